@@ -0,0 +1,1472 @@
+
+_alarmtest:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+
+void periodic();
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	51                   	push   %ecx
+   e:	83 ec 14             	sub    $0x14,%esp
+    long i;
+    printf(1, "alarmtest starting\n");
+  11:	83 ec 08             	sub    $0x8,%esp
+  14:	68 dc 0a 00 00       	push   $0xadc
+  19:	6a 01                	push   $0x1
+  1b:	e8 03 07 00 00       	call   723 <printf>
+  20:	83 c4 10             	add    $0x10,%esp
+    if(alarm(10, periodic) < 0){
+  23:	83 ec 08             	sub    $0x8,%esp
+  26:	68 a0 00 00 00       	push   $0xa0
+  2b:	6a 0a                	push   $0xa
+  2d:	e8 06 06 00 00       	call   638 <alarm>
+  32:	83 c4 10             	add    $0x10,%esp
+  35:	85 c0                	test   %eax,%eax
+  37:	79 12                	jns    4b <main+0x4b>
+        printf(1, "alarm failed");
+  39:	83 ec 08             	sub    $0x8,%esp
+  3c:	68 f0 0a 00 00       	push   $0xaf0
+  41:	6a 01                	push   $0x1
+  43:	e8 db 06 00 00       	call   723 <printf>
+  48:	83 c4 10             	add    $0x10,%esp
+    }
+    for(i = 0; i < 25*5000000; i++){
+  4b:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  52:	eb 3e                	jmp    92 <main+0x92>
+        if((i % 250000) == 0)
+  54:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+  57:	ba 83 de 1b 43       	mov    $0x431bde83,%edx
+  5c:	89 c8                	mov    %ecx,%eax
+  5e:	f7 ea                	imul   %edx
+  60:	89 d0                	mov    %edx,%eax
+  62:	c1 f8 10             	sar    $0x10,%eax
+  65:	89 ca                	mov    %ecx,%edx
+  67:	c1 fa 1f             	sar    $0x1f,%edx
+  6a:	29 d0                	sub    %edx,%eax
+  6c:	69 d0 90 d0 03 00    	imul   $0x3d090,%eax,%edx
+  72:	89 c8                	mov    %ecx,%eax
+  74:	29 d0                	sub    %edx,%eax
+  76:	85 c0                	test   %eax,%eax
+  78:	75 14                	jne    8e <main+0x8e>
+        write(2, ".", 1);
+  7a:	83 ec 04             	sub    $0x4,%esp
+  7d:	6a 01                	push   $0x1
+  7f:	68 fd 0a 00 00       	push   $0xafd
+  84:	6a 02                	push   $0x2
+  86:	e8 b9 03 00 00       	call   444 <write>
+  8b:	83 c4 10             	add    $0x10,%esp
+    for(i = 0; i < 25*5000000; i++){
+  8e:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+  92:	81 7d f4 3f 59 73 07 	cmpl   $0x773593f,-0xc(%ebp)
+  99:	7e b9                	jle    54 <main+0x54>
+    }
+    exit();
+  9b:	e8 85 03 00 00       	call   425 <exit>
+
+000000a0 <periodic>:
+}
+
+void
+periodic()
+{
+  a0:	55                   	push   %ebp
+  a1:	89 e5                	mov    %esp,%ebp
+  a3:	83 ec 28             	sub    $0x28,%esp
+    int a = 0;
+  a6:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    int b = 1;
+  ad:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    int c = 2;
+  b4:	c7 45 ec 02 00 00 00 	movl   $0x2,-0x14(%ebp)
+    int d = 3;
+  bb:	c7 45 e8 03 00 00 00 	movl   $0x3,-0x18(%ebp)
+    int e, f, g, h;
+    e = a + b;
+  c2:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  c5:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  c8:	01 d0                	add    %edx,%eax
+  ca:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    f = a + c;
+  cd:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  d0:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  d3:	01 d0                	add    %edx,%eax
+  d5:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    g = c + d;
+  d8:	8b 55 ec             	mov    -0x14(%ebp),%edx
+  db:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  de:	01 d0                	add    %edx,%eax
+  e0:	89 45 dc             	mov    %eax,-0x24(%ebp)
+    h = b + c;
+  e3:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  e6:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  e9:	01 d0                	add    %edx,%eax
+  eb:	89 45 d8             	mov    %eax,-0x28(%ebp)
+    printf(1, "alarm! %d %d %d %d %d %d %d %d\n", a, b, c, d, e, f, g, h);
+  ee:	83 ec 08             	sub    $0x8,%esp
+  f1:	ff 75 d8             	push   -0x28(%ebp)
+  f4:	ff 75 dc             	push   -0x24(%ebp)
+  f7:	ff 75 e0             	push   -0x20(%ebp)
+  fa:	ff 75 e4             	push   -0x1c(%ebp)
+  fd:	ff 75 e8             	push   -0x18(%ebp)
+ 100:	ff 75 ec             	push   -0x14(%ebp)
+ 103:	ff 75 f0             	push   -0x10(%ebp)
+ 106:	ff 75 f4             	push   -0xc(%ebp)
+ 109:	68 00 0b 00 00       	push   $0xb00
+ 10e:	6a 01                	push   $0x1
+ 110:	e8 0e 06 00 00       	call   723 <printf>
+ 115:	83 c4 30             	add    $0x30,%esp
+ 118:	90                   	nop
+ 119:	c9                   	leave
+ 11a:	c3                   	ret
+
+0000011b <stosb>:
+strchr(const char *s, char c)
+{
+    for(; *s; s++)
+        if(*s == c)
+            return (char*)s;
+    return 0;
+ 11b:	55                   	push   %ebp
+ 11c:	89 e5                	mov    %esp,%ebp
+ 11e:	57                   	push   %edi
+ 11f:	53                   	push   %ebx
+}
+ 120:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 123:	8b 55 10             	mov    0x10(%ebp),%edx
+ 126:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 129:	89 cb                	mov    %ecx,%ebx
+ 12b:	89 df                	mov    %ebx,%edi
+ 12d:	89 d1                	mov    %edx,%ecx
+ 12f:	fc                   	cld
+ 130:	f3 aa                	rep stos %al,%es:(%edi)
+ 132:	89 ca                	mov    %ecx,%edx
+ 134:	89 fb                	mov    %edi,%ebx
+ 136:	89 5d 08             	mov    %ebx,0x8(%ebp)
+ 139:	89 55 10             	mov    %edx,0x10(%ebp)
+
+char*
+gets(char *buf, int max)
+{
+ 13c:	90                   	nop
+ 13d:	5b                   	pop    %ebx
+ 13e:	5f                   	pop    %edi
+ 13f:	5d                   	pop    %ebp
+ 140:	c3                   	ret
+
+00000141 <strcpy>:
+{
+ 141:	55                   	push   %ebp
+ 142:	89 e5                	mov    %esp,%ebp
+ 144:	83 ec 10             	sub    $0x10,%esp
+    os = s;
+ 147:	8b 45 08             	mov    0x8(%ebp),%eax
+ 14a:	89 45 fc             	mov    %eax,-0x4(%ebp)
+    while((*s++ = *t++) != 0)
+ 14d:	90                   	nop
+ 14e:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 151:	8d 42 01             	lea    0x1(%edx),%eax
+ 154:	89 45 0c             	mov    %eax,0xc(%ebp)
+ 157:	8b 45 08             	mov    0x8(%ebp),%eax
+ 15a:	8d 48 01             	lea    0x1(%eax),%ecx
+ 15d:	89 4d 08             	mov    %ecx,0x8(%ebp)
+ 160:	0f b6 12             	movzbl (%edx),%edx
+ 163:	88 10                	mov    %dl,(%eax)
+ 165:	0f b6 00             	movzbl (%eax),%eax
+ 168:	84 c0                	test   %al,%al
+ 16a:	75 e2                	jne    14e <strcpy+0xd>
+    return os;
+ 16c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 16f:	c9                   	leave
+ 170:	c3                   	ret
+
+00000171 <strcmp>:
+{
+ 171:	55                   	push   %ebp
+ 172:	89 e5                	mov    %esp,%ebp
+    while(*p && *p == *q)
+ 174:	eb 08                	jmp    17e <strcmp+0xd>
+        p++, q++;
+ 176:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 17a:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+    while(*p && *p == *q)
+ 17e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 181:	0f b6 00             	movzbl (%eax),%eax
+ 184:	84 c0                	test   %al,%al
+ 186:	74 10                	je     198 <strcmp+0x27>
+ 188:	8b 45 08             	mov    0x8(%ebp),%eax
+ 18b:	0f b6 10             	movzbl (%eax),%edx
+ 18e:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 191:	0f b6 00             	movzbl (%eax),%eax
+ 194:	38 c2                	cmp    %al,%dl
+ 196:	74 de                	je     176 <strcmp+0x5>
+    return (uchar)*p - (uchar)*q;
+ 198:	8b 45 08             	mov    0x8(%ebp),%eax
+ 19b:	0f b6 00             	movzbl (%eax),%eax
+ 19e:	0f b6 d0             	movzbl %al,%edx
+ 1a1:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 1a4:	0f b6 00             	movzbl (%eax),%eax
+ 1a7:	0f b6 c0             	movzbl %al,%eax
+ 1aa:	29 c2                	sub    %eax,%edx
+ 1ac:	89 d0                	mov    %edx,%eax
+}
+ 1ae:	5d                   	pop    %ebp
+ 1af:	c3                   	ret
+
+000001b0 <strlen>:
+{
+ 1b0:	55                   	push   %ebp
+ 1b1:	89 e5                	mov    %esp,%ebp
+ 1b3:	83 ec 10             	sub    $0x10,%esp
+    for(n = 0; s[n]; n++)
+ 1b6:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ 1bd:	eb 04                	jmp    1c3 <strlen+0x13>
+ 1bf:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 1c3:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 1c6:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1c9:	01 d0                	add    %edx,%eax
+ 1cb:	0f b6 00             	movzbl (%eax),%eax
+ 1ce:	84 c0                	test   %al,%al
+ 1d0:	75 ed                	jne    1bf <strlen+0xf>
+    return n;
+ 1d2:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 1d5:	c9                   	leave
+ 1d6:	c3                   	ret
+
+000001d7 <memset>:
+{
+ 1d7:	55                   	push   %ebp
+ 1d8:	89 e5                	mov    %esp,%ebp
+    stosb(dst, c, n);
+ 1da:	8b 45 10             	mov    0x10(%ebp),%eax
+ 1dd:	50                   	push   %eax
+ 1de:	ff 75 0c             	push   0xc(%ebp)
+ 1e1:	ff 75 08             	push   0x8(%ebp)
+ 1e4:	e8 32 ff ff ff       	call   11b <stosb>
+ 1e9:	83 c4 0c             	add    $0xc,%esp
+    return dst;
+ 1ec:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 1ef:	c9                   	leave
+ 1f0:	c3                   	ret
+
+000001f1 <strchr>:
+{
+ 1f1:	55                   	push   %ebp
+ 1f2:	89 e5                	mov    %esp,%ebp
+ 1f4:	83 ec 04             	sub    $0x4,%esp
+ 1f7:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 1fa:	88 45 fc             	mov    %al,-0x4(%ebp)
+    for(; *s; s++)
+ 1fd:	eb 14                	jmp    213 <strchr+0x22>
+        if(*s == c)
+ 1ff:	8b 45 08             	mov    0x8(%ebp),%eax
+ 202:	0f b6 00             	movzbl (%eax),%eax
+ 205:	38 45 fc             	cmp    %al,-0x4(%ebp)
+ 208:	75 05                	jne    20f <strchr+0x1e>
+            return (char*)s;
+ 20a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 20d:	eb 13                	jmp    222 <strchr+0x31>
+    for(; *s; s++)
+ 20f:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 213:	8b 45 08             	mov    0x8(%ebp),%eax
+ 216:	0f b6 00             	movzbl (%eax),%eax
+ 219:	84 c0                	test   %al,%al
+ 21b:	75 e2                	jne    1ff <strchr+0xe>
+    return 0;
+ 21d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 222:	c9                   	leave
+ 223:	c3                   	ret
+
+00000224 <gets>:
+{
+ 224:	55                   	push   %ebp
+ 225:	89 e5                	mov    %esp,%ebp
+ 227:	83 ec 18             	sub    $0x18,%esp
+    int i, cc;
+    char c;
+
+    for(i=0; i+1 < max; ){
+ 22a:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 231:	eb 42                	jmp    275 <gets+0x51>
+        cc = read(0, &c, 1);
+ 233:	83 ec 04             	sub    $0x4,%esp
+ 236:	6a 01                	push   $0x1
+ 238:	8d 45 ef             	lea    -0x11(%ebp),%eax
+ 23b:	50                   	push   %eax
+ 23c:	6a 00                	push   $0x0
+ 23e:	e8 f7 01 00 00       	call   43a <read>
+ 243:	83 c4 10             	add    $0x10,%esp
+ 246:	89 45 f0             	mov    %eax,-0x10(%ebp)
+        if(cc < 1)
+ 249:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 24d:	7e 33                	jle    282 <gets+0x5e>
+            break;
+        buf[i++] = c;
+ 24f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 252:	8d 50 01             	lea    0x1(%eax),%edx
+ 255:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 258:	89 c2                	mov    %eax,%edx
+ 25a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 25d:	01 c2                	add    %eax,%edx
+ 25f:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 263:	88 02                	mov    %al,(%edx)
+        if(c == '\n' || c == '\r')
+ 265:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 269:	3c 0a                	cmp    $0xa,%al
+ 26b:	74 16                	je     283 <gets+0x5f>
+ 26d:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 271:	3c 0d                	cmp    $0xd,%al
+ 273:	74 0e                	je     283 <gets+0x5f>
+    for(i=0; i+1 < max; ){
+ 275:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 278:	83 c0 01             	add    $0x1,%eax
+ 27b:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 27e:	7f b3                	jg     233 <gets+0xf>
+ 280:	eb 01                	jmp    283 <gets+0x5f>
+            break;
+ 282:	90                   	nop
+            break;
+    }
+    buf[i] = '\0';
+ 283:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 286:	8b 45 08             	mov    0x8(%ebp),%eax
+ 289:	01 d0                	add    %edx,%eax
+ 28b:	c6 00 00             	movb   $0x0,(%eax)
+    return buf;
+ 28e:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 291:	c9                   	leave
+ 292:	c3                   	ret
+
+00000293 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 293:	55                   	push   %ebp
+ 294:	89 e5                	mov    %esp,%ebp
+ 296:	83 ec 18             	sub    $0x18,%esp
+    int fd;
+    int r;
+
+    fd = open(n, O_RDONLY);
+ 299:	83 ec 08             	sub    $0x8,%esp
+ 29c:	6a 00                	push   $0x0
+ 29e:	ff 75 08             	push   0x8(%ebp)
+ 2a1:	e8 c6 01 00 00       	call   46c <open>
+ 2a6:	83 c4 10             	add    $0x10,%esp
+ 2a9:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(fd < 0)
+ 2ac:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 2b0:	79 07                	jns    2b9 <stat+0x26>
+        return -1;
+ 2b2:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 2b7:	eb 25                	jmp    2de <stat+0x4b>
+    r = fstat(fd, st);
+ 2b9:	83 ec 08             	sub    $0x8,%esp
+ 2bc:	ff 75 0c             	push   0xc(%ebp)
+ 2bf:	ff 75 f4             	push   -0xc(%ebp)
+ 2c2:	e8 c3 01 00 00       	call   48a <fstat>
+ 2c7:	83 c4 10             	add    $0x10,%esp
+ 2ca:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    close(fd);
+ 2cd:	83 ec 0c             	sub    $0xc,%esp
+ 2d0:	ff 75 f4             	push   -0xc(%ebp)
+ 2d3:	e8 76 01 00 00       	call   44e <close>
+ 2d8:	83 c4 10             	add    $0x10,%esp
+    return r;
+ 2db:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ 2de:	c9                   	leave
+ 2df:	c3                   	ret
+
+000002e0 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 2e0:	55                   	push   %ebp
+ 2e1:	89 e5                	mov    %esp,%ebp
+ 2e3:	83 ec 10             	sub    $0x10,%esp
+    int n;
+
+    n = 0;
+ 2e6:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+    while('0' <= *s && *s <= '9')
+ 2ed:	eb 25                	jmp    314 <atoi+0x34>
+        n = n*10 + *s++ - '0';
+ 2ef:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 2f2:	89 d0                	mov    %edx,%eax
+ 2f4:	c1 e0 02             	shl    $0x2,%eax
+ 2f7:	01 d0                	add    %edx,%eax
+ 2f9:	01 c0                	add    %eax,%eax
+ 2fb:	89 c1                	mov    %eax,%ecx
+ 2fd:	8b 45 08             	mov    0x8(%ebp),%eax
+ 300:	8d 50 01             	lea    0x1(%eax),%edx
+ 303:	89 55 08             	mov    %edx,0x8(%ebp)
+ 306:	0f b6 00             	movzbl (%eax),%eax
+ 309:	0f be c0             	movsbl %al,%eax
+ 30c:	01 c8                	add    %ecx,%eax
+ 30e:	83 e8 30             	sub    $0x30,%eax
+ 311:	89 45 fc             	mov    %eax,-0x4(%ebp)
+    while('0' <= *s && *s <= '9')
+ 314:	8b 45 08             	mov    0x8(%ebp),%eax
+ 317:	0f b6 00             	movzbl (%eax),%eax
+ 31a:	3c 2f                	cmp    $0x2f,%al
+ 31c:	7e 0a                	jle    328 <atoi+0x48>
+ 31e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 321:	0f b6 00             	movzbl (%eax),%eax
+ 324:	3c 39                	cmp    $0x39,%al
+ 326:	7e c7                	jle    2ef <atoi+0xf>
+    return n;
+ 328:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 32b:	c9                   	leave
+ 32c:	c3                   	ret
+
+0000032d <nice>:
+
+// Add inc to the caller's nice value; return the new value.
+int
+nice(int inc)
+{
+ 32d:	55                   	push   %ebp
+ 32e:	89 e5                	mov    %esp,%ebp
+ 330:	83 ec 18             	sub    $0x18,%esp
+    int n;
+
+    n = getpriority(0) + inc;
+ 333:	83 ec 0c             	sub    $0xc,%esp
+ 336:	6a 00                	push   $0x0
+ 338:	e8 d9 01 00 00       	call   516 <getpriority>
+ 33d:	83 c4 10             	add    $0x10,%esp
+ 340:	8b 55 08             	mov    0x8(%ebp),%edx
+ 343:	01 d0                	add    %edx,%eax
+ 345:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(n < 0)
+ 348:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 34c:	79 07                	jns    355 <nice+0x28>
+        n = 0;
+ 34e:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    if(n > NICEMAX)
+ 355:	83 7d f4 13          	cmpl   $0x13,-0xc(%ebp)
+ 359:	7e 07                	jle    362 <nice+0x35>
+        n = NICEMAX;
+ 35b:	c7 45 f4 13 00 00 00 	movl   $0x13,-0xc(%ebp)
+    if(setpriority(0, n) < 0)
+ 362:	83 ec 08             	sub    $0x8,%esp
+ 365:	ff 75 f4             	push   -0xc(%ebp)
+ 368:	6a 00                	push   $0x0
+ 36a:	e8 b1 01 00 00       	call   520 <setpriority>
+ 36f:	83 c4 10             	add    $0x10,%esp
+ 372:	85 c0                	test   %eax,%eax
+ 374:	79 07                	jns    37d <nice+0x50>
+        return -1;
+ 376:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 37b:	eb 03                	jmp    380 <nice+0x53>
+    return n;
+ 37d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+ 380:	c9                   	leave
+ 381:	c3                   	ret
+
+00000382 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 382:	55                   	push   %ebp
+ 383:	89 e5                	mov    %esp,%ebp
+ 385:	83 ec 10             	sub    $0x10,%esp
+    char *dst;
+    const char *src;
+
+    dst = vdst;
+ 388:	8b 45 08             	mov    0x8(%ebp),%eax
+ 38b:	89 45 fc             	mov    %eax,-0x4(%ebp)
+    src = vsrc;
+ 38e:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 391:	89 45 f8             	mov    %eax,-0x8(%ebp)
+    while(n-- > 0)
+ 394:	eb 17                	jmp    3ad <memmove+0x2b>
+        *dst++ = *src++;
+ 396:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 399:	8d 42 01             	lea    0x1(%edx),%eax
+ 39c:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 39f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 3a2:	8d 48 01             	lea    0x1(%eax),%ecx
+ 3a5:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+ 3a8:	0f b6 12             	movzbl (%edx),%edx
+ 3ab:	88 10                	mov    %dl,(%eax)
+    while(n-- > 0)
+ 3ad:	8b 45 10             	mov    0x10(%ebp),%eax
+ 3b0:	8d 50 ff             	lea    -0x1(%eax),%edx
+ 3b3:	89 55 10             	mov    %edx,0x10(%ebp)
+ 3b6:	85 c0                	test   %eax,%eax
+ 3b8:	7f dc                	jg     396 <memmove+0x14>
+    return vdst;
+ 3ba:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 3bd:	c9                   	leave
+ 3be:	c3                   	ret
+
+000003bf <dosyscall>:
+sysmode:
+    .long 0
+
+    .text
+dosyscall:
+    cmpl $0, sysmode
+ 3bf:	83 3d ac 0d 00 00 00 	cmpl   $0x0,0xdac
+    jg 2f
+ 3c6:	7f 0c                	jg     3d4 <dosyscall+0x15>
+    jl 1f
+ 3c8:	7c 07                	jl     3d1 <dosyscall+0x12>
+    call sepcheck
+ 3ca:	e8 27 00 00 00       	call   3f6 <sepcheck>
+    jmp dosyscall
+ 3cf:	eb ee                	jmp    3bf <dosyscall>
+1:
+    int $T_SYSCALL
+ 3d1:	cd 40                	int    $0x40
+    ret
+ 3d3:	c3                   	ret
+2:
+    pushl %ebx
+ 3d4:	53                   	push   %ebx
+    pushl %esi
+ 3d5:	56                   	push   %esi
+    pushl %edi
+ 3d6:	57                   	push   %edi
+    pushl %ebp
+ 3d7:	55                   	push   %ebp
+    movl 20(%esp), %ebx
+ 3d8:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+    movl 24(%esp), %esi
+ 3dc:	8b 74 24 18          	mov    0x18(%esp),%esi
+    movl 28(%esp), %edi
+ 3e0:	8b 7c 24 1c          	mov    0x1c(%esp),%edi
+    movl 32(%esp), %ebp
+ 3e4:	8b 6c 24 20          	mov    0x20(%esp),%ebp
+    movl %esp, %ecx
+ 3e8:	89 e1                	mov    %esp,%ecx
+    movl $3f, %edx
+ 3ea:	ba f1 03 00 00       	mov    $0x3f1,%edx
+    sysenter
+ 3ef:	0f 34                	sysenter
+3:
+    popl %ebp
+ 3f1:	5d                   	pop    %ebp
+    popl %edi
+ 3f2:	5f                   	pop    %edi
+    popl %esi
+ 3f3:	5e                   	pop    %esi
+    popl %ebx
+ 3f4:	5b                   	pop    %ebx
+    ret
+ 3f5:	c3                   	ret
+
+000003f6 <sepcheck>:
+
+# Set sysmode from cpuid's SEP flag.    Preserves %eax.
+sepcheck:
+    pushl %eax
+ 3f6:	50                   	push   %eax
+    pushl %ebx
+ 3f7:	53                   	push   %ebx
+    movl $1, %eax
+ 3f8:	b8 01 00 00 00       	mov    $0x1,%eax
+    cpuid
+ 3fd:	0f a2                	cpuid
+    movl $-1, sysmode
+ 3ff:	c7 05 ac 0d 00 00 ff 	movl   $0xffffffff,0xdac
+ 406:	ff ff ff 
+    testl $0x800, %edx
+ 409:	f7 c2 00 08 00 00    	test   $0x800,%edx
+    jz 1f
+ 40f:	74 0a                	je     41b <sepcheck+0x25>
+    movl $1, sysmode
+ 411:	c7 05 ac 0d 00 00 01 	movl   $0x1,0xdac
+ 418:	00 00 00 
+1:
+    popl %ebx
+ 41b:	5b                   	pop    %ebx
+    popl %eax
+ 41c:	58                   	pop    %eax
+    ret
+ 41d:	c3                   	ret
+
+0000041e <fork>:
+
+SYSCALL(fork)
+ 41e:	b8 01 00 00 00       	mov    $0x1,%eax
+ 423:	eb 9a                	jmp    3bf <dosyscall>
+
+00000425 <exit>:
+SYSCALL(exit)
+ 425:	b8 02 00 00 00       	mov    $0x2,%eax
+ 42a:	eb 93                	jmp    3bf <dosyscall>
+
+0000042c <wait>:
+SYSCALL(wait)
+ 42c:	b8 03 00 00 00       	mov    $0x3,%eax
+ 431:	eb 8c                	jmp    3bf <dosyscall>
+
+00000433 <pipe>:
+SYSCALL(pipe)
+ 433:	b8 04 00 00 00       	mov    $0x4,%eax
+ 438:	eb 85                	jmp    3bf <dosyscall>
+
+0000043a <read>:
+SYSCALL(read)
+ 43a:	b8 05 00 00 00       	mov    $0x5,%eax
+ 43f:	e9 7b ff ff ff       	jmp    3bf <dosyscall>
+
+00000444 <write>:
+SYSCALL(write)
+ 444:	b8 10 00 00 00       	mov    $0x10,%eax
+ 449:	e9 71 ff ff ff       	jmp    3bf <dosyscall>
+
+0000044e <close>:
+SYSCALL(close)
+ 44e:	b8 15 00 00 00       	mov    $0x15,%eax
+ 453:	e9 67 ff ff ff       	jmp    3bf <dosyscall>
+
+00000458 <kill>:
+SYSCALL(kill)
+ 458:	b8 06 00 00 00       	mov    $0x6,%eax
+ 45d:	e9 5d ff ff ff       	jmp    3bf <dosyscall>
+
+00000462 <exec>:
+SYSCALL(exec)
+ 462:	b8 07 00 00 00       	mov    $0x7,%eax
+ 467:	e9 53 ff ff ff       	jmp    3bf <dosyscall>
+
+0000046c <open>:
+SYSCALL(open)
+ 46c:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 471:	e9 49 ff ff ff       	jmp    3bf <dosyscall>
+
+00000476 <mknod>:
+SYSCALL(mknod)
+ 476:	b8 11 00 00 00       	mov    $0x11,%eax
+ 47b:	e9 3f ff ff ff       	jmp    3bf <dosyscall>
+
+00000480 <unlink>:
+SYSCALL(unlink)
+ 480:	b8 12 00 00 00       	mov    $0x12,%eax
+ 485:	e9 35 ff ff ff       	jmp    3bf <dosyscall>
+
+0000048a <fstat>:
+SYSCALL(fstat)
+ 48a:	b8 08 00 00 00       	mov    $0x8,%eax
+ 48f:	e9 2b ff ff ff       	jmp    3bf <dosyscall>
+
+00000494 <link>:
+SYSCALL(link)
+ 494:	b8 13 00 00 00       	mov    $0x13,%eax
+ 499:	e9 21 ff ff ff       	jmp    3bf <dosyscall>
+
+0000049e <mkdir>:
+SYSCALL(mkdir)
+ 49e:	b8 14 00 00 00       	mov    $0x14,%eax
+ 4a3:	e9 17 ff ff ff       	jmp    3bf <dosyscall>
+
+000004a8 <chdir>:
+SYSCALL(chdir)
+ 4a8:	b8 09 00 00 00       	mov    $0x9,%eax
+ 4ad:	e9 0d ff ff ff       	jmp    3bf <dosyscall>
+
+000004b2 <dup>:
+SYSCALL(dup)
+ 4b2:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 4b7:	e9 03 ff ff ff       	jmp    3bf <dosyscall>
+
+000004bc <getpid>:
+SYSCALL(getpid)
+ 4bc:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 4c1:	e9 f9 fe ff ff       	jmp    3bf <dosyscall>
+
+000004c6 <sbrk>:
+SYSCALL(sbrk)
+ 4c6:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 4cb:	e9 ef fe ff ff       	jmp    3bf <dosyscall>
+
+000004d0 <sleep>:
+SYSCALL(sleep)
+ 4d0:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 4d5:	e9 e5 fe ff ff       	jmp    3bf <dosyscall>
+
+000004da <uptime>:
+SYSCALL(uptime)
+ 4da:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 4df:	e9 db fe ff ff       	jmp    3bf <dosyscall>
+
+000004e4 <date>:
+SYSCALL(date)
+ 4e4:	b8 16 00 00 00       	mov    $0x16,%eax
+ 4e9:	e9 d1 fe ff ff       	jmp    3bf <dosyscall>
+
+000004ee <dup2>:
+SYSCALL(dup2)
+ 4ee:	b8 17 00 00 00       	mov    $0x17,%eax
+ 4f3:	e9 c7 fe ff ff       	jmp    3bf <dosyscall>
+
+000004f8 <uffd>:
+SYSCALL(uffd)
+ 4f8:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 4fd:	e9 bd fe ff ff       	jmp    3bf <dosyscall>
+
+00000502 <uffdregister>:
+SYSCALL(uffdregister)
+ 502:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 507:	e9 b3 fe ff ff       	jmp    3bf <dosyscall>
+
+0000050c <uffdcopy>:
+SYSCALL(uffdcopy)
+ 50c:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 511:	e9 a9 fe ff ff       	jmp    3bf <dosyscall>
+
+00000516 <getpriority>:
+SYSCALL(getpriority)
+ 516:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 51b:	e9 9f fe ff ff       	jmp    3bf <dosyscall>
+
+00000520 <setpriority>:
+SYSCALL(setpriority)
+ 520:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 525:	e9 95 fe ff ff       	jmp    3bf <dosyscall>
+
+0000052a <setweight>:
+SYSCALL(setweight)
+ 52a:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 52f:	e9 8b fe ff ff       	jmp    3bf <dosyscall>
+
+00000534 <setgroup>:
+SYSCALL(setgroup)
+ 534:	b8 20 00 00 00       	mov    $0x20,%eax
+ 539:	e9 81 fe ff ff       	jmp    3bf <dosyscall>
+
+0000053e <schedinfo>:
+SYSCALL(schedinfo)
+ 53e:	b8 21 00 00 00       	mov    $0x21,%eax
+ 543:	e9 77 fe ff ff       	jmp    3bf <dosyscall>
+
+00000548 <nanosleep>:
+SYSCALL(nanosleep)
+ 548:	b8 22 00 00 00       	mov    $0x22,%eax
+ 54d:	e9 6d fe ff ff       	jmp    3bf <dosyscall>
+
+00000552 <clock_nanosleep>:
+SYSCALL(clock_nanosleep)
+ 552:	b8 23 00 00 00       	mov    $0x23,%eax
+ 557:	e9 63 fe ff ff       	jmp    3bf <dosyscall>
+
+0000055c <clock_gettime>:
+SYSCALL(clock_gettime)
+ 55c:	b8 24 00 00 00       	mov    $0x24,%eax
+ 561:	e9 59 fe ff ff       	jmp    3bf <dosyscall>
+
+00000566 <sched_setaffinity>:
+SYSCALL(sched_setaffinity)
+ 566:	b8 25 00 00 00       	mov    $0x25,%eax
+ 56b:	e9 4f fe ff ff       	jmp    3bf <dosyscall>
+
+00000570 <sched_getaffinity>:
+SYSCALL(sched_getaffinity)
+ 570:	b8 26 00 00 00       	mov    $0x26,%eax
+ 575:	e9 45 fe ff ff       	jmp    3bf <dosyscall>
+
+0000057a <irqaffinity>:
+SYSCALL(irqaffinity)
+ 57a:	b8 27 00 00 00       	mov    $0x27,%eax
+ 57f:	e9 3b fe ff ff       	jmp    3bf <dosyscall>
+
+00000584 <getrusage>:
+SYSCALL(getrusage)
+ 584:	b8 28 00 00 00       	mov    $0x28,%eax
+ 589:	e9 31 fe ff ff       	jmp    3bf <dosyscall>
+
+0000058e <times>:
+SYSCALL(times)
+ 58e:	b8 29 00 00 00       	mov    $0x29,%eax
+ 593:	e9 27 fe ff ff       	jmp    3bf <dosyscall>
+
+00000598 <schedlat>:
+SYSCALL(schedlat)
+ 598:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 59d:	e9 1d fe ff ff       	jmp    3bf <dosyscall>
+
+000005a2 <sched_setscheduler>:
+SYSCALL(sched_setscheduler)
+ 5a2:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 5a7:	e9 13 fe ff ff       	jmp    3bf <dosyscall>
+
+000005ac <sched_getscheduler>:
+SYSCALL(sched_getscheduler)
+ 5ac:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 5b1:	e9 09 fe ff ff       	jmp    3bf <dosyscall>
+
+000005b6 <sched_getparam>:
+SYSCALL(sched_getparam)
+ 5b6:	b8 2d 00 00 00       	mov    $0x2d,%eax
+ 5bb:	e9 ff fd ff ff       	jmp    3bf <dosyscall>
+
+000005c0 <lockstat>:
+SYSCALL(lockstat)
+ 5c0:	b8 2e 00 00 00       	mov    $0x2e,%eax
+ 5c5:	e9 f5 fd ff ff       	jmp    3bf <dosyscall>
+
+000005ca <ioring_setup>:
+SYSCALL(ioring_setup)
+ 5ca:	b8 2f 00 00 00       	mov    $0x2f,%eax
+ 5cf:	e9 eb fd ff ff       	jmp    3bf <dosyscall>
+
+000005d4 <ioring_enter>:
+SYSCALL(ioring_enter)
+ 5d4:	b8 30 00 00 00       	mov    $0x30,%eax
+ 5d9:	e9 e1 fd ff ff       	jmp    3bf <dosyscall>
+
+000005de <readv>:
+SYSCALL(readv)
+ 5de:	b8 31 00 00 00       	mov    $0x31,%eax
+ 5e3:	e9 d7 fd ff ff       	jmp    3bf <dosyscall>
+
+000005e8 <writev>:
+SYSCALL(writev)
+ 5e8:	b8 32 00 00 00       	mov    $0x32,%eax
+ 5ed:	e9 cd fd ff ff       	jmp    3bf <dosyscall>
+
+000005f2 <pread>:
+SYSCALL(pread)
+ 5f2:	b8 33 00 00 00       	mov    $0x33,%eax
+ 5f7:	e9 c3 fd ff ff       	jmp    3bf <dosyscall>
+
+000005fc <pwrite>:
+SYSCALL(pwrite)
+ 5fc:	b8 34 00 00 00       	mov    $0x34,%eax
+ 601:	e9 b9 fd ff ff       	jmp    3bf <dosyscall>
+
+00000606 <sendfile>:
+SYSCALL(sendfile)
+ 606:	b8 35 00 00 00       	mov    $0x35,%eax
+ 60b:	e9 af fd ff ff       	jmp    3bf <dosyscall>
+
+00000610 <splice>:
+SYSCALL(splice)
+ 610:	b8 36 00 00 00       	mov    $0x36,%eax
+ 615:	e9 a5 fd ff ff       	jmp    3bf <dosyscall>
+
+0000061a <sysstat>:
+SYSCALL(sysstat)
+ 61a:	b8 37 00 00 00       	mov    $0x37,%eax
+ 61f:	e9 9b fd ff ff       	jmp    3bf <dosyscall>
+
+00000624 <strace>:
+SYSCALL(strace)
+ 624:	b8 38 00 00 00       	mov    $0x38,%eax
+ 629:	e9 91 fd ff ff       	jmp    3bf <dosyscall>
+
+0000062e <straceread>:
+SYSCALL(straceread)
+ 62e:	b8 39 00 00 00       	mov    $0x39,%eax
+ 633:	e9 87 fd ff ff       	jmp    3bf <dosyscall>
+
+00000638 <alarm>:
+
+# alarm and rstoregs keep to int $T_SYSCALL: rstoregs restores
+# %ecx and %edx, which sysexit would clobber.
+.globl alarm
+    alarm:
+        pushl $rstoregs
+ 638:	68 48 06 00 00       	push   $0x648
+        movl $SYS_alarm, %eax
+ 63d:	b8 18 00 00 00       	mov    $0x18,%eax
+        int $T_SYSCALL
+ 642:	cd 40                	int    $0x40
+        add $0x04, %esp
+ 644:	83 c4 04             	add    $0x4,%esp
+        ret
+ 647:	c3                   	ret
+
+00000648 <rstoregs>:
+
+.globl rstoregs
+    rstoregs:
+        movl $SYS_rstoregs, %eax
+ 648:	b8 19 00 00 00       	mov    $0x19,%eax
+        int $T_SYSCALL
+ 64d:	cd 40                	int    $0x40
+
+0000064f <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 64f:	55                   	push   %ebp
+ 650:	89 e5                	mov    %esp,%ebp
+ 652:	83 ec 18             	sub    $0x18,%esp
+ 655:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 658:	88 45 f4             	mov    %al,-0xc(%ebp)
+    write(fd, &c, 1);
+ 65b:	83 ec 04             	sub    $0x4,%esp
+ 65e:	6a 01                	push   $0x1
+ 660:	8d 45 f4             	lea    -0xc(%ebp),%eax
+ 663:	50                   	push   %eax
+ 664:	ff 75 08             	push   0x8(%ebp)
+ 667:	e8 d8 fd ff ff       	call   444 <write>
+ 66c:	83 c4 10             	add    $0x10,%esp
+}
+ 66f:	90                   	nop
+ 670:	c9                   	leave
+ 671:	c3                   	ret
+
+00000672 <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 672:	55                   	push   %ebp
+ 673:	89 e5                	mov    %esp,%ebp
+ 675:	83 ec 28             	sub    $0x28,%esp
+    static char digits[] = "0123456789ABCDEF";
+    char buf[16];
+    int i, neg;
+    uint x;
+
+    neg = 0;
+ 678:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+    if(sgn && xx < 0){
+ 67f:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+ 683:	74 17                	je     69c <printint+0x2a>
+ 685:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 689:	79 11                	jns    69c <printint+0x2a>
+        neg = 1;
+ 68b:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+        x = -xx;
+ 692:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 695:	f7 d8                	neg    %eax
+ 697:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 69a:	eb 06                	jmp    6a2 <printint+0x30>
+    } else {
+        x = xx;
+ 69c:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 69f:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    }
+
+    i = 0;
+ 6a2:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    do{
+        buf[i++] = digits[x % base];
+ 6a9:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 6ac:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 6af:	ba 00 00 00 00       	mov    $0x0,%edx
+ 6b4:	f7 f1                	div    %ecx
+ 6b6:	89 d1                	mov    %edx,%ecx
+ 6b8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 6bb:	8d 50 01             	lea    0x1(%eax),%edx
+ 6be:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 6c1:	0f b6 91 b0 0d 00 00 	movzbl 0xdb0(%ecx),%edx
+ 6c8:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+    }while((x /= base) != 0);
+ 6cc:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 6cf:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 6d2:	ba 00 00 00 00       	mov    $0x0,%edx
+ 6d7:	f7 f1                	div    %ecx
+ 6d9:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 6dc:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 6e0:	75 c7                	jne    6a9 <printint+0x37>
+    if(neg)
+ 6e2:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 6e6:	74 2d                	je     715 <printint+0xa3>
+        buf[i++] = '-';
+ 6e8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 6eb:	8d 50 01             	lea    0x1(%eax),%edx
+ 6ee:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 6f1:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+    while(--i >= 0)
+ 6f6:	eb 1d                	jmp    715 <printint+0xa3>
+        putc(fd, buf[i]);
+ 6f8:	8d 55 dc             	lea    -0x24(%ebp),%edx
+ 6fb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 6fe:	01 d0                	add    %edx,%eax
+ 700:	0f b6 00             	movzbl (%eax),%eax
+ 703:	0f be c0             	movsbl %al,%eax
+ 706:	83 ec 08             	sub    $0x8,%esp
+ 709:	50                   	push   %eax
+ 70a:	ff 75 08             	push   0x8(%ebp)
+ 70d:	e8 3d ff ff ff       	call   64f <putc>
+ 712:	83 c4 10             	add    $0x10,%esp
+    while(--i >= 0)
+ 715:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+ 719:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 71d:	79 d9                	jns    6f8 <printint+0x86>
+}
+ 71f:	90                   	nop
+ 720:	90                   	nop
+ 721:	c9                   	leave
+ 722:	c3                   	ret
+
+00000723 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 723:	55                   	push   %ebp
+ 724:	89 e5                	mov    %esp,%ebp
+ 726:	83 ec 28             	sub    $0x28,%esp
+    char *s;
+    int c, i, state;
+    uint *ap;
+
+    state = 0;
+ 729:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+    ap = (uint*)(void*)&fmt + 1;
+ 730:	8d 45 0c             	lea    0xc(%ebp),%eax
+ 733:	83 c0 04             	add    $0x4,%eax
+ 736:	89 45 e8             	mov    %eax,-0x18(%ebp)
+    for(i = 0; fmt[i]; i++){
+ 739:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 740:	e9 59 01 00 00       	jmp    89e <printf+0x17b>
+        c = fmt[i] & 0xff;
+ 745:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 748:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 74b:	01 d0                	add    %edx,%eax
+ 74d:	0f b6 00             	movzbl (%eax),%eax
+ 750:	0f be c0             	movsbl %al,%eax
+ 753:	25 ff 00 00 00       	and    $0xff,%eax
+ 758:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        if(state == 0){
+ 75b:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 75f:	75 2c                	jne    78d <printf+0x6a>
+            if(c == '%'){
+ 761:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 765:	75 0c                	jne    773 <printf+0x50>
+                state = '%';
+ 767:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+ 76e:	e9 27 01 00 00       	jmp    89a <printf+0x177>
+            } else {
+                putc(fd, c);
+ 773:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 776:	0f be c0             	movsbl %al,%eax
+ 779:	83 ec 08             	sub    $0x8,%esp
+ 77c:	50                   	push   %eax
+ 77d:	ff 75 08             	push   0x8(%ebp)
+ 780:	e8 ca fe ff ff       	call   64f <putc>
+ 785:	83 c4 10             	add    $0x10,%esp
+ 788:	e9 0d 01 00 00       	jmp    89a <printf+0x177>
+            }
+        } else if(state == '%'){
+ 78d:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+ 791:	0f 85 03 01 00 00    	jne    89a <printf+0x177>
+            if(c == 'd'){
+ 797:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+ 79b:	75 1e                	jne    7bb <printf+0x98>
+                printint(fd, *ap, 10, 1);
+ 79d:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 7a0:	8b 00                	mov    (%eax),%eax
+ 7a2:	6a 01                	push   $0x1
+ 7a4:	6a 0a                	push   $0xa
+ 7a6:	50                   	push   %eax
+ 7a7:	ff 75 08             	push   0x8(%ebp)
+ 7aa:	e8 c3 fe ff ff       	call   672 <printint>
+ 7af:	83 c4 10             	add    $0x10,%esp
+                ap++;
+ 7b2:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 7b6:	e9 d8 00 00 00       	jmp    893 <printf+0x170>
+            } else if(c == 'x' || c == 'p'){
+ 7bb:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+ 7bf:	74 06                	je     7c7 <printf+0xa4>
+ 7c1:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+ 7c5:	75 1e                	jne    7e5 <printf+0xc2>
+                printint(fd, *ap, 16, 0);
+ 7c7:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 7ca:	8b 00                	mov    (%eax),%eax
+ 7cc:	6a 00                	push   $0x0
+ 7ce:	6a 10                	push   $0x10
+ 7d0:	50                   	push   %eax
+ 7d1:	ff 75 08             	push   0x8(%ebp)
+ 7d4:	e8 99 fe ff ff       	call   672 <printint>
+ 7d9:	83 c4 10             	add    $0x10,%esp
+                ap++;
+ 7dc:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 7e0:	e9 ae 00 00 00       	jmp    893 <printf+0x170>
+            } else if(c == 's'){
+ 7e5:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+ 7e9:	75 43                	jne    82e <printf+0x10b>
+                s = (char*)*ap;
+ 7eb:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 7ee:	8b 00                	mov    (%eax),%eax
+ 7f0:	89 45 f4             	mov    %eax,-0xc(%ebp)
+                ap++;
+ 7f3:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+                if(s == 0)
+ 7f7:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 7fb:	75 25                	jne    822 <printf+0xff>
+                    s = "(null)";
+ 7fd:	c7 45 f4 20 0b 00 00 	movl   $0xb20,-0xc(%ebp)
+                while(*s != 0){
+ 804:	eb 1c                	jmp    822 <printf+0xff>
+                    putc(fd, *s);
+ 806:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 809:	0f b6 00             	movzbl (%eax),%eax
+ 80c:	0f be c0             	movsbl %al,%eax
+ 80f:	83 ec 08             	sub    $0x8,%esp
+ 812:	50                   	push   %eax
+ 813:	ff 75 08             	push   0x8(%ebp)
+ 816:	e8 34 fe ff ff       	call   64f <putc>
+ 81b:	83 c4 10             	add    $0x10,%esp
+                    s++;
+ 81e:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+                while(*s != 0){
+ 822:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 825:	0f b6 00             	movzbl (%eax),%eax
+ 828:	84 c0                	test   %al,%al
+ 82a:	75 da                	jne    806 <printf+0xe3>
+ 82c:	eb 65                	jmp    893 <printf+0x170>
+                }
+            } else if(c == 'c'){
+ 82e:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+ 832:	75 1d                	jne    851 <printf+0x12e>
+                putc(fd, *ap);
+ 834:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 837:	8b 00                	mov    (%eax),%eax
+ 839:	0f be c0             	movsbl %al,%eax
+ 83c:	83 ec 08             	sub    $0x8,%esp
+ 83f:	50                   	push   %eax
+ 840:	ff 75 08             	push   0x8(%ebp)
+ 843:	e8 07 fe ff ff       	call   64f <putc>
+ 848:	83 c4 10             	add    $0x10,%esp
+                ap++;
+ 84b:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 84f:	eb 42                	jmp    893 <printf+0x170>
+            } else if(c == '%'){
+ 851:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 855:	75 17                	jne    86e <printf+0x14b>
+                putc(fd, c);
+ 857:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 85a:	0f be c0             	movsbl %al,%eax
+ 85d:	83 ec 08             	sub    $0x8,%esp
+ 860:	50                   	push   %eax
+ 861:	ff 75 08             	push   0x8(%ebp)
+ 864:	e8 e6 fd ff ff       	call   64f <putc>
+ 869:	83 c4 10             	add    $0x10,%esp
+ 86c:	eb 25                	jmp    893 <printf+0x170>
+            } else {
+                // Unknown % sequence.    Print it to draw attention.
+                putc(fd, '%');
+ 86e:	83 ec 08             	sub    $0x8,%esp
+ 871:	6a 25                	push   $0x25
+ 873:	ff 75 08             	push   0x8(%ebp)
+ 876:	e8 d4 fd ff ff       	call   64f <putc>
+ 87b:	83 c4 10             	add    $0x10,%esp
+                putc(fd, c);
+ 87e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 881:	0f be c0             	movsbl %al,%eax
+ 884:	83 ec 08             	sub    $0x8,%esp
+ 887:	50                   	push   %eax
+ 888:	ff 75 08             	push   0x8(%ebp)
+ 88b:	e8 bf fd ff ff       	call   64f <putc>
+ 890:	83 c4 10             	add    $0x10,%esp
+            }
+            state = 0;
+ 893:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+    for(i = 0; fmt[i]; i++){
+ 89a:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ 89e:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 8a1:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 8a4:	01 d0                	add    %edx,%eax
+ 8a6:	0f b6 00             	movzbl (%eax),%eax
+ 8a9:	84 c0                	test   %al,%al
+ 8ab:	0f 85 94 fe ff ff    	jne    745 <printf+0x22>
+        }
+    }
+}
+ 8b1:	90                   	nop
+ 8b2:	90                   	nop
+ 8b3:	c9                   	leave
+ 8b4:	c3                   	ret
+
+000008b5 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 8b5:	55                   	push   %ebp
+ 8b6:	89 e5                	mov    %esp,%ebp
+ 8b8:	83 ec 10             	sub    $0x10,%esp
+    Header *bp, *p;
+
+    bp = (Header*)ap - 1;
+ 8bb:	8b 45 08             	mov    0x8(%ebp),%eax
+ 8be:	83 e8 08             	sub    $0x8,%eax
+ 8c1:	89 45 f8             	mov    %eax,-0x8(%ebp)
+    for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 8c4:	a1 cc 0d 00 00       	mov    0xdcc,%eax
+ 8c9:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 8cc:	eb 24                	jmp    8f2 <free+0x3d>
+        if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 8ce:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 8d1:	8b 00                	mov    (%eax),%eax
+ 8d3:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 8d6:	72 12                	jb     8ea <free+0x35>
+ 8d8:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 8db:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 8de:	72 24                	jb     904 <free+0x4f>
+ 8e0:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 8e3:	8b 00                	mov    (%eax),%eax
+ 8e5:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 8e8:	72 1a                	jb     904 <free+0x4f>
+    for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 8ea:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 8ed:	8b 00                	mov    (%eax),%eax
+ 8ef:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 8f2:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 8f5:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 8f8:	73 d4                	jae    8ce <free+0x19>
+ 8fa:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 8fd:	8b 00                	mov    (%eax),%eax
+ 8ff:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 902:	73 ca                	jae    8ce <free+0x19>
+            break;
+    if(bp + bp->s.size == p->s.ptr){
+ 904:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 907:	8b 40 04             	mov    0x4(%eax),%eax
+ 90a:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 911:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 914:	01 c2                	add    %eax,%edx
+ 916:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 919:	8b 00                	mov    (%eax),%eax
+ 91b:	39 c2                	cmp    %eax,%edx
+ 91d:	75 24                	jne    943 <free+0x8e>
+        bp->s.size += p->s.ptr->s.size;
+ 91f:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 922:	8b 50 04             	mov    0x4(%eax),%edx
+ 925:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 928:	8b 00                	mov    (%eax),%eax
+ 92a:	8b 40 04             	mov    0x4(%eax),%eax
+ 92d:	01 c2                	add    %eax,%edx
+ 92f:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 932:	89 50 04             	mov    %edx,0x4(%eax)
+        bp->s.ptr = p->s.ptr->s.ptr;
+ 935:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 938:	8b 00                	mov    (%eax),%eax
+ 93a:	8b 10                	mov    (%eax),%edx
+ 93c:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 93f:	89 10                	mov    %edx,(%eax)
+ 941:	eb 0a                	jmp    94d <free+0x98>
+    } else
+        bp->s.ptr = p->s.ptr;
+ 943:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 946:	8b 10                	mov    (%eax),%edx
+ 948:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 94b:	89 10                	mov    %edx,(%eax)
+    if(p + p->s.size == bp){
+ 94d:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 950:	8b 40 04             	mov    0x4(%eax),%eax
+ 953:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 95a:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 95d:	01 d0                	add    %edx,%eax
+ 95f:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 962:	75 20                	jne    984 <free+0xcf>
+        p->s.size += bp->s.size;
+ 964:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 967:	8b 50 04             	mov    0x4(%eax),%edx
+ 96a:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 96d:	8b 40 04             	mov    0x4(%eax),%eax
+ 970:	01 c2                	add    %eax,%edx
+ 972:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 975:	89 50 04             	mov    %edx,0x4(%eax)
+        p->s.ptr = bp->s.ptr;
+ 978:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 97b:	8b 10                	mov    (%eax),%edx
+ 97d:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 980:	89 10                	mov    %edx,(%eax)
+ 982:	eb 08                	jmp    98c <free+0xd7>
+    } else
+        p->s.ptr = bp;
+ 984:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 987:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 98a:	89 10                	mov    %edx,(%eax)
+    freep = p;
+ 98c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 98f:	a3 cc 0d 00 00       	mov    %eax,0xdcc
+}
+ 994:	90                   	nop
+ 995:	c9                   	leave
+ 996:	c3                   	ret
+
+00000997 <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+ 997:	55                   	push   %ebp
+ 998:	89 e5                	mov    %esp,%ebp
+ 99a:	83 ec 18             	sub    $0x18,%esp
+    char *p;
+    Header *hp;
+
+    if(nu < 4096)
+ 99d:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+ 9a4:	77 07                	ja     9ad <morecore+0x16>
+        nu = 4096;
+ 9a6:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+    p = sbrk(nu * sizeof(Header));
+ 9ad:	8b 45 08             	mov    0x8(%ebp),%eax
+ 9b0:	c1 e0 03             	shl    $0x3,%eax
+ 9b3:	83 ec 0c             	sub    $0xc,%esp
+ 9b6:	50                   	push   %eax
+ 9b7:	e8 0a fb ff ff       	call   4c6 <sbrk>
+ 9bc:	83 c4 10             	add    $0x10,%esp
+ 9bf:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p == (char*)-1)
+ 9c2:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+ 9c6:	75 07                	jne    9cf <morecore+0x38>
+        return 0;
+ 9c8:	b8 00 00 00 00       	mov    $0x0,%eax
+ 9cd:	eb 26                	jmp    9f5 <morecore+0x5e>
+    hp = (Header*)p;
+ 9cf:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 9d2:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    hp->s.size = nu;
+ 9d5:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 9d8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 9db:	89 50 04             	mov    %edx,0x4(%eax)
+    free((void*)(hp + 1));
+ 9de:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 9e1:	83 c0 08             	add    $0x8,%eax
+ 9e4:	83 ec 0c             	sub    $0xc,%esp
+ 9e7:	50                   	push   %eax
+ 9e8:	e8 c8 fe ff ff       	call   8b5 <free>
+ 9ed:	83 c4 10             	add    $0x10,%esp
+    return freep;
+ 9f0:	a1 cc 0d 00 00       	mov    0xdcc,%eax
+}
+ 9f5:	c9                   	leave
+ 9f6:	c3                   	ret
+
+000009f7 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ 9f7:	55                   	push   %ebp
+ 9f8:	89 e5                	mov    %esp,%ebp
+ 9fa:	83 ec 18             	sub    $0x18,%esp
+    Header *p, *prevp;
+    uint nunits;
+
+    nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 9fd:	8b 45 08             	mov    0x8(%ebp),%eax
+ a00:	83 c0 07             	add    $0x7,%eax
+ a03:	c1 e8 03             	shr    $0x3,%eax
+ a06:	83 c0 01             	add    $0x1,%eax
+ a09:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    if((prevp = freep) == 0){
+ a0c:	a1 cc 0d 00 00       	mov    0xdcc,%eax
+ a11:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ a14:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ a18:	75 23                	jne    a3d <malloc+0x46>
+        base.s.ptr = freep = prevp = &base;
+ a1a:	c7 45 f0 c4 0d 00 00 	movl   $0xdc4,-0x10(%ebp)
+ a21:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ a24:	a3 cc 0d 00 00       	mov    %eax,0xdcc
+ a29:	a1 cc 0d 00 00       	mov    0xdcc,%eax
+ a2e:	a3 c4 0d 00 00       	mov    %eax,0xdc4
+        base.s.size = 0;
+ a33:	c7 05 c8 0d 00 00 00 	movl   $0x0,0xdc8
+ a3a:	00 00 00 
+    }
+    for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ a3d:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ a40:	8b 00                	mov    (%eax),%eax
+ a42:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        if(p->s.size >= nunits){
+ a45:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a48:	8b 40 04             	mov    0x4(%eax),%eax
+ a4b:	3b 45 ec             	cmp    -0x14(%ebp),%eax
+ a4e:	72 4d                	jb     a9d <malloc+0xa6>
+            if(p->s.size == nunits)
+ a50:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a53:	8b 40 04             	mov    0x4(%eax),%eax
+ a56:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+ a59:	75 0c                	jne    a67 <malloc+0x70>
+                prevp->s.ptr = p->s.ptr;
+ a5b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a5e:	8b 10                	mov    (%eax),%edx
+ a60:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ a63:	89 10                	mov    %edx,(%eax)
+ a65:	eb 26                	jmp    a8d <malloc+0x96>
+            else {
+                p->s.size -= nunits;
+ a67:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a6a:	8b 40 04             	mov    0x4(%eax),%eax
+ a6d:	2b 45 ec             	sub    -0x14(%ebp),%eax
+ a70:	89 c2                	mov    %eax,%edx
+ a72:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a75:	89 50 04             	mov    %edx,0x4(%eax)
+                p += p->s.size;
+ a78:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a7b:	8b 40 04             	mov    0x4(%eax),%eax
+ a7e:	c1 e0 03             	shl    $0x3,%eax
+ a81:	01 45 f4             	add    %eax,-0xc(%ebp)
+                p->s.size = nunits;
+ a84:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a87:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ a8a:	89 50 04             	mov    %edx,0x4(%eax)
+            }
+            freep = prevp;
+ a8d:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ a90:	a3 cc 0d 00 00       	mov    %eax,0xdcc
+            return (void*)(p + 1);
+ a95:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a98:	83 c0 08             	add    $0x8,%eax
+ a9b:	eb 3b                	jmp    ad8 <malloc+0xe1>
+        }
+        if(p == freep)
+ a9d:	a1 cc 0d 00 00       	mov    0xdcc,%eax
+ aa2:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ aa5:	75 1e                	jne    ac5 <malloc+0xce>
+            if((p = morecore(nunits)) == 0)
+ aa7:	83 ec 0c             	sub    $0xc,%esp
+ aaa:	ff 75 ec             	push   -0x14(%ebp)
+ aad:	e8 e5 fe ff ff       	call   997 <morecore>
+ ab2:	83 c4 10             	add    $0x10,%esp
+ ab5:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ ab8:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ abc:	75 07                	jne    ac5 <malloc+0xce>
+                return 0;
+ abe:	b8 00 00 00 00       	mov    $0x0,%eax
+ ac3:	eb 13                	jmp    ad8 <malloc+0xe1>
+    for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ ac5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ ac8:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ acb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ ace:	8b 00                	mov    (%eax),%eax
+ ad0:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        if(p->s.size >= nunits){
+ ad3:	e9 6d ff ff ff       	jmp    a45 <malloc+0x4e>
+    }
+}
+ ad8:	c9                   	leave
+ ad9:	c3                   	ret
@@ -21,7 +21,9 @@
 #include "types.h"
 #include "defs.h"
 #include "param.h"
+#include "mmu.h"
 #include "spinlock.h"
+#include "proc.h"
 #include "sleeplock.h"
 #include "fs.h"
 #include "buf.h"
@@ -100,6 +102,8 @@ bread(uint dev, uint blockno)
 
     b = bget(dev, blockno);
     if((b->flags & B_VALID) == 0) {
+        if(myproc())
+            myproc()->ru.inblock++;
         iderw(b);
     }
     return b;
@@ -112,6 +116,8 @@ bwrite(struct buf *b)
     if(!holdingsleep(&b->lock))
         panic("bwrite");
     b->flags |= B_DIRTY;
+    if(myproc())
+        myproc()->ru.oublock++;
     iderw(b);
 }
 
@@ -0,0 +1,1526 @@
+
+_cat:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <cat>:
+
+char buf[512];
+
+void
+cat(int fd)
+{
+   0:	55                   	push   %ebp
+   1:	89 e5                	mov    %esp,%ebp
+   3:	83 ec 18             	sub    $0x18,%esp
+    int n;
+
+    // Let the kernel copy a file without bringing it through buf;
+    // sendfile() refuses a pipe, which is read the usual way.
+    if((n = sendfile(1, fd, 0, 4096)) >= 0){
+   6:	68 00 10 00 00       	push   $0x1000
+   b:	6a 00                	push   $0x0
+   d:	ff 75 08             	push   0x8(%ebp)
+  10:	6a 01                	push   $0x1
+  12:	e8 5a 06 00 00       	call   671 <sendfile>
+  17:	83 c4 10             	add    $0x10,%esp
+  1a:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  1d:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+  21:	78 71                	js     94 <cat+0x94>
+        while(n > 0)
+  23:	eb 17                	jmp    3c <cat+0x3c>
+            n = sendfile(1, fd, 0, 4096);
+  25:	68 00 10 00 00       	push   $0x1000
+  2a:	6a 00                	push   $0x0
+  2c:	ff 75 08             	push   0x8(%ebp)
+  2f:	6a 01                	push   $0x1
+  31:	e8 3b 06 00 00       	call   671 <sendfile>
+  36:	83 c4 10             	add    $0x10,%esp
+  39:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        while(n > 0)
+  3c:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+  40:	7f e3                	jg     25 <cat+0x25>
+        if(n < 0){
+  42:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+  46:	0f 89 86 00 00 00    	jns    d2 <cat+0xd2>
+            printf(1, "cat: sendfile error\n");
+  4c:	83 ec 08             	sub    $0x8,%esp
+  4f:	68 45 0b 00 00       	push   $0xb45
+  54:	6a 01                	push   $0x1
+  56:	e8 33 07 00 00       	call   78e <printf>
+  5b:	83 c4 10             	add    $0x10,%esp
+            exit();
+  5e:	e8 2d 04 00 00       	call   490 <exit>
+        }
+        return;
+    }
+
+    while((n = read(fd, buf, sizeof(buf))) > 0) {
+        if (write(1, buf, n) != n) {
+  63:	83 ec 04             	sub    $0x4,%esp
+  66:	ff 75 f4             	push   -0xc(%ebp)
+  69:	68 40 0e 00 00       	push   $0xe40
+  6e:	6a 01                	push   $0x1
+  70:	e8 3a 04 00 00       	call   4af <write>
+  75:	83 c4 10             	add    $0x10,%esp
+  78:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+  7b:	74 17                	je     94 <cat+0x94>
+            printf(1, "cat: write error\n");
+  7d:	83 ec 08             	sub    $0x8,%esp
+  80:	68 5a 0b 00 00       	push   $0xb5a
+  85:	6a 01                	push   $0x1
+  87:	e8 02 07 00 00       	call   78e <printf>
+  8c:	83 c4 10             	add    $0x10,%esp
+            exit();
+  8f:	e8 fc 03 00 00       	call   490 <exit>
+    while((n = read(fd, buf, sizeof(buf))) > 0) {
+  94:	83 ec 04             	sub    $0x4,%esp
+  97:	68 00 02 00 00       	push   $0x200
+  9c:	68 40 0e 00 00       	push   $0xe40
+  a1:	ff 75 08             	push   0x8(%ebp)
+  a4:	e8 fc 03 00 00       	call   4a5 <read>
+  a9:	83 c4 10             	add    $0x10,%esp
+  ac:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  af:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+  b3:	7f ae                	jg     63 <cat+0x63>
+        }
+    }
+    if(n < 0){
+  b5:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+  b9:	79 18                	jns    d3 <cat+0xd3>
+        printf(1, "cat: read error\n");
+  bb:	83 ec 08             	sub    $0x8,%esp
+  be:	68 6c 0b 00 00       	push   $0xb6c
+  c3:	6a 01                	push   $0x1
+  c5:	e8 c4 06 00 00       	call   78e <printf>
+  ca:	83 c4 10             	add    $0x10,%esp
+        exit();
+  cd:	e8 be 03 00 00       	call   490 <exit>
+        return;
+  d2:	90                   	nop
+    }
+}
+  d3:	c9                   	leave
+  d4:	c3                   	ret
+
+000000d5 <main>:
+
+int
+main(int argc, char *argv[])
+{
+  d5:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+  d9:	83 e4 f0             	and    $0xfffffff0,%esp
+  dc:	ff 71 fc             	push   -0x4(%ecx)
+  df:	55                   	push   %ebp
+  e0:	89 e5                	mov    %esp,%ebp
+  e2:	53                   	push   %ebx
+  e3:	51                   	push   %ecx
+  e4:	83 ec 10             	sub    $0x10,%esp
+  e7:	89 cb                	mov    %ecx,%ebx
+    int fd, i;
+
+    if(argc <= 1){
+  e9:	83 3b 01             	cmpl   $0x1,(%ebx)
+  ec:	7f 12                	jg     100 <main+0x2b>
+        cat(0);
+  ee:	83 ec 0c             	sub    $0xc,%esp
+  f1:	6a 00                	push   $0x0
+  f3:	e8 08 ff ff ff       	call   0 <cat>
+  f8:	83 c4 10             	add    $0x10,%esp
+        exit();
+  fb:	e8 90 03 00 00       	call   490 <exit>
+    }
+
+    for(i = 1; i < argc; i++){
+ 100:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+ 107:	eb 71                	jmp    17a <main+0xa5>
+        if((fd = open(argv[i], 0)) < 0){
+ 109:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 10c:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+ 113:	8b 43 04             	mov    0x4(%ebx),%eax
+ 116:	01 d0                	add    %edx,%eax
+ 118:	8b 00                	mov    (%eax),%eax
+ 11a:	83 ec 08             	sub    $0x8,%esp
+ 11d:	6a 00                	push   $0x0
+ 11f:	50                   	push   %eax
+ 120:	e8 b2 03 00 00       	call   4d7 <open>
+ 125:	83 c4 10             	add    $0x10,%esp
+ 128:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ 12b:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 12f:	79 29                	jns    15a <main+0x85>
+            printf(1, "cat: cannot open %s\n", argv[i]);
+ 131:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 134:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+ 13b:	8b 43 04             	mov    0x4(%ebx),%eax
+ 13e:	01 d0                	add    %edx,%eax
+ 140:	8b 00                	mov    (%eax),%eax
+ 142:	83 ec 04             	sub    $0x4,%esp
+ 145:	50                   	push   %eax
+ 146:	68 7d 0b 00 00       	push   $0xb7d
+ 14b:	6a 01                	push   $0x1
+ 14d:	e8 3c 06 00 00       	call   78e <printf>
+ 152:	83 c4 10             	add    $0x10,%esp
+            exit();
+ 155:	e8 36 03 00 00       	call   490 <exit>
+        }
+        cat(fd);
+ 15a:	83 ec 0c             	sub    $0xc,%esp
+ 15d:	ff 75 f0             	push   -0x10(%ebp)
+ 160:	e8 9b fe ff ff       	call   0 <cat>
+ 165:	83 c4 10             	add    $0x10,%esp
+        close(fd);
+ 168:	83 ec 0c             	sub    $0xc,%esp
+ 16b:	ff 75 f0             	push   -0x10(%ebp)
+ 16e:	e8 46 03 00 00       	call   4b9 <close>
+ 173:	83 c4 10             	add    $0x10,%esp
+    for(i = 1; i < argc; i++){
+ 176:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+ 17a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 17d:	3b 03                	cmp    (%ebx),%eax
+ 17f:	7c 88                	jl     109 <main+0x34>
+    }
+    exit();
+ 181:	e8 0a 03 00 00       	call   490 <exit>
+
+00000186 <stosb>:
+strchr(const char *s, char c)
+{
+    for(; *s; s++)
+        if(*s == c)
+            return (char*)s;
+    return 0;
+ 186:	55                   	push   %ebp
+ 187:	89 e5                	mov    %esp,%ebp
+ 189:	57                   	push   %edi
+ 18a:	53                   	push   %ebx
+}
+ 18b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 18e:	8b 55 10             	mov    0x10(%ebp),%edx
+ 191:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 194:	89 cb                	mov    %ecx,%ebx
+ 196:	89 df                	mov    %ebx,%edi
+ 198:	89 d1                	mov    %edx,%ecx
+ 19a:	fc                   	cld
+ 19b:	f3 aa                	rep stos %al,%es:(%edi)
+ 19d:	89 ca                	mov    %ecx,%edx
+ 19f:	89 fb                	mov    %edi,%ebx
+ 1a1:	89 5d 08             	mov    %ebx,0x8(%ebp)
+ 1a4:	89 55 10             	mov    %edx,0x10(%ebp)
+
+char*
+gets(char *buf, int max)
+{
+ 1a7:	90                   	nop
+ 1a8:	5b                   	pop    %ebx
+ 1a9:	5f                   	pop    %edi
+ 1aa:	5d                   	pop    %ebp
+ 1ab:	c3                   	ret
+
+000001ac <strcpy>:
+{
+ 1ac:	55                   	push   %ebp
+ 1ad:	89 e5                	mov    %esp,%ebp
+ 1af:	83 ec 10             	sub    $0x10,%esp
+    os = s;
+ 1b2:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1b5:	89 45 fc             	mov    %eax,-0x4(%ebp)
+    while((*s++ = *t++) != 0)
+ 1b8:	90                   	nop
+ 1b9:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 1bc:	8d 42 01             	lea    0x1(%edx),%eax
+ 1bf:	89 45 0c             	mov    %eax,0xc(%ebp)
+ 1c2:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1c5:	8d 48 01             	lea    0x1(%eax),%ecx
+ 1c8:	89 4d 08             	mov    %ecx,0x8(%ebp)
+ 1cb:	0f b6 12             	movzbl (%edx),%edx
+ 1ce:	88 10                	mov    %dl,(%eax)
+ 1d0:	0f b6 00             	movzbl (%eax),%eax
+ 1d3:	84 c0                	test   %al,%al
+ 1d5:	75 e2                	jne    1b9 <strcpy+0xd>
+    return os;
+ 1d7:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 1da:	c9                   	leave
+ 1db:	c3                   	ret
+
+000001dc <strcmp>:
+{
+ 1dc:	55                   	push   %ebp
+ 1dd:	89 e5                	mov    %esp,%ebp
+    while(*p && *p == *q)
+ 1df:	eb 08                	jmp    1e9 <strcmp+0xd>
+        p++, q++;
+ 1e1:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 1e5:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+    while(*p && *p == *q)
+ 1e9:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1ec:	0f b6 00             	movzbl (%eax),%eax
+ 1ef:	84 c0                	test   %al,%al
+ 1f1:	74 10                	je     203 <strcmp+0x27>
+ 1f3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1f6:	0f b6 10             	movzbl (%eax),%edx
+ 1f9:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 1fc:	0f b6 00             	movzbl (%eax),%eax
+ 1ff:	38 c2                	cmp    %al,%dl
+ 201:	74 de                	je     1e1 <strcmp+0x5>
+    return (uchar)*p - (uchar)*q;
+ 203:	8b 45 08             	mov    0x8(%ebp),%eax
+ 206:	0f b6 00             	movzbl (%eax),%eax
+ 209:	0f b6 d0             	movzbl %al,%edx
+ 20c:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 20f:	0f b6 00             	movzbl (%eax),%eax
+ 212:	0f b6 c0             	movzbl %al,%eax
+ 215:	29 c2                	sub    %eax,%edx
+ 217:	89 d0                	mov    %edx,%eax
+}
+ 219:	5d                   	pop    %ebp
+ 21a:	c3                   	ret
+
+0000021b <strlen>:
+{
+ 21b:	55                   	push   %ebp
+ 21c:	89 e5                	mov    %esp,%ebp
+ 21e:	83 ec 10             	sub    $0x10,%esp
+    for(n = 0; s[n]; n++)
+ 221:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ 228:	eb 04                	jmp    22e <strlen+0x13>
+ 22a:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 22e:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 231:	8b 45 08             	mov    0x8(%ebp),%eax
+ 234:	01 d0                	add    %edx,%eax
+ 236:	0f b6 00             	movzbl (%eax),%eax
+ 239:	84 c0                	test   %al,%al
+ 23b:	75 ed                	jne    22a <strlen+0xf>
+    return n;
+ 23d:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 240:	c9                   	leave
+ 241:	c3                   	ret
+
+00000242 <memset>:
+{
+ 242:	55                   	push   %ebp
+ 243:	89 e5                	mov    %esp,%ebp
+    stosb(dst, c, n);
+ 245:	8b 45 10             	mov    0x10(%ebp),%eax
+ 248:	50                   	push   %eax
+ 249:	ff 75 0c             	push   0xc(%ebp)
+ 24c:	ff 75 08             	push   0x8(%ebp)
+ 24f:	e8 32 ff ff ff       	call   186 <stosb>
+ 254:	83 c4 0c             	add    $0xc,%esp
+    return dst;
+ 257:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 25a:	c9                   	leave
+ 25b:	c3                   	ret
+
+0000025c <strchr>:
+{
+ 25c:	55                   	push   %ebp
+ 25d:	89 e5                	mov    %esp,%ebp
+ 25f:	83 ec 04             	sub    $0x4,%esp
+ 262:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 265:	88 45 fc             	mov    %al,-0x4(%ebp)
+    for(; *s; s++)
+ 268:	eb 14                	jmp    27e <strchr+0x22>
+        if(*s == c)
+ 26a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 26d:	0f b6 00             	movzbl (%eax),%eax
+ 270:	38 45 fc             	cmp    %al,-0x4(%ebp)
+ 273:	75 05                	jne    27a <strchr+0x1e>
+            return (char*)s;
+ 275:	8b 45 08             	mov    0x8(%ebp),%eax
+ 278:	eb 13                	jmp    28d <strchr+0x31>
+    for(; *s; s++)
+ 27a:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 27e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 281:	0f b6 00             	movzbl (%eax),%eax
+ 284:	84 c0                	test   %al,%al
+ 286:	75 e2                	jne    26a <strchr+0xe>
+    return 0;
+ 288:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 28d:	c9                   	leave
+ 28e:	c3                   	ret
+
+0000028f <gets>:
+{
+ 28f:	55                   	push   %ebp
+ 290:	89 e5                	mov    %esp,%ebp
+ 292:	83 ec 18             	sub    $0x18,%esp
+    int i, cc;
+    char c;
+
+    for(i=0; i+1 < max; ){
+ 295:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 29c:	eb 42                	jmp    2e0 <gets+0x51>
+        cc = read(0, &c, 1);
+ 29e:	83 ec 04             	sub    $0x4,%esp
+ 2a1:	6a 01                	push   $0x1
+ 2a3:	8d 45 ef             	lea    -0x11(%ebp),%eax
+ 2a6:	50                   	push   %eax
+ 2a7:	6a 00                	push   $0x0
+ 2a9:	e8 f7 01 00 00       	call   4a5 <read>
+ 2ae:	83 c4 10             	add    $0x10,%esp
+ 2b1:	89 45 f0             	mov    %eax,-0x10(%ebp)
+        if(cc < 1)
+ 2b4:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 2b8:	7e 33                	jle    2ed <gets+0x5e>
+            break;
+        buf[i++] = c;
+ 2ba:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 2bd:	8d 50 01             	lea    0x1(%eax),%edx
+ 2c0:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 2c3:	89 c2                	mov    %eax,%edx
+ 2c5:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2c8:	01 c2                	add    %eax,%edx
+ 2ca:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 2ce:	88 02                	mov    %al,(%edx)
+        if(c == '\n' || c == '\r')
+ 2d0:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 2d4:	3c 0a                	cmp    $0xa,%al
+ 2d6:	74 16                	je     2ee <gets+0x5f>
+ 2d8:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 2dc:	3c 0d                	cmp    $0xd,%al
+ 2de:	74 0e                	je     2ee <gets+0x5f>
+    for(i=0; i+1 < max; ){
+ 2e0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 2e3:	83 c0 01             	add    $0x1,%eax
+ 2e6:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 2e9:	7f b3                	jg     29e <gets+0xf>
+ 2eb:	eb 01                	jmp    2ee <gets+0x5f>
+            break;
+ 2ed:	90                   	nop
+            break;
+    }
+    buf[i] = '\0';
+ 2ee:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 2f1:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2f4:	01 d0                	add    %edx,%eax
+ 2f6:	c6 00 00             	movb   $0x0,(%eax)
+    return buf;
+ 2f9:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 2fc:	c9                   	leave
+ 2fd:	c3                   	ret
+
+000002fe <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 2fe:	55                   	push   %ebp
+ 2ff:	89 e5                	mov    %esp,%ebp
+ 301:	83 ec 18             	sub    $0x18,%esp
+    int fd;
+    int r;
+
+    fd = open(n, O_RDONLY);
+ 304:	83 ec 08             	sub    $0x8,%esp
+ 307:	6a 00                	push   $0x0
+ 309:	ff 75 08             	push   0x8(%ebp)
+ 30c:	e8 c6 01 00 00       	call   4d7 <open>
+ 311:	83 c4 10             	add    $0x10,%esp
+ 314:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(fd < 0)
+ 317:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 31b:	79 07                	jns    324 <stat+0x26>
+        return -1;
+ 31d:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 322:	eb 25                	jmp    349 <stat+0x4b>
+    r = fstat(fd, st);
+ 324:	83 ec 08             	sub    $0x8,%esp
+ 327:	ff 75 0c             	push   0xc(%ebp)
+ 32a:	ff 75 f4             	push   -0xc(%ebp)
+ 32d:	e8 c3 01 00 00       	call   4f5 <fstat>
+ 332:	83 c4 10             	add    $0x10,%esp
+ 335:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    close(fd);
+ 338:	83 ec 0c             	sub    $0xc,%esp
+ 33b:	ff 75 f4             	push   -0xc(%ebp)
+ 33e:	e8 76 01 00 00       	call   4b9 <close>
+ 343:	83 c4 10             	add    $0x10,%esp
+    return r;
+ 346:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ 349:	c9                   	leave
+ 34a:	c3                   	ret
+
+0000034b <atoi>:
+
+int
+atoi(const char *s)
+{
+ 34b:	55                   	push   %ebp
+ 34c:	89 e5                	mov    %esp,%ebp
+ 34e:	83 ec 10             	sub    $0x10,%esp
+    int n;
+
+    n = 0;
+ 351:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+    while('0' <= *s && *s <= '9')
+ 358:	eb 25                	jmp    37f <atoi+0x34>
+        n = n*10 + *s++ - '0';
+ 35a:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 35d:	89 d0                	mov    %edx,%eax
+ 35f:	c1 e0 02             	shl    $0x2,%eax
+ 362:	01 d0                	add    %edx,%eax
+ 364:	01 c0                	add    %eax,%eax
+ 366:	89 c1                	mov    %eax,%ecx
+ 368:	8b 45 08             	mov    0x8(%ebp),%eax
+ 36b:	8d 50 01             	lea    0x1(%eax),%edx
+ 36e:	89 55 08             	mov    %edx,0x8(%ebp)
+ 371:	0f b6 00             	movzbl (%eax),%eax
+ 374:	0f be c0             	movsbl %al,%eax
+ 377:	01 c8                	add    %ecx,%eax
+ 379:	83 e8 30             	sub    $0x30,%eax
+ 37c:	89 45 fc             	mov    %eax,-0x4(%ebp)
+    while('0' <= *s && *s <= '9')
+ 37f:	8b 45 08             	mov    0x8(%ebp),%eax
+ 382:	0f b6 00             	movzbl (%eax),%eax
+ 385:	3c 2f                	cmp    $0x2f,%al
+ 387:	7e 0a                	jle    393 <atoi+0x48>
+ 389:	8b 45 08             	mov    0x8(%ebp),%eax
+ 38c:	0f b6 00             	movzbl (%eax),%eax
+ 38f:	3c 39                	cmp    $0x39,%al
+ 391:	7e c7                	jle    35a <atoi+0xf>
+    return n;
+ 393:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 396:	c9                   	leave
+ 397:	c3                   	ret
+
+00000398 <nice>:
+
+// Add inc to the caller's nice value; return the new value.
+int
+nice(int inc)
+{
+ 398:	55                   	push   %ebp
+ 399:	89 e5                	mov    %esp,%ebp
+ 39b:	83 ec 18             	sub    $0x18,%esp
+    int n;
+
+    n = getpriority(0) + inc;
+ 39e:	83 ec 0c             	sub    $0xc,%esp
+ 3a1:	6a 00                	push   $0x0
+ 3a3:	e8 d9 01 00 00       	call   581 <getpriority>
+ 3a8:	83 c4 10             	add    $0x10,%esp
+ 3ab:	8b 55 08             	mov    0x8(%ebp),%edx
+ 3ae:	01 d0                	add    %edx,%eax
+ 3b0:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(n < 0)
+ 3b3:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 3b7:	79 07                	jns    3c0 <nice+0x28>
+        n = 0;
+ 3b9:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    if(n > NICEMAX)
+ 3c0:	83 7d f4 13          	cmpl   $0x13,-0xc(%ebp)
+ 3c4:	7e 07                	jle    3cd <nice+0x35>
+        n = NICEMAX;
+ 3c6:	c7 45 f4 13 00 00 00 	movl   $0x13,-0xc(%ebp)
+    if(setpriority(0, n) < 0)
+ 3cd:	83 ec 08             	sub    $0x8,%esp
+ 3d0:	ff 75 f4             	push   -0xc(%ebp)
+ 3d3:	6a 00                	push   $0x0
+ 3d5:	e8 b1 01 00 00       	call   58b <setpriority>
+ 3da:	83 c4 10             	add    $0x10,%esp
+ 3dd:	85 c0                	test   %eax,%eax
+ 3df:	79 07                	jns    3e8 <nice+0x50>
+        return -1;
+ 3e1:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 3e6:	eb 03                	jmp    3eb <nice+0x53>
+    return n;
+ 3e8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+ 3eb:	c9                   	leave
+ 3ec:	c3                   	ret
+
+000003ed <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 3ed:	55                   	push   %ebp
+ 3ee:	89 e5                	mov    %esp,%ebp
+ 3f0:	83 ec 10             	sub    $0x10,%esp
+    char *dst;
+    const char *src;
+
+    dst = vdst;
+ 3f3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3f6:	89 45 fc             	mov    %eax,-0x4(%ebp)
+    src = vsrc;
+ 3f9:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 3fc:	89 45 f8             	mov    %eax,-0x8(%ebp)
+    while(n-- > 0)
+ 3ff:	eb 17                	jmp    418 <memmove+0x2b>
+        *dst++ = *src++;
+ 401:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 404:	8d 42 01             	lea    0x1(%edx),%eax
+ 407:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 40a:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 40d:	8d 48 01             	lea    0x1(%eax),%ecx
+ 410:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+ 413:	0f b6 12             	movzbl (%edx),%edx
+ 416:	88 10                	mov    %dl,(%eax)
+    while(n-- > 0)
+ 418:	8b 45 10             	mov    0x10(%ebp),%eax
+ 41b:	8d 50 ff             	lea    -0x1(%eax),%edx
+ 41e:	89 55 10             	mov    %edx,0x10(%ebp)
+ 421:	85 c0                	test   %eax,%eax
+ 423:	7f dc                	jg     401 <memmove+0x14>
+    return vdst;
+ 425:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 428:	c9                   	leave
+ 429:	c3                   	ret
+
+0000042a <dosyscall>:
+sysmode:
+    .long 0
+
+    .text
+dosyscall:
+    cmpl $0, sysmode
+ 42a:	83 3d 24 0e 00 00 00 	cmpl   $0x0,0xe24
+    jg 2f
+ 431:	7f 0c                	jg     43f <dosyscall+0x15>
+    jl 1f
+ 433:	7c 07                	jl     43c <dosyscall+0x12>
+    call sepcheck
+ 435:	e8 27 00 00 00       	call   461 <sepcheck>
+    jmp dosyscall
+ 43a:	eb ee                	jmp    42a <dosyscall>
+1:
+    int $T_SYSCALL
+ 43c:	cd 40                	int    $0x40
+    ret
+ 43e:	c3                   	ret
+2:
+    pushl %ebx
+ 43f:	53                   	push   %ebx
+    pushl %esi
+ 440:	56                   	push   %esi
+    pushl %edi
+ 441:	57                   	push   %edi
+    pushl %ebp
+ 442:	55                   	push   %ebp
+    movl 20(%esp), %ebx
+ 443:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+    movl 24(%esp), %esi
+ 447:	8b 74 24 18          	mov    0x18(%esp),%esi
+    movl 28(%esp), %edi
+ 44b:	8b 7c 24 1c          	mov    0x1c(%esp),%edi
+    movl 32(%esp), %ebp
+ 44f:	8b 6c 24 20          	mov    0x20(%esp),%ebp
+    movl %esp, %ecx
+ 453:	89 e1                	mov    %esp,%ecx
+    movl $3f, %edx
+ 455:	ba 5c 04 00 00       	mov    $0x45c,%edx
+    sysenter
+ 45a:	0f 34                	sysenter
+3:
+    popl %ebp
+ 45c:	5d                   	pop    %ebp
+    popl %edi
+ 45d:	5f                   	pop    %edi
+    popl %esi
+ 45e:	5e                   	pop    %esi
+    popl %ebx
+ 45f:	5b                   	pop    %ebx
+    ret
+ 460:	c3                   	ret
+
+00000461 <sepcheck>:
+
+# Set sysmode from cpuid's SEP flag.    Preserves %eax.
+sepcheck:
+    pushl %eax
+ 461:	50                   	push   %eax
+    pushl %ebx
+ 462:	53                   	push   %ebx
+    movl $1, %eax
+ 463:	b8 01 00 00 00       	mov    $0x1,%eax
+    cpuid
+ 468:	0f a2                	cpuid
+    movl $-1, sysmode
+ 46a:	c7 05 24 0e 00 00 ff 	movl   $0xffffffff,0xe24
+ 471:	ff ff ff 
+    testl $0x800, %edx
+ 474:	f7 c2 00 08 00 00    	test   $0x800,%edx
+    jz 1f
+ 47a:	74 0a                	je     486 <sepcheck+0x25>
+    movl $1, sysmode
+ 47c:	c7 05 24 0e 00 00 01 	movl   $0x1,0xe24
+ 483:	00 00 00 
+1:
+    popl %ebx
+ 486:	5b                   	pop    %ebx
+    popl %eax
+ 487:	58                   	pop    %eax
+    ret
+ 488:	c3                   	ret
+
+00000489 <fork>:
+
+SYSCALL(fork)
+ 489:	b8 01 00 00 00       	mov    $0x1,%eax
+ 48e:	eb 9a                	jmp    42a <dosyscall>
+
+00000490 <exit>:
+SYSCALL(exit)
+ 490:	b8 02 00 00 00       	mov    $0x2,%eax
+ 495:	eb 93                	jmp    42a <dosyscall>
+
+00000497 <wait>:
+SYSCALL(wait)
+ 497:	b8 03 00 00 00       	mov    $0x3,%eax
+ 49c:	eb 8c                	jmp    42a <dosyscall>
+
+0000049e <pipe>:
+SYSCALL(pipe)
+ 49e:	b8 04 00 00 00       	mov    $0x4,%eax
+ 4a3:	eb 85                	jmp    42a <dosyscall>
+
+000004a5 <read>:
+SYSCALL(read)
+ 4a5:	b8 05 00 00 00       	mov    $0x5,%eax
+ 4aa:	e9 7b ff ff ff       	jmp    42a <dosyscall>
+
+000004af <write>:
+SYSCALL(write)
+ 4af:	b8 10 00 00 00       	mov    $0x10,%eax
+ 4b4:	e9 71 ff ff ff       	jmp    42a <dosyscall>
+
+000004b9 <close>:
+SYSCALL(close)
+ 4b9:	b8 15 00 00 00       	mov    $0x15,%eax
+ 4be:	e9 67 ff ff ff       	jmp    42a <dosyscall>
+
+000004c3 <kill>:
+SYSCALL(kill)
+ 4c3:	b8 06 00 00 00       	mov    $0x6,%eax
+ 4c8:	e9 5d ff ff ff       	jmp    42a <dosyscall>
+
+000004cd <exec>:
+SYSCALL(exec)
+ 4cd:	b8 07 00 00 00       	mov    $0x7,%eax
+ 4d2:	e9 53 ff ff ff       	jmp    42a <dosyscall>
+
+000004d7 <open>:
+SYSCALL(open)
+ 4d7:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 4dc:	e9 49 ff ff ff       	jmp    42a <dosyscall>
+
+000004e1 <mknod>:
+SYSCALL(mknod)
+ 4e1:	b8 11 00 00 00       	mov    $0x11,%eax
+ 4e6:	e9 3f ff ff ff       	jmp    42a <dosyscall>
+
+000004eb <unlink>:
+SYSCALL(unlink)
+ 4eb:	b8 12 00 00 00       	mov    $0x12,%eax
+ 4f0:	e9 35 ff ff ff       	jmp    42a <dosyscall>
+
+000004f5 <fstat>:
+SYSCALL(fstat)
+ 4f5:	b8 08 00 00 00       	mov    $0x8,%eax
+ 4fa:	e9 2b ff ff ff       	jmp    42a <dosyscall>
+
+000004ff <link>:
+SYSCALL(link)
+ 4ff:	b8 13 00 00 00       	mov    $0x13,%eax
+ 504:	e9 21 ff ff ff       	jmp    42a <dosyscall>
+
+00000509 <mkdir>:
+SYSCALL(mkdir)
+ 509:	b8 14 00 00 00       	mov    $0x14,%eax
+ 50e:	e9 17 ff ff ff       	jmp    42a <dosyscall>
+
+00000513 <chdir>:
+SYSCALL(chdir)
+ 513:	b8 09 00 00 00       	mov    $0x9,%eax
+ 518:	e9 0d ff ff ff       	jmp    42a <dosyscall>
+
+0000051d <dup>:
+SYSCALL(dup)
+ 51d:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 522:	e9 03 ff ff ff       	jmp    42a <dosyscall>
+
+00000527 <getpid>:
+SYSCALL(getpid)
+ 527:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 52c:	e9 f9 fe ff ff       	jmp    42a <dosyscall>
+
+00000531 <sbrk>:
+SYSCALL(sbrk)
+ 531:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 536:	e9 ef fe ff ff       	jmp    42a <dosyscall>
+
+0000053b <sleep>:
+SYSCALL(sleep)
+ 53b:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 540:	e9 e5 fe ff ff       	jmp    42a <dosyscall>
+
+00000545 <uptime>:
+SYSCALL(uptime)
+ 545:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 54a:	e9 db fe ff ff       	jmp    42a <dosyscall>
+
+0000054f <date>:
+SYSCALL(date)
+ 54f:	b8 16 00 00 00       	mov    $0x16,%eax
+ 554:	e9 d1 fe ff ff       	jmp    42a <dosyscall>
+
+00000559 <dup2>:
+SYSCALL(dup2)
+ 559:	b8 17 00 00 00       	mov    $0x17,%eax
+ 55e:	e9 c7 fe ff ff       	jmp    42a <dosyscall>
+
+00000563 <uffd>:
+SYSCALL(uffd)
+ 563:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 568:	e9 bd fe ff ff       	jmp    42a <dosyscall>
+
+0000056d <uffdregister>:
+SYSCALL(uffdregister)
+ 56d:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 572:	e9 b3 fe ff ff       	jmp    42a <dosyscall>
+
+00000577 <uffdcopy>:
+SYSCALL(uffdcopy)
+ 577:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 57c:	e9 a9 fe ff ff       	jmp    42a <dosyscall>
+
+00000581 <getpriority>:
+SYSCALL(getpriority)
+ 581:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 586:	e9 9f fe ff ff       	jmp    42a <dosyscall>
+
+0000058b <setpriority>:
+SYSCALL(setpriority)
+ 58b:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 590:	e9 95 fe ff ff       	jmp    42a <dosyscall>
+
+00000595 <setweight>:
+SYSCALL(setweight)
+ 595:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 59a:	e9 8b fe ff ff       	jmp    42a <dosyscall>
+
+0000059f <setgroup>:
+SYSCALL(setgroup)
+ 59f:	b8 20 00 00 00       	mov    $0x20,%eax
+ 5a4:	e9 81 fe ff ff       	jmp    42a <dosyscall>
+
+000005a9 <schedinfo>:
+SYSCALL(schedinfo)
+ 5a9:	b8 21 00 00 00       	mov    $0x21,%eax
+ 5ae:	e9 77 fe ff ff       	jmp    42a <dosyscall>
+
+000005b3 <nanosleep>:
+SYSCALL(nanosleep)
+ 5b3:	b8 22 00 00 00       	mov    $0x22,%eax
+ 5b8:	e9 6d fe ff ff       	jmp    42a <dosyscall>
+
+000005bd <clock_nanosleep>:
+SYSCALL(clock_nanosleep)
+ 5bd:	b8 23 00 00 00       	mov    $0x23,%eax
+ 5c2:	e9 63 fe ff ff       	jmp    42a <dosyscall>
+
+000005c7 <clock_gettime>:
+SYSCALL(clock_gettime)
+ 5c7:	b8 24 00 00 00       	mov    $0x24,%eax
+ 5cc:	e9 59 fe ff ff       	jmp    42a <dosyscall>
+
+000005d1 <sched_setaffinity>:
+SYSCALL(sched_setaffinity)
+ 5d1:	b8 25 00 00 00       	mov    $0x25,%eax
+ 5d6:	e9 4f fe ff ff       	jmp    42a <dosyscall>
+
+000005db <sched_getaffinity>:
+SYSCALL(sched_getaffinity)
+ 5db:	b8 26 00 00 00       	mov    $0x26,%eax
+ 5e0:	e9 45 fe ff ff       	jmp    42a <dosyscall>
+
+000005e5 <irqaffinity>:
+SYSCALL(irqaffinity)
+ 5e5:	b8 27 00 00 00       	mov    $0x27,%eax
+ 5ea:	e9 3b fe ff ff       	jmp    42a <dosyscall>
+
+000005ef <getrusage>:
+SYSCALL(getrusage)
+ 5ef:	b8 28 00 00 00       	mov    $0x28,%eax
+ 5f4:	e9 31 fe ff ff       	jmp    42a <dosyscall>
+
+000005f9 <times>:
+SYSCALL(times)
+ 5f9:	b8 29 00 00 00       	mov    $0x29,%eax
+ 5fe:	e9 27 fe ff ff       	jmp    42a <dosyscall>
+
+00000603 <schedlat>:
+SYSCALL(schedlat)
+ 603:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 608:	e9 1d fe ff ff       	jmp    42a <dosyscall>
+
+0000060d <sched_setscheduler>:
+SYSCALL(sched_setscheduler)
+ 60d:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 612:	e9 13 fe ff ff       	jmp    42a <dosyscall>
+
+00000617 <sched_getscheduler>:
+SYSCALL(sched_getscheduler)
+ 617:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 61c:	e9 09 fe ff ff       	jmp    42a <dosyscall>
+
+00000621 <sched_getparam>:
+SYSCALL(sched_getparam)
+ 621:	b8 2d 00 00 00       	mov    $0x2d,%eax
+ 626:	e9 ff fd ff ff       	jmp    42a <dosyscall>
+
+0000062b <lockstat>:
+SYSCALL(lockstat)
+ 62b:	b8 2e 00 00 00       	mov    $0x2e,%eax
+ 630:	e9 f5 fd ff ff       	jmp    42a <dosyscall>
+
+00000635 <ioring_setup>:
+SYSCALL(ioring_setup)
+ 635:	b8 2f 00 00 00       	mov    $0x2f,%eax
+ 63a:	e9 eb fd ff ff       	jmp    42a <dosyscall>
+
+0000063f <ioring_enter>:
+SYSCALL(ioring_enter)
+ 63f:	b8 30 00 00 00       	mov    $0x30,%eax
+ 644:	e9 e1 fd ff ff       	jmp    42a <dosyscall>
+
+00000649 <readv>:
+SYSCALL(readv)
+ 649:	b8 31 00 00 00       	mov    $0x31,%eax
+ 64e:	e9 d7 fd ff ff       	jmp    42a <dosyscall>
+
+00000653 <writev>:
+SYSCALL(writev)
+ 653:	b8 32 00 00 00       	mov    $0x32,%eax
+ 658:	e9 cd fd ff ff       	jmp    42a <dosyscall>
+
+0000065d <pread>:
+SYSCALL(pread)
+ 65d:	b8 33 00 00 00       	mov    $0x33,%eax
+ 662:	e9 c3 fd ff ff       	jmp    42a <dosyscall>
+
+00000667 <pwrite>:
+SYSCALL(pwrite)
+ 667:	b8 34 00 00 00       	mov    $0x34,%eax
+ 66c:	e9 b9 fd ff ff       	jmp    42a <dosyscall>
+
+00000671 <sendfile>:
+SYSCALL(sendfile)
+ 671:	b8 35 00 00 00       	mov    $0x35,%eax
+ 676:	e9 af fd ff ff       	jmp    42a <dosyscall>
+
+0000067b <splice>:
+SYSCALL(splice)
+ 67b:	b8 36 00 00 00       	mov    $0x36,%eax
+ 680:	e9 a5 fd ff ff       	jmp    42a <dosyscall>
+
+00000685 <sysstat>:
+SYSCALL(sysstat)
+ 685:	b8 37 00 00 00       	mov    $0x37,%eax
+ 68a:	e9 9b fd ff ff       	jmp    42a <dosyscall>
+
+0000068f <strace>:
+SYSCALL(strace)
+ 68f:	b8 38 00 00 00       	mov    $0x38,%eax
+ 694:	e9 91 fd ff ff       	jmp    42a <dosyscall>
+
+00000699 <straceread>:
+SYSCALL(straceread)
+ 699:	b8 39 00 00 00       	mov    $0x39,%eax
+ 69e:	e9 87 fd ff ff       	jmp    42a <dosyscall>
+
+000006a3 <alarm>:
+
+# alarm and rstoregs keep to int $T_SYSCALL: rstoregs restores
+# %ecx and %edx, which sysexit would clobber.
+.globl alarm
+    alarm:
+        pushl $rstoregs
+ 6a3:	68 b3 06 00 00       	push   $0x6b3
+        movl $SYS_alarm, %eax
+ 6a8:	b8 18 00 00 00       	mov    $0x18,%eax
+        int $T_SYSCALL
+ 6ad:	cd 40                	int    $0x40
+        add $0x04, %esp
+ 6af:	83 c4 04             	add    $0x4,%esp
+        ret
+ 6b2:	c3                   	ret
+
+000006b3 <rstoregs>:
+
+.globl rstoregs
+    rstoregs:
+        movl $SYS_rstoregs, %eax
+ 6b3:	b8 19 00 00 00       	mov    $0x19,%eax
+        int $T_SYSCALL
+ 6b8:	cd 40                	int    $0x40
+
+000006ba <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 6ba:	55                   	push   %ebp
+ 6bb:	89 e5                	mov    %esp,%ebp
+ 6bd:	83 ec 18             	sub    $0x18,%esp
+ 6c0:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 6c3:	88 45 f4             	mov    %al,-0xc(%ebp)
+    write(fd, &c, 1);
+ 6c6:	83 ec 04             	sub    $0x4,%esp
+ 6c9:	6a 01                	push   $0x1
+ 6cb:	8d 45 f4             	lea    -0xc(%ebp),%eax
+ 6ce:	50                   	push   %eax
+ 6cf:	ff 75 08             	push   0x8(%ebp)
+ 6d2:	e8 d8 fd ff ff       	call   4af <write>
+ 6d7:	83 c4 10             	add    $0x10,%esp
+}
+ 6da:	90                   	nop
+ 6db:	c9                   	leave
+ 6dc:	c3                   	ret
+
+000006dd <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 6dd:	55                   	push   %ebp
+ 6de:	89 e5                	mov    %esp,%ebp
+ 6e0:	83 ec 28             	sub    $0x28,%esp
+    static char digits[] = "0123456789ABCDEF";
+    char buf[16];
+    int i, neg;
+    uint x;
+
+    neg = 0;
+ 6e3:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+    if(sgn && xx < 0){
+ 6ea:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+ 6ee:	74 17                	je     707 <printint+0x2a>
+ 6f0:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 6f4:	79 11                	jns    707 <printint+0x2a>
+        neg = 1;
+ 6f6:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+        x = -xx;
+ 6fd:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 700:	f7 d8                	neg    %eax
+ 702:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 705:	eb 06                	jmp    70d <printint+0x30>
+    } else {
+        x = xx;
+ 707:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 70a:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    }
+
+    i = 0;
+ 70d:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    do{
+        buf[i++] = digits[x % base];
+ 714:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 717:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 71a:	ba 00 00 00 00       	mov    $0x0,%edx
+ 71f:	f7 f1                	div    %ecx
+ 721:	89 d1                	mov    %edx,%ecx
+ 723:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 726:	8d 50 01             	lea    0x1(%eax),%edx
+ 729:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 72c:	0f b6 91 28 0e 00 00 	movzbl 0xe28(%ecx),%edx
+ 733:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+    }while((x /= base) != 0);
+ 737:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 73a:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 73d:	ba 00 00 00 00       	mov    $0x0,%edx
+ 742:	f7 f1                	div    %ecx
+ 744:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 747:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 74b:	75 c7                	jne    714 <printint+0x37>
+    if(neg)
+ 74d:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 751:	74 2d                	je     780 <printint+0xa3>
+        buf[i++] = '-';
+ 753:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 756:	8d 50 01             	lea    0x1(%eax),%edx
+ 759:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 75c:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+    while(--i >= 0)
+ 761:	eb 1d                	jmp    780 <printint+0xa3>
+        putc(fd, buf[i]);
+ 763:	8d 55 dc             	lea    -0x24(%ebp),%edx
+ 766:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 769:	01 d0                	add    %edx,%eax
+ 76b:	0f b6 00             	movzbl (%eax),%eax
+ 76e:	0f be c0             	movsbl %al,%eax
+ 771:	83 ec 08             	sub    $0x8,%esp
+ 774:	50                   	push   %eax
+ 775:	ff 75 08             	push   0x8(%ebp)
+ 778:	e8 3d ff ff ff       	call   6ba <putc>
+ 77d:	83 c4 10             	add    $0x10,%esp
+    while(--i >= 0)
+ 780:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+ 784:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 788:	79 d9                	jns    763 <printint+0x86>
+}
+ 78a:	90                   	nop
+ 78b:	90                   	nop
+ 78c:	c9                   	leave
+ 78d:	c3                   	ret
+
+0000078e <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 78e:	55                   	push   %ebp
+ 78f:	89 e5                	mov    %esp,%ebp
+ 791:	83 ec 28             	sub    $0x28,%esp
+    char *s;
+    int c, i, state;
+    uint *ap;
+
+    state = 0;
+ 794:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+    ap = (uint*)(void*)&fmt + 1;
+ 79b:	8d 45 0c             	lea    0xc(%ebp),%eax
+ 79e:	83 c0 04             	add    $0x4,%eax
+ 7a1:	89 45 e8             	mov    %eax,-0x18(%ebp)
+    for(i = 0; fmt[i]; i++){
+ 7a4:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 7ab:	e9 59 01 00 00       	jmp    909 <printf+0x17b>
+        c = fmt[i] & 0xff;
+ 7b0:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 7b3:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 7b6:	01 d0                	add    %edx,%eax
+ 7b8:	0f b6 00             	movzbl (%eax),%eax
+ 7bb:	0f be c0             	movsbl %al,%eax
+ 7be:	25 ff 00 00 00       	and    $0xff,%eax
+ 7c3:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        if(state == 0){
+ 7c6:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 7ca:	75 2c                	jne    7f8 <printf+0x6a>
+            if(c == '%'){
+ 7cc:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 7d0:	75 0c                	jne    7de <printf+0x50>
+                state = '%';
+ 7d2:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+ 7d9:	e9 27 01 00 00       	jmp    905 <printf+0x177>
+            } else {
+                putc(fd, c);
+ 7de:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 7e1:	0f be c0             	movsbl %al,%eax
+ 7e4:	83 ec 08             	sub    $0x8,%esp
+ 7e7:	50                   	push   %eax
+ 7e8:	ff 75 08             	push   0x8(%ebp)
+ 7eb:	e8 ca fe ff ff       	call   6ba <putc>
+ 7f0:	83 c4 10             	add    $0x10,%esp
+ 7f3:	e9 0d 01 00 00       	jmp    905 <printf+0x177>
+            }
+        } else if(state == '%'){
+ 7f8:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+ 7fc:	0f 85 03 01 00 00    	jne    905 <printf+0x177>
+            if(c == 'd'){
+ 802:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+ 806:	75 1e                	jne    826 <printf+0x98>
+                printint(fd, *ap, 10, 1);
+ 808:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 80b:	8b 00                	mov    (%eax),%eax
+ 80d:	6a 01                	push   $0x1
+ 80f:	6a 0a                	push   $0xa
+ 811:	50                   	push   %eax
+ 812:	ff 75 08             	push   0x8(%ebp)
+ 815:	e8 c3 fe ff ff       	call   6dd <printint>
+ 81a:	83 c4 10             	add    $0x10,%esp
+                ap++;
+ 81d:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 821:	e9 d8 00 00 00       	jmp    8fe <printf+0x170>
+            } else if(c == 'x' || c == 'p'){
+ 826:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+ 82a:	74 06                	je     832 <printf+0xa4>
+ 82c:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+ 830:	75 1e                	jne    850 <printf+0xc2>
+                printint(fd, *ap, 16, 0);
+ 832:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 835:	8b 00                	mov    (%eax),%eax
+ 837:	6a 00                	push   $0x0
+ 839:	6a 10                	push   $0x10
+ 83b:	50                   	push   %eax
+ 83c:	ff 75 08             	push   0x8(%ebp)
+ 83f:	e8 99 fe ff ff       	call   6dd <printint>
+ 844:	83 c4 10             	add    $0x10,%esp
+                ap++;
+ 847:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 84b:	e9 ae 00 00 00       	jmp    8fe <printf+0x170>
+            } else if(c == 's'){
+ 850:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+ 854:	75 43                	jne    899 <printf+0x10b>
+                s = (char*)*ap;
+ 856:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 859:	8b 00                	mov    (%eax),%eax
+ 85b:	89 45 f4             	mov    %eax,-0xc(%ebp)
+                ap++;
+ 85e:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+                if(s == 0)
+ 862:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 866:	75 25                	jne    88d <printf+0xff>
+                    s = "(null)";
+ 868:	c7 45 f4 92 0b 00 00 	movl   $0xb92,-0xc(%ebp)
+                while(*s != 0){
+ 86f:	eb 1c                	jmp    88d <printf+0xff>
+                    putc(fd, *s);
+ 871:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 874:	0f b6 00             	movzbl (%eax),%eax
+ 877:	0f be c0             	movsbl %al,%eax
+ 87a:	83 ec 08             	sub    $0x8,%esp
+ 87d:	50                   	push   %eax
+ 87e:	ff 75 08             	push   0x8(%ebp)
+ 881:	e8 34 fe ff ff       	call   6ba <putc>
+ 886:	83 c4 10             	add    $0x10,%esp
+                    s++;
+ 889:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+                while(*s != 0){
+ 88d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 890:	0f b6 00             	movzbl (%eax),%eax
+ 893:	84 c0                	test   %al,%al
+ 895:	75 da                	jne    871 <printf+0xe3>
+ 897:	eb 65                	jmp    8fe <printf+0x170>
+                }
+            } else if(c == 'c'){
+ 899:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+ 89d:	75 1d                	jne    8bc <printf+0x12e>
+                putc(fd, *ap);
+ 89f:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 8a2:	8b 00                	mov    (%eax),%eax
+ 8a4:	0f be c0             	movsbl %al,%eax
+ 8a7:	83 ec 08             	sub    $0x8,%esp
+ 8aa:	50                   	push   %eax
+ 8ab:	ff 75 08             	push   0x8(%ebp)
+ 8ae:	e8 07 fe ff ff       	call   6ba <putc>
+ 8b3:	83 c4 10             	add    $0x10,%esp
+                ap++;
+ 8b6:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 8ba:	eb 42                	jmp    8fe <printf+0x170>
+            } else if(c == '%'){
+ 8bc:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 8c0:	75 17                	jne    8d9 <printf+0x14b>
+                putc(fd, c);
+ 8c2:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 8c5:	0f be c0             	movsbl %al,%eax
+ 8c8:	83 ec 08             	sub    $0x8,%esp
+ 8cb:	50                   	push   %eax
+ 8cc:	ff 75 08             	push   0x8(%ebp)
+ 8cf:	e8 e6 fd ff ff       	call   6ba <putc>
+ 8d4:	83 c4 10             	add    $0x10,%esp
+ 8d7:	eb 25                	jmp    8fe <printf+0x170>
+            } else {
+                // Unknown % sequence.    Print it to draw attention.
+                putc(fd, '%');
+ 8d9:	83 ec 08             	sub    $0x8,%esp
+ 8dc:	6a 25                	push   $0x25
+ 8de:	ff 75 08             	push   0x8(%ebp)
+ 8e1:	e8 d4 fd ff ff       	call   6ba <putc>
+ 8e6:	83 c4 10             	add    $0x10,%esp
+                putc(fd, c);
+ 8e9:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 8ec:	0f be c0             	movsbl %al,%eax
+ 8ef:	83 ec 08             	sub    $0x8,%esp
+ 8f2:	50                   	push   %eax
+ 8f3:	ff 75 08             	push   0x8(%ebp)
+ 8f6:	e8 bf fd ff ff       	call   6ba <putc>
+ 8fb:	83 c4 10             	add    $0x10,%esp
+            }
+            state = 0;
+ 8fe:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+    for(i = 0; fmt[i]; i++){
+ 905:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ 909:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 90c:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 90f:	01 d0                	add    %edx,%eax
+ 911:	0f b6 00             	movzbl (%eax),%eax
+ 914:	84 c0                	test   %al,%al
+ 916:	0f 85 94 fe ff ff    	jne    7b0 <printf+0x22>
+        }
+    }
+}
+ 91c:	90                   	nop
+ 91d:	90                   	nop
+ 91e:	c9                   	leave
+ 91f:	c3                   	ret
+
+00000920 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 920:	55                   	push   %ebp
+ 921:	89 e5                	mov    %esp,%ebp
+ 923:	83 ec 10             	sub    $0x10,%esp
+    Header *bp, *p;
+
+    bp = (Header*)ap - 1;
+ 926:	8b 45 08             	mov    0x8(%ebp),%eax
+ 929:	83 e8 08             	sub    $0x8,%eax
+ 92c:	89 45 f8             	mov    %eax,-0x8(%ebp)
+    for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 92f:	a1 48 10 00 00       	mov    0x1048,%eax
+ 934:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 937:	eb 24                	jmp    95d <free+0x3d>
+        if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 939:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 93c:	8b 00                	mov    (%eax),%eax
+ 93e:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 941:	72 12                	jb     955 <free+0x35>
+ 943:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 946:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 949:	72 24                	jb     96f <free+0x4f>
+ 94b:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 94e:	8b 00                	mov    (%eax),%eax
+ 950:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 953:	72 1a                	jb     96f <free+0x4f>
+    for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 955:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 958:	8b 00                	mov    (%eax),%eax
+ 95a:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 95d:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 960:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 963:	73 d4                	jae    939 <free+0x19>
+ 965:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 968:	8b 00                	mov    (%eax),%eax
+ 96a:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 96d:	73 ca                	jae    939 <free+0x19>
+            break;
+    if(bp + bp->s.size == p->s.ptr){
+ 96f:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 972:	8b 40 04             	mov    0x4(%eax),%eax
+ 975:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 97c:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 97f:	01 c2                	add    %eax,%edx
+ 981:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 984:	8b 00                	mov    (%eax),%eax
+ 986:	39 c2                	cmp    %eax,%edx
+ 988:	75 24                	jne    9ae <free+0x8e>
+        bp->s.size += p->s.ptr->s.size;
+ 98a:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 98d:	8b 50 04             	mov    0x4(%eax),%edx
+ 990:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 993:	8b 00                	mov    (%eax),%eax
+ 995:	8b 40 04             	mov    0x4(%eax),%eax
+ 998:	01 c2                	add    %eax,%edx
+ 99a:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 99d:	89 50 04             	mov    %edx,0x4(%eax)
+        bp->s.ptr = p->s.ptr->s.ptr;
+ 9a0:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 9a3:	8b 00                	mov    (%eax),%eax
+ 9a5:	8b 10                	mov    (%eax),%edx
+ 9a7:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 9aa:	89 10                	mov    %edx,(%eax)
+ 9ac:	eb 0a                	jmp    9b8 <free+0x98>
+    } else
+        bp->s.ptr = p->s.ptr;
+ 9ae:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 9b1:	8b 10                	mov    (%eax),%edx
+ 9b3:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 9b6:	89 10                	mov    %edx,(%eax)
+    if(p + p->s.size == bp){
+ 9b8:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 9bb:	8b 40 04             	mov    0x4(%eax),%eax
+ 9be:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 9c5:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 9c8:	01 d0                	add    %edx,%eax
+ 9ca:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 9cd:	75 20                	jne    9ef <free+0xcf>
+        p->s.size += bp->s.size;
+ 9cf:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 9d2:	8b 50 04             	mov    0x4(%eax),%edx
+ 9d5:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 9d8:	8b 40 04             	mov    0x4(%eax),%eax
+ 9db:	01 c2                	add    %eax,%edx
+ 9dd:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 9e0:	89 50 04             	mov    %edx,0x4(%eax)
+        p->s.ptr = bp->s.ptr;
+ 9e3:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 9e6:	8b 10                	mov    (%eax),%edx
+ 9e8:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 9eb:	89 10                	mov    %edx,(%eax)
+ 9ed:	eb 08                	jmp    9f7 <free+0xd7>
+    } else
+        p->s.ptr = bp;
+ 9ef:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 9f2:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 9f5:	89 10                	mov    %edx,(%eax)
+    freep = p;
+ 9f7:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 9fa:	a3 48 10 00 00       	mov    %eax,0x1048
+}
+ 9ff:	90                   	nop
+ a00:	c9                   	leave
+ a01:	c3                   	ret
+
+00000a02 <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+ a02:	55                   	push   %ebp
+ a03:	89 e5                	mov    %esp,%ebp
+ a05:	83 ec 18             	sub    $0x18,%esp
+    char *p;
+    Header *hp;
+
+    if(nu < 4096)
+ a08:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+ a0f:	77 07                	ja     a18 <morecore+0x16>
+        nu = 4096;
+ a11:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+    p = sbrk(nu * sizeof(Header));
+ a18:	8b 45 08             	mov    0x8(%ebp),%eax
+ a1b:	c1 e0 03             	shl    $0x3,%eax
+ a1e:	83 ec 0c             	sub    $0xc,%esp
+ a21:	50                   	push   %eax
+ a22:	e8 0a fb ff ff       	call   531 <sbrk>
+ a27:	83 c4 10             	add    $0x10,%esp
+ a2a:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p == (char*)-1)
+ a2d:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+ a31:	75 07                	jne    a3a <morecore+0x38>
+        return 0;
+ a33:	b8 00 00 00 00       	mov    $0x0,%eax
+ a38:	eb 26                	jmp    a60 <morecore+0x5e>
+    hp = (Header*)p;
+ a3a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a3d:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    hp->s.size = nu;
+ a40:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ a43:	8b 55 08             	mov    0x8(%ebp),%edx
+ a46:	89 50 04             	mov    %edx,0x4(%eax)
+    free((void*)(hp + 1));
+ a49:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ a4c:	83 c0 08             	add    $0x8,%eax
+ a4f:	83 ec 0c             	sub    $0xc,%esp
+ a52:	50                   	push   %eax
+ a53:	e8 c8 fe ff ff       	call   920 <free>
+ a58:	83 c4 10             	add    $0x10,%esp
+    return freep;
+ a5b:	a1 48 10 00 00       	mov    0x1048,%eax
+}
+ a60:	c9                   	leave
+ a61:	c3                   	ret
+
+00000a62 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ a62:	55                   	push   %ebp
+ a63:	89 e5                	mov    %esp,%ebp
+ a65:	83 ec 18             	sub    $0x18,%esp
+    Header *p, *prevp;
+    uint nunits;
+
+    nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ a68:	8b 45 08             	mov    0x8(%ebp),%eax
+ a6b:	83 c0 07             	add    $0x7,%eax
+ a6e:	c1 e8 03             	shr    $0x3,%eax
+ a71:	83 c0 01             	add    $0x1,%eax
+ a74:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    if((prevp = freep) == 0){
+ a77:	a1 48 10 00 00       	mov    0x1048,%eax
+ a7c:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ a7f:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ a83:	75 23                	jne    aa8 <malloc+0x46>
+        base.s.ptr = freep = prevp = &base;
+ a85:	c7 45 f0 40 10 00 00 	movl   $0x1040,-0x10(%ebp)
+ a8c:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ a8f:	a3 48 10 00 00       	mov    %eax,0x1048
+ a94:	a1 48 10 00 00       	mov    0x1048,%eax
+ a99:	a3 40 10 00 00       	mov    %eax,0x1040
+        base.s.size = 0;
+ a9e:	c7 05 44 10 00 00 00 	movl   $0x0,0x1044
+ aa5:	00 00 00 
+    }
+    for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ aa8:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ aab:	8b 00                	mov    (%eax),%eax
+ aad:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        if(p->s.size >= nunits){
+ ab0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ ab3:	8b 40 04             	mov    0x4(%eax),%eax
+ ab6:	3b 45 ec             	cmp    -0x14(%ebp),%eax
+ ab9:	72 4d                	jb     b08 <malloc+0xa6>
+            if(p->s.size == nunits)
+ abb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ abe:	8b 40 04             	mov    0x4(%eax),%eax
+ ac1:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+ ac4:	75 0c                	jne    ad2 <malloc+0x70>
+                prevp->s.ptr = p->s.ptr;
+ ac6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ ac9:	8b 10                	mov    (%eax),%edx
+ acb:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ ace:	89 10                	mov    %edx,(%eax)
+ ad0:	eb 26                	jmp    af8 <malloc+0x96>
+            else {
+                p->s.size -= nunits;
+ ad2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ ad5:	8b 40 04             	mov    0x4(%eax),%eax
+ ad8:	2b 45 ec             	sub    -0x14(%ebp),%eax
+ adb:	89 c2                	mov    %eax,%edx
+ add:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ ae0:	89 50 04             	mov    %edx,0x4(%eax)
+                p += p->s.size;
+ ae3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ ae6:	8b 40 04             	mov    0x4(%eax),%eax
+ ae9:	c1 e0 03             	shl    $0x3,%eax
+ aec:	01 45 f4             	add    %eax,-0xc(%ebp)
+                p->s.size = nunits;
+ aef:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ af2:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ af5:	89 50 04             	mov    %edx,0x4(%eax)
+            }
+            freep = prevp;
+ af8:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ afb:	a3 48 10 00 00       	mov    %eax,0x1048
+            return (void*)(p + 1);
+ b00:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b03:	83 c0 08             	add    $0x8,%eax
+ b06:	eb 3b                	jmp    b43 <malloc+0xe1>
+        }
+        if(p == freep)
+ b08:	a1 48 10 00 00       	mov    0x1048,%eax
+ b0d:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ b10:	75 1e                	jne    b30 <malloc+0xce>
+            if((p = morecore(nunits)) == 0)
+ b12:	83 ec 0c             	sub    $0xc,%esp
+ b15:	ff 75 ec             	push   -0x14(%ebp)
+ b18:	e8 e5 fe ff ff       	call   a02 <morecore>
+ b1d:	83 c4 10             	add    $0x10,%esp
+ b20:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ b23:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ b27:	75 07                	jne    b30 <malloc+0xce>
+                return 0;
+ b29:	b8 00 00 00 00       	mov    $0x0,%eax
+ b2e:	eb 13                	jmp    b43 <malloc+0xe1>
+    for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ b30:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b33:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ b36:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b39:	8b 00                	mov    (%eax),%eax
+ b3b:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        if(p->s.size >= nunits){
+ b3e:	e9 6d ff ff ff       	jmp    ab0 <malloc+0x4e>
+    }
+}
+ b43:	c9                   	leave
+ b44:	c3                   	ret
@@ -0,0 +1,1548 @@
+
+_chrt:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <usage>:
+#include "param.h"
+#include "sched.h"
+
+void
+usage(void)
+{
+   0:	55                   	push   %ebp
+   1:	89 e5                	mov    %esp,%ebp
+   3:	83 ec 08             	sub    $0x8,%esp
+    printf(2, "usage: chrt prio cmd [arg...]\n"
+   6:	83 ec 08             	sub    $0x8,%esp
+   9:	68 80 0b 00 00       	push   $0xb80
+   e:	6a 02                	push   $0x2
+  10:	e8 b2 07 00 00       	call   7c7 <printf>
+  15:	83 c4 10             	add    $0x10,%esp
+        "       chrt -p pid [prio]\n");
+    exit();
+  18:	e8 ac 04 00 00       	call   4c9 <exit>
+
+0000001d <setprio>:
+}
+
+// Put pid in the class prio calls for.
+int
+setprio(int pid, int prio)
+{
+  1d:	55                   	push   %ebp
+  1e:	89 e5                	mov    %esp,%ebp
+  20:	83 ec 08             	sub    $0x8,%esp
+    return sched_setscheduler(pid, prio ? SCHED_FIFO : SCHED_OTHER, prio);
+  23:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  27:	0f 95 c0             	setne  %al
+  2a:	0f b6 c0             	movzbl %al,%eax
+  2d:	83 ec 04             	sub    $0x4,%esp
+  30:	ff 75 0c             	push   0xc(%ebp)
+  33:	50                   	push   %eax
+  34:	ff 75 08             	push   0x8(%ebp)
+  37:	e8 0a 06 00 00       	call   646 <sched_setscheduler>
+  3c:	83 c4 10             	add    $0x10,%esp
+}
+  3f:	c9                   	leave
+  40:	c3                   	ret
+
+00000041 <main>:
+
+int
+main(int argc, char *argv[])
+{
+  41:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+  45:	83 e4 f0             	and    $0xfffffff0,%esp
+  48:	ff 71 fc             	push   -0x4(%ecx)
+  4b:	55                   	push   %ebp
+  4c:	89 e5                	mov    %esp,%ebp
+  4e:	53                   	push   %ebx
+  4f:	51                   	push   %ecx
+  50:	83 ec 10             	sub    $0x10,%esp
+  53:	89 cb                	mov    %ecx,%ebx
+    int pid, prio;
+
+    if(argc < 3)
+  55:	83 3b 02             	cmpl   $0x2,(%ebx)
+  58:	7f 05                	jg     5f <main+0x1e>
+        usage();
+  5a:	e8 a1 ff ff ff       	call   0 <usage>
+    if(strcmp(argv[1], "-p") == 0){
+  5f:	8b 43 04             	mov    0x4(%ebx),%eax
+  62:	83 c0 04             	add    $0x4,%eax
+  65:	8b 00                	mov    (%eax),%eax
+  67:	83 ec 08             	sub    $0x8,%esp
+  6a:	68 b9 0b 00 00       	push   $0xbb9
+  6f:	50                   	push   %eax
+  70:	e8 a0 01 00 00       	call   215 <strcmp>
+  75:	83 c4 10             	add    $0x10,%esp
+  78:	85 c0                	test   %eax,%eax
+  7a:	0f 85 be 00 00 00    	jne    13e <main+0xfd>
+        pid = atoi(argv[2]);
+  80:	8b 43 04             	mov    0x4(%ebx),%eax
+  83:	83 c0 08             	add    $0x8,%eax
+  86:	8b 00                	mov    (%eax),%eax
+  88:	83 ec 0c             	sub    $0xc,%esp
+  8b:	50                   	push   %eax
+  8c:	e8 f3 02 00 00       	call   384 <atoi>
+  91:	83 c4 10             	add    $0x10,%esp
+  94:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        if(argc > 3 && setprio(pid, atoi(argv[3])) < 0){
+  97:	83 3b 03             	cmpl   $0x3,(%ebx)
+  9a:	7e 41                	jle    dd <main+0x9c>
+  9c:	8b 43 04             	mov    0x4(%ebx),%eax
+  9f:	83 c0 0c             	add    $0xc,%eax
+  a2:	8b 00                	mov    (%eax),%eax
+  a4:	83 ec 0c             	sub    $0xc,%esp
+  a7:	50                   	push   %eax
+  a8:	e8 d7 02 00 00       	call   384 <atoi>
+  ad:	83 c4 10             	add    $0x10,%esp
+  b0:	83 ec 08             	sub    $0x8,%esp
+  b3:	50                   	push   %eax
+  b4:	ff 75 f4             	push   -0xc(%ebp)
+  b7:	e8 61 ff ff ff       	call   1d <setprio>
+  bc:	83 c4 10             	add    $0x10,%esp
+  bf:	85 c0                	test   %eax,%eax
+  c1:	79 1a                	jns    dd <main+0x9c>
+            printf(2, "chrt: cannot set priority of %d\n", pid);
+  c3:	83 ec 04             	sub    $0x4,%esp
+  c6:	ff 75 f4             	push   -0xc(%ebp)
+  c9:	68 bc 0b 00 00       	push   $0xbbc
+  ce:	6a 02                	push   $0x2
+  d0:	e8 f2 06 00 00       	call   7c7 <printf>
+  d5:	83 c4 10             	add    $0x10,%esp
+            exit();
+  d8:	e8 ec 03 00 00       	call   4c9 <exit>
+        }
+        if((prio = sched_getparam(pid)) < 0){
+  dd:	83 ec 0c             	sub    $0xc,%esp
+  e0:	ff 75 f4             	push   -0xc(%ebp)
+  e3:	e8 72 05 00 00       	call   65a <sched_getparam>
+  e8:	83 c4 10             	add    $0x10,%esp
+  eb:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  ee:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+  f2:	79 1a                	jns    10e <main+0xcd>
+            printf(2, "chrt: no process %d\n", pid);
+  f4:	83 ec 04             	sub    $0x4,%esp
+  f7:	ff 75 f4             	push   -0xc(%ebp)
+  fa:	68 dd 0b 00 00       	push   $0xbdd
+  ff:	6a 02                	push   $0x2
+ 101:	e8 c1 06 00 00       	call   7c7 <printf>
+ 106:	83 c4 10             	add    $0x10,%esp
+            exit();
+ 109:	e8 bb 03 00 00       	call   4c9 <exit>
+        }
+        printf(1, "pid %d: %s priority %d\n", pid,
+ 10e:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 112:	74 07                	je     11b <main+0xda>
+ 114:	b8 f2 0b 00 00       	mov    $0xbf2,%eax
+ 119:	eb 05                	jmp    120 <main+0xdf>
+ 11b:	b8 fd 0b 00 00       	mov    $0xbfd,%eax
+ 120:	83 ec 0c             	sub    $0xc,%esp
+ 123:	ff 75 f0             	push   -0x10(%ebp)
+ 126:	50                   	push   %eax
+ 127:	ff 75 f4             	push   -0xc(%ebp)
+ 12a:	68 09 0c 00 00       	push   $0xc09
+ 12f:	6a 01                	push   $0x1
+ 131:	e8 91 06 00 00       	call   7c7 <printf>
+ 136:	83 c4 20             	add    $0x20,%esp
+            prio ? "SCHED_FIFO" : "SCHED_OTHER", prio);
+        exit();
+ 139:	e8 8b 03 00 00       	call   4c9 <exit>
+    }
+
+    if(setprio(0, atoi(argv[1])) < 0){
+ 13e:	8b 43 04             	mov    0x4(%ebx),%eax
+ 141:	83 c0 04             	add    $0x4,%eax
+ 144:	8b 00                	mov    (%eax),%eax
+ 146:	83 ec 0c             	sub    $0xc,%esp
+ 149:	50                   	push   %eax
+ 14a:	e8 35 02 00 00       	call   384 <atoi>
+ 14f:	83 c4 10             	add    $0x10,%esp
+ 152:	83 ec 08             	sub    $0x8,%esp
+ 155:	50                   	push   %eax
+ 156:	6a 00                	push   $0x0
+ 158:	e8 c0 fe ff ff       	call   1d <setprio>
+ 15d:	83 c4 10             	add    $0x10,%esp
+ 160:	85 c0                	test   %eax,%eax
+ 162:	79 20                	jns    184 <main+0x143>
+        printf(2, "chrt: bad priority %s\n", argv[1]);
+ 164:	8b 43 04             	mov    0x4(%ebx),%eax
+ 167:	83 c0 04             	add    $0x4,%eax
+ 16a:	8b 00                	mov    (%eax),%eax
+ 16c:	83 ec 04             	sub    $0x4,%esp
+ 16f:	50                   	push   %eax
+ 170:	68 21 0c 00 00       	push   $0xc21
+ 175:	6a 02                	push   $0x2
+ 177:	e8 4b 06 00 00       	call   7c7 <printf>
+ 17c:	83 c4 10             	add    $0x10,%esp
+        exit();
+ 17f:	e8 45 03 00 00       	call   4c9 <exit>
+    }
+    exec(argv[2], argv + 2);
+ 184:	8b 43 04             	mov    0x4(%ebx),%eax
+ 187:	8d 50 08             	lea    0x8(%eax),%edx
+ 18a:	8b 43 04             	mov    0x4(%ebx),%eax
+ 18d:	83 c0 08             	add    $0x8,%eax
+ 190:	8b 00                	mov    (%eax),%eax
+ 192:	83 ec 08             	sub    $0x8,%esp
+ 195:	52                   	push   %edx
+ 196:	50                   	push   %eax
+ 197:	e8 6a 03 00 00       	call   506 <exec>
+ 19c:	83 c4 10             	add    $0x10,%esp
+    printf(2, "chrt: exec %s failed\n", argv[2]);
+ 19f:	8b 43 04             	mov    0x4(%ebx),%eax
+ 1a2:	83 c0 08             	add    $0x8,%eax
+ 1a5:	8b 00                	mov    (%eax),%eax
+ 1a7:	83 ec 04             	sub    $0x4,%esp
+ 1aa:	50                   	push   %eax
+ 1ab:	68 38 0c 00 00       	push   $0xc38
+ 1b0:	6a 02                	push   $0x2
+ 1b2:	e8 10 06 00 00       	call   7c7 <printf>
+ 1b7:	83 c4 10             	add    $0x10,%esp
+    exit();
+ 1ba:	e8 0a 03 00 00       	call   4c9 <exit>
+
+000001bf <stosb>:
+strchr(const char *s, char c)
+{
+    for(; *s; s++)
+        if(*s == c)
+            return (char*)s;
+    return 0;
+ 1bf:	55                   	push   %ebp
+ 1c0:	89 e5                	mov    %esp,%ebp
+ 1c2:	57                   	push   %edi
+ 1c3:	53                   	push   %ebx
+}
+ 1c4:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 1c7:	8b 55 10             	mov    0x10(%ebp),%edx
+ 1ca:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 1cd:	89 cb                	mov    %ecx,%ebx
+ 1cf:	89 df                	mov    %ebx,%edi
+ 1d1:	89 d1                	mov    %edx,%ecx
+ 1d3:	fc                   	cld
+ 1d4:	f3 aa                	rep stos %al,%es:(%edi)
+ 1d6:	89 ca                	mov    %ecx,%edx
+ 1d8:	89 fb                	mov    %edi,%ebx
+ 1da:	89 5d 08             	mov    %ebx,0x8(%ebp)
+ 1dd:	89 55 10             	mov    %edx,0x10(%ebp)
+
+char*
+gets(char *buf, int max)
+{
+ 1e0:	90                   	nop
+ 1e1:	5b                   	pop    %ebx
+ 1e2:	5f                   	pop    %edi
+ 1e3:	5d                   	pop    %ebp
+ 1e4:	c3                   	ret
+
+000001e5 <strcpy>:
+{
+ 1e5:	55                   	push   %ebp
+ 1e6:	89 e5                	mov    %esp,%ebp
+ 1e8:	83 ec 10             	sub    $0x10,%esp
+    os = s;
+ 1eb:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1ee:	89 45 fc             	mov    %eax,-0x4(%ebp)
+    while((*s++ = *t++) != 0)
+ 1f1:	90                   	nop
+ 1f2:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 1f5:	8d 42 01             	lea    0x1(%edx),%eax
+ 1f8:	89 45 0c             	mov    %eax,0xc(%ebp)
+ 1fb:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1fe:	8d 48 01             	lea    0x1(%eax),%ecx
+ 201:	89 4d 08             	mov    %ecx,0x8(%ebp)
+ 204:	0f b6 12             	movzbl (%edx),%edx
+ 207:	88 10                	mov    %dl,(%eax)
+ 209:	0f b6 00             	movzbl (%eax),%eax
+ 20c:	84 c0                	test   %al,%al
+ 20e:	75 e2                	jne    1f2 <strcpy+0xd>
+    return os;
+ 210:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 213:	c9                   	leave
+ 214:	c3                   	ret
+
+00000215 <strcmp>:
+{
+ 215:	55                   	push   %ebp
+ 216:	89 e5                	mov    %esp,%ebp
+    while(*p && *p == *q)
+ 218:	eb 08                	jmp    222 <strcmp+0xd>
+        p++, q++;
+ 21a:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 21e:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+    while(*p && *p == *q)
+ 222:	8b 45 08             	mov    0x8(%ebp),%eax
+ 225:	0f b6 00             	movzbl (%eax),%eax
+ 228:	84 c0                	test   %al,%al
+ 22a:	74 10                	je     23c <strcmp+0x27>
+ 22c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 22f:	0f b6 10             	movzbl (%eax),%edx
+ 232:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 235:	0f b6 00             	movzbl (%eax),%eax
+ 238:	38 c2                	cmp    %al,%dl
+ 23a:	74 de                	je     21a <strcmp+0x5>
+    return (uchar)*p - (uchar)*q;
+ 23c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 23f:	0f b6 00             	movzbl (%eax),%eax
+ 242:	0f b6 d0             	movzbl %al,%edx
+ 245:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 248:	0f b6 00             	movzbl (%eax),%eax
+ 24b:	0f b6 c0             	movzbl %al,%eax
+ 24e:	29 c2                	sub    %eax,%edx
+ 250:	89 d0                	mov    %edx,%eax
+}
+ 252:	5d                   	pop    %ebp
+ 253:	c3                   	ret
+
+00000254 <strlen>:
+{
+ 254:	55                   	push   %ebp
+ 255:	89 e5                	mov    %esp,%ebp
+ 257:	83 ec 10             	sub    $0x10,%esp
+    for(n = 0; s[n]; n++)
+ 25a:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ 261:	eb 04                	jmp    267 <strlen+0x13>
+ 263:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 267:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 26a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 26d:	01 d0                	add    %edx,%eax
+ 26f:	0f b6 00             	movzbl (%eax),%eax
+ 272:	84 c0                	test   %al,%al
+ 274:	75 ed                	jne    263 <strlen+0xf>
+    return n;
+ 276:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 279:	c9                   	leave
+ 27a:	c3                   	ret
+
+0000027b <memset>:
+{
+ 27b:	55                   	push   %ebp
+ 27c:	89 e5                	mov    %esp,%ebp
+    stosb(dst, c, n);
+ 27e:	8b 45 10             	mov    0x10(%ebp),%eax
+ 281:	50                   	push   %eax
+ 282:	ff 75 0c             	push   0xc(%ebp)
+ 285:	ff 75 08             	push   0x8(%ebp)
+ 288:	e8 32 ff ff ff       	call   1bf <stosb>
+ 28d:	83 c4 0c             	add    $0xc,%esp
+    return dst;
+ 290:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 293:	c9                   	leave
+ 294:	c3                   	ret
+
+00000295 <strchr>:
+{
+ 295:	55                   	push   %ebp
+ 296:	89 e5                	mov    %esp,%ebp
+ 298:	83 ec 04             	sub    $0x4,%esp
+ 29b:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 29e:	88 45 fc             	mov    %al,-0x4(%ebp)
+    for(; *s; s++)
+ 2a1:	eb 14                	jmp    2b7 <strchr+0x22>
+        if(*s == c)
+ 2a3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2a6:	0f b6 00             	movzbl (%eax),%eax
+ 2a9:	38 45 fc             	cmp    %al,-0x4(%ebp)
+ 2ac:	75 05                	jne    2b3 <strchr+0x1e>
+            return (char*)s;
+ 2ae:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2b1:	eb 13                	jmp    2c6 <strchr+0x31>
+    for(; *s; s++)
+ 2b3:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 2b7:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2ba:	0f b6 00             	movzbl (%eax),%eax
+ 2bd:	84 c0                	test   %al,%al
+ 2bf:	75 e2                	jne    2a3 <strchr+0xe>
+    return 0;
+ 2c1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 2c6:	c9                   	leave
+ 2c7:	c3                   	ret
+
+000002c8 <gets>:
+{
+ 2c8:	55                   	push   %ebp
+ 2c9:	89 e5                	mov    %esp,%ebp
+ 2cb:	83 ec 18             	sub    $0x18,%esp
+    int i, cc;
+    char c;
+
+    for(i=0; i+1 < max; ){
+ 2ce:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 2d5:	eb 42                	jmp    319 <gets+0x51>
+        cc = read(0, &c, 1);
+ 2d7:	83 ec 04             	sub    $0x4,%esp
+ 2da:	6a 01                	push   $0x1
+ 2dc:	8d 45 ef             	lea    -0x11(%ebp),%eax
+ 2df:	50                   	push   %eax
+ 2e0:	6a 00                	push   $0x0
+ 2e2:	e8 f7 01 00 00       	call   4de <read>
+ 2e7:	83 c4 10             	add    $0x10,%esp
+ 2ea:	89 45 f0             	mov    %eax,-0x10(%ebp)
+        if(cc < 1)
+ 2ed:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 2f1:	7e 33                	jle    326 <gets+0x5e>
+            break;
+        buf[i++] = c;
+ 2f3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 2f6:	8d 50 01             	lea    0x1(%eax),%edx
+ 2f9:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 2fc:	89 c2                	mov    %eax,%edx
+ 2fe:	8b 45 08             	mov    0x8(%ebp),%eax
+ 301:	01 c2                	add    %eax,%edx
+ 303:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 307:	88 02                	mov    %al,(%edx)
+        if(c == '\n' || c == '\r')
+ 309:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 30d:	3c 0a                	cmp    $0xa,%al
+ 30f:	74 16                	je     327 <gets+0x5f>
+ 311:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 315:	3c 0d                	cmp    $0xd,%al
+ 317:	74 0e                	je     327 <gets+0x5f>
+    for(i=0; i+1 < max; ){
+ 319:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 31c:	83 c0 01             	add    $0x1,%eax
+ 31f:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 322:	7f b3                	jg     2d7 <gets+0xf>
+ 324:	eb 01                	jmp    327 <gets+0x5f>
+            break;
+ 326:	90                   	nop
+            break;
+    }
+    buf[i] = '\0';
+ 327:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 32a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 32d:	01 d0                	add    %edx,%eax
+ 32f:	c6 00 00             	movb   $0x0,(%eax)
+    return buf;
+ 332:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 335:	c9                   	leave
+ 336:	c3                   	ret
+
+00000337 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 337:	55                   	push   %ebp
+ 338:	89 e5                	mov    %esp,%ebp
+ 33a:	83 ec 18             	sub    $0x18,%esp
+    int fd;
+    int r;
+
+    fd = open(n, O_RDONLY);
+ 33d:	83 ec 08             	sub    $0x8,%esp
+ 340:	6a 00                	push   $0x0
+ 342:	ff 75 08             	push   0x8(%ebp)
+ 345:	e8 c6 01 00 00       	call   510 <open>
+ 34a:	83 c4 10             	add    $0x10,%esp
+ 34d:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(fd < 0)
+ 350:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 354:	79 07                	jns    35d <stat+0x26>
+        return -1;
+ 356:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 35b:	eb 25                	jmp    382 <stat+0x4b>
+    r = fstat(fd, st);
+ 35d:	83 ec 08             	sub    $0x8,%esp
+ 360:	ff 75 0c             	push   0xc(%ebp)
+ 363:	ff 75 f4             	push   -0xc(%ebp)
+ 366:	e8 c3 01 00 00       	call   52e <fstat>
+ 36b:	83 c4 10             	add    $0x10,%esp
+ 36e:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    close(fd);
+ 371:	83 ec 0c             	sub    $0xc,%esp
+ 374:	ff 75 f4             	push   -0xc(%ebp)
+ 377:	e8 76 01 00 00       	call   4f2 <close>
+ 37c:	83 c4 10             	add    $0x10,%esp
+    return r;
+ 37f:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ 382:	c9                   	leave
+ 383:	c3                   	ret
+
+00000384 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 384:	55                   	push   %ebp
+ 385:	89 e5                	mov    %esp,%ebp
+ 387:	83 ec 10             	sub    $0x10,%esp
+    int n;
+
+    n = 0;
+ 38a:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+    while('0' <= *s && *s <= '9')
+ 391:	eb 25                	jmp    3b8 <atoi+0x34>
+        n = n*10 + *s++ - '0';
+ 393:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 396:	89 d0                	mov    %edx,%eax
+ 398:	c1 e0 02             	shl    $0x2,%eax
+ 39b:	01 d0                	add    %edx,%eax
+ 39d:	01 c0                	add    %eax,%eax
+ 39f:	89 c1                	mov    %eax,%ecx
+ 3a1:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3a4:	8d 50 01             	lea    0x1(%eax),%edx
+ 3a7:	89 55 08             	mov    %edx,0x8(%ebp)
+ 3aa:	0f b6 00             	movzbl (%eax),%eax
+ 3ad:	0f be c0             	movsbl %al,%eax
+ 3b0:	01 c8                	add    %ecx,%eax
+ 3b2:	83 e8 30             	sub    $0x30,%eax
+ 3b5:	89 45 fc             	mov    %eax,-0x4(%ebp)
+    while('0' <= *s && *s <= '9')
+ 3b8:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3bb:	0f b6 00             	movzbl (%eax),%eax
+ 3be:	3c 2f                	cmp    $0x2f,%al
+ 3c0:	7e 0a                	jle    3cc <atoi+0x48>
+ 3c2:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3c5:	0f b6 00             	movzbl (%eax),%eax
+ 3c8:	3c 39                	cmp    $0x39,%al
+ 3ca:	7e c7                	jle    393 <atoi+0xf>
+    return n;
+ 3cc:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 3cf:	c9                   	leave
+ 3d0:	c3                   	ret
+
+000003d1 <nice>:
+
+// Add inc to the caller's nice value; return the new value.
+int
+nice(int inc)
+{
+ 3d1:	55                   	push   %ebp
+ 3d2:	89 e5                	mov    %esp,%ebp
+ 3d4:	83 ec 18             	sub    $0x18,%esp
+    int n;
+
+    n = getpriority(0) + inc;
+ 3d7:	83 ec 0c             	sub    $0xc,%esp
+ 3da:	6a 00                	push   $0x0
+ 3dc:	e8 d9 01 00 00       	call   5ba <getpriority>
+ 3e1:	83 c4 10             	add    $0x10,%esp
+ 3e4:	8b 55 08             	mov    0x8(%ebp),%edx
+ 3e7:	01 d0                	add    %edx,%eax
+ 3e9:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(n < 0)
+ 3ec:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 3f0:	79 07                	jns    3f9 <nice+0x28>
+        n = 0;
+ 3f2:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    if(n > NICEMAX)
+ 3f9:	83 7d f4 13          	cmpl   $0x13,-0xc(%ebp)
+ 3fd:	7e 07                	jle    406 <nice+0x35>
+        n = NICEMAX;
+ 3ff:	c7 45 f4 13 00 00 00 	movl   $0x13,-0xc(%ebp)
+    if(setpriority(0, n) < 0)
+ 406:	83 ec 08             	sub    $0x8,%esp
+ 409:	ff 75 f4             	push   -0xc(%ebp)
+ 40c:	6a 00                	push   $0x0
+ 40e:	e8 b1 01 00 00       	call   5c4 <setpriority>
+ 413:	83 c4 10             	add    $0x10,%esp
+ 416:	85 c0                	test   %eax,%eax
+ 418:	79 07                	jns    421 <nice+0x50>
+        return -1;
+ 41a:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 41f:	eb 03                	jmp    424 <nice+0x53>
+    return n;
+ 421:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+ 424:	c9                   	leave
+ 425:	c3                   	ret
+
+00000426 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 426:	55                   	push   %ebp
+ 427:	89 e5                	mov    %esp,%ebp
+ 429:	83 ec 10             	sub    $0x10,%esp
+    char *dst;
+    const char *src;
+
+    dst = vdst;
+ 42c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 42f:	89 45 fc             	mov    %eax,-0x4(%ebp)
+    src = vsrc;
+ 432:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 435:	89 45 f8             	mov    %eax,-0x8(%ebp)
+    while(n-- > 0)
+ 438:	eb 17                	jmp    451 <memmove+0x2b>
+        *dst++ = *src++;
+ 43a:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 43d:	8d 42 01             	lea    0x1(%edx),%eax
+ 440:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 443:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 446:	8d 48 01             	lea    0x1(%eax),%ecx
+ 449:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+ 44c:	0f b6 12             	movzbl (%edx),%edx
+ 44f:	88 10                	mov    %dl,(%eax)
+    while(n-- > 0)
+ 451:	8b 45 10             	mov    0x10(%ebp),%eax
+ 454:	8d 50 ff             	lea    -0x1(%eax),%edx
+ 457:	89 55 10             	mov    %edx,0x10(%ebp)
+ 45a:	85 c0                	test   %eax,%eax
+ 45c:	7f dc                	jg     43a <memmove+0x14>
+    return vdst;
+ 45e:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 461:	c9                   	leave
+ 462:	c3                   	ret
+
+00000463 <dosyscall>:
+sysmode:
+    .long 0
+
+    .text
+dosyscall:
+    cmpl $0, sysmode
+ 463:	83 3d fc 0e 00 00 00 	cmpl   $0x0,0xefc
+    jg 2f
+ 46a:	7f 0c                	jg     478 <dosyscall+0x15>
+    jl 1f
+ 46c:	7c 07                	jl     475 <dosyscall+0x12>
+    call sepcheck
+ 46e:	e8 27 00 00 00       	call   49a <sepcheck>
+    jmp dosyscall
+ 473:	eb ee                	jmp    463 <dosyscall>
+1:
+    int $T_SYSCALL
+ 475:	cd 40                	int    $0x40
+    ret
+ 477:	c3                   	ret
+2:
+    pushl %ebx
+ 478:	53                   	push   %ebx
+    pushl %esi
+ 479:	56                   	push   %esi
+    pushl %edi
+ 47a:	57                   	push   %edi
+    pushl %ebp
+ 47b:	55                   	push   %ebp
+    movl 20(%esp), %ebx
+ 47c:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+    movl 24(%esp), %esi
+ 480:	8b 74 24 18          	mov    0x18(%esp),%esi
+    movl 28(%esp), %edi
+ 484:	8b 7c 24 1c          	mov    0x1c(%esp),%edi
+    movl 32(%esp), %ebp
+ 488:	8b 6c 24 20          	mov    0x20(%esp),%ebp
+    movl %esp, %ecx
+ 48c:	89 e1                	mov    %esp,%ecx
+    movl $3f, %edx
+ 48e:	ba 95 04 00 00       	mov    $0x495,%edx
+    sysenter
+ 493:	0f 34                	sysenter
+3:
+    popl %ebp
+ 495:	5d                   	pop    %ebp
+    popl %edi
+ 496:	5f                   	pop    %edi
+    popl %esi
+ 497:	5e                   	pop    %esi
+    popl %ebx
+ 498:	5b                   	pop    %ebx
+    ret
+ 499:	c3                   	ret
+
+0000049a <sepcheck>:
+
+# Set sysmode from cpuid's SEP flag.    Preserves %eax.
+sepcheck:
+    pushl %eax
+ 49a:	50                   	push   %eax
+    pushl %ebx
+ 49b:	53                   	push   %ebx
+    movl $1, %eax
+ 49c:	b8 01 00 00 00       	mov    $0x1,%eax
+    cpuid
+ 4a1:	0f a2                	cpuid
+    movl $-1, sysmode
+ 4a3:	c7 05 fc 0e 00 00 ff 	movl   $0xffffffff,0xefc
+ 4aa:	ff ff ff 
+    testl $0x800, %edx
+ 4ad:	f7 c2 00 08 00 00    	test   $0x800,%edx
+    jz 1f
+ 4b3:	74 0a                	je     4bf <sepcheck+0x25>
+    movl $1, sysmode
+ 4b5:	c7 05 fc 0e 00 00 01 	movl   $0x1,0xefc
+ 4bc:	00 00 00 
+1:
+    popl %ebx
+ 4bf:	5b                   	pop    %ebx
+    popl %eax
+ 4c0:	58                   	pop    %eax
+    ret
+ 4c1:	c3                   	ret
+
+000004c2 <fork>:
+
+SYSCALL(fork)
+ 4c2:	b8 01 00 00 00       	mov    $0x1,%eax
+ 4c7:	eb 9a                	jmp    463 <dosyscall>
+
+000004c9 <exit>:
+SYSCALL(exit)
+ 4c9:	b8 02 00 00 00       	mov    $0x2,%eax
+ 4ce:	eb 93                	jmp    463 <dosyscall>
+
+000004d0 <wait>:
+SYSCALL(wait)
+ 4d0:	b8 03 00 00 00       	mov    $0x3,%eax
+ 4d5:	eb 8c                	jmp    463 <dosyscall>
+
+000004d7 <pipe>:
+SYSCALL(pipe)
+ 4d7:	b8 04 00 00 00       	mov    $0x4,%eax
+ 4dc:	eb 85                	jmp    463 <dosyscall>
+
+000004de <read>:
+SYSCALL(read)
+ 4de:	b8 05 00 00 00       	mov    $0x5,%eax
+ 4e3:	e9 7b ff ff ff       	jmp    463 <dosyscall>
+
+000004e8 <write>:
+SYSCALL(write)
+ 4e8:	b8 10 00 00 00       	mov    $0x10,%eax
+ 4ed:	e9 71 ff ff ff       	jmp    463 <dosyscall>
+
+000004f2 <close>:
+SYSCALL(close)
+ 4f2:	b8 15 00 00 00       	mov    $0x15,%eax
+ 4f7:	e9 67 ff ff ff       	jmp    463 <dosyscall>
+
+000004fc <kill>:
+SYSCALL(kill)
+ 4fc:	b8 06 00 00 00       	mov    $0x6,%eax
+ 501:	e9 5d ff ff ff       	jmp    463 <dosyscall>
+
+00000506 <exec>:
+SYSCALL(exec)
+ 506:	b8 07 00 00 00       	mov    $0x7,%eax
+ 50b:	e9 53 ff ff ff       	jmp    463 <dosyscall>
+
+00000510 <open>:
+SYSCALL(open)
+ 510:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 515:	e9 49 ff ff ff       	jmp    463 <dosyscall>
+
+0000051a <mknod>:
+SYSCALL(mknod)
+ 51a:	b8 11 00 00 00       	mov    $0x11,%eax
+ 51f:	e9 3f ff ff ff       	jmp    463 <dosyscall>
+
+00000524 <unlink>:
+SYSCALL(unlink)
+ 524:	b8 12 00 00 00       	mov    $0x12,%eax
+ 529:	e9 35 ff ff ff       	jmp    463 <dosyscall>
+
+0000052e <fstat>:
+SYSCALL(fstat)
+ 52e:	b8 08 00 00 00       	mov    $0x8,%eax
+ 533:	e9 2b ff ff ff       	jmp    463 <dosyscall>
+
+00000538 <link>:
+SYSCALL(link)
+ 538:	b8 13 00 00 00       	mov    $0x13,%eax
+ 53d:	e9 21 ff ff ff       	jmp    463 <dosyscall>
+
+00000542 <mkdir>:
+SYSCALL(mkdir)
+ 542:	b8 14 00 00 00       	mov    $0x14,%eax
+ 547:	e9 17 ff ff ff       	jmp    463 <dosyscall>
+
+0000054c <chdir>:
+SYSCALL(chdir)
+ 54c:	b8 09 00 00 00       	mov    $0x9,%eax
+ 551:	e9 0d ff ff ff       	jmp    463 <dosyscall>
+
+00000556 <dup>:
+SYSCALL(dup)
+ 556:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 55b:	e9 03 ff ff ff       	jmp    463 <dosyscall>
+
+00000560 <getpid>:
+SYSCALL(getpid)
+ 560:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 565:	e9 f9 fe ff ff       	jmp    463 <dosyscall>
+
+0000056a <sbrk>:
+SYSCALL(sbrk)
+ 56a:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 56f:	e9 ef fe ff ff       	jmp    463 <dosyscall>
+
+00000574 <sleep>:
+SYSCALL(sleep)
+ 574:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 579:	e9 e5 fe ff ff       	jmp    463 <dosyscall>
+
+0000057e <uptime>:
+SYSCALL(uptime)
+ 57e:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 583:	e9 db fe ff ff       	jmp    463 <dosyscall>
+
+00000588 <date>:
+SYSCALL(date)
+ 588:	b8 16 00 00 00       	mov    $0x16,%eax
+ 58d:	e9 d1 fe ff ff       	jmp    463 <dosyscall>
+
+00000592 <dup2>:
+SYSCALL(dup2)
+ 592:	b8 17 00 00 00       	mov    $0x17,%eax
+ 597:	e9 c7 fe ff ff       	jmp    463 <dosyscall>
+
+0000059c <uffd>:
+SYSCALL(uffd)
+ 59c:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 5a1:	e9 bd fe ff ff       	jmp    463 <dosyscall>
+
+000005a6 <uffdregister>:
+SYSCALL(uffdregister)
+ 5a6:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 5ab:	e9 b3 fe ff ff       	jmp    463 <dosyscall>
+
+000005b0 <uffdcopy>:
+SYSCALL(uffdcopy)
+ 5b0:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 5b5:	e9 a9 fe ff ff       	jmp    463 <dosyscall>
+
+000005ba <getpriority>:
+SYSCALL(getpriority)
+ 5ba:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 5bf:	e9 9f fe ff ff       	jmp    463 <dosyscall>
+
+000005c4 <setpriority>:
+SYSCALL(setpriority)
+ 5c4:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 5c9:	e9 95 fe ff ff       	jmp    463 <dosyscall>
+
+000005ce <setweight>:
+SYSCALL(setweight)
+ 5ce:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 5d3:	e9 8b fe ff ff       	jmp    463 <dosyscall>
+
+000005d8 <setgroup>:
+SYSCALL(setgroup)
+ 5d8:	b8 20 00 00 00       	mov    $0x20,%eax
+ 5dd:	e9 81 fe ff ff       	jmp    463 <dosyscall>
+
+000005e2 <schedinfo>:
+SYSCALL(schedinfo)
+ 5e2:	b8 21 00 00 00       	mov    $0x21,%eax
+ 5e7:	e9 77 fe ff ff       	jmp    463 <dosyscall>
+
+000005ec <nanosleep>:
+SYSCALL(nanosleep)
+ 5ec:	b8 22 00 00 00       	mov    $0x22,%eax
+ 5f1:	e9 6d fe ff ff       	jmp    463 <dosyscall>
+
+000005f6 <clock_nanosleep>:
+SYSCALL(clock_nanosleep)
+ 5f6:	b8 23 00 00 00       	mov    $0x23,%eax
+ 5fb:	e9 63 fe ff ff       	jmp    463 <dosyscall>
+
+00000600 <clock_gettime>:
+SYSCALL(clock_gettime)
+ 600:	b8 24 00 00 00       	mov    $0x24,%eax
+ 605:	e9 59 fe ff ff       	jmp    463 <dosyscall>
+
+0000060a <sched_setaffinity>:
+SYSCALL(sched_setaffinity)
+ 60a:	b8 25 00 00 00       	mov    $0x25,%eax
+ 60f:	e9 4f fe ff ff       	jmp    463 <dosyscall>
+
+00000614 <sched_getaffinity>:
+SYSCALL(sched_getaffinity)
+ 614:	b8 26 00 00 00       	mov    $0x26,%eax
+ 619:	e9 45 fe ff ff       	jmp    463 <dosyscall>
+
+0000061e <irqaffinity>:
+SYSCALL(irqaffinity)
+ 61e:	b8 27 00 00 00       	mov    $0x27,%eax
+ 623:	e9 3b fe ff ff       	jmp    463 <dosyscall>
+
+00000628 <getrusage>:
+SYSCALL(getrusage)
+ 628:	b8 28 00 00 00       	mov    $0x28,%eax
+ 62d:	e9 31 fe ff ff       	jmp    463 <dosyscall>
+
+00000632 <times>:
+SYSCALL(times)
+ 632:	b8 29 00 00 00       	mov    $0x29,%eax
+ 637:	e9 27 fe ff ff       	jmp    463 <dosyscall>
+
+0000063c <schedlat>:
+SYSCALL(schedlat)
+ 63c:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 641:	e9 1d fe ff ff       	jmp    463 <dosyscall>
+
+00000646 <sched_setscheduler>:
+SYSCALL(sched_setscheduler)
+ 646:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 64b:	e9 13 fe ff ff       	jmp    463 <dosyscall>
+
+00000650 <sched_getscheduler>:
+SYSCALL(sched_getscheduler)
+ 650:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 655:	e9 09 fe ff ff       	jmp    463 <dosyscall>
+
+0000065a <sched_getparam>:
+SYSCALL(sched_getparam)
+ 65a:	b8 2d 00 00 00       	mov    $0x2d,%eax
+ 65f:	e9 ff fd ff ff       	jmp    463 <dosyscall>
+
+00000664 <lockstat>:
+SYSCALL(lockstat)
+ 664:	b8 2e 00 00 00       	mov    $0x2e,%eax
+ 669:	e9 f5 fd ff ff       	jmp    463 <dosyscall>
+
+0000066e <ioring_setup>:
+SYSCALL(ioring_setup)
+ 66e:	b8 2f 00 00 00       	mov    $0x2f,%eax
+ 673:	e9 eb fd ff ff       	jmp    463 <dosyscall>
+
+00000678 <ioring_enter>:
+SYSCALL(ioring_enter)
+ 678:	b8 30 00 00 00       	mov    $0x30,%eax
+ 67d:	e9 e1 fd ff ff       	jmp    463 <dosyscall>
+
+00000682 <readv>:
+SYSCALL(readv)
+ 682:	b8 31 00 00 00       	mov    $0x31,%eax
+ 687:	e9 d7 fd ff ff       	jmp    463 <dosyscall>
+
+0000068c <writev>:
+SYSCALL(writev)
+ 68c:	b8 32 00 00 00       	mov    $0x32,%eax
+ 691:	e9 cd fd ff ff       	jmp    463 <dosyscall>
+
+00000696 <pread>:
+SYSCALL(pread)
+ 696:	b8 33 00 00 00       	mov    $0x33,%eax
+ 69b:	e9 c3 fd ff ff       	jmp    463 <dosyscall>
+
+000006a0 <pwrite>:
+SYSCALL(pwrite)
+ 6a0:	b8 34 00 00 00       	mov    $0x34,%eax
+ 6a5:	e9 b9 fd ff ff       	jmp    463 <dosyscall>
+
+000006aa <sendfile>:
+SYSCALL(sendfile)
+ 6aa:	b8 35 00 00 00       	mov    $0x35,%eax
+ 6af:	e9 af fd ff ff       	jmp    463 <dosyscall>
+
+000006b4 <splice>:
+SYSCALL(splice)
+ 6b4:	b8 36 00 00 00       	mov    $0x36,%eax
+ 6b9:	e9 a5 fd ff ff       	jmp    463 <dosyscall>
+
+000006be <sysstat>:
+SYSCALL(sysstat)
+ 6be:	b8 37 00 00 00       	mov    $0x37,%eax
+ 6c3:	e9 9b fd ff ff       	jmp    463 <dosyscall>
+
+000006c8 <strace>:
+SYSCALL(strace)
+ 6c8:	b8 38 00 00 00       	mov    $0x38,%eax
+ 6cd:	e9 91 fd ff ff       	jmp    463 <dosyscall>
+
+000006d2 <straceread>:
+SYSCALL(straceread)
+ 6d2:	b8 39 00 00 00       	mov    $0x39,%eax
+ 6d7:	e9 87 fd ff ff       	jmp    463 <dosyscall>
+
+000006dc <alarm>:
+
+# alarm and rstoregs keep to int $T_SYSCALL: rstoregs restores
+# %ecx and %edx, which sysexit would clobber.
+.globl alarm
+    alarm:
+        pushl $rstoregs
+ 6dc:	68 ec 06 00 00       	push   $0x6ec
+        movl $SYS_alarm, %eax
+ 6e1:	b8 18 00 00 00       	mov    $0x18,%eax
+        int $T_SYSCALL
+ 6e6:	cd 40                	int    $0x40
+        add $0x04, %esp
+ 6e8:	83 c4 04             	add    $0x4,%esp
+        ret
+ 6eb:	c3                   	ret
+
+000006ec <rstoregs>:
+
+.globl rstoregs
+    rstoregs:
+        movl $SYS_rstoregs, %eax
+ 6ec:	b8 19 00 00 00       	mov    $0x19,%eax
+        int $T_SYSCALL
+ 6f1:	cd 40                	int    $0x40
+
+000006f3 <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 6f3:	55                   	push   %ebp
+ 6f4:	89 e5                	mov    %esp,%ebp
+ 6f6:	83 ec 18             	sub    $0x18,%esp
+ 6f9:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 6fc:	88 45 f4             	mov    %al,-0xc(%ebp)
+    write(fd, &c, 1);
+ 6ff:	83 ec 04             	sub    $0x4,%esp
+ 702:	6a 01                	push   $0x1
+ 704:	8d 45 f4             	lea    -0xc(%ebp),%eax
+ 707:	50                   	push   %eax
+ 708:	ff 75 08             	push   0x8(%ebp)
+ 70b:	e8 d8 fd ff ff       	call   4e8 <write>
+ 710:	83 c4 10             	add    $0x10,%esp
+}
+ 713:	90                   	nop
+ 714:	c9                   	leave
+ 715:	c3                   	ret
+
+00000716 <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 716:	55                   	push   %ebp
+ 717:	89 e5                	mov    %esp,%ebp
+ 719:	83 ec 28             	sub    $0x28,%esp
+    static char digits[] = "0123456789ABCDEF";
+    char buf[16];
+    int i, neg;
+    uint x;
+
+    neg = 0;
+ 71c:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+    if(sgn && xx < 0){
+ 723:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+ 727:	74 17                	je     740 <printint+0x2a>
+ 729:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 72d:	79 11                	jns    740 <printint+0x2a>
+        neg = 1;
+ 72f:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+        x = -xx;
+ 736:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 739:	f7 d8                	neg    %eax
+ 73b:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 73e:	eb 06                	jmp    746 <printint+0x30>
+    } else {
+        x = xx;
+ 740:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 743:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    }
+
+    i = 0;
+ 746:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    do{
+        buf[i++] = digits[x % base];
+ 74d:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 750:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 753:	ba 00 00 00 00       	mov    $0x0,%edx
+ 758:	f7 f1                	div    %ecx
+ 75a:	89 d1                	mov    %edx,%ecx
+ 75c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 75f:	8d 50 01             	lea    0x1(%eax),%edx
+ 762:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 765:	0f b6 91 00 0f 00 00 	movzbl 0xf00(%ecx),%edx
+ 76c:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+    }while((x /= base) != 0);
+ 770:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 773:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 776:	ba 00 00 00 00       	mov    $0x0,%edx
+ 77b:	f7 f1                	div    %ecx
+ 77d:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 780:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 784:	75 c7                	jne    74d <printint+0x37>
+    if(neg)
+ 786:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 78a:	74 2d                	je     7b9 <printint+0xa3>
+        buf[i++] = '-';
+ 78c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 78f:	8d 50 01             	lea    0x1(%eax),%edx
+ 792:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 795:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+    while(--i >= 0)
+ 79a:	eb 1d                	jmp    7b9 <printint+0xa3>
+        putc(fd, buf[i]);
+ 79c:	8d 55 dc             	lea    -0x24(%ebp),%edx
+ 79f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 7a2:	01 d0                	add    %edx,%eax
+ 7a4:	0f b6 00             	movzbl (%eax),%eax
+ 7a7:	0f be c0             	movsbl %al,%eax
+ 7aa:	83 ec 08             	sub    $0x8,%esp
+ 7ad:	50                   	push   %eax
+ 7ae:	ff 75 08             	push   0x8(%ebp)
+ 7b1:	e8 3d ff ff ff       	call   6f3 <putc>
+ 7b6:	83 c4 10             	add    $0x10,%esp
+    while(--i >= 0)
+ 7b9:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+ 7bd:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 7c1:	79 d9                	jns    79c <printint+0x86>
+}
+ 7c3:	90                   	nop
+ 7c4:	90                   	nop
+ 7c5:	c9                   	leave
+ 7c6:	c3                   	ret
+
+000007c7 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 7c7:	55                   	push   %ebp
+ 7c8:	89 e5                	mov    %esp,%ebp
+ 7ca:	83 ec 28             	sub    $0x28,%esp
+    char *s;
+    int c, i, state;
+    uint *ap;
+
+    state = 0;
+ 7cd:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+    ap = (uint*)(void*)&fmt + 1;
+ 7d4:	8d 45 0c             	lea    0xc(%ebp),%eax
+ 7d7:	83 c0 04             	add    $0x4,%eax
+ 7da:	89 45 e8             	mov    %eax,-0x18(%ebp)
+    for(i = 0; fmt[i]; i++){
+ 7dd:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 7e4:	e9 59 01 00 00       	jmp    942 <printf+0x17b>
+        c = fmt[i] & 0xff;
+ 7e9:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 7ec:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 7ef:	01 d0                	add    %edx,%eax
+ 7f1:	0f b6 00             	movzbl (%eax),%eax
+ 7f4:	0f be c0             	movsbl %al,%eax
+ 7f7:	25 ff 00 00 00       	and    $0xff,%eax
+ 7fc:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        if(state == 0){
+ 7ff:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 803:	75 2c                	jne    831 <printf+0x6a>
+            if(c == '%'){
+ 805:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 809:	75 0c                	jne    817 <printf+0x50>
+                state = '%';
+ 80b:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+ 812:	e9 27 01 00 00       	jmp    93e <printf+0x177>
+            } else {
+                putc(fd, c);
+ 817:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 81a:	0f be c0             	movsbl %al,%eax
+ 81d:	83 ec 08             	sub    $0x8,%esp
+ 820:	50                   	push   %eax
+ 821:	ff 75 08             	push   0x8(%ebp)
+ 824:	e8 ca fe ff ff       	call   6f3 <putc>
+ 829:	83 c4 10             	add    $0x10,%esp
+ 82c:	e9 0d 01 00 00       	jmp    93e <printf+0x177>
+            }
+        } else if(state == '%'){
+ 831:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+ 835:	0f 85 03 01 00 00    	jne    93e <printf+0x177>
+            if(c == 'd'){
+ 83b:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+ 83f:	75 1e                	jne    85f <printf+0x98>
+                printint(fd, *ap, 10, 1);
+ 841:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 844:	8b 00                	mov    (%eax),%eax
+ 846:	6a 01                	push   $0x1
+ 848:	6a 0a                	push   $0xa
+ 84a:	50                   	push   %eax
+ 84b:	ff 75 08             	push   0x8(%ebp)
+ 84e:	e8 c3 fe ff ff       	call   716 <printint>
+ 853:	83 c4 10             	add    $0x10,%esp
+                ap++;
+ 856:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 85a:	e9 d8 00 00 00       	jmp    937 <printf+0x170>
+            } else if(c == 'x' || c == 'p'){
+ 85f:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+ 863:	74 06                	je     86b <printf+0xa4>
+ 865:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+ 869:	75 1e                	jne    889 <printf+0xc2>
+                printint(fd, *ap, 16, 0);
+ 86b:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 86e:	8b 00                	mov    (%eax),%eax
+ 870:	6a 00                	push   $0x0
+ 872:	6a 10                	push   $0x10
+ 874:	50                   	push   %eax
+ 875:	ff 75 08             	push   0x8(%ebp)
+ 878:	e8 99 fe ff ff       	call   716 <printint>
+ 87d:	83 c4 10             	add    $0x10,%esp
+                ap++;
+ 880:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 884:	e9 ae 00 00 00       	jmp    937 <printf+0x170>
+            } else if(c == 's'){
+ 889:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+ 88d:	75 43                	jne    8d2 <printf+0x10b>
+                s = (char*)*ap;
+ 88f:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 892:	8b 00                	mov    (%eax),%eax
+ 894:	89 45 f4             	mov    %eax,-0xc(%ebp)
+                ap++;
+ 897:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+                if(s == 0)
+ 89b:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 89f:	75 25                	jne    8c6 <printf+0xff>
+                    s = "(null)";
+ 8a1:	c7 45 f4 4e 0c 00 00 	movl   $0xc4e,-0xc(%ebp)
+                while(*s != 0){
+ 8a8:	eb 1c                	jmp    8c6 <printf+0xff>
+                    putc(fd, *s);
+ 8aa:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 8ad:	0f b6 00             	movzbl (%eax),%eax
+ 8b0:	0f be c0             	movsbl %al,%eax
+ 8b3:	83 ec 08             	sub    $0x8,%esp
+ 8b6:	50                   	push   %eax
+ 8b7:	ff 75 08             	push   0x8(%ebp)
+ 8ba:	e8 34 fe ff ff       	call   6f3 <putc>
+ 8bf:	83 c4 10             	add    $0x10,%esp
+                    s++;
+ 8c2:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+                while(*s != 0){
+ 8c6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 8c9:	0f b6 00             	movzbl (%eax),%eax
+ 8cc:	84 c0                	test   %al,%al
+ 8ce:	75 da                	jne    8aa <printf+0xe3>
+ 8d0:	eb 65                	jmp    937 <printf+0x170>
+                }
+            } else if(c == 'c'){
+ 8d2:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+ 8d6:	75 1d                	jne    8f5 <printf+0x12e>
+                putc(fd, *ap);
+ 8d8:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 8db:	8b 00                	mov    (%eax),%eax
+ 8dd:	0f be c0             	movsbl %al,%eax
+ 8e0:	83 ec 08             	sub    $0x8,%esp
+ 8e3:	50                   	push   %eax
+ 8e4:	ff 75 08             	push   0x8(%ebp)
+ 8e7:	e8 07 fe ff ff       	call   6f3 <putc>
+ 8ec:	83 c4 10             	add    $0x10,%esp
+                ap++;
+ 8ef:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 8f3:	eb 42                	jmp    937 <printf+0x170>
+            } else if(c == '%'){
+ 8f5:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 8f9:	75 17                	jne    912 <printf+0x14b>
+                putc(fd, c);
+ 8fb:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 8fe:	0f be c0             	movsbl %al,%eax
+ 901:	83 ec 08             	sub    $0x8,%esp
+ 904:	50                   	push   %eax
+ 905:	ff 75 08             	push   0x8(%ebp)
+ 908:	e8 e6 fd ff ff       	call   6f3 <putc>
+ 90d:	83 c4 10             	add    $0x10,%esp
+ 910:	eb 25                	jmp    937 <printf+0x170>
+            } else {
+                // Unknown % sequence.    Print it to draw attention.
+                putc(fd, '%');
+ 912:	83 ec 08             	sub    $0x8,%esp
+ 915:	6a 25                	push   $0x25
+ 917:	ff 75 08             	push   0x8(%ebp)
+ 91a:	e8 d4 fd ff ff       	call   6f3 <putc>
+ 91f:	83 c4 10             	add    $0x10,%esp
+                putc(fd, c);
+ 922:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 925:	0f be c0             	movsbl %al,%eax
+ 928:	83 ec 08             	sub    $0x8,%esp
+ 92b:	50                   	push   %eax
+ 92c:	ff 75 08             	push   0x8(%ebp)
+ 92f:	e8 bf fd ff ff       	call   6f3 <putc>
+ 934:	83 c4 10             	add    $0x10,%esp
+            }
+            state = 0;
+ 937:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+    for(i = 0; fmt[i]; i++){
+ 93e:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ 942:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 945:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 948:	01 d0                	add    %edx,%eax
+ 94a:	0f b6 00             	movzbl (%eax),%eax
+ 94d:	84 c0                	test   %al,%al
+ 94f:	0f 85 94 fe ff ff    	jne    7e9 <printf+0x22>
+        }
+    }
+}
+ 955:	90                   	nop
+ 956:	90                   	nop
+ 957:	c9                   	leave
+ 958:	c3                   	ret
+
+00000959 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 959:	55                   	push   %ebp
+ 95a:	89 e5                	mov    %esp,%ebp
+ 95c:	83 ec 10             	sub    $0x10,%esp
+    Header *bp, *p;
+
+    bp = (Header*)ap - 1;
+ 95f:	8b 45 08             	mov    0x8(%ebp),%eax
+ 962:	83 e8 08             	sub    $0x8,%eax
+ 965:	89 45 f8             	mov    %eax,-0x8(%ebp)
+    for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 968:	a1 1c 0f 00 00       	mov    0xf1c,%eax
+ 96d:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 970:	eb 24                	jmp    996 <free+0x3d>
+        if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 972:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 975:	8b 00                	mov    (%eax),%eax
+ 977:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 97a:	72 12                	jb     98e <free+0x35>
+ 97c:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 97f:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 982:	72 24                	jb     9a8 <free+0x4f>
+ 984:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 987:	8b 00                	mov    (%eax),%eax
+ 989:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 98c:	72 1a                	jb     9a8 <free+0x4f>
+    for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 98e:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 991:	8b 00                	mov    (%eax),%eax
+ 993:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 996:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 999:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 99c:	73 d4                	jae    972 <free+0x19>
+ 99e:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 9a1:	8b 00                	mov    (%eax),%eax
+ 9a3:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 9a6:	73 ca                	jae    972 <free+0x19>
+            break;
+    if(bp + bp->s.size == p->s.ptr){
+ 9a8:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 9ab:	8b 40 04             	mov    0x4(%eax),%eax
+ 9ae:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 9b5:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 9b8:	01 c2                	add    %eax,%edx
+ 9ba:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 9bd:	8b 00                	mov    (%eax),%eax
+ 9bf:	39 c2                	cmp    %eax,%edx
+ 9c1:	75 24                	jne    9e7 <free+0x8e>
+        bp->s.size += p->s.ptr->s.size;
+ 9c3:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 9c6:	8b 50 04             	mov    0x4(%eax),%edx
+ 9c9:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 9cc:	8b 00                	mov    (%eax),%eax
+ 9ce:	8b 40 04             	mov    0x4(%eax),%eax
+ 9d1:	01 c2                	add    %eax,%edx
+ 9d3:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 9d6:	89 50 04             	mov    %edx,0x4(%eax)
+        bp->s.ptr = p->s.ptr->s.ptr;
+ 9d9:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 9dc:	8b 00                	mov    (%eax),%eax
+ 9de:	8b 10                	mov    (%eax),%edx
+ 9e0:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 9e3:	89 10                	mov    %edx,(%eax)
+ 9e5:	eb 0a                	jmp    9f1 <free+0x98>
+    } else
+        bp->s.ptr = p->s.ptr;
+ 9e7:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 9ea:	8b 10                	mov    (%eax),%edx
+ 9ec:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 9ef:	89 10                	mov    %edx,(%eax)
+    if(p + p->s.size == bp){
+ 9f1:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 9f4:	8b 40 04             	mov    0x4(%eax),%eax
+ 9f7:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 9fe:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a01:	01 d0                	add    %edx,%eax
+ a03:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ a06:	75 20                	jne    a28 <free+0xcf>
+        p->s.size += bp->s.size;
+ a08:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a0b:	8b 50 04             	mov    0x4(%eax),%edx
+ a0e:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ a11:	8b 40 04             	mov    0x4(%eax),%eax
+ a14:	01 c2                	add    %eax,%edx
+ a16:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a19:	89 50 04             	mov    %edx,0x4(%eax)
+        p->s.ptr = bp->s.ptr;
+ a1c:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ a1f:	8b 10                	mov    (%eax),%edx
+ a21:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a24:	89 10                	mov    %edx,(%eax)
+ a26:	eb 08                	jmp    a30 <free+0xd7>
+    } else
+        p->s.ptr = bp;
+ a28:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a2b:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ a2e:	89 10                	mov    %edx,(%eax)
+    freep = p;
+ a30:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a33:	a3 1c 0f 00 00       	mov    %eax,0xf1c
+}
+ a38:	90                   	nop
+ a39:	c9                   	leave
+ a3a:	c3                   	ret
+
+00000a3b <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+ a3b:	55                   	push   %ebp
+ a3c:	89 e5                	mov    %esp,%ebp
+ a3e:	83 ec 18             	sub    $0x18,%esp
+    char *p;
+    Header *hp;
+
+    if(nu < 4096)
+ a41:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+ a48:	77 07                	ja     a51 <morecore+0x16>
+        nu = 4096;
+ a4a:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+    p = sbrk(nu * sizeof(Header));
+ a51:	8b 45 08             	mov    0x8(%ebp),%eax
+ a54:	c1 e0 03             	shl    $0x3,%eax
+ a57:	83 ec 0c             	sub    $0xc,%esp
+ a5a:	50                   	push   %eax
+ a5b:	e8 0a fb ff ff       	call   56a <sbrk>
+ a60:	83 c4 10             	add    $0x10,%esp
+ a63:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p == (char*)-1)
+ a66:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+ a6a:	75 07                	jne    a73 <morecore+0x38>
+        return 0;
+ a6c:	b8 00 00 00 00       	mov    $0x0,%eax
+ a71:	eb 26                	jmp    a99 <morecore+0x5e>
+    hp = (Header*)p;
+ a73:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a76:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    hp->s.size = nu;
+ a79:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ a7c:	8b 55 08             	mov    0x8(%ebp),%edx
+ a7f:	89 50 04             	mov    %edx,0x4(%eax)
+    free((void*)(hp + 1));
+ a82:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ a85:	83 c0 08             	add    $0x8,%eax
+ a88:	83 ec 0c             	sub    $0xc,%esp
+ a8b:	50                   	push   %eax
+ a8c:	e8 c8 fe ff ff       	call   959 <free>
+ a91:	83 c4 10             	add    $0x10,%esp
+    return freep;
+ a94:	a1 1c 0f 00 00       	mov    0xf1c,%eax
+}
+ a99:	c9                   	leave
+ a9a:	c3                   	ret
+
+00000a9b <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ a9b:	55                   	push   %ebp
+ a9c:	89 e5                	mov    %esp,%ebp
+ a9e:	83 ec 18             	sub    $0x18,%esp
+    Header *p, *prevp;
+    uint nunits;
+
+    nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ aa1:	8b 45 08             	mov    0x8(%ebp),%eax
+ aa4:	83 c0 07             	add    $0x7,%eax
+ aa7:	c1 e8 03             	shr    $0x3,%eax
+ aaa:	83 c0 01             	add    $0x1,%eax
+ aad:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    if((prevp = freep) == 0){
+ ab0:	a1 1c 0f 00 00       	mov    0xf1c,%eax
+ ab5:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ ab8:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ abc:	75 23                	jne    ae1 <malloc+0x46>
+        base.s.ptr = freep = prevp = &base;
+ abe:	c7 45 f0 14 0f 00 00 	movl   $0xf14,-0x10(%ebp)
+ ac5:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ ac8:	a3 1c 0f 00 00       	mov    %eax,0xf1c
+ acd:	a1 1c 0f 00 00       	mov    0xf1c,%eax
+ ad2:	a3 14 0f 00 00       	mov    %eax,0xf14
+        base.s.size = 0;
+ ad7:	c7 05 18 0f 00 00 00 	movl   $0x0,0xf18
+ ade:	00 00 00 
+    }
+    for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ ae1:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ ae4:	8b 00                	mov    (%eax),%eax
+ ae6:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        if(p->s.size >= nunits){
+ ae9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ aec:	8b 40 04             	mov    0x4(%eax),%eax
+ aef:	3b 45 ec             	cmp    -0x14(%ebp),%eax
+ af2:	72 4d                	jb     b41 <malloc+0xa6>
+            if(p->s.size == nunits)
+ af4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ af7:	8b 40 04             	mov    0x4(%eax),%eax
+ afa:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+ afd:	75 0c                	jne    b0b <malloc+0x70>
+                prevp->s.ptr = p->s.ptr;
+ aff:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b02:	8b 10                	mov    (%eax),%edx
+ b04:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ b07:	89 10                	mov    %edx,(%eax)
+ b09:	eb 26                	jmp    b31 <malloc+0x96>
+            else {
+                p->s.size -= nunits;
+ b0b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b0e:	8b 40 04             	mov    0x4(%eax),%eax
+ b11:	2b 45 ec             	sub    -0x14(%ebp),%eax
+ b14:	89 c2                	mov    %eax,%edx
+ b16:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b19:	89 50 04             	mov    %edx,0x4(%eax)
+                p += p->s.size;
+ b1c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b1f:	8b 40 04             	mov    0x4(%eax),%eax
+ b22:	c1 e0 03             	shl    $0x3,%eax
+ b25:	01 45 f4             	add    %eax,-0xc(%ebp)
+                p->s.size = nunits;
+ b28:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b2b:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ b2e:	89 50 04             	mov    %edx,0x4(%eax)
+            }
+            freep = prevp;
+ b31:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ b34:	a3 1c 0f 00 00       	mov    %eax,0xf1c
+            return (void*)(p + 1);
+ b39:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b3c:	83 c0 08             	add    $0x8,%eax
+ b3f:	eb 3b                	jmp    b7c <malloc+0xe1>
+        }
+        if(p == freep)
+ b41:	a1 1c 0f 00 00       	mov    0xf1c,%eax
+ b46:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ b49:	75 1e                	jne    b69 <malloc+0xce>
+            if((p = morecore(nunits)) == 0)
+ b4b:	83 ec 0c             	sub    $0xc,%esp
+ b4e:	ff 75 ec             	push   -0x14(%ebp)
+ b51:	e8 e5 fe ff ff       	call   a3b <morecore>
+ b56:	83 c4 10             	add    $0x10,%esp
+ b59:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ b5c:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ b60:	75 07                	jne    b69 <malloc+0xce>
+                return 0;
+ b62:	b8 00 00 00 00       	mov    $0x0,%eax
+ b67:	eb 13                	jmp    b7c <malloc+0xe1>
+    for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ b69:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b6c:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ b6f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b72:	8b 00                	mov    (%eax),%eax
+ b74:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        if(p->s.size >= nunits){
+ b77:	e9 6d ff ff ff       	jmp    ae9 <malloc+0x4e>
+    }
+}
+ b7c:	c9                   	leave
+ b7d:	c3                   	ret
@@ -0,0 +1,59 @@
+// Run a command, or change a process, in the real-time FIFO class.
+//
+//    chrt prio cmd [arg...]    run cmd at real-time priority prio
+//    chrt -p pid [prio]        show or set the priority of pid
+//
+// Priority 0 means the normal class; 1 to SCHED_PRIOMAX are
+// real-time, higher first.
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "param.h"
+#include "sched.h"
+
+void
+usage(void)
+{
+    printf(2, "usage: chrt prio cmd [arg...]\n"
+        "       chrt -p pid [prio]\n");
+    exit();
+}
+
+// Put pid in the class prio calls for.
+int
+setprio(int pid, int prio)
+{
+    return sched_setscheduler(pid, prio ? SCHED_FIFO : SCHED_OTHER, prio);
+}
+
+int
+main(int argc, char *argv[])
+{
+    int pid, prio;
+
+    if(argc < 3)
+        usage();
+    if(strcmp(argv[1], "-p") == 0){
+        pid = atoi(argv[2]);
+        if(argc > 3 && setprio(pid, atoi(argv[3])) < 0){
+            printf(2, "chrt: cannot set priority of %d\n", pid);
+            exit();
+        }
+        if((prio = sched_getparam(pid)) < 0){
+            printf(2, "chrt: no process %d\n", pid);
+            exit();
+        }
+        printf(1, "pid %d: %s priority %d\n", pid,
+            prio ? "SCHED_FIFO" : "SCHED_OTHER", prio);
+        exit();
+    }
+
+    if(setprio(0, atoi(argv[1])) < 0){
+        printf(2, "chrt: bad priority %s\n", argv[1]);
+        exit();
+    }
+    exec(argv[2], argv + 2);
+    printf(2, "chrt: exec %s failed\n", argv[2]);
+    exit();
+}
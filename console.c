@@ -290,8 +290,7 @@ consoleinit(void)
 {
     initlock(&cons.lock, "console", 1);
 
-    devsw[CONSOLE].write = consolewrite;
-    devsw[CONSOLE].read = consoleread;
+    devswregister(CONSOLE, consoleread, consolewrite);
     cons.locking = 1;
 
     ioapicenable(IRQ_KBD, 0);
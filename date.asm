@@ -0,0 +1,1405 @@
+
+_date:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "user.h"
+#include "date.h"
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	53                   	push   %ebx
+  10:	51                   	push   %ecx
+  11:	83 ec 28             	sub    $0x28,%esp
+    struct rtcdate r;
+
+    if (date(&r)) {
+  14:	83 ec 0c             	sub    $0xc,%esp
+  17:	8d 45 d0             	lea    -0x30(%ebp),%eax
+  1a:	50                   	push   %eax
+  1b:	e8 13 04 00 00       	call   433 <date>
+  20:	83 c4 10             	add    $0x10,%esp
+  23:	85 c0                	test   %eax,%eax
+  25:	74 17                	je     3e <main+0x3e>
+        printf(2, "date failed\n");
+  27:	83 ec 08             	sub    $0x8,%esp
+  2a:	68 29 0a 00 00       	push   $0xa29
+  2f:	6a 02                	push   $0x2
+  31:	e8 3c 06 00 00       	call   672 <printf>
+  36:	83 c4 10             	add    $0x10,%esp
+        exit();
+  39:	e8 36 03 00 00       	call   374 <exit>
+    }
+
+    // your code to print the time in any format you like...
+        printf(1, "%d.%d.%d %d:%d:%d\n", r.year, r.month, r.day, r.hour, r.minute, r.second);
+  3e:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  41:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+  44:	8b 5d d8             	mov    -0x28(%ebp),%ebx
+  47:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  4a:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  4d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  50:	57                   	push   %edi
+  51:	56                   	push   %esi
+  52:	53                   	push   %ebx
+  53:	51                   	push   %ecx
+  54:	52                   	push   %edx
+  55:	50                   	push   %eax
+  56:	68 36 0a 00 00       	push   $0xa36
+  5b:	6a 01                	push   $0x1
+  5d:	e8 10 06 00 00       	call   672 <printf>
+  62:	83 c4 20             	add    $0x20,%esp
+    exit();
+  65:	e8 0a 03 00 00       	call   374 <exit>
+
+0000006a <stosb>:
+strchr(const char *s, char c)
+{
+    for(; *s; s++)
+        if(*s == c)
+            return (char*)s;
+    return 0;
+  6a:	55                   	push   %ebp
+  6b:	89 e5                	mov    %esp,%ebp
+  6d:	57                   	push   %edi
+  6e:	53                   	push   %ebx
+}
+  6f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  72:	8b 55 10             	mov    0x10(%ebp),%edx
+  75:	8b 45 0c             	mov    0xc(%ebp),%eax
+  78:	89 cb                	mov    %ecx,%ebx
+  7a:	89 df                	mov    %ebx,%edi
+  7c:	89 d1                	mov    %edx,%ecx
+  7e:	fc                   	cld
+  7f:	f3 aa                	rep stos %al,%es:(%edi)
+  81:	89 ca                	mov    %ecx,%edx
+  83:	89 fb                	mov    %edi,%ebx
+  85:	89 5d 08             	mov    %ebx,0x8(%ebp)
+  88:	89 55 10             	mov    %edx,0x10(%ebp)
+
+char*
+gets(char *buf, int max)
+{
+  8b:	90                   	nop
+  8c:	5b                   	pop    %ebx
+  8d:	5f                   	pop    %edi
+  8e:	5d                   	pop    %ebp
+  8f:	c3                   	ret
+
+00000090 <strcpy>:
+{
+  90:	55                   	push   %ebp
+  91:	89 e5                	mov    %esp,%ebp
+  93:	83 ec 10             	sub    $0x10,%esp
+    os = s;
+  96:	8b 45 08             	mov    0x8(%ebp),%eax
+  99:	89 45 fc             	mov    %eax,-0x4(%ebp)
+    while((*s++ = *t++) != 0)
+  9c:	90                   	nop
+  9d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  a0:	8d 42 01             	lea    0x1(%edx),%eax
+  a3:	89 45 0c             	mov    %eax,0xc(%ebp)
+  a6:	8b 45 08             	mov    0x8(%ebp),%eax
+  a9:	8d 48 01             	lea    0x1(%eax),%ecx
+  ac:	89 4d 08             	mov    %ecx,0x8(%ebp)
+  af:	0f b6 12             	movzbl (%edx),%edx
+  b2:	88 10                	mov    %dl,(%eax)
+  b4:	0f b6 00             	movzbl (%eax),%eax
+  b7:	84 c0                	test   %al,%al
+  b9:	75 e2                	jne    9d <strcpy+0xd>
+    return os;
+  bb:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+  be:	c9                   	leave
+  bf:	c3                   	ret
+
+000000c0 <strcmp>:
+{
+  c0:	55                   	push   %ebp
+  c1:	89 e5                	mov    %esp,%ebp
+    while(*p && *p == *q)
+  c3:	eb 08                	jmp    cd <strcmp+0xd>
+        p++, q++;
+  c5:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+  c9:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+    while(*p && *p == *q)
+  cd:	8b 45 08             	mov    0x8(%ebp),%eax
+  d0:	0f b6 00             	movzbl (%eax),%eax
+  d3:	84 c0                	test   %al,%al
+  d5:	74 10                	je     e7 <strcmp+0x27>
+  d7:	8b 45 08             	mov    0x8(%ebp),%eax
+  da:	0f b6 10             	movzbl (%eax),%edx
+  dd:	8b 45 0c             	mov    0xc(%ebp),%eax
+  e0:	0f b6 00             	movzbl (%eax),%eax
+  e3:	38 c2                	cmp    %al,%dl
+  e5:	74 de                	je     c5 <strcmp+0x5>
+    return (uchar)*p - (uchar)*q;
+  e7:	8b 45 08             	mov    0x8(%ebp),%eax
+  ea:	0f b6 00             	movzbl (%eax),%eax
+  ed:	0f b6 d0             	movzbl %al,%edx
+  f0:	8b 45 0c             	mov    0xc(%ebp),%eax
+  f3:	0f b6 00             	movzbl (%eax),%eax
+  f6:	0f b6 c0             	movzbl %al,%eax
+  f9:	29 c2                	sub    %eax,%edx
+  fb:	89 d0                	mov    %edx,%eax
+}
+  fd:	5d                   	pop    %ebp
+  fe:	c3                   	ret
+
+000000ff <strlen>:
+{
+  ff:	55                   	push   %ebp
+ 100:	89 e5                	mov    %esp,%ebp
+ 102:	83 ec 10             	sub    $0x10,%esp
+    for(n = 0; s[n]; n++)
+ 105:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ 10c:	eb 04                	jmp    112 <strlen+0x13>
+ 10e:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 112:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 115:	8b 45 08             	mov    0x8(%ebp),%eax
+ 118:	01 d0                	add    %edx,%eax
+ 11a:	0f b6 00             	movzbl (%eax),%eax
+ 11d:	84 c0                	test   %al,%al
+ 11f:	75 ed                	jne    10e <strlen+0xf>
+    return n;
+ 121:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 124:	c9                   	leave
+ 125:	c3                   	ret
+
+00000126 <memset>:
+{
+ 126:	55                   	push   %ebp
+ 127:	89 e5                	mov    %esp,%ebp
+    stosb(dst, c, n);
+ 129:	8b 45 10             	mov    0x10(%ebp),%eax
+ 12c:	50                   	push   %eax
+ 12d:	ff 75 0c             	push   0xc(%ebp)
+ 130:	ff 75 08             	push   0x8(%ebp)
+ 133:	e8 32 ff ff ff       	call   6a <stosb>
+ 138:	83 c4 0c             	add    $0xc,%esp
+    return dst;
+ 13b:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 13e:	c9                   	leave
+ 13f:	c3                   	ret
+
+00000140 <strchr>:
+{
+ 140:	55                   	push   %ebp
+ 141:	89 e5                	mov    %esp,%ebp
+ 143:	83 ec 04             	sub    $0x4,%esp
+ 146:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 149:	88 45 fc             	mov    %al,-0x4(%ebp)
+    for(; *s; s++)
+ 14c:	eb 14                	jmp    162 <strchr+0x22>
+        if(*s == c)
+ 14e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 151:	0f b6 00             	movzbl (%eax),%eax
+ 154:	38 45 fc             	cmp    %al,-0x4(%ebp)
+ 157:	75 05                	jne    15e <strchr+0x1e>
+            return (char*)s;
+ 159:	8b 45 08             	mov    0x8(%ebp),%eax
+ 15c:	eb 13                	jmp    171 <strchr+0x31>
+    for(; *s; s++)
+ 15e:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 162:	8b 45 08             	mov    0x8(%ebp),%eax
+ 165:	0f b6 00             	movzbl (%eax),%eax
+ 168:	84 c0                	test   %al,%al
+ 16a:	75 e2                	jne    14e <strchr+0xe>
+    return 0;
+ 16c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 171:	c9                   	leave
+ 172:	c3                   	ret
+
+00000173 <gets>:
+{
+ 173:	55                   	push   %ebp
+ 174:	89 e5                	mov    %esp,%ebp
+ 176:	83 ec 18             	sub    $0x18,%esp
+    int i, cc;
+    char c;
+
+    for(i=0; i+1 < max; ){
+ 179:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 180:	eb 42                	jmp    1c4 <gets+0x51>
+        cc = read(0, &c, 1);
+ 182:	83 ec 04             	sub    $0x4,%esp
+ 185:	6a 01                	push   $0x1
+ 187:	8d 45 ef             	lea    -0x11(%ebp),%eax
+ 18a:	50                   	push   %eax
+ 18b:	6a 00                	push   $0x0
+ 18d:	e8 f7 01 00 00       	call   389 <read>
+ 192:	83 c4 10             	add    $0x10,%esp
+ 195:	89 45 f0             	mov    %eax,-0x10(%ebp)
+        if(cc < 1)
+ 198:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 19c:	7e 33                	jle    1d1 <gets+0x5e>
+            break;
+        buf[i++] = c;
+ 19e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 1a1:	8d 50 01             	lea    0x1(%eax),%edx
+ 1a4:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 1a7:	89 c2                	mov    %eax,%edx
+ 1a9:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1ac:	01 c2                	add    %eax,%edx
+ 1ae:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 1b2:	88 02                	mov    %al,(%edx)
+        if(c == '\n' || c == '\r')
+ 1b4:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 1b8:	3c 0a                	cmp    $0xa,%al
+ 1ba:	74 16                	je     1d2 <gets+0x5f>
+ 1bc:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 1c0:	3c 0d                	cmp    $0xd,%al
+ 1c2:	74 0e                	je     1d2 <gets+0x5f>
+    for(i=0; i+1 < max; ){
+ 1c4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 1c7:	83 c0 01             	add    $0x1,%eax
+ 1ca:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 1cd:	7f b3                	jg     182 <gets+0xf>
+ 1cf:	eb 01                	jmp    1d2 <gets+0x5f>
+            break;
+ 1d1:	90                   	nop
+            break;
+    }
+    buf[i] = '\0';
+ 1d2:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 1d5:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1d8:	01 d0                	add    %edx,%eax
+ 1da:	c6 00 00             	movb   $0x0,(%eax)
+    return buf;
+ 1dd:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 1e0:	c9                   	leave
+ 1e1:	c3                   	ret
+
+000001e2 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 1e2:	55                   	push   %ebp
+ 1e3:	89 e5                	mov    %esp,%ebp
+ 1e5:	83 ec 18             	sub    $0x18,%esp
+    int fd;
+    int r;
+
+    fd = open(n, O_RDONLY);
+ 1e8:	83 ec 08             	sub    $0x8,%esp
+ 1eb:	6a 00                	push   $0x0
+ 1ed:	ff 75 08             	push   0x8(%ebp)
+ 1f0:	e8 c6 01 00 00       	call   3bb <open>
+ 1f5:	83 c4 10             	add    $0x10,%esp
+ 1f8:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(fd < 0)
+ 1fb:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 1ff:	79 07                	jns    208 <stat+0x26>
+        return -1;
+ 201:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 206:	eb 25                	jmp    22d <stat+0x4b>
+    r = fstat(fd, st);
+ 208:	83 ec 08             	sub    $0x8,%esp
+ 20b:	ff 75 0c             	push   0xc(%ebp)
+ 20e:	ff 75 f4             	push   -0xc(%ebp)
+ 211:	e8 c3 01 00 00       	call   3d9 <fstat>
+ 216:	83 c4 10             	add    $0x10,%esp
+ 219:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    close(fd);
+ 21c:	83 ec 0c             	sub    $0xc,%esp
+ 21f:	ff 75 f4             	push   -0xc(%ebp)
+ 222:	e8 76 01 00 00       	call   39d <close>
+ 227:	83 c4 10             	add    $0x10,%esp
+    return r;
+ 22a:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ 22d:	c9                   	leave
+ 22e:	c3                   	ret
+
+0000022f <atoi>:
+
+int
+atoi(const char *s)
+{
+ 22f:	55                   	push   %ebp
+ 230:	89 e5                	mov    %esp,%ebp
+ 232:	83 ec 10             	sub    $0x10,%esp
+    int n;
+
+    n = 0;
+ 235:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+    while('0' <= *s && *s <= '9')
+ 23c:	eb 25                	jmp    263 <atoi+0x34>
+        n = n*10 + *s++ - '0';
+ 23e:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 241:	89 d0                	mov    %edx,%eax
+ 243:	c1 e0 02             	shl    $0x2,%eax
+ 246:	01 d0                	add    %edx,%eax
+ 248:	01 c0                	add    %eax,%eax
+ 24a:	89 c1                	mov    %eax,%ecx
+ 24c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 24f:	8d 50 01             	lea    0x1(%eax),%edx
+ 252:	89 55 08             	mov    %edx,0x8(%ebp)
+ 255:	0f b6 00             	movzbl (%eax),%eax
+ 258:	0f be c0             	movsbl %al,%eax
+ 25b:	01 c8                	add    %ecx,%eax
+ 25d:	83 e8 30             	sub    $0x30,%eax
+ 260:	89 45 fc             	mov    %eax,-0x4(%ebp)
+    while('0' <= *s && *s <= '9')
+ 263:	8b 45 08             	mov    0x8(%ebp),%eax
+ 266:	0f b6 00             	movzbl (%eax),%eax
+ 269:	3c 2f                	cmp    $0x2f,%al
+ 26b:	7e 0a                	jle    277 <atoi+0x48>
+ 26d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 270:	0f b6 00             	movzbl (%eax),%eax
+ 273:	3c 39                	cmp    $0x39,%al
+ 275:	7e c7                	jle    23e <atoi+0xf>
+    return n;
+ 277:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 27a:	c9                   	leave
+ 27b:	c3                   	ret
+
+0000027c <nice>:
+
+// Add inc to the caller's nice value; return the new value.
+int
+nice(int inc)
+{
+ 27c:	55                   	push   %ebp
+ 27d:	89 e5                	mov    %esp,%ebp
+ 27f:	83 ec 18             	sub    $0x18,%esp
+    int n;
+
+    n = getpriority(0) + inc;
+ 282:	83 ec 0c             	sub    $0xc,%esp
+ 285:	6a 00                	push   $0x0
+ 287:	e8 d9 01 00 00       	call   465 <getpriority>
+ 28c:	83 c4 10             	add    $0x10,%esp
+ 28f:	8b 55 08             	mov    0x8(%ebp),%edx
+ 292:	01 d0                	add    %edx,%eax
+ 294:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(n < 0)
+ 297:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 29b:	79 07                	jns    2a4 <nice+0x28>
+        n = 0;
+ 29d:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    if(n > NICEMAX)
+ 2a4:	83 7d f4 13          	cmpl   $0x13,-0xc(%ebp)
+ 2a8:	7e 07                	jle    2b1 <nice+0x35>
+        n = NICEMAX;
+ 2aa:	c7 45 f4 13 00 00 00 	movl   $0x13,-0xc(%ebp)
+    if(setpriority(0, n) < 0)
+ 2b1:	83 ec 08             	sub    $0x8,%esp
+ 2b4:	ff 75 f4             	push   -0xc(%ebp)
+ 2b7:	6a 00                	push   $0x0
+ 2b9:	e8 b1 01 00 00       	call   46f <setpriority>
+ 2be:	83 c4 10             	add    $0x10,%esp
+ 2c1:	85 c0                	test   %eax,%eax
+ 2c3:	79 07                	jns    2cc <nice+0x50>
+        return -1;
+ 2c5:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 2ca:	eb 03                	jmp    2cf <nice+0x53>
+    return n;
+ 2cc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+ 2cf:	c9                   	leave
+ 2d0:	c3                   	ret
+
+000002d1 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 2d1:	55                   	push   %ebp
+ 2d2:	89 e5                	mov    %esp,%ebp
+ 2d4:	83 ec 10             	sub    $0x10,%esp
+    char *dst;
+    const char *src;
+
+    dst = vdst;
+ 2d7:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2da:	89 45 fc             	mov    %eax,-0x4(%ebp)
+    src = vsrc;
+ 2dd:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 2e0:	89 45 f8             	mov    %eax,-0x8(%ebp)
+    while(n-- > 0)
+ 2e3:	eb 17                	jmp    2fc <memmove+0x2b>
+        *dst++ = *src++;
+ 2e5:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 2e8:	8d 42 01             	lea    0x1(%edx),%eax
+ 2eb:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 2ee:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 2f1:	8d 48 01             	lea    0x1(%eax),%ecx
+ 2f4:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+ 2f7:	0f b6 12             	movzbl (%edx),%edx
+ 2fa:	88 10                	mov    %dl,(%eax)
+    while(n-- > 0)
+ 2fc:	8b 45 10             	mov    0x10(%ebp),%eax
+ 2ff:	8d 50 ff             	lea    -0x1(%eax),%edx
+ 302:	89 55 10             	mov    %edx,0x10(%ebp)
+ 305:	85 c0                	test   %eax,%eax
+ 307:	7f dc                	jg     2e5 <memmove+0x14>
+    return vdst;
+ 309:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 30c:	c9                   	leave
+ 30d:	c3                   	ret
+
+0000030e <dosyscall>:
+sysmode:
+    .long 0
+
+    .text
+dosyscall:
+    cmpl $0, sysmode
+ 30e:	83 3d c0 0c 00 00 00 	cmpl   $0x0,0xcc0
+    jg 2f
+ 315:	7f 0c                	jg     323 <dosyscall+0x15>
+    jl 1f
+ 317:	7c 07                	jl     320 <dosyscall+0x12>
+    call sepcheck
+ 319:	e8 27 00 00 00       	call   345 <sepcheck>
+    jmp dosyscall
+ 31e:	eb ee                	jmp    30e <dosyscall>
+1:
+    int $T_SYSCALL
+ 320:	cd 40                	int    $0x40
+    ret
+ 322:	c3                   	ret
+2:
+    pushl %ebx
+ 323:	53                   	push   %ebx
+    pushl %esi
+ 324:	56                   	push   %esi
+    pushl %edi
+ 325:	57                   	push   %edi
+    pushl %ebp
+ 326:	55                   	push   %ebp
+    movl 20(%esp), %ebx
+ 327:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+    movl 24(%esp), %esi
+ 32b:	8b 74 24 18          	mov    0x18(%esp),%esi
+    movl 28(%esp), %edi
+ 32f:	8b 7c 24 1c          	mov    0x1c(%esp),%edi
+    movl 32(%esp), %ebp
+ 333:	8b 6c 24 20          	mov    0x20(%esp),%ebp
+    movl %esp, %ecx
+ 337:	89 e1                	mov    %esp,%ecx
+    movl $3f, %edx
+ 339:	ba 40 03 00 00       	mov    $0x340,%edx
+    sysenter
+ 33e:	0f 34                	sysenter
+3:
+    popl %ebp
+ 340:	5d                   	pop    %ebp
+    popl %edi
+ 341:	5f                   	pop    %edi
+    popl %esi
+ 342:	5e                   	pop    %esi
+    popl %ebx
+ 343:	5b                   	pop    %ebx
+    ret
+ 344:	c3                   	ret
+
+00000345 <sepcheck>:
+
+# Set sysmode from cpuid's SEP flag.    Preserves %eax.
+sepcheck:
+    pushl %eax
+ 345:	50                   	push   %eax
+    pushl %ebx
+ 346:	53                   	push   %ebx
+    movl $1, %eax
+ 347:	b8 01 00 00 00       	mov    $0x1,%eax
+    cpuid
+ 34c:	0f a2                	cpuid
+    movl $-1, sysmode
+ 34e:	c7 05 c0 0c 00 00 ff 	movl   $0xffffffff,0xcc0
+ 355:	ff ff ff 
+    testl $0x800, %edx
+ 358:	f7 c2 00 08 00 00    	test   $0x800,%edx
+    jz 1f
+ 35e:	74 0a                	je     36a <sepcheck+0x25>
+    movl $1, sysmode
+ 360:	c7 05 c0 0c 00 00 01 	movl   $0x1,0xcc0
+ 367:	00 00 00 
+1:
+    popl %ebx
+ 36a:	5b                   	pop    %ebx
+    popl %eax
+ 36b:	58                   	pop    %eax
+    ret
+ 36c:	c3                   	ret
+
+0000036d <fork>:
+
+SYSCALL(fork)
+ 36d:	b8 01 00 00 00       	mov    $0x1,%eax
+ 372:	eb 9a                	jmp    30e <dosyscall>
+
+00000374 <exit>:
+SYSCALL(exit)
+ 374:	b8 02 00 00 00       	mov    $0x2,%eax
+ 379:	eb 93                	jmp    30e <dosyscall>
+
+0000037b <wait>:
+SYSCALL(wait)
+ 37b:	b8 03 00 00 00       	mov    $0x3,%eax
+ 380:	eb 8c                	jmp    30e <dosyscall>
+
+00000382 <pipe>:
+SYSCALL(pipe)
+ 382:	b8 04 00 00 00       	mov    $0x4,%eax
+ 387:	eb 85                	jmp    30e <dosyscall>
+
+00000389 <read>:
+SYSCALL(read)
+ 389:	b8 05 00 00 00       	mov    $0x5,%eax
+ 38e:	e9 7b ff ff ff       	jmp    30e <dosyscall>
+
+00000393 <write>:
+SYSCALL(write)
+ 393:	b8 10 00 00 00       	mov    $0x10,%eax
+ 398:	e9 71 ff ff ff       	jmp    30e <dosyscall>
+
+0000039d <close>:
+SYSCALL(close)
+ 39d:	b8 15 00 00 00       	mov    $0x15,%eax
+ 3a2:	e9 67 ff ff ff       	jmp    30e <dosyscall>
+
+000003a7 <kill>:
+SYSCALL(kill)
+ 3a7:	b8 06 00 00 00       	mov    $0x6,%eax
+ 3ac:	e9 5d ff ff ff       	jmp    30e <dosyscall>
+
+000003b1 <exec>:
+SYSCALL(exec)
+ 3b1:	b8 07 00 00 00       	mov    $0x7,%eax
+ 3b6:	e9 53 ff ff ff       	jmp    30e <dosyscall>
+
+000003bb <open>:
+SYSCALL(open)
+ 3bb:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 3c0:	e9 49 ff ff ff       	jmp    30e <dosyscall>
+
+000003c5 <mknod>:
+SYSCALL(mknod)
+ 3c5:	b8 11 00 00 00       	mov    $0x11,%eax
+ 3ca:	e9 3f ff ff ff       	jmp    30e <dosyscall>
+
+000003cf <unlink>:
+SYSCALL(unlink)
+ 3cf:	b8 12 00 00 00       	mov    $0x12,%eax
+ 3d4:	e9 35 ff ff ff       	jmp    30e <dosyscall>
+
+000003d9 <fstat>:
+SYSCALL(fstat)
+ 3d9:	b8 08 00 00 00       	mov    $0x8,%eax
+ 3de:	e9 2b ff ff ff       	jmp    30e <dosyscall>
+
+000003e3 <link>:
+SYSCALL(link)
+ 3e3:	b8 13 00 00 00       	mov    $0x13,%eax
+ 3e8:	e9 21 ff ff ff       	jmp    30e <dosyscall>
+
+000003ed <mkdir>:
+SYSCALL(mkdir)
+ 3ed:	b8 14 00 00 00       	mov    $0x14,%eax
+ 3f2:	e9 17 ff ff ff       	jmp    30e <dosyscall>
+
+000003f7 <chdir>:
+SYSCALL(chdir)
+ 3f7:	b8 09 00 00 00       	mov    $0x9,%eax
+ 3fc:	e9 0d ff ff ff       	jmp    30e <dosyscall>
+
+00000401 <dup>:
+SYSCALL(dup)
+ 401:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 406:	e9 03 ff ff ff       	jmp    30e <dosyscall>
+
+0000040b <getpid>:
+SYSCALL(getpid)
+ 40b:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 410:	e9 f9 fe ff ff       	jmp    30e <dosyscall>
+
+00000415 <sbrk>:
+SYSCALL(sbrk)
+ 415:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 41a:	e9 ef fe ff ff       	jmp    30e <dosyscall>
+
+0000041f <sleep>:
+SYSCALL(sleep)
+ 41f:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 424:	e9 e5 fe ff ff       	jmp    30e <dosyscall>
+
+00000429 <uptime>:
+SYSCALL(uptime)
+ 429:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 42e:	e9 db fe ff ff       	jmp    30e <dosyscall>
+
+00000433 <date>:
+SYSCALL(date)
+ 433:	b8 16 00 00 00       	mov    $0x16,%eax
+ 438:	e9 d1 fe ff ff       	jmp    30e <dosyscall>
+
+0000043d <dup2>:
+SYSCALL(dup2)
+ 43d:	b8 17 00 00 00       	mov    $0x17,%eax
+ 442:	e9 c7 fe ff ff       	jmp    30e <dosyscall>
+
+00000447 <uffd>:
+SYSCALL(uffd)
+ 447:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 44c:	e9 bd fe ff ff       	jmp    30e <dosyscall>
+
+00000451 <uffdregister>:
+SYSCALL(uffdregister)
+ 451:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 456:	e9 b3 fe ff ff       	jmp    30e <dosyscall>
+
+0000045b <uffdcopy>:
+SYSCALL(uffdcopy)
+ 45b:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 460:	e9 a9 fe ff ff       	jmp    30e <dosyscall>
+
+00000465 <getpriority>:
+SYSCALL(getpriority)
+ 465:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 46a:	e9 9f fe ff ff       	jmp    30e <dosyscall>
+
+0000046f <setpriority>:
+SYSCALL(setpriority)
+ 46f:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 474:	e9 95 fe ff ff       	jmp    30e <dosyscall>
+
+00000479 <setweight>:
+SYSCALL(setweight)
+ 479:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 47e:	e9 8b fe ff ff       	jmp    30e <dosyscall>
+
+00000483 <setgroup>:
+SYSCALL(setgroup)
+ 483:	b8 20 00 00 00       	mov    $0x20,%eax
+ 488:	e9 81 fe ff ff       	jmp    30e <dosyscall>
+
+0000048d <schedinfo>:
+SYSCALL(schedinfo)
+ 48d:	b8 21 00 00 00       	mov    $0x21,%eax
+ 492:	e9 77 fe ff ff       	jmp    30e <dosyscall>
+
+00000497 <nanosleep>:
+SYSCALL(nanosleep)
+ 497:	b8 22 00 00 00       	mov    $0x22,%eax
+ 49c:	e9 6d fe ff ff       	jmp    30e <dosyscall>
+
+000004a1 <clock_nanosleep>:
+SYSCALL(clock_nanosleep)
+ 4a1:	b8 23 00 00 00       	mov    $0x23,%eax
+ 4a6:	e9 63 fe ff ff       	jmp    30e <dosyscall>
+
+000004ab <clock_gettime>:
+SYSCALL(clock_gettime)
+ 4ab:	b8 24 00 00 00       	mov    $0x24,%eax
+ 4b0:	e9 59 fe ff ff       	jmp    30e <dosyscall>
+
+000004b5 <sched_setaffinity>:
+SYSCALL(sched_setaffinity)
+ 4b5:	b8 25 00 00 00       	mov    $0x25,%eax
+ 4ba:	e9 4f fe ff ff       	jmp    30e <dosyscall>
+
+000004bf <sched_getaffinity>:
+SYSCALL(sched_getaffinity)
+ 4bf:	b8 26 00 00 00       	mov    $0x26,%eax
+ 4c4:	e9 45 fe ff ff       	jmp    30e <dosyscall>
+
+000004c9 <irqaffinity>:
+SYSCALL(irqaffinity)
+ 4c9:	b8 27 00 00 00       	mov    $0x27,%eax
+ 4ce:	e9 3b fe ff ff       	jmp    30e <dosyscall>
+
+000004d3 <getrusage>:
+SYSCALL(getrusage)
+ 4d3:	b8 28 00 00 00       	mov    $0x28,%eax
+ 4d8:	e9 31 fe ff ff       	jmp    30e <dosyscall>
+
+000004dd <times>:
+SYSCALL(times)
+ 4dd:	b8 29 00 00 00       	mov    $0x29,%eax
+ 4e2:	e9 27 fe ff ff       	jmp    30e <dosyscall>
+
+000004e7 <schedlat>:
+SYSCALL(schedlat)
+ 4e7:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 4ec:	e9 1d fe ff ff       	jmp    30e <dosyscall>
+
+000004f1 <sched_setscheduler>:
+SYSCALL(sched_setscheduler)
+ 4f1:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 4f6:	e9 13 fe ff ff       	jmp    30e <dosyscall>
+
+000004fb <sched_getscheduler>:
+SYSCALL(sched_getscheduler)
+ 4fb:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 500:	e9 09 fe ff ff       	jmp    30e <dosyscall>
+
+00000505 <sched_getparam>:
+SYSCALL(sched_getparam)
+ 505:	b8 2d 00 00 00       	mov    $0x2d,%eax
+ 50a:	e9 ff fd ff ff       	jmp    30e <dosyscall>
+
+0000050f <lockstat>:
+SYSCALL(lockstat)
+ 50f:	b8 2e 00 00 00       	mov    $0x2e,%eax
+ 514:	e9 f5 fd ff ff       	jmp    30e <dosyscall>
+
+00000519 <ioring_setup>:
+SYSCALL(ioring_setup)
+ 519:	b8 2f 00 00 00       	mov    $0x2f,%eax
+ 51e:	e9 eb fd ff ff       	jmp    30e <dosyscall>
+
+00000523 <ioring_enter>:
+SYSCALL(ioring_enter)
+ 523:	b8 30 00 00 00       	mov    $0x30,%eax
+ 528:	e9 e1 fd ff ff       	jmp    30e <dosyscall>
+
+0000052d <readv>:
+SYSCALL(readv)
+ 52d:	b8 31 00 00 00       	mov    $0x31,%eax
+ 532:	e9 d7 fd ff ff       	jmp    30e <dosyscall>
+
+00000537 <writev>:
+SYSCALL(writev)
+ 537:	b8 32 00 00 00       	mov    $0x32,%eax
+ 53c:	e9 cd fd ff ff       	jmp    30e <dosyscall>
+
+00000541 <pread>:
+SYSCALL(pread)
+ 541:	b8 33 00 00 00       	mov    $0x33,%eax
+ 546:	e9 c3 fd ff ff       	jmp    30e <dosyscall>
+
+0000054b <pwrite>:
+SYSCALL(pwrite)
+ 54b:	b8 34 00 00 00       	mov    $0x34,%eax
+ 550:	e9 b9 fd ff ff       	jmp    30e <dosyscall>
+
+00000555 <sendfile>:
+SYSCALL(sendfile)
+ 555:	b8 35 00 00 00       	mov    $0x35,%eax
+ 55a:	e9 af fd ff ff       	jmp    30e <dosyscall>
+
+0000055f <splice>:
+SYSCALL(splice)
+ 55f:	b8 36 00 00 00       	mov    $0x36,%eax
+ 564:	e9 a5 fd ff ff       	jmp    30e <dosyscall>
+
+00000569 <sysstat>:
+SYSCALL(sysstat)
+ 569:	b8 37 00 00 00       	mov    $0x37,%eax
+ 56e:	e9 9b fd ff ff       	jmp    30e <dosyscall>
+
+00000573 <strace>:
+SYSCALL(strace)
+ 573:	b8 38 00 00 00       	mov    $0x38,%eax
+ 578:	e9 91 fd ff ff       	jmp    30e <dosyscall>
+
+0000057d <straceread>:
+SYSCALL(straceread)
+ 57d:	b8 39 00 00 00       	mov    $0x39,%eax
+ 582:	e9 87 fd ff ff       	jmp    30e <dosyscall>
+
+00000587 <alarm>:
+
+# alarm and rstoregs keep to int $T_SYSCALL: rstoregs restores
+# %ecx and %edx, which sysexit would clobber.
+.globl alarm
+    alarm:
+        pushl $rstoregs
+ 587:	68 97 05 00 00       	push   $0x597
+        movl $SYS_alarm, %eax
+ 58c:	b8 18 00 00 00       	mov    $0x18,%eax
+        int $T_SYSCALL
+ 591:	cd 40                	int    $0x40
+        add $0x04, %esp
+ 593:	83 c4 04             	add    $0x4,%esp
+        ret
+ 596:	c3                   	ret
+
+00000597 <rstoregs>:
+
+.globl rstoregs
+    rstoregs:
+        movl $SYS_rstoregs, %eax
+ 597:	b8 19 00 00 00       	mov    $0x19,%eax
+        int $T_SYSCALL
+ 59c:	cd 40                	int    $0x40
+
+0000059e <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 59e:	55                   	push   %ebp
+ 59f:	89 e5                	mov    %esp,%ebp
+ 5a1:	83 ec 18             	sub    $0x18,%esp
+ 5a4:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 5a7:	88 45 f4             	mov    %al,-0xc(%ebp)
+    write(fd, &c, 1);
+ 5aa:	83 ec 04             	sub    $0x4,%esp
+ 5ad:	6a 01                	push   $0x1
+ 5af:	8d 45 f4             	lea    -0xc(%ebp),%eax
+ 5b2:	50                   	push   %eax
+ 5b3:	ff 75 08             	push   0x8(%ebp)
+ 5b6:	e8 d8 fd ff ff       	call   393 <write>
+ 5bb:	83 c4 10             	add    $0x10,%esp
+}
+ 5be:	90                   	nop
+ 5bf:	c9                   	leave
+ 5c0:	c3                   	ret
+
+000005c1 <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 5c1:	55                   	push   %ebp
+ 5c2:	89 e5                	mov    %esp,%ebp
+ 5c4:	83 ec 28             	sub    $0x28,%esp
+    static char digits[] = "0123456789ABCDEF";
+    char buf[16];
+    int i, neg;
+    uint x;
+
+    neg = 0;
+ 5c7:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+    if(sgn && xx < 0){
+ 5ce:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+ 5d2:	74 17                	je     5eb <printint+0x2a>
+ 5d4:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 5d8:	79 11                	jns    5eb <printint+0x2a>
+        neg = 1;
+ 5da:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+        x = -xx;
+ 5e1:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 5e4:	f7 d8                	neg    %eax
+ 5e6:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 5e9:	eb 06                	jmp    5f1 <printint+0x30>
+    } else {
+        x = xx;
+ 5eb:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 5ee:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    }
+
+    i = 0;
+ 5f1:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    do{
+        buf[i++] = digits[x % base];
+ 5f8:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 5fb:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 5fe:	ba 00 00 00 00       	mov    $0x0,%edx
+ 603:	f7 f1                	div    %ecx
+ 605:	89 d1                	mov    %edx,%ecx
+ 607:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 60a:	8d 50 01             	lea    0x1(%eax),%edx
+ 60d:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 610:	0f b6 91 c4 0c 00 00 	movzbl 0xcc4(%ecx),%edx
+ 617:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+    }while((x /= base) != 0);
+ 61b:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 61e:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 621:	ba 00 00 00 00       	mov    $0x0,%edx
+ 626:	f7 f1                	div    %ecx
+ 628:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 62b:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 62f:	75 c7                	jne    5f8 <printint+0x37>
+    if(neg)
+ 631:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 635:	74 2d                	je     664 <printint+0xa3>
+        buf[i++] = '-';
+ 637:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 63a:	8d 50 01             	lea    0x1(%eax),%edx
+ 63d:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 640:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+    while(--i >= 0)
+ 645:	eb 1d                	jmp    664 <printint+0xa3>
+        putc(fd, buf[i]);
+ 647:	8d 55 dc             	lea    -0x24(%ebp),%edx
+ 64a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 64d:	01 d0                	add    %edx,%eax
+ 64f:	0f b6 00             	movzbl (%eax),%eax
+ 652:	0f be c0             	movsbl %al,%eax
+ 655:	83 ec 08             	sub    $0x8,%esp
+ 658:	50                   	push   %eax
+ 659:	ff 75 08             	push   0x8(%ebp)
+ 65c:	e8 3d ff ff ff       	call   59e <putc>
+ 661:	83 c4 10             	add    $0x10,%esp
+    while(--i >= 0)
+ 664:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+ 668:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 66c:	79 d9                	jns    647 <printint+0x86>
+}
+ 66e:	90                   	nop
+ 66f:	90                   	nop
+ 670:	c9                   	leave
+ 671:	c3                   	ret
+
+00000672 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 672:	55                   	push   %ebp
+ 673:	89 e5                	mov    %esp,%ebp
+ 675:	83 ec 28             	sub    $0x28,%esp
+    char *s;
+    int c, i, state;
+    uint *ap;
+
+    state = 0;
+ 678:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+    ap = (uint*)(void*)&fmt + 1;
+ 67f:	8d 45 0c             	lea    0xc(%ebp),%eax
+ 682:	83 c0 04             	add    $0x4,%eax
+ 685:	89 45 e8             	mov    %eax,-0x18(%ebp)
+    for(i = 0; fmt[i]; i++){
+ 688:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 68f:	e9 59 01 00 00       	jmp    7ed <printf+0x17b>
+        c = fmt[i] & 0xff;
+ 694:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 697:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 69a:	01 d0                	add    %edx,%eax
+ 69c:	0f b6 00             	movzbl (%eax),%eax
+ 69f:	0f be c0             	movsbl %al,%eax
+ 6a2:	25 ff 00 00 00       	and    $0xff,%eax
+ 6a7:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        if(state == 0){
+ 6aa:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 6ae:	75 2c                	jne    6dc <printf+0x6a>
+            if(c == '%'){
+ 6b0:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 6b4:	75 0c                	jne    6c2 <printf+0x50>
+                state = '%';
+ 6b6:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+ 6bd:	e9 27 01 00 00       	jmp    7e9 <printf+0x177>
+            } else {
+                putc(fd, c);
+ 6c2:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 6c5:	0f be c0             	movsbl %al,%eax
+ 6c8:	83 ec 08             	sub    $0x8,%esp
+ 6cb:	50                   	push   %eax
+ 6cc:	ff 75 08             	push   0x8(%ebp)
+ 6cf:	e8 ca fe ff ff       	call   59e <putc>
+ 6d4:	83 c4 10             	add    $0x10,%esp
+ 6d7:	e9 0d 01 00 00       	jmp    7e9 <printf+0x177>
+            }
+        } else if(state == '%'){
+ 6dc:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+ 6e0:	0f 85 03 01 00 00    	jne    7e9 <printf+0x177>
+            if(c == 'd'){
+ 6e6:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+ 6ea:	75 1e                	jne    70a <printf+0x98>
+                printint(fd, *ap, 10, 1);
+ 6ec:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 6ef:	8b 00                	mov    (%eax),%eax
+ 6f1:	6a 01                	push   $0x1
+ 6f3:	6a 0a                	push   $0xa
+ 6f5:	50                   	push   %eax
+ 6f6:	ff 75 08             	push   0x8(%ebp)
+ 6f9:	e8 c3 fe ff ff       	call   5c1 <printint>
+ 6fe:	83 c4 10             	add    $0x10,%esp
+                ap++;
+ 701:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 705:	e9 d8 00 00 00       	jmp    7e2 <printf+0x170>
+            } else if(c == 'x' || c == 'p'){
+ 70a:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+ 70e:	74 06                	je     716 <printf+0xa4>
+ 710:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+ 714:	75 1e                	jne    734 <printf+0xc2>
+                printint(fd, *ap, 16, 0);
+ 716:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 719:	8b 00                	mov    (%eax),%eax
+ 71b:	6a 00                	push   $0x0
+ 71d:	6a 10                	push   $0x10
+ 71f:	50                   	push   %eax
+ 720:	ff 75 08             	push   0x8(%ebp)
+ 723:	e8 99 fe ff ff       	call   5c1 <printint>
+ 728:	83 c4 10             	add    $0x10,%esp
+                ap++;
+ 72b:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 72f:	e9 ae 00 00 00       	jmp    7e2 <printf+0x170>
+            } else if(c == 's'){
+ 734:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+ 738:	75 43                	jne    77d <printf+0x10b>
+                s = (char*)*ap;
+ 73a:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 73d:	8b 00                	mov    (%eax),%eax
+ 73f:	89 45 f4             	mov    %eax,-0xc(%ebp)
+                ap++;
+ 742:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+                if(s == 0)
+ 746:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 74a:	75 25                	jne    771 <printf+0xff>
+                    s = "(null)";
+ 74c:	c7 45 f4 49 0a 00 00 	movl   $0xa49,-0xc(%ebp)
+                while(*s != 0){
+ 753:	eb 1c                	jmp    771 <printf+0xff>
+                    putc(fd, *s);
+ 755:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 758:	0f b6 00             	movzbl (%eax),%eax
+ 75b:	0f be c0             	movsbl %al,%eax
+ 75e:	83 ec 08             	sub    $0x8,%esp
+ 761:	50                   	push   %eax
+ 762:	ff 75 08             	push   0x8(%ebp)
+ 765:	e8 34 fe ff ff       	call   59e <putc>
+ 76a:	83 c4 10             	add    $0x10,%esp
+                    s++;
+ 76d:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+                while(*s != 0){
+ 771:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 774:	0f b6 00             	movzbl (%eax),%eax
+ 777:	84 c0                	test   %al,%al
+ 779:	75 da                	jne    755 <printf+0xe3>
+ 77b:	eb 65                	jmp    7e2 <printf+0x170>
+                }
+            } else if(c == 'c'){
+ 77d:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+ 781:	75 1d                	jne    7a0 <printf+0x12e>
+                putc(fd, *ap);
+ 783:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 786:	8b 00                	mov    (%eax),%eax
+ 788:	0f be c0             	movsbl %al,%eax
+ 78b:	83 ec 08             	sub    $0x8,%esp
+ 78e:	50                   	push   %eax
+ 78f:	ff 75 08             	push   0x8(%ebp)
+ 792:	e8 07 fe ff ff       	call   59e <putc>
+ 797:	83 c4 10             	add    $0x10,%esp
+                ap++;
+ 79a:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 79e:	eb 42                	jmp    7e2 <printf+0x170>
+            } else if(c == '%'){
+ 7a0:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 7a4:	75 17                	jne    7bd <printf+0x14b>
+                putc(fd, c);
+ 7a6:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 7a9:	0f be c0             	movsbl %al,%eax
+ 7ac:	83 ec 08             	sub    $0x8,%esp
+ 7af:	50                   	push   %eax
+ 7b0:	ff 75 08             	push   0x8(%ebp)
+ 7b3:	e8 e6 fd ff ff       	call   59e <putc>
+ 7b8:	83 c4 10             	add    $0x10,%esp
+ 7bb:	eb 25                	jmp    7e2 <printf+0x170>
+            } else {
+                // Unknown % sequence.    Print it to draw attention.
+                putc(fd, '%');
+ 7bd:	83 ec 08             	sub    $0x8,%esp
+ 7c0:	6a 25                	push   $0x25
+ 7c2:	ff 75 08             	push   0x8(%ebp)
+ 7c5:	e8 d4 fd ff ff       	call   59e <putc>
+ 7ca:	83 c4 10             	add    $0x10,%esp
+                putc(fd, c);
+ 7cd:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 7d0:	0f be c0             	movsbl %al,%eax
+ 7d3:	83 ec 08             	sub    $0x8,%esp
+ 7d6:	50                   	push   %eax
+ 7d7:	ff 75 08             	push   0x8(%ebp)
+ 7da:	e8 bf fd ff ff       	call   59e <putc>
+ 7df:	83 c4 10             	add    $0x10,%esp
+            }
+            state = 0;
+ 7e2:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+    for(i = 0; fmt[i]; i++){
+ 7e9:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ 7ed:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 7f0:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 7f3:	01 d0                	add    %edx,%eax
+ 7f5:	0f b6 00             	movzbl (%eax),%eax
+ 7f8:	84 c0                	test   %al,%al
+ 7fa:	0f 85 94 fe ff ff    	jne    694 <printf+0x22>
+        }
+    }
+}
+ 800:	90                   	nop
+ 801:	90                   	nop
+ 802:	c9                   	leave
+ 803:	c3                   	ret
+
+00000804 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 804:	55                   	push   %ebp
+ 805:	89 e5                	mov    %esp,%ebp
+ 807:	83 ec 10             	sub    $0x10,%esp
+    Header *bp, *p;
+
+    bp = (Header*)ap - 1;
+ 80a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 80d:	83 e8 08             	sub    $0x8,%eax
+ 810:	89 45 f8             	mov    %eax,-0x8(%ebp)
+    for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 813:	a1 e0 0c 00 00       	mov    0xce0,%eax
+ 818:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 81b:	eb 24                	jmp    841 <free+0x3d>
+        if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 81d:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 820:	8b 00                	mov    (%eax),%eax
+ 822:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 825:	72 12                	jb     839 <free+0x35>
+ 827:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 82a:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 82d:	72 24                	jb     853 <free+0x4f>
+ 82f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 832:	8b 00                	mov    (%eax),%eax
+ 834:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 837:	72 1a                	jb     853 <free+0x4f>
+    for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 839:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 83c:	8b 00                	mov    (%eax),%eax
+ 83e:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 841:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 844:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 847:	73 d4                	jae    81d <free+0x19>
+ 849:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 84c:	8b 00                	mov    (%eax),%eax
+ 84e:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 851:	73 ca                	jae    81d <free+0x19>
+            break;
+    if(bp + bp->s.size == p->s.ptr){
+ 853:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 856:	8b 40 04             	mov    0x4(%eax),%eax
+ 859:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 860:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 863:	01 c2                	add    %eax,%edx
+ 865:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 868:	8b 00                	mov    (%eax),%eax
+ 86a:	39 c2                	cmp    %eax,%edx
+ 86c:	75 24                	jne    892 <free+0x8e>
+        bp->s.size += p->s.ptr->s.size;
+ 86e:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 871:	8b 50 04             	mov    0x4(%eax),%edx
+ 874:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 877:	8b 00                	mov    (%eax),%eax
+ 879:	8b 40 04             	mov    0x4(%eax),%eax
+ 87c:	01 c2                	add    %eax,%edx
+ 87e:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 881:	89 50 04             	mov    %edx,0x4(%eax)
+        bp->s.ptr = p->s.ptr->s.ptr;
+ 884:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 887:	8b 00                	mov    (%eax),%eax
+ 889:	8b 10                	mov    (%eax),%edx
+ 88b:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 88e:	89 10                	mov    %edx,(%eax)
+ 890:	eb 0a                	jmp    89c <free+0x98>
+    } else
+        bp->s.ptr = p->s.ptr;
+ 892:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 895:	8b 10                	mov    (%eax),%edx
+ 897:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 89a:	89 10                	mov    %edx,(%eax)
+    if(p + p->s.size == bp){
+ 89c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 89f:	8b 40 04             	mov    0x4(%eax),%eax
+ 8a2:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 8a9:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 8ac:	01 d0                	add    %edx,%eax
+ 8ae:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 8b1:	75 20                	jne    8d3 <free+0xcf>
+        p->s.size += bp->s.size;
+ 8b3:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 8b6:	8b 50 04             	mov    0x4(%eax),%edx
+ 8b9:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 8bc:	8b 40 04             	mov    0x4(%eax),%eax
+ 8bf:	01 c2                	add    %eax,%edx
+ 8c1:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 8c4:	89 50 04             	mov    %edx,0x4(%eax)
+        p->s.ptr = bp->s.ptr;
+ 8c7:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 8ca:	8b 10                	mov    (%eax),%edx
+ 8cc:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 8cf:	89 10                	mov    %edx,(%eax)
+ 8d1:	eb 08                	jmp    8db <free+0xd7>
+    } else
+        p->s.ptr = bp;
+ 8d3:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 8d6:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 8d9:	89 10                	mov    %edx,(%eax)
+    freep = p;
+ 8db:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 8de:	a3 e0 0c 00 00       	mov    %eax,0xce0
+}
+ 8e3:	90                   	nop
+ 8e4:	c9                   	leave
+ 8e5:	c3                   	ret
+
+000008e6 <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+ 8e6:	55                   	push   %ebp
+ 8e7:	89 e5                	mov    %esp,%ebp
+ 8e9:	83 ec 18             	sub    $0x18,%esp
+    char *p;
+    Header *hp;
+
+    if(nu < 4096)
+ 8ec:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+ 8f3:	77 07                	ja     8fc <morecore+0x16>
+        nu = 4096;
+ 8f5:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+    p = sbrk(nu * sizeof(Header));
+ 8fc:	8b 45 08             	mov    0x8(%ebp),%eax
+ 8ff:	c1 e0 03             	shl    $0x3,%eax
+ 902:	83 ec 0c             	sub    $0xc,%esp
+ 905:	50                   	push   %eax
+ 906:	e8 0a fb ff ff       	call   415 <sbrk>
+ 90b:	83 c4 10             	add    $0x10,%esp
+ 90e:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p == (char*)-1)
+ 911:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+ 915:	75 07                	jne    91e <morecore+0x38>
+        return 0;
+ 917:	b8 00 00 00 00       	mov    $0x0,%eax
+ 91c:	eb 26                	jmp    944 <morecore+0x5e>
+    hp = (Header*)p;
+ 91e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 921:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    hp->s.size = nu;
+ 924:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 927:	8b 55 08             	mov    0x8(%ebp),%edx
+ 92a:	89 50 04             	mov    %edx,0x4(%eax)
+    free((void*)(hp + 1));
+ 92d:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 930:	83 c0 08             	add    $0x8,%eax
+ 933:	83 ec 0c             	sub    $0xc,%esp
+ 936:	50                   	push   %eax
+ 937:	e8 c8 fe ff ff       	call   804 <free>
+ 93c:	83 c4 10             	add    $0x10,%esp
+    return freep;
+ 93f:	a1 e0 0c 00 00       	mov    0xce0,%eax
+}
+ 944:	c9                   	leave
+ 945:	c3                   	ret
+
+00000946 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ 946:	55                   	push   %ebp
+ 947:	89 e5                	mov    %esp,%ebp
+ 949:	83 ec 18             	sub    $0x18,%esp
+    Header *p, *prevp;
+    uint nunits;
+
+    nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 94c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 94f:	83 c0 07             	add    $0x7,%eax
+ 952:	c1 e8 03             	shr    $0x3,%eax
+ 955:	83 c0 01             	add    $0x1,%eax
+ 958:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    if((prevp = freep) == 0){
+ 95b:	a1 e0 0c 00 00       	mov    0xce0,%eax
+ 960:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ 963:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 967:	75 23                	jne    98c <malloc+0x46>
+        base.s.ptr = freep = prevp = &base;
+ 969:	c7 45 f0 d8 0c 00 00 	movl   $0xcd8,-0x10(%ebp)
+ 970:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 973:	a3 e0 0c 00 00       	mov    %eax,0xce0
+ 978:	a1 e0 0c 00 00       	mov    0xce0,%eax
+ 97d:	a3 d8 0c 00 00       	mov    %eax,0xcd8
+        base.s.size = 0;
+ 982:	c7 05 dc 0c 00 00 00 	movl   $0x0,0xcdc
+ 989:	00 00 00 
+    }
+    for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 98c:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 98f:	8b 00                	mov    (%eax),%eax
+ 991:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        if(p->s.size >= nunits){
+ 994:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 997:	8b 40 04             	mov    0x4(%eax),%eax
+ 99a:	3b 45 ec             	cmp    -0x14(%ebp),%eax
+ 99d:	72 4d                	jb     9ec <malloc+0xa6>
+            if(p->s.size == nunits)
+ 99f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 9a2:	8b 40 04             	mov    0x4(%eax),%eax
+ 9a5:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+ 9a8:	75 0c                	jne    9b6 <malloc+0x70>
+                prevp->s.ptr = p->s.ptr;
+ 9aa:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 9ad:	8b 10                	mov    (%eax),%edx
+ 9af:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 9b2:	89 10                	mov    %edx,(%eax)
+ 9b4:	eb 26                	jmp    9dc <malloc+0x96>
+            else {
+                p->s.size -= nunits;
+ 9b6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 9b9:	8b 40 04             	mov    0x4(%eax),%eax
+ 9bc:	2b 45 ec             	sub    -0x14(%ebp),%eax
+ 9bf:	89 c2                	mov    %eax,%edx
+ 9c1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 9c4:	89 50 04             	mov    %edx,0x4(%eax)
+                p += p->s.size;
+ 9c7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 9ca:	8b 40 04             	mov    0x4(%eax),%eax
+ 9cd:	c1 e0 03             	shl    $0x3,%eax
+ 9d0:	01 45 f4             	add    %eax,-0xc(%ebp)
+                p->s.size = nunits;
+ 9d3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 9d6:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 9d9:	89 50 04             	mov    %edx,0x4(%eax)
+            }
+            freep = prevp;
+ 9dc:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 9df:	a3 e0 0c 00 00       	mov    %eax,0xce0
+            return (void*)(p + 1);
+ 9e4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 9e7:	83 c0 08             	add    $0x8,%eax
+ 9ea:	eb 3b                	jmp    a27 <malloc+0xe1>
+        }
+        if(p == freep)
+ 9ec:	a1 e0 0c 00 00       	mov    0xce0,%eax
+ 9f1:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ 9f4:	75 1e                	jne    a14 <malloc+0xce>
+            if((p = morecore(nunits)) == 0)
+ 9f6:	83 ec 0c             	sub    $0xc,%esp
+ 9f9:	ff 75 ec             	push   -0x14(%ebp)
+ 9fc:	e8 e5 fe ff ff       	call   8e6 <morecore>
+ a01:	83 c4 10             	add    $0x10,%esp
+ a04:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ a07:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ a0b:	75 07                	jne    a14 <malloc+0xce>
+                return 0;
+ a0d:	b8 00 00 00 00       	mov    $0x0,%eax
+ a12:	eb 13                	jmp    a27 <malloc+0xe1>
+    for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ a14:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a17:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ a1a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a1d:	8b 00                	mov    (%eax),%eax
+ a1f:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        if(p->s.size >= nunits){
+ a22:	e9 6d ff ff ff       	jmp    994 <malloc+0x4e>
+    }
+}
+ a27:	c9                   	leave
+ a28:	c3                   	ret
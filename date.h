@@ -6,3 +6,13 @@ struct rtcdate {
     uint month;
     uint year;
 };
+
+struct timespec {
+    int tv_sec;
+    int tv_nsec;
+};
+
+#define CLOCK_REALTIME        0
+#define CLOCK_MONOTONIC     1    // time since boot
+
+#define TIMER_ABSTIME         1    // clock_nanosleep: req is a deadline
@@ -1,14 +1,30 @@
 struct buf;
 struct context;
 struct file;
+struct hrtimer;
 struct inode;
+struct ioctx;
+struct iosqe;
+struct iovec;
+struct devsw;
 struct pipe;
 struct proc;
 struct rtcdate;
+struct schedinfo;
+struct schedlat;
 struct spinlock;
 struct sleeplock;
+struct lockclass;
+struct lockstat;
+struct rwlock;
+struct seqlock;
 struct stat;
+struct stracerec;
+struct syscount;
+struct sysstat;
 struct superblock;
+struct timer;
+struct uffd;
 struct mm_area;
 
 // bio.c
@@ -31,9 +47,16 @@ struct file*                filealloc(void);
 void                        fileclose(struct file*);
 struct file*                   filedup(struct file*);
 void                        fileinit(void);
+void                        devswregister(int, int (*)(struct inode*, char*, int), int (*)(struct inode*, char*, int));
+int                         getdevsw(int, struct devsw*);
 int                         fileread(struct file*, char*, int n);
 int                         filestat(struct file*, struct stat*);
 int                         filewrite(struct file*, char*, int n);
+int                         filepread(struct file*, char*, int, uint);
+int                         filepwrite(struct file*, char*, int, uint);
+int                         filereadv(struct file*, struct iovec*, int);
+int                         filewritev(struct file*, struct iovec*, int);
+int                         filesplice(struct file*, uint*, struct file*, uint*, int);
 
 // fs.c
 void                        readsb(int dev, struct superblock *sb);
@@ -51,9 +74,19 @@ int                         namecmp(const char*, const char*);
 struct inode*               namei(char*);
 struct inode*               nameiparent(char*, char*);
 int                         readi(struct inode*, char*, uint, uint);
+int                         readipipe(struct inode*, struct pipe*, uint, uint);
 void                        stati(struct inode*, struct stat*);
 int                         writei(struct inode*, char*, uint, uint);
 
+// hrtimer.c
+void                        cyclestons(uint64, uint*, uint*);
+void                        hrtickstop(int);
+void                        hrtimercancel(struct hrtimer*);
+int                         hrtimerintr(void);
+void                        hrtimerset(struct hrtimer*, uint64, void(*)(void*), void*);
+int                         hrsleep(uint64);
+uint64                      nstocycles(uint, uint);
+
 // ide.c
 void                        ideinit(void);
 void                        ideintr(void);
@@ -63,11 +96,22 @@ void                        iderw(struct buf*);
 void                        ioapicenable(int irq, int cpu);
 extern uchar                ioapicid;
 void                        ioapicinit(void);
+int                         ioapicroute(int, int);
+
+// ioring.c
+int                         ioringalloc(struct file**, uint*);
+void                        ioringclose(struct ioctx*);
+void                        ioringinit(void);
+int                         ioringnext(struct ioctx*, struct iosqe*);
+void                        ioringpost(struct ioctx*, uint, int);
+void                        ioringsubmit(struct ioctx*, struct file*, struct iosqe*);
+int                         ioringwait(struct ioctx*, int);
 
 // kalloc.c
 char*                       kalloc(void);
 void                        kfree(char*);
 void                        kdecref(uint);
+void                        kincref(uint);
 void                        kinit1(void*, void*);
 void                        kinit2(void*, void*);
 
@@ -80,6 +124,11 @@ int                         lapicid(void);
 extern volatile uint*       lapic;
 void                        lapiceoi(void);
 void                        lapicinit(void);
+void                        lapicipi(int, int);
+extern uint                 lapickhz;
+void                        lapiconeshot(uint);
+extern uint                 tsckhz;
+extern uint64               boottsc;
 void                        lapicstartap(uchar, uint);
 void                        microdelay(int);
 
@@ -88,11 +137,21 @@ void                        initlog(int dev);
 void                        log_write(struct buf*);
 void                        begin_op();
 void                        end_op();
+void                        logsync(void);
 
 // mp.c
 extern int                  ismp;
 void                        mpinit(void);
 
+// ncache.c
+uint                        ncachebegin(void);
+void                        ncacheenter(uint, uint, char*, uint, int);
+void                        ncacheinit(void);
+uint                        ncachelookup(uint, uint, char*, int*);
+void                        ncachepurge(uint, uint);
+void                        ncacheremove(uint, uint, char*);
+int                         ncacheretry(uint);
+
 // picirq.c
 void                        picenable(int);
 void                        picinit(void);
@@ -102,26 +161,56 @@ int                         pipealloc(struct file**, struct file**);
 void                        pipeclose(struct pipe*, int);
 int                         piperead(struct pipe*, char*, int);
 int                         pipewrite(struct pipe*, char*, int);
+int                         pipewait(struct pipe*);
+int                         pipeput(struct pipe*, char*, int);
 
 //PAGEBREAK: 16
 // proc.c
+void                        acct(int);
 int                         cpuid(void);
 void                        exit(void);
 int                         fork(void);
+int                         getaffinity(int);
+int                         getpriority(int);
 int                         kill(int);
+struct proc*                kproc(char*, void(*)(void));
 struct cpu*                 mycpu(void);
 struct proc*                myproc();
 void                        pinit(void);
 void                        procdump(void);
 void                        scheduler(void) __attribute__((noreturn));
 void                        sched(void);
+int                         schedinfo(struct schedinfo*, int);
+int                         schedlat(int, struct schedlat*, int);
+int                         schedtick(int);
+int                         needresched(void);
+int                         setscheduler(int, int, int);
+int                         getscheduler(int);
+int                         getrtprio(int);
+int                         setaffinity(int, uint);
+int                         setgroup(int);
+int                         setpriority(int, int);
+int                         setstrace(int, int);
+int                         setweight(int, int);
 void                        setproc(struct proc*);
 void                        sleep(void*, struct spinlock*);
+int                         syscounts(int, char*, int);
 void                        userinit(void);
 int                         wait(void);
+void                        wakeone(void*);
 void                        wakeup(void*);
 void                        yield(void);
 
+// uffd.c
+int                         uffdalloc(struct file**);
+void                        uffdclose(struct uffd*);
+int                         uffdcopy(struct uffd*, uint, char*);
+void                        uffddetach(struct proc*);
+int                         uffdfault(struct proc*, uint);
+void                        uffdfaultin(struct proc*, uint, uint);
+int                         uffdread(struct uffd*, char*, int);
+int                         uffdregister(struct uffd*, uint, uint);
+
 // swtch.S
 void                        swtch(struct context**, struct context*);
 
@@ -136,6 +225,32 @@ void                        popcli(void);
 void                        popclii(uint);
 void                        pushclii(uint);
 
+// lockstat.c
+extern int                  lockstaton;
+struct lockclass*           lockclass(char*, int);
+void                        lockstatacquire(struct lockclass*, uint, int, uint64);
+void                        lockstatrelease(struct lockclass*, uint64);
+int                         lockstat(int, struct lockstat*, int);
+
+// rcu.c
+void                        rcureadlock(void);
+void                        rcureadunlock(void);
+uint                        rcuretire(void);
+void                        rcuwait(uint);
+
+// rwlock.c
+void                        initrwlock(struct rwlock*, char*, uint);
+void                        acquireread(struct rwlock*);
+void                        releaseread(struct rwlock*);
+void                        acquirewrite(struct rwlock*);
+void                        releasewrite(struct rwlock*);
+int                         holdingwrite(struct rwlock*);
+void                        initseqlock(struct seqlock*, char*);
+void                        writeseqlock(struct seqlock*);
+void                        writesequnlock(struct seqlock*);
+uint                        readseqbegin(struct seqlock*);
+int                         readseqretry(struct seqlock*, uint);
+
 // sleeplock.c
 void                        acquiresleep(struct sleeplock*);
 void                        releasesleep(struct sleeplock*);
@@ -155,16 +270,30 @@ char*                       strncpy(char*, const char*, int);
 int                         argint(int, int*);
 int                         argptr(int, char**, int);
 int                         argstr(int, char**);
+int                         checkrange(uint, uint);
 int                         fetchint(uint, int*);
 int                         fetchstr(uint, char**);
 void                        syscall(void);
+char*                       syscallname(int);
+
+// sysstat.c
+extern int                  sysstaton;
+void                        stracecount(int);
+int                         straceread(struct stracerec*, int);
+void                        syscallstat(int, uint*, int, uint64);
+int                         sysstat(int, int, struct sysstat*, int);
+void                        sysstatinit(void);
 
 // timer.c
-void                        timerinit(void);
+void                        timerdel(struct timer*);
+void                        timerexpire(uint);
+void                        timerset(struct timer*, uint, void(*)(void*), void*);
 
 // trap.c
 void                        idtinit(void);
+void                        sysenterinit(void);
 extern uint ticks;
+uint                        readticks(void);
 void                        tvinit(void);
 void                        tlb_invalidate(pde_t*, void*);
 extern struct spinlock tickslock;
@@ -174,6 +303,11 @@ void                        uartinit(void);
 void                        uartintr(void);
 void                        uartputc(int);
 
+// vdso.c
+void                        vdsoinit(void);
+int                         vdsomap(pde_t*, int);
+void                        vdsotick(uint);
+
 // vm.c
 void                        seginit(void);
 void                        kvmalloc(void);
@@ -198,5 +332,7 @@ int                         mappage(pde_t*, void*, uint, int);
 void                        unmappage(pde_t*, void*, pte_t**);
 pde_t*                      copyseg(pde_t*, pde_t*, struct mm_area*);
 pte_t*                      walkpgdir(pde_t *, const void *, int);
+int                         pinuvm(uint, uint, int, uint*);
+void                        unpinuvm(uint*, int);
 // number of elements in fixed-size array
 #define NELEM(x) (sizeof(x)/sizeof((x)[0]))
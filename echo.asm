@@ -0,0 +1,1395 @@
+
+_echo:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "stat.h"
+#include "user.h"
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	53                   	push   %ebx
+   e:	51                   	push   %ecx
+   f:	83 ec 10             	sub    $0x10,%esp
+  12:	89 cb                	mov    %ecx,%ebx
+    int i;
+
+    for(i = 1; i < argc; i++)
+  14:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+  1b:	eb 3c                	jmp    59 <main+0x59>
+        printf(1, "%s%s", argv[i], i+1 < argc ? " " : "\n");
+  1d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  20:	83 c0 01             	add    $0x1,%eax
+  23:	39 03                	cmp    %eax,(%ebx)
+  25:	7e 07                	jle    2e <main+0x2e>
+  27:	b9 24 0a 00 00       	mov    $0xa24,%ecx
+  2c:	eb 05                	jmp    33 <main+0x33>
+  2e:	b9 26 0a 00 00       	mov    $0xa26,%ecx
+  33:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  36:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+  3d:	8b 43 04             	mov    0x4(%ebx),%eax
+  40:	01 d0                	add    %edx,%eax
+  42:	8b 00                	mov    (%eax),%eax
+  44:	51                   	push   %ecx
+  45:	50                   	push   %eax
+  46:	68 28 0a 00 00       	push   $0xa28
+  4b:	6a 01                	push   $0x1
+  4d:	e8 1b 06 00 00       	call   66d <printf>
+  52:	83 c4 10             	add    $0x10,%esp
+    for(i = 1; i < argc; i++)
+  55:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+  59:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  5c:	3b 03                	cmp    (%ebx),%eax
+  5e:	7c bd                	jl     1d <main+0x1d>
+    exit();
+  60:	e8 0a 03 00 00       	call   36f <exit>
+
+00000065 <stosb>:
+strchr(const char *s, char c)
+{
+    for(; *s; s++)
+        if(*s == c)
+            return (char*)s;
+    return 0;
+  65:	55                   	push   %ebp
+  66:	89 e5                	mov    %esp,%ebp
+  68:	57                   	push   %edi
+  69:	53                   	push   %ebx
+}
+  6a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  6d:	8b 55 10             	mov    0x10(%ebp),%edx
+  70:	8b 45 0c             	mov    0xc(%ebp),%eax
+  73:	89 cb                	mov    %ecx,%ebx
+  75:	89 df                	mov    %ebx,%edi
+  77:	89 d1                	mov    %edx,%ecx
+  79:	fc                   	cld
+  7a:	f3 aa                	rep stos %al,%es:(%edi)
+  7c:	89 ca                	mov    %ecx,%edx
+  7e:	89 fb                	mov    %edi,%ebx
+  80:	89 5d 08             	mov    %ebx,0x8(%ebp)
+  83:	89 55 10             	mov    %edx,0x10(%ebp)
+
+char*
+gets(char *buf, int max)
+{
+  86:	90                   	nop
+  87:	5b                   	pop    %ebx
+  88:	5f                   	pop    %edi
+  89:	5d                   	pop    %ebp
+  8a:	c3                   	ret
+
+0000008b <strcpy>:
+{
+  8b:	55                   	push   %ebp
+  8c:	89 e5                	mov    %esp,%ebp
+  8e:	83 ec 10             	sub    $0x10,%esp
+    os = s;
+  91:	8b 45 08             	mov    0x8(%ebp),%eax
+  94:	89 45 fc             	mov    %eax,-0x4(%ebp)
+    while((*s++ = *t++) != 0)
+  97:	90                   	nop
+  98:	8b 55 0c             	mov    0xc(%ebp),%edx
+  9b:	8d 42 01             	lea    0x1(%edx),%eax
+  9e:	89 45 0c             	mov    %eax,0xc(%ebp)
+  a1:	8b 45 08             	mov    0x8(%ebp),%eax
+  a4:	8d 48 01             	lea    0x1(%eax),%ecx
+  a7:	89 4d 08             	mov    %ecx,0x8(%ebp)
+  aa:	0f b6 12             	movzbl (%edx),%edx
+  ad:	88 10                	mov    %dl,(%eax)
+  af:	0f b6 00             	movzbl (%eax),%eax
+  b2:	84 c0                	test   %al,%al
+  b4:	75 e2                	jne    98 <strcpy+0xd>
+    return os;
+  b6:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+  b9:	c9                   	leave
+  ba:	c3                   	ret
+
+000000bb <strcmp>:
+{
+  bb:	55                   	push   %ebp
+  bc:	89 e5                	mov    %esp,%ebp
+    while(*p && *p == *q)
+  be:	eb 08                	jmp    c8 <strcmp+0xd>
+        p++, q++;
+  c0:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+  c4:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+    while(*p && *p == *q)
+  c8:	8b 45 08             	mov    0x8(%ebp),%eax
+  cb:	0f b6 00             	movzbl (%eax),%eax
+  ce:	84 c0                	test   %al,%al
+  d0:	74 10                	je     e2 <strcmp+0x27>
+  d2:	8b 45 08             	mov    0x8(%ebp),%eax
+  d5:	0f b6 10             	movzbl (%eax),%edx
+  d8:	8b 45 0c             	mov    0xc(%ebp),%eax
+  db:	0f b6 00             	movzbl (%eax),%eax
+  de:	38 c2                	cmp    %al,%dl
+  e0:	74 de                	je     c0 <strcmp+0x5>
+    return (uchar)*p - (uchar)*q;
+  e2:	8b 45 08             	mov    0x8(%ebp),%eax
+  e5:	0f b6 00             	movzbl (%eax),%eax
+  e8:	0f b6 d0             	movzbl %al,%edx
+  eb:	8b 45 0c             	mov    0xc(%ebp),%eax
+  ee:	0f b6 00             	movzbl (%eax),%eax
+  f1:	0f b6 c0             	movzbl %al,%eax
+  f4:	29 c2                	sub    %eax,%edx
+  f6:	89 d0                	mov    %edx,%eax
+}
+  f8:	5d                   	pop    %ebp
+  f9:	c3                   	ret
+
+000000fa <strlen>:
+{
+  fa:	55                   	push   %ebp
+  fb:	89 e5                	mov    %esp,%ebp
+  fd:	83 ec 10             	sub    $0x10,%esp
+    for(n = 0; s[n]; n++)
+ 100:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ 107:	eb 04                	jmp    10d <strlen+0x13>
+ 109:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 10d:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 110:	8b 45 08             	mov    0x8(%ebp),%eax
+ 113:	01 d0                	add    %edx,%eax
+ 115:	0f b6 00             	movzbl (%eax),%eax
+ 118:	84 c0                	test   %al,%al
+ 11a:	75 ed                	jne    109 <strlen+0xf>
+    return n;
+ 11c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 11f:	c9                   	leave
+ 120:	c3                   	ret
+
+00000121 <memset>:
+{
+ 121:	55                   	push   %ebp
+ 122:	89 e5                	mov    %esp,%ebp
+    stosb(dst, c, n);
+ 124:	8b 45 10             	mov    0x10(%ebp),%eax
+ 127:	50                   	push   %eax
+ 128:	ff 75 0c             	push   0xc(%ebp)
+ 12b:	ff 75 08             	push   0x8(%ebp)
+ 12e:	e8 32 ff ff ff       	call   65 <stosb>
+ 133:	83 c4 0c             	add    $0xc,%esp
+    return dst;
+ 136:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 139:	c9                   	leave
+ 13a:	c3                   	ret
+
+0000013b <strchr>:
+{
+ 13b:	55                   	push   %ebp
+ 13c:	89 e5                	mov    %esp,%ebp
+ 13e:	83 ec 04             	sub    $0x4,%esp
+ 141:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 144:	88 45 fc             	mov    %al,-0x4(%ebp)
+    for(; *s; s++)
+ 147:	eb 14                	jmp    15d <strchr+0x22>
+        if(*s == c)
+ 149:	8b 45 08             	mov    0x8(%ebp),%eax
+ 14c:	0f b6 00             	movzbl (%eax),%eax
+ 14f:	38 45 fc             	cmp    %al,-0x4(%ebp)
+ 152:	75 05                	jne    159 <strchr+0x1e>
+            return (char*)s;
+ 154:	8b 45 08             	mov    0x8(%ebp),%eax
+ 157:	eb 13                	jmp    16c <strchr+0x31>
+    for(; *s; s++)
+ 159:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 15d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 160:	0f b6 00             	movzbl (%eax),%eax
+ 163:	84 c0                	test   %al,%al
+ 165:	75 e2                	jne    149 <strchr+0xe>
+    return 0;
+ 167:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 16c:	c9                   	leave
+ 16d:	c3                   	ret
+
+0000016e <gets>:
+{
+ 16e:	55                   	push   %ebp
+ 16f:	89 e5                	mov    %esp,%ebp
+ 171:	83 ec 18             	sub    $0x18,%esp
+    int i, cc;
+    char c;
+
+    for(i=0; i+1 < max; ){
+ 174:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 17b:	eb 42                	jmp    1bf <gets+0x51>
+        cc = read(0, &c, 1);
+ 17d:	83 ec 04             	sub    $0x4,%esp
+ 180:	6a 01                	push   $0x1
+ 182:	8d 45 ef             	lea    -0x11(%ebp),%eax
+ 185:	50                   	push   %eax
+ 186:	6a 00                	push   $0x0
+ 188:	e8 f7 01 00 00       	call   384 <read>
+ 18d:	83 c4 10             	add    $0x10,%esp
+ 190:	89 45 f0             	mov    %eax,-0x10(%ebp)
+        if(cc < 1)
+ 193:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 197:	7e 33                	jle    1cc <gets+0x5e>
+            break;
+        buf[i++] = c;
+ 199:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 19c:	8d 50 01             	lea    0x1(%eax),%edx
+ 19f:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 1a2:	89 c2                	mov    %eax,%edx
+ 1a4:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1a7:	01 c2                	add    %eax,%edx
+ 1a9:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 1ad:	88 02                	mov    %al,(%edx)
+        if(c == '\n' || c == '\r')
+ 1af:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 1b3:	3c 0a                	cmp    $0xa,%al
+ 1b5:	74 16                	je     1cd <gets+0x5f>
+ 1b7:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 1bb:	3c 0d                	cmp    $0xd,%al
+ 1bd:	74 0e                	je     1cd <gets+0x5f>
+    for(i=0; i+1 < max; ){
+ 1bf:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 1c2:	83 c0 01             	add    $0x1,%eax
+ 1c5:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 1c8:	7f b3                	jg     17d <gets+0xf>
+ 1ca:	eb 01                	jmp    1cd <gets+0x5f>
+            break;
+ 1cc:	90                   	nop
+            break;
+    }
+    buf[i] = '\0';
+ 1cd:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 1d0:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1d3:	01 d0                	add    %edx,%eax
+ 1d5:	c6 00 00             	movb   $0x0,(%eax)
+    return buf;
+ 1d8:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 1db:	c9                   	leave
+ 1dc:	c3                   	ret
+
+000001dd <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 1dd:	55                   	push   %ebp
+ 1de:	89 e5                	mov    %esp,%ebp
+ 1e0:	83 ec 18             	sub    $0x18,%esp
+    int fd;
+    int r;
+
+    fd = open(n, O_RDONLY);
+ 1e3:	83 ec 08             	sub    $0x8,%esp
+ 1e6:	6a 00                	push   $0x0
+ 1e8:	ff 75 08             	push   0x8(%ebp)
+ 1eb:	e8 c6 01 00 00       	call   3b6 <open>
+ 1f0:	83 c4 10             	add    $0x10,%esp
+ 1f3:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(fd < 0)
+ 1f6:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 1fa:	79 07                	jns    203 <stat+0x26>
+        return -1;
+ 1fc:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 201:	eb 25                	jmp    228 <stat+0x4b>
+    r = fstat(fd, st);
+ 203:	83 ec 08             	sub    $0x8,%esp
+ 206:	ff 75 0c             	push   0xc(%ebp)
+ 209:	ff 75 f4             	push   -0xc(%ebp)
+ 20c:	e8 c3 01 00 00       	call   3d4 <fstat>
+ 211:	83 c4 10             	add    $0x10,%esp
+ 214:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    close(fd);
+ 217:	83 ec 0c             	sub    $0xc,%esp
+ 21a:	ff 75 f4             	push   -0xc(%ebp)
+ 21d:	e8 76 01 00 00       	call   398 <close>
+ 222:	83 c4 10             	add    $0x10,%esp
+    return r;
+ 225:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ 228:	c9                   	leave
+ 229:	c3                   	ret
+
+0000022a <atoi>:
+
+int
+atoi(const char *s)
+{
+ 22a:	55                   	push   %ebp
+ 22b:	89 e5                	mov    %esp,%ebp
+ 22d:	83 ec 10             	sub    $0x10,%esp
+    int n;
+
+    n = 0;
+ 230:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+    while('0' <= *s && *s <= '9')
+ 237:	eb 25                	jmp    25e <atoi+0x34>
+        n = n*10 + *s++ - '0';
+ 239:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 23c:	89 d0                	mov    %edx,%eax
+ 23e:	c1 e0 02             	shl    $0x2,%eax
+ 241:	01 d0                	add    %edx,%eax
+ 243:	01 c0                	add    %eax,%eax
+ 245:	89 c1                	mov    %eax,%ecx
+ 247:	8b 45 08             	mov    0x8(%ebp),%eax
+ 24a:	8d 50 01             	lea    0x1(%eax),%edx
+ 24d:	89 55 08             	mov    %edx,0x8(%ebp)
+ 250:	0f b6 00             	movzbl (%eax),%eax
+ 253:	0f be c0             	movsbl %al,%eax
+ 256:	01 c8                	add    %ecx,%eax
+ 258:	83 e8 30             	sub    $0x30,%eax
+ 25b:	89 45 fc             	mov    %eax,-0x4(%ebp)
+    while('0' <= *s && *s <= '9')
+ 25e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 261:	0f b6 00             	movzbl (%eax),%eax
+ 264:	3c 2f                	cmp    $0x2f,%al
+ 266:	7e 0a                	jle    272 <atoi+0x48>
+ 268:	8b 45 08             	mov    0x8(%ebp),%eax
+ 26b:	0f b6 00             	movzbl (%eax),%eax
+ 26e:	3c 39                	cmp    $0x39,%al
+ 270:	7e c7                	jle    239 <atoi+0xf>
+    return n;
+ 272:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 275:	c9                   	leave
+ 276:	c3                   	ret
+
+00000277 <nice>:
+
+// Add inc to the caller's nice value; return the new value.
+int
+nice(int inc)
+{
+ 277:	55                   	push   %ebp
+ 278:	89 e5                	mov    %esp,%ebp
+ 27a:	83 ec 18             	sub    $0x18,%esp
+    int n;
+
+    n = getpriority(0) + inc;
+ 27d:	83 ec 0c             	sub    $0xc,%esp
+ 280:	6a 00                	push   $0x0
+ 282:	e8 d9 01 00 00       	call   460 <getpriority>
+ 287:	83 c4 10             	add    $0x10,%esp
+ 28a:	8b 55 08             	mov    0x8(%ebp),%edx
+ 28d:	01 d0                	add    %edx,%eax
+ 28f:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(n < 0)
+ 292:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 296:	79 07                	jns    29f <nice+0x28>
+        n = 0;
+ 298:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    if(n > NICEMAX)
+ 29f:	83 7d f4 13          	cmpl   $0x13,-0xc(%ebp)
+ 2a3:	7e 07                	jle    2ac <nice+0x35>
+        n = NICEMAX;
+ 2a5:	c7 45 f4 13 00 00 00 	movl   $0x13,-0xc(%ebp)
+    if(setpriority(0, n) < 0)
+ 2ac:	83 ec 08             	sub    $0x8,%esp
+ 2af:	ff 75 f4             	push   -0xc(%ebp)
+ 2b2:	6a 00                	push   $0x0
+ 2b4:	e8 b1 01 00 00       	call   46a <setpriority>
+ 2b9:	83 c4 10             	add    $0x10,%esp
+ 2bc:	85 c0                	test   %eax,%eax
+ 2be:	79 07                	jns    2c7 <nice+0x50>
+        return -1;
+ 2c0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 2c5:	eb 03                	jmp    2ca <nice+0x53>
+    return n;
+ 2c7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+ 2ca:	c9                   	leave
+ 2cb:	c3                   	ret
+
+000002cc <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 2cc:	55                   	push   %ebp
+ 2cd:	89 e5                	mov    %esp,%ebp
+ 2cf:	83 ec 10             	sub    $0x10,%esp
+    char *dst;
+    const char *src;
+
+    dst = vdst;
+ 2d2:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2d5:	89 45 fc             	mov    %eax,-0x4(%ebp)
+    src = vsrc;
+ 2d8:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 2db:	89 45 f8             	mov    %eax,-0x8(%ebp)
+    while(n-- > 0)
+ 2de:	eb 17                	jmp    2f7 <memmove+0x2b>
+        *dst++ = *src++;
+ 2e0:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 2e3:	8d 42 01             	lea    0x1(%edx),%eax
+ 2e6:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 2e9:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 2ec:	8d 48 01             	lea    0x1(%eax),%ecx
+ 2ef:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+ 2f2:	0f b6 12             	movzbl (%edx),%edx
+ 2f5:	88 10                	mov    %dl,(%eax)
+    while(n-- > 0)
+ 2f7:	8b 45 10             	mov    0x10(%ebp),%eax
+ 2fa:	8d 50 ff             	lea    -0x1(%eax),%edx
+ 2fd:	89 55 10             	mov    %edx,0x10(%ebp)
+ 300:	85 c0                	test   %eax,%eax
+ 302:	7f dc                	jg     2e0 <memmove+0x14>
+    return vdst;
+ 304:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 307:	c9                   	leave
+ 308:	c3                   	ret
+
+00000309 <dosyscall>:
+sysmode:
+    .long 0
+
+    .text
+dosyscall:
+    cmpl $0, sysmode
+ 309:	83 3d 9c 0c 00 00 00 	cmpl   $0x0,0xc9c
+    jg 2f
+ 310:	7f 0c                	jg     31e <dosyscall+0x15>
+    jl 1f
+ 312:	7c 07                	jl     31b <dosyscall+0x12>
+    call sepcheck
+ 314:	e8 27 00 00 00       	call   340 <sepcheck>
+    jmp dosyscall
+ 319:	eb ee                	jmp    309 <dosyscall>
+1:
+    int $T_SYSCALL
+ 31b:	cd 40                	int    $0x40
+    ret
+ 31d:	c3                   	ret
+2:
+    pushl %ebx
+ 31e:	53                   	push   %ebx
+    pushl %esi
+ 31f:	56                   	push   %esi
+    pushl %edi
+ 320:	57                   	push   %edi
+    pushl %ebp
+ 321:	55                   	push   %ebp
+    movl 20(%esp), %ebx
+ 322:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+    movl 24(%esp), %esi
+ 326:	8b 74 24 18          	mov    0x18(%esp),%esi
+    movl 28(%esp), %edi
+ 32a:	8b 7c 24 1c          	mov    0x1c(%esp),%edi
+    movl 32(%esp), %ebp
+ 32e:	8b 6c 24 20          	mov    0x20(%esp),%ebp
+    movl %esp, %ecx
+ 332:	89 e1                	mov    %esp,%ecx
+    movl $3f, %edx
+ 334:	ba 3b 03 00 00       	mov    $0x33b,%edx
+    sysenter
+ 339:	0f 34                	sysenter
+3:
+    popl %ebp
+ 33b:	5d                   	pop    %ebp
+    popl %edi
+ 33c:	5f                   	pop    %edi
+    popl %esi
+ 33d:	5e                   	pop    %esi
+    popl %ebx
+ 33e:	5b                   	pop    %ebx
+    ret
+ 33f:	c3                   	ret
+
+00000340 <sepcheck>:
+
+# Set sysmode from cpuid's SEP flag.    Preserves %eax.
+sepcheck:
+    pushl %eax
+ 340:	50                   	push   %eax
+    pushl %ebx
+ 341:	53                   	push   %ebx
+    movl $1, %eax
+ 342:	b8 01 00 00 00       	mov    $0x1,%eax
+    cpuid
+ 347:	0f a2                	cpuid
+    movl $-1, sysmode
+ 349:	c7 05 9c 0c 00 00 ff 	movl   $0xffffffff,0xc9c
+ 350:	ff ff ff 
+    testl $0x800, %edx
+ 353:	f7 c2 00 08 00 00    	test   $0x800,%edx
+    jz 1f
+ 359:	74 0a                	je     365 <sepcheck+0x25>
+    movl $1, sysmode
+ 35b:	c7 05 9c 0c 00 00 01 	movl   $0x1,0xc9c
+ 362:	00 00 00 
+1:
+    popl %ebx
+ 365:	5b                   	pop    %ebx
+    popl %eax
+ 366:	58                   	pop    %eax
+    ret
+ 367:	c3                   	ret
+
+00000368 <fork>:
+
+SYSCALL(fork)
+ 368:	b8 01 00 00 00       	mov    $0x1,%eax
+ 36d:	eb 9a                	jmp    309 <dosyscall>
+
+0000036f <exit>:
+SYSCALL(exit)
+ 36f:	b8 02 00 00 00       	mov    $0x2,%eax
+ 374:	eb 93                	jmp    309 <dosyscall>
+
+00000376 <wait>:
+SYSCALL(wait)
+ 376:	b8 03 00 00 00       	mov    $0x3,%eax
+ 37b:	eb 8c                	jmp    309 <dosyscall>
+
+0000037d <pipe>:
+SYSCALL(pipe)
+ 37d:	b8 04 00 00 00       	mov    $0x4,%eax
+ 382:	eb 85                	jmp    309 <dosyscall>
+
+00000384 <read>:
+SYSCALL(read)
+ 384:	b8 05 00 00 00       	mov    $0x5,%eax
+ 389:	e9 7b ff ff ff       	jmp    309 <dosyscall>
+
+0000038e <write>:
+SYSCALL(write)
+ 38e:	b8 10 00 00 00       	mov    $0x10,%eax
+ 393:	e9 71 ff ff ff       	jmp    309 <dosyscall>
+
+00000398 <close>:
+SYSCALL(close)
+ 398:	b8 15 00 00 00       	mov    $0x15,%eax
+ 39d:	e9 67 ff ff ff       	jmp    309 <dosyscall>
+
+000003a2 <kill>:
+SYSCALL(kill)
+ 3a2:	b8 06 00 00 00       	mov    $0x6,%eax
+ 3a7:	e9 5d ff ff ff       	jmp    309 <dosyscall>
+
+000003ac <exec>:
+SYSCALL(exec)
+ 3ac:	b8 07 00 00 00       	mov    $0x7,%eax
+ 3b1:	e9 53 ff ff ff       	jmp    309 <dosyscall>
+
+000003b6 <open>:
+SYSCALL(open)
+ 3b6:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 3bb:	e9 49 ff ff ff       	jmp    309 <dosyscall>
+
+000003c0 <mknod>:
+SYSCALL(mknod)
+ 3c0:	b8 11 00 00 00       	mov    $0x11,%eax
+ 3c5:	e9 3f ff ff ff       	jmp    309 <dosyscall>
+
+000003ca <unlink>:
+SYSCALL(unlink)
+ 3ca:	b8 12 00 00 00       	mov    $0x12,%eax
+ 3cf:	e9 35 ff ff ff       	jmp    309 <dosyscall>
+
+000003d4 <fstat>:
+SYSCALL(fstat)
+ 3d4:	b8 08 00 00 00       	mov    $0x8,%eax
+ 3d9:	e9 2b ff ff ff       	jmp    309 <dosyscall>
+
+000003de <link>:
+SYSCALL(link)
+ 3de:	b8 13 00 00 00       	mov    $0x13,%eax
+ 3e3:	e9 21 ff ff ff       	jmp    309 <dosyscall>
+
+000003e8 <mkdir>:
+SYSCALL(mkdir)
+ 3e8:	b8 14 00 00 00       	mov    $0x14,%eax
+ 3ed:	e9 17 ff ff ff       	jmp    309 <dosyscall>
+
+000003f2 <chdir>:
+SYSCALL(chdir)
+ 3f2:	b8 09 00 00 00       	mov    $0x9,%eax
+ 3f7:	e9 0d ff ff ff       	jmp    309 <dosyscall>
+
+000003fc <dup>:
+SYSCALL(dup)
+ 3fc:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 401:	e9 03 ff ff ff       	jmp    309 <dosyscall>
+
+00000406 <getpid>:
+SYSCALL(getpid)
+ 406:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 40b:	e9 f9 fe ff ff       	jmp    309 <dosyscall>
+
+00000410 <sbrk>:
+SYSCALL(sbrk)
+ 410:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 415:	e9 ef fe ff ff       	jmp    309 <dosyscall>
+
+0000041a <sleep>:
+SYSCALL(sleep)
+ 41a:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 41f:	e9 e5 fe ff ff       	jmp    309 <dosyscall>
+
+00000424 <uptime>:
+SYSCALL(uptime)
+ 424:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 429:	e9 db fe ff ff       	jmp    309 <dosyscall>
+
+0000042e <date>:
+SYSCALL(date)
+ 42e:	b8 16 00 00 00       	mov    $0x16,%eax
+ 433:	e9 d1 fe ff ff       	jmp    309 <dosyscall>
+
+00000438 <dup2>:
+SYSCALL(dup2)
+ 438:	b8 17 00 00 00       	mov    $0x17,%eax
+ 43d:	e9 c7 fe ff ff       	jmp    309 <dosyscall>
+
+00000442 <uffd>:
+SYSCALL(uffd)
+ 442:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 447:	e9 bd fe ff ff       	jmp    309 <dosyscall>
+
+0000044c <uffdregister>:
+SYSCALL(uffdregister)
+ 44c:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 451:	e9 b3 fe ff ff       	jmp    309 <dosyscall>
+
+00000456 <uffdcopy>:
+SYSCALL(uffdcopy)
+ 456:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 45b:	e9 a9 fe ff ff       	jmp    309 <dosyscall>
+
+00000460 <getpriority>:
+SYSCALL(getpriority)
+ 460:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 465:	e9 9f fe ff ff       	jmp    309 <dosyscall>
+
+0000046a <setpriority>:
+SYSCALL(setpriority)
+ 46a:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 46f:	e9 95 fe ff ff       	jmp    309 <dosyscall>
+
+00000474 <setweight>:
+SYSCALL(setweight)
+ 474:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 479:	e9 8b fe ff ff       	jmp    309 <dosyscall>
+
+0000047e <setgroup>:
+SYSCALL(setgroup)
+ 47e:	b8 20 00 00 00       	mov    $0x20,%eax
+ 483:	e9 81 fe ff ff       	jmp    309 <dosyscall>
+
+00000488 <schedinfo>:
+SYSCALL(schedinfo)
+ 488:	b8 21 00 00 00       	mov    $0x21,%eax
+ 48d:	e9 77 fe ff ff       	jmp    309 <dosyscall>
+
+00000492 <nanosleep>:
+SYSCALL(nanosleep)
+ 492:	b8 22 00 00 00       	mov    $0x22,%eax
+ 497:	e9 6d fe ff ff       	jmp    309 <dosyscall>
+
+0000049c <clock_nanosleep>:
+SYSCALL(clock_nanosleep)
+ 49c:	b8 23 00 00 00       	mov    $0x23,%eax
+ 4a1:	e9 63 fe ff ff       	jmp    309 <dosyscall>
+
+000004a6 <clock_gettime>:
+SYSCALL(clock_gettime)
+ 4a6:	b8 24 00 00 00       	mov    $0x24,%eax
+ 4ab:	e9 59 fe ff ff       	jmp    309 <dosyscall>
+
+000004b0 <sched_setaffinity>:
+SYSCALL(sched_setaffinity)
+ 4b0:	b8 25 00 00 00       	mov    $0x25,%eax
+ 4b5:	e9 4f fe ff ff       	jmp    309 <dosyscall>
+
+000004ba <sched_getaffinity>:
+SYSCALL(sched_getaffinity)
+ 4ba:	b8 26 00 00 00       	mov    $0x26,%eax
+ 4bf:	e9 45 fe ff ff       	jmp    309 <dosyscall>
+
+000004c4 <irqaffinity>:
+SYSCALL(irqaffinity)
+ 4c4:	b8 27 00 00 00       	mov    $0x27,%eax
+ 4c9:	e9 3b fe ff ff       	jmp    309 <dosyscall>
+
+000004ce <getrusage>:
+SYSCALL(getrusage)
+ 4ce:	b8 28 00 00 00       	mov    $0x28,%eax
+ 4d3:	e9 31 fe ff ff       	jmp    309 <dosyscall>
+
+000004d8 <times>:
+SYSCALL(times)
+ 4d8:	b8 29 00 00 00       	mov    $0x29,%eax
+ 4dd:	e9 27 fe ff ff       	jmp    309 <dosyscall>
+
+000004e2 <schedlat>:
+SYSCALL(schedlat)
+ 4e2:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 4e7:	e9 1d fe ff ff       	jmp    309 <dosyscall>
+
+000004ec <sched_setscheduler>:
+SYSCALL(sched_setscheduler)
+ 4ec:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 4f1:	e9 13 fe ff ff       	jmp    309 <dosyscall>
+
+000004f6 <sched_getscheduler>:
+SYSCALL(sched_getscheduler)
+ 4f6:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 4fb:	e9 09 fe ff ff       	jmp    309 <dosyscall>
+
+00000500 <sched_getparam>:
+SYSCALL(sched_getparam)
+ 500:	b8 2d 00 00 00       	mov    $0x2d,%eax
+ 505:	e9 ff fd ff ff       	jmp    309 <dosyscall>
+
+0000050a <lockstat>:
+SYSCALL(lockstat)
+ 50a:	b8 2e 00 00 00       	mov    $0x2e,%eax
+ 50f:	e9 f5 fd ff ff       	jmp    309 <dosyscall>
+
+00000514 <ioring_setup>:
+SYSCALL(ioring_setup)
+ 514:	b8 2f 00 00 00       	mov    $0x2f,%eax
+ 519:	e9 eb fd ff ff       	jmp    309 <dosyscall>
+
+0000051e <ioring_enter>:
+SYSCALL(ioring_enter)
+ 51e:	b8 30 00 00 00       	mov    $0x30,%eax
+ 523:	e9 e1 fd ff ff       	jmp    309 <dosyscall>
+
+00000528 <readv>:
+SYSCALL(readv)
+ 528:	b8 31 00 00 00       	mov    $0x31,%eax
+ 52d:	e9 d7 fd ff ff       	jmp    309 <dosyscall>
+
+00000532 <writev>:
+SYSCALL(writev)
+ 532:	b8 32 00 00 00       	mov    $0x32,%eax
+ 537:	e9 cd fd ff ff       	jmp    309 <dosyscall>
+
+0000053c <pread>:
+SYSCALL(pread)
+ 53c:	b8 33 00 00 00       	mov    $0x33,%eax
+ 541:	e9 c3 fd ff ff       	jmp    309 <dosyscall>
+
+00000546 <pwrite>:
+SYSCALL(pwrite)
+ 546:	b8 34 00 00 00       	mov    $0x34,%eax
+ 54b:	e9 b9 fd ff ff       	jmp    309 <dosyscall>
+
+00000550 <sendfile>:
+SYSCALL(sendfile)
+ 550:	b8 35 00 00 00       	mov    $0x35,%eax
+ 555:	e9 af fd ff ff       	jmp    309 <dosyscall>
+
+0000055a <splice>:
+SYSCALL(splice)
+ 55a:	b8 36 00 00 00       	mov    $0x36,%eax
+ 55f:	e9 a5 fd ff ff       	jmp    309 <dosyscall>
+
+00000564 <sysstat>:
+SYSCALL(sysstat)
+ 564:	b8 37 00 00 00       	mov    $0x37,%eax
+ 569:	e9 9b fd ff ff       	jmp    309 <dosyscall>
+
+0000056e <strace>:
+SYSCALL(strace)
+ 56e:	b8 38 00 00 00       	mov    $0x38,%eax
+ 573:	e9 91 fd ff ff       	jmp    309 <dosyscall>
+
+00000578 <straceread>:
+SYSCALL(straceread)
+ 578:	b8 39 00 00 00       	mov    $0x39,%eax
+ 57d:	e9 87 fd ff ff       	jmp    309 <dosyscall>
+
+00000582 <alarm>:
+
+# alarm and rstoregs keep to int $T_SYSCALL: rstoregs restores
+# %ecx and %edx, which sysexit would clobber.
+.globl alarm
+    alarm:
+        pushl $rstoregs
+ 582:	68 92 05 00 00       	push   $0x592
+        movl $SYS_alarm, %eax
+ 587:	b8 18 00 00 00       	mov    $0x18,%eax
+        int $T_SYSCALL
+ 58c:	cd 40                	int    $0x40
+        add $0x04, %esp
+ 58e:	83 c4 04             	add    $0x4,%esp
+        ret
+ 591:	c3                   	ret
+
+00000592 <rstoregs>:
+
+.globl rstoregs
+    rstoregs:
+        movl $SYS_rstoregs, %eax
+ 592:	b8 19 00 00 00       	mov    $0x19,%eax
+        int $T_SYSCALL
+ 597:	cd 40                	int    $0x40
+
+00000599 <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 599:	55                   	push   %ebp
+ 59a:	89 e5                	mov    %esp,%ebp
+ 59c:	83 ec 18             	sub    $0x18,%esp
+ 59f:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 5a2:	88 45 f4             	mov    %al,-0xc(%ebp)
+    write(fd, &c, 1);
+ 5a5:	83 ec 04             	sub    $0x4,%esp
+ 5a8:	6a 01                	push   $0x1
+ 5aa:	8d 45 f4             	lea    -0xc(%ebp),%eax
+ 5ad:	50                   	push   %eax
+ 5ae:	ff 75 08             	push   0x8(%ebp)
+ 5b1:	e8 d8 fd ff ff       	call   38e <write>
+ 5b6:	83 c4 10             	add    $0x10,%esp
+}
+ 5b9:	90                   	nop
+ 5ba:	c9                   	leave
+ 5bb:	c3                   	ret
+
+000005bc <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 5bc:	55                   	push   %ebp
+ 5bd:	89 e5                	mov    %esp,%ebp
+ 5bf:	83 ec 28             	sub    $0x28,%esp
+    static char digits[] = "0123456789ABCDEF";
+    char buf[16];
+    int i, neg;
+    uint x;
+
+    neg = 0;
+ 5c2:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+    if(sgn && xx < 0){
+ 5c9:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+ 5cd:	74 17                	je     5e6 <printint+0x2a>
+ 5cf:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 5d3:	79 11                	jns    5e6 <printint+0x2a>
+        neg = 1;
+ 5d5:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+        x = -xx;
+ 5dc:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 5df:	f7 d8                	neg    %eax
+ 5e1:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 5e4:	eb 06                	jmp    5ec <printint+0x30>
+    } else {
+        x = xx;
+ 5e6:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 5e9:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    }
+
+    i = 0;
+ 5ec:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    do{
+        buf[i++] = digits[x % base];
+ 5f3:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 5f6:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 5f9:	ba 00 00 00 00       	mov    $0x0,%edx
+ 5fe:	f7 f1                	div    %ecx
+ 600:	89 d1                	mov    %edx,%ecx
+ 602:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 605:	8d 50 01             	lea    0x1(%eax),%edx
+ 608:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 60b:	0f b6 91 a0 0c 00 00 	movzbl 0xca0(%ecx),%edx
+ 612:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+    }while((x /= base) != 0);
+ 616:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 619:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 61c:	ba 00 00 00 00       	mov    $0x0,%edx
+ 621:	f7 f1                	div    %ecx
+ 623:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 626:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 62a:	75 c7                	jne    5f3 <printint+0x37>
+    if(neg)
+ 62c:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 630:	74 2d                	je     65f <printint+0xa3>
+        buf[i++] = '-';
+ 632:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 635:	8d 50 01             	lea    0x1(%eax),%edx
+ 638:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 63b:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+    while(--i >= 0)
+ 640:	eb 1d                	jmp    65f <printint+0xa3>
+        putc(fd, buf[i]);
+ 642:	8d 55 dc             	lea    -0x24(%ebp),%edx
+ 645:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 648:	01 d0                	add    %edx,%eax
+ 64a:	0f b6 00             	movzbl (%eax),%eax
+ 64d:	0f be c0             	movsbl %al,%eax
+ 650:	83 ec 08             	sub    $0x8,%esp
+ 653:	50                   	push   %eax
+ 654:	ff 75 08             	push   0x8(%ebp)
+ 657:	e8 3d ff ff ff       	call   599 <putc>
+ 65c:	83 c4 10             	add    $0x10,%esp
+    while(--i >= 0)
+ 65f:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+ 663:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 667:	79 d9                	jns    642 <printint+0x86>
+}
+ 669:	90                   	nop
+ 66a:	90                   	nop
+ 66b:	c9                   	leave
+ 66c:	c3                   	ret
+
+0000066d <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 66d:	55                   	push   %ebp
+ 66e:	89 e5                	mov    %esp,%ebp
+ 670:	83 ec 28             	sub    $0x28,%esp
+    char *s;
+    int c, i, state;
+    uint *ap;
+
+    state = 0;
+ 673:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+    ap = (uint*)(void*)&fmt + 1;
+ 67a:	8d 45 0c             	lea    0xc(%ebp),%eax
+ 67d:	83 c0 04             	add    $0x4,%eax
+ 680:	89 45 e8             	mov    %eax,-0x18(%ebp)
+    for(i = 0; fmt[i]; i++){
+ 683:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 68a:	e9 59 01 00 00       	jmp    7e8 <printf+0x17b>
+        c = fmt[i] & 0xff;
+ 68f:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 692:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 695:	01 d0                	add    %edx,%eax
+ 697:	0f b6 00             	movzbl (%eax),%eax
+ 69a:	0f be c0             	movsbl %al,%eax
+ 69d:	25 ff 00 00 00       	and    $0xff,%eax
+ 6a2:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        if(state == 0){
+ 6a5:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 6a9:	75 2c                	jne    6d7 <printf+0x6a>
+            if(c == '%'){
+ 6ab:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 6af:	75 0c                	jne    6bd <printf+0x50>
+                state = '%';
+ 6b1:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+ 6b8:	e9 27 01 00 00       	jmp    7e4 <printf+0x177>
+            } else {
+                putc(fd, c);
+ 6bd:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 6c0:	0f be c0             	movsbl %al,%eax
+ 6c3:	83 ec 08             	sub    $0x8,%esp
+ 6c6:	50                   	push   %eax
+ 6c7:	ff 75 08             	push   0x8(%ebp)
+ 6ca:	e8 ca fe ff ff       	call   599 <putc>
+ 6cf:	83 c4 10             	add    $0x10,%esp
+ 6d2:	e9 0d 01 00 00       	jmp    7e4 <printf+0x177>
+            }
+        } else if(state == '%'){
+ 6d7:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+ 6db:	0f 85 03 01 00 00    	jne    7e4 <printf+0x177>
+            if(c == 'd'){
+ 6e1:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+ 6e5:	75 1e                	jne    705 <printf+0x98>
+                printint(fd, *ap, 10, 1);
+ 6e7:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 6ea:	8b 00                	mov    (%eax),%eax
+ 6ec:	6a 01                	push   $0x1
+ 6ee:	6a 0a                	push   $0xa
+ 6f0:	50                   	push   %eax
+ 6f1:	ff 75 08             	push   0x8(%ebp)
+ 6f4:	e8 c3 fe ff ff       	call   5bc <printint>
+ 6f9:	83 c4 10             	add    $0x10,%esp
+                ap++;
+ 6fc:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 700:	e9 d8 00 00 00       	jmp    7dd <printf+0x170>
+            } else if(c == 'x' || c == 'p'){
+ 705:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+ 709:	74 06                	je     711 <printf+0xa4>
+ 70b:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+ 70f:	75 1e                	jne    72f <printf+0xc2>
+                printint(fd, *ap, 16, 0);
+ 711:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 714:	8b 00                	mov    (%eax),%eax
+ 716:	6a 00                	push   $0x0
+ 718:	6a 10                	push   $0x10
+ 71a:	50                   	push   %eax
+ 71b:	ff 75 08             	push   0x8(%ebp)
+ 71e:	e8 99 fe ff ff       	call   5bc <printint>
+ 723:	83 c4 10             	add    $0x10,%esp
+                ap++;
+ 726:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 72a:	e9 ae 00 00 00       	jmp    7dd <printf+0x170>
+            } else if(c == 's'){
+ 72f:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+ 733:	75 43                	jne    778 <printf+0x10b>
+                s = (char*)*ap;
+ 735:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 738:	8b 00                	mov    (%eax),%eax
+ 73a:	89 45 f4             	mov    %eax,-0xc(%ebp)
+                ap++;
+ 73d:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+                if(s == 0)
+ 741:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 745:	75 25                	jne    76c <printf+0xff>
+                    s = "(null)";
+ 747:	c7 45 f4 2d 0a 00 00 	movl   $0xa2d,-0xc(%ebp)
+                while(*s != 0){
+ 74e:	eb 1c                	jmp    76c <printf+0xff>
+                    putc(fd, *s);
+ 750:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 753:	0f b6 00             	movzbl (%eax),%eax
+ 756:	0f be c0             	movsbl %al,%eax
+ 759:	83 ec 08             	sub    $0x8,%esp
+ 75c:	50                   	push   %eax
+ 75d:	ff 75 08             	push   0x8(%ebp)
+ 760:	e8 34 fe ff ff       	call   599 <putc>
+ 765:	83 c4 10             	add    $0x10,%esp
+                    s++;
+ 768:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+                while(*s != 0){
+ 76c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 76f:	0f b6 00             	movzbl (%eax),%eax
+ 772:	84 c0                	test   %al,%al
+ 774:	75 da                	jne    750 <printf+0xe3>
+ 776:	eb 65                	jmp    7dd <printf+0x170>
+                }
+            } else if(c == 'c'){
+ 778:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+ 77c:	75 1d                	jne    79b <printf+0x12e>
+                putc(fd, *ap);
+ 77e:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 781:	8b 00                	mov    (%eax),%eax
+ 783:	0f be c0             	movsbl %al,%eax
+ 786:	83 ec 08             	sub    $0x8,%esp
+ 789:	50                   	push   %eax
+ 78a:	ff 75 08             	push   0x8(%ebp)
+ 78d:	e8 07 fe ff ff       	call   599 <putc>
+ 792:	83 c4 10             	add    $0x10,%esp
+                ap++;
+ 795:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 799:	eb 42                	jmp    7dd <printf+0x170>
+            } else if(c == '%'){
+ 79b:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 79f:	75 17                	jne    7b8 <printf+0x14b>
+                putc(fd, c);
+ 7a1:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 7a4:	0f be c0             	movsbl %al,%eax
+ 7a7:	83 ec 08             	sub    $0x8,%esp
+ 7aa:	50                   	push   %eax
+ 7ab:	ff 75 08             	push   0x8(%ebp)
+ 7ae:	e8 e6 fd ff ff       	call   599 <putc>
+ 7b3:	83 c4 10             	add    $0x10,%esp
+ 7b6:	eb 25                	jmp    7dd <printf+0x170>
+            } else {
+                // Unknown % sequence.    Print it to draw attention.
+                putc(fd, '%');
+ 7b8:	83 ec 08             	sub    $0x8,%esp
+ 7bb:	6a 25                	push   $0x25
+ 7bd:	ff 75 08             	push   0x8(%ebp)
+ 7c0:	e8 d4 fd ff ff       	call   599 <putc>
+ 7c5:	83 c4 10             	add    $0x10,%esp
+                putc(fd, c);
+ 7c8:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 7cb:	0f be c0             	movsbl %al,%eax
+ 7ce:	83 ec 08             	sub    $0x8,%esp
+ 7d1:	50                   	push   %eax
+ 7d2:	ff 75 08             	push   0x8(%ebp)
+ 7d5:	e8 bf fd ff ff       	call   599 <putc>
+ 7da:	83 c4 10             	add    $0x10,%esp
+            }
+            state = 0;
+ 7dd:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+    for(i = 0; fmt[i]; i++){
+ 7e4:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ 7e8:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 7eb:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 7ee:	01 d0                	add    %edx,%eax
+ 7f0:	0f b6 00             	movzbl (%eax),%eax
+ 7f3:	84 c0                	test   %al,%al
+ 7f5:	0f 85 94 fe ff ff    	jne    68f <printf+0x22>
+        }
+    }
+}
+ 7fb:	90                   	nop
+ 7fc:	90                   	nop
+ 7fd:	c9                   	leave
+ 7fe:	c3                   	ret
+
+000007ff <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 7ff:	55                   	push   %ebp
+ 800:	89 e5                	mov    %esp,%ebp
+ 802:	83 ec 10             	sub    $0x10,%esp
+    Header *bp, *p;
+
+    bp = (Header*)ap - 1;
+ 805:	8b 45 08             	mov    0x8(%ebp),%eax
+ 808:	83 e8 08             	sub    $0x8,%eax
+ 80b:	89 45 f8             	mov    %eax,-0x8(%ebp)
+    for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 80e:	a1 bc 0c 00 00       	mov    0xcbc,%eax
+ 813:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 816:	eb 24                	jmp    83c <free+0x3d>
+        if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 818:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 81b:	8b 00                	mov    (%eax),%eax
+ 81d:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 820:	72 12                	jb     834 <free+0x35>
+ 822:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 825:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 828:	72 24                	jb     84e <free+0x4f>
+ 82a:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 82d:	8b 00                	mov    (%eax),%eax
+ 82f:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 832:	72 1a                	jb     84e <free+0x4f>
+    for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 834:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 837:	8b 00                	mov    (%eax),%eax
+ 839:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 83c:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 83f:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 842:	73 d4                	jae    818 <free+0x19>
+ 844:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 847:	8b 00                	mov    (%eax),%eax
+ 849:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 84c:	73 ca                	jae    818 <free+0x19>
+            break;
+    if(bp + bp->s.size == p->s.ptr){
+ 84e:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 851:	8b 40 04             	mov    0x4(%eax),%eax
+ 854:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 85b:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 85e:	01 c2                	add    %eax,%edx
+ 860:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 863:	8b 00                	mov    (%eax),%eax
+ 865:	39 c2                	cmp    %eax,%edx
+ 867:	75 24                	jne    88d <free+0x8e>
+        bp->s.size += p->s.ptr->s.size;
+ 869:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 86c:	8b 50 04             	mov    0x4(%eax),%edx
+ 86f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 872:	8b 00                	mov    (%eax),%eax
+ 874:	8b 40 04             	mov    0x4(%eax),%eax
+ 877:	01 c2                	add    %eax,%edx
+ 879:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 87c:	89 50 04             	mov    %edx,0x4(%eax)
+        bp->s.ptr = p->s.ptr->s.ptr;
+ 87f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 882:	8b 00                	mov    (%eax),%eax
+ 884:	8b 10                	mov    (%eax),%edx
+ 886:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 889:	89 10                	mov    %edx,(%eax)
+ 88b:	eb 0a                	jmp    897 <free+0x98>
+    } else
+        bp->s.ptr = p->s.ptr;
+ 88d:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 890:	8b 10                	mov    (%eax),%edx
+ 892:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 895:	89 10                	mov    %edx,(%eax)
+    if(p + p->s.size == bp){
+ 897:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 89a:	8b 40 04             	mov    0x4(%eax),%eax
+ 89d:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 8a4:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 8a7:	01 d0                	add    %edx,%eax
+ 8a9:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 8ac:	75 20                	jne    8ce <free+0xcf>
+        p->s.size += bp->s.size;
+ 8ae:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 8b1:	8b 50 04             	mov    0x4(%eax),%edx
+ 8b4:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 8b7:	8b 40 04             	mov    0x4(%eax),%eax
+ 8ba:	01 c2                	add    %eax,%edx
+ 8bc:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 8bf:	89 50 04             	mov    %edx,0x4(%eax)
+        p->s.ptr = bp->s.ptr;
+ 8c2:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 8c5:	8b 10                	mov    (%eax),%edx
+ 8c7:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 8ca:	89 10                	mov    %edx,(%eax)
+ 8cc:	eb 08                	jmp    8d6 <free+0xd7>
+    } else
+        p->s.ptr = bp;
+ 8ce:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 8d1:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 8d4:	89 10                	mov    %edx,(%eax)
+    freep = p;
+ 8d6:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 8d9:	a3 bc 0c 00 00       	mov    %eax,0xcbc
+}
+ 8de:	90                   	nop
+ 8df:	c9                   	leave
+ 8e0:	c3                   	ret
+
+000008e1 <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+ 8e1:	55                   	push   %ebp
+ 8e2:	89 e5                	mov    %esp,%ebp
+ 8e4:	83 ec 18             	sub    $0x18,%esp
+    char *p;
+    Header *hp;
+
+    if(nu < 4096)
+ 8e7:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+ 8ee:	77 07                	ja     8f7 <morecore+0x16>
+        nu = 4096;
+ 8f0:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+    p = sbrk(nu * sizeof(Header));
+ 8f7:	8b 45 08             	mov    0x8(%ebp),%eax
+ 8fa:	c1 e0 03             	shl    $0x3,%eax
+ 8fd:	83 ec 0c             	sub    $0xc,%esp
+ 900:	50                   	push   %eax
+ 901:	e8 0a fb ff ff       	call   410 <sbrk>
+ 906:	83 c4 10             	add    $0x10,%esp
+ 909:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p == (char*)-1)
+ 90c:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+ 910:	75 07                	jne    919 <morecore+0x38>
+        return 0;
+ 912:	b8 00 00 00 00       	mov    $0x0,%eax
+ 917:	eb 26                	jmp    93f <morecore+0x5e>
+    hp = (Header*)p;
+ 919:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 91c:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    hp->s.size = nu;
+ 91f:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 922:	8b 55 08             	mov    0x8(%ebp),%edx
+ 925:	89 50 04             	mov    %edx,0x4(%eax)
+    free((void*)(hp + 1));
+ 928:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 92b:	83 c0 08             	add    $0x8,%eax
+ 92e:	83 ec 0c             	sub    $0xc,%esp
+ 931:	50                   	push   %eax
+ 932:	e8 c8 fe ff ff       	call   7ff <free>
+ 937:	83 c4 10             	add    $0x10,%esp
+    return freep;
+ 93a:	a1 bc 0c 00 00       	mov    0xcbc,%eax
+}
+ 93f:	c9                   	leave
+ 940:	c3                   	ret
+
+00000941 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ 941:	55                   	push   %ebp
+ 942:	89 e5                	mov    %esp,%ebp
+ 944:	83 ec 18             	sub    $0x18,%esp
+    Header *p, *prevp;
+    uint nunits;
+
+    nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 947:	8b 45 08             	mov    0x8(%ebp),%eax
+ 94a:	83 c0 07             	add    $0x7,%eax
+ 94d:	c1 e8 03             	shr    $0x3,%eax
+ 950:	83 c0 01             	add    $0x1,%eax
+ 953:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    if((prevp = freep) == 0){
+ 956:	a1 bc 0c 00 00       	mov    0xcbc,%eax
+ 95b:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ 95e:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 962:	75 23                	jne    987 <malloc+0x46>
+        base.s.ptr = freep = prevp = &base;
+ 964:	c7 45 f0 b4 0c 00 00 	movl   $0xcb4,-0x10(%ebp)
+ 96b:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 96e:	a3 bc 0c 00 00       	mov    %eax,0xcbc
+ 973:	a1 bc 0c 00 00       	mov    0xcbc,%eax
+ 978:	a3 b4 0c 00 00       	mov    %eax,0xcb4
+        base.s.size = 0;
+ 97d:	c7 05 b8 0c 00 00 00 	movl   $0x0,0xcb8
+ 984:	00 00 00 
+    }
+    for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 987:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 98a:	8b 00                	mov    (%eax),%eax
+ 98c:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        if(p->s.size >= nunits){
+ 98f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 992:	8b 40 04             	mov    0x4(%eax),%eax
+ 995:	3b 45 ec             	cmp    -0x14(%ebp),%eax
+ 998:	72 4d                	jb     9e7 <malloc+0xa6>
+            if(p->s.size == nunits)
+ 99a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 99d:	8b 40 04             	mov    0x4(%eax),%eax
+ 9a0:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+ 9a3:	75 0c                	jne    9b1 <malloc+0x70>
+                prevp->s.ptr = p->s.ptr;
+ 9a5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 9a8:	8b 10                	mov    (%eax),%edx
+ 9aa:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 9ad:	89 10                	mov    %edx,(%eax)
+ 9af:	eb 26                	jmp    9d7 <malloc+0x96>
+            else {
+                p->s.size -= nunits;
+ 9b1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 9b4:	8b 40 04             	mov    0x4(%eax),%eax
+ 9b7:	2b 45 ec             	sub    -0x14(%ebp),%eax
+ 9ba:	89 c2                	mov    %eax,%edx
+ 9bc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 9bf:	89 50 04             	mov    %edx,0x4(%eax)
+                p += p->s.size;
+ 9c2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 9c5:	8b 40 04             	mov    0x4(%eax),%eax
+ 9c8:	c1 e0 03             	shl    $0x3,%eax
+ 9cb:	01 45 f4             	add    %eax,-0xc(%ebp)
+                p->s.size = nunits;
+ 9ce:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 9d1:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 9d4:	89 50 04             	mov    %edx,0x4(%eax)
+            }
+            freep = prevp;
+ 9d7:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 9da:	a3 bc 0c 00 00       	mov    %eax,0xcbc
+            return (void*)(p + 1);
+ 9df:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 9e2:	83 c0 08             	add    $0x8,%eax
+ 9e5:	eb 3b                	jmp    a22 <malloc+0xe1>
+        }
+        if(p == freep)
+ 9e7:	a1 bc 0c 00 00       	mov    0xcbc,%eax
+ 9ec:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ 9ef:	75 1e                	jne    a0f <malloc+0xce>
+            if((p = morecore(nunits)) == 0)
+ 9f1:	83 ec 0c             	sub    $0xc,%esp
+ 9f4:	ff 75 ec             	push   -0x14(%ebp)
+ 9f7:	e8 e5 fe ff ff       	call   8e1 <morecore>
+ 9fc:	83 c4 10             	add    $0x10,%esp
+ 9ff:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ a02:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ a06:	75 07                	jne    a0f <malloc+0xce>
+                return 0;
+ a08:	b8 00 00 00 00       	mov    $0x0,%eax
+ a0d:	eb 13                	jmp    a22 <malloc+0xe1>
+    for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ a0f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a12:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ a15:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a18:	8b 00                	mov    (%eax),%eax
+ a1a:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        if(p->s.size >= nunits){
+ a1d:	e9 6d ff ff ff       	jmp    98f <malloc+0x4e>
+    }
+}
+ a22:	c9                   	leave
+ a23:	c3                   	ret
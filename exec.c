@@ -2,10 +2,12 @@
 #include "param.h"
 #include "memlayout.h"
 #include "mmu.h"
+#include "spinlock.h"
 #include "proc.h"
 #include "defs.h"
 #include "x86.h"
 #include "elf.h"
+#include "vdso.h"
 
 int
 exec(char *path, char **argv)
@@ -48,7 +50,7 @@ exec(char *path, char **argv)
         goto bad;
     if(ph.memsz < ph.filesz)
         goto bad;
-    if(ph.vaddr + ph.memsz < ph.vaddr)
+    if(ph.vaddr + ph.memsz < ph.vaddr || ph.vaddr + ph.memsz > VDSOADDR)
         goto bad;
     if(allocuvm(pgdir, text_data.sz, ph.vaddr+ph.memsz) < 0){
         goto bad;    
@@ -69,6 +71,8 @@ exec(char *path, char **argv)
     stack.sz = PGSIZE;  
     if(allocuvm(pgdir, stack.start, stack.start + stack.sz) < 0)
         goto bad;
+    if(vdsomap(pgdir, curproc->pid) < 0)
+        goto bad;
     sp = stack.start + stack.sz;
 
     heap.start = sp;    
@@ -100,6 +104,8 @@ exec(char *path, char **argv)
     safestrcpy(curproc->name, last, sizeof(curproc->name));
 
     // Commit to the user image.
+    if(curproc->uffd)
+        uffddetach(curproc);
     oldpgdir = curproc->pgdir;
     curproc->pgdir = pgdir;
     curproc->tf->eip = elf.entry;    // main
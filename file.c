@@ -5,12 +5,20 @@
 #include "types.h"
 #include "defs.h"
 #include "param.h"
+#include "stat.h"
+#include "mmu.h"
 #include "fs.h"
 #include "spinlock.h"
 #include "sleeplock.h"
+#include "rwlock.h"
 #include "file.h"
+#include "uio.h"
+
+// Device switch, read on every device read and write and
+// written only as drivers register.
+static struct devsw devsw[NDEV];
+static struct rwlock devswlock;
 
-struct devsw devsw[NDEV];
 struct {
     struct spinlock lock;
     struct file file[NFILE];
@@ -20,6 +28,33 @@ void
 fileinit(void)
 {
     initlock(&ftable.lock, "ftable", 1);
+    initrwlock(&devswlock, "devsw", 0);
+}
+
+// Install the read and write functions of device major.
+void
+devswregister(int major, int (*read)(struct inode*, char*, int),
+              int (*write)(struct inode*, char*, int))
+{
+    if(major < 0 || major >= NDEV)
+        panic("devswregister");
+    acquirewrite(&devswlock);
+    devsw[major].read = read;
+    devsw[major].write = write;
+    releasewrite(&devswlock);
+}
+
+// Copy the functions of device major to d.
+// Return -1 if there is no such device.
+int
+getdevsw(int major, struct devsw *d)
+{
+    if(major < 0 || major >= NDEV)
+        return -1;
+    acquireread(&devswlock);
+    *d = devsw[major];
+    releaseread(&devswlock);
+    return 0;
 }
 
 // Allocate a file structure.
@@ -72,6 +107,10 @@ fileclose(struct file *f)
 
     if(ff.type == FD_PIPE)
         pipeclose(ff.pipe, ff.writable);
+    else if(ff.type == FD_UFFD)
+        uffdclose(ff.uffd);
+    else if(ff.type == FD_IORING)
+        ioringclose(ff.ioctx);
     else if(ff.type == FD_INODE){
         begin_op();
         iput(ff.ip);
@@ -92,66 +131,245 @@ filestat(struct file *f, struct stat *st)
     return -1;
 }
 
-// Read from file f.
+// Read from inode file f at *off into the buffers in iov, in
+// order, advancing *off.    Stops at the first buffer that is not
+// filled.    Return the number of bytes read, or -1.
+static int
+readinode(struct file *f, struct iovec *iov, int iovcnt, uint *off)
+{
+    int i, r, tot;
+
+    tot = 0;
+    ilock(f->ip);
+    for(i = 0; i < iovcnt; i++){
+        if((r = readi(f->ip, iov[i].iov_base, *off, iov[i].iov_len)) < 0){
+            if(tot == 0)
+                tot = -1;
+            break;
+        }
+        *off += r;
+        tot += r;
+        if(r < iov[i].iov_len)
+            break;
+    }
+    iunlock(f->ip);
+    return tot;
+}
+
+// Read from file f into the buffers in iov.
 int
-fileread(struct file *f, char *addr, int n)
+filereadv(struct file *f, struct iovec *iov, int iovcnt)
 {
-    int r;
+    int i;
 
     if(f->readable == 0)
         return -1;
+    if(f->type == FD_INODE)
+        return readinode(f, iov, iovcnt, &f->off);
+    // A pipe read may block, so only read once, into the first
+    // buffer with room; the caller sees a short read.    With no
+    // room at all there is nothing to wait for.
+    for(i = 0; i < iovcnt && iov[i].iov_len == 0; i++)
+        ;
+    if(i == iovcnt)
+        return 0;
     if(f->type == FD_PIPE)
-        return piperead(f->pipe, addr, n);
-    if(f->type == FD_INODE){
+        return piperead(f->pipe, iov[i].iov_base, iov[i].iov_len);
+    if(f->type == FD_UFFD)
+        return uffdread(f->uffd, iov[i].iov_base, iov[i].iov_len);
+    panic("fileread");
+}
+
+// Read from file f.
+int
+fileread(struct file *f, char *addr, int n)
+{
+    struct iovec iov;
+
+    iov.iov_base = addr;
+    iov.iov_len = n;
+    return filereadv(f, &iov, 1);
+}
+
+// Read from file f at offset off, leaving f->off alone.
+int
+filepread(struct file *f, char *addr, int n, uint off)
+{
+    struct iovec iov;
+
+    if(f->readable == 0 || f->type != FD_INODE)
+        return -1;
+    iov.iov_base = addr;
+    iov.iov_len = n;
+    return readinode(f, &iov, 1, &off);
+}
+
+// Write the buffers in iov, in order, to inode file f at *off,
+// advancing *off.    Return the number of bytes written, or -1.
+static int
+writeinode(struct file *f, struct iovec *iov, int iovcnt, uint *off)
+{
+    // write a few blocks at a time to avoid exceeding
+    // the maximum log transaction size, including
+    // i-node, indirect block, allocation blocks,
+    // and 2 blocks of slop for non-aligned writes.
+    // this really belongs lower down, since writei()
+    // might be writing a device like the console.
+    // Consecutive buffers go to consecutive offsets, so as many
+    // of them as fit in max bytes can share a transaction.
+    int max = ((MAXOPBLOCKS-1-1-2) / 2) * 512;
+    int i = 0, done = 0, tot = 0;
+    int n1, room, r = 0;
+
+    while(i < iovcnt){
+        begin_op();
         ilock(f->ip);
-        if((r = readi(f->ip, addr, f->off, n)) > 0)
-            f->off += r;
+        for(room = max; i < iovcnt && room > 0; ){
+            n1 = iov[i].iov_len - done;
+            if(n1 > room)
+                n1 = room;
+            if(n1 > 0){
+                if((r = writei(f->ip, (char*)iov[i].iov_base + done, *off, n1)) < 0)
+                    break;
+                if(r != n1)
+                    panic("short filewrite");
+                *off += r;
+                done += r;
+                tot += r;
+                room -= r;
+            }
+            if(done == iov[i].iov_len){
+                i++;
+                done = 0;
+            }
+        }
         iunlock(f->ip);
-        return r;
+        end_op();
+
+        if(r < 0)
+            return -1;
     }
-    panic("fileread");
+    return tot;
 }
 
 //PAGEBREAK!
+// Write the buffers in iov to file f.
+int
+filewritev(struct file *f, struct iovec *iov, int iovcnt)
+{
+    int i, r, tot;
+
+    if(f->writable == 0)
+        return -1;
+    if(f->type == FD_INODE)
+        return writeinode(f, iov, iovcnt, &f->off);
+    if(f->type == FD_PIPE){
+        tot = 0;
+        for(i = 0; i < iovcnt; i++){
+            if((r = pipewrite(f->pipe, iov[i].iov_base, iov[i].iov_len)) < 0)
+                return tot > 0 ? tot : -1;
+            tot += r;
+        }
+        return tot;
+    }
+    panic("filewrite");
+}
+
 // Write to file f.
 int
 filewrite(struct file *f, char *addr, int n)
 {
-    int r;
+    struct iovec iov;
 
-    if(f->writable == 0)
+    iov.iov_base = addr;
+    iov.iov_len = n;
+    return filewritev(f, &iov, 1);
+}
+
+// Write to file f at offset off, leaving f->off alone.
+int
+filepwrite(struct file *f, char *addr, int n, uint off)
+{
+    struct iovec iov;
+
+    if(f->writable == 0 || f->type != FD_INODE)
         return -1;
-    if(f->type == FD_PIPE)
-        return pipewrite(f->pipe, addr, n);
-    if(f->type == FD_INODE){
-        // write a few blocks at a time to avoid exceeding
-        // the maximum log transaction size, including
-        // i-node, indirect block, allocation blocks,
-        // and 2 blocks of slop for non-aligned writes.
-        // this really belongs lower down, since writei()
-        // might be writing a device like the console.
-        int max = ((MAXOPBLOCKS-1-1-2) / 2) * 512;
-        int i = 0;
-        while(i < n){
-            int n1 = n - i;
-            if(n1 > max)
-                n1 = max;
-
-            begin_op();
-            ilock(f->ip);
-            if ((r = writei(f->ip, addr + i, f->off, n1)) > 0)
-                f->off += r;
-            iunlock(f->ip);
-            end_op();
+    iov.iov_base = addr;
+    iov.iov_len = n;
+    return writeinode(f, &iov, 1, &off);
+}
 
+//PAGEBREAK!
+// Move up to n bytes from in to out without passing them through
+// user space, for sendfile() and splice().    in and out are each
+// an inode or a pipe; an inode is read or written at *inoff or
+// *outoff, which advance.    A file going into a pipe is copied
+// straight from the buffer cache; anything else bounces through
+// one kernel page.    Reading a pipe stops after the first read,
+// which may be short, as it would be for read().
+// Return the number of bytes moved, or -1.
+int
+filesplice(struct file *in, uint *inoff, struct file *out, uint *outoff, int n)
+{
+    struct iovec iov;
+    char *buf;
+    int r, w, tot;
+
+    if(in->readable == 0 || out->writable == 0 || n < 0 ||
+       (in->type != FD_INODE && in->type != FD_PIPE) ||
+       (out->type != FD_INODE && out->type != FD_PIPE))
+        return -1;
+
+    tot = 0;
+    if(in->type == FD_INODE && in->ip->type != T_DEV && out->type == FD_PIPE){
+        // Wait for the pipe with no locks held, then move what
+        // fits under the inode lock.
+        while(tot < n){
+            if(pipewait(out->pipe) < 0)
+                break;
+            ilock(in->ip);
+            if(*inoff >= in->ip->size){
+                iunlock(in->ip);
+                return tot;
+            }
+            if((r = readipipe(in->ip, out->pipe, *inoff, n - tot)) > 0)
+                *inoff += r;
+            iunlock(in->ip);
             if(r < 0)
                 break;
-            if(r != n1)
-                panic("short filewrite");
-            i += r;
+            tot += r;
         }
-        return i == n ? n : -1;
+        return tot > 0 || n == 0 ? tot : -1;
     }
-    panic("filewrite");
-}
 
+    if((buf = kalloc()) == 0)
+        return -1;
+    while(tot < n){
+        iov.iov_base = buf;
+        iov.iov_len = n - tot < PGSIZE ? n - tot : PGSIZE;
+        if(in->type == FD_INODE)
+            r = readinode(in, &iov, 1, inoff);
+        else
+            r = piperead(in->pipe, buf, iov.iov_len);
+        if(r <= 0){
+            if(r < 0 && tot == 0)
+                tot = -1;
+            break;
+        }
+        iov.iov_len = r;
+        if(out->type == FD_INODE)
+            w = writeinode(out, &iov, 1, outoff);
+        else
+            w = pipewrite(out->pipe, buf, r);
+        if(w < 0){
+            if(tot == 0)
+                tot = -1;
+            break;
+        }
+        tot += r;
+        if(in->type == FD_PIPE)
+            break;
+    }
+    kfree(buf);
+    return tot;
+}
@@ -1,9 +1,11 @@
 struct file {
-    enum { FD_NONE, FD_PIPE, FD_INODE } type;
+    enum { FD_NONE, FD_PIPE, FD_INODE, FD_UFFD, FD_IORING } type;
     int ref; // reference count
     char readable;
     char writable;
     struct pipe *pipe;
+    struct uffd *uffd;
+    struct ioctx *ioctx;
     struct inode *ip;
     uint off;
 };
@@ -32,6 +34,5 @@ struct devsw {
     int (*write)(struct inode*, char*, int);
 };
 
-extern struct devsw devsw[];
 
 #define CONSOLE 1
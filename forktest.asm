@@ -0,0 +1,926 @@
+
+_forktest:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <printf>:
+
+#define N    1000
+
+void
+printf(int fd, const char *s, ...)
+{
+   0:	55                   	push   %ebp
+   1:	89 e5                	mov    %esp,%ebp
+   3:	83 ec 08             	sub    $0x8,%esp
+    write(fd, s, strlen(s));
+   6:	83 ec 0c             	sub    $0xc,%esp
+   9:	ff 75 0c             	push   0xc(%ebp)
+   c:	e8 8c 01 00 00       	call   19d <strlen>
+  11:	83 c4 10             	add    $0x10,%esp
+  14:	83 ec 04             	sub    $0x4,%esp
+  17:	50                   	push   %eax
+  18:	ff 75 0c             	push   0xc(%ebp)
+  1b:	ff 75 08             	push   0x8(%ebp)
+  1e:	e8 0e 04 00 00       	call   431 <write>
+  23:	83 c4 10             	add    $0x10,%esp
+}
+  26:	90                   	nop
+  27:	c9                   	leave
+  28:	c3                   	ret
+
+00000029 <forktest>:
+
+void
+forktest(void)
+{
+  29:	55                   	push   %ebp
+  2a:	89 e5                	mov    %esp,%ebp
+  2c:	83 ec 18             	sub    $0x18,%esp
+    int n, pid;
+
+    printf(1, "fork test\n");
+  2f:	83 ec 08             	sub    $0x8,%esp
+  32:	68 3c 06 00 00       	push   $0x63c
+  37:	6a 01                	push   $0x1
+  39:	e8 c2 ff ff ff       	call   0 <printf>
+  3e:	83 c4 10             	add    $0x10,%esp
+
+    for(n=0; n<N; n++){
+  41:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  48:	eb 1d                	jmp    67 <forktest+0x3e>
+        pid = fork();
+  4a:	e8 bc 03 00 00       	call   40b <fork>
+  4f:	89 45 f0             	mov    %eax,-0x10(%ebp)
+        if(pid < 0)
+  52:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+  56:	78 1a                	js     72 <forktest+0x49>
+            break;
+        if(pid == 0)
+  58:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+  5c:	75 05                	jne    63 <forktest+0x3a>
+            exit();
+  5e:	e8 af 03 00 00       	call   412 <exit>
+    for(n=0; n<N; n++){
+  63:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+  67:	81 7d f4 e7 03 00 00 	cmpl   $0x3e7,-0xc(%ebp)
+  6e:	7e da                	jle    4a <forktest+0x21>
+  70:	eb 01                	jmp    73 <forktest+0x4a>
+            break;
+  72:	90                   	nop
+    }
+
+    if(n == N){
+  73:	81 7d f4 e8 03 00 00 	cmpl   $0x3e8,-0xc(%ebp)
+  7a:	75 40                	jne    bc <forktest+0x93>
+        printf(1, "fork claimed to work N times!\n", N);
+  7c:	83 ec 04             	sub    $0x4,%esp
+  7f:	68 e8 03 00 00       	push   $0x3e8
+  84:	68 48 06 00 00       	push   $0x648
+  89:	6a 01                	push   $0x1
+  8b:	e8 70 ff ff ff       	call   0 <printf>
+  90:	83 c4 10             	add    $0x10,%esp
+        exit();
+  93:	e8 7a 03 00 00       	call   412 <exit>
+    }
+
+    for(; n > 0; n--){
+        if(wait() < 0){
+  98:	e8 7c 03 00 00       	call   419 <wait>
+  9d:	85 c0                	test   %eax,%eax
+  9f:	79 17                	jns    b8 <forktest+0x8f>
+            printf(1, "wait stopped early\n");
+  a1:	83 ec 08             	sub    $0x8,%esp
+  a4:	68 67 06 00 00       	push   $0x667
+  a9:	6a 01                	push   $0x1
+  ab:	e8 50 ff ff ff       	call   0 <printf>
+  b0:	83 c4 10             	add    $0x10,%esp
+            exit();
+  b3:	e8 5a 03 00 00       	call   412 <exit>
+    for(; n > 0; n--){
+  b8:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+  bc:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+  c0:	7f d6                	jg     98 <forktest+0x6f>
+        }
+    }
+
+    if(wait() != -1){
+  c2:	e8 52 03 00 00       	call   419 <wait>
+  c7:	83 f8 ff             	cmp    $0xffffffff,%eax
+  ca:	74 17                	je     e3 <forktest+0xba>
+        printf(1, "wait got too many\n");
+  cc:	83 ec 08             	sub    $0x8,%esp
+  cf:	68 7b 06 00 00       	push   $0x67b
+  d4:	6a 01                	push   $0x1
+  d6:	e8 25 ff ff ff       	call   0 <printf>
+  db:	83 c4 10             	add    $0x10,%esp
+        exit();
+  de:	e8 2f 03 00 00       	call   412 <exit>
+    }
+
+    printf(1, "fork test OK\n");
+  e3:	83 ec 08             	sub    $0x8,%esp
+  e6:	68 8e 06 00 00       	push   $0x68e
+  eb:	6a 01                	push   $0x1
+  ed:	e8 0e ff ff ff       	call   0 <printf>
+  f2:	83 c4 10             	add    $0x10,%esp
+}
+  f5:	90                   	nop
+  f6:	c9                   	leave
+  f7:	c3                   	ret
+
+000000f8 <main>:
+
+int
+main(void)
+{
+  f8:	55                   	push   %ebp
+  f9:	89 e5                	mov    %esp,%ebp
+  fb:	83 e4 f0             	and    $0xfffffff0,%esp
+    forktest();
+  fe:	e8 26 ff ff ff       	call   29 <forktest>
+    exit();
+ 103:	e8 0a 03 00 00       	call   412 <exit>
+
+00000108 <stosb>:
+strchr(const char *s, char c)
+{
+    for(; *s; s++)
+        if(*s == c)
+            return (char*)s;
+    return 0;
+ 108:	55                   	push   %ebp
+ 109:	89 e5                	mov    %esp,%ebp
+ 10b:	57                   	push   %edi
+ 10c:	53                   	push   %ebx
+}
+ 10d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 110:	8b 55 10             	mov    0x10(%ebp),%edx
+ 113:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 116:	89 cb                	mov    %ecx,%ebx
+ 118:	89 df                	mov    %ebx,%edi
+ 11a:	89 d1                	mov    %edx,%ecx
+ 11c:	fc                   	cld
+ 11d:	f3 aa                	rep stos %al,%es:(%edi)
+ 11f:	89 ca                	mov    %ecx,%edx
+ 121:	89 fb                	mov    %edi,%ebx
+ 123:	89 5d 08             	mov    %ebx,0x8(%ebp)
+ 126:	89 55 10             	mov    %edx,0x10(%ebp)
+
+char*
+gets(char *buf, int max)
+{
+ 129:	90                   	nop
+ 12a:	5b                   	pop    %ebx
+ 12b:	5f                   	pop    %edi
+ 12c:	5d                   	pop    %ebp
+ 12d:	c3                   	ret
+
+0000012e <strcpy>:
+{
+ 12e:	55                   	push   %ebp
+ 12f:	89 e5                	mov    %esp,%ebp
+ 131:	83 ec 10             	sub    $0x10,%esp
+    os = s;
+ 134:	8b 45 08             	mov    0x8(%ebp),%eax
+ 137:	89 45 fc             	mov    %eax,-0x4(%ebp)
+    while((*s++ = *t++) != 0)
+ 13a:	90                   	nop
+ 13b:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 13e:	8d 42 01             	lea    0x1(%edx),%eax
+ 141:	89 45 0c             	mov    %eax,0xc(%ebp)
+ 144:	8b 45 08             	mov    0x8(%ebp),%eax
+ 147:	8d 48 01             	lea    0x1(%eax),%ecx
+ 14a:	89 4d 08             	mov    %ecx,0x8(%ebp)
+ 14d:	0f b6 12             	movzbl (%edx),%edx
+ 150:	88 10                	mov    %dl,(%eax)
+ 152:	0f b6 00             	movzbl (%eax),%eax
+ 155:	84 c0                	test   %al,%al
+ 157:	75 e2                	jne    13b <strcpy+0xd>
+    return os;
+ 159:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 15c:	c9                   	leave
+ 15d:	c3                   	ret
+
+0000015e <strcmp>:
+{
+ 15e:	55                   	push   %ebp
+ 15f:	89 e5                	mov    %esp,%ebp
+    while(*p && *p == *q)
+ 161:	eb 08                	jmp    16b <strcmp+0xd>
+        p++, q++;
+ 163:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 167:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+    while(*p && *p == *q)
+ 16b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 16e:	0f b6 00             	movzbl (%eax),%eax
+ 171:	84 c0                	test   %al,%al
+ 173:	74 10                	je     185 <strcmp+0x27>
+ 175:	8b 45 08             	mov    0x8(%ebp),%eax
+ 178:	0f b6 10             	movzbl (%eax),%edx
+ 17b:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 17e:	0f b6 00             	movzbl (%eax),%eax
+ 181:	38 c2                	cmp    %al,%dl
+ 183:	74 de                	je     163 <strcmp+0x5>
+    return (uchar)*p - (uchar)*q;
+ 185:	8b 45 08             	mov    0x8(%ebp),%eax
+ 188:	0f b6 00             	movzbl (%eax),%eax
+ 18b:	0f b6 d0             	movzbl %al,%edx
+ 18e:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 191:	0f b6 00             	movzbl (%eax),%eax
+ 194:	0f b6 c0             	movzbl %al,%eax
+ 197:	29 c2                	sub    %eax,%edx
+ 199:	89 d0                	mov    %edx,%eax
+}
+ 19b:	5d                   	pop    %ebp
+ 19c:	c3                   	ret
+
+0000019d <strlen>:
+{
+ 19d:	55                   	push   %ebp
+ 19e:	89 e5                	mov    %esp,%ebp
+ 1a0:	83 ec 10             	sub    $0x10,%esp
+    for(n = 0; s[n]; n++)
+ 1a3:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ 1aa:	eb 04                	jmp    1b0 <strlen+0x13>
+ 1ac:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 1b0:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 1b3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1b6:	01 d0                	add    %edx,%eax
+ 1b8:	0f b6 00             	movzbl (%eax),%eax
+ 1bb:	84 c0                	test   %al,%al
+ 1bd:	75 ed                	jne    1ac <strlen+0xf>
+    return n;
+ 1bf:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 1c2:	c9                   	leave
+ 1c3:	c3                   	ret
+
+000001c4 <memset>:
+{
+ 1c4:	55                   	push   %ebp
+ 1c5:	89 e5                	mov    %esp,%ebp
+    stosb(dst, c, n);
+ 1c7:	8b 45 10             	mov    0x10(%ebp),%eax
+ 1ca:	50                   	push   %eax
+ 1cb:	ff 75 0c             	push   0xc(%ebp)
+ 1ce:	ff 75 08             	push   0x8(%ebp)
+ 1d1:	e8 32 ff ff ff       	call   108 <stosb>
+ 1d6:	83 c4 0c             	add    $0xc,%esp
+    return dst;
+ 1d9:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 1dc:	c9                   	leave
+ 1dd:	c3                   	ret
+
+000001de <strchr>:
+{
+ 1de:	55                   	push   %ebp
+ 1df:	89 e5                	mov    %esp,%ebp
+ 1e1:	83 ec 04             	sub    $0x4,%esp
+ 1e4:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 1e7:	88 45 fc             	mov    %al,-0x4(%ebp)
+    for(; *s; s++)
+ 1ea:	eb 14                	jmp    200 <strchr+0x22>
+        if(*s == c)
+ 1ec:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1ef:	0f b6 00             	movzbl (%eax),%eax
+ 1f2:	38 45 fc             	cmp    %al,-0x4(%ebp)
+ 1f5:	75 05                	jne    1fc <strchr+0x1e>
+            return (char*)s;
+ 1f7:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1fa:	eb 13                	jmp    20f <strchr+0x31>
+    for(; *s; s++)
+ 1fc:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 200:	8b 45 08             	mov    0x8(%ebp),%eax
+ 203:	0f b6 00             	movzbl (%eax),%eax
+ 206:	84 c0                	test   %al,%al
+ 208:	75 e2                	jne    1ec <strchr+0xe>
+    return 0;
+ 20a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 20f:	c9                   	leave
+ 210:	c3                   	ret
+
+00000211 <gets>:
+{
+ 211:	55                   	push   %ebp
+ 212:	89 e5                	mov    %esp,%ebp
+ 214:	83 ec 18             	sub    $0x18,%esp
+    int i, cc;
+    char c;
+
+    for(i=0; i+1 < max; ){
+ 217:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 21e:	eb 42                	jmp    262 <gets+0x51>
+        cc = read(0, &c, 1);
+ 220:	83 ec 04             	sub    $0x4,%esp
+ 223:	6a 01                	push   $0x1
+ 225:	8d 45 ef             	lea    -0x11(%ebp),%eax
+ 228:	50                   	push   %eax
+ 229:	6a 00                	push   $0x0
+ 22b:	e8 f7 01 00 00       	call   427 <read>
+ 230:	83 c4 10             	add    $0x10,%esp
+ 233:	89 45 f0             	mov    %eax,-0x10(%ebp)
+        if(cc < 1)
+ 236:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 23a:	7e 33                	jle    26f <gets+0x5e>
+            break;
+        buf[i++] = c;
+ 23c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 23f:	8d 50 01             	lea    0x1(%eax),%edx
+ 242:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 245:	89 c2                	mov    %eax,%edx
+ 247:	8b 45 08             	mov    0x8(%ebp),%eax
+ 24a:	01 c2                	add    %eax,%edx
+ 24c:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 250:	88 02                	mov    %al,(%edx)
+        if(c == '\n' || c == '\r')
+ 252:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 256:	3c 0a                	cmp    $0xa,%al
+ 258:	74 16                	je     270 <gets+0x5f>
+ 25a:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 25e:	3c 0d                	cmp    $0xd,%al
+ 260:	74 0e                	je     270 <gets+0x5f>
+    for(i=0; i+1 < max; ){
+ 262:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 265:	83 c0 01             	add    $0x1,%eax
+ 268:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 26b:	7f b3                	jg     220 <gets+0xf>
+ 26d:	eb 01                	jmp    270 <gets+0x5f>
+            break;
+ 26f:	90                   	nop
+            break;
+    }
+    buf[i] = '\0';
+ 270:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 273:	8b 45 08             	mov    0x8(%ebp),%eax
+ 276:	01 d0                	add    %edx,%eax
+ 278:	c6 00 00             	movb   $0x0,(%eax)
+    return buf;
+ 27b:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 27e:	c9                   	leave
+ 27f:	c3                   	ret
+
+00000280 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 280:	55                   	push   %ebp
+ 281:	89 e5                	mov    %esp,%ebp
+ 283:	83 ec 18             	sub    $0x18,%esp
+    int fd;
+    int r;
+
+    fd = open(n, O_RDONLY);
+ 286:	83 ec 08             	sub    $0x8,%esp
+ 289:	6a 00                	push   $0x0
+ 28b:	ff 75 08             	push   0x8(%ebp)
+ 28e:	e8 c6 01 00 00       	call   459 <open>
+ 293:	83 c4 10             	add    $0x10,%esp
+ 296:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(fd < 0)
+ 299:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 29d:	79 07                	jns    2a6 <stat+0x26>
+        return -1;
+ 29f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 2a4:	eb 25                	jmp    2cb <stat+0x4b>
+    r = fstat(fd, st);
+ 2a6:	83 ec 08             	sub    $0x8,%esp
+ 2a9:	ff 75 0c             	push   0xc(%ebp)
+ 2ac:	ff 75 f4             	push   -0xc(%ebp)
+ 2af:	e8 c3 01 00 00       	call   477 <fstat>
+ 2b4:	83 c4 10             	add    $0x10,%esp
+ 2b7:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    close(fd);
+ 2ba:	83 ec 0c             	sub    $0xc,%esp
+ 2bd:	ff 75 f4             	push   -0xc(%ebp)
+ 2c0:	e8 76 01 00 00       	call   43b <close>
+ 2c5:	83 c4 10             	add    $0x10,%esp
+    return r;
+ 2c8:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ 2cb:	c9                   	leave
+ 2cc:	c3                   	ret
+
+000002cd <atoi>:
+
+int
+atoi(const char *s)
+{
+ 2cd:	55                   	push   %ebp
+ 2ce:	89 e5                	mov    %esp,%ebp
+ 2d0:	83 ec 10             	sub    $0x10,%esp
+    int n;
+
+    n = 0;
+ 2d3:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+    while('0' <= *s && *s <= '9')
+ 2da:	eb 25                	jmp    301 <atoi+0x34>
+        n = n*10 + *s++ - '0';
+ 2dc:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 2df:	89 d0                	mov    %edx,%eax
+ 2e1:	c1 e0 02             	shl    $0x2,%eax
+ 2e4:	01 d0                	add    %edx,%eax
+ 2e6:	01 c0                	add    %eax,%eax
+ 2e8:	89 c1                	mov    %eax,%ecx
+ 2ea:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2ed:	8d 50 01             	lea    0x1(%eax),%edx
+ 2f0:	89 55 08             	mov    %edx,0x8(%ebp)
+ 2f3:	0f b6 00             	movzbl (%eax),%eax
+ 2f6:	0f be c0             	movsbl %al,%eax
+ 2f9:	01 c8                	add    %ecx,%eax
+ 2fb:	83 e8 30             	sub    $0x30,%eax
+ 2fe:	89 45 fc             	mov    %eax,-0x4(%ebp)
+    while('0' <= *s && *s <= '9')
+ 301:	8b 45 08             	mov    0x8(%ebp),%eax
+ 304:	0f b6 00             	movzbl (%eax),%eax
+ 307:	3c 2f                	cmp    $0x2f,%al
+ 309:	7e 0a                	jle    315 <atoi+0x48>
+ 30b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 30e:	0f b6 00             	movzbl (%eax),%eax
+ 311:	3c 39                	cmp    $0x39,%al
+ 313:	7e c7                	jle    2dc <atoi+0xf>
+    return n;
+ 315:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 318:	c9                   	leave
+ 319:	c3                   	ret
+
+0000031a <nice>:
+
+// Add inc to the caller's nice value; return the new value.
+int
+nice(int inc)
+{
+ 31a:	55                   	push   %ebp
+ 31b:	89 e5                	mov    %esp,%ebp
+ 31d:	83 ec 18             	sub    $0x18,%esp
+    int n;
+
+    n = getpriority(0) + inc;
+ 320:	83 ec 0c             	sub    $0xc,%esp
+ 323:	6a 00                	push   $0x0
+ 325:	e8 d9 01 00 00       	call   503 <getpriority>
+ 32a:	83 c4 10             	add    $0x10,%esp
+ 32d:	8b 55 08             	mov    0x8(%ebp),%edx
+ 330:	01 d0                	add    %edx,%eax
+ 332:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(n < 0)
+ 335:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 339:	79 07                	jns    342 <nice+0x28>
+        n = 0;
+ 33b:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    if(n > NICEMAX)
+ 342:	83 7d f4 13          	cmpl   $0x13,-0xc(%ebp)
+ 346:	7e 07                	jle    34f <nice+0x35>
+        n = NICEMAX;
+ 348:	c7 45 f4 13 00 00 00 	movl   $0x13,-0xc(%ebp)
+    if(setpriority(0, n) < 0)
+ 34f:	83 ec 08             	sub    $0x8,%esp
+ 352:	ff 75 f4             	push   -0xc(%ebp)
+ 355:	6a 00                	push   $0x0
+ 357:	e8 b1 01 00 00       	call   50d <setpriority>
+ 35c:	83 c4 10             	add    $0x10,%esp
+ 35f:	85 c0                	test   %eax,%eax
+ 361:	79 07                	jns    36a <nice+0x50>
+        return -1;
+ 363:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 368:	eb 03                	jmp    36d <nice+0x53>
+    return n;
+ 36a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+ 36d:	c9                   	leave
+ 36e:	c3                   	ret
+
+0000036f <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 36f:	55                   	push   %ebp
+ 370:	89 e5                	mov    %esp,%ebp
+ 372:	83 ec 10             	sub    $0x10,%esp
+    char *dst;
+    const char *src;
+
+    dst = vdst;
+ 375:	8b 45 08             	mov    0x8(%ebp),%eax
+ 378:	89 45 fc             	mov    %eax,-0x4(%ebp)
+    src = vsrc;
+ 37b:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 37e:	89 45 f8             	mov    %eax,-0x8(%ebp)
+    while(n-- > 0)
+ 381:	eb 17                	jmp    39a <memmove+0x2b>
+        *dst++ = *src++;
+ 383:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 386:	8d 42 01             	lea    0x1(%edx),%eax
+ 389:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 38c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 38f:	8d 48 01             	lea    0x1(%eax),%ecx
+ 392:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+ 395:	0f b6 12             	movzbl (%edx),%edx
+ 398:	88 10                	mov    %dl,(%eax)
+    while(n-- > 0)
+ 39a:	8b 45 10             	mov    0x10(%ebp),%eax
+ 39d:	8d 50 ff             	lea    -0x1(%eax),%edx
+ 3a0:	89 55 10             	mov    %edx,0x10(%ebp)
+ 3a3:	85 c0                	test   %eax,%eax
+ 3a5:	7f dc                	jg     383 <memmove+0x14>
+    return vdst;
+ 3a7:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 3aa:	c9                   	leave
+ 3ab:	c3                   	ret
+
+000003ac <dosyscall>:
+sysmode:
+    .long 0
+
+    .text
+dosyscall:
+    cmpl $0, sysmode
+ 3ac:	83 3d 78 08 00 00 00 	cmpl   $0x0,0x878
+    jg 2f
+ 3b3:	7f 0c                	jg     3c1 <dosyscall+0x15>
+    jl 1f
+ 3b5:	7c 07                	jl     3be <dosyscall+0x12>
+    call sepcheck
+ 3b7:	e8 27 00 00 00       	call   3e3 <sepcheck>
+    jmp dosyscall
+ 3bc:	eb ee                	jmp    3ac <dosyscall>
+1:
+    int $T_SYSCALL
+ 3be:	cd 40                	int    $0x40
+    ret
+ 3c0:	c3                   	ret
+2:
+    pushl %ebx
+ 3c1:	53                   	push   %ebx
+    pushl %esi
+ 3c2:	56                   	push   %esi
+    pushl %edi
+ 3c3:	57                   	push   %edi
+    pushl %ebp
+ 3c4:	55                   	push   %ebp
+    movl 20(%esp), %ebx
+ 3c5:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+    movl 24(%esp), %esi
+ 3c9:	8b 74 24 18          	mov    0x18(%esp),%esi
+    movl 28(%esp), %edi
+ 3cd:	8b 7c 24 1c          	mov    0x1c(%esp),%edi
+    movl 32(%esp), %ebp
+ 3d1:	8b 6c 24 20          	mov    0x20(%esp),%ebp
+    movl %esp, %ecx
+ 3d5:	89 e1                	mov    %esp,%ecx
+    movl $3f, %edx
+ 3d7:	ba de 03 00 00       	mov    $0x3de,%edx
+    sysenter
+ 3dc:	0f 34                	sysenter
+3:
+    popl %ebp
+ 3de:	5d                   	pop    %ebp
+    popl %edi
+ 3df:	5f                   	pop    %edi
+    popl %esi
+ 3e0:	5e                   	pop    %esi
+    popl %ebx
+ 3e1:	5b                   	pop    %ebx
+    ret
+ 3e2:	c3                   	ret
+
+000003e3 <sepcheck>:
+
+# Set sysmode from cpuid's SEP flag.    Preserves %eax.
+sepcheck:
+    pushl %eax
+ 3e3:	50                   	push   %eax
+    pushl %ebx
+ 3e4:	53                   	push   %ebx
+    movl $1, %eax
+ 3e5:	b8 01 00 00 00       	mov    $0x1,%eax
+    cpuid
+ 3ea:	0f a2                	cpuid
+    movl $-1, sysmode
+ 3ec:	c7 05 78 08 00 00 ff 	movl   $0xffffffff,0x878
+ 3f3:	ff ff ff 
+    testl $0x800, %edx
+ 3f6:	f7 c2 00 08 00 00    	test   $0x800,%edx
+    jz 1f
+ 3fc:	74 0a                	je     408 <sepcheck+0x25>
+    movl $1, sysmode
+ 3fe:	c7 05 78 08 00 00 01 	movl   $0x1,0x878
+ 405:	00 00 00 
+1:
+    popl %ebx
+ 408:	5b                   	pop    %ebx
+    popl %eax
+ 409:	58                   	pop    %eax
+    ret
+ 40a:	c3                   	ret
+
+0000040b <fork>:
+
+SYSCALL(fork)
+ 40b:	b8 01 00 00 00       	mov    $0x1,%eax
+ 410:	eb 9a                	jmp    3ac <dosyscall>
+
+00000412 <exit>:
+SYSCALL(exit)
+ 412:	b8 02 00 00 00       	mov    $0x2,%eax
+ 417:	eb 93                	jmp    3ac <dosyscall>
+
+00000419 <wait>:
+SYSCALL(wait)
+ 419:	b8 03 00 00 00       	mov    $0x3,%eax
+ 41e:	eb 8c                	jmp    3ac <dosyscall>
+
+00000420 <pipe>:
+SYSCALL(pipe)
+ 420:	b8 04 00 00 00       	mov    $0x4,%eax
+ 425:	eb 85                	jmp    3ac <dosyscall>
+
+00000427 <read>:
+SYSCALL(read)
+ 427:	b8 05 00 00 00       	mov    $0x5,%eax
+ 42c:	e9 7b ff ff ff       	jmp    3ac <dosyscall>
+
+00000431 <write>:
+SYSCALL(write)
+ 431:	b8 10 00 00 00       	mov    $0x10,%eax
+ 436:	e9 71 ff ff ff       	jmp    3ac <dosyscall>
+
+0000043b <close>:
+SYSCALL(close)
+ 43b:	b8 15 00 00 00       	mov    $0x15,%eax
+ 440:	e9 67 ff ff ff       	jmp    3ac <dosyscall>
+
+00000445 <kill>:
+SYSCALL(kill)
+ 445:	b8 06 00 00 00       	mov    $0x6,%eax
+ 44a:	e9 5d ff ff ff       	jmp    3ac <dosyscall>
+
+0000044f <exec>:
+SYSCALL(exec)
+ 44f:	b8 07 00 00 00       	mov    $0x7,%eax
+ 454:	e9 53 ff ff ff       	jmp    3ac <dosyscall>
+
+00000459 <open>:
+SYSCALL(open)
+ 459:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 45e:	e9 49 ff ff ff       	jmp    3ac <dosyscall>
+
+00000463 <mknod>:
+SYSCALL(mknod)
+ 463:	b8 11 00 00 00       	mov    $0x11,%eax
+ 468:	e9 3f ff ff ff       	jmp    3ac <dosyscall>
+
+0000046d <unlink>:
+SYSCALL(unlink)
+ 46d:	b8 12 00 00 00       	mov    $0x12,%eax
+ 472:	e9 35 ff ff ff       	jmp    3ac <dosyscall>
+
+00000477 <fstat>:
+SYSCALL(fstat)
+ 477:	b8 08 00 00 00       	mov    $0x8,%eax
+ 47c:	e9 2b ff ff ff       	jmp    3ac <dosyscall>
+
+00000481 <link>:
+SYSCALL(link)
+ 481:	b8 13 00 00 00       	mov    $0x13,%eax
+ 486:	e9 21 ff ff ff       	jmp    3ac <dosyscall>
+
+0000048b <mkdir>:
+SYSCALL(mkdir)
+ 48b:	b8 14 00 00 00       	mov    $0x14,%eax
+ 490:	e9 17 ff ff ff       	jmp    3ac <dosyscall>
+
+00000495 <chdir>:
+SYSCALL(chdir)
+ 495:	b8 09 00 00 00       	mov    $0x9,%eax
+ 49a:	e9 0d ff ff ff       	jmp    3ac <dosyscall>
+
+0000049f <dup>:
+SYSCALL(dup)
+ 49f:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 4a4:	e9 03 ff ff ff       	jmp    3ac <dosyscall>
+
+000004a9 <getpid>:
+SYSCALL(getpid)
+ 4a9:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 4ae:	e9 f9 fe ff ff       	jmp    3ac <dosyscall>
+
+000004b3 <sbrk>:
+SYSCALL(sbrk)
+ 4b3:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 4b8:	e9 ef fe ff ff       	jmp    3ac <dosyscall>
+
+000004bd <sleep>:
+SYSCALL(sleep)
+ 4bd:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 4c2:	e9 e5 fe ff ff       	jmp    3ac <dosyscall>
+
+000004c7 <uptime>:
+SYSCALL(uptime)
+ 4c7:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 4cc:	e9 db fe ff ff       	jmp    3ac <dosyscall>
+
+000004d1 <date>:
+SYSCALL(date)
+ 4d1:	b8 16 00 00 00       	mov    $0x16,%eax
+ 4d6:	e9 d1 fe ff ff       	jmp    3ac <dosyscall>
+
+000004db <dup2>:
+SYSCALL(dup2)
+ 4db:	b8 17 00 00 00       	mov    $0x17,%eax
+ 4e0:	e9 c7 fe ff ff       	jmp    3ac <dosyscall>
+
+000004e5 <uffd>:
+SYSCALL(uffd)
+ 4e5:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 4ea:	e9 bd fe ff ff       	jmp    3ac <dosyscall>
+
+000004ef <uffdregister>:
+SYSCALL(uffdregister)
+ 4ef:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 4f4:	e9 b3 fe ff ff       	jmp    3ac <dosyscall>
+
+000004f9 <uffdcopy>:
+SYSCALL(uffdcopy)
+ 4f9:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 4fe:	e9 a9 fe ff ff       	jmp    3ac <dosyscall>
+
+00000503 <getpriority>:
+SYSCALL(getpriority)
+ 503:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 508:	e9 9f fe ff ff       	jmp    3ac <dosyscall>
+
+0000050d <setpriority>:
+SYSCALL(setpriority)
+ 50d:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 512:	e9 95 fe ff ff       	jmp    3ac <dosyscall>
+
+00000517 <setweight>:
+SYSCALL(setweight)
+ 517:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 51c:	e9 8b fe ff ff       	jmp    3ac <dosyscall>
+
+00000521 <setgroup>:
+SYSCALL(setgroup)
+ 521:	b8 20 00 00 00       	mov    $0x20,%eax
+ 526:	e9 81 fe ff ff       	jmp    3ac <dosyscall>
+
+0000052b <schedinfo>:
+SYSCALL(schedinfo)
+ 52b:	b8 21 00 00 00       	mov    $0x21,%eax
+ 530:	e9 77 fe ff ff       	jmp    3ac <dosyscall>
+
+00000535 <nanosleep>:
+SYSCALL(nanosleep)
+ 535:	b8 22 00 00 00       	mov    $0x22,%eax
+ 53a:	e9 6d fe ff ff       	jmp    3ac <dosyscall>
+
+0000053f <clock_nanosleep>:
+SYSCALL(clock_nanosleep)
+ 53f:	b8 23 00 00 00       	mov    $0x23,%eax
+ 544:	e9 63 fe ff ff       	jmp    3ac <dosyscall>
+
+00000549 <clock_gettime>:
+SYSCALL(clock_gettime)
+ 549:	b8 24 00 00 00       	mov    $0x24,%eax
+ 54e:	e9 59 fe ff ff       	jmp    3ac <dosyscall>
+
+00000553 <sched_setaffinity>:
+SYSCALL(sched_setaffinity)
+ 553:	b8 25 00 00 00       	mov    $0x25,%eax
+ 558:	e9 4f fe ff ff       	jmp    3ac <dosyscall>
+
+0000055d <sched_getaffinity>:
+SYSCALL(sched_getaffinity)
+ 55d:	b8 26 00 00 00       	mov    $0x26,%eax
+ 562:	e9 45 fe ff ff       	jmp    3ac <dosyscall>
+
+00000567 <irqaffinity>:
+SYSCALL(irqaffinity)
+ 567:	b8 27 00 00 00       	mov    $0x27,%eax
+ 56c:	e9 3b fe ff ff       	jmp    3ac <dosyscall>
+
+00000571 <getrusage>:
+SYSCALL(getrusage)
+ 571:	b8 28 00 00 00       	mov    $0x28,%eax
+ 576:	e9 31 fe ff ff       	jmp    3ac <dosyscall>
+
+0000057b <times>:
+SYSCALL(times)
+ 57b:	b8 29 00 00 00       	mov    $0x29,%eax
+ 580:	e9 27 fe ff ff       	jmp    3ac <dosyscall>
+
+00000585 <schedlat>:
+SYSCALL(schedlat)
+ 585:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 58a:	e9 1d fe ff ff       	jmp    3ac <dosyscall>
+
+0000058f <sched_setscheduler>:
+SYSCALL(sched_setscheduler)
+ 58f:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 594:	e9 13 fe ff ff       	jmp    3ac <dosyscall>
+
+00000599 <sched_getscheduler>:
+SYSCALL(sched_getscheduler)
+ 599:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 59e:	e9 09 fe ff ff       	jmp    3ac <dosyscall>
+
+000005a3 <sched_getparam>:
+SYSCALL(sched_getparam)
+ 5a3:	b8 2d 00 00 00       	mov    $0x2d,%eax
+ 5a8:	e9 ff fd ff ff       	jmp    3ac <dosyscall>
+
+000005ad <lockstat>:
+SYSCALL(lockstat)
+ 5ad:	b8 2e 00 00 00       	mov    $0x2e,%eax
+ 5b2:	e9 f5 fd ff ff       	jmp    3ac <dosyscall>
+
+000005b7 <ioring_setup>:
+SYSCALL(ioring_setup)
+ 5b7:	b8 2f 00 00 00       	mov    $0x2f,%eax
+ 5bc:	e9 eb fd ff ff       	jmp    3ac <dosyscall>
+
+000005c1 <ioring_enter>:
+SYSCALL(ioring_enter)
+ 5c1:	b8 30 00 00 00       	mov    $0x30,%eax
+ 5c6:	e9 e1 fd ff ff       	jmp    3ac <dosyscall>
+
+000005cb <readv>:
+SYSCALL(readv)
+ 5cb:	b8 31 00 00 00       	mov    $0x31,%eax
+ 5d0:	e9 d7 fd ff ff       	jmp    3ac <dosyscall>
+
+000005d5 <writev>:
+SYSCALL(writev)
+ 5d5:	b8 32 00 00 00       	mov    $0x32,%eax
+ 5da:	e9 cd fd ff ff       	jmp    3ac <dosyscall>
+
+000005df <pread>:
+SYSCALL(pread)
+ 5df:	b8 33 00 00 00       	mov    $0x33,%eax
+ 5e4:	e9 c3 fd ff ff       	jmp    3ac <dosyscall>
+
+000005e9 <pwrite>:
+SYSCALL(pwrite)
+ 5e9:	b8 34 00 00 00       	mov    $0x34,%eax
+ 5ee:	e9 b9 fd ff ff       	jmp    3ac <dosyscall>
+
+000005f3 <sendfile>:
+SYSCALL(sendfile)
+ 5f3:	b8 35 00 00 00       	mov    $0x35,%eax
+ 5f8:	e9 af fd ff ff       	jmp    3ac <dosyscall>
+
+000005fd <splice>:
+SYSCALL(splice)
+ 5fd:	b8 36 00 00 00       	mov    $0x36,%eax
+ 602:	e9 a5 fd ff ff       	jmp    3ac <dosyscall>
+
+00000607 <sysstat>:
+SYSCALL(sysstat)
+ 607:	b8 37 00 00 00       	mov    $0x37,%eax
+ 60c:	e9 9b fd ff ff       	jmp    3ac <dosyscall>
+
+00000611 <strace>:
+SYSCALL(strace)
+ 611:	b8 38 00 00 00       	mov    $0x38,%eax
+ 616:	e9 91 fd ff ff       	jmp    3ac <dosyscall>
+
+0000061b <straceread>:
+SYSCALL(straceread)
+ 61b:	b8 39 00 00 00       	mov    $0x39,%eax
+ 620:	e9 87 fd ff ff       	jmp    3ac <dosyscall>
+
+00000625 <alarm>:
+
+# alarm and rstoregs keep to int $T_SYSCALL: rstoregs restores
+# %ecx and %edx, which sysexit would clobber.
+.globl alarm
+    alarm:
+        pushl $rstoregs
+ 625:	68 35 06 00 00       	push   $0x635
+        movl $SYS_alarm, %eax
+ 62a:	b8 18 00 00 00       	mov    $0x18,%eax
+        int $T_SYSCALL
+ 62f:	cd 40                	int    $0x40
+        add $0x04, %esp
+ 631:	83 c4 04             	add    $0x4,%esp
+        ret
+ 634:	c3                   	ret
+
+00000635 <rstoregs>:
+
+.globl rstoregs
+    rstoregs:
+        movl $SYS_rstoregs, %eax
+ 635:	b8 19 00 00 00       	mov    $0x19,%eax
+        int $T_SYSCALL
+ 63a:	cd 40                	int    $0x40
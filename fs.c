@@ -14,8 +14,10 @@
 #include "param.h"
 #include "stat.h"
 #include "mmu.h"
-#include "proc.h"
+#include "x86.h"
 #include "spinlock.h"
+#include "proc.h"
+#include "rwlock.h"
 #include "sleeplock.h"
 #include "fs.h"
 #include "buf.h"
@@ -23,9 +25,17 @@
 
 #define min(a, b) ((a) < (b) ? (a) : (b))
 static void itrunc(struct inode*);
+static struct inode* iget(uint dev, uint inum);
 // there should be one superblock per disk device, but we run with
-// only one device
-struct superblock sb; 
+// only one device.    sbseq guards it: it is written once, by
+// iinit(), and read on every block and inode allocation.
+static struct superblock sb; 
+static struct seqlock sbseq;
+
+// The root directory, held for good by iinit().    Readers take
+// a reference under rootlock, so it cannot be dropped under them.
+static struct inode *rootip;
+static struct rwlock rootlock;
 
 // Read the super block.
 void
@@ -38,6 +48,18 @@ readsb(int dev, struct superblock *sb)
     brelse(bp);
 }
 
+// Copy the superblock into s.
+static void
+getsb(struct superblock *s)
+{
+    uint seq;
+
+    do {
+        seq = readseqbegin(&sbseq);
+        *s = sb;
+    } while(readseqretry(&sbseq, seq));
+}
+
 // Zero a block.
 static void
 bzero(int dev, int bno)
@@ -58,11 +80,13 @@ balloc(uint dev)
 {
     int b, bi, m;
     struct buf *bp;
+    struct superblock s;
 
+    getsb(&s);
     bp = 0;
-    for(b = 0; b < sb.size; b += BPB){
-        bp = bread(dev, BBLOCK(b, sb));
-        for(bi = 0; bi < BPB && b + bi < sb.size; bi++){
+    for(b = 0; b < s.size; b += BPB){
+        bp = bread(dev, BBLOCK(b, s));
+        for(bi = 0; bi < BPB && b + bi < s.size; bi++){
             m = 1 << (bi % 8);
             if((bp->data[bi/8] & m) == 0){    // Is block free?
                 bp->data[bi/8] |= m;    // Mark block in use.
@@ -82,9 +106,11 @@ static void
 bfree(int dev, uint b)
 {
     struct buf *bp;
+    struct superblock s;
     int bi, m;
 
-    bp = bread(dev, BBLOCK(b, sb));
+    getsb(&s);
+    bp = bread(dev, BBLOCK(b, s));
     bi = b % BPB;
     m = 1 << (bi % 8);
     if((bp->data[bi/8] & m) == 0)
@@ -172,20 +198,34 @@ void
 iinit(int dev)
 {
     int i = 0;
+    struct superblock s;
+    struct inode *ip;
     
     initlock(&icache.lock, "icache", 1);
     for(i = 0; i < NINODE; i++) {
         initsleeplock(&icache.inode[i].lock, "inode");
     }
 
-    readsb(dev, &sb);
+    initseqlock(&sbseq, "superblock");
+    readsb(dev, &s);
+    writeseqlock(&sbseq);
+    sb = s;
+    writesequnlock(&sbseq);
+
+    ncacheinit();
+
+    initrwlock(&rootlock, "root", 0);
+    ip = iget(ROOTDEV, ROOTINO);
+    acquirewrite(&rootlock);
+    rootip = ip;
+    releasewrite(&rootlock);
+
     cprintf("sb: size %d nblocks %d ninodes %d nlog %d logstart %d\
  inodestart %d bmap start %d\n", sb.size, sb.nblocks,
                     sb.ninodes, sb.nlog, sb.logstart, sb.inodestart,
                     sb.bmapstart);
 }
 
-static struct inode* iget(uint dev, uint inum);
 
 //PAGEBREAK!
 // Allocate an inode on device dev.
@@ -197,9 +237,11 @@ ialloc(uint dev, short type)
     int inum;
     struct buf *bp;
     struct dinode *dip;
+    struct superblock s;
 
-    for(inum = 1; inum < sb.ninodes; inum++){
-        bp = bread(dev, IBLOCK(inum, sb));
+    getsb(&s);
+    for(inum = 1; inum < s.ninodes; inum++){
+        bp = bread(dev, IBLOCK(inum, s));
         dip = (struct dinode*)bp->data + inum%IPB;
         if(dip->type == 0){    // a free inode
             memset(dip, 0, sizeof(*dip));
@@ -222,8 +264,10 @@ iupdate(struct inode *ip)
 {
     struct buf *bp;
     struct dinode *dip;
+    struct superblock s;
 
-    bp = bread(ip->dev, IBLOCK(ip->inum, sb));
+    getsb(&s);
+    bp = bread(ip->dev, IBLOCK(ip->inum, s));
     dip = (struct dinode*)bp->data + ip->inum%IPB;
     dip->type = ip->type;
     dip->major = ip->major;
@@ -249,7 +293,7 @@ iget(uint dev, uint inum)
     empty = 0;
     for(ip = &icache.inode[0]; ip < &icache.inode[NINODE]; ip++){
         if(ip->ref > 0 && ip->dev == dev && ip->inum == inum){
-            ip->ref++;
+            xadd((uint*)&ip->ref, 1);
             release(&icache.lock);
             return ip;
         }
@@ -273,12 +317,13 @@ iget(uint dev, uint inum)
 
 // Increment reference count for ip.
 // Returns ip to enable ip = idup(ip1) idiom.
+// The caller already holds a reference, so ip cannot be recycled
+// meanwhile and an atomic increment will do without icache.lock;
+// every other change to ref is atomic too.
 struct inode*
 idup(struct inode *ip)
 {
-    acquire(&icache.lock);
-    ip->ref++;
-    release(&icache.lock);
+    xadd((uint*)&ip->ref, 1);
     return ip;
 }
 
@@ -289,6 +334,7 @@ ilock(struct inode *ip)
 {
     struct buf *bp;
     struct dinode *dip;
+    struct superblock s;
 
     if(ip == 0 || ip->ref < 1)
         panic("ilock");
@@ -296,7 +342,8 @@ ilock(struct inode *ip)
     acquiresleep(&ip->lock);
 
     if(ip->valid == 0){
-        bp = bread(ip->dev, IBLOCK(ip->inum, sb));
+        getsb(&s);
+        bp = bread(ip->dev, IBLOCK(ip->inum, s));
         dip = (struct dinode*)bp->data + ip->inum%IPB;
         ip->type = dip->type;
         ip->major = dip->major;
@@ -338,6 +385,7 @@ iput(struct inode *ip)
         release(&icache.lock);
         if(r == 1){
             // inode has no links and no other references: truncate and free.
+            ncachepurge(ip->dev, ip->inum);
             itrunc(ip);
             ip->type = 0;
             iupdate(ip);
@@ -347,7 +395,7 @@ iput(struct inode *ip)
     releasesleep(&ip->lock);
 
     acquire(&icache.lock);
-    ip->ref--;
+    xadd((uint*)&ip->ref, -1);
     release(&icache.lock);
 }
 
@@ -454,11 +502,12 @@ readi(struct inode *ip, char *dst, uint off, uint n)
 {
     uint tot, m;
     struct buf *bp;
+    struct devsw dev;
 
     if(ip->type == T_DEV){
-        if(ip->major < 0 || ip->major >= NDEV || !devsw[ip->major].read)
+        if(getdevsw(ip->major, &dev) < 0 || !dev.read)
             return -1;
-        return devsw[ip->major].read(ip, dst, n);
+        return dev.read(ip, dst, n);
     }
 
     if(off > ip->size || off + n < off)
@@ -475,6 +524,31 @@ readi(struct inode *ip, char *dst, uint off, uint n)
     return n;
 }
 
+// Copy up to n bytes of ip from off into pipe p straight out of
+// the buffer cache, stopping early once p is full; never sleeps
+// waiting for the pipe.    Caller must hold ip->lock.
+// Return the number of bytes copied, or -1.
+int
+readipipe(struct inode *ip, struct pipe *p, uint off, uint n)
+{
+    uint tot, m;
+    struct buf *bp;
+
+    if(ip->type == T_DEV || off > ip->size || off + n < off)
+        return -1;
+    if(off + n > ip->size)
+        n = ip->size - off;
+
+    for(tot=0; tot<n; tot+=m, off+=m){
+        bp = bread(ip->dev, bmap(ip, off/BSIZE));
+        m = pipeput(p, (char*)bp->data + off%BSIZE, min(n - tot, BSIZE - off%BSIZE));
+        brelse(bp);
+        if(m == 0)
+            break;
+    }
+    return tot;
+}
+
 // PAGEBREAK!
 // Write data to inode.
 // Caller must hold ip->lock.
@@ -483,11 +557,12 @@ writei(struct inode *ip, char *src, uint off, uint n)
 {
     uint tot, m;
     struct buf *bp;
+    struct devsw dev;
 
     if(ip->type == T_DEV){
-        if(ip->major < 0 || ip->major >= NDEV || !devsw[ip->major].write)
+        if(getdevsw(ip->major, &dev) < 0 || !dev.write)
             return -1;
-        return devsw[ip->major].write(ip, src, n);
+        return dev.write(ip, src, n);
     }
 
     if(off > ip->size || off + n < off)
@@ -617,6 +692,45 @@ skipelem(char *path, char *name)
     return path;
 }
 
+// Look path up in the name cache, taking no sleeplocks and reading
+// no directories.    Return 0 if some element is not cached, and
+// leave it to namex() to walk the directories.
+static struct inode*
+namecached(char *path, int nameiparent, char *name)
+{
+    struct inode *ip;
+    uint dev, inum, seq;
+    int isdir;
+
+    seq = ncachebegin();
+    isdir = 1;
+    if(*path == '/'){
+        dev = ROOTDEV;
+        inum = ROOTINO;
+    } else {
+        dev = myproc()->cwd->dev;
+        inum = myproc()->cwd->inum;
+    }
+    while((path = skipelem(path, name)) != 0){
+        if(nameiparent && *path == '\0')
+            break;
+        if((inum = ncachelookup(dev, inum, name, &isdir)) == 0)
+            return 0;
+    }
+    // A parent that is not a directory is namex()'s error to report.
+    if(nameiparent && (path == 0 || !isdir))
+        return 0;
+
+    // Names are only cached in directories, so if inum was removed
+    // since the lookup began the sequence number has moved on.
+    ip = iget(dev, inum);
+    if(ncacheretry(seq)){
+        iput(ip);
+        return 0;
+    }
+    return ip;
+}
+
 // Look up and return the inode for a path name.
 // If parent != 0, return the inode for the parent and copy the final
 // path element into name, which must have room for DIRSIZ bytes.
@@ -625,10 +739,17 @@ static struct inode*
 namex(char *path, int nameiparent, char *name)
 {
     struct inode *ip, *next;
+    int isdir;
+
+    if((ip = namecached(path, nameiparent, name)) != 0)
+        return ip;
 
-    if(*path == '/')
-        ip = iget(ROOTDEV, ROOTINO);
-    else
+    if(*path == '/'){
+        // userinit() looks up "/" before iinit() has run.
+        acquireread(&rootlock);
+        ip = rootip ? idup(rootip) : iget(ROOTDEV, ROOTINO);
+        releaseread(&rootlock);
+    } else
         ip = idup(myproc()->cwd);
 
     while((path = skipelem(path, name)) != 0){
@@ -646,6 +767,17 @@ namex(char *path, int nameiparent, char *name)
             iunlockput(ip);
             return 0;
         }
+        // Note whether next is a directory, so that namecached()
+        // may return it as a parent.    "." and ".." always are, and
+        // locking them here would deadlock or lock child before parent.
+        if(namecmp(name, ".") == 0 || namecmp(name, "..") == 0)
+            isdir = 1;
+        else {
+            ilock(next);
+            isdir = next->type == T_DIR;
+            iunlock(next);
+        }
+        ncacheenter(ip->dev, ip->inum, name, next->inum, isdir);
         iunlockput(ip);
         ip = next;
     }
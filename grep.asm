@@ -0,0 +1,1728 @@
+
+_grep:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <grep>:
+char buf[1024];
+int match(char*, char*);
+
+void
+grep(char *pattern, int fd)
+{
+   0:	55                   	push   %ebp
+   1:	89 e5                	mov    %esp,%ebp
+   3:	83 ec 18             	sub    $0x18,%esp
+    int n, m;
+    char *p, *q;
+
+    m = 0;
+   6:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    while((n = read(fd, buf+m, sizeof(buf)-m-1)) > 0){
+   d:	e9 ae 00 00 00       	jmp    c0 <grep+0xc0>
+        m += n;
+  12:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  15:	01 45 f4             	add    %eax,-0xc(%ebp)
+        buf[m] = '\0';
+  18:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  1b:	05 40 10 00 00       	add    $0x1040,%eax
+  20:	c6 00 00             	movb   $0x0,(%eax)
+        p = buf;
+  23:	c7 45 f0 40 10 00 00 	movl   $0x1040,-0x10(%ebp)
+        while((q = strchr(p, '\n')) != 0){
+  2a:	eb 44                	jmp    70 <grep+0x70>
+            *q = 0;
+  2c:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  2f:	c6 00 00             	movb   $0x0,(%eax)
+            if(match(pattern, p)){
+  32:	83 ec 08             	sub    $0x8,%esp
+  35:	ff 75 f0             	push   -0x10(%ebp)
+  38:	ff 75 08             	push   0x8(%ebp)
+  3b:	e8 8f 01 00 00       	call   1cf <match>
+  40:	83 c4 10             	add    $0x10,%esp
+  43:	85 c0                	test   %eax,%eax
+  45:	74 20                	je     67 <grep+0x67>
+                *q = '\n';
+  47:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  4a:	c6 00 0a             	movb   $0xa,(%eax)
+                write(1, p, q+1 - p);
+  4d:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  50:	83 c0 01             	add    $0x1,%eax
+  53:	2b 45 f0             	sub    -0x10(%ebp),%eax
+  56:	83 ec 04             	sub    $0x4,%esp
+  59:	50                   	push   %eax
+  5a:	ff 75 f0             	push   -0x10(%ebp)
+  5d:	6a 01                	push   $0x1
+  5f:	e8 f0 05 00 00       	call   654 <write>
+  64:	83 c4 10             	add    $0x10,%esp
+            }
+            p = q+1;
+  67:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  6a:	83 c0 01             	add    $0x1,%eax
+  6d:	89 45 f0             	mov    %eax,-0x10(%ebp)
+        while((q = strchr(p, '\n')) != 0){
+  70:	83 ec 08             	sub    $0x8,%esp
+  73:	6a 0a                	push   $0xa
+  75:	ff 75 f0             	push   -0x10(%ebp)
+  78:	e8 84 03 00 00       	call   401 <strchr>
+  7d:	83 c4 10             	add    $0x10,%esp
+  80:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  83:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+  87:	75 a3                	jne    2c <grep+0x2c>
+        }
+        if(p == buf)
+  89:	81 7d f0 40 10 00 00 	cmpl   $0x1040,-0x10(%ebp)
+  90:	75 07                	jne    99 <grep+0x99>
+            m = 0;
+  92:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+        if(m > 0){
+  99:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+  9d:	7e 21                	jle    c0 <grep+0xc0>
+            m -= p - buf;
+  9f:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  a2:	2d 40 10 00 00       	sub    $0x1040,%eax
+  a7:	29 45 f4             	sub    %eax,-0xc(%ebp)
+            memmove(buf, p, m);
+  aa:	83 ec 04             	sub    $0x4,%esp
+  ad:	ff 75 f4             	push   -0xc(%ebp)
+  b0:	ff 75 f0             	push   -0x10(%ebp)
+  b3:	68 40 10 00 00       	push   $0x1040
+  b8:	e8 d5 04 00 00       	call   592 <memmove>
+  bd:	83 c4 10             	add    $0x10,%esp
+    while((n = read(fd, buf+m, sizeof(buf)-m-1)) > 0){
+  c0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  c3:	ba ff 03 00 00       	mov    $0x3ff,%edx
+  c8:	29 c2                	sub    %eax,%edx
+  ca:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  cd:	05 40 10 00 00       	add    $0x1040,%eax
+  d2:	83 ec 04             	sub    $0x4,%esp
+  d5:	52                   	push   %edx
+  d6:	50                   	push   %eax
+  d7:	ff 75 0c             	push   0xc(%ebp)
+  da:	e8 6b 05 00 00       	call   64a <read>
+  df:	83 c4 10             	add    $0x10,%esp
+  e2:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  e5:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+  e9:	0f 8f 23 ff ff ff    	jg     12 <grep+0x12>
+        }
+    }
+}
+  ef:	90                   	nop
+  f0:	90                   	nop
+  f1:	c9                   	leave
+  f2:	c3                   	ret
+
+000000f3 <main>:
+
+int
+main(int argc, char *argv[])
+{
+  f3:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+  f7:	83 e4 f0             	and    $0xfffffff0,%esp
+  fa:	ff 71 fc             	push   -0x4(%ecx)
+  fd:	55                   	push   %ebp
+  fe:	89 e5                	mov    %esp,%ebp
+ 100:	53                   	push   %ebx
+ 101:	51                   	push   %ecx
+ 102:	83 ec 10             	sub    $0x10,%esp
+ 105:	89 cb                	mov    %ecx,%ebx
+    int fd, i;
+    char *pattern;
+
+    if(argc <= 1){
+ 107:	83 3b 01             	cmpl   $0x1,(%ebx)
+ 10a:	7f 17                	jg     123 <main+0x30>
+        printf(2, "usage: grep pattern [file ...]\n");
+ 10c:	83 ec 08             	sub    $0x8,%esp
+ 10f:	68 ec 0c 00 00       	push   $0xcec
+ 114:	6a 02                	push   $0x2
+ 116:	e8 18 08 00 00       	call   933 <printf>
+ 11b:	83 c4 10             	add    $0x10,%esp
+        exit();
+ 11e:	e8 12 05 00 00       	call   635 <exit>
+    }
+    pattern = argv[1];
+ 123:	8b 43 04             	mov    0x4(%ebx),%eax
+ 126:	8b 40 04             	mov    0x4(%eax),%eax
+ 129:	89 45 f0             	mov    %eax,-0x10(%ebp)
+
+    if(argc <= 2){
+ 12c:	83 3b 02             	cmpl   $0x2,(%ebx)
+ 12f:	7f 15                	jg     146 <main+0x53>
+        grep(pattern, 0);
+ 131:	83 ec 08             	sub    $0x8,%esp
+ 134:	6a 00                	push   $0x0
+ 136:	ff 75 f0             	push   -0x10(%ebp)
+ 139:	e8 c2 fe ff ff       	call   0 <grep>
+ 13e:	83 c4 10             	add    $0x10,%esp
+        exit();
+ 141:	e8 ef 04 00 00       	call   635 <exit>
+    }
+
+    for(i = 2; i < argc; i++){
+ 146:	c7 45 f4 02 00 00 00 	movl   $0x2,-0xc(%ebp)
+ 14d:	eb 74                	jmp    1c3 <main+0xd0>
+        if((fd = open(argv[i], 0)) < 0){
+ 14f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 152:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+ 159:	8b 43 04             	mov    0x4(%ebx),%eax
+ 15c:	01 d0                	add    %edx,%eax
+ 15e:	8b 00                	mov    (%eax),%eax
+ 160:	83 ec 08             	sub    $0x8,%esp
+ 163:	6a 00                	push   $0x0
+ 165:	50                   	push   %eax
+ 166:	e8 11 05 00 00       	call   67c <open>
+ 16b:	83 c4 10             	add    $0x10,%esp
+ 16e:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 171:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 175:	79 29                	jns    1a0 <main+0xad>
+            printf(1, "grep: cannot open %s\n", argv[i]);
+ 177:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 17a:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+ 181:	8b 43 04             	mov    0x4(%ebx),%eax
+ 184:	01 d0                	add    %edx,%eax
+ 186:	8b 00                	mov    (%eax),%eax
+ 188:	83 ec 04             	sub    $0x4,%esp
+ 18b:	50                   	push   %eax
+ 18c:	68 0c 0d 00 00       	push   $0xd0c
+ 191:	6a 01                	push   $0x1
+ 193:	e8 9b 07 00 00       	call   933 <printf>
+ 198:	83 c4 10             	add    $0x10,%esp
+            exit();
+ 19b:	e8 95 04 00 00       	call   635 <exit>
+        }
+        grep(pattern, fd);
+ 1a0:	83 ec 08             	sub    $0x8,%esp
+ 1a3:	ff 75 ec             	push   -0x14(%ebp)
+ 1a6:	ff 75 f0             	push   -0x10(%ebp)
+ 1a9:	e8 52 fe ff ff       	call   0 <grep>
+ 1ae:	83 c4 10             	add    $0x10,%esp
+        close(fd);
+ 1b1:	83 ec 0c             	sub    $0xc,%esp
+ 1b4:	ff 75 ec             	push   -0x14(%ebp)
+ 1b7:	e8 a2 04 00 00       	call   65e <close>
+ 1bc:	83 c4 10             	add    $0x10,%esp
+    for(i = 2; i < argc; i++){
+ 1bf:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+ 1c3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 1c6:	3b 03                	cmp    (%ebx),%eax
+ 1c8:	7c 85                	jl     14f <main+0x5c>
+    }
+    exit();
+ 1ca:	e8 66 04 00 00       	call   635 <exit>
+
+000001cf <match>:
+int matchhere(char*, char*);
+int matchstar(int, char*, char*);
+
+int
+match(char *re, char *text)
+{
+ 1cf:	55                   	push   %ebp
+ 1d0:	89 e5                	mov    %esp,%ebp
+ 1d2:	83 ec 08             	sub    $0x8,%esp
+    if(re[0] == '^')
+ 1d5:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1d8:	0f b6 00             	movzbl (%eax),%eax
+ 1db:	3c 5e                	cmp    $0x5e,%al
+ 1dd:	75 17                	jne    1f6 <match+0x27>
+        return matchhere(re+1, text);
+ 1df:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1e2:	83 c0 01             	add    $0x1,%eax
+ 1e5:	83 ec 08             	sub    $0x8,%esp
+ 1e8:	ff 75 0c             	push   0xc(%ebp)
+ 1eb:	50                   	push   %eax
+ 1ec:	e8 38 00 00 00       	call   229 <matchhere>
+ 1f1:	83 c4 10             	add    $0x10,%esp
+ 1f4:	eb 31                	jmp    227 <match+0x58>
+    do{    // must look at empty string
+        if(matchhere(re, text))
+ 1f6:	83 ec 08             	sub    $0x8,%esp
+ 1f9:	ff 75 0c             	push   0xc(%ebp)
+ 1fc:	ff 75 08             	push   0x8(%ebp)
+ 1ff:	e8 25 00 00 00       	call   229 <matchhere>
+ 204:	83 c4 10             	add    $0x10,%esp
+ 207:	85 c0                	test   %eax,%eax
+ 209:	74 07                	je     212 <match+0x43>
+            return 1;
+ 20b:	b8 01 00 00 00       	mov    $0x1,%eax
+ 210:	eb 15                	jmp    227 <match+0x58>
+    }while(*text++ != '\0');
+ 212:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 215:	8d 50 01             	lea    0x1(%eax),%edx
+ 218:	89 55 0c             	mov    %edx,0xc(%ebp)
+ 21b:	0f b6 00             	movzbl (%eax),%eax
+ 21e:	84 c0                	test   %al,%al
+ 220:	75 d4                	jne    1f6 <match+0x27>
+    return 0;
+ 222:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 227:	c9                   	leave
+ 228:	c3                   	ret
+
+00000229 <matchhere>:
+
+// matchhere: search for re at beginning of text
+int matchhere(char *re, char *text)
+{
+ 229:	55                   	push   %ebp
+ 22a:	89 e5                	mov    %esp,%ebp
+ 22c:	83 ec 08             	sub    $0x8,%esp
+    if(re[0] == '\0')
+ 22f:	8b 45 08             	mov    0x8(%ebp),%eax
+ 232:	0f b6 00             	movzbl (%eax),%eax
+ 235:	84 c0                	test   %al,%al
+ 237:	75 0a                	jne    243 <matchhere+0x1a>
+        return 1;
+ 239:	b8 01 00 00 00       	mov    $0x1,%eax
+ 23e:	e9 99 00 00 00       	jmp    2dc <matchhere+0xb3>
+    if(re[1] == '*')
+ 243:	8b 45 08             	mov    0x8(%ebp),%eax
+ 246:	83 c0 01             	add    $0x1,%eax
+ 249:	0f b6 00             	movzbl (%eax),%eax
+ 24c:	3c 2a                	cmp    $0x2a,%al
+ 24e:	75 21                	jne    271 <matchhere+0x48>
+        return matchstar(re[0], re+2, text);
+ 250:	8b 45 08             	mov    0x8(%ebp),%eax
+ 253:	8d 50 02             	lea    0x2(%eax),%edx
+ 256:	8b 45 08             	mov    0x8(%ebp),%eax
+ 259:	0f b6 00             	movzbl (%eax),%eax
+ 25c:	0f be c0             	movsbl %al,%eax
+ 25f:	83 ec 04             	sub    $0x4,%esp
+ 262:	ff 75 0c             	push   0xc(%ebp)
+ 265:	52                   	push   %edx
+ 266:	50                   	push   %eax
+ 267:	e8 72 00 00 00       	call   2de <matchstar>
+ 26c:	83 c4 10             	add    $0x10,%esp
+ 26f:	eb 6b                	jmp    2dc <matchhere+0xb3>
+    if(re[0] == '$' && re[1] == '\0')
+ 271:	8b 45 08             	mov    0x8(%ebp),%eax
+ 274:	0f b6 00             	movzbl (%eax),%eax
+ 277:	3c 24                	cmp    $0x24,%al
+ 279:	75 1d                	jne    298 <matchhere+0x6f>
+ 27b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 27e:	83 c0 01             	add    $0x1,%eax
+ 281:	0f b6 00             	movzbl (%eax),%eax
+ 284:	84 c0                	test   %al,%al
+ 286:	75 10                	jne    298 <matchhere+0x6f>
+        return *text == '\0';
+ 288:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 28b:	0f b6 00             	movzbl (%eax),%eax
+ 28e:	84 c0                	test   %al,%al
+ 290:	0f 94 c0             	sete   %al
+ 293:	0f b6 c0             	movzbl %al,%eax
+ 296:	eb 44                	jmp    2dc <matchhere+0xb3>
+    if(*text!='\0' && (re[0]=='.' || re[0]==*text))
+ 298:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 29b:	0f b6 00             	movzbl (%eax),%eax
+ 29e:	84 c0                	test   %al,%al
+ 2a0:	74 35                	je     2d7 <matchhere+0xae>
+ 2a2:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2a5:	0f b6 00             	movzbl (%eax),%eax
+ 2a8:	3c 2e                	cmp    $0x2e,%al
+ 2aa:	74 10                	je     2bc <matchhere+0x93>
+ 2ac:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2af:	0f b6 10             	movzbl (%eax),%edx
+ 2b2:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 2b5:	0f b6 00             	movzbl (%eax),%eax
+ 2b8:	38 c2                	cmp    %al,%dl
+ 2ba:	75 1b                	jne    2d7 <matchhere+0xae>
+        return matchhere(re+1, text+1);
+ 2bc:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 2bf:	8d 50 01             	lea    0x1(%eax),%edx
+ 2c2:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2c5:	83 c0 01             	add    $0x1,%eax
+ 2c8:	83 ec 08             	sub    $0x8,%esp
+ 2cb:	52                   	push   %edx
+ 2cc:	50                   	push   %eax
+ 2cd:	e8 57 ff ff ff       	call   229 <matchhere>
+ 2d2:	83 c4 10             	add    $0x10,%esp
+ 2d5:	eb 05                	jmp    2dc <matchhere+0xb3>
+    return 0;
+ 2d7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 2dc:	c9                   	leave
+ 2dd:	c3                   	ret
+
+000002de <matchstar>:
+
+// matchstar: search for c*re at beginning of text
+int matchstar(int c, char *re, char *text)
+{
+ 2de:	55                   	push   %ebp
+ 2df:	89 e5                	mov    %esp,%ebp
+ 2e1:	83 ec 08             	sub    $0x8,%esp
+    do{    // a * matches zero or more instances
+        if(matchhere(re, text))
+ 2e4:	83 ec 08             	sub    $0x8,%esp
+ 2e7:	ff 75 10             	push   0x10(%ebp)
+ 2ea:	ff 75 0c             	push   0xc(%ebp)
+ 2ed:	e8 37 ff ff ff       	call   229 <matchhere>
+ 2f2:	83 c4 10             	add    $0x10,%esp
+ 2f5:	85 c0                	test   %eax,%eax
+ 2f7:	74 07                	je     300 <matchstar+0x22>
+            return 1;
+ 2f9:	b8 01 00 00 00       	mov    $0x1,%eax
+ 2fe:	eb 29                	jmp    329 <matchstar+0x4b>
+    }while(*text!='\0' && (*text++==c || c=='.'));
+ 300:	8b 45 10             	mov    0x10(%ebp),%eax
+ 303:	0f b6 00             	movzbl (%eax),%eax
+ 306:	84 c0                	test   %al,%al
+ 308:	74 1a                	je     324 <matchstar+0x46>
+ 30a:	8b 45 10             	mov    0x10(%ebp),%eax
+ 30d:	8d 50 01             	lea    0x1(%eax),%edx
+ 310:	89 55 10             	mov    %edx,0x10(%ebp)
+ 313:	0f b6 00             	movzbl (%eax),%eax
+ 316:	0f be c0             	movsbl %al,%eax
+ 319:	39 45 08             	cmp    %eax,0x8(%ebp)
+ 31c:	74 c6                	je     2e4 <matchstar+0x6>
+ 31e:	83 7d 08 2e          	cmpl   $0x2e,0x8(%ebp)
+ 322:	74 c0                	je     2e4 <matchstar+0x6>
+    return 0;
+ 324:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 329:	c9                   	leave
+ 32a:	c3                   	ret
+
+0000032b <stosb>:
+strchr(const char *s, char c)
+{
+    for(; *s; s++)
+        if(*s == c)
+            return (char*)s;
+    return 0;
+ 32b:	55                   	push   %ebp
+ 32c:	89 e5                	mov    %esp,%ebp
+ 32e:	57                   	push   %edi
+ 32f:	53                   	push   %ebx
+}
+ 330:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 333:	8b 55 10             	mov    0x10(%ebp),%edx
+ 336:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 339:	89 cb                	mov    %ecx,%ebx
+ 33b:	89 df                	mov    %ebx,%edi
+ 33d:	89 d1                	mov    %edx,%ecx
+ 33f:	fc                   	cld
+ 340:	f3 aa                	rep stos %al,%es:(%edi)
+ 342:	89 ca                	mov    %ecx,%edx
+ 344:	89 fb                	mov    %edi,%ebx
+ 346:	89 5d 08             	mov    %ebx,0x8(%ebp)
+ 349:	89 55 10             	mov    %edx,0x10(%ebp)
+
+char*
+gets(char *buf, int max)
+{
+ 34c:	90                   	nop
+ 34d:	5b                   	pop    %ebx
+ 34e:	5f                   	pop    %edi
+ 34f:	5d                   	pop    %ebp
+ 350:	c3                   	ret
+
+00000351 <strcpy>:
+{
+ 351:	55                   	push   %ebp
+ 352:	89 e5                	mov    %esp,%ebp
+ 354:	83 ec 10             	sub    $0x10,%esp
+    os = s;
+ 357:	8b 45 08             	mov    0x8(%ebp),%eax
+ 35a:	89 45 fc             	mov    %eax,-0x4(%ebp)
+    while((*s++ = *t++) != 0)
+ 35d:	90                   	nop
+ 35e:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 361:	8d 42 01             	lea    0x1(%edx),%eax
+ 364:	89 45 0c             	mov    %eax,0xc(%ebp)
+ 367:	8b 45 08             	mov    0x8(%ebp),%eax
+ 36a:	8d 48 01             	lea    0x1(%eax),%ecx
+ 36d:	89 4d 08             	mov    %ecx,0x8(%ebp)
+ 370:	0f b6 12             	movzbl (%edx),%edx
+ 373:	88 10                	mov    %dl,(%eax)
+ 375:	0f b6 00             	movzbl (%eax),%eax
+ 378:	84 c0                	test   %al,%al
+ 37a:	75 e2                	jne    35e <strcpy+0xd>
+    return os;
+ 37c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 37f:	c9                   	leave
+ 380:	c3                   	ret
+
+00000381 <strcmp>:
+{
+ 381:	55                   	push   %ebp
+ 382:	89 e5                	mov    %esp,%ebp
+    while(*p && *p == *q)
+ 384:	eb 08                	jmp    38e <strcmp+0xd>
+        p++, q++;
+ 386:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 38a:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+    while(*p && *p == *q)
+ 38e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 391:	0f b6 00             	movzbl (%eax),%eax
+ 394:	84 c0                	test   %al,%al
+ 396:	74 10                	je     3a8 <strcmp+0x27>
+ 398:	8b 45 08             	mov    0x8(%ebp),%eax
+ 39b:	0f b6 10             	movzbl (%eax),%edx
+ 39e:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 3a1:	0f b6 00             	movzbl (%eax),%eax
+ 3a4:	38 c2                	cmp    %al,%dl
+ 3a6:	74 de                	je     386 <strcmp+0x5>
+    return (uchar)*p - (uchar)*q;
+ 3a8:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3ab:	0f b6 00             	movzbl (%eax),%eax
+ 3ae:	0f b6 d0             	movzbl %al,%edx
+ 3b1:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 3b4:	0f b6 00             	movzbl (%eax),%eax
+ 3b7:	0f b6 c0             	movzbl %al,%eax
+ 3ba:	29 c2                	sub    %eax,%edx
+ 3bc:	89 d0                	mov    %edx,%eax
+}
+ 3be:	5d                   	pop    %ebp
+ 3bf:	c3                   	ret
+
+000003c0 <strlen>:
+{
+ 3c0:	55                   	push   %ebp
+ 3c1:	89 e5                	mov    %esp,%ebp
+ 3c3:	83 ec 10             	sub    $0x10,%esp
+    for(n = 0; s[n]; n++)
+ 3c6:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ 3cd:	eb 04                	jmp    3d3 <strlen+0x13>
+ 3cf:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 3d3:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 3d6:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3d9:	01 d0                	add    %edx,%eax
+ 3db:	0f b6 00             	movzbl (%eax),%eax
+ 3de:	84 c0                	test   %al,%al
+ 3e0:	75 ed                	jne    3cf <strlen+0xf>
+    return n;
+ 3e2:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 3e5:	c9                   	leave
+ 3e6:	c3                   	ret
+
+000003e7 <memset>:
+{
+ 3e7:	55                   	push   %ebp
+ 3e8:	89 e5                	mov    %esp,%ebp
+    stosb(dst, c, n);
+ 3ea:	8b 45 10             	mov    0x10(%ebp),%eax
+ 3ed:	50                   	push   %eax
+ 3ee:	ff 75 0c             	push   0xc(%ebp)
+ 3f1:	ff 75 08             	push   0x8(%ebp)
+ 3f4:	e8 32 ff ff ff       	call   32b <stosb>
+ 3f9:	83 c4 0c             	add    $0xc,%esp
+    return dst;
+ 3fc:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 3ff:	c9                   	leave
+ 400:	c3                   	ret
+
+00000401 <strchr>:
+{
+ 401:	55                   	push   %ebp
+ 402:	89 e5                	mov    %esp,%ebp
+ 404:	83 ec 04             	sub    $0x4,%esp
+ 407:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 40a:	88 45 fc             	mov    %al,-0x4(%ebp)
+    for(; *s; s++)
+ 40d:	eb 14                	jmp    423 <strchr+0x22>
+        if(*s == c)
+ 40f:	8b 45 08             	mov    0x8(%ebp),%eax
+ 412:	0f b6 00             	movzbl (%eax),%eax
+ 415:	38 45 fc             	cmp    %al,-0x4(%ebp)
+ 418:	75 05                	jne    41f <strchr+0x1e>
+            return (char*)s;
+ 41a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 41d:	eb 13                	jmp    432 <strchr+0x31>
+    for(; *s; s++)
+ 41f:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 423:	8b 45 08             	mov    0x8(%ebp),%eax
+ 426:	0f b6 00             	movzbl (%eax),%eax
+ 429:	84 c0                	test   %al,%al
+ 42b:	75 e2                	jne    40f <strchr+0xe>
+    return 0;
+ 42d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 432:	c9                   	leave
+ 433:	c3                   	ret
+
+00000434 <gets>:
+{
+ 434:	55                   	push   %ebp
+ 435:	89 e5                	mov    %esp,%ebp
+ 437:	83 ec 18             	sub    $0x18,%esp
+    int i, cc;
+    char c;
+
+    for(i=0; i+1 < max; ){
+ 43a:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 441:	eb 42                	jmp    485 <gets+0x51>
+        cc = read(0, &c, 1);
+ 443:	83 ec 04             	sub    $0x4,%esp
+ 446:	6a 01                	push   $0x1
+ 448:	8d 45 ef             	lea    -0x11(%ebp),%eax
+ 44b:	50                   	push   %eax
+ 44c:	6a 00                	push   $0x0
+ 44e:	e8 f7 01 00 00       	call   64a <read>
+ 453:	83 c4 10             	add    $0x10,%esp
+ 456:	89 45 f0             	mov    %eax,-0x10(%ebp)
+        if(cc < 1)
+ 459:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 45d:	7e 33                	jle    492 <gets+0x5e>
+            break;
+        buf[i++] = c;
+ 45f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 462:	8d 50 01             	lea    0x1(%eax),%edx
+ 465:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 468:	89 c2                	mov    %eax,%edx
+ 46a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 46d:	01 c2                	add    %eax,%edx
+ 46f:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 473:	88 02                	mov    %al,(%edx)
+        if(c == '\n' || c == '\r')
+ 475:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 479:	3c 0a                	cmp    $0xa,%al
+ 47b:	74 16                	je     493 <gets+0x5f>
+ 47d:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 481:	3c 0d                	cmp    $0xd,%al
+ 483:	74 0e                	je     493 <gets+0x5f>
+    for(i=0; i+1 < max; ){
+ 485:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 488:	83 c0 01             	add    $0x1,%eax
+ 48b:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 48e:	7f b3                	jg     443 <gets+0xf>
+ 490:	eb 01                	jmp    493 <gets+0x5f>
+            break;
+ 492:	90                   	nop
+            break;
+    }
+    buf[i] = '\0';
+ 493:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 496:	8b 45 08             	mov    0x8(%ebp),%eax
+ 499:	01 d0                	add    %edx,%eax
+ 49b:	c6 00 00             	movb   $0x0,(%eax)
+    return buf;
+ 49e:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 4a1:	c9                   	leave
+ 4a2:	c3                   	ret
+
+000004a3 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 4a3:	55                   	push   %ebp
+ 4a4:	89 e5                	mov    %esp,%ebp
+ 4a6:	83 ec 18             	sub    $0x18,%esp
+    int fd;
+    int r;
+
+    fd = open(n, O_RDONLY);
+ 4a9:	83 ec 08             	sub    $0x8,%esp
+ 4ac:	6a 00                	push   $0x0
+ 4ae:	ff 75 08             	push   0x8(%ebp)
+ 4b1:	e8 c6 01 00 00       	call   67c <open>
+ 4b6:	83 c4 10             	add    $0x10,%esp
+ 4b9:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(fd < 0)
+ 4bc:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 4c0:	79 07                	jns    4c9 <stat+0x26>
+        return -1;
+ 4c2:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 4c7:	eb 25                	jmp    4ee <stat+0x4b>
+    r = fstat(fd, st);
+ 4c9:	83 ec 08             	sub    $0x8,%esp
+ 4cc:	ff 75 0c             	push   0xc(%ebp)
+ 4cf:	ff 75 f4             	push   -0xc(%ebp)
+ 4d2:	e8 c3 01 00 00       	call   69a <fstat>
+ 4d7:	83 c4 10             	add    $0x10,%esp
+ 4da:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    close(fd);
+ 4dd:	83 ec 0c             	sub    $0xc,%esp
+ 4e0:	ff 75 f4             	push   -0xc(%ebp)
+ 4e3:	e8 76 01 00 00       	call   65e <close>
+ 4e8:	83 c4 10             	add    $0x10,%esp
+    return r;
+ 4eb:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ 4ee:	c9                   	leave
+ 4ef:	c3                   	ret
+
+000004f0 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 4f0:	55                   	push   %ebp
+ 4f1:	89 e5                	mov    %esp,%ebp
+ 4f3:	83 ec 10             	sub    $0x10,%esp
+    int n;
+
+    n = 0;
+ 4f6:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+    while('0' <= *s && *s <= '9')
+ 4fd:	eb 25                	jmp    524 <atoi+0x34>
+        n = n*10 + *s++ - '0';
+ 4ff:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 502:	89 d0                	mov    %edx,%eax
+ 504:	c1 e0 02             	shl    $0x2,%eax
+ 507:	01 d0                	add    %edx,%eax
+ 509:	01 c0                	add    %eax,%eax
+ 50b:	89 c1                	mov    %eax,%ecx
+ 50d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 510:	8d 50 01             	lea    0x1(%eax),%edx
+ 513:	89 55 08             	mov    %edx,0x8(%ebp)
+ 516:	0f b6 00             	movzbl (%eax),%eax
+ 519:	0f be c0             	movsbl %al,%eax
+ 51c:	01 c8                	add    %ecx,%eax
+ 51e:	83 e8 30             	sub    $0x30,%eax
+ 521:	89 45 fc             	mov    %eax,-0x4(%ebp)
+    while('0' <= *s && *s <= '9')
+ 524:	8b 45 08             	mov    0x8(%ebp),%eax
+ 527:	0f b6 00             	movzbl (%eax),%eax
+ 52a:	3c 2f                	cmp    $0x2f,%al
+ 52c:	7e 0a                	jle    538 <atoi+0x48>
+ 52e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 531:	0f b6 00             	movzbl (%eax),%eax
+ 534:	3c 39                	cmp    $0x39,%al
+ 536:	7e c7                	jle    4ff <atoi+0xf>
+    return n;
+ 538:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 53b:	c9                   	leave
+ 53c:	c3                   	ret
+
+0000053d <nice>:
+
+// Add inc to the caller's nice value; return the new value.
+int
+nice(int inc)
+{
+ 53d:	55                   	push   %ebp
+ 53e:	89 e5                	mov    %esp,%ebp
+ 540:	83 ec 18             	sub    $0x18,%esp
+    int n;
+
+    n = getpriority(0) + inc;
+ 543:	83 ec 0c             	sub    $0xc,%esp
+ 546:	6a 00                	push   $0x0
+ 548:	e8 d9 01 00 00       	call   726 <getpriority>
+ 54d:	83 c4 10             	add    $0x10,%esp
+ 550:	8b 55 08             	mov    0x8(%ebp),%edx
+ 553:	01 d0                	add    %edx,%eax
+ 555:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(n < 0)
+ 558:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 55c:	79 07                	jns    565 <nice+0x28>
+        n = 0;
+ 55e:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    if(n > NICEMAX)
+ 565:	83 7d f4 13          	cmpl   $0x13,-0xc(%ebp)
+ 569:	7e 07                	jle    572 <nice+0x35>
+        n = NICEMAX;
+ 56b:	c7 45 f4 13 00 00 00 	movl   $0x13,-0xc(%ebp)
+    if(setpriority(0, n) < 0)
+ 572:	83 ec 08             	sub    $0x8,%esp
+ 575:	ff 75 f4             	push   -0xc(%ebp)
+ 578:	6a 00                	push   $0x0
+ 57a:	e8 b1 01 00 00       	call   730 <setpriority>
+ 57f:	83 c4 10             	add    $0x10,%esp
+ 582:	85 c0                	test   %eax,%eax
+ 584:	79 07                	jns    58d <nice+0x50>
+        return -1;
+ 586:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 58b:	eb 03                	jmp    590 <nice+0x53>
+    return n;
+ 58d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+ 590:	c9                   	leave
+ 591:	c3                   	ret
+
+00000592 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 592:	55                   	push   %ebp
+ 593:	89 e5                	mov    %esp,%ebp
+ 595:	83 ec 10             	sub    $0x10,%esp
+    char *dst;
+    const char *src;
+
+    dst = vdst;
+ 598:	8b 45 08             	mov    0x8(%ebp),%eax
+ 59b:	89 45 fc             	mov    %eax,-0x4(%ebp)
+    src = vsrc;
+ 59e:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 5a1:	89 45 f8             	mov    %eax,-0x8(%ebp)
+    while(n-- > 0)
+ 5a4:	eb 17                	jmp    5bd <memmove+0x2b>
+        *dst++ = *src++;
+ 5a6:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 5a9:	8d 42 01             	lea    0x1(%edx),%eax
+ 5ac:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 5af:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 5b2:	8d 48 01             	lea    0x1(%eax),%ecx
+ 5b5:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+ 5b8:	0f b6 12             	movzbl (%edx),%edx
+ 5bb:	88 10                	mov    %dl,(%eax)
+    while(n-- > 0)
+ 5bd:	8b 45 10             	mov    0x10(%ebp),%eax
+ 5c0:	8d 50 ff             	lea    -0x1(%eax),%edx
+ 5c3:	89 55 10             	mov    %edx,0x10(%ebp)
+ 5c6:	85 c0                	test   %eax,%eax
+ 5c8:	7f dc                	jg     5a6 <memmove+0x14>
+    return vdst;
+ 5ca:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 5cd:	c9                   	leave
+ 5ce:	c3                   	ret
+
+000005cf <dosyscall>:
+sysmode:
+    .long 0
+
+    .text
+dosyscall:
+    cmpl $0, sysmode
+ 5cf:	83 3d 14 10 00 00 00 	cmpl   $0x0,0x1014
+    jg 2f
+ 5d6:	7f 0c                	jg     5e4 <dosyscall+0x15>
+    jl 1f
+ 5d8:	7c 07                	jl     5e1 <dosyscall+0x12>
+    call sepcheck
+ 5da:	e8 27 00 00 00       	call   606 <sepcheck>
+    jmp dosyscall
+ 5df:	eb ee                	jmp    5cf <dosyscall>
+1:
+    int $T_SYSCALL
+ 5e1:	cd 40                	int    $0x40
+    ret
+ 5e3:	c3                   	ret
+2:
+    pushl %ebx
+ 5e4:	53                   	push   %ebx
+    pushl %esi
+ 5e5:	56                   	push   %esi
+    pushl %edi
+ 5e6:	57                   	push   %edi
+    pushl %ebp
+ 5e7:	55                   	push   %ebp
+    movl 20(%esp), %ebx
+ 5e8:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+    movl 24(%esp), %esi
+ 5ec:	8b 74 24 18          	mov    0x18(%esp),%esi
+    movl 28(%esp), %edi
+ 5f0:	8b 7c 24 1c          	mov    0x1c(%esp),%edi
+    movl 32(%esp), %ebp
+ 5f4:	8b 6c 24 20          	mov    0x20(%esp),%ebp
+    movl %esp, %ecx
+ 5f8:	89 e1                	mov    %esp,%ecx
+    movl $3f, %edx
+ 5fa:	ba 01 06 00 00       	mov    $0x601,%edx
+    sysenter
+ 5ff:	0f 34                	sysenter
+3:
+    popl %ebp
+ 601:	5d                   	pop    %ebp
+    popl %edi
+ 602:	5f                   	pop    %edi
+    popl %esi
+ 603:	5e                   	pop    %esi
+    popl %ebx
+ 604:	5b                   	pop    %ebx
+    ret
+ 605:	c3                   	ret
+
+00000606 <sepcheck>:
+
+# Set sysmode from cpuid's SEP flag.    Preserves %eax.
+sepcheck:
+    pushl %eax
+ 606:	50                   	push   %eax
+    pushl %ebx
+ 607:	53                   	push   %ebx
+    movl $1, %eax
+ 608:	b8 01 00 00 00       	mov    $0x1,%eax
+    cpuid
+ 60d:	0f a2                	cpuid
+    movl $-1, sysmode
+ 60f:	c7 05 14 10 00 00 ff 	movl   $0xffffffff,0x1014
+ 616:	ff ff ff 
+    testl $0x800, %edx
+ 619:	f7 c2 00 08 00 00    	test   $0x800,%edx
+    jz 1f
+ 61f:	74 0a                	je     62b <sepcheck+0x25>
+    movl $1, sysmode
+ 621:	c7 05 14 10 00 00 01 	movl   $0x1,0x1014
+ 628:	00 00 00 
+1:
+    popl %ebx
+ 62b:	5b                   	pop    %ebx
+    popl %eax
+ 62c:	58                   	pop    %eax
+    ret
+ 62d:	c3                   	ret
+
+0000062e <fork>:
+
+SYSCALL(fork)
+ 62e:	b8 01 00 00 00       	mov    $0x1,%eax
+ 633:	eb 9a                	jmp    5cf <dosyscall>
+
+00000635 <exit>:
+SYSCALL(exit)
+ 635:	b8 02 00 00 00       	mov    $0x2,%eax
+ 63a:	eb 93                	jmp    5cf <dosyscall>
+
+0000063c <wait>:
+SYSCALL(wait)
+ 63c:	b8 03 00 00 00       	mov    $0x3,%eax
+ 641:	eb 8c                	jmp    5cf <dosyscall>
+
+00000643 <pipe>:
+SYSCALL(pipe)
+ 643:	b8 04 00 00 00       	mov    $0x4,%eax
+ 648:	eb 85                	jmp    5cf <dosyscall>
+
+0000064a <read>:
+SYSCALL(read)
+ 64a:	b8 05 00 00 00       	mov    $0x5,%eax
+ 64f:	e9 7b ff ff ff       	jmp    5cf <dosyscall>
+
+00000654 <write>:
+SYSCALL(write)
+ 654:	b8 10 00 00 00       	mov    $0x10,%eax
+ 659:	e9 71 ff ff ff       	jmp    5cf <dosyscall>
+
+0000065e <close>:
+SYSCALL(close)
+ 65e:	b8 15 00 00 00       	mov    $0x15,%eax
+ 663:	e9 67 ff ff ff       	jmp    5cf <dosyscall>
+
+00000668 <kill>:
+SYSCALL(kill)
+ 668:	b8 06 00 00 00       	mov    $0x6,%eax
+ 66d:	e9 5d ff ff ff       	jmp    5cf <dosyscall>
+
+00000672 <exec>:
+SYSCALL(exec)
+ 672:	b8 07 00 00 00       	mov    $0x7,%eax
+ 677:	e9 53 ff ff ff       	jmp    5cf <dosyscall>
+
+0000067c <open>:
+SYSCALL(open)
+ 67c:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 681:	e9 49 ff ff ff       	jmp    5cf <dosyscall>
+
+00000686 <mknod>:
+SYSCALL(mknod)
+ 686:	b8 11 00 00 00       	mov    $0x11,%eax
+ 68b:	e9 3f ff ff ff       	jmp    5cf <dosyscall>
+
+00000690 <unlink>:
+SYSCALL(unlink)
+ 690:	b8 12 00 00 00       	mov    $0x12,%eax
+ 695:	e9 35 ff ff ff       	jmp    5cf <dosyscall>
+
+0000069a <fstat>:
+SYSCALL(fstat)
+ 69a:	b8 08 00 00 00       	mov    $0x8,%eax
+ 69f:	e9 2b ff ff ff       	jmp    5cf <dosyscall>
+
+000006a4 <link>:
+SYSCALL(link)
+ 6a4:	b8 13 00 00 00       	mov    $0x13,%eax
+ 6a9:	e9 21 ff ff ff       	jmp    5cf <dosyscall>
+
+000006ae <mkdir>:
+SYSCALL(mkdir)
+ 6ae:	b8 14 00 00 00       	mov    $0x14,%eax
+ 6b3:	e9 17 ff ff ff       	jmp    5cf <dosyscall>
+
+000006b8 <chdir>:
+SYSCALL(chdir)
+ 6b8:	b8 09 00 00 00       	mov    $0x9,%eax
+ 6bd:	e9 0d ff ff ff       	jmp    5cf <dosyscall>
+
+000006c2 <dup>:
+SYSCALL(dup)
+ 6c2:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 6c7:	e9 03 ff ff ff       	jmp    5cf <dosyscall>
+
+000006cc <getpid>:
+SYSCALL(getpid)
+ 6cc:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 6d1:	e9 f9 fe ff ff       	jmp    5cf <dosyscall>
+
+000006d6 <sbrk>:
+SYSCALL(sbrk)
+ 6d6:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 6db:	e9 ef fe ff ff       	jmp    5cf <dosyscall>
+
+000006e0 <sleep>:
+SYSCALL(sleep)
+ 6e0:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 6e5:	e9 e5 fe ff ff       	jmp    5cf <dosyscall>
+
+000006ea <uptime>:
+SYSCALL(uptime)
+ 6ea:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 6ef:	e9 db fe ff ff       	jmp    5cf <dosyscall>
+
+000006f4 <date>:
+SYSCALL(date)
+ 6f4:	b8 16 00 00 00       	mov    $0x16,%eax
+ 6f9:	e9 d1 fe ff ff       	jmp    5cf <dosyscall>
+
+000006fe <dup2>:
+SYSCALL(dup2)
+ 6fe:	b8 17 00 00 00       	mov    $0x17,%eax
+ 703:	e9 c7 fe ff ff       	jmp    5cf <dosyscall>
+
+00000708 <uffd>:
+SYSCALL(uffd)
+ 708:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 70d:	e9 bd fe ff ff       	jmp    5cf <dosyscall>
+
+00000712 <uffdregister>:
+SYSCALL(uffdregister)
+ 712:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 717:	e9 b3 fe ff ff       	jmp    5cf <dosyscall>
+
+0000071c <uffdcopy>:
+SYSCALL(uffdcopy)
+ 71c:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 721:	e9 a9 fe ff ff       	jmp    5cf <dosyscall>
+
+00000726 <getpriority>:
+SYSCALL(getpriority)
+ 726:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 72b:	e9 9f fe ff ff       	jmp    5cf <dosyscall>
+
+00000730 <setpriority>:
+SYSCALL(setpriority)
+ 730:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 735:	e9 95 fe ff ff       	jmp    5cf <dosyscall>
+
+0000073a <setweight>:
+SYSCALL(setweight)
+ 73a:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 73f:	e9 8b fe ff ff       	jmp    5cf <dosyscall>
+
+00000744 <setgroup>:
+SYSCALL(setgroup)
+ 744:	b8 20 00 00 00       	mov    $0x20,%eax
+ 749:	e9 81 fe ff ff       	jmp    5cf <dosyscall>
+
+0000074e <schedinfo>:
+SYSCALL(schedinfo)
+ 74e:	b8 21 00 00 00       	mov    $0x21,%eax
+ 753:	e9 77 fe ff ff       	jmp    5cf <dosyscall>
+
+00000758 <nanosleep>:
+SYSCALL(nanosleep)
+ 758:	b8 22 00 00 00       	mov    $0x22,%eax
+ 75d:	e9 6d fe ff ff       	jmp    5cf <dosyscall>
+
+00000762 <clock_nanosleep>:
+SYSCALL(clock_nanosleep)
+ 762:	b8 23 00 00 00       	mov    $0x23,%eax
+ 767:	e9 63 fe ff ff       	jmp    5cf <dosyscall>
+
+0000076c <clock_gettime>:
+SYSCALL(clock_gettime)
+ 76c:	b8 24 00 00 00       	mov    $0x24,%eax
+ 771:	e9 59 fe ff ff       	jmp    5cf <dosyscall>
+
+00000776 <sched_setaffinity>:
+SYSCALL(sched_setaffinity)
+ 776:	b8 25 00 00 00       	mov    $0x25,%eax
+ 77b:	e9 4f fe ff ff       	jmp    5cf <dosyscall>
+
+00000780 <sched_getaffinity>:
+SYSCALL(sched_getaffinity)
+ 780:	b8 26 00 00 00       	mov    $0x26,%eax
+ 785:	e9 45 fe ff ff       	jmp    5cf <dosyscall>
+
+0000078a <irqaffinity>:
+SYSCALL(irqaffinity)
+ 78a:	b8 27 00 00 00       	mov    $0x27,%eax
+ 78f:	e9 3b fe ff ff       	jmp    5cf <dosyscall>
+
+00000794 <getrusage>:
+SYSCALL(getrusage)
+ 794:	b8 28 00 00 00       	mov    $0x28,%eax
+ 799:	e9 31 fe ff ff       	jmp    5cf <dosyscall>
+
+0000079e <times>:
+SYSCALL(times)
+ 79e:	b8 29 00 00 00       	mov    $0x29,%eax
+ 7a3:	e9 27 fe ff ff       	jmp    5cf <dosyscall>
+
+000007a8 <schedlat>:
+SYSCALL(schedlat)
+ 7a8:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 7ad:	e9 1d fe ff ff       	jmp    5cf <dosyscall>
+
+000007b2 <sched_setscheduler>:
+SYSCALL(sched_setscheduler)
+ 7b2:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 7b7:	e9 13 fe ff ff       	jmp    5cf <dosyscall>
+
+000007bc <sched_getscheduler>:
+SYSCALL(sched_getscheduler)
+ 7bc:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 7c1:	e9 09 fe ff ff       	jmp    5cf <dosyscall>
+
+000007c6 <sched_getparam>:
+SYSCALL(sched_getparam)
+ 7c6:	b8 2d 00 00 00       	mov    $0x2d,%eax
+ 7cb:	e9 ff fd ff ff       	jmp    5cf <dosyscall>
+
+000007d0 <lockstat>:
+SYSCALL(lockstat)
+ 7d0:	b8 2e 00 00 00       	mov    $0x2e,%eax
+ 7d5:	e9 f5 fd ff ff       	jmp    5cf <dosyscall>
+
+000007da <ioring_setup>:
+SYSCALL(ioring_setup)
+ 7da:	b8 2f 00 00 00       	mov    $0x2f,%eax
+ 7df:	e9 eb fd ff ff       	jmp    5cf <dosyscall>
+
+000007e4 <ioring_enter>:
+SYSCALL(ioring_enter)
+ 7e4:	b8 30 00 00 00       	mov    $0x30,%eax
+ 7e9:	e9 e1 fd ff ff       	jmp    5cf <dosyscall>
+
+000007ee <readv>:
+SYSCALL(readv)
+ 7ee:	b8 31 00 00 00       	mov    $0x31,%eax
+ 7f3:	e9 d7 fd ff ff       	jmp    5cf <dosyscall>
+
+000007f8 <writev>:
+SYSCALL(writev)
+ 7f8:	b8 32 00 00 00       	mov    $0x32,%eax
+ 7fd:	e9 cd fd ff ff       	jmp    5cf <dosyscall>
+
+00000802 <pread>:
+SYSCALL(pread)
+ 802:	b8 33 00 00 00       	mov    $0x33,%eax
+ 807:	e9 c3 fd ff ff       	jmp    5cf <dosyscall>
+
+0000080c <pwrite>:
+SYSCALL(pwrite)
+ 80c:	b8 34 00 00 00       	mov    $0x34,%eax
+ 811:	e9 b9 fd ff ff       	jmp    5cf <dosyscall>
+
+00000816 <sendfile>:
+SYSCALL(sendfile)
+ 816:	b8 35 00 00 00       	mov    $0x35,%eax
+ 81b:	e9 af fd ff ff       	jmp    5cf <dosyscall>
+
+00000820 <splice>:
+SYSCALL(splice)
+ 820:	b8 36 00 00 00       	mov    $0x36,%eax
+ 825:	e9 a5 fd ff ff       	jmp    5cf <dosyscall>
+
+0000082a <sysstat>:
+SYSCALL(sysstat)
+ 82a:	b8 37 00 00 00       	mov    $0x37,%eax
+ 82f:	e9 9b fd ff ff       	jmp    5cf <dosyscall>
+
+00000834 <strace>:
+SYSCALL(strace)
+ 834:	b8 38 00 00 00       	mov    $0x38,%eax
+ 839:	e9 91 fd ff ff       	jmp    5cf <dosyscall>
+
+0000083e <straceread>:
+SYSCALL(straceread)
+ 83e:	b8 39 00 00 00       	mov    $0x39,%eax
+ 843:	e9 87 fd ff ff       	jmp    5cf <dosyscall>
+
+00000848 <alarm>:
+
+# alarm and rstoregs keep to int $T_SYSCALL: rstoregs restores
+# %ecx and %edx, which sysexit would clobber.
+.globl alarm
+    alarm:
+        pushl $rstoregs
+ 848:	68 58 08 00 00       	push   $0x858
+        movl $SYS_alarm, %eax
+ 84d:	b8 18 00 00 00       	mov    $0x18,%eax
+        int $T_SYSCALL
+ 852:	cd 40                	int    $0x40
+        add $0x04, %esp
+ 854:	83 c4 04             	add    $0x4,%esp
+        ret
+ 857:	c3                   	ret
+
+00000858 <rstoregs>:
+
+.globl rstoregs
+    rstoregs:
+        movl $SYS_rstoregs, %eax
+ 858:	b8 19 00 00 00       	mov    $0x19,%eax
+        int $T_SYSCALL
+ 85d:	cd 40                	int    $0x40
+
+0000085f <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 85f:	55                   	push   %ebp
+ 860:	89 e5                	mov    %esp,%ebp
+ 862:	83 ec 18             	sub    $0x18,%esp
+ 865:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 868:	88 45 f4             	mov    %al,-0xc(%ebp)
+    write(fd, &c, 1);
+ 86b:	83 ec 04             	sub    $0x4,%esp
+ 86e:	6a 01                	push   $0x1
+ 870:	8d 45 f4             	lea    -0xc(%ebp),%eax
+ 873:	50                   	push   %eax
+ 874:	ff 75 08             	push   0x8(%ebp)
+ 877:	e8 d8 fd ff ff       	call   654 <write>
+ 87c:	83 c4 10             	add    $0x10,%esp
+}
+ 87f:	90                   	nop
+ 880:	c9                   	leave
+ 881:	c3                   	ret
+
+00000882 <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 882:	55                   	push   %ebp
+ 883:	89 e5                	mov    %esp,%ebp
+ 885:	83 ec 28             	sub    $0x28,%esp
+    static char digits[] = "0123456789ABCDEF";
+    char buf[16];
+    int i, neg;
+    uint x;
+
+    neg = 0;
+ 888:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+    if(sgn && xx < 0){
+ 88f:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+ 893:	74 17                	je     8ac <printint+0x2a>
+ 895:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 899:	79 11                	jns    8ac <printint+0x2a>
+        neg = 1;
+ 89b:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+        x = -xx;
+ 8a2:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 8a5:	f7 d8                	neg    %eax
+ 8a7:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 8aa:	eb 06                	jmp    8b2 <printint+0x30>
+    } else {
+        x = xx;
+ 8ac:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 8af:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    }
+
+    i = 0;
+ 8b2:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    do{
+        buf[i++] = digits[x % base];
+ 8b9:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 8bc:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 8bf:	ba 00 00 00 00       	mov    $0x0,%edx
+ 8c4:	f7 f1                	div    %ecx
+ 8c6:	89 d1                	mov    %edx,%ecx
+ 8c8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 8cb:	8d 50 01             	lea    0x1(%eax),%edx
+ 8ce:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 8d1:	0f b6 91 18 10 00 00 	movzbl 0x1018(%ecx),%edx
+ 8d8:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+    }while((x /= base) != 0);
+ 8dc:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 8df:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 8e2:	ba 00 00 00 00       	mov    $0x0,%edx
+ 8e7:	f7 f1                	div    %ecx
+ 8e9:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 8ec:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 8f0:	75 c7                	jne    8b9 <printint+0x37>
+    if(neg)
+ 8f2:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 8f6:	74 2d                	je     925 <printint+0xa3>
+        buf[i++] = '-';
+ 8f8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 8fb:	8d 50 01             	lea    0x1(%eax),%edx
+ 8fe:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 901:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+    while(--i >= 0)
+ 906:	eb 1d                	jmp    925 <printint+0xa3>
+        putc(fd, buf[i]);
+ 908:	8d 55 dc             	lea    -0x24(%ebp),%edx
+ 90b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 90e:	01 d0                	add    %edx,%eax
+ 910:	0f b6 00             	movzbl (%eax),%eax
+ 913:	0f be c0             	movsbl %al,%eax
+ 916:	83 ec 08             	sub    $0x8,%esp
+ 919:	50                   	push   %eax
+ 91a:	ff 75 08             	push   0x8(%ebp)
+ 91d:	e8 3d ff ff ff       	call   85f <putc>
+ 922:	83 c4 10             	add    $0x10,%esp
+    while(--i >= 0)
+ 925:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+ 929:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 92d:	79 d9                	jns    908 <printint+0x86>
+}
+ 92f:	90                   	nop
+ 930:	90                   	nop
+ 931:	c9                   	leave
+ 932:	c3                   	ret
+
+00000933 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 933:	55                   	push   %ebp
+ 934:	89 e5                	mov    %esp,%ebp
+ 936:	83 ec 28             	sub    $0x28,%esp
+    char *s;
+    int c, i, state;
+    uint *ap;
+
+    state = 0;
+ 939:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+    ap = (uint*)(void*)&fmt + 1;
+ 940:	8d 45 0c             	lea    0xc(%ebp),%eax
+ 943:	83 c0 04             	add    $0x4,%eax
+ 946:	89 45 e8             	mov    %eax,-0x18(%ebp)
+    for(i = 0; fmt[i]; i++){
+ 949:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 950:	e9 59 01 00 00       	jmp    aae <printf+0x17b>
+        c = fmt[i] & 0xff;
+ 955:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 958:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 95b:	01 d0                	add    %edx,%eax
+ 95d:	0f b6 00             	movzbl (%eax),%eax
+ 960:	0f be c0             	movsbl %al,%eax
+ 963:	25 ff 00 00 00       	and    $0xff,%eax
+ 968:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        if(state == 0){
+ 96b:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 96f:	75 2c                	jne    99d <printf+0x6a>
+            if(c == '%'){
+ 971:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 975:	75 0c                	jne    983 <printf+0x50>
+                state = '%';
+ 977:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+ 97e:	e9 27 01 00 00       	jmp    aaa <printf+0x177>
+            } else {
+                putc(fd, c);
+ 983:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 986:	0f be c0             	movsbl %al,%eax
+ 989:	83 ec 08             	sub    $0x8,%esp
+ 98c:	50                   	push   %eax
+ 98d:	ff 75 08             	push   0x8(%ebp)
+ 990:	e8 ca fe ff ff       	call   85f <putc>
+ 995:	83 c4 10             	add    $0x10,%esp
+ 998:	e9 0d 01 00 00       	jmp    aaa <printf+0x177>
+            }
+        } else if(state == '%'){
+ 99d:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+ 9a1:	0f 85 03 01 00 00    	jne    aaa <printf+0x177>
+            if(c == 'd'){
+ 9a7:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+ 9ab:	75 1e                	jne    9cb <printf+0x98>
+                printint(fd, *ap, 10, 1);
+ 9ad:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 9b0:	8b 00                	mov    (%eax),%eax
+ 9b2:	6a 01                	push   $0x1
+ 9b4:	6a 0a                	push   $0xa
+ 9b6:	50                   	push   %eax
+ 9b7:	ff 75 08             	push   0x8(%ebp)
+ 9ba:	e8 c3 fe ff ff       	call   882 <printint>
+ 9bf:	83 c4 10             	add    $0x10,%esp
+                ap++;
+ 9c2:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 9c6:	e9 d8 00 00 00       	jmp    aa3 <printf+0x170>
+            } else if(c == 'x' || c == 'p'){
+ 9cb:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+ 9cf:	74 06                	je     9d7 <printf+0xa4>
+ 9d1:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+ 9d5:	75 1e                	jne    9f5 <printf+0xc2>
+                printint(fd, *ap, 16, 0);
+ 9d7:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 9da:	8b 00                	mov    (%eax),%eax
+ 9dc:	6a 00                	push   $0x0
+ 9de:	6a 10                	push   $0x10
+ 9e0:	50                   	push   %eax
+ 9e1:	ff 75 08             	push   0x8(%ebp)
+ 9e4:	e8 99 fe ff ff       	call   882 <printint>
+ 9e9:	83 c4 10             	add    $0x10,%esp
+                ap++;
+ 9ec:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 9f0:	e9 ae 00 00 00       	jmp    aa3 <printf+0x170>
+            } else if(c == 's'){
+ 9f5:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+ 9f9:	75 43                	jne    a3e <printf+0x10b>
+                s = (char*)*ap;
+ 9fb:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 9fe:	8b 00                	mov    (%eax),%eax
+ a00:	89 45 f4             	mov    %eax,-0xc(%ebp)
+                ap++;
+ a03:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+                if(s == 0)
+ a07:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ a0b:	75 25                	jne    a32 <printf+0xff>
+                    s = "(null)";
+ a0d:	c7 45 f4 22 0d 00 00 	movl   $0xd22,-0xc(%ebp)
+                while(*s != 0){
+ a14:	eb 1c                	jmp    a32 <printf+0xff>
+                    putc(fd, *s);
+ a16:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a19:	0f b6 00             	movzbl (%eax),%eax
+ a1c:	0f be c0             	movsbl %al,%eax
+ a1f:	83 ec 08             	sub    $0x8,%esp
+ a22:	50                   	push   %eax
+ a23:	ff 75 08             	push   0x8(%ebp)
+ a26:	e8 34 fe ff ff       	call   85f <putc>
+ a2b:	83 c4 10             	add    $0x10,%esp
+                    s++;
+ a2e:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+                while(*s != 0){
+ a32:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a35:	0f b6 00             	movzbl (%eax),%eax
+ a38:	84 c0                	test   %al,%al
+ a3a:	75 da                	jne    a16 <printf+0xe3>
+ a3c:	eb 65                	jmp    aa3 <printf+0x170>
+                }
+            } else if(c == 'c'){
+ a3e:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+ a42:	75 1d                	jne    a61 <printf+0x12e>
+                putc(fd, *ap);
+ a44:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ a47:	8b 00                	mov    (%eax),%eax
+ a49:	0f be c0             	movsbl %al,%eax
+ a4c:	83 ec 08             	sub    $0x8,%esp
+ a4f:	50                   	push   %eax
+ a50:	ff 75 08             	push   0x8(%ebp)
+ a53:	e8 07 fe ff ff       	call   85f <putc>
+ a58:	83 c4 10             	add    $0x10,%esp
+                ap++;
+ a5b:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ a5f:	eb 42                	jmp    aa3 <printf+0x170>
+            } else if(c == '%'){
+ a61:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ a65:	75 17                	jne    a7e <printf+0x14b>
+                putc(fd, c);
+ a67:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ a6a:	0f be c0             	movsbl %al,%eax
+ a6d:	83 ec 08             	sub    $0x8,%esp
+ a70:	50                   	push   %eax
+ a71:	ff 75 08             	push   0x8(%ebp)
+ a74:	e8 e6 fd ff ff       	call   85f <putc>
+ a79:	83 c4 10             	add    $0x10,%esp
+ a7c:	eb 25                	jmp    aa3 <printf+0x170>
+            } else {
+                // Unknown % sequence.    Print it to draw attention.
+                putc(fd, '%');
+ a7e:	83 ec 08             	sub    $0x8,%esp
+ a81:	6a 25                	push   $0x25
+ a83:	ff 75 08             	push   0x8(%ebp)
+ a86:	e8 d4 fd ff ff       	call   85f <putc>
+ a8b:	83 c4 10             	add    $0x10,%esp
+                putc(fd, c);
+ a8e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ a91:	0f be c0             	movsbl %al,%eax
+ a94:	83 ec 08             	sub    $0x8,%esp
+ a97:	50                   	push   %eax
+ a98:	ff 75 08             	push   0x8(%ebp)
+ a9b:	e8 bf fd ff ff       	call   85f <putc>
+ aa0:	83 c4 10             	add    $0x10,%esp
+            }
+            state = 0;
+ aa3:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+    for(i = 0; fmt[i]; i++){
+ aaa:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ aae:	8b 55 0c             	mov    0xc(%ebp),%edx
+ ab1:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ ab4:	01 d0                	add    %edx,%eax
+ ab6:	0f b6 00             	movzbl (%eax),%eax
+ ab9:	84 c0                	test   %al,%al
+ abb:	0f 85 94 fe ff ff    	jne    955 <printf+0x22>
+        }
+    }
+}
+ ac1:	90                   	nop
+ ac2:	90                   	nop
+ ac3:	c9                   	leave
+ ac4:	c3                   	ret
+
+00000ac5 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ ac5:	55                   	push   %ebp
+ ac6:	89 e5                	mov    %esp,%ebp
+ ac8:	83 ec 10             	sub    $0x10,%esp
+    Header *bp, *p;
+
+    bp = (Header*)ap - 1;
+ acb:	8b 45 08             	mov    0x8(%ebp),%eax
+ ace:	83 e8 08             	sub    $0x8,%eax
+ ad1:	89 45 f8             	mov    %eax,-0x8(%ebp)
+    for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ ad4:	a1 48 14 00 00       	mov    0x1448,%eax
+ ad9:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ adc:	eb 24                	jmp    b02 <free+0x3d>
+        if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ ade:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ ae1:	8b 00                	mov    (%eax),%eax
+ ae3:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ ae6:	72 12                	jb     afa <free+0x35>
+ ae8:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ aeb:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ aee:	72 24                	jb     b14 <free+0x4f>
+ af0:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ af3:	8b 00                	mov    (%eax),%eax
+ af5:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ af8:	72 1a                	jb     b14 <free+0x4f>
+    for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ afa:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ afd:	8b 00                	mov    (%eax),%eax
+ aff:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ b02:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ b05:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ b08:	73 d4                	jae    ade <free+0x19>
+ b0a:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b0d:	8b 00                	mov    (%eax),%eax
+ b0f:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ b12:	73 ca                	jae    ade <free+0x19>
+            break;
+    if(bp + bp->s.size == p->s.ptr){
+ b14:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ b17:	8b 40 04             	mov    0x4(%eax),%eax
+ b1a:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ b21:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ b24:	01 c2                	add    %eax,%edx
+ b26:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b29:	8b 00                	mov    (%eax),%eax
+ b2b:	39 c2                	cmp    %eax,%edx
+ b2d:	75 24                	jne    b53 <free+0x8e>
+        bp->s.size += p->s.ptr->s.size;
+ b2f:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ b32:	8b 50 04             	mov    0x4(%eax),%edx
+ b35:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b38:	8b 00                	mov    (%eax),%eax
+ b3a:	8b 40 04             	mov    0x4(%eax),%eax
+ b3d:	01 c2                	add    %eax,%edx
+ b3f:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ b42:	89 50 04             	mov    %edx,0x4(%eax)
+        bp->s.ptr = p->s.ptr->s.ptr;
+ b45:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b48:	8b 00                	mov    (%eax),%eax
+ b4a:	8b 10                	mov    (%eax),%edx
+ b4c:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ b4f:	89 10                	mov    %edx,(%eax)
+ b51:	eb 0a                	jmp    b5d <free+0x98>
+    } else
+        bp->s.ptr = p->s.ptr;
+ b53:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b56:	8b 10                	mov    (%eax),%edx
+ b58:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ b5b:	89 10                	mov    %edx,(%eax)
+    if(p + p->s.size == bp){
+ b5d:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b60:	8b 40 04             	mov    0x4(%eax),%eax
+ b63:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ b6a:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b6d:	01 d0                	add    %edx,%eax
+ b6f:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ b72:	75 20                	jne    b94 <free+0xcf>
+        p->s.size += bp->s.size;
+ b74:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b77:	8b 50 04             	mov    0x4(%eax),%edx
+ b7a:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ b7d:	8b 40 04             	mov    0x4(%eax),%eax
+ b80:	01 c2                	add    %eax,%edx
+ b82:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b85:	89 50 04             	mov    %edx,0x4(%eax)
+        p->s.ptr = bp->s.ptr;
+ b88:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ b8b:	8b 10                	mov    (%eax),%edx
+ b8d:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b90:	89 10                	mov    %edx,(%eax)
+ b92:	eb 08                	jmp    b9c <free+0xd7>
+    } else
+        p->s.ptr = bp;
+ b94:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b97:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ b9a:	89 10                	mov    %edx,(%eax)
+    freep = p;
+ b9c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b9f:	a3 48 14 00 00       	mov    %eax,0x1448
+}
+ ba4:	90                   	nop
+ ba5:	c9                   	leave
+ ba6:	c3                   	ret
+
+00000ba7 <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+ ba7:	55                   	push   %ebp
+ ba8:	89 e5                	mov    %esp,%ebp
+ baa:	83 ec 18             	sub    $0x18,%esp
+    char *p;
+    Header *hp;
+
+    if(nu < 4096)
+ bad:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+ bb4:	77 07                	ja     bbd <morecore+0x16>
+        nu = 4096;
+ bb6:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+    p = sbrk(nu * sizeof(Header));
+ bbd:	8b 45 08             	mov    0x8(%ebp),%eax
+ bc0:	c1 e0 03             	shl    $0x3,%eax
+ bc3:	83 ec 0c             	sub    $0xc,%esp
+ bc6:	50                   	push   %eax
+ bc7:	e8 0a fb ff ff       	call   6d6 <sbrk>
+ bcc:	83 c4 10             	add    $0x10,%esp
+ bcf:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p == (char*)-1)
+ bd2:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+ bd6:	75 07                	jne    bdf <morecore+0x38>
+        return 0;
+ bd8:	b8 00 00 00 00       	mov    $0x0,%eax
+ bdd:	eb 26                	jmp    c05 <morecore+0x5e>
+    hp = (Header*)p;
+ bdf:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ be2:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    hp->s.size = nu;
+ be5:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ be8:	8b 55 08             	mov    0x8(%ebp),%edx
+ beb:	89 50 04             	mov    %edx,0x4(%eax)
+    free((void*)(hp + 1));
+ bee:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ bf1:	83 c0 08             	add    $0x8,%eax
+ bf4:	83 ec 0c             	sub    $0xc,%esp
+ bf7:	50                   	push   %eax
+ bf8:	e8 c8 fe ff ff       	call   ac5 <free>
+ bfd:	83 c4 10             	add    $0x10,%esp
+    return freep;
+ c00:	a1 48 14 00 00       	mov    0x1448,%eax
+}
+ c05:	c9                   	leave
+ c06:	c3                   	ret
+
+00000c07 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ c07:	55                   	push   %ebp
+ c08:	89 e5                	mov    %esp,%ebp
+ c0a:	83 ec 18             	sub    $0x18,%esp
+    Header *p, *prevp;
+    uint nunits;
+
+    nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ c0d:	8b 45 08             	mov    0x8(%ebp),%eax
+ c10:	83 c0 07             	add    $0x7,%eax
+ c13:	c1 e8 03             	shr    $0x3,%eax
+ c16:	83 c0 01             	add    $0x1,%eax
+ c19:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    if((prevp = freep) == 0){
+ c1c:	a1 48 14 00 00       	mov    0x1448,%eax
+ c21:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ c24:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ c28:	75 23                	jne    c4d <malloc+0x46>
+        base.s.ptr = freep = prevp = &base;
+ c2a:	c7 45 f0 40 14 00 00 	movl   $0x1440,-0x10(%ebp)
+ c31:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ c34:	a3 48 14 00 00       	mov    %eax,0x1448
+ c39:	a1 48 14 00 00       	mov    0x1448,%eax
+ c3e:	a3 40 14 00 00       	mov    %eax,0x1440
+        base.s.size = 0;
+ c43:	c7 05 44 14 00 00 00 	movl   $0x0,0x1444
+ c4a:	00 00 00 
+    }
+    for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ c4d:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ c50:	8b 00                	mov    (%eax),%eax
+ c52:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        if(p->s.size >= nunits){
+ c55:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ c58:	8b 40 04             	mov    0x4(%eax),%eax
+ c5b:	3b 45 ec             	cmp    -0x14(%ebp),%eax
+ c5e:	72 4d                	jb     cad <malloc+0xa6>
+            if(p->s.size == nunits)
+ c60:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ c63:	8b 40 04             	mov    0x4(%eax),%eax
+ c66:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+ c69:	75 0c                	jne    c77 <malloc+0x70>
+                prevp->s.ptr = p->s.ptr;
+ c6b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ c6e:	8b 10                	mov    (%eax),%edx
+ c70:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ c73:	89 10                	mov    %edx,(%eax)
+ c75:	eb 26                	jmp    c9d <malloc+0x96>
+            else {
+                p->s.size -= nunits;
+ c77:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ c7a:	8b 40 04             	mov    0x4(%eax),%eax
+ c7d:	2b 45 ec             	sub    -0x14(%ebp),%eax
+ c80:	89 c2                	mov    %eax,%edx
+ c82:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ c85:	89 50 04             	mov    %edx,0x4(%eax)
+                p += p->s.size;
+ c88:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ c8b:	8b 40 04             	mov    0x4(%eax),%eax
+ c8e:	c1 e0 03             	shl    $0x3,%eax
+ c91:	01 45 f4             	add    %eax,-0xc(%ebp)
+                p->s.size = nunits;
+ c94:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ c97:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ c9a:	89 50 04             	mov    %edx,0x4(%eax)
+            }
+            freep = prevp;
+ c9d:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ ca0:	a3 48 14 00 00       	mov    %eax,0x1448
+            return (void*)(p + 1);
+ ca5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ ca8:	83 c0 08             	add    $0x8,%eax
+ cab:	eb 3b                	jmp    ce8 <malloc+0xe1>
+        }
+        if(p == freep)
+ cad:	a1 48 14 00 00       	mov    0x1448,%eax
+ cb2:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ cb5:	75 1e                	jne    cd5 <malloc+0xce>
+            if((p = morecore(nunits)) == 0)
+ cb7:	83 ec 0c             	sub    $0xc,%esp
+ cba:	ff 75 ec             	push   -0x14(%ebp)
+ cbd:	e8 e5 fe ff ff       	call   ba7 <morecore>
+ cc2:	83 c4 10             	add    $0x10,%esp
+ cc5:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ cc8:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ ccc:	75 07                	jne    cd5 <malloc+0xce>
+                return 0;
+ cce:	b8 00 00 00 00       	mov    $0x0,%eax
+ cd3:	eb 13                	jmp    ce8 <malloc+0xe1>
+    for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ cd5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ cd8:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ cdb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ cde:	8b 00                	mov    (%eax),%eax
+ ce0:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        if(p->s.size >= nunits){
+ ce3:	e9 6d ff ff ff       	jmp    c55 <malloc+0x4e>
+    }
+}
+ ce8:	c9                   	leave
+ ce9:	c3                   	ret
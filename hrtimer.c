@@ -0,0 +1,210 @@
+// High-resolution timers.
+//
+// Each cpu keeps a list of hrtimers sorted by deadline, in TSC
+// cycles, and runs its LAPIC timer in one-shot mode aimed at the
+// earlier of its first hrtimer and its next periodic tick.    The
+// tick is emulated: hrtimerintr() reports when one is due, and
+// idle() can stop it on cpus other than cpu 0 so that a halted cpu
+// wakes only for its hrtimers.
+//
+// c->hrlock protects c's list and the hrtimers on it, and is held
+// while their functions run.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "mmu.h"
+#include "x86.h"
+#include "spinlock.h"
+#include "proc.h"
+
+// Longest interval programmed into the LAPIC at once, in ms,
+// so that the conversion to LAPIC counts cannot overflow.
+#define MAXSHOT    1000
+
+// Aim c's LAPIC timer at its next event.
+// Caller must hold c->hrlock.
+static void
+hrprogram(struct cpu *c, uint64 now)
+{
+    uint64 next, d;
+
+    if(c->hrhead)
+        next = c->hrhead->expires;
+    else
+        next = ~(uint64)0;
+    if(!c->tickstopped && c->nexttick < next)
+        next = c->nexttick;
+    if(next == ~(uint64)0){
+        lapiconeshot(0);
+        return;
+    }
+    d = next > now ? next - now : 0;
+    if(d > (uint64)tsckhz * MAXSHOT)
+        d = (uint64)tsckhz * MAXSHOT;
+    d = divu64(d * lapickhz, tsckhz);
+    lapiconeshot(d > 0 ? d : 1);
+}
+
+// Convert an interval to TSC cycles.
+uint64
+nstocycles(uint sec, uint nsec)
+{
+    return (uint64)sec * tsckhz * 1000 + divu64((uint64)nsec * tsckhz, 1000000);
+}
+
+// Convert TSC cycles to an interval.
+void
+cyclestons(uint64 cycles, uint *sec, uint *nsec)
+{
+    uint64 ms;
+
+    ms = divu64(cycles, tsckhz);
+    cycles -= ms * tsckhz;
+    *sec = divu64(ms, 1000);
+    *nsec = (ms - (uint64)*sec * 1000) * 1000000 +
+        (uint)divu64(cycles * 1000000, tsckhz);
+}
+
+// Unlink t from c's list.    Caller must hold c->hrlock.
+static void
+hrdel(struct cpu *c, struct hrtimer *t)
+{
+    struct hrtimer **pp;
+
+    for(pp = &c->hrhead; *pp; pp = &(*pp)->next){
+        if(*pp == t){
+            *pp = t->next;
+            break;
+        }
+    }
+    t->next = 0;
+    t->cpu = -1;
+}
+
+// Queue t on c to call fn(arg) once the TSC reaches expires.
+// Caller must hold c->hrlock; t must not be queued.
+static void
+hrput(struct cpu *c, struct hrtimer *t, uint64 expires, void (*fn)(void*), void *arg)
+{
+    struct hrtimer **pp;
+
+    t->expires = expires;
+    t->fn = fn;
+    t->arg = arg;
+    t->cpu = c - cpus;
+    for(pp = &c->hrhead; *pp && (*pp)->expires <= expires; pp = &(*pp)->next)
+        ;
+    t->next = *pp;
+    *pp = t;
+    if(c->hrhead == t && c == mycpu())
+        hrprogram(c, rdtsc());
+}
+
+// Arrange for fn(arg) to be called from the timer interrupt once
+// the TSC reaches expires, on the calling cpu.    fn runs with
+// the cpu's hrlock held and must not touch that cpu's hrtimers.
+void
+hrtimerset(struct hrtimer *t, uint64 expires, void (*fn)(void*), void *arg)
+{
+    struct cpu *c;
+
+    hrtimercancel(t);
+    pushcli();
+    c = mycpu();
+    acquire(&c->hrlock);
+    hrput(c, t, expires, fn, arg);
+    release(&c->hrlock);
+    popcli();
+}
+
+// Take t off whatever cpu's list it is on.
+void
+hrtimercancel(struct hrtimer *t)
+{
+    struct cpu *c;
+    int i;
+
+    while((i = t->cpu) >= 0){
+        c = &cpus[i];
+        acquire(&c->hrlock);
+        if(t->cpu == i)
+            hrdel(c, t);
+        release(&c->hrlock);
+    }
+}
+
+// Sleep until the TSC reaches deadline.
+// Return -1 if killed first, else 0.
+int
+hrsleep(uint64 deadline)
+{
+    struct proc *p = myproc();
+    struct hrtimer *t = &p->hrtimer;
+    struct cpu *c;
+
+    pushcli();
+    c = mycpu();
+    acquire(&c->hrlock);
+    popcli();
+    if(rdtsc() >= deadline){
+        release(&c->hrlock);
+        return 0;
+    }
+    hrput(c, t, deadline, wakeup, t);
+    while(t->cpu >= 0){
+        if(p->killed){
+            hrdel(c, t);
+            release(&c->hrlock);
+            return -1;
+        }
+        sleep(t, &c->hrlock);
+    }
+    release(&c->hrlock);
+    return 0;
+}
+
+// Stop or restart this cpu's periodic tick.
+// Caller must have interrupts disabled.
+void
+hrtickstop(int stop)
+{
+    struct cpu *c = mycpu();
+    uint64 now = rdtsc();
+
+    acquire(&c->hrlock);
+    c->tickstopped = stop;
+    if(!stop)
+        c->nexttick = now + (uint64)tsckhz * (1000/HZ);
+    hrprogram(c, now);
+    release(&c->hrlock);
+}
+
+// Handle a LAPIC timer interrupt: run the hrtimers that are due
+// and re-arm the timer.    Return 1 if a periodic tick is due.
+int
+hrtimerintr(void)
+{
+    struct cpu *c = mycpu();
+    struct hrtimer *t;
+    uint64 now = rdtsc();
+    int tick;
+
+    acquire(&c->hrlock);
+    tick = 0;
+    if(!c->tickstopped && now >= c->nexttick){
+        tick = 1;
+        c->nexttick += (uint64)tsckhz * (1000/HZ);
+        if(c->nexttick <= now)    // fell behind; don't try to catch up
+            c->nexttick = now + (uint64)tsckhz * (1000/HZ);
+    }
+    while((t = c->hrhead) != 0 && t->expires <= now){
+        c->hrhead = t->next;
+        t->next = 0;
+        t->cpu = -1;
+        t->fn(t->arg);
+    }
+    hrprogram(c, now);
+    release(&c->hrlock);
+    return tick;
+}
@@ -0,0 +1,1454 @@
+
+_init:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+
+char *argv[] = { "sh", 0 };
+
+int
+main(void)
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	51                   	push   %ecx
+   e:	83 ec 14             	sub    $0x14,%esp
+    int pid, wpid;
+
+    if(open("console", O_RDWR) < 0){
+  11:	83 ec 08             	sub    $0x8,%esp
+  14:	6a 02                	push   $0x2
+  16:	68 c3 0a 00 00       	push   $0xac3
+  1b:	e8 32 04 00 00       	call   452 <open>
+  20:	83 c4 10             	add    $0x10,%esp
+  23:	85 c0                	test   %eax,%eax
+  25:	79 26                	jns    4d <main+0x4d>
+        mknod("console", 1, 1);
+  27:	83 ec 04             	sub    $0x4,%esp
+  2a:	6a 01                	push   $0x1
+  2c:	6a 01                	push   $0x1
+  2e:	68 c3 0a 00 00       	push   $0xac3
+  33:	e8 24 04 00 00       	call   45c <mknod>
+  38:	83 c4 10             	add    $0x10,%esp
+        open("console", O_RDWR);
+  3b:	83 ec 08             	sub    $0x8,%esp
+  3e:	6a 02                	push   $0x2
+  40:	68 c3 0a 00 00       	push   $0xac3
+  45:	e8 08 04 00 00       	call   452 <open>
+  4a:	83 c4 10             	add    $0x10,%esp
+    }
+    dup(0);    // stdout
+  4d:	83 ec 0c             	sub    $0xc,%esp
+  50:	6a 00                	push   $0x0
+  52:	e8 41 04 00 00       	call   498 <dup>
+  57:	83 c4 10             	add    $0x10,%esp
+    dup(0);    // stderr
+  5a:	83 ec 0c             	sub    $0xc,%esp
+  5d:	6a 00                	push   $0x0
+  5f:	e8 34 04 00 00       	call   498 <dup>
+  64:	83 c4 10             	add    $0x10,%esp
+
+    for(;;){
+        printf(1, "init: starting sh\n");
+  67:	83 ec 08             	sub    $0x8,%esp
+  6a:	68 cb 0a 00 00       	push   $0xacb
+  6f:	6a 01                	push   $0x1
+  71:	e8 93 06 00 00       	call   709 <printf>
+  76:	83 c4 10             	add    $0x10,%esp
+        pid = fork();
+  79:	e8 86 03 00 00       	call   404 <fork>
+  7e:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        if(pid < 0){
+  81:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+  85:	79 17                	jns    9e <main+0x9e>
+            printf(1, "init: fork failed\n");
+  87:	83 ec 08             	sub    $0x8,%esp
+  8a:	68 de 0a 00 00       	push   $0xade
+  8f:	6a 01                	push   $0x1
+  91:	e8 73 06 00 00       	call   709 <printf>
+  96:	83 c4 10             	add    $0x10,%esp
+            exit();
+  99:	e8 6d 03 00 00       	call   40b <exit>
+        }
+        if(pid == 0){
+  9e:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+  a2:	75 3e                	jne    e2 <main+0xe2>
+            exec("sh", argv);
+  a4:	83 ec 08             	sub    $0x8,%esp
+  a7:	68 7c 0d 00 00       	push   $0xd7c
+  ac:	68 c0 0a 00 00       	push   $0xac0
+  b1:	e8 92 03 00 00       	call   448 <exec>
+  b6:	83 c4 10             	add    $0x10,%esp
+            printf(1, "init: exec sh failed\n");
+  b9:	83 ec 08             	sub    $0x8,%esp
+  bc:	68 f1 0a 00 00       	push   $0xaf1
+  c1:	6a 01                	push   $0x1
+  c3:	e8 41 06 00 00       	call   709 <printf>
+  c8:	83 c4 10             	add    $0x10,%esp
+            exit();
+  cb:	e8 3b 03 00 00       	call   40b <exit>
+        }
+        while((wpid=wait()) >= 0 && wpid != pid)
+            printf(1, "zombie!\n");
+  d0:	83 ec 08             	sub    $0x8,%esp
+  d3:	68 07 0b 00 00       	push   $0xb07
+  d8:	6a 01                	push   $0x1
+  da:	e8 2a 06 00 00       	call   709 <printf>
+  df:	83 c4 10             	add    $0x10,%esp
+        while((wpid=wait()) >= 0 && wpid != pid)
+  e2:	e8 2b 03 00 00       	call   412 <wait>
+  e7:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  ea:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+  ee:	0f 88 73 ff ff ff    	js     67 <main+0x67>
+  f4:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  f7:	3b 45 f4             	cmp    -0xc(%ebp),%eax
+  fa:	75 d4                	jne    d0 <main+0xd0>
+        printf(1, "init: starting sh\n");
+  fc:	e9 66 ff ff ff       	jmp    67 <main+0x67>
+
+00000101 <stosb>:
+strchr(const char *s, char c)
+{
+    for(; *s; s++)
+        if(*s == c)
+            return (char*)s;
+    return 0;
+ 101:	55                   	push   %ebp
+ 102:	89 e5                	mov    %esp,%ebp
+ 104:	57                   	push   %edi
+ 105:	53                   	push   %ebx
+}
+ 106:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 109:	8b 55 10             	mov    0x10(%ebp),%edx
+ 10c:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 10f:	89 cb                	mov    %ecx,%ebx
+ 111:	89 df                	mov    %ebx,%edi
+ 113:	89 d1                	mov    %edx,%ecx
+ 115:	fc                   	cld
+ 116:	f3 aa                	rep stos %al,%es:(%edi)
+ 118:	89 ca                	mov    %ecx,%edx
+ 11a:	89 fb                	mov    %edi,%ebx
+ 11c:	89 5d 08             	mov    %ebx,0x8(%ebp)
+ 11f:	89 55 10             	mov    %edx,0x10(%ebp)
+
+char*
+gets(char *buf, int max)
+{
+ 122:	90                   	nop
+ 123:	5b                   	pop    %ebx
+ 124:	5f                   	pop    %edi
+ 125:	5d                   	pop    %ebp
+ 126:	c3                   	ret
+
+00000127 <strcpy>:
+{
+ 127:	55                   	push   %ebp
+ 128:	89 e5                	mov    %esp,%ebp
+ 12a:	83 ec 10             	sub    $0x10,%esp
+    os = s;
+ 12d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 130:	89 45 fc             	mov    %eax,-0x4(%ebp)
+    while((*s++ = *t++) != 0)
+ 133:	90                   	nop
+ 134:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 137:	8d 42 01             	lea    0x1(%edx),%eax
+ 13a:	89 45 0c             	mov    %eax,0xc(%ebp)
+ 13d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 140:	8d 48 01             	lea    0x1(%eax),%ecx
+ 143:	89 4d 08             	mov    %ecx,0x8(%ebp)
+ 146:	0f b6 12             	movzbl (%edx),%edx
+ 149:	88 10                	mov    %dl,(%eax)
+ 14b:	0f b6 00             	movzbl (%eax),%eax
+ 14e:	84 c0                	test   %al,%al
+ 150:	75 e2                	jne    134 <strcpy+0xd>
+    return os;
+ 152:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 155:	c9                   	leave
+ 156:	c3                   	ret
+
+00000157 <strcmp>:
+{
+ 157:	55                   	push   %ebp
+ 158:	89 e5                	mov    %esp,%ebp
+    while(*p && *p == *q)
+ 15a:	eb 08                	jmp    164 <strcmp+0xd>
+        p++, q++;
+ 15c:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 160:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+    while(*p && *p == *q)
+ 164:	8b 45 08             	mov    0x8(%ebp),%eax
+ 167:	0f b6 00             	movzbl (%eax),%eax
+ 16a:	84 c0                	test   %al,%al
+ 16c:	74 10                	je     17e <strcmp+0x27>
+ 16e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 171:	0f b6 10             	movzbl (%eax),%edx
+ 174:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 177:	0f b6 00             	movzbl (%eax),%eax
+ 17a:	38 c2                	cmp    %al,%dl
+ 17c:	74 de                	je     15c <strcmp+0x5>
+    return (uchar)*p - (uchar)*q;
+ 17e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 181:	0f b6 00             	movzbl (%eax),%eax
+ 184:	0f b6 d0             	movzbl %al,%edx
+ 187:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 18a:	0f b6 00             	movzbl (%eax),%eax
+ 18d:	0f b6 c0             	movzbl %al,%eax
+ 190:	29 c2                	sub    %eax,%edx
+ 192:	89 d0                	mov    %edx,%eax
+}
+ 194:	5d                   	pop    %ebp
+ 195:	c3                   	ret
+
+00000196 <strlen>:
+{
+ 196:	55                   	push   %ebp
+ 197:	89 e5                	mov    %esp,%ebp
+ 199:	83 ec 10             	sub    $0x10,%esp
+    for(n = 0; s[n]; n++)
+ 19c:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ 1a3:	eb 04                	jmp    1a9 <strlen+0x13>
+ 1a5:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 1a9:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 1ac:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1af:	01 d0                	add    %edx,%eax
+ 1b1:	0f b6 00             	movzbl (%eax),%eax
+ 1b4:	84 c0                	test   %al,%al
+ 1b6:	75 ed                	jne    1a5 <strlen+0xf>
+    return n;
+ 1b8:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 1bb:	c9                   	leave
+ 1bc:	c3                   	ret
+
+000001bd <memset>:
+{
+ 1bd:	55                   	push   %ebp
+ 1be:	89 e5                	mov    %esp,%ebp
+    stosb(dst, c, n);
+ 1c0:	8b 45 10             	mov    0x10(%ebp),%eax
+ 1c3:	50                   	push   %eax
+ 1c4:	ff 75 0c             	push   0xc(%ebp)
+ 1c7:	ff 75 08             	push   0x8(%ebp)
+ 1ca:	e8 32 ff ff ff       	call   101 <stosb>
+ 1cf:	83 c4 0c             	add    $0xc,%esp
+    return dst;
+ 1d2:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 1d5:	c9                   	leave
+ 1d6:	c3                   	ret
+
+000001d7 <strchr>:
+{
+ 1d7:	55                   	push   %ebp
+ 1d8:	89 e5                	mov    %esp,%ebp
+ 1da:	83 ec 04             	sub    $0x4,%esp
+ 1dd:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 1e0:	88 45 fc             	mov    %al,-0x4(%ebp)
+    for(; *s; s++)
+ 1e3:	eb 14                	jmp    1f9 <strchr+0x22>
+        if(*s == c)
+ 1e5:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1e8:	0f b6 00             	movzbl (%eax),%eax
+ 1eb:	38 45 fc             	cmp    %al,-0x4(%ebp)
+ 1ee:	75 05                	jne    1f5 <strchr+0x1e>
+            return (char*)s;
+ 1f0:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1f3:	eb 13                	jmp    208 <strchr+0x31>
+    for(; *s; s++)
+ 1f5:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 1f9:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1fc:	0f b6 00             	movzbl (%eax),%eax
+ 1ff:	84 c0                	test   %al,%al
+ 201:	75 e2                	jne    1e5 <strchr+0xe>
+    return 0;
+ 203:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 208:	c9                   	leave
+ 209:	c3                   	ret
+
+0000020a <gets>:
+{
+ 20a:	55                   	push   %ebp
+ 20b:	89 e5                	mov    %esp,%ebp
+ 20d:	83 ec 18             	sub    $0x18,%esp
+    int i, cc;
+    char c;
+
+    for(i=0; i+1 < max; ){
+ 210:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 217:	eb 42                	jmp    25b <gets+0x51>
+        cc = read(0, &c, 1);
+ 219:	83 ec 04             	sub    $0x4,%esp
+ 21c:	6a 01                	push   $0x1
+ 21e:	8d 45 ef             	lea    -0x11(%ebp),%eax
+ 221:	50                   	push   %eax
+ 222:	6a 00                	push   $0x0
+ 224:	e8 f7 01 00 00       	call   420 <read>
+ 229:	83 c4 10             	add    $0x10,%esp
+ 22c:	89 45 f0             	mov    %eax,-0x10(%ebp)
+        if(cc < 1)
+ 22f:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 233:	7e 33                	jle    268 <gets+0x5e>
+            break;
+        buf[i++] = c;
+ 235:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 238:	8d 50 01             	lea    0x1(%eax),%edx
+ 23b:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 23e:	89 c2                	mov    %eax,%edx
+ 240:	8b 45 08             	mov    0x8(%ebp),%eax
+ 243:	01 c2                	add    %eax,%edx
+ 245:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 249:	88 02                	mov    %al,(%edx)
+        if(c == '\n' || c == '\r')
+ 24b:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 24f:	3c 0a                	cmp    $0xa,%al
+ 251:	74 16                	je     269 <gets+0x5f>
+ 253:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 257:	3c 0d                	cmp    $0xd,%al
+ 259:	74 0e                	je     269 <gets+0x5f>
+    for(i=0; i+1 < max; ){
+ 25b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 25e:	83 c0 01             	add    $0x1,%eax
+ 261:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 264:	7f b3                	jg     219 <gets+0xf>
+ 266:	eb 01                	jmp    269 <gets+0x5f>
+            break;
+ 268:	90                   	nop
+            break;
+    }
+    buf[i] = '\0';
+ 269:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 26c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 26f:	01 d0                	add    %edx,%eax
+ 271:	c6 00 00             	movb   $0x0,(%eax)
+    return buf;
+ 274:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 277:	c9                   	leave
+ 278:	c3                   	ret
+
+00000279 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 279:	55                   	push   %ebp
+ 27a:	89 e5                	mov    %esp,%ebp
+ 27c:	83 ec 18             	sub    $0x18,%esp
+    int fd;
+    int r;
+
+    fd = open(n, O_RDONLY);
+ 27f:	83 ec 08             	sub    $0x8,%esp
+ 282:	6a 00                	push   $0x0
+ 284:	ff 75 08             	push   0x8(%ebp)
+ 287:	e8 c6 01 00 00       	call   452 <open>
+ 28c:	83 c4 10             	add    $0x10,%esp
+ 28f:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(fd < 0)
+ 292:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 296:	79 07                	jns    29f <stat+0x26>
+        return -1;
+ 298:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 29d:	eb 25                	jmp    2c4 <stat+0x4b>
+    r = fstat(fd, st);
+ 29f:	83 ec 08             	sub    $0x8,%esp
+ 2a2:	ff 75 0c             	push   0xc(%ebp)
+ 2a5:	ff 75 f4             	push   -0xc(%ebp)
+ 2a8:	e8 c3 01 00 00       	call   470 <fstat>
+ 2ad:	83 c4 10             	add    $0x10,%esp
+ 2b0:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    close(fd);
+ 2b3:	83 ec 0c             	sub    $0xc,%esp
+ 2b6:	ff 75 f4             	push   -0xc(%ebp)
+ 2b9:	e8 76 01 00 00       	call   434 <close>
+ 2be:	83 c4 10             	add    $0x10,%esp
+    return r;
+ 2c1:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ 2c4:	c9                   	leave
+ 2c5:	c3                   	ret
+
+000002c6 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 2c6:	55                   	push   %ebp
+ 2c7:	89 e5                	mov    %esp,%ebp
+ 2c9:	83 ec 10             	sub    $0x10,%esp
+    int n;
+
+    n = 0;
+ 2cc:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+    while('0' <= *s && *s <= '9')
+ 2d3:	eb 25                	jmp    2fa <atoi+0x34>
+        n = n*10 + *s++ - '0';
+ 2d5:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 2d8:	89 d0                	mov    %edx,%eax
+ 2da:	c1 e0 02             	shl    $0x2,%eax
+ 2dd:	01 d0                	add    %edx,%eax
+ 2df:	01 c0                	add    %eax,%eax
+ 2e1:	89 c1                	mov    %eax,%ecx
+ 2e3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2e6:	8d 50 01             	lea    0x1(%eax),%edx
+ 2e9:	89 55 08             	mov    %edx,0x8(%ebp)
+ 2ec:	0f b6 00             	movzbl (%eax),%eax
+ 2ef:	0f be c0             	movsbl %al,%eax
+ 2f2:	01 c8                	add    %ecx,%eax
+ 2f4:	83 e8 30             	sub    $0x30,%eax
+ 2f7:	89 45 fc             	mov    %eax,-0x4(%ebp)
+    while('0' <= *s && *s <= '9')
+ 2fa:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2fd:	0f b6 00             	movzbl (%eax),%eax
+ 300:	3c 2f                	cmp    $0x2f,%al
+ 302:	7e 0a                	jle    30e <atoi+0x48>
+ 304:	8b 45 08             	mov    0x8(%ebp),%eax
+ 307:	0f b6 00             	movzbl (%eax),%eax
+ 30a:	3c 39                	cmp    $0x39,%al
+ 30c:	7e c7                	jle    2d5 <atoi+0xf>
+    return n;
+ 30e:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 311:	c9                   	leave
+ 312:	c3                   	ret
+
+00000313 <nice>:
+
+// Add inc to the caller's nice value; return the new value.
+int
+nice(int inc)
+{
+ 313:	55                   	push   %ebp
+ 314:	89 e5                	mov    %esp,%ebp
+ 316:	83 ec 18             	sub    $0x18,%esp
+    int n;
+
+    n = getpriority(0) + inc;
+ 319:	83 ec 0c             	sub    $0xc,%esp
+ 31c:	6a 00                	push   $0x0
+ 31e:	e8 d9 01 00 00       	call   4fc <getpriority>
+ 323:	83 c4 10             	add    $0x10,%esp
+ 326:	8b 55 08             	mov    0x8(%ebp),%edx
+ 329:	01 d0                	add    %edx,%eax
+ 32b:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(n < 0)
+ 32e:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 332:	79 07                	jns    33b <nice+0x28>
+        n = 0;
+ 334:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    if(n > NICEMAX)
+ 33b:	83 7d f4 13          	cmpl   $0x13,-0xc(%ebp)
+ 33f:	7e 07                	jle    348 <nice+0x35>
+        n = NICEMAX;
+ 341:	c7 45 f4 13 00 00 00 	movl   $0x13,-0xc(%ebp)
+    if(setpriority(0, n) < 0)
+ 348:	83 ec 08             	sub    $0x8,%esp
+ 34b:	ff 75 f4             	push   -0xc(%ebp)
+ 34e:	6a 00                	push   $0x0
+ 350:	e8 b1 01 00 00       	call   506 <setpriority>
+ 355:	83 c4 10             	add    $0x10,%esp
+ 358:	85 c0                	test   %eax,%eax
+ 35a:	79 07                	jns    363 <nice+0x50>
+        return -1;
+ 35c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 361:	eb 03                	jmp    366 <nice+0x53>
+    return n;
+ 363:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+ 366:	c9                   	leave
+ 367:	c3                   	ret
+
+00000368 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 368:	55                   	push   %ebp
+ 369:	89 e5                	mov    %esp,%ebp
+ 36b:	83 ec 10             	sub    $0x10,%esp
+    char *dst;
+    const char *src;
+
+    dst = vdst;
+ 36e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 371:	89 45 fc             	mov    %eax,-0x4(%ebp)
+    src = vsrc;
+ 374:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 377:	89 45 f8             	mov    %eax,-0x8(%ebp)
+    while(n-- > 0)
+ 37a:	eb 17                	jmp    393 <memmove+0x2b>
+        *dst++ = *src++;
+ 37c:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 37f:	8d 42 01             	lea    0x1(%edx),%eax
+ 382:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 385:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 388:	8d 48 01             	lea    0x1(%eax),%ecx
+ 38b:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+ 38e:	0f b6 12             	movzbl (%edx),%edx
+ 391:	88 10                	mov    %dl,(%eax)
+    while(n-- > 0)
+ 393:	8b 45 10             	mov    0x10(%ebp),%eax
+ 396:	8d 50 ff             	lea    -0x1(%eax),%edx
+ 399:	89 55 10             	mov    %edx,0x10(%ebp)
+ 39c:	85 c0                	test   %eax,%eax
+ 39e:	7f dc                	jg     37c <memmove+0x14>
+    return vdst;
+ 3a0:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 3a3:	c9                   	leave
+ 3a4:	c3                   	ret
+
+000003a5 <dosyscall>:
+sysmode:
+    .long 0
+
+    .text
+dosyscall:
+    cmpl $0, sysmode
+ 3a5:	83 3d 84 0d 00 00 00 	cmpl   $0x0,0xd84
+    jg 2f
+ 3ac:	7f 0c                	jg     3ba <dosyscall+0x15>
+    jl 1f
+ 3ae:	7c 07                	jl     3b7 <dosyscall+0x12>
+    call sepcheck
+ 3b0:	e8 27 00 00 00       	call   3dc <sepcheck>
+    jmp dosyscall
+ 3b5:	eb ee                	jmp    3a5 <dosyscall>
+1:
+    int $T_SYSCALL
+ 3b7:	cd 40                	int    $0x40
+    ret
+ 3b9:	c3                   	ret
+2:
+    pushl %ebx
+ 3ba:	53                   	push   %ebx
+    pushl %esi
+ 3bb:	56                   	push   %esi
+    pushl %edi
+ 3bc:	57                   	push   %edi
+    pushl %ebp
+ 3bd:	55                   	push   %ebp
+    movl 20(%esp), %ebx
+ 3be:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+    movl 24(%esp), %esi
+ 3c2:	8b 74 24 18          	mov    0x18(%esp),%esi
+    movl 28(%esp), %edi
+ 3c6:	8b 7c 24 1c          	mov    0x1c(%esp),%edi
+    movl 32(%esp), %ebp
+ 3ca:	8b 6c 24 20          	mov    0x20(%esp),%ebp
+    movl %esp, %ecx
+ 3ce:	89 e1                	mov    %esp,%ecx
+    movl $3f, %edx
+ 3d0:	ba d7 03 00 00       	mov    $0x3d7,%edx
+    sysenter
+ 3d5:	0f 34                	sysenter
+3:
+    popl %ebp
+ 3d7:	5d                   	pop    %ebp
+    popl %edi
+ 3d8:	5f                   	pop    %edi
+    popl %esi
+ 3d9:	5e                   	pop    %esi
+    popl %ebx
+ 3da:	5b                   	pop    %ebx
+    ret
+ 3db:	c3                   	ret
+
+000003dc <sepcheck>:
+
+# Set sysmode from cpuid's SEP flag.    Preserves %eax.
+sepcheck:
+    pushl %eax
+ 3dc:	50                   	push   %eax
+    pushl %ebx
+ 3dd:	53                   	push   %ebx
+    movl $1, %eax
+ 3de:	b8 01 00 00 00       	mov    $0x1,%eax
+    cpuid
+ 3e3:	0f a2                	cpuid
+    movl $-1, sysmode
+ 3e5:	c7 05 84 0d 00 00 ff 	movl   $0xffffffff,0xd84
+ 3ec:	ff ff ff 
+    testl $0x800, %edx
+ 3ef:	f7 c2 00 08 00 00    	test   $0x800,%edx
+    jz 1f
+ 3f5:	74 0a                	je     401 <sepcheck+0x25>
+    movl $1, sysmode
+ 3f7:	c7 05 84 0d 00 00 01 	movl   $0x1,0xd84
+ 3fe:	00 00 00 
+1:
+    popl %ebx
+ 401:	5b                   	pop    %ebx
+    popl %eax
+ 402:	58                   	pop    %eax
+    ret
+ 403:	c3                   	ret
+
+00000404 <fork>:
+
+SYSCALL(fork)
+ 404:	b8 01 00 00 00       	mov    $0x1,%eax
+ 409:	eb 9a                	jmp    3a5 <dosyscall>
+
+0000040b <exit>:
+SYSCALL(exit)
+ 40b:	b8 02 00 00 00       	mov    $0x2,%eax
+ 410:	eb 93                	jmp    3a5 <dosyscall>
+
+00000412 <wait>:
+SYSCALL(wait)
+ 412:	b8 03 00 00 00       	mov    $0x3,%eax
+ 417:	eb 8c                	jmp    3a5 <dosyscall>
+
+00000419 <pipe>:
+SYSCALL(pipe)
+ 419:	b8 04 00 00 00       	mov    $0x4,%eax
+ 41e:	eb 85                	jmp    3a5 <dosyscall>
+
+00000420 <read>:
+SYSCALL(read)
+ 420:	b8 05 00 00 00       	mov    $0x5,%eax
+ 425:	e9 7b ff ff ff       	jmp    3a5 <dosyscall>
+
+0000042a <write>:
+SYSCALL(write)
+ 42a:	b8 10 00 00 00       	mov    $0x10,%eax
+ 42f:	e9 71 ff ff ff       	jmp    3a5 <dosyscall>
+
+00000434 <close>:
+SYSCALL(close)
+ 434:	b8 15 00 00 00       	mov    $0x15,%eax
+ 439:	e9 67 ff ff ff       	jmp    3a5 <dosyscall>
+
+0000043e <kill>:
+SYSCALL(kill)
+ 43e:	b8 06 00 00 00       	mov    $0x6,%eax
+ 443:	e9 5d ff ff ff       	jmp    3a5 <dosyscall>
+
+00000448 <exec>:
+SYSCALL(exec)
+ 448:	b8 07 00 00 00       	mov    $0x7,%eax
+ 44d:	e9 53 ff ff ff       	jmp    3a5 <dosyscall>
+
+00000452 <open>:
+SYSCALL(open)
+ 452:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 457:	e9 49 ff ff ff       	jmp    3a5 <dosyscall>
+
+0000045c <mknod>:
+SYSCALL(mknod)
+ 45c:	b8 11 00 00 00       	mov    $0x11,%eax
+ 461:	e9 3f ff ff ff       	jmp    3a5 <dosyscall>
+
+00000466 <unlink>:
+SYSCALL(unlink)
+ 466:	b8 12 00 00 00       	mov    $0x12,%eax
+ 46b:	e9 35 ff ff ff       	jmp    3a5 <dosyscall>
+
+00000470 <fstat>:
+SYSCALL(fstat)
+ 470:	b8 08 00 00 00       	mov    $0x8,%eax
+ 475:	e9 2b ff ff ff       	jmp    3a5 <dosyscall>
+
+0000047a <link>:
+SYSCALL(link)
+ 47a:	b8 13 00 00 00       	mov    $0x13,%eax
+ 47f:	e9 21 ff ff ff       	jmp    3a5 <dosyscall>
+
+00000484 <mkdir>:
+SYSCALL(mkdir)
+ 484:	b8 14 00 00 00       	mov    $0x14,%eax
+ 489:	e9 17 ff ff ff       	jmp    3a5 <dosyscall>
+
+0000048e <chdir>:
+SYSCALL(chdir)
+ 48e:	b8 09 00 00 00       	mov    $0x9,%eax
+ 493:	e9 0d ff ff ff       	jmp    3a5 <dosyscall>
+
+00000498 <dup>:
+SYSCALL(dup)
+ 498:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 49d:	e9 03 ff ff ff       	jmp    3a5 <dosyscall>
+
+000004a2 <getpid>:
+SYSCALL(getpid)
+ 4a2:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 4a7:	e9 f9 fe ff ff       	jmp    3a5 <dosyscall>
+
+000004ac <sbrk>:
+SYSCALL(sbrk)
+ 4ac:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 4b1:	e9 ef fe ff ff       	jmp    3a5 <dosyscall>
+
+000004b6 <sleep>:
+SYSCALL(sleep)
+ 4b6:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 4bb:	e9 e5 fe ff ff       	jmp    3a5 <dosyscall>
+
+000004c0 <uptime>:
+SYSCALL(uptime)
+ 4c0:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 4c5:	e9 db fe ff ff       	jmp    3a5 <dosyscall>
+
+000004ca <date>:
+SYSCALL(date)
+ 4ca:	b8 16 00 00 00       	mov    $0x16,%eax
+ 4cf:	e9 d1 fe ff ff       	jmp    3a5 <dosyscall>
+
+000004d4 <dup2>:
+SYSCALL(dup2)
+ 4d4:	b8 17 00 00 00       	mov    $0x17,%eax
+ 4d9:	e9 c7 fe ff ff       	jmp    3a5 <dosyscall>
+
+000004de <uffd>:
+SYSCALL(uffd)
+ 4de:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 4e3:	e9 bd fe ff ff       	jmp    3a5 <dosyscall>
+
+000004e8 <uffdregister>:
+SYSCALL(uffdregister)
+ 4e8:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 4ed:	e9 b3 fe ff ff       	jmp    3a5 <dosyscall>
+
+000004f2 <uffdcopy>:
+SYSCALL(uffdcopy)
+ 4f2:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 4f7:	e9 a9 fe ff ff       	jmp    3a5 <dosyscall>
+
+000004fc <getpriority>:
+SYSCALL(getpriority)
+ 4fc:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 501:	e9 9f fe ff ff       	jmp    3a5 <dosyscall>
+
+00000506 <setpriority>:
+SYSCALL(setpriority)
+ 506:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 50b:	e9 95 fe ff ff       	jmp    3a5 <dosyscall>
+
+00000510 <setweight>:
+SYSCALL(setweight)
+ 510:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 515:	e9 8b fe ff ff       	jmp    3a5 <dosyscall>
+
+0000051a <setgroup>:
+SYSCALL(setgroup)
+ 51a:	b8 20 00 00 00       	mov    $0x20,%eax
+ 51f:	e9 81 fe ff ff       	jmp    3a5 <dosyscall>
+
+00000524 <schedinfo>:
+SYSCALL(schedinfo)
+ 524:	b8 21 00 00 00       	mov    $0x21,%eax
+ 529:	e9 77 fe ff ff       	jmp    3a5 <dosyscall>
+
+0000052e <nanosleep>:
+SYSCALL(nanosleep)
+ 52e:	b8 22 00 00 00       	mov    $0x22,%eax
+ 533:	e9 6d fe ff ff       	jmp    3a5 <dosyscall>
+
+00000538 <clock_nanosleep>:
+SYSCALL(clock_nanosleep)
+ 538:	b8 23 00 00 00       	mov    $0x23,%eax
+ 53d:	e9 63 fe ff ff       	jmp    3a5 <dosyscall>
+
+00000542 <clock_gettime>:
+SYSCALL(clock_gettime)
+ 542:	b8 24 00 00 00       	mov    $0x24,%eax
+ 547:	e9 59 fe ff ff       	jmp    3a5 <dosyscall>
+
+0000054c <sched_setaffinity>:
+SYSCALL(sched_setaffinity)
+ 54c:	b8 25 00 00 00       	mov    $0x25,%eax
+ 551:	e9 4f fe ff ff       	jmp    3a5 <dosyscall>
+
+00000556 <sched_getaffinity>:
+SYSCALL(sched_getaffinity)
+ 556:	b8 26 00 00 00       	mov    $0x26,%eax
+ 55b:	e9 45 fe ff ff       	jmp    3a5 <dosyscall>
+
+00000560 <irqaffinity>:
+SYSCALL(irqaffinity)
+ 560:	b8 27 00 00 00       	mov    $0x27,%eax
+ 565:	e9 3b fe ff ff       	jmp    3a5 <dosyscall>
+
+0000056a <getrusage>:
+SYSCALL(getrusage)
+ 56a:	b8 28 00 00 00       	mov    $0x28,%eax
+ 56f:	e9 31 fe ff ff       	jmp    3a5 <dosyscall>
+
+00000574 <times>:
+SYSCALL(times)
+ 574:	b8 29 00 00 00       	mov    $0x29,%eax
+ 579:	e9 27 fe ff ff       	jmp    3a5 <dosyscall>
+
+0000057e <schedlat>:
+SYSCALL(schedlat)
+ 57e:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 583:	e9 1d fe ff ff       	jmp    3a5 <dosyscall>
+
+00000588 <sched_setscheduler>:
+SYSCALL(sched_setscheduler)
+ 588:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 58d:	e9 13 fe ff ff       	jmp    3a5 <dosyscall>
+
+00000592 <sched_getscheduler>:
+SYSCALL(sched_getscheduler)
+ 592:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 597:	e9 09 fe ff ff       	jmp    3a5 <dosyscall>
+
+0000059c <sched_getparam>:
+SYSCALL(sched_getparam)
+ 59c:	b8 2d 00 00 00       	mov    $0x2d,%eax
+ 5a1:	e9 ff fd ff ff       	jmp    3a5 <dosyscall>
+
+000005a6 <lockstat>:
+SYSCALL(lockstat)
+ 5a6:	b8 2e 00 00 00       	mov    $0x2e,%eax
+ 5ab:	e9 f5 fd ff ff       	jmp    3a5 <dosyscall>
+
+000005b0 <ioring_setup>:
+SYSCALL(ioring_setup)
+ 5b0:	b8 2f 00 00 00       	mov    $0x2f,%eax
+ 5b5:	e9 eb fd ff ff       	jmp    3a5 <dosyscall>
+
+000005ba <ioring_enter>:
+SYSCALL(ioring_enter)
+ 5ba:	b8 30 00 00 00       	mov    $0x30,%eax
+ 5bf:	e9 e1 fd ff ff       	jmp    3a5 <dosyscall>
+
+000005c4 <readv>:
+SYSCALL(readv)
+ 5c4:	b8 31 00 00 00       	mov    $0x31,%eax
+ 5c9:	e9 d7 fd ff ff       	jmp    3a5 <dosyscall>
+
+000005ce <writev>:
+SYSCALL(writev)
+ 5ce:	b8 32 00 00 00       	mov    $0x32,%eax
+ 5d3:	e9 cd fd ff ff       	jmp    3a5 <dosyscall>
+
+000005d8 <pread>:
+SYSCALL(pread)
+ 5d8:	b8 33 00 00 00       	mov    $0x33,%eax
+ 5dd:	e9 c3 fd ff ff       	jmp    3a5 <dosyscall>
+
+000005e2 <pwrite>:
+SYSCALL(pwrite)
+ 5e2:	b8 34 00 00 00       	mov    $0x34,%eax
+ 5e7:	e9 b9 fd ff ff       	jmp    3a5 <dosyscall>
+
+000005ec <sendfile>:
+SYSCALL(sendfile)
+ 5ec:	b8 35 00 00 00       	mov    $0x35,%eax
+ 5f1:	e9 af fd ff ff       	jmp    3a5 <dosyscall>
+
+000005f6 <splice>:
+SYSCALL(splice)
+ 5f6:	b8 36 00 00 00       	mov    $0x36,%eax
+ 5fb:	e9 a5 fd ff ff       	jmp    3a5 <dosyscall>
+
+00000600 <sysstat>:
+SYSCALL(sysstat)
+ 600:	b8 37 00 00 00       	mov    $0x37,%eax
+ 605:	e9 9b fd ff ff       	jmp    3a5 <dosyscall>
+
+0000060a <strace>:
+SYSCALL(strace)
+ 60a:	b8 38 00 00 00       	mov    $0x38,%eax
+ 60f:	e9 91 fd ff ff       	jmp    3a5 <dosyscall>
+
+00000614 <straceread>:
+SYSCALL(straceread)
+ 614:	b8 39 00 00 00       	mov    $0x39,%eax
+ 619:	e9 87 fd ff ff       	jmp    3a5 <dosyscall>
+
+0000061e <alarm>:
+
+# alarm and rstoregs keep to int $T_SYSCALL: rstoregs restores
+# %ecx and %edx, which sysexit would clobber.
+.globl alarm
+    alarm:
+        pushl $rstoregs
+ 61e:	68 2e 06 00 00       	push   $0x62e
+        movl $SYS_alarm, %eax
+ 623:	b8 18 00 00 00       	mov    $0x18,%eax
+        int $T_SYSCALL
+ 628:	cd 40                	int    $0x40
+        add $0x04, %esp
+ 62a:	83 c4 04             	add    $0x4,%esp
+        ret
+ 62d:	c3                   	ret
+
+0000062e <rstoregs>:
+
+.globl rstoregs
+    rstoregs:
+        movl $SYS_rstoregs, %eax
+ 62e:	b8 19 00 00 00       	mov    $0x19,%eax
+        int $T_SYSCALL
+ 633:	cd 40                	int    $0x40
+
+00000635 <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 635:	55                   	push   %ebp
+ 636:	89 e5                	mov    %esp,%ebp
+ 638:	83 ec 18             	sub    $0x18,%esp
+ 63b:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 63e:	88 45 f4             	mov    %al,-0xc(%ebp)
+    write(fd, &c, 1);
+ 641:	83 ec 04             	sub    $0x4,%esp
+ 644:	6a 01                	push   $0x1
+ 646:	8d 45 f4             	lea    -0xc(%ebp),%eax
+ 649:	50                   	push   %eax
+ 64a:	ff 75 08             	push   0x8(%ebp)
+ 64d:	e8 d8 fd ff ff       	call   42a <write>
+ 652:	83 c4 10             	add    $0x10,%esp
+}
+ 655:	90                   	nop
+ 656:	c9                   	leave
+ 657:	c3                   	ret
+
+00000658 <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 658:	55                   	push   %ebp
+ 659:	89 e5                	mov    %esp,%ebp
+ 65b:	83 ec 28             	sub    $0x28,%esp
+    static char digits[] = "0123456789ABCDEF";
+    char buf[16];
+    int i, neg;
+    uint x;
+
+    neg = 0;
+ 65e:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+    if(sgn && xx < 0){
+ 665:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+ 669:	74 17                	je     682 <printint+0x2a>
+ 66b:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 66f:	79 11                	jns    682 <printint+0x2a>
+        neg = 1;
+ 671:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+        x = -xx;
+ 678:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 67b:	f7 d8                	neg    %eax
+ 67d:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 680:	eb 06                	jmp    688 <printint+0x30>
+    } else {
+        x = xx;
+ 682:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 685:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    }
+
+    i = 0;
+ 688:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    do{
+        buf[i++] = digits[x % base];
+ 68f:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 692:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 695:	ba 00 00 00 00       	mov    $0x0,%edx
+ 69a:	f7 f1                	div    %ecx
+ 69c:	89 d1                	mov    %edx,%ecx
+ 69e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 6a1:	8d 50 01             	lea    0x1(%eax),%edx
+ 6a4:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 6a7:	0f b6 91 88 0d 00 00 	movzbl 0xd88(%ecx),%edx
+ 6ae:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+    }while((x /= base) != 0);
+ 6b2:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 6b5:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 6b8:	ba 00 00 00 00       	mov    $0x0,%edx
+ 6bd:	f7 f1                	div    %ecx
+ 6bf:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 6c2:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 6c6:	75 c7                	jne    68f <printint+0x37>
+    if(neg)
+ 6c8:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 6cc:	74 2d                	je     6fb <printint+0xa3>
+        buf[i++] = '-';
+ 6ce:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 6d1:	8d 50 01             	lea    0x1(%eax),%edx
+ 6d4:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 6d7:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+    while(--i >= 0)
+ 6dc:	eb 1d                	jmp    6fb <printint+0xa3>
+        putc(fd, buf[i]);
+ 6de:	8d 55 dc             	lea    -0x24(%ebp),%edx
+ 6e1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 6e4:	01 d0                	add    %edx,%eax
+ 6e6:	0f b6 00             	movzbl (%eax),%eax
+ 6e9:	0f be c0             	movsbl %al,%eax
+ 6ec:	83 ec 08             	sub    $0x8,%esp
+ 6ef:	50                   	push   %eax
+ 6f0:	ff 75 08             	push   0x8(%ebp)
+ 6f3:	e8 3d ff ff ff       	call   635 <putc>
+ 6f8:	83 c4 10             	add    $0x10,%esp
+    while(--i >= 0)
+ 6fb:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+ 6ff:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 703:	79 d9                	jns    6de <printint+0x86>
+}
+ 705:	90                   	nop
+ 706:	90                   	nop
+ 707:	c9                   	leave
+ 708:	c3                   	ret
+
+00000709 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 709:	55                   	push   %ebp
+ 70a:	89 e5                	mov    %esp,%ebp
+ 70c:	83 ec 28             	sub    $0x28,%esp
+    char *s;
+    int c, i, state;
+    uint *ap;
+
+    state = 0;
+ 70f:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+    ap = (uint*)(void*)&fmt + 1;
+ 716:	8d 45 0c             	lea    0xc(%ebp),%eax
+ 719:	83 c0 04             	add    $0x4,%eax
+ 71c:	89 45 e8             	mov    %eax,-0x18(%ebp)
+    for(i = 0; fmt[i]; i++){
+ 71f:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 726:	e9 59 01 00 00       	jmp    884 <printf+0x17b>
+        c = fmt[i] & 0xff;
+ 72b:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 72e:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 731:	01 d0                	add    %edx,%eax
+ 733:	0f b6 00             	movzbl (%eax),%eax
+ 736:	0f be c0             	movsbl %al,%eax
+ 739:	25 ff 00 00 00       	and    $0xff,%eax
+ 73e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        if(state == 0){
+ 741:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 745:	75 2c                	jne    773 <printf+0x6a>
+            if(c == '%'){
+ 747:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 74b:	75 0c                	jne    759 <printf+0x50>
+                state = '%';
+ 74d:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+ 754:	e9 27 01 00 00       	jmp    880 <printf+0x177>
+            } else {
+                putc(fd, c);
+ 759:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 75c:	0f be c0             	movsbl %al,%eax
+ 75f:	83 ec 08             	sub    $0x8,%esp
+ 762:	50                   	push   %eax
+ 763:	ff 75 08             	push   0x8(%ebp)
+ 766:	e8 ca fe ff ff       	call   635 <putc>
+ 76b:	83 c4 10             	add    $0x10,%esp
+ 76e:	e9 0d 01 00 00       	jmp    880 <printf+0x177>
+            }
+        } else if(state == '%'){
+ 773:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+ 777:	0f 85 03 01 00 00    	jne    880 <printf+0x177>
+            if(c == 'd'){
+ 77d:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+ 781:	75 1e                	jne    7a1 <printf+0x98>
+                printint(fd, *ap, 10, 1);
+ 783:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 786:	8b 00                	mov    (%eax),%eax
+ 788:	6a 01                	push   $0x1
+ 78a:	6a 0a                	push   $0xa
+ 78c:	50                   	push   %eax
+ 78d:	ff 75 08             	push   0x8(%ebp)
+ 790:	e8 c3 fe ff ff       	call   658 <printint>
+ 795:	83 c4 10             	add    $0x10,%esp
+                ap++;
+ 798:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 79c:	e9 d8 00 00 00       	jmp    879 <printf+0x170>
+            } else if(c == 'x' || c == 'p'){
+ 7a1:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+ 7a5:	74 06                	je     7ad <printf+0xa4>
+ 7a7:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+ 7ab:	75 1e                	jne    7cb <printf+0xc2>
+                printint(fd, *ap, 16, 0);
+ 7ad:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 7b0:	8b 00                	mov    (%eax),%eax
+ 7b2:	6a 00                	push   $0x0
+ 7b4:	6a 10                	push   $0x10
+ 7b6:	50                   	push   %eax
+ 7b7:	ff 75 08             	push   0x8(%ebp)
+ 7ba:	e8 99 fe ff ff       	call   658 <printint>
+ 7bf:	83 c4 10             	add    $0x10,%esp
+                ap++;
+ 7c2:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 7c6:	e9 ae 00 00 00       	jmp    879 <printf+0x170>
+            } else if(c == 's'){
+ 7cb:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+ 7cf:	75 43                	jne    814 <printf+0x10b>
+                s = (char*)*ap;
+ 7d1:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 7d4:	8b 00                	mov    (%eax),%eax
+ 7d6:	89 45 f4             	mov    %eax,-0xc(%ebp)
+                ap++;
+ 7d9:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+                if(s == 0)
+ 7dd:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 7e1:	75 25                	jne    808 <printf+0xff>
+                    s = "(null)";
+ 7e3:	c7 45 f4 10 0b 00 00 	movl   $0xb10,-0xc(%ebp)
+                while(*s != 0){
+ 7ea:	eb 1c                	jmp    808 <printf+0xff>
+                    putc(fd, *s);
+ 7ec:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 7ef:	0f b6 00             	movzbl (%eax),%eax
+ 7f2:	0f be c0             	movsbl %al,%eax
+ 7f5:	83 ec 08             	sub    $0x8,%esp
+ 7f8:	50                   	push   %eax
+ 7f9:	ff 75 08             	push   0x8(%ebp)
+ 7fc:	e8 34 fe ff ff       	call   635 <putc>
+ 801:	83 c4 10             	add    $0x10,%esp
+                    s++;
+ 804:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+                while(*s != 0){
+ 808:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 80b:	0f b6 00             	movzbl (%eax),%eax
+ 80e:	84 c0                	test   %al,%al
+ 810:	75 da                	jne    7ec <printf+0xe3>
+ 812:	eb 65                	jmp    879 <printf+0x170>
+                }
+            } else if(c == 'c'){
+ 814:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+ 818:	75 1d                	jne    837 <printf+0x12e>
+                putc(fd, *ap);
+ 81a:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 81d:	8b 00                	mov    (%eax),%eax
+ 81f:	0f be c0             	movsbl %al,%eax
+ 822:	83 ec 08             	sub    $0x8,%esp
+ 825:	50                   	push   %eax
+ 826:	ff 75 08             	push   0x8(%ebp)
+ 829:	e8 07 fe ff ff       	call   635 <putc>
+ 82e:	83 c4 10             	add    $0x10,%esp
+                ap++;
+ 831:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 835:	eb 42                	jmp    879 <printf+0x170>
+            } else if(c == '%'){
+ 837:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 83b:	75 17                	jne    854 <printf+0x14b>
+                putc(fd, c);
+ 83d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 840:	0f be c0             	movsbl %al,%eax
+ 843:	83 ec 08             	sub    $0x8,%esp
+ 846:	50                   	push   %eax
+ 847:	ff 75 08             	push   0x8(%ebp)
+ 84a:	e8 e6 fd ff ff       	call   635 <putc>
+ 84f:	83 c4 10             	add    $0x10,%esp
+ 852:	eb 25                	jmp    879 <printf+0x170>
+            } else {
+                // Unknown % sequence.    Print it to draw attention.
+                putc(fd, '%');
+ 854:	83 ec 08             	sub    $0x8,%esp
+ 857:	6a 25                	push   $0x25
+ 859:	ff 75 08             	push   0x8(%ebp)
+ 85c:	e8 d4 fd ff ff       	call   635 <putc>
+ 861:	83 c4 10             	add    $0x10,%esp
+                putc(fd, c);
+ 864:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 867:	0f be c0             	movsbl %al,%eax
+ 86a:	83 ec 08             	sub    $0x8,%esp
+ 86d:	50                   	push   %eax
+ 86e:	ff 75 08             	push   0x8(%ebp)
+ 871:	e8 bf fd ff ff       	call   635 <putc>
+ 876:	83 c4 10             	add    $0x10,%esp
+            }
+            state = 0;
+ 879:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+    for(i = 0; fmt[i]; i++){
+ 880:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ 884:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 887:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 88a:	01 d0                	add    %edx,%eax
+ 88c:	0f b6 00             	movzbl (%eax),%eax
+ 88f:	84 c0                	test   %al,%al
+ 891:	0f 85 94 fe ff ff    	jne    72b <printf+0x22>
+        }
+    }
+}
+ 897:	90                   	nop
+ 898:	90                   	nop
+ 899:	c9                   	leave
+ 89a:	c3                   	ret
+
+0000089b <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 89b:	55                   	push   %ebp
+ 89c:	89 e5                	mov    %esp,%ebp
+ 89e:	83 ec 10             	sub    $0x10,%esp
+    Header *bp, *p;
+
+    bp = (Header*)ap - 1;
+ 8a1:	8b 45 08             	mov    0x8(%ebp),%eax
+ 8a4:	83 e8 08             	sub    $0x8,%eax
+ 8a7:	89 45 f8             	mov    %eax,-0x8(%ebp)
+    for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 8aa:	a1 a4 0d 00 00       	mov    0xda4,%eax
+ 8af:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 8b2:	eb 24                	jmp    8d8 <free+0x3d>
+        if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 8b4:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 8b7:	8b 00                	mov    (%eax),%eax
+ 8b9:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 8bc:	72 12                	jb     8d0 <free+0x35>
+ 8be:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 8c1:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 8c4:	72 24                	jb     8ea <free+0x4f>
+ 8c6:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 8c9:	8b 00                	mov    (%eax),%eax
+ 8cb:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 8ce:	72 1a                	jb     8ea <free+0x4f>
+    for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 8d0:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 8d3:	8b 00                	mov    (%eax),%eax
+ 8d5:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 8d8:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 8db:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 8de:	73 d4                	jae    8b4 <free+0x19>
+ 8e0:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 8e3:	8b 00                	mov    (%eax),%eax
+ 8e5:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 8e8:	73 ca                	jae    8b4 <free+0x19>
+            break;
+    if(bp + bp->s.size == p->s.ptr){
+ 8ea:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 8ed:	8b 40 04             	mov    0x4(%eax),%eax
+ 8f0:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 8f7:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 8fa:	01 c2                	add    %eax,%edx
+ 8fc:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 8ff:	8b 00                	mov    (%eax),%eax
+ 901:	39 c2                	cmp    %eax,%edx
+ 903:	75 24                	jne    929 <free+0x8e>
+        bp->s.size += p->s.ptr->s.size;
+ 905:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 908:	8b 50 04             	mov    0x4(%eax),%edx
+ 90b:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 90e:	8b 00                	mov    (%eax),%eax
+ 910:	8b 40 04             	mov    0x4(%eax),%eax
+ 913:	01 c2                	add    %eax,%edx
+ 915:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 918:	89 50 04             	mov    %edx,0x4(%eax)
+        bp->s.ptr = p->s.ptr->s.ptr;
+ 91b:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 91e:	8b 00                	mov    (%eax),%eax
+ 920:	8b 10                	mov    (%eax),%edx
+ 922:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 925:	89 10                	mov    %edx,(%eax)
+ 927:	eb 0a                	jmp    933 <free+0x98>
+    } else
+        bp->s.ptr = p->s.ptr;
+ 929:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 92c:	8b 10                	mov    (%eax),%edx
+ 92e:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 931:	89 10                	mov    %edx,(%eax)
+    if(p + p->s.size == bp){
+ 933:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 936:	8b 40 04             	mov    0x4(%eax),%eax
+ 939:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 940:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 943:	01 d0                	add    %edx,%eax
+ 945:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 948:	75 20                	jne    96a <free+0xcf>
+        p->s.size += bp->s.size;
+ 94a:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 94d:	8b 50 04             	mov    0x4(%eax),%edx
+ 950:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 953:	8b 40 04             	mov    0x4(%eax),%eax
+ 956:	01 c2                	add    %eax,%edx
+ 958:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 95b:	89 50 04             	mov    %edx,0x4(%eax)
+        p->s.ptr = bp->s.ptr;
+ 95e:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 961:	8b 10                	mov    (%eax),%edx
+ 963:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 966:	89 10                	mov    %edx,(%eax)
+ 968:	eb 08                	jmp    972 <free+0xd7>
+    } else
+        p->s.ptr = bp;
+ 96a:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 96d:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 970:	89 10                	mov    %edx,(%eax)
+    freep = p;
+ 972:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 975:	a3 a4 0d 00 00       	mov    %eax,0xda4
+}
+ 97a:	90                   	nop
+ 97b:	c9                   	leave
+ 97c:	c3                   	ret
+
+0000097d <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+ 97d:	55                   	push   %ebp
+ 97e:	89 e5                	mov    %esp,%ebp
+ 980:	83 ec 18             	sub    $0x18,%esp
+    char *p;
+    Header *hp;
+
+    if(nu < 4096)
+ 983:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+ 98a:	77 07                	ja     993 <morecore+0x16>
+        nu = 4096;
+ 98c:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+    p = sbrk(nu * sizeof(Header));
+ 993:	8b 45 08             	mov    0x8(%ebp),%eax
+ 996:	c1 e0 03             	shl    $0x3,%eax
+ 999:	83 ec 0c             	sub    $0xc,%esp
+ 99c:	50                   	push   %eax
+ 99d:	e8 0a fb ff ff       	call   4ac <sbrk>
+ 9a2:	83 c4 10             	add    $0x10,%esp
+ 9a5:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p == (char*)-1)
+ 9a8:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+ 9ac:	75 07                	jne    9b5 <morecore+0x38>
+        return 0;
+ 9ae:	b8 00 00 00 00       	mov    $0x0,%eax
+ 9b3:	eb 26                	jmp    9db <morecore+0x5e>
+    hp = (Header*)p;
+ 9b5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 9b8:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    hp->s.size = nu;
+ 9bb:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 9be:	8b 55 08             	mov    0x8(%ebp),%edx
+ 9c1:	89 50 04             	mov    %edx,0x4(%eax)
+    free((void*)(hp + 1));
+ 9c4:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 9c7:	83 c0 08             	add    $0x8,%eax
+ 9ca:	83 ec 0c             	sub    $0xc,%esp
+ 9cd:	50                   	push   %eax
+ 9ce:	e8 c8 fe ff ff       	call   89b <free>
+ 9d3:	83 c4 10             	add    $0x10,%esp
+    return freep;
+ 9d6:	a1 a4 0d 00 00       	mov    0xda4,%eax
+}
+ 9db:	c9                   	leave
+ 9dc:	c3                   	ret
+
+000009dd <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ 9dd:	55                   	push   %ebp
+ 9de:	89 e5                	mov    %esp,%ebp
+ 9e0:	83 ec 18             	sub    $0x18,%esp
+    Header *p, *prevp;
+    uint nunits;
+
+    nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 9e3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 9e6:	83 c0 07             	add    $0x7,%eax
+ 9e9:	c1 e8 03             	shr    $0x3,%eax
+ 9ec:	83 c0 01             	add    $0x1,%eax
+ 9ef:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    if((prevp = freep) == 0){
+ 9f2:	a1 a4 0d 00 00       	mov    0xda4,%eax
+ 9f7:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ 9fa:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 9fe:	75 23                	jne    a23 <malloc+0x46>
+        base.s.ptr = freep = prevp = &base;
+ a00:	c7 45 f0 9c 0d 00 00 	movl   $0xd9c,-0x10(%ebp)
+ a07:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ a0a:	a3 a4 0d 00 00       	mov    %eax,0xda4
+ a0f:	a1 a4 0d 00 00       	mov    0xda4,%eax
+ a14:	a3 9c 0d 00 00       	mov    %eax,0xd9c
+        base.s.size = 0;
+ a19:	c7 05 a0 0d 00 00 00 	movl   $0x0,0xda0
+ a20:	00 00 00 
+    }
+    for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ a23:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ a26:	8b 00                	mov    (%eax),%eax
+ a28:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        if(p->s.size >= nunits){
+ a2b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a2e:	8b 40 04             	mov    0x4(%eax),%eax
+ a31:	3b 45 ec             	cmp    -0x14(%ebp),%eax
+ a34:	72 4d                	jb     a83 <malloc+0xa6>
+            if(p->s.size == nunits)
+ a36:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a39:	8b 40 04             	mov    0x4(%eax),%eax
+ a3c:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+ a3f:	75 0c                	jne    a4d <malloc+0x70>
+                prevp->s.ptr = p->s.ptr;
+ a41:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a44:	8b 10                	mov    (%eax),%edx
+ a46:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ a49:	89 10                	mov    %edx,(%eax)
+ a4b:	eb 26                	jmp    a73 <malloc+0x96>
+            else {
+                p->s.size -= nunits;
+ a4d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a50:	8b 40 04             	mov    0x4(%eax),%eax
+ a53:	2b 45 ec             	sub    -0x14(%ebp),%eax
+ a56:	89 c2                	mov    %eax,%edx
+ a58:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a5b:	89 50 04             	mov    %edx,0x4(%eax)
+                p += p->s.size;
+ a5e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a61:	8b 40 04             	mov    0x4(%eax),%eax
+ a64:	c1 e0 03             	shl    $0x3,%eax
+ a67:	01 45 f4             	add    %eax,-0xc(%ebp)
+                p->s.size = nunits;
+ a6a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a6d:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ a70:	89 50 04             	mov    %edx,0x4(%eax)
+            }
+            freep = prevp;
+ a73:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ a76:	a3 a4 0d 00 00       	mov    %eax,0xda4
+            return (void*)(p + 1);
+ a7b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a7e:	83 c0 08             	add    $0x8,%eax
+ a81:	eb 3b                	jmp    abe <malloc+0xe1>
+        }
+        if(p == freep)
+ a83:	a1 a4 0d 00 00       	mov    0xda4,%eax
+ a88:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ a8b:	75 1e                	jne    aab <malloc+0xce>
+            if((p = morecore(nunits)) == 0)
+ a8d:	83 ec 0c             	sub    $0xc,%esp
+ a90:	ff 75 ec             	push   -0x14(%ebp)
+ a93:	e8 e5 fe ff ff       	call   97d <morecore>
+ a98:	83 c4 10             	add    $0x10,%esp
+ a9b:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ a9e:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ aa2:	75 07                	jne    aab <malloc+0xce>
+                return 0;
+ aa4:	b8 00 00 00 00       	mov    $0x0,%eax
+ aa9:	eb 13                	jmp    abe <malloc+0xe1>
+    for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ aab:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ aae:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ ab1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ ab4:	8b 00                	mov    (%eax),%eax
+ ab6:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        if(p->s.size >= nunits){
+ ab9:	e9 6d ff ff ff       	jmp    a2b <malloc+0x4e>
+    }
+}
+ abe:	c9                   	leave
+ abf:	c3                   	ret
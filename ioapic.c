@@ -5,6 +5,7 @@
 #include "types.h"
 #include "defs.h"
 #include "traps.h"
+#include "spinlock.h"
 
 #define IOAPIC    0xFEC00000     // Default physical address of IO APIC
 
@@ -23,6 +24,8 @@
 #define INT_LOGICAL        0x00000800    // Destination is CPU id (vs APIC ID)
 
 volatile struct ioapic *ioapic;
+static int maxintr;
+static struct spinlock ioapiclock;    // for ioapicroute() at run time
 
 // IO APIC MMIO structure: write reg, then read or write data.
 struct ioapic {
@@ -48,8 +51,9 @@ ioapicwrite(int reg, uint data)
 void
 ioapicinit(void)
 {
-    int i, id, maxintr;
+    int i, id;
 
+    initlock(&ioapiclock, "ioapic", 1);
     ioapic = (volatile struct ioapic*)IOAPIC;
     maxintr = (ioapicread(REG_VER) >> 16) & 0xFF;
     id = ioapicread(REG_ID) >> 24;
@@ -73,3 +77,22 @@ ioapicenable(int irq, int cpunum)
     ioapicwrite(REG_TABLE+2*irq, T_IRQ0 + irq);
     ioapicwrite(REG_TABLE+2*irq+1, cpunum << 24);
 }
+
+// Route an enabled interrupt to the cpu with the given APIC ID.
+// Return -1 if irq is out of range or not enabled.
+int
+ioapicroute(int irq, int apicid)
+{
+    int r;
+
+    if(irq < 0 || irq > maxintr)
+        return -1;
+    r = -1;
+    acquire(&ioapiclock);
+    if(!(ioapicread(REG_TABLE+2*irq) & INT_DISABLED)){
+        ioapicwrite(REG_TABLE+2*irq+1, apicid << 24);
+        r = 0;
+    }
+    release(&ioapiclock);
+    return r;
+}
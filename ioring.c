@@ -0,0 +1,355 @@
+// Asynchronous file operations through shared rings (ioring.h).
+//
+// ioring_enter() runs in the submitting process.    It takes entries
+// off the submission ring, runs opens and closes on the spot, and
+// queues reads, writes and fsyncs for a small pool of kernel worker
+// processes.    Those have no user memory, so the submitter first
+// faults in and pins the pages of each buffer; a worker reaches them
+// through their kernel addresses and then posts the completion into
+// the shared page, which the kernel keeps its own reference to.
+//
+// An operation is counted in ctx->inflight from the moment its entry
+// is taken until its completion is posted, and entries are only
+// taken while the completion ring has room for all of them.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "memlayout.h"
+#include "mmu.h"
+#include "spinlock.h"
+#include "proc.h"
+#include "fs.h"
+#include "sleeplock.h"
+#include "file.h"
+#include "ioring.h"
+#include "vdso.h"
+
+#define NIOWORKER     4    // Worker processes
+#define NIOREQ       64    // Operations queued for the workers, system-wide
+#define IOMAXPAGES    8    // Pages pinned for one operation
+
+#define min(a, b) ((a) < (b) ? (a) : (b))
+
+struct ioctx {
+    struct spinlock lock;
+    struct ioring *ring;    // Kernel address of the shared page
+    int inflight;           // Entries taken but not yet completed
+    int fileopen;           // Some struct file still refers to this ctx
+};
+
+// A read, write or fsync waiting for or held by a worker.
+struct ioreq {
+    struct ioctx *ctx;
+    struct file *f;
+    int op;
+    int off;
+    uint len;
+    uint pgoff;             // Offset of the buffer in its first page
+    int npage;
+    uint pa[IOMAXPAGES];    // Pinned pages of the buffer
+    uint data;
+    struct ioreq *next;
+};
+
+static struct {
+    struct spinlock lock;
+    struct ioreq req[NIOREQ];
+    struct ioreq *free;
+    struct ioreq *head;     // Queued for a worker, oldest first
+    struct ioreq *tail;
+    int nworker;
+} ioq;
+
+static void ioworker(void);
+
+void
+ioringinit(void)
+{
+    struct ioreq *r;
+
+    initlock(&ioq.lock, "ioq", 1);
+    for(r = ioq.req; r < ioq.req + NIOREQ; r++){
+        r->next = ioq.free;
+        ioq.free = r;
+    }
+}
+
+// Create a ring, map its page at the end of the caller's heap,
+// and return a file for it, setting *addr to the page's address.
+int
+ioringalloc(struct file **f, uint *addr)
+{
+    struct proc *curproc = myproc();
+    struct ioctx *ctx;
+    char *page;
+    uint a;
+    int i, start;
+
+    ctx = 0;
+    page = 0;
+    if((*f = filealloc()) == 0)
+        goto bad;
+    if((ctx = (struct ioctx*)kalloc()) == 0 || (page = kalloc()) == 0)
+        goto bad;
+
+    // The first ring starts the workers.
+    acquire(&ioq.lock);
+    start = ioq.nworker;
+    ioq.nworker = NIOWORKER;
+    release(&ioq.lock);
+    for(i = start; i < NIOWORKER; i++){
+        if(kproc("ioworker", ioworker) == 0){
+            acquire(&ioq.lock);
+            ioq.nworker = i;
+            release(&ioq.lock);
+            goto bad;
+        }
+    }
+
+    a = PGROUNDUP(curproc->heap.start + curproc->heap.sz);
+    if(a + PGSIZE > VDSOADDR)
+        goto bad;
+    memset(page, 0, PGSIZE);
+    if(mappage(curproc->pgdir, (char*)a, V2P(page), PTE_W|PTE_U|PTE_SHARED) < 0)
+        goto bad;
+    curproc->heap.sz = a + PGSIZE - curproc->heap.start;
+    // The process may unmap the page with sbrk(); workers still
+    // post completions to it until the ring is closed.
+    kincref(V2P(page));
+
+    initlock(&ctx->lock, "ioring", 1);
+    ctx->ring = (struct ioring*)page;
+    ctx->inflight = 0;
+    ctx->fileopen = 1;
+    (*f)->type = FD_IORING;
+    (*f)->readable = 0;
+    (*f)->writable = 0;
+    (*f)->ioctx = ctx;
+    *addr = a;
+    return 0;
+
+ bad:
+    if(page)
+        kfree(page);
+    if(ctx)
+        kfree((char*)ctx);
+    if(*f)
+        fileclose(*f);
+    return -1;
+}
+
+// Free ctx if nothing refers to it any more.
+// Called with ctx->lock held; releases it.
+static void
+ioctxfree(struct ioctx *ctx)
+{
+    if(ctx->fileopen == 0 && ctx->inflight == 0){
+        release(&ctx->lock);
+        kdecref(V2P(ctx->ring));
+        kfree((char*)ctx);
+    } else
+        release(&ctx->lock);
+}
+
+// The last file referring to ctx has been closed.    Operations
+// still in flight finish, and the ring goes away after them.
+void
+ioringclose(struct ioctx *ctx)
+{
+    acquire(&ctx->lock);
+    ctx->fileopen = 0;
+    ioctxfree(ctx);
+}
+
+// Take the next submission into *e, unless the ring is empty or
+// the completion ring could not hold its result.
+// Return 1 if an entry was taken, else 0.
+int
+ioringnext(struct ioctx *ctx, struct iosqe *e)
+{
+    struct ioring *ring = ctx->ring;
+    uint head, ncq;
+
+    acquire(&ctx->lock);
+    head = ring->sqhead;
+    // cqhead belongs to the process; treat nonsense as a full ring.
+    ncq = ring->cqtail - ring->cqhead;
+    if(head == ring->sqtail || ncq > IORING_CQ ||
+       ncq + ctx->inflight >= IORING_CQ){
+        release(&ctx->lock);
+        return 0;
+    }
+    ctx->inflight++;
+    // Copy the entry, since the process may change it at any time,
+    // and advance sqhead before another enter on the same ring,
+    // perhaps from a forked child, can take it too.
+    *e = ring->sq[head % IORING_SQ];
+    ring->sqhead = head + 1;
+    release(&ctx->lock);
+    return 1;
+}
+
+// Post the completion of an entry taken by ioringnext().
+void
+ioringpost(struct ioctx *ctx, uint data, int res)
+{
+    struct ioring *ring = ctx->ring;
+    struct iocqe *c;
+
+    acquire(&ctx->lock);
+    c = &ring->cq[ring->cqtail % IORING_CQ];
+    c->data = data;
+    c->res = res;
+    // The process must see the entry before the new tail.
+    __sync_synchronize();
+    ring->cqtail++;
+    ctx->inflight--;
+    wakeup(ctx);
+    ioctxfree(ctx);
+}
+
+// Hand a read, write or fsync on f to the workers.    Takes over
+// the caller's reference to f.
+void
+ioringsubmit(struct ioctx *ctx, struct file *f, struct iosqe *e)
+{
+    struct ioreq *r;
+    uint len;
+    int n;
+
+    r = 0;
+    len = 0;
+    n = 0;
+    if(e->op == IOOP_READ || e->op == IOOP_WRITE){
+        // Longer transfers complete short, as a pipe's would.
+        len = min(e->len, IOMAXPAGES*PGSIZE - e->addr % PGSIZE);
+        if(len > 0 && !checkrange(e->addr, len))
+            goto bad;
+    }
+
+    acquire(&ioq.lock);
+    if((r = ioq.free) != 0)
+        ioq.free = r->next;
+    release(&ioq.lock);
+    if(r == 0)
+        goto bad;
+
+    r->ctx = ctx;
+    r->f = f;
+    r->op = e->op;
+    r->off = e->off;
+    r->data = e->data;
+    r->npage = 0;
+    r->len = 0;
+    if(e->op == IOOP_READ || e->op == IOOP_WRITE){
+        r->pgoff = e->addr % PGSIZE;
+        if(len > 0 && (n = pinuvm(e->addr, len, e->op == IOOP_READ, r->pa)) < 0)
+            goto bad;
+        r->npage = n;
+        r->len = len;
+    }
+
+    acquire(&ioq.lock);
+    r->next = 0;
+    if(ioq.head)
+        ioq.tail->next = r;
+    else
+        ioq.head = r;
+    ioq.tail = r;
+    wakeone(&ioq.head);
+    release(&ioq.lock);
+    return;
+
+ bad:
+    if(r){
+        acquire(&ioq.lock);
+        r->next = ioq.free;
+        ioq.free = r;
+        release(&ioq.lock);
+    }
+    fileclose(f);
+    ioringpost(ctx, e->data, -1);
+}
+
+// Move r's data between f and the pinned pages, a page at a time.
+static int
+iorw(struct ioreq *r)
+{
+    uint done, n, pgoff;
+    char *a;
+    int i, k;
+
+    done = 0;
+    pgoff = r->pgoff;
+    for(i = 0; i < r->npage && done < r->len; i++){
+        a = (char*)P2V(r->pa[i]) + pgoff;
+        n = min(r->len - done, PGSIZE - pgoff);
+        if(r->op == IOOP_READ){
+            if(r->off < 0)
+                k = fileread(r->f, a, n);
+            else
+                k = filepread(r->f, a, n, r->off + done);
+        } else {
+            if(r->off < 0)
+                k = filewrite(r->f, a, n);
+            else
+                k = filepwrite(r->f, a, n, r->off + done);
+        }
+        if(k < 0)
+            return done > 0 ? done : -1;
+        done += k;
+        if(k < n)
+            break;
+        pgoff = 0;
+    }
+    return done;
+}
+
+static void
+ioworker(void)
+{
+    struct ioreq *r;
+    int res;
+
+    for(;;){
+        acquire(&ioq.lock);
+        while((r = ioq.head) == 0)
+            sleep(&ioq.head, &ioq.lock);
+        ioq.head = r->next;
+        release(&ioq.lock);
+
+        if(r->op == IOOP_FSYNC){
+            logsync();
+            res = 0;
+        } else
+            res = iorw(r);
+        unpinuvm(r->pa, r->npage);
+        fileclose(r->f);
+        ioringpost(r->ctx, r->data, res);
+
+        acquire(&ioq.lock);
+        r->next = ioq.free;
+        ioq.free = r;
+        release(&ioq.lock);
+    }
+}
+
+// Wait until at least n completions are waiting in the ring, or
+// nothing more is in flight.    Return -1 if killed, else 0.
+int
+ioringwait(struct ioctx *ctx, int n)
+{
+    struct ioring *ring = ctx->ring;
+
+    acquire(&ctx->lock);
+    while(ring->cqtail - ring->cqhead < (uint)n && ctx->inflight > 0){
+        if(myproc()->killed){
+            release(&ctx->lock);
+            return -1;
+        }
+        sleep(ctx, &ctx->lock);
+    }
+    release(&ctx->lock);
+    return 0;
+}
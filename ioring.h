@@ -0,0 +1,43 @@
+// Submission and completion rings shared between a process and
+// the kernel, for batching file operations.
+//
+// ioring_setup() maps one page laid out as a struct ioring into the
+// caller's heap.    The process fills in sq[sqtail % IORING_SQ] and
+// advances sqtail; ioring_enter() takes entries from sqhead, and the
+// kernel posts a struct iocqe at cq[cqtail % IORING_CQ] as each
+// operation finishes, in any order.    The process reads completions
+// from cqhead and advances it.
+
+#define IORING_SQ     64
+#define IORING_CQ    128
+
+// Operations.
+#define IOOP_NOP      0
+#define IOOP_READ     1    // read(fd, addr, len)
+#define IOOP_WRITE    2    // write(fd, addr, len)
+#define IOOP_OPEN     3    // open(addr, len)
+#define IOOP_CLOSE    4    // close(fd)
+#define IOOP_FSYNC    5    // wait until writes to disk so far are durable
+
+struct iosqe {
+    int op;
+    int fd;
+    uint addr;        // Buffer, or path for IOOP_OPEN
+    uint len;         // Bytes, or mode for IOOP_OPEN
+    int off;          // File offset, or -1 to use and advance fd's own
+    uint data;        // Handed back in the completion
+};
+
+struct iocqe {
+    uint data;
+    int res;          // What the matching system call would return
+};
+
+struct ioring {
+    volatile uint sqhead;    // Advanced by the kernel
+    volatile uint sqtail;    // Advanced by the process
+    volatile uint cqhead;    // Advanced by the process
+    volatile uint cqtail;    // Advanced by the kernel
+    struct iosqe sq[IORING_SQ];
+    struct iocqe cq[IORING_CQ];
+};
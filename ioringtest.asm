@@ -0,0 +1,1745 @@
+
+_ioringtest:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <submit>:
+struct ioring *ring;
+int rfd;
+
+void
+submit(int op, int fd, void *addr, uint len, int off, uint data)
+{
+   0:	55                   	push   %ebp
+   1:	89 e5                	mov    %esp,%ebp
+   3:	83 ec 10             	sub    $0x10,%esp
+    struct iosqe *e;
+
+    e = &ring->sq[ring->sqtail % IORING_SQ];
+   6:	8b 0d e0 10 00 00    	mov    0x10e0,%ecx
+   c:	a1 e0 10 00 00       	mov    0x10e0,%eax
+  11:	8b 40 04             	mov    0x4(%eax),%eax
+  14:	83 e0 3f             	and    $0x3f,%eax
+  17:	89 c2                	mov    %eax,%edx
+  19:	89 d0                	mov    %edx,%eax
+  1b:	01 c0                	add    %eax,%eax
+  1d:	01 d0                	add    %edx,%eax
+  1f:	c1 e0 03             	shl    $0x3,%eax
+  22:	83 c0 10             	add    $0x10,%eax
+  25:	01 c8                	add    %ecx,%eax
+  27:	89 45 fc             	mov    %eax,-0x4(%ebp)
+    e->op = op;
+  2a:	8b 45 fc             	mov    -0x4(%ebp),%eax
+  2d:	8b 55 08             	mov    0x8(%ebp),%edx
+  30:	89 10                	mov    %edx,(%eax)
+    e->fd = fd;
+  32:	8b 45 fc             	mov    -0x4(%ebp),%eax
+  35:	8b 55 0c             	mov    0xc(%ebp),%edx
+  38:	89 50 04             	mov    %edx,0x4(%eax)
+    e->addr = (uint)addr;
+  3b:	8b 55 10             	mov    0x10(%ebp),%edx
+  3e:	8b 45 fc             	mov    -0x4(%ebp),%eax
+  41:	89 50 08             	mov    %edx,0x8(%eax)
+    e->len = len;
+  44:	8b 45 fc             	mov    -0x4(%ebp),%eax
+  47:	8b 55 14             	mov    0x14(%ebp),%edx
+  4a:	89 50 0c             	mov    %edx,0xc(%eax)
+    e->off = off;
+  4d:	8b 45 fc             	mov    -0x4(%ebp),%eax
+  50:	8b 55 18             	mov    0x18(%ebp),%edx
+  53:	89 50 10             	mov    %edx,0x10(%eax)
+    e->data = data;
+  56:	8b 45 fc             	mov    -0x4(%ebp),%eax
+  59:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  5c:	89 50 14             	mov    %edx,0x14(%eax)
+    ring->sqtail++;
+  5f:	a1 e0 10 00 00       	mov    0x10e0,%eax
+  64:	8b 50 04             	mov    0x4(%eax),%edx
+  67:	83 c2 01             	add    $0x1,%edx
+  6a:	89 50 04             	mov    %edx,0x4(%eax)
+}
+  6d:	90                   	nop
+  6e:	c9                   	leave
+  6f:	c3                   	ret
+
+00000070 <reap>:
+// Submit everything queued, wait for n completions, and check
+// that each succeeded with res bytes, or any res if res < 0.
+// Return the result of the last one.
+int
+reap(int n, int res)
+{
+  70:	55                   	push   %ebp
+  71:	89 e5                	mov    %esp,%ebp
+  73:	83 ec 18             	sub    $0x18,%esp
+    struct iocqe *c;
+    int i, r;
+
+    if(ioring_enter(rfd, IORING_SQ, n) < 0){
+  76:	a1 e4 10 00 00       	mov    0x10e4,%eax
+  7b:	83 ec 04             	sub    $0x4,%esp
+  7e:	ff 75 08             	push   0x8(%ebp)
+  81:	6a 40                	push   $0x40
+  83:	50                   	push   %eax
+  84:	e8 ec 07 00 00       	call   875 <ioring_enter>
+  89:	83 c4 10             	add    $0x10,%esp
+  8c:	85 c0                	test   %eax,%eax
+  8e:	79 17                	jns    a7 <reap+0x37>
+        printf(1, "ioring_enter failed\n");
+  90:	83 ec 08             	sub    $0x8,%esp
+  93:	68 7b 0d 00 00       	push   $0xd7b
+  98:	6a 01                	push   $0x1
+  9a:	e8 25 09 00 00       	call   9c4 <printf>
+  9f:	83 c4 10             	add    $0x10,%esp
+        exit();
+  a2:	e8 1f 06 00 00       	call   6c6 <exit>
+    }
+    r = 0;
+  a7:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+    for(i = 0; i < n; i++){
+  ae:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  b5:	e9 95 00 00 00       	jmp    14f <reap+0xdf>
+        if(ring->cqhead == ring->cqtail){
+  ba:	a1 e0 10 00 00       	mov    0x10e0,%eax
+  bf:	8b 50 08             	mov    0x8(%eax),%edx
+  c2:	a1 e0 10 00 00       	mov    0x10e0,%eax
+  c7:	8b 40 0c             	mov    0xc(%eax),%eax
+  ca:	39 c2                	cmp    %eax,%edx
+  cc:	75 17                	jne    e5 <reap+0x75>
+            printf(1, "missing completion\n");
+  ce:	83 ec 08             	sub    $0x8,%esp
+  d1:	68 90 0d 00 00       	push   $0xd90
+  d6:	6a 01                	push   $0x1
+  d8:	e8 e7 08 00 00       	call   9c4 <printf>
+  dd:	83 c4 10             	add    $0x10,%esp
+            exit();
+  e0:	e8 e1 05 00 00       	call   6c6 <exit>
+        }
+        c = &ring->cq[ring->cqhead % IORING_CQ];
+  e5:	8b 15 e0 10 00 00    	mov    0x10e0,%edx
+  eb:	a1 e0 10 00 00       	mov    0x10e0,%eax
+  f0:	8b 40 08             	mov    0x8(%eax),%eax
+  f3:	83 e0 7f             	and    $0x7f,%eax
+  f6:	05 c2 00 00 00       	add    $0xc2,%eax
+  fb:	c1 e0 03             	shl    $0x3,%eax
+  fe:	01 d0                	add    %edx,%eax
+ 100:	89 45 ec             	mov    %eax,-0x14(%ebp)
+        r = c->res;
+ 103:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 106:	8b 40 04             	mov    0x4(%eax),%eax
+ 109:	89 45 f0             	mov    %eax,-0x10(%ebp)
+        if(r < 0 || (res >= 0 && r != res)){
+ 10c:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 110:	78 0e                	js     120 <reap+0xb0>
+ 112:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 116:	78 25                	js     13d <reap+0xcd>
+ 118:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 11b:	3b 45 0c             	cmp    0xc(%ebp),%eax
+ 11e:	74 1d                	je     13d <reap+0xcd>
+            printf(1, "op %d returned %d\n", c->data, r);
+ 120:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 123:	8b 00                	mov    (%eax),%eax
+ 125:	ff 75 f0             	push   -0x10(%ebp)
+ 128:	50                   	push   %eax
+ 129:	68 a4 0d 00 00       	push   $0xda4
+ 12e:	6a 01                	push   $0x1
+ 130:	e8 8f 08 00 00       	call   9c4 <printf>
+ 135:	83 c4 10             	add    $0x10,%esp
+            exit();
+ 138:	e8 89 05 00 00       	call   6c6 <exit>
+        }
+        ring->cqhead++;
+ 13d:	a1 e0 10 00 00       	mov    0x10e0,%eax
+ 142:	8b 50 08             	mov    0x8(%eax),%edx
+ 145:	83 c2 01             	add    $0x1,%edx
+ 148:	89 50 08             	mov    %edx,0x8(%eax)
+    for(i = 0; i < n; i++){
+ 14b:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+ 14f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 152:	3b 45 08             	cmp    0x8(%ebp),%eax
+ 155:	0f 8c 5f ff ff ff    	jl     ba <reap+0x4a>
+    }
+    return r;
+ 15b:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ 15e:	c9                   	leave
+ 15f:	c3                   	ret
+
+00000160 <main>:
+
+int
+main(int argc, char *argv[])
+{
+ 160:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+ 164:	83 e4 f0             	and    $0xfffffff0,%esp
+ 167:	ff 71 fc             	push   -0x4(%ecx)
+ 16a:	55                   	push   %ebp
+ 16b:	89 e5                	mov    %esp,%ebp
+ 16d:	51                   	push   %ecx
+ 16e:	83 ec 14             	sub    $0x14,%esp
+    static char wbuf[NBLK][BLK], rbuf[NBLK][BLK];
+    int fd, i, j;
+
+    printf(1, "ioringtest starting\n");
+ 171:	83 ec 08             	sub    $0x8,%esp
+ 174:	68 b7 0d 00 00       	push   $0xdb7
+ 179:	6a 01                	push   $0x1
+ 17b:	e8 44 08 00 00       	call   9c4 <printf>
+ 180:	83 c4 10             	add    $0x10,%esp
+    if((rfd = ioring_setup(&ring)) < 0){
+ 183:	83 ec 0c             	sub    $0xc,%esp
+ 186:	68 e0 10 00 00       	push   $0x10e0
+ 18b:	e8 db 06 00 00       	call   86b <ioring_setup>
+ 190:	83 c4 10             	add    $0x10,%esp
+ 193:	a3 e4 10 00 00       	mov    %eax,0x10e4
+ 198:	a1 e4 10 00 00       	mov    0x10e4,%eax
+ 19d:	85 c0                	test   %eax,%eax
+ 19f:	79 17                	jns    1b8 <main+0x58>
+        printf(1, "ioring_setup failed\n");
+ 1a1:	83 ec 08             	sub    $0x8,%esp
+ 1a4:	68 cc 0d 00 00       	push   $0xdcc
+ 1a9:	6a 01                	push   $0x1
+ 1ab:	e8 14 08 00 00       	call   9c4 <printf>
+ 1b0:	83 c4 10             	add    $0x10,%esp
+        exit();
+ 1b3:	e8 0e 05 00 00       	call   6c6 <exit>
+    }
+
+    submit(IOOP_OPEN, 0, "ioringfile", O_CREATE|O_RDWR, 0, 0);
+ 1b8:	83 ec 08             	sub    $0x8,%esp
+ 1bb:	6a 00                	push   $0x0
+ 1bd:	6a 00                	push   $0x0
+ 1bf:	68 02 02 00 00       	push   $0x202
+ 1c4:	68 e1 0d 00 00       	push   $0xde1
+ 1c9:	6a 00                	push   $0x0
+ 1cb:	6a 03                	push   $0x3
+ 1cd:	e8 2e fe ff ff       	call   0 <submit>
+ 1d2:	83 c4 20             	add    $0x20,%esp
+    fd = reap(1, -1);
+ 1d5:	83 ec 08             	sub    $0x8,%esp
+ 1d8:	6a ff                	push   $0xffffffff
+ 1da:	6a 01                	push   $0x1
+ 1dc:	e8 8f fe ff ff       	call   70 <reap>
+ 1e1:	83 c4 10             	add    $0x10,%esp
+ 1e4:	89 45 ec             	mov    %eax,-0x14(%ebp)
+
+    for(i = 0; i < NBLK; i++){
+ 1e7:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 1ee:	eb 69                	jmp    259 <main+0xf9>
+        for(j = 0; j < BLK; j++)
+ 1f0:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 1f7:	eb 24                	jmp    21d <main+0xbd>
+            wbuf[i][j] = i + j;
+ 1f9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 1fc:	89 c2                	mov    %eax,%edx
+ 1fe:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 201:	01 d0                	add    %edx,%eax
+ 203:	89 c1                	mov    %eax,%ecx
+ 205:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 208:	c1 e0 09             	shl    $0x9,%eax
+ 20b:	89 c2                	mov    %eax,%edx
+ 20d:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 210:	01 d0                	add    %edx,%eax
+ 212:	05 00 11 00 00       	add    $0x1100,%eax
+ 217:	88 08                	mov    %cl,(%eax)
+        for(j = 0; j < BLK; j++)
+ 219:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ 21d:	81 7d f0 ff 01 00 00 	cmpl   $0x1ff,-0x10(%ebp)
+ 224:	7e d3                	jle    1f9 <main+0x99>
+        submit(IOOP_WRITE, fd, wbuf[i], BLK, i*BLK, i);
+ 226:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 229:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 22c:	89 d1                	mov    %edx,%ecx
+ 22e:	c1 e1 09             	shl    $0x9,%ecx
+ 231:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 234:	c1 e2 09             	shl    $0x9,%edx
+ 237:	81 c2 00 11 00 00    	add    $0x1100,%edx
+ 23d:	83 ec 08             	sub    $0x8,%esp
+ 240:	50                   	push   %eax
+ 241:	51                   	push   %ecx
+ 242:	68 00 02 00 00       	push   $0x200
+ 247:	52                   	push   %edx
+ 248:	ff 75 ec             	push   -0x14(%ebp)
+ 24b:	6a 02                	push   $0x2
+ 24d:	e8 ae fd ff ff       	call   0 <submit>
+ 252:	83 c4 20             	add    $0x20,%esp
+    for(i = 0; i < NBLK; i++){
+ 255:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+ 259:	83 7d f4 07          	cmpl   $0x7,-0xc(%ebp)
+ 25d:	7e 91                	jle    1f0 <main+0x90>
+    }
+    reap(NBLK, BLK);
+ 25f:	83 ec 08             	sub    $0x8,%esp
+ 262:	68 00 02 00 00       	push   $0x200
+ 267:	6a 08                	push   $0x8
+ 269:	e8 02 fe ff ff       	call   70 <reap>
+ 26e:	83 c4 10             	add    $0x10,%esp
+    submit(IOOP_FSYNC, fd, 0, 0, 0, 0);
+ 271:	83 ec 08             	sub    $0x8,%esp
+ 274:	6a 00                	push   $0x0
+ 276:	6a 00                	push   $0x0
+ 278:	6a 00                	push   $0x0
+ 27a:	6a 00                	push   $0x0
+ 27c:	ff 75 ec             	push   -0x14(%ebp)
+ 27f:	6a 05                	push   $0x5
+ 281:	e8 7a fd ff ff       	call   0 <submit>
+ 286:	83 c4 20             	add    $0x20,%esp
+    reap(1, 0);
+ 289:	83 ec 08             	sub    $0x8,%esp
+ 28c:	6a 00                	push   $0x0
+ 28e:	6a 01                	push   $0x1
+ 290:	e8 db fd ff ff       	call   70 <reap>
+ 295:	83 c4 10             	add    $0x10,%esp
+
+    for(i = 0; i < NBLK; i++)
+ 298:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 29f:	eb 33                	jmp    2d4 <main+0x174>
+        submit(IOOP_READ, fd, rbuf[i], BLK, i*BLK, i);
+ 2a1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 2a4:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 2a7:	89 d1                	mov    %edx,%ecx
+ 2a9:	c1 e1 09             	shl    $0x9,%ecx
+ 2ac:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 2af:	c1 e2 09             	shl    $0x9,%edx
+ 2b2:	81 c2 00 21 00 00    	add    $0x2100,%edx
+ 2b8:	83 ec 08             	sub    $0x8,%esp
+ 2bb:	50                   	push   %eax
+ 2bc:	51                   	push   %ecx
+ 2bd:	68 00 02 00 00       	push   $0x200
+ 2c2:	52                   	push   %edx
+ 2c3:	ff 75 ec             	push   -0x14(%ebp)
+ 2c6:	6a 01                	push   $0x1
+ 2c8:	e8 33 fd ff ff       	call   0 <submit>
+ 2cd:	83 c4 20             	add    $0x20,%esp
+    for(i = 0; i < NBLK; i++)
+ 2d0:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+ 2d4:	83 7d f4 07          	cmpl   $0x7,-0xc(%ebp)
+ 2d8:	7e c7                	jle    2a1 <main+0x141>
+    reap(NBLK, BLK);
+ 2da:	83 ec 08             	sub    $0x8,%esp
+ 2dd:	68 00 02 00 00       	push   $0x200
+ 2e2:	6a 08                	push   $0x8
+ 2e4:	e8 87 fd ff ff       	call   70 <reap>
+ 2e9:	83 c4 10             	add    $0x10,%esp
+    submit(IOOP_CLOSE, fd, 0, 0, 0, 0);
+ 2ec:	83 ec 08             	sub    $0x8,%esp
+ 2ef:	6a 00                	push   $0x0
+ 2f1:	6a 00                	push   $0x0
+ 2f3:	6a 00                	push   $0x0
+ 2f5:	6a 00                	push   $0x0
+ 2f7:	ff 75 ec             	push   -0x14(%ebp)
+ 2fa:	6a 04                	push   $0x4
+ 2fc:	e8 ff fc ff ff       	call   0 <submit>
+ 301:	83 c4 20             	add    $0x20,%esp
+    reap(1, 0);
+ 304:	83 ec 08             	sub    $0x8,%esp
+ 307:	6a 00                	push   $0x0
+ 309:	6a 01                	push   $0x1
+ 30b:	e8 60 fd ff ff       	call   70 <reap>
+ 310:	83 c4 10             	add    $0x10,%esp
+
+    for(i = 0; i < NBLK; i++){
+ 313:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 31a:	eb 62                	jmp    37e <main+0x21e>
+        for(j = 0; j < BLK; j++){
+ 31c:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 323:	eb 4c                	jmp    371 <main+0x211>
+            if(wbuf[i][j] != rbuf[i][j]){
+ 325:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 328:	c1 e0 09             	shl    $0x9,%eax
+ 32b:	89 c2                	mov    %eax,%edx
+ 32d:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 330:	01 d0                	add    %edx,%eax
+ 332:	05 00 11 00 00       	add    $0x1100,%eax
+ 337:	0f b6 10             	movzbl (%eax),%edx
+ 33a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 33d:	c1 e0 09             	shl    $0x9,%eax
+ 340:	89 c1                	mov    %eax,%ecx
+ 342:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 345:	01 c8                	add    %ecx,%eax
+ 347:	05 00 21 00 00       	add    $0x2100,%eax
+ 34c:	0f b6 00             	movzbl (%eax),%eax
+ 34f:	38 c2                	cmp    %al,%dl
+ 351:	74 1a                	je     36d <main+0x20d>
+                printf(1, "block %d differs at %d\n", i, j);
+ 353:	ff 75 f0             	push   -0x10(%ebp)
+ 356:	ff 75 f4             	push   -0xc(%ebp)
+ 359:	68 ec 0d 00 00       	push   $0xdec
+ 35e:	6a 01                	push   $0x1
+ 360:	e8 5f 06 00 00       	call   9c4 <printf>
+ 365:	83 c4 10             	add    $0x10,%esp
+                exit();
+ 368:	e8 59 03 00 00       	call   6c6 <exit>
+        for(j = 0; j < BLK; j++){
+ 36d:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ 371:	81 7d f0 ff 01 00 00 	cmpl   $0x1ff,-0x10(%ebp)
+ 378:	7e ab                	jle    325 <main+0x1c5>
+    for(i = 0; i < NBLK; i++){
+ 37a:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+ 37e:	83 7d f4 07          	cmpl   $0x7,-0xc(%ebp)
+ 382:	7e 98                	jle    31c <main+0x1bc>
+            }
+        }
+    }
+    unlink("ioringfile");
+ 384:	83 ec 0c             	sub    $0xc,%esp
+ 387:	68 e1 0d 00 00       	push   $0xde1
+ 38c:	e8 90 03 00 00       	call   721 <unlink>
+ 391:	83 c4 10             	add    $0x10,%esp
+    close(rfd);
+ 394:	a1 e4 10 00 00       	mov    0x10e4,%eax
+ 399:	83 ec 0c             	sub    $0xc,%esp
+ 39c:	50                   	push   %eax
+ 39d:	e8 4d 03 00 00       	call   6ef <close>
+ 3a2:	83 c4 10             	add    $0x10,%esp
+    printf(1, "ioringtest ok\n");
+ 3a5:	83 ec 08             	sub    $0x8,%esp
+ 3a8:	68 04 0e 00 00       	push   $0xe04
+ 3ad:	6a 01                	push   $0x1
+ 3af:	e8 10 06 00 00       	call   9c4 <printf>
+ 3b4:	83 c4 10             	add    $0x10,%esp
+    exit();
+ 3b7:	e8 0a 03 00 00       	call   6c6 <exit>
+
+000003bc <stosb>:
+strchr(const char *s, char c)
+{
+    for(; *s; s++)
+        if(*s == c)
+            return (char*)s;
+    return 0;
+ 3bc:	55                   	push   %ebp
+ 3bd:	89 e5                	mov    %esp,%ebp
+ 3bf:	57                   	push   %edi
+ 3c0:	53                   	push   %ebx
+}
+ 3c1:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 3c4:	8b 55 10             	mov    0x10(%ebp),%edx
+ 3c7:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 3ca:	89 cb                	mov    %ecx,%ebx
+ 3cc:	89 df                	mov    %ebx,%edi
+ 3ce:	89 d1                	mov    %edx,%ecx
+ 3d0:	fc                   	cld
+ 3d1:	f3 aa                	rep stos %al,%es:(%edi)
+ 3d3:	89 ca                	mov    %ecx,%edx
+ 3d5:	89 fb                	mov    %edi,%ebx
+ 3d7:	89 5d 08             	mov    %ebx,0x8(%ebp)
+ 3da:	89 55 10             	mov    %edx,0x10(%ebp)
+
+char*
+gets(char *buf, int max)
+{
+ 3dd:	90                   	nop
+ 3de:	5b                   	pop    %ebx
+ 3df:	5f                   	pop    %edi
+ 3e0:	5d                   	pop    %ebp
+ 3e1:	c3                   	ret
+
+000003e2 <strcpy>:
+{
+ 3e2:	55                   	push   %ebp
+ 3e3:	89 e5                	mov    %esp,%ebp
+ 3e5:	83 ec 10             	sub    $0x10,%esp
+    os = s;
+ 3e8:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3eb:	89 45 fc             	mov    %eax,-0x4(%ebp)
+    while((*s++ = *t++) != 0)
+ 3ee:	90                   	nop
+ 3ef:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 3f2:	8d 42 01             	lea    0x1(%edx),%eax
+ 3f5:	89 45 0c             	mov    %eax,0xc(%ebp)
+ 3f8:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3fb:	8d 48 01             	lea    0x1(%eax),%ecx
+ 3fe:	89 4d 08             	mov    %ecx,0x8(%ebp)
+ 401:	0f b6 12             	movzbl (%edx),%edx
+ 404:	88 10                	mov    %dl,(%eax)
+ 406:	0f b6 00             	movzbl (%eax),%eax
+ 409:	84 c0                	test   %al,%al
+ 40b:	75 e2                	jne    3ef <strcpy+0xd>
+    return os;
+ 40d:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 410:	c9                   	leave
+ 411:	c3                   	ret
+
+00000412 <strcmp>:
+{
+ 412:	55                   	push   %ebp
+ 413:	89 e5                	mov    %esp,%ebp
+    while(*p && *p == *q)
+ 415:	eb 08                	jmp    41f <strcmp+0xd>
+        p++, q++;
+ 417:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 41b:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+    while(*p && *p == *q)
+ 41f:	8b 45 08             	mov    0x8(%ebp),%eax
+ 422:	0f b6 00             	movzbl (%eax),%eax
+ 425:	84 c0                	test   %al,%al
+ 427:	74 10                	je     439 <strcmp+0x27>
+ 429:	8b 45 08             	mov    0x8(%ebp),%eax
+ 42c:	0f b6 10             	movzbl (%eax),%edx
+ 42f:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 432:	0f b6 00             	movzbl (%eax),%eax
+ 435:	38 c2                	cmp    %al,%dl
+ 437:	74 de                	je     417 <strcmp+0x5>
+    return (uchar)*p - (uchar)*q;
+ 439:	8b 45 08             	mov    0x8(%ebp),%eax
+ 43c:	0f b6 00             	movzbl (%eax),%eax
+ 43f:	0f b6 d0             	movzbl %al,%edx
+ 442:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 445:	0f b6 00             	movzbl (%eax),%eax
+ 448:	0f b6 c0             	movzbl %al,%eax
+ 44b:	29 c2                	sub    %eax,%edx
+ 44d:	89 d0                	mov    %edx,%eax
+}
+ 44f:	5d                   	pop    %ebp
+ 450:	c3                   	ret
+
+00000451 <strlen>:
+{
+ 451:	55                   	push   %ebp
+ 452:	89 e5                	mov    %esp,%ebp
+ 454:	83 ec 10             	sub    $0x10,%esp
+    for(n = 0; s[n]; n++)
+ 457:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ 45e:	eb 04                	jmp    464 <strlen+0x13>
+ 460:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 464:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 467:	8b 45 08             	mov    0x8(%ebp),%eax
+ 46a:	01 d0                	add    %edx,%eax
+ 46c:	0f b6 00             	movzbl (%eax),%eax
+ 46f:	84 c0                	test   %al,%al
+ 471:	75 ed                	jne    460 <strlen+0xf>
+    return n;
+ 473:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 476:	c9                   	leave
+ 477:	c3                   	ret
+
+00000478 <memset>:
+{
+ 478:	55                   	push   %ebp
+ 479:	89 e5                	mov    %esp,%ebp
+    stosb(dst, c, n);
+ 47b:	8b 45 10             	mov    0x10(%ebp),%eax
+ 47e:	50                   	push   %eax
+ 47f:	ff 75 0c             	push   0xc(%ebp)
+ 482:	ff 75 08             	push   0x8(%ebp)
+ 485:	e8 32 ff ff ff       	call   3bc <stosb>
+ 48a:	83 c4 0c             	add    $0xc,%esp
+    return dst;
+ 48d:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 490:	c9                   	leave
+ 491:	c3                   	ret
+
+00000492 <strchr>:
+{
+ 492:	55                   	push   %ebp
+ 493:	89 e5                	mov    %esp,%ebp
+ 495:	83 ec 04             	sub    $0x4,%esp
+ 498:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 49b:	88 45 fc             	mov    %al,-0x4(%ebp)
+    for(; *s; s++)
+ 49e:	eb 14                	jmp    4b4 <strchr+0x22>
+        if(*s == c)
+ 4a0:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4a3:	0f b6 00             	movzbl (%eax),%eax
+ 4a6:	38 45 fc             	cmp    %al,-0x4(%ebp)
+ 4a9:	75 05                	jne    4b0 <strchr+0x1e>
+            return (char*)s;
+ 4ab:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4ae:	eb 13                	jmp    4c3 <strchr+0x31>
+    for(; *s; s++)
+ 4b0:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 4b4:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4b7:	0f b6 00             	movzbl (%eax),%eax
+ 4ba:	84 c0                	test   %al,%al
+ 4bc:	75 e2                	jne    4a0 <strchr+0xe>
+    return 0;
+ 4be:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 4c3:	c9                   	leave
+ 4c4:	c3                   	ret
+
+000004c5 <gets>:
+{
+ 4c5:	55                   	push   %ebp
+ 4c6:	89 e5                	mov    %esp,%ebp
+ 4c8:	83 ec 18             	sub    $0x18,%esp
+    int i, cc;
+    char c;
+
+    for(i=0; i+1 < max; ){
+ 4cb:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 4d2:	eb 42                	jmp    516 <gets+0x51>
+        cc = read(0, &c, 1);
+ 4d4:	83 ec 04             	sub    $0x4,%esp
+ 4d7:	6a 01                	push   $0x1
+ 4d9:	8d 45 ef             	lea    -0x11(%ebp),%eax
+ 4dc:	50                   	push   %eax
+ 4dd:	6a 00                	push   $0x0
+ 4df:	e8 f7 01 00 00       	call   6db <read>
+ 4e4:	83 c4 10             	add    $0x10,%esp
+ 4e7:	89 45 f0             	mov    %eax,-0x10(%ebp)
+        if(cc < 1)
+ 4ea:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 4ee:	7e 33                	jle    523 <gets+0x5e>
+            break;
+        buf[i++] = c;
+ 4f0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 4f3:	8d 50 01             	lea    0x1(%eax),%edx
+ 4f6:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 4f9:	89 c2                	mov    %eax,%edx
+ 4fb:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4fe:	01 c2                	add    %eax,%edx
+ 500:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 504:	88 02                	mov    %al,(%edx)
+        if(c == '\n' || c == '\r')
+ 506:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 50a:	3c 0a                	cmp    $0xa,%al
+ 50c:	74 16                	je     524 <gets+0x5f>
+ 50e:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 512:	3c 0d                	cmp    $0xd,%al
+ 514:	74 0e                	je     524 <gets+0x5f>
+    for(i=0; i+1 < max; ){
+ 516:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 519:	83 c0 01             	add    $0x1,%eax
+ 51c:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 51f:	7f b3                	jg     4d4 <gets+0xf>
+ 521:	eb 01                	jmp    524 <gets+0x5f>
+            break;
+ 523:	90                   	nop
+            break;
+    }
+    buf[i] = '\0';
+ 524:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 527:	8b 45 08             	mov    0x8(%ebp),%eax
+ 52a:	01 d0                	add    %edx,%eax
+ 52c:	c6 00 00             	movb   $0x0,(%eax)
+    return buf;
+ 52f:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 532:	c9                   	leave
+ 533:	c3                   	ret
+
+00000534 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 534:	55                   	push   %ebp
+ 535:	89 e5                	mov    %esp,%ebp
+ 537:	83 ec 18             	sub    $0x18,%esp
+    int fd;
+    int r;
+
+    fd = open(n, O_RDONLY);
+ 53a:	83 ec 08             	sub    $0x8,%esp
+ 53d:	6a 00                	push   $0x0
+ 53f:	ff 75 08             	push   0x8(%ebp)
+ 542:	e8 c6 01 00 00       	call   70d <open>
+ 547:	83 c4 10             	add    $0x10,%esp
+ 54a:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(fd < 0)
+ 54d:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 551:	79 07                	jns    55a <stat+0x26>
+        return -1;
+ 553:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 558:	eb 25                	jmp    57f <stat+0x4b>
+    r = fstat(fd, st);
+ 55a:	83 ec 08             	sub    $0x8,%esp
+ 55d:	ff 75 0c             	push   0xc(%ebp)
+ 560:	ff 75 f4             	push   -0xc(%ebp)
+ 563:	e8 c3 01 00 00       	call   72b <fstat>
+ 568:	83 c4 10             	add    $0x10,%esp
+ 56b:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    close(fd);
+ 56e:	83 ec 0c             	sub    $0xc,%esp
+ 571:	ff 75 f4             	push   -0xc(%ebp)
+ 574:	e8 76 01 00 00       	call   6ef <close>
+ 579:	83 c4 10             	add    $0x10,%esp
+    return r;
+ 57c:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ 57f:	c9                   	leave
+ 580:	c3                   	ret
+
+00000581 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 581:	55                   	push   %ebp
+ 582:	89 e5                	mov    %esp,%ebp
+ 584:	83 ec 10             	sub    $0x10,%esp
+    int n;
+
+    n = 0;
+ 587:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+    while('0' <= *s && *s <= '9')
+ 58e:	eb 25                	jmp    5b5 <atoi+0x34>
+        n = n*10 + *s++ - '0';
+ 590:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 593:	89 d0                	mov    %edx,%eax
+ 595:	c1 e0 02             	shl    $0x2,%eax
+ 598:	01 d0                	add    %edx,%eax
+ 59a:	01 c0                	add    %eax,%eax
+ 59c:	89 c1                	mov    %eax,%ecx
+ 59e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5a1:	8d 50 01             	lea    0x1(%eax),%edx
+ 5a4:	89 55 08             	mov    %edx,0x8(%ebp)
+ 5a7:	0f b6 00             	movzbl (%eax),%eax
+ 5aa:	0f be c0             	movsbl %al,%eax
+ 5ad:	01 c8                	add    %ecx,%eax
+ 5af:	83 e8 30             	sub    $0x30,%eax
+ 5b2:	89 45 fc             	mov    %eax,-0x4(%ebp)
+    while('0' <= *s && *s <= '9')
+ 5b5:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5b8:	0f b6 00             	movzbl (%eax),%eax
+ 5bb:	3c 2f                	cmp    $0x2f,%al
+ 5bd:	7e 0a                	jle    5c9 <atoi+0x48>
+ 5bf:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5c2:	0f b6 00             	movzbl (%eax),%eax
+ 5c5:	3c 39                	cmp    $0x39,%al
+ 5c7:	7e c7                	jle    590 <atoi+0xf>
+    return n;
+ 5c9:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 5cc:	c9                   	leave
+ 5cd:	c3                   	ret
+
+000005ce <nice>:
+
+// Add inc to the caller's nice value; return the new value.
+int
+nice(int inc)
+{
+ 5ce:	55                   	push   %ebp
+ 5cf:	89 e5                	mov    %esp,%ebp
+ 5d1:	83 ec 18             	sub    $0x18,%esp
+    int n;
+
+    n = getpriority(0) + inc;
+ 5d4:	83 ec 0c             	sub    $0xc,%esp
+ 5d7:	6a 00                	push   $0x0
+ 5d9:	e8 d9 01 00 00       	call   7b7 <getpriority>
+ 5de:	83 c4 10             	add    $0x10,%esp
+ 5e1:	8b 55 08             	mov    0x8(%ebp),%edx
+ 5e4:	01 d0                	add    %edx,%eax
+ 5e6:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(n < 0)
+ 5e9:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 5ed:	79 07                	jns    5f6 <nice+0x28>
+        n = 0;
+ 5ef:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    if(n > NICEMAX)
+ 5f6:	83 7d f4 13          	cmpl   $0x13,-0xc(%ebp)
+ 5fa:	7e 07                	jle    603 <nice+0x35>
+        n = NICEMAX;
+ 5fc:	c7 45 f4 13 00 00 00 	movl   $0x13,-0xc(%ebp)
+    if(setpriority(0, n) < 0)
+ 603:	83 ec 08             	sub    $0x8,%esp
+ 606:	ff 75 f4             	push   -0xc(%ebp)
+ 609:	6a 00                	push   $0x0
+ 60b:	e8 b1 01 00 00       	call   7c1 <setpriority>
+ 610:	83 c4 10             	add    $0x10,%esp
+ 613:	85 c0                	test   %eax,%eax
+ 615:	79 07                	jns    61e <nice+0x50>
+        return -1;
+ 617:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 61c:	eb 03                	jmp    621 <nice+0x53>
+    return n;
+ 61e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+ 621:	c9                   	leave
+ 622:	c3                   	ret
+
+00000623 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 623:	55                   	push   %ebp
+ 624:	89 e5                	mov    %esp,%ebp
+ 626:	83 ec 10             	sub    $0x10,%esp
+    char *dst;
+    const char *src;
+
+    dst = vdst;
+ 629:	8b 45 08             	mov    0x8(%ebp),%eax
+ 62c:	89 45 fc             	mov    %eax,-0x4(%ebp)
+    src = vsrc;
+ 62f:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 632:	89 45 f8             	mov    %eax,-0x8(%ebp)
+    while(n-- > 0)
+ 635:	eb 17                	jmp    64e <memmove+0x2b>
+        *dst++ = *src++;
+ 637:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 63a:	8d 42 01             	lea    0x1(%edx),%eax
+ 63d:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 640:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 643:	8d 48 01             	lea    0x1(%eax),%ecx
+ 646:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+ 649:	0f b6 12             	movzbl (%edx),%edx
+ 64c:	88 10                	mov    %dl,(%eax)
+    while(n-- > 0)
+ 64e:	8b 45 10             	mov    0x10(%ebp),%eax
+ 651:	8d 50 ff             	lea    -0x1(%eax),%edx
+ 654:	89 55 10             	mov    %edx,0x10(%ebp)
+ 657:	85 c0                	test   %eax,%eax
+ 659:	7f dc                	jg     637 <memmove+0x14>
+    return vdst;
+ 65b:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 65e:	c9                   	leave
+ 65f:	c3                   	ret
+
+00000660 <dosyscall>:
+sysmode:
+    .long 0
+
+    .text
+dosyscall:
+    cmpl $0, sysmode
+ 660:	83 3d c0 10 00 00 00 	cmpl   $0x0,0x10c0
+    jg 2f
+ 667:	7f 0c                	jg     675 <dosyscall+0x15>
+    jl 1f
+ 669:	7c 07                	jl     672 <dosyscall+0x12>
+    call sepcheck
+ 66b:	e8 27 00 00 00       	call   697 <sepcheck>
+    jmp dosyscall
+ 670:	eb ee                	jmp    660 <dosyscall>
+1:
+    int $T_SYSCALL
+ 672:	cd 40                	int    $0x40
+    ret
+ 674:	c3                   	ret
+2:
+    pushl %ebx
+ 675:	53                   	push   %ebx
+    pushl %esi
+ 676:	56                   	push   %esi
+    pushl %edi
+ 677:	57                   	push   %edi
+    pushl %ebp
+ 678:	55                   	push   %ebp
+    movl 20(%esp), %ebx
+ 679:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+    movl 24(%esp), %esi
+ 67d:	8b 74 24 18          	mov    0x18(%esp),%esi
+    movl 28(%esp), %edi
+ 681:	8b 7c 24 1c          	mov    0x1c(%esp),%edi
+    movl 32(%esp), %ebp
+ 685:	8b 6c 24 20          	mov    0x20(%esp),%ebp
+    movl %esp, %ecx
+ 689:	89 e1                	mov    %esp,%ecx
+    movl $3f, %edx
+ 68b:	ba 92 06 00 00       	mov    $0x692,%edx
+    sysenter
+ 690:	0f 34                	sysenter
+3:
+    popl %ebp
+ 692:	5d                   	pop    %ebp
+    popl %edi
+ 693:	5f                   	pop    %edi
+    popl %esi
+ 694:	5e                   	pop    %esi
+    popl %ebx
+ 695:	5b                   	pop    %ebx
+    ret
+ 696:	c3                   	ret
+
+00000697 <sepcheck>:
+
+# Set sysmode from cpuid's SEP flag.    Preserves %eax.
+sepcheck:
+    pushl %eax
+ 697:	50                   	push   %eax
+    pushl %ebx
+ 698:	53                   	push   %ebx
+    movl $1, %eax
+ 699:	b8 01 00 00 00       	mov    $0x1,%eax
+    cpuid
+ 69e:	0f a2                	cpuid
+    movl $-1, sysmode
+ 6a0:	c7 05 c0 10 00 00 ff 	movl   $0xffffffff,0x10c0
+ 6a7:	ff ff ff 
+    testl $0x800, %edx
+ 6aa:	f7 c2 00 08 00 00    	test   $0x800,%edx
+    jz 1f
+ 6b0:	74 0a                	je     6bc <sepcheck+0x25>
+    movl $1, sysmode
+ 6b2:	c7 05 c0 10 00 00 01 	movl   $0x1,0x10c0
+ 6b9:	00 00 00 
+1:
+    popl %ebx
+ 6bc:	5b                   	pop    %ebx
+    popl %eax
+ 6bd:	58                   	pop    %eax
+    ret
+ 6be:	c3                   	ret
+
+000006bf <fork>:
+
+SYSCALL(fork)
+ 6bf:	b8 01 00 00 00       	mov    $0x1,%eax
+ 6c4:	eb 9a                	jmp    660 <dosyscall>
+
+000006c6 <exit>:
+SYSCALL(exit)
+ 6c6:	b8 02 00 00 00       	mov    $0x2,%eax
+ 6cb:	eb 93                	jmp    660 <dosyscall>
+
+000006cd <wait>:
+SYSCALL(wait)
+ 6cd:	b8 03 00 00 00       	mov    $0x3,%eax
+ 6d2:	eb 8c                	jmp    660 <dosyscall>
+
+000006d4 <pipe>:
+SYSCALL(pipe)
+ 6d4:	b8 04 00 00 00       	mov    $0x4,%eax
+ 6d9:	eb 85                	jmp    660 <dosyscall>
+
+000006db <read>:
+SYSCALL(read)
+ 6db:	b8 05 00 00 00       	mov    $0x5,%eax
+ 6e0:	e9 7b ff ff ff       	jmp    660 <dosyscall>
+
+000006e5 <write>:
+SYSCALL(write)
+ 6e5:	b8 10 00 00 00       	mov    $0x10,%eax
+ 6ea:	e9 71 ff ff ff       	jmp    660 <dosyscall>
+
+000006ef <close>:
+SYSCALL(close)
+ 6ef:	b8 15 00 00 00       	mov    $0x15,%eax
+ 6f4:	e9 67 ff ff ff       	jmp    660 <dosyscall>
+
+000006f9 <kill>:
+SYSCALL(kill)
+ 6f9:	b8 06 00 00 00       	mov    $0x6,%eax
+ 6fe:	e9 5d ff ff ff       	jmp    660 <dosyscall>
+
+00000703 <exec>:
+SYSCALL(exec)
+ 703:	b8 07 00 00 00       	mov    $0x7,%eax
+ 708:	e9 53 ff ff ff       	jmp    660 <dosyscall>
+
+0000070d <open>:
+SYSCALL(open)
+ 70d:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 712:	e9 49 ff ff ff       	jmp    660 <dosyscall>
+
+00000717 <mknod>:
+SYSCALL(mknod)
+ 717:	b8 11 00 00 00       	mov    $0x11,%eax
+ 71c:	e9 3f ff ff ff       	jmp    660 <dosyscall>
+
+00000721 <unlink>:
+SYSCALL(unlink)
+ 721:	b8 12 00 00 00       	mov    $0x12,%eax
+ 726:	e9 35 ff ff ff       	jmp    660 <dosyscall>
+
+0000072b <fstat>:
+SYSCALL(fstat)
+ 72b:	b8 08 00 00 00       	mov    $0x8,%eax
+ 730:	e9 2b ff ff ff       	jmp    660 <dosyscall>
+
+00000735 <link>:
+SYSCALL(link)
+ 735:	b8 13 00 00 00       	mov    $0x13,%eax
+ 73a:	e9 21 ff ff ff       	jmp    660 <dosyscall>
+
+0000073f <mkdir>:
+SYSCALL(mkdir)
+ 73f:	b8 14 00 00 00       	mov    $0x14,%eax
+ 744:	e9 17 ff ff ff       	jmp    660 <dosyscall>
+
+00000749 <chdir>:
+SYSCALL(chdir)
+ 749:	b8 09 00 00 00       	mov    $0x9,%eax
+ 74e:	e9 0d ff ff ff       	jmp    660 <dosyscall>
+
+00000753 <dup>:
+SYSCALL(dup)
+ 753:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 758:	e9 03 ff ff ff       	jmp    660 <dosyscall>
+
+0000075d <getpid>:
+SYSCALL(getpid)
+ 75d:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 762:	e9 f9 fe ff ff       	jmp    660 <dosyscall>
+
+00000767 <sbrk>:
+SYSCALL(sbrk)
+ 767:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 76c:	e9 ef fe ff ff       	jmp    660 <dosyscall>
+
+00000771 <sleep>:
+SYSCALL(sleep)
+ 771:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 776:	e9 e5 fe ff ff       	jmp    660 <dosyscall>
+
+0000077b <uptime>:
+SYSCALL(uptime)
+ 77b:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 780:	e9 db fe ff ff       	jmp    660 <dosyscall>
+
+00000785 <date>:
+SYSCALL(date)
+ 785:	b8 16 00 00 00       	mov    $0x16,%eax
+ 78a:	e9 d1 fe ff ff       	jmp    660 <dosyscall>
+
+0000078f <dup2>:
+SYSCALL(dup2)
+ 78f:	b8 17 00 00 00       	mov    $0x17,%eax
+ 794:	e9 c7 fe ff ff       	jmp    660 <dosyscall>
+
+00000799 <uffd>:
+SYSCALL(uffd)
+ 799:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 79e:	e9 bd fe ff ff       	jmp    660 <dosyscall>
+
+000007a3 <uffdregister>:
+SYSCALL(uffdregister)
+ 7a3:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 7a8:	e9 b3 fe ff ff       	jmp    660 <dosyscall>
+
+000007ad <uffdcopy>:
+SYSCALL(uffdcopy)
+ 7ad:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 7b2:	e9 a9 fe ff ff       	jmp    660 <dosyscall>
+
+000007b7 <getpriority>:
+SYSCALL(getpriority)
+ 7b7:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 7bc:	e9 9f fe ff ff       	jmp    660 <dosyscall>
+
+000007c1 <setpriority>:
+SYSCALL(setpriority)
+ 7c1:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 7c6:	e9 95 fe ff ff       	jmp    660 <dosyscall>
+
+000007cb <setweight>:
+SYSCALL(setweight)
+ 7cb:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 7d0:	e9 8b fe ff ff       	jmp    660 <dosyscall>
+
+000007d5 <setgroup>:
+SYSCALL(setgroup)
+ 7d5:	b8 20 00 00 00       	mov    $0x20,%eax
+ 7da:	e9 81 fe ff ff       	jmp    660 <dosyscall>
+
+000007df <schedinfo>:
+SYSCALL(schedinfo)
+ 7df:	b8 21 00 00 00       	mov    $0x21,%eax
+ 7e4:	e9 77 fe ff ff       	jmp    660 <dosyscall>
+
+000007e9 <nanosleep>:
+SYSCALL(nanosleep)
+ 7e9:	b8 22 00 00 00       	mov    $0x22,%eax
+ 7ee:	e9 6d fe ff ff       	jmp    660 <dosyscall>
+
+000007f3 <clock_nanosleep>:
+SYSCALL(clock_nanosleep)
+ 7f3:	b8 23 00 00 00       	mov    $0x23,%eax
+ 7f8:	e9 63 fe ff ff       	jmp    660 <dosyscall>
+
+000007fd <clock_gettime>:
+SYSCALL(clock_gettime)
+ 7fd:	b8 24 00 00 00       	mov    $0x24,%eax
+ 802:	e9 59 fe ff ff       	jmp    660 <dosyscall>
+
+00000807 <sched_setaffinity>:
+SYSCALL(sched_setaffinity)
+ 807:	b8 25 00 00 00       	mov    $0x25,%eax
+ 80c:	e9 4f fe ff ff       	jmp    660 <dosyscall>
+
+00000811 <sched_getaffinity>:
+SYSCALL(sched_getaffinity)
+ 811:	b8 26 00 00 00       	mov    $0x26,%eax
+ 816:	e9 45 fe ff ff       	jmp    660 <dosyscall>
+
+0000081b <irqaffinity>:
+SYSCALL(irqaffinity)
+ 81b:	b8 27 00 00 00       	mov    $0x27,%eax
+ 820:	e9 3b fe ff ff       	jmp    660 <dosyscall>
+
+00000825 <getrusage>:
+SYSCALL(getrusage)
+ 825:	b8 28 00 00 00       	mov    $0x28,%eax
+ 82a:	e9 31 fe ff ff       	jmp    660 <dosyscall>
+
+0000082f <times>:
+SYSCALL(times)
+ 82f:	b8 29 00 00 00       	mov    $0x29,%eax
+ 834:	e9 27 fe ff ff       	jmp    660 <dosyscall>
+
+00000839 <schedlat>:
+SYSCALL(schedlat)
+ 839:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 83e:	e9 1d fe ff ff       	jmp    660 <dosyscall>
+
+00000843 <sched_setscheduler>:
+SYSCALL(sched_setscheduler)
+ 843:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 848:	e9 13 fe ff ff       	jmp    660 <dosyscall>
+
+0000084d <sched_getscheduler>:
+SYSCALL(sched_getscheduler)
+ 84d:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 852:	e9 09 fe ff ff       	jmp    660 <dosyscall>
+
+00000857 <sched_getparam>:
+SYSCALL(sched_getparam)
+ 857:	b8 2d 00 00 00       	mov    $0x2d,%eax
+ 85c:	e9 ff fd ff ff       	jmp    660 <dosyscall>
+
+00000861 <lockstat>:
+SYSCALL(lockstat)
+ 861:	b8 2e 00 00 00       	mov    $0x2e,%eax
+ 866:	e9 f5 fd ff ff       	jmp    660 <dosyscall>
+
+0000086b <ioring_setup>:
+SYSCALL(ioring_setup)
+ 86b:	b8 2f 00 00 00       	mov    $0x2f,%eax
+ 870:	e9 eb fd ff ff       	jmp    660 <dosyscall>
+
+00000875 <ioring_enter>:
+SYSCALL(ioring_enter)
+ 875:	b8 30 00 00 00       	mov    $0x30,%eax
+ 87a:	e9 e1 fd ff ff       	jmp    660 <dosyscall>
+
+0000087f <readv>:
+SYSCALL(readv)
+ 87f:	b8 31 00 00 00       	mov    $0x31,%eax
+ 884:	e9 d7 fd ff ff       	jmp    660 <dosyscall>
+
+00000889 <writev>:
+SYSCALL(writev)
+ 889:	b8 32 00 00 00       	mov    $0x32,%eax
+ 88e:	e9 cd fd ff ff       	jmp    660 <dosyscall>
+
+00000893 <pread>:
+SYSCALL(pread)
+ 893:	b8 33 00 00 00       	mov    $0x33,%eax
+ 898:	e9 c3 fd ff ff       	jmp    660 <dosyscall>
+
+0000089d <pwrite>:
+SYSCALL(pwrite)
+ 89d:	b8 34 00 00 00       	mov    $0x34,%eax
+ 8a2:	e9 b9 fd ff ff       	jmp    660 <dosyscall>
+
+000008a7 <sendfile>:
+SYSCALL(sendfile)
+ 8a7:	b8 35 00 00 00       	mov    $0x35,%eax
+ 8ac:	e9 af fd ff ff       	jmp    660 <dosyscall>
+
+000008b1 <splice>:
+SYSCALL(splice)
+ 8b1:	b8 36 00 00 00       	mov    $0x36,%eax
+ 8b6:	e9 a5 fd ff ff       	jmp    660 <dosyscall>
+
+000008bb <sysstat>:
+SYSCALL(sysstat)
+ 8bb:	b8 37 00 00 00       	mov    $0x37,%eax
+ 8c0:	e9 9b fd ff ff       	jmp    660 <dosyscall>
+
+000008c5 <strace>:
+SYSCALL(strace)
+ 8c5:	b8 38 00 00 00       	mov    $0x38,%eax
+ 8ca:	e9 91 fd ff ff       	jmp    660 <dosyscall>
+
+000008cf <straceread>:
+SYSCALL(straceread)
+ 8cf:	b8 39 00 00 00       	mov    $0x39,%eax
+ 8d4:	e9 87 fd ff ff       	jmp    660 <dosyscall>
+
+000008d9 <alarm>:
+
+# alarm and rstoregs keep to int $T_SYSCALL: rstoregs restores
+# %ecx and %edx, which sysexit would clobber.
+.globl alarm
+    alarm:
+        pushl $rstoregs
+ 8d9:	68 e9 08 00 00       	push   $0x8e9
+        movl $SYS_alarm, %eax
+ 8de:	b8 18 00 00 00       	mov    $0x18,%eax
+        int $T_SYSCALL
+ 8e3:	cd 40                	int    $0x40
+        add $0x04, %esp
+ 8e5:	83 c4 04             	add    $0x4,%esp
+        ret
+ 8e8:	c3                   	ret
+
+000008e9 <rstoregs>:
+
+.globl rstoregs
+    rstoregs:
+        movl $SYS_rstoregs, %eax
+ 8e9:	b8 19 00 00 00       	mov    $0x19,%eax
+        int $T_SYSCALL
+ 8ee:	cd 40                	int    $0x40
+
+000008f0 <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 8f0:	55                   	push   %ebp
+ 8f1:	89 e5                	mov    %esp,%ebp
+ 8f3:	83 ec 18             	sub    $0x18,%esp
+ 8f6:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 8f9:	88 45 f4             	mov    %al,-0xc(%ebp)
+    write(fd, &c, 1);
+ 8fc:	83 ec 04             	sub    $0x4,%esp
+ 8ff:	6a 01                	push   $0x1
+ 901:	8d 45 f4             	lea    -0xc(%ebp),%eax
+ 904:	50                   	push   %eax
+ 905:	ff 75 08             	push   0x8(%ebp)
+ 908:	e8 d8 fd ff ff       	call   6e5 <write>
+ 90d:	83 c4 10             	add    $0x10,%esp
+}
+ 910:	90                   	nop
+ 911:	c9                   	leave
+ 912:	c3                   	ret
+
+00000913 <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 913:	55                   	push   %ebp
+ 914:	89 e5                	mov    %esp,%ebp
+ 916:	83 ec 28             	sub    $0x28,%esp
+    static char digits[] = "0123456789ABCDEF";
+    char buf[16];
+    int i, neg;
+    uint x;
+
+    neg = 0;
+ 919:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+    if(sgn && xx < 0){
+ 920:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+ 924:	74 17                	je     93d <printint+0x2a>
+ 926:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 92a:	79 11                	jns    93d <printint+0x2a>
+        neg = 1;
+ 92c:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+        x = -xx;
+ 933:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 936:	f7 d8                	neg    %eax
+ 938:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 93b:	eb 06                	jmp    943 <printint+0x30>
+    } else {
+        x = xx;
+ 93d:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 940:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    }
+
+    i = 0;
+ 943:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    do{
+        buf[i++] = digits[x % base];
+ 94a:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 94d:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 950:	ba 00 00 00 00       	mov    $0x0,%edx
+ 955:	f7 f1                	div    %ecx
+ 957:	89 d1                	mov    %edx,%ecx
+ 959:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 95c:	8d 50 01             	lea    0x1(%eax),%edx
+ 95f:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 962:	0f b6 91 c4 10 00 00 	movzbl 0x10c4(%ecx),%edx
+ 969:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+    }while((x /= base) != 0);
+ 96d:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 970:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 973:	ba 00 00 00 00       	mov    $0x0,%edx
+ 978:	f7 f1                	div    %ecx
+ 97a:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 97d:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 981:	75 c7                	jne    94a <printint+0x37>
+    if(neg)
+ 983:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 987:	74 2d                	je     9b6 <printint+0xa3>
+        buf[i++] = '-';
+ 989:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 98c:	8d 50 01             	lea    0x1(%eax),%edx
+ 98f:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 992:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+    while(--i >= 0)
+ 997:	eb 1d                	jmp    9b6 <printint+0xa3>
+        putc(fd, buf[i]);
+ 999:	8d 55 dc             	lea    -0x24(%ebp),%edx
+ 99c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 99f:	01 d0                	add    %edx,%eax
+ 9a1:	0f b6 00             	movzbl (%eax),%eax
+ 9a4:	0f be c0             	movsbl %al,%eax
+ 9a7:	83 ec 08             	sub    $0x8,%esp
+ 9aa:	50                   	push   %eax
+ 9ab:	ff 75 08             	push   0x8(%ebp)
+ 9ae:	e8 3d ff ff ff       	call   8f0 <putc>
+ 9b3:	83 c4 10             	add    $0x10,%esp
+    while(--i >= 0)
+ 9b6:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+ 9ba:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 9be:	79 d9                	jns    999 <printint+0x86>
+}
+ 9c0:	90                   	nop
+ 9c1:	90                   	nop
+ 9c2:	c9                   	leave
+ 9c3:	c3                   	ret
+
+000009c4 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 9c4:	55                   	push   %ebp
+ 9c5:	89 e5                	mov    %esp,%ebp
+ 9c7:	83 ec 28             	sub    $0x28,%esp
+    char *s;
+    int c, i, state;
+    uint *ap;
+
+    state = 0;
+ 9ca:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+    ap = (uint*)(void*)&fmt + 1;
+ 9d1:	8d 45 0c             	lea    0xc(%ebp),%eax
+ 9d4:	83 c0 04             	add    $0x4,%eax
+ 9d7:	89 45 e8             	mov    %eax,-0x18(%ebp)
+    for(i = 0; fmt[i]; i++){
+ 9da:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 9e1:	e9 59 01 00 00       	jmp    b3f <printf+0x17b>
+        c = fmt[i] & 0xff;
+ 9e6:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 9e9:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 9ec:	01 d0                	add    %edx,%eax
+ 9ee:	0f b6 00             	movzbl (%eax),%eax
+ 9f1:	0f be c0             	movsbl %al,%eax
+ 9f4:	25 ff 00 00 00       	and    $0xff,%eax
+ 9f9:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        if(state == 0){
+ 9fc:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ a00:	75 2c                	jne    a2e <printf+0x6a>
+            if(c == '%'){
+ a02:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ a06:	75 0c                	jne    a14 <printf+0x50>
+                state = '%';
+ a08:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+ a0f:	e9 27 01 00 00       	jmp    b3b <printf+0x177>
+            } else {
+                putc(fd, c);
+ a14:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ a17:	0f be c0             	movsbl %al,%eax
+ a1a:	83 ec 08             	sub    $0x8,%esp
+ a1d:	50                   	push   %eax
+ a1e:	ff 75 08             	push   0x8(%ebp)
+ a21:	e8 ca fe ff ff       	call   8f0 <putc>
+ a26:	83 c4 10             	add    $0x10,%esp
+ a29:	e9 0d 01 00 00       	jmp    b3b <printf+0x177>
+            }
+        } else if(state == '%'){
+ a2e:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+ a32:	0f 85 03 01 00 00    	jne    b3b <printf+0x177>
+            if(c == 'd'){
+ a38:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+ a3c:	75 1e                	jne    a5c <printf+0x98>
+                printint(fd, *ap, 10, 1);
+ a3e:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ a41:	8b 00                	mov    (%eax),%eax
+ a43:	6a 01                	push   $0x1
+ a45:	6a 0a                	push   $0xa
+ a47:	50                   	push   %eax
+ a48:	ff 75 08             	push   0x8(%ebp)
+ a4b:	e8 c3 fe ff ff       	call   913 <printint>
+ a50:	83 c4 10             	add    $0x10,%esp
+                ap++;
+ a53:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ a57:	e9 d8 00 00 00       	jmp    b34 <printf+0x170>
+            } else if(c == 'x' || c == 'p'){
+ a5c:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+ a60:	74 06                	je     a68 <printf+0xa4>
+ a62:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+ a66:	75 1e                	jne    a86 <printf+0xc2>
+                printint(fd, *ap, 16, 0);
+ a68:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ a6b:	8b 00                	mov    (%eax),%eax
+ a6d:	6a 00                	push   $0x0
+ a6f:	6a 10                	push   $0x10
+ a71:	50                   	push   %eax
+ a72:	ff 75 08             	push   0x8(%ebp)
+ a75:	e8 99 fe ff ff       	call   913 <printint>
+ a7a:	83 c4 10             	add    $0x10,%esp
+                ap++;
+ a7d:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ a81:	e9 ae 00 00 00       	jmp    b34 <printf+0x170>
+            } else if(c == 's'){
+ a86:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+ a8a:	75 43                	jne    acf <printf+0x10b>
+                s = (char*)*ap;
+ a8c:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ a8f:	8b 00                	mov    (%eax),%eax
+ a91:	89 45 f4             	mov    %eax,-0xc(%ebp)
+                ap++;
+ a94:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+                if(s == 0)
+ a98:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ a9c:	75 25                	jne    ac3 <printf+0xff>
+                    s = "(null)";
+ a9e:	c7 45 f4 13 0e 00 00 	movl   $0xe13,-0xc(%ebp)
+                while(*s != 0){
+ aa5:	eb 1c                	jmp    ac3 <printf+0xff>
+                    putc(fd, *s);
+ aa7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ aaa:	0f b6 00             	movzbl (%eax),%eax
+ aad:	0f be c0             	movsbl %al,%eax
+ ab0:	83 ec 08             	sub    $0x8,%esp
+ ab3:	50                   	push   %eax
+ ab4:	ff 75 08             	push   0x8(%ebp)
+ ab7:	e8 34 fe ff ff       	call   8f0 <putc>
+ abc:	83 c4 10             	add    $0x10,%esp
+                    s++;
+ abf:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+                while(*s != 0){
+ ac3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ ac6:	0f b6 00             	movzbl (%eax),%eax
+ ac9:	84 c0                	test   %al,%al
+ acb:	75 da                	jne    aa7 <printf+0xe3>
+ acd:	eb 65                	jmp    b34 <printf+0x170>
+                }
+            } else if(c == 'c'){
+ acf:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+ ad3:	75 1d                	jne    af2 <printf+0x12e>
+                putc(fd, *ap);
+ ad5:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ ad8:	8b 00                	mov    (%eax),%eax
+ ada:	0f be c0             	movsbl %al,%eax
+ add:	83 ec 08             	sub    $0x8,%esp
+ ae0:	50                   	push   %eax
+ ae1:	ff 75 08             	push   0x8(%ebp)
+ ae4:	e8 07 fe ff ff       	call   8f0 <putc>
+ ae9:	83 c4 10             	add    $0x10,%esp
+                ap++;
+ aec:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ af0:	eb 42                	jmp    b34 <printf+0x170>
+            } else if(c == '%'){
+ af2:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ af6:	75 17                	jne    b0f <printf+0x14b>
+                putc(fd, c);
+ af8:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ afb:	0f be c0             	movsbl %al,%eax
+ afe:	83 ec 08             	sub    $0x8,%esp
+ b01:	50                   	push   %eax
+ b02:	ff 75 08             	push   0x8(%ebp)
+ b05:	e8 e6 fd ff ff       	call   8f0 <putc>
+ b0a:	83 c4 10             	add    $0x10,%esp
+ b0d:	eb 25                	jmp    b34 <printf+0x170>
+            } else {
+                // Unknown % sequence.    Print it to draw attention.
+                putc(fd, '%');
+ b0f:	83 ec 08             	sub    $0x8,%esp
+ b12:	6a 25                	push   $0x25
+ b14:	ff 75 08             	push   0x8(%ebp)
+ b17:	e8 d4 fd ff ff       	call   8f0 <putc>
+ b1c:	83 c4 10             	add    $0x10,%esp
+                putc(fd, c);
+ b1f:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ b22:	0f be c0             	movsbl %al,%eax
+ b25:	83 ec 08             	sub    $0x8,%esp
+ b28:	50                   	push   %eax
+ b29:	ff 75 08             	push   0x8(%ebp)
+ b2c:	e8 bf fd ff ff       	call   8f0 <putc>
+ b31:	83 c4 10             	add    $0x10,%esp
+            }
+            state = 0;
+ b34:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+    for(i = 0; fmt[i]; i++){
+ b3b:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ b3f:	8b 55 0c             	mov    0xc(%ebp),%edx
+ b42:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ b45:	01 d0                	add    %edx,%eax
+ b47:	0f b6 00             	movzbl (%eax),%eax
+ b4a:	84 c0                	test   %al,%al
+ b4c:	0f 85 94 fe ff ff    	jne    9e6 <printf+0x22>
+        }
+    }
+}
+ b52:	90                   	nop
+ b53:	90                   	nop
+ b54:	c9                   	leave
+ b55:	c3                   	ret
+
+00000b56 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ b56:	55                   	push   %ebp
+ b57:	89 e5                	mov    %esp,%ebp
+ b59:	83 ec 10             	sub    $0x10,%esp
+    Header *bp, *p;
+
+    bp = (Header*)ap - 1;
+ b5c:	8b 45 08             	mov    0x8(%ebp),%eax
+ b5f:	83 e8 08             	sub    $0x8,%eax
+ b62:	89 45 f8             	mov    %eax,-0x8(%ebp)
+    for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ b65:	a1 08 31 00 00       	mov    0x3108,%eax
+ b6a:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ b6d:	eb 24                	jmp    b93 <free+0x3d>
+        if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ b6f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b72:	8b 00                	mov    (%eax),%eax
+ b74:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ b77:	72 12                	jb     b8b <free+0x35>
+ b79:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ b7c:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ b7f:	72 24                	jb     ba5 <free+0x4f>
+ b81:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b84:	8b 00                	mov    (%eax),%eax
+ b86:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ b89:	72 1a                	jb     ba5 <free+0x4f>
+    for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ b8b:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b8e:	8b 00                	mov    (%eax),%eax
+ b90:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ b93:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ b96:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ b99:	73 d4                	jae    b6f <free+0x19>
+ b9b:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b9e:	8b 00                	mov    (%eax),%eax
+ ba0:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ ba3:	73 ca                	jae    b6f <free+0x19>
+            break;
+    if(bp + bp->s.size == p->s.ptr){
+ ba5:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ ba8:	8b 40 04             	mov    0x4(%eax),%eax
+ bab:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ bb2:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ bb5:	01 c2                	add    %eax,%edx
+ bb7:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ bba:	8b 00                	mov    (%eax),%eax
+ bbc:	39 c2                	cmp    %eax,%edx
+ bbe:	75 24                	jne    be4 <free+0x8e>
+        bp->s.size += p->s.ptr->s.size;
+ bc0:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ bc3:	8b 50 04             	mov    0x4(%eax),%edx
+ bc6:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ bc9:	8b 00                	mov    (%eax),%eax
+ bcb:	8b 40 04             	mov    0x4(%eax),%eax
+ bce:	01 c2                	add    %eax,%edx
+ bd0:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ bd3:	89 50 04             	mov    %edx,0x4(%eax)
+        bp->s.ptr = p->s.ptr->s.ptr;
+ bd6:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ bd9:	8b 00                	mov    (%eax),%eax
+ bdb:	8b 10                	mov    (%eax),%edx
+ bdd:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ be0:	89 10                	mov    %edx,(%eax)
+ be2:	eb 0a                	jmp    bee <free+0x98>
+    } else
+        bp->s.ptr = p->s.ptr;
+ be4:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ be7:	8b 10                	mov    (%eax),%edx
+ be9:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ bec:	89 10                	mov    %edx,(%eax)
+    if(p + p->s.size == bp){
+ bee:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ bf1:	8b 40 04             	mov    0x4(%eax),%eax
+ bf4:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ bfb:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ bfe:	01 d0                	add    %edx,%eax
+ c00:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ c03:	75 20                	jne    c25 <free+0xcf>
+        p->s.size += bp->s.size;
+ c05:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ c08:	8b 50 04             	mov    0x4(%eax),%edx
+ c0b:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ c0e:	8b 40 04             	mov    0x4(%eax),%eax
+ c11:	01 c2                	add    %eax,%edx
+ c13:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ c16:	89 50 04             	mov    %edx,0x4(%eax)
+        p->s.ptr = bp->s.ptr;
+ c19:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ c1c:	8b 10                	mov    (%eax),%edx
+ c1e:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ c21:	89 10                	mov    %edx,(%eax)
+ c23:	eb 08                	jmp    c2d <free+0xd7>
+    } else
+        p->s.ptr = bp;
+ c25:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ c28:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ c2b:	89 10                	mov    %edx,(%eax)
+    freep = p;
+ c2d:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ c30:	a3 08 31 00 00       	mov    %eax,0x3108
+}
+ c35:	90                   	nop
+ c36:	c9                   	leave
+ c37:	c3                   	ret
+
+00000c38 <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+ c38:	55                   	push   %ebp
+ c39:	89 e5                	mov    %esp,%ebp
+ c3b:	83 ec 18             	sub    $0x18,%esp
+    char *p;
+    Header *hp;
+
+    if(nu < 4096)
+ c3e:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+ c45:	77 07                	ja     c4e <morecore+0x16>
+        nu = 4096;
+ c47:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+    p = sbrk(nu * sizeof(Header));
+ c4e:	8b 45 08             	mov    0x8(%ebp),%eax
+ c51:	c1 e0 03             	shl    $0x3,%eax
+ c54:	83 ec 0c             	sub    $0xc,%esp
+ c57:	50                   	push   %eax
+ c58:	e8 0a fb ff ff       	call   767 <sbrk>
+ c5d:	83 c4 10             	add    $0x10,%esp
+ c60:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p == (char*)-1)
+ c63:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+ c67:	75 07                	jne    c70 <morecore+0x38>
+        return 0;
+ c69:	b8 00 00 00 00       	mov    $0x0,%eax
+ c6e:	eb 26                	jmp    c96 <morecore+0x5e>
+    hp = (Header*)p;
+ c70:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ c73:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    hp->s.size = nu;
+ c76:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ c79:	8b 55 08             	mov    0x8(%ebp),%edx
+ c7c:	89 50 04             	mov    %edx,0x4(%eax)
+    free((void*)(hp + 1));
+ c7f:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ c82:	83 c0 08             	add    $0x8,%eax
+ c85:	83 ec 0c             	sub    $0xc,%esp
+ c88:	50                   	push   %eax
+ c89:	e8 c8 fe ff ff       	call   b56 <free>
+ c8e:	83 c4 10             	add    $0x10,%esp
+    return freep;
+ c91:	a1 08 31 00 00       	mov    0x3108,%eax
+}
+ c96:	c9                   	leave
+ c97:	c3                   	ret
+
+00000c98 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ c98:	55                   	push   %ebp
+ c99:	89 e5                	mov    %esp,%ebp
+ c9b:	83 ec 18             	sub    $0x18,%esp
+    Header *p, *prevp;
+    uint nunits;
+
+    nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ c9e:	8b 45 08             	mov    0x8(%ebp),%eax
+ ca1:	83 c0 07             	add    $0x7,%eax
+ ca4:	c1 e8 03             	shr    $0x3,%eax
+ ca7:	83 c0 01             	add    $0x1,%eax
+ caa:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    if((prevp = freep) == 0){
+ cad:	a1 08 31 00 00       	mov    0x3108,%eax
+ cb2:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ cb5:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ cb9:	75 23                	jne    cde <malloc+0x46>
+        base.s.ptr = freep = prevp = &base;
+ cbb:	c7 45 f0 00 31 00 00 	movl   $0x3100,-0x10(%ebp)
+ cc2:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ cc5:	a3 08 31 00 00       	mov    %eax,0x3108
+ cca:	a1 08 31 00 00       	mov    0x3108,%eax
+ ccf:	a3 00 31 00 00       	mov    %eax,0x3100
+        base.s.size = 0;
+ cd4:	c7 05 04 31 00 00 00 	movl   $0x0,0x3104
+ cdb:	00 00 00 
+    }
+    for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ cde:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ ce1:	8b 00                	mov    (%eax),%eax
+ ce3:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        if(p->s.size >= nunits){
+ ce6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ ce9:	8b 40 04             	mov    0x4(%eax),%eax
+ cec:	3b 45 ec             	cmp    -0x14(%ebp),%eax
+ cef:	72 4d                	jb     d3e <malloc+0xa6>
+            if(p->s.size == nunits)
+ cf1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ cf4:	8b 40 04             	mov    0x4(%eax),%eax
+ cf7:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+ cfa:	75 0c                	jne    d08 <malloc+0x70>
+                prevp->s.ptr = p->s.ptr;
+ cfc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ cff:	8b 10                	mov    (%eax),%edx
+ d01:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ d04:	89 10                	mov    %edx,(%eax)
+ d06:	eb 26                	jmp    d2e <malloc+0x96>
+            else {
+                p->s.size -= nunits;
+ d08:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ d0b:	8b 40 04             	mov    0x4(%eax),%eax
+ d0e:	2b 45 ec             	sub    -0x14(%ebp),%eax
+ d11:	89 c2                	mov    %eax,%edx
+ d13:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ d16:	89 50 04             	mov    %edx,0x4(%eax)
+                p += p->s.size;
+ d19:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ d1c:	8b 40 04             	mov    0x4(%eax),%eax
+ d1f:	c1 e0 03             	shl    $0x3,%eax
+ d22:	01 45 f4             	add    %eax,-0xc(%ebp)
+                p->s.size = nunits;
+ d25:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ d28:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ d2b:	89 50 04             	mov    %edx,0x4(%eax)
+            }
+            freep = prevp;
+ d2e:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ d31:	a3 08 31 00 00       	mov    %eax,0x3108
+            return (void*)(p + 1);
+ d36:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ d39:	83 c0 08             	add    $0x8,%eax
+ d3c:	eb 3b                	jmp    d79 <malloc+0xe1>
+        }
+        if(p == freep)
+ d3e:	a1 08 31 00 00       	mov    0x3108,%eax
+ d43:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ d46:	75 1e                	jne    d66 <malloc+0xce>
+            if((p = morecore(nunits)) == 0)
+ d48:	83 ec 0c             	sub    $0xc,%esp
+ d4b:	ff 75 ec             	push   -0x14(%ebp)
+ d4e:	e8 e5 fe ff ff       	call   c38 <morecore>
+ d53:	83 c4 10             	add    $0x10,%esp
+ d56:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ d59:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ d5d:	75 07                	jne    d66 <malloc+0xce>
+                return 0;
+ d5f:	b8 00 00 00 00       	mov    $0x0,%eax
+ d64:	eb 13                	jmp    d79 <malloc+0xe1>
+    for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ d66:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ d69:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ d6c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ d6f:	8b 00                	mov    (%eax),%eax
+ d71:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        if(p->s.size >= nunits){
+ d74:	e9 6d ff ff ff       	jmp    ce6 <malloc+0x4e>
+    }
+}
+ d79:	c9                   	leave
+ d7a:	c3                   	ret
@@ -0,0 +1,104 @@
+// Test the submission and completion rings: open a file, write
+// its blocks with several writes in flight, read them back the
+// same way, and close it, all through one ring.
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "fcntl.h"
+#include "ioring.h"
+
+#define NBLK  8
+#define BLK   512
+
+struct ioring *ring;
+int rfd;
+
+void
+submit(int op, int fd, void *addr, uint len, int off, uint data)
+{
+    struct iosqe *e;
+
+    e = &ring->sq[ring->sqtail % IORING_SQ];
+    e->op = op;
+    e->fd = fd;
+    e->addr = (uint)addr;
+    e->len = len;
+    e->off = off;
+    e->data = data;
+    ring->sqtail++;
+}
+
+// Submit everything queued, wait for n completions, and check
+// that each succeeded with res bytes, or any res if res < 0.
+// Return the result of the last one.
+int
+reap(int n, int res)
+{
+    struct iocqe *c;
+    int i, r;
+
+    if(ioring_enter(rfd, IORING_SQ, n) < 0){
+        printf(1, "ioring_enter failed\n");
+        exit();
+    }
+    r = 0;
+    for(i = 0; i < n; i++){
+        if(ring->cqhead == ring->cqtail){
+            printf(1, "missing completion\n");
+            exit();
+        }
+        c = &ring->cq[ring->cqhead % IORING_CQ];
+        r = c->res;
+        if(r < 0 || (res >= 0 && r != res)){
+            printf(1, "op %d returned %d\n", c->data, r);
+            exit();
+        }
+        ring->cqhead++;
+    }
+    return r;
+}
+
+int
+main(int argc, char *argv[])
+{
+    static char wbuf[NBLK][BLK], rbuf[NBLK][BLK];
+    int fd, i, j;
+
+    printf(1, "ioringtest starting\n");
+    if((rfd = ioring_setup(&ring)) < 0){
+        printf(1, "ioring_setup failed\n");
+        exit();
+    }
+
+    submit(IOOP_OPEN, 0, "ioringfile", O_CREATE|O_RDWR, 0, 0);
+    fd = reap(1, -1);
+
+    for(i = 0; i < NBLK; i++){
+        for(j = 0; j < BLK; j++)
+            wbuf[i][j] = i + j;
+        submit(IOOP_WRITE, fd, wbuf[i], BLK, i*BLK, i);
+    }
+    reap(NBLK, BLK);
+    submit(IOOP_FSYNC, fd, 0, 0, 0, 0);
+    reap(1, 0);
+
+    for(i = 0; i < NBLK; i++)
+        submit(IOOP_READ, fd, rbuf[i], BLK, i*BLK, i);
+    reap(NBLK, BLK);
+    submit(IOOP_CLOSE, fd, 0, 0, 0, 0);
+    reap(1, 0);
+
+    for(i = 0; i < NBLK; i++){
+        for(j = 0; j < BLK; j++){
+            if(wbuf[i][j] != rbuf[i][j]){
+                printf(1, "block %d differs at %d\n", i, j);
+                exit();
+            }
+        }
+    }
+    unlink("ioringfile");
+    close(rfd);
+    printf(1, "ioringtest ok\n");
+    exit();
+}
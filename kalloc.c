@@ -98,6 +98,13 @@ kalloc(void)
 }
 
 
+void kincref(uint pa)
+{
+    acquire(&pgref_lock);
+    ++pgref[PGNUM(pa)];
+    release(&pgref_lock);
+}
+
 void kdecref(uint pa)
 {
     acquire(&pgref_lock);
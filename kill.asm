@@ -0,0 +1,1402 @@
+
+_kill:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "stat.h"
+#include "user.h"
+
+int
+main(int argc, char **argv)
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	53                   	push   %ebx
+   e:	51                   	push   %ecx
+   f:	83 ec 10             	sub    $0x10,%esp
+  12:	89 cb                	mov    %ecx,%ebx
+    int i;
+
+    if(argc < 2){
+  14:	83 3b 01             	cmpl   $0x1,(%ebx)
+  17:	7f 17                	jg     30 <main+0x30>
+        printf(2, "usage: kill pid...\n");
+  19:	83 ec 08             	sub    $0x8,%esp
+  1c:	68 31 0a 00 00       	push   $0xa31
+  21:	6a 02                	push   $0x2
+  23:	e8 52 06 00 00       	call   67a <printf>
+  28:	83 c4 10             	add    $0x10,%esp
+        exit();
+  2b:	e8 4c 03 00 00       	call   37c <exit>
+    }
+    for(i=1; i<argc; i++)
+  30:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+  37:	eb 2d                	jmp    66 <main+0x66>
+        kill(atoi(argv[i]));
+  39:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  3c:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+  43:	8b 43 04             	mov    0x4(%ebx),%eax
+  46:	01 d0                	add    %edx,%eax
+  48:	8b 00                	mov    (%eax),%eax
+  4a:	83 ec 0c             	sub    $0xc,%esp
+  4d:	50                   	push   %eax
+  4e:	e8 e4 01 00 00       	call   237 <atoi>
+  53:	83 c4 10             	add    $0x10,%esp
+  56:	83 ec 0c             	sub    $0xc,%esp
+  59:	50                   	push   %eax
+  5a:	e8 50 03 00 00       	call   3af <kill>
+  5f:	83 c4 10             	add    $0x10,%esp
+    for(i=1; i<argc; i++)
+  62:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+  66:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  69:	3b 03                	cmp    (%ebx),%eax
+  6b:	7c cc                	jl     39 <main+0x39>
+    exit();
+  6d:	e8 0a 03 00 00       	call   37c <exit>
+
+00000072 <stosb>:
+strchr(const char *s, char c)
+{
+    for(; *s; s++)
+        if(*s == c)
+            return (char*)s;
+    return 0;
+  72:	55                   	push   %ebp
+  73:	89 e5                	mov    %esp,%ebp
+  75:	57                   	push   %edi
+  76:	53                   	push   %ebx
+}
+  77:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  7a:	8b 55 10             	mov    0x10(%ebp),%edx
+  7d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80:	89 cb                	mov    %ecx,%ebx
+  82:	89 df                	mov    %ebx,%edi
+  84:	89 d1                	mov    %edx,%ecx
+  86:	fc                   	cld
+  87:	f3 aa                	rep stos %al,%es:(%edi)
+  89:	89 ca                	mov    %ecx,%edx
+  8b:	89 fb                	mov    %edi,%ebx
+  8d:	89 5d 08             	mov    %ebx,0x8(%ebp)
+  90:	89 55 10             	mov    %edx,0x10(%ebp)
+
+char*
+gets(char *buf, int max)
+{
+  93:	90                   	nop
+  94:	5b                   	pop    %ebx
+  95:	5f                   	pop    %edi
+  96:	5d                   	pop    %ebp
+  97:	c3                   	ret
+
+00000098 <strcpy>:
+{
+  98:	55                   	push   %ebp
+  99:	89 e5                	mov    %esp,%ebp
+  9b:	83 ec 10             	sub    $0x10,%esp
+    os = s;
+  9e:	8b 45 08             	mov    0x8(%ebp),%eax
+  a1:	89 45 fc             	mov    %eax,-0x4(%ebp)
+    while((*s++ = *t++) != 0)
+  a4:	90                   	nop
+  a5:	8b 55 0c             	mov    0xc(%ebp),%edx
+  a8:	8d 42 01             	lea    0x1(%edx),%eax
+  ab:	89 45 0c             	mov    %eax,0xc(%ebp)
+  ae:	8b 45 08             	mov    0x8(%ebp),%eax
+  b1:	8d 48 01             	lea    0x1(%eax),%ecx
+  b4:	89 4d 08             	mov    %ecx,0x8(%ebp)
+  b7:	0f b6 12             	movzbl (%edx),%edx
+  ba:	88 10                	mov    %dl,(%eax)
+  bc:	0f b6 00             	movzbl (%eax),%eax
+  bf:	84 c0                	test   %al,%al
+  c1:	75 e2                	jne    a5 <strcpy+0xd>
+    return os;
+  c3:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+  c6:	c9                   	leave
+  c7:	c3                   	ret
+
+000000c8 <strcmp>:
+{
+  c8:	55                   	push   %ebp
+  c9:	89 e5                	mov    %esp,%ebp
+    while(*p && *p == *q)
+  cb:	eb 08                	jmp    d5 <strcmp+0xd>
+        p++, q++;
+  cd:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+  d1:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+    while(*p && *p == *q)
+  d5:	8b 45 08             	mov    0x8(%ebp),%eax
+  d8:	0f b6 00             	movzbl (%eax),%eax
+  db:	84 c0                	test   %al,%al
+  dd:	74 10                	je     ef <strcmp+0x27>
+  df:	8b 45 08             	mov    0x8(%ebp),%eax
+  e2:	0f b6 10             	movzbl (%eax),%edx
+  e5:	8b 45 0c             	mov    0xc(%ebp),%eax
+  e8:	0f b6 00             	movzbl (%eax),%eax
+  eb:	38 c2                	cmp    %al,%dl
+  ed:	74 de                	je     cd <strcmp+0x5>
+    return (uchar)*p - (uchar)*q;
+  ef:	8b 45 08             	mov    0x8(%ebp),%eax
+  f2:	0f b6 00             	movzbl (%eax),%eax
+  f5:	0f b6 d0             	movzbl %al,%edx
+  f8:	8b 45 0c             	mov    0xc(%ebp),%eax
+  fb:	0f b6 00             	movzbl (%eax),%eax
+  fe:	0f b6 c0             	movzbl %al,%eax
+ 101:	29 c2                	sub    %eax,%edx
+ 103:	89 d0                	mov    %edx,%eax
+}
+ 105:	5d                   	pop    %ebp
+ 106:	c3                   	ret
+
+00000107 <strlen>:
+{
+ 107:	55                   	push   %ebp
+ 108:	89 e5                	mov    %esp,%ebp
+ 10a:	83 ec 10             	sub    $0x10,%esp
+    for(n = 0; s[n]; n++)
+ 10d:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ 114:	eb 04                	jmp    11a <strlen+0x13>
+ 116:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 11a:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 11d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 120:	01 d0                	add    %edx,%eax
+ 122:	0f b6 00             	movzbl (%eax),%eax
+ 125:	84 c0                	test   %al,%al
+ 127:	75 ed                	jne    116 <strlen+0xf>
+    return n;
+ 129:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 12c:	c9                   	leave
+ 12d:	c3                   	ret
+
+0000012e <memset>:
+{
+ 12e:	55                   	push   %ebp
+ 12f:	89 e5                	mov    %esp,%ebp
+    stosb(dst, c, n);
+ 131:	8b 45 10             	mov    0x10(%ebp),%eax
+ 134:	50                   	push   %eax
+ 135:	ff 75 0c             	push   0xc(%ebp)
+ 138:	ff 75 08             	push   0x8(%ebp)
+ 13b:	e8 32 ff ff ff       	call   72 <stosb>
+ 140:	83 c4 0c             	add    $0xc,%esp
+    return dst;
+ 143:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 146:	c9                   	leave
+ 147:	c3                   	ret
+
+00000148 <strchr>:
+{
+ 148:	55                   	push   %ebp
+ 149:	89 e5                	mov    %esp,%ebp
+ 14b:	83 ec 04             	sub    $0x4,%esp
+ 14e:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 151:	88 45 fc             	mov    %al,-0x4(%ebp)
+    for(; *s; s++)
+ 154:	eb 14                	jmp    16a <strchr+0x22>
+        if(*s == c)
+ 156:	8b 45 08             	mov    0x8(%ebp),%eax
+ 159:	0f b6 00             	movzbl (%eax),%eax
+ 15c:	38 45 fc             	cmp    %al,-0x4(%ebp)
+ 15f:	75 05                	jne    166 <strchr+0x1e>
+            return (char*)s;
+ 161:	8b 45 08             	mov    0x8(%ebp),%eax
+ 164:	eb 13                	jmp    179 <strchr+0x31>
+    for(; *s; s++)
+ 166:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 16a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 16d:	0f b6 00             	movzbl (%eax),%eax
+ 170:	84 c0                	test   %al,%al
+ 172:	75 e2                	jne    156 <strchr+0xe>
+    return 0;
+ 174:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 179:	c9                   	leave
+ 17a:	c3                   	ret
+
+0000017b <gets>:
+{
+ 17b:	55                   	push   %ebp
+ 17c:	89 e5                	mov    %esp,%ebp
+ 17e:	83 ec 18             	sub    $0x18,%esp
+    int i, cc;
+    char c;
+
+    for(i=0; i+1 < max; ){
+ 181:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 188:	eb 42                	jmp    1cc <gets+0x51>
+        cc = read(0, &c, 1);
+ 18a:	83 ec 04             	sub    $0x4,%esp
+ 18d:	6a 01                	push   $0x1
+ 18f:	8d 45 ef             	lea    -0x11(%ebp),%eax
+ 192:	50                   	push   %eax
+ 193:	6a 00                	push   $0x0
+ 195:	e8 f7 01 00 00       	call   391 <read>
+ 19a:	83 c4 10             	add    $0x10,%esp
+ 19d:	89 45 f0             	mov    %eax,-0x10(%ebp)
+        if(cc < 1)
+ 1a0:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 1a4:	7e 33                	jle    1d9 <gets+0x5e>
+            break;
+        buf[i++] = c;
+ 1a6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 1a9:	8d 50 01             	lea    0x1(%eax),%edx
+ 1ac:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 1af:	89 c2                	mov    %eax,%edx
+ 1b1:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1b4:	01 c2                	add    %eax,%edx
+ 1b6:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 1ba:	88 02                	mov    %al,(%edx)
+        if(c == '\n' || c == '\r')
+ 1bc:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 1c0:	3c 0a                	cmp    $0xa,%al
+ 1c2:	74 16                	je     1da <gets+0x5f>
+ 1c4:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 1c8:	3c 0d                	cmp    $0xd,%al
+ 1ca:	74 0e                	je     1da <gets+0x5f>
+    for(i=0; i+1 < max; ){
+ 1cc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 1cf:	83 c0 01             	add    $0x1,%eax
+ 1d2:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 1d5:	7f b3                	jg     18a <gets+0xf>
+ 1d7:	eb 01                	jmp    1da <gets+0x5f>
+            break;
+ 1d9:	90                   	nop
+            break;
+    }
+    buf[i] = '\0';
+ 1da:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 1dd:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1e0:	01 d0                	add    %edx,%eax
+ 1e2:	c6 00 00             	movb   $0x0,(%eax)
+    return buf;
+ 1e5:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 1e8:	c9                   	leave
+ 1e9:	c3                   	ret
+
+000001ea <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 1ea:	55                   	push   %ebp
+ 1eb:	89 e5                	mov    %esp,%ebp
+ 1ed:	83 ec 18             	sub    $0x18,%esp
+    int fd;
+    int r;
+
+    fd = open(n, O_RDONLY);
+ 1f0:	83 ec 08             	sub    $0x8,%esp
+ 1f3:	6a 00                	push   $0x0
+ 1f5:	ff 75 08             	push   0x8(%ebp)
+ 1f8:	e8 c6 01 00 00       	call   3c3 <open>
+ 1fd:	83 c4 10             	add    $0x10,%esp
+ 200:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(fd < 0)
+ 203:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 207:	79 07                	jns    210 <stat+0x26>
+        return -1;
+ 209:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 20e:	eb 25                	jmp    235 <stat+0x4b>
+    r = fstat(fd, st);
+ 210:	83 ec 08             	sub    $0x8,%esp
+ 213:	ff 75 0c             	push   0xc(%ebp)
+ 216:	ff 75 f4             	push   -0xc(%ebp)
+ 219:	e8 c3 01 00 00       	call   3e1 <fstat>
+ 21e:	83 c4 10             	add    $0x10,%esp
+ 221:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    close(fd);
+ 224:	83 ec 0c             	sub    $0xc,%esp
+ 227:	ff 75 f4             	push   -0xc(%ebp)
+ 22a:	e8 76 01 00 00       	call   3a5 <close>
+ 22f:	83 c4 10             	add    $0x10,%esp
+    return r;
+ 232:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ 235:	c9                   	leave
+ 236:	c3                   	ret
+
+00000237 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 237:	55                   	push   %ebp
+ 238:	89 e5                	mov    %esp,%ebp
+ 23a:	83 ec 10             	sub    $0x10,%esp
+    int n;
+
+    n = 0;
+ 23d:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+    while('0' <= *s && *s <= '9')
+ 244:	eb 25                	jmp    26b <atoi+0x34>
+        n = n*10 + *s++ - '0';
+ 246:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 249:	89 d0                	mov    %edx,%eax
+ 24b:	c1 e0 02             	shl    $0x2,%eax
+ 24e:	01 d0                	add    %edx,%eax
+ 250:	01 c0                	add    %eax,%eax
+ 252:	89 c1                	mov    %eax,%ecx
+ 254:	8b 45 08             	mov    0x8(%ebp),%eax
+ 257:	8d 50 01             	lea    0x1(%eax),%edx
+ 25a:	89 55 08             	mov    %edx,0x8(%ebp)
+ 25d:	0f b6 00             	movzbl (%eax),%eax
+ 260:	0f be c0             	movsbl %al,%eax
+ 263:	01 c8                	add    %ecx,%eax
+ 265:	83 e8 30             	sub    $0x30,%eax
+ 268:	89 45 fc             	mov    %eax,-0x4(%ebp)
+    while('0' <= *s && *s <= '9')
+ 26b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 26e:	0f b6 00             	movzbl (%eax),%eax
+ 271:	3c 2f                	cmp    $0x2f,%al
+ 273:	7e 0a                	jle    27f <atoi+0x48>
+ 275:	8b 45 08             	mov    0x8(%ebp),%eax
+ 278:	0f b6 00             	movzbl (%eax),%eax
+ 27b:	3c 39                	cmp    $0x39,%al
+ 27d:	7e c7                	jle    246 <atoi+0xf>
+    return n;
+ 27f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 282:	c9                   	leave
+ 283:	c3                   	ret
+
+00000284 <nice>:
+
+// Add inc to the caller's nice value; return the new value.
+int
+nice(int inc)
+{
+ 284:	55                   	push   %ebp
+ 285:	89 e5                	mov    %esp,%ebp
+ 287:	83 ec 18             	sub    $0x18,%esp
+    int n;
+
+    n = getpriority(0) + inc;
+ 28a:	83 ec 0c             	sub    $0xc,%esp
+ 28d:	6a 00                	push   $0x0
+ 28f:	e8 d9 01 00 00       	call   46d <getpriority>
+ 294:	83 c4 10             	add    $0x10,%esp
+ 297:	8b 55 08             	mov    0x8(%ebp),%edx
+ 29a:	01 d0                	add    %edx,%eax
+ 29c:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(n < 0)
+ 29f:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 2a3:	79 07                	jns    2ac <nice+0x28>
+        n = 0;
+ 2a5:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    if(n > NICEMAX)
+ 2ac:	83 7d f4 13          	cmpl   $0x13,-0xc(%ebp)
+ 2b0:	7e 07                	jle    2b9 <nice+0x35>
+        n = NICEMAX;
+ 2b2:	c7 45 f4 13 00 00 00 	movl   $0x13,-0xc(%ebp)
+    if(setpriority(0, n) < 0)
+ 2b9:	83 ec 08             	sub    $0x8,%esp
+ 2bc:	ff 75 f4             	push   -0xc(%ebp)
+ 2bf:	6a 00                	push   $0x0
+ 2c1:	e8 b1 01 00 00       	call   477 <setpriority>
+ 2c6:	83 c4 10             	add    $0x10,%esp
+ 2c9:	85 c0                	test   %eax,%eax
+ 2cb:	79 07                	jns    2d4 <nice+0x50>
+        return -1;
+ 2cd:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 2d2:	eb 03                	jmp    2d7 <nice+0x53>
+    return n;
+ 2d4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+ 2d7:	c9                   	leave
+ 2d8:	c3                   	ret
+
+000002d9 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 2d9:	55                   	push   %ebp
+ 2da:	89 e5                	mov    %esp,%ebp
+ 2dc:	83 ec 10             	sub    $0x10,%esp
+    char *dst;
+    const char *src;
+
+    dst = vdst;
+ 2df:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2e2:	89 45 fc             	mov    %eax,-0x4(%ebp)
+    src = vsrc;
+ 2e5:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 2e8:	89 45 f8             	mov    %eax,-0x8(%ebp)
+    while(n-- > 0)
+ 2eb:	eb 17                	jmp    304 <memmove+0x2b>
+        *dst++ = *src++;
+ 2ed:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 2f0:	8d 42 01             	lea    0x1(%edx),%eax
+ 2f3:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 2f6:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 2f9:	8d 48 01             	lea    0x1(%eax),%ecx
+ 2fc:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+ 2ff:	0f b6 12             	movzbl (%edx),%edx
+ 302:	88 10                	mov    %dl,(%eax)
+    while(n-- > 0)
+ 304:	8b 45 10             	mov    0x10(%ebp),%eax
+ 307:	8d 50 ff             	lea    -0x1(%eax),%edx
+ 30a:	89 55 10             	mov    %edx,0x10(%ebp)
+ 30d:	85 c0                	test   %eax,%eax
+ 30f:	7f dc                	jg     2ed <memmove+0x14>
+    return vdst;
+ 311:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 314:	c9                   	leave
+ 315:	c3                   	ret
+
+00000316 <dosyscall>:
+sysmode:
+    .long 0
+
+    .text
+dosyscall:
+    cmpl $0, sysmode
+ 316:	83 3d b4 0c 00 00 00 	cmpl   $0x0,0xcb4
+    jg 2f
+ 31d:	7f 0c                	jg     32b <dosyscall+0x15>
+    jl 1f
+ 31f:	7c 07                	jl     328 <dosyscall+0x12>
+    call sepcheck
+ 321:	e8 27 00 00 00       	call   34d <sepcheck>
+    jmp dosyscall
+ 326:	eb ee                	jmp    316 <dosyscall>
+1:
+    int $T_SYSCALL
+ 328:	cd 40                	int    $0x40
+    ret
+ 32a:	c3                   	ret
+2:
+    pushl %ebx
+ 32b:	53                   	push   %ebx
+    pushl %esi
+ 32c:	56                   	push   %esi
+    pushl %edi
+ 32d:	57                   	push   %edi
+    pushl %ebp
+ 32e:	55                   	push   %ebp
+    movl 20(%esp), %ebx
+ 32f:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+    movl 24(%esp), %esi
+ 333:	8b 74 24 18          	mov    0x18(%esp),%esi
+    movl 28(%esp), %edi
+ 337:	8b 7c 24 1c          	mov    0x1c(%esp),%edi
+    movl 32(%esp), %ebp
+ 33b:	8b 6c 24 20          	mov    0x20(%esp),%ebp
+    movl %esp, %ecx
+ 33f:	89 e1                	mov    %esp,%ecx
+    movl $3f, %edx
+ 341:	ba 48 03 00 00       	mov    $0x348,%edx
+    sysenter
+ 346:	0f 34                	sysenter
+3:
+    popl %ebp
+ 348:	5d                   	pop    %ebp
+    popl %edi
+ 349:	5f                   	pop    %edi
+    popl %esi
+ 34a:	5e                   	pop    %esi
+    popl %ebx
+ 34b:	5b                   	pop    %ebx
+    ret
+ 34c:	c3                   	ret
+
+0000034d <sepcheck>:
+
+# Set sysmode from cpuid's SEP flag.    Preserves %eax.
+sepcheck:
+    pushl %eax
+ 34d:	50                   	push   %eax
+    pushl %ebx
+ 34e:	53                   	push   %ebx
+    movl $1, %eax
+ 34f:	b8 01 00 00 00       	mov    $0x1,%eax
+    cpuid
+ 354:	0f a2                	cpuid
+    movl $-1, sysmode
+ 356:	c7 05 b4 0c 00 00 ff 	movl   $0xffffffff,0xcb4
+ 35d:	ff ff ff 
+    testl $0x800, %edx
+ 360:	f7 c2 00 08 00 00    	test   $0x800,%edx
+    jz 1f
+ 366:	74 0a                	je     372 <sepcheck+0x25>
+    movl $1, sysmode
+ 368:	c7 05 b4 0c 00 00 01 	movl   $0x1,0xcb4
+ 36f:	00 00 00 
+1:
+    popl %ebx
+ 372:	5b                   	pop    %ebx
+    popl %eax
+ 373:	58                   	pop    %eax
+    ret
+ 374:	c3                   	ret
+
+00000375 <fork>:
+
+SYSCALL(fork)
+ 375:	b8 01 00 00 00       	mov    $0x1,%eax
+ 37a:	eb 9a                	jmp    316 <dosyscall>
+
+0000037c <exit>:
+SYSCALL(exit)
+ 37c:	b8 02 00 00 00       	mov    $0x2,%eax
+ 381:	eb 93                	jmp    316 <dosyscall>
+
+00000383 <wait>:
+SYSCALL(wait)
+ 383:	b8 03 00 00 00       	mov    $0x3,%eax
+ 388:	eb 8c                	jmp    316 <dosyscall>
+
+0000038a <pipe>:
+SYSCALL(pipe)
+ 38a:	b8 04 00 00 00       	mov    $0x4,%eax
+ 38f:	eb 85                	jmp    316 <dosyscall>
+
+00000391 <read>:
+SYSCALL(read)
+ 391:	b8 05 00 00 00       	mov    $0x5,%eax
+ 396:	e9 7b ff ff ff       	jmp    316 <dosyscall>
+
+0000039b <write>:
+SYSCALL(write)
+ 39b:	b8 10 00 00 00       	mov    $0x10,%eax
+ 3a0:	e9 71 ff ff ff       	jmp    316 <dosyscall>
+
+000003a5 <close>:
+SYSCALL(close)
+ 3a5:	b8 15 00 00 00       	mov    $0x15,%eax
+ 3aa:	e9 67 ff ff ff       	jmp    316 <dosyscall>
+
+000003af <kill>:
+SYSCALL(kill)
+ 3af:	b8 06 00 00 00       	mov    $0x6,%eax
+ 3b4:	e9 5d ff ff ff       	jmp    316 <dosyscall>
+
+000003b9 <exec>:
+SYSCALL(exec)
+ 3b9:	b8 07 00 00 00       	mov    $0x7,%eax
+ 3be:	e9 53 ff ff ff       	jmp    316 <dosyscall>
+
+000003c3 <open>:
+SYSCALL(open)
+ 3c3:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 3c8:	e9 49 ff ff ff       	jmp    316 <dosyscall>
+
+000003cd <mknod>:
+SYSCALL(mknod)
+ 3cd:	b8 11 00 00 00       	mov    $0x11,%eax
+ 3d2:	e9 3f ff ff ff       	jmp    316 <dosyscall>
+
+000003d7 <unlink>:
+SYSCALL(unlink)
+ 3d7:	b8 12 00 00 00       	mov    $0x12,%eax
+ 3dc:	e9 35 ff ff ff       	jmp    316 <dosyscall>
+
+000003e1 <fstat>:
+SYSCALL(fstat)
+ 3e1:	b8 08 00 00 00       	mov    $0x8,%eax
+ 3e6:	e9 2b ff ff ff       	jmp    316 <dosyscall>
+
+000003eb <link>:
+SYSCALL(link)
+ 3eb:	b8 13 00 00 00       	mov    $0x13,%eax
+ 3f0:	e9 21 ff ff ff       	jmp    316 <dosyscall>
+
+000003f5 <mkdir>:
+SYSCALL(mkdir)
+ 3f5:	b8 14 00 00 00       	mov    $0x14,%eax
+ 3fa:	e9 17 ff ff ff       	jmp    316 <dosyscall>
+
+000003ff <chdir>:
+SYSCALL(chdir)
+ 3ff:	b8 09 00 00 00       	mov    $0x9,%eax
+ 404:	e9 0d ff ff ff       	jmp    316 <dosyscall>
+
+00000409 <dup>:
+SYSCALL(dup)
+ 409:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 40e:	e9 03 ff ff ff       	jmp    316 <dosyscall>
+
+00000413 <getpid>:
+SYSCALL(getpid)
+ 413:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 418:	e9 f9 fe ff ff       	jmp    316 <dosyscall>
+
+0000041d <sbrk>:
+SYSCALL(sbrk)
+ 41d:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 422:	e9 ef fe ff ff       	jmp    316 <dosyscall>
+
+00000427 <sleep>:
+SYSCALL(sleep)
+ 427:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 42c:	e9 e5 fe ff ff       	jmp    316 <dosyscall>
+
+00000431 <uptime>:
+SYSCALL(uptime)
+ 431:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 436:	e9 db fe ff ff       	jmp    316 <dosyscall>
+
+0000043b <date>:
+SYSCALL(date)
+ 43b:	b8 16 00 00 00       	mov    $0x16,%eax
+ 440:	e9 d1 fe ff ff       	jmp    316 <dosyscall>
+
+00000445 <dup2>:
+SYSCALL(dup2)
+ 445:	b8 17 00 00 00       	mov    $0x17,%eax
+ 44a:	e9 c7 fe ff ff       	jmp    316 <dosyscall>
+
+0000044f <uffd>:
+SYSCALL(uffd)
+ 44f:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 454:	e9 bd fe ff ff       	jmp    316 <dosyscall>
+
+00000459 <uffdregister>:
+SYSCALL(uffdregister)
+ 459:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 45e:	e9 b3 fe ff ff       	jmp    316 <dosyscall>
+
+00000463 <uffdcopy>:
+SYSCALL(uffdcopy)
+ 463:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 468:	e9 a9 fe ff ff       	jmp    316 <dosyscall>
+
+0000046d <getpriority>:
+SYSCALL(getpriority)
+ 46d:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 472:	e9 9f fe ff ff       	jmp    316 <dosyscall>
+
+00000477 <setpriority>:
+SYSCALL(setpriority)
+ 477:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 47c:	e9 95 fe ff ff       	jmp    316 <dosyscall>
+
+00000481 <setweight>:
+SYSCALL(setweight)
+ 481:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 486:	e9 8b fe ff ff       	jmp    316 <dosyscall>
+
+0000048b <setgroup>:
+SYSCALL(setgroup)
+ 48b:	b8 20 00 00 00       	mov    $0x20,%eax
+ 490:	e9 81 fe ff ff       	jmp    316 <dosyscall>
+
+00000495 <schedinfo>:
+SYSCALL(schedinfo)
+ 495:	b8 21 00 00 00       	mov    $0x21,%eax
+ 49a:	e9 77 fe ff ff       	jmp    316 <dosyscall>
+
+0000049f <nanosleep>:
+SYSCALL(nanosleep)
+ 49f:	b8 22 00 00 00       	mov    $0x22,%eax
+ 4a4:	e9 6d fe ff ff       	jmp    316 <dosyscall>
+
+000004a9 <clock_nanosleep>:
+SYSCALL(clock_nanosleep)
+ 4a9:	b8 23 00 00 00       	mov    $0x23,%eax
+ 4ae:	e9 63 fe ff ff       	jmp    316 <dosyscall>
+
+000004b3 <clock_gettime>:
+SYSCALL(clock_gettime)
+ 4b3:	b8 24 00 00 00       	mov    $0x24,%eax
+ 4b8:	e9 59 fe ff ff       	jmp    316 <dosyscall>
+
+000004bd <sched_setaffinity>:
+SYSCALL(sched_setaffinity)
+ 4bd:	b8 25 00 00 00       	mov    $0x25,%eax
+ 4c2:	e9 4f fe ff ff       	jmp    316 <dosyscall>
+
+000004c7 <sched_getaffinity>:
+SYSCALL(sched_getaffinity)
+ 4c7:	b8 26 00 00 00       	mov    $0x26,%eax
+ 4cc:	e9 45 fe ff ff       	jmp    316 <dosyscall>
+
+000004d1 <irqaffinity>:
+SYSCALL(irqaffinity)
+ 4d1:	b8 27 00 00 00       	mov    $0x27,%eax
+ 4d6:	e9 3b fe ff ff       	jmp    316 <dosyscall>
+
+000004db <getrusage>:
+SYSCALL(getrusage)
+ 4db:	b8 28 00 00 00       	mov    $0x28,%eax
+ 4e0:	e9 31 fe ff ff       	jmp    316 <dosyscall>
+
+000004e5 <times>:
+SYSCALL(times)
+ 4e5:	b8 29 00 00 00       	mov    $0x29,%eax
+ 4ea:	e9 27 fe ff ff       	jmp    316 <dosyscall>
+
+000004ef <schedlat>:
+SYSCALL(schedlat)
+ 4ef:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 4f4:	e9 1d fe ff ff       	jmp    316 <dosyscall>
+
+000004f9 <sched_setscheduler>:
+SYSCALL(sched_setscheduler)
+ 4f9:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 4fe:	e9 13 fe ff ff       	jmp    316 <dosyscall>
+
+00000503 <sched_getscheduler>:
+SYSCALL(sched_getscheduler)
+ 503:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 508:	e9 09 fe ff ff       	jmp    316 <dosyscall>
+
+0000050d <sched_getparam>:
+SYSCALL(sched_getparam)
+ 50d:	b8 2d 00 00 00       	mov    $0x2d,%eax
+ 512:	e9 ff fd ff ff       	jmp    316 <dosyscall>
+
+00000517 <lockstat>:
+SYSCALL(lockstat)
+ 517:	b8 2e 00 00 00       	mov    $0x2e,%eax
+ 51c:	e9 f5 fd ff ff       	jmp    316 <dosyscall>
+
+00000521 <ioring_setup>:
+SYSCALL(ioring_setup)
+ 521:	b8 2f 00 00 00       	mov    $0x2f,%eax
+ 526:	e9 eb fd ff ff       	jmp    316 <dosyscall>
+
+0000052b <ioring_enter>:
+SYSCALL(ioring_enter)
+ 52b:	b8 30 00 00 00       	mov    $0x30,%eax
+ 530:	e9 e1 fd ff ff       	jmp    316 <dosyscall>
+
+00000535 <readv>:
+SYSCALL(readv)
+ 535:	b8 31 00 00 00       	mov    $0x31,%eax
+ 53a:	e9 d7 fd ff ff       	jmp    316 <dosyscall>
+
+0000053f <writev>:
+SYSCALL(writev)
+ 53f:	b8 32 00 00 00       	mov    $0x32,%eax
+ 544:	e9 cd fd ff ff       	jmp    316 <dosyscall>
+
+00000549 <pread>:
+SYSCALL(pread)
+ 549:	b8 33 00 00 00       	mov    $0x33,%eax
+ 54e:	e9 c3 fd ff ff       	jmp    316 <dosyscall>
+
+00000553 <pwrite>:
+SYSCALL(pwrite)
+ 553:	b8 34 00 00 00       	mov    $0x34,%eax
+ 558:	e9 b9 fd ff ff       	jmp    316 <dosyscall>
+
+0000055d <sendfile>:
+SYSCALL(sendfile)
+ 55d:	b8 35 00 00 00       	mov    $0x35,%eax
+ 562:	e9 af fd ff ff       	jmp    316 <dosyscall>
+
+00000567 <splice>:
+SYSCALL(splice)
+ 567:	b8 36 00 00 00       	mov    $0x36,%eax
+ 56c:	e9 a5 fd ff ff       	jmp    316 <dosyscall>
+
+00000571 <sysstat>:
+SYSCALL(sysstat)
+ 571:	b8 37 00 00 00       	mov    $0x37,%eax
+ 576:	e9 9b fd ff ff       	jmp    316 <dosyscall>
+
+0000057b <strace>:
+SYSCALL(strace)
+ 57b:	b8 38 00 00 00       	mov    $0x38,%eax
+ 580:	e9 91 fd ff ff       	jmp    316 <dosyscall>
+
+00000585 <straceread>:
+SYSCALL(straceread)
+ 585:	b8 39 00 00 00       	mov    $0x39,%eax
+ 58a:	e9 87 fd ff ff       	jmp    316 <dosyscall>
+
+0000058f <alarm>:
+
+# alarm and rstoregs keep to int $T_SYSCALL: rstoregs restores
+# %ecx and %edx, which sysexit would clobber.
+.globl alarm
+    alarm:
+        pushl $rstoregs
+ 58f:	68 9f 05 00 00       	push   $0x59f
+        movl $SYS_alarm, %eax
+ 594:	b8 18 00 00 00       	mov    $0x18,%eax
+        int $T_SYSCALL
+ 599:	cd 40                	int    $0x40
+        add $0x04, %esp
+ 59b:	83 c4 04             	add    $0x4,%esp
+        ret
+ 59e:	c3                   	ret
+
+0000059f <rstoregs>:
+
+.globl rstoregs
+    rstoregs:
+        movl $SYS_rstoregs, %eax
+ 59f:	b8 19 00 00 00       	mov    $0x19,%eax
+        int $T_SYSCALL
+ 5a4:	cd 40                	int    $0x40
+
+000005a6 <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 5a6:	55                   	push   %ebp
+ 5a7:	89 e5                	mov    %esp,%ebp
+ 5a9:	83 ec 18             	sub    $0x18,%esp
+ 5ac:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 5af:	88 45 f4             	mov    %al,-0xc(%ebp)
+    write(fd, &c, 1);
+ 5b2:	83 ec 04             	sub    $0x4,%esp
+ 5b5:	6a 01                	push   $0x1
+ 5b7:	8d 45 f4             	lea    -0xc(%ebp),%eax
+ 5ba:	50                   	push   %eax
+ 5bb:	ff 75 08             	push   0x8(%ebp)
+ 5be:	e8 d8 fd ff ff       	call   39b <write>
+ 5c3:	83 c4 10             	add    $0x10,%esp
+}
+ 5c6:	90                   	nop
+ 5c7:	c9                   	leave
+ 5c8:	c3                   	ret
+
+000005c9 <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 5c9:	55                   	push   %ebp
+ 5ca:	89 e5                	mov    %esp,%ebp
+ 5cc:	83 ec 28             	sub    $0x28,%esp
+    static char digits[] = "0123456789ABCDEF";
+    char buf[16];
+    int i, neg;
+    uint x;
+
+    neg = 0;
+ 5cf:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+    if(sgn && xx < 0){
+ 5d6:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+ 5da:	74 17                	je     5f3 <printint+0x2a>
+ 5dc:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 5e0:	79 11                	jns    5f3 <printint+0x2a>
+        neg = 1;
+ 5e2:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+        x = -xx;
+ 5e9:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 5ec:	f7 d8                	neg    %eax
+ 5ee:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 5f1:	eb 06                	jmp    5f9 <printint+0x30>
+    } else {
+        x = xx;
+ 5f3:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 5f6:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    }
+
+    i = 0;
+ 5f9:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    do{
+        buf[i++] = digits[x % base];
+ 600:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 603:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 606:	ba 00 00 00 00       	mov    $0x0,%edx
+ 60b:	f7 f1                	div    %ecx
+ 60d:	89 d1                	mov    %edx,%ecx
+ 60f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 612:	8d 50 01             	lea    0x1(%eax),%edx
+ 615:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 618:	0f b6 91 b8 0c 00 00 	movzbl 0xcb8(%ecx),%edx
+ 61f:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+    }while((x /= base) != 0);
+ 623:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 626:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 629:	ba 00 00 00 00       	mov    $0x0,%edx
+ 62e:	f7 f1                	div    %ecx
+ 630:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 633:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 637:	75 c7                	jne    600 <printint+0x37>
+    if(neg)
+ 639:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 63d:	74 2d                	je     66c <printint+0xa3>
+        buf[i++] = '-';
+ 63f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 642:	8d 50 01             	lea    0x1(%eax),%edx
+ 645:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 648:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+    while(--i >= 0)
+ 64d:	eb 1d                	jmp    66c <printint+0xa3>
+        putc(fd, buf[i]);
+ 64f:	8d 55 dc             	lea    -0x24(%ebp),%edx
+ 652:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 655:	01 d0                	add    %edx,%eax
+ 657:	0f b6 00             	movzbl (%eax),%eax
+ 65a:	0f be c0             	movsbl %al,%eax
+ 65d:	83 ec 08             	sub    $0x8,%esp
+ 660:	50                   	push   %eax
+ 661:	ff 75 08             	push   0x8(%ebp)
+ 664:	e8 3d ff ff ff       	call   5a6 <putc>
+ 669:	83 c4 10             	add    $0x10,%esp
+    while(--i >= 0)
+ 66c:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+ 670:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 674:	79 d9                	jns    64f <printint+0x86>
+}
+ 676:	90                   	nop
+ 677:	90                   	nop
+ 678:	c9                   	leave
+ 679:	c3                   	ret
+
+0000067a <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 67a:	55                   	push   %ebp
+ 67b:	89 e5                	mov    %esp,%ebp
+ 67d:	83 ec 28             	sub    $0x28,%esp
+    char *s;
+    int c, i, state;
+    uint *ap;
+
+    state = 0;
+ 680:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+    ap = (uint*)(void*)&fmt + 1;
+ 687:	8d 45 0c             	lea    0xc(%ebp),%eax
+ 68a:	83 c0 04             	add    $0x4,%eax
+ 68d:	89 45 e8             	mov    %eax,-0x18(%ebp)
+    for(i = 0; fmt[i]; i++){
+ 690:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 697:	e9 59 01 00 00       	jmp    7f5 <printf+0x17b>
+        c = fmt[i] & 0xff;
+ 69c:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 69f:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 6a2:	01 d0                	add    %edx,%eax
+ 6a4:	0f b6 00             	movzbl (%eax),%eax
+ 6a7:	0f be c0             	movsbl %al,%eax
+ 6aa:	25 ff 00 00 00       	and    $0xff,%eax
+ 6af:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        if(state == 0){
+ 6b2:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 6b6:	75 2c                	jne    6e4 <printf+0x6a>
+            if(c == '%'){
+ 6b8:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 6bc:	75 0c                	jne    6ca <printf+0x50>
+                state = '%';
+ 6be:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+ 6c5:	e9 27 01 00 00       	jmp    7f1 <printf+0x177>
+            } else {
+                putc(fd, c);
+ 6ca:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 6cd:	0f be c0             	movsbl %al,%eax
+ 6d0:	83 ec 08             	sub    $0x8,%esp
+ 6d3:	50                   	push   %eax
+ 6d4:	ff 75 08             	push   0x8(%ebp)
+ 6d7:	e8 ca fe ff ff       	call   5a6 <putc>
+ 6dc:	83 c4 10             	add    $0x10,%esp
+ 6df:	e9 0d 01 00 00       	jmp    7f1 <printf+0x177>
+            }
+        } else if(state == '%'){
+ 6e4:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+ 6e8:	0f 85 03 01 00 00    	jne    7f1 <printf+0x177>
+            if(c == 'd'){
+ 6ee:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+ 6f2:	75 1e                	jne    712 <printf+0x98>
+                printint(fd, *ap, 10, 1);
+ 6f4:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 6f7:	8b 00                	mov    (%eax),%eax
+ 6f9:	6a 01                	push   $0x1
+ 6fb:	6a 0a                	push   $0xa
+ 6fd:	50                   	push   %eax
+ 6fe:	ff 75 08             	push   0x8(%ebp)
+ 701:	e8 c3 fe ff ff       	call   5c9 <printint>
+ 706:	83 c4 10             	add    $0x10,%esp
+                ap++;
+ 709:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 70d:	e9 d8 00 00 00       	jmp    7ea <printf+0x170>
+            } else if(c == 'x' || c == 'p'){
+ 712:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+ 716:	74 06                	je     71e <printf+0xa4>
+ 718:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+ 71c:	75 1e                	jne    73c <printf+0xc2>
+                printint(fd, *ap, 16, 0);
+ 71e:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 721:	8b 00                	mov    (%eax),%eax
+ 723:	6a 00                	push   $0x0
+ 725:	6a 10                	push   $0x10
+ 727:	50                   	push   %eax
+ 728:	ff 75 08             	push   0x8(%ebp)
+ 72b:	e8 99 fe ff ff       	call   5c9 <printint>
+ 730:	83 c4 10             	add    $0x10,%esp
+                ap++;
+ 733:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 737:	e9 ae 00 00 00       	jmp    7ea <printf+0x170>
+            } else if(c == 's'){
+ 73c:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+ 740:	75 43                	jne    785 <printf+0x10b>
+                s = (char*)*ap;
+ 742:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 745:	8b 00                	mov    (%eax),%eax
+ 747:	89 45 f4             	mov    %eax,-0xc(%ebp)
+                ap++;
+ 74a:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+                if(s == 0)
+ 74e:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 752:	75 25                	jne    779 <printf+0xff>
+                    s = "(null)";
+ 754:	c7 45 f4 45 0a 00 00 	movl   $0xa45,-0xc(%ebp)
+                while(*s != 0){
+ 75b:	eb 1c                	jmp    779 <printf+0xff>
+                    putc(fd, *s);
+ 75d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 760:	0f b6 00             	movzbl (%eax),%eax
+ 763:	0f be c0             	movsbl %al,%eax
+ 766:	83 ec 08             	sub    $0x8,%esp
+ 769:	50                   	push   %eax
+ 76a:	ff 75 08             	push   0x8(%ebp)
+ 76d:	e8 34 fe ff ff       	call   5a6 <putc>
+ 772:	83 c4 10             	add    $0x10,%esp
+                    s++;
+ 775:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+                while(*s != 0){
+ 779:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 77c:	0f b6 00             	movzbl (%eax),%eax
+ 77f:	84 c0                	test   %al,%al
+ 781:	75 da                	jne    75d <printf+0xe3>
+ 783:	eb 65                	jmp    7ea <printf+0x170>
+                }
+            } else if(c == 'c'){
+ 785:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+ 789:	75 1d                	jne    7a8 <printf+0x12e>
+                putc(fd, *ap);
+ 78b:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 78e:	8b 00                	mov    (%eax),%eax
+ 790:	0f be c0             	movsbl %al,%eax
+ 793:	83 ec 08             	sub    $0x8,%esp
+ 796:	50                   	push   %eax
+ 797:	ff 75 08             	push   0x8(%ebp)
+ 79a:	e8 07 fe ff ff       	call   5a6 <putc>
+ 79f:	83 c4 10             	add    $0x10,%esp
+                ap++;
+ 7a2:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 7a6:	eb 42                	jmp    7ea <printf+0x170>
+            } else if(c == '%'){
+ 7a8:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 7ac:	75 17                	jne    7c5 <printf+0x14b>
+                putc(fd, c);
+ 7ae:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 7b1:	0f be c0             	movsbl %al,%eax
+ 7b4:	83 ec 08             	sub    $0x8,%esp
+ 7b7:	50                   	push   %eax
+ 7b8:	ff 75 08             	push   0x8(%ebp)
+ 7bb:	e8 e6 fd ff ff       	call   5a6 <putc>
+ 7c0:	83 c4 10             	add    $0x10,%esp
+ 7c3:	eb 25                	jmp    7ea <printf+0x170>
+            } else {
+                // Unknown % sequence.    Print it to draw attention.
+                putc(fd, '%');
+ 7c5:	83 ec 08             	sub    $0x8,%esp
+ 7c8:	6a 25                	push   $0x25
+ 7ca:	ff 75 08             	push   0x8(%ebp)
+ 7cd:	e8 d4 fd ff ff       	call   5a6 <putc>
+ 7d2:	83 c4 10             	add    $0x10,%esp
+                putc(fd, c);
+ 7d5:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 7d8:	0f be c0             	movsbl %al,%eax
+ 7db:	83 ec 08             	sub    $0x8,%esp
+ 7de:	50                   	push   %eax
+ 7df:	ff 75 08             	push   0x8(%ebp)
+ 7e2:	e8 bf fd ff ff       	call   5a6 <putc>
+ 7e7:	83 c4 10             	add    $0x10,%esp
+            }
+            state = 0;
+ 7ea:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+    for(i = 0; fmt[i]; i++){
+ 7f1:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ 7f5:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 7f8:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 7fb:	01 d0                	add    %edx,%eax
+ 7fd:	0f b6 00             	movzbl (%eax),%eax
+ 800:	84 c0                	test   %al,%al
+ 802:	0f 85 94 fe ff ff    	jne    69c <printf+0x22>
+        }
+    }
+}
+ 808:	90                   	nop
+ 809:	90                   	nop
+ 80a:	c9                   	leave
+ 80b:	c3                   	ret
+
+0000080c <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 80c:	55                   	push   %ebp
+ 80d:	89 e5                	mov    %esp,%ebp
+ 80f:	83 ec 10             	sub    $0x10,%esp
+    Header *bp, *p;
+
+    bp = (Header*)ap - 1;
+ 812:	8b 45 08             	mov    0x8(%ebp),%eax
+ 815:	83 e8 08             	sub    $0x8,%eax
+ 818:	89 45 f8             	mov    %eax,-0x8(%ebp)
+    for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 81b:	a1 d4 0c 00 00       	mov    0xcd4,%eax
+ 820:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 823:	eb 24                	jmp    849 <free+0x3d>
+        if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 825:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 828:	8b 00                	mov    (%eax),%eax
+ 82a:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 82d:	72 12                	jb     841 <free+0x35>
+ 82f:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 832:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 835:	72 24                	jb     85b <free+0x4f>
+ 837:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 83a:	8b 00                	mov    (%eax),%eax
+ 83c:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 83f:	72 1a                	jb     85b <free+0x4f>
+    for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 841:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 844:	8b 00                	mov    (%eax),%eax
+ 846:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 849:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 84c:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 84f:	73 d4                	jae    825 <free+0x19>
+ 851:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 854:	8b 00                	mov    (%eax),%eax
+ 856:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 859:	73 ca                	jae    825 <free+0x19>
+            break;
+    if(bp + bp->s.size == p->s.ptr){
+ 85b:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 85e:	8b 40 04             	mov    0x4(%eax),%eax
+ 861:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 868:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 86b:	01 c2                	add    %eax,%edx
+ 86d:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 870:	8b 00                	mov    (%eax),%eax
+ 872:	39 c2                	cmp    %eax,%edx
+ 874:	75 24                	jne    89a <free+0x8e>
+        bp->s.size += p->s.ptr->s.size;
+ 876:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 879:	8b 50 04             	mov    0x4(%eax),%edx
+ 87c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 87f:	8b 00                	mov    (%eax),%eax
+ 881:	8b 40 04             	mov    0x4(%eax),%eax
+ 884:	01 c2                	add    %eax,%edx
+ 886:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 889:	89 50 04             	mov    %edx,0x4(%eax)
+        bp->s.ptr = p->s.ptr->s.ptr;
+ 88c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 88f:	8b 00                	mov    (%eax),%eax
+ 891:	8b 10                	mov    (%eax),%edx
+ 893:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 896:	89 10                	mov    %edx,(%eax)
+ 898:	eb 0a                	jmp    8a4 <free+0x98>
+    } else
+        bp->s.ptr = p->s.ptr;
+ 89a:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 89d:	8b 10                	mov    (%eax),%edx
+ 89f:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 8a2:	89 10                	mov    %edx,(%eax)
+    if(p + p->s.size == bp){
+ 8a4:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 8a7:	8b 40 04             	mov    0x4(%eax),%eax
+ 8aa:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 8b1:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 8b4:	01 d0                	add    %edx,%eax
+ 8b6:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 8b9:	75 20                	jne    8db <free+0xcf>
+        p->s.size += bp->s.size;
+ 8bb:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 8be:	8b 50 04             	mov    0x4(%eax),%edx
+ 8c1:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 8c4:	8b 40 04             	mov    0x4(%eax),%eax
+ 8c7:	01 c2                	add    %eax,%edx
+ 8c9:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 8cc:	89 50 04             	mov    %edx,0x4(%eax)
+        p->s.ptr = bp->s.ptr;
+ 8cf:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 8d2:	8b 10                	mov    (%eax),%edx
+ 8d4:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 8d7:	89 10                	mov    %edx,(%eax)
+ 8d9:	eb 08                	jmp    8e3 <free+0xd7>
+    } else
+        p->s.ptr = bp;
+ 8db:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 8de:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 8e1:	89 10                	mov    %edx,(%eax)
+    freep = p;
+ 8e3:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 8e6:	a3 d4 0c 00 00       	mov    %eax,0xcd4
+}
+ 8eb:	90                   	nop
+ 8ec:	c9                   	leave
+ 8ed:	c3                   	ret
+
+000008ee <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+ 8ee:	55                   	push   %ebp
+ 8ef:	89 e5                	mov    %esp,%ebp
+ 8f1:	83 ec 18             	sub    $0x18,%esp
+    char *p;
+    Header *hp;
+
+    if(nu < 4096)
+ 8f4:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+ 8fb:	77 07                	ja     904 <morecore+0x16>
+        nu = 4096;
+ 8fd:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+    p = sbrk(nu * sizeof(Header));
+ 904:	8b 45 08             	mov    0x8(%ebp),%eax
+ 907:	c1 e0 03             	shl    $0x3,%eax
+ 90a:	83 ec 0c             	sub    $0xc,%esp
+ 90d:	50                   	push   %eax
+ 90e:	e8 0a fb ff ff       	call   41d <sbrk>
+ 913:	83 c4 10             	add    $0x10,%esp
+ 916:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p == (char*)-1)
+ 919:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+ 91d:	75 07                	jne    926 <morecore+0x38>
+        return 0;
+ 91f:	b8 00 00 00 00       	mov    $0x0,%eax
+ 924:	eb 26                	jmp    94c <morecore+0x5e>
+    hp = (Header*)p;
+ 926:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 929:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    hp->s.size = nu;
+ 92c:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 92f:	8b 55 08             	mov    0x8(%ebp),%edx
+ 932:	89 50 04             	mov    %edx,0x4(%eax)
+    free((void*)(hp + 1));
+ 935:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 938:	83 c0 08             	add    $0x8,%eax
+ 93b:	83 ec 0c             	sub    $0xc,%esp
+ 93e:	50                   	push   %eax
+ 93f:	e8 c8 fe ff ff       	call   80c <free>
+ 944:	83 c4 10             	add    $0x10,%esp
+    return freep;
+ 947:	a1 d4 0c 00 00       	mov    0xcd4,%eax
+}
+ 94c:	c9                   	leave
+ 94d:	c3                   	ret
+
+0000094e <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ 94e:	55                   	push   %ebp
+ 94f:	89 e5                	mov    %esp,%ebp
+ 951:	83 ec 18             	sub    $0x18,%esp
+    Header *p, *prevp;
+    uint nunits;
+
+    nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 954:	8b 45 08             	mov    0x8(%ebp),%eax
+ 957:	83 c0 07             	add    $0x7,%eax
+ 95a:	c1 e8 03             	shr    $0x3,%eax
+ 95d:	83 c0 01             	add    $0x1,%eax
+ 960:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    if((prevp = freep) == 0){
+ 963:	a1 d4 0c 00 00       	mov    0xcd4,%eax
+ 968:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ 96b:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 96f:	75 23                	jne    994 <malloc+0x46>
+        base.s.ptr = freep = prevp = &base;
+ 971:	c7 45 f0 cc 0c 00 00 	movl   $0xccc,-0x10(%ebp)
+ 978:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 97b:	a3 d4 0c 00 00       	mov    %eax,0xcd4
+ 980:	a1 d4 0c 00 00       	mov    0xcd4,%eax
+ 985:	a3 cc 0c 00 00       	mov    %eax,0xccc
+        base.s.size = 0;
+ 98a:	c7 05 d0 0c 00 00 00 	movl   $0x0,0xcd0
+ 991:	00 00 00 
+    }
+    for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 994:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 997:	8b 00                	mov    (%eax),%eax
+ 999:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        if(p->s.size >= nunits){
+ 99c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 99f:	8b 40 04             	mov    0x4(%eax),%eax
+ 9a2:	3b 45 ec             	cmp    -0x14(%ebp),%eax
+ 9a5:	72 4d                	jb     9f4 <malloc+0xa6>
+            if(p->s.size == nunits)
+ 9a7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 9aa:	8b 40 04             	mov    0x4(%eax),%eax
+ 9ad:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+ 9b0:	75 0c                	jne    9be <malloc+0x70>
+                prevp->s.ptr = p->s.ptr;
+ 9b2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 9b5:	8b 10                	mov    (%eax),%edx
+ 9b7:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 9ba:	89 10                	mov    %edx,(%eax)
+ 9bc:	eb 26                	jmp    9e4 <malloc+0x96>
+            else {
+                p->s.size -= nunits;
+ 9be:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 9c1:	8b 40 04             	mov    0x4(%eax),%eax
+ 9c4:	2b 45 ec             	sub    -0x14(%ebp),%eax
+ 9c7:	89 c2                	mov    %eax,%edx
+ 9c9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 9cc:	89 50 04             	mov    %edx,0x4(%eax)
+                p += p->s.size;
+ 9cf:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 9d2:	8b 40 04             	mov    0x4(%eax),%eax
+ 9d5:	c1 e0 03             	shl    $0x3,%eax
+ 9d8:	01 45 f4             	add    %eax,-0xc(%ebp)
+                p->s.size = nunits;
+ 9db:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 9de:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 9e1:	89 50 04             	mov    %edx,0x4(%eax)
+            }
+            freep = prevp;
+ 9e4:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 9e7:	a3 d4 0c 00 00       	mov    %eax,0xcd4
+            return (void*)(p + 1);
+ 9ec:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 9ef:	83 c0 08             	add    $0x8,%eax
+ 9f2:	eb 3b                	jmp    a2f <malloc+0xe1>
+        }
+        if(p == freep)
+ 9f4:	a1 d4 0c 00 00       	mov    0xcd4,%eax
+ 9f9:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ 9fc:	75 1e                	jne    a1c <malloc+0xce>
+            if((p = morecore(nunits)) == 0)
+ 9fe:	83 ec 0c             	sub    $0xc,%esp
+ a01:	ff 75 ec             	push   -0x14(%ebp)
+ a04:	e8 e5 fe ff ff       	call   8ee <morecore>
+ a09:	83 c4 10             	add    $0x10,%esp
+ a0c:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ a0f:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ a13:	75 07                	jne    a1c <malloc+0xce>
+                return 0;
+ a15:	b8 00 00 00 00       	mov    $0x0,%eax
+ a1a:	eb 13                	jmp    a2f <malloc+0xe1>
+    for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ a1c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a1f:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ a22:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a25:	8b 00                	mov    (%eax),%eax
+ a27:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        if(p->s.size >= nunits){
+ a2a:	e9 6d ff ff ff       	jmp    99c <malloc+0x4e>
+    }
+}
+ a2f:	c9                   	leave
+ a30:	c3                   	ret
@@ -42,6 +42,9 @@
 #define TDCR        (0x03E0/4)     // Timer Divide Configuration
 
 volatile uint *lapic;    // Initialized in mp.c
+uint lapickhz;                 // LAPIC timer counts per ms, set by lapiccalibrate
+uint tsckhz;                     // TSC cycles per ms
+uint64 boottsc;                // TSC at calibration, the zero of CLOCK_MONOTONIC
 
 //PAGEBREAK!
 static void
@@ -51,6 +54,49 @@ lapicw(int index, int value)
     lapic[ID];    // wait for write to finish, by reading
 }
 
+// Channel 2 of the 8253/8254 PIT, gated through port 0x61.
+#define PIT_HZ            1193182
+#define PIT_CH2         0x42
+#define PIT_MODE        0x43
+#define PIT_GATE        0x61
+#define CALMS                 10            // calibration interval in ms
+
+// Measure the LAPIC timer and TSC rates against the PIT,
+// whose frequency is fixed, over CALMS milliseconds.
+// Fall back to the old guess of 1 GHz if the PIT never fires.
+static void
+lapiccalibrate(void)
+{
+    uint latch, count, i;
+    uint64 t0, t1;
+
+    latch = PIT_HZ / 1000 * CALMS;
+    outb(PIT_GATE, (inb(PIT_GATE) & ~0x02) | 0x01);    // gate on, speaker off
+    outb(PIT_MODE, 0xB0);        // channel 2, lo/hi byte, mode 0
+    outb(PIT_CH2, latch & 0xFF);
+    outb(PIT_CH2, latch >> 8);
+
+    lapicw(TDCR, X1);
+    lapicw(TIMER, MASKED | (T_IRQ0 + IRQ_TIMER));
+    lapicw(TICR, 0xFFFFFFFF);
+    t0 = rdtsc();
+    for(i = 0; i < 10000000; i++)
+        if(inb(PIT_GATE) & 0x20)    // output high at terminal count
+            break;
+    t1 = rdtsc();
+    count = 0xFFFFFFFF - lapic[TCCR];
+    lapicw(TICR, 0);
+
+    if(i == 10000000 || count == 0){
+        lapickhz = 1000000;
+        tsckhz = 1000000;
+    } else {
+        lapickhz = count / CALMS;
+        tsckhz = (uint)(t1 - t0) / CALMS;
+    }
+    boottsc = t1;
+}
+
 void
 lapicinit(void)
 {
@@ -61,13 +107,15 @@ lapicinit(void)
     // SVR寄存器的第8位控制APIC软件启用/禁用，1为启用，0为禁用
     lapicw(SVR, ENABLE | (T_IRQ0 + IRQ_SPURIOUS));
 
-    // The timer repeatedly counts down at bus frequency
-    // from lapic[TICR] and then issues an interrupt.
-    // If xv6 cared more about precise timekeeping,
-    // TICR would be calibrated using an external time source.
+    // The timer counts down at bus frequency from lapic[TICR]
+    // and then issues an interrupt.    It runs in one-shot mode:
+    // hrtimerintr() re-arms it for the next tick or hrtimer.
+    // The boot cpu calibrates it first.
+    if(lapickhz == 0)
+        lapiccalibrate();
     lapicw(TDCR, X1);
-    lapicw(TIMER, PERIODIC | (T_IRQ0 + IRQ_TIMER));
-    lapicw(TICR, 10000000);
+    lapicw(TIMER, T_IRQ0 + IRQ_TIMER);
+    lapicw(TICR, lapickhz * (1000/HZ));
 
     // Disable logical interrupt lines.
     lapicw(LINT0, MASKED);
@@ -114,6 +162,27 @@ lapiceoi(void)
         lapicw(EOI, 0);
 }
 
+// Interrupt once after count LAPIC timer counts; 0 stops the timer.
+void
+lapiconeshot(uint count)
+{
+    if(!lapic)
+        return;
+    lapicw(TICR, count);
+}
+
+// Send interrupt vector to the cpu with the given APIC ID.
+void
+lapicipi(int apicid, int vector)
+{
+    if(!lapic)
+        return;
+    lapicw(ICRHI, apicid<<24);
+    lapicw(ICRLO, FIXED | ASSERT | vector);
+    while(lapic[ICRLO] & DELIVS)
+        ;
+}
+
 // Spin for a given number of microseconds.
 // On real hardware would want to tune this dynamically.
 void
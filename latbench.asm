@@ -0,0 +1,1559 @@
+
+_latbench:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <spin>:
+
+#define ROUNDS 200
+
+void
+spin(void)
+{
+   0:	55                   	push   %ebp
+   1:	89 e5                	mov    %esp,%ebp
+   3:	83 ec 10             	sub    $0x10,%esp
+    volatile int i;
+
+    for(;;)
+        for(i = 0; i < 1000000; i++)
+   6:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+   d:	eb 09                	jmp    18 <spin+0x18>
+   f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+  12:	83 c0 01             	add    $0x1,%eax
+  15:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  18:	8b 45 fc             	mov    -0x4(%ebp),%eax
+  1b:	3d 3f 42 0f 00       	cmp    $0xf423f,%eax
+  20:	7e ed                	jle    f <spin+0xf>
+  22:	eb e2                	jmp    6 <spin+0x6>
+
+00000024 <main>:
+            ;
+}
+
+int
+main(int argc, char *argv[])
+{
+  24:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+  28:	83 e4 f0             	and    $0xfffffff0,%esp
+  2b:	ff 71 fc             	push   -0x4(%ecx)
+  2e:	55                   	push   %ebp
+  2f:	89 e5                	mov    %esp,%ebp
+  31:	53                   	push   %ebx
+  32:	51                   	push   %ecx
+  33:	81 ec 20 01 00 00    	sub    $0x120,%esp
+  39:	89 cb                	mov    %ecx,%ebx
+    int i, n, nv, pid, t0, late, total, max;
+    int pids[64];
+
+    n = 4;
+  3b:	c7 45 f0 04 00 00 00 	movl   $0x4,-0x10(%ebp)
+    nv = 0;
+  42:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+    if(argc > 1)
+  49:	83 3b 01             	cmpl   $0x1,(%ebx)
+  4c:	7e 17                	jle    65 <main+0x41>
+        n = atoi(argv[1]);
+  4e:	8b 43 04             	mov    0x4(%ebx),%eax
+  51:	83 c0 04             	add    $0x4,%eax
+  54:	8b 00                	mov    (%eax),%eax
+  56:	83 ec 0c             	sub    $0xc,%esp
+  59:	50                   	push   %eax
+  5a:	e8 3e 03 00 00       	call   39d <atoi>
+  5f:	83 c4 10             	add    $0x10,%esp
+  62:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(argc > 2)
+  65:	83 3b 02             	cmpl   $0x2,(%ebx)
+  68:	7e 17                	jle    81 <main+0x5d>
+        nv = atoi(argv[2]);
+  6a:	8b 43 04             	mov    0x4(%ebx),%eax
+  6d:	83 c0 08             	add    $0x8,%eax
+  70:	8b 00                	mov    (%eax),%eax
+  72:	83 ec 0c             	sub    $0xc,%esp
+  75:	50                   	push   %eax
+  76:	e8 22 03 00 00       	call   39d <atoi>
+  7b:	83 c4 10             	add    $0x10,%esp
+  7e:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    if(n > 64)
+  81:	83 7d f0 40          	cmpl   $0x40,-0x10(%ebp)
+  85:	7e 07                	jle    8e <main+0x6a>
+        n = 64;
+  87:	c7 45 f0 40 00 00 00 	movl   $0x40,-0x10(%ebp)
+
+    for(i = 0; i < n; i++){
+  8e:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  95:	eb 58                	jmp    ef <main+0xcb>
+        pid = fork();
+  97:	e8 3f 04 00 00       	call   4db <fork>
+  9c:	89 45 dc             	mov    %eax,-0x24(%ebp)
+        if(pid < 0){
+  9f:	83 7d dc 00          	cmpl   $0x0,-0x24(%ebp)
+  a3:	79 1a                	jns    bf <main+0x9b>
+            printf(2, "latbench: fork failed\n");
+  a5:	83 ec 08             	sub    $0x8,%esp
+  a8:	68 98 0b 00 00       	push   $0xb98
+  ad:	6a 02                	push   $0x2
+  af:	e8 2c 07 00 00       	call   7e0 <printf>
+  b4:	83 c4 10             	add    $0x10,%esp
+            n = i;
+  b7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  ba:	89 45 f0             	mov    %eax,-0x10(%ebp)
+            break;
+  bd:	eb 38                	jmp    f7 <main+0xd3>
+        }
+        if(pid == 0){
+  bf:	83 7d dc 00          	cmpl   $0x0,-0x24(%ebp)
+  c3:	75 19                	jne    de <main+0xba>
+            if(nv > 0)
+  c5:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+  c9:	7e 0e                	jle    d9 <main+0xb5>
+                nice(nv);
+  cb:	83 ec 0c             	sub    $0xc,%esp
+  ce:	ff 75 ec             	push   -0x14(%ebp)
+  d1:	e8 14 03 00 00       	call   3ea <nice>
+  d6:	83 c4 10             	add    $0x10,%esp
+            spin();
+  d9:	e8 22 ff ff ff       	call   0 <spin>
+        }
+        pids[i] = pid;
+  de:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  e1:	8b 55 dc             	mov    -0x24(%ebp),%edx
+  e4:	89 94 85 d8 fe ff ff 	mov    %edx,-0x128(%ebp,%eax,4)
+    for(i = 0; i < n; i++){
+  eb:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+  ef:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  f2:	3b 45 f0             	cmp    -0x10(%ebp),%eax
+  f5:	7c a0                	jl     97 <main+0x73>
+    }
+
+    // Let the spinners use up their slices and sink.
+    sleep(10);
+  f7:	83 ec 0c             	sub    $0xc,%esp
+  fa:	6a 0a                	push   $0xa
+  fc:	e8 8c 04 00 00       	call   58d <sleep>
+ 101:	83 c4 10             	add    $0x10,%esp
+
+    total = max = 0;
+ 104:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%ebp)
+ 10b:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ 10e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    for(i = 0; i < ROUNDS; i++){
+ 111:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 118:	eb 48                	jmp    162 <main+0x13e>
+        t0 = uptime();
+ 11a:	e8 78 04 00 00       	call   597 <uptime>
+ 11f:	89 45 d8             	mov    %eax,-0x28(%ebp)
+        sleep(1);
+ 122:	83 ec 0c             	sub    $0xc,%esp
+ 125:	6a 01                	push   $0x1
+ 127:	e8 61 04 00 00       	call   58d <sleep>
+ 12c:	83 c4 10             	add    $0x10,%esp
+        late = uptime() - t0 - 1;
+ 12f:	e8 63 04 00 00       	call   597 <uptime>
+ 134:	2b 45 d8             	sub    -0x28(%ebp),%eax
+ 137:	83 e8 01             	sub    $0x1,%eax
+ 13a:	89 45 e8             	mov    %eax,-0x18(%ebp)
+        if(late < 0)
+ 13d:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+ 141:	79 07                	jns    14a <main+0x126>
+            late = 0;
+ 143:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+        total += late;
+ 14a:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 14d:	01 45 e4             	add    %eax,-0x1c(%ebp)
+        if(late > max)
+ 150:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 153:	3b 45 e0             	cmp    -0x20(%ebp),%eax
+ 156:	7e 06                	jle    15e <main+0x13a>
+            max = late;
+ 158:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 15b:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    for(i = 0; i < ROUNDS; i++){
+ 15e:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+ 162:	81 7d f4 c7 00 00 00 	cmpl   $0xc7,-0xc(%ebp)
+ 169:	7e af                	jle    11a <main+0xf6>
+    }
+
+    for(i = 0; i < n; i++)
+ 16b:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 172:	eb 1a                	jmp    18e <main+0x16a>
+        kill(pids[i]);
+ 174:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 177:	8b 84 85 d8 fe ff ff 	mov    -0x128(%ebp,%eax,4),%eax
+ 17e:	83 ec 0c             	sub    $0xc,%esp
+ 181:	50                   	push   %eax
+ 182:	e8 8e 03 00 00       	call   515 <kill>
+ 187:	83 c4 10             	add    $0x10,%esp
+    for(i = 0; i < n; i++)
+ 18a:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+ 18e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 191:	3b 45 f0             	cmp    -0x10(%ebp),%eax
+ 194:	7c de                	jl     174 <main+0x150>
+    for(i = 0; i < n; i++)
+ 196:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 19d:	eb 09                	jmp    1a8 <main+0x184>
+        wait();
+ 19f:	e8 45 03 00 00       	call   4e9 <wait>
+    for(i = 0; i < n; i++)
+ 1a4:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+ 1a8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 1ab:	3b 45 f0             	cmp    -0x10(%ebp),%eax
+ 1ae:	7c ef                	jl     19f <main+0x17b>
+
+    printf(1, "latbench: %d spinners nice %d: %d rounds, %d ticks late total, max %d\n",
+ 1b0:	83 ec 04             	sub    $0x4,%esp
+ 1b3:	ff 75 e0             	push   -0x20(%ebp)
+ 1b6:	ff 75 e4             	push   -0x1c(%ebp)
+ 1b9:	68 c8 00 00 00       	push   $0xc8
+ 1be:	ff 75 ec             	push   -0x14(%ebp)
+ 1c1:	ff 75 f0             	push   -0x10(%ebp)
+ 1c4:	68 b0 0b 00 00       	push   $0xbb0
+ 1c9:	6a 01                	push   $0x1
+ 1cb:	e8 10 06 00 00       	call   7e0 <printf>
+ 1d0:	83 c4 20             	add    $0x20,%esp
+        n, nv, ROUNDS, total, max);
+    exit();
+ 1d3:	e8 0a 03 00 00       	call   4e2 <exit>
+
+000001d8 <stosb>:
+strchr(const char *s, char c)
+{
+    for(; *s; s++)
+        if(*s == c)
+            return (char*)s;
+    return 0;
+ 1d8:	55                   	push   %ebp
+ 1d9:	89 e5                	mov    %esp,%ebp
+ 1db:	57                   	push   %edi
+ 1dc:	53                   	push   %ebx
+}
+ 1dd:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 1e0:	8b 55 10             	mov    0x10(%ebp),%edx
+ 1e3:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 1e6:	89 cb                	mov    %ecx,%ebx
+ 1e8:	89 df                	mov    %ebx,%edi
+ 1ea:	89 d1                	mov    %edx,%ecx
+ 1ec:	fc                   	cld
+ 1ed:	f3 aa                	rep stos %al,%es:(%edi)
+ 1ef:	89 ca                	mov    %ecx,%edx
+ 1f1:	89 fb                	mov    %edi,%ebx
+ 1f3:	89 5d 08             	mov    %ebx,0x8(%ebp)
+ 1f6:	89 55 10             	mov    %edx,0x10(%ebp)
+
+char*
+gets(char *buf, int max)
+{
+ 1f9:	90                   	nop
+ 1fa:	5b                   	pop    %ebx
+ 1fb:	5f                   	pop    %edi
+ 1fc:	5d                   	pop    %ebp
+ 1fd:	c3                   	ret
+
+000001fe <strcpy>:
+{
+ 1fe:	55                   	push   %ebp
+ 1ff:	89 e5                	mov    %esp,%ebp
+ 201:	83 ec 10             	sub    $0x10,%esp
+    os = s;
+ 204:	8b 45 08             	mov    0x8(%ebp),%eax
+ 207:	89 45 fc             	mov    %eax,-0x4(%ebp)
+    while((*s++ = *t++) != 0)
+ 20a:	90                   	nop
+ 20b:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 20e:	8d 42 01             	lea    0x1(%edx),%eax
+ 211:	89 45 0c             	mov    %eax,0xc(%ebp)
+ 214:	8b 45 08             	mov    0x8(%ebp),%eax
+ 217:	8d 48 01             	lea    0x1(%eax),%ecx
+ 21a:	89 4d 08             	mov    %ecx,0x8(%ebp)
+ 21d:	0f b6 12             	movzbl (%edx),%edx
+ 220:	88 10                	mov    %dl,(%eax)
+ 222:	0f b6 00             	movzbl (%eax),%eax
+ 225:	84 c0                	test   %al,%al
+ 227:	75 e2                	jne    20b <strcpy+0xd>
+    return os;
+ 229:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 22c:	c9                   	leave
+ 22d:	c3                   	ret
+
+0000022e <strcmp>:
+{
+ 22e:	55                   	push   %ebp
+ 22f:	89 e5                	mov    %esp,%ebp
+    while(*p && *p == *q)
+ 231:	eb 08                	jmp    23b <strcmp+0xd>
+        p++, q++;
+ 233:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 237:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+    while(*p && *p == *q)
+ 23b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 23e:	0f b6 00             	movzbl (%eax),%eax
+ 241:	84 c0                	test   %al,%al
+ 243:	74 10                	je     255 <strcmp+0x27>
+ 245:	8b 45 08             	mov    0x8(%ebp),%eax
+ 248:	0f b6 10             	movzbl (%eax),%edx
+ 24b:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 24e:	0f b6 00             	movzbl (%eax),%eax
+ 251:	38 c2                	cmp    %al,%dl
+ 253:	74 de                	je     233 <strcmp+0x5>
+    return (uchar)*p - (uchar)*q;
+ 255:	8b 45 08             	mov    0x8(%ebp),%eax
+ 258:	0f b6 00             	movzbl (%eax),%eax
+ 25b:	0f b6 d0             	movzbl %al,%edx
+ 25e:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 261:	0f b6 00             	movzbl (%eax),%eax
+ 264:	0f b6 c0             	movzbl %al,%eax
+ 267:	29 c2                	sub    %eax,%edx
+ 269:	89 d0                	mov    %edx,%eax
+}
+ 26b:	5d                   	pop    %ebp
+ 26c:	c3                   	ret
+
+0000026d <strlen>:
+{
+ 26d:	55                   	push   %ebp
+ 26e:	89 e5                	mov    %esp,%ebp
+ 270:	83 ec 10             	sub    $0x10,%esp
+    for(n = 0; s[n]; n++)
+ 273:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ 27a:	eb 04                	jmp    280 <strlen+0x13>
+ 27c:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 280:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 283:	8b 45 08             	mov    0x8(%ebp),%eax
+ 286:	01 d0                	add    %edx,%eax
+ 288:	0f b6 00             	movzbl (%eax),%eax
+ 28b:	84 c0                	test   %al,%al
+ 28d:	75 ed                	jne    27c <strlen+0xf>
+    return n;
+ 28f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 292:	c9                   	leave
+ 293:	c3                   	ret
+
+00000294 <memset>:
+{
+ 294:	55                   	push   %ebp
+ 295:	89 e5                	mov    %esp,%ebp
+    stosb(dst, c, n);
+ 297:	8b 45 10             	mov    0x10(%ebp),%eax
+ 29a:	50                   	push   %eax
+ 29b:	ff 75 0c             	push   0xc(%ebp)
+ 29e:	ff 75 08             	push   0x8(%ebp)
+ 2a1:	e8 32 ff ff ff       	call   1d8 <stosb>
+ 2a6:	83 c4 0c             	add    $0xc,%esp
+    return dst;
+ 2a9:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 2ac:	c9                   	leave
+ 2ad:	c3                   	ret
+
+000002ae <strchr>:
+{
+ 2ae:	55                   	push   %ebp
+ 2af:	89 e5                	mov    %esp,%ebp
+ 2b1:	83 ec 04             	sub    $0x4,%esp
+ 2b4:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 2b7:	88 45 fc             	mov    %al,-0x4(%ebp)
+    for(; *s; s++)
+ 2ba:	eb 14                	jmp    2d0 <strchr+0x22>
+        if(*s == c)
+ 2bc:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2bf:	0f b6 00             	movzbl (%eax),%eax
+ 2c2:	38 45 fc             	cmp    %al,-0x4(%ebp)
+ 2c5:	75 05                	jne    2cc <strchr+0x1e>
+            return (char*)s;
+ 2c7:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2ca:	eb 13                	jmp    2df <strchr+0x31>
+    for(; *s; s++)
+ 2cc:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 2d0:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2d3:	0f b6 00             	movzbl (%eax),%eax
+ 2d6:	84 c0                	test   %al,%al
+ 2d8:	75 e2                	jne    2bc <strchr+0xe>
+    return 0;
+ 2da:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 2df:	c9                   	leave
+ 2e0:	c3                   	ret
+
+000002e1 <gets>:
+{
+ 2e1:	55                   	push   %ebp
+ 2e2:	89 e5                	mov    %esp,%ebp
+ 2e4:	83 ec 18             	sub    $0x18,%esp
+    int i, cc;
+    char c;
+
+    for(i=0; i+1 < max; ){
+ 2e7:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 2ee:	eb 42                	jmp    332 <gets+0x51>
+        cc = read(0, &c, 1);
+ 2f0:	83 ec 04             	sub    $0x4,%esp
+ 2f3:	6a 01                	push   $0x1
+ 2f5:	8d 45 ef             	lea    -0x11(%ebp),%eax
+ 2f8:	50                   	push   %eax
+ 2f9:	6a 00                	push   $0x0
+ 2fb:	e8 f7 01 00 00       	call   4f7 <read>
+ 300:	83 c4 10             	add    $0x10,%esp
+ 303:	89 45 f0             	mov    %eax,-0x10(%ebp)
+        if(cc < 1)
+ 306:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 30a:	7e 33                	jle    33f <gets+0x5e>
+            break;
+        buf[i++] = c;
+ 30c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 30f:	8d 50 01             	lea    0x1(%eax),%edx
+ 312:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 315:	89 c2                	mov    %eax,%edx
+ 317:	8b 45 08             	mov    0x8(%ebp),%eax
+ 31a:	01 c2                	add    %eax,%edx
+ 31c:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 320:	88 02                	mov    %al,(%edx)
+        if(c == '\n' || c == '\r')
+ 322:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 326:	3c 0a                	cmp    $0xa,%al
+ 328:	74 16                	je     340 <gets+0x5f>
+ 32a:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 32e:	3c 0d                	cmp    $0xd,%al
+ 330:	74 0e                	je     340 <gets+0x5f>
+    for(i=0; i+1 < max; ){
+ 332:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 335:	83 c0 01             	add    $0x1,%eax
+ 338:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 33b:	7f b3                	jg     2f0 <gets+0xf>
+ 33d:	eb 01                	jmp    340 <gets+0x5f>
+            break;
+ 33f:	90                   	nop
+            break;
+    }
+    buf[i] = '\0';
+ 340:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 343:	8b 45 08             	mov    0x8(%ebp),%eax
+ 346:	01 d0                	add    %edx,%eax
+ 348:	c6 00 00             	movb   $0x0,(%eax)
+    return buf;
+ 34b:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 34e:	c9                   	leave
+ 34f:	c3                   	ret
+
+00000350 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 350:	55                   	push   %ebp
+ 351:	89 e5                	mov    %esp,%ebp
+ 353:	83 ec 18             	sub    $0x18,%esp
+    int fd;
+    int r;
+
+    fd = open(n, O_RDONLY);
+ 356:	83 ec 08             	sub    $0x8,%esp
+ 359:	6a 00                	push   $0x0
+ 35b:	ff 75 08             	push   0x8(%ebp)
+ 35e:	e8 c6 01 00 00       	call   529 <open>
+ 363:	83 c4 10             	add    $0x10,%esp
+ 366:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(fd < 0)
+ 369:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 36d:	79 07                	jns    376 <stat+0x26>
+        return -1;
+ 36f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 374:	eb 25                	jmp    39b <stat+0x4b>
+    r = fstat(fd, st);
+ 376:	83 ec 08             	sub    $0x8,%esp
+ 379:	ff 75 0c             	push   0xc(%ebp)
+ 37c:	ff 75 f4             	push   -0xc(%ebp)
+ 37f:	e8 c3 01 00 00       	call   547 <fstat>
+ 384:	83 c4 10             	add    $0x10,%esp
+ 387:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    close(fd);
+ 38a:	83 ec 0c             	sub    $0xc,%esp
+ 38d:	ff 75 f4             	push   -0xc(%ebp)
+ 390:	e8 76 01 00 00       	call   50b <close>
+ 395:	83 c4 10             	add    $0x10,%esp
+    return r;
+ 398:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ 39b:	c9                   	leave
+ 39c:	c3                   	ret
+
+0000039d <atoi>:
+
+int
+atoi(const char *s)
+{
+ 39d:	55                   	push   %ebp
+ 39e:	89 e5                	mov    %esp,%ebp
+ 3a0:	83 ec 10             	sub    $0x10,%esp
+    int n;
+
+    n = 0;
+ 3a3:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+    while('0' <= *s && *s <= '9')
+ 3aa:	eb 25                	jmp    3d1 <atoi+0x34>
+        n = n*10 + *s++ - '0';
+ 3ac:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 3af:	89 d0                	mov    %edx,%eax
+ 3b1:	c1 e0 02             	shl    $0x2,%eax
+ 3b4:	01 d0                	add    %edx,%eax
+ 3b6:	01 c0                	add    %eax,%eax
+ 3b8:	89 c1                	mov    %eax,%ecx
+ 3ba:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3bd:	8d 50 01             	lea    0x1(%eax),%edx
+ 3c0:	89 55 08             	mov    %edx,0x8(%ebp)
+ 3c3:	0f b6 00             	movzbl (%eax),%eax
+ 3c6:	0f be c0             	movsbl %al,%eax
+ 3c9:	01 c8                	add    %ecx,%eax
+ 3cb:	83 e8 30             	sub    $0x30,%eax
+ 3ce:	89 45 fc             	mov    %eax,-0x4(%ebp)
+    while('0' <= *s && *s <= '9')
+ 3d1:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3d4:	0f b6 00             	movzbl (%eax),%eax
+ 3d7:	3c 2f                	cmp    $0x2f,%al
+ 3d9:	7e 0a                	jle    3e5 <atoi+0x48>
+ 3db:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3de:	0f b6 00             	movzbl (%eax),%eax
+ 3e1:	3c 39                	cmp    $0x39,%al
+ 3e3:	7e c7                	jle    3ac <atoi+0xf>
+    return n;
+ 3e5:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 3e8:	c9                   	leave
+ 3e9:	c3                   	ret
+
+000003ea <nice>:
+
+// Add inc to the caller's nice value; return the new value.
+int
+nice(int inc)
+{
+ 3ea:	55                   	push   %ebp
+ 3eb:	89 e5                	mov    %esp,%ebp
+ 3ed:	83 ec 18             	sub    $0x18,%esp
+    int n;
+
+    n = getpriority(0) + inc;
+ 3f0:	83 ec 0c             	sub    $0xc,%esp
+ 3f3:	6a 00                	push   $0x0
+ 3f5:	e8 d9 01 00 00       	call   5d3 <getpriority>
+ 3fa:	83 c4 10             	add    $0x10,%esp
+ 3fd:	8b 55 08             	mov    0x8(%ebp),%edx
+ 400:	01 d0                	add    %edx,%eax
+ 402:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(n < 0)
+ 405:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 409:	79 07                	jns    412 <nice+0x28>
+        n = 0;
+ 40b:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    if(n > NICEMAX)
+ 412:	83 7d f4 13          	cmpl   $0x13,-0xc(%ebp)
+ 416:	7e 07                	jle    41f <nice+0x35>
+        n = NICEMAX;
+ 418:	c7 45 f4 13 00 00 00 	movl   $0x13,-0xc(%ebp)
+    if(setpriority(0, n) < 0)
+ 41f:	83 ec 08             	sub    $0x8,%esp
+ 422:	ff 75 f4             	push   -0xc(%ebp)
+ 425:	6a 00                	push   $0x0
+ 427:	e8 b1 01 00 00       	call   5dd <setpriority>
+ 42c:	83 c4 10             	add    $0x10,%esp
+ 42f:	85 c0                	test   %eax,%eax
+ 431:	79 07                	jns    43a <nice+0x50>
+        return -1;
+ 433:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 438:	eb 03                	jmp    43d <nice+0x53>
+    return n;
+ 43a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+ 43d:	c9                   	leave
+ 43e:	c3                   	ret
+
+0000043f <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 43f:	55                   	push   %ebp
+ 440:	89 e5                	mov    %esp,%ebp
+ 442:	83 ec 10             	sub    $0x10,%esp
+    char *dst;
+    const char *src;
+
+    dst = vdst;
+ 445:	8b 45 08             	mov    0x8(%ebp),%eax
+ 448:	89 45 fc             	mov    %eax,-0x4(%ebp)
+    src = vsrc;
+ 44b:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 44e:	89 45 f8             	mov    %eax,-0x8(%ebp)
+    while(n-- > 0)
+ 451:	eb 17                	jmp    46a <memmove+0x2b>
+        *dst++ = *src++;
+ 453:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 456:	8d 42 01             	lea    0x1(%edx),%eax
+ 459:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 45c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 45f:	8d 48 01             	lea    0x1(%eax),%ecx
+ 462:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+ 465:	0f b6 12             	movzbl (%edx),%edx
+ 468:	88 10                	mov    %dl,(%eax)
+    while(n-- > 0)
+ 46a:	8b 45 10             	mov    0x10(%ebp),%eax
+ 46d:	8d 50 ff             	lea    -0x1(%eax),%edx
+ 470:	89 55 10             	mov    %edx,0x10(%ebp)
+ 473:	85 c0                	test   %eax,%eax
+ 475:	7f dc                	jg     453 <memmove+0x14>
+    return vdst;
+ 477:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 47a:	c9                   	leave
+ 47b:	c3                   	ret
+
+0000047c <dosyscall>:
+sysmode:
+    .long 0
+
+    .text
+dosyscall:
+    cmpl $0, sysmode
+ 47c:	83 3d 84 0e 00 00 00 	cmpl   $0x0,0xe84
+    jg 2f
+ 483:	7f 0c                	jg     491 <dosyscall+0x15>
+    jl 1f
+ 485:	7c 07                	jl     48e <dosyscall+0x12>
+    call sepcheck
+ 487:	e8 27 00 00 00       	call   4b3 <sepcheck>
+    jmp dosyscall
+ 48c:	eb ee                	jmp    47c <dosyscall>
+1:
+    int $T_SYSCALL
+ 48e:	cd 40                	int    $0x40
+    ret
+ 490:	c3                   	ret
+2:
+    pushl %ebx
+ 491:	53                   	push   %ebx
+    pushl %esi
+ 492:	56                   	push   %esi
+    pushl %edi
+ 493:	57                   	push   %edi
+    pushl %ebp
+ 494:	55                   	push   %ebp
+    movl 20(%esp), %ebx
+ 495:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+    movl 24(%esp), %esi
+ 499:	8b 74 24 18          	mov    0x18(%esp),%esi
+    movl 28(%esp), %edi
+ 49d:	8b 7c 24 1c          	mov    0x1c(%esp),%edi
+    movl 32(%esp), %ebp
+ 4a1:	8b 6c 24 20          	mov    0x20(%esp),%ebp
+    movl %esp, %ecx
+ 4a5:	89 e1                	mov    %esp,%ecx
+    movl $3f, %edx
+ 4a7:	ba ae 04 00 00       	mov    $0x4ae,%edx
+    sysenter
+ 4ac:	0f 34                	sysenter
+3:
+    popl %ebp
+ 4ae:	5d                   	pop    %ebp
+    popl %edi
+ 4af:	5f                   	pop    %edi
+    popl %esi
+ 4b0:	5e                   	pop    %esi
+    popl %ebx
+ 4b1:	5b                   	pop    %ebx
+    ret
+ 4b2:	c3                   	ret
+
+000004b3 <sepcheck>:
+
+# Set sysmode from cpuid's SEP flag.    Preserves %eax.
+sepcheck:
+    pushl %eax
+ 4b3:	50                   	push   %eax
+    pushl %ebx
+ 4b4:	53                   	push   %ebx
+    movl $1, %eax
+ 4b5:	b8 01 00 00 00       	mov    $0x1,%eax
+    cpuid
+ 4ba:	0f a2                	cpuid
+    movl $-1, sysmode
+ 4bc:	c7 05 84 0e 00 00 ff 	movl   $0xffffffff,0xe84
+ 4c3:	ff ff ff 
+    testl $0x800, %edx
+ 4c6:	f7 c2 00 08 00 00    	test   $0x800,%edx
+    jz 1f
+ 4cc:	74 0a                	je     4d8 <sepcheck+0x25>
+    movl $1, sysmode
+ 4ce:	c7 05 84 0e 00 00 01 	movl   $0x1,0xe84
+ 4d5:	00 00 00 
+1:
+    popl %ebx
+ 4d8:	5b                   	pop    %ebx
+    popl %eax
+ 4d9:	58                   	pop    %eax
+    ret
+ 4da:	c3                   	ret
+
+000004db <fork>:
+
+SYSCALL(fork)
+ 4db:	b8 01 00 00 00       	mov    $0x1,%eax
+ 4e0:	eb 9a                	jmp    47c <dosyscall>
+
+000004e2 <exit>:
+SYSCALL(exit)
+ 4e2:	b8 02 00 00 00       	mov    $0x2,%eax
+ 4e7:	eb 93                	jmp    47c <dosyscall>
+
+000004e9 <wait>:
+SYSCALL(wait)
+ 4e9:	b8 03 00 00 00       	mov    $0x3,%eax
+ 4ee:	eb 8c                	jmp    47c <dosyscall>
+
+000004f0 <pipe>:
+SYSCALL(pipe)
+ 4f0:	b8 04 00 00 00       	mov    $0x4,%eax
+ 4f5:	eb 85                	jmp    47c <dosyscall>
+
+000004f7 <read>:
+SYSCALL(read)
+ 4f7:	b8 05 00 00 00       	mov    $0x5,%eax
+ 4fc:	e9 7b ff ff ff       	jmp    47c <dosyscall>
+
+00000501 <write>:
+SYSCALL(write)
+ 501:	b8 10 00 00 00       	mov    $0x10,%eax
+ 506:	e9 71 ff ff ff       	jmp    47c <dosyscall>
+
+0000050b <close>:
+SYSCALL(close)
+ 50b:	b8 15 00 00 00       	mov    $0x15,%eax
+ 510:	e9 67 ff ff ff       	jmp    47c <dosyscall>
+
+00000515 <kill>:
+SYSCALL(kill)
+ 515:	b8 06 00 00 00       	mov    $0x6,%eax
+ 51a:	e9 5d ff ff ff       	jmp    47c <dosyscall>
+
+0000051f <exec>:
+SYSCALL(exec)
+ 51f:	b8 07 00 00 00       	mov    $0x7,%eax
+ 524:	e9 53 ff ff ff       	jmp    47c <dosyscall>
+
+00000529 <open>:
+SYSCALL(open)
+ 529:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 52e:	e9 49 ff ff ff       	jmp    47c <dosyscall>
+
+00000533 <mknod>:
+SYSCALL(mknod)
+ 533:	b8 11 00 00 00       	mov    $0x11,%eax
+ 538:	e9 3f ff ff ff       	jmp    47c <dosyscall>
+
+0000053d <unlink>:
+SYSCALL(unlink)
+ 53d:	b8 12 00 00 00       	mov    $0x12,%eax
+ 542:	e9 35 ff ff ff       	jmp    47c <dosyscall>
+
+00000547 <fstat>:
+SYSCALL(fstat)
+ 547:	b8 08 00 00 00       	mov    $0x8,%eax
+ 54c:	e9 2b ff ff ff       	jmp    47c <dosyscall>
+
+00000551 <link>:
+SYSCALL(link)
+ 551:	b8 13 00 00 00       	mov    $0x13,%eax
+ 556:	e9 21 ff ff ff       	jmp    47c <dosyscall>
+
+0000055b <mkdir>:
+SYSCALL(mkdir)
+ 55b:	b8 14 00 00 00       	mov    $0x14,%eax
+ 560:	e9 17 ff ff ff       	jmp    47c <dosyscall>
+
+00000565 <chdir>:
+SYSCALL(chdir)
+ 565:	b8 09 00 00 00       	mov    $0x9,%eax
+ 56a:	e9 0d ff ff ff       	jmp    47c <dosyscall>
+
+0000056f <dup>:
+SYSCALL(dup)
+ 56f:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 574:	e9 03 ff ff ff       	jmp    47c <dosyscall>
+
+00000579 <getpid>:
+SYSCALL(getpid)
+ 579:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 57e:	e9 f9 fe ff ff       	jmp    47c <dosyscall>
+
+00000583 <sbrk>:
+SYSCALL(sbrk)
+ 583:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 588:	e9 ef fe ff ff       	jmp    47c <dosyscall>
+
+0000058d <sleep>:
+SYSCALL(sleep)
+ 58d:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 592:	e9 e5 fe ff ff       	jmp    47c <dosyscall>
+
+00000597 <uptime>:
+SYSCALL(uptime)
+ 597:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 59c:	e9 db fe ff ff       	jmp    47c <dosyscall>
+
+000005a1 <date>:
+SYSCALL(date)
+ 5a1:	b8 16 00 00 00       	mov    $0x16,%eax
+ 5a6:	e9 d1 fe ff ff       	jmp    47c <dosyscall>
+
+000005ab <dup2>:
+SYSCALL(dup2)
+ 5ab:	b8 17 00 00 00       	mov    $0x17,%eax
+ 5b0:	e9 c7 fe ff ff       	jmp    47c <dosyscall>
+
+000005b5 <uffd>:
+SYSCALL(uffd)
+ 5b5:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 5ba:	e9 bd fe ff ff       	jmp    47c <dosyscall>
+
+000005bf <uffdregister>:
+SYSCALL(uffdregister)
+ 5bf:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 5c4:	e9 b3 fe ff ff       	jmp    47c <dosyscall>
+
+000005c9 <uffdcopy>:
+SYSCALL(uffdcopy)
+ 5c9:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 5ce:	e9 a9 fe ff ff       	jmp    47c <dosyscall>
+
+000005d3 <getpriority>:
+SYSCALL(getpriority)
+ 5d3:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 5d8:	e9 9f fe ff ff       	jmp    47c <dosyscall>
+
+000005dd <setpriority>:
+SYSCALL(setpriority)
+ 5dd:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 5e2:	e9 95 fe ff ff       	jmp    47c <dosyscall>
+
+000005e7 <setweight>:
+SYSCALL(setweight)
+ 5e7:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 5ec:	e9 8b fe ff ff       	jmp    47c <dosyscall>
+
+000005f1 <setgroup>:
+SYSCALL(setgroup)
+ 5f1:	b8 20 00 00 00       	mov    $0x20,%eax
+ 5f6:	e9 81 fe ff ff       	jmp    47c <dosyscall>
+
+000005fb <schedinfo>:
+SYSCALL(schedinfo)
+ 5fb:	b8 21 00 00 00       	mov    $0x21,%eax
+ 600:	e9 77 fe ff ff       	jmp    47c <dosyscall>
+
+00000605 <nanosleep>:
+SYSCALL(nanosleep)
+ 605:	b8 22 00 00 00       	mov    $0x22,%eax
+ 60a:	e9 6d fe ff ff       	jmp    47c <dosyscall>
+
+0000060f <clock_nanosleep>:
+SYSCALL(clock_nanosleep)
+ 60f:	b8 23 00 00 00       	mov    $0x23,%eax
+ 614:	e9 63 fe ff ff       	jmp    47c <dosyscall>
+
+00000619 <clock_gettime>:
+SYSCALL(clock_gettime)
+ 619:	b8 24 00 00 00       	mov    $0x24,%eax
+ 61e:	e9 59 fe ff ff       	jmp    47c <dosyscall>
+
+00000623 <sched_setaffinity>:
+SYSCALL(sched_setaffinity)
+ 623:	b8 25 00 00 00       	mov    $0x25,%eax
+ 628:	e9 4f fe ff ff       	jmp    47c <dosyscall>
+
+0000062d <sched_getaffinity>:
+SYSCALL(sched_getaffinity)
+ 62d:	b8 26 00 00 00       	mov    $0x26,%eax
+ 632:	e9 45 fe ff ff       	jmp    47c <dosyscall>
+
+00000637 <irqaffinity>:
+SYSCALL(irqaffinity)
+ 637:	b8 27 00 00 00       	mov    $0x27,%eax
+ 63c:	e9 3b fe ff ff       	jmp    47c <dosyscall>
+
+00000641 <getrusage>:
+SYSCALL(getrusage)
+ 641:	b8 28 00 00 00       	mov    $0x28,%eax
+ 646:	e9 31 fe ff ff       	jmp    47c <dosyscall>
+
+0000064b <times>:
+SYSCALL(times)
+ 64b:	b8 29 00 00 00       	mov    $0x29,%eax
+ 650:	e9 27 fe ff ff       	jmp    47c <dosyscall>
+
+00000655 <schedlat>:
+SYSCALL(schedlat)
+ 655:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 65a:	e9 1d fe ff ff       	jmp    47c <dosyscall>
+
+0000065f <sched_setscheduler>:
+SYSCALL(sched_setscheduler)
+ 65f:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 664:	e9 13 fe ff ff       	jmp    47c <dosyscall>
+
+00000669 <sched_getscheduler>:
+SYSCALL(sched_getscheduler)
+ 669:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 66e:	e9 09 fe ff ff       	jmp    47c <dosyscall>
+
+00000673 <sched_getparam>:
+SYSCALL(sched_getparam)
+ 673:	b8 2d 00 00 00       	mov    $0x2d,%eax
+ 678:	e9 ff fd ff ff       	jmp    47c <dosyscall>
+
+0000067d <lockstat>:
+SYSCALL(lockstat)
+ 67d:	b8 2e 00 00 00       	mov    $0x2e,%eax
+ 682:	e9 f5 fd ff ff       	jmp    47c <dosyscall>
+
+00000687 <ioring_setup>:
+SYSCALL(ioring_setup)
+ 687:	b8 2f 00 00 00       	mov    $0x2f,%eax
+ 68c:	e9 eb fd ff ff       	jmp    47c <dosyscall>
+
+00000691 <ioring_enter>:
+SYSCALL(ioring_enter)
+ 691:	b8 30 00 00 00       	mov    $0x30,%eax
+ 696:	e9 e1 fd ff ff       	jmp    47c <dosyscall>
+
+0000069b <readv>:
+SYSCALL(readv)
+ 69b:	b8 31 00 00 00       	mov    $0x31,%eax
+ 6a0:	e9 d7 fd ff ff       	jmp    47c <dosyscall>
+
+000006a5 <writev>:
+SYSCALL(writev)
+ 6a5:	b8 32 00 00 00       	mov    $0x32,%eax
+ 6aa:	e9 cd fd ff ff       	jmp    47c <dosyscall>
+
+000006af <pread>:
+SYSCALL(pread)
+ 6af:	b8 33 00 00 00       	mov    $0x33,%eax
+ 6b4:	e9 c3 fd ff ff       	jmp    47c <dosyscall>
+
+000006b9 <pwrite>:
+SYSCALL(pwrite)
+ 6b9:	b8 34 00 00 00       	mov    $0x34,%eax
+ 6be:	e9 b9 fd ff ff       	jmp    47c <dosyscall>
+
+000006c3 <sendfile>:
+SYSCALL(sendfile)
+ 6c3:	b8 35 00 00 00       	mov    $0x35,%eax
+ 6c8:	e9 af fd ff ff       	jmp    47c <dosyscall>
+
+000006cd <splice>:
+SYSCALL(splice)
+ 6cd:	b8 36 00 00 00       	mov    $0x36,%eax
+ 6d2:	e9 a5 fd ff ff       	jmp    47c <dosyscall>
+
+000006d7 <sysstat>:
+SYSCALL(sysstat)
+ 6d7:	b8 37 00 00 00       	mov    $0x37,%eax
+ 6dc:	e9 9b fd ff ff       	jmp    47c <dosyscall>
+
+000006e1 <strace>:
+SYSCALL(strace)
+ 6e1:	b8 38 00 00 00       	mov    $0x38,%eax
+ 6e6:	e9 91 fd ff ff       	jmp    47c <dosyscall>
+
+000006eb <straceread>:
+SYSCALL(straceread)
+ 6eb:	b8 39 00 00 00       	mov    $0x39,%eax
+ 6f0:	e9 87 fd ff ff       	jmp    47c <dosyscall>
+
+000006f5 <alarm>:
+
+# alarm and rstoregs keep to int $T_SYSCALL: rstoregs restores
+# %ecx and %edx, which sysexit would clobber.
+.globl alarm
+    alarm:
+        pushl $rstoregs
+ 6f5:	68 05 07 00 00       	push   $0x705
+        movl $SYS_alarm, %eax
+ 6fa:	b8 18 00 00 00       	mov    $0x18,%eax
+        int $T_SYSCALL
+ 6ff:	cd 40                	int    $0x40
+        add $0x04, %esp
+ 701:	83 c4 04             	add    $0x4,%esp
+        ret
+ 704:	c3                   	ret
+
+00000705 <rstoregs>:
+
+.globl rstoregs
+    rstoregs:
+        movl $SYS_rstoregs, %eax
+ 705:	b8 19 00 00 00       	mov    $0x19,%eax
+        int $T_SYSCALL
+ 70a:	cd 40                	int    $0x40
+
+0000070c <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 70c:	55                   	push   %ebp
+ 70d:	89 e5                	mov    %esp,%ebp
+ 70f:	83 ec 18             	sub    $0x18,%esp
+ 712:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 715:	88 45 f4             	mov    %al,-0xc(%ebp)
+    write(fd, &c, 1);
+ 718:	83 ec 04             	sub    $0x4,%esp
+ 71b:	6a 01                	push   $0x1
+ 71d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+ 720:	50                   	push   %eax
+ 721:	ff 75 08             	push   0x8(%ebp)
+ 724:	e8 d8 fd ff ff       	call   501 <write>
+ 729:	83 c4 10             	add    $0x10,%esp
+}
+ 72c:	90                   	nop
+ 72d:	c9                   	leave
+ 72e:	c3                   	ret
+
+0000072f <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 72f:	55                   	push   %ebp
+ 730:	89 e5                	mov    %esp,%ebp
+ 732:	83 ec 28             	sub    $0x28,%esp
+    static char digits[] = "0123456789ABCDEF";
+    char buf[16];
+    int i, neg;
+    uint x;
+
+    neg = 0;
+ 735:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+    if(sgn && xx < 0){
+ 73c:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+ 740:	74 17                	je     759 <printint+0x2a>
+ 742:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 746:	79 11                	jns    759 <printint+0x2a>
+        neg = 1;
+ 748:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+        x = -xx;
+ 74f:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 752:	f7 d8                	neg    %eax
+ 754:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 757:	eb 06                	jmp    75f <printint+0x30>
+    } else {
+        x = xx;
+ 759:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 75c:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    }
+
+    i = 0;
+ 75f:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    do{
+        buf[i++] = digits[x % base];
+ 766:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 769:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 76c:	ba 00 00 00 00       	mov    $0x0,%edx
+ 771:	f7 f1                	div    %ecx
+ 773:	89 d1                	mov    %edx,%ecx
+ 775:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 778:	8d 50 01             	lea    0x1(%eax),%edx
+ 77b:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 77e:	0f b6 91 88 0e 00 00 	movzbl 0xe88(%ecx),%edx
+ 785:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+    }while((x /= base) != 0);
+ 789:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 78c:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 78f:	ba 00 00 00 00       	mov    $0x0,%edx
+ 794:	f7 f1                	div    %ecx
+ 796:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 799:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 79d:	75 c7                	jne    766 <printint+0x37>
+    if(neg)
+ 79f:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 7a3:	74 2d                	je     7d2 <printint+0xa3>
+        buf[i++] = '-';
+ 7a5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 7a8:	8d 50 01             	lea    0x1(%eax),%edx
+ 7ab:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 7ae:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+    while(--i >= 0)
+ 7b3:	eb 1d                	jmp    7d2 <printint+0xa3>
+        putc(fd, buf[i]);
+ 7b5:	8d 55 dc             	lea    -0x24(%ebp),%edx
+ 7b8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 7bb:	01 d0                	add    %edx,%eax
+ 7bd:	0f b6 00             	movzbl (%eax),%eax
+ 7c0:	0f be c0             	movsbl %al,%eax
+ 7c3:	83 ec 08             	sub    $0x8,%esp
+ 7c6:	50                   	push   %eax
+ 7c7:	ff 75 08             	push   0x8(%ebp)
+ 7ca:	e8 3d ff ff ff       	call   70c <putc>
+ 7cf:	83 c4 10             	add    $0x10,%esp
+    while(--i >= 0)
+ 7d2:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+ 7d6:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 7da:	79 d9                	jns    7b5 <printint+0x86>
+}
+ 7dc:	90                   	nop
+ 7dd:	90                   	nop
+ 7de:	c9                   	leave
+ 7df:	c3                   	ret
+
+000007e0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 7e0:	55                   	push   %ebp
+ 7e1:	89 e5                	mov    %esp,%ebp
+ 7e3:	83 ec 28             	sub    $0x28,%esp
+    char *s;
+    int c, i, state;
+    uint *ap;
+
+    state = 0;
+ 7e6:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+    ap = (uint*)(void*)&fmt + 1;
+ 7ed:	8d 45 0c             	lea    0xc(%ebp),%eax
+ 7f0:	83 c0 04             	add    $0x4,%eax
+ 7f3:	89 45 e8             	mov    %eax,-0x18(%ebp)
+    for(i = 0; fmt[i]; i++){
+ 7f6:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 7fd:	e9 59 01 00 00       	jmp    95b <printf+0x17b>
+        c = fmt[i] & 0xff;
+ 802:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 805:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 808:	01 d0                	add    %edx,%eax
+ 80a:	0f b6 00             	movzbl (%eax),%eax
+ 80d:	0f be c0             	movsbl %al,%eax
+ 810:	25 ff 00 00 00       	and    $0xff,%eax
+ 815:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        if(state == 0){
+ 818:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 81c:	75 2c                	jne    84a <printf+0x6a>
+            if(c == '%'){
+ 81e:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 822:	75 0c                	jne    830 <printf+0x50>
+                state = '%';
+ 824:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+ 82b:	e9 27 01 00 00       	jmp    957 <printf+0x177>
+            } else {
+                putc(fd, c);
+ 830:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 833:	0f be c0             	movsbl %al,%eax
+ 836:	83 ec 08             	sub    $0x8,%esp
+ 839:	50                   	push   %eax
+ 83a:	ff 75 08             	push   0x8(%ebp)
+ 83d:	e8 ca fe ff ff       	call   70c <putc>
+ 842:	83 c4 10             	add    $0x10,%esp
+ 845:	e9 0d 01 00 00       	jmp    957 <printf+0x177>
+            }
+        } else if(state == '%'){
+ 84a:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+ 84e:	0f 85 03 01 00 00    	jne    957 <printf+0x177>
+            if(c == 'd'){
+ 854:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+ 858:	75 1e                	jne    878 <printf+0x98>
+                printint(fd, *ap, 10, 1);
+ 85a:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 85d:	8b 00                	mov    (%eax),%eax
+ 85f:	6a 01                	push   $0x1
+ 861:	6a 0a                	push   $0xa
+ 863:	50                   	push   %eax
+ 864:	ff 75 08             	push   0x8(%ebp)
+ 867:	e8 c3 fe ff ff       	call   72f <printint>
+ 86c:	83 c4 10             	add    $0x10,%esp
+                ap++;
+ 86f:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 873:	e9 d8 00 00 00       	jmp    950 <printf+0x170>
+            } else if(c == 'x' || c == 'p'){
+ 878:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+ 87c:	74 06                	je     884 <printf+0xa4>
+ 87e:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+ 882:	75 1e                	jne    8a2 <printf+0xc2>
+                printint(fd, *ap, 16, 0);
+ 884:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 887:	8b 00                	mov    (%eax),%eax
+ 889:	6a 00                	push   $0x0
+ 88b:	6a 10                	push   $0x10
+ 88d:	50                   	push   %eax
+ 88e:	ff 75 08             	push   0x8(%ebp)
+ 891:	e8 99 fe ff ff       	call   72f <printint>
+ 896:	83 c4 10             	add    $0x10,%esp
+                ap++;
+ 899:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 89d:	e9 ae 00 00 00       	jmp    950 <printf+0x170>
+            } else if(c == 's'){
+ 8a2:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+ 8a6:	75 43                	jne    8eb <printf+0x10b>
+                s = (char*)*ap;
+ 8a8:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 8ab:	8b 00                	mov    (%eax),%eax
+ 8ad:	89 45 f4             	mov    %eax,-0xc(%ebp)
+                ap++;
+ 8b0:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+                if(s == 0)
+ 8b4:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 8b8:	75 25                	jne    8df <printf+0xff>
+                    s = "(null)";
+ 8ba:	c7 45 f4 f7 0b 00 00 	movl   $0xbf7,-0xc(%ebp)
+                while(*s != 0){
+ 8c1:	eb 1c                	jmp    8df <printf+0xff>
+                    putc(fd, *s);
+ 8c3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 8c6:	0f b6 00             	movzbl (%eax),%eax
+ 8c9:	0f be c0             	movsbl %al,%eax
+ 8cc:	83 ec 08             	sub    $0x8,%esp
+ 8cf:	50                   	push   %eax
+ 8d0:	ff 75 08             	push   0x8(%ebp)
+ 8d3:	e8 34 fe ff ff       	call   70c <putc>
+ 8d8:	83 c4 10             	add    $0x10,%esp
+                    s++;
+ 8db:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+                while(*s != 0){
+ 8df:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 8e2:	0f b6 00             	movzbl (%eax),%eax
+ 8e5:	84 c0                	test   %al,%al
+ 8e7:	75 da                	jne    8c3 <printf+0xe3>
+ 8e9:	eb 65                	jmp    950 <printf+0x170>
+                }
+            } else if(c == 'c'){
+ 8eb:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+ 8ef:	75 1d                	jne    90e <printf+0x12e>
+                putc(fd, *ap);
+ 8f1:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 8f4:	8b 00                	mov    (%eax),%eax
+ 8f6:	0f be c0             	movsbl %al,%eax
+ 8f9:	83 ec 08             	sub    $0x8,%esp
+ 8fc:	50                   	push   %eax
+ 8fd:	ff 75 08             	push   0x8(%ebp)
+ 900:	e8 07 fe ff ff       	call   70c <putc>
+ 905:	83 c4 10             	add    $0x10,%esp
+                ap++;
+ 908:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 90c:	eb 42                	jmp    950 <printf+0x170>
+            } else if(c == '%'){
+ 90e:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 912:	75 17                	jne    92b <printf+0x14b>
+                putc(fd, c);
+ 914:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 917:	0f be c0             	movsbl %al,%eax
+ 91a:	83 ec 08             	sub    $0x8,%esp
+ 91d:	50                   	push   %eax
+ 91e:	ff 75 08             	push   0x8(%ebp)
+ 921:	e8 e6 fd ff ff       	call   70c <putc>
+ 926:	83 c4 10             	add    $0x10,%esp
+ 929:	eb 25                	jmp    950 <printf+0x170>
+            } else {
+                // Unknown % sequence.    Print it to draw attention.
+                putc(fd, '%');
+ 92b:	83 ec 08             	sub    $0x8,%esp
+ 92e:	6a 25                	push   $0x25
+ 930:	ff 75 08             	push   0x8(%ebp)
+ 933:	e8 d4 fd ff ff       	call   70c <putc>
+ 938:	83 c4 10             	add    $0x10,%esp
+                putc(fd, c);
+ 93b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 93e:	0f be c0             	movsbl %al,%eax
+ 941:	83 ec 08             	sub    $0x8,%esp
+ 944:	50                   	push   %eax
+ 945:	ff 75 08             	push   0x8(%ebp)
+ 948:	e8 bf fd ff ff       	call   70c <putc>
+ 94d:	83 c4 10             	add    $0x10,%esp
+            }
+            state = 0;
+ 950:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+    for(i = 0; fmt[i]; i++){
+ 957:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ 95b:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 95e:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 961:	01 d0                	add    %edx,%eax
+ 963:	0f b6 00             	movzbl (%eax),%eax
+ 966:	84 c0                	test   %al,%al
+ 968:	0f 85 94 fe ff ff    	jne    802 <printf+0x22>
+        }
+    }
+}
+ 96e:	90                   	nop
+ 96f:	90                   	nop
+ 970:	c9                   	leave
+ 971:	c3                   	ret
+
+00000972 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 972:	55                   	push   %ebp
+ 973:	89 e5                	mov    %esp,%ebp
+ 975:	83 ec 10             	sub    $0x10,%esp
+    Header *bp, *p;
+
+    bp = (Header*)ap - 1;
+ 978:	8b 45 08             	mov    0x8(%ebp),%eax
+ 97b:	83 e8 08             	sub    $0x8,%eax
+ 97e:	89 45 f8             	mov    %eax,-0x8(%ebp)
+    for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 981:	a1 a4 0e 00 00       	mov    0xea4,%eax
+ 986:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 989:	eb 24                	jmp    9af <free+0x3d>
+        if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 98b:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 98e:	8b 00                	mov    (%eax),%eax
+ 990:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 993:	72 12                	jb     9a7 <free+0x35>
+ 995:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 998:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 99b:	72 24                	jb     9c1 <free+0x4f>
+ 99d:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 9a0:	8b 00                	mov    (%eax),%eax
+ 9a2:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 9a5:	72 1a                	jb     9c1 <free+0x4f>
+    for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 9a7:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 9aa:	8b 00                	mov    (%eax),%eax
+ 9ac:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 9af:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 9b2:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 9b5:	73 d4                	jae    98b <free+0x19>
+ 9b7:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 9ba:	8b 00                	mov    (%eax),%eax
+ 9bc:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 9bf:	73 ca                	jae    98b <free+0x19>
+            break;
+    if(bp + bp->s.size == p->s.ptr){
+ 9c1:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 9c4:	8b 40 04             	mov    0x4(%eax),%eax
+ 9c7:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 9ce:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 9d1:	01 c2                	add    %eax,%edx
+ 9d3:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 9d6:	8b 00                	mov    (%eax),%eax
+ 9d8:	39 c2                	cmp    %eax,%edx
+ 9da:	75 24                	jne    a00 <free+0x8e>
+        bp->s.size += p->s.ptr->s.size;
+ 9dc:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 9df:	8b 50 04             	mov    0x4(%eax),%edx
+ 9e2:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 9e5:	8b 00                	mov    (%eax),%eax
+ 9e7:	8b 40 04             	mov    0x4(%eax),%eax
+ 9ea:	01 c2                	add    %eax,%edx
+ 9ec:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 9ef:	89 50 04             	mov    %edx,0x4(%eax)
+        bp->s.ptr = p->s.ptr->s.ptr;
+ 9f2:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 9f5:	8b 00                	mov    (%eax),%eax
+ 9f7:	8b 10                	mov    (%eax),%edx
+ 9f9:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 9fc:	89 10                	mov    %edx,(%eax)
+ 9fe:	eb 0a                	jmp    a0a <free+0x98>
+    } else
+        bp->s.ptr = p->s.ptr;
+ a00:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a03:	8b 10                	mov    (%eax),%edx
+ a05:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ a08:	89 10                	mov    %edx,(%eax)
+    if(p + p->s.size == bp){
+ a0a:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a0d:	8b 40 04             	mov    0x4(%eax),%eax
+ a10:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ a17:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a1a:	01 d0                	add    %edx,%eax
+ a1c:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ a1f:	75 20                	jne    a41 <free+0xcf>
+        p->s.size += bp->s.size;
+ a21:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a24:	8b 50 04             	mov    0x4(%eax),%edx
+ a27:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ a2a:	8b 40 04             	mov    0x4(%eax),%eax
+ a2d:	01 c2                	add    %eax,%edx
+ a2f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a32:	89 50 04             	mov    %edx,0x4(%eax)
+        p->s.ptr = bp->s.ptr;
+ a35:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ a38:	8b 10                	mov    (%eax),%edx
+ a3a:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a3d:	89 10                	mov    %edx,(%eax)
+ a3f:	eb 08                	jmp    a49 <free+0xd7>
+    } else
+        p->s.ptr = bp;
+ a41:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a44:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ a47:	89 10                	mov    %edx,(%eax)
+    freep = p;
+ a49:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a4c:	a3 a4 0e 00 00       	mov    %eax,0xea4
+}
+ a51:	90                   	nop
+ a52:	c9                   	leave
+ a53:	c3                   	ret
+
+00000a54 <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+ a54:	55                   	push   %ebp
+ a55:	89 e5                	mov    %esp,%ebp
+ a57:	83 ec 18             	sub    $0x18,%esp
+    char *p;
+    Header *hp;
+
+    if(nu < 4096)
+ a5a:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+ a61:	77 07                	ja     a6a <morecore+0x16>
+        nu = 4096;
+ a63:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+    p = sbrk(nu * sizeof(Header));
+ a6a:	8b 45 08             	mov    0x8(%ebp),%eax
+ a6d:	c1 e0 03             	shl    $0x3,%eax
+ a70:	83 ec 0c             	sub    $0xc,%esp
+ a73:	50                   	push   %eax
+ a74:	e8 0a fb ff ff       	call   583 <sbrk>
+ a79:	83 c4 10             	add    $0x10,%esp
+ a7c:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p == (char*)-1)
+ a7f:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+ a83:	75 07                	jne    a8c <morecore+0x38>
+        return 0;
+ a85:	b8 00 00 00 00       	mov    $0x0,%eax
+ a8a:	eb 26                	jmp    ab2 <morecore+0x5e>
+    hp = (Header*)p;
+ a8c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a8f:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    hp->s.size = nu;
+ a92:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ a95:	8b 55 08             	mov    0x8(%ebp),%edx
+ a98:	89 50 04             	mov    %edx,0x4(%eax)
+    free((void*)(hp + 1));
+ a9b:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ a9e:	83 c0 08             	add    $0x8,%eax
+ aa1:	83 ec 0c             	sub    $0xc,%esp
+ aa4:	50                   	push   %eax
+ aa5:	e8 c8 fe ff ff       	call   972 <free>
+ aaa:	83 c4 10             	add    $0x10,%esp
+    return freep;
+ aad:	a1 a4 0e 00 00       	mov    0xea4,%eax
+}
+ ab2:	c9                   	leave
+ ab3:	c3                   	ret
+
+00000ab4 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ ab4:	55                   	push   %ebp
+ ab5:	89 e5                	mov    %esp,%ebp
+ ab7:	83 ec 18             	sub    $0x18,%esp
+    Header *p, *prevp;
+    uint nunits;
+
+    nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ aba:	8b 45 08             	mov    0x8(%ebp),%eax
+ abd:	83 c0 07             	add    $0x7,%eax
+ ac0:	c1 e8 03             	shr    $0x3,%eax
+ ac3:	83 c0 01             	add    $0x1,%eax
+ ac6:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    if((prevp = freep) == 0){
+ ac9:	a1 a4 0e 00 00       	mov    0xea4,%eax
+ ace:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ ad1:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ ad5:	75 23                	jne    afa <malloc+0x46>
+        base.s.ptr = freep = prevp = &base;
+ ad7:	c7 45 f0 9c 0e 00 00 	movl   $0xe9c,-0x10(%ebp)
+ ade:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ ae1:	a3 a4 0e 00 00       	mov    %eax,0xea4
+ ae6:	a1 a4 0e 00 00       	mov    0xea4,%eax
+ aeb:	a3 9c 0e 00 00       	mov    %eax,0xe9c
+        base.s.size = 0;
+ af0:	c7 05 a0 0e 00 00 00 	movl   $0x0,0xea0
+ af7:	00 00 00 
+    }
+    for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ afa:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ afd:	8b 00                	mov    (%eax),%eax
+ aff:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        if(p->s.size >= nunits){
+ b02:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b05:	8b 40 04             	mov    0x4(%eax),%eax
+ b08:	3b 45 ec             	cmp    -0x14(%ebp),%eax
+ b0b:	72 4d                	jb     b5a <malloc+0xa6>
+            if(p->s.size == nunits)
+ b0d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b10:	8b 40 04             	mov    0x4(%eax),%eax
+ b13:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+ b16:	75 0c                	jne    b24 <malloc+0x70>
+                prevp->s.ptr = p->s.ptr;
+ b18:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b1b:	8b 10                	mov    (%eax),%edx
+ b1d:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ b20:	89 10                	mov    %edx,(%eax)
+ b22:	eb 26                	jmp    b4a <malloc+0x96>
+            else {
+                p->s.size -= nunits;
+ b24:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b27:	8b 40 04             	mov    0x4(%eax),%eax
+ b2a:	2b 45 ec             	sub    -0x14(%ebp),%eax
+ b2d:	89 c2                	mov    %eax,%edx
+ b2f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b32:	89 50 04             	mov    %edx,0x4(%eax)
+                p += p->s.size;
+ b35:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b38:	8b 40 04             	mov    0x4(%eax),%eax
+ b3b:	c1 e0 03             	shl    $0x3,%eax
+ b3e:	01 45 f4             	add    %eax,-0xc(%ebp)
+                p->s.size = nunits;
+ b41:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b44:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ b47:	89 50 04             	mov    %edx,0x4(%eax)
+            }
+            freep = prevp;
+ b4a:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ b4d:	a3 a4 0e 00 00       	mov    %eax,0xea4
+            return (void*)(p + 1);
+ b52:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b55:	83 c0 08             	add    $0x8,%eax
+ b58:	eb 3b                	jmp    b95 <malloc+0xe1>
+        }
+        if(p == freep)
+ b5a:	a1 a4 0e 00 00       	mov    0xea4,%eax
+ b5f:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ b62:	75 1e                	jne    b82 <malloc+0xce>
+            if((p = morecore(nunits)) == 0)
+ b64:	83 ec 0c             	sub    $0xc,%esp
+ b67:	ff 75 ec             	push   -0x14(%ebp)
+ b6a:	e8 e5 fe ff ff       	call   a54 <morecore>
+ b6f:	83 c4 10             	add    $0x10,%esp
+ b72:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ b75:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ b79:	75 07                	jne    b82 <malloc+0xce>
+                return 0;
+ b7b:	b8 00 00 00 00       	mov    $0x0,%eax
+ b80:	eb 13                	jmp    b95 <malloc+0xe1>
+    for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ b82:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b85:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ b88:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b8b:	8b 00                	mov    (%eax),%eax
+ b8d:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        if(p->s.size >= nunits){
+ b90:	e9 6d ff ff ff       	jmp    b02 <malloc+0x4e>
+    }
+}
+ b95:	c9                   	leave
+ b96:	c3                   	ret
@@ -0,0 +1,76 @@
+// Interactive latency benchmark: measure how late a process that
+// sleeps for one tick gets back onto a cpu while CPU-bound
+// processes compete for it.
+//
+//    latbench [spinners [nice]]
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+
+#define ROUNDS 200
+
+void
+spin(void)
+{
+    volatile int i;
+
+    for(;;)
+        for(i = 0; i < 1000000; i++)
+            ;
+}
+
+int
+main(int argc, char *argv[])
+{
+    int i, n, nv, pid, t0, late, total, max;
+    int pids[64];
+
+    n = 4;
+    nv = 0;
+    if(argc > 1)
+        n = atoi(argv[1]);
+    if(argc > 2)
+        nv = atoi(argv[2]);
+    if(n > 64)
+        n = 64;
+
+    for(i = 0; i < n; i++){
+        pid = fork();
+        if(pid < 0){
+            printf(2, "latbench: fork failed\n");
+            n = i;
+            break;
+        }
+        if(pid == 0){
+            if(nv > 0)
+                nice(nv);
+            spin();
+        }
+        pids[i] = pid;
+    }
+
+    // Let the spinners use up their slices and sink.
+    sleep(10);
+
+    total = max = 0;
+    for(i = 0; i < ROUNDS; i++){
+        t0 = uptime();
+        sleep(1);
+        late = uptime() - t0 - 1;
+        if(late < 0)
+            late = 0;
+        total += late;
+        if(late > max)
+            max = late;
+    }
+
+    for(i = 0; i < n; i++)
+        kill(pids[i]);
+    for(i = 0; i < n; i++)
+        wait();
+
+    printf(1, "latbench: %d spinners nice %d: %d rounds, %d ticks late total, max %d\n",
+        n, nv, ROUNDS, total, max);
+    exit();
+}
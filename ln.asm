@@ -0,0 +1,1404 @@
+
+_ln:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "stat.h"
+#include "user.h"
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	53                   	push   %ebx
+   e:	51                   	push   %ecx
+   f:	89 cb                	mov    %ecx,%ebx
+    if(argc != 3){
+  11:	83 3b 03             	cmpl   $0x3,(%ebx)
+  14:	74 17                	je     2d <main+0x2d>
+        printf(2, "Usage: ln old new\n");
+  16:	83 ec 08             	sub    $0x8,%esp
+  19:	68 33 0a 00 00       	push   $0xa33
+  1e:	6a 02                	push   $0x2
+  20:	e8 57 06 00 00       	call   67c <printf>
+  25:	83 c4 10             	add    $0x10,%esp
+        exit();
+  28:	e8 51 03 00 00       	call   37e <exit>
+    }
+    if(link(argv[1], argv[2]) < 0)
+  2d:	8b 43 04             	mov    0x4(%ebx),%eax
+  30:	83 c0 08             	add    $0x8,%eax
+  33:	8b 10                	mov    (%eax),%edx
+  35:	8b 43 04             	mov    0x4(%ebx),%eax
+  38:	83 c0 04             	add    $0x4,%eax
+  3b:	8b 00                	mov    (%eax),%eax
+  3d:	83 ec 08             	sub    $0x8,%esp
+  40:	52                   	push   %edx
+  41:	50                   	push   %eax
+  42:	e8 a6 03 00 00       	call   3ed <link>
+  47:	83 c4 10             	add    $0x10,%esp
+  4a:	85 c0                	test   %eax,%eax
+  4c:	79 21                	jns    6f <main+0x6f>
+        printf(2, "link %s %s: failed\n", argv[1], argv[2]);
+  4e:	8b 43 04             	mov    0x4(%ebx),%eax
+  51:	83 c0 08             	add    $0x8,%eax
+  54:	8b 10                	mov    (%eax),%edx
+  56:	8b 43 04             	mov    0x4(%ebx),%eax
+  59:	83 c0 04             	add    $0x4,%eax
+  5c:	8b 00                	mov    (%eax),%eax
+  5e:	52                   	push   %edx
+  5f:	50                   	push   %eax
+  60:	68 46 0a 00 00       	push   $0xa46
+  65:	6a 02                	push   $0x2
+  67:	e8 10 06 00 00       	call   67c <printf>
+  6c:	83 c4 10             	add    $0x10,%esp
+    exit();
+  6f:	e8 0a 03 00 00       	call   37e <exit>
+
+00000074 <stosb>:
+strchr(const char *s, char c)
+{
+    for(; *s; s++)
+        if(*s == c)
+            return (char*)s;
+    return 0;
+  74:	55                   	push   %ebp
+  75:	89 e5                	mov    %esp,%ebp
+  77:	57                   	push   %edi
+  78:	53                   	push   %ebx
+}
+  79:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  7c:	8b 55 10             	mov    0x10(%ebp),%edx
+  7f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  82:	89 cb                	mov    %ecx,%ebx
+  84:	89 df                	mov    %ebx,%edi
+  86:	89 d1                	mov    %edx,%ecx
+  88:	fc                   	cld
+  89:	f3 aa                	rep stos %al,%es:(%edi)
+  8b:	89 ca                	mov    %ecx,%edx
+  8d:	89 fb                	mov    %edi,%ebx
+  8f:	89 5d 08             	mov    %ebx,0x8(%ebp)
+  92:	89 55 10             	mov    %edx,0x10(%ebp)
+
+char*
+gets(char *buf, int max)
+{
+  95:	90                   	nop
+  96:	5b                   	pop    %ebx
+  97:	5f                   	pop    %edi
+  98:	5d                   	pop    %ebp
+  99:	c3                   	ret
+
+0000009a <strcpy>:
+{
+  9a:	55                   	push   %ebp
+  9b:	89 e5                	mov    %esp,%ebp
+  9d:	83 ec 10             	sub    $0x10,%esp
+    os = s;
+  a0:	8b 45 08             	mov    0x8(%ebp),%eax
+  a3:	89 45 fc             	mov    %eax,-0x4(%ebp)
+    while((*s++ = *t++) != 0)
+  a6:	90                   	nop
+  a7:	8b 55 0c             	mov    0xc(%ebp),%edx
+  aa:	8d 42 01             	lea    0x1(%edx),%eax
+  ad:	89 45 0c             	mov    %eax,0xc(%ebp)
+  b0:	8b 45 08             	mov    0x8(%ebp),%eax
+  b3:	8d 48 01             	lea    0x1(%eax),%ecx
+  b6:	89 4d 08             	mov    %ecx,0x8(%ebp)
+  b9:	0f b6 12             	movzbl (%edx),%edx
+  bc:	88 10                	mov    %dl,(%eax)
+  be:	0f b6 00             	movzbl (%eax),%eax
+  c1:	84 c0                	test   %al,%al
+  c3:	75 e2                	jne    a7 <strcpy+0xd>
+    return os;
+  c5:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+  c8:	c9                   	leave
+  c9:	c3                   	ret
+
+000000ca <strcmp>:
+{
+  ca:	55                   	push   %ebp
+  cb:	89 e5                	mov    %esp,%ebp
+    while(*p && *p == *q)
+  cd:	eb 08                	jmp    d7 <strcmp+0xd>
+        p++, q++;
+  cf:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+  d3:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+    while(*p && *p == *q)
+  d7:	8b 45 08             	mov    0x8(%ebp),%eax
+  da:	0f b6 00             	movzbl (%eax),%eax
+  dd:	84 c0                	test   %al,%al
+  df:	74 10                	je     f1 <strcmp+0x27>
+  e1:	8b 45 08             	mov    0x8(%ebp),%eax
+  e4:	0f b6 10             	movzbl (%eax),%edx
+  e7:	8b 45 0c             	mov    0xc(%ebp),%eax
+  ea:	0f b6 00             	movzbl (%eax),%eax
+  ed:	38 c2                	cmp    %al,%dl
+  ef:	74 de                	je     cf <strcmp+0x5>
+    return (uchar)*p - (uchar)*q;
+  f1:	8b 45 08             	mov    0x8(%ebp),%eax
+  f4:	0f b6 00             	movzbl (%eax),%eax
+  f7:	0f b6 d0             	movzbl %al,%edx
+  fa:	8b 45 0c             	mov    0xc(%ebp),%eax
+  fd:	0f b6 00             	movzbl (%eax),%eax
+ 100:	0f b6 c0             	movzbl %al,%eax
+ 103:	29 c2                	sub    %eax,%edx
+ 105:	89 d0                	mov    %edx,%eax
+}
+ 107:	5d                   	pop    %ebp
+ 108:	c3                   	ret
+
+00000109 <strlen>:
+{
+ 109:	55                   	push   %ebp
+ 10a:	89 e5                	mov    %esp,%ebp
+ 10c:	83 ec 10             	sub    $0x10,%esp
+    for(n = 0; s[n]; n++)
+ 10f:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ 116:	eb 04                	jmp    11c <strlen+0x13>
+ 118:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 11c:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 11f:	8b 45 08             	mov    0x8(%ebp),%eax
+ 122:	01 d0                	add    %edx,%eax
+ 124:	0f b6 00             	movzbl (%eax),%eax
+ 127:	84 c0                	test   %al,%al
+ 129:	75 ed                	jne    118 <strlen+0xf>
+    return n;
+ 12b:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 12e:	c9                   	leave
+ 12f:	c3                   	ret
+
+00000130 <memset>:
+{
+ 130:	55                   	push   %ebp
+ 131:	89 e5                	mov    %esp,%ebp
+    stosb(dst, c, n);
+ 133:	8b 45 10             	mov    0x10(%ebp),%eax
+ 136:	50                   	push   %eax
+ 137:	ff 75 0c             	push   0xc(%ebp)
+ 13a:	ff 75 08             	push   0x8(%ebp)
+ 13d:	e8 32 ff ff ff       	call   74 <stosb>
+ 142:	83 c4 0c             	add    $0xc,%esp
+    return dst;
+ 145:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 148:	c9                   	leave
+ 149:	c3                   	ret
+
+0000014a <strchr>:
+{
+ 14a:	55                   	push   %ebp
+ 14b:	89 e5                	mov    %esp,%ebp
+ 14d:	83 ec 04             	sub    $0x4,%esp
+ 150:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 153:	88 45 fc             	mov    %al,-0x4(%ebp)
+    for(; *s; s++)
+ 156:	eb 14                	jmp    16c <strchr+0x22>
+        if(*s == c)
+ 158:	8b 45 08             	mov    0x8(%ebp),%eax
+ 15b:	0f b6 00             	movzbl (%eax),%eax
+ 15e:	38 45 fc             	cmp    %al,-0x4(%ebp)
+ 161:	75 05                	jne    168 <strchr+0x1e>
+            return (char*)s;
+ 163:	8b 45 08             	mov    0x8(%ebp),%eax
+ 166:	eb 13                	jmp    17b <strchr+0x31>
+    for(; *s; s++)
+ 168:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 16c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 16f:	0f b6 00             	movzbl (%eax),%eax
+ 172:	84 c0                	test   %al,%al
+ 174:	75 e2                	jne    158 <strchr+0xe>
+    return 0;
+ 176:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 17b:	c9                   	leave
+ 17c:	c3                   	ret
+
+0000017d <gets>:
+{
+ 17d:	55                   	push   %ebp
+ 17e:	89 e5                	mov    %esp,%ebp
+ 180:	83 ec 18             	sub    $0x18,%esp
+    int i, cc;
+    char c;
+
+    for(i=0; i+1 < max; ){
+ 183:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 18a:	eb 42                	jmp    1ce <gets+0x51>
+        cc = read(0, &c, 1);
+ 18c:	83 ec 04             	sub    $0x4,%esp
+ 18f:	6a 01                	push   $0x1
+ 191:	8d 45 ef             	lea    -0x11(%ebp),%eax
+ 194:	50                   	push   %eax
+ 195:	6a 00                	push   $0x0
+ 197:	e8 f7 01 00 00       	call   393 <read>
+ 19c:	83 c4 10             	add    $0x10,%esp
+ 19f:	89 45 f0             	mov    %eax,-0x10(%ebp)
+        if(cc < 1)
+ 1a2:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 1a6:	7e 33                	jle    1db <gets+0x5e>
+            break;
+        buf[i++] = c;
+ 1a8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 1ab:	8d 50 01             	lea    0x1(%eax),%edx
+ 1ae:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 1b1:	89 c2                	mov    %eax,%edx
+ 1b3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1b6:	01 c2                	add    %eax,%edx
+ 1b8:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 1bc:	88 02                	mov    %al,(%edx)
+        if(c == '\n' || c == '\r')
+ 1be:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 1c2:	3c 0a                	cmp    $0xa,%al
+ 1c4:	74 16                	je     1dc <gets+0x5f>
+ 1c6:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 1ca:	3c 0d                	cmp    $0xd,%al
+ 1cc:	74 0e                	je     1dc <gets+0x5f>
+    for(i=0; i+1 < max; ){
+ 1ce:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 1d1:	83 c0 01             	add    $0x1,%eax
+ 1d4:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 1d7:	7f b3                	jg     18c <gets+0xf>
+ 1d9:	eb 01                	jmp    1dc <gets+0x5f>
+            break;
+ 1db:	90                   	nop
+            break;
+    }
+    buf[i] = '\0';
+ 1dc:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 1df:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1e2:	01 d0                	add    %edx,%eax
+ 1e4:	c6 00 00             	movb   $0x0,(%eax)
+    return buf;
+ 1e7:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 1ea:	c9                   	leave
+ 1eb:	c3                   	ret
+
+000001ec <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 1ec:	55                   	push   %ebp
+ 1ed:	89 e5                	mov    %esp,%ebp
+ 1ef:	83 ec 18             	sub    $0x18,%esp
+    int fd;
+    int r;
+
+    fd = open(n, O_RDONLY);
+ 1f2:	83 ec 08             	sub    $0x8,%esp
+ 1f5:	6a 00                	push   $0x0
+ 1f7:	ff 75 08             	push   0x8(%ebp)
+ 1fa:	e8 c6 01 00 00       	call   3c5 <open>
+ 1ff:	83 c4 10             	add    $0x10,%esp
+ 202:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(fd < 0)
+ 205:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 209:	79 07                	jns    212 <stat+0x26>
+        return -1;
+ 20b:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 210:	eb 25                	jmp    237 <stat+0x4b>
+    r = fstat(fd, st);
+ 212:	83 ec 08             	sub    $0x8,%esp
+ 215:	ff 75 0c             	push   0xc(%ebp)
+ 218:	ff 75 f4             	push   -0xc(%ebp)
+ 21b:	e8 c3 01 00 00       	call   3e3 <fstat>
+ 220:	83 c4 10             	add    $0x10,%esp
+ 223:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    close(fd);
+ 226:	83 ec 0c             	sub    $0xc,%esp
+ 229:	ff 75 f4             	push   -0xc(%ebp)
+ 22c:	e8 76 01 00 00       	call   3a7 <close>
+ 231:	83 c4 10             	add    $0x10,%esp
+    return r;
+ 234:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ 237:	c9                   	leave
+ 238:	c3                   	ret
+
+00000239 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 239:	55                   	push   %ebp
+ 23a:	89 e5                	mov    %esp,%ebp
+ 23c:	83 ec 10             	sub    $0x10,%esp
+    int n;
+
+    n = 0;
+ 23f:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+    while('0' <= *s && *s <= '9')
+ 246:	eb 25                	jmp    26d <atoi+0x34>
+        n = n*10 + *s++ - '0';
+ 248:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 24b:	89 d0                	mov    %edx,%eax
+ 24d:	c1 e0 02             	shl    $0x2,%eax
+ 250:	01 d0                	add    %edx,%eax
+ 252:	01 c0                	add    %eax,%eax
+ 254:	89 c1                	mov    %eax,%ecx
+ 256:	8b 45 08             	mov    0x8(%ebp),%eax
+ 259:	8d 50 01             	lea    0x1(%eax),%edx
+ 25c:	89 55 08             	mov    %edx,0x8(%ebp)
+ 25f:	0f b6 00             	movzbl (%eax),%eax
+ 262:	0f be c0             	movsbl %al,%eax
+ 265:	01 c8                	add    %ecx,%eax
+ 267:	83 e8 30             	sub    $0x30,%eax
+ 26a:	89 45 fc             	mov    %eax,-0x4(%ebp)
+    while('0' <= *s && *s <= '9')
+ 26d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 270:	0f b6 00             	movzbl (%eax),%eax
+ 273:	3c 2f                	cmp    $0x2f,%al
+ 275:	7e 0a                	jle    281 <atoi+0x48>
+ 277:	8b 45 08             	mov    0x8(%ebp),%eax
+ 27a:	0f b6 00             	movzbl (%eax),%eax
+ 27d:	3c 39                	cmp    $0x39,%al
+ 27f:	7e c7                	jle    248 <atoi+0xf>
+    return n;
+ 281:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 284:	c9                   	leave
+ 285:	c3                   	ret
+
+00000286 <nice>:
+
+// Add inc to the caller's nice value; return the new value.
+int
+nice(int inc)
+{
+ 286:	55                   	push   %ebp
+ 287:	89 e5                	mov    %esp,%ebp
+ 289:	83 ec 18             	sub    $0x18,%esp
+    int n;
+
+    n = getpriority(0) + inc;
+ 28c:	83 ec 0c             	sub    $0xc,%esp
+ 28f:	6a 00                	push   $0x0
+ 291:	e8 d9 01 00 00       	call   46f <getpriority>
+ 296:	83 c4 10             	add    $0x10,%esp
+ 299:	8b 55 08             	mov    0x8(%ebp),%edx
+ 29c:	01 d0                	add    %edx,%eax
+ 29e:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(n < 0)
+ 2a1:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 2a5:	79 07                	jns    2ae <nice+0x28>
+        n = 0;
+ 2a7:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    if(n > NICEMAX)
+ 2ae:	83 7d f4 13          	cmpl   $0x13,-0xc(%ebp)
+ 2b2:	7e 07                	jle    2bb <nice+0x35>
+        n = NICEMAX;
+ 2b4:	c7 45 f4 13 00 00 00 	movl   $0x13,-0xc(%ebp)
+    if(setpriority(0, n) < 0)
+ 2bb:	83 ec 08             	sub    $0x8,%esp
+ 2be:	ff 75 f4             	push   -0xc(%ebp)
+ 2c1:	6a 00                	push   $0x0
+ 2c3:	e8 b1 01 00 00       	call   479 <setpriority>
+ 2c8:	83 c4 10             	add    $0x10,%esp
+ 2cb:	85 c0                	test   %eax,%eax
+ 2cd:	79 07                	jns    2d6 <nice+0x50>
+        return -1;
+ 2cf:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 2d4:	eb 03                	jmp    2d9 <nice+0x53>
+    return n;
+ 2d6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+ 2d9:	c9                   	leave
+ 2da:	c3                   	ret
+
+000002db <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 2db:	55                   	push   %ebp
+ 2dc:	89 e5                	mov    %esp,%ebp
+ 2de:	83 ec 10             	sub    $0x10,%esp
+    char *dst;
+    const char *src;
+
+    dst = vdst;
+ 2e1:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2e4:	89 45 fc             	mov    %eax,-0x4(%ebp)
+    src = vsrc;
+ 2e7:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 2ea:	89 45 f8             	mov    %eax,-0x8(%ebp)
+    while(n-- > 0)
+ 2ed:	eb 17                	jmp    306 <memmove+0x2b>
+        *dst++ = *src++;
+ 2ef:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 2f2:	8d 42 01             	lea    0x1(%edx),%eax
+ 2f5:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 2f8:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 2fb:	8d 48 01             	lea    0x1(%eax),%ecx
+ 2fe:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+ 301:	0f b6 12             	movzbl (%edx),%edx
+ 304:	88 10                	mov    %dl,(%eax)
+    while(n-- > 0)
+ 306:	8b 45 10             	mov    0x10(%ebp),%eax
+ 309:	8d 50 ff             	lea    -0x1(%eax),%edx
+ 30c:	89 55 10             	mov    %edx,0x10(%ebp)
+ 30f:	85 c0                	test   %eax,%eax
+ 311:	7f dc                	jg     2ef <memmove+0x14>
+    return vdst;
+ 313:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 316:	c9                   	leave
+ 317:	c3                   	ret
+
+00000318 <dosyscall>:
+sysmode:
+    .long 0
+
+    .text
+dosyscall:
+    cmpl $0, sysmode
+ 318:	83 3d cc 0c 00 00 00 	cmpl   $0x0,0xccc
+    jg 2f
+ 31f:	7f 0c                	jg     32d <dosyscall+0x15>
+    jl 1f
+ 321:	7c 07                	jl     32a <dosyscall+0x12>
+    call sepcheck
+ 323:	e8 27 00 00 00       	call   34f <sepcheck>
+    jmp dosyscall
+ 328:	eb ee                	jmp    318 <dosyscall>
+1:
+    int $T_SYSCALL
+ 32a:	cd 40                	int    $0x40
+    ret
+ 32c:	c3                   	ret
+2:
+    pushl %ebx
+ 32d:	53                   	push   %ebx
+    pushl %esi
+ 32e:	56                   	push   %esi
+    pushl %edi
+ 32f:	57                   	push   %edi
+    pushl %ebp
+ 330:	55                   	push   %ebp
+    movl 20(%esp), %ebx
+ 331:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+    movl 24(%esp), %esi
+ 335:	8b 74 24 18          	mov    0x18(%esp),%esi
+    movl 28(%esp), %edi
+ 339:	8b 7c 24 1c          	mov    0x1c(%esp),%edi
+    movl 32(%esp), %ebp
+ 33d:	8b 6c 24 20          	mov    0x20(%esp),%ebp
+    movl %esp, %ecx
+ 341:	89 e1                	mov    %esp,%ecx
+    movl $3f, %edx
+ 343:	ba 4a 03 00 00       	mov    $0x34a,%edx
+    sysenter
+ 348:	0f 34                	sysenter
+3:
+    popl %ebp
+ 34a:	5d                   	pop    %ebp
+    popl %edi
+ 34b:	5f                   	pop    %edi
+    popl %esi
+ 34c:	5e                   	pop    %esi
+    popl %ebx
+ 34d:	5b                   	pop    %ebx
+    ret
+ 34e:	c3                   	ret
+
+0000034f <sepcheck>:
+
+# Set sysmode from cpuid's SEP flag.    Preserves %eax.
+sepcheck:
+    pushl %eax
+ 34f:	50                   	push   %eax
+    pushl %ebx
+ 350:	53                   	push   %ebx
+    movl $1, %eax
+ 351:	b8 01 00 00 00       	mov    $0x1,%eax
+    cpuid
+ 356:	0f a2                	cpuid
+    movl $-1, sysmode
+ 358:	c7 05 cc 0c 00 00 ff 	movl   $0xffffffff,0xccc
+ 35f:	ff ff ff 
+    testl $0x800, %edx
+ 362:	f7 c2 00 08 00 00    	test   $0x800,%edx
+    jz 1f
+ 368:	74 0a                	je     374 <sepcheck+0x25>
+    movl $1, sysmode
+ 36a:	c7 05 cc 0c 00 00 01 	movl   $0x1,0xccc
+ 371:	00 00 00 
+1:
+    popl %ebx
+ 374:	5b                   	pop    %ebx
+    popl %eax
+ 375:	58                   	pop    %eax
+    ret
+ 376:	c3                   	ret
+
+00000377 <fork>:
+
+SYSCALL(fork)
+ 377:	b8 01 00 00 00       	mov    $0x1,%eax
+ 37c:	eb 9a                	jmp    318 <dosyscall>
+
+0000037e <exit>:
+SYSCALL(exit)
+ 37e:	b8 02 00 00 00       	mov    $0x2,%eax
+ 383:	eb 93                	jmp    318 <dosyscall>
+
+00000385 <wait>:
+SYSCALL(wait)
+ 385:	b8 03 00 00 00       	mov    $0x3,%eax
+ 38a:	eb 8c                	jmp    318 <dosyscall>
+
+0000038c <pipe>:
+SYSCALL(pipe)
+ 38c:	b8 04 00 00 00       	mov    $0x4,%eax
+ 391:	eb 85                	jmp    318 <dosyscall>
+
+00000393 <read>:
+SYSCALL(read)
+ 393:	b8 05 00 00 00       	mov    $0x5,%eax
+ 398:	e9 7b ff ff ff       	jmp    318 <dosyscall>
+
+0000039d <write>:
+SYSCALL(write)
+ 39d:	b8 10 00 00 00       	mov    $0x10,%eax
+ 3a2:	e9 71 ff ff ff       	jmp    318 <dosyscall>
+
+000003a7 <close>:
+SYSCALL(close)
+ 3a7:	b8 15 00 00 00       	mov    $0x15,%eax
+ 3ac:	e9 67 ff ff ff       	jmp    318 <dosyscall>
+
+000003b1 <kill>:
+SYSCALL(kill)
+ 3b1:	b8 06 00 00 00       	mov    $0x6,%eax
+ 3b6:	e9 5d ff ff ff       	jmp    318 <dosyscall>
+
+000003bb <exec>:
+SYSCALL(exec)
+ 3bb:	b8 07 00 00 00       	mov    $0x7,%eax
+ 3c0:	e9 53 ff ff ff       	jmp    318 <dosyscall>
+
+000003c5 <open>:
+SYSCALL(open)
+ 3c5:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 3ca:	e9 49 ff ff ff       	jmp    318 <dosyscall>
+
+000003cf <mknod>:
+SYSCALL(mknod)
+ 3cf:	b8 11 00 00 00       	mov    $0x11,%eax
+ 3d4:	e9 3f ff ff ff       	jmp    318 <dosyscall>
+
+000003d9 <unlink>:
+SYSCALL(unlink)
+ 3d9:	b8 12 00 00 00       	mov    $0x12,%eax
+ 3de:	e9 35 ff ff ff       	jmp    318 <dosyscall>
+
+000003e3 <fstat>:
+SYSCALL(fstat)
+ 3e3:	b8 08 00 00 00       	mov    $0x8,%eax
+ 3e8:	e9 2b ff ff ff       	jmp    318 <dosyscall>
+
+000003ed <link>:
+SYSCALL(link)
+ 3ed:	b8 13 00 00 00       	mov    $0x13,%eax
+ 3f2:	e9 21 ff ff ff       	jmp    318 <dosyscall>
+
+000003f7 <mkdir>:
+SYSCALL(mkdir)
+ 3f7:	b8 14 00 00 00       	mov    $0x14,%eax
+ 3fc:	e9 17 ff ff ff       	jmp    318 <dosyscall>
+
+00000401 <chdir>:
+SYSCALL(chdir)
+ 401:	b8 09 00 00 00       	mov    $0x9,%eax
+ 406:	e9 0d ff ff ff       	jmp    318 <dosyscall>
+
+0000040b <dup>:
+SYSCALL(dup)
+ 40b:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 410:	e9 03 ff ff ff       	jmp    318 <dosyscall>
+
+00000415 <getpid>:
+SYSCALL(getpid)
+ 415:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 41a:	e9 f9 fe ff ff       	jmp    318 <dosyscall>
+
+0000041f <sbrk>:
+SYSCALL(sbrk)
+ 41f:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 424:	e9 ef fe ff ff       	jmp    318 <dosyscall>
+
+00000429 <sleep>:
+SYSCALL(sleep)
+ 429:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 42e:	e9 e5 fe ff ff       	jmp    318 <dosyscall>
+
+00000433 <uptime>:
+SYSCALL(uptime)
+ 433:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 438:	e9 db fe ff ff       	jmp    318 <dosyscall>
+
+0000043d <date>:
+SYSCALL(date)
+ 43d:	b8 16 00 00 00       	mov    $0x16,%eax
+ 442:	e9 d1 fe ff ff       	jmp    318 <dosyscall>
+
+00000447 <dup2>:
+SYSCALL(dup2)
+ 447:	b8 17 00 00 00       	mov    $0x17,%eax
+ 44c:	e9 c7 fe ff ff       	jmp    318 <dosyscall>
+
+00000451 <uffd>:
+SYSCALL(uffd)
+ 451:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 456:	e9 bd fe ff ff       	jmp    318 <dosyscall>
+
+0000045b <uffdregister>:
+SYSCALL(uffdregister)
+ 45b:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 460:	e9 b3 fe ff ff       	jmp    318 <dosyscall>
+
+00000465 <uffdcopy>:
+SYSCALL(uffdcopy)
+ 465:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 46a:	e9 a9 fe ff ff       	jmp    318 <dosyscall>
+
+0000046f <getpriority>:
+SYSCALL(getpriority)
+ 46f:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 474:	e9 9f fe ff ff       	jmp    318 <dosyscall>
+
+00000479 <setpriority>:
+SYSCALL(setpriority)
+ 479:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 47e:	e9 95 fe ff ff       	jmp    318 <dosyscall>
+
+00000483 <setweight>:
+SYSCALL(setweight)
+ 483:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 488:	e9 8b fe ff ff       	jmp    318 <dosyscall>
+
+0000048d <setgroup>:
+SYSCALL(setgroup)
+ 48d:	b8 20 00 00 00       	mov    $0x20,%eax
+ 492:	e9 81 fe ff ff       	jmp    318 <dosyscall>
+
+00000497 <schedinfo>:
+SYSCALL(schedinfo)
+ 497:	b8 21 00 00 00       	mov    $0x21,%eax
+ 49c:	e9 77 fe ff ff       	jmp    318 <dosyscall>
+
+000004a1 <nanosleep>:
+SYSCALL(nanosleep)
+ 4a1:	b8 22 00 00 00       	mov    $0x22,%eax
+ 4a6:	e9 6d fe ff ff       	jmp    318 <dosyscall>
+
+000004ab <clock_nanosleep>:
+SYSCALL(clock_nanosleep)
+ 4ab:	b8 23 00 00 00       	mov    $0x23,%eax
+ 4b0:	e9 63 fe ff ff       	jmp    318 <dosyscall>
+
+000004b5 <clock_gettime>:
+SYSCALL(clock_gettime)
+ 4b5:	b8 24 00 00 00       	mov    $0x24,%eax
+ 4ba:	e9 59 fe ff ff       	jmp    318 <dosyscall>
+
+000004bf <sched_setaffinity>:
+SYSCALL(sched_setaffinity)
+ 4bf:	b8 25 00 00 00       	mov    $0x25,%eax
+ 4c4:	e9 4f fe ff ff       	jmp    318 <dosyscall>
+
+000004c9 <sched_getaffinity>:
+SYSCALL(sched_getaffinity)
+ 4c9:	b8 26 00 00 00       	mov    $0x26,%eax
+ 4ce:	e9 45 fe ff ff       	jmp    318 <dosyscall>
+
+000004d3 <irqaffinity>:
+SYSCALL(irqaffinity)
+ 4d3:	b8 27 00 00 00       	mov    $0x27,%eax
+ 4d8:	e9 3b fe ff ff       	jmp    318 <dosyscall>
+
+000004dd <getrusage>:
+SYSCALL(getrusage)
+ 4dd:	b8 28 00 00 00       	mov    $0x28,%eax
+ 4e2:	e9 31 fe ff ff       	jmp    318 <dosyscall>
+
+000004e7 <times>:
+SYSCALL(times)
+ 4e7:	b8 29 00 00 00       	mov    $0x29,%eax
+ 4ec:	e9 27 fe ff ff       	jmp    318 <dosyscall>
+
+000004f1 <schedlat>:
+SYSCALL(schedlat)
+ 4f1:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 4f6:	e9 1d fe ff ff       	jmp    318 <dosyscall>
+
+000004fb <sched_setscheduler>:
+SYSCALL(sched_setscheduler)
+ 4fb:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 500:	e9 13 fe ff ff       	jmp    318 <dosyscall>
+
+00000505 <sched_getscheduler>:
+SYSCALL(sched_getscheduler)
+ 505:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 50a:	e9 09 fe ff ff       	jmp    318 <dosyscall>
+
+0000050f <sched_getparam>:
+SYSCALL(sched_getparam)
+ 50f:	b8 2d 00 00 00       	mov    $0x2d,%eax
+ 514:	e9 ff fd ff ff       	jmp    318 <dosyscall>
+
+00000519 <lockstat>:
+SYSCALL(lockstat)
+ 519:	b8 2e 00 00 00       	mov    $0x2e,%eax
+ 51e:	e9 f5 fd ff ff       	jmp    318 <dosyscall>
+
+00000523 <ioring_setup>:
+SYSCALL(ioring_setup)
+ 523:	b8 2f 00 00 00       	mov    $0x2f,%eax
+ 528:	e9 eb fd ff ff       	jmp    318 <dosyscall>
+
+0000052d <ioring_enter>:
+SYSCALL(ioring_enter)
+ 52d:	b8 30 00 00 00       	mov    $0x30,%eax
+ 532:	e9 e1 fd ff ff       	jmp    318 <dosyscall>
+
+00000537 <readv>:
+SYSCALL(readv)
+ 537:	b8 31 00 00 00       	mov    $0x31,%eax
+ 53c:	e9 d7 fd ff ff       	jmp    318 <dosyscall>
+
+00000541 <writev>:
+SYSCALL(writev)
+ 541:	b8 32 00 00 00       	mov    $0x32,%eax
+ 546:	e9 cd fd ff ff       	jmp    318 <dosyscall>
+
+0000054b <pread>:
+SYSCALL(pread)
+ 54b:	b8 33 00 00 00       	mov    $0x33,%eax
+ 550:	e9 c3 fd ff ff       	jmp    318 <dosyscall>
+
+00000555 <pwrite>:
+SYSCALL(pwrite)
+ 555:	b8 34 00 00 00       	mov    $0x34,%eax
+ 55a:	e9 b9 fd ff ff       	jmp    318 <dosyscall>
+
+0000055f <sendfile>:
+SYSCALL(sendfile)
+ 55f:	b8 35 00 00 00       	mov    $0x35,%eax
+ 564:	e9 af fd ff ff       	jmp    318 <dosyscall>
+
+00000569 <splice>:
+SYSCALL(splice)
+ 569:	b8 36 00 00 00       	mov    $0x36,%eax
+ 56e:	e9 a5 fd ff ff       	jmp    318 <dosyscall>
+
+00000573 <sysstat>:
+SYSCALL(sysstat)
+ 573:	b8 37 00 00 00       	mov    $0x37,%eax
+ 578:	e9 9b fd ff ff       	jmp    318 <dosyscall>
+
+0000057d <strace>:
+SYSCALL(strace)
+ 57d:	b8 38 00 00 00       	mov    $0x38,%eax
+ 582:	e9 91 fd ff ff       	jmp    318 <dosyscall>
+
+00000587 <straceread>:
+SYSCALL(straceread)
+ 587:	b8 39 00 00 00       	mov    $0x39,%eax
+ 58c:	e9 87 fd ff ff       	jmp    318 <dosyscall>
+
+00000591 <alarm>:
+
+# alarm and rstoregs keep to int $T_SYSCALL: rstoregs restores
+# %ecx and %edx, which sysexit would clobber.
+.globl alarm
+    alarm:
+        pushl $rstoregs
+ 591:	68 a1 05 00 00       	push   $0x5a1
+        movl $SYS_alarm, %eax
+ 596:	b8 18 00 00 00       	mov    $0x18,%eax
+        int $T_SYSCALL
+ 59b:	cd 40                	int    $0x40
+        add $0x04, %esp
+ 59d:	83 c4 04             	add    $0x4,%esp
+        ret
+ 5a0:	c3                   	ret
+
+000005a1 <rstoregs>:
+
+.globl rstoregs
+    rstoregs:
+        movl $SYS_rstoregs, %eax
+ 5a1:	b8 19 00 00 00       	mov    $0x19,%eax
+        int $T_SYSCALL
+ 5a6:	cd 40                	int    $0x40
+
+000005a8 <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 5a8:	55                   	push   %ebp
+ 5a9:	89 e5                	mov    %esp,%ebp
+ 5ab:	83 ec 18             	sub    $0x18,%esp
+ 5ae:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 5b1:	88 45 f4             	mov    %al,-0xc(%ebp)
+    write(fd, &c, 1);
+ 5b4:	83 ec 04             	sub    $0x4,%esp
+ 5b7:	6a 01                	push   $0x1
+ 5b9:	8d 45 f4             	lea    -0xc(%ebp),%eax
+ 5bc:	50                   	push   %eax
+ 5bd:	ff 75 08             	push   0x8(%ebp)
+ 5c0:	e8 d8 fd ff ff       	call   39d <write>
+ 5c5:	83 c4 10             	add    $0x10,%esp
+}
+ 5c8:	90                   	nop
+ 5c9:	c9                   	leave
+ 5ca:	c3                   	ret
+
+000005cb <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 5cb:	55                   	push   %ebp
+ 5cc:	89 e5                	mov    %esp,%ebp
+ 5ce:	83 ec 28             	sub    $0x28,%esp
+    static char digits[] = "0123456789ABCDEF";
+    char buf[16];
+    int i, neg;
+    uint x;
+
+    neg = 0;
+ 5d1:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+    if(sgn && xx < 0){
+ 5d8:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+ 5dc:	74 17                	je     5f5 <printint+0x2a>
+ 5de:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 5e2:	79 11                	jns    5f5 <printint+0x2a>
+        neg = 1;
+ 5e4:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+        x = -xx;
+ 5eb:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 5ee:	f7 d8                	neg    %eax
+ 5f0:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 5f3:	eb 06                	jmp    5fb <printint+0x30>
+    } else {
+        x = xx;
+ 5f5:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 5f8:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    }
+
+    i = 0;
+ 5fb:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    do{
+        buf[i++] = digits[x % base];
+ 602:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 605:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 608:	ba 00 00 00 00       	mov    $0x0,%edx
+ 60d:	f7 f1                	div    %ecx
+ 60f:	89 d1                	mov    %edx,%ecx
+ 611:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 614:	8d 50 01             	lea    0x1(%eax),%edx
+ 617:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 61a:	0f b6 91 d0 0c 00 00 	movzbl 0xcd0(%ecx),%edx
+ 621:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+    }while((x /= base) != 0);
+ 625:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 628:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 62b:	ba 00 00 00 00       	mov    $0x0,%edx
+ 630:	f7 f1                	div    %ecx
+ 632:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 635:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 639:	75 c7                	jne    602 <printint+0x37>
+    if(neg)
+ 63b:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 63f:	74 2d                	je     66e <printint+0xa3>
+        buf[i++] = '-';
+ 641:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 644:	8d 50 01             	lea    0x1(%eax),%edx
+ 647:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 64a:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+    while(--i >= 0)
+ 64f:	eb 1d                	jmp    66e <printint+0xa3>
+        putc(fd, buf[i]);
+ 651:	8d 55 dc             	lea    -0x24(%ebp),%edx
+ 654:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 657:	01 d0                	add    %edx,%eax
+ 659:	0f b6 00             	movzbl (%eax),%eax
+ 65c:	0f be c0             	movsbl %al,%eax
+ 65f:	83 ec 08             	sub    $0x8,%esp
+ 662:	50                   	push   %eax
+ 663:	ff 75 08             	push   0x8(%ebp)
+ 666:	e8 3d ff ff ff       	call   5a8 <putc>
+ 66b:	83 c4 10             	add    $0x10,%esp
+    while(--i >= 0)
+ 66e:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+ 672:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 676:	79 d9                	jns    651 <printint+0x86>
+}
+ 678:	90                   	nop
+ 679:	90                   	nop
+ 67a:	c9                   	leave
+ 67b:	c3                   	ret
+
+0000067c <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 67c:	55                   	push   %ebp
+ 67d:	89 e5                	mov    %esp,%ebp
+ 67f:	83 ec 28             	sub    $0x28,%esp
+    char *s;
+    int c, i, state;
+    uint *ap;
+
+    state = 0;
+ 682:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+    ap = (uint*)(void*)&fmt + 1;
+ 689:	8d 45 0c             	lea    0xc(%ebp),%eax
+ 68c:	83 c0 04             	add    $0x4,%eax
+ 68f:	89 45 e8             	mov    %eax,-0x18(%ebp)
+    for(i = 0; fmt[i]; i++){
+ 692:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 699:	e9 59 01 00 00       	jmp    7f7 <printf+0x17b>
+        c = fmt[i] & 0xff;
+ 69e:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 6a1:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 6a4:	01 d0                	add    %edx,%eax
+ 6a6:	0f b6 00             	movzbl (%eax),%eax
+ 6a9:	0f be c0             	movsbl %al,%eax
+ 6ac:	25 ff 00 00 00       	and    $0xff,%eax
+ 6b1:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        if(state == 0){
+ 6b4:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 6b8:	75 2c                	jne    6e6 <printf+0x6a>
+            if(c == '%'){
+ 6ba:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 6be:	75 0c                	jne    6cc <printf+0x50>
+                state = '%';
+ 6c0:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+ 6c7:	e9 27 01 00 00       	jmp    7f3 <printf+0x177>
+            } else {
+                putc(fd, c);
+ 6cc:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 6cf:	0f be c0             	movsbl %al,%eax
+ 6d2:	83 ec 08             	sub    $0x8,%esp
+ 6d5:	50                   	push   %eax
+ 6d6:	ff 75 08             	push   0x8(%ebp)
+ 6d9:	e8 ca fe ff ff       	call   5a8 <putc>
+ 6de:	83 c4 10             	add    $0x10,%esp
+ 6e1:	e9 0d 01 00 00       	jmp    7f3 <printf+0x177>
+            }
+        } else if(state == '%'){
+ 6e6:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+ 6ea:	0f 85 03 01 00 00    	jne    7f3 <printf+0x177>
+            if(c == 'd'){
+ 6f0:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+ 6f4:	75 1e                	jne    714 <printf+0x98>
+                printint(fd, *ap, 10, 1);
+ 6f6:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 6f9:	8b 00                	mov    (%eax),%eax
+ 6fb:	6a 01                	push   $0x1
+ 6fd:	6a 0a                	push   $0xa
+ 6ff:	50                   	push   %eax
+ 700:	ff 75 08             	push   0x8(%ebp)
+ 703:	e8 c3 fe ff ff       	call   5cb <printint>
+ 708:	83 c4 10             	add    $0x10,%esp
+                ap++;
+ 70b:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 70f:	e9 d8 00 00 00       	jmp    7ec <printf+0x170>
+            } else if(c == 'x' || c == 'p'){
+ 714:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+ 718:	74 06                	je     720 <printf+0xa4>
+ 71a:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+ 71e:	75 1e                	jne    73e <printf+0xc2>
+                printint(fd, *ap, 16, 0);
+ 720:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 723:	8b 00                	mov    (%eax),%eax
+ 725:	6a 00                	push   $0x0
+ 727:	6a 10                	push   $0x10
+ 729:	50                   	push   %eax
+ 72a:	ff 75 08             	push   0x8(%ebp)
+ 72d:	e8 99 fe ff ff       	call   5cb <printint>
+ 732:	83 c4 10             	add    $0x10,%esp
+                ap++;
+ 735:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 739:	e9 ae 00 00 00       	jmp    7ec <printf+0x170>
+            } else if(c == 's'){
+ 73e:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+ 742:	75 43                	jne    787 <printf+0x10b>
+                s = (char*)*ap;
+ 744:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 747:	8b 00                	mov    (%eax),%eax
+ 749:	89 45 f4             	mov    %eax,-0xc(%ebp)
+                ap++;
+ 74c:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+                if(s == 0)
+ 750:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 754:	75 25                	jne    77b <printf+0xff>
+                    s = "(null)";
+ 756:	c7 45 f4 5a 0a 00 00 	movl   $0xa5a,-0xc(%ebp)
+                while(*s != 0){
+ 75d:	eb 1c                	jmp    77b <printf+0xff>
+                    putc(fd, *s);
+ 75f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 762:	0f b6 00             	movzbl (%eax),%eax
+ 765:	0f be c0             	movsbl %al,%eax
+ 768:	83 ec 08             	sub    $0x8,%esp
+ 76b:	50                   	push   %eax
+ 76c:	ff 75 08             	push   0x8(%ebp)
+ 76f:	e8 34 fe ff ff       	call   5a8 <putc>
+ 774:	83 c4 10             	add    $0x10,%esp
+                    s++;
+ 777:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+                while(*s != 0){
+ 77b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 77e:	0f b6 00             	movzbl (%eax),%eax
+ 781:	84 c0                	test   %al,%al
+ 783:	75 da                	jne    75f <printf+0xe3>
+ 785:	eb 65                	jmp    7ec <printf+0x170>
+                }
+            } else if(c == 'c'){
+ 787:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+ 78b:	75 1d                	jne    7aa <printf+0x12e>
+                putc(fd, *ap);
+ 78d:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 790:	8b 00                	mov    (%eax),%eax
+ 792:	0f be c0             	movsbl %al,%eax
+ 795:	83 ec 08             	sub    $0x8,%esp
+ 798:	50                   	push   %eax
+ 799:	ff 75 08             	push   0x8(%ebp)
+ 79c:	e8 07 fe ff ff       	call   5a8 <putc>
+ 7a1:	83 c4 10             	add    $0x10,%esp
+                ap++;
+ 7a4:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 7a8:	eb 42                	jmp    7ec <printf+0x170>
+            } else if(c == '%'){
+ 7aa:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 7ae:	75 17                	jne    7c7 <printf+0x14b>
+                putc(fd, c);
+ 7b0:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 7b3:	0f be c0             	movsbl %al,%eax
+ 7b6:	83 ec 08             	sub    $0x8,%esp
+ 7b9:	50                   	push   %eax
+ 7ba:	ff 75 08             	push   0x8(%ebp)
+ 7bd:	e8 e6 fd ff ff       	call   5a8 <putc>
+ 7c2:	83 c4 10             	add    $0x10,%esp
+ 7c5:	eb 25                	jmp    7ec <printf+0x170>
+            } else {
+                // Unknown % sequence.    Print it to draw attention.
+                putc(fd, '%');
+ 7c7:	83 ec 08             	sub    $0x8,%esp
+ 7ca:	6a 25                	push   $0x25
+ 7cc:	ff 75 08             	push   0x8(%ebp)
+ 7cf:	e8 d4 fd ff ff       	call   5a8 <putc>
+ 7d4:	83 c4 10             	add    $0x10,%esp
+                putc(fd, c);
+ 7d7:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 7da:	0f be c0             	movsbl %al,%eax
+ 7dd:	83 ec 08             	sub    $0x8,%esp
+ 7e0:	50                   	push   %eax
+ 7e1:	ff 75 08             	push   0x8(%ebp)
+ 7e4:	e8 bf fd ff ff       	call   5a8 <putc>
+ 7e9:	83 c4 10             	add    $0x10,%esp
+            }
+            state = 0;
+ 7ec:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+    for(i = 0; fmt[i]; i++){
+ 7f3:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ 7f7:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 7fa:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 7fd:	01 d0                	add    %edx,%eax
+ 7ff:	0f b6 00             	movzbl (%eax),%eax
+ 802:	84 c0                	test   %al,%al
+ 804:	0f 85 94 fe ff ff    	jne    69e <printf+0x22>
+        }
+    }
+}
+ 80a:	90                   	nop
+ 80b:	90                   	nop
+ 80c:	c9                   	leave
+ 80d:	c3                   	ret
+
+0000080e <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 80e:	55                   	push   %ebp
+ 80f:	89 e5                	mov    %esp,%ebp
+ 811:	83 ec 10             	sub    $0x10,%esp
+    Header *bp, *p;
+
+    bp = (Header*)ap - 1;
+ 814:	8b 45 08             	mov    0x8(%ebp),%eax
+ 817:	83 e8 08             	sub    $0x8,%eax
+ 81a:	89 45 f8             	mov    %eax,-0x8(%ebp)
+    for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 81d:	a1 ec 0c 00 00       	mov    0xcec,%eax
+ 822:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 825:	eb 24                	jmp    84b <free+0x3d>
+        if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 827:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 82a:	8b 00                	mov    (%eax),%eax
+ 82c:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 82f:	72 12                	jb     843 <free+0x35>
+ 831:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 834:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 837:	72 24                	jb     85d <free+0x4f>
+ 839:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 83c:	8b 00                	mov    (%eax),%eax
+ 83e:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 841:	72 1a                	jb     85d <free+0x4f>
+    for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 843:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 846:	8b 00                	mov    (%eax),%eax
+ 848:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 84b:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 84e:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 851:	73 d4                	jae    827 <free+0x19>
+ 853:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 856:	8b 00                	mov    (%eax),%eax
+ 858:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 85b:	73 ca                	jae    827 <free+0x19>
+            break;
+    if(bp + bp->s.size == p->s.ptr){
+ 85d:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 860:	8b 40 04             	mov    0x4(%eax),%eax
+ 863:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 86a:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 86d:	01 c2                	add    %eax,%edx
+ 86f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 872:	8b 00                	mov    (%eax),%eax
+ 874:	39 c2                	cmp    %eax,%edx
+ 876:	75 24                	jne    89c <free+0x8e>
+        bp->s.size += p->s.ptr->s.size;
+ 878:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 87b:	8b 50 04             	mov    0x4(%eax),%edx
+ 87e:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 881:	8b 00                	mov    (%eax),%eax
+ 883:	8b 40 04             	mov    0x4(%eax),%eax
+ 886:	01 c2                	add    %eax,%edx
+ 888:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 88b:	89 50 04             	mov    %edx,0x4(%eax)
+        bp->s.ptr = p->s.ptr->s.ptr;
+ 88e:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 891:	8b 00                	mov    (%eax),%eax
+ 893:	8b 10                	mov    (%eax),%edx
+ 895:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 898:	89 10                	mov    %edx,(%eax)
+ 89a:	eb 0a                	jmp    8a6 <free+0x98>
+    } else
+        bp->s.ptr = p->s.ptr;
+ 89c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 89f:	8b 10                	mov    (%eax),%edx
+ 8a1:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 8a4:	89 10                	mov    %edx,(%eax)
+    if(p + p->s.size == bp){
+ 8a6:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 8a9:	8b 40 04             	mov    0x4(%eax),%eax
+ 8ac:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 8b3:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 8b6:	01 d0                	add    %edx,%eax
+ 8b8:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 8bb:	75 20                	jne    8dd <free+0xcf>
+        p->s.size += bp->s.size;
+ 8bd:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 8c0:	8b 50 04             	mov    0x4(%eax),%edx
+ 8c3:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 8c6:	8b 40 04             	mov    0x4(%eax),%eax
+ 8c9:	01 c2                	add    %eax,%edx
+ 8cb:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 8ce:	89 50 04             	mov    %edx,0x4(%eax)
+        p->s.ptr = bp->s.ptr;
+ 8d1:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 8d4:	8b 10                	mov    (%eax),%edx
+ 8d6:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 8d9:	89 10                	mov    %edx,(%eax)
+ 8db:	eb 08                	jmp    8e5 <free+0xd7>
+    } else
+        p->s.ptr = bp;
+ 8dd:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 8e0:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 8e3:	89 10                	mov    %edx,(%eax)
+    freep = p;
+ 8e5:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 8e8:	a3 ec 0c 00 00       	mov    %eax,0xcec
+}
+ 8ed:	90                   	nop
+ 8ee:	c9                   	leave
+ 8ef:	c3                   	ret
+
+000008f0 <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+ 8f0:	55                   	push   %ebp
+ 8f1:	89 e5                	mov    %esp,%ebp
+ 8f3:	83 ec 18             	sub    $0x18,%esp
+    char *p;
+    Header *hp;
+
+    if(nu < 4096)
+ 8f6:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+ 8fd:	77 07                	ja     906 <morecore+0x16>
+        nu = 4096;
+ 8ff:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+    p = sbrk(nu * sizeof(Header));
+ 906:	8b 45 08             	mov    0x8(%ebp),%eax
+ 909:	c1 e0 03             	shl    $0x3,%eax
+ 90c:	83 ec 0c             	sub    $0xc,%esp
+ 90f:	50                   	push   %eax
+ 910:	e8 0a fb ff ff       	call   41f <sbrk>
+ 915:	83 c4 10             	add    $0x10,%esp
+ 918:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p == (char*)-1)
+ 91b:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+ 91f:	75 07                	jne    928 <morecore+0x38>
+        return 0;
+ 921:	b8 00 00 00 00       	mov    $0x0,%eax
+ 926:	eb 26                	jmp    94e <morecore+0x5e>
+    hp = (Header*)p;
+ 928:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 92b:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    hp->s.size = nu;
+ 92e:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 931:	8b 55 08             	mov    0x8(%ebp),%edx
+ 934:	89 50 04             	mov    %edx,0x4(%eax)
+    free((void*)(hp + 1));
+ 937:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 93a:	83 c0 08             	add    $0x8,%eax
+ 93d:	83 ec 0c             	sub    $0xc,%esp
+ 940:	50                   	push   %eax
+ 941:	e8 c8 fe ff ff       	call   80e <free>
+ 946:	83 c4 10             	add    $0x10,%esp
+    return freep;
+ 949:	a1 ec 0c 00 00       	mov    0xcec,%eax
+}
+ 94e:	c9                   	leave
+ 94f:	c3                   	ret
+
+00000950 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ 950:	55                   	push   %ebp
+ 951:	89 e5                	mov    %esp,%ebp
+ 953:	83 ec 18             	sub    $0x18,%esp
+    Header *p, *prevp;
+    uint nunits;
+
+    nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 956:	8b 45 08             	mov    0x8(%ebp),%eax
+ 959:	83 c0 07             	add    $0x7,%eax
+ 95c:	c1 e8 03             	shr    $0x3,%eax
+ 95f:	83 c0 01             	add    $0x1,%eax
+ 962:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    if((prevp = freep) == 0){
+ 965:	a1 ec 0c 00 00       	mov    0xcec,%eax
+ 96a:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ 96d:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 971:	75 23                	jne    996 <malloc+0x46>
+        base.s.ptr = freep = prevp = &base;
+ 973:	c7 45 f0 e4 0c 00 00 	movl   $0xce4,-0x10(%ebp)
+ 97a:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 97d:	a3 ec 0c 00 00       	mov    %eax,0xcec
+ 982:	a1 ec 0c 00 00       	mov    0xcec,%eax
+ 987:	a3 e4 0c 00 00       	mov    %eax,0xce4
+        base.s.size = 0;
+ 98c:	c7 05 e8 0c 00 00 00 	movl   $0x0,0xce8
+ 993:	00 00 00 
+    }
+    for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 996:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 999:	8b 00                	mov    (%eax),%eax
+ 99b:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        if(p->s.size >= nunits){
+ 99e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 9a1:	8b 40 04             	mov    0x4(%eax),%eax
+ 9a4:	3b 45 ec             	cmp    -0x14(%ebp),%eax
+ 9a7:	72 4d                	jb     9f6 <malloc+0xa6>
+            if(p->s.size == nunits)
+ 9a9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 9ac:	8b 40 04             	mov    0x4(%eax),%eax
+ 9af:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+ 9b2:	75 0c                	jne    9c0 <malloc+0x70>
+                prevp->s.ptr = p->s.ptr;
+ 9b4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 9b7:	8b 10                	mov    (%eax),%edx
+ 9b9:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 9bc:	89 10                	mov    %edx,(%eax)
+ 9be:	eb 26                	jmp    9e6 <malloc+0x96>
+            else {
+                p->s.size -= nunits;
+ 9c0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 9c3:	8b 40 04             	mov    0x4(%eax),%eax
+ 9c6:	2b 45 ec             	sub    -0x14(%ebp),%eax
+ 9c9:	89 c2                	mov    %eax,%edx
+ 9cb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 9ce:	89 50 04             	mov    %edx,0x4(%eax)
+                p += p->s.size;
+ 9d1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 9d4:	8b 40 04             	mov    0x4(%eax),%eax
+ 9d7:	c1 e0 03             	shl    $0x3,%eax
+ 9da:	01 45 f4             	add    %eax,-0xc(%ebp)
+                p->s.size = nunits;
+ 9dd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 9e0:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 9e3:	89 50 04             	mov    %edx,0x4(%eax)
+            }
+            freep = prevp;
+ 9e6:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 9e9:	a3 ec 0c 00 00       	mov    %eax,0xcec
+            return (void*)(p + 1);
+ 9ee:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 9f1:	83 c0 08             	add    $0x8,%eax
+ 9f4:	eb 3b                	jmp    a31 <malloc+0xe1>
+        }
+        if(p == freep)
+ 9f6:	a1 ec 0c 00 00       	mov    0xcec,%eax
+ 9fb:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ 9fe:	75 1e                	jne    a1e <malloc+0xce>
+            if((p = morecore(nunits)) == 0)
+ a00:	83 ec 0c             	sub    $0xc,%esp
+ a03:	ff 75 ec             	push   -0x14(%ebp)
+ a06:	e8 e5 fe ff ff       	call   8f0 <morecore>
+ a0b:	83 c4 10             	add    $0x10,%esp
+ a0e:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ a11:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ a15:	75 07                	jne    a1e <malloc+0xce>
+                return 0;
+ a17:	b8 00 00 00 00       	mov    $0x0,%eax
+ a1c:	eb 13                	jmp    a31 <malloc+0xe1>
+    for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ a1e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a21:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ a24:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a27:	8b 00                	mov    (%eax),%eax
+ a29:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        if(p->s.size >= nunits){
+ a2c:	e9 6d ff ff ff       	jmp    99e <malloc+0x4e>
+    }
+}
+ a31:	c9                   	leave
+ a32:	c3                   	ret
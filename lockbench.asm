@@ -0,0 +1,1550 @@
+
+_lockbench:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+
+#define NOPID 0x7fffffff
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	53                   	push   %ebx
+   e:	51                   	push   %ecx
+   f:	83 ec 30             	sub    $0x30,%esp
+  12:	89 c8                	mov    %ecx,%eax
+    int i, n, iters, ncpu, mask, us;
+    struct timespec t0, t1;
+
+    iters = 100000;
+  14:	c7 45 ec a0 86 01 00 	movl   $0x186a0,-0x14(%ebp)
+    if(argc > 1)
+  1b:	83 38 01             	cmpl   $0x1,(%eax)
+  1e:	7e 17                	jle    37 <main+0x37>
+        iters = atoi(argv[1]);
+  20:	8b 40 04             	mov    0x4(%eax),%eax
+  23:	83 c0 04             	add    $0x4,%eax
+  26:	8b 00                	mov    (%eax),%eax
+  28:	83 ec 0c             	sub    $0xc,%esp
+  2b:	50                   	push   %eax
+  2c:	e8 6b 03 00 00       	call   39c <atoi>
+  31:	83 c4 10             	add    $0x10,%esp
+  34:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    mask = sched_getaffinity(0);
+  37:	83 ec 0c             	sub    $0xc,%esp
+  3a:	6a 00                	push   $0x0
+  3c:	e8 eb 05 00 00       	call   62c <sched_getaffinity>
+  41:	83 c4 10             	add    $0x10,%esp
+  44:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    ncpu = 0;
+  47:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+    for(i = 0; i < 32; i++)
+  4e:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  55:	eb 1b                	jmp    72 <main+0x72>
+        if(mask & (1 << i))
+  57:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  5a:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  5d:	89 c1                	mov    %eax,%ecx
+  5f:	d3 fa                	sar    %cl,%edx
+  61:	89 d0                	mov    %edx,%eax
+  63:	83 e0 01             	and    $0x1,%eax
+  66:	85 c0                	test   %eax,%eax
+  68:	74 04                	je     6e <main+0x6e>
+            ncpu++;
+  6a:	83 45 e8 01          	addl   $0x1,-0x18(%ebp)
+    for(i = 0; i < 32; i++)
+  6e:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+  72:	83 7d f4 1f          	cmpl   $0x1f,-0xc(%ebp)
+  76:	7e df                	jle    57 <main+0x57>
+
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+  78:	83 ec 08             	sub    $0x8,%esp
+  7b:	8d 45 d8             	lea    -0x28(%ebp),%eax
+  7e:	50                   	push   %eax
+  7f:	6a 01                	push   $0x1
+  81:	e8 92 05 00 00       	call   618 <clock_gettime>
+  86:	83 c4 10             	add    $0x10,%esp
+    n = 0;
+  89:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+    for(i = 0; i < 32; i++){
+  90:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  97:	e9 8b 00 00 00       	jmp    127 <main+0x127>
+        if((mask & (1 << i)) == 0)
+  9c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  9f:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  a2:	89 c1                	mov    %eax,%ecx
+  a4:	d3 fa                	sar    %cl,%edx
+  a6:	89 d0                	mov    %edx,%eax
+  a8:	83 e0 01             	and    $0x1,%eax
+  ab:	85 c0                	test   %eax,%eax
+  ad:	74 73                	je     122 <main+0x122>
+            continue;
+        switch(fork()){
+  af:	e8 26 04 00 00       	call   4da <fork>
+  b4:	83 f8 ff             	cmp    $0xffffffff,%eax
+  b7:	74 06                	je     bf <main+0xbf>
+  b9:	85 c0                	test   %eax,%eax
+  bb:	74 19                	je     d6 <main+0xd6>
+  bd:	eb 5d                	jmp    11c <main+0x11c>
+        case -1:
+            printf(2, "lockbench: fork failed\n");
+  bf:	83 ec 08             	sub    $0x8,%esp
+  c2:	68 98 0b 00 00       	push   $0xb98
+  c7:	6a 02                	push   $0x2
+  c9:	e8 11 07 00 00       	call   7df <printf>
+  ce:	83 c4 10             	add    $0x10,%esp
+            exit();
+  d1:	e8 0b 04 00 00       	call   4e1 <exit>
+        case 0:
+            sched_setaffinity(0, 1 << i);
+  d6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  d9:	ba 01 00 00 00       	mov    $0x1,%edx
+  de:	89 c1                	mov    %eax,%ecx
+  e0:	d3 e2                	shl    %cl,%edx
+  e2:	89 d0                	mov    %edx,%eax
+  e4:	83 ec 08             	sub    $0x8,%esp
+  e7:	50                   	push   %eax
+  e8:	6a 00                	push   $0x0
+  ea:	e8 33 05 00 00       	call   622 <sched_setaffinity>
+  ef:	83 c4 10             	add    $0x10,%esp
+            for(n = 0; n < iters; n++)
+  f2:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  f9:	eb 14                	jmp    10f <main+0x10f>
+                kill(NOPID);
+  fb:	83 ec 0c             	sub    $0xc,%esp
+  fe:	68 ff ff ff 7f       	push   $0x7fffffff
+ 103:	e8 0c 04 00 00       	call   514 <kill>
+ 108:	83 c4 10             	add    $0x10,%esp
+            for(n = 0; n < iters; n++)
+ 10b:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ 10f:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 112:	3b 45 ec             	cmp    -0x14(%ebp),%eax
+ 115:	7c e4                	jl     fb <main+0xfb>
+            exit();
+ 117:	e8 c5 03 00 00       	call   4e1 <exit>
+        }
+        n++;
+ 11c:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ 120:	eb 01                	jmp    123 <main+0x123>
+            continue;
+ 122:	90                   	nop
+    for(i = 0; i < 32; i++){
+ 123:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+ 127:	83 7d f4 1f          	cmpl   $0x1f,-0xc(%ebp)
+ 12b:	0f 8e 6b ff ff ff    	jle    9c <main+0x9c>
+    }
+    while(n-- > 0)
+ 131:	eb 05                	jmp    138 <main+0x138>
+        wait();
+ 133:	e8 b0 03 00 00       	call   4e8 <wait>
+    while(n-- > 0)
+ 138:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 13b:	8d 50 ff             	lea    -0x1(%eax),%edx
+ 13e:	89 55 f0             	mov    %edx,-0x10(%ebp)
+ 141:	85 c0                	test   %eax,%eax
+ 143:	7f ee                	jg     133 <main+0x133>
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+ 145:	83 ec 08             	sub    $0x8,%esp
+ 148:	8d 45 d0             	lea    -0x30(%ebp),%eax
+ 14b:	50                   	push   %eax
+ 14c:	6a 01                	push   $0x1
+ 14e:	e8 c5 04 00 00       	call   618 <clock_gettime>
+ 153:	83 c4 10             	add    $0x10,%esp
+
+    us = (t1.tv_sec - t0.tv_sec) * 1000000 + (t1.tv_nsec - t0.tv_nsec) / 1000;
+ 156:	8b 55 d0             	mov    -0x30(%ebp),%edx
+ 159:	8b 45 d8             	mov    -0x28(%ebp),%eax
+ 15c:	29 c2                	sub    %eax,%edx
+ 15e:	69 da 40 42 0f 00    	imul   $0xf4240,%edx,%ebx
+ 164:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 167:	8b 45 dc             	mov    -0x24(%ebp),%eax
+ 16a:	89 d1                	mov    %edx,%ecx
+ 16c:	29 c1                	sub    %eax,%ecx
+ 16e:	ba d3 4d 62 10       	mov    $0x10624dd3,%edx
+ 173:	89 c8                	mov    %ecx,%eax
+ 175:	f7 ea                	imul   %edx
+ 177:	c1 fa 06             	sar    $0x6,%edx
+ 17a:	89 c8                	mov    %ecx,%eax
+ 17c:	c1 f8 1f             	sar    $0x1f,%eax
+ 17f:	29 c2                	sub    %eax,%edx
+ 181:	8d 04 13             	lea    (%ebx,%edx,1),%eax
+ 184:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    printf(1, "lockbench: %d cpus x %d acquires in %d us, %d ns per acquire per cpu\n",
+ 187:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 18b:	7e 24                	jle    1b1 <main+0x1b1>
+        ncpu, iters, us, iters > 0 ? us / iters * 1000 + us % iters * 1000 / iters : 0);
+ 18d:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ 190:	99                   	cltd
+ 191:	f7 7d ec             	idivl  -0x14(%ebp)
+ 194:	69 c8 e8 03 00 00    	imul   $0x3e8,%eax,%ecx
+ 19a:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ 19d:	99                   	cltd
+ 19e:	f7 7d ec             	idivl  -0x14(%ebp)
+ 1a1:	89 d0                	mov    %edx,%eax
+ 1a3:	69 c0 e8 03 00 00    	imul   $0x3e8,%eax,%eax
+ 1a9:	99                   	cltd
+ 1aa:	f7 7d ec             	idivl  -0x14(%ebp)
+    printf(1, "lockbench: %d cpus x %d acquires in %d us, %d ns per acquire per cpu\n",
+ 1ad:	01 c8                	add    %ecx,%eax
+ 1af:	eb 05                	jmp    1b6 <main+0x1b6>
+ 1b1:	b8 00 00 00 00       	mov    $0x0,%eax
+ 1b6:	83 ec 08             	sub    $0x8,%esp
+ 1b9:	50                   	push   %eax
+ 1ba:	ff 75 e0             	push   -0x20(%ebp)
+ 1bd:	ff 75 ec             	push   -0x14(%ebp)
+ 1c0:	ff 75 e8             	push   -0x18(%ebp)
+ 1c3:	68 b0 0b 00 00       	push   $0xbb0
+ 1c8:	6a 01                	push   $0x1
+ 1ca:	e8 10 06 00 00       	call   7df <printf>
+ 1cf:	83 c4 20             	add    $0x20,%esp
+    exit();
+ 1d2:	e8 0a 03 00 00       	call   4e1 <exit>
+
+000001d7 <stosb>:
+strchr(const char *s, char c)
+{
+    for(; *s; s++)
+        if(*s == c)
+            return (char*)s;
+    return 0;
+ 1d7:	55                   	push   %ebp
+ 1d8:	89 e5                	mov    %esp,%ebp
+ 1da:	57                   	push   %edi
+ 1db:	53                   	push   %ebx
+}
+ 1dc:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 1df:	8b 55 10             	mov    0x10(%ebp),%edx
+ 1e2:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 1e5:	89 cb                	mov    %ecx,%ebx
+ 1e7:	89 df                	mov    %ebx,%edi
+ 1e9:	89 d1                	mov    %edx,%ecx
+ 1eb:	fc                   	cld
+ 1ec:	f3 aa                	rep stos %al,%es:(%edi)
+ 1ee:	89 ca                	mov    %ecx,%edx
+ 1f0:	89 fb                	mov    %edi,%ebx
+ 1f2:	89 5d 08             	mov    %ebx,0x8(%ebp)
+ 1f5:	89 55 10             	mov    %edx,0x10(%ebp)
+
+char*
+gets(char *buf, int max)
+{
+ 1f8:	90                   	nop
+ 1f9:	5b                   	pop    %ebx
+ 1fa:	5f                   	pop    %edi
+ 1fb:	5d                   	pop    %ebp
+ 1fc:	c3                   	ret
+
+000001fd <strcpy>:
+{
+ 1fd:	55                   	push   %ebp
+ 1fe:	89 e5                	mov    %esp,%ebp
+ 200:	83 ec 10             	sub    $0x10,%esp
+    os = s;
+ 203:	8b 45 08             	mov    0x8(%ebp),%eax
+ 206:	89 45 fc             	mov    %eax,-0x4(%ebp)
+    while((*s++ = *t++) != 0)
+ 209:	90                   	nop
+ 20a:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 20d:	8d 42 01             	lea    0x1(%edx),%eax
+ 210:	89 45 0c             	mov    %eax,0xc(%ebp)
+ 213:	8b 45 08             	mov    0x8(%ebp),%eax
+ 216:	8d 48 01             	lea    0x1(%eax),%ecx
+ 219:	89 4d 08             	mov    %ecx,0x8(%ebp)
+ 21c:	0f b6 12             	movzbl (%edx),%edx
+ 21f:	88 10                	mov    %dl,(%eax)
+ 221:	0f b6 00             	movzbl (%eax),%eax
+ 224:	84 c0                	test   %al,%al
+ 226:	75 e2                	jne    20a <strcpy+0xd>
+    return os;
+ 228:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 22b:	c9                   	leave
+ 22c:	c3                   	ret
+
+0000022d <strcmp>:
+{
+ 22d:	55                   	push   %ebp
+ 22e:	89 e5                	mov    %esp,%ebp
+    while(*p && *p == *q)
+ 230:	eb 08                	jmp    23a <strcmp+0xd>
+        p++, q++;
+ 232:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 236:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+    while(*p && *p == *q)
+ 23a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 23d:	0f b6 00             	movzbl (%eax),%eax
+ 240:	84 c0                	test   %al,%al
+ 242:	74 10                	je     254 <strcmp+0x27>
+ 244:	8b 45 08             	mov    0x8(%ebp),%eax
+ 247:	0f b6 10             	movzbl (%eax),%edx
+ 24a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 24d:	0f b6 00             	movzbl (%eax),%eax
+ 250:	38 c2                	cmp    %al,%dl
+ 252:	74 de                	je     232 <strcmp+0x5>
+    return (uchar)*p - (uchar)*q;
+ 254:	8b 45 08             	mov    0x8(%ebp),%eax
+ 257:	0f b6 00             	movzbl (%eax),%eax
+ 25a:	0f b6 d0             	movzbl %al,%edx
+ 25d:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 260:	0f b6 00             	movzbl (%eax),%eax
+ 263:	0f b6 c0             	movzbl %al,%eax
+ 266:	29 c2                	sub    %eax,%edx
+ 268:	89 d0                	mov    %edx,%eax
+}
+ 26a:	5d                   	pop    %ebp
+ 26b:	c3                   	ret
+
+0000026c <strlen>:
+{
+ 26c:	55                   	push   %ebp
+ 26d:	89 e5                	mov    %esp,%ebp
+ 26f:	83 ec 10             	sub    $0x10,%esp
+    for(n = 0; s[n]; n++)
+ 272:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ 279:	eb 04                	jmp    27f <strlen+0x13>
+ 27b:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 27f:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 282:	8b 45 08             	mov    0x8(%ebp),%eax
+ 285:	01 d0                	add    %edx,%eax
+ 287:	0f b6 00             	movzbl (%eax),%eax
+ 28a:	84 c0                	test   %al,%al
+ 28c:	75 ed                	jne    27b <strlen+0xf>
+    return n;
+ 28e:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 291:	c9                   	leave
+ 292:	c3                   	ret
+
+00000293 <memset>:
+{
+ 293:	55                   	push   %ebp
+ 294:	89 e5                	mov    %esp,%ebp
+    stosb(dst, c, n);
+ 296:	8b 45 10             	mov    0x10(%ebp),%eax
+ 299:	50                   	push   %eax
+ 29a:	ff 75 0c             	push   0xc(%ebp)
+ 29d:	ff 75 08             	push   0x8(%ebp)
+ 2a0:	e8 32 ff ff ff       	call   1d7 <stosb>
+ 2a5:	83 c4 0c             	add    $0xc,%esp
+    return dst;
+ 2a8:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 2ab:	c9                   	leave
+ 2ac:	c3                   	ret
+
+000002ad <strchr>:
+{
+ 2ad:	55                   	push   %ebp
+ 2ae:	89 e5                	mov    %esp,%ebp
+ 2b0:	83 ec 04             	sub    $0x4,%esp
+ 2b3:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 2b6:	88 45 fc             	mov    %al,-0x4(%ebp)
+    for(; *s; s++)
+ 2b9:	eb 14                	jmp    2cf <strchr+0x22>
+        if(*s == c)
+ 2bb:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2be:	0f b6 00             	movzbl (%eax),%eax
+ 2c1:	38 45 fc             	cmp    %al,-0x4(%ebp)
+ 2c4:	75 05                	jne    2cb <strchr+0x1e>
+            return (char*)s;
+ 2c6:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2c9:	eb 13                	jmp    2de <strchr+0x31>
+    for(; *s; s++)
+ 2cb:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 2cf:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2d2:	0f b6 00             	movzbl (%eax),%eax
+ 2d5:	84 c0                	test   %al,%al
+ 2d7:	75 e2                	jne    2bb <strchr+0xe>
+    return 0;
+ 2d9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 2de:	c9                   	leave
+ 2df:	c3                   	ret
+
+000002e0 <gets>:
+{
+ 2e0:	55                   	push   %ebp
+ 2e1:	89 e5                	mov    %esp,%ebp
+ 2e3:	83 ec 18             	sub    $0x18,%esp
+    int i, cc;
+    char c;
+
+    for(i=0; i+1 < max; ){
+ 2e6:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 2ed:	eb 42                	jmp    331 <gets+0x51>
+        cc = read(0, &c, 1);
+ 2ef:	83 ec 04             	sub    $0x4,%esp
+ 2f2:	6a 01                	push   $0x1
+ 2f4:	8d 45 ef             	lea    -0x11(%ebp),%eax
+ 2f7:	50                   	push   %eax
+ 2f8:	6a 00                	push   $0x0
+ 2fa:	e8 f7 01 00 00       	call   4f6 <read>
+ 2ff:	83 c4 10             	add    $0x10,%esp
+ 302:	89 45 f0             	mov    %eax,-0x10(%ebp)
+        if(cc < 1)
+ 305:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 309:	7e 33                	jle    33e <gets+0x5e>
+            break;
+        buf[i++] = c;
+ 30b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 30e:	8d 50 01             	lea    0x1(%eax),%edx
+ 311:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 314:	89 c2                	mov    %eax,%edx
+ 316:	8b 45 08             	mov    0x8(%ebp),%eax
+ 319:	01 c2                	add    %eax,%edx
+ 31b:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 31f:	88 02                	mov    %al,(%edx)
+        if(c == '\n' || c == '\r')
+ 321:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 325:	3c 0a                	cmp    $0xa,%al
+ 327:	74 16                	je     33f <gets+0x5f>
+ 329:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 32d:	3c 0d                	cmp    $0xd,%al
+ 32f:	74 0e                	je     33f <gets+0x5f>
+    for(i=0; i+1 < max; ){
+ 331:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 334:	83 c0 01             	add    $0x1,%eax
+ 337:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 33a:	7f b3                	jg     2ef <gets+0xf>
+ 33c:	eb 01                	jmp    33f <gets+0x5f>
+            break;
+ 33e:	90                   	nop
+            break;
+    }
+    buf[i] = '\0';
+ 33f:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 342:	8b 45 08             	mov    0x8(%ebp),%eax
+ 345:	01 d0                	add    %edx,%eax
+ 347:	c6 00 00             	movb   $0x0,(%eax)
+    return buf;
+ 34a:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 34d:	c9                   	leave
+ 34e:	c3                   	ret
+
+0000034f <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 34f:	55                   	push   %ebp
+ 350:	89 e5                	mov    %esp,%ebp
+ 352:	83 ec 18             	sub    $0x18,%esp
+    int fd;
+    int r;
+
+    fd = open(n, O_RDONLY);
+ 355:	83 ec 08             	sub    $0x8,%esp
+ 358:	6a 00                	push   $0x0
+ 35a:	ff 75 08             	push   0x8(%ebp)
+ 35d:	e8 c6 01 00 00       	call   528 <open>
+ 362:	83 c4 10             	add    $0x10,%esp
+ 365:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(fd < 0)
+ 368:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 36c:	79 07                	jns    375 <stat+0x26>
+        return -1;
+ 36e:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 373:	eb 25                	jmp    39a <stat+0x4b>
+    r = fstat(fd, st);
+ 375:	83 ec 08             	sub    $0x8,%esp
+ 378:	ff 75 0c             	push   0xc(%ebp)
+ 37b:	ff 75 f4             	push   -0xc(%ebp)
+ 37e:	e8 c3 01 00 00       	call   546 <fstat>
+ 383:	83 c4 10             	add    $0x10,%esp
+ 386:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    close(fd);
+ 389:	83 ec 0c             	sub    $0xc,%esp
+ 38c:	ff 75 f4             	push   -0xc(%ebp)
+ 38f:	e8 76 01 00 00       	call   50a <close>
+ 394:	83 c4 10             	add    $0x10,%esp
+    return r;
+ 397:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ 39a:	c9                   	leave
+ 39b:	c3                   	ret
+
+0000039c <atoi>:
+
+int
+atoi(const char *s)
+{
+ 39c:	55                   	push   %ebp
+ 39d:	89 e5                	mov    %esp,%ebp
+ 39f:	83 ec 10             	sub    $0x10,%esp
+    int n;
+
+    n = 0;
+ 3a2:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+    while('0' <= *s && *s <= '9')
+ 3a9:	eb 25                	jmp    3d0 <atoi+0x34>
+        n = n*10 + *s++ - '0';
+ 3ab:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 3ae:	89 d0                	mov    %edx,%eax
+ 3b0:	c1 e0 02             	shl    $0x2,%eax
+ 3b3:	01 d0                	add    %edx,%eax
+ 3b5:	01 c0                	add    %eax,%eax
+ 3b7:	89 c1                	mov    %eax,%ecx
+ 3b9:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3bc:	8d 50 01             	lea    0x1(%eax),%edx
+ 3bf:	89 55 08             	mov    %edx,0x8(%ebp)
+ 3c2:	0f b6 00             	movzbl (%eax),%eax
+ 3c5:	0f be c0             	movsbl %al,%eax
+ 3c8:	01 c8                	add    %ecx,%eax
+ 3ca:	83 e8 30             	sub    $0x30,%eax
+ 3cd:	89 45 fc             	mov    %eax,-0x4(%ebp)
+    while('0' <= *s && *s <= '9')
+ 3d0:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3d3:	0f b6 00             	movzbl (%eax),%eax
+ 3d6:	3c 2f                	cmp    $0x2f,%al
+ 3d8:	7e 0a                	jle    3e4 <atoi+0x48>
+ 3da:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3dd:	0f b6 00             	movzbl (%eax),%eax
+ 3e0:	3c 39                	cmp    $0x39,%al
+ 3e2:	7e c7                	jle    3ab <atoi+0xf>
+    return n;
+ 3e4:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 3e7:	c9                   	leave
+ 3e8:	c3                   	ret
+
+000003e9 <nice>:
+
+// Add inc to the caller's nice value; return the new value.
+int
+nice(int inc)
+{
+ 3e9:	55                   	push   %ebp
+ 3ea:	89 e5                	mov    %esp,%ebp
+ 3ec:	83 ec 18             	sub    $0x18,%esp
+    int n;
+
+    n = getpriority(0) + inc;
+ 3ef:	83 ec 0c             	sub    $0xc,%esp
+ 3f2:	6a 00                	push   $0x0
+ 3f4:	e8 d9 01 00 00       	call   5d2 <getpriority>
+ 3f9:	83 c4 10             	add    $0x10,%esp
+ 3fc:	8b 55 08             	mov    0x8(%ebp),%edx
+ 3ff:	01 d0                	add    %edx,%eax
+ 401:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(n < 0)
+ 404:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 408:	79 07                	jns    411 <nice+0x28>
+        n = 0;
+ 40a:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    if(n > NICEMAX)
+ 411:	83 7d f4 13          	cmpl   $0x13,-0xc(%ebp)
+ 415:	7e 07                	jle    41e <nice+0x35>
+        n = NICEMAX;
+ 417:	c7 45 f4 13 00 00 00 	movl   $0x13,-0xc(%ebp)
+    if(setpriority(0, n) < 0)
+ 41e:	83 ec 08             	sub    $0x8,%esp
+ 421:	ff 75 f4             	push   -0xc(%ebp)
+ 424:	6a 00                	push   $0x0
+ 426:	e8 b1 01 00 00       	call   5dc <setpriority>
+ 42b:	83 c4 10             	add    $0x10,%esp
+ 42e:	85 c0                	test   %eax,%eax
+ 430:	79 07                	jns    439 <nice+0x50>
+        return -1;
+ 432:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 437:	eb 03                	jmp    43c <nice+0x53>
+    return n;
+ 439:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+ 43c:	c9                   	leave
+ 43d:	c3                   	ret
+
+0000043e <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 43e:	55                   	push   %ebp
+ 43f:	89 e5                	mov    %esp,%ebp
+ 441:	83 ec 10             	sub    $0x10,%esp
+    char *dst;
+    const char *src;
+
+    dst = vdst;
+ 444:	8b 45 08             	mov    0x8(%ebp),%eax
+ 447:	89 45 fc             	mov    %eax,-0x4(%ebp)
+    src = vsrc;
+ 44a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 44d:	89 45 f8             	mov    %eax,-0x8(%ebp)
+    while(n-- > 0)
+ 450:	eb 17                	jmp    469 <memmove+0x2b>
+        *dst++ = *src++;
+ 452:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 455:	8d 42 01             	lea    0x1(%edx),%eax
+ 458:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 45b:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 45e:	8d 48 01             	lea    0x1(%eax),%ecx
+ 461:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+ 464:	0f b6 12             	movzbl (%edx),%edx
+ 467:	88 10                	mov    %dl,(%eax)
+    while(n-- > 0)
+ 469:	8b 45 10             	mov    0x10(%ebp),%eax
+ 46c:	8d 50 ff             	lea    -0x1(%eax),%edx
+ 46f:	89 55 10             	mov    %edx,0x10(%ebp)
+ 472:	85 c0                	test   %eax,%eax
+ 474:	7f dc                	jg     452 <memmove+0x14>
+    return vdst;
+ 476:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 479:	c9                   	leave
+ 47a:	c3                   	ret
+
+0000047b <dosyscall>:
+sysmode:
+    .long 0
+
+    .text
+dosyscall:
+    cmpl $0, sysmode
+ 47b:	83 3d 68 0e 00 00 00 	cmpl   $0x0,0xe68
+    jg 2f
+ 482:	7f 0c                	jg     490 <dosyscall+0x15>
+    jl 1f
+ 484:	7c 07                	jl     48d <dosyscall+0x12>
+    call sepcheck
+ 486:	e8 27 00 00 00       	call   4b2 <sepcheck>
+    jmp dosyscall
+ 48b:	eb ee                	jmp    47b <dosyscall>
+1:
+    int $T_SYSCALL
+ 48d:	cd 40                	int    $0x40
+    ret
+ 48f:	c3                   	ret
+2:
+    pushl %ebx
+ 490:	53                   	push   %ebx
+    pushl %esi
+ 491:	56                   	push   %esi
+    pushl %edi
+ 492:	57                   	push   %edi
+    pushl %ebp
+ 493:	55                   	push   %ebp
+    movl 20(%esp), %ebx
+ 494:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+    movl 24(%esp), %esi
+ 498:	8b 74 24 18          	mov    0x18(%esp),%esi
+    movl 28(%esp), %edi
+ 49c:	8b 7c 24 1c          	mov    0x1c(%esp),%edi
+    movl 32(%esp), %ebp
+ 4a0:	8b 6c 24 20          	mov    0x20(%esp),%ebp
+    movl %esp, %ecx
+ 4a4:	89 e1                	mov    %esp,%ecx
+    movl $3f, %edx
+ 4a6:	ba ad 04 00 00       	mov    $0x4ad,%edx
+    sysenter
+ 4ab:	0f 34                	sysenter
+3:
+    popl %ebp
+ 4ad:	5d                   	pop    %ebp
+    popl %edi
+ 4ae:	5f                   	pop    %edi
+    popl %esi
+ 4af:	5e                   	pop    %esi
+    popl %ebx
+ 4b0:	5b                   	pop    %ebx
+    ret
+ 4b1:	c3                   	ret
+
+000004b2 <sepcheck>:
+
+# Set sysmode from cpuid's SEP flag.    Preserves %eax.
+sepcheck:
+    pushl %eax
+ 4b2:	50                   	push   %eax
+    pushl %ebx
+ 4b3:	53                   	push   %ebx
+    movl $1, %eax
+ 4b4:	b8 01 00 00 00       	mov    $0x1,%eax
+    cpuid
+ 4b9:	0f a2                	cpuid
+    movl $-1, sysmode
+ 4bb:	c7 05 68 0e 00 00 ff 	movl   $0xffffffff,0xe68
+ 4c2:	ff ff ff 
+    testl $0x800, %edx
+ 4c5:	f7 c2 00 08 00 00    	test   $0x800,%edx
+    jz 1f
+ 4cb:	74 0a                	je     4d7 <sepcheck+0x25>
+    movl $1, sysmode
+ 4cd:	c7 05 68 0e 00 00 01 	movl   $0x1,0xe68
+ 4d4:	00 00 00 
+1:
+    popl %ebx
+ 4d7:	5b                   	pop    %ebx
+    popl %eax
+ 4d8:	58                   	pop    %eax
+    ret
+ 4d9:	c3                   	ret
+
+000004da <fork>:
+
+SYSCALL(fork)
+ 4da:	b8 01 00 00 00       	mov    $0x1,%eax
+ 4df:	eb 9a                	jmp    47b <dosyscall>
+
+000004e1 <exit>:
+SYSCALL(exit)
+ 4e1:	b8 02 00 00 00       	mov    $0x2,%eax
+ 4e6:	eb 93                	jmp    47b <dosyscall>
+
+000004e8 <wait>:
+SYSCALL(wait)
+ 4e8:	b8 03 00 00 00       	mov    $0x3,%eax
+ 4ed:	eb 8c                	jmp    47b <dosyscall>
+
+000004ef <pipe>:
+SYSCALL(pipe)
+ 4ef:	b8 04 00 00 00       	mov    $0x4,%eax
+ 4f4:	eb 85                	jmp    47b <dosyscall>
+
+000004f6 <read>:
+SYSCALL(read)
+ 4f6:	b8 05 00 00 00       	mov    $0x5,%eax
+ 4fb:	e9 7b ff ff ff       	jmp    47b <dosyscall>
+
+00000500 <write>:
+SYSCALL(write)
+ 500:	b8 10 00 00 00       	mov    $0x10,%eax
+ 505:	e9 71 ff ff ff       	jmp    47b <dosyscall>
+
+0000050a <close>:
+SYSCALL(close)
+ 50a:	b8 15 00 00 00       	mov    $0x15,%eax
+ 50f:	e9 67 ff ff ff       	jmp    47b <dosyscall>
+
+00000514 <kill>:
+SYSCALL(kill)
+ 514:	b8 06 00 00 00       	mov    $0x6,%eax
+ 519:	e9 5d ff ff ff       	jmp    47b <dosyscall>
+
+0000051e <exec>:
+SYSCALL(exec)
+ 51e:	b8 07 00 00 00       	mov    $0x7,%eax
+ 523:	e9 53 ff ff ff       	jmp    47b <dosyscall>
+
+00000528 <open>:
+SYSCALL(open)
+ 528:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 52d:	e9 49 ff ff ff       	jmp    47b <dosyscall>
+
+00000532 <mknod>:
+SYSCALL(mknod)
+ 532:	b8 11 00 00 00       	mov    $0x11,%eax
+ 537:	e9 3f ff ff ff       	jmp    47b <dosyscall>
+
+0000053c <unlink>:
+SYSCALL(unlink)
+ 53c:	b8 12 00 00 00       	mov    $0x12,%eax
+ 541:	e9 35 ff ff ff       	jmp    47b <dosyscall>
+
+00000546 <fstat>:
+SYSCALL(fstat)
+ 546:	b8 08 00 00 00       	mov    $0x8,%eax
+ 54b:	e9 2b ff ff ff       	jmp    47b <dosyscall>
+
+00000550 <link>:
+SYSCALL(link)
+ 550:	b8 13 00 00 00       	mov    $0x13,%eax
+ 555:	e9 21 ff ff ff       	jmp    47b <dosyscall>
+
+0000055a <mkdir>:
+SYSCALL(mkdir)
+ 55a:	b8 14 00 00 00       	mov    $0x14,%eax
+ 55f:	e9 17 ff ff ff       	jmp    47b <dosyscall>
+
+00000564 <chdir>:
+SYSCALL(chdir)
+ 564:	b8 09 00 00 00       	mov    $0x9,%eax
+ 569:	e9 0d ff ff ff       	jmp    47b <dosyscall>
+
+0000056e <dup>:
+SYSCALL(dup)
+ 56e:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 573:	e9 03 ff ff ff       	jmp    47b <dosyscall>
+
+00000578 <getpid>:
+SYSCALL(getpid)
+ 578:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 57d:	e9 f9 fe ff ff       	jmp    47b <dosyscall>
+
+00000582 <sbrk>:
+SYSCALL(sbrk)
+ 582:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 587:	e9 ef fe ff ff       	jmp    47b <dosyscall>
+
+0000058c <sleep>:
+SYSCALL(sleep)
+ 58c:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 591:	e9 e5 fe ff ff       	jmp    47b <dosyscall>
+
+00000596 <uptime>:
+SYSCALL(uptime)
+ 596:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 59b:	e9 db fe ff ff       	jmp    47b <dosyscall>
+
+000005a0 <date>:
+SYSCALL(date)
+ 5a0:	b8 16 00 00 00       	mov    $0x16,%eax
+ 5a5:	e9 d1 fe ff ff       	jmp    47b <dosyscall>
+
+000005aa <dup2>:
+SYSCALL(dup2)
+ 5aa:	b8 17 00 00 00       	mov    $0x17,%eax
+ 5af:	e9 c7 fe ff ff       	jmp    47b <dosyscall>
+
+000005b4 <uffd>:
+SYSCALL(uffd)
+ 5b4:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 5b9:	e9 bd fe ff ff       	jmp    47b <dosyscall>
+
+000005be <uffdregister>:
+SYSCALL(uffdregister)
+ 5be:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 5c3:	e9 b3 fe ff ff       	jmp    47b <dosyscall>
+
+000005c8 <uffdcopy>:
+SYSCALL(uffdcopy)
+ 5c8:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 5cd:	e9 a9 fe ff ff       	jmp    47b <dosyscall>
+
+000005d2 <getpriority>:
+SYSCALL(getpriority)
+ 5d2:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 5d7:	e9 9f fe ff ff       	jmp    47b <dosyscall>
+
+000005dc <setpriority>:
+SYSCALL(setpriority)
+ 5dc:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 5e1:	e9 95 fe ff ff       	jmp    47b <dosyscall>
+
+000005e6 <setweight>:
+SYSCALL(setweight)
+ 5e6:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 5eb:	e9 8b fe ff ff       	jmp    47b <dosyscall>
+
+000005f0 <setgroup>:
+SYSCALL(setgroup)
+ 5f0:	b8 20 00 00 00       	mov    $0x20,%eax
+ 5f5:	e9 81 fe ff ff       	jmp    47b <dosyscall>
+
+000005fa <schedinfo>:
+SYSCALL(schedinfo)
+ 5fa:	b8 21 00 00 00       	mov    $0x21,%eax
+ 5ff:	e9 77 fe ff ff       	jmp    47b <dosyscall>
+
+00000604 <nanosleep>:
+SYSCALL(nanosleep)
+ 604:	b8 22 00 00 00       	mov    $0x22,%eax
+ 609:	e9 6d fe ff ff       	jmp    47b <dosyscall>
+
+0000060e <clock_nanosleep>:
+SYSCALL(clock_nanosleep)
+ 60e:	b8 23 00 00 00       	mov    $0x23,%eax
+ 613:	e9 63 fe ff ff       	jmp    47b <dosyscall>
+
+00000618 <clock_gettime>:
+SYSCALL(clock_gettime)
+ 618:	b8 24 00 00 00       	mov    $0x24,%eax
+ 61d:	e9 59 fe ff ff       	jmp    47b <dosyscall>
+
+00000622 <sched_setaffinity>:
+SYSCALL(sched_setaffinity)
+ 622:	b8 25 00 00 00       	mov    $0x25,%eax
+ 627:	e9 4f fe ff ff       	jmp    47b <dosyscall>
+
+0000062c <sched_getaffinity>:
+SYSCALL(sched_getaffinity)
+ 62c:	b8 26 00 00 00       	mov    $0x26,%eax
+ 631:	e9 45 fe ff ff       	jmp    47b <dosyscall>
+
+00000636 <irqaffinity>:
+SYSCALL(irqaffinity)
+ 636:	b8 27 00 00 00       	mov    $0x27,%eax
+ 63b:	e9 3b fe ff ff       	jmp    47b <dosyscall>
+
+00000640 <getrusage>:
+SYSCALL(getrusage)
+ 640:	b8 28 00 00 00       	mov    $0x28,%eax
+ 645:	e9 31 fe ff ff       	jmp    47b <dosyscall>
+
+0000064a <times>:
+SYSCALL(times)
+ 64a:	b8 29 00 00 00       	mov    $0x29,%eax
+ 64f:	e9 27 fe ff ff       	jmp    47b <dosyscall>
+
+00000654 <schedlat>:
+SYSCALL(schedlat)
+ 654:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 659:	e9 1d fe ff ff       	jmp    47b <dosyscall>
+
+0000065e <sched_setscheduler>:
+SYSCALL(sched_setscheduler)
+ 65e:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 663:	e9 13 fe ff ff       	jmp    47b <dosyscall>
+
+00000668 <sched_getscheduler>:
+SYSCALL(sched_getscheduler)
+ 668:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 66d:	e9 09 fe ff ff       	jmp    47b <dosyscall>
+
+00000672 <sched_getparam>:
+SYSCALL(sched_getparam)
+ 672:	b8 2d 00 00 00       	mov    $0x2d,%eax
+ 677:	e9 ff fd ff ff       	jmp    47b <dosyscall>
+
+0000067c <lockstat>:
+SYSCALL(lockstat)
+ 67c:	b8 2e 00 00 00       	mov    $0x2e,%eax
+ 681:	e9 f5 fd ff ff       	jmp    47b <dosyscall>
+
+00000686 <ioring_setup>:
+SYSCALL(ioring_setup)
+ 686:	b8 2f 00 00 00       	mov    $0x2f,%eax
+ 68b:	e9 eb fd ff ff       	jmp    47b <dosyscall>
+
+00000690 <ioring_enter>:
+SYSCALL(ioring_enter)
+ 690:	b8 30 00 00 00       	mov    $0x30,%eax
+ 695:	e9 e1 fd ff ff       	jmp    47b <dosyscall>
+
+0000069a <readv>:
+SYSCALL(readv)
+ 69a:	b8 31 00 00 00       	mov    $0x31,%eax
+ 69f:	e9 d7 fd ff ff       	jmp    47b <dosyscall>
+
+000006a4 <writev>:
+SYSCALL(writev)
+ 6a4:	b8 32 00 00 00       	mov    $0x32,%eax
+ 6a9:	e9 cd fd ff ff       	jmp    47b <dosyscall>
+
+000006ae <pread>:
+SYSCALL(pread)
+ 6ae:	b8 33 00 00 00       	mov    $0x33,%eax
+ 6b3:	e9 c3 fd ff ff       	jmp    47b <dosyscall>
+
+000006b8 <pwrite>:
+SYSCALL(pwrite)
+ 6b8:	b8 34 00 00 00       	mov    $0x34,%eax
+ 6bd:	e9 b9 fd ff ff       	jmp    47b <dosyscall>
+
+000006c2 <sendfile>:
+SYSCALL(sendfile)
+ 6c2:	b8 35 00 00 00       	mov    $0x35,%eax
+ 6c7:	e9 af fd ff ff       	jmp    47b <dosyscall>
+
+000006cc <splice>:
+SYSCALL(splice)
+ 6cc:	b8 36 00 00 00       	mov    $0x36,%eax
+ 6d1:	e9 a5 fd ff ff       	jmp    47b <dosyscall>
+
+000006d6 <sysstat>:
+SYSCALL(sysstat)
+ 6d6:	b8 37 00 00 00       	mov    $0x37,%eax
+ 6db:	e9 9b fd ff ff       	jmp    47b <dosyscall>
+
+000006e0 <strace>:
+SYSCALL(strace)
+ 6e0:	b8 38 00 00 00       	mov    $0x38,%eax
+ 6e5:	e9 91 fd ff ff       	jmp    47b <dosyscall>
+
+000006ea <straceread>:
+SYSCALL(straceread)
+ 6ea:	b8 39 00 00 00       	mov    $0x39,%eax
+ 6ef:	e9 87 fd ff ff       	jmp    47b <dosyscall>
+
+000006f4 <alarm>:
+
+# alarm and rstoregs keep to int $T_SYSCALL: rstoregs restores
+# %ecx and %edx, which sysexit would clobber.
+.globl alarm
+    alarm:
+        pushl $rstoregs
+ 6f4:	68 04 07 00 00       	push   $0x704
+        movl $SYS_alarm, %eax
+ 6f9:	b8 18 00 00 00       	mov    $0x18,%eax
+        int $T_SYSCALL
+ 6fe:	cd 40                	int    $0x40
+        add $0x04, %esp
+ 700:	83 c4 04             	add    $0x4,%esp
+        ret
+ 703:	c3                   	ret
+
+00000704 <rstoregs>:
+
+.globl rstoregs
+    rstoregs:
+        movl $SYS_rstoregs, %eax
+ 704:	b8 19 00 00 00       	mov    $0x19,%eax
+        int $T_SYSCALL
+ 709:	cd 40                	int    $0x40
+
+0000070b <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 70b:	55                   	push   %ebp
+ 70c:	89 e5                	mov    %esp,%ebp
+ 70e:	83 ec 18             	sub    $0x18,%esp
+ 711:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 714:	88 45 f4             	mov    %al,-0xc(%ebp)
+    write(fd, &c, 1);
+ 717:	83 ec 04             	sub    $0x4,%esp
+ 71a:	6a 01                	push   $0x1
+ 71c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+ 71f:	50                   	push   %eax
+ 720:	ff 75 08             	push   0x8(%ebp)
+ 723:	e8 d8 fd ff ff       	call   500 <write>
+ 728:	83 c4 10             	add    $0x10,%esp
+}
+ 72b:	90                   	nop
+ 72c:	c9                   	leave
+ 72d:	c3                   	ret
+
+0000072e <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 72e:	55                   	push   %ebp
+ 72f:	89 e5                	mov    %esp,%ebp
+ 731:	83 ec 28             	sub    $0x28,%esp
+    static char digits[] = "0123456789ABCDEF";
+    char buf[16];
+    int i, neg;
+    uint x;
+
+    neg = 0;
+ 734:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+    if(sgn && xx < 0){
+ 73b:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+ 73f:	74 17                	je     758 <printint+0x2a>
+ 741:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 745:	79 11                	jns    758 <printint+0x2a>
+        neg = 1;
+ 747:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+        x = -xx;
+ 74e:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 751:	f7 d8                	neg    %eax
+ 753:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 756:	eb 06                	jmp    75e <printint+0x30>
+    } else {
+        x = xx;
+ 758:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 75b:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    }
+
+    i = 0;
+ 75e:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    do{
+        buf[i++] = digits[x % base];
+ 765:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 768:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 76b:	ba 00 00 00 00       	mov    $0x0,%edx
+ 770:	f7 f1                	div    %ecx
+ 772:	89 d1                	mov    %edx,%ecx
+ 774:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 777:	8d 50 01             	lea    0x1(%eax),%edx
+ 77a:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 77d:	0f b6 91 6c 0e 00 00 	movzbl 0xe6c(%ecx),%edx
+ 784:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+    }while((x /= base) != 0);
+ 788:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 78b:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 78e:	ba 00 00 00 00       	mov    $0x0,%edx
+ 793:	f7 f1                	div    %ecx
+ 795:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 798:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 79c:	75 c7                	jne    765 <printint+0x37>
+    if(neg)
+ 79e:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 7a2:	74 2d                	je     7d1 <printint+0xa3>
+        buf[i++] = '-';
+ 7a4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 7a7:	8d 50 01             	lea    0x1(%eax),%edx
+ 7aa:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 7ad:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+    while(--i >= 0)
+ 7b2:	eb 1d                	jmp    7d1 <printint+0xa3>
+        putc(fd, buf[i]);
+ 7b4:	8d 55 dc             	lea    -0x24(%ebp),%edx
+ 7b7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 7ba:	01 d0                	add    %edx,%eax
+ 7bc:	0f b6 00             	movzbl (%eax),%eax
+ 7bf:	0f be c0             	movsbl %al,%eax
+ 7c2:	83 ec 08             	sub    $0x8,%esp
+ 7c5:	50                   	push   %eax
+ 7c6:	ff 75 08             	push   0x8(%ebp)
+ 7c9:	e8 3d ff ff ff       	call   70b <putc>
+ 7ce:	83 c4 10             	add    $0x10,%esp
+    while(--i >= 0)
+ 7d1:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+ 7d5:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 7d9:	79 d9                	jns    7b4 <printint+0x86>
+}
+ 7db:	90                   	nop
+ 7dc:	90                   	nop
+ 7dd:	c9                   	leave
+ 7de:	c3                   	ret
+
+000007df <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 7df:	55                   	push   %ebp
+ 7e0:	89 e5                	mov    %esp,%ebp
+ 7e2:	83 ec 28             	sub    $0x28,%esp
+    char *s;
+    int c, i, state;
+    uint *ap;
+
+    state = 0;
+ 7e5:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+    ap = (uint*)(void*)&fmt + 1;
+ 7ec:	8d 45 0c             	lea    0xc(%ebp),%eax
+ 7ef:	83 c0 04             	add    $0x4,%eax
+ 7f2:	89 45 e8             	mov    %eax,-0x18(%ebp)
+    for(i = 0; fmt[i]; i++){
+ 7f5:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 7fc:	e9 59 01 00 00       	jmp    95a <printf+0x17b>
+        c = fmt[i] & 0xff;
+ 801:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 804:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 807:	01 d0                	add    %edx,%eax
+ 809:	0f b6 00             	movzbl (%eax),%eax
+ 80c:	0f be c0             	movsbl %al,%eax
+ 80f:	25 ff 00 00 00       	and    $0xff,%eax
+ 814:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        if(state == 0){
+ 817:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 81b:	75 2c                	jne    849 <printf+0x6a>
+            if(c == '%'){
+ 81d:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 821:	75 0c                	jne    82f <printf+0x50>
+                state = '%';
+ 823:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+ 82a:	e9 27 01 00 00       	jmp    956 <printf+0x177>
+            } else {
+                putc(fd, c);
+ 82f:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 832:	0f be c0             	movsbl %al,%eax
+ 835:	83 ec 08             	sub    $0x8,%esp
+ 838:	50                   	push   %eax
+ 839:	ff 75 08             	push   0x8(%ebp)
+ 83c:	e8 ca fe ff ff       	call   70b <putc>
+ 841:	83 c4 10             	add    $0x10,%esp
+ 844:	e9 0d 01 00 00       	jmp    956 <printf+0x177>
+            }
+        } else if(state == '%'){
+ 849:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+ 84d:	0f 85 03 01 00 00    	jne    956 <printf+0x177>
+            if(c == 'd'){
+ 853:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+ 857:	75 1e                	jne    877 <printf+0x98>
+                printint(fd, *ap, 10, 1);
+ 859:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 85c:	8b 00                	mov    (%eax),%eax
+ 85e:	6a 01                	push   $0x1
+ 860:	6a 0a                	push   $0xa
+ 862:	50                   	push   %eax
+ 863:	ff 75 08             	push   0x8(%ebp)
+ 866:	e8 c3 fe ff ff       	call   72e <printint>
+ 86b:	83 c4 10             	add    $0x10,%esp
+                ap++;
+ 86e:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 872:	e9 d8 00 00 00       	jmp    94f <printf+0x170>
+            } else if(c == 'x' || c == 'p'){
+ 877:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+ 87b:	74 06                	je     883 <printf+0xa4>
+ 87d:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+ 881:	75 1e                	jne    8a1 <printf+0xc2>
+                printint(fd, *ap, 16, 0);
+ 883:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 886:	8b 00                	mov    (%eax),%eax
+ 888:	6a 00                	push   $0x0
+ 88a:	6a 10                	push   $0x10
+ 88c:	50                   	push   %eax
+ 88d:	ff 75 08             	push   0x8(%ebp)
+ 890:	e8 99 fe ff ff       	call   72e <printint>
+ 895:	83 c4 10             	add    $0x10,%esp
+                ap++;
+ 898:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 89c:	e9 ae 00 00 00       	jmp    94f <printf+0x170>
+            } else if(c == 's'){
+ 8a1:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+ 8a5:	75 43                	jne    8ea <printf+0x10b>
+                s = (char*)*ap;
+ 8a7:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 8aa:	8b 00                	mov    (%eax),%eax
+ 8ac:	89 45 f4             	mov    %eax,-0xc(%ebp)
+                ap++;
+ 8af:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+                if(s == 0)
+ 8b3:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 8b7:	75 25                	jne    8de <printf+0xff>
+                    s = "(null)";
+ 8b9:	c7 45 f4 f6 0b 00 00 	movl   $0xbf6,-0xc(%ebp)
+                while(*s != 0){
+ 8c0:	eb 1c                	jmp    8de <printf+0xff>
+                    putc(fd, *s);
+ 8c2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 8c5:	0f b6 00             	movzbl (%eax),%eax
+ 8c8:	0f be c0             	movsbl %al,%eax
+ 8cb:	83 ec 08             	sub    $0x8,%esp
+ 8ce:	50                   	push   %eax
+ 8cf:	ff 75 08             	push   0x8(%ebp)
+ 8d2:	e8 34 fe ff ff       	call   70b <putc>
+ 8d7:	83 c4 10             	add    $0x10,%esp
+                    s++;
+ 8da:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+                while(*s != 0){
+ 8de:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 8e1:	0f b6 00             	movzbl (%eax),%eax
+ 8e4:	84 c0                	test   %al,%al
+ 8e6:	75 da                	jne    8c2 <printf+0xe3>
+ 8e8:	eb 65                	jmp    94f <printf+0x170>
+                }
+            } else if(c == 'c'){
+ 8ea:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+ 8ee:	75 1d                	jne    90d <printf+0x12e>
+                putc(fd, *ap);
+ 8f0:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 8f3:	8b 00                	mov    (%eax),%eax
+ 8f5:	0f be c0             	movsbl %al,%eax
+ 8f8:	83 ec 08             	sub    $0x8,%esp
+ 8fb:	50                   	push   %eax
+ 8fc:	ff 75 08             	push   0x8(%ebp)
+ 8ff:	e8 07 fe ff ff       	call   70b <putc>
+ 904:	83 c4 10             	add    $0x10,%esp
+                ap++;
+ 907:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 90b:	eb 42                	jmp    94f <printf+0x170>
+            } else if(c == '%'){
+ 90d:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 911:	75 17                	jne    92a <printf+0x14b>
+                putc(fd, c);
+ 913:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 916:	0f be c0             	movsbl %al,%eax
+ 919:	83 ec 08             	sub    $0x8,%esp
+ 91c:	50                   	push   %eax
+ 91d:	ff 75 08             	push   0x8(%ebp)
+ 920:	e8 e6 fd ff ff       	call   70b <putc>
+ 925:	83 c4 10             	add    $0x10,%esp
+ 928:	eb 25                	jmp    94f <printf+0x170>
+            } else {
+                // Unknown % sequence.    Print it to draw attention.
+                putc(fd, '%');
+ 92a:	83 ec 08             	sub    $0x8,%esp
+ 92d:	6a 25                	push   $0x25
+ 92f:	ff 75 08             	push   0x8(%ebp)
+ 932:	e8 d4 fd ff ff       	call   70b <putc>
+ 937:	83 c4 10             	add    $0x10,%esp
+                putc(fd, c);
+ 93a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 93d:	0f be c0             	movsbl %al,%eax
+ 940:	83 ec 08             	sub    $0x8,%esp
+ 943:	50                   	push   %eax
+ 944:	ff 75 08             	push   0x8(%ebp)
+ 947:	e8 bf fd ff ff       	call   70b <putc>
+ 94c:	83 c4 10             	add    $0x10,%esp
+            }
+            state = 0;
+ 94f:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+    for(i = 0; fmt[i]; i++){
+ 956:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ 95a:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 95d:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 960:	01 d0                	add    %edx,%eax
+ 962:	0f b6 00             	movzbl (%eax),%eax
+ 965:	84 c0                	test   %al,%al
+ 967:	0f 85 94 fe ff ff    	jne    801 <printf+0x22>
+        }
+    }
+}
+ 96d:	90                   	nop
+ 96e:	90                   	nop
+ 96f:	c9                   	leave
+ 970:	c3                   	ret
+
+00000971 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 971:	55                   	push   %ebp
+ 972:	89 e5                	mov    %esp,%ebp
+ 974:	83 ec 10             	sub    $0x10,%esp
+    Header *bp, *p;
+
+    bp = (Header*)ap - 1;
+ 977:	8b 45 08             	mov    0x8(%ebp),%eax
+ 97a:	83 e8 08             	sub    $0x8,%eax
+ 97d:	89 45 f8             	mov    %eax,-0x8(%ebp)
+    for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 980:	a1 88 0e 00 00       	mov    0xe88,%eax
+ 985:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 988:	eb 24                	jmp    9ae <free+0x3d>
+        if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 98a:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 98d:	8b 00                	mov    (%eax),%eax
+ 98f:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 992:	72 12                	jb     9a6 <free+0x35>
+ 994:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 997:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 99a:	72 24                	jb     9c0 <free+0x4f>
+ 99c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 99f:	8b 00                	mov    (%eax),%eax
+ 9a1:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 9a4:	72 1a                	jb     9c0 <free+0x4f>
+    for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 9a6:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 9a9:	8b 00                	mov    (%eax),%eax
+ 9ab:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 9ae:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 9b1:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 9b4:	73 d4                	jae    98a <free+0x19>
+ 9b6:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 9b9:	8b 00                	mov    (%eax),%eax
+ 9bb:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 9be:	73 ca                	jae    98a <free+0x19>
+            break;
+    if(bp + bp->s.size == p->s.ptr){
+ 9c0:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 9c3:	8b 40 04             	mov    0x4(%eax),%eax
+ 9c6:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 9cd:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 9d0:	01 c2                	add    %eax,%edx
+ 9d2:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 9d5:	8b 00                	mov    (%eax),%eax
+ 9d7:	39 c2                	cmp    %eax,%edx
+ 9d9:	75 24                	jne    9ff <free+0x8e>
+        bp->s.size += p->s.ptr->s.size;
+ 9db:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 9de:	8b 50 04             	mov    0x4(%eax),%edx
+ 9e1:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 9e4:	8b 00                	mov    (%eax),%eax
+ 9e6:	8b 40 04             	mov    0x4(%eax),%eax
+ 9e9:	01 c2                	add    %eax,%edx
+ 9eb:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 9ee:	89 50 04             	mov    %edx,0x4(%eax)
+        bp->s.ptr = p->s.ptr->s.ptr;
+ 9f1:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 9f4:	8b 00                	mov    (%eax),%eax
+ 9f6:	8b 10                	mov    (%eax),%edx
+ 9f8:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 9fb:	89 10                	mov    %edx,(%eax)
+ 9fd:	eb 0a                	jmp    a09 <free+0x98>
+    } else
+        bp->s.ptr = p->s.ptr;
+ 9ff:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a02:	8b 10                	mov    (%eax),%edx
+ a04:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ a07:	89 10                	mov    %edx,(%eax)
+    if(p + p->s.size == bp){
+ a09:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a0c:	8b 40 04             	mov    0x4(%eax),%eax
+ a0f:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ a16:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a19:	01 d0                	add    %edx,%eax
+ a1b:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ a1e:	75 20                	jne    a40 <free+0xcf>
+        p->s.size += bp->s.size;
+ a20:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a23:	8b 50 04             	mov    0x4(%eax),%edx
+ a26:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ a29:	8b 40 04             	mov    0x4(%eax),%eax
+ a2c:	01 c2                	add    %eax,%edx
+ a2e:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a31:	89 50 04             	mov    %edx,0x4(%eax)
+        p->s.ptr = bp->s.ptr;
+ a34:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ a37:	8b 10                	mov    (%eax),%edx
+ a39:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a3c:	89 10                	mov    %edx,(%eax)
+ a3e:	eb 08                	jmp    a48 <free+0xd7>
+    } else
+        p->s.ptr = bp;
+ a40:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a43:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ a46:	89 10                	mov    %edx,(%eax)
+    freep = p;
+ a48:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a4b:	a3 88 0e 00 00       	mov    %eax,0xe88
+}
+ a50:	90                   	nop
+ a51:	c9                   	leave
+ a52:	c3                   	ret
+
+00000a53 <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+ a53:	55                   	push   %ebp
+ a54:	89 e5                	mov    %esp,%ebp
+ a56:	83 ec 18             	sub    $0x18,%esp
+    char *p;
+    Header *hp;
+
+    if(nu < 4096)
+ a59:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+ a60:	77 07                	ja     a69 <morecore+0x16>
+        nu = 4096;
+ a62:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+    p = sbrk(nu * sizeof(Header));
+ a69:	8b 45 08             	mov    0x8(%ebp),%eax
+ a6c:	c1 e0 03             	shl    $0x3,%eax
+ a6f:	83 ec 0c             	sub    $0xc,%esp
+ a72:	50                   	push   %eax
+ a73:	e8 0a fb ff ff       	call   582 <sbrk>
+ a78:	83 c4 10             	add    $0x10,%esp
+ a7b:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p == (char*)-1)
+ a7e:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+ a82:	75 07                	jne    a8b <morecore+0x38>
+        return 0;
+ a84:	b8 00 00 00 00       	mov    $0x0,%eax
+ a89:	eb 26                	jmp    ab1 <morecore+0x5e>
+    hp = (Header*)p;
+ a8b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a8e:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    hp->s.size = nu;
+ a91:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ a94:	8b 55 08             	mov    0x8(%ebp),%edx
+ a97:	89 50 04             	mov    %edx,0x4(%eax)
+    free((void*)(hp + 1));
+ a9a:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ a9d:	83 c0 08             	add    $0x8,%eax
+ aa0:	83 ec 0c             	sub    $0xc,%esp
+ aa3:	50                   	push   %eax
+ aa4:	e8 c8 fe ff ff       	call   971 <free>
+ aa9:	83 c4 10             	add    $0x10,%esp
+    return freep;
+ aac:	a1 88 0e 00 00       	mov    0xe88,%eax
+}
+ ab1:	c9                   	leave
+ ab2:	c3                   	ret
+
+00000ab3 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ ab3:	55                   	push   %ebp
+ ab4:	89 e5                	mov    %esp,%ebp
+ ab6:	83 ec 18             	sub    $0x18,%esp
+    Header *p, *prevp;
+    uint nunits;
+
+    nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ ab9:	8b 45 08             	mov    0x8(%ebp),%eax
+ abc:	83 c0 07             	add    $0x7,%eax
+ abf:	c1 e8 03             	shr    $0x3,%eax
+ ac2:	83 c0 01             	add    $0x1,%eax
+ ac5:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    if((prevp = freep) == 0){
+ ac8:	a1 88 0e 00 00       	mov    0xe88,%eax
+ acd:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ ad0:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ ad4:	75 23                	jne    af9 <malloc+0x46>
+        base.s.ptr = freep = prevp = &base;
+ ad6:	c7 45 f0 80 0e 00 00 	movl   $0xe80,-0x10(%ebp)
+ add:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ ae0:	a3 88 0e 00 00       	mov    %eax,0xe88
+ ae5:	a1 88 0e 00 00       	mov    0xe88,%eax
+ aea:	a3 80 0e 00 00       	mov    %eax,0xe80
+        base.s.size = 0;
+ aef:	c7 05 84 0e 00 00 00 	movl   $0x0,0xe84
+ af6:	00 00 00 
+    }
+    for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ af9:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ afc:	8b 00                	mov    (%eax),%eax
+ afe:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        if(p->s.size >= nunits){
+ b01:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b04:	8b 40 04             	mov    0x4(%eax),%eax
+ b07:	3b 45 ec             	cmp    -0x14(%ebp),%eax
+ b0a:	72 4d                	jb     b59 <malloc+0xa6>
+            if(p->s.size == nunits)
+ b0c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b0f:	8b 40 04             	mov    0x4(%eax),%eax
+ b12:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+ b15:	75 0c                	jne    b23 <malloc+0x70>
+                prevp->s.ptr = p->s.ptr;
+ b17:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b1a:	8b 10                	mov    (%eax),%edx
+ b1c:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ b1f:	89 10                	mov    %edx,(%eax)
+ b21:	eb 26                	jmp    b49 <malloc+0x96>
+            else {
+                p->s.size -= nunits;
+ b23:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b26:	8b 40 04             	mov    0x4(%eax),%eax
+ b29:	2b 45 ec             	sub    -0x14(%ebp),%eax
+ b2c:	89 c2                	mov    %eax,%edx
+ b2e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b31:	89 50 04             	mov    %edx,0x4(%eax)
+                p += p->s.size;
+ b34:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b37:	8b 40 04             	mov    0x4(%eax),%eax
+ b3a:	c1 e0 03             	shl    $0x3,%eax
+ b3d:	01 45 f4             	add    %eax,-0xc(%ebp)
+                p->s.size = nunits;
+ b40:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b43:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ b46:	89 50 04             	mov    %edx,0x4(%eax)
+            }
+            freep = prevp;
+ b49:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ b4c:	a3 88 0e 00 00       	mov    %eax,0xe88
+            return (void*)(p + 1);
+ b51:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b54:	83 c0 08             	add    $0x8,%eax
+ b57:	eb 3b                	jmp    b94 <malloc+0xe1>
+        }
+        if(p == freep)
+ b59:	a1 88 0e 00 00       	mov    0xe88,%eax
+ b5e:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ b61:	75 1e                	jne    b81 <malloc+0xce>
+            if((p = morecore(nunits)) == 0)
+ b63:	83 ec 0c             	sub    $0xc,%esp
+ b66:	ff 75 ec             	push   -0x14(%ebp)
+ b69:	e8 e5 fe ff ff       	call   a53 <morecore>
+ b6e:	83 c4 10             	add    $0x10,%esp
+ b71:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ b74:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ b78:	75 07                	jne    b81 <malloc+0xce>
+                return 0;
+ b7a:	b8 00 00 00 00       	mov    $0x0,%eax
+ b7f:	eb 13                	jmp    b94 <malloc+0xe1>
+    for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ b81:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b84:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ b87:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b8a:	8b 00                	mov    (%eax),%eax
+ b8c:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        if(p->s.size >= nunits){
+ b8f:	e9 6d ff ff ff       	jmp    b01 <malloc+0x4e>
+    }
+}
+ b94:	c9                   	leave
+ b95:	c3                   	ret
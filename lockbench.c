@@ -0,0 +1,55 @@
+// Spinlock contention benchmark: one process per cpu, each pinned
+// to its cpu, hammers ptable.lock through kill() of a pid that
+// does not exist.  Run it under CPUS=1 through CPUS=8 to see how
+// the cost of an acquire grows with the number of contenders.
+//
+//    lockbench [iters]
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "date.h"
+
+#define NOPID 0x7fffffff
+
+int
+main(int argc, char *argv[])
+{
+    int i, n, iters, ncpu, mask, us;
+    struct timespec t0, t1;
+
+    iters = 100000;
+    if(argc > 1)
+        iters = atoi(argv[1]);
+    mask = sched_getaffinity(0);
+    ncpu = 0;
+    for(i = 0; i < 32; i++)
+        if(mask & (1 << i))
+            ncpu++;
+
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    n = 0;
+    for(i = 0; i < 32; i++){
+        if((mask & (1 << i)) == 0)
+            continue;
+        switch(fork()){
+        case -1:
+            printf(2, "lockbench: fork failed\n");
+            exit();
+        case 0:
+            sched_setaffinity(0, 1 << i);
+            for(n = 0; n < iters; n++)
+                kill(NOPID);
+            exit();
+        }
+        n++;
+    }
+    while(n-- > 0)
+        wait();
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+
+    us = (t1.tv_sec - t0.tv_sec) * 1000000 + (t1.tv_nsec - t0.tv_nsec) / 1000;
+    printf(1, "lockbench: %d cpus x %d acquires in %d us, %d ns per acquire per cpu\n",
+        ncpu, iters, us, iters > 0 ? us / iters * 1000 + us % iters * 1000 / iters : 0);
+    exit();
+}
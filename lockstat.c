@@ -0,0 +1,209 @@
+// Lock statistics.
+//
+// While lockstat is on, acquire() and acquiresleep() count each
+// acquisition against the lock's class, all the locks of one kind
+// that share a name: how often it was taken, how often the caller
+// had to wait and for how long, and how long it was held.  Each
+// contended acquisition also counts the caller's pc in a small table
+// of call sites.  The counters are per cpu, so updating them needs
+// no lock; lockstat() adds them up.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "x86.h"
+#include "mmu.h"
+#include "spinlock.h"
+#include "proc.h"
+#include "lockstat.h"
+
+struct lockcpu {
+    uint nacquire;
+    uint ncontended;
+    uint64 wait;
+    uint64 maxwait;
+    uint64 maxhold;
+    uint sitepc[NLOCKSITE];
+    uint sitecount[NLOCKSITE];
+};
+
+struct lockclass {
+    char *name;
+    int sleep;
+    struct lockcpu cpu[NCPU];
+};
+
+static struct lockclass classes[NLOCKCLASS];
+static int nclass;
+
+// Protects classes and nclass.    Not a spinlock, which would
+// need a class of its own, and initlock() runs before mycpu() works.
+static uint classlock;
+
+int lockstaton;
+
+// Return the class for locks called name, sleeplocks if sleep is
+// set, adding it if it is new; or 0 if the table is full.
+struct lockclass*
+lockclass(char *name, int sleep)
+{
+    struct lockclass *lc;
+    uint eflags;
+
+    eflags = readeflags();
+    cli();
+    while(xchg(&classlock, 1) != 0)
+        pause();
+    for(lc = classes; lc < &classes[nclass]; lc++)
+        if(lc->sleep == sleep && strncmp(lc->name, name, LOCKNAME) == 0)
+            break;
+    if(lc == &classes[nclass]){
+        if(nclass < NLOCKCLASS){
+            lc->name = name;
+            lc->sleep = sleep;
+            nclass++;
+        } else
+            lc = 0;
+    }
+    xchg(&classlock, 0);
+    if(eflags & FL_IF)
+        sti();
+    return lc;
+}
+
+// Count a contended acquisition by pc.    When the table is full,
+// pc takes over the least-counted entry and its count, so that
+// a new hot site can climb past sites that have cooled.
+static void
+countsite(struct lockcpu *s, uint pc)
+{
+    int i, min;
+
+    min = 0;
+    for(i = 0; i < NLOCKSITE; i++){
+        if(s->sitepc[i] == pc){
+            s->sitecount[i]++;
+            return;
+        }
+        if(s->sitecount[i] < s->sitecount[min])
+            min = i;
+    }
+    s->sitepc[min] = pc;
+    s->sitecount[min]++;
+}
+
+// Count an acquisition of a lock of class lc by pc, after waiting
+// wait cycles if contended.
+void
+lockstatacquire(struct lockclass *lc, uint pc, int contended, uint64 wait)
+{
+    struct lockcpu *s;
+
+    if(lc == 0)
+        return;
+    pushcli();
+    s = &lc->cpu[cpuid()];
+    s->nacquire++;
+    if(contended){
+        s->ncontended++;
+        s->wait += wait;
+        if(wait > s->maxwait)
+            s->maxwait = wait;
+        countsite(s, pc);
+    }
+    popcli();
+}
+
+// Count the release of a lock of class lc held for hold cycles.
+void
+lockstatrelease(struct lockclass *lc, uint64 hold)
+{
+    struct lockcpu *s;
+
+    if(lc == 0)
+        return;
+    pushcli();
+    s = &lc->cpu[cpuid()];
+    if(hold > s->maxhold)
+        s->maxhold = hold;
+    popcli();
+}
+
+// Add up the counts of class lc into ls.
+static void
+sumclass(struct lockclass *lc, struct lockstat *ls)
+{
+    uint pcs[NLOCKSITE*NCPU], counts[NLOCKSITE*NCPU];
+    struct lockcpu *s;
+    int i, j, n, best;
+
+    memset(ls, 0, sizeof(*ls));
+    safestrcpy(ls->name, lc->name, sizeof(ls->name));
+    ls->sleep = lc->sleep;
+    n = 0;
+    for(s = lc->cpu; s < &lc->cpu[ncpu]; s++){
+        ls->nacquire += s->nacquire;
+        ls->ncontended += s->ncontended;
+        ls->wait += s->wait;
+        if(s->maxwait > ls->maxwait)
+            ls->maxwait = s->maxwait;
+        if(s->maxhold > ls->maxhold)
+            ls->maxhold = s->maxhold;
+        for(i = 0; i < NLOCKSITE; i++){
+            if(s->sitecount[i] == 0)
+                continue;
+            for(j = 0; j < n && pcs[j] != s->sitepc[i]; j++)
+                ;
+            if(j == n){
+                pcs[n] = s->sitepc[i];
+                counts[n++] = 0;
+            }
+            counts[j] += s->sitecount[i];
+        }
+    }
+    for(i = 0; i < NLOCKSITE; i++){
+        best = -1;
+        for(j = 0; j < n; j++)
+            if(counts[j] && (best < 0 || counts[j] > counts[best]))
+                best = j;
+        if(best < 0)
+            break;
+        ls->sitepc[i] = pcs[best];
+        ls->sitecount[i] = counts[best];
+        counts[best] = 0;
+    }
+}
+
+// Carry out lockstat command cmd.    LOCKSTAT_READ fills in up to
+// n entries of ls, for the classes that have been acquired, and
+// returns how many; the other commands return 0.
+// The counts are read and reset without locks, so a count racing
+// with either may be off by one.
+int
+lockstat(int cmd, struct lockstat *ls, int n)
+{
+    struct lockclass *lc;
+    int i;
+
+    switch(cmd){
+    case LOCKSTAT_READ:
+        i = 0;
+        for(lc = classes; lc < &classes[nclass] && i < n; lc++){
+            sumclass(lc, &ls[i]);
+            if(ls[i].nacquire > 0)
+                i++;
+        }
+        return i;
+    case LOCKSTAT_ON:
+        lockstaton = 1;
+        return 0;
+    case LOCKSTAT_OFF:
+        lockstaton = 0;
+        return 0;
+    case LOCKSTAT_RESET:
+        for(lc = classes; lc < &classes[nclass]; lc++)
+            memset(lc->cpu, 0, sizeof(lc->cpu));
+        return 0;
+    }
+    return -1;
+}
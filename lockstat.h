@@ -0,0 +1,23 @@
+// Lock statistics, for lockstat().
+#define LOCKSTAT_READ   0   // copy out one struct lockstat per class
+#define LOCKSTAT_ON     1   // start counting
+#define LOCKSTAT_OFF    2   // stop counting
+#define LOCKSTAT_RESET  3   // zero the counts
+
+#define NLOCKCLASS     64   // most lock classes counted
+#define NLOCKSITE       4   // call sites kept per lock class
+#define LOCKNAME       16   // longest lock name kept, with its nul
+
+// Totals for one lock class: the spinlocks, or the sleeplocks,
+// that share a name.  Times are in TSC cycles.
+struct lockstat {
+    char name[LOCKNAME];
+    int sleep;                      // 1 for sleeplocks
+    uint nacquire;
+    uint ncontended;                // acquisitions that had to wait
+    uint64 wait;                    // total time spent waiting
+    uint64 maxwait;
+    uint64 maxhold;
+    uint sitepc[NLOCKSITE];         // callers that waited most often,
+    uint sitecount[NLOCKSITE];      // most first
+};
@@ -0,0 +1,1865 @@
+
+_lockstats:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <printu64>:
+
+// Print v in decimal.    There is no 64-bit division here, so
+// divide by 10 sixteen bits at a time.
+void
+printu64(uint64 v)
+{
+   0:	55                   	push   %ebp
+   1:	89 e5                	mov    %esp,%ebp
+   3:	83 ec 48             	sub    $0x48,%esp
+   6:	8b 45 08             	mov    0x8(%ebp),%eax
+   9:	89 45 c0             	mov    %eax,-0x40(%ebp)
+   c:	8b 45 0c             	mov    0xc(%ebp),%eax
+   f:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+    ushort w[4];
+    char buf[24];
+    uint r, more;
+    int i, n;
+
+    for(i = 0; i < 4; i++)
+  12:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  19:	eb 2f                	jmp    4a <printu64+0x4a>
+        w[i] = v >> (48 - 16*i);
+  1b:	b8 03 00 00 00       	mov    $0x3,%eax
+  20:	2b 45 ec             	sub    -0x14(%ebp),%eax
+  23:	c1 e0 04             	shl    $0x4,%eax
+  26:	89 c1                	mov    %eax,%ecx
+  28:	8b 45 c0             	mov    -0x40(%ebp),%eax
+  2b:	8b 55 c4             	mov    -0x3c(%ebp),%edx
+  2e:	0f ad d0             	shrd   %cl,%edx,%eax
+  31:	d3 ea                	shr    %cl,%edx
+  33:	f6 c1 20             	test   $0x20,%cl
+  36:	74 04                	je     3c <printu64+0x3c>
+  38:	89 d0                	mov    %edx,%eax
+  3a:	31 d2                	xor    %edx,%edx
+  3c:	89 c2                	mov    %eax,%edx
+  3e:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  41:	66 89 54 45 e0       	mov    %dx,-0x20(%ebp,%eax,2)
+    for(i = 0; i < 4; i++)
+  46:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+  4a:	83 7d ec 03          	cmpl   $0x3,-0x14(%ebp)
+  4e:	7e cb                	jle    1b <printu64+0x1b>
+    n = sizeof(buf) - 1;
+  50:	c7 45 e8 17 00 00 00 	movl   $0x17,-0x18(%ebp)
+    buf[n] = 0;
+  57:	8d 55 c8             	lea    -0x38(%ebp),%edx
+  5a:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  5d:	01 d0                	add    %edx,%eax
+  5f:	c6 00 00             	movb   $0x0,(%eax)
+    do {
+        r = 0;
+  62:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+        more = 0;
+  69:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+        for(i = 0; i < 4; i++){
+  70:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  77:	eb 62                	jmp    db <printu64+0xdb>
+            r = (r << 16) | w[i];
+  79:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  7c:	c1 e0 10             	shl    $0x10,%eax
+  7f:	89 c2                	mov    %eax,%edx
+  81:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  84:	0f b7 44 45 e0       	movzwl -0x20(%ebp,%eax,2),%eax
+  89:	0f b7 c0             	movzwl %ax,%eax
+  8c:	09 d0                	or     %edx,%eax
+  8e:	89 45 f4             	mov    %eax,-0xc(%ebp)
+            w[i] = r / 10;
+  91:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  94:	ba cd cc cc cc       	mov    $0xcccccccd,%edx
+  99:	f7 e2                	mul    %edx
+  9b:	89 d0                	mov    %edx,%eax
+  9d:	c1 e8 03             	shr    $0x3,%eax
+  a0:	89 c2                	mov    %eax,%edx
+  a2:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  a5:	66 89 54 45 e0       	mov    %dx,-0x20(%ebp,%eax,2)
+            r %= 10;
+  aa:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+  ad:	ba cd cc cc cc       	mov    $0xcccccccd,%edx
+  b2:	89 c8                	mov    %ecx,%eax
+  b4:	f7 e2                	mul    %edx
+  b6:	c1 ea 03             	shr    $0x3,%edx
+  b9:	89 d0                	mov    %edx,%eax
+  bb:	c1 e0 02             	shl    $0x2,%eax
+  be:	01 d0                	add    %edx,%eax
+  c0:	01 c0                	add    %eax,%eax
+  c2:	29 c1                	sub    %eax,%ecx
+  c4:	89 ca                	mov    %ecx,%edx
+  c6:	89 55 f4             	mov    %edx,-0xc(%ebp)
+            more |= w[i];
+  c9:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  cc:	0f b7 44 45 e0       	movzwl -0x20(%ebp,%eax,2),%eax
+  d1:	0f b7 c0             	movzwl %ax,%eax
+  d4:	09 45 f0             	or     %eax,-0x10(%ebp)
+        for(i = 0; i < 4; i++){
+  d7:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+  db:	83 7d ec 03          	cmpl   $0x3,-0x14(%ebp)
+  df:	7e 98                	jle    79 <printu64+0x79>
+        }
+        buf[--n] = '0' + r;
+  e1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  e4:	83 c0 30             	add    $0x30,%eax
+  e7:	83 6d e8 01          	subl   $0x1,-0x18(%ebp)
+  eb:	89 c1                	mov    %eax,%ecx
+  ed:	8d 55 c8             	lea    -0x38(%ebp),%edx
+  f0:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  f3:	01 d0                	add    %edx,%eax
+  f5:	88 08                	mov    %cl,(%eax)
+    } while(more);
+  f7:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+  fb:	0f 85 61 ff ff ff    	jne    62 <printu64+0x62>
+    printf(1, "%s", buf + n);
+ 101:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 104:	8d 55 c8             	lea    -0x38(%ebp),%edx
+ 107:	01 d0                	add    %edx,%eax
+ 109:	83 ec 04             	sub    $0x4,%esp
+ 10c:	50                   	push   %eax
+ 10d:	68 b0 0e 00 00       	push   $0xeb0
+ 112:	6a 01                	push   $0x1
+ 114:	e8 de 09 00 00       	call   af7 <printf>
+ 119:	83 c4 10             	add    $0x10,%esp
+}
+ 11c:	90                   	nop
+ 11d:	c9                   	leave
+ 11e:	c3                   	ret
+
+0000011f <report>:
+
+void
+report(void)
+{
+ 11f:	55                   	push   %ebp
+ 120:	89 e5                	mov    %esp,%ebp
+ 122:	57                   	push   %edi
+ 123:	56                   	push   %esi
+ 124:	53                   	push   %ebx
+ 125:	83 ec 6c             	sub    $0x6c,%esp
+    struct lockstat t;
+    int i, j, n;
+
+    n = lockstat(LOCKSTAT_READ, stats, NSTAT);
+ 128:	83 ec 04             	sub    $0x4,%esp
+ 12b:	6a 40                	push   $0x40
+ 12d:	68 20 12 00 00       	push   $0x1220
+ 132:	6a 00                	push   $0x0
+ 134:	e8 5b 08 00 00       	call   994 <lockstat>
+ 139:	83 c4 10             	add    $0x10,%esp
+ 13c:	89 45 dc             	mov    %eax,-0x24(%ebp)
+    for(i = 0; i < n; i++){
+ 13f:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+ 146:	e9 a2 00 00 00       	jmp    1ed <report+0xce>
+        for(j = i+1; j < n; j++){
+ 14b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 14e:	83 c0 01             	add    $0x1,%eax
+ 151:	89 45 e0             	mov    %eax,-0x20(%ebp)
+ 154:	e9 84 00 00 00       	jmp    1dd <report+0xbe>
+            if(stats[j].ncontended > stats[i].ncontended){
+ 159:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ 15c:	6b c0 54             	imul   $0x54,%eax,%eax
+ 15f:	05 38 12 00 00       	add    $0x1238,%eax
+ 164:	8b 00                	mov    (%eax),%eax
+ 166:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+ 169:	6b d2 54             	imul   $0x54,%edx,%edx
+ 16c:	81 c2 38 12 00 00    	add    $0x1238,%edx
+ 172:	8b 12                	mov    (%edx),%edx
+ 174:	39 c2                	cmp    %eax,%edx
+ 176:	73 61                	jae    1d9 <report+0xba>
+                t = stats[i];
+ 178:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 17b:	6b c0 54             	imul   $0x54,%eax,%eax
+ 17e:	8d 90 20 12 00 00    	lea    0x1220(%eax),%edx
+ 184:	8d 45 88             	lea    -0x78(%ebp),%eax
+ 187:	89 d3                	mov    %edx,%ebx
+ 189:	ba 15 00 00 00       	mov    $0x15,%edx
+ 18e:	89 c7                	mov    %eax,%edi
+ 190:	89 de                	mov    %ebx,%esi
+ 192:	89 d1                	mov    %edx,%ecx
+ 194:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+                stats[i] = stats[j];
+ 196:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 199:	6b c0 54             	imul   $0x54,%eax,%eax
+ 19c:	8d 90 20 12 00 00    	lea    0x1220(%eax),%edx
+ 1a2:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ 1a5:	6b c0 54             	imul   $0x54,%eax,%eax
+ 1a8:	05 20 12 00 00       	add    $0x1220,%eax
+ 1ad:	89 c3                	mov    %eax,%ebx
+ 1af:	b8 15 00 00 00       	mov    $0x15,%eax
+ 1b4:	89 d7                	mov    %edx,%edi
+ 1b6:	89 de                	mov    %ebx,%esi
+ 1b8:	89 c1                	mov    %eax,%ecx
+ 1ba:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+                stats[j] = t;
+ 1bc:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ 1bf:	6b c0 54             	imul   $0x54,%eax,%eax
+ 1c2:	05 20 12 00 00       	add    $0x1220,%eax
+ 1c7:	89 c3                	mov    %eax,%ebx
+ 1c9:	8d 45 88             	lea    -0x78(%ebp),%eax
+ 1cc:	ba 15 00 00 00       	mov    $0x15,%edx
+ 1d1:	89 df                	mov    %ebx,%edi
+ 1d3:	89 c6                	mov    %eax,%esi
+ 1d5:	89 d1                	mov    %edx,%ecx
+ 1d7:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+        for(j = i+1; j < n; j++){
+ 1d9:	83 45 e0 01          	addl   $0x1,-0x20(%ebp)
+ 1dd:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ 1e0:	3b 45 dc             	cmp    -0x24(%ebp),%eax
+ 1e3:	0f 8c 70 ff ff ff    	jl     159 <report+0x3a>
+    for(i = 0; i < n; i++){
+ 1e9:	83 45 e4 01          	addl   $0x1,-0x1c(%ebp)
+ 1ed:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 1f0:	3b 45 dc             	cmp    -0x24(%ebp),%eax
+ 1f3:	0f 8c 52 ff ff ff    	jl     14b <report+0x2c>
+            }
+        }
+    }
+    for(i = 0; i < n; i++){
+ 1f9:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+ 200:	e9 70 01 00 00       	jmp    375 <report+0x256>
+        printf(1, "%s%s: %d acquires, %d contended, wait ",
+ 205:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 208:	6b c0 54             	imul   $0x54,%eax,%eax
+ 20b:	05 38 12 00 00       	add    $0x1238,%eax
+ 210:	8b 10                	mov    (%eax),%edx
+ 212:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 215:	6b c0 54             	imul   $0x54,%eax,%eax
+ 218:	05 34 12 00 00       	add    $0x1234,%eax
+ 21d:	8b 00                	mov    (%eax),%eax
+            stats[i].name, stats[i].sleep ? " (sleep)" : "",
+ 21f:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ 222:	6b c9 54             	imul   $0x54,%ecx,%ecx
+ 225:	81 c1 30 12 00 00    	add    $0x1230,%ecx
+ 22b:	8b 09                	mov    (%ecx),%ecx
+        printf(1, "%s%s: %d acquires, %d contended, wait ",
+ 22d:	85 c9                	test   %ecx,%ecx
+ 22f:	74 07                	je     238 <report+0x119>
+ 231:	bb b3 0e 00 00       	mov    $0xeb3,%ebx
+ 236:	eb 05                	jmp    23d <report+0x11e>
+ 238:	bb bc 0e 00 00       	mov    $0xebc,%ebx
+            stats[i].name, stats[i].sleep ? " (sleep)" : "",
+ 23d:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ 240:	6b c9 54             	imul   $0x54,%ecx,%ecx
+ 243:	81 c1 20 12 00 00    	add    $0x1220,%ecx
+        printf(1, "%s%s: %d acquires, %d contended, wait ",
+ 249:	83 ec 08             	sub    $0x8,%esp
+ 24c:	52                   	push   %edx
+ 24d:	50                   	push   %eax
+ 24e:	53                   	push   %ebx
+ 24f:	51                   	push   %ecx
+ 250:	68 c0 0e 00 00       	push   $0xec0
+ 255:	6a 01                	push   $0x1
+ 257:	e8 9b 08 00 00       	call   af7 <printf>
+ 25c:	83 c4 20             	add    $0x20,%esp
+            stats[i].nacquire, stats[i].ncontended);
+        printu64(stats[i].wait);
+ 25f:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 262:	6b c0 54             	imul   $0x54,%eax,%eax
+ 265:	05 30 12 00 00       	add    $0x1230,%eax
+ 26a:	8b 50 10             	mov    0x10(%eax),%edx
+ 26d:	8b 40 0c             	mov    0xc(%eax),%eax
+ 270:	83 ec 08             	sub    $0x8,%esp
+ 273:	52                   	push   %edx
+ 274:	50                   	push   %eax
+ 275:	e8 86 fd ff ff       	call   0 <printu64>
+ 27a:	83 c4 10             	add    $0x10,%esp
+        printf(1, " max ");
+ 27d:	83 ec 08             	sub    $0x8,%esp
+ 280:	68 e7 0e 00 00       	push   $0xee7
+ 285:	6a 01                	push   $0x1
+ 287:	e8 6b 08 00 00       	call   af7 <printf>
+ 28c:	83 c4 10             	add    $0x10,%esp
+        printu64(stats[i].maxwait);
+ 28f:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 292:	6b c0 54             	imul   $0x54,%eax,%eax
+ 295:	05 40 12 00 00       	add    $0x1240,%eax
+ 29a:	8b 50 08             	mov    0x8(%eax),%edx
+ 29d:	8b 40 04             	mov    0x4(%eax),%eax
+ 2a0:	83 ec 08             	sub    $0x8,%esp
+ 2a3:	52                   	push   %edx
+ 2a4:	50                   	push   %eax
+ 2a5:	e8 56 fd ff ff       	call   0 <printu64>
+ 2aa:	83 c4 10             	add    $0x10,%esp
+        printf(1, ", max hold ");
+ 2ad:	83 ec 08             	sub    $0x8,%esp
+ 2b0:	68 ed 0e 00 00       	push   $0xeed
+ 2b5:	6a 01                	push   $0x1
+ 2b7:	e8 3b 08 00 00       	call   af7 <printf>
+ 2bc:	83 c4 10             	add    $0x10,%esp
+        printu64(stats[i].maxhold);
+ 2bf:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 2c2:	6b c0 54             	imul   $0x54,%eax,%eax
+ 2c5:	05 40 12 00 00       	add    $0x1240,%eax
+ 2ca:	8b 50 10             	mov    0x10(%eax),%edx
+ 2cd:	8b 40 0c             	mov    0xc(%eax),%eax
+ 2d0:	83 ec 08             	sub    $0x8,%esp
+ 2d3:	52                   	push   %edx
+ 2d4:	50                   	push   %eax
+ 2d5:	e8 26 fd ff ff       	call   0 <printu64>
+ 2da:	83 c4 10             	add    $0x10,%esp
+        printf(1, "\n");
+ 2dd:	83 ec 08             	sub    $0x8,%esp
+ 2e0:	68 f9 0e 00 00       	push   $0xef9
+ 2e5:	6a 01                	push   $0x1
+ 2e7:	e8 0b 08 00 00       	call   af7 <printf>
+ 2ec:	83 c4 10             	add    $0x10,%esp
+        for(j = 0; j < NLOCKSITE && stats[i].sitecount[j]; j++)
+ 2ef:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%ebp)
+ 2f6:	eb 51                	jmp    349 <report+0x22a>
+            printf(1, "    %x %d\n", stats[i].sitepc[j], stats[i].sitecount[j]);
+ 2f8:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+ 2fb:	89 d0                	mov    %edx,%eax
+ 2fd:	c1 e0 02             	shl    $0x2,%eax
+ 300:	01 d0                	add    %edx,%eax
+ 302:	c1 e0 02             	shl    $0x2,%eax
+ 305:	01 d0                	add    %edx,%eax
+ 307:	8b 55 e0             	mov    -0x20(%ebp),%edx
+ 30a:	01 d0                	add    %edx,%eax
+ 30c:	83 c0 10             	add    $0x10,%eax
+ 30f:	8b 0c 85 24 12 00 00 	mov    0x1224(,%eax,4),%ecx
+ 316:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+ 319:	89 d0                	mov    %edx,%eax
+ 31b:	c1 e0 02             	shl    $0x2,%eax
+ 31e:	01 d0                	add    %edx,%eax
+ 320:	c1 e0 02             	shl    $0x2,%eax
+ 323:	01 d0                	add    %edx,%eax
+ 325:	8b 55 e0             	mov    -0x20(%ebp),%edx
+ 328:	01 d0                	add    %edx,%eax
+ 32a:	83 c0 0c             	add    $0xc,%eax
+ 32d:	8b 04 85 24 12 00 00 	mov    0x1224(,%eax,4),%eax
+ 334:	51                   	push   %ecx
+ 335:	50                   	push   %eax
+ 336:	68 fb 0e 00 00       	push   $0xefb
+ 33b:	6a 01                	push   $0x1
+ 33d:	e8 b5 07 00 00       	call   af7 <printf>
+ 342:	83 c4 10             	add    $0x10,%esp
+        for(j = 0; j < NLOCKSITE && stats[i].sitecount[j]; j++)
+ 345:	83 45 e0 01          	addl   $0x1,-0x20(%ebp)
+ 349:	83 7d e0 03          	cmpl   $0x3,-0x20(%ebp)
+ 34d:	7f 22                	jg     371 <report+0x252>
+ 34f:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+ 352:	89 d0                	mov    %edx,%eax
+ 354:	c1 e0 02             	shl    $0x2,%eax
+ 357:	01 d0                	add    %edx,%eax
+ 359:	c1 e0 02             	shl    $0x2,%eax
+ 35c:	01 d0                	add    %edx,%eax
+ 35e:	8b 55 e0             	mov    -0x20(%ebp),%edx
+ 361:	01 d0                	add    %edx,%eax
+ 363:	83 c0 10             	add    $0x10,%eax
+ 366:	8b 04 85 24 12 00 00 	mov    0x1224(,%eax,4),%eax
+ 36d:	85 c0                	test   %eax,%eax
+ 36f:	75 87                	jne    2f8 <report+0x1d9>
+    for(i = 0; i < n; i++){
+ 371:	83 45 e4 01          	addl   $0x1,-0x1c(%ebp)
+ 375:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 378:	3b 45 dc             	cmp    -0x24(%ebp),%eax
+ 37b:	0f 8c 84 fe ff ff    	jl     205 <report+0xe6>
+    }
+}
+ 381:	90                   	nop
+ 382:	90                   	nop
+ 383:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 386:	5b                   	pop    %ebx
+ 387:	5e                   	pop    %esi
+ 388:	5f                   	pop    %edi
+ 389:	5d                   	pop    %ebp
+ 38a:	c3                   	ret
+
+0000038b <main>:
+
+int
+main(int argc, char *argv[])
+{
+ 38b:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+ 38f:	83 e4 f0             	and    $0xfffffff0,%esp
+ 392:	ff 71 fc             	push   -0x4(%ecx)
+ 395:	55                   	push   %ebp
+ 396:	89 e5                	mov    %esp,%ebp
+ 398:	53                   	push   %ebx
+ 399:	51                   	push   %ecx
+ 39a:	83 ec 10             	sub    $0x10,%esp
+ 39d:	89 cb                	mov    %ecx,%ebx
+    int pid;
+
+    if(argc < 2){
+ 39f:	83 3b 01             	cmpl   $0x1,(%ebx)
+ 3a2:	7f 0a                	jg     3ae <main+0x23>
+        report();
+ 3a4:	e8 76 fd ff ff       	call   11f <report>
+        exit();
+ 3a9:	e8 4b 04 00 00       	call   7f9 <exit>
+    }
+    if(strcmp(argv[1], "on") == 0)
+ 3ae:	8b 43 04             	mov    0x4(%ebx),%eax
+ 3b1:	83 c0 04             	add    $0x4,%eax
+ 3b4:	8b 00                	mov    (%eax),%eax
+ 3b6:	83 ec 08             	sub    $0x8,%esp
+ 3b9:	68 06 0f 00 00       	push   $0xf06
+ 3be:	50                   	push   %eax
+ 3bf:	e8 81 01 00 00       	call   545 <strcmp>
+ 3c4:	83 c4 10             	add    $0x10,%esp
+ 3c7:	85 c0                	test   %eax,%eax
+ 3c9:	75 16                	jne    3e1 <main+0x56>
+        lockstat(LOCKSTAT_ON, 0, 0);
+ 3cb:	83 ec 04             	sub    $0x4,%esp
+ 3ce:	6a 00                	push   $0x0
+ 3d0:	6a 00                	push   $0x0
+ 3d2:	6a 01                	push   $0x1
+ 3d4:	e8 bb 05 00 00       	call   994 <lockstat>
+ 3d9:	83 c4 10             	add    $0x10,%esp
+ 3dc:	e9 09 01 00 00       	jmp    4ea <main+0x15f>
+    else if(strcmp(argv[1], "off") == 0)
+ 3e1:	8b 43 04             	mov    0x4(%ebx),%eax
+ 3e4:	83 c0 04             	add    $0x4,%eax
+ 3e7:	8b 00                	mov    (%eax),%eax
+ 3e9:	83 ec 08             	sub    $0x8,%esp
+ 3ec:	68 09 0f 00 00       	push   $0xf09
+ 3f1:	50                   	push   %eax
+ 3f2:	e8 4e 01 00 00       	call   545 <strcmp>
+ 3f7:	83 c4 10             	add    $0x10,%esp
+ 3fa:	85 c0                	test   %eax,%eax
+ 3fc:	75 16                	jne    414 <main+0x89>
+        lockstat(LOCKSTAT_OFF, 0, 0);
+ 3fe:	83 ec 04             	sub    $0x4,%esp
+ 401:	6a 00                	push   $0x0
+ 403:	6a 00                	push   $0x0
+ 405:	6a 02                	push   $0x2
+ 407:	e8 88 05 00 00       	call   994 <lockstat>
+ 40c:	83 c4 10             	add    $0x10,%esp
+ 40f:	e9 d6 00 00 00       	jmp    4ea <main+0x15f>
+    else if(strcmp(argv[1], "reset") == 0)
+ 414:	8b 43 04             	mov    0x4(%ebx),%eax
+ 417:	83 c0 04             	add    $0x4,%eax
+ 41a:	8b 00                	mov    (%eax),%eax
+ 41c:	83 ec 08             	sub    $0x8,%esp
+ 41f:	68 0d 0f 00 00       	push   $0xf0d
+ 424:	50                   	push   %eax
+ 425:	e8 1b 01 00 00       	call   545 <strcmp>
+ 42a:	83 c4 10             	add    $0x10,%esp
+ 42d:	85 c0                	test   %eax,%eax
+ 42f:	75 16                	jne    447 <main+0xbc>
+        lockstat(LOCKSTAT_RESET, 0, 0);
+ 431:	83 ec 04             	sub    $0x4,%esp
+ 434:	6a 00                	push   $0x0
+ 436:	6a 00                	push   $0x0
+ 438:	6a 03                	push   $0x3
+ 43a:	e8 55 05 00 00       	call   994 <lockstat>
+ 43f:	83 c4 10             	add    $0x10,%esp
+ 442:	e9 a3 00 00 00       	jmp    4ea <main+0x15f>
+    else {
+        lockstat(LOCKSTAT_RESET, 0, 0);
+ 447:	83 ec 04             	sub    $0x4,%esp
+ 44a:	6a 00                	push   $0x0
+ 44c:	6a 00                	push   $0x0
+ 44e:	6a 03                	push   $0x3
+ 450:	e8 3f 05 00 00       	call   994 <lockstat>
+ 455:	83 c4 10             	add    $0x10,%esp
+        lockstat(LOCKSTAT_ON, 0, 0);
+ 458:	83 ec 04             	sub    $0x4,%esp
+ 45b:	6a 00                	push   $0x0
+ 45d:	6a 00                	push   $0x0
+ 45f:	6a 01                	push   $0x1
+ 461:	e8 2e 05 00 00       	call   994 <lockstat>
+ 466:	83 c4 10             	add    $0x10,%esp
+        pid = fork();
+ 469:	e8 84 03 00 00       	call   7f2 <fork>
+ 46e:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        if(pid < 0){
+ 471:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 475:	79 17                	jns    48e <main+0x103>
+            printf(2, "lockstats: fork failed\n");
+ 477:	83 ec 08             	sub    $0x8,%esp
+ 47a:	68 13 0f 00 00       	push   $0xf13
+ 47f:	6a 02                	push   $0x2
+ 481:	e8 71 06 00 00       	call   af7 <printf>
+ 486:	83 c4 10             	add    $0x10,%esp
+            exit();
+ 489:	e8 6b 03 00 00       	call   7f9 <exit>
+        }
+        if(pid == 0){
+ 48e:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 492:	75 3b                	jne    4cf <main+0x144>
+            exec(argv[1], argv + 1);
+ 494:	8b 43 04             	mov    0x4(%ebx),%eax
+ 497:	8d 50 04             	lea    0x4(%eax),%edx
+ 49a:	8b 43 04             	mov    0x4(%ebx),%eax
+ 49d:	83 c0 04             	add    $0x4,%eax
+ 4a0:	8b 00                	mov    (%eax),%eax
+ 4a2:	83 ec 08             	sub    $0x8,%esp
+ 4a5:	52                   	push   %edx
+ 4a6:	50                   	push   %eax
+ 4a7:	e8 8a 03 00 00       	call   836 <exec>
+ 4ac:	83 c4 10             	add    $0x10,%esp
+            printf(2, "lockstats: exec %s failed\n", argv[1]);
+ 4af:	8b 43 04             	mov    0x4(%ebx),%eax
+ 4b2:	83 c0 04             	add    $0x4,%eax
+ 4b5:	8b 00                	mov    (%eax),%eax
+ 4b7:	83 ec 04             	sub    $0x4,%esp
+ 4ba:	50                   	push   %eax
+ 4bb:	68 2b 0f 00 00       	push   $0xf2b
+ 4c0:	6a 02                	push   $0x2
+ 4c2:	e8 30 06 00 00       	call   af7 <printf>
+ 4c7:	83 c4 10             	add    $0x10,%esp
+            exit();
+ 4ca:	e8 2a 03 00 00       	call   7f9 <exit>
+        }
+        wait();
+ 4cf:	e8 2c 03 00 00       	call   800 <wait>
+        lockstat(LOCKSTAT_OFF, 0, 0);
+ 4d4:	83 ec 04             	sub    $0x4,%esp
+ 4d7:	6a 00                	push   $0x0
+ 4d9:	6a 00                	push   $0x0
+ 4db:	6a 02                	push   $0x2
+ 4dd:	e8 b2 04 00 00       	call   994 <lockstat>
+ 4e2:	83 c4 10             	add    $0x10,%esp
+        report();
+ 4e5:	e8 35 fc ff ff       	call   11f <report>
+    }
+    exit();
+ 4ea:	e8 0a 03 00 00       	call   7f9 <exit>
+
+000004ef <stosb>:
+strchr(const char *s, char c)
+{
+    for(; *s; s++)
+        if(*s == c)
+            return (char*)s;
+    return 0;
+ 4ef:	55                   	push   %ebp
+ 4f0:	89 e5                	mov    %esp,%ebp
+ 4f2:	57                   	push   %edi
+ 4f3:	53                   	push   %ebx
+}
+ 4f4:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 4f7:	8b 55 10             	mov    0x10(%ebp),%edx
+ 4fa:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 4fd:	89 cb                	mov    %ecx,%ebx
+ 4ff:	89 df                	mov    %ebx,%edi
+ 501:	89 d1                	mov    %edx,%ecx
+ 503:	fc                   	cld
+ 504:	f3 aa                	rep stos %al,%es:(%edi)
+ 506:	89 ca                	mov    %ecx,%edx
+ 508:	89 fb                	mov    %edi,%ebx
+ 50a:	89 5d 08             	mov    %ebx,0x8(%ebp)
+ 50d:	89 55 10             	mov    %edx,0x10(%ebp)
+
+char*
+gets(char *buf, int max)
+{
+ 510:	90                   	nop
+ 511:	5b                   	pop    %ebx
+ 512:	5f                   	pop    %edi
+ 513:	5d                   	pop    %ebp
+ 514:	c3                   	ret
+
+00000515 <strcpy>:
+{
+ 515:	55                   	push   %ebp
+ 516:	89 e5                	mov    %esp,%ebp
+ 518:	83 ec 10             	sub    $0x10,%esp
+    os = s;
+ 51b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 51e:	89 45 fc             	mov    %eax,-0x4(%ebp)
+    while((*s++ = *t++) != 0)
+ 521:	90                   	nop
+ 522:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 525:	8d 42 01             	lea    0x1(%edx),%eax
+ 528:	89 45 0c             	mov    %eax,0xc(%ebp)
+ 52b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 52e:	8d 48 01             	lea    0x1(%eax),%ecx
+ 531:	89 4d 08             	mov    %ecx,0x8(%ebp)
+ 534:	0f b6 12             	movzbl (%edx),%edx
+ 537:	88 10                	mov    %dl,(%eax)
+ 539:	0f b6 00             	movzbl (%eax),%eax
+ 53c:	84 c0                	test   %al,%al
+ 53e:	75 e2                	jne    522 <strcpy+0xd>
+    return os;
+ 540:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 543:	c9                   	leave
+ 544:	c3                   	ret
+
+00000545 <strcmp>:
+{
+ 545:	55                   	push   %ebp
+ 546:	89 e5                	mov    %esp,%ebp
+    while(*p && *p == *q)
+ 548:	eb 08                	jmp    552 <strcmp+0xd>
+        p++, q++;
+ 54a:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 54e:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+    while(*p && *p == *q)
+ 552:	8b 45 08             	mov    0x8(%ebp),%eax
+ 555:	0f b6 00             	movzbl (%eax),%eax
+ 558:	84 c0                	test   %al,%al
+ 55a:	74 10                	je     56c <strcmp+0x27>
+ 55c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 55f:	0f b6 10             	movzbl (%eax),%edx
+ 562:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 565:	0f b6 00             	movzbl (%eax),%eax
+ 568:	38 c2                	cmp    %al,%dl
+ 56a:	74 de                	je     54a <strcmp+0x5>
+    return (uchar)*p - (uchar)*q;
+ 56c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 56f:	0f b6 00             	movzbl (%eax),%eax
+ 572:	0f b6 d0             	movzbl %al,%edx
+ 575:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 578:	0f b6 00             	movzbl (%eax),%eax
+ 57b:	0f b6 c0             	movzbl %al,%eax
+ 57e:	29 c2                	sub    %eax,%edx
+ 580:	89 d0                	mov    %edx,%eax
+}
+ 582:	5d                   	pop    %ebp
+ 583:	c3                   	ret
+
+00000584 <strlen>:
+{
+ 584:	55                   	push   %ebp
+ 585:	89 e5                	mov    %esp,%ebp
+ 587:	83 ec 10             	sub    $0x10,%esp
+    for(n = 0; s[n]; n++)
+ 58a:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ 591:	eb 04                	jmp    597 <strlen+0x13>
+ 593:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 597:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 59a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 59d:	01 d0                	add    %edx,%eax
+ 59f:	0f b6 00             	movzbl (%eax),%eax
+ 5a2:	84 c0                	test   %al,%al
+ 5a4:	75 ed                	jne    593 <strlen+0xf>
+    return n;
+ 5a6:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 5a9:	c9                   	leave
+ 5aa:	c3                   	ret
+
+000005ab <memset>:
+{
+ 5ab:	55                   	push   %ebp
+ 5ac:	89 e5                	mov    %esp,%ebp
+    stosb(dst, c, n);
+ 5ae:	8b 45 10             	mov    0x10(%ebp),%eax
+ 5b1:	50                   	push   %eax
+ 5b2:	ff 75 0c             	push   0xc(%ebp)
+ 5b5:	ff 75 08             	push   0x8(%ebp)
+ 5b8:	e8 32 ff ff ff       	call   4ef <stosb>
+ 5bd:	83 c4 0c             	add    $0xc,%esp
+    return dst;
+ 5c0:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 5c3:	c9                   	leave
+ 5c4:	c3                   	ret
+
+000005c5 <strchr>:
+{
+ 5c5:	55                   	push   %ebp
+ 5c6:	89 e5                	mov    %esp,%ebp
+ 5c8:	83 ec 04             	sub    $0x4,%esp
+ 5cb:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 5ce:	88 45 fc             	mov    %al,-0x4(%ebp)
+    for(; *s; s++)
+ 5d1:	eb 14                	jmp    5e7 <strchr+0x22>
+        if(*s == c)
+ 5d3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5d6:	0f b6 00             	movzbl (%eax),%eax
+ 5d9:	38 45 fc             	cmp    %al,-0x4(%ebp)
+ 5dc:	75 05                	jne    5e3 <strchr+0x1e>
+            return (char*)s;
+ 5de:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5e1:	eb 13                	jmp    5f6 <strchr+0x31>
+    for(; *s; s++)
+ 5e3:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 5e7:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5ea:	0f b6 00             	movzbl (%eax),%eax
+ 5ed:	84 c0                	test   %al,%al
+ 5ef:	75 e2                	jne    5d3 <strchr+0xe>
+    return 0;
+ 5f1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 5f6:	c9                   	leave
+ 5f7:	c3                   	ret
+
+000005f8 <gets>:
+{
+ 5f8:	55                   	push   %ebp
+ 5f9:	89 e5                	mov    %esp,%ebp
+ 5fb:	83 ec 18             	sub    $0x18,%esp
+    int i, cc;
+    char c;
+
+    for(i=0; i+1 < max; ){
+ 5fe:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 605:	eb 42                	jmp    649 <gets+0x51>
+        cc = read(0, &c, 1);
+ 607:	83 ec 04             	sub    $0x4,%esp
+ 60a:	6a 01                	push   $0x1
+ 60c:	8d 45 ef             	lea    -0x11(%ebp),%eax
+ 60f:	50                   	push   %eax
+ 610:	6a 00                	push   $0x0
+ 612:	e8 f7 01 00 00       	call   80e <read>
+ 617:	83 c4 10             	add    $0x10,%esp
+ 61a:	89 45 f0             	mov    %eax,-0x10(%ebp)
+        if(cc < 1)
+ 61d:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 621:	7e 33                	jle    656 <gets+0x5e>
+            break;
+        buf[i++] = c;
+ 623:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 626:	8d 50 01             	lea    0x1(%eax),%edx
+ 629:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 62c:	89 c2                	mov    %eax,%edx
+ 62e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 631:	01 c2                	add    %eax,%edx
+ 633:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 637:	88 02                	mov    %al,(%edx)
+        if(c == '\n' || c == '\r')
+ 639:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 63d:	3c 0a                	cmp    $0xa,%al
+ 63f:	74 16                	je     657 <gets+0x5f>
+ 641:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 645:	3c 0d                	cmp    $0xd,%al
+ 647:	74 0e                	je     657 <gets+0x5f>
+    for(i=0; i+1 < max; ){
+ 649:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 64c:	83 c0 01             	add    $0x1,%eax
+ 64f:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 652:	7f b3                	jg     607 <gets+0xf>
+ 654:	eb 01                	jmp    657 <gets+0x5f>
+            break;
+ 656:	90                   	nop
+            break;
+    }
+    buf[i] = '\0';
+ 657:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 65a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 65d:	01 d0                	add    %edx,%eax
+ 65f:	c6 00 00             	movb   $0x0,(%eax)
+    return buf;
+ 662:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 665:	c9                   	leave
+ 666:	c3                   	ret
+
+00000667 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 667:	55                   	push   %ebp
+ 668:	89 e5                	mov    %esp,%ebp
+ 66a:	83 ec 18             	sub    $0x18,%esp
+    int fd;
+    int r;
+
+    fd = open(n, O_RDONLY);
+ 66d:	83 ec 08             	sub    $0x8,%esp
+ 670:	6a 00                	push   $0x0
+ 672:	ff 75 08             	push   0x8(%ebp)
+ 675:	e8 c6 01 00 00       	call   840 <open>
+ 67a:	83 c4 10             	add    $0x10,%esp
+ 67d:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(fd < 0)
+ 680:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 684:	79 07                	jns    68d <stat+0x26>
+        return -1;
+ 686:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 68b:	eb 25                	jmp    6b2 <stat+0x4b>
+    r = fstat(fd, st);
+ 68d:	83 ec 08             	sub    $0x8,%esp
+ 690:	ff 75 0c             	push   0xc(%ebp)
+ 693:	ff 75 f4             	push   -0xc(%ebp)
+ 696:	e8 c3 01 00 00       	call   85e <fstat>
+ 69b:	83 c4 10             	add    $0x10,%esp
+ 69e:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    close(fd);
+ 6a1:	83 ec 0c             	sub    $0xc,%esp
+ 6a4:	ff 75 f4             	push   -0xc(%ebp)
+ 6a7:	e8 76 01 00 00       	call   822 <close>
+ 6ac:	83 c4 10             	add    $0x10,%esp
+    return r;
+ 6af:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ 6b2:	c9                   	leave
+ 6b3:	c3                   	ret
+
+000006b4 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 6b4:	55                   	push   %ebp
+ 6b5:	89 e5                	mov    %esp,%ebp
+ 6b7:	83 ec 10             	sub    $0x10,%esp
+    int n;
+
+    n = 0;
+ 6ba:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+    while('0' <= *s && *s <= '9')
+ 6c1:	eb 25                	jmp    6e8 <atoi+0x34>
+        n = n*10 + *s++ - '0';
+ 6c3:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 6c6:	89 d0                	mov    %edx,%eax
+ 6c8:	c1 e0 02             	shl    $0x2,%eax
+ 6cb:	01 d0                	add    %edx,%eax
+ 6cd:	01 c0                	add    %eax,%eax
+ 6cf:	89 c1                	mov    %eax,%ecx
+ 6d1:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6d4:	8d 50 01             	lea    0x1(%eax),%edx
+ 6d7:	89 55 08             	mov    %edx,0x8(%ebp)
+ 6da:	0f b6 00             	movzbl (%eax),%eax
+ 6dd:	0f be c0             	movsbl %al,%eax
+ 6e0:	01 c8                	add    %ecx,%eax
+ 6e2:	83 e8 30             	sub    $0x30,%eax
+ 6e5:	89 45 fc             	mov    %eax,-0x4(%ebp)
+    while('0' <= *s && *s <= '9')
+ 6e8:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6eb:	0f b6 00             	movzbl (%eax),%eax
+ 6ee:	3c 2f                	cmp    $0x2f,%al
+ 6f0:	7e 0a                	jle    6fc <atoi+0x48>
+ 6f2:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6f5:	0f b6 00             	movzbl (%eax),%eax
+ 6f8:	3c 39                	cmp    $0x39,%al
+ 6fa:	7e c7                	jle    6c3 <atoi+0xf>
+    return n;
+ 6fc:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 6ff:	c9                   	leave
+ 700:	c3                   	ret
+
+00000701 <nice>:
+
+// Add inc to the caller's nice value; return the new value.
+int
+nice(int inc)
+{
+ 701:	55                   	push   %ebp
+ 702:	89 e5                	mov    %esp,%ebp
+ 704:	83 ec 18             	sub    $0x18,%esp
+    int n;
+
+    n = getpriority(0) + inc;
+ 707:	83 ec 0c             	sub    $0xc,%esp
+ 70a:	6a 00                	push   $0x0
+ 70c:	e8 d9 01 00 00       	call   8ea <getpriority>
+ 711:	83 c4 10             	add    $0x10,%esp
+ 714:	8b 55 08             	mov    0x8(%ebp),%edx
+ 717:	01 d0                	add    %edx,%eax
+ 719:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(n < 0)
+ 71c:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 720:	79 07                	jns    729 <nice+0x28>
+        n = 0;
+ 722:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    if(n > NICEMAX)
+ 729:	83 7d f4 13          	cmpl   $0x13,-0xc(%ebp)
+ 72d:	7e 07                	jle    736 <nice+0x35>
+        n = NICEMAX;
+ 72f:	c7 45 f4 13 00 00 00 	movl   $0x13,-0xc(%ebp)
+    if(setpriority(0, n) < 0)
+ 736:	83 ec 08             	sub    $0x8,%esp
+ 739:	ff 75 f4             	push   -0xc(%ebp)
+ 73c:	6a 00                	push   $0x0
+ 73e:	e8 b1 01 00 00       	call   8f4 <setpriority>
+ 743:	83 c4 10             	add    $0x10,%esp
+ 746:	85 c0                	test   %eax,%eax
+ 748:	79 07                	jns    751 <nice+0x50>
+        return -1;
+ 74a:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 74f:	eb 03                	jmp    754 <nice+0x53>
+    return n;
+ 751:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+ 754:	c9                   	leave
+ 755:	c3                   	ret
+
+00000756 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 756:	55                   	push   %ebp
+ 757:	89 e5                	mov    %esp,%ebp
+ 759:	83 ec 10             	sub    $0x10,%esp
+    char *dst;
+    const char *src;
+
+    dst = vdst;
+ 75c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 75f:	89 45 fc             	mov    %eax,-0x4(%ebp)
+    src = vsrc;
+ 762:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 765:	89 45 f8             	mov    %eax,-0x8(%ebp)
+    while(n-- > 0)
+ 768:	eb 17                	jmp    781 <memmove+0x2b>
+        *dst++ = *src++;
+ 76a:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 76d:	8d 42 01             	lea    0x1(%edx),%eax
+ 770:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 773:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 776:	8d 48 01             	lea    0x1(%eax),%ecx
+ 779:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+ 77c:	0f b6 12             	movzbl (%edx),%edx
+ 77f:	88 10                	mov    %dl,(%eax)
+    while(n-- > 0)
+ 781:	8b 45 10             	mov    0x10(%ebp),%eax
+ 784:	8d 50 ff             	lea    -0x1(%eax),%edx
+ 787:	89 55 10             	mov    %edx,0x10(%ebp)
+ 78a:	85 c0                	test   %eax,%eax
+ 78c:	7f dc                	jg     76a <memmove+0x14>
+    return vdst;
+ 78e:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 791:	c9                   	leave
+ 792:	c3                   	ret
+
+00000793 <dosyscall>:
+sysmode:
+    .long 0
+
+    .text
+dosyscall:
+    cmpl $0, sysmode
+ 793:	83 3d 08 12 00 00 00 	cmpl   $0x0,0x1208
+    jg 2f
+ 79a:	7f 0c                	jg     7a8 <dosyscall+0x15>
+    jl 1f
+ 79c:	7c 07                	jl     7a5 <dosyscall+0x12>
+    call sepcheck
+ 79e:	e8 27 00 00 00       	call   7ca <sepcheck>
+    jmp dosyscall
+ 7a3:	eb ee                	jmp    793 <dosyscall>
+1:
+    int $T_SYSCALL
+ 7a5:	cd 40                	int    $0x40
+    ret
+ 7a7:	c3                   	ret
+2:
+    pushl %ebx
+ 7a8:	53                   	push   %ebx
+    pushl %esi
+ 7a9:	56                   	push   %esi
+    pushl %edi
+ 7aa:	57                   	push   %edi
+    pushl %ebp
+ 7ab:	55                   	push   %ebp
+    movl 20(%esp), %ebx
+ 7ac:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+    movl 24(%esp), %esi
+ 7b0:	8b 74 24 18          	mov    0x18(%esp),%esi
+    movl 28(%esp), %edi
+ 7b4:	8b 7c 24 1c          	mov    0x1c(%esp),%edi
+    movl 32(%esp), %ebp
+ 7b8:	8b 6c 24 20          	mov    0x20(%esp),%ebp
+    movl %esp, %ecx
+ 7bc:	89 e1                	mov    %esp,%ecx
+    movl $3f, %edx
+ 7be:	ba c5 07 00 00       	mov    $0x7c5,%edx
+    sysenter
+ 7c3:	0f 34                	sysenter
+3:
+    popl %ebp
+ 7c5:	5d                   	pop    %ebp
+    popl %edi
+ 7c6:	5f                   	pop    %edi
+    popl %esi
+ 7c7:	5e                   	pop    %esi
+    popl %ebx
+ 7c8:	5b                   	pop    %ebx
+    ret
+ 7c9:	c3                   	ret
+
+000007ca <sepcheck>:
+
+# Set sysmode from cpuid's SEP flag.    Preserves %eax.
+sepcheck:
+    pushl %eax
+ 7ca:	50                   	push   %eax
+    pushl %ebx
+ 7cb:	53                   	push   %ebx
+    movl $1, %eax
+ 7cc:	b8 01 00 00 00       	mov    $0x1,%eax
+    cpuid
+ 7d1:	0f a2                	cpuid
+    movl $-1, sysmode
+ 7d3:	c7 05 08 12 00 00 ff 	movl   $0xffffffff,0x1208
+ 7da:	ff ff ff 
+    testl $0x800, %edx
+ 7dd:	f7 c2 00 08 00 00    	test   $0x800,%edx
+    jz 1f
+ 7e3:	74 0a                	je     7ef <sepcheck+0x25>
+    movl $1, sysmode
+ 7e5:	c7 05 08 12 00 00 01 	movl   $0x1,0x1208
+ 7ec:	00 00 00 
+1:
+    popl %ebx
+ 7ef:	5b                   	pop    %ebx
+    popl %eax
+ 7f0:	58                   	pop    %eax
+    ret
+ 7f1:	c3                   	ret
+
+000007f2 <fork>:
+
+SYSCALL(fork)
+ 7f2:	b8 01 00 00 00       	mov    $0x1,%eax
+ 7f7:	eb 9a                	jmp    793 <dosyscall>
+
+000007f9 <exit>:
+SYSCALL(exit)
+ 7f9:	b8 02 00 00 00       	mov    $0x2,%eax
+ 7fe:	eb 93                	jmp    793 <dosyscall>
+
+00000800 <wait>:
+SYSCALL(wait)
+ 800:	b8 03 00 00 00       	mov    $0x3,%eax
+ 805:	eb 8c                	jmp    793 <dosyscall>
+
+00000807 <pipe>:
+SYSCALL(pipe)
+ 807:	b8 04 00 00 00       	mov    $0x4,%eax
+ 80c:	eb 85                	jmp    793 <dosyscall>
+
+0000080e <read>:
+SYSCALL(read)
+ 80e:	b8 05 00 00 00       	mov    $0x5,%eax
+ 813:	e9 7b ff ff ff       	jmp    793 <dosyscall>
+
+00000818 <write>:
+SYSCALL(write)
+ 818:	b8 10 00 00 00       	mov    $0x10,%eax
+ 81d:	e9 71 ff ff ff       	jmp    793 <dosyscall>
+
+00000822 <close>:
+SYSCALL(close)
+ 822:	b8 15 00 00 00       	mov    $0x15,%eax
+ 827:	e9 67 ff ff ff       	jmp    793 <dosyscall>
+
+0000082c <kill>:
+SYSCALL(kill)
+ 82c:	b8 06 00 00 00       	mov    $0x6,%eax
+ 831:	e9 5d ff ff ff       	jmp    793 <dosyscall>
+
+00000836 <exec>:
+SYSCALL(exec)
+ 836:	b8 07 00 00 00       	mov    $0x7,%eax
+ 83b:	e9 53 ff ff ff       	jmp    793 <dosyscall>
+
+00000840 <open>:
+SYSCALL(open)
+ 840:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 845:	e9 49 ff ff ff       	jmp    793 <dosyscall>
+
+0000084a <mknod>:
+SYSCALL(mknod)
+ 84a:	b8 11 00 00 00       	mov    $0x11,%eax
+ 84f:	e9 3f ff ff ff       	jmp    793 <dosyscall>
+
+00000854 <unlink>:
+SYSCALL(unlink)
+ 854:	b8 12 00 00 00       	mov    $0x12,%eax
+ 859:	e9 35 ff ff ff       	jmp    793 <dosyscall>
+
+0000085e <fstat>:
+SYSCALL(fstat)
+ 85e:	b8 08 00 00 00       	mov    $0x8,%eax
+ 863:	e9 2b ff ff ff       	jmp    793 <dosyscall>
+
+00000868 <link>:
+SYSCALL(link)
+ 868:	b8 13 00 00 00       	mov    $0x13,%eax
+ 86d:	e9 21 ff ff ff       	jmp    793 <dosyscall>
+
+00000872 <mkdir>:
+SYSCALL(mkdir)
+ 872:	b8 14 00 00 00       	mov    $0x14,%eax
+ 877:	e9 17 ff ff ff       	jmp    793 <dosyscall>
+
+0000087c <chdir>:
+SYSCALL(chdir)
+ 87c:	b8 09 00 00 00       	mov    $0x9,%eax
+ 881:	e9 0d ff ff ff       	jmp    793 <dosyscall>
+
+00000886 <dup>:
+SYSCALL(dup)
+ 886:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 88b:	e9 03 ff ff ff       	jmp    793 <dosyscall>
+
+00000890 <getpid>:
+SYSCALL(getpid)
+ 890:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 895:	e9 f9 fe ff ff       	jmp    793 <dosyscall>
+
+0000089a <sbrk>:
+SYSCALL(sbrk)
+ 89a:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 89f:	e9 ef fe ff ff       	jmp    793 <dosyscall>
+
+000008a4 <sleep>:
+SYSCALL(sleep)
+ 8a4:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 8a9:	e9 e5 fe ff ff       	jmp    793 <dosyscall>
+
+000008ae <uptime>:
+SYSCALL(uptime)
+ 8ae:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 8b3:	e9 db fe ff ff       	jmp    793 <dosyscall>
+
+000008b8 <date>:
+SYSCALL(date)
+ 8b8:	b8 16 00 00 00       	mov    $0x16,%eax
+ 8bd:	e9 d1 fe ff ff       	jmp    793 <dosyscall>
+
+000008c2 <dup2>:
+SYSCALL(dup2)
+ 8c2:	b8 17 00 00 00       	mov    $0x17,%eax
+ 8c7:	e9 c7 fe ff ff       	jmp    793 <dosyscall>
+
+000008cc <uffd>:
+SYSCALL(uffd)
+ 8cc:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 8d1:	e9 bd fe ff ff       	jmp    793 <dosyscall>
+
+000008d6 <uffdregister>:
+SYSCALL(uffdregister)
+ 8d6:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 8db:	e9 b3 fe ff ff       	jmp    793 <dosyscall>
+
+000008e0 <uffdcopy>:
+SYSCALL(uffdcopy)
+ 8e0:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 8e5:	e9 a9 fe ff ff       	jmp    793 <dosyscall>
+
+000008ea <getpriority>:
+SYSCALL(getpriority)
+ 8ea:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 8ef:	e9 9f fe ff ff       	jmp    793 <dosyscall>
+
+000008f4 <setpriority>:
+SYSCALL(setpriority)
+ 8f4:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 8f9:	e9 95 fe ff ff       	jmp    793 <dosyscall>
+
+000008fe <setweight>:
+SYSCALL(setweight)
+ 8fe:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 903:	e9 8b fe ff ff       	jmp    793 <dosyscall>
+
+00000908 <setgroup>:
+SYSCALL(setgroup)
+ 908:	b8 20 00 00 00       	mov    $0x20,%eax
+ 90d:	e9 81 fe ff ff       	jmp    793 <dosyscall>
+
+00000912 <schedinfo>:
+SYSCALL(schedinfo)
+ 912:	b8 21 00 00 00       	mov    $0x21,%eax
+ 917:	e9 77 fe ff ff       	jmp    793 <dosyscall>
+
+0000091c <nanosleep>:
+SYSCALL(nanosleep)
+ 91c:	b8 22 00 00 00       	mov    $0x22,%eax
+ 921:	e9 6d fe ff ff       	jmp    793 <dosyscall>
+
+00000926 <clock_nanosleep>:
+SYSCALL(clock_nanosleep)
+ 926:	b8 23 00 00 00       	mov    $0x23,%eax
+ 92b:	e9 63 fe ff ff       	jmp    793 <dosyscall>
+
+00000930 <clock_gettime>:
+SYSCALL(clock_gettime)
+ 930:	b8 24 00 00 00       	mov    $0x24,%eax
+ 935:	e9 59 fe ff ff       	jmp    793 <dosyscall>
+
+0000093a <sched_setaffinity>:
+SYSCALL(sched_setaffinity)
+ 93a:	b8 25 00 00 00       	mov    $0x25,%eax
+ 93f:	e9 4f fe ff ff       	jmp    793 <dosyscall>
+
+00000944 <sched_getaffinity>:
+SYSCALL(sched_getaffinity)
+ 944:	b8 26 00 00 00       	mov    $0x26,%eax
+ 949:	e9 45 fe ff ff       	jmp    793 <dosyscall>
+
+0000094e <irqaffinity>:
+SYSCALL(irqaffinity)
+ 94e:	b8 27 00 00 00       	mov    $0x27,%eax
+ 953:	e9 3b fe ff ff       	jmp    793 <dosyscall>
+
+00000958 <getrusage>:
+SYSCALL(getrusage)
+ 958:	b8 28 00 00 00       	mov    $0x28,%eax
+ 95d:	e9 31 fe ff ff       	jmp    793 <dosyscall>
+
+00000962 <times>:
+SYSCALL(times)
+ 962:	b8 29 00 00 00       	mov    $0x29,%eax
+ 967:	e9 27 fe ff ff       	jmp    793 <dosyscall>
+
+0000096c <schedlat>:
+SYSCALL(schedlat)
+ 96c:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 971:	e9 1d fe ff ff       	jmp    793 <dosyscall>
+
+00000976 <sched_setscheduler>:
+SYSCALL(sched_setscheduler)
+ 976:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 97b:	e9 13 fe ff ff       	jmp    793 <dosyscall>
+
+00000980 <sched_getscheduler>:
+SYSCALL(sched_getscheduler)
+ 980:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 985:	e9 09 fe ff ff       	jmp    793 <dosyscall>
+
+0000098a <sched_getparam>:
+SYSCALL(sched_getparam)
+ 98a:	b8 2d 00 00 00       	mov    $0x2d,%eax
+ 98f:	e9 ff fd ff ff       	jmp    793 <dosyscall>
+
+00000994 <lockstat>:
+SYSCALL(lockstat)
+ 994:	b8 2e 00 00 00       	mov    $0x2e,%eax
+ 999:	e9 f5 fd ff ff       	jmp    793 <dosyscall>
+
+0000099e <ioring_setup>:
+SYSCALL(ioring_setup)
+ 99e:	b8 2f 00 00 00       	mov    $0x2f,%eax
+ 9a3:	e9 eb fd ff ff       	jmp    793 <dosyscall>
+
+000009a8 <ioring_enter>:
+SYSCALL(ioring_enter)
+ 9a8:	b8 30 00 00 00       	mov    $0x30,%eax
+ 9ad:	e9 e1 fd ff ff       	jmp    793 <dosyscall>
+
+000009b2 <readv>:
+SYSCALL(readv)
+ 9b2:	b8 31 00 00 00       	mov    $0x31,%eax
+ 9b7:	e9 d7 fd ff ff       	jmp    793 <dosyscall>
+
+000009bc <writev>:
+SYSCALL(writev)
+ 9bc:	b8 32 00 00 00       	mov    $0x32,%eax
+ 9c1:	e9 cd fd ff ff       	jmp    793 <dosyscall>
+
+000009c6 <pread>:
+SYSCALL(pread)
+ 9c6:	b8 33 00 00 00       	mov    $0x33,%eax
+ 9cb:	e9 c3 fd ff ff       	jmp    793 <dosyscall>
+
+000009d0 <pwrite>:
+SYSCALL(pwrite)
+ 9d0:	b8 34 00 00 00       	mov    $0x34,%eax
+ 9d5:	e9 b9 fd ff ff       	jmp    793 <dosyscall>
+
+000009da <sendfile>:
+SYSCALL(sendfile)
+ 9da:	b8 35 00 00 00       	mov    $0x35,%eax
+ 9df:	e9 af fd ff ff       	jmp    793 <dosyscall>
+
+000009e4 <splice>:
+SYSCALL(splice)
+ 9e4:	b8 36 00 00 00       	mov    $0x36,%eax
+ 9e9:	e9 a5 fd ff ff       	jmp    793 <dosyscall>
+
+000009ee <sysstat>:
+SYSCALL(sysstat)
+ 9ee:	b8 37 00 00 00       	mov    $0x37,%eax
+ 9f3:	e9 9b fd ff ff       	jmp    793 <dosyscall>
+
+000009f8 <strace>:
+SYSCALL(strace)
+ 9f8:	b8 38 00 00 00       	mov    $0x38,%eax
+ 9fd:	e9 91 fd ff ff       	jmp    793 <dosyscall>
+
+00000a02 <straceread>:
+SYSCALL(straceread)
+ a02:	b8 39 00 00 00       	mov    $0x39,%eax
+ a07:	e9 87 fd ff ff       	jmp    793 <dosyscall>
+
+00000a0c <alarm>:
+
+# alarm and rstoregs keep to int $T_SYSCALL: rstoregs restores
+# %ecx and %edx, which sysexit would clobber.
+.globl alarm
+    alarm:
+        pushl $rstoregs
+ a0c:	68 1c 0a 00 00       	push   $0xa1c
+        movl $SYS_alarm, %eax
+ a11:	b8 18 00 00 00       	mov    $0x18,%eax
+        int $T_SYSCALL
+ a16:	cd 40                	int    $0x40
+        add $0x04, %esp
+ a18:	83 c4 04             	add    $0x4,%esp
+        ret
+ a1b:	c3                   	ret
+
+00000a1c <rstoregs>:
+
+.globl rstoregs
+    rstoregs:
+        movl $SYS_rstoregs, %eax
+ a1c:	b8 19 00 00 00       	mov    $0x19,%eax
+        int $T_SYSCALL
+ a21:	cd 40                	int    $0x40
+
+00000a23 <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ a23:	55                   	push   %ebp
+ a24:	89 e5                	mov    %esp,%ebp
+ a26:	83 ec 18             	sub    $0x18,%esp
+ a29:	8b 45 0c             	mov    0xc(%ebp),%eax
+ a2c:	88 45 f4             	mov    %al,-0xc(%ebp)
+    write(fd, &c, 1);
+ a2f:	83 ec 04             	sub    $0x4,%esp
+ a32:	6a 01                	push   $0x1
+ a34:	8d 45 f4             	lea    -0xc(%ebp),%eax
+ a37:	50                   	push   %eax
+ a38:	ff 75 08             	push   0x8(%ebp)
+ a3b:	e8 d8 fd ff ff       	call   818 <write>
+ a40:	83 c4 10             	add    $0x10,%esp
+}
+ a43:	90                   	nop
+ a44:	c9                   	leave
+ a45:	c3                   	ret
+
+00000a46 <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ a46:	55                   	push   %ebp
+ a47:	89 e5                	mov    %esp,%ebp
+ a49:	83 ec 28             	sub    $0x28,%esp
+    static char digits[] = "0123456789ABCDEF";
+    char buf[16];
+    int i, neg;
+    uint x;
+
+    neg = 0;
+ a4c:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+    if(sgn && xx < 0){
+ a53:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+ a57:	74 17                	je     a70 <printint+0x2a>
+ a59:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ a5d:	79 11                	jns    a70 <printint+0x2a>
+        neg = 1;
+ a5f:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+        x = -xx;
+ a66:	8b 45 0c             	mov    0xc(%ebp),%eax
+ a69:	f7 d8                	neg    %eax
+ a6b:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ a6e:	eb 06                	jmp    a76 <printint+0x30>
+    } else {
+        x = xx;
+ a70:	8b 45 0c             	mov    0xc(%ebp),%eax
+ a73:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    }
+
+    i = 0;
+ a76:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    do{
+        buf[i++] = digits[x % base];
+ a7d:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ a80:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ a83:	ba 00 00 00 00       	mov    $0x0,%edx
+ a88:	f7 f1                	div    %ecx
+ a8a:	89 d1                	mov    %edx,%ecx
+ a8c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a8f:	8d 50 01             	lea    0x1(%eax),%edx
+ a92:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ a95:	0f b6 91 0c 12 00 00 	movzbl 0x120c(%ecx),%edx
+ a9c:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+    }while((x /= base) != 0);
+ aa0:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ aa3:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ aa6:	ba 00 00 00 00       	mov    $0x0,%edx
+ aab:	f7 f1                	div    %ecx
+ aad:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ ab0:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ ab4:	75 c7                	jne    a7d <printint+0x37>
+    if(neg)
+ ab6:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ aba:	74 2d                	je     ae9 <printint+0xa3>
+        buf[i++] = '-';
+ abc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ abf:	8d 50 01             	lea    0x1(%eax),%edx
+ ac2:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ ac5:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+    while(--i >= 0)
+ aca:	eb 1d                	jmp    ae9 <printint+0xa3>
+        putc(fd, buf[i]);
+ acc:	8d 55 dc             	lea    -0x24(%ebp),%edx
+ acf:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ ad2:	01 d0                	add    %edx,%eax
+ ad4:	0f b6 00             	movzbl (%eax),%eax
+ ad7:	0f be c0             	movsbl %al,%eax
+ ada:	83 ec 08             	sub    $0x8,%esp
+ add:	50                   	push   %eax
+ ade:	ff 75 08             	push   0x8(%ebp)
+ ae1:	e8 3d ff ff ff       	call   a23 <putc>
+ ae6:	83 c4 10             	add    $0x10,%esp
+    while(--i >= 0)
+ ae9:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+ aed:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ af1:	79 d9                	jns    acc <printint+0x86>
+}
+ af3:	90                   	nop
+ af4:	90                   	nop
+ af5:	c9                   	leave
+ af6:	c3                   	ret
+
+00000af7 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ af7:	55                   	push   %ebp
+ af8:	89 e5                	mov    %esp,%ebp
+ afa:	83 ec 28             	sub    $0x28,%esp
+    char *s;
+    int c, i, state;
+    uint *ap;
+
+    state = 0;
+ afd:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+    ap = (uint*)(void*)&fmt + 1;
+ b04:	8d 45 0c             	lea    0xc(%ebp),%eax
+ b07:	83 c0 04             	add    $0x4,%eax
+ b0a:	89 45 e8             	mov    %eax,-0x18(%ebp)
+    for(i = 0; fmt[i]; i++){
+ b0d:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ b14:	e9 59 01 00 00       	jmp    c72 <printf+0x17b>
+        c = fmt[i] & 0xff;
+ b19:	8b 55 0c             	mov    0xc(%ebp),%edx
+ b1c:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ b1f:	01 d0                	add    %edx,%eax
+ b21:	0f b6 00             	movzbl (%eax),%eax
+ b24:	0f be c0             	movsbl %al,%eax
+ b27:	25 ff 00 00 00       	and    $0xff,%eax
+ b2c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        if(state == 0){
+ b2f:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ b33:	75 2c                	jne    b61 <printf+0x6a>
+            if(c == '%'){
+ b35:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ b39:	75 0c                	jne    b47 <printf+0x50>
+                state = '%';
+ b3b:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+ b42:	e9 27 01 00 00       	jmp    c6e <printf+0x177>
+            } else {
+                putc(fd, c);
+ b47:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ b4a:	0f be c0             	movsbl %al,%eax
+ b4d:	83 ec 08             	sub    $0x8,%esp
+ b50:	50                   	push   %eax
+ b51:	ff 75 08             	push   0x8(%ebp)
+ b54:	e8 ca fe ff ff       	call   a23 <putc>
+ b59:	83 c4 10             	add    $0x10,%esp
+ b5c:	e9 0d 01 00 00       	jmp    c6e <printf+0x177>
+            }
+        } else if(state == '%'){
+ b61:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+ b65:	0f 85 03 01 00 00    	jne    c6e <printf+0x177>
+            if(c == 'd'){
+ b6b:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+ b6f:	75 1e                	jne    b8f <printf+0x98>
+                printint(fd, *ap, 10, 1);
+ b71:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ b74:	8b 00                	mov    (%eax),%eax
+ b76:	6a 01                	push   $0x1
+ b78:	6a 0a                	push   $0xa
+ b7a:	50                   	push   %eax
+ b7b:	ff 75 08             	push   0x8(%ebp)
+ b7e:	e8 c3 fe ff ff       	call   a46 <printint>
+ b83:	83 c4 10             	add    $0x10,%esp
+                ap++;
+ b86:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ b8a:	e9 d8 00 00 00       	jmp    c67 <printf+0x170>
+            } else if(c == 'x' || c == 'p'){
+ b8f:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+ b93:	74 06                	je     b9b <printf+0xa4>
+ b95:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+ b99:	75 1e                	jne    bb9 <printf+0xc2>
+                printint(fd, *ap, 16, 0);
+ b9b:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ b9e:	8b 00                	mov    (%eax),%eax
+ ba0:	6a 00                	push   $0x0
+ ba2:	6a 10                	push   $0x10
+ ba4:	50                   	push   %eax
+ ba5:	ff 75 08             	push   0x8(%ebp)
+ ba8:	e8 99 fe ff ff       	call   a46 <printint>
+ bad:	83 c4 10             	add    $0x10,%esp
+                ap++;
+ bb0:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ bb4:	e9 ae 00 00 00       	jmp    c67 <printf+0x170>
+            } else if(c == 's'){
+ bb9:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+ bbd:	75 43                	jne    c02 <printf+0x10b>
+                s = (char*)*ap;
+ bbf:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ bc2:	8b 00                	mov    (%eax),%eax
+ bc4:	89 45 f4             	mov    %eax,-0xc(%ebp)
+                ap++;
+ bc7:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+                if(s == 0)
+ bcb:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ bcf:	75 25                	jne    bf6 <printf+0xff>
+                    s = "(null)";
+ bd1:	c7 45 f4 46 0f 00 00 	movl   $0xf46,-0xc(%ebp)
+                while(*s != 0){
+ bd8:	eb 1c                	jmp    bf6 <printf+0xff>
+                    putc(fd, *s);
+ bda:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ bdd:	0f b6 00             	movzbl (%eax),%eax
+ be0:	0f be c0             	movsbl %al,%eax
+ be3:	83 ec 08             	sub    $0x8,%esp
+ be6:	50                   	push   %eax
+ be7:	ff 75 08             	push   0x8(%ebp)
+ bea:	e8 34 fe ff ff       	call   a23 <putc>
+ bef:	83 c4 10             	add    $0x10,%esp
+                    s++;
+ bf2:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+                while(*s != 0){
+ bf6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ bf9:	0f b6 00             	movzbl (%eax),%eax
+ bfc:	84 c0                	test   %al,%al
+ bfe:	75 da                	jne    bda <printf+0xe3>
+ c00:	eb 65                	jmp    c67 <printf+0x170>
+                }
+            } else if(c == 'c'){
+ c02:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+ c06:	75 1d                	jne    c25 <printf+0x12e>
+                putc(fd, *ap);
+ c08:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ c0b:	8b 00                	mov    (%eax),%eax
+ c0d:	0f be c0             	movsbl %al,%eax
+ c10:	83 ec 08             	sub    $0x8,%esp
+ c13:	50                   	push   %eax
+ c14:	ff 75 08             	push   0x8(%ebp)
+ c17:	e8 07 fe ff ff       	call   a23 <putc>
+ c1c:	83 c4 10             	add    $0x10,%esp
+                ap++;
+ c1f:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ c23:	eb 42                	jmp    c67 <printf+0x170>
+            } else if(c == '%'){
+ c25:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ c29:	75 17                	jne    c42 <printf+0x14b>
+                putc(fd, c);
+ c2b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ c2e:	0f be c0             	movsbl %al,%eax
+ c31:	83 ec 08             	sub    $0x8,%esp
+ c34:	50                   	push   %eax
+ c35:	ff 75 08             	push   0x8(%ebp)
+ c38:	e8 e6 fd ff ff       	call   a23 <putc>
+ c3d:	83 c4 10             	add    $0x10,%esp
+ c40:	eb 25                	jmp    c67 <printf+0x170>
+            } else {
+                // Unknown % sequence.    Print it to draw attention.
+                putc(fd, '%');
+ c42:	83 ec 08             	sub    $0x8,%esp
+ c45:	6a 25                	push   $0x25
+ c47:	ff 75 08             	push   0x8(%ebp)
+ c4a:	e8 d4 fd ff ff       	call   a23 <putc>
+ c4f:	83 c4 10             	add    $0x10,%esp
+                putc(fd, c);
+ c52:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ c55:	0f be c0             	movsbl %al,%eax
+ c58:	83 ec 08             	sub    $0x8,%esp
+ c5b:	50                   	push   %eax
+ c5c:	ff 75 08             	push   0x8(%ebp)
+ c5f:	e8 bf fd ff ff       	call   a23 <putc>
+ c64:	83 c4 10             	add    $0x10,%esp
+            }
+            state = 0;
+ c67:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+    for(i = 0; fmt[i]; i++){
+ c6e:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ c72:	8b 55 0c             	mov    0xc(%ebp),%edx
+ c75:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ c78:	01 d0                	add    %edx,%eax
+ c7a:	0f b6 00             	movzbl (%eax),%eax
+ c7d:	84 c0                	test   %al,%al
+ c7f:	0f 85 94 fe ff ff    	jne    b19 <printf+0x22>
+        }
+    }
+}
+ c85:	90                   	nop
+ c86:	90                   	nop
+ c87:	c9                   	leave
+ c88:	c3                   	ret
+
+00000c89 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ c89:	55                   	push   %ebp
+ c8a:	89 e5                	mov    %esp,%ebp
+ c8c:	83 ec 10             	sub    $0x10,%esp
+    Header *bp, *p;
+
+    bp = (Header*)ap - 1;
+ c8f:	8b 45 08             	mov    0x8(%ebp),%eax
+ c92:	83 e8 08             	sub    $0x8,%eax
+ c95:	89 45 f8             	mov    %eax,-0x8(%ebp)
+    for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ c98:	a1 28 27 00 00       	mov    0x2728,%eax
+ c9d:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ ca0:	eb 24                	jmp    cc6 <free+0x3d>
+        if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ ca2:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ ca5:	8b 00                	mov    (%eax),%eax
+ ca7:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ caa:	72 12                	jb     cbe <free+0x35>
+ cac:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ caf:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ cb2:	72 24                	jb     cd8 <free+0x4f>
+ cb4:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ cb7:	8b 00                	mov    (%eax),%eax
+ cb9:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ cbc:	72 1a                	jb     cd8 <free+0x4f>
+    for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ cbe:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ cc1:	8b 00                	mov    (%eax),%eax
+ cc3:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ cc6:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ cc9:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ ccc:	73 d4                	jae    ca2 <free+0x19>
+ cce:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ cd1:	8b 00                	mov    (%eax),%eax
+ cd3:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ cd6:	73 ca                	jae    ca2 <free+0x19>
+            break;
+    if(bp + bp->s.size == p->s.ptr){
+ cd8:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ cdb:	8b 40 04             	mov    0x4(%eax),%eax
+ cde:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ ce5:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ ce8:	01 c2                	add    %eax,%edx
+ cea:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ ced:	8b 00                	mov    (%eax),%eax
+ cef:	39 c2                	cmp    %eax,%edx
+ cf1:	75 24                	jne    d17 <free+0x8e>
+        bp->s.size += p->s.ptr->s.size;
+ cf3:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ cf6:	8b 50 04             	mov    0x4(%eax),%edx
+ cf9:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ cfc:	8b 00                	mov    (%eax),%eax
+ cfe:	8b 40 04             	mov    0x4(%eax),%eax
+ d01:	01 c2                	add    %eax,%edx
+ d03:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ d06:	89 50 04             	mov    %edx,0x4(%eax)
+        bp->s.ptr = p->s.ptr->s.ptr;
+ d09:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ d0c:	8b 00                	mov    (%eax),%eax
+ d0e:	8b 10                	mov    (%eax),%edx
+ d10:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ d13:	89 10                	mov    %edx,(%eax)
+ d15:	eb 0a                	jmp    d21 <free+0x98>
+    } else
+        bp->s.ptr = p->s.ptr;
+ d17:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ d1a:	8b 10                	mov    (%eax),%edx
+ d1c:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ d1f:	89 10                	mov    %edx,(%eax)
+    if(p + p->s.size == bp){
+ d21:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ d24:	8b 40 04             	mov    0x4(%eax),%eax
+ d27:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ d2e:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ d31:	01 d0                	add    %edx,%eax
+ d33:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ d36:	75 20                	jne    d58 <free+0xcf>
+        p->s.size += bp->s.size;
+ d38:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ d3b:	8b 50 04             	mov    0x4(%eax),%edx
+ d3e:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ d41:	8b 40 04             	mov    0x4(%eax),%eax
+ d44:	01 c2                	add    %eax,%edx
+ d46:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ d49:	89 50 04             	mov    %edx,0x4(%eax)
+        p->s.ptr = bp->s.ptr;
+ d4c:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ d4f:	8b 10                	mov    (%eax),%edx
+ d51:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ d54:	89 10                	mov    %edx,(%eax)
+ d56:	eb 08                	jmp    d60 <free+0xd7>
+    } else
+        p->s.ptr = bp;
+ d58:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ d5b:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ d5e:	89 10                	mov    %edx,(%eax)
+    freep = p;
+ d60:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ d63:	a3 28 27 00 00       	mov    %eax,0x2728
+}
+ d68:	90                   	nop
+ d69:	c9                   	leave
+ d6a:	c3                   	ret
+
+00000d6b <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+ d6b:	55                   	push   %ebp
+ d6c:	89 e5                	mov    %esp,%ebp
+ d6e:	83 ec 18             	sub    $0x18,%esp
+    char *p;
+    Header *hp;
+
+    if(nu < 4096)
+ d71:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+ d78:	77 07                	ja     d81 <morecore+0x16>
+        nu = 4096;
+ d7a:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+    p = sbrk(nu * sizeof(Header));
+ d81:	8b 45 08             	mov    0x8(%ebp),%eax
+ d84:	c1 e0 03             	shl    $0x3,%eax
+ d87:	83 ec 0c             	sub    $0xc,%esp
+ d8a:	50                   	push   %eax
+ d8b:	e8 0a fb ff ff       	call   89a <sbrk>
+ d90:	83 c4 10             	add    $0x10,%esp
+ d93:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p == (char*)-1)
+ d96:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+ d9a:	75 07                	jne    da3 <morecore+0x38>
+        return 0;
+ d9c:	b8 00 00 00 00       	mov    $0x0,%eax
+ da1:	eb 26                	jmp    dc9 <morecore+0x5e>
+    hp = (Header*)p;
+ da3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ da6:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    hp->s.size = nu;
+ da9:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ dac:	8b 55 08             	mov    0x8(%ebp),%edx
+ daf:	89 50 04             	mov    %edx,0x4(%eax)
+    free((void*)(hp + 1));
+ db2:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ db5:	83 c0 08             	add    $0x8,%eax
+ db8:	83 ec 0c             	sub    $0xc,%esp
+ dbb:	50                   	push   %eax
+ dbc:	e8 c8 fe ff ff       	call   c89 <free>
+ dc1:	83 c4 10             	add    $0x10,%esp
+    return freep;
+ dc4:	a1 28 27 00 00       	mov    0x2728,%eax
+}
+ dc9:	c9                   	leave
+ dca:	c3                   	ret
+
+00000dcb <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ dcb:	55                   	push   %ebp
+ dcc:	89 e5                	mov    %esp,%ebp
+ dce:	83 ec 18             	sub    $0x18,%esp
+    Header *p, *prevp;
+    uint nunits;
+
+    nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ dd1:	8b 45 08             	mov    0x8(%ebp),%eax
+ dd4:	83 c0 07             	add    $0x7,%eax
+ dd7:	c1 e8 03             	shr    $0x3,%eax
+ dda:	83 c0 01             	add    $0x1,%eax
+ ddd:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    if((prevp = freep) == 0){
+ de0:	a1 28 27 00 00       	mov    0x2728,%eax
+ de5:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ de8:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ dec:	75 23                	jne    e11 <malloc+0x46>
+        base.s.ptr = freep = prevp = &base;
+ dee:	c7 45 f0 20 27 00 00 	movl   $0x2720,-0x10(%ebp)
+ df5:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ df8:	a3 28 27 00 00       	mov    %eax,0x2728
+ dfd:	a1 28 27 00 00       	mov    0x2728,%eax
+ e02:	a3 20 27 00 00       	mov    %eax,0x2720
+        base.s.size = 0;
+ e07:	c7 05 24 27 00 00 00 	movl   $0x0,0x2724
+ e0e:	00 00 00 
+    }
+    for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ e11:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ e14:	8b 00                	mov    (%eax),%eax
+ e16:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        if(p->s.size >= nunits){
+ e19:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ e1c:	8b 40 04             	mov    0x4(%eax),%eax
+ e1f:	3b 45 ec             	cmp    -0x14(%ebp),%eax
+ e22:	72 4d                	jb     e71 <malloc+0xa6>
+            if(p->s.size == nunits)
+ e24:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ e27:	8b 40 04             	mov    0x4(%eax),%eax
+ e2a:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+ e2d:	75 0c                	jne    e3b <malloc+0x70>
+                prevp->s.ptr = p->s.ptr;
+ e2f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ e32:	8b 10                	mov    (%eax),%edx
+ e34:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ e37:	89 10                	mov    %edx,(%eax)
+ e39:	eb 26                	jmp    e61 <malloc+0x96>
+            else {
+                p->s.size -= nunits;
+ e3b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ e3e:	8b 40 04             	mov    0x4(%eax),%eax
+ e41:	2b 45 ec             	sub    -0x14(%ebp),%eax
+ e44:	89 c2                	mov    %eax,%edx
+ e46:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ e49:	89 50 04             	mov    %edx,0x4(%eax)
+                p += p->s.size;
+ e4c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ e4f:	8b 40 04             	mov    0x4(%eax),%eax
+ e52:	c1 e0 03             	shl    $0x3,%eax
+ e55:	01 45 f4             	add    %eax,-0xc(%ebp)
+                p->s.size = nunits;
+ e58:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ e5b:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ e5e:	89 50 04             	mov    %edx,0x4(%eax)
+            }
+            freep = prevp;
+ e61:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ e64:	a3 28 27 00 00       	mov    %eax,0x2728
+            return (void*)(p + 1);
+ e69:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ e6c:	83 c0 08             	add    $0x8,%eax
+ e6f:	eb 3b                	jmp    eac <malloc+0xe1>
+        }
+        if(p == freep)
+ e71:	a1 28 27 00 00       	mov    0x2728,%eax
+ e76:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ e79:	75 1e                	jne    e99 <malloc+0xce>
+            if((p = morecore(nunits)) == 0)
+ e7b:	83 ec 0c             	sub    $0xc,%esp
+ e7e:	ff 75 ec             	push   -0x14(%ebp)
+ e81:	e8 e5 fe ff ff       	call   d6b <morecore>
+ e86:	83 c4 10             	add    $0x10,%esp
+ e89:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ e8c:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ e90:	75 07                	jne    e99 <malloc+0xce>
+                return 0;
+ e92:	b8 00 00 00 00       	mov    $0x0,%eax
+ e97:	eb 13                	jmp    eac <malloc+0xe1>
+    for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ e99:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ e9c:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ e9f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ ea2:	8b 00                	mov    (%eax),%eax
+ ea4:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        if(p->s.size >= nunits){
+ ea7:	e9 6d ff ff ff       	jmp    e19 <malloc+0x4e>
+    }
+}
+ eac:	c9                   	leave
+ ead:	c3                   	ret
@@ -0,0 +1,111 @@
+// Report lock contention statistics.
+//
+//    lockstats                 print the counts, most contended first
+//    lockstats on|off|reset    start, stop or zero the counting
+//    lockstats cmd [arg...]    count while cmd runs, then print
+//
+// Times are in TSC cycles.  Call sites are kernel pcs; look them
+// up in kernel.asm.
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "lockstat.h"
+
+#define NSTAT 64
+
+struct lockstat stats[NSTAT];
+
+// Print v in decimal.    There is no 64-bit division here, so
+// divide by 10 sixteen bits at a time.
+void
+printu64(uint64 v)
+{
+    ushort w[4];
+    char buf[24];
+    uint r, more;
+    int i, n;
+
+    for(i = 0; i < 4; i++)
+        w[i] = v >> (48 - 16*i);
+    n = sizeof(buf) - 1;
+    buf[n] = 0;
+    do {
+        r = 0;
+        more = 0;
+        for(i = 0; i < 4; i++){
+            r = (r << 16) | w[i];
+            w[i] = r / 10;
+            r %= 10;
+            more |= w[i];
+        }
+        buf[--n] = '0' + r;
+    } while(more);
+    printf(1, "%s", buf + n);
+}
+
+void
+report(void)
+{
+    struct lockstat t;
+    int i, j, n;
+
+    n = lockstat(LOCKSTAT_READ, stats, NSTAT);
+    for(i = 0; i < n; i++){
+        for(j = i+1; j < n; j++){
+            if(stats[j].ncontended > stats[i].ncontended){
+                t = stats[i];
+                stats[i] = stats[j];
+                stats[j] = t;
+            }
+        }
+    }
+    for(i = 0; i < n; i++){
+        printf(1, "%s%s: %d acquires, %d contended, wait ",
+            stats[i].name, stats[i].sleep ? " (sleep)" : "",
+            stats[i].nacquire, stats[i].ncontended);
+        printu64(stats[i].wait);
+        printf(1, " max ");
+        printu64(stats[i].maxwait);
+        printf(1, ", max hold ");
+        printu64(stats[i].maxhold);
+        printf(1, "\n");
+        for(j = 0; j < NLOCKSITE && stats[i].sitecount[j]; j++)
+            printf(1, "    %x %d\n", stats[i].sitepc[j], stats[i].sitecount[j]);
+    }
+}
+
+int
+main(int argc, char *argv[])
+{
+    int pid;
+
+    if(argc < 2){
+        report();
+        exit();
+    }
+    if(strcmp(argv[1], "on") == 0)
+        lockstat(LOCKSTAT_ON, 0, 0);
+    else if(strcmp(argv[1], "off") == 0)
+        lockstat(LOCKSTAT_OFF, 0, 0);
+    else if(strcmp(argv[1], "reset") == 0)
+        lockstat(LOCKSTAT_RESET, 0, 0);
+    else {
+        lockstat(LOCKSTAT_RESET, 0, 0);
+        lockstat(LOCKSTAT_ON, 0, 0);
+        pid = fork();
+        if(pid < 0){
+            printf(2, "lockstats: fork failed\n");
+            exit();
+        }
+        if(pid == 0){
+            exec(argv[1], argv + 1);
+            printf(2, "lockstats: exec %s failed\n", argv[1]);
+            exit();
+        }
+        wait();
+        lockstat(LOCKSTAT_OFF, 0, 0);
+        report();
+    }
+    exit();
+}
@@ -42,6 +42,7 @@ struct log {
     int size;
     int outstanding; // how many FS sys calls are executing.
     int committing;    // in commit(), please wait.
+    int ncommit;       // commits finished, for logsync().
     int dev;
     struct logheader lh;
 };
@@ -156,9 +157,9 @@ end_op(void)
         log.committing = 1;
     } else {
         // begin_op() may be waiting for log space,
-        // and decrementing log.outstanding has decreased
-        // the amount of reserved space.
-        wakeup(&log);
+        // and decrementing log.outstanding has freed
+        // exactly one operation's reservation.
+        wakeone(&log);
     }
     release(&log.lock);
 
@@ -168,11 +169,28 @@ end_op(void)
         commit();
         acquire(&log.lock);
         log.committing = 0;
+        log.ncommit++;
         wakeup(&log);
+        wakeup(&log.ncommit);
         release(&log.lock);
     }
 }
 
+// Wait until every FS system call that has finished is on disk.
+// If none are running or committing, that is already so; otherwise
+// the next commit to finish covers them.
+void
+logsync(void)
+{
+    int n;
+
+    acquire(&log.lock);
+    n = log.ncommit;
+    while((log.outstanding > 0 || log.committing) && log.ncommit == n)
+        sleep(&log.ncommit, &log.lock);
+    release(&log.lock);
+}
+
 // Copy modified blocks from cache to log.
 static void
 write_log(void)
@@ -0,0 +1,1698 @@
+
+_ls:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <fmtname>:
+#include "user.h"
+#include "fs.h"
+
+char*
+fmtname(char *path)
+{
+   0:	55                   	push   %ebp
+   1:	89 e5                	mov    %esp,%ebp
+   3:	53                   	push   %ebx
+   4:	83 ec 14             	sub    $0x14,%esp
+    static char buf[DIRSIZ+1];
+    char *p;
+
+    // Find first character after last slash.
+    for(p=path+strlen(path); p >= path && *p != '/'; p--)
+   7:	83 ec 0c             	sub    $0xc,%esp
+   a:	ff 75 08             	push   0x8(%ebp)
+   d:	e8 c7 03 00 00       	call   3d9 <strlen>
+  12:	83 c4 10             	add    $0x10,%esp
+  15:	8b 55 08             	mov    0x8(%ebp),%edx
+  18:	01 d0                	add    %edx,%eax
+  1a:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  1d:	eb 04                	jmp    23 <fmtname+0x23>
+  1f:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+  23:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  26:	3b 45 08             	cmp    0x8(%ebp),%eax
+  29:	72 0a                	jb     35 <fmtname+0x35>
+  2b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  2e:	0f b6 00             	movzbl (%eax),%eax
+  31:	3c 2f                	cmp    $0x2f,%al
+  33:	75 ea                	jne    1f <fmtname+0x1f>
+        ;
+    p++;
+  35:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+
+    // Return blank-padded name.
+    if(strlen(p) >= DIRSIZ)
+  39:	83 ec 0c             	sub    $0xc,%esp
+  3c:	ff 75 f4             	push   -0xc(%ebp)
+  3f:	e8 95 03 00 00       	call   3d9 <strlen>
+  44:	83 c4 10             	add    $0x10,%esp
+  47:	83 f8 0d             	cmp    $0xd,%eax
+  4a:	76 05                	jbe    51 <fmtname+0x51>
+        return p;
+  4c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  4f:	eb 60                	jmp    b1 <fmtname+0xb1>
+    memmove(buf, p, strlen(p));
+  51:	83 ec 0c             	sub    $0xc,%esp
+  54:	ff 75 f4             	push   -0xc(%ebp)
+  57:	e8 7d 03 00 00       	call   3d9 <strlen>
+  5c:	83 c4 10             	add    $0x10,%esp
+  5f:	83 ec 04             	sub    $0x4,%esp
+  62:	50                   	push   %eax
+  63:	ff 75 f4             	push   -0xc(%ebp)
+  66:	68 28 10 00 00       	push   $0x1028
+  6b:	e8 3b 05 00 00       	call   5ab <memmove>
+  70:	83 c4 10             	add    $0x10,%esp
+    memset(buf+strlen(p), ' ', DIRSIZ-strlen(p));
+  73:	83 ec 0c             	sub    $0xc,%esp
+  76:	ff 75 f4             	push   -0xc(%ebp)
+  79:	e8 5b 03 00 00       	call   3d9 <strlen>
+  7e:	83 c4 10             	add    $0x10,%esp
+  81:	ba 0e 00 00 00       	mov    $0xe,%edx
+  86:	89 d3                	mov    %edx,%ebx
+  88:	29 c3                	sub    %eax,%ebx
+  8a:	83 ec 0c             	sub    $0xc,%esp
+  8d:	ff 75 f4             	push   -0xc(%ebp)
+  90:	e8 44 03 00 00       	call   3d9 <strlen>
+  95:	83 c4 10             	add    $0x10,%esp
+  98:	05 28 10 00 00       	add    $0x1028,%eax
+  9d:	83 ec 04             	sub    $0x4,%esp
+  a0:	53                   	push   %ebx
+  a1:	6a 20                	push   $0x20
+  a3:	50                   	push   %eax
+  a4:	e8 57 03 00 00       	call   400 <memset>
+  a9:	83 c4 10             	add    $0x10,%esp
+    return buf;
+  ac:	b8 28 10 00 00       	mov    $0x1028,%eax
+}
+  b1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  b4:	c9                   	leave
+  b5:	c3                   	ret
+
+000000b6 <ls>:
+
+void
+ls(char *path)
+{
+  b6:	55                   	push   %ebp
+  b7:	89 e5                	mov    %esp,%ebp
+  b9:	57                   	push   %edi
+  ba:	56                   	push   %esi
+  bb:	53                   	push   %ebx
+  bc:	81 ec 3c 02 00 00    	sub    $0x23c,%esp
+    char buf[512], *p;
+    int fd;
+    struct dirent de;
+    struct stat st;
+
+    if((fd = open(path, 0)) < 0){
+  c2:	83 ec 08             	sub    $0x8,%esp
+  c5:	6a 00                	push   $0x0
+  c7:	ff 75 08             	push   0x8(%ebp)
+  ca:	e8 c6 05 00 00       	call   695 <open>
+  cf:	83 c4 10             	add    $0x10,%esp
+  d2:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  d5:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  d9:	79 1a                	jns    f5 <ls+0x3f>
+        printf(2, "ls: cannot open %s\n", path);
+  db:	83 ec 04             	sub    $0x4,%esp
+  de:	ff 75 08             	push   0x8(%ebp)
+  e1:	68 03 0d 00 00       	push   $0xd03
+  e6:	6a 02                	push   $0x2
+  e8:	e8 5f 08 00 00       	call   94c <printf>
+  ed:	83 c4 10             	add    $0x10,%esp
+        return;
+  f0:	e9 e3 01 00 00       	jmp    2d8 <ls+0x222>
+    }
+
+    if(fstat(fd, &st) < 0){
+  f5:	83 ec 08             	sub    $0x8,%esp
+  f8:	8d 85 bc fd ff ff    	lea    -0x244(%ebp),%eax
+  fe:	50                   	push   %eax
+  ff:	ff 75 e4             	push   -0x1c(%ebp)
+ 102:	e8 ac 05 00 00       	call   6b3 <fstat>
+ 107:	83 c4 10             	add    $0x10,%esp
+ 10a:	85 c0                	test   %eax,%eax
+ 10c:	79 28                	jns    136 <ls+0x80>
+        printf(2, "ls: cannot stat %s\n", path);
+ 10e:	83 ec 04             	sub    $0x4,%esp
+ 111:	ff 75 08             	push   0x8(%ebp)
+ 114:	68 17 0d 00 00       	push   $0xd17
+ 119:	6a 02                	push   $0x2
+ 11b:	e8 2c 08 00 00       	call   94c <printf>
+ 120:	83 c4 10             	add    $0x10,%esp
+        close(fd);
+ 123:	83 ec 0c             	sub    $0xc,%esp
+ 126:	ff 75 e4             	push   -0x1c(%ebp)
+ 129:	e8 49 05 00 00       	call   677 <close>
+ 12e:	83 c4 10             	add    $0x10,%esp
+        return;
+ 131:	e9 a2 01 00 00       	jmp    2d8 <ls+0x222>
+    }
+
+    switch(st.type){
+ 136:	0f b7 85 bc fd ff ff 	movzwl -0x244(%ebp),%eax
+ 13d:	98                   	cwtl
+ 13e:	83 f8 01             	cmp    $0x1,%eax
+ 141:	74 48                	je     18b <ls+0xd5>
+ 143:	83 f8 02             	cmp    $0x2,%eax
+ 146:	0f 85 7e 01 00 00    	jne    2ca <ls+0x214>
+    case T_FILE:
+        printf(1, "%s %d %d %d\n", fmtname(path), st.type, st.ino, st.size);
+ 14c:	8b bd cc fd ff ff    	mov    -0x234(%ebp),%edi
+ 152:	8b b5 c4 fd ff ff    	mov    -0x23c(%ebp),%esi
+ 158:	0f b7 85 bc fd ff ff 	movzwl -0x244(%ebp),%eax
+ 15f:	0f bf d8             	movswl %ax,%ebx
+ 162:	83 ec 0c             	sub    $0xc,%esp
+ 165:	ff 75 08             	push   0x8(%ebp)
+ 168:	e8 93 fe ff ff       	call   0 <fmtname>
+ 16d:	83 c4 10             	add    $0x10,%esp
+ 170:	83 ec 08             	sub    $0x8,%esp
+ 173:	57                   	push   %edi
+ 174:	56                   	push   %esi
+ 175:	53                   	push   %ebx
+ 176:	50                   	push   %eax
+ 177:	68 2b 0d 00 00       	push   $0xd2b
+ 17c:	6a 01                	push   $0x1
+ 17e:	e8 c9 07 00 00       	call   94c <printf>
+ 183:	83 c4 20             	add    $0x20,%esp
+        break;
+ 186:	e9 3f 01 00 00       	jmp    2ca <ls+0x214>
+
+    case T_DIR:
+        if(strlen(path) + 1 + DIRSIZ + 1 > sizeof buf){
+ 18b:	83 ec 0c             	sub    $0xc,%esp
+ 18e:	ff 75 08             	push   0x8(%ebp)
+ 191:	e8 43 02 00 00       	call   3d9 <strlen>
+ 196:	83 c4 10             	add    $0x10,%esp
+ 199:	83 c0 10             	add    $0x10,%eax
+ 19c:	3d 00 02 00 00       	cmp    $0x200,%eax
+ 1a1:	76 17                	jbe    1ba <ls+0x104>
+            printf(1, "ls: path too long\n");
+ 1a3:	83 ec 08             	sub    $0x8,%esp
+ 1a6:	68 38 0d 00 00       	push   $0xd38
+ 1ab:	6a 01                	push   $0x1
+ 1ad:	e8 9a 07 00 00       	call   94c <printf>
+ 1b2:	83 c4 10             	add    $0x10,%esp
+            break;
+ 1b5:	e9 10 01 00 00       	jmp    2ca <ls+0x214>
+        }
+        strcpy(buf, path);
+ 1ba:	83 ec 08             	sub    $0x8,%esp
+ 1bd:	ff 75 08             	push   0x8(%ebp)
+ 1c0:	8d 85 e0 fd ff ff    	lea    -0x220(%ebp),%eax
+ 1c6:	50                   	push   %eax
+ 1c7:	e8 9e 01 00 00       	call   36a <strcpy>
+ 1cc:	83 c4 10             	add    $0x10,%esp
+        p = buf+strlen(buf);
+ 1cf:	83 ec 0c             	sub    $0xc,%esp
+ 1d2:	8d 85 e0 fd ff ff    	lea    -0x220(%ebp),%eax
+ 1d8:	50                   	push   %eax
+ 1d9:	e8 fb 01 00 00       	call   3d9 <strlen>
+ 1de:	83 c4 10             	add    $0x10,%esp
+ 1e1:	8d 95 e0 fd ff ff    	lea    -0x220(%ebp),%edx
+ 1e7:	01 d0                	add    %edx,%eax
+ 1e9:	89 45 e0             	mov    %eax,-0x20(%ebp)
+        *p++ = '/';
+ 1ec:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ 1ef:	8d 50 01             	lea    0x1(%eax),%edx
+ 1f2:	89 55 e0             	mov    %edx,-0x20(%ebp)
+ 1f5:	c6 00 2f             	movb   $0x2f,(%eax)
+        while(read(fd, &de, sizeof(de)) == sizeof(de)){
+ 1f8:	e9 ac 00 00 00       	jmp    2a9 <ls+0x1f3>
+            if(de.inum == 0)
+ 1fd:	0f b7 85 d0 fd ff ff 	movzwl -0x230(%ebp),%eax
+ 204:	66 85 c0             	test   %ax,%ax
+ 207:	0f 84 9b 00 00 00    	je     2a8 <ls+0x1f2>
+                continue;
+            memmove(p, de.name, DIRSIZ);
+ 20d:	83 ec 04             	sub    $0x4,%esp
+ 210:	6a 0e                	push   $0xe
+ 212:	8d 85 d0 fd ff ff    	lea    -0x230(%ebp),%eax
+ 218:	83 c0 02             	add    $0x2,%eax
+ 21b:	50                   	push   %eax
+ 21c:	ff 75 e0             	push   -0x20(%ebp)
+ 21f:	e8 87 03 00 00       	call   5ab <memmove>
+ 224:	83 c4 10             	add    $0x10,%esp
+            p[DIRSIZ] = 0;
+ 227:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ 22a:	83 c0 0e             	add    $0xe,%eax
+ 22d:	c6 00 00             	movb   $0x0,(%eax)
+            if(stat(buf, &st) < 0){
+ 230:	83 ec 08             	sub    $0x8,%esp
+ 233:	8d 85 bc fd ff ff    	lea    -0x244(%ebp),%eax
+ 239:	50                   	push   %eax
+ 23a:	8d 85 e0 fd ff ff    	lea    -0x220(%ebp),%eax
+ 240:	50                   	push   %eax
+ 241:	e8 76 02 00 00       	call   4bc <stat>
+ 246:	83 c4 10             	add    $0x10,%esp
+ 249:	85 c0                	test   %eax,%eax
+ 24b:	79 1b                	jns    268 <ls+0x1b2>
+                printf(1, "ls: cannot stat %s\n", buf);
+ 24d:	83 ec 04             	sub    $0x4,%esp
+ 250:	8d 85 e0 fd ff ff    	lea    -0x220(%ebp),%eax
+ 256:	50                   	push   %eax
+ 257:	68 17 0d 00 00       	push   $0xd17
+ 25c:	6a 01                	push   $0x1
+ 25e:	e8 e9 06 00 00       	call   94c <printf>
+ 263:	83 c4 10             	add    $0x10,%esp
+                continue;
+ 266:	eb 41                	jmp    2a9 <ls+0x1f3>
+            }
+            printf(1, "%s %d %d %d\n", fmtname(buf), st.type, st.ino, st.size);
+ 268:	8b bd cc fd ff ff    	mov    -0x234(%ebp),%edi
+ 26e:	8b b5 c4 fd ff ff    	mov    -0x23c(%ebp),%esi
+ 274:	0f b7 85 bc fd ff ff 	movzwl -0x244(%ebp),%eax
+ 27b:	0f bf d8             	movswl %ax,%ebx
+ 27e:	83 ec 0c             	sub    $0xc,%esp
+ 281:	8d 85 e0 fd ff ff    	lea    -0x220(%ebp),%eax
+ 287:	50                   	push   %eax
+ 288:	e8 73 fd ff ff       	call   0 <fmtname>
+ 28d:	83 c4 10             	add    $0x10,%esp
+ 290:	83 ec 08             	sub    $0x8,%esp
+ 293:	57                   	push   %edi
+ 294:	56                   	push   %esi
+ 295:	53                   	push   %ebx
+ 296:	50                   	push   %eax
+ 297:	68 2b 0d 00 00       	push   $0xd2b
+ 29c:	6a 01                	push   $0x1
+ 29e:	e8 a9 06 00 00       	call   94c <printf>
+ 2a3:	83 c4 20             	add    $0x20,%esp
+ 2a6:	eb 01                	jmp    2a9 <ls+0x1f3>
+                continue;
+ 2a8:	90                   	nop
+        while(read(fd, &de, sizeof(de)) == sizeof(de)){
+ 2a9:	83 ec 04             	sub    $0x4,%esp
+ 2ac:	6a 10                	push   $0x10
+ 2ae:	8d 85 d0 fd ff ff    	lea    -0x230(%ebp),%eax
+ 2b4:	50                   	push   %eax
+ 2b5:	ff 75 e4             	push   -0x1c(%ebp)
+ 2b8:	e8 a6 03 00 00       	call   663 <read>
+ 2bd:	83 c4 10             	add    $0x10,%esp
+ 2c0:	83 f8 10             	cmp    $0x10,%eax
+ 2c3:	0f 84 34 ff ff ff    	je     1fd <ls+0x147>
+        }
+        break;
+ 2c9:	90                   	nop
+    }
+    close(fd);
+ 2ca:	83 ec 0c             	sub    $0xc,%esp
+ 2cd:	ff 75 e4             	push   -0x1c(%ebp)
+ 2d0:	e8 a2 03 00 00       	call   677 <close>
+ 2d5:	83 c4 10             	add    $0x10,%esp
+}
+ 2d8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 2db:	5b                   	pop    %ebx
+ 2dc:	5e                   	pop    %esi
+ 2dd:	5f                   	pop    %edi
+ 2de:	5d                   	pop    %ebp
+ 2df:	c3                   	ret
+
+000002e0 <main>:
+
+int
+main(int argc, char *argv[])
+{
+ 2e0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+ 2e4:	83 e4 f0             	and    $0xfffffff0,%esp
+ 2e7:	ff 71 fc             	push   -0x4(%ecx)
+ 2ea:	55                   	push   %ebp
+ 2eb:	89 e5                	mov    %esp,%ebp
+ 2ed:	53                   	push   %ebx
+ 2ee:	51                   	push   %ecx
+ 2ef:	83 ec 10             	sub    $0x10,%esp
+ 2f2:	89 cb                	mov    %ecx,%ebx
+    int i;
+
+    if(argc < 2){
+ 2f4:	83 3b 01             	cmpl   $0x1,(%ebx)
+ 2f7:	7f 15                	jg     30e <main+0x2e>
+        ls(".");
+ 2f9:	83 ec 0c             	sub    $0xc,%esp
+ 2fc:	68 4b 0d 00 00       	push   $0xd4b
+ 301:	e8 b0 fd ff ff       	call   b6 <ls>
+ 306:	83 c4 10             	add    $0x10,%esp
+        exit();
+ 309:	e8 40 03 00 00       	call   64e <exit>
+    }
+    for(i=1; i<argc; i++)
+ 30e:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+ 315:	eb 21                	jmp    338 <main+0x58>
+        ls(argv[i]);
+ 317:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 31a:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+ 321:	8b 43 04             	mov    0x4(%ebx),%eax
+ 324:	01 d0                	add    %edx,%eax
+ 326:	8b 00                	mov    (%eax),%eax
+ 328:	83 ec 0c             	sub    $0xc,%esp
+ 32b:	50                   	push   %eax
+ 32c:	e8 85 fd ff ff       	call   b6 <ls>
+ 331:	83 c4 10             	add    $0x10,%esp
+    for(i=1; i<argc; i++)
+ 334:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+ 338:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 33b:	3b 03                	cmp    (%ebx),%eax
+ 33d:	7c d8                	jl     317 <main+0x37>
+    exit();
+ 33f:	e8 0a 03 00 00       	call   64e <exit>
+
+00000344 <stosb>:
+strchr(const char *s, char c)
+{
+    for(; *s; s++)
+        if(*s == c)
+            return (char*)s;
+    return 0;
+ 344:	55                   	push   %ebp
+ 345:	89 e5                	mov    %esp,%ebp
+ 347:	57                   	push   %edi
+ 348:	53                   	push   %ebx
+}
+ 349:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 34c:	8b 55 10             	mov    0x10(%ebp),%edx
+ 34f:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 352:	89 cb                	mov    %ecx,%ebx
+ 354:	89 df                	mov    %ebx,%edi
+ 356:	89 d1                	mov    %edx,%ecx
+ 358:	fc                   	cld
+ 359:	f3 aa                	rep stos %al,%es:(%edi)
+ 35b:	89 ca                	mov    %ecx,%edx
+ 35d:	89 fb                	mov    %edi,%ebx
+ 35f:	89 5d 08             	mov    %ebx,0x8(%ebp)
+ 362:	89 55 10             	mov    %edx,0x10(%ebp)
+
+char*
+gets(char *buf, int max)
+{
+ 365:	90                   	nop
+ 366:	5b                   	pop    %ebx
+ 367:	5f                   	pop    %edi
+ 368:	5d                   	pop    %ebp
+ 369:	c3                   	ret
+
+0000036a <strcpy>:
+{
+ 36a:	55                   	push   %ebp
+ 36b:	89 e5                	mov    %esp,%ebp
+ 36d:	83 ec 10             	sub    $0x10,%esp
+    os = s;
+ 370:	8b 45 08             	mov    0x8(%ebp),%eax
+ 373:	89 45 fc             	mov    %eax,-0x4(%ebp)
+    while((*s++ = *t++) != 0)
+ 376:	90                   	nop
+ 377:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 37a:	8d 42 01             	lea    0x1(%edx),%eax
+ 37d:	89 45 0c             	mov    %eax,0xc(%ebp)
+ 380:	8b 45 08             	mov    0x8(%ebp),%eax
+ 383:	8d 48 01             	lea    0x1(%eax),%ecx
+ 386:	89 4d 08             	mov    %ecx,0x8(%ebp)
+ 389:	0f b6 12             	movzbl (%edx),%edx
+ 38c:	88 10                	mov    %dl,(%eax)
+ 38e:	0f b6 00             	movzbl (%eax),%eax
+ 391:	84 c0                	test   %al,%al
+ 393:	75 e2                	jne    377 <strcpy+0xd>
+    return os;
+ 395:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 398:	c9                   	leave
+ 399:	c3                   	ret
+
+0000039a <strcmp>:
+{
+ 39a:	55                   	push   %ebp
+ 39b:	89 e5                	mov    %esp,%ebp
+    while(*p && *p == *q)
+ 39d:	eb 08                	jmp    3a7 <strcmp+0xd>
+        p++, q++;
+ 39f:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 3a3:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+    while(*p && *p == *q)
+ 3a7:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3aa:	0f b6 00             	movzbl (%eax),%eax
+ 3ad:	84 c0                	test   %al,%al
+ 3af:	74 10                	je     3c1 <strcmp+0x27>
+ 3b1:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3b4:	0f b6 10             	movzbl (%eax),%edx
+ 3b7:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 3ba:	0f b6 00             	movzbl (%eax),%eax
+ 3bd:	38 c2                	cmp    %al,%dl
+ 3bf:	74 de                	je     39f <strcmp+0x5>
+    return (uchar)*p - (uchar)*q;
+ 3c1:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3c4:	0f b6 00             	movzbl (%eax),%eax
+ 3c7:	0f b6 d0             	movzbl %al,%edx
+ 3ca:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 3cd:	0f b6 00             	movzbl (%eax),%eax
+ 3d0:	0f b6 c0             	movzbl %al,%eax
+ 3d3:	29 c2                	sub    %eax,%edx
+ 3d5:	89 d0                	mov    %edx,%eax
+}
+ 3d7:	5d                   	pop    %ebp
+ 3d8:	c3                   	ret
+
+000003d9 <strlen>:
+{
+ 3d9:	55                   	push   %ebp
+ 3da:	89 e5                	mov    %esp,%ebp
+ 3dc:	83 ec 10             	sub    $0x10,%esp
+    for(n = 0; s[n]; n++)
+ 3df:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ 3e6:	eb 04                	jmp    3ec <strlen+0x13>
+ 3e8:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 3ec:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 3ef:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3f2:	01 d0                	add    %edx,%eax
+ 3f4:	0f b6 00             	movzbl (%eax),%eax
+ 3f7:	84 c0                	test   %al,%al
+ 3f9:	75 ed                	jne    3e8 <strlen+0xf>
+    return n;
+ 3fb:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 3fe:	c9                   	leave
+ 3ff:	c3                   	ret
+
+00000400 <memset>:
+{
+ 400:	55                   	push   %ebp
+ 401:	89 e5                	mov    %esp,%ebp
+    stosb(dst, c, n);
+ 403:	8b 45 10             	mov    0x10(%ebp),%eax
+ 406:	50                   	push   %eax
+ 407:	ff 75 0c             	push   0xc(%ebp)
+ 40a:	ff 75 08             	push   0x8(%ebp)
+ 40d:	e8 32 ff ff ff       	call   344 <stosb>
+ 412:	83 c4 0c             	add    $0xc,%esp
+    return dst;
+ 415:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 418:	c9                   	leave
+ 419:	c3                   	ret
+
+0000041a <strchr>:
+{
+ 41a:	55                   	push   %ebp
+ 41b:	89 e5                	mov    %esp,%ebp
+ 41d:	83 ec 04             	sub    $0x4,%esp
+ 420:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 423:	88 45 fc             	mov    %al,-0x4(%ebp)
+    for(; *s; s++)
+ 426:	eb 14                	jmp    43c <strchr+0x22>
+        if(*s == c)
+ 428:	8b 45 08             	mov    0x8(%ebp),%eax
+ 42b:	0f b6 00             	movzbl (%eax),%eax
+ 42e:	38 45 fc             	cmp    %al,-0x4(%ebp)
+ 431:	75 05                	jne    438 <strchr+0x1e>
+            return (char*)s;
+ 433:	8b 45 08             	mov    0x8(%ebp),%eax
+ 436:	eb 13                	jmp    44b <strchr+0x31>
+    for(; *s; s++)
+ 438:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 43c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 43f:	0f b6 00             	movzbl (%eax),%eax
+ 442:	84 c0                	test   %al,%al
+ 444:	75 e2                	jne    428 <strchr+0xe>
+    return 0;
+ 446:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 44b:	c9                   	leave
+ 44c:	c3                   	ret
+
+0000044d <gets>:
+{
+ 44d:	55                   	push   %ebp
+ 44e:	89 e5                	mov    %esp,%ebp
+ 450:	83 ec 18             	sub    $0x18,%esp
+    int i, cc;
+    char c;
+
+    for(i=0; i+1 < max; ){
+ 453:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 45a:	eb 42                	jmp    49e <gets+0x51>
+        cc = read(0, &c, 1);
+ 45c:	83 ec 04             	sub    $0x4,%esp
+ 45f:	6a 01                	push   $0x1
+ 461:	8d 45 ef             	lea    -0x11(%ebp),%eax
+ 464:	50                   	push   %eax
+ 465:	6a 00                	push   $0x0
+ 467:	e8 f7 01 00 00       	call   663 <read>
+ 46c:	83 c4 10             	add    $0x10,%esp
+ 46f:	89 45 f0             	mov    %eax,-0x10(%ebp)
+        if(cc < 1)
+ 472:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 476:	7e 33                	jle    4ab <gets+0x5e>
+            break;
+        buf[i++] = c;
+ 478:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 47b:	8d 50 01             	lea    0x1(%eax),%edx
+ 47e:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 481:	89 c2                	mov    %eax,%edx
+ 483:	8b 45 08             	mov    0x8(%ebp),%eax
+ 486:	01 c2                	add    %eax,%edx
+ 488:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 48c:	88 02                	mov    %al,(%edx)
+        if(c == '\n' || c == '\r')
+ 48e:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 492:	3c 0a                	cmp    $0xa,%al
+ 494:	74 16                	je     4ac <gets+0x5f>
+ 496:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 49a:	3c 0d                	cmp    $0xd,%al
+ 49c:	74 0e                	je     4ac <gets+0x5f>
+    for(i=0; i+1 < max; ){
+ 49e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 4a1:	83 c0 01             	add    $0x1,%eax
+ 4a4:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 4a7:	7f b3                	jg     45c <gets+0xf>
+ 4a9:	eb 01                	jmp    4ac <gets+0x5f>
+            break;
+ 4ab:	90                   	nop
+            break;
+    }
+    buf[i] = '\0';
+ 4ac:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 4af:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4b2:	01 d0                	add    %edx,%eax
+ 4b4:	c6 00 00             	movb   $0x0,(%eax)
+    return buf;
+ 4b7:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 4ba:	c9                   	leave
+ 4bb:	c3                   	ret
+
+000004bc <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 4bc:	55                   	push   %ebp
+ 4bd:	89 e5                	mov    %esp,%ebp
+ 4bf:	83 ec 18             	sub    $0x18,%esp
+    int fd;
+    int r;
+
+    fd = open(n, O_RDONLY);
+ 4c2:	83 ec 08             	sub    $0x8,%esp
+ 4c5:	6a 00                	push   $0x0
+ 4c7:	ff 75 08             	push   0x8(%ebp)
+ 4ca:	e8 c6 01 00 00       	call   695 <open>
+ 4cf:	83 c4 10             	add    $0x10,%esp
+ 4d2:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(fd < 0)
+ 4d5:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 4d9:	79 07                	jns    4e2 <stat+0x26>
+        return -1;
+ 4db:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 4e0:	eb 25                	jmp    507 <stat+0x4b>
+    r = fstat(fd, st);
+ 4e2:	83 ec 08             	sub    $0x8,%esp
+ 4e5:	ff 75 0c             	push   0xc(%ebp)
+ 4e8:	ff 75 f4             	push   -0xc(%ebp)
+ 4eb:	e8 c3 01 00 00       	call   6b3 <fstat>
+ 4f0:	83 c4 10             	add    $0x10,%esp
+ 4f3:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    close(fd);
+ 4f6:	83 ec 0c             	sub    $0xc,%esp
+ 4f9:	ff 75 f4             	push   -0xc(%ebp)
+ 4fc:	e8 76 01 00 00       	call   677 <close>
+ 501:	83 c4 10             	add    $0x10,%esp
+    return r;
+ 504:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ 507:	c9                   	leave
+ 508:	c3                   	ret
+
+00000509 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 509:	55                   	push   %ebp
+ 50a:	89 e5                	mov    %esp,%ebp
+ 50c:	83 ec 10             	sub    $0x10,%esp
+    int n;
+
+    n = 0;
+ 50f:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+    while('0' <= *s && *s <= '9')
+ 516:	eb 25                	jmp    53d <atoi+0x34>
+        n = n*10 + *s++ - '0';
+ 518:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 51b:	89 d0                	mov    %edx,%eax
+ 51d:	c1 e0 02             	shl    $0x2,%eax
+ 520:	01 d0                	add    %edx,%eax
+ 522:	01 c0                	add    %eax,%eax
+ 524:	89 c1                	mov    %eax,%ecx
+ 526:	8b 45 08             	mov    0x8(%ebp),%eax
+ 529:	8d 50 01             	lea    0x1(%eax),%edx
+ 52c:	89 55 08             	mov    %edx,0x8(%ebp)
+ 52f:	0f b6 00             	movzbl (%eax),%eax
+ 532:	0f be c0             	movsbl %al,%eax
+ 535:	01 c8                	add    %ecx,%eax
+ 537:	83 e8 30             	sub    $0x30,%eax
+ 53a:	89 45 fc             	mov    %eax,-0x4(%ebp)
+    while('0' <= *s && *s <= '9')
+ 53d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 540:	0f b6 00             	movzbl (%eax),%eax
+ 543:	3c 2f                	cmp    $0x2f,%al
+ 545:	7e 0a                	jle    551 <atoi+0x48>
+ 547:	8b 45 08             	mov    0x8(%ebp),%eax
+ 54a:	0f b6 00             	movzbl (%eax),%eax
+ 54d:	3c 39                	cmp    $0x39,%al
+ 54f:	7e c7                	jle    518 <atoi+0xf>
+    return n;
+ 551:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 554:	c9                   	leave
+ 555:	c3                   	ret
+
+00000556 <nice>:
+
+// Add inc to the caller's nice value; return the new value.
+int
+nice(int inc)
+{
+ 556:	55                   	push   %ebp
+ 557:	89 e5                	mov    %esp,%ebp
+ 559:	83 ec 18             	sub    $0x18,%esp
+    int n;
+
+    n = getpriority(0) + inc;
+ 55c:	83 ec 0c             	sub    $0xc,%esp
+ 55f:	6a 00                	push   $0x0
+ 561:	e8 d9 01 00 00       	call   73f <getpriority>
+ 566:	83 c4 10             	add    $0x10,%esp
+ 569:	8b 55 08             	mov    0x8(%ebp),%edx
+ 56c:	01 d0                	add    %edx,%eax
+ 56e:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(n < 0)
+ 571:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 575:	79 07                	jns    57e <nice+0x28>
+        n = 0;
+ 577:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    if(n > NICEMAX)
+ 57e:	83 7d f4 13          	cmpl   $0x13,-0xc(%ebp)
+ 582:	7e 07                	jle    58b <nice+0x35>
+        n = NICEMAX;
+ 584:	c7 45 f4 13 00 00 00 	movl   $0x13,-0xc(%ebp)
+    if(setpriority(0, n) < 0)
+ 58b:	83 ec 08             	sub    $0x8,%esp
+ 58e:	ff 75 f4             	push   -0xc(%ebp)
+ 591:	6a 00                	push   $0x0
+ 593:	e8 b1 01 00 00       	call   749 <setpriority>
+ 598:	83 c4 10             	add    $0x10,%esp
+ 59b:	85 c0                	test   %eax,%eax
+ 59d:	79 07                	jns    5a6 <nice+0x50>
+        return -1;
+ 59f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 5a4:	eb 03                	jmp    5a9 <nice+0x53>
+    return n;
+ 5a6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+ 5a9:	c9                   	leave
+ 5aa:	c3                   	ret
+
+000005ab <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 5ab:	55                   	push   %ebp
+ 5ac:	89 e5                	mov    %esp,%ebp
+ 5ae:	83 ec 10             	sub    $0x10,%esp
+    char *dst;
+    const char *src;
+
+    dst = vdst;
+ 5b1:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5b4:	89 45 fc             	mov    %eax,-0x4(%ebp)
+    src = vsrc;
+ 5b7:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 5ba:	89 45 f8             	mov    %eax,-0x8(%ebp)
+    while(n-- > 0)
+ 5bd:	eb 17                	jmp    5d6 <memmove+0x2b>
+        *dst++ = *src++;
+ 5bf:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 5c2:	8d 42 01             	lea    0x1(%edx),%eax
+ 5c5:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 5c8:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 5cb:	8d 48 01             	lea    0x1(%eax),%ecx
+ 5ce:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+ 5d1:	0f b6 12             	movzbl (%edx),%edx
+ 5d4:	88 10                	mov    %dl,(%eax)
+    while(n-- > 0)
+ 5d6:	8b 45 10             	mov    0x10(%ebp),%eax
+ 5d9:	8d 50 ff             	lea    -0x1(%eax),%edx
+ 5dc:	89 55 10             	mov    %edx,0x10(%ebp)
+ 5df:	85 c0                	test   %eax,%eax
+ 5e1:	7f dc                	jg     5bf <memmove+0x14>
+    return vdst;
+ 5e3:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 5e6:	c9                   	leave
+ 5e7:	c3                   	ret
+
+000005e8 <dosyscall>:
+sysmode:
+    .long 0
+
+    .text
+dosyscall:
+    cmpl $0, sysmode
+ 5e8:	83 3d 10 10 00 00 00 	cmpl   $0x0,0x1010
+    jg 2f
+ 5ef:	7f 0c                	jg     5fd <dosyscall+0x15>
+    jl 1f
+ 5f1:	7c 07                	jl     5fa <dosyscall+0x12>
+    call sepcheck
+ 5f3:	e8 27 00 00 00       	call   61f <sepcheck>
+    jmp dosyscall
+ 5f8:	eb ee                	jmp    5e8 <dosyscall>
+1:
+    int $T_SYSCALL
+ 5fa:	cd 40                	int    $0x40
+    ret
+ 5fc:	c3                   	ret
+2:
+    pushl %ebx
+ 5fd:	53                   	push   %ebx
+    pushl %esi
+ 5fe:	56                   	push   %esi
+    pushl %edi
+ 5ff:	57                   	push   %edi
+    pushl %ebp
+ 600:	55                   	push   %ebp
+    movl 20(%esp), %ebx
+ 601:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+    movl 24(%esp), %esi
+ 605:	8b 74 24 18          	mov    0x18(%esp),%esi
+    movl 28(%esp), %edi
+ 609:	8b 7c 24 1c          	mov    0x1c(%esp),%edi
+    movl 32(%esp), %ebp
+ 60d:	8b 6c 24 20          	mov    0x20(%esp),%ebp
+    movl %esp, %ecx
+ 611:	89 e1                	mov    %esp,%ecx
+    movl $3f, %edx
+ 613:	ba 1a 06 00 00       	mov    $0x61a,%edx
+    sysenter
+ 618:	0f 34                	sysenter
+3:
+    popl %ebp
+ 61a:	5d                   	pop    %ebp
+    popl %edi
+ 61b:	5f                   	pop    %edi
+    popl %esi
+ 61c:	5e                   	pop    %esi
+    popl %ebx
+ 61d:	5b                   	pop    %ebx
+    ret
+ 61e:	c3                   	ret
+
+0000061f <sepcheck>:
+
+# Set sysmode from cpuid's SEP flag.    Preserves %eax.
+sepcheck:
+    pushl %eax
+ 61f:	50                   	push   %eax
+    pushl %ebx
+ 620:	53                   	push   %ebx
+    movl $1, %eax
+ 621:	b8 01 00 00 00       	mov    $0x1,%eax
+    cpuid
+ 626:	0f a2                	cpuid
+    movl $-1, sysmode
+ 628:	c7 05 10 10 00 00 ff 	movl   $0xffffffff,0x1010
+ 62f:	ff ff ff 
+    testl $0x800, %edx
+ 632:	f7 c2 00 08 00 00    	test   $0x800,%edx
+    jz 1f
+ 638:	74 0a                	je     644 <sepcheck+0x25>
+    movl $1, sysmode
+ 63a:	c7 05 10 10 00 00 01 	movl   $0x1,0x1010
+ 641:	00 00 00 
+1:
+    popl %ebx
+ 644:	5b                   	pop    %ebx
+    popl %eax
+ 645:	58                   	pop    %eax
+    ret
+ 646:	c3                   	ret
+
+00000647 <fork>:
+
+SYSCALL(fork)
+ 647:	b8 01 00 00 00       	mov    $0x1,%eax
+ 64c:	eb 9a                	jmp    5e8 <dosyscall>
+
+0000064e <exit>:
+SYSCALL(exit)
+ 64e:	b8 02 00 00 00       	mov    $0x2,%eax
+ 653:	eb 93                	jmp    5e8 <dosyscall>
+
+00000655 <wait>:
+SYSCALL(wait)
+ 655:	b8 03 00 00 00       	mov    $0x3,%eax
+ 65a:	eb 8c                	jmp    5e8 <dosyscall>
+
+0000065c <pipe>:
+SYSCALL(pipe)
+ 65c:	b8 04 00 00 00       	mov    $0x4,%eax
+ 661:	eb 85                	jmp    5e8 <dosyscall>
+
+00000663 <read>:
+SYSCALL(read)
+ 663:	b8 05 00 00 00       	mov    $0x5,%eax
+ 668:	e9 7b ff ff ff       	jmp    5e8 <dosyscall>
+
+0000066d <write>:
+SYSCALL(write)
+ 66d:	b8 10 00 00 00       	mov    $0x10,%eax
+ 672:	e9 71 ff ff ff       	jmp    5e8 <dosyscall>
+
+00000677 <close>:
+SYSCALL(close)
+ 677:	b8 15 00 00 00       	mov    $0x15,%eax
+ 67c:	e9 67 ff ff ff       	jmp    5e8 <dosyscall>
+
+00000681 <kill>:
+SYSCALL(kill)
+ 681:	b8 06 00 00 00       	mov    $0x6,%eax
+ 686:	e9 5d ff ff ff       	jmp    5e8 <dosyscall>
+
+0000068b <exec>:
+SYSCALL(exec)
+ 68b:	b8 07 00 00 00       	mov    $0x7,%eax
+ 690:	e9 53 ff ff ff       	jmp    5e8 <dosyscall>
+
+00000695 <open>:
+SYSCALL(open)
+ 695:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 69a:	e9 49 ff ff ff       	jmp    5e8 <dosyscall>
+
+0000069f <mknod>:
+SYSCALL(mknod)
+ 69f:	b8 11 00 00 00       	mov    $0x11,%eax
+ 6a4:	e9 3f ff ff ff       	jmp    5e8 <dosyscall>
+
+000006a9 <unlink>:
+SYSCALL(unlink)
+ 6a9:	b8 12 00 00 00       	mov    $0x12,%eax
+ 6ae:	e9 35 ff ff ff       	jmp    5e8 <dosyscall>
+
+000006b3 <fstat>:
+SYSCALL(fstat)
+ 6b3:	b8 08 00 00 00       	mov    $0x8,%eax
+ 6b8:	e9 2b ff ff ff       	jmp    5e8 <dosyscall>
+
+000006bd <link>:
+SYSCALL(link)
+ 6bd:	b8 13 00 00 00       	mov    $0x13,%eax
+ 6c2:	e9 21 ff ff ff       	jmp    5e8 <dosyscall>
+
+000006c7 <mkdir>:
+SYSCALL(mkdir)
+ 6c7:	b8 14 00 00 00       	mov    $0x14,%eax
+ 6cc:	e9 17 ff ff ff       	jmp    5e8 <dosyscall>
+
+000006d1 <chdir>:
+SYSCALL(chdir)
+ 6d1:	b8 09 00 00 00       	mov    $0x9,%eax
+ 6d6:	e9 0d ff ff ff       	jmp    5e8 <dosyscall>
+
+000006db <dup>:
+SYSCALL(dup)
+ 6db:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 6e0:	e9 03 ff ff ff       	jmp    5e8 <dosyscall>
+
+000006e5 <getpid>:
+SYSCALL(getpid)
+ 6e5:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 6ea:	e9 f9 fe ff ff       	jmp    5e8 <dosyscall>
+
+000006ef <sbrk>:
+SYSCALL(sbrk)
+ 6ef:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 6f4:	e9 ef fe ff ff       	jmp    5e8 <dosyscall>
+
+000006f9 <sleep>:
+SYSCALL(sleep)
+ 6f9:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 6fe:	e9 e5 fe ff ff       	jmp    5e8 <dosyscall>
+
+00000703 <uptime>:
+SYSCALL(uptime)
+ 703:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 708:	e9 db fe ff ff       	jmp    5e8 <dosyscall>
+
+0000070d <date>:
+SYSCALL(date)
+ 70d:	b8 16 00 00 00       	mov    $0x16,%eax
+ 712:	e9 d1 fe ff ff       	jmp    5e8 <dosyscall>
+
+00000717 <dup2>:
+SYSCALL(dup2)
+ 717:	b8 17 00 00 00       	mov    $0x17,%eax
+ 71c:	e9 c7 fe ff ff       	jmp    5e8 <dosyscall>
+
+00000721 <uffd>:
+SYSCALL(uffd)
+ 721:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 726:	e9 bd fe ff ff       	jmp    5e8 <dosyscall>
+
+0000072b <uffdregister>:
+SYSCALL(uffdregister)
+ 72b:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 730:	e9 b3 fe ff ff       	jmp    5e8 <dosyscall>
+
+00000735 <uffdcopy>:
+SYSCALL(uffdcopy)
+ 735:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 73a:	e9 a9 fe ff ff       	jmp    5e8 <dosyscall>
+
+0000073f <getpriority>:
+SYSCALL(getpriority)
+ 73f:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 744:	e9 9f fe ff ff       	jmp    5e8 <dosyscall>
+
+00000749 <setpriority>:
+SYSCALL(setpriority)
+ 749:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 74e:	e9 95 fe ff ff       	jmp    5e8 <dosyscall>
+
+00000753 <setweight>:
+SYSCALL(setweight)
+ 753:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 758:	e9 8b fe ff ff       	jmp    5e8 <dosyscall>
+
+0000075d <setgroup>:
+SYSCALL(setgroup)
+ 75d:	b8 20 00 00 00       	mov    $0x20,%eax
+ 762:	e9 81 fe ff ff       	jmp    5e8 <dosyscall>
+
+00000767 <schedinfo>:
+SYSCALL(schedinfo)
+ 767:	b8 21 00 00 00       	mov    $0x21,%eax
+ 76c:	e9 77 fe ff ff       	jmp    5e8 <dosyscall>
+
+00000771 <nanosleep>:
+SYSCALL(nanosleep)
+ 771:	b8 22 00 00 00       	mov    $0x22,%eax
+ 776:	e9 6d fe ff ff       	jmp    5e8 <dosyscall>
+
+0000077b <clock_nanosleep>:
+SYSCALL(clock_nanosleep)
+ 77b:	b8 23 00 00 00       	mov    $0x23,%eax
+ 780:	e9 63 fe ff ff       	jmp    5e8 <dosyscall>
+
+00000785 <clock_gettime>:
+SYSCALL(clock_gettime)
+ 785:	b8 24 00 00 00       	mov    $0x24,%eax
+ 78a:	e9 59 fe ff ff       	jmp    5e8 <dosyscall>
+
+0000078f <sched_setaffinity>:
+SYSCALL(sched_setaffinity)
+ 78f:	b8 25 00 00 00       	mov    $0x25,%eax
+ 794:	e9 4f fe ff ff       	jmp    5e8 <dosyscall>
+
+00000799 <sched_getaffinity>:
+SYSCALL(sched_getaffinity)
+ 799:	b8 26 00 00 00       	mov    $0x26,%eax
+ 79e:	e9 45 fe ff ff       	jmp    5e8 <dosyscall>
+
+000007a3 <irqaffinity>:
+SYSCALL(irqaffinity)
+ 7a3:	b8 27 00 00 00       	mov    $0x27,%eax
+ 7a8:	e9 3b fe ff ff       	jmp    5e8 <dosyscall>
+
+000007ad <getrusage>:
+SYSCALL(getrusage)
+ 7ad:	b8 28 00 00 00       	mov    $0x28,%eax
+ 7b2:	e9 31 fe ff ff       	jmp    5e8 <dosyscall>
+
+000007b7 <times>:
+SYSCALL(times)
+ 7b7:	b8 29 00 00 00       	mov    $0x29,%eax
+ 7bc:	e9 27 fe ff ff       	jmp    5e8 <dosyscall>
+
+000007c1 <schedlat>:
+SYSCALL(schedlat)
+ 7c1:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 7c6:	e9 1d fe ff ff       	jmp    5e8 <dosyscall>
+
+000007cb <sched_setscheduler>:
+SYSCALL(sched_setscheduler)
+ 7cb:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 7d0:	e9 13 fe ff ff       	jmp    5e8 <dosyscall>
+
+000007d5 <sched_getscheduler>:
+SYSCALL(sched_getscheduler)
+ 7d5:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 7da:	e9 09 fe ff ff       	jmp    5e8 <dosyscall>
+
+000007df <sched_getparam>:
+SYSCALL(sched_getparam)
+ 7df:	b8 2d 00 00 00       	mov    $0x2d,%eax
+ 7e4:	e9 ff fd ff ff       	jmp    5e8 <dosyscall>
+
+000007e9 <lockstat>:
+SYSCALL(lockstat)
+ 7e9:	b8 2e 00 00 00       	mov    $0x2e,%eax
+ 7ee:	e9 f5 fd ff ff       	jmp    5e8 <dosyscall>
+
+000007f3 <ioring_setup>:
+SYSCALL(ioring_setup)
+ 7f3:	b8 2f 00 00 00       	mov    $0x2f,%eax
+ 7f8:	e9 eb fd ff ff       	jmp    5e8 <dosyscall>
+
+000007fd <ioring_enter>:
+SYSCALL(ioring_enter)
+ 7fd:	b8 30 00 00 00       	mov    $0x30,%eax
+ 802:	e9 e1 fd ff ff       	jmp    5e8 <dosyscall>
+
+00000807 <readv>:
+SYSCALL(readv)
+ 807:	b8 31 00 00 00       	mov    $0x31,%eax
+ 80c:	e9 d7 fd ff ff       	jmp    5e8 <dosyscall>
+
+00000811 <writev>:
+SYSCALL(writev)
+ 811:	b8 32 00 00 00       	mov    $0x32,%eax
+ 816:	e9 cd fd ff ff       	jmp    5e8 <dosyscall>
+
+0000081b <pread>:
+SYSCALL(pread)
+ 81b:	b8 33 00 00 00       	mov    $0x33,%eax
+ 820:	e9 c3 fd ff ff       	jmp    5e8 <dosyscall>
+
+00000825 <pwrite>:
+SYSCALL(pwrite)
+ 825:	b8 34 00 00 00       	mov    $0x34,%eax
+ 82a:	e9 b9 fd ff ff       	jmp    5e8 <dosyscall>
+
+0000082f <sendfile>:
+SYSCALL(sendfile)
+ 82f:	b8 35 00 00 00       	mov    $0x35,%eax
+ 834:	e9 af fd ff ff       	jmp    5e8 <dosyscall>
+
+00000839 <splice>:
+SYSCALL(splice)
+ 839:	b8 36 00 00 00       	mov    $0x36,%eax
+ 83e:	e9 a5 fd ff ff       	jmp    5e8 <dosyscall>
+
+00000843 <sysstat>:
+SYSCALL(sysstat)
+ 843:	b8 37 00 00 00       	mov    $0x37,%eax
+ 848:	e9 9b fd ff ff       	jmp    5e8 <dosyscall>
+
+0000084d <strace>:
+SYSCALL(strace)
+ 84d:	b8 38 00 00 00       	mov    $0x38,%eax
+ 852:	e9 91 fd ff ff       	jmp    5e8 <dosyscall>
+
+00000857 <straceread>:
+SYSCALL(straceread)
+ 857:	b8 39 00 00 00       	mov    $0x39,%eax
+ 85c:	e9 87 fd ff ff       	jmp    5e8 <dosyscall>
+
+00000861 <alarm>:
+
+# alarm and rstoregs keep to int $T_SYSCALL: rstoregs restores
+# %ecx and %edx, which sysexit would clobber.
+.globl alarm
+    alarm:
+        pushl $rstoregs
+ 861:	68 71 08 00 00       	push   $0x871
+        movl $SYS_alarm, %eax
+ 866:	b8 18 00 00 00       	mov    $0x18,%eax
+        int $T_SYSCALL
+ 86b:	cd 40                	int    $0x40
+        add $0x04, %esp
+ 86d:	83 c4 04             	add    $0x4,%esp
+        ret
+ 870:	c3                   	ret
+
+00000871 <rstoregs>:
+
+.globl rstoregs
+    rstoregs:
+        movl $SYS_rstoregs, %eax
+ 871:	b8 19 00 00 00       	mov    $0x19,%eax
+        int $T_SYSCALL
+ 876:	cd 40                	int    $0x40
+
+00000878 <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 878:	55                   	push   %ebp
+ 879:	89 e5                	mov    %esp,%ebp
+ 87b:	83 ec 18             	sub    $0x18,%esp
+ 87e:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 881:	88 45 f4             	mov    %al,-0xc(%ebp)
+    write(fd, &c, 1);
+ 884:	83 ec 04             	sub    $0x4,%esp
+ 887:	6a 01                	push   $0x1
+ 889:	8d 45 f4             	lea    -0xc(%ebp),%eax
+ 88c:	50                   	push   %eax
+ 88d:	ff 75 08             	push   0x8(%ebp)
+ 890:	e8 d8 fd ff ff       	call   66d <write>
+ 895:	83 c4 10             	add    $0x10,%esp
+}
+ 898:	90                   	nop
+ 899:	c9                   	leave
+ 89a:	c3                   	ret
+
+0000089b <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 89b:	55                   	push   %ebp
+ 89c:	89 e5                	mov    %esp,%ebp
+ 89e:	83 ec 28             	sub    $0x28,%esp
+    static char digits[] = "0123456789ABCDEF";
+    char buf[16];
+    int i, neg;
+    uint x;
+
+    neg = 0;
+ 8a1:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+    if(sgn && xx < 0){
+ 8a8:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+ 8ac:	74 17                	je     8c5 <printint+0x2a>
+ 8ae:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 8b2:	79 11                	jns    8c5 <printint+0x2a>
+        neg = 1;
+ 8b4:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+        x = -xx;
+ 8bb:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 8be:	f7 d8                	neg    %eax
+ 8c0:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 8c3:	eb 06                	jmp    8cb <printint+0x30>
+    } else {
+        x = xx;
+ 8c5:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 8c8:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    }
+
+    i = 0;
+ 8cb:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    do{
+        buf[i++] = digits[x % base];
+ 8d2:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 8d5:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 8d8:	ba 00 00 00 00       	mov    $0x0,%edx
+ 8dd:	f7 f1                	div    %ecx
+ 8df:	89 d1                	mov    %edx,%ecx
+ 8e1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 8e4:	8d 50 01             	lea    0x1(%eax),%edx
+ 8e7:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 8ea:	0f b6 91 14 10 00 00 	movzbl 0x1014(%ecx),%edx
+ 8f1:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+    }while((x /= base) != 0);
+ 8f5:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 8f8:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 8fb:	ba 00 00 00 00       	mov    $0x0,%edx
+ 900:	f7 f1                	div    %ecx
+ 902:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 905:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 909:	75 c7                	jne    8d2 <printint+0x37>
+    if(neg)
+ 90b:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 90f:	74 2d                	je     93e <printint+0xa3>
+        buf[i++] = '-';
+ 911:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 914:	8d 50 01             	lea    0x1(%eax),%edx
+ 917:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 91a:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+    while(--i >= 0)
+ 91f:	eb 1d                	jmp    93e <printint+0xa3>
+        putc(fd, buf[i]);
+ 921:	8d 55 dc             	lea    -0x24(%ebp),%edx
+ 924:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 927:	01 d0                	add    %edx,%eax
+ 929:	0f b6 00             	movzbl (%eax),%eax
+ 92c:	0f be c0             	movsbl %al,%eax
+ 92f:	83 ec 08             	sub    $0x8,%esp
+ 932:	50                   	push   %eax
+ 933:	ff 75 08             	push   0x8(%ebp)
+ 936:	e8 3d ff ff ff       	call   878 <putc>
+ 93b:	83 c4 10             	add    $0x10,%esp
+    while(--i >= 0)
+ 93e:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+ 942:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 946:	79 d9                	jns    921 <printint+0x86>
+}
+ 948:	90                   	nop
+ 949:	90                   	nop
+ 94a:	c9                   	leave
+ 94b:	c3                   	ret
+
+0000094c <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 94c:	55                   	push   %ebp
+ 94d:	89 e5                	mov    %esp,%ebp
+ 94f:	83 ec 28             	sub    $0x28,%esp
+    char *s;
+    int c, i, state;
+    uint *ap;
+
+    state = 0;
+ 952:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+    ap = (uint*)(void*)&fmt + 1;
+ 959:	8d 45 0c             	lea    0xc(%ebp),%eax
+ 95c:	83 c0 04             	add    $0x4,%eax
+ 95f:	89 45 e8             	mov    %eax,-0x18(%ebp)
+    for(i = 0; fmt[i]; i++){
+ 962:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 969:	e9 59 01 00 00       	jmp    ac7 <printf+0x17b>
+        c = fmt[i] & 0xff;
+ 96e:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 971:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 974:	01 d0                	add    %edx,%eax
+ 976:	0f b6 00             	movzbl (%eax),%eax
+ 979:	0f be c0             	movsbl %al,%eax
+ 97c:	25 ff 00 00 00       	and    $0xff,%eax
+ 981:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        if(state == 0){
+ 984:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 988:	75 2c                	jne    9b6 <printf+0x6a>
+            if(c == '%'){
+ 98a:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 98e:	75 0c                	jne    99c <printf+0x50>
+                state = '%';
+ 990:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+ 997:	e9 27 01 00 00       	jmp    ac3 <printf+0x177>
+            } else {
+                putc(fd, c);
+ 99c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 99f:	0f be c0             	movsbl %al,%eax
+ 9a2:	83 ec 08             	sub    $0x8,%esp
+ 9a5:	50                   	push   %eax
+ 9a6:	ff 75 08             	push   0x8(%ebp)
+ 9a9:	e8 ca fe ff ff       	call   878 <putc>
+ 9ae:	83 c4 10             	add    $0x10,%esp
+ 9b1:	e9 0d 01 00 00       	jmp    ac3 <printf+0x177>
+            }
+        } else if(state == '%'){
+ 9b6:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+ 9ba:	0f 85 03 01 00 00    	jne    ac3 <printf+0x177>
+            if(c == 'd'){
+ 9c0:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+ 9c4:	75 1e                	jne    9e4 <printf+0x98>
+                printint(fd, *ap, 10, 1);
+ 9c6:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 9c9:	8b 00                	mov    (%eax),%eax
+ 9cb:	6a 01                	push   $0x1
+ 9cd:	6a 0a                	push   $0xa
+ 9cf:	50                   	push   %eax
+ 9d0:	ff 75 08             	push   0x8(%ebp)
+ 9d3:	e8 c3 fe ff ff       	call   89b <printint>
+ 9d8:	83 c4 10             	add    $0x10,%esp
+                ap++;
+ 9db:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 9df:	e9 d8 00 00 00       	jmp    abc <printf+0x170>
+            } else if(c == 'x' || c == 'p'){
+ 9e4:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+ 9e8:	74 06                	je     9f0 <printf+0xa4>
+ 9ea:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+ 9ee:	75 1e                	jne    a0e <printf+0xc2>
+                printint(fd, *ap, 16, 0);
+ 9f0:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 9f3:	8b 00                	mov    (%eax),%eax
+ 9f5:	6a 00                	push   $0x0
+ 9f7:	6a 10                	push   $0x10
+ 9f9:	50                   	push   %eax
+ 9fa:	ff 75 08             	push   0x8(%ebp)
+ 9fd:	e8 99 fe ff ff       	call   89b <printint>
+ a02:	83 c4 10             	add    $0x10,%esp
+                ap++;
+ a05:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ a09:	e9 ae 00 00 00       	jmp    abc <printf+0x170>
+            } else if(c == 's'){
+ a0e:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+ a12:	75 43                	jne    a57 <printf+0x10b>
+                s = (char*)*ap;
+ a14:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ a17:	8b 00                	mov    (%eax),%eax
+ a19:	89 45 f4             	mov    %eax,-0xc(%ebp)
+                ap++;
+ a1c:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+                if(s == 0)
+ a20:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ a24:	75 25                	jne    a4b <printf+0xff>
+                    s = "(null)";
+ a26:	c7 45 f4 4d 0d 00 00 	movl   $0xd4d,-0xc(%ebp)
+                while(*s != 0){
+ a2d:	eb 1c                	jmp    a4b <printf+0xff>
+                    putc(fd, *s);
+ a2f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a32:	0f b6 00             	movzbl (%eax),%eax
+ a35:	0f be c0             	movsbl %al,%eax
+ a38:	83 ec 08             	sub    $0x8,%esp
+ a3b:	50                   	push   %eax
+ a3c:	ff 75 08             	push   0x8(%ebp)
+ a3f:	e8 34 fe ff ff       	call   878 <putc>
+ a44:	83 c4 10             	add    $0x10,%esp
+                    s++;
+ a47:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+                while(*s != 0){
+ a4b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a4e:	0f b6 00             	movzbl (%eax),%eax
+ a51:	84 c0                	test   %al,%al
+ a53:	75 da                	jne    a2f <printf+0xe3>
+ a55:	eb 65                	jmp    abc <printf+0x170>
+                }
+            } else if(c == 'c'){
+ a57:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+ a5b:	75 1d                	jne    a7a <printf+0x12e>
+                putc(fd, *ap);
+ a5d:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ a60:	8b 00                	mov    (%eax),%eax
+ a62:	0f be c0             	movsbl %al,%eax
+ a65:	83 ec 08             	sub    $0x8,%esp
+ a68:	50                   	push   %eax
+ a69:	ff 75 08             	push   0x8(%ebp)
+ a6c:	e8 07 fe ff ff       	call   878 <putc>
+ a71:	83 c4 10             	add    $0x10,%esp
+                ap++;
+ a74:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ a78:	eb 42                	jmp    abc <printf+0x170>
+            } else if(c == '%'){
+ a7a:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ a7e:	75 17                	jne    a97 <printf+0x14b>
+                putc(fd, c);
+ a80:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ a83:	0f be c0             	movsbl %al,%eax
+ a86:	83 ec 08             	sub    $0x8,%esp
+ a89:	50                   	push   %eax
+ a8a:	ff 75 08             	push   0x8(%ebp)
+ a8d:	e8 e6 fd ff ff       	call   878 <putc>
+ a92:	83 c4 10             	add    $0x10,%esp
+ a95:	eb 25                	jmp    abc <printf+0x170>
+            } else {
+                // Unknown % sequence.    Print it to draw attention.
+                putc(fd, '%');
+ a97:	83 ec 08             	sub    $0x8,%esp
+ a9a:	6a 25                	push   $0x25
+ a9c:	ff 75 08             	push   0x8(%ebp)
+ a9f:	e8 d4 fd ff ff       	call   878 <putc>
+ aa4:	83 c4 10             	add    $0x10,%esp
+                putc(fd, c);
+ aa7:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ aaa:	0f be c0             	movsbl %al,%eax
+ aad:	83 ec 08             	sub    $0x8,%esp
+ ab0:	50                   	push   %eax
+ ab1:	ff 75 08             	push   0x8(%ebp)
+ ab4:	e8 bf fd ff ff       	call   878 <putc>
+ ab9:	83 c4 10             	add    $0x10,%esp
+            }
+            state = 0;
+ abc:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+    for(i = 0; fmt[i]; i++){
+ ac3:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ ac7:	8b 55 0c             	mov    0xc(%ebp),%edx
+ aca:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ acd:	01 d0                	add    %edx,%eax
+ acf:	0f b6 00             	movzbl (%eax),%eax
+ ad2:	84 c0                	test   %al,%al
+ ad4:	0f 85 94 fe ff ff    	jne    96e <printf+0x22>
+        }
+    }
+}
+ ada:	90                   	nop
+ adb:	90                   	nop
+ adc:	c9                   	leave
+ add:	c3                   	ret
+
+00000ade <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ ade:	55                   	push   %ebp
+ adf:	89 e5                	mov    %esp,%ebp
+ ae1:	83 ec 10             	sub    $0x10,%esp
+    Header *bp, *p;
+
+    bp = (Header*)ap - 1;
+ ae4:	8b 45 08             	mov    0x8(%ebp),%eax
+ ae7:	83 e8 08             	sub    $0x8,%eax
+ aea:	89 45 f8             	mov    %eax,-0x8(%ebp)
+    for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ aed:	a1 40 10 00 00       	mov    0x1040,%eax
+ af2:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ af5:	eb 24                	jmp    b1b <free+0x3d>
+        if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ af7:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ afa:	8b 00                	mov    (%eax),%eax
+ afc:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ aff:	72 12                	jb     b13 <free+0x35>
+ b01:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ b04:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ b07:	72 24                	jb     b2d <free+0x4f>
+ b09:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b0c:	8b 00                	mov    (%eax),%eax
+ b0e:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ b11:	72 1a                	jb     b2d <free+0x4f>
+    for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ b13:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b16:	8b 00                	mov    (%eax),%eax
+ b18:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ b1b:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ b1e:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ b21:	73 d4                	jae    af7 <free+0x19>
+ b23:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b26:	8b 00                	mov    (%eax),%eax
+ b28:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ b2b:	73 ca                	jae    af7 <free+0x19>
+            break;
+    if(bp + bp->s.size == p->s.ptr){
+ b2d:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ b30:	8b 40 04             	mov    0x4(%eax),%eax
+ b33:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ b3a:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ b3d:	01 c2                	add    %eax,%edx
+ b3f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b42:	8b 00                	mov    (%eax),%eax
+ b44:	39 c2                	cmp    %eax,%edx
+ b46:	75 24                	jne    b6c <free+0x8e>
+        bp->s.size += p->s.ptr->s.size;
+ b48:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ b4b:	8b 50 04             	mov    0x4(%eax),%edx
+ b4e:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b51:	8b 00                	mov    (%eax),%eax
+ b53:	8b 40 04             	mov    0x4(%eax),%eax
+ b56:	01 c2                	add    %eax,%edx
+ b58:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ b5b:	89 50 04             	mov    %edx,0x4(%eax)
+        bp->s.ptr = p->s.ptr->s.ptr;
+ b5e:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b61:	8b 00                	mov    (%eax),%eax
+ b63:	8b 10                	mov    (%eax),%edx
+ b65:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ b68:	89 10                	mov    %edx,(%eax)
+ b6a:	eb 0a                	jmp    b76 <free+0x98>
+    } else
+        bp->s.ptr = p->s.ptr;
+ b6c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b6f:	8b 10                	mov    (%eax),%edx
+ b71:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ b74:	89 10                	mov    %edx,(%eax)
+    if(p + p->s.size == bp){
+ b76:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b79:	8b 40 04             	mov    0x4(%eax),%eax
+ b7c:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ b83:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b86:	01 d0                	add    %edx,%eax
+ b88:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ b8b:	75 20                	jne    bad <free+0xcf>
+        p->s.size += bp->s.size;
+ b8d:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b90:	8b 50 04             	mov    0x4(%eax),%edx
+ b93:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ b96:	8b 40 04             	mov    0x4(%eax),%eax
+ b99:	01 c2                	add    %eax,%edx
+ b9b:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b9e:	89 50 04             	mov    %edx,0x4(%eax)
+        p->s.ptr = bp->s.ptr;
+ ba1:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ ba4:	8b 10                	mov    (%eax),%edx
+ ba6:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ ba9:	89 10                	mov    %edx,(%eax)
+ bab:	eb 08                	jmp    bb5 <free+0xd7>
+    } else
+        p->s.ptr = bp;
+ bad:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ bb0:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ bb3:	89 10                	mov    %edx,(%eax)
+    freep = p;
+ bb5:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ bb8:	a3 40 10 00 00       	mov    %eax,0x1040
+}
+ bbd:	90                   	nop
+ bbe:	c9                   	leave
+ bbf:	c3                   	ret
+
+00000bc0 <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+ bc0:	55                   	push   %ebp
+ bc1:	89 e5                	mov    %esp,%ebp
+ bc3:	83 ec 18             	sub    $0x18,%esp
+    char *p;
+    Header *hp;
+
+    if(nu < 4096)
+ bc6:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+ bcd:	77 07                	ja     bd6 <morecore+0x16>
+        nu = 4096;
+ bcf:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+    p = sbrk(nu * sizeof(Header));
+ bd6:	8b 45 08             	mov    0x8(%ebp),%eax
+ bd9:	c1 e0 03             	shl    $0x3,%eax
+ bdc:	83 ec 0c             	sub    $0xc,%esp
+ bdf:	50                   	push   %eax
+ be0:	e8 0a fb ff ff       	call   6ef <sbrk>
+ be5:	83 c4 10             	add    $0x10,%esp
+ be8:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p == (char*)-1)
+ beb:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+ bef:	75 07                	jne    bf8 <morecore+0x38>
+        return 0;
+ bf1:	b8 00 00 00 00       	mov    $0x0,%eax
+ bf6:	eb 26                	jmp    c1e <morecore+0x5e>
+    hp = (Header*)p;
+ bf8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ bfb:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    hp->s.size = nu;
+ bfe:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ c01:	8b 55 08             	mov    0x8(%ebp),%edx
+ c04:	89 50 04             	mov    %edx,0x4(%eax)
+    free((void*)(hp + 1));
+ c07:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ c0a:	83 c0 08             	add    $0x8,%eax
+ c0d:	83 ec 0c             	sub    $0xc,%esp
+ c10:	50                   	push   %eax
+ c11:	e8 c8 fe ff ff       	call   ade <free>
+ c16:	83 c4 10             	add    $0x10,%esp
+    return freep;
+ c19:	a1 40 10 00 00       	mov    0x1040,%eax
+}
+ c1e:	c9                   	leave
+ c1f:	c3                   	ret
+
+00000c20 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ c20:	55                   	push   %ebp
+ c21:	89 e5                	mov    %esp,%ebp
+ c23:	83 ec 18             	sub    $0x18,%esp
+    Header *p, *prevp;
+    uint nunits;
+
+    nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ c26:	8b 45 08             	mov    0x8(%ebp),%eax
+ c29:	83 c0 07             	add    $0x7,%eax
+ c2c:	c1 e8 03             	shr    $0x3,%eax
+ c2f:	83 c0 01             	add    $0x1,%eax
+ c32:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    if((prevp = freep) == 0){
+ c35:	a1 40 10 00 00       	mov    0x1040,%eax
+ c3a:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ c3d:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ c41:	75 23                	jne    c66 <malloc+0x46>
+        base.s.ptr = freep = prevp = &base;
+ c43:	c7 45 f0 38 10 00 00 	movl   $0x1038,-0x10(%ebp)
+ c4a:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ c4d:	a3 40 10 00 00       	mov    %eax,0x1040
+ c52:	a1 40 10 00 00       	mov    0x1040,%eax
+ c57:	a3 38 10 00 00       	mov    %eax,0x1038
+        base.s.size = 0;
+ c5c:	c7 05 3c 10 00 00 00 	movl   $0x0,0x103c
+ c63:	00 00 00 
+    }
+    for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ c66:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ c69:	8b 00                	mov    (%eax),%eax
+ c6b:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        if(p->s.size >= nunits){
+ c6e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ c71:	8b 40 04             	mov    0x4(%eax),%eax
+ c74:	3b 45 ec             	cmp    -0x14(%ebp),%eax
+ c77:	72 4d                	jb     cc6 <malloc+0xa6>
+            if(p->s.size == nunits)
+ c79:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ c7c:	8b 40 04             	mov    0x4(%eax),%eax
+ c7f:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+ c82:	75 0c                	jne    c90 <malloc+0x70>
+                prevp->s.ptr = p->s.ptr;
+ c84:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ c87:	8b 10                	mov    (%eax),%edx
+ c89:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ c8c:	89 10                	mov    %edx,(%eax)
+ c8e:	eb 26                	jmp    cb6 <malloc+0x96>
+            else {
+                p->s.size -= nunits;
+ c90:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ c93:	8b 40 04             	mov    0x4(%eax),%eax
+ c96:	2b 45 ec             	sub    -0x14(%ebp),%eax
+ c99:	89 c2                	mov    %eax,%edx
+ c9b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ c9e:	89 50 04             	mov    %edx,0x4(%eax)
+                p += p->s.size;
+ ca1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ ca4:	8b 40 04             	mov    0x4(%eax),%eax
+ ca7:	c1 e0 03             	shl    $0x3,%eax
+ caa:	01 45 f4             	add    %eax,-0xc(%ebp)
+                p->s.size = nunits;
+ cad:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ cb0:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ cb3:	89 50 04             	mov    %edx,0x4(%eax)
+            }
+            freep = prevp;
+ cb6:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ cb9:	a3 40 10 00 00       	mov    %eax,0x1040
+            return (void*)(p + 1);
+ cbe:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ cc1:	83 c0 08             	add    $0x8,%eax
+ cc4:	eb 3b                	jmp    d01 <malloc+0xe1>
+        }
+        if(p == freep)
+ cc6:	a1 40 10 00 00       	mov    0x1040,%eax
+ ccb:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ cce:	75 1e                	jne    cee <malloc+0xce>
+            if((p = morecore(nunits)) == 0)
+ cd0:	83 ec 0c             	sub    $0xc,%esp
+ cd3:	ff 75 ec             	push   -0x14(%ebp)
+ cd6:	e8 e5 fe ff ff       	call   bc0 <morecore>
+ cdb:	83 c4 10             	add    $0x10,%esp
+ cde:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ ce1:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ ce5:	75 07                	jne    cee <malloc+0xce>
+                return 0;
+ ce7:	b8 00 00 00 00       	mov    $0x0,%eax
+ cec:	eb 13                	jmp    d01 <malloc+0xe1>
+    for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ cee:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ cf1:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ cf4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ cf7:	8b 00                	mov    (%eax),%eax
+ cf9:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        if(p->s.size >= nunits){
+ cfc:	e9 6d ff ff ff       	jmp    c6e <malloc+0x4e>
+    }
+}
+ d01:	c9                   	leave
+ d02:	c3                   	ret
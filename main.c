@@ -3,6 +3,7 @@
 #include "param.h"
 #include "memlayout.h"
 #include "mmu.h"
+#include "spinlock.h"
 #include "proc.h"
 #include "x86.h"
 
@@ -24,15 +25,18 @@ main(void)
     seginit();             // segment descriptors
     picinit();             // disable pic
     ioapicinit();        // another interrupt controller
+    fileinit();            // file table and device switch
+    ioringinit();          // asynchronous I/O queue
+    sysstatinit();         // system call statistics
     consoleinit();     // console hardware
     uartinit();            // serial port
     pinit();                 // process table
     tvinit();                // trap vectors
     binit();                 // buffer cache
-    fileinit();            // file table
     ideinit();             // disk 
     startothers();     // start other processors
     kinit2(P2V(4*1024*1024), P2V(PHYSTOP)); // must come after startothers()
+    vdsoinit();            // user-readable kernel data
     userinit();            // first user process
     mpmain();                // finish this processor's setup
 }
@@ -53,6 +57,7 @@ mpmain(void)
 {
     cprintf("cpu%d: starting %d\n", cpuid(), cpuid());
     idtinit();             // load idt register
+    sysenterinit();        // fast system call entry
     xchg(&(mycpu()->started), 1); // tell startothers() we're up
     scheduler();         // start running processes
 }
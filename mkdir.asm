@@ -0,0 +1,1418 @@
+
+_mkdir:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "stat.h"
+#include "user.h"
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	53                   	push   %ebx
+   e:	51                   	push   %ecx
+   f:	83 ec 10             	sub    $0x10,%esp
+  12:	89 cb                	mov    %ecx,%ebx
+    int i;
+
+    if(argc < 2){
+  14:	83 3b 01             	cmpl   $0x1,(%ebx)
+  17:	7f 17                	jg     30 <main+0x30>
+        printf(2, "Usage: mkdir files...\n");
+  19:	83 ec 08             	sub    $0x8,%esp
+  1c:	68 4f 0a 00 00       	push   $0xa4f
+  21:	6a 02                	push   $0x2
+  23:	e8 70 06 00 00       	call   698 <printf>
+  28:	83 c4 10             	add    $0x10,%esp
+        exit();
+  2b:	e8 6a 03 00 00       	call   39a <exit>
+    }
+
+    for(i = 1; i < argc; i++){
+  30:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+  37:	eb 4b                	jmp    84 <main+0x84>
+        if(mkdir(argv[i]) < 0){
+  39:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  3c:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+  43:	8b 43 04             	mov    0x4(%ebx),%eax
+  46:	01 d0                	add    %edx,%eax
+  48:	8b 00                	mov    (%eax),%eax
+  4a:	83 ec 0c             	sub    $0xc,%esp
+  4d:	50                   	push   %eax
+  4e:	e8 c0 03 00 00       	call   413 <mkdir>
+  53:	83 c4 10             	add    $0x10,%esp
+  56:	85 c0                	test   %eax,%eax
+  58:	79 26                	jns    80 <main+0x80>
+            printf(2, "mkdir: %s failed to create\n", argv[i]);
+  5a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  5d:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+  64:	8b 43 04             	mov    0x4(%ebx),%eax
+  67:	01 d0                	add    %edx,%eax
+  69:	8b 00                	mov    (%eax),%eax
+  6b:	83 ec 04             	sub    $0x4,%esp
+  6e:	50                   	push   %eax
+  6f:	68 66 0a 00 00       	push   $0xa66
+  74:	6a 02                	push   $0x2
+  76:	e8 1d 06 00 00       	call   698 <printf>
+  7b:	83 c4 10             	add    $0x10,%esp
+            break;
+  7e:	eb 0b                	jmp    8b <main+0x8b>
+    for(i = 1; i < argc; i++){
+  80:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+  84:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  87:	3b 03                	cmp    (%ebx),%eax
+  89:	7c ae                	jl     39 <main+0x39>
+        }
+    }
+
+    exit();
+  8b:	e8 0a 03 00 00       	call   39a <exit>
+
+00000090 <stosb>:
+strchr(const char *s, char c)
+{
+    for(; *s; s++)
+        if(*s == c)
+            return (char*)s;
+    return 0;
+  90:	55                   	push   %ebp
+  91:	89 e5                	mov    %esp,%ebp
+  93:	57                   	push   %edi
+  94:	53                   	push   %ebx
+}
+  95:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  98:	8b 55 10             	mov    0x10(%ebp),%edx
+  9b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  9e:	89 cb                	mov    %ecx,%ebx
+  a0:	89 df                	mov    %ebx,%edi
+  a2:	89 d1                	mov    %edx,%ecx
+  a4:	fc                   	cld
+  a5:	f3 aa                	rep stos %al,%es:(%edi)
+  a7:	89 ca                	mov    %ecx,%edx
+  a9:	89 fb                	mov    %edi,%ebx
+  ab:	89 5d 08             	mov    %ebx,0x8(%ebp)
+  ae:	89 55 10             	mov    %edx,0x10(%ebp)
+
+char*
+gets(char *buf, int max)
+{
+  b1:	90                   	nop
+  b2:	5b                   	pop    %ebx
+  b3:	5f                   	pop    %edi
+  b4:	5d                   	pop    %ebp
+  b5:	c3                   	ret
+
+000000b6 <strcpy>:
+{
+  b6:	55                   	push   %ebp
+  b7:	89 e5                	mov    %esp,%ebp
+  b9:	83 ec 10             	sub    $0x10,%esp
+    os = s;
+  bc:	8b 45 08             	mov    0x8(%ebp),%eax
+  bf:	89 45 fc             	mov    %eax,-0x4(%ebp)
+    while((*s++ = *t++) != 0)
+  c2:	90                   	nop
+  c3:	8b 55 0c             	mov    0xc(%ebp),%edx
+  c6:	8d 42 01             	lea    0x1(%edx),%eax
+  c9:	89 45 0c             	mov    %eax,0xc(%ebp)
+  cc:	8b 45 08             	mov    0x8(%ebp),%eax
+  cf:	8d 48 01             	lea    0x1(%eax),%ecx
+  d2:	89 4d 08             	mov    %ecx,0x8(%ebp)
+  d5:	0f b6 12             	movzbl (%edx),%edx
+  d8:	88 10                	mov    %dl,(%eax)
+  da:	0f b6 00             	movzbl (%eax),%eax
+  dd:	84 c0                	test   %al,%al
+  df:	75 e2                	jne    c3 <strcpy+0xd>
+    return os;
+  e1:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+  e4:	c9                   	leave
+  e5:	c3                   	ret
+
+000000e6 <strcmp>:
+{
+  e6:	55                   	push   %ebp
+  e7:	89 e5                	mov    %esp,%ebp
+    while(*p && *p == *q)
+  e9:	eb 08                	jmp    f3 <strcmp+0xd>
+        p++, q++;
+  eb:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+  ef:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+    while(*p && *p == *q)
+  f3:	8b 45 08             	mov    0x8(%ebp),%eax
+  f6:	0f b6 00             	movzbl (%eax),%eax
+  f9:	84 c0                	test   %al,%al
+  fb:	74 10                	je     10d <strcmp+0x27>
+  fd:	8b 45 08             	mov    0x8(%ebp),%eax
+ 100:	0f b6 10             	movzbl (%eax),%edx
+ 103:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 106:	0f b6 00             	movzbl (%eax),%eax
+ 109:	38 c2                	cmp    %al,%dl
+ 10b:	74 de                	je     eb <strcmp+0x5>
+    return (uchar)*p - (uchar)*q;
+ 10d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 110:	0f b6 00             	movzbl (%eax),%eax
+ 113:	0f b6 d0             	movzbl %al,%edx
+ 116:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 119:	0f b6 00             	movzbl (%eax),%eax
+ 11c:	0f b6 c0             	movzbl %al,%eax
+ 11f:	29 c2                	sub    %eax,%edx
+ 121:	89 d0                	mov    %edx,%eax
+}
+ 123:	5d                   	pop    %ebp
+ 124:	c3                   	ret
+
+00000125 <strlen>:
+{
+ 125:	55                   	push   %ebp
+ 126:	89 e5                	mov    %esp,%ebp
+ 128:	83 ec 10             	sub    $0x10,%esp
+    for(n = 0; s[n]; n++)
+ 12b:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ 132:	eb 04                	jmp    138 <strlen+0x13>
+ 134:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 138:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 13b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 13e:	01 d0                	add    %edx,%eax
+ 140:	0f b6 00             	movzbl (%eax),%eax
+ 143:	84 c0                	test   %al,%al
+ 145:	75 ed                	jne    134 <strlen+0xf>
+    return n;
+ 147:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 14a:	c9                   	leave
+ 14b:	c3                   	ret
+
+0000014c <memset>:
+{
+ 14c:	55                   	push   %ebp
+ 14d:	89 e5                	mov    %esp,%ebp
+    stosb(dst, c, n);
+ 14f:	8b 45 10             	mov    0x10(%ebp),%eax
+ 152:	50                   	push   %eax
+ 153:	ff 75 0c             	push   0xc(%ebp)
+ 156:	ff 75 08             	push   0x8(%ebp)
+ 159:	e8 32 ff ff ff       	call   90 <stosb>
+ 15e:	83 c4 0c             	add    $0xc,%esp
+    return dst;
+ 161:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 164:	c9                   	leave
+ 165:	c3                   	ret
+
+00000166 <strchr>:
+{
+ 166:	55                   	push   %ebp
+ 167:	89 e5                	mov    %esp,%ebp
+ 169:	83 ec 04             	sub    $0x4,%esp
+ 16c:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 16f:	88 45 fc             	mov    %al,-0x4(%ebp)
+    for(; *s; s++)
+ 172:	eb 14                	jmp    188 <strchr+0x22>
+        if(*s == c)
+ 174:	8b 45 08             	mov    0x8(%ebp),%eax
+ 177:	0f b6 00             	movzbl (%eax),%eax
+ 17a:	38 45 fc             	cmp    %al,-0x4(%ebp)
+ 17d:	75 05                	jne    184 <strchr+0x1e>
+            return (char*)s;
+ 17f:	8b 45 08             	mov    0x8(%ebp),%eax
+ 182:	eb 13                	jmp    197 <strchr+0x31>
+    for(; *s; s++)
+ 184:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 188:	8b 45 08             	mov    0x8(%ebp),%eax
+ 18b:	0f b6 00             	movzbl (%eax),%eax
+ 18e:	84 c0                	test   %al,%al
+ 190:	75 e2                	jne    174 <strchr+0xe>
+    return 0;
+ 192:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 197:	c9                   	leave
+ 198:	c3                   	ret
+
+00000199 <gets>:
+{
+ 199:	55                   	push   %ebp
+ 19a:	89 e5                	mov    %esp,%ebp
+ 19c:	83 ec 18             	sub    $0x18,%esp
+    int i, cc;
+    char c;
+
+    for(i=0; i+1 < max; ){
+ 19f:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 1a6:	eb 42                	jmp    1ea <gets+0x51>
+        cc = read(0, &c, 1);
+ 1a8:	83 ec 04             	sub    $0x4,%esp
+ 1ab:	6a 01                	push   $0x1
+ 1ad:	8d 45 ef             	lea    -0x11(%ebp),%eax
+ 1b0:	50                   	push   %eax
+ 1b1:	6a 00                	push   $0x0
+ 1b3:	e8 f7 01 00 00       	call   3af <read>
+ 1b8:	83 c4 10             	add    $0x10,%esp
+ 1bb:	89 45 f0             	mov    %eax,-0x10(%ebp)
+        if(cc < 1)
+ 1be:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 1c2:	7e 33                	jle    1f7 <gets+0x5e>
+            break;
+        buf[i++] = c;
+ 1c4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 1c7:	8d 50 01             	lea    0x1(%eax),%edx
+ 1ca:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 1cd:	89 c2                	mov    %eax,%edx
+ 1cf:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1d2:	01 c2                	add    %eax,%edx
+ 1d4:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 1d8:	88 02                	mov    %al,(%edx)
+        if(c == '\n' || c == '\r')
+ 1da:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 1de:	3c 0a                	cmp    $0xa,%al
+ 1e0:	74 16                	je     1f8 <gets+0x5f>
+ 1e2:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 1e6:	3c 0d                	cmp    $0xd,%al
+ 1e8:	74 0e                	je     1f8 <gets+0x5f>
+    for(i=0; i+1 < max; ){
+ 1ea:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 1ed:	83 c0 01             	add    $0x1,%eax
+ 1f0:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 1f3:	7f b3                	jg     1a8 <gets+0xf>
+ 1f5:	eb 01                	jmp    1f8 <gets+0x5f>
+            break;
+ 1f7:	90                   	nop
+            break;
+    }
+    buf[i] = '\0';
+ 1f8:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 1fb:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1fe:	01 d0                	add    %edx,%eax
+ 200:	c6 00 00             	movb   $0x0,(%eax)
+    return buf;
+ 203:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 206:	c9                   	leave
+ 207:	c3                   	ret
+
+00000208 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 208:	55                   	push   %ebp
+ 209:	89 e5                	mov    %esp,%ebp
+ 20b:	83 ec 18             	sub    $0x18,%esp
+    int fd;
+    int r;
+
+    fd = open(n, O_RDONLY);
+ 20e:	83 ec 08             	sub    $0x8,%esp
+ 211:	6a 00                	push   $0x0
+ 213:	ff 75 08             	push   0x8(%ebp)
+ 216:	e8 c6 01 00 00       	call   3e1 <open>
+ 21b:	83 c4 10             	add    $0x10,%esp
+ 21e:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(fd < 0)
+ 221:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 225:	79 07                	jns    22e <stat+0x26>
+        return -1;
+ 227:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 22c:	eb 25                	jmp    253 <stat+0x4b>
+    r = fstat(fd, st);
+ 22e:	83 ec 08             	sub    $0x8,%esp
+ 231:	ff 75 0c             	push   0xc(%ebp)
+ 234:	ff 75 f4             	push   -0xc(%ebp)
+ 237:	e8 c3 01 00 00       	call   3ff <fstat>
+ 23c:	83 c4 10             	add    $0x10,%esp
+ 23f:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    close(fd);
+ 242:	83 ec 0c             	sub    $0xc,%esp
+ 245:	ff 75 f4             	push   -0xc(%ebp)
+ 248:	e8 76 01 00 00       	call   3c3 <close>
+ 24d:	83 c4 10             	add    $0x10,%esp
+    return r;
+ 250:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ 253:	c9                   	leave
+ 254:	c3                   	ret
+
+00000255 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 255:	55                   	push   %ebp
+ 256:	89 e5                	mov    %esp,%ebp
+ 258:	83 ec 10             	sub    $0x10,%esp
+    int n;
+
+    n = 0;
+ 25b:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+    while('0' <= *s && *s <= '9')
+ 262:	eb 25                	jmp    289 <atoi+0x34>
+        n = n*10 + *s++ - '0';
+ 264:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 267:	89 d0                	mov    %edx,%eax
+ 269:	c1 e0 02             	shl    $0x2,%eax
+ 26c:	01 d0                	add    %edx,%eax
+ 26e:	01 c0                	add    %eax,%eax
+ 270:	89 c1                	mov    %eax,%ecx
+ 272:	8b 45 08             	mov    0x8(%ebp),%eax
+ 275:	8d 50 01             	lea    0x1(%eax),%edx
+ 278:	89 55 08             	mov    %edx,0x8(%ebp)
+ 27b:	0f b6 00             	movzbl (%eax),%eax
+ 27e:	0f be c0             	movsbl %al,%eax
+ 281:	01 c8                	add    %ecx,%eax
+ 283:	83 e8 30             	sub    $0x30,%eax
+ 286:	89 45 fc             	mov    %eax,-0x4(%ebp)
+    while('0' <= *s && *s <= '9')
+ 289:	8b 45 08             	mov    0x8(%ebp),%eax
+ 28c:	0f b6 00             	movzbl (%eax),%eax
+ 28f:	3c 2f                	cmp    $0x2f,%al
+ 291:	7e 0a                	jle    29d <atoi+0x48>
+ 293:	8b 45 08             	mov    0x8(%ebp),%eax
+ 296:	0f b6 00             	movzbl (%eax),%eax
+ 299:	3c 39                	cmp    $0x39,%al
+ 29b:	7e c7                	jle    264 <atoi+0xf>
+    return n;
+ 29d:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 2a0:	c9                   	leave
+ 2a1:	c3                   	ret
+
+000002a2 <nice>:
+
+// Add inc to the caller's nice value; return the new value.
+int
+nice(int inc)
+{
+ 2a2:	55                   	push   %ebp
+ 2a3:	89 e5                	mov    %esp,%ebp
+ 2a5:	83 ec 18             	sub    $0x18,%esp
+    int n;
+
+    n = getpriority(0) + inc;
+ 2a8:	83 ec 0c             	sub    $0xc,%esp
+ 2ab:	6a 00                	push   $0x0
+ 2ad:	e8 d9 01 00 00       	call   48b <getpriority>
+ 2b2:	83 c4 10             	add    $0x10,%esp
+ 2b5:	8b 55 08             	mov    0x8(%ebp),%edx
+ 2b8:	01 d0                	add    %edx,%eax
+ 2ba:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(n < 0)
+ 2bd:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 2c1:	79 07                	jns    2ca <nice+0x28>
+        n = 0;
+ 2c3:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    if(n > NICEMAX)
+ 2ca:	83 7d f4 13          	cmpl   $0x13,-0xc(%ebp)
+ 2ce:	7e 07                	jle    2d7 <nice+0x35>
+        n = NICEMAX;
+ 2d0:	c7 45 f4 13 00 00 00 	movl   $0x13,-0xc(%ebp)
+    if(setpriority(0, n) < 0)
+ 2d7:	83 ec 08             	sub    $0x8,%esp
+ 2da:	ff 75 f4             	push   -0xc(%ebp)
+ 2dd:	6a 00                	push   $0x0
+ 2df:	e8 b1 01 00 00       	call   495 <setpriority>
+ 2e4:	83 c4 10             	add    $0x10,%esp
+ 2e7:	85 c0                	test   %eax,%eax
+ 2e9:	79 07                	jns    2f2 <nice+0x50>
+        return -1;
+ 2eb:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 2f0:	eb 03                	jmp    2f5 <nice+0x53>
+    return n;
+ 2f2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+ 2f5:	c9                   	leave
+ 2f6:	c3                   	ret
+
+000002f7 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 2f7:	55                   	push   %ebp
+ 2f8:	89 e5                	mov    %esp,%ebp
+ 2fa:	83 ec 10             	sub    $0x10,%esp
+    char *dst;
+    const char *src;
+
+    dst = vdst;
+ 2fd:	8b 45 08             	mov    0x8(%ebp),%eax
+ 300:	89 45 fc             	mov    %eax,-0x4(%ebp)
+    src = vsrc;
+ 303:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 306:	89 45 f8             	mov    %eax,-0x8(%ebp)
+    while(n-- > 0)
+ 309:	eb 17                	jmp    322 <memmove+0x2b>
+        *dst++ = *src++;
+ 30b:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 30e:	8d 42 01             	lea    0x1(%edx),%eax
+ 311:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 314:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 317:	8d 48 01             	lea    0x1(%eax),%ecx
+ 31a:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+ 31d:	0f b6 12             	movzbl (%edx),%edx
+ 320:	88 10                	mov    %dl,(%eax)
+    while(n-- > 0)
+ 322:	8b 45 10             	mov    0x10(%ebp),%eax
+ 325:	8d 50 ff             	lea    -0x1(%eax),%edx
+ 328:	89 55 10             	mov    %edx,0x10(%ebp)
+ 32b:	85 c0                	test   %eax,%eax
+ 32d:	7f dc                	jg     30b <memmove+0x14>
+    return vdst;
+ 32f:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 332:	c9                   	leave
+ 333:	c3                   	ret
+
+00000334 <dosyscall>:
+sysmode:
+    .long 0
+
+    .text
+dosyscall:
+    cmpl $0, sysmode
+ 334:	83 3d f4 0c 00 00 00 	cmpl   $0x0,0xcf4
+    jg 2f
+ 33b:	7f 0c                	jg     349 <dosyscall+0x15>
+    jl 1f
+ 33d:	7c 07                	jl     346 <dosyscall+0x12>
+    call sepcheck
+ 33f:	e8 27 00 00 00       	call   36b <sepcheck>
+    jmp dosyscall
+ 344:	eb ee                	jmp    334 <dosyscall>
+1:
+    int $T_SYSCALL
+ 346:	cd 40                	int    $0x40
+    ret
+ 348:	c3                   	ret
+2:
+    pushl %ebx
+ 349:	53                   	push   %ebx
+    pushl %esi
+ 34a:	56                   	push   %esi
+    pushl %edi
+ 34b:	57                   	push   %edi
+    pushl %ebp
+ 34c:	55                   	push   %ebp
+    movl 20(%esp), %ebx
+ 34d:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+    movl 24(%esp), %esi
+ 351:	8b 74 24 18          	mov    0x18(%esp),%esi
+    movl 28(%esp), %edi
+ 355:	8b 7c 24 1c          	mov    0x1c(%esp),%edi
+    movl 32(%esp), %ebp
+ 359:	8b 6c 24 20          	mov    0x20(%esp),%ebp
+    movl %esp, %ecx
+ 35d:	89 e1                	mov    %esp,%ecx
+    movl $3f, %edx
+ 35f:	ba 66 03 00 00       	mov    $0x366,%edx
+    sysenter
+ 364:	0f 34                	sysenter
+3:
+    popl %ebp
+ 366:	5d                   	pop    %ebp
+    popl %edi
+ 367:	5f                   	pop    %edi
+    popl %esi
+ 368:	5e                   	pop    %esi
+    popl %ebx
+ 369:	5b                   	pop    %ebx
+    ret
+ 36a:	c3                   	ret
+
+0000036b <sepcheck>:
+
+# Set sysmode from cpuid's SEP flag.    Preserves %eax.
+sepcheck:
+    pushl %eax
+ 36b:	50                   	push   %eax
+    pushl %ebx
+ 36c:	53                   	push   %ebx
+    movl $1, %eax
+ 36d:	b8 01 00 00 00       	mov    $0x1,%eax
+    cpuid
+ 372:	0f a2                	cpuid
+    movl $-1, sysmode
+ 374:	c7 05 f4 0c 00 00 ff 	movl   $0xffffffff,0xcf4
+ 37b:	ff ff ff 
+    testl $0x800, %edx
+ 37e:	f7 c2 00 08 00 00    	test   $0x800,%edx
+    jz 1f
+ 384:	74 0a                	je     390 <sepcheck+0x25>
+    movl $1, sysmode
+ 386:	c7 05 f4 0c 00 00 01 	movl   $0x1,0xcf4
+ 38d:	00 00 00 
+1:
+    popl %ebx
+ 390:	5b                   	pop    %ebx
+    popl %eax
+ 391:	58                   	pop    %eax
+    ret
+ 392:	c3                   	ret
+
+00000393 <fork>:
+
+SYSCALL(fork)
+ 393:	b8 01 00 00 00       	mov    $0x1,%eax
+ 398:	eb 9a                	jmp    334 <dosyscall>
+
+0000039a <exit>:
+SYSCALL(exit)
+ 39a:	b8 02 00 00 00       	mov    $0x2,%eax
+ 39f:	eb 93                	jmp    334 <dosyscall>
+
+000003a1 <wait>:
+SYSCALL(wait)
+ 3a1:	b8 03 00 00 00       	mov    $0x3,%eax
+ 3a6:	eb 8c                	jmp    334 <dosyscall>
+
+000003a8 <pipe>:
+SYSCALL(pipe)
+ 3a8:	b8 04 00 00 00       	mov    $0x4,%eax
+ 3ad:	eb 85                	jmp    334 <dosyscall>
+
+000003af <read>:
+SYSCALL(read)
+ 3af:	b8 05 00 00 00       	mov    $0x5,%eax
+ 3b4:	e9 7b ff ff ff       	jmp    334 <dosyscall>
+
+000003b9 <write>:
+SYSCALL(write)
+ 3b9:	b8 10 00 00 00       	mov    $0x10,%eax
+ 3be:	e9 71 ff ff ff       	jmp    334 <dosyscall>
+
+000003c3 <close>:
+SYSCALL(close)
+ 3c3:	b8 15 00 00 00       	mov    $0x15,%eax
+ 3c8:	e9 67 ff ff ff       	jmp    334 <dosyscall>
+
+000003cd <kill>:
+SYSCALL(kill)
+ 3cd:	b8 06 00 00 00       	mov    $0x6,%eax
+ 3d2:	e9 5d ff ff ff       	jmp    334 <dosyscall>
+
+000003d7 <exec>:
+SYSCALL(exec)
+ 3d7:	b8 07 00 00 00       	mov    $0x7,%eax
+ 3dc:	e9 53 ff ff ff       	jmp    334 <dosyscall>
+
+000003e1 <open>:
+SYSCALL(open)
+ 3e1:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 3e6:	e9 49 ff ff ff       	jmp    334 <dosyscall>
+
+000003eb <mknod>:
+SYSCALL(mknod)
+ 3eb:	b8 11 00 00 00       	mov    $0x11,%eax
+ 3f0:	e9 3f ff ff ff       	jmp    334 <dosyscall>
+
+000003f5 <unlink>:
+SYSCALL(unlink)
+ 3f5:	b8 12 00 00 00       	mov    $0x12,%eax
+ 3fa:	e9 35 ff ff ff       	jmp    334 <dosyscall>
+
+000003ff <fstat>:
+SYSCALL(fstat)
+ 3ff:	b8 08 00 00 00       	mov    $0x8,%eax
+ 404:	e9 2b ff ff ff       	jmp    334 <dosyscall>
+
+00000409 <link>:
+SYSCALL(link)
+ 409:	b8 13 00 00 00       	mov    $0x13,%eax
+ 40e:	e9 21 ff ff ff       	jmp    334 <dosyscall>
+
+00000413 <mkdir>:
+SYSCALL(mkdir)
+ 413:	b8 14 00 00 00       	mov    $0x14,%eax
+ 418:	e9 17 ff ff ff       	jmp    334 <dosyscall>
+
+0000041d <chdir>:
+SYSCALL(chdir)
+ 41d:	b8 09 00 00 00       	mov    $0x9,%eax
+ 422:	e9 0d ff ff ff       	jmp    334 <dosyscall>
+
+00000427 <dup>:
+SYSCALL(dup)
+ 427:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 42c:	e9 03 ff ff ff       	jmp    334 <dosyscall>
+
+00000431 <getpid>:
+SYSCALL(getpid)
+ 431:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 436:	e9 f9 fe ff ff       	jmp    334 <dosyscall>
+
+0000043b <sbrk>:
+SYSCALL(sbrk)
+ 43b:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 440:	e9 ef fe ff ff       	jmp    334 <dosyscall>
+
+00000445 <sleep>:
+SYSCALL(sleep)
+ 445:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 44a:	e9 e5 fe ff ff       	jmp    334 <dosyscall>
+
+0000044f <uptime>:
+SYSCALL(uptime)
+ 44f:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 454:	e9 db fe ff ff       	jmp    334 <dosyscall>
+
+00000459 <date>:
+SYSCALL(date)
+ 459:	b8 16 00 00 00       	mov    $0x16,%eax
+ 45e:	e9 d1 fe ff ff       	jmp    334 <dosyscall>
+
+00000463 <dup2>:
+SYSCALL(dup2)
+ 463:	b8 17 00 00 00       	mov    $0x17,%eax
+ 468:	e9 c7 fe ff ff       	jmp    334 <dosyscall>
+
+0000046d <uffd>:
+SYSCALL(uffd)
+ 46d:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 472:	e9 bd fe ff ff       	jmp    334 <dosyscall>
+
+00000477 <uffdregister>:
+SYSCALL(uffdregister)
+ 477:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 47c:	e9 b3 fe ff ff       	jmp    334 <dosyscall>
+
+00000481 <uffdcopy>:
+SYSCALL(uffdcopy)
+ 481:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 486:	e9 a9 fe ff ff       	jmp    334 <dosyscall>
+
+0000048b <getpriority>:
+SYSCALL(getpriority)
+ 48b:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 490:	e9 9f fe ff ff       	jmp    334 <dosyscall>
+
+00000495 <setpriority>:
+SYSCALL(setpriority)
+ 495:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 49a:	e9 95 fe ff ff       	jmp    334 <dosyscall>
+
+0000049f <setweight>:
+SYSCALL(setweight)
+ 49f:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 4a4:	e9 8b fe ff ff       	jmp    334 <dosyscall>
+
+000004a9 <setgroup>:
+SYSCALL(setgroup)
+ 4a9:	b8 20 00 00 00       	mov    $0x20,%eax
+ 4ae:	e9 81 fe ff ff       	jmp    334 <dosyscall>
+
+000004b3 <schedinfo>:
+SYSCALL(schedinfo)
+ 4b3:	b8 21 00 00 00       	mov    $0x21,%eax
+ 4b8:	e9 77 fe ff ff       	jmp    334 <dosyscall>
+
+000004bd <nanosleep>:
+SYSCALL(nanosleep)
+ 4bd:	b8 22 00 00 00       	mov    $0x22,%eax
+ 4c2:	e9 6d fe ff ff       	jmp    334 <dosyscall>
+
+000004c7 <clock_nanosleep>:
+SYSCALL(clock_nanosleep)
+ 4c7:	b8 23 00 00 00       	mov    $0x23,%eax
+ 4cc:	e9 63 fe ff ff       	jmp    334 <dosyscall>
+
+000004d1 <clock_gettime>:
+SYSCALL(clock_gettime)
+ 4d1:	b8 24 00 00 00       	mov    $0x24,%eax
+ 4d6:	e9 59 fe ff ff       	jmp    334 <dosyscall>
+
+000004db <sched_setaffinity>:
+SYSCALL(sched_setaffinity)
+ 4db:	b8 25 00 00 00       	mov    $0x25,%eax
+ 4e0:	e9 4f fe ff ff       	jmp    334 <dosyscall>
+
+000004e5 <sched_getaffinity>:
+SYSCALL(sched_getaffinity)
+ 4e5:	b8 26 00 00 00       	mov    $0x26,%eax
+ 4ea:	e9 45 fe ff ff       	jmp    334 <dosyscall>
+
+000004ef <irqaffinity>:
+SYSCALL(irqaffinity)
+ 4ef:	b8 27 00 00 00       	mov    $0x27,%eax
+ 4f4:	e9 3b fe ff ff       	jmp    334 <dosyscall>
+
+000004f9 <getrusage>:
+SYSCALL(getrusage)
+ 4f9:	b8 28 00 00 00       	mov    $0x28,%eax
+ 4fe:	e9 31 fe ff ff       	jmp    334 <dosyscall>
+
+00000503 <times>:
+SYSCALL(times)
+ 503:	b8 29 00 00 00       	mov    $0x29,%eax
+ 508:	e9 27 fe ff ff       	jmp    334 <dosyscall>
+
+0000050d <schedlat>:
+SYSCALL(schedlat)
+ 50d:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 512:	e9 1d fe ff ff       	jmp    334 <dosyscall>
+
+00000517 <sched_setscheduler>:
+SYSCALL(sched_setscheduler)
+ 517:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 51c:	e9 13 fe ff ff       	jmp    334 <dosyscall>
+
+00000521 <sched_getscheduler>:
+SYSCALL(sched_getscheduler)
+ 521:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 526:	e9 09 fe ff ff       	jmp    334 <dosyscall>
+
+0000052b <sched_getparam>:
+SYSCALL(sched_getparam)
+ 52b:	b8 2d 00 00 00       	mov    $0x2d,%eax
+ 530:	e9 ff fd ff ff       	jmp    334 <dosyscall>
+
+00000535 <lockstat>:
+SYSCALL(lockstat)
+ 535:	b8 2e 00 00 00       	mov    $0x2e,%eax
+ 53a:	e9 f5 fd ff ff       	jmp    334 <dosyscall>
+
+0000053f <ioring_setup>:
+SYSCALL(ioring_setup)
+ 53f:	b8 2f 00 00 00       	mov    $0x2f,%eax
+ 544:	e9 eb fd ff ff       	jmp    334 <dosyscall>
+
+00000549 <ioring_enter>:
+SYSCALL(ioring_enter)
+ 549:	b8 30 00 00 00       	mov    $0x30,%eax
+ 54e:	e9 e1 fd ff ff       	jmp    334 <dosyscall>
+
+00000553 <readv>:
+SYSCALL(readv)
+ 553:	b8 31 00 00 00       	mov    $0x31,%eax
+ 558:	e9 d7 fd ff ff       	jmp    334 <dosyscall>
+
+0000055d <writev>:
+SYSCALL(writev)
+ 55d:	b8 32 00 00 00       	mov    $0x32,%eax
+ 562:	e9 cd fd ff ff       	jmp    334 <dosyscall>
+
+00000567 <pread>:
+SYSCALL(pread)
+ 567:	b8 33 00 00 00       	mov    $0x33,%eax
+ 56c:	e9 c3 fd ff ff       	jmp    334 <dosyscall>
+
+00000571 <pwrite>:
+SYSCALL(pwrite)
+ 571:	b8 34 00 00 00       	mov    $0x34,%eax
+ 576:	e9 b9 fd ff ff       	jmp    334 <dosyscall>
+
+0000057b <sendfile>:
+SYSCALL(sendfile)
+ 57b:	b8 35 00 00 00       	mov    $0x35,%eax
+ 580:	e9 af fd ff ff       	jmp    334 <dosyscall>
+
+00000585 <splice>:
+SYSCALL(splice)
+ 585:	b8 36 00 00 00       	mov    $0x36,%eax
+ 58a:	e9 a5 fd ff ff       	jmp    334 <dosyscall>
+
+0000058f <sysstat>:
+SYSCALL(sysstat)
+ 58f:	b8 37 00 00 00       	mov    $0x37,%eax
+ 594:	e9 9b fd ff ff       	jmp    334 <dosyscall>
+
+00000599 <strace>:
+SYSCALL(strace)
+ 599:	b8 38 00 00 00       	mov    $0x38,%eax
+ 59e:	e9 91 fd ff ff       	jmp    334 <dosyscall>
+
+000005a3 <straceread>:
+SYSCALL(straceread)
+ 5a3:	b8 39 00 00 00       	mov    $0x39,%eax
+ 5a8:	e9 87 fd ff ff       	jmp    334 <dosyscall>
+
+000005ad <alarm>:
+
+# alarm and rstoregs keep to int $T_SYSCALL: rstoregs restores
+# %ecx and %edx, which sysexit would clobber.
+.globl alarm
+    alarm:
+        pushl $rstoregs
+ 5ad:	68 bd 05 00 00       	push   $0x5bd
+        movl $SYS_alarm, %eax
+ 5b2:	b8 18 00 00 00       	mov    $0x18,%eax
+        int $T_SYSCALL
+ 5b7:	cd 40                	int    $0x40
+        add $0x04, %esp
+ 5b9:	83 c4 04             	add    $0x4,%esp
+        ret
+ 5bc:	c3                   	ret
+
+000005bd <rstoregs>:
+
+.globl rstoregs
+    rstoregs:
+        movl $SYS_rstoregs, %eax
+ 5bd:	b8 19 00 00 00       	mov    $0x19,%eax
+        int $T_SYSCALL
+ 5c2:	cd 40                	int    $0x40
+
+000005c4 <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 5c4:	55                   	push   %ebp
+ 5c5:	89 e5                	mov    %esp,%ebp
+ 5c7:	83 ec 18             	sub    $0x18,%esp
+ 5ca:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 5cd:	88 45 f4             	mov    %al,-0xc(%ebp)
+    write(fd, &c, 1);
+ 5d0:	83 ec 04             	sub    $0x4,%esp
+ 5d3:	6a 01                	push   $0x1
+ 5d5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+ 5d8:	50                   	push   %eax
+ 5d9:	ff 75 08             	push   0x8(%ebp)
+ 5dc:	e8 d8 fd ff ff       	call   3b9 <write>
+ 5e1:	83 c4 10             	add    $0x10,%esp
+}
+ 5e4:	90                   	nop
+ 5e5:	c9                   	leave
+ 5e6:	c3                   	ret
+
+000005e7 <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 5e7:	55                   	push   %ebp
+ 5e8:	89 e5                	mov    %esp,%ebp
+ 5ea:	83 ec 28             	sub    $0x28,%esp
+    static char digits[] = "0123456789ABCDEF";
+    char buf[16];
+    int i, neg;
+    uint x;
+
+    neg = 0;
+ 5ed:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+    if(sgn && xx < 0){
+ 5f4:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+ 5f8:	74 17                	je     611 <printint+0x2a>
+ 5fa:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 5fe:	79 11                	jns    611 <printint+0x2a>
+        neg = 1;
+ 600:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+        x = -xx;
+ 607:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 60a:	f7 d8                	neg    %eax
+ 60c:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 60f:	eb 06                	jmp    617 <printint+0x30>
+    } else {
+        x = xx;
+ 611:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 614:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    }
+
+    i = 0;
+ 617:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    do{
+        buf[i++] = digits[x % base];
+ 61e:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 621:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 624:	ba 00 00 00 00       	mov    $0x0,%edx
+ 629:	f7 f1                	div    %ecx
+ 62b:	89 d1                	mov    %edx,%ecx
+ 62d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 630:	8d 50 01             	lea    0x1(%eax),%edx
+ 633:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 636:	0f b6 91 f8 0c 00 00 	movzbl 0xcf8(%ecx),%edx
+ 63d:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+    }while((x /= base) != 0);
+ 641:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 644:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 647:	ba 00 00 00 00       	mov    $0x0,%edx
+ 64c:	f7 f1                	div    %ecx
+ 64e:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 651:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 655:	75 c7                	jne    61e <printint+0x37>
+    if(neg)
+ 657:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 65b:	74 2d                	je     68a <printint+0xa3>
+        buf[i++] = '-';
+ 65d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 660:	8d 50 01             	lea    0x1(%eax),%edx
+ 663:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 666:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+    while(--i >= 0)
+ 66b:	eb 1d                	jmp    68a <printint+0xa3>
+        putc(fd, buf[i]);
+ 66d:	8d 55 dc             	lea    -0x24(%ebp),%edx
+ 670:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 673:	01 d0                	add    %edx,%eax
+ 675:	0f b6 00             	movzbl (%eax),%eax
+ 678:	0f be c0             	movsbl %al,%eax
+ 67b:	83 ec 08             	sub    $0x8,%esp
+ 67e:	50                   	push   %eax
+ 67f:	ff 75 08             	push   0x8(%ebp)
+ 682:	e8 3d ff ff ff       	call   5c4 <putc>
+ 687:	83 c4 10             	add    $0x10,%esp
+    while(--i >= 0)
+ 68a:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+ 68e:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 692:	79 d9                	jns    66d <printint+0x86>
+}
+ 694:	90                   	nop
+ 695:	90                   	nop
+ 696:	c9                   	leave
+ 697:	c3                   	ret
+
+00000698 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 698:	55                   	push   %ebp
+ 699:	89 e5                	mov    %esp,%ebp
+ 69b:	83 ec 28             	sub    $0x28,%esp
+    char *s;
+    int c, i, state;
+    uint *ap;
+
+    state = 0;
+ 69e:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+    ap = (uint*)(void*)&fmt + 1;
+ 6a5:	8d 45 0c             	lea    0xc(%ebp),%eax
+ 6a8:	83 c0 04             	add    $0x4,%eax
+ 6ab:	89 45 e8             	mov    %eax,-0x18(%ebp)
+    for(i = 0; fmt[i]; i++){
+ 6ae:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 6b5:	e9 59 01 00 00       	jmp    813 <printf+0x17b>
+        c = fmt[i] & 0xff;
+ 6ba:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 6bd:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 6c0:	01 d0                	add    %edx,%eax
+ 6c2:	0f b6 00             	movzbl (%eax),%eax
+ 6c5:	0f be c0             	movsbl %al,%eax
+ 6c8:	25 ff 00 00 00       	and    $0xff,%eax
+ 6cd:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        if(state == 0){
+ 6d0:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 6d4:	75 2c                	jne    702 <printf+0x6a>
+            if(c == '%'){
+ 6d6:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 6da:	75 0c                	jne    6e8 <printf+0x50>
+                state = '%';
+ 6dc:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+ 6e3:	e9 27 01 00 00       	jmp    80f <printf+0x177>
+            } else {
+                putc(fd, c);
+ 6e8:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 6eb:	0f be c0             	movsbl %al,%eax
+ 6ee:	83 ec 08             	sub    $0x8,%esp
+ 6f1:	50                   	push   %eax
+ 6f2:	ff 75 08             	push   0x8(%ebp)
+ 6f5:	e8 ca fe ff ff       	call   5c4 <putc>
+ 6fa:	83 c4 10             	add    $0x10,%esp
+ 6fd:	e9 0d 01 00 00       	jmp    80f <printf+0x177>
+            }
+        } else if(state == '%'){
+ 702:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+ 706:	0f 85 03 01 00 00    	jne    80f <printf+0x177>
+            if(c == 'd'){
+ 70c:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+ 710:	75 1e                	jne    730 <printf+0x98>
+                printint(fd, *ap, 10, 1);
+ 712:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 715:	8b 00                	mov    (%eax),%eax
+ 717:	6a 01                	push   $0x1
+ 719:	6a 0a                	push   $0xa
+ 71b:	50                   	push   %eax
+ 71c:	ff 75 08             	push   0x8(%ebp)
+ 71f:	e8 c3 fe ff ff       	call   5e7 <printint>
+ 724:	83 c4 10             	add    $0x10,%esp
+                ap++;
+ 727:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 72b:	e9 d8 00 00 00       	jmp    808 <printf+0x170>
+            } else if(c == 'x' || c == 'p'){
+ 730:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+ 734:	74 06                	je     73c <printf+0xa4>
+ 736:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+ 73a:	75 1e                	jne    75a <printf+0xc2>
+                printint(fd, *ap, 16, 0);
+ 73c:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 73f:	8b 00                	mov    (%eax),%eax
+ 741:	6a 00                	push   $0x0
+ 743:	6a 10                	push   $0x10
+ 745:	50                   	push   %eax
+ 746:	ff 75 08             	push   0x8(%ebp)
+ 749:	e8 99 fe ff ff       	call   5e7 <printint>
+ 74e:	83 c4 10             	add    $0x10,%esp
+                ap++;
+ 751:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 755:	e9 ae 00 00 00       	jmp    808 <printf+0x170>
+            } else if(c == 's'){
+ 75a:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+ 75e:	75 43                	jne    7a3 <printf+0x10b>
+                s = (char*)*ap;
+ 760:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 763:	8b 00                	mov    (%eax),%eax
+ 765:	89 45 f4             	mov    %eax,-0xc(%ebp)
+                ap++;
+ 768:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+                if(s == 0)
+ 76c:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 770:	75 25                	jne    797 <printf+0xff>
+                    s = "(null)";
+ 772:	c7 45 f4 82 0a 00 00 	movl   $0xa82,-0xc(%ebp)
+                while(*s != 0){
+ 779:	eb 1c                	jmp    797 <printf+0xff>
+                    putc(fd, *s);
+ 77b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 77e:	0f b6 00             	movzbl (%eax),%eax
+ 781:	0f be c0             	movsbl %al,%eax
+ 784:	83 ec 08             	sub    $0x8,%esp
+ 787:	50                   	push   %eax
+ 788:	ff 75 08             	push   0x8(%ebp)
+ 78b:	e8 34 fe ff ff       	call   5c4 <putc>
+ 790:	83 c4 10             	add    $0x10,%esp
+                    s++;
+ 793:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+                while(*s != 0){
+ 797:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 79a:	0f b6 00             	movzbl (%eax),%eax
+ 79d:	84 c0                	test   %al,%al
+ 79f:	75 da                	jne    77b <printf+0xe3>
+ 7a1:	eb 65                	jmp    808 <printf+0x170>
+                }
+            } else if(c == 'c'){
+ 7a3:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+ 7a7:	75 1d                	jne    7c6 <printf+0x12e>
+                putc(fd, *ap);
+ 7a9:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 7ac:	8b 00                	mov    (%eax),%eax
+ 7ae:	0f be c0             	movsbl %al,%eax
+ 7b1:	83 ec 08             	sub    $0x8,%esp
+ 7b4:	50                   	push   %eax
+ 7b5:	ff 75 08             	push   0x8(%ebp)
+ 7b8:	e8 07 fe ff ff       	call   5c4 <putc>
+ 7bd:	83 c4 10             	add    $0x10,%esp
+                ap++;
+ 7c0:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 7c4:	eb 42                	jmp    808 <printf+0x170>
+            } else if(c == '%'){
+ 7c6:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 7ca:	75 17                	jne    7e3 <printf+0x14b>
+                putc(fd, c);
+ 7cc:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 7cf:	0f be c0             	movsbl %al,%eax
+ 7d2:	83 ec 08             	sub    $0x8,%esp
+ 7d5:	50                   	push   %eax
+ 7d6:	ff 75 08             	push   0x8(%ebp)
+ 7d9:	e8 e6 fd ff ff       	call   5c4 <putc>
+ 7de:	83 c4 10             	add    $0x10,%esp
+ 7e1:	eb 25                	jmp    808 <printf+0x170>
+            } else {
+                // Unknown % sequence.    Print it to draw attention.
+                putc(fd, '%');
+ 7e3:	83 ec 08             	sub    $0x8,%esp
+ 7e6:	6a 25                	push   $0x25
+ 7e8:	ff 75 08             	push   0x8(%ebp)
+ 7eb:	e8 d4 fd ff ff       	call   5c4 <putc>
+ 7f0:	83 c4 10             	add    $0x10,%esp
+                putc(fd, c);
+ 7f3:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 7f6:	0f be c0             	movsbl %al,%eax
+ 7f9:	83 ec 08             	sub    $0x8,%esp
+ 7fc:	50                   	push   %eax
+ 7fd:	ff 75 08             	push   0x8(%ebp)
+ 800:	e8 bf fd ff ff       	call   5c4 <putc>
+ 805:	83 c4 10             	add    $0x10,%esp
+            }
+            state = 0;
+ 808:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+    for(i = 0; fmt[i]; i++){
+ 80f:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ 813:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 816:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 819:	01 d0                	add    %edx,%eax
+ 81b:	0f b6 00             	movzbl (%eax),%eax
+ 81e:	84 c0                	test   %al,%al
+ 820:	0f 85 94 fe ff ff    	jne    6ba <printf+0x22>
+        }
+    }
+}
+ 826:	90                   	nop
+ 827:	90                   	nop
+ 828:	c9                   	leave
+ 829:	c3                   	ret
+
+0000082a <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 82a:	55                   	push   %ebp
+ 82b:	89 e5                	mov    %esp,%ebp
+ 82d:	83 ec 10             	sub    $0x10,%esp
+    Header *bp, *p;
+
+    bp = (Header*)ap - 1;
+ 830:	8b 45 08             	mov    0x8(%ebp),%eax
+ 833:	83 e8 08             	sub    $0x8,%eax
+ 836:	89 45 f8             	mov    %eax,-0x8(%ebp)
+    for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 839:	a1 14 0d 00 00       	mov    0xd14,%eax
+ 83e:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 841:	eb 24                	jmp    867 <free+0x3d>
+        if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 843:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 846:	8b 00                	mov    (%eax),%eax
+ 848:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 84b:	72 12                	jb     85f <free+0x35>
+ 84d:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 850:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 853:	72 24                	jb     879 <free+0x4f>
+ 855:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 858:	8b 00                	mov    (%eax),%eax
+ 85a:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 85d:	72 1a                	jb     879 <free+0x4f>
+    for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 85f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 862:	8b 00                	mov    (%eax),%eax
+ 864:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 867:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 86a:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 86d:	73 d4                	jae    843 <free+0x19>
+ 86f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 872:	8b 00                	mov    (%eax),%eax
+ 874:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 877:	73 ca                	jae    843 <free+0x19>
+            break;
+    if(bp + bp->s.size == p->s.ptr){
+ 879:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 87c:	8b 40 04             	mov    0x4(%eax),%eax
+ 87f:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 886:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 889:	01 c2                	add    %eax,%edx
+ 88b:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 88e:	8b 00                	mov    (%eax),%eax
+ 890:	39 c2                	cmp    %eax,%edx
+ 892:	75 24                	jne    8b8 <free+0x8e>
+        bp->s.size += p->s.ptr->s.size;
+ 894:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 897:	8b 50 04             	mov    0x4(%eax),%edx
+ 89a:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 89d:	8b 00                	mov    (%eax),%eax
+ 89f:	8b 40 04             	mov    0x4(%eax),%eax
+ 8a2:	01 c2                	add    %eax,%edx
+ 8a4:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 8a7:	89 50 04             	mov    %edx,0x4(%eax)
+        bp->s.ptr = p->s.ptr->s.ptr;
+ 8aa:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 8ad:	8b 00                	mov    (%eax),%eax
+ 8af:	8b 10                	mov    (%eax),%edx
+ 8b1:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 8b4:	89 10                	mov    %edx,(%eax)
+ 8b6:	eb 0a                	jmp    8c2 <free+0x98>
+    } else
+        bp->s.ptr = p->s.ptr;
+ 8b8:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 8bb:	8b 10                	mov    (%eax),%edx
+ 8bd:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 8c0:	89 10                	mov    %edx,(%eax)
+    if(p + p->s.size == bp){
+ 8c2:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 8c5:	8b 40 04             	mov    0x4(%eax),%eax
+ 8c8:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 8cf:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 8d2:	01 d0                	add    %edx,%eax
+ 8d4:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 8d7:	75 20                	jne    8f9 <free+0xcf>
+        p->s.size += bp->s.size;
+ 8d9:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 8dc:	8b 50 04             	mov    0x4(%eax),%edx
+ 8df:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 8e2:	8b 40 04             	mov    0x4(%eax),%eax
+ 8e5:	01 c2                	add    %eax,%edx
+ 8e7:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 8ea:	89 50 04             	mov    %edx,0x4(%eax)
+        p->s.ptr = bp->s.ptr;
+ 8ed:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 8f0:	8b 10                	mov    (%eax),%edx
+ 8f2:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 8f5:	89 10                	mov    %edx,(%eax)
+ 8f7:	eb 08                	jmp    901 <free+0xd7>
+    } else
+        p->s.ptr = bp;
+ 8f9:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 8fc:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 8ff:	89 10                	mov    %edx,(%eax)
+    freep = p;
+ 901:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 904:	a3 14 0d 00 00       	mov    %eax,0xd14
+}
+ 909:	90                   	nop
+ 90a:	c9                   	leave
+ 90b:	c3                   	ret
+
+0000090c <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+ 90c:	55                   	push   %ebp
+ 90d:	89 e5                	mov    %esp,%ebp
+ 90f:	83 ec 18             	sub    $0x18,%esp
+    char *p;
+    Header *hp;
+
+    if(nu < 4096)
+ 912:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+ 919:	77 07                	ja     922 <morecore+0x16>
+        nu = 4096;
+ 91b:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+    p = sbrk(nu * sizeof(Header));
+ 922:	8b 45 08             	mov    0x8(%ebp),%eax
+ 925:	c1 e0 03             	shl    $0x3,%eax
+ 928:	83 ec 0c             	sub    $0xc,%esp
+ 92b:	50                   	push   %eax
+ 92c:	e8 0a fb ff ff       	call   43b <sbrk>
+ 931:	83 c4 10             	add    $0x10,%esp
+ 934:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p == (char*)-1)
+ 937:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+ 93b:	75 07                	jne    944 <morecore+0x38>
+        return 0;
+ 93d:	b8 00 00 00 00       	mov    $0x0,%eax
+ 942:	eb 26                	jmp    96a <morecore+0x5e>
+    hp = (Header*)p;
+ 944:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 947:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    hp->s.size = nu;
+ 94a:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 94d:	8b 55 08             	mov    0x8(%ebp),%edx
+ 950:	89 50 04             	mov    %edx,0x4(%eax)
+    free((void*)(hp + 1));
+ 953:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 956:	83 c0 08             	add    $0x8,%eax
+ 959:	83 ec 0c             	sub    $0xc,%esp
+ 95c:	50                   	push   %eax
+ 95d:	e8 c8 fe ff ff       	call   82a <free>
+ 962:	83 c4 10             	add    $0x10,%esp
+    return freep;
+ 965:	a1 14 0d 00 00       	mov    0xd14,%eax
+}
+ 96a:	c9                   	leave
+ 96b:	c3                   	ret
+
+0000096c <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ 96c:	55                   	push   %ebp
+ 96d:	89 e5                	mov    %esp,%ebp
+ 96f:	83 ec 18             	sub    $0x18,%esp
+    Header *p, *prevp;
+    uint nunits;
+
+    nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 972:	8b 45 08             	mov    0x8(%ebp),%eax
+ 975:	83 c0 07             	add    $0x7,%eax
+ 978:	c1 e8 03             	shr    $0x3,%eax
+ 97b:	83 c0 01             	add    $0x1,%eax
+ 97e:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    if((prevp = freep) == 0){
+ 981:	a1 14 0d 00 00       	mov    0xd14,%eax
+ 986:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ 989:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 98d:	75 23                	jne    9b2 <malloc+0x46>
+        base.s.ptr = freep = prevp = &base;
+ 98f:	c7 45 f0 0c 0d 00 00 	movl   $0xd0c,-0x10(%ebp)
+ 996:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 999:	a3 14 0d 00 00       	mov    %eax,0xd14
+ 99e:	a1 14 0d 00 00       	mov    0xd14,%eax
+ 9a3:	a3 0c 0d 00 00       	mov    %eax,0xd0c
+        base.s.size = 0;
+ 9a8:	c7 05 10 0d 00 00 00 	movl   $0x0,0xd10
+ 9af:	00 00 00 
+    }
+    for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 9b2:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 9b5:	8b 00                	mov    (%eax),%eax
+ 9b7:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        if(p->s.size >= nunits){
+ 9ba:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 9bd:	8b 40 04             	mov    0x4(%eax),%eax
+ 9c0:	3b 45 ec             	cmp    -0x14(%ebp),%eax
+ 9c3:	72 4d                	jb     a12 <malloc+0xa6>
+            if(p->s.size == nunits)
+ 9c5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 9c8:	8b 40 04             	mov    0x4(%eax),%eax
+ 9cb:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+ 9ce:	75 0c                	jne    9dc <malloc+0x70>
+                prevp->s.ptr = p->s.ptr;
+ 9d0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 9d3:	8b 10                	mov    (%eax),%edx
+ 9d5:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 9d8:	89 10                	mov    %edx,(%eax)
+ 9da:	eb 26                	jmp    a02 <malloc+0x96>
+            else {
+                p->s.size -= nunits;
+ 9dc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 9df:	8b 40 04             	mov    0x4(%eax),%eax
+ 9e2:	2b 45 ec             	sub    -0x14(%ebp),%eax
+ 9e5:	89 c2                	mov    %eax,%edx
+ 9e7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 9ea:	89 50 04             	mov    %edx,0x4(%eax)
+                p += p->s.size;
+ 9ed:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 9f0:	8b 40 04             	mov    0x4(%eax),%eax
+ 9f3:	c1 e0 03             	shl    $0x3,%eax
+ 9f6:	01 45 f4             	add    %eax,-0xc(%ebp)
+                p->s.size = nunits;
+ 9f9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 9fc:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 9ff:	89 50 04             	mov    %edx,0x4(%eax)
+            }
+            freep = prevp;
+ a02:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ a05:	a3 14 0d 00 00       	mov    %eax,0xd14
+            return (void*)(p + 1);
+ a0a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a0d:	83 c0 08             	add    $0x8,%eax
+ a10:	eb 3b                	jmp    a4d <malloc+0xe1>
+        }
+        if(p == freep)
+ a12:	a1 14 0d 00 00       	mov    0xd14,%eax
+ a17:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ a1a:	75 1e                	jne    a3a <malloc+0xce>
+            if((p = morecore(nunits)) == 0)
+ a1c:	83 ec 0c             	sub    $0xc,%esp
+ a1f:	ff 75 ec             	push   -0x14(%ebp)
+ a22:	e8 e5 fe ff ff       	call   90c <morecore>
+ a27:	83 c4 10             	add    $0x10,%esp
+ a2a:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ a2d:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ a31:	75 07                	jne    a3a <malloc+0xce>
+                return 0;
+ a33:	b8 00 00 00 00       	mov    $0x0,%eax
+ a38:	eb 13                	jmp    a4d <malloc+0xe1>
+    for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ a3a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a3d:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ a40:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a43:	8b 00                	mov    (%eax),%eax
+ a45:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        if(p->s.size >= nunits){
+ a48:	e9 6d ff ff ff       	jmp    9ba <malloc+0x4e>
+    }
+}
+ a4d:	c9                   	leave
+ a4e:	c3                   	ret
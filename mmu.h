@@ -2,6 +2,7 @@
 // x86 memory management unit (MMU).
 
 // Eflags register
+#define FL_TF                     0x00000100            // Trap Flag
 #define FL_IF                     0x00000200            // Interrupt Enable
 
 // Control Register flags
@@ -11,6 +12,14 @@
 
 #define CR4_PSE                 0x00000010            // Page size extension
 
+// Model-specific registers
+#define MSR_SYSENTER_CS         0x174         // Kernel %cs for sysenter
+#define MSR_SYSENTER_ESP        0x175         // Kernel %esp for sysenter
+#define MSR_SYSENTER_EIP        0x176         // Kernel %eip for sysenter
+
+// cpuid leaf 1 %edx feature flags
+#define CPUID_SEP               0x00000800            // sysenter and sysexit
+
 // various segment selectors.
 #define SEG_KCODE 1    // kernel code
 #define SEG_KDATA 2    // kernel data+stack
@@ -99,6 +108,7 @@ struct segdesc {
 #define PTE_W                     0x002     // Writeable
 #define PTE_U                     0x004     // User
 #define PTE_PS                    0x080     // Page Size
+#define PTE_SHARED              0x400     // Shared with the kernel, never COW
 #define PTE_COW                 0x800     // Copy On write
 #define PTE_ALL                 0xfff
 
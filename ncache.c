@@ -0,0 +1,194 @@
+// Name cache: remembers which inode number a name in a directory
+// refers to, so that namex() can resolve most paths without
+// locking and reading each directory along the way.
+//
+// Lookups take no locks.    They run under rcureadlock(), and an
+// entry is reused only after rcuwait() says no lookup can still be
+// looking at it.    ncache.lock serializes changes.    namex() adds
+// entries while it holds the directory's lock; unlinking a name or
+// freeing an inode removes them, and bumps ncache.seq so that a
+// path lookup that raced with the removal can tell.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "x86.h"
+#include "memlayout.h"
+#include "mmu.h"
+#include "spinlock.h"
+#include "proc.h"
+#include "rwlock.h"
+#include "fs.h"
+
+#define NCHASH    64
+
+struct ncentry {
+    struct ncentry *volatile next;    // Hash chain
+    uint dev;
+    uint dinum;                       // Directory the name is in
+    char name[DIRSIZ];
+    uint inum;                        // Inode the name refers to
+    int isdir;                        // inum is a directory
+    int used;                         // On a hash chain
+    uint epoch;                       // When it was taken off its chain
+};
+
+static struct {
+    struct spinlock lock;
+    struct seqlock seq;
+    struct ncentry *volatile hash[NCHASH];
+    struct ncentry entry[NNCACHE];
+    uint hand;                        // Next entry to reuse
+} ncache;
+
+void
+ncacheinit(void)
+{
+    initlock(&ncache.lock, "ncache", 1);
+    initseqlock(&ncache.seq, "ncache");
+}
+
+static uint
+nchash(uint dev, uint dinum, char *name)
+{
+    uint h;
+    int i;
+
+    h = dev * 31 + dinum;
+    for(i = 0; i < DIRSIZ && name[i]; i++)
+        h = h * 31 + (uchar)name[i];
+    return h % NCHASH;
+}
+
+static int
+ncmatch(struct ncentry *e, uint dev, uint dinum, char *name)
+{
+    return e->dev == dev && e->dinum == dinum && namecmp(e->name, name) == 0;
+}
+
+// Take e off its hash chain.    Lookups already on e can still
+// follow e->next, so e must not be reused before rcuwait(e->epoch).
+// Caller must hold ncache.lock.
+static void
+ncunlink(struct ncentry *e)
+{
+    struct ncentry *volatile *pp;
+
+    for(pp = &ncache.hash[nchash(e->dev, e->dinum, e->name)]; *pp; pp = &(*pp)->next){
+        if(*pp == e){
+            *pp = e->next;
+            break;
+        }
+    }
+    e->used = 0;
+    e->epoch = rcuretire();
+}
+
+// Return the inode number that name in directory dinum refers
+// to, setting *isdir if it is a directory, or 0 if it is not cached.
+uint
+ncachelookup(uint dev, uint dinum, char *name, int *isdir)
+{
+    struct ncentry *e;
+    uint inum;
+
+    inum = 0;
+    rcureadlock();
+    for(e = ncache.hash[nchash(dev, dinum, name)]; e; e = e->next){
+        if(ncmatch(e, dev, dinum, name)){
+            inum = e->inum;
+            *isdir = e->isdir;
+            break;
+        }
+    }
+    rcureadunlock();
+    return inum;
+}
+
+// Remember that name in directory dinum refers to inum, which is
+// a directory if isdir is set.    Caller must hold the directory's lock.
+void
+ncacheenter(uint dev, uint dinum, char *name, uint inum, int isdir)
+{
+    struct ncentry *e;
+    uint h;
+
+    h = nchash(dev, dinum, name);
+    acquire(&ncache.lock);
+    for(e = ncache.hash[h]; e; e = e->next){
+        if(ncmatch(e, dev, dinum, name)){
+            release(&ncache.lock);
+            return;
+        }
+    }
+
+    // Reuse entries in turn, evicting the oldest.
+    e = &ncache.entry[ncache.hand];
+    ncache.hand = (ncache.hand + 1) % NNCACHE;
+    if(e->used)
+        ncunlink(e);
+    rcuwait(e->epoch);
+
+    e->dev = dev;
+    e->dinum = dinum;
+    strncpy(e->name, name, DIRSIZ);
+    e->inum = inum;
+    e->isdir = isdir;
+    e->used = 1;
+    e->next = ncache.hash[h];
+    // Fill in e before lookups can find it.
+    __sync_synchronize();
+    ncache.hash[h] = e;
+    release(&ncache.lock);
+}
+
+// Forget name in directory dinum.
+// Caller must hold the directory's lock.
+void
+ncacheremove(uint dev, uint dinum, char *name)
+{
+    struct ncentry *e;
+
+    acquire(&ncache.lock);
+    for(e = ncache.hash[nchash(dev, dinum, name)]; e; e = e->next)
+        if(ncmatch(e, dev, dinum, name))
+            break;
+    if(e){
+        writeseqlock(&ncache.seq);
+        ncunlink(e);
+        writesequnlock(&ncache.seq);
+    }
+    release(&ncache.lock);
+}
+
+// Forget every name in or referring to inode inum, which is
+// being freed.
+void
+ncachepurge(uint dev, uint inum)
+{
+    struct ncentry *e;
+
+    acquire(&ncache.lock);
+    writeseqlock(&ncache.seq);
+    for(e = ncache.entry; e < ncache.entry + NNCACHE; e++)
+        if(e->used && e->dev == dev && (e->dinum == inum || e->inum == inum))
+            ncunlink(e);
+    writesequnlock(&ncache.seq);
+    release(&ncache.lock);
+}
+
+// Start a path lookup through the cache.    Pass the result to
+// ncacheretry() once the lookup has a reference to its inode.
+uint
+ncachebegin(void)
+{
+    return readseqbegin(&ncache.seq);
+}
+
+// Return 1 if a name may have been removed since ncachebegin()
+// returned s, so that a lookup begun then must be redone.
+int
+ncacheretry(uint s)
+{
+    return readseqretry(&ncache.seq, s);
+}
@@ -0,0 +1,1490 @@
+
+_nullbench:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <rdtsclo>:
+#include "syscall.h"
+#include "traps.h"
+
+static inline uint
+rdtsclo(void)
+{
+   0:	55                   	push   %ebp
+   1:	89 e5                	mov    %esp,%ebp
+   3:	83 ec 10             	sub    $0x10,%esp
+    uint lo, hi;
+
+    asm volatile("rdtsc" : "=a" (lo), "=d" (hi));
+   6:	0f 31                	rdtsc
+   8:	89 45 fc             	mov    %eax,-0x4(%ebp)
+   b:	89 55 f8             	mov    %edx,-0x8(%ebp)
+    return lo;
+   e:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+  11:	c9                   	leave
+  12:	c3                   	ret
+
+00000013 <intgetpid>:
+
+static inline int
+intgetpid(void)
+{
+  13:	55                   	push   %ebp
+  14:	89 e5                	mov    %esp,%ebp
+  16:	83 ec 10             	sub    $0x10,%esp
+    int r;
+
+    asm volatile("int %1" : "=a" (r) : "i" (T_SYSCALL), "a" (SYS_getpid) : "memory");
+  19:	b8 0b 00 00 00       	mov    $0xb,%eax
+  1e:	cd 40                	int    $0x40
+  20:	89 45 fc             	mov    %eax,-0x4(%ebp)
+    return r;
+  23:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+  26:	c9                   	leave
+  27:	c3                   	ret
+
+00000028 <main>:
+
+int
+main(int argc, char *argv[])
+{
+  28:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+  2c:	83 e4 f0             	and    $0xfffffff0,%esp
+  2f:	ff 71 fc             	push   -0x4(%ecx)
+  32:	55                   	push   %ebp
+  33:	89 e5                	mov    %esp,%ebp
+  35:	53                   	push   %ebx
+  36:	51                   	push   %ecx
+  37:	83 ec 20             	sub    $0x20,%esp
+  3a:	89 c8                	mov    %ecx,%eax
+    uint t0, fast, slow;
+    int i, n;
+
+    n = 100000;
+  3c:	c7 45 f0 a0 86 01 00 	movl   $0x186a0,-0x10(%ebp)
+    if(argc > 1)
+  43:	83 38 01             	cmpl   $0x1,(%eax)
+  46:	7e 17                	jle    5f <main+0x37>
+        n = atoi(argv[1]);
+  48:	8b 40 04             	mov    0x4(%eax),%eax
+  4b:	83 c0 04             	add    $0x4,%eax
+  4e:	8b 00                	mov    (%eax),%eax
+  50:	83 ec 0c             	sub    $0xc,%esp
+  53:	50                   	push   %eax
+  54:	e8 74 02 00 00       	call   2cd <atoi>
+  59:	83 c4 10             	add    $0x10,%esp
+  5c:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(n <= 0)
+  5f:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+  63:	7f 07                	jg     6c <main+0x44>
+        n = 1;
+  65:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+
+    // Warm up, and let the stub pick its entry path.
+    getpid();
+  6c:	e8 38 04 00 00       	call   4a9 <getpid>
+    intgetpid();
+  71:	e8 9d ff ff ff       	call   13 <intgetpid>
+
+    t0 = rdtsclo();
+  76:	e8 85 ff ff ff       	call   0 <rdtsclo>
+  7b:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    for(i = 0; i < n; i++)
+  7e:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  85:	eb 09                	jmp    90 <main+0x68>
+        getpid();
+  87:	e8 1d 04 00 00       	call   4a9 <getpid>
+    for(i = 0; i < n; i++)
+  8c:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+  90:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  93:	3b 45 f0             	cmp    -0x10(%ebp),%eax
+  96:	7c ef                	jl     87 <main+0x5f>
+    fast = rdtsclo() - t0;
+  98:	e8 63 ff ff ff       	call   0 <rdtsclo>
+  9d:	2b 45 ec             	sub    -0x14(%ebp),%eax
+  a0:	89 45 e8             	mov    %eax,-0x18(%ebp)
+
+    t0 = rdtsclo();
+  a3:	e8 58 ff ff ff       	call   0 <rdtsclo>
+  a8:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    for(i = 0; i < n; i++)
+  ab:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  b2:	eb 09                	jmp    bd <main+0x95>
+        intgetpid();
+  b4:	e8 5a ff ff ff       	call   13 <intgetpid>
+    for(i = 0; i < n; i++)
+  b9:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+  bd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  c0:	3b 45 f0             	cmp    -0x10(%ebp),%eax
+  c3:	7c ef                	jl     b4 <main+0x8c>
+    slow = rdtsclo() - t0;
+  c5:	e8 36 ff ff ff       	call   0 <rdtsclo>
+  ca:	2b 45 ec             	sub    -0x14(%ebp),%eax
+  cd:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+
+    printf(1, "nullbench: %d calls: stub %d cycles/call, int $T_SYSCALL %d cycles/call\n",
+  d0:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  d3:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  d6:	ba 00 00 00 00       	mov    $0x0,%edx
+  db:	f7 f3                	div    %ebx
+  dd:	89 c1                	mov    %eax,%ecx
+  df:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  e2:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  e5:	ba 00 00 00 00       	mov    $0x0,%edx
+  ea:	f7 f3                	div    %ebx
+  ec:	83 ec 0c             	sub    $0xc,%esp
+  ef:	51                   	push   %ecx
+  f0:	50                   	push   %eax
+  f1:	ff 75 f0             	push   -0x10(%ebp)
+  f4:	68 c8 0a 00 00       	push   $0xac8
+  f9:	6a 01                	push   $0x1
+  fb:	e8 10 06 00 00       	call   710 <printf>
+ 100:	83 c4 20             	add    $0x20,%esp
+        n, fast / n, slow / n);
+    exit();
+ 103:	e8 0a 03 00 00       	call   412 <exit>
+
+00000108 <stosb>:
+strchr(const char *s, char c)
+{
+    for(; *s; s++)
+        if(*s == c)
+            return (char*)s;
+    return 0;
+ 108:	55                   	push   %ebp
+ 109:	89 e5                	mov    %esp,%ebp
+ 10b:	57                   	push   %edi
+ 10c:	53                   	push   %ebx
+}
+ 10d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 110:	8b 55 10             	mov    0x10(%ebp),%edx
+ 113:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 116:	89 cb                	mov    %ecx,%ebx
+ 118:	89 df                	mov    %ebx,%edi
+ 11a:	89 d1                	mov    %edx,%ecx
+ 11c:	fc                   	cld
+ 11d:	f3 aa                	rep stos %al,%es:(%edi)
+ 11f:	89 ca                	mov    %ecx,%edx
+ 121:	89 fb                	mov    %edi,%ebx
+ 123:	89 5d 08             	mov    %ebx,0x8(%ebp)
+ 126:	89 55 10             	mov    %edx,0x10(%ebp)
+
+char*
+gets(char *buf, int max)
+{
+ 129:	90                   	nop
+ 12a:	5b                   	pop    %ebx
+ 12b:	5f                   	pop    %edi
+ 12c:	5d                   	pop    %ebp
+ 12d:	c3                   	ret
+
+0000012e <strcpy>:
+{
+ 12e:	55                   	push   %ebp
+ 12f:	89 e5                	mov    %esp,%ebp
+ 131:	83 ec 10             	sub    $0x10,%esp
+    os = s;
+ 134:	8b 45 08             	mov    0x8(%ebp),%eax
+ 137:	89 45 fc             	mov    %eax,-0x4(%ebp)
+    while((*s++ = *t++) != 0)
+ 13a:	90                   	nop
+ 13b:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 13e:	8d 42 01             	lea    0x1(%edx),%eax
+ 141:	89 45 0c             	mov    %eax,0xc(%ebp)
+ 144:	8b 45 08             	mov    0x8(%ebp),%eax
+ 147:	8d 48 01             	lea    0x1(%eax),%ecx
+ 14a:	89 4d 08             	mov    %ecx,0x8(%ebp)
+ 14d:	0f b6 12             	movzbl (%edx),%edx
+ 150:	88 10                	mov    %dl,(%eax)
+ 152:	0f b6 00             	movzbl (%eax),%eax
+ 155:	84 c0                	test   %al,%al
+ 157:	75 e2                	jne    13b <strcpy+0xd>
+    return os;
+ 159:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 15c:	c9                   	leave
+ 15d:	c3                   	ret
+
+0000015e <strcmp>:
+{
+ 15e:	55                   	push   %ebp
+ 15f:	89 e5                	mov    %esp,%ebp
+    while(*p && *p == *q)
+ 161:	eb 08                	jmp    16b <strcmp+0xd>
+        p++, q++;
+ 163:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 167:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+    while(*p && *p == *q)
+ 16b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 16e:	0f b6 00             	movzbl (%eax),%eax
+ 171:	84 c0                	test   %al,%al
+ 173:	74 10                	je     185 <strcmp+0x27>
+ 175:	8b 45 08             	mov    0x8(%ebp),%eax
+ 178:	0f b6 10             	movzbl (%eax),%edx
+ 17b:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 17e:	0f b6 00             	movzbl (%eax),%eax
+ 181:	38 c2                	cmp    %al,%dl
+ 183:	74 de                	je     163 <strcmp+0x5>
+    return (uchar)*p - (uchar)*q;
+ 185:	8b 45 08             	mov    0x8(%ebp),%eax
+ 188:	0f b6 00             	movzbl (%eax),%eax
+ 18b:	0f b6 d0             	movzbl %al,%edx
+ 18e:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 191:	0f b6 00             	movzbl (%eax),%eax
+ 194:	0f b6 c0             	movzbl %al,%eax
+ 197:	29 c2                	sub    %eax,%edx
+ 199:	89 d0                	mov    %edx,%eax
+}
+ 19b:	5d                   	pop    %ebp
+ 19c:	c3                   	ret
+
+0000019d <strlen>:
+{
+ 19d:	55                   	push   %ebp
+ 19e:	89 e5                	mov    %esp,%ebp
+ 1a0:	83 ec 10             	sub    $0x10,%esp
+    for(n = 0; s[n]; n++)
+ 1a3:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ 1aa:	eb 04                	jmp    1b0 <strlen+0x13>
+ 1ac:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 1b0:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 1b3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1b6:	01 d0                	add    %edx,%eax
+ 1b8:	0f b6 00             	movzbl (%eax),%eax
+ 1bb:	84 c0                	test   %al,%al
+ 1bd:	75 ed                	jne    1ac <strlen+0xf>
+    return n;
+ 1bf:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 1c2:	c9                   	leave
+ 1c3:	c3                   	ret
+
+000001c4 <memset>:
+{
+ 1c4:	55                   	push   %ebp
+ 1c5:	89 e5                	mov    %esp,%ebp
+    stosb(dst, c, n);
+ 1c7:	8b 45 10             	mov    0x10(%ebp),%eax
+ 1ca:	50                   	push   %eax
+ 1cb:	ff 75 0c             	push   0xc(%ebp)
+ 1ce:	ff 75 08             	push   0x8(%ebp)
+ 1d1:	e8 32 ff ff ff       	call   108 <stosb>
+ 1d6:	83 c4 0c             	add    $0xc,%esp
+    return dst;
+ 1d9:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 1dc:	c9                   	leave
+ 1dd:	c3                   	ret
+
+000001de <strchr>:
+{
+ 1de:	55                   	push   %ebp
+ 1df:	89 e5                	mov    %esp,%ebp
+ 1e1:	83 ec 04             	sub    $0x4,%esp
+ 1e4:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 1e7:	88 45 fc             	mov    %al,-0x4(%ebp)
+    for(; *s; s++)
+ 1ea:	eb 14                	jmp    200 <strchr+0x22>
+        if(*s == c)
+ 1ec:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1ef:	0f b6 00             	movzbl (%eax),%eax
+ 1f2:	38 45 fc             	cmp    %al,-0x4(%ebp)
+ 1f5:	75 05                	jne    1fc <strchr+0x1e>
+            return (char*)s;
+ 1f7:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1fa:	eb 13                	jmp    20f <strchr+0x31>
+    for(; *s; s++)
+ 1fc:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 200:	8b 45 08             	mov    0x8(%ebp),%eax
+ 203:	0f b6 00             	movzbl (%eax),%eax
+ 206:	84 c0                	test   %al,%al
+ 208:	75 e2                	jne    1ec <strchr+0xe>
+    return 0;
+ 20a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 20f:	c9                   	leave
+ 210:	c3                   	ret
+
+00000211 <gets>:
+{
+ 211:	55                   	push   %ebp
+ 212:	89 e5                	mov    %esp,%ebp
+ 214:	83 ec 18             	sub    $0x18,%esp
+    int i, cc;
+    char c;
+
+    for(i=0; i+1 < max; ){
+ 217:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 21e:	eb 42                	jmp    262 <gets+0x51>
+        cc = read(0, &c, 1);
+ 220:	83 ec 04             	sub    $0x4,%esp
+ 223:	6a 01                	push   $0x1
+ 225:	8d 45 ef             	lea    -0x11(%ebp),%eax
+ 228:	50                   	push   %eax
+ 229:	6a 00                	push   $0x0
+ 22b:	e8 f7 01 00 00       	call   427 <read>
+ 230:	83 c4 10             	add    $0x10,%esp
+ 233:	89 45 f0             	mov    %eax,-0x10(%ebp)
+        if(cc < 1)
+ 236:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 23a:	7e 33                	jle    26f <gets+0x5e>
+            break;
+        buf[i++] = c;
+ 23c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 23f:	8d 50 01             	lea    0x1(%eax),%edx
+ 242:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 245:	89 c2                	mov    %eax,%edx
+ 247:	8b 45 08             	mov    0x8(%ebp),%eax
+ 24a:	01 c2                	add    %eax,%edx
+ 24c:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 250:	88 02                	mov    %al,(%edx)
+        if(c == '\n' || c == '\r')
+ 252:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 256:	3c 0a                	cmp    $0xa,%al
+ 258:	74 16                	je     270 <gets+0x5f>
+ 25a:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 25e:	3c 0d                	cmp    $0xd,%al
+ 260:	74 0e                	je     270 <gets+0x5f>
+    for(i=0; i+1 < max; ){
+ 262:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 265:	83 c0 01             	add    $0x1,%eax
+ 268:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 26b:	7f b3                	jg     220 <gets+0xf>
+ 26d:	eb 01                	jmp    270 <gets+0x5f>
+            break;
+ 26f:	90                   	nop
+            break;
+    }
+    buf[i] = '\0';
+ 270:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 273:	8b 45 08             	mov    0x8(%ebp),%eax
+ 276:	01 d0                	add    %edx,%eax
+ 278:	c6 00 00             	movb   $0x0,(%eax)
+    return buf;
+ 27b:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 27e:	c9                   	leave
+ 27f:	c3                   	ret
+
+00000280 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 280:	55                   	push   %ebp
+ 281:	89 e5                	mov    %esp,%ebp
+ 283:	83 ec 18             	sub    $0x18,%esp
+    int fd;
+    int r;
+
+    fd = open(n, O_RDONLY);
+ 286:	83 ec 08             	sub    $0x8,%esp
+ 289:	6a 00                	push   $0x0
+ 28b:	ff 75 08             	push   0x8(%ebp)
+ 28e:	e8 c6 01 00 00       	call   459 <open>
+ 293:	83 c4 10             	add    $0x10,%esp
+ 296:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(fd < 0)
+ 299:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 29d:	79 07                	jns    2a6 <stat+0x26>
+        return -1;
+ 29f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 2a4:	eb 25                	jmp    2cb <stat+0x4b>
+    r = fstat(fd, st);
+ 2a6:	83 ec 08             	sub    $0x8,%esp
+ 2a9:	ff 75 0c             	push   0xc(%ebp)
+ 2ac:	ff 75 f4             	push   -0xc(%ebp)
+ 2af:	e8 c3 01 00 00       	call   477 <fstat>
+ 2b4:	83 c4 10             	add    $0x10,%esp
+ 2b7:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    close(fd);
+ 2ba:	83 ec 0c             	sub    $0xc,%esp
+ 2bd:	ff 75 f4             	push   -0xc(%ebp)
+ 2c0:	e8 76 01 00 00       	call   43b <close>
+ 2c5:	83 c4 10             	add    $0x10,%esp
+    return r;
+ 2c8:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ 2cb:	c9                   	leave
+ 2cc:	c3                   	ret
+
+000002cd <atoi>:
+
+int
+atoi(const char *s)
+{
+ 2cd:	55                   	push   %ebp
+ 2ce:	89 e5                	mov    %esp,%ebp
+ 2d0:	83 ec 10             	sub    $0x10,%esp
+    int n;
+
+    n = 0;
+ 2d3:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+    while('0' <= *s && *s <= '9')
+ 2da:	eb 25                	jmp    301 <atoi+0x34>
+        n = n*10 + *s++ - '0';
+ 2dc:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 2df:	89 d0                	mov    %edx,%eax
+ 2e1:	c1 e0 02             	shl    $0x2,%eax
+ 2e4:	01 d0                	add    %edx,%eax
+ 2e6:	01 c0                	add    %eax,%eax
+ 2e8:	89 c1                	mov    %eax,%ecx
+ 2ea:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2ed:	8d 50 01             	lea    0x1(%eax),%edx
+ 2f0:	89 55 08             	mov    %edx,0x8(%ebp)
+ 2f3:	0f b6 00             	movzbl (%eax),%eax
+ 2f6:	0f be c0             	movsbl %al,%eax
+ 2f9:	01 c8                	add    %ecx,%eax
+ 2fb:	83 e8 30             	sub    $0x30,%eax
+ 2fe:	89 45 fc             	mov    %eax,-0x4(%ebp)
+    while('0' <= *s && *s <= '9')
+ 301:	8b 45 08             	mov    0x8(%ebp),%eax
+ 304:	0f b6 00             	movzbl (%eax),%eax
+ 307:	3c 2f                	cmp    $0x2f,%al
+ 309:	7e 0a                	jle    315 <atoi+0x48>
+ 30b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 30e:	0f b6 00             	movzbl (%eax),%eax
+ 311:	3c 39                	cmp    $0x39,%al
+ 313:	7e c7                	jle    2dc <atoi+0xf>
+    return n;
+ 315:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 318:	c9                   	leave
+ 319:	c3                   	ret
+
+0000031a <nice>:
+
+// Add inc to the caller's nice value; return the new value.
+int
+nice(int inc)
+{
+ 31a:	55                   	push   %ebp
+ 31b:	89 e5                	mov    %esp,%ebp
+ 31d:	83 ec 18             	sub    $0x18,%esp
+    int n;
+
+    n = getpriority(0) + inc;
+ 320:	83 ec 0c             	sub    $0xc,%esp
+ 323:	6a 00                	push   $0x0
+ 325:	e8 d9 01 00 00       	call   503 <getpriority>
+ 32a:	83 c4 10             	add    $0x10,%esp
+ 32d:	8b 55 08             	mov    0x8(%ebp),%edx
+ 330:	01 d0                	add    %edx,%eax
+ 332:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(n < 0)
+ 335:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 339:	79 07                	jns    342 <nice+0x28>
+        n = 0;
+ 33b:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    if(n > NICEMAX)
+ 342:	83 7d f4 13          	cmpl   $0x13,-0xc(%ebp)
+ 346:	7e 07                	jle    34f <nice+0x35>
+        n = NICEMAX;
+ 348:	c7 45 f4 13 00 00 00 	movl   $0x13,-0xc(%ebp)
+    if(setpriority(0, n) < 0)
+ 34f:	83 ec 08             	sub    $0x8,%esp
+ 352:	ff 75 f4             	push   -0xc(%ebp)
+ 355:	6a 00                	push   $0x0
+ 357:	e8 b1 01 00 00       	call   50d <setpriority>
+ 35c:	83 c4 10             	add    $0x10,%esp
+ 35f:	85 c0                	test   %eax,%eax
+ 361:	79 07                	jns    36a <nice+0x50>
+        return -1;
+ 363:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 368:	eb 03                	jmp    36d <nice+0x53>
+    return n;
+ 36a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+ 36d:	c9                   	leave
+ 36e:	c3                   	ret
+
+0000036f <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 36f:	55                   	push   %ebp
+ 370:	89 e5                	mov    %esp,%ebp
+ 372:	83 ec 10             	sub    $0x10,%esp
+    char *dst;
+    const char *src;
+
+    dst = vdst;
+ 375:	8b 45 08             	mov    0x8(%ebp),%eax
+ 378:	89 45 fc             	mov    %eax,-0x4(%ebp)
+    src = vsrc;
+ 37b:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 37e:	89 45 f8             	mov    %eax,-0x8(%ebp)
+    while(n-- > 0)
+ 381:	eb 17                	jmp    39a <memmove+0x2b>
+        *dst++ = *src++;
+ 383:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 386:	8d 42 01             	lea    0x1(%edx),%eax
+ 389:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 38c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 38f:	8d 48 01             	lea    0x1(%eax),%ecx
+ 392:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+ 395:	0f b6 12             	movzbl (%edx),%edx
+ 398:	88 10                	mov    %dl,(%eax)
+    while(n-- > 0)
+ 39a:	8b 45 10             	mov    0x10(%ebp),%eax
+ 39d:	8d 50 ff             	lea    -0x1(%eax),%edx
+ 3a0:	89 55 10             	mov    %edx,0x10(%ebp)
+ 3a3:	85 c0                	test   %eax,%eax
+ 3a5:	7f dc                	jg     383 <memmove+0x14>
+    return vdst;
+ 3a7:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 3aa:	c9                   	leave
+ 3ab:	c3                   	ret
+
+000003ac <dosyscall>:
+sysmode:
+    .long 0
+
+    .text
+dosyscall:
+    cmpl $0, sysmode
+ 3ac:	83 3d c0 0d 00 00 00 	cmpl   $0x0,0xdc0
+    jg 2f
+ 3b3:	7f 0c                	jg     3c1 <dosyscall+0x15>
+    jl 1f
+ 3b5:	7c 07                	jl     3be <dosyscall+0x12>
+    call sepcheck
+ 3b7:	e8 27 00 00 00       	call   3e3 <sepcheck>
+    jmp dosyscall
+ 3bc:	eb ee                	jmp    3ac <dosyscall>
+1:
+    int $T_SYSCALL
+ 3be:	cd 40                	int    $0x40
+    ret
+ 3c0:	c3                   	ret
+2:
+    pushl %ebx
+ 3c1:	53                   	push   %ebx
+    pushl %esi
+ 3c2:	56                   	push   %esi
+    pushl %edi
+ 3c3:	57                   	push   %edi
+    pushl %ebp
+ 3c4:	55                   	push   %ebp
+    movl 20(%esp), %ebx
+ 3c5:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+    movl 24(%esp), %esi
+ 3c9:	8b 74 24 18          	mov    0x18(%esp),%esi
+    movl 28(%esp), %edi
+ 3cd:	8b 7c 24 1c          	mov    0x1c(%esp),%edi
+    movl 32(%esp), %ebp
+ 3d1:	8b 6c 24 20          	mov    0x20(%esp),%ebp
+    movl %esp, %ecx
+ 3d5:	89 e1                	mov    %esp,%ecx
+    movl $3f, %edx
+ 3d7:	ba de 03 00 00       	mov    $0x3de,%edx
+    sysenter
+ 3dc:	0f 34                	sysenter
+3:
+    popl %ebp
+ 3de:	5d                   	pop    %ebp
+    popl %edi
+ 3df:	5f                   	pop    %edi
+    popl %esi
+ 3e0:	5e                   	pop    %esi
+    popl %ebx
+ 3e1:	5b                   	pop    %ebx
+    ret
+ 3e2:	c3                   	ret
+
+000003e3 <sepcheck>:
+
+# Set sysmode from cpuid's SEP flag.    Preserves %eax.
+sepcheck:
+    pushl %eax
+ 3e3:	50                   	push   %eax
+    pushl %ebx
+ 3e4:	53                   	push   %ebx
+    movl $1, %eax
+ 3e5:	b8 01 00 00 00       	mov    $0x1,%eax
+    cpuid
+ 3ea:	0f a2                	cpuid
+    movl $-1, sysmode
+ 3ec:	c7 05 c0 0d 00 00 ff 	movl   $0xffffffff,0xdc0
+ 3f3:	ff ff ff 
+    testl $0x800, %edx
+ 3f6:	f7 c2 00 08 00 00    	test   $0x800,%edx
+    jz 1f
+ 3fc:	74 0a                	je     408 <sepcheck+0x25>
+    movl $1, sysmode
+ 3fe:	c7 05 c0 0d 00 00 01 	movl   $0x1,0xdc0
+ 405:	00 00 00 
+1:
+    popl %ebx
+ 408:	5b                   	pop    %ebx
+    popl %eax
+ 409:	58                   	pop    %eax
+    ret
+ 40a:	c3                   	ret
+
+0000040b <fork>:
+
+SYSCALL(fork)
+ 40b:	b8 01 00 00 00       	mov    $0x1,%eax
+ 410:	eb 9a                	jmp    3ac <dosyscall>
+
+00000412 <exit>:
+SYSCALL(exit)
+ 412:	b8 02 00 00 00       	mov    $0x2,%eax
+ 417:	eb 93                	jmp    3ac <dosyscall>
+
+00000419 <wait>:
+SYSCALL(wait)
+ 419:	b8 03 00 00 00       	mov    $0x3,%eax
+ 41e:	eb 8c                	jmp    3ac <dosyscall>
+
+00000420 <pipe>:
+SYSCALL(pipe)
+ 420:	b8 04 00 00 00       	mov    $0x4,%eax
+ 425:	eb 85                	jmp    3ac <dosyscall>
+
+00000427 <read>:
+SYSCALL(read)
+ 427:	b8 05 00 00 00       	mov    $0x5,%eax
+ 42c:	e9 7b ff ff ff       	jmp    3ac <dosyscall>
+
+00000431 <write>:
+SYSCALL(write)
+ 431:	b8 10 00 00 00       	mov    $0x10,%eax
+ 436:	e9 71 ff ff ff       	jmp    3ac <dosyscall>
+
+0000043b <close>:
+SYSCALL(close)
+ 43b:	b8 15 00 00 00       	mov    $0x15,%eax
+ 440:	e9 67 ff ff ff       	jmp    3ac <dosyscall>
+
+00000445 <kill>:
+SYSCALL(kill)
+ 445:	b8 06 00 00 00       	mov    $0x6,%eax
+ 44a:	e9 5d ff ff ff       	jmp    3ac <dosyscall>
+
+0000044f <exec>:
+SYSCALL(exec)
+ 44f:	b8 07 00 00 00       	mov    $0x7,%eax
+ 454:	e9 53 ff ff ff       	jmp    3ac <dosyscall>
+
+00000459 <open>:
+SYSCALL(open)
+ 459:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 45e:	e9 49 ff ff ff       	jmp    3ac <dosyscall>
+
+00000463 <mknod>:
+SYSCALL(mknod)
+ 463:	b8 11 00 00 00       	mov    $0x11,%eax
+ 468:	e9 3f ff ff ff       	jmp    3ac <dosyscall>
+
+0000046d <unlink>:
+SYSCALL(unlink)
+ 46d:	b8 12 00 00 00       	mov    $0x12,%eax
+ 472:	e9 35 ff ff ff       	jmp    3ac <dosyscall>
+
+00000477 <fstat>:
+SYSCALL(fstat)
+ 477:	b8 08 00 00 00       	mov    $0x8,%eax
+ 47c:	e9 2b ff ff ff       	jmp    3ac <dosyscall>
+
+00000481 <link>:
+SYSCALL(link)
+ 481:	b8 13 00 00 00       	mov    $0x13,%eax
+ 486:	e9 21 ff ff ff       	jmp    3ac <dosyscall>
+
+0000048b <mkdir>:
+SYSCALL(mkdir)
+ 48b:	b8 14 00 00 00       	mov    $0x14,%eax
+ 490:	e9 17 ff ff ff       	jmp    3ac <dosyscall>
+
+00000495 <chdir>:
+SYSCALL(chdir)
+ 495:	b8 09 00 00 00       	mov    $0x9,%eax
+ 49a:	e9 0d ff ff ff       	jmp    3ac <dosyscall>
+
+0000049f <dup>:
+SYSCALL(dup)
+ 49f:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 4a4:	e9 03 ff ff ff       	jmp    3ac <dosyscall>
+
+000004a9 <getpid>:
+SYSCALL(getpid)
+ 4a9:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 4ae:	e9 f9 fe ff ff       	jmp    3ac <dosyscall>
+
+000004b3 <sbrk>:
+SYSCALL(sbrk)
+ 4b3:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 4b8:	e9 ef fe ff ff       	jmp    3ac <dosyscall>
+
+000004bd <sleep>:
+SYSCALL(sleep)
+ 4bd:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 4c2:	e9 e5 fe ff ff       	jmp    3ac <dosyscall>
+
+000004c7 <uptime>:
+SYSCALL(uptime)
+ 4c7:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 4cc:	e9 db fe ff ff       	jmp    3ac <dosyscall>
+
+000004d1 <date>:
+SYSCALL(date)
+ 4d1:	b8 16 00 00 00       	mov    $0x16,%eax
+ 4d6:	e9 d1 fe ff ff       	jmp    3ac <dosyscall>
+
+000004db <dup2>:
+SYSCALL(dup2)
+ 4db:	b8 17 00 00 00       	mov    $0x17,%eax
+ 4e0:	e9 c7 fe ff ff       	jmp    3ac <dosyscall>
+
+000004e5 <uffd>:
+SYSCALL(uffd)
+ 4e5:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 4ea:	e9 bd fe ff ff       	jmp    3ac <dosyscall>
+
+000004ef <uffdregister>:
+SYSCALL(uffdregister)
+ 4ef:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 4f4:	e9 b3 fe ff ff       	jmp    3ac <dosyscall>
+
+000004f9 <uffdcopy>:
+SYSCALL(uffdcopy)
+ 4f9:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 4fe:	e9 a9 fe ff ff       	jmp    3ac <dosyscall>
+
+00000503 <getpriority>:
+SYSCALL(getpriority)
+ 503:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 508:	e9 9f fe ff ff       	jmp    3ac <dosyscall>
+
+0000050d <setpriority>:
+SYSCALL(setpriority)
+ 50d:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 512:	e9 95 fe ff ff       	jmp    3ac <dosyscall>
+
+00000517 <setweight>:
+SYSCALL(setweight)
+ 517:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 51c:	e9 8b fe ff ff       	jmp    3ac <dosyscall>
+
+00000521 <setgroup>:
+SYSCALL(setgroup)
+ 521:	b8 20 00 00 00       	mov    $0x20,%eax
+ 526:	e9 81 fe ff ff       	jmp    3ac <dosyscall>
+
+0000052b <schedinfo>:
+SYSCALL(schedinfo)
+ 52b:	b8 21 00 00 00       	mov    $0x21,%eax
+ 530:	e9 77 fe ff ff       	jmp    3ac <dosyscall>
+
+00000535 <nanosleep>:
+SYSCALL(nanosleep)
+ 535:	b8 22 00 00 00       	mov    $0x22,%eax
+ 53a:	e9 6d fe ff ff       	jmp    3ac <dosyscall>
+
+0000053f <clock_nanosleep>:
+SYSCALL(clock_nanosleep)
+ 53f:	b8 23 00 00 00       	mov    $0x23,%eax
+ 544:	e9 63 fe ff ff       	jmp    3ac <dosyscall>
+
+00000549 <clock_gettime>:
+SYSCALL(clock_gettime)
+ 549:	b8 24 00 00 00       	mov    $0x24,%eax
+ 54e:	e9 59 fe ff ff       	jmp    3ac <dosyscall>
+
+00000553 <sched_setaffinity>:
+SYSCALL(sched_setaffinity)
+ 553:	b8 25 00 00 00       	mov    $0x25,%eax
+ 558:	e9 4f fe ff ff       	jmp    3ac <dosyscall>
+
+0000055d <sched_getaffinity>:
+SYSCALL(sched_getaffinity)
+ 55d:	b8 26 00 00 00       	mov    $0x26,%eax
+ 562:	e9 45 fe ff ff       	jmp    3ac <dosyscall>
+
+00000567 <irqaffinity>:
+SYSCALL(irqaffinity)
+ 567:	b8 27 00 00 00       	mov    $0x27,%eax
+ 56c:	e9 3b fe ff ff       	jmp    3ac <dosyscall>
+
+00000571 <getrusage>:
+SYSCALL(getrusage)
+ 571:	b8 28 00 00 00       	mov    $0x28,%eax
+ 576:	e9 31 fe ff ff       	jmp    3ac <dosyscall>
+
+0000057b <times>:
+SYSCALL(times)
+ 57b:	b8 29 00 00 00       	mov    $0x29,%eax
+ 580:	e9 27 fe ff ff       	jmp    3ac <dosyscall>
+
+00000585 <schedlat>:
+SYSCALL(schedlat)
+ 585:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 58a:	e9 1d fe ff ff       	jmp    3ac <dosyscall>
+
+0000058f <sched_setscheduler>:
+SYSCALL(sched_setscheduler)
+ 58f:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 594:	e9 13 fe ff ff       	jmp    3ac <dosyscall>
+
+00000599 <sched_getscheduler>:
+SYSCALL(sched_getscheduler)
+ 599:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 59e:	e9 09 fe ff ff       	jmp    3ac <dosyscall>
+
+000005a3 <sched_getparam>:
+SYSCALL(sched_getparam)
+ 5a3:	b8 2d 00 00 00       	mov    $0x2d,%eax
+ 5a8:	e9 ff fd ff ff       	jmp    3ac <dosyscall>
+
+000005ad <lockstat>:
+SYSCALL(lockstat)
+ 5ad:	b8 2e 00 00 00       	mov    $0x2e,%eax
+ 5b2:	e9 f5 fd ff ff       	jmp    3ac <dosyscall>
+
+000005b7 <ioring_setup>:
+SYSCALL(ioring_setup)
+ 5b7:	b8 2f 00 00 00       	mov    $0x2f,%eax
+ 5bc:	e9 eb fd ff ff       	jmp    3ac <dosyscall>
+
+000005c1 <ioring_enter>:
+SYSCALL(ioring_enter)
+ 5c1:	b8 30 00 00 00       	mov    $0x30,%eax
+ 5c6:	e9 e1 fd ff ff       	jmp    3ac <dosyscall>
+
+000005cb <readv>:
+SYSCALL(readv)
+ 5cb:	b8 31 00 00 00       	mov    $0x31,%eax
+ 5d0:	e9 d7 fd ff ff       	jmp    3ac <dosyscall>
+
+000005d5 <writev>:
+SYSCALL(writev)
+ 5d5:	b8 32 00 00 00       	mov    $0x32,%eax
+ 5da:	e9 cd fd ff ff       	jmp    3ac <dosyscall>
+
+000005df <pread>:
+SYSCALL(pread)
+ 5df:	b8 33 00 00 00       	mov    $0x33,%eax
+ 5e4:	e9 c3 fd ff ff       	jmp    3ac <dosyscall>
+
+000005e9 <pwrite>:
+SYSCALL(pwrite)
+ 5e9:	b8 34 00 00 00       	mov    $0x34,%eax
+ 5ee:	e9 b9 fd ff ff       	jmp    3ac <dosyscall>
+
+000005f3 <sendfile>:
+SYSCALL(sendfile)
+ 5f3:	b8 35 00 00 00       	mov    $0x35,%eax
+ 5f8:	e9 af fd ff ff       	jmp    3ac <dosyscall>
+
+000005fd <splice>:
+SYSCALL(splice)
+ 5fd:	b8 36 00 00 00       	mov    $0x36,%eax
+ 602:	e9 a5 fd ff ff       	jmp    3ac <dosyscall>
+
+00000607 <sysstat>:
+SYSCALL(sysstat)
+ 607:	b8 37 00 00 00       	mov    $0x37,%eax
+ 60c:	e9 9b fd ff ff       	jmp    3ac <dosyscall>
+
+00000611 <strace>:
+SYSCALL(strace)
+ 611:	b8 38 00 00 00       	mov    $0x38,%eax
+ 616:	e9 91 fd ff ff       	jmp    3ac <dosyscall>
+
+0000061b <straceread>:
+SYSCALL(straceread)
+ 61b:	b8 39 00 00 00       	mov    $0x39,%eax
+ 620:	e9 87 fd ff ff       	jmp    3ac <dosyscall>
+
+00000625 <alarm>:
+
+# alarm and rstoregs keep to int $T_SYSCALL: rstoregs restores
+# %ecx and %edx, which sysexit would clobber.
+.globl alarm
+    alarm:
+        pushl $rstoregs
+ 625:	68 35 06 00 00       	push   $0x635
+        movl $SYS_alarm, %eax
+ 62a:	b8 18 00 00 00       	mov    $0x18,%eax
+        int $T_SYSCALL
+ 62f:	cd 40                	int    $0x40
+        add $0x04, %esp
+ 631:	83 c4 04             	add    $0x4,%esp
+        ret
+ 634:	c3                   	ret
+
+00000635 <rstoregs>:
+
+.globl rstoregs
+    rstoregs:
+        movl $SYS_rstoregs, %eax
+ 635:	b8 19 00 00 00       	mov    $0x19,%eax
+        int $T_SYSCALL
+ 63a:	cd 40                	int    $0x40
+
+0000063c <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 63c:	55                   	push   %ebp
+ 63d:	89 e5                	mov    %esp,%ebp
+ 63f:	83 ec 18             	sub    $0x18,%esp
+ 642:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 645:	88 45 f4             	mov    %al,-0xc(%ebp)
+    write(fd, &c, 1);
+ 648:	83 ec 04             	sub    $0x4,%esp
+ 64b:	6a 01                	push   $0x1
+ 64d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+ 650:	50                   	push   %eax
+ 651:	ff 75 08             	push   0x8(%ebp)
+ 654:	e8 d8 fd ff ff       	call   431 <write>
+ 659:	83 c4 10             	add    $0x10,%esp
+}
+ 65c:	90                   	nop
+ 65d:	c9                   	leave
+ 65e:	c3                   	ret
+
+0000065f <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 65f:	55                   	push   %ebp
+ 660:	89 e5                	mov    %esp,%ebp
+ 662:	83 ec 28             	sub    $0x28,%esp
+    static char digits[] = "0123456789ABCDEF";
+    char buf[16];
+    int i, neg;
+    uint x;
+
+    neg = 0;
+ 665:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+    if(sgn && xx < 0){
+ 66c:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+ 670:	74 17                	je     689 <printint+0x2a>
+ 672:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 676:	79 11                	jns    689 <printint+0x2a>
+        neg = 1;
+ 678:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+        x = -xx;
+ 67f:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 682:	f7 d8                	neg    %eax
+ 684:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 687:	eb 06                	jmp    68f <printint+0x30>
+    } else {
+        x = xx;
+ 689:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 68c:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    }
+
+    i = 0;
+ 68f:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    do{
+        buf[i++] = digits[x % base];
+ 696:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 699:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 69c:	ba 00 00 00 00       	mov    $0x0,%edx
+ 6a1:	f7 f1                	div    %ecx
+ 6a3:	89 d1                	mov    %edx,%ecx
+ 6a5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 6a8:	8d 50 01             	lea    0x1(%eax),%edx
+ 6ab:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 6ae:	0f b6 91 c4 0d 00 00 	movzbl 0xdc4(%ecx),%edx
+ 6b5:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+    }while((x /= base) != 0);
+ 6b9:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 6bc:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 6bf:	ba 00 00 00 00       	mov    $0x0,%edx
+ 6c4:	f7 f1                	div    %ecx
+ 6c6:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 6c9:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 6cd:	75 c7                	jne    696 <printint+0x37>
+    if(neg)
+ 6cf:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 6d3:	74 2d                	je     702 <printint+0xa3>
+        buf[i++] = '-';
+ 6d5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 6d8:	8d 50 01             	lea    0x1(%eax),%edx
+ 6db:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 6de:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+    while(--i >= 0)
+ 6e3:	eb 1d                	jmp    702 <printint+0xa3>
+        putc(fd, buf[i]);
+ 6e5:	8d 55 dc             	lea    -0x24(%ebp),%edx
+ 6e8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 6eb:	01 d0                	add    %edx,%eax
+ 6ed:	0f b6 00             	movzbl (%eax),%eax
+ 6f0:	0f be c0             	movsbl %al,%eax
+ 6f3:	83 ec 08             	sub    $0x8,%esp
+ 6f6:	50                   	push   %eax
+ 6f7:	ff 75 08             	push   0x8(%ebp)
+ 6fa:	e8 3d ff ff ff       	call   63c <putc>
+ 6ff:	83 c4 10             	add    $0x10,%esp
+    while(--i >= 0)
+ 702:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+ 706:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 70a:	79 d9                	jns    6e5 <printint+0x86>
+}
+ 70c:	90                   	nop
+ 70d:	90                   	nop
+ 70e:	c9                   	leave
+ 70f:	c3                   	ret
+
+00000710 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 710:	55                   	push   %ebp
+ 711:	89 e5                	mov    %esp,%ebp
+ 713:	83 ec 28             	sub    $0x28,%esp
+    char *s;
+    int c, i, state;
+    uint *ap;
+
+    state = 0;
+ 716:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+    ap = (uint*)(void*)&fmt + 1;
+ 71d:	8d 45 0c             	lea    0xc(%ebp),%eax
+ 720:	83 c0 04             	add    $0x4,%eax
+ 723:	89 45 e8             	mov    %eax,-0x18(%ebp)
+    for(i = 0; fmt[i]; i++){
+ 726:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 72d:	e9 59 01 00 00       	jmp    88b <printf+0x17b>
+        c = fmt[i] & 0xff;
+ 732:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 735:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 738:	01 d0                	add    %edx,%eax
+ 73a:	0f b6 00             	movzbl (%eax),%eax
+ 73d:	0f be c0             	movsbl %al,%eax
+ 740:	25 ff 00 00 00       	and    $0xff,%eax
+ 745:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        if(state == 0){
+ 748:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 74c:	75 2c                	jne    77a <printf+0x6a>
+            if(c == '%'){
+ 74e:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 752:	75 0c                	jne    760 <printf+0x50>
+                state = '%';
+ 754:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+ 75b:	e9 27 01 00 00       	jmp    887 <printf+0x177>
+            } else {
+                putc(fd, c);
+ 760:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 763:	0f be c0             	movsbl %al,%eax
+ 766:	83 ec 08             	sub    $0x8,%esp
+ 769:	50                   	push   %eax
+ 76a:	ff 75 08             	push   0x8(%ebp)
+ 76d:	e8 ca fe ff ff       	call   63c <putc>
+ 772:	83 c4 10             	add    $0x10,%esp
+ 775:	e9 0d 01 00 00       	jmp    887 <printf+0x177>
+            }
+        } else if(state == '%'){
+ 77a:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+ 77e:	0f 85 03 01 00 00    	jne    887 <printf+0x177>
+            if(c == 'd'){
+ 784:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+ 788:	75 1e                	jne    7a8 <printf+0x98>
+                printint(fd, *ap, 10, 1);
+ 78a:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 78d:	8b 00                	mov    (%eax),%eax
+ 78f:	6a 01                	push   $0x1
+ 791:	6a 0a                	push   $0xa
+ 793:	50                   	push   %eax
+ 794:	ff 75 08             	push   0x8(%ebp)
+ 797:	e8 c3 fe ff ff       	call   65f <printint>
+ 79c:	83 c4 10             	add    $0x10,%esp
+                ap++;
+ 79f:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 7a3:	e9 d8 00 00 00       	jmp    880 <printf+0x170>
+            } else if(c == 'x' || c == 'p'){
+ 7a8:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+ 7ac:	74 06                	je     7b4 <printf+0xa4>
+ 7ae:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+ 7b2:	75 1e                	jne    7d2 <printf+0xc2>
+                printint(fd, *ap, 16, 0);
+ 7b4:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 7b7:	8b 00                	mov    (%eax),%eax
+ 7b9:	6a 00                	push   $0x0
+ 7bb:	6a 10                	push   $0x10
+ 7bd:	50                   	push   %eax
+ 7be:	ff 75 08             	push   0x8(%ebp)
+ 7c1:	e8 99 fe ff ff       	call   65f <printint>
+ 7c6:	83 c4 10             	add    $0x10,%esp
+                ap++;
+ 7c9:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 7cd:	e9 ae 00 00 00       	jmp    880 <printf+0x170>
+            } else if(c == 's'){
+ 7d2:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+ 7d6:	75 43                	jne    81b <printf+0x10b>
+                s = (char*)*ap;
+ 7d8:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 7db:	8b 00                	mov    (%eax),%eax
+ 7dd:	89 45 f4             	mov    %eax,-0xc(%ebp)
+                ap++;
+ 7e0:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+                if(s == 0)
+ 7e4:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 7e8:	75 25                	jne    80f <printf+0xff>
+                    s = "(null)";
+ 7ea:	c7 45 f4 11 0b 00 00 	movl   $0xb11,-0xc(%ebp)
+                while(*s != 0){
+ 7f1:	eb 1c                	jmp    80f <printf+0xff>
+                    putc(fd, *s);
+ 7f3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 7f6:	0f b6 00             	movzbl (%eax),%eax
+ 7f9:	0f be c0             	movsbl %al,%eax
+ 7fc:	83 ec 08             	sub    $0x8,%esp
+ 7ff:	50                   	push   %eax
+ 800:	ff 75 08             	push   0x8(%ebp)
+ 803:	e8 34 fe ff ff       	call   63c <putc>
+ 808:	83 c4 10             	add    $0x10,%esp
+                    s++;
+ 80b:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+                while(*s != 0){
+ 80f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 812:	0f b6 00             	movzbl (%eax),%eax
+ 815:	84 c0                	test   %al,%al
+ 817:	75 da                	jne    7f3 <printf+0xe3>
+ 819:	eb 65                	jmp    880 <printf+0x170>
+                }
+            } else if(c == 'c'){
+ 81b:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+ 81f:	75 1d                	jne    83e <printf+0x12e>
+                putc(fd, *ap);
+ 821:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 824:	8b 00                	mov    (%eax),%eax
+ 826:	0f be c0             	movsbl %al,%eax
+ 829:	83 ec 08             	sub    $0x8,%esp
+ 82c:	50                   	push   %eax
+ 82d:	ff 75 08             	push   0x8(%ebp)
+ 830:	e8 07 fe ff ff       	call   63c <putc>
+ 835:	83 c4 10             	add    $0x10,%esp
+                ap++;
+ 838:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 83c:	eb 42                	jmp    880 <printf+0x170>
+            } else if(c == '%'){
+ 83e:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 842:	75 17                	jne    85b <printf+0x14b>
+                putc(fd, c);
+ 844:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 847:	0f be c0             	movsbl %al,%eax
+ 84a:	83 ec 08             	sub    $0x8,%esp
+ 84d:	50                   	push   %eax
+ 84e:	ff 75 08             	push   0x8(%ebp)
+ 851:	e8 e6 fd ff ff       	call   63c <putc>
+ 856:	83 c4 10             	add    $0x10,%esp
+ 859:	eb 25                	jmp    880 <printf+0x170>
+            } else {
+                // Unknown % sequence.    Print it to draw attention.
+                putc(fd, '%');
+ 85b:	83 ec 08             	sub    $0x8,%esp
+ 85e:	6a 25                	push   $0x25
+ 860:	ff 75 08             	push   0x8(%ebp)
+ 863:	e8 d4 fd ff ff       	call   63c <putc>
+ 868:	83 c4 10             	add    $0x10,%esp
+                putc(fd, c);
+ 86b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 86e:	0f be c0             	movsbl %al,%eax
+ 871:	83 ec 08             	sub    $0x8,%esp
+ 874:	50                   	push   %eax
+ 875:	ff 75 08             	push   0x8(%ebp)
+ 878:	e8 bf fd ff ff       	call   63c <putc>
+ 87d:	83 c4 10             	add    $0x10,%esp
+            }
+            state = 0;
+ 880:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+    for(i = 0; fmt[i]; i++){
+ 887:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ 88b:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 88e:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 891:	01 d0                	add    %edx,%eax
+ 893:	0f b6 00             	movzbl (%eax),%eax
+ 896:	84 c0                	test   %al,%al
+ 898:	0f 85 94 fe ff ff    	jne    732 <printf+0x22>
+        }
+    }
+}
+ 89e:	90                   	nop
+ 89f:	90                   	nop
+ 8a0:	c9                   	leave
+ 8a1:	c3                   	ret
+
+000008a2 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 8a2:	55                   	push   %ebp
+ 8a3:	89 e5                	mov    %esp,%ebp
+ 8a5:	83 ec 10             	sub    $0x10,%esp
+    Header *bp, *p;
+
+    bp = (Header*)ap - 1;
+ 8a8:	8b 45 08             	mov    0x8(%ebp),%eax
+ 8ab:	83 e8 08             	sub    $0x8,%eax
+ 8ae:	89 45 f8             	mov    %eax,-0x8(%ebp)
+    for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 8b1:	a1 e0 0d 00 00       	mov    0xde0,%eax
+ 8b6:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 8b9:	eb 24                	jmp    8df <free+0x3d>
+        if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 8bb:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 8be:	8b 00                	mov    (%eax),%eax
+ 8c0:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 8c3:	72 12                	jb     8d7 <free+0x35>
+ 8c5:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 8c8:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 8cb:	72 24                	jb     8f1 <free+0x4f>
+ 8cd:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 8d0:	8b 00                	mov    (%eax),%eax
+ 8d2:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 8d5:	72 1a                	jb     8f1 <free+0x4f>
+    for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 8d7:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 8da:	8b 00                	mov    (%eax),%eax
+ 8dc:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 8df:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 8e2:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 8e5:	73 d4                	jae    8bb <free+0x19>
+ 8e7:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 8ea:	8b 00                	mov    (%eax),%eax
+ 8ec:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 8ef:	73 ca                	jae    8bb <free+0x19>
+            break;
+    if(bp + bp->s.size == p->s.ptr){
+ 8f1:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 8f4:	8b 40 04             	mov    0x4(%eax),%eax
+ 8f7:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 8fe:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 901:	01 c2                	add    %eax,%edx
+ 903:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 906:	8b 00                	mov    (%eax),%eax
+ 908:	39 c2                	cmp    %eax,%edx
+ 90a:	75 24                	jne    930 <free+0x8e>
+        bp->s.size += p->s.ptr->s.size;
+ 90c:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 90f:	8b 50 04             	mov    0x4(%eax),%edx
+ 912:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 915:	8b 00                	mov    (%eax),%eax
+ 917:	8b 40 04             	mov    0x4(%eax),%eax
+ 91a:	01 c2                	add    %eax,%edx
+ 91c:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 91f:	89 50 04             	mov    %edx,0x4(%eax)
+        bp->s.ptr = p->s.ptr->s.ptr;
+ 922:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 925:	8b 00                	mov    (%eax),%eax
+ 927:	8b 10                	mov    (%eax),%edx
+ 929:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 92c:	89 10                	mov    %edx,(%eax)
+ 92e:	eb 0a                	jmp    93a <free+0x98>
+    } else
+        bp->s.ptr = p->s.ptr;
+ 930:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 933:	8b 10                	mov    (%eax),%edx
+ 935:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 938:	89 10                	mov    %edx,(%eax)
+    if(p + p->s.size == bp){
+ 93a:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 93d:	8b 40 04             	mov    0x4(%eax),%eax
+ 940:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 947:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 94a:	01 d0                	add    %edx,%eax
+ 94c:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 94f:	75 20                	jne    971 <free+0xcf>
+        p->s.size += bp->s.size;
+ 951:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 954:	8b 50 04             	mov    0x4(%eax),%edx
+ 957:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 95a:	8b 40 04             	mov    0x4(%eax),%eax
+ 95d:	01 c2                	add    %eax,%edx
+ 95f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 962:	89 50 04             	mov    %edx,0x4(%eax)
+        p->s.ptr = bp->s.ptr;
+ 965:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 968:	8b 10                	mov    (%eax),%edx
+ 96a:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 96d:	89 10                	mov    %edx,(%eax)
+ 96f:	eb 08                	jmp    979 <free+0xd7>
+    } else
+        p->s.ptr = bp;
+ 971:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 974:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 977:	89 10                	mov    %edx,(%eax)
+    freep = p;
+ 979:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 97c:	a3 e0 0d 00 00       	mov    %eax,0xde0
+}
+ 981:	90                   	nop
+ 982:	c9                   	leave
+ 983:	c3                   	ret
+
+00000984 <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+ 984:	55                   	push   %ebp
+ 985:	89 e5                	mov    %esp,%ebp
+ 987:	83 ec 18             	sub    $0x18,%esp
+    char *p;
+    Header *hp;
+
+    if(nu < 4096)
+ 98a:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+ 991:	77 07                	ja     99a <morecore+0x16>
+        nu = 4096;
+ 993:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+    p = sbrk(nu * sizeof(Header));
+ 99a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 99d:	c1 e0 03             	shl    $0x3,%eax
+ 9a0:	83 ec 0c             	sub    $0xc,%esp
+ 9a3:	50                   	push   %eax
+ 9a4:	e8 0a fb ff ff       	call   4b3 <sbrk>
+ 9a9:	83 c4 10             	add    $0x10,%esp
+ 9ac:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p == (char*)-1)
+ 9af:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+ 9b3:	75 07                	jne    9bc <morecore+0x38>
+        return 0;
+ 9b5:	b8 00 00 00 00       	mov    $0x0,%eax
+ 9ba:	eb 26                	jmp    9e2 <morecore+0x5e>
+    hp = (Header*)p;
+ 9bc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 9bf:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    hp->s.size = nu;
+ 9c2:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 9c5:	8b 55 08             	mov    0x8(%ebp),%edx
+ 9c8:	89 50 04             	mov    %edx,0x4(%eax)
+    free((void*)(hp + 1));
+ 9cb:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 9ce:	83 c0 08             	add    $0x8,%eax
+ 9d1:	83 ec 0c             	sub    $0xc,%esp
+ 9d4:	50                   	push   %eax
+ 9d5:	e8 c8 fe ff ff       	call   8a2 <free>
+ 9da:	83 c4 10             	add    $0x10,%esp
+    return freep;
+ 9dd:	a1 e0 0d 00 00       	mov    0xde0,%eax
+}
+ 9e2:	c9                   	leave
+ 9e3:	c3                   	ret
+
+000009e4 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ 9e4:	55                   	push   %ebp
+ 9e5:	89 e5                	mov    %esp,%ebp
+ 9e7:	83 ec 18             	sub    $0x18,%esp
+    Header *p, *prevp;
+    uint nunits;
+
+    nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 9ea:	8b 45 08             	mov    0x8(%ebp),%eax
+ 9ed:	83 c0 07             	add    $0x7,%eax
+ 9f0:	c1 e8 03             	shr    $0x3,%eax
+ 9f3:	83 c0 01             	add    $0x1,%eax
+ 9f6:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    if((prevp = freep) == 0){
+ 9f9:	a1 e0 0d 00 00       	mov    0xde0,%eax
+ 9fe:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ a01:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ a05:	75 23                	jne    a2a <malloc+0x46>
+        base.s.ptr = freep = prevp = &base;
+ a07:	c7 45 f0 d8 0d 00 00 	movl   $0xdd8,-0x10(%ebp)
+ a0e:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ a11:	a3 e0 0d 00 00       	mov    %eax,0xde0
+ a16:	a1 e0 0d 00 00       	mov    0xde0,%eax
+ a1b:	a3 d8 0d 00 00       	mov    %eax,0xdd8
+        base.s.size = 0;
+ a20:	c7 05 dc 0d 00 00 00 	movl   $0x0,0xddc
+ a27:	00 00 00 
+    }
+    for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ a2a:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ a2d:	8b 00                	mov    (%eax),%eax
+ a2f:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        if(p->s.size >= nunits){
+ a32:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a35:	8b 40 04             	mov    0x4(%eax),%eax
+ a38:	3b 45 ec             	cmp    -0x14(%ebp),%eax
+ a3b:	72 4d                	jb     a8a <malloc+0xa6>
+            if(p->s.size == nunits)
+ a3d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a40:	8b 40 04             	mov    0x4(%eax),%eax
+ a43:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+ a46:	75 0c                	jne    a54 <malloc+0x70>
+                prevp->s.ptr = p->s.ptr;
+ a48:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a4b:	8b 10                	mov    (%eax),%edx
+ a4d:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ a50:	89 10                	mov    %edx,(%eax)
+ a52:	eb 26                	jmp    a7a <malloc+0x96>
+            else {
+                p->s.size -= nunits;
+ a54:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a57:	8b 40 04             	mov    0x4(%eax),%eax
+ a5a:	2b 45 ec             	sub    -0x14(%ebp),%eax
+ a5d:	89 c2                	mov    %eax,%edx
+ a5f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a62:	89 50 04             	mov    %edx,0x4(%eax)
+                p += p->s.size;
+ a65:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a68:	8b 40 04             	mov    0x4(%eax),%eax
+ a6b:	c1 e0 03             	shl    $0x3,%eax
+ a6e:	01 45 f4             	add    %eax,-0xc(%ebp)
+                p->s.size = nunits;
+ a71:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a74:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ a77:	89 50 04             	mov    %edx,0x4(%eax)
+            }
+            freep = prevp;
+ a7a:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ a7d:	a3 e0 0d 00 00       	mov    %eax,0xde0
+            return (void*)(p + 1);
+ a82:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a85:	83 c0 08             	add    $0x8,%eax
+ a88:	eb 3b                	jmp    ac5 <malloc+0xe1>
+        }
+        if(p == freep)
+ a8a:	a1 e0 0d 00 00       	mov    0xde0,%eax
+ a8f:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ a92:	75 1e                	jne    ab2 <malloc+0xce>
+            if((p = morecore(nunits)) == 0)
+ a94:	83 ec 0c             	sub    $0xc,%esp
+ a97:	ff 75 ec             	push   -0x14(%ebp)
+ a9a:	e8 e5 fe ff ff       	call   984 <morecore>
+ a9f:	83 c4 10             	add    $0x10,%esp
+ aa2:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ aa5:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ aa9:	75 07                	jne    ab2 <malloc+0xce>
+                return 0;
+ aab:	b8 00 00 00 00       	mov    $0x0,%eax
+ ab0:	eb 13                	jmp    ac5 <malloc+0xe1>
+    for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ ab2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ ab5:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ ab8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ abb:	8b 00                	mov    (%eax),%eax
+ abd:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        if(p->s.size >= nunits){
+ ac0:	e9 6d ff ff ff       	jmp    a32 <malloc+0x4e>
+    }
+}
+ ac5:	c9                   	leave
+ ac6:	c3                   	ret
@@ -0,0 +1,60 @@
+// Null system call benchmark: time getpid() through the usual
+// stub, which uses sysenter where the cpu has it, against the
+// same call made with int $T_SYSCALL.
+//
+//    nullbench [calls]
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "syscall.h"
+#include "traps.h"
+
+static inline uint
+rdtsclo(void)
+{
+    uint lo, hi;
+
+    asm volatile("rdtsc" : "=a" (lo), "=d" (hi));
+    return lo;
+}
+
+static inline int
+intgetpid(void)
+{
+    int r;
+
+    asm volatile("int %1" : "=a" (r) : "i" (T_SYSCALL), "a" (SYS_getpid) : "memory");
+    return r;
+}
+
+int
+main(int argc, char *argv[])
+{
+    uint t0, fast, slow;
+    int i, n;
+
+    n = 100000;
+    if(argc > 1)
+        n = atoi(argv[1]);
+    if(n <= 0)
+        n = 1;
+
+    // Warm up, and let the stub pick its entry path.
+    getpid();
+    intgetpid();
+
+    t0 = rdtsclo();
+    for(i = 0; i < n; i++)
+        getpid();
+    fast = rdtsclo() - t0;
+
+    t0 = rdtsclo();
+    for(i = 0; i < n; i++)
+        intgetpid();
+    slow = rdtsclo() - t0;
+
+    printf(1, "nullbench: %d calls: stub %d cycles/call, int $T_SYSCALL %d cycles/call\n",
+        n, fast / n, slow / n);
+    exit();
+}
@@ -1,14 +1,23 @@
-#define NPROC                64    // maximum number of processes
+#define NPROC                64    // processes allocated at boot
+#define MAXPROC             512    // maximum number of processes
 #define KSTACKSIZE 4096    // size of per-process kernel stack
 #define NCPU                    8    // maximum number of CPUs
 #define NOFILE             16    // open files per process
 #define NFILE             100    // open files per system
 #define NINODE             50    // maximum number of active i-nodes
+#define NNCACHE           256    // name cache entries
 #define NDEV                 10    // maximum major device number
 #define ROOTDEV             1    // device number of file system root disk
 #define MAXARG             32    // max exec arguments
 #define MAXOPBLOCKS    10    // max # of blocks any FS op writes
 #define LOGSIZE            (MAXOPBLOCKS*3)    // max data blocks in on-disk log
 #define NBUF                 (MAXOPBLOCKS*3)    // size of disk block cache
-#define FSSIZE             1000    // size of file system in blocks
+#define FSSIZE             2000    // size of file system in blocks
+#define HZ                  100    // timer ticks per second
+#define NPRIO                 4    // scheduler priority levels
+#define NICEMAX              19    // largest nice value
+#define WEIGHT0            1024    // default share weight
+#define WEIGHTMAX         65536    // largest share weight
+#define NGROUP               16    // maximum number of share groups
+#define NLATBUCKET           40    // log2 buckets in scheduling histograms
 
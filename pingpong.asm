@@ -0,0 +1,1562 @@
+
+_pingpong:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "user.h"
+#include "date.h"
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	53                   	push   %ebx
+   e:	51                   	push   %ecx
+   f:	83 ec 40             	sub    $0x40,%esp
+  12:	89 c8                	mov    %ecx,%eax
+    int i, n, pid, us, ping[2], pong[2];
+    struct timespec t0, t1;
+    char c;
+
+    n = 10000;
+  14:	c7 45 f0 10 27 00 00 	movl   $0x2710,-0x10(%ebp)
+    if(argc > 1)
+  1b:	83 38 01             	cmpl   $0x1,(%eax)
+  1e:	7e 17                	jle    37 <main+0x37>
+        n = atoi(argv[1]);
+  20:	8b 40 04             	mov    0x4(%eax),%eax
+  23:	83 c0 04             	add    $0x4,%eax
+  26:	8b 00                	mov    (%eax),%eax
+  28:	83 ec 0c             	sub    $0xc,%esp
+  2b:	50                   	push   %eax
+  2c:	e8 71 03 00 00       	call   3a2 <atoi>
+  31:	83 c4 10             	add    $0x10,%esp
+  34:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(pipe(ping) < 0 || pipe(pong) < 0){
+  37:	83 ec 0c             	sub    $0xc,%esp
+  3a:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  3d:	50                   	push   %eax
+  3e:	e8 b2 04 00 00       	call   4f5 <pipe>
+  43:	83 c4 10             	add    $0x10,%esp
+  46:	85 c0                	test   %eax,%eax
+  48:	78 13                	js     5d <main+0x5d>
+  4a:	83 ec 0c             	sub    $0xc,%esp
+  4d:	8d 45 d8             	lea    -0x28(%ebp),%eax
+  50:	50                   	push   %eax
+  51:	e8 9f 04 00 00       	call   4f5 <pipe>
+  56:	83 c4 10             	add    $0x10,%esp
+  59:	85 c0                	test   %eax,%eax
+  5b:	79 17                	jns    74 <main+0x74>
+        printf(2, "pingpong: pipe failed\n");
+  5d:	83 ec 08             	sub    $0x8,%esp
+  60:	68 9c 0b 00 00       	push   $0xb9c
+  65:	6a 02                	push   $0x2
+  67:	e8 79 07 00 00       	call   7e5 <printf>
+  6c:	83 c4 10             	add    $0x10,%esp
+        exit();
+  6f:	e8 73 04 00 00       	call   4e7 <exit>
+    }
+
+    pid = fork();
+  74:	e8 67 04 00 00       	call   4e0 <fork>
+  79:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    if(pid < 0){
+  7c:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+  80:	79 17                	jns    99 <main+0x99>
+        printf(2, "pingpong: fork failed\n");
+  82:	83 ec 08             	sub    $0x8,%esp
+  85:	68 b3 0b 00 00       	push   $0xbb3
+  8a:	6a 02                	push   $0x2
+  8c:	e8 54 07 00 00       	call   7e5 <printf>
+  91:	83 c4 10             	add    $0x10,%esp
+        exit();
+  94:	e8 4e 04 00 00       	call   4e7 <exit>
+    }
+    if(pid == 0){
+  99:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+  9d:	75 4c                	jne    eb <main+0xeb>
+        for(i = 0; i < n; i++){
+  9f:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  a6:	eb 33                	jmp    db <main+0xdb>
+            if(read(ping[0], &c, 1) != 1)
+  a8:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  ab:	83 ec 04             	sub    $0x4,%esp
+  ae:	6a 01                	push   $0x1
+  b0:	8d 55 c7             	lea    -0x39(%ebp),%edx
+  b3:	52                   	push   %edx
+  b4:	50                   	push   %eax
+  b5:	e8 42 04 00 00       	call   4fc <read>
+  ba:	83 c4 10             	add    $0x10,%esp
+  bd:	83 f8 01             	cmp    $0x1,%eax
+  c0:	75 23                	jne    e5 <main+0xe5>
+                break;
+            write(pong[1], &c, 1);
+  c2:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  c5:	83 ec 04             	sub    $0x4,%esp
+  c8:	6a 01                	push   $0x1
+  ca:	8d 55 c7             	lea    -0x39(%ebp),%edx
+  cd:	52                   	push   %edx
+  ce:	50                   	push   %eax
+  cf:	e8 32 04 00 00       	call   506 <write>
+  d4:	83 c4 10             	add    $0x10,%esp
+        for(i = 0; i < n; i++){
+  d7:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+  db:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  de:	3b 45 f0             	cmp    -0x10(%ebp),%eax
+  e1:	7c c5                	jl     a8 <main+0xa8>
+  e3:	eb 01                	jmp    e6 <main+0xe6>
+                break;
+  e5:	90                   	nop
+        }
+        exit();
+  e6:	e8 fc 03 00 00       	call   4e7 <exit>
+    }
+
+    c = 'x';
+  eb:	c6 45 c7 78          	movb   $0x78,-0x39(%ebp)
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+  ef:	83 ec 08             	sub    $0x8,%esp
+  f2:	8d 45 d0             	lea    -0x30(%ebp),%eax
+  f5:	50                   	push   %eax
+  f6:	6a 01                	push   $0x1
+  f8:	e8 21 05 00 00       	call   61e <clock_gettime>
+  fd:	83 c4 10             	add    $0x10,%esp
+    for(i = 0; i < n; i++){
+ 100:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 107:	eb 47                	jmp    150 <main+0x150>
+        write(ping[1], &c, 1);
+ 109:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 10c:	83 ec 04             	sub    $0x4,%esp
+ 10f:	6a 01                	push   $0x1
+ 111:	8d 55 c7             	lea    -0x39(%ebp),%edx
+ 114:	52                   	push   %edx
+ 115:	50                   	push   %eax
+ 116:	e8 eb 03 00 00       	call   506 <write>
+ 11b:	83 c4 10             	add    $0x10,%esp
+        if(read(pong[0], &c, 1) != 1){
+ 11e:	8b 45 d8             	mov    -0x28(%ebp),%eax
+ 121:	83 ec 04             	sub    $0x4,%esp
+ 124:	6a 01                	push   $0x1
+ 126:	8d 55 c7             	lea    -0x39(%ebp),%edx
+ 129:	52                   	push   %edx
+ 12a:	50                   	push   %eax
+ 12b:	e8 cc 03 00 00       	call   4fc <read>
+ 130:	83 c4 10             	add    $0x10,%esp
+ 133:	83 f8 01             	cmp    $0x1,%eax
+ 136:	74 14                	je     14c <main+0x14c>
+            printf(2, "pingpong: read failed\n");
+ 138:	83 ec 08             	sub    $0x8,%esp
+ 13b:	68 ca 0b 00 00       	push   $0xbca
+ 140:	6a 02                	push   $0x2
+ 142:	e8 9e 06 00 00       	call   7e5 <printf>
+ 147:	83 c4 10             	add    $0x10,%esp
+            break;
+ 14a:	eb 0c                	jmp    158 <main+0x158>
+    for(i = 0; i < n; i++){
+ 14c:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+ 150:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 153:	3b 45 f0             	cmp    -0x10(%ebp),%eax
+ 156:	7c b1                	jl     109 <main+0x109>
+        }
+    }
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+ 158:	83 ec 08             	sub    $0x8,%esp
+ 15b:	8d 45 c8             	lea    -0x38(%ebp),%eax
+ 15e:	50                   	push   %eax
+ 15f:	6a 01                	push   $0x1
+ 161:	e8 b8 04 00 00       	call   61e <clock_gettime>
+ 166:	83 c4 10             	add    $0x10,%esp
+    wait();
+ 169:	e8 80 03 00 00       	call   4ee <wait>
+
+    us = (t1.tv_sec - t0.tv_sec) * 1000000 + (t1.tv_nsec - t0.tv_nsec) / 1000;
+ 16e:	8b 55 c8             	mov    -0x38(%ebp),%edx
+ 171:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 174:	29 c2                	sub    %eax,%edx
+ 176:	69 da 40 42 0f 00    	imul   $0xf4240,%edx,%ebx
+ 17c:	8b 55 cc             	mov    -0x34(%ebp),%edx
+ 17f:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+ 182:	89 d1                	mov    %edx,%ecx
+ 184:	29 c1                	sub    %eax,%ecx
+ 186:	ba d3 4d 62 10       	mov    $0x10624dd3,%edx
+ 18b:	89 c8                	mov    %ecx,%eax
+ 18d:	f7 ea                	imul   %edx
+ 18f:	c1 fa 06             	sar    $0x6,%edx
+ 192:	89 c8                	mov    %ecx,%eax
+ 194:	c1 f8 1f             	sar    $0x1f,%eax
+ 197:	29 c2                	sub    %eax,%edx
+ 199:	8d 04 13             	lea    (%ebx,%edx,1),%eax
+ 19c:	89 45 e8             	mov    %eax,-0x18(%ebp)
+    printf(1, "pingpong: %d round trips in %d us, %d ns each\n",
+ 19f:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 1a3:	7e 15                	jle    1ba <main+0x1ba>
+        i, us, i > 0 ? us * 10 / i * 100 : 0);
+ 1a5:	8b 55 e8             	mov    -0x18(%ebp),%edx
+ 1a8:	89 d0                	mov    %edx,%eax
+ 1aa:	c1 e0 02             	shl    $0x2,%eax
+ 1ad:	01 d0                	add    %edx,%eax
+ 1af:	01 c0                	add    %eax,%eax
+ 1b1:	99                   	cltd
+ 1b2:	f7 7d f4             	idivl  -0xc(%ebp)
+    printf(1, "pingpong: %d round trips in %d us, %d ns each\n",
+ 1b5:	6b c0 64             	imul   $0x64,%eax,%eax
+ 1b8:	eb 05                	jmp    1bf <main+0x1bf>
+ 1ba:	b8 00 00 00 00       	mov    $0x0,%eax
+ 1bf:	83 ec 0c             	sub    $0xc,%esp
+ 1c2:	50                   	push   %eax
+ 1c3:	ff 75 e8             	push   -0x18(%ebp)
+ 1c6:	ff 75 f4             	push   -0xc(%ebp)
+ 1c9:	68 e4 0b 00 00       	push   $0xbe4
+ 1ce:	6a 01                	push   $0x1
+ 1d0:	e8 10 06 00 00       	call   7e5 <printf>
+ 1d5:	83 c4 20             	add    $0x20,%esp
+    exit();
+ 1d8:	e8 0a 03 00 00       	call   4e7 <exit>
+
+000001dd <stosb>:
+strchr(const char *s, char c)
+{
+    for(; *s; s++)
+        if(*s == c)
+            return (char*)s;
+    return 0;
+ 1dd:	55                   	push   %ebp
+ 1de:	89 e5                	mov    %esp,%ebp
+ 1e0:	57                   	push   %edi
+ 1e1:	53                   	push   %ebx
+}
+ 1e2:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 1e5:	8b 55 10             	mov    0x10(%ebp),%edx
+ 1e8:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 1eb:	89 cb                	mov    %ecx,%ebx
+ 1ed:	89 df                	mov    %ebx,%edi
+ 1ef:	89 d1                	mov    %edx,%ecx
+ 1f1:	fc                   	cld
+ 1f2:	f3 aa                	rep stos %al,%es:(%edi)
+ 1f4:	89 ca                	mov    %ecx,%edx
+ 1f6:	89 fb                	mov    %edi,%ebx
+ 1f8:	89 5d 08             	mov    %ebx,0x8(%ebp)
+ 1fb:	89 55 10             	mov    %edx,0x10(%ebp)
+
+char*
+gets(char *buf, int max)
+{
+ 1fe:	90                   	nop
+ 1ff:	5b                   	pop    %ebx
+ 200:	5f                   	pop    %edi
+ 201:	5d                   	pop    %ebp
+ 202:	c3                   	ret
+
+00000203 <strcpy>:
+{
+ 203:	55                   	push   %ebp
+ 204:	89 e5                	mov    %esp,%ebp
+ 206:	83 ec 10             	sub    $0x10,%esp
+    os = s;
+ 209:	8b 45 08             	mov    0x8(%ebp),%eax
+ 20c:	89 45 fc             	mov    %eax,-0x4(%ebp)
+    while((*s++ = *t++) != 0)
+ 20f:	90                   	nop
+ 210:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 213:	8d 42 01             	lea    0x1(%edx),%eax
+ 216:	89 45 0c             	mov    %eax,0xc(%ebp)
+ 219:	8b 45 08             	mov    0x8(%ebp),%eax
+ 21c:	8d 48 01             	lea    0x1(%eax),%ecx
+ 21f:	89 4d 08             	mov    %ecx,0x8(%ebp)
+ 222:	0f b6 12             	movzbl (%edx),%edx
+ 225:	88 10                	mov    %dl,(%eax)
+ 227:	0f b6 00             	movzbl (%eax),%eax
+ 22a:	84 c0                	test   %al,%al
+ 22c:	75 e2                	jne    210 <strcpy+0xd>
+    return os;
+ 22e:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 231:	c9                   	leave
+ 232:	c3                   	ret
+
+00000233 <strcmp>:
+{
+ 233:	55                   	push   %ebp
+ 234:	89 e5                	mov    %esp,%ebp
+    while(*p && *p == *q)
+ 236:	eb 08                	jmp    240 <strcmp+0xd>
+        p++, q++;
+ 238:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 23c:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+    while(*p && *p == *q)
+ 240:	8b 45 08             	mov    0x8(%ebp),%eax
+ 243:	0f b6 00             	movzbl (%eax),%eax
+ 246:	84 c0                	test   %al,%al
+ 248:	74 10                	je     25a <strcmp+0x27>
+ 24a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 24d:	0f b6 10             	movzbl (%eax),%edx
+ 250:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 253:	0f b6 00             	movzbl (%eax),%eax
+ 256:	38 c2                	cmp    %al,%dl
+ 258:	74 de                	je     238 <strcmp+0x5>
+    return (uchar)*p - (uchar)*q;
+ 25a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 25d:	0f b6 00             	movzbl (%eax),%eax
+ 260:	0f b6 d0             	movzbl %al,%edx
+ 263:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 266:	0f b6 00             	movzbl (%eax),%eax
+ 269:	0f b6 c0             	movzbl %al,%eax
+ 26c:	29 c2                	sub    %eax,%edx
+ 26e:	89 d0                	mov    %edx,%eax
+}
+ 270:	5d                   	pop    %ebp
+ 271:	c3                   	ret
+
+00000272 <strlen>:
+{
+ 272:	55                   	push   %ebp
+ 273:	89 e5                	mov    %esp,%ebp
+ 275:	83 ec 10             	sub    $0x10,%esp
+    for(n = 0; s[n]; n++)
+ 278:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ 27f:	eb 04                	jmp    285 <strlen+0x13>
+ 281:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 285:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 288:	8b 45 08             	mov    0x8(%ebp),%eax
+ 28b:	01 d0                	add    %edx,%eax
+ 28d:	0f b6 00             	movzbl (%eax),%eax
+ 290:	84 c0                	test   %al,%al
+ 292:	75 ed                	jne    281 <strlen+0xf>
+    return n;
+ 294:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 297:	c9                   	leave
+ 298:	c3                   	ret
+
+00000299 <memset>:
+{
+ 299:	55                   	push   %ebp
+ 29a:	89 e5                	mov    %esp,%ebp
+    stosb(dst, c, n);
+ 29c:	8b 45 10             	mov    0x10(%ebp),%eax
+ 29f:	50                   	push   %eax
+ 2a0:	ff 75 0c             	push   0xc(%ebp)
+ 2a3:	ff 75 08             	push   0x8(%ebp)
+ 2a6:	e8 32 ff ff ff       	call   1dd <stosb>
+ 2ab:	83 c4 0c             	add    $0xc,%esp
+    return dst;
+ 2ae:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 2b1:	c9                   	leave
+ 2b2:	c3                   	ret
+
+000002b3 <strchr>:
+{
+ 2b3:	55                   	push   %ebp
+ 2b4:	89 e5                	mov    %esp,%ebp
+ 2b6:	83 ec 04             	sub    $0x4,%esp
+ 2b9:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 2bc:	88 45 fc             	mov    %al,-0x4(%ebp)
+    for(; *s; s++)
+ 2bf:	eb 14                	jmp    2d5 <strchr+0x22>
+        if(*s == c)
+ 2c1:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2c4:	0f b6 00             	movzbl (%eax),%eax
+ 2c7:	38 45 fc             	cmp    %al,-0x4(%ebp)
+ 2ca:	75 05                	jne    2d1 <strchr+0x1e>
+            return (char*)s;
+ 2cc:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2cf:	eb 13                	jmp    2e4 <strchr+0x31>
+    for(; *s; s++)
+ 2d1:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 2d5:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2d8:	0f b6 00             	movzbl (%eax),%eax
+ 2db:	84 c0                	test   %al,%al
+ 2dd:	75 e2                	jne    2c1 <strchr+0xe>
+    return 0;
+ 2df:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 2e4:	c9                   	leave
+ 2e5:	c3                   	ret
+
+000002e6 <gets>:
+{
+ 2e6:	55                   	push   %ebp
+ 2e7:	89 e5                	mov    %esp,%ebp
+ 2e9:	83 ec 18             	sub    $0x18,%esp
+    int i, cc;
+    char c;
+
+    for(i=0; i+1 < max; ){
+ 2ec:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 2f3:	eb 42                	jmp    337 <gets+0x51>
+        cc = read(0, &c, 1);
+ 2f5:	83 ec 04             	sub    $0x4,%esp
+ 2f8:	6a 01                	push   $0x1
+ 2fa:	8d 45 ef             	lea    -0x11(%ebp),%eax
+ 2fd:	50                   	push   %eax
+ 2fe:	6a 00                	push   $0x0
+ 300:	e8 f7 01 00 00       	call   4fc <read>
+ 305:	83 c4 10             	add    $0x10,%esp
+ 308:	89 45 f0             	mov    %eax,-0x10(%ebp)
+        if(cc < 1)
+ 30b:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 30f:	7e 33                	jle    344 <gets+0x5e>
+            break;
+        buf[i++] = c;
+ 311:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 314:	8d 50 01             	lea    0x1(%eax),%edx
+ 317:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 31a:	89 c2                	mov    %eax,%edx
+ 31c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 31f:	01 c2                	add    %eax,%edx
+ 321:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 325:	88 02                	mov    %al,(%edx)
+        if(c == '\n' || c == '\r')
+ 327:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 32b:	3c 0a                	cmp    $0xa,%al
+ 32d:	74 16                	je     345 <gets+0x5f>
+ 32f:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 333:	3c 0d                	cmp    $0xd,%al
+ 335:	74 0e                	je     345 <gets+0x5f>
+    for(i=0; i+1 < max; ){
+ 337:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 33a:	83 c0 01             	add    $0x1,%eax
+ 33d:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 340:	7f b3                	jg     2f5 <gets+0xf>
+ 342:	eb 01                	jmp    345 <gets+0x5f>
+            break;
+ 344:	90                   	nop
+            break;
+    }
+    buf[i] = '\0';
+ 345:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 348:	8b 45 08             	mov    0x8(%ebp),%eax
+ 34b:	01 d0                	add    %edx,%eax
+ 34d:	c6 00 00             	movb   $0x0,(%eax)
+    return buf;
+ 350:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 353:	c9                   	leave
+ 354:	c3                   	ret
+
+00000355 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 355:	55                   	push   %ebp
+ 356:	89 e5                	mov    %esp,%ebp
+ 358:	83 ec 18             	sub    $0x18,%esp
+    int fd;
+    int r;
+
+    fd = open(n, O_RDONLY);
+ 35b:	83 ec 08             	sub    $0x8,%esp
+ 35e:	6a 00                	push   $0x0
+ 360:	ff 75 08             	push   0x8(%ebp)
+ 363:	e8 c6 01 00 00       	call   52e <open>
+ 368:	83 c4 10             	add    $0x10,%esp
+ 36b:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(fd < 0)
+ 36e:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 372:	79 07                	jns    37b <stat+0x26>
+        return -1;
+ 374:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 379:	eb 25                	jmp    3a0 <stat+0x4b>
+    r = fstat(fd, st);
+ 37b:	83 ec 08             	sub    $0x8,%esp
+ 37e:	ff 75 0c             	push   0xc(%ebp)
+ 381:	ff 75 f4             	push   -0xc(%ebp)
+ 384:	e8 c3 01 00 00       	call   54c <fstat>
+ 389:	83 c4 10             	add    $0x10,%esp
+ 38c:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    close(fd);
+ 38f:	83 ec 0c             	sub    $0xc,%esp
+ 392:	ff 75 f4             	push   -0xc(%ebp)
+ 395:	e8 76 01 00 00       	call   510 <close>
+ 39a:	83 c4 10             	add    $0x10,%esp
+    return r;
+ 39d:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ 3a0:	c9                   	leave
+ 3a1:	c3                   	ret
+
+000003a2 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 3a2:	55                   	push   %ebp
+ 3a3:	89 e5                	mov    %esp,%ebp
+ 3a5:	83 ec 10             	sub    $0x10,%esp
+    int n;
+
+    n = 0;
+ 3a8:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+    while('0' <= *s && *s <= '9')
+ 3af:	eb 25                	jmp    3d6 <atoi+0x34>
+        n = n*10 + *s++ - '0';
+ 3b1:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 3b4:	89 d0                	mov    %edx,%eax
+ 3b6:	c1 e0 02             	shl    $0x2,%eax
+ 3b9:	01 d0                	add    %edx,%eax
+ 3bb:	01 c0                	add    %eax,%eax
+ 3bd:	89 c1                	mov    %eax,%ecx
+ 3bf:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3c2:	8d 50 01             	lea    0x1(%eax),%edx
+ 3c5:	89 55 08             	mov    %edx,0x8(%ebp)
+ 3c8:	0f b6 00             	movzbl (%eax),%eax
+ 3cb:	0f be c0             	movsbl %al,%eax
+ 3ce:	01 c8                	add    %ecx,%eax
+ 3d0:	83 e8 30             	sub    $0x30,%eax
+ 3d3:	89 45 fc             	mov    %eax,-0x4(%ebp)
+    while('0' <= *s && *s <= '9')
+ 3d6:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3d9:	0f b6 00             	movzbl (%eax),%eax
+ 3dc:	3c 2f                	cmp    $0x2f,%al
+ 3de:	7e 0a                	jle    3ea <atoi+0x48>
+ 3e0:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3e3:	0f b6 00             	movzbl (%eax),%eax
+ 3e6:	3c 39                	cmp    $0x39,%al
+ 3e8:	7e c7                	jle    3b1 <atoi+0xf>
+    return n;
+ 3ea:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 3ed:	c9                   	leave
+ 3ee:	c3                   	ret
+
+000003ef <nice>:
+
+// Add inc to the caller's nice value; return the new value.
+int
+nice(int inc)
+{
+ 3ef:	55                   	push   %ebp
+ 3f0:	89 e5                	mov    %esp,%ebp
+ 3f2:	83 ec 18             	sub    $0x18,%esp
+    int n;
+
+    n = getpriority(0) + inc;
+ 3f5:	83 ec 0c             	sub    $0xc,%esp
+ 3f8:	6a 00                	push   $0x0
+ 3fa:	e8 d9 01 00 00       	call   5d8 <getpriority>
+ 3ff:	83 c4 10             	add    $0x10,%esp
+ 402:	8b 55 08             	mov    0x8(%ebp),%edx
+ 405:	01 d0                	add    %edx,%eax
+ 407:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(n < 0)
+ 40a:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 40e:	79 07                	jns    417 <nice+0x28>
+        n = 0;
+ 410:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    if(n > NICEMAX)
+ 417:	83 7d f4 13          	cmpl   $0x13,-0xc(%ebp)
+ 41b:	7e 07                	jle    424 <nice+0x35>
+        n = NICEMAX;
+ 41d:	c7 45 f4 13 00 00 00 	movl   $0x13,-0xc(%ebp)
+    if(setpriority(0, n) < 0)
+ 424:	83 ec 08             	sub    $0x8,%esp
+ 427:	ff 75 f4             	push   -0xc(%ebp)
+ 42a:	6a 00                	push   $0x0
+ 42c:	e8 b1 01 00 00       	call   5e2 <setpriority>
+ 431:	83 c4 10             	add    $0x10,%esp
+ 434:	85 c0                	test   %eax,%eax
+ 436:	79 07                	jns    43f <nice+0x50>
+        return -1;
+ 438:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 43d:	eb 03                	jmp    442 <nice+0x53>
+    return n;
+ 43f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+ 442:	c9                   	leave
+ 443:	c3                   	ret
+
+00000444 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 444:	55                   	push   %ebp
+ 445:	89 e5                	mov    %esp,%ebp
+ 447:	83 ec 10             	sub    $0x10,%esp
+    char *dst;
+    const char *src;
+
+    dst = vdst;
+ 44a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 44d:	89 45 fc             	mov    %eax,-0x4(%ebp)
+    src = vsrc;
+ 450:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 453:	89 45 f8             	mov    %eax,-0x8(%ebp)
+    while(n-- > 0)
+ 456:	eb 17                	jmp    46f <memmove+0x2b>
+        *dst++ = *src++;
+ 458:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 45b:	8d 42 01             	lea    0x1(%edx),%eax
+ 45e:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 461:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 464:	8d 48 01             	lea    0x1(%eax),%ecx
+ 467:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+ 46a:	0f b6 12             	movzbl (%edx),%edx
+ 46d:	88 10                	mov    %dl,(%eax)
+    while(n-- > 0)
+ 46f:	8b 45 10             	mov    0x10(%ebp),%eax
+ 472:	8d 50 ff             	lea    -0x1(%eax),%edx
+ 475:	89 55 10             	mov    %edx,0x10(%ebp)
+ 478:	85 c0                	test   %eax,%eax
+ 47a:	7f dc                	jg     458 <memmove+0x14>
+    return vdst;
+ 47c:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 47f:	c9                   	leave
+ 480:	c3                   	ret
+
+00000481 <dosyscall>:
+sysmode:
+    .long 0
+
+    .text
+dosyscall:
+    cmpl $0, sysmode
+ 481:	83 3d 84 0e 00 00 00 	cmpl   $0x0,0xe84
+    jg 2f
+ 488:	7f 0c                	jg     496 <dosyscall+0x15>
+    jl 1f
+ 48a:	7c 07                	jl     493 <dosyscall+0x12>
+    call sepcheck
+ 48c:	e8 27 00 00 00       	call   4b8 <sepcheck>
+    jmp dosyscall
+ 491:	eb ee                	jmp    481 <dosyscall>
+1:
+    int $T_SYSCALL
+ 493:	cd 40                	int    $0x40
+    ret
+ 495:	c3                   	ret
+2:
+    pushl %ebx
+ 496:	53                   	push   %ebx
+    pushl %esi
+ 497:	56                   	push   %esi
+    pushl %edi
+ 498:	57                   	push   %edi
+    pushl %ebp
+ 499:	55                   	push   %ebp
+    movl 20(%esp), %ebx
+ 49a:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+    movl 24(%esp), %esi
+ 49e:	8b 74 24 18          	mov    0x18(%esp),%esi
+    movl 28(%esp), %edi
+ 4a2:	8b 7c 24 1c          	mov    0x1c(%esp),%edi
+    movl 32(%esp), %ebp
+ 4a6:	8b 6c 24 20          	mov    0x20(%esp),%ebp
+    movl %esp, %ecx
+ 4aa:	89 e1                	mov    %esp,%ecx
+    movl $3f, %edx
+ 4ac:	ba b3 04 00 00       	mov    $0x4b3,%edx
+    sysenter
+ 4b1:	0f 34                	sysenter
+3:
+    popl %ebp
+ 4b3:	5d                   	pop    %ebp
+    popl %edi
+ 4b4:	5f                   	pop    %edi
+    popl %esi
+ 4b5:	5e                   	pop    %esi
+    popl %ebx
+ 4b6:	5b                   	pop    %ebx
+    ret
+ 4b7:	c3                   	ret
+
+000004b8 <sepcheck>:
+
+# Set sysmode from cpuid's SEP flag.    Preserves %eax.
+sepcheck:
+    pushl %eax
+ 4b8:	50                   	push   %eax
+    pushl %ebx
+ 4b9:	53                   	push   %ebx
+    movl $1, %eax
+ 4ba:	b8 01 00 00 00       	mov    $0x1,%eax
+    cpuid
+ 4bf:	0f a2                	cpuid
+    movl $-1, sysmode
+ 4c1:	c7 05 84 0e 00 00 ff 	movl   $0xffffffff,0xe84
+ 4c8:	ff ff ff 
+    testl $0x800, %edx
+ 4cb:	f7 c2 00 08 00 00    	test   $0x800,%edx
+    jz 1f
+ 4d1:	74 0a                	je     4dd <sepcheck+0x25>
+    movl $1, sysmode
+ 4d3:	c7 05 84 0e 00 00 01 	movl   $0x1,0xe84
+ 4da:	00 00 00 
+1:
+    popl %ebx
+ 4dd:	5b                   	pop    %ebx
+    popl %eax
+ 4de:	58                   	pop    %eax
+    ret
+ 4df:	c3                   	ret
+
+000004e0 <fork>:
+
+SYSCALL(fork)
+ 4e0:	b8 01 00 00 00       	mov    $0x1,%eax
+ 4e5:	eb 9a                	jmp    481 <dosyscall>
+
+000004e7 <exit>:
+SYSCALL(exit)
+ 4e7:	b8 02 00 00 00       	mov    $0x2,%eax
+ 4ec:	eb 93                	jmp    481 <dosyscall>
+
+000004ee <wait>:
+SYSCALL(wait)
+ 4ee:	b8 03 00 00 00       	mov    $0x3,%eax
+ 4f3:	eb 8c                	jmp    481 <dosyscall>
+
+000004f5 <pipe>:
+SYSCALL(pipe)
+ 4f5:	b8 04 00 00 00       	mov    $0x4,%eax
+ 4fa:	eb 85                	jmp    481 <dosyscall>
+
+000004fc <read>:
+SYSCALL(read)
+ 4fc:	b8 05 00 00 00       	mov    $0x5,%eax
+ 501:	e9 7b ff ff ff       	jmp    481 <dosyscall>
+
+00000506 <write>:
+SYSCALL(write)
+ 506:	b8 10 00 00 00       	mov    $0x10,%eax
+ 50b:	e9 71 ff ff ff       	jmp    481 <dosyscall>
+
+00000510 <close>:
+SYSCALL(close)
+ 510:	b8 15 00 00 00       	mov    $0x15,%eax
+ 515:	e9 67 ff ff ff       	jmp    481 <dosyscall>
+
+0000051a <kill>:
+SYSCALL(kill)
+ 51a:	b8 06 00 00 00       	mov    $0x6,%eax
+ 51f:	e9 5d ff ff ff       	jmp    481 <dosyscall>
+
+00000524 <exec>:
+SYSCALL(exec)
+ 524:	b8 07 00 00 00       	mov    $0x7,%eax
+ 529:	e9 53 ff ff ff       	jmp    481 <dosyscall>
+
+0000052e <open>:
+SYSCALL(open)
+ 52e:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 533:	e9 49 ff ff ff       	jmp    481 <dosyscall>
+
+00000538 <mknod>:
+SYSCALL(mknod)
+ 538:	b8 11 00 00 00       	mov    $0x11,%eax
+ 53d:	e9 3f ff ff ff       	jmp    481 <dosyscall>
+
+00000542 <unlink>:
+SYSCALL(unlink)
+ 542:	b8 12 00 00 00       	mov    $0x12,%eax
+ 547:	e9 35 ff ff ff       	jmp    481 <dosyscall>
+
+0000054c <fstat>:
+SYSCALL(fstat)
+ 54c:	b8 08 00 00 00       	mov    $0x8,%eax
+ 551:	e9 2b ff ff ff       	jmp    481 <dosyscall>
+
+00000556 <link>:
+SYSCALL(link)
+ 556:	b8 13 00 00 00       	mov    $0x13,%eax
+ 55b:	e9 21 ff ff ff       	jmp    481 <dosyscall>
+
+00000560 <mkdir>:
+SYSCALL(mkdir)
+ 560:	b8 14 00 00 00       	mov    $0x14,%eax
+ 565:	e9 17 ff ff ff       	jmp    481 <dosyscall>
+
+0000056a <chdir>:
+SYSCALL(chdir)
+ 56a:	b8 09 00 00 00       	mov    $0x9,%eax
+ 56f:	e9 0d ff ff ff       	jmp    481 <dosyscall>
+
+00000574 <dup>:
+SYSCALL(dup)
+ 574:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 579:	e9 03 ff ff ff       	jmp    481 <dosyscall>
+
+0000057e <getpid>:
+SYSCALL(getpid)
+ 57e:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 583:	e9 f9 fe ff ff       	jmp    481 <dosyscall>
+
+00000588 <sbrk>:
+SYSCALL(sbrk)
+ 588:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 58d:	e9 ef fe ff ff       	jmp    481 <dosyscall>
+
+00000592 <sleep>:
+SYSCALL(sleep)
+ 592:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 597:	e9 e5 fe ff ff       	jmp    481 <dosyscall>
+
+0000059c <uptime>:
+SYSCALL(uptime)
+ 59c:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 5a1:	e9 db fe ff ff       	jmp    481 <dosyscall>
+
+000005a6 <date>:
+SYSCALL(date)
+ 5a6:	b8 16 00 00 00       	mov    $0x16,%eax
+ 5ab:	e9 d1 fe ff ff       	jmp    481 <dosyscall>
+
+000005b0 <dup2>:
+SYSCALL(dup2)
+ 5b0:	b8 17 00 00 00       	mov    $0x17,%eax
+ 5b5:	e9 c7 fe ff ff       	jmp    481 <dosyscall>
+
+000005ba <uffd>:
+SYSCALL(uffd)
+ 5ba:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 5bf:	e9 bd fe ff ff       	jmp    481 <dosyscall>
+
+000005c4 <uffdregister>:
+SYSCALL(uffdregister)
+ 5c4:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 5c9:	e9 b3 fe ff ff       	jmp    481 <dosyscall>
+
+000005ce <uffdcopy>:
+SYSCALL(uffdcopy)
+ 5ce:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 5d3:	e9 a9 fe ff ff       	jmp    481 <dosyscall>
+
+000005d8 <getpriority>:
+SYSCALL(getpriority)
+ 5d8:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 5dd:	e9 9f fe ff ff       	jmp    481 <dosyscall>
+
+000005e2 <setpriority>:
+SYSCALL(setpriority)
+ 5e2:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 5e7:	e9 95 fe ff ff       	jmp    481 <dosyscall>
+
+000005ec <setweight>:
+SYSCALL(setweight)
+ 5ec:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 5f1:	e9 8b fe ff ff       	jmp    481 <dosyscall>
+
+000005f6 <setgroup>:
+SYSCALL(setgroup)
+ 5f6:	b8 20 00 00 00       	mov    $0x20,%eax
+ 5fb:	e9 81 fe ff ff       	jmp    481 <dosyscall>
+
+00000600 <schedinfo>:
+SYSCALL(schedinfo)
+ 600:	b8 21 00 00 00       	mov    $0x21,%eax
+ 605:	e9 77 fe ff ff       	jmp    481 <dosyscall>
+
+0000060a <nanosleep>:
+SYSCALL(nanosleep)
+ 60a:	b8 22 00 00 00       	mov    $0x22,%eax
+ 60f:	e9 6d fe ff ff       	jmp    481 <dosyscall>
+
+00000614 <clock_nanosleep>:
+SYSCALL(clock_nanosleep)
+ 614:	b8 23 00 00 00       	mov    $0x23,%eax
+ 619:	e9 63 fe ff ff       	jmp    481 <dosyscall>
+
+0000061e <clock_gettime>:
+SYSCALL(clock_gettime)
+ 61e:	b8 24 00 00 00       	mov    $0x24,%eax
+ 623:	e9 59 fe ff ff       	jmp    481 <dosyscall>
+
+00000628 <sched_setaffinity>:
+SYSCALL(sched_setaffinity)
+ 628:	b8 25 00 00 00       	mov    $0x25,%eax
+ 62d:	e9 4f fe ff ff       	jmp    481 <dosyscall>
+
+00000632 <sched_getaffinity>:
+SYSCALL(sched_getaffinity)
+ 632:	b8 26 00 00 00       	mov    $0x26,%eax
+ 637:	e9 45 fe ff ff       	jmp    481 <dosyscall>
+
+0000063c <irqaffinity>:
+SYSCALL(irqaffinity)
+ 63c:	b8 27 00 00 00       	mov    $0x27,%eax
+ 641:	e9 3b fe ff ff       	jmp    481 <dosyscall>
+
+00000646 <getrusage>:
+SYSCALL(getrusage)
+ 646:	b8 28 00 00 00       	mov    $0x28,%eax
+ 64b:	e9 31 fe ff ff       	jmp    481 <dosyscall>
+
+00000650 <times>:
+SYSCALL(times)
+ 650:	b8 29 00 00 00       	mov    $0x29,%eax
+ 655:	e9 27 fe ff ff       	jmp    481 <dosyscall>
+
+0000065a <schedlat>:
+SYSCALL(schedlat)
+ 65a:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 65f:	e9 1d fe ff ff       	jmp    481 <dosyscall>
+
+00000664 <sched_setscheduler>:
+SYSCALL(sched_setscheduler)
+ 664:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 669:	e9 13 fe ff ff       	jmp    481 <dosyscall>
+
+0000066e <sched_getscheduler>:
+SYSCALL(sched_getscheduler)
+ 66e:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 673:	e9 09 fe ff ff       	jmp    481 <dosyscall>
+
+00000678 <sched_getparam>:
+SYSCALL(sched_getparam)
+ 678:	b8 2d 00 00 00       	mov    $0x2d,%eax
+ 67d:	e9 ff fd ff ff       	jmp    481 <dosyscall>
+
+00000682 <lockstat>:
+SYSCALL(lockstat)
+ 682:	b8 2e 00 00 00       	mov    $0x2e,%eax
+ 687:	e9 f5 fd ff ff       	jmp    481 <dosyscall>
+
+0000068c <ioring_setup>:
+SYSCALL(ioring_setup)
+ 68c:	b8 2f 00 00 00       	mov    $0x2f,%eax
+ 691:	e9 eb fd ff ff       	jmp    481 <dosyscall>
+
+00000696 <ioring_enter>:
+SYSCALL(ioring_enter)
+ 696:	b8 30 00 00 00       	mov    $0x30,%eax
+ 69b:	e9 e1 fd ff ff       	jmp    481 <dosyscall>
+
+000006a0 <readv>:
+SYSCALL(readv)
+ 6a0:	b8 31 00 00 00       	mov    $0x31,%eax
+ 6a5:	e9 d7 fd ff ff       	jmp    481 <dosyscall>
+
+000006aa <writev>:
+SYSCALL(writev)
+ 6aa:	b8 32 00 00 00       	mov    $0x32,%eax
+ 6af:	e9 cd fd ff ff       	jmp    481 <dosyscall>
+
+000006b4 <pread>:
+SYSCALL(pread)
+ 6b4:	b8 33 00 00 00       	mov    $0x33,%eax
+ 6b9:	e9 c3 fd ff ff       	jmp    481 <dosyscall>
+
+000006be <pwrite>:
+SYSCALL(pwrite)
+ 6be:	b8 34 00 00 00       	mov    $0x34,%eax
+ 6c3:	e9 b9 fd ff ff       	jmp    481 <dosyscall>
+
+000006c8 <sendfile>:
+SYSCALL(sendfile)
+ 6c8:	b8 35 00 00 00       	mov    $0x35,%eax
+ 6cd:	e9 af fd ff ff       	jmp    481 <dosyscall>
+
+000006d2 <splice>:
+SYSCALL(splice)
+ 6d2:	b8 36 00 00 00       	mov    $0x36,%eax
+ 6d7:	e9 a5 fd ff ff       	jmp    481 <dosyscall>
+
+000006dc <sysstat>:
+SYSCALL(sysstat)
+ 6dc:	b8 37 00 00 00       	mov    $0x37,%eax
+ 6e1:	e9 9b fd ff ff       	jmp    481 <dosyscall>
+
+000006e6 <strace>:
+SYSCALL(strace)
+ 6e6:	b8 38 00 00 00       	mov    $0x38,%eax
+ 6eb:	e9 91 fd ff ff       	jmp    481 <dosyscall>
+
+000006f0 <straceread>:
+SYSCALL(straceread)
+ 6f0:	b8 39 00 00 00       	mov    $0x39,%eax
+ 6f5:	e9 87 fd ff ff       	jmp    481 <dosyscall>
+
+000006fa <alarm>:
+
+# alarm and rstoregs keep to int $T_SYSCALL: rstoregs restores
+# %ecx and %edx, which sysexit would clobber.
+.globl alarm
+    alarm:
+        pushl $rstoregs
+ 6fa:	68 0a 07 00 00       	push   $0x70a
+        movl $SYS_alarm, %eax
+ 6ff:	b8 18 00 00 00       	mov    $0x18,%eax
+        int $T_SYSCALL
+ 704:	cd 40                	int    $0x40
+        add $0x04, %esp
+ 706:	83 c4 04             	add    $0x4,%esp
+        ret
+ 709:	c3                   	ret
+
+0000070a <rstoregs>:
+
+.globl rstoregs
+    rstoregs:
+        movl $SYS_rstoregs, %eax
+ 70a:	b8 19 00 00 00       	mov    $0x19,%eax
+        int $T_SYSCALL
+ 70f:	cd 40                	int    $0x40
+
+00000711 <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 711:	55                   	push   %ebp
+ 712:	89 e5                	mov    %esp,%ebp
+ 714:	83 ec 18             	sub    $0x18,%esp
+ 717:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 71a:	88 45 f4             	mov    %al,-0xc(%ebp)
+    write(fd, &c, 1);
+ 71d:	83 ec 04             	sub    $0x4,%esp
+ 720:	6a 01                	push   $0x1
+ 722:	8d 45 f4             	lea    -0xc(%ebp),%eax
+ 725:	50                   	push   %eax
+ 726:	ff 75 08             	push   0x8(%ebp)
+ 729:	e8 d8 fd ff ff       	call   506 <write>
+ 72e:	83 c4 10             	add    $0x10,%esp
+}
+ 731:	90                   	nop
+ 732:	c9                   	leave
+ 733:	c3                   	ret
+
+00000734 <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 734:	55                   	push   %ebp
+ 735:	89 e5                	mov    %esp,%ebp
+ 737:	83 ec 28             	sub    $0x28,%esp
+    static char digits[] = "0123456789ABCDEF";
+    char buf[16];
+    int i, neg;
+    uint x;
+
+    neg = 0;
+ 73a:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+    if(sgn && xx < 0){
+ 741:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+ 745:	74 17                	je     75e <printint+0x2a>
+ 747:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 74b:	79 11                	jns    75e <printint+0x2a>
+        neg = 1;
+ 74d:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+        x = -xx;
+ 754:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 757:	f7 d8                	neg    %eax
+ 759:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 75c:	eb 06                	jmp    764 <printint+0x30>
+    } else {
+        x = xx;
+ 75e:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 761:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    }
+
+    i = 0;
+ 764:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    do{
+        buf[i++] = digits[x % base];
+ 76b:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 76e:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 771:	ba 00 00 00 00       	mov    $0x0,%edx
+ 776:	f7 f1                	div    %ecx
+ 778:	89 d1                	mov    %edx,%ecx
+ 77a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 77d:	8d 50 01             	lea    0x1(%eax),%edx
+ 780:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 783:	0f b6 91 88 0e 00 00 	movzbl 0xe88(%ecx),%edx
+ 78a:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+    }while((x /= base) != 0);
+ 78e:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 791:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 794:	ba 00 00 00 00       	mov    $0x0,%edx
+ 799:	f7 f1                	div    %ecx
+ 79b:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 79e:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 7a2:	75 c7                	jne    76b <printint+0x37>
+    if(neg)
+ 7a4:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 7a8:	74 2d                	je     7d7 <printint+0xa3>
+        buf[i++] = '-';
+ 7aa:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 7ad:	8d 50 01             	lea    0x1(%eax),%edx
+ 7b0:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 7b3:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+    while(--i >= 0)
+ 7b8:	eb 1d                	jmp    7d7 <printint+0xa3>
+        putc(fd, buf[i]);
+ 7ba:	8d 55 dc             	lea    -0x24(%ebp),%edx
+ 7bd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 7c0:	01 d0                	add    %edx,%eax
+ 7c2:	0f b6 00             	movzbl (%eax),%eax
+ 7c5:	0f be c0             	movsbl %al,%eax
+ 7c8:	83 ec 08             	sub    $0x8,%esp
+ 7cb:	50                   	push   %eax
+ 7cc:	ff 75 08             	push   0x8(%ebp)
+ 7cf:	e8 3d ff ff ff       	call   711 <putc>
+ 7d4:	83 c4 10             	add    $0x10,%esp
+    while(--i >= 0)
+ 7d7:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+ 7db:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 7df:	79 d9                	jns    7ba <printint+0x86>
+}
+ 7e1:	90                   	nop
+ 7e2:	90                   	nop
+ 7e3:	c9                   	leave
+ 7e4:	c3                   	ret
+
+000007e5 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 7e5:	55                   	push   %ebp
+ 7e6:	89 e5                	mov    %esp,%ebp
+ 7e8:	83 ec 28             	sub    $0x28,%esp
+    char *s;
+    int c, i, state;
+    uint *ap;
+
+    state = 0;
+ 7eb:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+    ap = (uint*)(void*)&fmt + 1;
+ 7f2:	8d 45 0c             	lea    0xc(%ebp),%eax
+ 7f5:	83 c0 04             	add    $0x4,%eax
+ 7f8:	89 45 e8             	mov    %eax,-0x18(%ebp)
+    for(i = 0; fmt[i]; i++){
+ 7fb:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 802:	e9 59 01 00 00       	jmp    960 <printf+0x17b>
+        c = fmt[i] & 0xff;
+ 807:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 80a:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 80d:	01 d0                	add    %edx,%eax
+ 80f:	0f b6 00             	movzbl (%eax),%eax
+ 812:	0f be c0             	movsbl %al,%eax
+ 815:	25 ff 00 00 00       	and    $0xff,%eax
+ 81a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        if(state == 0){
+ 81d:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 821:	75 2c                	jne    84f <printf+0x6a>
+            if(c == '%'){
+ 823:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 827:	75 0c                	jne    835 <printf+0x50>
+                state = '%';
+ 829:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+ 830:	e9 27 01 00 00       	jmp    95c <printf+0x177>
+            } else {
+                putc(fd, c);
+ 835:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 838:	0f be c0             	movsbl %al,%eax
+ 83b:	83 ec 08             	sub    $0x8,%esp
+ 83e:	50                   	push   %eax
+ 83f:	ff 75 08             	push   0x8(%ebp)
+ 842:	e8 ca fe ff ff       	call   711 <putc>
+ 847:	83 c4 10             	add    $0x10,%esp
+ 84a:	e9 0d 01 00 00       	jmp    95c <printf+0x177>
+            }
+        } else if(state == '%'){
+ 84f:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+ 853:	0f 85 03 01 00 00    	jne    95c <printf+0x177>
+            if(c == 'd'){
+ 859:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+ 85d:	75 1e                	jne    87d <printf+0x98>
+                printint(fd, *ap, 10, 1);
+ 85f:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 862:	8b 00                	mov    (%eax),%eax
+ 864:	6a 01                	push   $0x1
+ 866:	6a 0a                	push   $0xa
+ 868:	50                   	push   %eax
+ 869:	ff 75 08             	push   0x8(%ebp)
+ 86c:	e8 c3 fe ff ff       	call   734 <printint>
+ 871:	83 c4 10             	add    $0x10,%esp
+                ap++;
+ 874:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 878:	e9 d8 00 00 00       	jmp    955 <printf+0x170>
+            } else if(c == 'x' || c == 'p'){
+ 87d:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+ 881:	74 06                	je     889 <printf+0xa4>
+ 883:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+ 887:	75 1e                	jne    8a7 <printf+0xc2>
+                printint(fd, *ap, 16, 0);
+ 889:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 88c:	8b 00                	mov    (%eax),%eax
+ 88e:	6a 00                	push   $0x0
+ 890:	6a 10                	push   $0x10
+ 892:	50                   	push   %eax
+ 893:	ff 75 08             	push   0x8(%ebp)
+ 896:	e8 99 fe ff ff       	call   734 <printint>
+ 89b:	83 c4 10             	add    $0x10,%esp
+                ap++;
+ 89e:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 8a2:	e9 ae 00 00 00       	jmp    955 <printf+0x170>
+            } else if(c == 's'){
+ 8a7:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+ 8ab:	75 43                	jne    8f0 <printf+0x10b>
+                s = (char*)*ap;
+ 8ad:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 8b0:	8b 00                	mov    (%eax),%eax
+ 8b2:	89 45 f4             	mov    %eax,-0xc(%ebp)
+                ap++;
+ 8b5:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+                if(s == 0)
+ 8b9:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 8bd:	75 25                	jne    8e4 <printf+0xff>
+                    s = "(null)";
+ 8bf:	c7 45 f4 13 0c 00 00 	movl   $0xc13,-0xc(%ebp)
+                while(*s != 0){
+ 8c6:	eb 1c                	jmp    8e4 <printf+0xff>
+                    putc(fd, *s);
+ 8c8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 8cb:	0f b6 00             	movzbl (%eax),%eax
+ 8ce:	0f be c0             	movsbl %al,%eax
+ 8d1:	83 ec 08             	sub    $0x8,%esp
+ 8d4:	50                   	push   %eax
+ 8d5:	ff 75 08             	push   0x8(%ebp)
+ 8d8:	e8 34 fe ff ff       	call   711 <putc>
+ 8dd:	83 c4 10             	add    $0x10,%esp
+                    s++;
+ 8e0:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+                while(*s != 0){
+ 8e4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 8e7:	0f b6 00             	movzbl (%eax),%eax
+ 8ea:	84 c0                	test   %al,%al
+ 8ec:	75 da                	jne    8c8 <printf+0xe3>
+ 8ee:	eb 65                	jmp    955 <printf+0x170>
+                }
+            } else if(c == 'c'){
+ 8f0:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+ 8f4:	75 1d                	jne    913 <printf+0x12e>
+                putc(fd, *ap);
+ 8f6:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 8f9:	8b 00                	mov    (%eax),%eax
+ 8fb:	0f be c0             	movsbl %al,%eax
+ 8fe:	83 ec 08             	sub    $0x8,%esp
+ 901:	50                   	push   %eax
+ 902:	ff 75 08             	push   0x8(%ebp)
+ 905:	e8 07 fe ff ff       	call   711 <putc>
+ 90a:	83 c4 10             	add    $0x10,%esp
+                ap++;
+ 90d:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 911:	eb 42                	jmp    955 <printf+0x170>
+            } else if(c == '%'){
+ 913:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 917:	75 17                	jne    930 <printf+0x14b>
+                putc(fd, c);
+ 919:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 91c:	0f be c0             	movsbl %al,%eax
+ 91f:	83 ec 08             	sub    $0x8,%esp
+ 922:	50                   	push   %eax
+ 923:	ff 75 08             	push   0x8(%ebp)
+ 926:	e8 e6 fd ff ff       	call   711 <putc>
+ 92b:	83 c4 10             	add    $0x10,%esp
+ 92e:	eb 25                	jmp    955 <printf+0x170>
+            } else {
+                // Unknown % sequence.    Print it to draw attention.
+                putc(fd, '%');
+ 930:	83 ec 08             	sub    $0x8,%esp
+ 933:	6a 25                	push   $0x25
+ 935:	ff 75 08             	push   0x8(%ebp)
+ 938:	e8 d4 fd ff ff       	call   711 <putc>
+ 93d:	83 c4 10             	add    $0x10,%esp
+                putc(fd, c);
+ 940:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 943:	0f be c0             	movsbl %al,%eax
+ 946:	83 ec 08             	sub    $0x8,%esp
+ 949:	50                   	push   %eax
+ 94a:	ff 75 08             	push   0x8(%ebp)
+ 94d:	e8 bf fd ff ff       	call   711 <putc>
+ 952:	83 c4 10             	add    $0x10,%esp
+            }
+            state = 0;
+ 955:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+    for(i = 0; fmt[i]; i++){
+ 95c:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ 960:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 963:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 966:	01 d0                	add    %edx,%eax
+ 968:	0f b6 00             	movzbl (%eax),%eax
+ 96b:	84 c0                	test   %al,%al
+ 96d:	0f 85 94 fe ff ff    	jne    807 <printf+0x22>
+        }
+    }
+}
+ 973:	90                   	nop
+ 974:	90                   	nop
+ 975:	c9                   	leave
+ 976:	c3                   	ret
+
+00000977 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 977:	55                   	push   %ebp
+ 978:	89 e5                	mov    %esp,%ebp
+ 97a:	83 ec 10             	sub    $0x10,%esp
+    Header *bp, *p;
+
+    bp = (Header*)ap - 1;
+ 97d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 980:	83 e8 08             	sub    $0x8,%eax
+ 983:	89 45 f8             	mov    %eax,-0x8(%ebp)
+    for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 986:	a1 a4 0e 00 00       	mov    0xea4,%eax
+ 98b:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 98e:	eb 24                	jmp    9b4 <free+0x3d>
+        if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 990:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 993:	8b 00                	mov    (%eax),%eax
+ 995:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 998:	72 12                	jb     9ac <free+0x35>
+ 99a:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 99d:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 9a0:	72 24                	jb     9c6 <free+0x4f>
+ 9a2:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 9a5:	8b 00                	mov    (%eax),%eax
+ 9a7:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 9aa:	72 1a                	jb     9c6 <free+0x4f>
+    for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 9ac:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 9af:	8b 00                	mov    (%eax),%eax
+ 9b1:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 9b4:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 9b7:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 9ba:	73 d4                	jae    990 <free+0x19>
+ 9bc:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 9bf:	8b 00                	mov    (%eax),%eax
+ 9c1:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 9c4:	73 ca                	jae    990 <free+0x19>
+            break;
+    if(bp + bp->s.size == p->s.ptr){
+ 9c6:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 9c9:	8b 40 04             	mov    0x4(%eax),%eax
+ 9cc:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 9d3:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 9d6:	01 c2                	add    %eax,%edx
+ 9d8:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 9db:	8b 00                	mov    (%eax),%eax
+ 9dd:	39 c2                	cmp    %eax,%edx
+ 9df:	75 24                	jne    a05 <free+0x8e>
+        bp->s.size += p->s.ptr->s.size;
+ 9e1:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 9e4:	8b 50 04             	mov    0x4(%eax),%edx
+ 9e7:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 9ea:	8b 00                	mov    (%eax),%eax
+ 9ec:	8b 40 04             	mov    0x4(%eax),%eax
+ 9ef:	01 c2                	add    %eax,%edx
+ 9f1:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 9f4:	89 50 04             	mov    %edx,0x4(%eax)
+        bp->s.ptr = p->s.ptr->s.ptr;
+ 9f7:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 9fa:	8b 00                	mov    (%eax),%eax
+ 9fc:	8b 10                	mov    (%eax),%edx
+ 9fe:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ a01:	89 10                	mov    %edx,(%eax)
+ a03:	eb 0a                	jmp    a0f <free+0x98>
+    } else
+        bp->s.ptr = p->s.ptr;
+ a05:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a08:	8b 10                	mov    (%eax),%edx
+ a0a:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ a0d:	89 10                	mov    %edx,(%eax)
+    if(p + p->s.size == bp){
+ a0f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a12:	8b 40 04             	mov    0x4(%eax),%eax
+ a15:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ a1c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a1f:	01 d0                	add    %edx,%eax
+ a21:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ a24:	75 20                	jne    a46 <free+0xcf>
+        p->s.size += bp->s.size;
+ a26:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a29:	8b 50 04             	mov    0x4(%eax),%edx
+ a2c:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ a2f:	8b 40 04             	mov    0x4(%eax),%eax
+ a32:	01 c2                	add    %eax,%edx
+ a34:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a37:	89 50 04             	mov    %edx,0x4(%eax)
+        p->s.ptr = bp->s.ptr;
+ a3a:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ a3d:	8b 10                	mov    (%eax),%edx
+ a3f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a42:	89 10                	mov    %edx,(%eax)
+ a44:	eb 08                	jmp    a4e <free+0xd7>
+    } else
+        p->s.ptr = bp;
+ a46:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a49:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ a4c:	89 10                	mov    %edx,(%eax)
+    freep = p;
+ a4e:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a51:	a3 a4 0e 00 00       	mov    %eax,0xea4
+}
+ a56:	90                   	nop
+ a57:	c9                   	leave
+ a58:	c3                   	ret
+
+00000a59 <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+ a59:	55                   	push   %ebp
+ a5a:	89 e5                	mov    %esp,%ebp
+ a5c:	83 ec 18             	sub    $0x18,%esp
+    char *p;
+    Header *hp;
+
+    if(nu < 4096)
+ a5f:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+ a66:	77 07                	ja     a6f <morecore+0x16>
+        nu = 4096;
+ a68:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+    p = sbrk(nu * sizeof(Header));
+ a6f:	8b 45 08             	mov    0x8(%ebp),%eax
+ a72:	c1 e0 03             	shl    $0x3,%eax
+ a75:	83 ec 0c             	sub    $0xc,%esp
+ a78:	50                   	push   %eax
+ a79:	e8 0a fb ff ff       	call   588 <sbrk>
+ a7e:	83 c4 10             	add    $0x10,%esp
+ a81:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p == (char*)-1)
+ a84:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+ a88:	75 07                	jne    a91 <morecore+0x38>
+        return 0;
+ a8a:	b8 00 00 00 00       	mov    $0x0,%eax
+ a8f:	eb 26                	jmp    ab7 <morecore+0x5e>
+    hp = (Header*)p;
+ a91:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a94:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    hp->s.size = nu;
+ a97:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ a9a:	8b 55 08             	mov    0x8(%ebp),%edx
+ a9d:	89 50 04             	mov    %edx,0x4(%eax)
+    free((void*)(hp + 1));
+ aa0:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ aa3:	83 c0 08             	add    $0x8,%eax
+ aa6:	83 ec 0c             	sub    $0xc,%esp
+ aa9:	50                   	push   %eax
+ aaa:	e8 c8 fe ff ff       	call   977 <free>
+ aaf:	83 c4 10             	add    $0x10,%esp
+    return freep;
+ ab2:	a1 a4 0e 00 00       	mov    0xea4,%eax
+}
+ ab7:	c9                   	leave
+ ab8:	c3                   	ret
+
+00000ab9 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ ab9:	55                   	push   %ebp
+ aba:	89 e5                	mov    %esp,%ebp
+ abc:	83 ec 18             	sub    $0x18,%esp
+    Header *p, *prevp;
+    uint nunits;
+
+    nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ abf:	8b 45 08             	mov    0x8(%ebp),%eax
+ ac2:	83 c0 07             	add    $0x7,%eax
+ ac5:	c1 e8 03             	shr    $0x3,%eax
+ ac8:	83 c0 01             	add    $0x1,%eax
+ acb:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    if((prevp = freep) == 0){
+ ace:	a1 a4 0e 00 00       	mov    0xea4,%eax
+ ad3:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ ad6:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ ada:	75 23                	jne    aff <malloc+0x46>
+        base.s.ptr = freep = prevp = &base;
+ adc:	c7 45 f0 9c 0e 00 00 	movl   $0xe9c,-0x10(%ebp)
+ ae3:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ ae6:	a3 a4 0e 00 00       	mov    %eax,0xea4
+ aeb:	a1 a4 0e 00 00       	mov    0xea4,%eax
+ af0:	a3 9c 0e 00 00       	mov    %eax,0xe9c
+        base.s.size = 0;
+ af5:	c7 05 a0 0e 00 00 00 	movl   $0x0,0xea0
+ afc:	00 00 00 
+    }
+    for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ aff:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ b02:	8b 00                	mov    (%eax),%eax
+ b04:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        if(p->s.size >= nunits){
+ b07:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b0a:	8b 40 04             	mov    0x4(%eax),%eax
+ b0d:	3b 45 ec             	cmp    -0x14(%ebp),%eax
+ b10:	72 4d                	jb     b5f <malloc+0xa6>
+            if(p->s.size == nunits)
+ b12:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b15:	8b 40 04             	mov    0x4(%eax),%eax
+ b18:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+ b1b:	75 0c                	jne    b29 <malloc+0x70>
+                prevp->s.ptr = p->s.ptr;
+ b1d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b20:	8b 10                	mov    (%eax),%edx
+ b22:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ b25:	89 10                	mov    %edx,(%eax)
+ b27:	eb 26                	jmp    b4f <malloc+0x96>
+            else {
+                p->s.size -= nunits;
+ b29:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b2c:	8b 40 04             	mov    0x4(%eax),%eax
+ b2f:	2b 45 ec             	sub    -0x14(%ebp),%eax
+ b32:	89 c2                	mov    %eax,%edx
+ b34:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b37:	89 50 04             	mov    %edx,0x4(%eax)
+                p += p->s.size;
+ b3a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b3d:	8b 40 04             	mov    0x4(%eax),%eax
+ b40:	c1 e0 03             	shl    $0x3,%eax
+ b43:	01 45 f4             	add    %eax,-0xc(%ebp)
+                p->s.size = nunits;
+ b46:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b49:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ b4c:	89 50 04             	mov    %edx,0x4(%eax)
+            }
+            freep = prevp;
+ b4f:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ b52:	a3 a4 0e 00 00       	mov    %eax,0xea4
+            return (void*)(p + 1);
+ b57:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b5a:	83 c0 08             	add    $0x8,%eax
+ b5d:	eb 3b                	jmp    b9a <malloc+0xe1>
+        }
+        if(p == freep)
+ b5f:	a1 a4 0e 00 00       	mov    0xea4,%eax
+ b64:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ b67:	75 1e                	jne    b87 <malloc+0xce>
+            if((p = morecore(nunits)) == 0)
+ b69:	83 ec 0c             	sub    $0xc,%esp
+ b6c:	ff 75 ec             	push   -0x14(%ebp)
+ b6f:	e8 e5 fe ff ff       	call   a59 <morecore>
+ b74:	83 c4 10             	add    $0x10,%esp
+ b77:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ b7a:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ b7e:	75 07                	jne    b87 <malloc+0xce>
+                return 0;
+ b80:	b8 00 00 00 00       	mov    $0x0,%eax
+ b85:	eb 13                	jmp    b9a <malloc+0xe1>
+    for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ b87:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b8a:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ b8d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b90:	8b 00                	mov    (%eax),%eax
+ b92:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        if(p->s.size >= nunits){
+ b95:	e9 6d ff ff ff       	jmp    b07 <malloc+0x4e>
+    }
+}
+ b9a:	c9                   	leave
+ b9b:	c3                   	ret
@@ -0,0 +1,59 @@
+// Pipe ping-pong benchmark: a parent and child bounce one byte
+// back and forth over two pipes, so every round trip is two
+// wakeups and two context switches.
+//
+//    pingpong [rounds]
+//
+// Pin it with taskset to one cpu to measure the switch itself.
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "date.h"
+
+int
+main(int argc, char *argv[])
+{
+    int i, n, pid, us, ping[2], pong[2];
+    struct timespec t0, t1;
+    char c;
+
+    n = 10000;
+    if(argc > 1)
+        n = atoi(argv[1]);
+    if(pipe(ping) < 0 || pipe(pong) < 0){
+        printf(2, "pingpong: pipe failed\n");
+        exit();
+    }
+
+    pid = fork();
+    if(pid < 0){
+        printf(2, "pingpong: fork failed\n");
+        exit();
+    }
+    if(pid == 0){
+        for(i = 0; i < n; i++){
+            if(read(ping[0], &c, 1) != 1)
+                break;
+            write(pong[1], &c, 1);
+        }
+        exit();
+    }
+
+    c = 'x';
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    for(i = 0; i < n; i++){
+        write(ping[1], &c, 1);
+        if(read(pong[0], &c, 1) != 1){
+            printf(2, "pingpong: read failed\n");
+            break;
+        }
+    }
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+    wait();
+
+    us = (t1.tv_sec - t0.tv_sec) * 1000000 + (t1.tv_nsec - t0.tv_nsec) / 1000;
+    printf(1, "pingpong: %d round trips in %d us, %d ns each\n",
+        i, us, i > 0 ? us * 10 / i * 100 : 0);
+    exit();
+}
@@ -2,9 +2,9 @@
 #include "defs.h"
 #include "param.h"
 #include "mmu.h"
+#include "spinlock.h"
 #include "proc.h"
 #include "fs.h"
-#include "spinlock.h"
 #include "sleeplock.h"
 #include "file.h"
 
@@ -74,6 +74,64 @@ pipeclose(struct pipe *p, int writable)
         release(&p->lock);
 }
 
+// Copy up to n bytes from addr into p, as many as fit, a run at
+// a time.    Caller must hold p->lock.    Return the number copied.
+static int
+pipecopyin(struct pipe *p, char *addr, int n)
+{
+    int i, m;
+
+    for(i = 0; i < n; i += m){
+        m = p->nread + PIPESIZE - p->nwrite;
+        if(m == 0)
+            break;
+        if(m > PIPESIZE - p->nwrite % PIPESIZE)
+            m = PIPESIZE - p->nwrite % PIPESIZE;
+        if(m > n - i)
+            m = n - i;
+        memmove(p->data + p->nwrite % PIPESIZE, addr + i, m);
+        p->nwrite += m;
+    }
+    return i;
+}
+
+// Copy up to n bytes out of p into addr, as many as are there.
+// Caller must hold p->lock.    Return the number copied.
+static int
+pipecopyout(struct pipe *p, char *addr, int n)
+{
+    int i, m;
+
+    for(i = 0; i < n; i += m){    //DOC: piperead-copy
+        m = p->nwrite - p->nread;
+        if(m == 0)
+            break;
+        if(m > PIPESIZE - p->nread % PIPESIZE)
+            m = PIPESIZE - p->nread % PIPESIZE;
+        if(m > n - i)
+            m = n - i;
+        memmove(addr + i, p->data + p->nread % PIPESIZE, m);
+        p->nread += m;
+    }
+    return i;
+}
+
+// Wait for room in p.    Caller must hold p->lock.
+// Return -1 if the read end is closed or the process is killed.
+static int
+pipewaitroom(struct pipe *p)
+{
+    while(p->nwrite == p->nread + PIPESIZE){    //DOC: pipewrite-full
+        if(p->readopen == 0 || myproc()->killed){
+            wakeone(&p->nwrite);    // pass on our wakeup
+            return -1;
+        }
+        wakeone(&p->nread);
+        sleep(&p->nwrite, &p->lock);    //DOC: pipewrite-sleep
+    }
+    return 0;
+}
+
 //PAGEBREAK: 40
 int
 pipewrite(struct pipe *p, char *addr, int n)
@@ -81,18 +139,17 @@ pipewrite(struct pipe *p, char *addr, int n)
     int i;
 
     acquire(&p->lock);
-    for(i = 0; i < n; i++){
-        while(p->nwrite == p->nread + PIPESIZE){    //DOC: pipewrite-full
-            if(p->readopen == 0 || myproc()->killed){
-                release(&p->lock);
-                return -1;
-            }
-            wakeup(&p->nread);
-            sleep(&p->nwrite, &p->lock);    //DOC: pipewrite-sleep
+    for(i = 0; i < n; i += pipecopyin(p, addr + i, n - i)){
+        if(pipewaitroom(p) < 0){
+            release(&p->lock);
+            return -1;
         }
-        p->data[p->nwrite++ % PIPESIZE] = addr[i];
     }
-    wakeup(&p->nread);    //DOC: pipewrite-wakeup1
+    // Readers and writers are woken one at a time; whoever
+    // leaves room or data behind wakes the next in line.
+    wakeone(&p->nread);    //DOC: pipewrite-wakeup1
+    if(p->nwrite != p->nread + PIPESIZE)
+        wakeone(&p->nwrite);
     release(&p->lock);
     return n;
 }
@@ -105,17 +162,51 @@ piperead(struct pipe *p, char *addr, int n)
     acquire(&p->lock);
     while(p->nread == p->nwrite && p->writeopen){    //DOC: pipe-empty
         if(myproc()->killed){
+            wakeone(&p->nread);    // pass on our wakeup
             release(&p->lock);
             return -1;
         }
         sleep(&p->nread, &p->lock); //DOC: piperead-sleep
     }
-    for(i = 0; i < n; i++){    //DOC: piperead-copy
-        if(p->nread == p->nwrite)
-            break;
-        addr[i] = p->data[p->nread++ % PIPESIZE];
-    }
-    wakeup(&p->nwrite);    //DOC: piperead-wakeup
+    i = pipecopyout(p, addr, n);
+    wakeone(&p->nwrite);    //DOC: piperead-wakeup
+    if(p->nread != p->nwrite)
+        wakeone(&p->nread);
+    release(&p->lock);
+    return i;
+}
+
+// For splicing into p from a source that must not be held while
+// sleeping: wait for room with pipewait(), then take the source's
+// locks and hand its data to pipeput(), which never sleeps.
+
+// Wait until p has room.    Return -1 if the read end is closed
+// or the process is killed, else 0.
+int
+pipewait(struct pipe *p)
+{
+    int r;
+
+    acquire(&p->lock);
+    if((r = pipewaitroom(p)) == 0)
+        wakeone(&p->nwrite);    // room may be left for the next writer
+    release(&p->lock);
+    return r;
+}
+
+// Copy as much of the n bytes at addr into p as fits right now.
+// Return the number copied.
+int
+pipeput(struct pipe *p, char *addr, int n)
+{
+    int i;
+
+    acquire(&p->lock);
+    i = pipecopyin(p, addr, n);
+    if(i > 0)
+        wakeone(&p->nread);
+    if(p->nwrite != p->nread + PIPESIZE)
+        wakeone(&p->nwrite);
     release(&p->lock);
     return i;
 }
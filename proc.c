@@ -4,26 +4,244 @@
 #include "memlayout.h"
 #include "mmu.h"
 #include "x86.h"
-#include "proc.h"
+#include "traps.h"
 #include "spinlock.h"
+#include "proc.h"
+#include "sched.h"
+
+// Locking:
+//    p->lock protects p->state, p->chan, p->killed and p->rqnext.
+//    It is held across swtch() into and out of the process.
+//    cpu->rq.lock protects that cpu's run queue.    Lock order is
+//    p->lock, then rq.lock.
+//    ptable.lock protects slot allocation, nextpid, the pid hash
+//    and the parent/child links used by wait() and exit().
+//    It is taken before p->lock.
+//    A wait queue's lock protects its list and the wqnext/wqprev
+//    links of the processes on it.    It is taken before p->lock.
+//    gtable.lock protects the share groups and is taken last.
+//
+// A process is on exactly one run queue while it is RUNNABLE and
+// not running; anything queued has completely switched out.
+// A process is on the wait queue for p->chan exactly while it is
+// SLEEPING.
+
+// The first NPROC procs are static; when they are all in use,
+// allocproc() carves more out of kalloc'd pages, up to MAXPROC.
+// Procs are never freed, only returned to the free list, so the
+// list of all procs only grows; it may be walked without a lock.
+#define NPIDHASH    64
+#define PIDHASH(pid)    ((uint)(pid) % NPIDHASH)
 
 struct {
     struct spinlock lock;
     struct proc proc[NPROC];
+    struct proc *all;                        // Every proc, through allnext
+    struct proc *free;                     // UNUSED procs, through freenext
+    struct proc *pidhash[NPIDHASH];    // Live procs by pid, through pidnext
+    int nproc;                                     // Procs made so far
 } ptable;
 
+// Sleeping processes, hashed by the channel they sleep on.
+// Each list is in the order the processes went to sleep.
+#define NWAITQ    64
+struct waitq {
+    struct spinlock lock;
+    struct proc *head;
+    struct proc *tail;
+};
+static struct waitq waitq[NWAITQ];
+
+struct {
+    struct spinlock lock;
+    struct group group[NGROUP];
+} gtable;
+
 static struct proc *initproc;
 
 int nextpid = 1;
 extern void forkret(void);
 extern void trapret(void);
 
-static void wakeup1(void *chan);
+// Multi-level feedback queue.    A process starts at the best level
+// its nice value allows, drops one level each time it runs for a
+// whole time slice, rises one level when it wakes from sleep, and
+// every BOOSTTICKS all processes are lifted back to their best level
+// so that CPU-bound work cannot starve.    Lower levels get longer
+// slices.    p->prio is changed only by the cpu running p, by
+// makerunnable() under p->lock, or under rq.lock while p is queued.
+#define BOOSTTICKS    100
+#define SLICE(prio)     (1 << (prio))
+#define PRIOCEIL(p)     ((p)->nice * NPRIO / (NICEMAX+1))
+
+// Proportional share.    Each time a process comes off a cpu it is
+// charged for the TSC cycles it ran: its pass advances by the cycles
+// times its stride, STRIDE1/weight, so a process of twice the weight
+// advances half as fast.    Within a level the smallest pass runs
+// next, and over time each process in a level gets cpu in proportion
+// to its weight.    A process joining a queue is lifted to the pass
+// of the queue's last pick so that sleeping does not bank credit.
+// A share group is charged the same way for every cycle any member
+// runs, and its members are ordered by the group's pass, so the
+// group gets the share of one process of its weight however many
+// members it has; among themselves members go by their own pass.
+#define STRIDE1         (1 << 20)
+#define PASSSHIFT     10
+
+// Real-time FIFO class.    A process with a non-zero p->rtprio
+// waits on rq.rthead, highest rtprio first and in arrival order
+// within a priority, and runs before any normal process.    The tick
+// does not take the cpu from it except for a higher rtprio, and on
+// waking it preempts a normal process at once.    As a safeguard, once
+// real-time work has had RTRUNTIME ticks of a cpu in a window of
+// RTPERIOD ticks, the cpu is throttled: normal processes queued on
+// it run first until the window ends.
+#define RTPERIOD        100
+#define RTRUNTIME        95
+
+// May p run on the cpu with index i?
+#define CANRUN(p, i)    (((p)->affinity >> (i)) & 1)
+
+// Make p a new UNUSED proc.    Caller must hold ptable.lock,
+// except during pinit().
+static void
+addslot(struct proc *p)
+{
+    initlock(&p->lock, "proc", 1);
+    p->state = UNUSED;
+    p->freenext = ptable.free;
+    ptable.free = p;
+    p->allnext = ptable.all;
+    __sync_synchronize();    // p is complete before lockless walkers see it
+    ptable.all = p;
+    ptable.nproc++;
+}
+
+// Add a page's worth of procs, unless there are MAXPROC already.
+// Caller must hold ptable.lock.
+static int
+growprocs(void)
+{
+    struct proc *p;
+    char *mem;
+
+    if(ptable.nproc >= MAXPROC || (mem = kalloc()) == 0)
+        return -1;
+    memset(mem, 0, PGSIZE);
+    for(p = (struct proc*)mem; p + 1 <= (struct proc*)(mem + PGSIZE); p++)
+        if(ptable.nproc < MAXPROC)
+            addslot(p);
+    return 0;
+}
+
+// Return the live process with the given pid, or 0.
+// Caller must hold ptable.lock.
+static struct proc*
+findproc(int pid)
+{
+    struct proc *p;
+
+    for(p = ptable.pidhash[PIDHASH(pid)]; p; p = p->pidnext)
+        if(p->pid == pid)
+            return p;
+    return 0;
+}
+
+// Return process pid, or the caller if pid is 0, with its
+// p->lock held; or 0 if there is no such process.
+static struct proc*
+lockpid(int pid)
+{
+    struct proc *p;
+
+    if(pid == 0)
+        pid = myproc()->pid;
+    acquire(&ptable.lock);
+    if((p = findproc(pid)) != 0)
+        acquire(&p->lock);
+    release(&ptable.lock);
+    return p;
+}
+
+// Return the share group gid, making it if need be, with a
+// reference for the caller; or 0 if all groups are in use.
+// Caller must hold gtable.lock.
+static struct group*
+groupget(int gid)
+{
+    struct group *g, *free;
+
+    free = 0;
+    for(g = gtable.group; g < &gtable.group[NGROUP]; g++){
+        if(g->gid == gid){
+            g->nref++;
+            return g;
+        }
+        if(free == 0 && g->gid == 0)
+            free = g;
+    }
+    if((g = free) == 0)
+        return 0;
+    g->gid = gid;
+    g->nref = 1;
+    g->weight = WEIGHT0;
+    g->pass = g->minpass = 0;
+    return g;
+}
+
+// Drop a reference to g, freeing it with the last.
+// Caller must hold gtable.lock.
+static void
+groupput(struct group *g)
+{
+    if(--g->nref == 0)
+        g->gid = 0;
+}
+
+// Take p out of the pid hash and put it on the free list.
+// Caller must hold ptable.lock.
+static void
+freeproc(struct proc *p)
+{
+    struct proc **pp;
+
+    if(p->grp){
+        acquire(&gtable.lock);
+        groupput(p->grp);
+        release(&gtable.lock);
+        p->grp = 0;
+    }
+
+    for(pp = &ptable.pidhash[PIDHASH(p->pid)]; *pp; pp = &(*pp)->pidnext){
+        if(*pp == p){
+            *pp = p->pidnext;
+            break;
+        }
+    }
+    p->pid = 0;
+    p->parent = 0;
+    p->state = UNUSED;
+    p->freenext = ptable.free;
+    ptable.free = p;
+}
 
 void
 pinit(void)
 {
+    struct proc *p;
+    struct cpu *c;
+    int i;
+
     initlock(&ptable.lock, "ptable", 1);
+    initlock(&gtable.lock, "gtable", 1);
+    for(p = &ptable.proc[NPROC-1]; p >= ptable.proc; p--)
+        addslot(p);
+    for(c = cpus; c < &cpus[NCPU]; c++)
+        initlock(&c->rq.lock, "runq", 1);
+    for(c = cpus; c < &cpus[NCPU]; c++)
+        initlock(&c->hrlock, "hrtimer", 1);
+    for(i = 0; i < NWAITQ; i++)
+        initlock(&waitq[i].lock, "waitq", 1);
 }
 
 // Must be called with interrupts disabled
@@ -65,6 +283,444 @@ myproc(void) {
     return p;
 }
 
+// Append p to the list for its level.    Caller must hold rq->lock.
+static void
+rqappend(struct runq *rq, struct proc *p)
+{
+    struct proc **pp;
+
+    if(p->rtprio){
+        for(pp = &rq->rthead; *pp && (*pp)->rtprio >= p->rtprio; pp = &(*pp)->rqnext)
+            ;
+        p->rqnext = *pp;
+        *pp = p;
+        return;
+    }
+    p->rqnext = 0;
+    if(rq->tail[p->prio])
+        rq->tail[p->prio]->rqnext = p;
+    else
+        rq->head[p->prio] = p;
+    rq->tail[p->prio] = p;
+}
+
+// If c is halted in idle(), wake it with a reschedule IPI.
+// Whoever clears c->idle sends the one IPI.
+static void
+kick(struct cpu *c)
+{
+    if(c != mycpu() && c->idle && xchg(&c->idle, 0))
+        lapicipi(c->apicid, T_IRQ0 + IRQ_RESCHED);
+}
+
+// Wake one idle cpu other than c, if there is one, so that it
+// can steal from c's queue.
+static void
+kickother(struct cpu *c)
+{
+    struct cpu *o;
+
+    for(o = cpus; o < &cpus[ncpu]; o++){
+        if(o != c && o->idle){
+            kick(o);
+            return;
+        }
+    }
+}
+
+// The rtprio of the process running on c, 0 if none or normal.
+// Reads without locks; the answer is only a hint.
+static int
+currtprio(struct cpu *c)
+{
+    struct proc *p = c->proc;
+
+    return p ? p->rtprio : 0;
+}
+
+// Make c give up its current process for a better one at its
+// next return from a trap.
+static void
+preempt(struct cpu *c)
+{
+    c->resched = 1;
+    if(c != mycpu())
+        lapicipi(c->apicid, T_IRQ0 + IRQ_RESCHED);
+}
+
+// The pass runqget() orders p by: its group's, if it has one.
+// Read without gtable.lock; a stale value only misorders a pick.
+static uint64
+rqpass(struct proc *p)
+{
+    return p->grp ? p->grp->pass : p->pass;
+}
+
+// Should runqget() prefer p to q, queued at the same level?
+static int
+rqbefore(struct proc *p, struct proc *q)
+{
+    if(p->grp && p->grp == q->grp)
+        return p->pass < q->pass;
+    return rqpass(p) < rqpass(q);
+}
+
+// Append p to c's run queue, and wake c if it is idle, or make
+// it switch if p outranks what it is running, or else wake another
+// idle cpu to take over the extra work.
+// Caller must hold p->lock.
+static void
+runqput(struct cpu *c, struct proc *p)
+{
+    struct group *g = p->grp;
+
+    p->queuedts = rdtsc();
+    acquire(&c->rq.lock);
+    if(g == 0){
+        if(p->pass < c->rq.minpass)
+            p->pass = c->rq.minpass;
+    } else {
+        acquire(&gtable.lock);
+        if(g->pass < c->rq.minpass)
+            g->pass = c->rq.minpass;
+        if(p->pass < g->minpass)
+            p->pass = g->minpass;
+        release(&gtable.lock);
+    }
+    rqappend(&c->rq, p);
+    c->rq.n++;
+    release(&c->rq.lock);
+    if(c->idle)
+        kick(c);
+    else if(p->rtprio > currtprio(c))
+        preempt(c);
+    else
+        kickother(c);
+}
+
+// Unlink and return the first real-time process queued on c that
+// may run on self, or 0.    Caller must hold c->rq.lock.
+static struct proc*
+rqtakert(struct cpu *c, struct cpu *self)
+{
+    struct proc **pp, *p;
+
+    for(pp = &c->rq.rthead; (p = *pp) != 0; pp = &p->rqnext){
+        if(CANRUN(p, self - cpus)){
+            *pp = p->rqnext;
+            p->rqnext = 0;
+            c->rq.n--;
+            return p;
+        }
+    }
+    return 0;
+}
+
+// Remove and return the first real-time process on c's run queue
+// allowed to run on cpu self; failing that, the process with the
+// smallest pass at the best level that holds one, ties going to
+// the process queued first; or 0 if there is none.    A throttled
+// self takes normal processes ahead of real-time ones.
+static struct proc*
+runqget(struct cpu *c, struct cpu *self)
+{
+    struct proc *p, *prev, *best, *bprev;
+    int i;
+
+    best = bprev = 0;
+    acquire(&c->rq.lock);
+    if(!self->rtthrottled && (best = rqtakert(c, self)) != 0){
+        release(&c->rq.lock);
+        return best;
+    }
+    for(i = 0; i < NPRIO; i++){
+        for(prev = 0, p = c->rq.head[i]; p; prev = p, p = p->rqnext){
+            if(!CANRUN(p, self - cpus))
+                continue;
+            if(best == 0 || rqbefore(p, best)){
+                best = p;
+                bprev = prev;
+            }
+        }
+        if(best == 0)
+            continue;
+        if(bprev)
+            bprev->rqnext = best->rqnext;
+        else
+            c->rq.head[i] = best->rqnext;
+        if(c->rq.tail[i] == best)
+            c->rq.tail[i] = bprev;
+        c->rq.n--;
+        if(rqpass(best) > c->rq.minpass)
+            c->rq.minpass = rqpass(best);
+        if(best->grp){
+            acquire(&gtable.lock);
+            if(best->pass > best->grp->minpass)
+                best->grp->minpass = best->pass;
+            release(&gtable.lock);
+        }
+        best->rqnext = 0;
+        break;
+    }
+    if(best == 0 && self->rtthrottled)
+        best = rqtakert(c, self);
+    release(&c->rq.lock);
+    return best;
+}
+
+// CPU time accounting.    p->lastts is when p's time was last
+// charged.    trap() calls acct() on entry, charging the time since
+// to user or system time by where the trap came from, and again on
+// its way back to user space; sched() charges system time up to the
+// switch and restarts the clock when p runs again.
+void
+acct(int user)
+{
+    struct proc *p;
+    uint64 now;
+
+    pushcli();
+    if((p = mycpu()->proc) != 0){
+        now = rdtsc();
+        if(user)
+            p->ru.utime += now - p->lastts;
+        else
+            p->ru.stime += now - p->lastts;
+        p->lastts = now;
+    }
+    popcli();
+}
+
+static void
+addusage(struct pusage *to, struct pusage *from)
+{
+    to->utime += from->utime;
+    to->stime += from->stime;
+    to->minflt += from->minflt;
+    to->majflt += from->majflt;
+    to->inblock += from->inblock;
+    to->oublock += from->oublock;
+    to->nvcsw += from->nvcsw;
+    to->nivcsw += from->nivcsw;
+}
+
+// Count an interval of d TSC cycles in log2 histogram h,
+// and raise *max to d if it is longer.    Only the cpu that owns
+// h updates it, with interrupts off.
+static void
+lathist(uint *h, uint64 *max, uint64 d)
+{
+    uint i;
+
+    if(d >> 32)
+        i = 32 + bsr(d >> 32);
+    else if(d)
+        i = bsr(d);
+    else
+        i = 0;
+    if(i >= NLATBUCKET)
+        i = NLATBUCKET-1;
+    h[i]++;
+    if(d > *max)
+        *max = d;
+}
+
+// Charge p, and its group, for cycles of cpu time.
+// Caller must hold p->lock.
+static void
+charge(struct proc *p, uint64 cycles)
+{
+    struct group *g = p->grp;
+
+    p->runtime += cycles;
+    p->pass += (cycles >> PASSSHIFT) * (STRIDE1 / p->weight);
+    if(g){
+        acquire(&gtable.lock);
+        g->pass += (cycles >> PASSSHIFT) * (STRIDE1 / g->weight);
+        release(&gtable.lock);
+    }
+}
+
+// Return the highest rtprio queued on c, or 0 if none.
+// Reads without the lock; the answer is only a hint.
+static int
+runqrt(struct cpu *c)
+{
+    struct proc *p = c->rq.rthead;
+
+    return p ? p->rtprio : 0;
+}
+
+// Return the best level with a process queued on c, or NPRIO.
+// Reads without the lock; the answer is only a hint.
+static int
+runqbest(struct cpu *c)
+{
+    int i;
+
+    for(i = 0; i < NPRIO; i++)
+        if(c->rq.head[i])
+            break;
+    return i;
+}
+
+// Lift every process queued on c back to the best level
+// its nice value allows.
+static void
+runqboost(struct cpu *c)
+{
+    struct proc *p, *next;
+    int i;
+
+    acquire(&c->rq.lock);
+    for(i = 1; i < NPRIO; i++){
+        p = c->rq.head[i];
+        c->rq.head[i] = c->rq.tail[i] = 0;
+        for(; p; p = next){
+            next = p->rqnext;
+            p->prio = PRIOCEIL(p);
+            p->sliceused = 0;
+            rqappend(&c->rq, p);
+        }
+    }
+    release(&c->rq.lock);
+}
+
+// Steal a process allowed to run on self from the busiest other
+// cpu, or failing that from any other cpu.
+// The queue lengths are read without locks; a stale answer
+// only means we try again on the next pass.
+static struct proc*
+runqsteal(struct cpu *self)
+{
+    struct cpu *c, *busiest;
+    struct proc *p;
+    int most;
+
+    busiest = 0;
+    most = 0;
+    for(c = cpus; c < &cpus[ncpu]; c++){
+        if(c != self && c->rq.n > most){
+            most = c->rq.n;
+            busiest = c;
+        }
+    }
+    if(busiest == 0)
+        return 0;
+    if((p = runqget(busiest, self)) != 0)
+        return p;
+    for(c = cpus; c < &cpus[ncpu]; c++)
+        if(c != self && c != busiest && c->rq.n > 0 && (p = runqget(c, self)) != 0)
+            return p;
+    return 0;
+}
+
+// Is there a process queued anywhere that self could run?
+static int
+runqwaiting(struct cpu *self)
+{
+    struct cpu *c;
+    struct proc *p;
+    int i, found;
+
+    if(self->rq.n > 0)
+        return 1;
+    found = 0;
+    for(c = cpus; c < &cpus[ncpu] && !found; c++){
+        if(c == self || c->rq.n == 0)
+            continue;
+        acquire(&c->rq.lock);
+        for(p = c->rq.rthead; p && !found; p = p->rqnext)
+            found = CANRUN(p, self - cpus);
+        for(i = 0; i < NPRIO && !found; i++)
+            for(p = c->rq.head[i]; p && !found; p = p->rqnext)
+                found = CANRUN(p, self - cpus);
+        release(&c->rq.lock);
+    }
+    return found;
+}
+
+// Return the wait queue for chan.
+static struct waitq*
+chanwaitq(void *chan)
+{
+    return &waitq[((uint)chan * 2654435761U) >> 26];    // NWAITQ == 64
+}
+
+// Append p to the tail of wq.    Caller must hold wq->lock.
+static void
+waitqput(struct waitq *wq, struct proc *p)
+{
+    p->wqnext = 0;
+    p->wqprev = wq->tail;
+    if(wq->tail)
+        wq->tail->wqnext = p;
+    else
+        wq->head = p;
+    wq->tail = p;
+}
+
+// Unlink p from wq.    Caller must hold wq->lock.
+static void
+waitqdel(struct waitq *wq, struct proc *p)
+{
+    if(p->wqprev)
+        p->wqprev->wqnext = p->wqnext;
+    else
+        wq->head = p->wqnext;
+    if(p->wqnext)
+        p->wqnext->wqprev = p->wqprev;
+    else
+        wq->tail = p->wqprev;
+    p->wqnext = p->wqprev = 0;
+}
+
+// Choose a cpu for p to wait on.    Prefer the cpu p last ran on,
+// whose cache may still hold its working set, if it is idle or
+// has no more waiting than self; then self; then whichever
+// allowed cpu has the fewest waiting.    A real-time process goes
+// where it can run soonest: the cpu it last ran on if that is not
+// running real-time work, else the allowed cpu running the least
+// important work.
+static struct cpu*
+pickcpu(struct proc *p, struct cpu *self)
+{
+    struct cpu *c, *best;
+
+    if(p->rtprio){
+        if(p->cpu >= 0 && p->cpu < ncpu && CANRUN(p, p->cpu) &&
+            currtprio(&cpus[p->cpu]) == 0)
+            return &cpus[p->cpu];
+        best = 0;
+        for(c = cpus; c < &cpus[ncpu]; c++)
+            if(CANRUN(p, c - cpus) && (best == 0 || currtprio(c) < currtprio(best)))
+                best = c;
+        return best;
+    }
+    if(p->cpu >= 0 && p->cpu < ncpu && CANRUN(p, p->cpu) &&
+        (cpus[p->cpu].idle || cpus[p->cpu].rq.n <= self->rq.n))
+        return &cpus[p->cpu];
+    if(CANRUN(p, self - cpus))
+        return self;
+    best = 0;
+    for(c = cpus; c < &cpus[ncpu]; c++)
+        if(CANRUN(p, c - cpus) && (best == 0 || c->rq.n < best->rq.n))
+            best = c;
+    return best;
+}
+
+// Make p RUNNABLE and queue it on the cpu pickcpu() chooses.
+// A process waking from sleep rises one level.
+// Caller must hold p->lock.
+static void
+makerunnable(struct proc *p)
+{
+    if(p->state == SLEEPING && p->prio > PRIOCEIL(p))
+        p->prio--;
+    p->state = RUNNABLE;
+    runqput(pickcpu(p, mycpu()), p);
+}
+
 //PAGEBREAK: 32
 // Look in the process table for an UNUSED proc.
 // If found, change state to EMBRYO and initialize
@@ -77,22 +733,24 @@ allocproc(void)
     char *sp;
 
     acquire(&ptable.lock);
-
-    for(p = ptable.proc; p < &ptable.proc[NPROC]; p++)
-        if(p->state == UNUSED)
-            goto found;
-
-    release(&ptable.lock);
-    return 0;
-
-found:
+    if(ptable.free == 0 && growprocs() < 0){
+        release(&ptable.lock);
+        return 0;
+    }
+    p = ptable.free;
+    ptable.free = p->freenext;
     p->state = EMBRYO;
     p->pid = nextpid++;
-
+    p->pidnext = ptable.pidhash[PIDHASH(p->pid)];
+    ptable.pidhash[PIDHASH(p->pid)] = p;
+    p->parent = p->child = p->sibling = 0;
     release(&ptable.lock);
+
     // Allocate kernel stack.
     if((p->kstack = kalloc()) == 0){
-        p->state = UNUSED;
+        acquire(&ptable.lock);
+        freeproc(p);
+        release(&ptable.lock);
         return 0;
     }
     p->text_data.start =  p->text_data.sz = 0;
@@ -100,7 +758,24 @@ found:
     p->heap = p->text_data;
     p->alarmhandler = 0;
     p->inalarmhandler = 0;
-    p->alarmticks = p->alarmticksleft = 0;
+    p->alarmticks = p->alarmpending = 0;
+    p->sleeptimer.pprev = p->alarmtimer.pprev = 0;
+    p->hrtimer.cpu = -1;
+    p->uffd = 0;
+    p->sysstat = 0;
+    p->straced = 0;
+    p->cpu = -1;
+    p->affinity = ~0;
+    p->nice = 0;
+    p->prio = 0;
+    p->sliceused = 0;
+    p->weight = WEIGHT0;
+    p->grp = 0;
+    p->rtprio = 0;
+    p->pass = 0;
+    p->runtime = 0;
+    memset(&p->ru, 0, sizeof(p->ru));
+    memset(&p->cru, 0, sizeof(p->cru));
     sp = p->kstack + KSTACKSIZE;
 
     // Leave room for trap frame.
@@ -134,6 +809,8 @@ userinit(void)
     if((p->pgdir = copykvm()) == 0)
         panic("userinit: out of memory?");
     inituvm(p->pgdir, _binary_initcode_start, (int)_binary_initcode_size);
+    if(vdsomap(p->pgdir, p->pid) < 0)
+        panic("userinit: out of memory?");
     p->stack.start = 0;
     p->stack.sz = PGSIZE;
     p->text_data = p->heap = p->stack;
@@ -153,13 +830,39 @@ userinit(void)
     // run this process. the acquire forces the above
     // writes to be visible, and the lock is also needed
     // because the assignment might not be atomic.
-    acquire(&ptable.lock);
+    acquire(&p->lock);
 
-    p->state = RUNNABLE;
+    makerunnable(p);
 
-    release(&ptable.lock);
+    release(&p->lock);
 }
 
+// Start a kernel process running fn, which must never return.
+// It has no user memory and never leaves the kernel.
+struct proc*
+kproc(char *name, void (*fn)(void))
+{
+    struct proc *p;
+
+    if((p = allocproc()) == 0)
+        return 0;
+    if((p->pgdir = copykvm()) == 0){
+        kfree(p->kstack);
+        p->kstack = 0;
+        acquire(&ptable.lock);
+        freeproc(p);
+        release(&ptable.lock);
+        return 0;
+    }
+    // Have forkret() return to fn rather than trapret.
+    *(uint*)(p->context + 1) = (uint)fn;
+    safestrcpy(p->name, name, sizeof(p->name));
+
+    acquire(&p->lock);
+    makerunnable(p);
+    release(&p->lock);
+    return p;
+}
 
 // Create a new process copying p as the parent.
 // Sets up stack to return as if from system call.
@@ -177,16 +880,20 @@ fork(void)
     }
 
     // Copy process state from proc.
-    if((np->pgdir = copyuvm(curproc)) == 0){
+    if((np->pgdir = copyuvm(curproc)) == 0 || vdsomap(np->pgdir, np->pid) < 0){
+        if(np->pgdir)
+            freevm(np->pgdir);
+        np->pgdir = 0;
         kfree(np->kstack);
         np->kstack = 0;
-        np->state = UNUSED;
+        acquire(&ptable.lock);
+        freeproc(np);
+        release(&ptable.lock);
         return -1;
     }
     np->text_data = curproc->text_data;
     np->stack = curproc->stack;
     np->heap = curproc->heap;
-    np->parent = curproc;
     *np->tf = *curproc->tf;
 
     // Clear %eax so that fork returns 0 in the child.
@@ -199,13 +906,35 @@ fork(void)
 
     safestrcpy(np->name, curproc->name, sizeof(curproc->name));
 
+    np->nice = curproc->nice;
+    np->prio = PRIOCEIL(np);
+    np->weight = curproc->weight;
+    np->affinity = curproc->affinity;
+    if(curproc->grp){
+        acquire(&gtable.lock);
+        curproc->grp->nref++;
+        np->grp = curproc->grp;
+        release(&gtable.lock);
+    }
+    np->rtprio = curproc->rtprio;
+    if(curproc->straced){
+        np->straced = 1;
+        stracecount(1);
+    }
+
     pid = np->pid;
 
     acquire(&ptable.lock);
+    np->parent = curproc;
+    np->sibling = curproc->child;
+    curproc->child = np;
+    release(&ptable.lock);
 
-    np->state = RUNNABLE;
+    acquire(&np->lock);
 
-    release(&ptable.lock);
+    makerunnable(np);
+
+    release(&np->lock);
 
     lcr3(V2P(curproc->pgdir)); 
     return pid;
@@ -224,6 +953,15 @@ exit(void)
     if(curproc == initproc)
         panic("init exiting");
 
+    if(curproc->uffd)
+        uffddetach(curproc);
+    setstrace(0, 0);
+
+    // Take the alarm off the timer queue before the slot is reused.
+    acquire(&tickslock);
+    timerdel(&curproc->alarmtimer);
+    release(&tickslock);
+
     // Close all open files.
     for(fd = 0; fd < NOFILE; fd++){
         if(curproc->ofile[fd]){
@@ -240,19 +978,25 @@ exit(void)
     acquire(&ptable.lock);
 
     // Parent might be sleeping in wait().
-    wakeup1(curproc->parent);
+    wakeup(curproc->parent);
 
     // Pass abandoned children to init.
-    for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
-        if(p->parent == curproc){
-            p->parent = initproc;
-            if(p->state == ZOMBIE)
-                wakeup1(initproc);
-        }
+    // A child only becomes ZOMBIE while holding ptable.lock.
+    while((p = curproc->child) != 0){
+        curproc->child = p->sibling;
+        p->parent = initproc;
+        p->sibling = initproc->child;
+        initproc->child = p;
+        if(p->state == ZOMBIE)
+            wakeup(initproc);
     }
 
     // Jump into the scheduler, never to return.
+    // The parent cannot reap us until the scheduler releases
+    // curproc->lock, after we have left this stack for good.
+    acquire(&curproc->lock);
     curproc->state = ZOMBIE;
+    release(&ptable.lock);
     sched();
     panic("zombie exit");
 }
@@ -265,32 +1009,41 @@ exit(void)
 int
 wait(void)
 {
-    struct proc *p;
-    int havekids, pid;
+    struct proc *p, **pp;
+    int havekids, pid, traced;
     struct proc *curproc = myproc();
     
     acquire(&ptable.lock);
     for(;;){
-        // Scan through table looking for exited children.
-        havekids = 0;
-        for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
-            if(p->parent != curproc)
-                continue;
-            havekids = 1;
+        // Scan through our children looking for exited ones.
+        havekids = curproc->child != 0;
+        for(pp = &curproc->child; (p = *pp) != 0; pp = &p->sibling){
+            acquire(&p->lock);
             if(p->state == ZOMBIE){
                 // Found one.
+                *pp = p->sibling;
                 pid = p->pid;
+                addusage(&curproc->cru, &p->ru);
+                addusage(&curproc->cru, &p->cru);
                 kfree(p->kstack);
                 p->kstack = 0;
                 freevm(p->pgdir);
-                p->pid = 0;
-                p->parent = 0;
+                if(p->sysstat)
+                    kfree((char*)p->sysstat);
+                p->sysstat = 0;
+                // Traced after exit() stopped its tracing.
+                traced = p->straced;
+                p->straced = 0;
                 p->name[0] = 0;
                 p->killed = 0;
-                p->state = UNUSED;
+                freeproc(p);
+                release(&p->lock);
                 release(&ptable.lock);
+                if(traced)
+                    stracecount(-1);
                 return pid;
             }
+            release(&p->lock);
         }
 
         // No point waiting if we don't have any children.
@@ -304,14 +1057,74 @@ wait(void)
     }
 }
 
+// Nothing to run: halt until an interrupt arrives.    Cpus other
+// than cpu 0, which keeps ticks, also stop their periodic tick and
+// wake only for hrtimers; runqput() wakes them with a reschedule
+// IPI when there is work.
+// Called with interrupts enabled, returns with them enabled.
+static void
+idle(struct cpu *c)
+{
+    cli();
+    // Publish idle before the last look at the queues: a waker
+    // queues then checks idle, so one of us sees the other.
+    xchg(&c->idle, 1);
+    if(runqwaiting(c)){
+        c->idle = 0;
+        sti();
+        return;
+    }
+    c->nidle++;
+    if(c != &cpus[0])
+        hrtickstop(1);
+    stihlt();
+    cli();
+    c->idle = 0;
+    if(c != &cpus[0])
+        hrtickstop(0);
+    sti();
+}
+
+// Make p, which the caller has taken off a run queue and locked,
+// the process running on c, ready to swtch() to.
+static void
+switchin(struct cpu *c, struct proc *p)
+{
+    if(p->state != RUNNABLE)
+        panic("switchin: queued proc not runnable");
+    c->proc = p;
+    c->resched = 0;
+    p->cpu = c - cpus;
+    switchuvm(p);
+    p->state = RUNNING;
+    c->switchts = rdtsc();
+    lathist(c->waithist, &c->maxwait, c->switchts - p->queuedts);
+}
+
+// Complete a switch away from c->prev now that this cpu is off
+// its stack, by releasing the lock its sched() held.
+static void
+finishswitch(void)
+{
+    struct cpu *c = mycpu();
+    struct proc *prev = c->prev;
+
+    if(prev){
+        c->prev = 0;
+        release(&prev->lock);
+    }
+}
+
 //PAGEBREAK: 42
 // Per-CPU process scheduler.
 // Each CPU calls scheduler() after setting itself up.
 // Scheduler never returns.    It loops, doing:
-//    - choose a process to run
+//    - take a process from this cpu's run queue,
+//      or steal one from the busiest other cpu
 //    - swtch to start running that process
-//    - eventually that process transfers control
-//            via swtch back to the scheduler.
+//    - eventually that process, or another one it switched
+//      to directly, transfers control via swtch back to the
+//      scheduler.
 void
 scheduler(void)
 {
@@ -323,46 +1136,52 @@ scheduler(void)
         // Enable interrupts on this processor.
         sti();
 
-        // Loop over process table looking for process to run.
-        acquire(&ptable.lock);
-        for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
-            if(p->state != RUNNABLE)
-                continue;
-
-            // Switch to chosen process.    It is the process's job
-            // to release ptable.lock and then reacquire it
-            // before jumping back to us.
-            c->proc = p;
-            switchuvm(p);
-            p->state = RUNNING;
-
-            swtch(&(c->scheduler), p->context);
-            switchkvm();
-
-            // Process is done running for now.
-            // It should have changed its p->state before coming back.
-            c->proc = 0;
+        p = 0;
+        if(c->rq.n > 0)
+            p = runqget(c, c);
+        if(p == 0 && (p = runqsteal(c)) == 0){
+            idle(c);
+            continue;
         }
-        release(&ptable.lock);
 
+        // Switch to chosen process.    It is the process's job
+        // to release p->lock and then reacquire it
+        // before jumping back to us.
+        acquire(&p->lock);
+        switchin(c, p);
+        swtch(&(c->scheduler), p->context);
+
+        // Whichever process came back has queued itself if it
+        // is still runnable.    Leave its page table before letting
+        // go of it: once unlocked, an exited one may be freed.
+        switchkvm();
+        c->proc = 0;
+        finishswitch();
     }
 }
 
-// Enter scheduler.    Must hold only ptable.lock
+// Enter scheduler.    Must hold only p->lock
 // and have changed proc->state. Saves and restores
 // intena because intena is a property of this
 // kernel thread, not this CPU. It should
 // be proc->intena and proc->ncli, but that would
 // break in the few places where a lock is held but
 // there's no process.
+//
+// If another process is queued on this cpu, switch straight
+// to it rather than through the scheduler and the kernel page
+// table.    p->lock stays held until the next process, or the
+// scheduler, calls finishswitch().
 void
 sched(void)
 {
     int intena;
-    struct proc *p = myproc();
+    struct proc *p = myproc(), *next;
+    struct cpu *c;
+    uint64 now;
 
-    if(!holding(&ptable.lock))
-        panic("sched ptable.lock");
+    if(!holding(&p->lock))
+        panic("sched p->lock");
     if(mycpu()->ncli != 1)
         panic("sched locks");
     if(p->state == RUNNING)
@@ -370,18 +1189,125 @@ sched(void)
     if(readeflags()&FL_IF)
         panic("sched interruptible");
     intena = mycpu()->intena;
-    swtch(&p->context, mycpu()->scheduler);
+    acct(0);
+    c = mycpu();
+    now = rdtsc();
+    lathist(c->slicehist, &c->maxslice, now - c->switchts);
+    charge(p, now - c->switchts);
+
+    // A yielding p goes to the back of our queue now, unless its
+    // affinity changed to exclude us; a cpu that takes it waits
+    // on p->lock until we are off p's stack.    Only take the next
+    // process from our own queue, and only while p is on no other
+    // cpu's queue: two cpus each holding one proc lock and waiting
+    // for the other's must not happen.
+    next = 0;
+    if(p->state == RUNNABLE && !CANRUN(p, c - cpus))
+        runqput(pickcpu(p, c), p);
+    else {
+        if(p->state == RUNNABLE)
+            runqput(c, p);
+        if(c->rq.n > 0)
+            next = runqget(c, c);
+    }
+    if(next == p){
+        // Still the best here: no need to switch.
+        p->state = RUNNING;
+        c->resched = 0;
+        c->switchts = rdtsc();
+        return;
+    }
+
+    c->prev = p;
+    if(next){
+        acquire(&next->lock);
+        switchin(c, next);
+        swtch(&p->context, next->context);
+    } else
+        swtch(&p->context, c->scheduler);
+    finishswitch();
+    p->lastts = rdtsc();
     mycpu()->intena = intena;
 }
 
+// Called on each timer interrupt that finds a process running
+// on this cpu; tick says whether a periodic tick was due or only
+// hrtimers.    Charges a tick to the process and returns 1 if it
+// should yield: it has used up its time slice, in which case it
+// drops a level, or a better-level process is waiting here.
+// A real-time process yields only to a higher rtprio, or to normal
+// processes once the cpu is throttled.
+int
+schedtick(int tick)
+{
+    struct cpu *c;
+    struct proc *p;
+    int r;
+
+    pushcli();
+    c = mycpu();
+    p = c->proc;
+    if(tick){
+        if(ticks - c->rtstart >= RTPERIOD){
+            c->rtstart = ticks;
+            c->rtused = 0;
+            c->rtthrottled = 0;
+        }
+        if(p->rtprio && ++c->rtused >= RTRUNTIME)
+            c->rtthrottled = 1;
+    }
+    if(p->rtprio){
+        r = runqrt(c) > p->rtprio ||
+            (c->rtthrottled && runqbest(c) < NPRIO);
+        popcli();
+        return r;
+    }
+    if(ticks - c->lastboost >= BOOSTTICKS){
+        c->lastboost = ticks;
+        runqboost(c);
+        p->prio = PRIOCEIL(p);
+        p->sliceused = 0;
+    }
+    // setpriority() may have raised nice since we last looked.
+    if(p->prio < PRIOCEIL(p))
+        p->prio = PRIOCEIL(p);
+
+    r = 0;
+    if(tick && ++p->sliceused >= SLICE(p->prio)){
+        if(p->prio < NPRIO-1)
+            p->prio++;
+        p->sliceused = 0;
+        r = 1;
+    } else if(runqbest(c) < p->prio || (runqrt(c) && !c->rtthrottled))
+        r = 1;
+    popcli();
+    return r;
+}
+
+// Has a better process been queued for this cpu since the
+// current one was switched to?    Clears the request.
+int
+needresched(void)
+{
+    int r;
+
+    pushcli();
+    r = xchg(&mycpu()->resched, 0);
+    popcli();
+    return r;
+}
+
 // Give up the CPU for one scheduling round.
 void
 yield(void)
 {
-    acquire(&ptable.lock);    //DOC: yieldlock
-    myproc()->state = RUNNABLE;
+    struct proc *p = myproc();
+
+    acquire(&p->lock);    //DOC: yieldlock
+    p->state = RUNNABLE;
+    p->ru.nivcsw++;
     sched();
-    release(&ptable.lock);
+    release(&p->lock);
 }
 
 // A fork child's very first scheduling by scheduler()
@@ -390,8 +1316,11 @@ void
 forkret(void)
 {
     static int first = 1;
-    // Still holding ptable.lock from scheduler.
-    release(&ptable.lock);
+    // Still holding p->lock from scheduler or sched(),
+    // and the previous process's lock if sched() switched here.
+    finishswitch();
+    myproc()->lastts = rdtsc();
+    release(&myproc()->lock);
 
     if (first) {
         // Some initialization functions must be run in the context
@@ -411,6 +1340,7 @@ void
 sleep(void *chan, struct spinlock *lk)
 {
     struct proc *p = myproc();
+    struct waitq *wq;
     
     if(p == 0)
         panic("sleep");
@@ -418,19 +1348,21 @@ sleep(void *chan, struct spinlock *lk)
     if(lk == 0)
         panic("sleep without lk");
 
-    // Must acquire ptable.lock in order to
+    // Must acquire p->lock in order to
     // change p->state and then call sched.
-    // Once we hold ptable.lock, we can be
-    // guaranteed that we won't miss any wakeup
-    // (wakeup runs with ptable.lock locked),
-    // so it's okay to release lk.
-    if(lk != &ptable.lock){    //DOC: sleeplock0
-        acquire(&ptable.lock);    //DOC: sleeplock1
-        release(lk);
-    }
-    // Go to sleep.
+    // We join chan's wait queue and mark ourselves
+    // SLEEPING before releasing lk, so a waker holding
+    // lk always finds us there, and we cannot miss
+    // its wakeup.
+    wq = chanwaitq(chan);
+    acquire(&wq->lock);
+    acquire(&p->lock);    //DOC: sleeplock1
     p->chan = chan;
     p->state = SLEEPING;
+    waitqput(wq, p);
+    release(&wq->lock);
+    release(lk);
+    p->ru.nvcsw++;
 
     sched();
 
@@ -438,32 +1370,80 @@ sleep(void *chan, struct spinlock *lk)
     p->chan = 0;
 
     // Reacquire original lock.
-    if(lk != &ptable.lock){    //DOC: sleeplock2
-        release(&ptable.lock);
-        acquire(lk);
-    }
+    release(&p->lock);    //DOC: sleeplock2
+    acquire(lk);
 }
 
 //PAGEBREAK!
-// Wake up all processes sleeping on chan.
-// The ptable lock must be held.
+// Wake processes sleeping on chan: all of them, or if one
+// is set only the one that has waited longest.
+// Callers hold the lock that sleepers passed to sleep(),
+// so a sleeper is already queued by the time we look,
+// and the unlocked test below cannot miss it.
 static void
-wakeup1(void *chan)
+wakeupn(void *chan, int one)
 {
-    struct proc *p;
-
-    for(p = ptable.proc; p < &ptable.proc[NPROC]; p++)
-        if(p->state == SLEEPING && p->chan == chan)
-            p->state = RUNNABLE;
+    struct waitq *wq = chanwaitq(chan);
+    struct proc *p, *next;
+
+    if(wq->head == 0)
+        return;
+    acquire(&wq->lock);
+    for(p = wq->head; p; p = next){
+        next = p->wqnext;
+        if(p->chan != chan)
+            continue;
+        waitqdel(wq, p);
+        acquire(&p->lock);
+        makerunnable(p);
+        release(&p->lock);
+        if(one)
+            break;
+    }
+    release(&wq->lock);
 }
 
 // Wake up all processes sleeping on chan.
 void
 wakeup(void *chan)
 {
-    acquire(&ptable.lock);
-    wakeup1(chan);
-    release(&ptable.lock);
+    wakeupn(chan, 0);
+}
+
+// Wake up the process that has slept longest on chan.
+// For waiters that each consume what the waker made
+// available, so only one of them can make progress.
+void
+wakeone(void *chan)
+{
+    wakeupn(chan, 1);
+}
+
+// Wake p if it is sleeping, whatever it sleeps on.
+// p's state and chan are read without p->lock to find the
+// queue, and checked again once we hold the locks.
+static void
+wakeproc(struct proc *p)
+{
+    struct waitq *wq;
+    void *chan;
+
+    for(;;){
+        if(p->state != SLEEPING || (chan = p->chan) == 0)
+            return;
+        wq = chanwaitq(chan);
+        acquire(&wq->lock);
+        acquire(&p->lock);
+        if(p->state == SLEEPING && p->chan == chan){
+            waitqdel(wq, p);
+            makerunnable(p);
+            release(&p->lock);
+            release(&wq->lock);
+            return;
+        }
+        release(&p->lock);
+        release(&wq->lock);
+    }
 }
 
 // Kill the process with the given pid.
@@ -475,20 +1455,295 @@ kill(int pid)
     struct proc *p;
 
     acquire(&ptable.lock);
-    for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
-        if(p->pid == pid){
-            p->killed = 1;
-            // Wake process from sleep if necessary.
-            if(p->state == SLEEPING)
-                p->state = RUNNABLE;
-            release(&ptable.lock);
+    if((p = findproc(pid)) == 0){
+        release(&ptable.lock);
+        return -1;
+    }
+    acquire(&p->lock);
+    p->killed = 1;
+    release(&p->lock);
+    // Wake process from sleep if necessary.
+    // Holding ptable.lock keeps p from being reused meanwhile.
+    wakeproc(p);
+    release(&ptable.lock);
+    return 0;
+}
+
+// Set the nice value of process pid, or of the caller if pid is 0.
+int
+setpriority(int pid, int nice)
+{
+    struct proc *p;
+
+    if(nice < 0 || nice > NICEMAX)
+        return -1;
+    if((p = lockpid(pid)) == 0)
+        return -1;
+    p->nice = nice;
+    release(&p->lock);
+    return 0;
+}
+
+// Return the nice value of process pid, or of the caller if pid is 0.
+int
+getpriority(int pid)
+{
+    struct proc *p;
+    int nice;
+
+    if((p = lockpid(pid)) == 0)
+        return -1;
+    nice = p->nice;
+    release(&p->lock);
+    return nice;
+}
+
+// Set the scheduling policy and real-time priority of process pid,
+// or of the caller if pid is 0.    A queued process moves to its new
+// class the next time it is queued.
+int
+setscheduler(int pid, int policy, int prio)
+{
+    struct proc *p, *curproc = myproc();
+
+    if(policy == SCHED_OTHER ? prio != 0 :
+       policy != SCHED_FIFO || prio < 1 || prio > SCHED_PRIOMAX)
+        return -1;
+    if((p = lockpid(pid)) == 0)
+        return -1;
+    p->rtprio = prio;
+    release(&p->lock);
+    if(p == curproc)
+        yield();    // a waiting process may now outrank us
+    return 0;
+}
+
+// Return the scheduling policy of process pid, or of the caller
+// if pid is 0.
+int
+getscheduler(int pid)
+{
+    struct proc *p;
+    int policy;
+
+    if((p = lockpid(pid)) == 0)
+        return -1;
+    policy = p->rtprio ? SCHED_FIFO : SCHED_OTHER;
+    release(&p->lock);
+    return policy;
+}
+
+// Return the real-time priority of process pid, or of the caller
+// if pid is 0; 0 for a normal process.
+int
+getrtprio(int pid)
+{
+    struct proc *p;
+    int prio;
+
+    if((p = lockpid(pid)) == 0)
+        return -1;
+    prio = p->rtprio;
+    release(&p->lock);
+    return prio;
+}
+
+// Restrict process pid, or the caller if pid is 0, to the cpus
+// whose bits are set in mask.    A process running or queued
+// elsewhere moves the next time it yields or is stolen; the
+// caller moves at once.
+int
+setaffinity(int pid, uint mask)
+{
+    struct proc *p, *curproc = myproc();
+
+    if(ncpu < 32)
+        mask &= (1 << ncpu) - 1;
+    if(mask == 0)
+        return -1;
+    if((p = lockpid(pid)) == 0)
+        return -1;
+    p->affinity = mask;
+    release(&p->lock);
+    if(p == curproc){
+        pushcli();
+        if(!CANRUN(curproc, cpuid())){
+            popcli();
+            yield();
+        } else
+            popcli();
+    }
+    return 0;
+}
+
+// Return the affinity mask of process pid, or of the caller
+// if pid is 0.
+int
+getaffinity(int pid)
+{
+    struct proc *p;
+    int mask;
+
+    if((p = lockpid(pid)) == 0)
+        return -1;
+    mask = p->affinity;
+    if(ncpu < 32)
+        mask &= (1 << ncpu) - 1;
+    release(&p->lock);
+    return mask;
+}
+
+// Start or stop tracing the system calls of process pid, or of
+// the caller if pid is 0.
+int
+setstrace(int pid, int on)
+{
+    struct proc *p;
+    int changed;
+
+    if((p = lockpid(pid)) == 0)
+        return -1;
+    on = on != 0;
+    changed = p->straced != on && (!on || p->state != ZOMBIE);
+    if(changed)
+        p->straced = on;
+    release(&p->lock);
+    // Not under p->lock, which waking the tracer may need.
+    if(changed)
+        stracecount(on ? 1 : -1);
+    return 0;
+}
+
+// Copy the system call counts of process pid, or of the caller if
+// pid is 0, to page unless it is 0, then zero them if reset is set.
+// A process with no counts leaves page alone.
+int
+syscounts(int pid, char *page, int reset)
+{
+    struct proc *p;
+
+    if((p = lockpid(pid)) == 0)
+        return -1;
+    if(p->sysstat){
+        if(page)
+            memmove(page, p->sysstat, PGSIZE);
+        if(reset)
+            memset(p->sysstat, 0, PGSIZE);
+    }
+    release(&p->lock);
+    return 0;
+}
+
+// Set the share weight of process pid, of the caller if pid is 0,
+// or of group -pid if pid is negative.    A process in a group has
+// its weight only against the other members.
+int
+setweight(int pid, int weight)
+{
+    struct proc *p;
+    struct group *g;
+
+    if(weight < 1 || weight > WEIGHTMAX)
+        return -1;
+    if(pid >= 0){
+        if((p = lockpid(pid)) == 0)
+            return -1;
+        p->weight = weight;
+        release(&p->lock);
+        return 0;
+    }
+    acquire(&gtable.lock);
+    for(g = gtable.group; g < &gtable.group[NGROUP]; g++){
+        if(g->gid == -pid){
+            g->weight = weight;
+            release(&gtable.lock);
             return 0;
         }
     }
-    release(&ptable.lock);
+    release(&gtable.lock);
     return -1;
 }
 
+// Move the caller into share group gid, or out of its group if
+// gid is 0; children inherit it.    A new group has weight WEIGHT0.
+// Return -1 if there are already NGROUP groups.
+int
+setgroup(int gid)
+{
+    struct proc *p = myproc();
+    struct group *g;
+
+    if(gid < 0)
+        return -1;
+    acquire(&p->lock);
+    acquire(&gtable.lock);
+    g = 0;
+    if(gid != 0 && (g = groupget(gid)) == 0){
+        release(&gtable.lock);
+        release(&p->lock);
+        return -1;
+    }
+    if(p->grp)
+        groupput(p->grp);
+    if(g != p->grp)
+        p->pass = 0;    // another scale; lifted when next queued
+    p->grp = g;
+    release(&gtable.lock);
+    release(&p->lock);
+    return 0;
+}
+
+// Fill in up to n entries of si with the scheduling statistics
+// of live processes.    Return the number filled in.
+int
+schedinfo(struct schedinfo *si, int n)
+{
+    struct proc *p;
+    int i;
+
+    i = 0;
+    for(p = ptable.all; p && i < n; p = p->allnext){
+        acquire(&p->lock);
+        if(p->state != UNUSED && p->state != ZOMBIE){
+            si[i].pid = p->pid;
+            si[i].group = p->grp ? p->grp->gid : 0;
+            si[i].weight = p->weight;
+            si[i].gweight = p->grp ? p->grp->weight : p->weight;
+            si[i].prio = p->prio;
+            si[i].runtime = p->runtime >> 20;
+            safestrcpy(si[i].name, p->name, sizeof(si[i].name));
+            i++;
+        }
+        release(&p->lock);
+    }
+    return i;
+}
+
+// Copy cpu's scheduling latency histograms to sl, and clear them
+// if reset is set.    The histograms are not locked, so a count
+// racing with the copy or reset may be missed or lost.
+// Return -1 if there is no such cpu.
+int
+schedlat(int cpu, struct schedlat *sl, int reset)
+{
+    struct cpu *c;
+
+    if(cpu < 0 || cpu >= ncpu)
+        return -1;
+    c = &cpus[cpu];
+    sl->khz = tsckhz;
+    memmove(sl->wait, c->waithist, sizeof(sl->wait));
+    memmove(sl->slice, c->slicehist, sizeof(sl->slice));
+    sl->maxwait = divu64(c->maxwait * 1000, tsckhz);
+    sl->maxslice = divu64(c->maxslice * 1000, tsckhz);
+    if(reset){
+        memset(c->waithist, 0, sizeof(c->waithist));
+        memset(c->slicehist, 0, sizeof(c->slicehist));
+        c->maxwait = c->maxslice = 0;
+    }
+    return 0;
+}
+
 //PAGEBREAK: 36
 // Print a process listing to console.    For debugging.
 // Runs when user types ^P on console.
@@ -509,14 +1764,14 @@ procdump(void)
     char *state;
     uint pc[10];
 
-    for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
+    for(p = ptable.all; p; p = p->allnext){
         if(p->state == UNUSED)
             continue;
         if(p->state >= 0 && p->state < NELEM(states) && states[p->state])
             state = states[p->state];
         else
             state = "???";
-        cprintf("%d %s %s", p->pid, state, p->name);
+        cprintf("%d %s %s prio %d nice %d", p->pid, state, p->name, p->prio, p->nice);
         if(p->state == SLEEPING){
             getcallerpcs((uint*)p->context->ebp+2, pc);
             for(i=0; i<10 && pc[i] != 0; i++)
@@ -524,4 +1779,7 @@ procdump(void)
         }
         cprintf("\n");
     }
+    for(i = 0; i < ncpu; i++)
+        cprintf("cpu%d: %d queued, idle %d times, %d reschedule IPIs\n",
+            i, cpus[i].rq.n, cpus[i].nidle, cpus[i].nwake);
 }
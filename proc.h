@@ -1,13 +1,68 @@
+// Per-CPU queue of RUNNABLE processes, linked through proc.rqnext.
+// There is one list per priority level; level 0 runs first, and
+// within a level the process with the smallest pass runs first,
+// a share group's members going by the group's pass.
+struct runq {
+    struct spinlock lock;
+    struct proc *head[NPRIO];
+    struct proc *tail[NPRIO];
+    struct proc *rthead;                 // Real-time processes, best first
+    int n;                                         // Number of queued processes
+    uint64 minpass;                            // Pass of the last process taken
+};
+
+// A share group.    Its members compete for the cpu as one process
+// of the group's weight, and share what the group gets by their
+// own weights.    Protected by gtable.lock in proc.c.
+struct group {
+    int gid;                                         // 0 if the slot is free
+    int nref;                                        // Procs in the group
+    int weight;                                    // Share weight, 1..WEIGHTMAX
+    uint64 pass;                                 // Virtual time: cycles run / weight
+    uint64 minpass;                            // Pass of the last member taken
+};
+
+// A deadline in TSC cycles on a cpu's hrtimer list (hrtimer.c).
+struct hrtimer {
+    uint64 expires;
+    void (*fn)(void*);
+    void *arg;
+    struct hrtimer *next;
+    int cpu;                                         // Index of the cpu queued on, or -1
+};
+
 // Per-CPU state
 struct cpu {
     uchar apicid;                                // Local APIC ID
     struct context *scheduler;     // swtch() here to enter scheduler
+    uint sysstack[128];                    // Trampoline stack under ts, see sysenterinit
     struct taskstate ts;                 // Used by x86 to find stack for interrupt
     struct segdesc gdt[NSEGS];     // x86 global descriptor table
     volatile uint started;             // Has the CPU started?
     int ncli;                                        // Depth of pushcli nesting.
     int intena;                                    // Were interrupts enabled before pushcli?
     struct proc *proc;                     // The process running on this cpu or null
+    struct proc *prev;                     // Process switched away from, lock still held
+    uint64 switchts;                         // TSC when proc was switched to
+    struct runq rq;                            // Processes waiting to run on this cpu
+    uint lastboost;                            // ticks at the last priority reset
+    volatile uint idle;                    // Halted in idle(), waiting for an IPI
+    uint nidle;                                    // Times this cpu halted
+    uint nwake;                                    // Reschedule IPIs received
+    struct spinlock hrlock;            // Protects hrhead
+    struct hrtimer *hrhead;            // Pending hrtimers, earliest first
+    uint64 nexttick;                         // TSC of the next periodic tick
+    int tickstopped;                         // Periodic tick stopped while idle
+    uint waithist[NLATBUCKET];     // Run queue waits, log2 TSC cycles
+    uint slicehist[NLATBUCKET];    // Time slices run, log2 TSC cycles
+    uint64 maxwait;                            // Longest run queue wait
+    uint64 maxslice;                         // Longest time slice
+    volatile uint resched;             // A better process is waiting
+    uint rtstart;                                // ticks when the RT window began
+    uint rtused;                                 // Ticks of RT work in this window
+    int rtthrottled;                         // RT work used up its window
+    int rcunest;                                 // Depth of rcureadlock nesting
+    volatile uint rcuepoch;            // Epoch being read in, or 0
 };
 
 extern struct cpu cpus[NCPU];
@@ -41,8 +96,30 @@ struct mm_area {
 
 #define MAXSTACK (PGSIZE << 1)
 
+// A deadline on the timer queue (timer.c).
+struct timer {
+    uint expires;                                // Tick at which fn(arg) runs
+    void (*fn)(void*);
+    void *arg;
+    struct timer *next;                    // Wheel slot links; pprev is 0
+    struct timer **pprev;                // when not queued
+};
+
+// Resource usage counters, reported by getrusage().
+struct pusage {
+    uint64 utime;                                // TSC cycles in user mode
+    uint64 stime;                                // TSC cycles in the kernel
+    uint minflt;                                 // Page faults resolved in the kernel
+    uint majflt;                                 // Page faults handed to a uffd handler
+    uint inblock;                                // Disk blocks read
+    uint oublock;                                // Disk blocks written
+    uint nvcsw;                                    // Sleeps
+    uint nivcsw;                                 // Preemptions
+};
+
 // Per-process state
 struct proc {
+    struct spinlock lock;                // Protects state, chan, killed, rqnext
     pde_t* pgdir;                                // Page table
     struct mm_area text_data;
     struct mm_area stack;
@@ -51,18 +128,47 @@ struct proc {
     enum procstate state;                // Process state
     int pid;                                         // Process ID
     struct proc *parent;                 // Parent process
+    struct proc *child;                    // First child; the rest follow sibling
+    struct proc *sibling;                // Next child of the same parent
+    struct proc *pidnext;                // Next in pid hash chain
+    struct proc *freenext;             // Next UNUSED proc
+    struct proc *allnext;                // Next proc in ptable.all
     struct trapframe *tf;                // Trap frame for current syscall
     struct context *context;         // swtch() here to run process
     void *chan;                                    // If non-zero, sleeping on chan
+    struct proc *wqnext;                 // Wait queue links while SLEEPING
+    struct proc *wqprev;
+    struct proc *slnext;                 // Next waiter on a sleeplock
     int killed;                                    // If non-zero, have been killed
     struct file *ofile[NOFILE];    // Open files
     struct inode *cwd;                     // Current directory
     char name[16];                             // Process name (debugging)
+    struct proc *rqnext;                 // Next process on a run queue
+    int cpu;                                         // Index of the cpu it last ran on, or -1
+    uint affinity;                             // Bit i set: may run on cpu i
+    int prio;                                        // Scheduling level, 0 is best
+    int nice;                                        // 0..NICEMAX, limits the best level
+    int sliceused;                             // Ticks used of the current time slice
+    int rtprio;                                    // SCHED_FIFO priority, 0 if normal
+    int weight;                                    // Share weight, 1..WEIGHTMAX
+    struct group *grp;                     // Share group, 0 if none
+    uint64 pass;                                 // Virtual time: cycles run / weight
+    uint64 runtime;                            // Total TSC cycles run
+    uint64 lastts;                             // TSC when time was last charged
+    uint64 queuedts;                         // TSC when last put on a run queue
+    struct pusage ru;                        // This process's usage
+    struct pusage cru;                     // Waited-for descendants' usage
+    struct timer sleeptimer;         // Wakes sys_sleep()
+    struct timer alarmtimer;         // Fires every alarmticks
+    struct hrtimer hrtimer;            // Wakes hrsleep()
     int alarmticks;
-    int alarmticksleft;
+    int alarmpending;                        // Alarm fired, handler not yet entered
     int inalarmhandler;
     uint alarmhandler;
     uint alarmhandlerret;
+    struct uffd *uffd;                     // If non-zero, heap faults go to a handler
+    struct syscount *sysstat;        // System call counts, a page, or 0
+    int straced;                                 // System calls are traced
 };
 
 // Process memory is laid out contiguously, low addresses first:
@@ -0,0 +1,82 @@
+// Epoch-based read-copy-update, for data that is read far more
+// often than it changes and whose readers must not take locks.
+//
+// A reader brackets its work with rcureadlock() and rcureadunlock(),
+// which record the current epoch in its cpu and keep it from being
+// preempted; it must not sleep in between.    A writer unlinks an
+// object so that new readers cannot find it, calls rcuretire() to
+// advance the epoch, and may reuse the object once rcuwait() on
+// that epoch returns: by then every reader that could still have
+// been looking at it has finished.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "x86.h"
+#include "memlayout.h"
+#include "mmu.h"
+#include "spinlock.h"
+#include "proc.h"
+
+// 0 in a cpu's rcuepoch means it is not reading, so the epoch
+// starts at 1.
+static volatile uint epoch = 1;
+
+void
+rcureadlock(void)
+{
+    struct cpu *c;
+    uint e;
+
+    pushcli();
+    c = mycpu();
+    if(c->rcunest++ > 0)
+        return;
+    // Publish the epoch, then check that it did not advance
+    // meanwhile: a writer that advanced it may already have
+    // looked at this cpu and seen it idle.
+    do {
+        e = epoch;
+        xchg(&c->rcuepoch, e);
+    } while(e != epoch);
+}
+
+void
+rcureadunlock(void)
+{
+    struct cpu *c = mycpu();
+
+    if(c->rcunest < 1)
+        panic("rcureadunlock");
+    if(--c->rcunest == 0){
+        __sync_synchronize();
+        c->rcuepoch = 0;
+    }
+    popcli();
+}
+
+// Advance the epoch after unlinking objects, and return the
+// epoch to hand to rcuwait() before reusing them.
+uint
+rcuretire(void)
+{
+    return xadd(&epoch, 1) + 1;
+}
+
+// Spin until no cpu is reading in an epoch before e.
+// Read sections are short and never sleep, so this is brief.
+void
+rcuwait(uint e)
+{
+    struct cpu *c;
+    uint ce;
+
+    pushcli();
+    if(mycpu()->rcunest > 0)
+        panic("rcuwait");
+    popcli();
+    for(c = cpus; c < cpus+ncpu; c++){
+        while((ce = c->rcuepoch) != 0 && ce < e)
+            pause();
+    }
+}
@@ -0,0 +1,28 @@
+// Resource usage reported by getrusage() and times().
+
+struct timeval {
+    int tv_sec;
+    int tv_usec;
+};
+
+struct rusage {
+    struct timeval ru_utime;    // user time
+    struct timeval ru_stime;    // system time
+    uint ru_minflt;                 // page faults resolved in the kernel
+    uint ru_majflt;                 // page faults handed to a uffd handler
+    uint ru_inblock;                // disk blocks read
+    uint ru_oublock;                // disk blocks written
+    uint ru_nvcsw;                    // voluntary context switches (sleep)
+    uint ru_nivcsw;                 // involuntary context switches (preemption)
+};
+
+#define RUSAGE_SELF         0
+#define RUSAGE_CHILDREN  -1        // waited-for descendants
+
+// Times in clock ticks (HZ per second).
+struct tms {
+    uint tms_utime;
+    uint tms_stime;
+    uint tms_cutime;
+    uint tms_cstime;
+};
@@ -0,0 +1,137 @@
+// Reader-writer locks and sequence locks, for read-mostly data:
+// readers never wait for each other, only for a writer.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "x86.h"
+#include "memlayout.h"
+#include "mmu.h"
+#include "spinlock.h"
+#include "proc.h"
+#include "rwlock.h"
+
+#define RWWRITER    0x80000000
+
+void
+initrwlock(struct rwlock *lk, char *name, uint cli)
+{
+    lk->name = name;
+    lk->word = 0;
+    lk->wwait = 0;
+    lk->cli = cli;
+    lk->cpu = 0;
+}
+
+// Acquire lk for reading.    Spins while a writer holds or
+// waits for it.
+void
+acquireread(struct rwlock *lk)
+{
+    uint w;
+
+    pushclii(lk->cli);
+    for(;;){
+        w = lk->word;
+        if((w & RWWRITER) == 0 && lk->wwait == 0 &&
+           cmpxchg(&lk->word, w, w + 1) == w)
+            break;
+        pause();
+    }
+    __sync_synchronize();
+}
+
+void
+releaseread(struct rwlock *lk)
+{
+    if(lk->word == 0 || (lk->word & RWWRITER))
+        panic("releaseread");
+    __sync_synchronize();
+    xadd(&lk->word, -1);
+    popclii(lk->cli);
+}
+
+// Acquire lk for writing, once the readers already in have left.
+void
+acquirewrite(struct rwlock *lk)
+{
+    pushclii(lk->cli);
+    if(lk->cli && holdingwrite(lk))
+        panic("acquirewrite");
+    xadd(&lk->wwait, 1);
+    while(cmpxchg(&lk->word, 0, RWWRITER) != 0)
+        pause();
+    xadd(&lk->wwait, -1);
+    __sync_synchronize();
+    if(lk->cli)
+        lk->cpu = mycpu();
+}
+
+void
+releasewrite(struct rwlock *lk)
+{
+    if(lk->word != RWWRITER || (lk->cli && !holdingwrite(lk)))
+        panic("releasewrite");
+    lk->cpu = 0;
+    __sync_synchronize();
+    lk->word = 0;
+    popclii(lk->cli);
+}
+
+// Check whether this cpu holds lk for writing.
+// Only meaningful when lk->cli is set.
+int
+holdingwrite(struct rwlock *lk)
+{
+    int r;
+
+    pushcli();
+    r = lk->word == RWWRITER && lk->cpu == mycpu();
+    popcli();
+    return r;
+}
+
+void
+initseqlock(struct seqlock *sl, char *name)
+{
+    initlock(&sl->lk, name, 1);
+    sl->seq = 0;
+}
+
+void
+writeseqlock(struct seqlock *sl)
+{
+    acquire(&sl->lk);
+    sl->seq++;
+    __sync_synchronize();
+}
+
+void
+writesequnlock(struct seqlock *sl)
+{
+    __sync_synchronize();
+    sl->seq++;
+    release(&sl->lk);
+}
+
+// Begin a read: wait out any write in progress and return the
+// sequence number to hand to readseqretry().
+uint
+readseqbegin(struct seqlock *sl)
+{
+    uint s;
+
+    while((s = sl->seq) & 1)
+        pause();
+    __sync_synchronize();
+    return s;
+}
+
+// Finish a read begun at sequence s.    Return 1 if a writer
+// got in meanwhile and the read must be done again.
+int
+readseqretry(struct seqlock *sl, uint s)
+{
+    __sync_synchronize();
+    return sl->seq != s;
+}
@@ -0,0 +1,19 @@
+// Reader-writer spin lock.    Any number of readers may hold it at
+// once, or one writer.    A waiting writer keeps new readers out,
+// so a reader must not take a read lock it already holds.
+struct rwlock {
+    volatile uint word;      // RWWRITER, or the number of readers
+    volatile uint wwait;     // Writers waiting
+    uint cli;                // As for a spinlock
+    char *name;              // Name of lock.
+    struct cpu *cpu;         // The cpu holding it for writing.
+};
+
+// Sequence lock.    Writers take lk and make seq odd while they
+// write; readers take no lock, but read again if seq was odd or
+// changed while they read.    For small data whose readers can
+// simply copy it.
+struct seqlock {
+    volatile uint seq;
+    struct spinlock lk;      // Serializes writers
+};
@@ -0,0 +1,26 @@
+// Scheduling policies for sched_setscheduler().
+#define SCHED_OTHER     0   // MLFQ and proportional share
+#define SCHED_FIFO      1   // real-time, priority 1..SCHED_PRIOMAX
+#define SCHED_PRIOMAX   99
+
+// Per-process scheduling statistics returned by schedinfo().
+struct schedinfo {
+    int pid;
+    int group;      // share group, 0 if none
+    int weight;     // share weight, against the group's other members
+    int gweight;    // the group's share weight, or weight if none
+    int prio;       // current MLFQ level
+    uint runtime;   // cpu time used, in units of 2^20 TSC cycles
+    char name[16];
+};
+
+// One cpu's scheduling latency histograms, returned by schedlat().
+// Bucket i counts intervals of 2^i to 2^(i+1) TSC cycles; the last
+// bucket also counts everything longer.
+struct schedlat {
+    uint khz;                       // TSC cycles per ms
+    uint wait[NLATBUCKET];          // RUNNABLE until switched to
+    uint slice[NLATBUCKET];         // switched to until switched out
+    uint maxwait;                   // longest wait, in us
+    uint maxslice;                  // longest slice, in us
+};
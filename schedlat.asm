@@ -0,0 +1,1571 @@
+
+_schedlat:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <bucketus>:
+struct schedlat sl;
+
+// Lower bound of bucket i in us, rounded down.
+uint
+bucketus(int i, uint khz)
+{
+   0:	55                   	push   %ebp
+   1:	89 e5                	mov    %esp,%ebp
+   3:	83 ec 10             	sub    $0x10,%esp
+    uint mhz;
+
+    mhz = khz / 1000;
+   6:	8b 45 0c             	mov    0xc(%ebp),%eax
+   9:	ba d3 4d 62 10       	mov    $0x10624dd3,%edx
+   e:	f7 e2                	mul    %edx
+  10:	89 d0                	mov    %edx,%eax
+  12:	c1 e8 06             	shr    $0x6,%eax
+  15:	89 45 fc             	mov    %eax,-0x4(%ebp)
+    if(mhz == 0)
+  18:	83 7d fc 00          	cmpl   $0x0,-0x4(%ebp)
+  1c:	75 07                	jne    25 <bucketus+0x25>
+        mhz = 1;
+  1e:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%ebp)
+    if(i < 32)
+  25:	83 7d 08 1f          	cmpl   $0x1f,0x8(%ebp)
+  29:	7f 18                	jg     43 <bucketus+0x43>
+        return (1U << i) / mhz;
+  2b:	8b 45 08             	mov    0x8(%ebp),%eax
+  2e:	ba 01 00 00 00       	mov    $0x1,%edx
+  33:	89 c1                	mov    %eax,%ecx
+  35:	d3 e2                	shl    %cl,%edx
+  37:	89 d0                	mov    %edx,%eax
+  39:	ba 00 00 00 00       	mov    $0x0,%edx
+  3e:	f7 75 fc             	divl   -0x4(%ebp)
+  41:	eb 1c                	jmp    5f <bucketus+0x5f>
+    return ((1U << (i - 16)) / mhz) << 16;
+  43:	8b 45 08             	mov    0x8(%ebp),%eax
+  46:	83 e8 10             	sub    $0x10,%eax
+  49:	ba 01 00 00 00       	mov    $0x1,%edx
+  4e:	89 c1                	mov    %eax,%ecx
+  50:	d3 e2                	shl    %cl,%edx
+  52:	89 d0                	mov    %edx,%eax
+  54:	ba 00 00 00 00       	mov    $0x0,%edx
+  59:	f7 75 fc             	divl   -0x4(%ebp)
+  5c:	c1 e0 10             	shl    $0x10,%eax
+}
+  5f:	c9                   	leave
+  60:	c3                   	ret
+
+00000061 <dump>:
+
+void
+dump(int cpu)
+{
+  61:	55                   	push   %ebp
+  62:	89 e5                	mov    %esp,%ebp
+  64:	56                   	push   %esi
+  65:	53                   	push   %ebx
+  66:	83 ec 10             	sub    $0x10,%esp
+    int i;
+
+    printf(1, "cpu %d: max wait %d us, max slice %d us\n",
+  69:	8b 15 48 10 00 00    	mov    0x1048,%edx
+  6f:	a1 44 10 00 00       	mov    0x1044,%eax
+  74:	83 ec 0c             	sub    $0xc,%esp
+  77:	52                   	push   %edx
+  78:	50                   	push   %eax
+  79:	ff 75 08             	push   0x8(%ebp)
+  7c:	68 b8 0b 00 00       	push   $0xbb8
+  81:	6a 01                	push   $0x1
+  83:	e8 79 07 00 00       	call   801 <printf>
+  88:	83 c4 20             	add    $0x20,%esp
+        cpu, sl.maxwait, sl.maxslice);
+    printf(1, "  cycles\tus>=\twait\tslice\n");
+  8b:	83 ec 08             	sub    $0x8,%esp
+  8e:	68 e1 0b 00 00       	push   $0xbe1
+  93:	6a 01                	push   $0x1
+  95:	e8 67 07 00 00       	call   801 <printf>
+  9a:	83 c4 10             	add    $0x10,%esp
+    for(i = 0; i < NLATBUCKET; i++){
+  9d:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  a4:	eb 69                	jmp    10f <dump+0xae>
+        if(sl.wait[i] == 0 && sl.slice[i] == 0)
+  a6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  a9:	8b 04 85 04 0f 00 00 	mov    0xf04(,%eax,4),%eax
+  b0:	85 c0                	test   %eax,%eax
+  b2:	75 11                	jne    c5 <dump+0x64>
+  b4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  b7:	83 c0 28             	add    $0x28,%eax
+  ba:	8b 04 85 04 0f 00 00 	mov    0xf04(,%eax,4),%eax
+  c1:	85 c0                	test   %eax,%eax
+  c3:	74 45                	je     10a <dump+0xa9>
+            continue;
+        printf(1, "  2^%d\t%d\t%d\t%d\n", i, bucketus(i, sl.khz),
+  c5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  c8:	83 c0 28             	add    $0x28,%eax
+  cb:	8b 34 85 04 0f 00 00 	mov    0xf04(,%eax,4),%esi
+  d2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  d5:	8b 1c 85 04 0f 00 00 	mov    0xf04(,%eax,4),%ebx
+  dc:	a1 00 0f 00 00       	mov    0xf00,%eax
+  e1:	83 ec 08             	sub    $0x8,%esp
+  e4:	50                   	push   %eax
+  e5:	ff 75 f4             	push   -0xc(%ebp)
+  e8:	e8 13 ff ff ff       	call   0 <bucketus>
+  ed:	83 c4 10             	add    $0x10,%esp
+  f0:	83 ec 08             	sub    $0x8,%esp
+  f3:	56                   	push   %esi
+  f4:	53                   	push   %ebx
+  f5:	50                   	push   %eax
+  f6:	ff 75 f4             	push   -0xc(%ebp)
+  f9:	68 fb 0b 00 00       	push   $0xbfb
+  fe:	6a 01                	push   $0x1
+ 100:	e8 fc 06 00 00       	call   801 <printf>
+ 105:	83 c4 20             	add    $0x20,%esp
+ 108:	eb 01                	jmp    10b <dump+0xaa>
+            continue;
+ 10a:	90                   	nop
+    for(i = 0; i < NLATBUCKET; i++){
+ 10b:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+ 10f:	83 7d f4 27          	cmpl   $0x27,-0xc(%ebp)
+ 113:	7e 91                	jle    a6 <dump+0x45>
+            sl.wait[i], sl.slice[i]);
+    }
+}
+ 115:	90                   	nop
+ 116:	90                   	nop
+ 117:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 11a:	5b                   	pop    %ebx
+ 11b:	5e                   	pop    %esi
+ 11c:	5d                   	pop    %ebp
+ 11d:	c3                   	ret
+
+0000011e <main>:
+
+int
+main(int argc, char *argv[])
+{
+ 11e:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+ 122:	83 e4 f0             	and    $0xfffffff0,%esp
+ 125:	ff 71 fc             	push   -0x4(%ecx)
+ 128:	55                   	push   %ebp
+ 129:	89 e5                	mov    %esp,%ebp
+ 12b:	53                   	push   %ebx
+ 12c:	51                   	push   %ecx
+ 12d:	83 ec 10             	sub    $0x10,%esp
+ 130:	89 cb                	mov    %ecx,%ebx
+    int cpu, print, reset;
+
+    print = 1;
+ 132:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    reset = 0;
+ 139:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+    if(argc > 1 && strcmp(argv[1], "-r") == 0)
+ 140:	83 3b 01             	cmpl   $0x1,(%ebx)
+ 143:	7e 26                	jle    16b <main+0x4d>
+ 145:	8b 43 04             	mov    0x4(%ebx),%eax
+ 148:	83 c0 04             	add    $0x4,%eax
+ 14b:	8b 00                	mov    (%eax),%eax
+ 14d:	83 ec 08             	sub    $0x8,%esp
+ 150:	68 0c 0c 00 00       	push   $0xc0c
+ 155:	50                   	push   %eax
+ 156:	e8 f4 00 00 00       	call   24f <strcmp>
+ 15b:	83 c4 10             	add    $0x10,%esp
+ 15e:	85 c0                	test   %eax,%eax
+ 160:	75 09                	jne    16b <main+0x4d>
+        reset = 1;
+ 162:	c7 45 ec 01 00 00 00 	movl   $0x1,-0x14(%ebp)
+ 169:	eb 4e                	jmp    1b9 <main+0x9b>
+    else if(argc > 1 && strcmp(argv[1], "-z") == 0){
+ 16b:	83 3b 01             	cmpl   $0x1,(%ebx)
+ 16e:	7e 2d                	jle    19d <main+0x7f>
+ 170:	8b 43 04             	mov    0x4(%ebx),%eax
+ 173:	83 c0 04             	add    $0x4,%eax
+ 176:	8b 00                	mov    (%eax),%eax
+ 178:	83 ec 08             	sub    $0x8,%esp
+ 17b:	68 0f 0c 00 00       	push   $0xc0f
+ 180:	50                   	push   %eax
+ 181:	e8 c9 00 00 00       	call   24f <strcmp>
+ 186:	83 c4 10             	add    $0x10,%esp
+ 189:	85 c0                	test   %eax,%eax
+ 18b:	75 10                	jne    19d <main+0x7f>
+        print = 0;
+ 18d:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+        reset = 1;
+ 194:	c7 45 ec 01 00 00 00 	movl   $0x1,-0x14(%ebp)
+ 19b:	eb 1c                	jmp    1b9 <main+0x9b>
+    } else if(argc > 1){
+ 19d:	83 3b 01             	cmpl   $0x1,(%ebx)
+ 1a0:	7e 17                	jle    1b9 <main+0x9b>
+        printf(2, "usage: schedlat [-r | -z]\n");
+ 1a2:	83 ec 08             	sub    $0x8,%esp
+ 1a5:	68 12 0c 00 00       	push   $0xc12
+ 1aa:	6a 02                	push   $0x2
+ 1ac:	e8 50 06 00 00       	call   801 <printf>
+ 1b1:	83 c4 10             	add    $0x10,%esp
+        exit();
+ 1b4:	e8 4a 03 00 00       	call   503 <exit>
+    }
+
+    for(cpu = 0; schedlat(cpu, &sl, reset) == 0; cpu++)
+ 1b9:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 1c0:	eb 18                	jmp    1da <main+0xbc>
+        if(print)
+ 1c2:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 1c6:	74 0e                	je     1d6 <main+0xb8>
+            dump(cpu);
+ 1c8:	83 ec 0c             	sub    $0xc,%esp
+ 1cb:	ff 75 f4             	push   -0xc(%ebp)
+ 1ce:	e8 8e fe ff ff       	call   61 <dump>
+ 1d3:	83 c4 10             	add    $0x10,%esp
+    for(cpu = 0; schedlat(cpu, &sl, reset) == 0; cpu++)
+ 1d6:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+ 1da:	83 ec 04             	sub    $0x4,%esp
+ 1dd:	ff 75 ec             	push   -0x14(%ebp)
+ 1e0:	68 00 0f 00 00       	push   $0xf00
+ 1e5:	ff 75 f4             	push   -0xc(%ebp)
+ 1e8:	e8 89 04 00 00       	call   676 <schedlat>
+ 1ed:	83 c4 10             	add    $0x10,%esp
+ 1f0:	85 c0                	test   %eax,%eax
+ 1f2:	74 ce                	je     1c2 <main+0xa4>
+    exit();
+ 1f4:	e8 0a 03 00 00       	call   503 <exit>
+
+000001f9 <stosb>:
+strchr(const char *s, char c)
+{
+    for(; *s; s++)
+        if(*s == c)
+            return (char*)s;
+    return 0;
+ 1f9:	55                   	push   %ebp
+ 1fa:	89 e5                	mov    %esp,%ebp
+ 1fc:	57                   	push   %edi
+ 1fd:	53                   	push   %ebx
+}
+ 1fe:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 201:	8b 55 10             	mov    0x10(%ebp),%edx
+ 204:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 207:	89 cb                	mov    %ecx,%ebx
+ 209:	89 df                	mov    %ebx,%edi
+ 20b:	89 d1                	mov    %edx,%ecx
+ 20d:	fc                   	cld
+ 20e:	f3 aa                	rep stos %al,%es:(%edi)
+ 210:	89 ca                	mov    %ecx,%edx
+ 212:	89 fb                	mov    %edi,%ebx
+ 214:	89 5d 08             	mov    %ebx,0x8(%ebp)
+ 217:	89 55 10             	mov    %edx,0x10(%ebp)
+
+char*
+gets(char *buf, int max)
+{
+ 21a:	90                   	nop
+ 21b:	5b                   	pop    %ebx
+ 21c:	5f                   	pop    %edi
+ 21d:	5d                   	pop    %ebp
+ 21e:	c3                   	ret
+
+0000021f <strcpy>:
+{
+ 21f:	55                   	push   %ebp
+ 220:	89 e5                	mov    %esp,%ebp
+ 222:	83 ec 10             	sub    $0x10,%esp
+    os = s;
+ 225:	8b 45 08             	mov    0x8(%ebp),%eax
+ 228:	89 45 fc             	mov    %eax,-0x4(%ebp)
+    while((*s++ = *t++) != 0)
+ 22b:	90                   	nop
+ 22c:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 22f:	8d 42 01             	lea    0x1(%edx),%eax
+ 232:	89 45 0c             	mov    %eax,0xc(%ebp)
+ 235:	8b 45 08             	mov    0x8(%ebp),%eax
+ 238:	8d 48 01             	lea    0x1(%eax),%ecx
+ 23b:	89 4d 08             	mov    %ecx,0x8(%ebp)
+ 23e:	0f b6 12             	movzbl (%edx),%edx
+ 241:	88 10                	mov    %dl,(%eax)
+ 243:	0f b6 00             	movzbl (%eax),%eax
+ 246:	84 c0                	test   %al,%al
+ 248:	75 e2                	jne    22c <strcpy+0xd>
+    return os;
+ 24a:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 24d:	c9                   	leave
+ 24e:	c3                   	ret
+
+0000024f <strcmp>:
+{
+ 24f:	55                   	push   %ebp
+ 250:	89 e5                	mov    %esp,%ebp
+    while(*p && *p == *q)
+ 252:	eb 08                	jmp    25c <strcmp+0xd>
+        p++, q++;
+ 254:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 258:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+    while(*p && *p == *q)
+ 25c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 25f:	0f b6 00             	movzbl (%eax),%eax
+ 262:	84 c0                	test   %al,%al
+ 264:	74 10                	je     276 <strcmp+0x27>
+ 266:	8b 45 08             	mov    0x8(%ebp),%eax
+ 269:	0f b6 10             	movzbl (%eax),%edx
+ 26c:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 26f:	0f b6 00             	movzbl (%eax),%eax
+ 272:	38 c2                	cmp    %al,%dl
+ 274:	74 de                	je     254 <strcmp+0x5>
+    return (uchar)*p - (uchar)*q;
+ 276:	8b 45 08             	mov    0x8(%ebp),%eax
+ 279:	0f b6 00             	movzbl (%eax),%eax
+ 27c:	0f b6 d0             	movzbl %al,%edx
+ 27f:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 282:	0f b6 00             	movzbl (%eax),%eax
+ 285:	0f b6 c0             	movzbl %al,%eax
+ 288:	29 c2                	sub    %eax,%edx
+ 28a:	89 d0                	mov    %edx,%eax
+}
+ 28c:	5d                   	pop    %ebp
+ 28d:	c3                   	ret
+
+0000028e <strlen>:
+{
+ 28e:	55                   	push   %ebp
+ 28f:	89 e5                	mov    %esp,%ebp
+ 291:	83 ec 10             	sub    $0x10,%esp
+    for(n = 0; s[n]; n++)
+ 294:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ 29b:	eb 04                	jmp    2a1 <strlen+0x13>
+ 29d:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 2a1:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 2a4:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2a7:	01 d0                	add    %edx,%eax
+ 2a9:	0f b6 00             	movzbl (%eax),%eax
+ 2ac:	84 c0                	test   %al,%al
+ 2ae:	75 ed                	jne    29d <strlen+0xf>
+    return n;
+ 2b0:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 2b3:	c9                   	leave
+ 2b4:	c3                   	ret
+
+000002b5 <memset>:
+{
+ 2b5:	55                   	push   %ebp
+ 2b6:	89 e5                	mov    %esp,%ebp
+    stosb(dst, c, n);
+ 2b8:	8b 45 10             	mov    0x10(%ebp),%eax
+ 2bb:	50                   	push   %eax
+ 2bc:	ff 75 0c             	push   0xc(%ebp)
+ 2bf:	ff 75 08             	push   0x8(%ebp)
+ 2c2:	e8 32 ff ff ff       	call   1f9 <stosb>
+ 2c7:	83 c4 0c             	add    $0xc,%esp
+    return dst;
+ 2ca:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 2cd:	c9                   	leave
+ 2ce:	c3                   	ret
+
+000002cf <strchr>:
+{
+ 2cf:	55                   	push   %ebp
+ 2d0:	89 e5                	mov    %esp,%ebp
+ 2d2:	83 ec 04             	sub    $0x4,%esp
+ 2d5:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 2d8:	88 45 fc             	mov    %al,-0x4(%ebp)
+    for(; *s; s++)
+ 2db:	eb 14                	jmp    2f1 <strchr+0x22>
+        if(*s == c)
+ 2dd:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2e0:	0f b6 00             	movzbl (%eax),%eax
+ 2e3:	38 45 fc             	cmp    %al,-0x4(%ebp)
+ 2e6:	75 05                	jne    2ed <strchr+0x1e>
+            return (char*)s;
+ 2e8:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2eb:	eb 13                	jmp    300 <strchr+0x31>
+    for(; *s; s++)
+ 2ed:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 2f1:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2f4:	0f b6 00             	movzbl (%eax),%eax
+ 2f7:	84 c0                	test   %al,%al
+ 2f9:	75 e2                	jne    2dd <strchr+0xe>
+    return 0;
+ 2fb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 300:	c9                   	leave
+ 301:	c3                   	ret
+
+00000302 <gets>:
+{
+ 302:	55                   	push   %ebp
+ 303:	89 e5                	mov    %esp,%ebp
+ 305:	83 ec 18             	sub    $0x18,%esp
+    int i, cc;
+    char c;
+
+    for(i=0; i+1 < max; ){
+ 308:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 30f:	eb 42                	jmp    353 <gets+0x51>
+        cc = read(0, &c, 1);
+ 311:	83 ec 04             	sub    $0x4,%esp
+ 314:	6a 01                	push   $0x1
+ 316:	8d 45 ef             	lea    -0x11(%ebp),%eax
+ 319:	50                   	push   %eax
+ 31a:	6a 00                	push   $0x0
+ 31c:	e8 f7 01 00 00       	call   518 <read>
+ 321:	83 c4 10             	add    $0x10,%esp
+ 324:	89 45 f0             	mov    %eax,-0x10(%ebp)
+        if(cc < 1)
+ 327:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 32b:	7e 33                	jle    360 <gets+0x5e>
+            break;
+        buf[i++] = c;
+ 32d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 330:	8d 50 01             	lea    0x1(%eax),%edx
+ 333:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 336:	89 c2                	mov    %eax,%edx
+ 338:	8b 45 08             	mov    0x8(%ebp),%eax
+ 33b:	01 c2                	add    %eax,%edx
+ 33d:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 341:	88 02                	mov    %al,(%edx)
+        if(c == '\n' || c == '\r')
+ 343:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 347:	3c 0a                	cmp    $0xa,%al
+ 349:	74 16                	je     361 <gets+0x5f>
+ 34b:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 34f:	3c 0d                	cmp    $0xd,%al
+ 351:	74 0e                	je     361 <gets+0x5f>
+    for(i=0; i+1 < max; ){
+ 353:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 356:	83 c0 01             	add    $0x1,%eax
+ 359:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 35c:	7f b3                	jg     311 <gets+0xf>
+ 35e:	eb 01                	jmp    361 <gets+0x5f>
+            break;
+ 360:	90                   	nop
+            break;
+    }
+    buf[i] = '\0';
+ 361:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 364:	8b 45 08             	mov    0x8(%ebp),%eax
+ 367:	01 d0                	add    %edx,%eax
+ 369:	c6 00 00             	movb   $0x0,(%eax)
+    return buf;
+ 36c:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 36f:	c9                   	leave
+ 370:	c3                   	ret
+
+00000371 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 371:	55                   	push   %ebp
+ 372:	89 e5                	mov    %esp,%ebp
+ 374:	83 ec 18             	sub    $0x18,%esp
+    int fd;
+    int r;
+
+    fd = open(n, O_RDONLY);
+ 377:	83 ec 08             	sub    $0x8,%esp
+ 37a:	6a 00                	push   $0x0
+ 37c:	ff 75 08             	push   0x8(%ebp)
+ 37f:	e8 c6 01 00 00       	call   54a <open>
+ 384:	83 c4 10             	add    $0x10,%esp
+ 387:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(fd < 0)
+ 38a:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 38e:	79 07                	jns    397 <stat+0x26>
+        return -1;
+ 390:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 395:	eb 25                	jmp    3bc <stat+0x4b>
+    r = fstat(fd, st);
+ 397:	83 ec 08             	sub    $0x8,%esp
+ 39a:	ff 75 0c             	push   0xc(%ebp)
+ 39d:	ff 75 f4             	push   -0xc(%ebp)
+ 3a0:	e8 c3 01 00 00       	call   568 <fstat>
+ 3a5:	83 c4 10             	add    $0x10,%esp
+ 3a8:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    close(fd);
+ 3ab:	83 ec 0c             	sub    $0xc,%esp
+ 3ae:	ff 75 f4             	push   -0xc(%ebp)
+ 3b1:	e8 76 01 00 00       	call   52c <close>
+ 3b6:	83 c4 10             	add    $0x10,%esp
+    return r;
+ 3b9:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ 3bc:	c9                   	leave
+ 3bd:	c3                   	ret
+
+000003be <atoi>:
+
+int
+atoi(const char *s)
+{
+ 3be:	55                   	push   %ebp
+ 3bf:	89 e5                	mov    %esp,%ebp
+ 3c1:	83 ec 10             	sub    $0x10,%esp
+    int n;
+
+    n = 0;
+ 3c4:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+    while('0' <= *s && *s <= '9')
+ 3cb:	eb 25                	jmp    3f2 <atoi+0x34>
+        n = n*10 + *s++ - '0';
+ 3cd:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 3d0:	89 d0                	mov    %edx,%eax
+ 3d2:	c1 e0 02             	shl    $0x2,%eax
+ 3d5:	01 d0                	add    %edx,%eax
+ 3d7:	01 c0                	add    %eax,%eax
+ 3d9:	89 c1                	mov    %eax,%ecx
+ 3db:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3de:	8d 50 01             	lea    0x1(%eax),%edx
+ 3e1:	89 55 08             	mov    %edx,0x8(%ebp)
+ 3e4:	0f b6 00             	movzbl (%eax),%eax
+ 3e7:	0f be c0             	movsbl %al,%eax
+ 3ea:	01 c8                	add    %ecx,%eax
+ 3ec:	83 e8 30             	sub    $0x30,%eax
+ 3ef:	89 45 fc             	mov    %eax,-0x4(%ebp)
+    while('0' <= *s && *s <= '9')
+ 3f2:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3f5:	0f b6 00             	movzbl (%eax),%eax
+ 3f8:	3c 2f                	cmp    $0x2f,%al
+ 3fa:	7e 0a                	jle    406 <atoi+0x48>
+ 3fc:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3ff:	0f b6 00             	movzbl (%eax),%eax
+ 402:	3c 39                	cmp    $0x39,%al
+ 404:	7e c7                	jle    3cd <atoi+0xf>
+    return n;
+ 406:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 409:	c9                   	leave
+ 40a:	c3                   	ret
+
+0000040b <nice>:
+
+// Add inc to the caller's nice value; return the new value.
+int
+nice(int inc)
+{
+ 40b:	55                   	push   %ebp
+ 40c:	89 e5                	mov    %esp,%ebp
+ 40e:	83 ec 18             	sub    $0x18,%esp
+    int n;
+
+    n = getpriority(0) + inc;
+ 411:	83 ec 0c             	sub    $0xc,%esp
+ 414:	6a 00                	push   $0x0
+ 416:	e8 d9 01 00 00       	call   5f4 <getpriority>
+ 41b:	83 c4 10             	add    $0x10,%esp
+ 41e:	8b 55 08             	mov    0x8(%ebp),%edx
+ 421:	01 d0                	add    %edx,%eax
+ 423:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(n < 0)
+ 426:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 42a:	79 07                	jns    433 <nice+0x28>
+        n = 0;
+ 42c:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    if(n > NICEMAX)
+ 433:	83 7d f4 13          	cmpl   $0x13,-0xc(%ebp)
+ 437:	7e 07                	jle    440 <nice+0x35>
+        n = NICEMAX;
+ 439:	c7 45 f4 13 00 00 00 	movl   $0x13,-0xc(%ebp)
+    if(setpriority(0, n) < 0)
+ 440:	83 ec 08             	sub    $0x8,%esp
+ 443:	ff 75 f4             	push   -0xc(%ebp)
+ 446:	6a 00                	push   $0x0
+ 448:	e8 b1 01 00 00       	call   5fe <setpriority>
+ 44d:	83 c4 10             	add    $0x10,%esp
+ 450:	85 c0                	test   %eax,%eax
+ 452:	79 07                	jns    45b <nice+0x50>
+        return -1;
+ 454:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 459:	eb 03                	jmp    45e <nice+0x53>
+    return n;
+ 45b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+ 45e:	c9                   	leave
+ 45f:	c3                   	ret
+
+00000460 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 460:	55                   	push   %ebp
+ 461:	89 e5                	mov    %esp,%ebp
+ 463:	83 ec 10             	sub    $0x10,%esp
+    char *dst;
+    const char *src;
+
+    dst = vdst;
+ 466:	8b 45 08             	mov    0x8(%ebp),%eax
+ 469:	89 45 fc             	mov    %eax,-0x4(%ebp)
+    src = vsrc;
+ 46c:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 46f:	89 45 f8             	mov    %eax,-0x8(%ebp)
+    while(n-- > 0)
+ 472:	eb 17                	jmp    48b <memmove+0x2b>
+        *dst++ = *src++;
+ 474:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 477:	8d 42 01             	lea    0x1(%edx),%eax
+ 47a:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 47d:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 480:	8d 48 01             	lea    0x1(%eax),%ecx
+ 483:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+ 486:	0f b6 12             	movzbl (%edx),%edx
+ 489:	88 10                	mov    %dl,(%eax)
+    while(n-- > 0)
+ 48b:	8b 45 10             	mov    0x10(%ebp),%eax
+ 48e:	8d 50 ff             	lea    -0x1(%eax),%edx
+ 491:	89 55 10             	mov    %edx,0x10(%ebp)
+ 494:	85 c0                	test   %eax,%eax
+ 496:	7f dc                	jg     474 <memmove+0x14>
+    return vdst;
+ 498:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 49b:	c9                   	leave
+ 49c:	c3                   	ret
+
+0000049d <dosyscall>:
+sysmode:
+    .long 0
+
+    .text
+dosyscall:
+    cmpl $0, sysmode
+ 49d:	83 3d e4 0e 00 00 00 	cmpl   $0x0,0xee4
+    jg 2f
+ 4a4:	7f 0c                	jg     4b2 <dosyscall+0x15>
+    jl 1f
+ 4a6:	7c 07                	jl     4af <dosyscall+0x12>
+    call sepcheck
+ 4a8:	e8 27 00 00 00       	call   4d4 <sepcheck>
+    jmp dosyscall
+ 4ad:	eb ee                	jmp    49d <dosyscall>
+1:
+    int $T_SYSCALL
+ 4af:	cd 40                	int    $0x40
+    ret
+ 4b1:	c3                   	ret
+2:
+    pushl %ebx
+ 4b2:	53                   	push   %ebx
+    pushl %esi
+ 4b3:	56                   	push   %esi
+    pushl %edi
+ 4b4:	57                   	push   %edi
+    pushl %ebp
+ 4b5:	55                   	push   %ebp
+    movl 20(%esp), %ebx
+ 4b6:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+    movl 24(%esp), %esi
+ 4ba:	8b 74 24 18          	mov    0x18(%esp),%esi
+    movl 28(%esp), %edi
+ 4be:	8b 7c 24 1c          	mov    0x1c(%esp),%edi
+    movl 32(%esp), %ebp
+ 4c2:	8b 6c 24 20          	mov    0x20(%esp),%ebp
+    movl %esp, %ecx
+ 4c6:	89 e1                	mov    %esp,%ecx
+    movl $3f, %edx
+ 4c8:	ba cf 04 00 00       	mov    $0x4cf,%edx
+    sysenter
+ 4cd:	0f 34                	sysenter
+3:
+    popl %ebp
+ 4cf:	5d                   	pop    %ebp
+    popl %edi
+ 4d0:	5f                   	pop    %edi
+    popl %esi
+ 4d1:	5e                   	pop    %esi
+    popl %ebx
+ 4d2:	5b                   	pop    %ebx
+    ret
+ 4d3:	c3                   	ret
+
+000004d4 <sepcheck>:
+
+# Set sysmode from cpuid's SEP flag.    Preserves %eax.
+sepcheck:
+    pushl %eax
+ 4d4:	50                   	push   %eax
+    pushl %ebx
+ 4d5:	53                   	push   %ebx
+    movl $1, %eax
+ 4d6:	b8 01 00 00 00       	mov    $0x1,%eax
+    cpuid
+ 4db:	0f a2                	cpuid
+    movl $-1, sysmode
+ 4dd:	c7 05 e4 0e 00 00 ff 	movl   $0xffffffff,0xee4
+ 4e4:	ff ff ff 
+    testl $0x800, %edx
+ 4e7:	f7 c2 00 08 00 00    	test   $0x800,%edx
+    jz 1f
+ 4ed:	74 0a                	je     4f9 <sepcheck+0x25>
+    movl $1, sysmode
+ 4ef:	c7 05 e4 0e 00 00 01 	movl   $0x1,0xee4
+ 4f6:	00 00 00 
+1:
+    popl %ebx
+ 4f9:	5b                   	pop    %ebx
+    popl %eax
+ 4fa:	58                   	pop    %eax
+    ret
+ 4fb:	c3                   	ret
+
+000004fc <fork>:
+
+SYSCALL(fork)
+ 4fc:	b8 01 00 00 00       	mov    $0x1,%eax
+ 501:	eb 9a                	jmp    49d <dosyscall>
+
+00000503 <exit>:
+SYSCALL(exit)
+ 503:	b8 02 00 00 00       	mov    $0x2,%eax
+ 508:	eb 93                	jmp    49d <dosyscall>
+
+0000050a <wait>:
+SYSCALL(wait)
+ 50a:	b8 03 00 00 00       	mov    $0x3,%eax
+ 50f:	eb 8c                	jmp    49d <dosyscall>
+
+00000511 <pipe>:
+SYSCALL(pipe)
+ 511:	b8 04 00 00 00       	mov    $0x4,%eax
+ 516:	eb 85                	jmp    49d <dosyscall>
+
+00000518 <read>:
+SYSCALL(read)
+ 518:	b8 05 00 00 00       	mov    $0x5,%eax
+ 51d:	e9 7b ff ff ff       	jmp    49d <dosyscall>
+
+00000522 <write>:
+SYSCALL(write)
+ 522:	b8 10 00 00 00       	mov    $0x10,%eax
+ 527:	e9 71 ff ff ff       	jmp    49d <dosyscall>
+
+0000052c <close>:
+SYSCALL(close)
+ 52c:	b8 15 00 00 00       	mov    $0x15,%eax
+ 531:	e9 67 ff ff ff       	jmp    49d <dosyscall>
+
+00000536 <kill>:
+SYSCALL(kill)
+ 536:	b8 06 00 00 00       	mov    $0x6,%eax
+ 53b:	e9 5d ff ff ff       	jmp    49d <dosyscall>
+
+00000540 <exec>:
+SYSCALL(exec)
+ 540:	b8 07 00 00 00       	mov    $0x7,%eax
+ 545:	e9 53 ff ff ff       	jmp    49d <dosyscall>
+
+0000054a <open>:
+SYSCALL(open)
+ 54a:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 54f:	e9 49 ff ff ff       	jmp    49d <dosyscall>
+
+00000554 <mknod>:
+SYSCALL(mknod)
+ 554:	b8 11 00 00 00       	mov    $0x11,%eax
+ 559:	e9 3f ff ff ff       	jmp    49d <dosyscall>
+
+0000055e <unlink>:
+SYSCALL(unlink)
+ 55e:	b8 12 00 00 00       	mov    $0x12,%eax
+ 563:	e9 35 ff ff ff       	jmp    49d <dosyscall>
+
+00000568 <fstat>:
+SYSCALL(fstat)
+ 568:	b8 08 00 00 00       	mov    $0x8,%eax
+ 56d:	e9 2b ff ff ff       	jmp    49d <dosyscall>
+
+00000572 <link>:
+SYSCALL(link)
+ 572:	b8 13 00 00 00       	mov    $0x13,%eax
+ 577:	e9 21 ff ff ff       	jmp    49d <dosyscall>
+
+0000057c <mkdir>:
+SYSCALL(mkdir)
+ 57c:	b8 14 00 00 00       	mov    $0x14,%eax
+ 581:	e9 17 ff ff ff       	jmp    49d <dosyscall>
+
+00000586 <chdir>:
+SYSCALL(chdir)
+ 586:	b8 09 00 00 00       	mov    $0x9,%eax
+ 58b:	e9 0d ff ff ff       	jmp    49d <dosyscall>
+
+00000590 <dup>:
+SYSCALL(dup)
+ 590:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 595:	e9 03 ff ff ff       	jmp    49d <dosyscall>
+
+0000059a <getpid>:
+SYSCALL(getpid)
+ 59a:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 59f:	e9 f9 fe ff ff       	jmp    49d <dosyscall>
+
+000005a4 <sbrk>:
+SYSCALL(sbrk)
+ 5a4:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 5a9:	e9 ef fe ff ff       	jmp    49d <dosyscall>
+
+000005ae <sleep>:
+SYSCALL(sleep)
+ 5ae:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 5b3:	e9 e5 fe ff ff       	jmp    49d <dosyscall>
+
+000005b8 <uptime>:
+SYSCALL(uptime)
+ 5b8:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 5bd:	e9 db fe ff ff       	jmp    49d <dosyscall>
+
+000005c2 <date>:
+SYSCALL(date)
+ 5c2:	b8 16 00 00 00       	mov    $0x16,%eax
+ 5c7:	e9 d1 fe ff ff       	jmp    49d <dosyscall>
+
+000005cc <dup2>:
+SYSCALL(dup2)
+ 5cc:	b8 17 00 00 00       	mov    $0x17,%eax
+ 5d1:	e9 c7 fe ff ff       	jmp    49d <dosyscall>
+
+000005d6 <uffd>:
+SYSCALL(uffd)
+ 5d6:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 5db:	e9 bd fe ff ff       	jmp    49d <dosyscall>
+
+000005e0 <uffdregister>:
+SYSCALL(uffdregister)
+ 5e0:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 5e5:	e9 b3 fe ff ff       	jmp    49d <dosyscall>
+
+000005ea <uffdcopy>:
+SYSCALL(uffdcopy)
+ 5ea:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 5ef:	e9 a9 fe ff ff       	jmp    49d <dosyscall>
+
+000005f4 <getpriority>:
+SYSCALL(getpriority)
+ 5f4:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 5f9:	e9 9f fe ff ff       	jmp    49d <dosyscall>
+
+000005fe <setpriority>:
+SYSCALL(setpriority)
+ 5fe:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 603:	e9 95 fe ff ff       	jmp    49d <dosyscall>
+
+00000608 <setweight>:
+SYSCALL(setweight)
+ 608:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 60d:	e9 8b fe ff ff       	jmp    49d <dosyscall>
+
+00000612 <setgroup>:
+SYSCALL(setgroup)
+ 612:	b8 20 00 00 00       	mov    $0x20,%eax
+ 617:	e9 81 fe ff ff       	jmp    49d <dosyscall>
+
+0000061c <schedinfo>:
+SYSCALL(schedinfo)
+ 61c:	b8 21 00 00 00       	mov    $0x21,%eax
+ 621:	e9 77 fe ff ff       	jmp    49d <dosyscall>
+
+00000626 <nanosleep>:
+SYSCALL(nanosleep)
+ 626:	b8 22 00 00 00       	mov    $0x22,%eax
+ 62b:	e9 6d fe ff ff       	jmp    49d <dosyscall>
+
+00000630 <clock_nanosleep>:
+SYSCALL(clock_nanosleep)
+ 630:	b8 23 00 00 00       	mov    $0x23,%eax
+ 635:	e9 63 fe ff ff       	jmp    49d <dosyscall>
+
+0000063a <clock_gettime>:
+SYSCALL(clock_gettime)
+ 63a:	b8 24 00 00 00       	mov    $0x24,%eax
+ 63f:	e9 59 fe ff ff       	jmp    49d <dosyscall>
+
+00000644 <sched_setaffinity>:
+SYSCALL(sched_setaffinity)
+ 644:	b8 25 00 00 00       	mov    $0x25,%eax
+ 649:	e9 4f fe ff ff       	jmp    49d <dosyscall>
+
+0000064e <sched_getaffinity>:
+SYSCALL(sched_getaffinity)
+ 64e:	b8 26 00 00 00       	mov    $0x26,%eax
+ 653:	e9 45 fe ff ff       	jmp    49d <dosyscall>
+
+00000658 <irqaffinity>:
+SYSCALL(irqaffinity)
+ 658:	b8 27 00 00 00       	mov    $0x27,%eax
+ 65d:	e9 3b fe ff ff       	jmp    49d <dosyscall>
+
+00000662 <getrusage>:
+SYSCALL(getrusage)
+ 662:	b8 28 00 00 00       	mov    $0x28,%eax
+ 667:	e9 31 fe ff ff       	jmp    49d <dosyscall>
+
+0000066c <times>:
+SYSCALL(times)
+ 66c:	b8 29 00 00 00       	mov    $0x29,%eax
+ 671:	e9 27 fe ff ff       	jmp    49d <dosyscall>
+
+00000676 <schedlat>:
+SYSCALL(schedlat)
+ 676:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 67b:	e9 1d fe ff ff       	jmp    49d <dosyscall>
+
+00000680 <sched_setscheduler>:
+SYSCALL(sched_setscheduler)
+ 680:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 685:	e9 13 fe ff ff       	jmp    49d <dosyscall>
+
+0000068a <sched_getscheduler>:
+SYSCALL(sched_getscheduler)
+ 68a:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 68f:	e9 09 fe ff ff       	jmp    49d <dosyscall>
+
+00000694 <sched_getparam>:
+SYSCALL(sched_getparam)
+ 694:	b8 2d 00 00 00       	mov    $0x2d,%eax
+ 699:	e9 ff fd ff ff       	jmp    49d <dosyscall>
+
+0000069e <lockstat>:
+SYSCALL(lockstat)
+ 69e:	b8 2e 00 00 00       	mov    $0x2e,%eax
+ 6a3:	e9 f5 fd ff ff       	jmp    49d <dosyscall>
+
+000006a8 <ioring_setup>:
+SYSCALL(ioring_setup)
+ 6a8:	b8 2f 00 00 00       	mov    $0x2f,%eax
+ 6ad:	e9 eb fd ff ff       	jmp    49d <dosyscall>
+
+000006b2 <ioring_enter>:
+SYSCALL(ioring_enter)
+ 6b2:	b8 30 00 00 00       	mov    $0x30,%eax
+ 6b7:	e9 e1 fd ff ff       	jmp    49d <dosyscall>
+
+000006bc <readv>:
+SYSCALL(readv)
+ 6bc:	b8 31 00 00 00       	mov    $0x31,%eax
+ 6c1:	e9 d7 fd ff ff       	jmp    49d <dosyscall>
+
+000006c6 <writev>:
+SYSCALL(writev)
+ 6c6:	b8 32 00 00 00       	mov    $0x32,%eax
+ 6cb:	e9 cd fd ff ff       	jmp    49d <dosyscall>
+
+000006d0 <pread>:
+SYSCALL(pread)
+ 6d0:	b8 33 00 00 00       	mov    $0x33,%eax
+ 6d5:	e9 c3 fd ff ff       	jmp    49d <dosyscall>
+
+000006da <pwrite>:
+SYSCALL(pwrite)
+ 6da:	b8 34 00 00 00       	mov    $0x34,%eax
+ 6df:	e9 b9 fd ff ff       	jmp    49d <dosyscall>
+
+000006e4 <sendfile>:
+SYSCALL(sendfile)
+ 6e4:	b8 35 00 00 00       	mov    $0x35,%eax
+ 6e9:	e9 af fd ff ff       	jmp    49d <dosyscall>
+
+000006ee <splice>:
+SYSCALL(splice)
+ 6ee:	b8 36 00 00 00       	mov    $0x36,%eax
+ 6f3:	e9 a5 fd ff ff       	jmp    49d <dosyscall>
+
+000006f8 <sysstat>:
+SYSCALL(sysstat)
+ 6f8:	b8 37 00 00 00       	mov    $0x37,%eax
+ 6fd:	e9 9b fd ff ff       	jmp    49d <dosyscall>
+
+00000702 <strace>:
+SYSCALL(strace)
+ 702:	b8 38 00 00 00       	mov    $0x38,%eax
+ 707:	e9 91 fd ff ff       	jmp    49d <dosyscall>
+
+0000070c <straceread>:
+SYSCALL(straceread)
+ 70c:	b8 39 00 00 00       	mov    $0x39,%eax
+ 711:	e9 87 fd ff ff       	jmp    49d <dosyscall>
+
+00000716 <alarm>:
+
+# alarm and rstoregs keep to int $T_SYSCALL: rstoregs restores
+# %ecx and %edx, which sysexit would clobber.
+.globl alarm
+    alarm:
+        pushl $rstoregs
+ 716:	68 26 07 00 00       	push   $0x726
+        movl $SYS_alarm, %eax
+ 71b:	b8 18 00 00 00       	mov    $0x18,%eax
+        int $T_SYSCALL
+ 720:	cd 40                	int    $0x40
+        add $0x04, %esp
+ 722:	83 c4 04             	add    $0x4,%esp
+        ret
+ 725:	c3                   	ret
+
+00000726 <rstoregs>:
+
+.globl rstoregs
+    rstoregs:
+        movl $SYS_rstoregs, %eax
+ 726:	b8 19 00 00 00       	mov    $0x19,%eax
+        int $T_SYSCALL
+ 72b:	cd 40                	int    $0x40
+
+0000072d <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 72d:	55                   	push   %ebp
+ 72e:	89 e5                	mov    %esp,%ebp
+ 730:	83 ec 18             	sub    $0x18,%esp
+ 733:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 736:	88 45 f4             	mov    %al,-0xc(%ebp)
+    write(fd, &c, 1);
+ 739:	83 ec 04             	sub    $0x4,%esp
+ 73c:	6a 01                	push   $0x1
+ 73e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+ 741:	50                   	push   %eax
+ 742:	ff 75 08             	push   0x8(%ebp)
+ 745:	e8 d8 fd ff ff       	call   522 <write>
+ 74a:	83 c4 10             	add    $0x10,%esp
+}
+ 74d:	90                   	nop
+ 74e:	c9                   	leave
+ 74f:	c3                   	ret
+
+00000750 <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 750:	55                   	push   %ebp
+ 751:	89 e5                	mov    %esp,%ebp
+ 753:	83 ec 28             	sub    $0x28,%esp
+    static char digits[] = "0123456789ABCDEF";
+    char buf[16];
+    int i, neg;
+    uint x;
+
+    neg = 0;
+ 756:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+    if(sgn && xx < 0){
+ 75d:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+ 761:	74 17                	je     77a <printint+0x2a>
+ 763:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 767:	79 11                	jns    77a <printint+0x2a>
+        neg = 1;
+ 769:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+        x = -xx;
+ 770:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 773:	f7 d8                	neg    %eax
+ 775:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 778:	eb 06                	jmp    780 <printint+0x30>
+    } else {
+        x = xx;
+ 77a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 77d:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    }
+
+    i = 0;
+ 780:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    do{
+        buf[i++] = digits[x % base];
+ 787:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 78a:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 78d:	ba 00 00 00 00       	mov    $0x0,%edx
+ 792:	f7 f1                	div    %ecx
+ 794:	89 d1                	mov    %edx,%ecx
+ 796:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 799:	8d 50 01             	lea    0x1(%eax),%edx
+ 79c:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 79f:	0f b6 91 e8 0e 00 00 	movzbl 0xee8(%ecx),%edx
+ 7a6:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+    }while((x /= base) != 0);
+ 7aa:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 7ad:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 7b0:	ba 00 00 00 00       	mov    $0x0,%edx
+ 7b5:	f7 f1                	div    %ecx
+ 7b7:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 7ba:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 7be:	75 c7                	jne    787 <printint+0x37>
+    if(neg)
+ 7c0:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 7c4:	74 2d                	je     7f3 <printint+0xa3>
+        buf[i++] = '-';
+ 7c6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 7c9:	8d 50 01             	lea    0x1(%eax),%edx
+ 7cc:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 7cf:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+    while(--i >= 0)
+ 7d4:	eb 1d                	jmp    7f3 <printint+0xa3>
+        putc(fd, buf[i]);
+ 7d6:	8d 55 dc             	lea    -0x24(%ebp),%edx
+ 7d9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 7dc:	01 d0                	add    %edx,%eax
+ 7de:	0f b6 00             	movzbl (%eax),%eax
+ 7e1:	0f be c0             	movsbl %al,%eax
+ 7e4:	83 ec 08             	sub    $0x8,%esp
+ 7e7:	50                   	push   %eax
+ 7e8:	ff 75 08             	push   0x8(%ebp)
+ 7eb:	e8 3d ff ff ff       	call   72d <putc>
+ 7f0:	83 c4 10             	add    $0x10,%esp
+    while(--i >= 0)
+ 7f3:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+ 7f7:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 7fb:	79 d9                	jns    7d6 <printint+0x86>
+}
+ 7fd:	90                   	nop
+ 7fe:	90                   	nop
+ 7ff:	c9                   	leave
+ 800:	c3                   	ret
+
+00000801 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 801:	55                   	push   %ebp
+ 802:	89 e5                	mov    %esp,%ebp
+ 804:	83 ec 28             	sub    $0x28,%esp
+    char *s;
+    int c, i, state;
+    uint *ap;
+
+    state = 0;
+ 807:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+    ap = (uint*)(void*)&fmt + 1;
+ 80e:	8d 45 0c             	lea    0xc(%ebp),%eax
+ 811:	83 c0 04             	add    $0x4,%eax
+ 814:	89 45 e8             	mov    %eax,-0x18(%ebp)
+    for(i = 0; fmt[i]; i++){
+ 817:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 81e:	e9 59 01 00 00       	jmp    97c <printf+0x17b>
+        c = fmt[i] & 0xff;
+ 823:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 826:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 829:	01 d0                	add    %edx,%eax
+ 82b:	0f b6 00             	movzbl (%eax),%eax
+ 82e:	0f be c0             	movsbl %al,%eax
+ 831:	25 ff 00 00 00       	and    $0xff,%eax
+ 836:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        if(state == 0){
+ 839:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 83d:	75 2c                	jne    86b <printf+0x6a>
+            if(c == '%'){
+ 83f:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 843:	75 0c                	jne    851 <printf+0x50>
+                state = '%';
+ 845:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+ 84c:	e9 27 01 00 00       	jmp    978 <printf+0x177>
+            } else {
+                putc(fd, c);
+ 851:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 854:	0f be c0             	movsbl %al,%eax
+ 857:	83 ec 08             	sub    $0x8,%esp
+ 85a:	50                   	push   %eax
+ 85b:	ff 75 08             	push   0x8(%ebp)
+ 85e:	e8 ca fe ff ff       	call   72d <putc>
+ 863:	83 c4 10             	add    $0x10,%esp
+ 866:	e9 0d 01 00 00       	jmp    978 <printf+0x177>
+            }
+        } else if(state == '%'){
+ 86b:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+ 86f:	0f 85 03 01 00 00    	jne    978 <printf+0x177>
+            if(c == 'd'){
+ 875:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+ 879:	75 1e                	jne    899 <printf+0x98>
+                printint(fd, *ap, 10, 1);
+ 87b:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 87e:	8b 00                	mov    (%eax),%eax
+ 880:	6a 01                	push   $0x1
+ 882:	6a 0a                	push   $0xa
+ 884:	50                   	push   %eax
+ 885:	ff 75 08             	push   0x8(%ebp)
+ 888:	e8 c3 fe ff ff       	call   750 <printint>
+ 88d:	83 c4 10             	add    $0x10,%esp
+                ap++;
+ 890:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 894:	e9 d8 00 00 00       	jmp    971 <printf+0x170>
+            } else if(c == 'x' || c == 'p'){
+ 899:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+ 89d:	74 06                	je     8a5 <printf+0xa4>
+ 89f:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+ 8a3:	75 1e                	jne    8c3 <printf+0xc2>
+                printint(fd, *ap, 16, 0);
+ 8a5:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 8a8:	8b 00                	mov    (%eax),%eax
+ 8aa:	6a 00                	push   $0x0
+ 8ac:	6a 10                	push   $0x10
+ 8ae:	50                   	push   %eax
+ 8af:	ff 75 08             	push   0x8(%ebp)
+ 8b2:	e8 99 fe ff ff       	call   750 <printint>
+ 8b7:	83 c4 10             	add    $0x10,%esp
+                ap++;
+ 8ba:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 8be:	e9 ae 00 00 00       	jmp    971 <printf+0x170>
+            } else if(c == 's'){
+ 8c3:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+ 8c7:	75 43                	jne    90c <printf+0x10b>
+                s = (char*)*ap;
+ 8c9:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 8cc:	8b 00                	mov    (%eax),%eax
+ 8ce:	89 45 f4             	mov    %eax,-0xc(%ebp)
+                ap++;
+ 8d1:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+                if(s == 0)
+ 8d5:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 8d9:	75 25                	jne    900 <printf+0xff>
+                    s = "(null)";
+ 8db:	c7 45 f4 2d 0c 00 00 	movl   $0xc2d,-0xc(%ebp)
+                while(*s != 0){
+ 8e2:	eb 1c                	jmp    900 <printf+0xff>
+                    putc(fd, *s);
+ 8e4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 8e7:	0f b6 00             	movzbl (%eax),%eax
+ 8ea:	0f be c0             	movsbl %al,%eax
+ 8ed:	83 ec 08             	sub    $0x8,%esp
+ 8f0:	50                   	push   %eax
+ 8f1:	ff 75 08             	push   0x8(%ebp)
+ 8f4:	e8 34 fe ff ff       	call   72d <putc>
+ 8f9:	83 c4 10             	add    $0x10,%esp
+                    s++;
+ 8fc:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+                while(*s != 0){
+ 900:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 903:	0f b6 00             	movzbl (%eax),%eax
+ 906:	84 c0                	test   %al,%al
+ 908:	75 da                	jne    8e4 <printf+0xe3>
+ 90a:	eb 65                	jmp    971 <printf+0x170>
+                }
+            } else if(c == 'c'){
+ 90c:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+ 910:	75 1d                	jne    92f <printf+0x12e>
+                putc(fd, *ap);
+ 912:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 915:	8b 00                	mov    (%eax),%eax
+ 917:	0f be c0             	movsbl %al,%eax
+ 91a:	83 ec 08             	sub    $0x8,%esp
+ 91d:	50                   	push   %eax
+ 91e:	ff 75 08             	push   0x8(%ebp)
+ 921:	e8 07 fe ff ff       	call   72d <putc>
+ 926:	83 c4 10             	add    $0x10,%esp
+                ap++;
+ 929:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 92d:	eb 42                	jmp    971 <printf+0x170>
+            } else if(c == '%'){
+ 92f:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 933:	75 17                	jne    94c <printf+0x14b>
+                putc(fd, c);
+ 935:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 938:	0f be c0             	movsbl %al,%eax
+ 93b:	83 ec 08             	sub    $0x8,%esp
+ 93e:	50                   	push   %eax
+ 93f:	ff 75 08             	push   0x8(%ebp)
+ 942:	e8 e6 fd ff ff       	call   72d <putc>
+ 947:	83 c4 10             	add    $0x10,%esp
+ 94a:	eb 25                	jmp    971 <printf+0x170>
+            } else {
+                // Unknown % sequence.    Print it to draw attention.
+                putc(fd, '%');
+ 94c:	83 ec 08             	sub    $0x8,%esp
+ 94f:	6a 25                	push   $0x25
+ 951:	ff 75 08             	push   0x8(%ebp)
+ 954:	e8 d4 fd ff ff       	call   72d <putc>
+ 959:	83 c4 10             	add    $0x10,%esp
+                putc(fd, c);
+ 95c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 95f:	0f be c0             	movsbl %al,%eax
+ 962:	83 ec 08             	sub    $0x8,%esp
+ 965:	50                   	push   %eax
+ 966:	ff 75 08             	push   0x8(%ebp)
+ 969:	e8 bf fd ff ff       	call   72d <putc>
+ 96e:	83 c4 10             	add    $0x10,%esp
+            }
+            state = 0;
+ 971:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+    for(i = 0; fmt[i]; i++){
+ 978:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ 97c:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 97f:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 982:	01 d0                	add    %edx,%eax
+ 984:	0f b6 00             	movzbl (%eax),%eax
+ 987:	84 c0                	test   %al,%al
+ 989:	0f 85 94 fe ff ff    	jne    823 <printf+0x22>
+        }
+    }
+}
+ 98f:	90                   	nop
+ 990:	90                   	nop
+ 991:	c9                   	leave
+ 992:	c3                   	ret
+
+00000993 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 993:	55                   	push   %ebp
+ 994:	89 e5                	mov    %esp,%ebp
+ 996:	83 ec 10             	sub    $0x10,%esp
+    Header *bp, *p;
+
+    bp = (Header*)ap - 1;
+ 999:	8b 45 08             	mov    0x8(%ebp),%eax
+ 99c:	83 e8 08             	sub    $0x8,%eax
+ 99f:	89 45 f8             	mov    %eax,-0x8(%ebp)
+    for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 9a2:	a1 54 10 00 00       	mov    0x1054,%eax
+ 9a7:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 9aa:	eb 24                	jmp    9d0 <free+0x3d>
+        if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 9ac:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 9af:	8b 00                	mov    (%eax),%eax
+ 9b1:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 9b4:	72 12                	jb     9c8 <free+0x35>
+ 9b6:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 9b9:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 9bc:	72 24                	jb     9e2 <free+0x4f>
+ 9be:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 9c1:	8b 00                	mov    (%eax),%eax
+ 9c3:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 9c6:	72 1a                	jb     9e2 <free+0x4f>
+    for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 9c8:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 9cb:	8b 00                	mov    (%eax),%eax
+ 9cd:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 9d0:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 9d3:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 9d6:	73 d4                	jae    9ac <free+0x19>
+ 9d8:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 9db:	8b 00                	mov    (%eax),%eax
+ 9dd:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 9e0:	73 ca                	jae    9ac <free+0x19>
+            break;
+    if(bp + bp->s.size == p->s.ptr){
+ 9e2:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 9e5:	8b 40 04             	mov    0x4(%eax),%eax
+ 9e8:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 9ef:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 9f2:	01 c2                	add    %eax,%edx
+ 9f4:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 9f7:	8b 00                	mov    (%eax),%eax
+ 9f9:	39 c2                	cmp    %eax,%edx
+ 9fb:	75 24                	jne    a21 <free+0x8e>
+        bp->s.size += p->s.ptr->s.size;
+ 9fd:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ a00:	8b 50 04             	mov    0x4(%eax),%edx
+ a03:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a06:	8b 00                	mov    (%eax),%eax
+ a08:	8b 40 04             	mov    0x4(%eax),%eax
+ a0b:	01 c2                	add    %eax,%edx
+ a0d:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ a10:	89 50 04             	mov    %edx,0x4(%eax)
+        bp->s.ptr = p->s.ptr->s.ptr;
+ a13:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a16:	8b 00                	mov    (%eax),%eax
+ a18:	8b 10                	mov    (%eax),%edx
+ a1a:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ a1d:	89 10                	mov    %edx,(%eax)
+ a1f:	eb 0a                	jmp    a2b <free+0x98>
+    } else
+        bp->s.ptr = p->s.ptr;
+ a21:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a24:	8b 10                	mov    (%eax),%edx
+ a26:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ a29:	89 10                	mov    %edx,(%eax)
+    if(p + p->s.size == bp){
+ a2b:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a2e:	8b 40 04             	mov    0x4(%eax),%eax
+ a31:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ a38:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a3b:	01 d0                	add    %edx,%eax
+ a3d:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ a40:	75 20                	jne    a62 <free+0xcf>
+        p->s.size += bp->s.size;
+ a42:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a45:	8b 50 04             	mov    0x4(%eax),%edx
+ a48:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ a4b:	8b 40 04             	mov    0x4(%eax),%eax
+ a4e:	01 c2                	add    %eax,%edx
+ a50:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a53:	89 50 04             	mov    %edx,0x4(%eax)
+        p->s.ptr = bp->s.ptr;
+ a56:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ a59:	8b 10                	mov    (%eax),%edx
+ a5b:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a5e:	89 10                	mov    %edx,(%eax)
+ a60:	eb 08                	jmp    a6a <free+0xd7>
+    } else
+        p->s.ptr = bp;
+ a62:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a65:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ a68:	89 10                	mov    %edx,(%eax)
+    freep = p;
+ a6a:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a6d:	a3 54 10 00 00       	mov    %eax,0x1054
+}
+ a72:	90                   	nop
+ a73:	c9                   	leave
+ a74:	c3                   	ret
+
+00000a75 <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+ a75:	55                   	push   %ebp
+ a76:	89 e5                	mov    %esp,%ebp
+ a78:	83 ec 18             	sub    $0x18,%esp
+    char *p;
+    Header *hp;
+
+    if(nu < 4096)
+ a7b:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+ a82:	77 07                	ja     a8b <morecore+0x16>
+        nu = 4096;
+ a84:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+    p = sbrk(nu * sizeof(Header));
+ a8b:	8b 45 08             	mov    0x8(%ebp),%eax
+ a8e:	c1 e0 03             	shl    $0x3,%eax
+ a91:	83 ec 0c             	sub    $0xc,%esp
+ a94:	50                   	push   %eax
+ a95:	e8 0a fb ff ff       	call   5a4 <sbrk>
+ a9a:	83 c4 10             	add    $0x10,%esp
+ a9d:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p == (char*)-1)
+ aa0:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+ aa4:	75 07                	jne    aad <morecore+0x38>
+        return 0;
+ aa6:	b8 00 00 00 00       	mov    $0x0,%eax
+ aab:	eb 26                	jmp    ad3 <morecore+0x5e>
+    hp = (Header*)p;
+ aad:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ ab0:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    hp->s.size = nu;
+ ab3:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ ab6:	8b 55 08             	mov    0x8(%ebp),%edx
+ ab9:	89 50 04             	mov    %edx,0x4(%eax)
+    free((void*)(hp + 1));
+ abc:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ abf:	83 c0 08             	add    $0x8,%eax
+ ac2:	83 ec 0c             	sub    $0xc,%esp
+ ac5:	50                   	push   %eax
+ ac6:	e8 c8 fe ff ff       	call   993 <free>
+ acb:	83 c4 10             	add    $0x10,%esp
+    return freep;
+ ace:	a1 54 10 00 00       	mov    0x1054,%eax
+}
+ ad3:	c9                   	leave
+ ad4:	c3                   	ret
+
+00000ad5 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ ad5:	55                   	push   %ebp
+ ad6:	89 e5                	mov    %esp,%ebp
+ ad8:	83 ec 18             	sub    $0x18,%esp
+    Header *p, *prevp;
+    uint nunits;
+
+    nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ adb:	8b 45 08             	mov    0x8(%ebp),%eax
+ ade:	83 c0 07             	add    $0x7,%eax
+ ae1:	c1 e8 03             	shr    $0x3,%eax
+ ae4:	83 c0 01             	add    $0x1,%eax
+ ae7:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    if((prevp = freep) == 0){
+ aea:	a1 54 10 00 00       	mov    0x1054,%eax
+ aef:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ af2:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ af6:	75 23                	jne    b1b <malloc+0x46>
+        base.s.ptr = freep = prevp = &base;
+ af8:	c7 45 f0 4c 10 00 00 	movl   $0x104c,-0x10(%ebp)
+ aff:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ b02:	a3 54 10 00 00       	mov    %eax,0x1054
+ b07:	a1 54 10 00 00       	mov    0x1054,%eax
+ b0c:	a3 4c 10 00 00       	mov    %eax,0x104c
+        base.s.size = 0;
+ b11:	c7 05 50 10 00 00 00 	movl   $0x0,0x1050
+ b18:	00 00 00 
+    }
+    for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ b1b:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ b1e:	8b 00                	mov    (%eax),%eax
+ b20:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        if(p->s.size >= nunits){
+ b23:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b26:	8b 40 04             	mov    0x4(%eax),%eax
+ b29:	3b 45 ec             	cmp    -0x14(%ebp),%eax
+ b2c:	72 4d                	jb     b7b <malloc+0xa6>
+            if(p->s.size == nunits)
+ b2e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b31:	8b 40 04             	mov    0x4(%eax),%eax
+ b34:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+ b37:	75 0c                	jne    b45 <malloc+0x70>
+                prevp->s.ptr = p->s.ptr;
+ b39:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b3c:	8b 10                	mov    (%eax),%edx
+ b3e:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ b41:	89 10                	mov    %edx,(%eax)
+ b43:	eb 26                	jmp    b6b <malloc+0x96>
+            else {
+                p->s.size -= nunits;
+ b45:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b48:	8b 40 04             	mov    0x4(%eax),%eax
+ b4b:	2b 45 ec             	sub    -0x14(%ebp),%eax
+ b4e:	89 c2                	mov    %eax,%edx
+ b50:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b53:	89 50 04             	mov    %edx,0x4(%eax)
+                p += p->s.size;
+ b56:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b59:	8b 40 04             	mov    0x4(%eax),%eax
+ b5c:	c1 e0 03             	shl    $0x3,%eax
+ b5f:	01 45 f4             	add    %eax,-0xc(%ebp)
+                p->s.size = nunits;
+ b62:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b65:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ b68:	89 50 04             	mov    %edx,0x4(%eax)
+            }
+            freep = prevp;
+ b6b:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ b6e:	a3 54 10 00 00       	mov    %eax,0x1054
+            return (void*)(p + 1);
+ b73:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b76:	83 c0 08             	add    $0x8,%eax
+ b79:	eb 3b                	jmp    bb6 <malloc+0xe1>
+        }
+        if(p == freep)
+ b7b:	a1 54 10 00 00       	mov    0x1054,%eax
+ b80:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ b83:	75 1e                	jne    ba3 <malloc+0xce>
+            if((p = morecore(nunits)) == 0)
+ b85:	83 ec 0c             	sub    $0xc,%esp
+ b88:	ff 75 ec             	push   -0x14(%ebp)
+ b8b:	e8 e5 fe ff ff       	call   a75 <morecore>
+ b90:	83 c4 10             	add    $0x10,%esp
+ b93:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ b96:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ b9a:	75 07                	jne    ba3 <malloc+0xce>
+                return 0;
+ b9c:	b8 00 00 00 00       	mov    $0x0,%eax
+ ba1:	eb 13                	jmp    bb6 <malloc+0xe1>
+    for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ ba3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ ba6:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ ba9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ bac:	8b 00                	mov    (%eax),%eax
+ bae:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        if(p->s.size >= nunits){
+ bb1:	e9 6d ff ff ff       	jmp    b23 <malloc+0x4e>
+    }
+}
+ bb6:	c9                   	leave
+ bb7:	c3                   	ret
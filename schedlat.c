@@ -0,0 +1,68 @@
+// Dump the per-cpu scheduling latency histograms: how long
+// processes wait on a run queue, and how long they run once
+// switched to.
+//
+//    schedlat       print the histograms of every cpu
+//    schedlat -r    print them, then reset them
+//    schedlat -z    reset them without printing
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "param.h"
+#include "sched.h"
+
+struct schedlat sl;
+
+// Lower bound of bucket i in us, rounded down.
+uint
+bucketus(int i, uint khz)
+{
+    uint mhz;
+
+    mhz = khz / 1000;
+    if(mhz == 0)
+        mhz = 1;
+    if(i < 32)
+        return (1U << i) / mhz;
+    return ((1U << (i - 16)) / mhz) << 16;
+}
+
+void
+dump(int cpu)
+{
+    int i;
+
+    printf(1, "cpu %d: max wait %d us, max slice %d us\n",
+        cpu, sl.maxwait, sl.maxslice);
+    printf(1, "  cycles\tus>=\twait\tslice\n");
+    for(i = 0; i < NLATBUCKET; i++){
+        if(sl.wait[i] == 0 && sl.slice[i] == 0)
+            continue;
+        printf(1, "  2^%d\t%d\t%d\t%d\n", i, bucketus(i, sl.khz),
+            sl.wait[i], sl.slice[i]);
+    }
+}
+
+int
+main(int argc, char *argv[])
+{
+    int cpu, print, reset;
+
+    print = 1;
+    reset = 0;
+    if(argc > 1 && strcmp(argv[1], "-r") == 0)
+        reset = 1;
+    else if(argc > 1 && strcmp(argv[1], "-z") == 0){
+        print = 0;
+        reset = 1;
+    } else if(argc > 1){
+        printf(2, "usage: schedlat [-r | -z]\n");
+        exit();
+    }
+
+    for(cpu = 0; schedlat(cpu, &sl, reset) == 0; cpu++)
+        if(print)
+            dump(cpu);
+    exit();
+}
@@ -0,0 +1,2882 @@
+
+_sh:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <runcmd>:
+struct cmd *parsecmd(char*);
+
+// Execute cmd.    Never returns.
+void
+runcmd(struct cmd *cmd)
+{
+       0:	55                   	push   %ebp
+       1:	89 e5                	mov    %esp,%ebp
+       3:	83 ec 28             	sub    $0x28,%esp
+    struct execcmd *ecmd;
+    struct listcmd *lcmd;
+    struct pipecmd *pcmd;
+    struct redircmd *rcmd;
+
+    if(cmd == 0)
+       6:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+       a:	75 05                	jne    11 <runcmd+0x11>
+        exit();
+       c:	e8 67 0f 00 00       	call   f78 <exit>
+
+    switch(cmd->type){
+      11:	8b 45 08             	mov    0x8(%ebp),%eax
+      14:	8b 00                	mov    (%eax),%eax
+      16:	83 f8 05             	cmp    $0x5,%eax
+      19:	77 09                	ja     24 <runcmd+0x24>
+      1b:	8b 04 85 64 16 00 00 	mov    0x1664(,%eax,4),%eax
+      22:	ff e0                	jmp    *%eax
+    default:
+        panic("panic: runcmd");
+      24:	83 ec 0c             	sub    $0xc,%esp
+      27:	68 30 16 00 00       	push   $0x1630
+      2c:	e8 58 03 00 00       	call   389 <panic>
+      31:	83 c4 10             	add    $0x10,%esp
+
+    case EXEC:
+        ecmd = (struct execcmd*)cmd;
+      34:	8b 45 08             	mov    0x8(%ebp),%eax
+      37:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        if(ecmd->argv[0] == 0)
+      3a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+      3d:	8b 40 04             	mov    0x4(%eax),%eax
+      40:	85 c0                	test   %eax,%eax
+      42:	75 05                	jne    49 <runcmd+0x49>
+            exit();
+      44:	e8 2f 0f 00 00       	call   f78 <exit>
+        exec(ecmd->argv[0], ecmd->argv);
+      49:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+      4c:	8d 50 04             	lea    0x4(%eax),%edx
+      4f:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+      52:	8b 40 04             	mov    0x4(%eax),%eax
+      55:	83 ec 08             	sub    $0x8,%esp
+      58:	52                   	push   %edx
+      59:	50                   	push   %eax
+      5a:	e8 56 0f 00 00       	call   fb5 <exec>
+      5f:	83 c4 10             	add    $0x10,%esp
+        printf(2, "exec %s failed\n", ecmd->argv[0]);
+      62:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+      65:	8b 40 04             	mov    0x4(%eax),%eax
+      68:	83 ec 04             	sub    $0x4,%esp
+      6b:	50                   	push   %eax
+      6c:	68 3e 16 00 00       	push   $0x163e
+      71:	6a 02                	push   $0x2
+      73:	e8 fe 11 00 00       	call   1276 <printf>
+      78:	83 c4 10             	add    $0x10,%esp
+        break;
+      7b:	e9 b0 01 00 00       	jmp    230 <runcmd+0x230>
+
+    case REDIR:
+        rcmd = (struct redircmd*)cmd;
+      80:	8b 45 08             	mov    0x8(%ebp),%eax
+      83:	89 45 e8             	mov    %eax,-0x18(%ebp)
+        close(rcmd->fd);
+      86:	8b 45 e8             	mov    -0x18(%ebp),%eax
+      89:	8b 40 14             	mov    0x14(%eax),%eax
+      8c:	83 ec 0c             	sub    $0xc,%esp
+      8f:	50                   	push   %eax
+      90:	e8 0c 0f 00 00       	call   fa1 <close>
+      95:	83 c4 10             	add    $0x10,%esp
+        if(open(rcmd->file, rcmd->mode) < 0){
+      98:	8b 45 e8             	mov    -0x18(%ebp),%eax
+      9b:	8b 50 10             	mov    0x10(%eax),%edx
+      9e:	8b 45 e8             	mov    -0x18(%ebp),%eax
+      a1:	8b 40 08             	mov    0x8(%eax),%eax
+      a4:	83 ec 08             	sub    $0x8,%esp
+      a7:	52                   	push   %edx
+      a8:	50                   	push   %eax
+      a9:	e8 11 0f 00 00       	call   fbf <open>
+      ae:	83 c4 10             	add    $0x10,%esp
+      b1:	85 c0                	test   %eax,%eax
+      b3:	79 1e                	jns    d3 <runcmd+0xd3>
+            printf(2, "open %s failed\n", rcmd->file);
+      b5:	8b 45 e8             	mov    -0x18(%ebp),%eax
+      b8:	8b 40 08             	mov    0x8(%eax),%eax
+      bb:	83 ec 04             	sub    $0x4,%esp
+      be:	50                   	push   %eax
+      bf:	68 4e 16 00 00       	push   $0x164e
+      c4:	6a 02                	push   $0x2
+      c6:	e8 ab 11 00 00       	call   1276 <printf>
+      cb:	83 c4 10             	add    $0x10,%esp
+            exit();
+      ce:	e8 a5 0e 00 00       	call   f78 <exit>
+        }
+        runcmd(rcmd->cmd);
+      d3:	8b 45 e8             	mov    -0x18(%ebp),%eax
+      d6:	8b 40 04             	mov    0x4(%eax),%eax
+      d9:	83 ec 0c             	sub    $0xc,%esp
+      dc:	50                   	push   %eax
+      dd:	e8 1e ff ff ff       	call   0 <runcmd>
+      e2:	83 c4 10             	add    $0x10,%esp
+        break;
+      e5:	e9 46 01 00 00       	jmp    230 <runcmd+0x230>
+
+    case LIST:
+        lcmd = (struct listcmd*)cmd;
+      ea:	8b 45 08             	mov    0x8(%ebp),%eax
+      ed:	89 45 f0             	mov    %eax,-0x10(%ebp)
+        if(fork1() == 0)
+      f0:	e8 b4 02 00 00       	call   3a9 <fork1>
+      f5:	85 c0                	test   %eax,%eax
+      f7:	75 12                	jne    10b <runcmd+0x10b>
+            runcmd(lcmd->left);
+      f9:	8b 45 f0             	mov    -0x10(%ebp),%eax
+      fc:	8b 40 04             	mov    0x4(%eax),%eax
+      ff:	83 ec 0c             	sub    $0xc,%esp
+     102:	50                   	push   %eax
+     103:	e8 f8 fe ff ff       	call   0 <runcmd>
+     108:	83 c4 10             	add    $0x10,%esp
+        wait();
+     10b:	e8 6f 0e 00 00       	call   f7f <wait>
+        runcmd(lcmd->right);
+     110:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     113:	8b 40 08             	mov    0x8(%eax),%eax
+     116:	83 ec 0c             	sub    $0xc,%esp
+     119:	50                   	push   %eax
+     11a:	e8 e1 fe ff ff       	call   0 <runcmd>
+     11f:	83 c4 10             	add    $0x10,%esp
+        break;
+     122:	e9 09 01 00 00       	jmp    230 <runcmd+0x230>
+
+    case PIPE:
+        pcmd = (struct pipecmd*)cmd;
+     127:	8b 45 08             	mov    0x8(%ebp),%eax
+     12a:	89 45 ec             	mov    %eax,-0x14(%ebp)
+        if(pipe(p) < 0)
+     12d:	83 ec 0c             	sub    $0xc,%esp
+     130:	8d 45 dc             	lea    -0x24(%ebp),%eax
+     133:	50                   	push   %eax
+     134:	e8 4d 0e 00 00       	call   f86 <pipe>
+     139:	83 c4 10             	add    $0x10,%esp
+     13c:	85 c0                	test   %eax,%eax
+     13e:	79 10                	jns    150 <runcmd+0x150>
+            panic("pipe");
+     140:	83 ec 0c             	sub    $0xc,%esp
+     143:	68 5e 16 00 00       	push   $0x165e
+     148:	e8 3c 02 00 00       	call   389 <panic>
+     14d:	83 c4 10             	add    $0x10,%esp
+        if(fork1() == 0){
+     150:	e8 54 02 00 00       	call   3a9 <fork1>
+     155:	85 c0                	test   %eax,%eax
+     157:	75 41                	jne    19a <runcmd+0x19a>
+            // close(1);
+            // dup(p[1]);
+            dup2(p[1], 1);
+     159:	8b 45 e0             	mov    -0x20(%ebp),%eax
+     15c:	83 ec 08             	sub    $0x8,%esp
+     15f:	6a 01                	push   $0x1
+     161:	50                   	push   %eax
+     162:	e8 da 0e 00 00       	call   1041 <dup2>
+     167:	83 c4 10             	add    $0x10,%esp
+            close(p[0]);
+     16a:	8b 45 dc             	mov    -0x24(%ebp),%eax
+     16d:	83 ec 0c             	sub    $0xc,%esp
+     170:	50                   	push   %eax
+     171:	e8 2b 0e 00 00       	call   fa1 <close>
+     176:	83 c4 10             	add    $0x10,%esp
+            close(p[1]);
+     179:	8b 45 e0             	mov    -0x20(%ebp),%eax
+     17c:	83 ec 0c             	sub    $0xc,%esp
+     17f:	50                   	push   %eax
+     180:	e8 1c 0e 00 00       	call   fa1 <close>
+     185:	83 c4 10             	add    $0x10,%esp
+            runcmd(pcmd->left);
+     188:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     18b:	8b 40 04             	mov    0x4(%eax),%eax
+     18e:	83 ec 0c             	sub    $0xc,%esp
+     191:	50                   	push   %eax
+     192:	e8 69 fe ff ff       	call   0 <runcmd>
+     197:	83 c4 10             	add    $0x10,%esp
+        }
+        if(fork1() == 0){
+     19a:	e8 0a 02 00 00       	call   3a9 <fork1>
+     19f:	85 c0                	test   %eax,%eax
+     1a1:	75 41                	jne    1e4 <runcmd+0x1e4>
+            // close(0);
+            // dup(p[0]);
+            dup2(p[0], 0);
+     1a3:	8b 45 dc             	mov    -0x24(%ebp),%eax
+     1a6:	83 ec 08             	sub    $0x8,%esp
+     1a9:	6a 00                	push   $0x0
+     1ab:	50                   	push   %eax
+     1ac:	e8 90 0e 00 00       	call   1041 <dup2>
+     1b1:	83 c4 10             	add    $0x10,%esp
+            close(p[0]);
+     1b4:	8b 45 dc             	mov    -0x24(%ebp),%eax
+     1b7:	83 ec 0c             	sub    $0xc,%esp
+     1ba:	50                   	push   %eax
+     1bb:	e8 e1 0d 00 00       	call   fa1 <close>
+     1c0:	83 c4 10             	add    $0x10,%esp
+            close(p[1]);
+     1c3:	8b 45 e0             	mov    -0x20(%ebp),%eax
+     1c6:	83 ec 0c             	sub    $0xc,%esp
+     1c9:	50                   	push   %eax
+     1ca:	e8 d2 0d 00 00       	call   fa1 <close>
+     1cf:	83 c4 10             	add    $0x10,%esp
+            runcmd(pcmd->right);
+     1d2:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     1d5:	8b 40 08             	mov    0x8(%eax),%eax
+     1d8:	83 ec 0c             	sub    $0xc,%esp
+     1db:	50                   	push   %eax
+     1dc:	e8 1f fe ff ff       	call   0 <runcmd>
+     1e1:	83 c4 10             	add    $0x10,%esp
+        }
+        close(p[0]);
+     1e4:	8b 45 dc             	mov    -0x24(%ebp),%eax
+     1e7:	83 ec 0c             	sub    $0xc,%esp
+     1ea:	50                   	push   %eax
+     1eb:	e8 b1 0d 00 00       	call   fa1 <close>
+     1f0:	83 c4 10             	add    $0x10,%esp
+        close(p[1]);
+     1f3:	8b 45 e0             	mov    -0x20(%ebp),%eax
+     1f6:	83 ec 0c             	sub    $0xc,%esp
+     1f9:	50                   	push   %eax
+     1fa:	e8 a2 0d 00 00       	call   fa1 <close>
+     1ff:	83 c4 10             	add    $0x10,%esp
+        wait();
+     202:	e8 78 0d 00 00       	call   f7f <wait>
+        wait();
+     207:	e8 73 0d 00 00       	call   f7f <wait>
+        break;
+     20c:	eb 22                	jmp    230 <runcmd+0x230>
+
+    case BACK:
+        bcmd = (struct backcmd*)cmd;
+     20e:	8b 45 08             	mov    0x8(%ebp),%eax
+     211:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        if(fork1() == 0)
+     214:	e8 90 01 00 00       	call   3a9 <fork1>
+     219:	85 c0                	test   %eax,%eax
+     21b:	75 12                	jne    22f <runcmd+0x22f>
+            runcmd(bcmd->cmd);
+     21d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     220:	8b 40 04             	mov    0x4(%eax),%eax
+     223:	83 ec 0c             	sub    $0xc,%esp
+     226:	50                   	push   %eax
+     227:	e8 d4 fd ff ff       	call   0 <runcmd>
+     22c:	83 c4 10             	add    $0x10,%esp
+        break;
+     22f:	90                   	nop
+    }
+    exit();
+     230:	e8 43 0d 00 00       	call   f78 <exit>
+
+00000235 <getcmd>:
+}
+
+int
+getcmd(char *buf, int nbuf)
+{
+     235:	55                   	push   %ebp
+     236:	89 e5                	mov    %esp,%ebp
+     238:	83 ec 08             	sub    $0x8,%esp
+    printf(2, "$ ");
+     23b:	83 ec 08             	sub    $0x8,%esp
+     23e:	68 7c 16 00 00       	push   $0x167c
+     243:	6a 02                	push   $0x2
+     245:	e8 2c 10 00 00       	call   1276 <printf>
+     24a:	83 c4 10             	add    $0x10,%esp
+    memset(buf, 0, nbuf);
+     24d:	8b 45 0c             	mov    0xc(%ebp),%eax
+     250:	83 ec 04             	sub    $0x4,%esp
+     253:	50                   	push   %eax
+     254:	6a 00                	push   $0x0
+     256:	ff 75 08             	push   0x8(%ebp)
+     259:	e8 cc 0a 00 00       	call   d2a <memset>
+     25e:	83 c4 10             	add    $0x10,%esp
+    gets(buf, nbuf);
+     261:	83 ec 08             	sub    $0x8,%esp
+     264:	ff 75 0c             	push   0xc(%ebp)
+     267:	ff 75 08             	push   0x8(%ebp)
+     26a:	e8 08 0b 00 00       	call   d77 <gets>
+     26f:	83 c4 10             	add    $0x10,%esp
+    if(buf[0] == 0) // EOF
+     272:	8b 45 08             	mov    0x8(%ebp),%eax
+     275:	0f b6 00             	movzbl (%eax),%eax
+     278:	84 c0                	test   %al,%al
+     27a:	75 07                	jne    283 <getcmd+0x4e>
+        return -1;
+     27c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     281:	eb 05                	jmp    288 <getcmd+0x53>
+    return 0;
+     283:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     288:	c9                   	leave
+     289:	c3                   	ret
+
+0000028a <main>:
+
+int
+main(void)
+{
+     28a:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+     28e:	83 e4 f0             	and    $0xfffffff0,%esp
+     291:	ff 71 fc             	push   -0x4(%ecx)
+     294:	55                   	push   %ebp
+     295:	89 e5                	mov    %esp,%ebp
+     297:	51                   	push   %ecx
+     298:	83 ec 14             	sub    $0x14,%esp
+    static char buf[100];
+    int fd;
+
+    // Ensure that three file descriptors are open.
+    while((fd = open("console", O_RDWR)) >= 0){
+     29b:	eb 16                	jmp    2b3 <main+0x29>
+        if(fd >= 3){
+     29d:	83 7d f4 02          	cmpl   $0x2,-0xc(%ebp)
+     2a1:	7e 10                	jle    2b3 <main+0x29>
+            close(fd);
+     2a3:	83 ec 0c             	sub    $0xc,%esp
+     2a6:	ff 75 f4             	push   -0xc(%ebp)
+     2a9:	e8 f3 0c 00 00       	call   fa1 <close>
+     2ae:	83 c4 10             	add    $0x10,%esp
+            break;
+     2b1:	eb 1b                	jmp    2ce <main+0x44>
+    while((fd = open("console", O_RDWR)) >= 0){
+     2b3:	83 ec 08             	sub    $0x8,%esp
+     2b6:	6a 02                	push   $0x2
+     2b8:	68 7f 16 00 00       	push   $0x167f
+     2bd:	e8 fd 0c 00 00       	call   fbf <open>
+     2c2:	83 c4 10             	add    $0x10,%esp
+     2c5:	89 45 f4             	mov    %eax,-0xc(%ebp)
+     2c8:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     2cc:	79 cf                	jns    29d <main+0x13>
+        }
+    }
+
+    // Read and run input commands.
+    while(getcmd(buf, sizeof(buf)) >= 0){
+     2ce:	e9 97 00 00 00       	jmp    36a <main+0xe0>
+        if(buf[0] == 'c' && buf[1] == 'd' && buf[2] == ' '){
+     2d3:	0f b6 05 00 1c 00 00 	movzbl 0x1c00,%eax
+     2da:	3c 63                	cmp    $0x63,%al
+     2dc:	75 5f                	jne    33d <main+0xb3>
+     2de:	0f b6 05 01 1c 00 00 	movzbl 0x1c01,%eax
+     2e5:	3c 64                	cmp    $0x64,%al
+     2e7:	75 54                	jne    33d <main+0xb3>
+     2e9:	0f b6 05 02 1c 00 00 	movzbl 0x1c02,%eax
+     2f0:	3c 20                	cmp    $0x20,%al
+     2f2:	75 49                	jne    33d <main+0xb3>
+            // Chdir must be called by the parent, not the child.
+            buf[strlen(buf)-1] = 0;    // chop \n
+     2f4:	83 ec 0c             	sub    $0xc,%esp
+     2f7:	68 00 1c 00 00       	push   $0x1c00
+     2fc:	e8 02 0a 00 00       	call   d03 <strlen>
+     301:	83 c4 10             	add    $0x10,%esp
+     304:	83 e8 01             	sub    $0x1,%eax
+     307:	c6 80 00 1c 00 00 00 	movb   $0x0,0x1c00(%eax)
+            if(chdir(buf+3) < 0)
+     30e:	b8 03 1c 00 00       	mov    $0x1c03,%eax
+     313:	83 ec 0c             	sub    $0xc,%esp
+     316:	50                   	push   %eax
+     317:	e8 df 0c 00 00       	call   ffb <chdir>
+     31c:	83 c4 10             	add    $0x10,%esp
+     31f:	85 c0                	test   %eax,%eax
+     321:	79 46                	jns    369 <main+0xdf>
+                printf(2, "cannot cd %s\n", buf+3);
+     323:	b8 03 1c 00 00       	mov    $0x1c03,%eax
+     328:	83 ec 04             	sub    $0x4,%esp
+     32b:	50                   	push   %eax
+     32c:	68 87 16 00 00       	push   $0x1687
+     331:	6a 02                	push   $0x2
+     333:	e8 3e 0f 00 00       	call   1276 <printf>
+     338:	83 c4 10             	add    $0x10,%esp
+            continue;
+     33b:	eb 2c                	jmp    369 <main+0xdf>
+        }
+        if(fork1() == 0)
+     33d:	e8 67 00 00 00       	call   3a9 <fork1>
+     342:	85 c0                	test   %eax,%eax
+     344:	75 1c                	jne    362 <main+0xd8>
+            runcmd(parsecmd(buf));
+     346:	83 ec 0c             	sub    $0xc,%esp
+     349:	68 00 1c 00 00       	push   $0x1c00
+     34e:	e8 ad 03 00 00       	call   700 <parsecmd>
+     353:	83 c4 10             	add    $0x10,%esp
+     356:	83 ec 0c             	sub    $0xc,%esp
+     359:	50                   	push   %eax
+     35a:	e8 a1 fc ff ff       	call   0 <runcmd>
+     35f:	83 c4 10             	add    $0x10,%esp
+        wait();
+     362:	e8 18 0c 00 00       	call   f7f <wait>
+     367:	eb 01                	jmp    36a <main+0xe0>
+            continue;
+     369:	90                   	nop
+    while(getcmd(buf, sizeof(buf)) >= 0){
+     36a:	83 ec 08             	sub    $0x8,%esp
+     36d:	6a 64                	push   $0x64
+     36f:	68 00 1c 00 00       	push   $0x1c00
+     374:	e8 bc fe ff ff       	call   235 <getcmd>
+     379:	83 c4 10             	add    $0x10,%esp
+     37c:	85 c0                	test   %eax,%eax
+     37e:	0f 89 4f ff ff ff    	jns    2d3 <main+0x49>
+    }
+    exit();
+     384:	e8 ef 0b 00 00       	call   f78 <exit>
+
+00000389 <panic>:
+}
+
+void
+panic(char *s)
+{
+     389:	55                   	push   %ebp
+     38a:	89 e5                	mov    %esp,%ebp
+     38c:	83 ec 08             	sub    $0x8,%esp
+    printf(2, "%s\n", s);
+     38f:	83 ec 04             	sub    $0x4,%esp
+     392:	ff 75 08             	push   0x8(%ebp)
+     395:	68 95 16 00 00       	push   $0x1695
+     39a:	6a 02                	push   $0x2
+     39c:	e8 d5 0e 00 00       	call   1276 <printf>
+     3a1:	83 c4 10             	add    $0x10,%esp
+    exit();
+     3a4:	e8 cf 0b 00 00       	call   f78 <exit>
+
+000003a9 <fork1>:
+}
+
+int
+fork1(void)
+{
+     3a9:	55                   	push   %ebp
+     3aa:	89 e5                	mov    %esp,%ebp
+     3ac:	83 ec 18             	sub    $0x18,%esp
+    int pid;
+
+    pid = fork();
+     3af:	e8 bd 0b 00 00       	call   f71 <fork>
+     3b4:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(pid == -1)
+     3b7:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+     3bb:	75 10                	jne    3cd <fork1+0x24>
+        panic("fork");
+     3bd:	83 ec 0c             	sub    $0xc,%esp
+     3c0:	68 99 16 00 00       	push   $0x1699
+     3c5:	e8 bf ff ff ff       	call   389 <panic>
+     3ca:	83 c4 10             	add    $0x10,%esp
+    return pid;
+     3cd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+     3d0:	c9                   	leave
+     3d1:	c3                   	ret
+
+000003d2 <execcmd>:
+//PAGEBREAK!
+// Constructors
+
+struct cmd*
+execcmd(void)
+{
+     3d2:	55                   	push   %ebp
+     3d3:	89 e5                	mov    %esp,%ebp
+     3d5:	83 ec 18             	sub    $0x18,%esp
+    struct execcmd *cmd;
+
+    cmd = malloc(sizeof(*cmd));
+     3d8:	83 ec 0c             	sub    $0xc,%esp
+     3db:	6a 54                	push   $0x54
+     3dd:	e8 68 11 00 00       	call   154a <malloc>
+     3e2:	83 c4 10             	add    $0x10,%esp
+     3e5:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    memset(cmd, 0, sizeof(*cmd));
+     3e8:	83 ec 04             	sub    $0x4,%esp
+     3eb:	6a 54                	push   $0x54
+     3ed:	6a 00                	push   $0x0
+     3ef:	ff 75 f4             	push   -0xc(%ebp)
+     3f2:	e8 33 09 00 00       	call   d2a <memset>
+     3f7:	83 c4 10             	add    $0x10,%esp
+    cmd->type = EXEC;
+     3fa:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     3fd:	c7 00 01 00 00 00    	movl   $0x1,(%eax)
+    return (struct cmd*)cmd;
+     403:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+     406:	c9                   	leave
+     407:	c3                   	ret
+
+00000408 <redircmd>:
+
+struct cmd*
+redircmd(struct cmd *subcmd, char *file, char *efile, int mode, int fd)
+{
+     408:	55                   	push   %ebp
+     409:	89 e5                	mov    %esp,%ebp
+     40b:	83 ec 18             	sub    $0x18,%esp
+    struct redircmd *cmd;
+
+    cmd = malloc(sizeof(*cmd));
+     40e:	83 ec 0c             	sub    $0xc,%esp
+     411:	6a 18                	push   $0x18
+     413:	e8 32 11 00 00       	call   154a <malloc>
+     418:	83 c4 10             	add    $0x10,%esp
+     41b:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    memset(cmd, 0, sizeof(*cmd));
+     41e:	83 ec 04             	sub    $0x4,%esp
+     421:	6a 18                	push   $0x18
+     423:	6a 00                	push   $0x0
+     425:	ff 75 f4             	push   -0xc(%ebp)
+     428:	e8 fd 08 00 00       	call   d2a <memset>
+     42d:	83 c4 10             	add    $0x10,%esp
+    cmd->type = REDIR;
+     430:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     433:	c7 00 02 00 00 00    	movl   $0x2,(%eax)
+    cmd->cmd = subcmd;
+     439:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     43c:	8b 55 08             	mov    0x8(%ebp),%edx
+     43f:	89 50 04             	mov    %edx,0x4(%eax)
+    cmd->file = file;
+     442:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     445:	8b 55 0c             	mov    0xc(%ebp),%edx
+     448:	89 50 08             	mov    %edx,0x8(%eax)
+    cmd->efile = efile;
+     44b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     44e:	8b 55 10             	mov    0x10(%ebp),%edx
+     451:	89 50 0c             	mov    %edx,0xc(%eax)
+    cmd->mode = mode;
+     454:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     457:	8b 55 14             	mov    0x14(%ebp),%edx
+     45a:	89 50 10             	mov    %edx,0x10(%eax)
+    cmd->fd = fd;
+     45d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     460:	8b 55 18             	mov    0x18(%ebp),%edx
+     463:	89 50 14             	mov    %edx,0x14(%eax)
+    return (struct cmd*)cmd;
+     466:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+     469:	c9                   	leave
+     46a:	c3                   	ret
+
+0000046b <pipecmd>:
+
+struct cmd*
+pipecmd(struct cmd *left, struct cmd *right)
+{
+     46b:	55                   	push   %ebp
+     46c:	89 e5                	mov    %esp,%ebp
+     46e:	83 ec 18             	sub    $0x18,%esp
+    struct pipecmd *cmd;
+
+    cmd = malloc(sizeof(*cmd));
+     471:	83 ec 0c             	sub    $0xc,%esp
+     474:	6a 0c                	push   $0xc
+     476:	e8 cf 10 00 00       	call   154a <malloc>
+     47b:	83 c4 10             	add    $0x10,%esp
+     47e:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    memset(cmd, 0, sizeof(*cmd));
+     481:	83 ec 04             	sub    $0x4,%esp
+     484:	6a 0c                	push   $0xc
+     486:	6a 00                	push   $0x0
+     488:	ff 75 f4             	push   -0xc(%ebp)
+     48b:	e8 9a 08 00 00       	call   d2a <memset>
+     490:	83 c4 10             	add    $0x10,%esp
+    cmd->type = PIPE;
+     493:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     496:	c7 00 03 00 00 00    	movl   $0x3,(%eax)
+    cmd->left = left;
+     49c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     49f:	8b 55 08             	mov    0x8(%ebp),%edx
+     4a2:	89 50 04             	mov    %edx,0x4(%eax)
+    cmd->right = right;
+     4a5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     4a8:	8b 55 0c             	mov    0xc(%ebp),%edx
+     4ab:	89 50 08             	mov    %edx,0x8(%eax)
+    return (struct cmd*)cmd;
+     4ae:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+     4b1:	c9                   	leave
+     4b2:	c3                   	ret
+
+000004b3 <listcmd>:
+
+struct cmd*
+listcmd(struct cmd *left, struct cmd *right)
+{
+     4b3:	55                   	push   %ebp
+     4b4:	89 e5                	mov    %esp,%ebp
+     4b6:	83 ec 18             	sub    $0x18,%esp
+    struct listcmd *cmd;
+
+    cmd = malloc(sizeof(*cmd));
+     4b9:	83 ec 0c             	sub    $0xc,%esp
+     4bc:	6a 0c                	push   $0xc
+     4be:	e8 87 10 00 00       	call   154a <malloc>
+     4c3:	83 c4 10             	add    $0x10,%esp
+     4c6:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    memset(cmd, 0, sizeof(*cmd));
+     4c9:	83 ec 04             	sub    $0x4,%esp
+     4cc:	6a 0c                	push   $0xc
+     4ce:	6a 00                	push   $0x0
+     4d0:	ff 75 f4             	push   -0xc(%ebp)
+     4d3:	e8 52 08 00 00       	call   d2a <memset>
+     4d8:	83 c4 10             	add    $0x10,%esp
+    cmd->type = LIST;
+     4db:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     4de:	c7 00 04 00 00 00    	movl   $0x4,(%eax)
+    cmd->left = left;
+     4e4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     4e7:	8b 55 08             	mov    0x8(%ebp),%edx
+     4ea:	89 50 04             	mov    %edx,0x4(%eax)
+    cmd->right = right;
+     4ed:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     4f0:	8b 55 0c             	mov    0xc(%ebp),%edx
+     4f3:	89 50 08             	mov    %edx,0x8(%eax)
+    return (struct cmd*)cmd;
+     4f6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+     4f9:	c9                   	leave
+     4fa:	c3                   	ret
+
+000004fb <backcmd>:
+
+struct cmd*
+backcmd(struct cmd *subcmd)
+{
+     4fb:	55                   	push   %ebp
+     4fc:	89 e5                	mov    %esp,%ebp
+     4fe:	83 ec 18             	sub    $0x18,%esp
+    struct backcmd *cmd;
+
+    cmd = malloc(sizeof(*cmd));
+     501:	83 ec 0c             	sub    $0xc,%esp
+     504:	6a 08                	push   $0x8
+     506:	e8 3f 10 00 00       	call   154a <malloc>
+     50b:	83 c4 10             	add    $0x10,%esp
+     50e:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    memset(cmd, 0, sizeof(*cmd));
+     511:	83 ec 04             	sub    $0x4,%esp
+     514:	6a 08                	push   $0x8
+     516:	6a 00                	push   $0x0
+     518:	ff 75 f4             	push   -0xc(%ebp)
+     51b:	e8 0a 08 00 00       	call   d2a <memset>
+     520:	83 c4 10             	add    $0x10,%esp
+    cmd->type = BACK;
+     523:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     526:	c7 00 05 00 00 00    	movl   $0x5,(%eax)
+    cmd->cmd = subcmd;
+     52c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     52f:	8b 55 08             	mov    0x8(%ebp),%edx
+     532:	89 50 04             	mov    %edx,0x4(%eax)
+    return (struct cmd*)cmd;
+     535:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+     538:	c9                   	leave
+     539:	c3                   	ret
+
+0000053a <gettoken>:
+char whitespace[] = " \t\r\n\v";
+char symbols[] = "<|>&;()";
+
+int
+gettoken(char **ps, char *es, char **q, char **eq)
+{
+     53a:	55                   	push   %ebp
+     53b:	89 e5                	mov    %esp,%ebp
+     53d:	83 ec 18             	sub    $0x18,%esp
+    char *s;
+    int ret;
+
+    s = *ps;
+     540:	8b 45 08             	mov    0x8(%ebp),%eax
+     543:	8b 00                	mov    (%eax),%eax
+     545:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    while(s < es && strchr(whitespace, *s))
+     548:	eb 04                	jmp    54e <gettoken+0x14>
+        s++;
+     54a:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    while(s < es && strchr(whitespace, *s))
+     54e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     551:	3b 45 0c             	cmp    0xc(%ebp),%eax
+     554:	73 1e                	jae    574 <gettoken+0x3a>
+     556:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     559:	0f b6 00             	movzbl (%eax),%eax
+     55c:	0f be c0             	movsbl %al,%eax
+     55f:	83 ec 08             	sub    $0x8,%esp
+     562:	50                   	push   %eax
+     563:	68 d0 1b 00 00       	push   $0x1bd0
+     568:	e8 d7 07 00 00       	call   d44 <strchr>
+     56d:	83 c4 10             	add    $0x10,%esp
+     570:	85 c0                	test   %eax,%eax
+     572:	75 d6                	jne    54a <gettoken+0x10>
+    if(q)
+     574:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+     578:	74 08                	je     582 <gettoken+0x48>
+        *q = s;
+     57a:	8b 45 10             	mov    0x10(%ebp),%eax
+     57d:	8b 55 f4             	mov    -0xc(%ebp),%edx
+     580:	89 10                	mov    %edx,(%eax)
+    ret = *s;
+     582:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     585:	0f b6 00             	movzbl (%eax),%eax
+     588:	0f be c0             	movsbl %al,%eax
+     58b:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    switch(*s){
+     58e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     591:	0f b6 00             	movzbl (%eax),%eax
+     594:	0f be c0             	movsbl %al,%eax
+     597:	83 f8 7c             	cmp    $0x7c,%eax
+     59a:	74 2c                	je     5c8 <gettoken+0x8e>
+     59c:	83 f8 7c             	cmp    $0x7c,%eax
+     59f:	7f 48                	jg     5e9 <gettoken+0xaf>
+     5a1:	83 f8 3e             	cmp    $0x3e,%eax
+     5a4:	74 28                	je     5ce <gettoken+0x94>
+     5a6:	83 f8 3e             	cmp    $0x3e,%eax
+     5a9:	7f 3e                	jg     5e9 <gettoken+0xaf>
+     5ab:	83 f8 3c             	cmp    $0x3c,%eax
+     5ae:	7f 39                	jg     5e9 <gettoken+0xaf>
+     5b0:	83 f8 3b             	cmp    $0x3b,%eax
+     5b3:	7d 13                	jge    5c8 <gettoken+0x8e>
+     5b5:	83 f8 29             	cmp    $0x29,%eax
+     5b8:	7f 2f                	jg     5e9 <gettoken+0xaf>
+     5ba:	83 f8 28             	cmp    $0x28,%eax
+     5bd:	7d 09                	jge    5c8 <gettoken+0x8e>
+     5bf:	85 c0                	test   %eax,%eax
+     5c1:	74 79                	je     63c <gettoken+0x102>
+     5c3:	83 f8 26             	cmp    $0x26,%eax
+     5c6:	75 21                	jne    5e9 <gettoken+0xaf>
+    case '(':
+    case ')':
+    case ';':
+    case '&':
+    case '<':
+        s++;
+     5c8:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+        break;
+     5cc:	eb 75                	jmp    643 <gettoken+0x109>
+    case '>':
+        s++;
+     5ce:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+        if(*s == '>'){
+     5d2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     5d5:	0f b6 00             	movzbl (%eax),%eax
+     5d8:	3c 3e                	cmp    $0x3e,%al
+     5da:	75 63                	jne    63f <gettoken+0x105>
+            ret = '+';
+     5dc:	c7 45 f0 2b 00 00 00 	movl   $0x2b,-0x10(%ebp)
+            s++;
+     5e3:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+        }
+        break;
+     5e7:	eb 56                	jmp    63f <gettoken+0x105>
+    default:
+        ret = 'a';
+     5e9:	c7 45 f0 61 00 00 00 	movl   $0x61,-0x10(%ebp)
+        while(s < es && !strchr(whitespace, *s) && !strchr(symbols, *s))
+     5f0:	eb 04                	jmp    5f6 <gettoken+0xbc>
+            s++;
+     5f2:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+        while(s < es && !strchr(whitespace, *s) && !strchr(symbols, *s))
+     5f6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     5f9:	3b 45 0c             	cmp    0xc(%ebp),%eax
+     5fc:	73 44                	jae    642 <gettoken+0x108>
+     5fe:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     601:	0f b6 00             	movzbl (%eax),%eax
+     604:	0f be c0             	movsbl %al,%eax
+     607:	83 ec 08             	sub    $0x8,%esp
+     60a:	50                   	push   %eax
+     60b:	68 d0 1b 00 00       	push   $0x1bd0
+     610:	e8 2f 07 00 00       	call   d44 <strchr>
+     615:	83 c4 10             	add    $0x10,%esp
+     618:	85 c0                	test   %eax,%eax
+     61a:	75 26                	jne    642 <gettoken+0x108>
+     61c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     61f:	0f b6 00             	movzbl (%eax),%eax
+     622:	0f be c0             	movsbl %al,%eax
+     625:	83 ec 08             	sub    $0x8,%esp
+     628:	50                   	push   %eax
+     629:	68 d8 1b 00 00       	push   $0x1bd8
+     62e:	e8 11 07 00 00       	call   d44 <strchr>
+     633:	83 c4 10             	add    $0x10,%esp
+     636:	85 c0                	test   %eax,%eax
+     638:	74 b8                	je     5f2 <gettoken+0xb8>
+        break;
+     63a:	eb 06                	jmp    642 <gettoken+0x108>
+        break;
+     63c:	90                   	nop
+     63d:	eb 04                	jmp    643 <gettoken+0x109>
+        break;
+     63f:	90                   	nop
+     640:	eb 01                	jmp    643 <gettoken+0x109>
+        break;
+     642:	90                   	nop
+    }
+    if(eq)
+     643:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+     647:	74 0e                	je     657 <gettoken+0x11d>
+        *eq = s;
+     649:	8b 45 14             	mov    0x14(%ebp),%eax
+     64c:	8b 55 f4             	mov    -0xc(%ebp),%edx
+     64f:	89 10                	mov    %edx,(%eax)
+
+    while(s < es && strchr(whitespace, *s))
+     651:	eb 04                	jmp    657 <gettoken+0x11d>
+        s++;
+     653:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    while(s < es && strchr(whitespace, *s))
+     657:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     65a:	3b 45 0c             	cmp    0xc(%ebp),%eax
+     65d:	73 1e                	jae    67d <gettoken+0x143>
+     65f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     662:	0f b6 00             	movzbl (%eax),%eax
+     665:	0f be c0             	movsbl %al,%eax
+     668:	83 ec 08             	sub    $0x8,%esp
+     66b:	50                   	push   %eax
+     66c:	68 d0 1b 00 00       	push   $0x1bd0
+     671:	e8 ce 06 00 00       	call   d44 <strchr>
+     676:	83 c4 10             	add    $0x10,%esp
+     679:	85 c0                	test   %eax,%eax
+     67b:	75 d6                	jne    653 <gettoken+0x119>
+    *ps = s;
+     67d:	8b 45 08             	mov    0x8(%ebp),%eax
+     680:	8b 55 f4             	mov    -0xc(%ebp),%edx
+     683:	89 10                	mov    %edx,(%eax)
+    return ret;
+     685:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+     688:	c9                   	leave
+     689:	c3                   	ret
+
+0000068a <peek>:
+
+int
+peek(char **ps, char *es, char *toks)
+{
+     68a:	55                   	push   %ebp
+     68b:	89 e5                	mov    %esp,%ebp
+     68d:	83 ec 18             	sub    $0x18,%esp
+    char *s;
+
+    s = *ps;
+     690:	8b 45 08             	mov    0x8(%ebp),%eax
+     693:	8b 00                	mov    (%eax),%eax
+     695:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    while(s < es && strchr(whitespace, *s))
+     698:	eb 04                	jmp    69e <peek+0x14>
+        s++;
+     69a:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    while(s < es && strchr(whitespace, *s))
+     69e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     6a1:	3b 45 0c             	cmp    0xc(%ebp),%eax
+     6a4:	73 1e                	jae    6c4 <peek+0x3a>
+     6a6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     6a9:	0f b6 00             	movzbl (%eax),%eax
+     6ac:	0f be c0             	movsbl %al,%eax
+     6af:	83 ec 08             	sub    $0x8,%esp
+     6b2:	50                   	push   %eax
+     6b3:	68 d0 1b 00 00       	push   $0x1bd0
+     6b8:	e8 87 06 00 00       	call   d44 <strchr>
+     6bd:	83 c4 10             	add    $0x10,%esp
+     6c0:	85 c0                	test   %eax,%eax
+     6c2:	75 d6                	jne    69a <peek+0x10>
+    *ps = s;
+     6c4:	8b 45 08             	mov    0x8(%ebp),%eax
+     6c7:	8b 55 f4             	mov    -0xc(%ebp),%edx
+     6ca:	89 10                	mov    %edx,(%eax)
+    return *s && strchr(toks, *s);
+     6cc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     6cf:	0f b6 00             	movzbl (%eax),%eax
+     6d2:	84 c0                	test   %al,%al
+     6d4:	74 23                	je     6f9 <peek+0x6f>
+     6d6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     6d9:	0f b6 00             	movzbl (%eax),%eax
+     6dc:	0f be c0             	movsbl %al,%eax
+     6df:	83 ec 08             	sub    $0x8,%esp
+     6e2:	50                   	push   %eax
+     6e3:	ff 75 10             	push   0x10(%ebp)
+     6e6:	e8 59 06 00 00       	call   d44 <strchr>
+     6eb:	83 c4 10             	add    $0x10,%esp
+     6ee:	85 c0                	test   %eax,%eax
+     6f0:	74 07                	je     6f9 <peek+0x6f>
+     6f2:	b8 01 00 00 00       	mov    $0x1,%eax
+     6f7:	eb 05                	jmp    6fe <peek+0x74>
+     6f9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     6fe:	c9                   	leave
+     6ff:	c3                   	ret
+
+00000700 <parsecmd>:
+struct cmd *parseexec(char**, char*);
+struct cmd *nulterminate(struct cmd*);
+
+struct cmd*
+parsecmd(char *s)
+{
+     700:	55                   	push   %ebp
+     701:	89 e5                	mov    %esp,%ebp
+     703:	53                   	push   %ebx
+     704:	83 ec 14             	sub    $0x14,%esp
+    char *es;
+    struct cmd *cmd;
+
+    es = s + strlen(s);
+     707:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     70a:	8b 45 08             	mov    0x8(%ebp),%eax
+     70d:	83 ec 0c             	sub    $0xc,%esp
+     710:	50                   	push   %eax
+     711:	e8 ed 05 00 00       	call   d03 <strlen>
+     716:	83 c4 10             	add    $0x10,%esp
+     719:	01 d8                	add    %ebx,%eax
+     71b:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    cmd = parseline(&s, es);
+     71e:	83 ec 08             	sub    $0x8,%esp
+     721:	ff 75 f4             	push   -0xc(%ebp)
+     724:	8d 45 08             	lea    0x8(%ebp),%eax
+     727:	50                   	push   %eax
+     728:	e8 61 00 00 00       	call   78e <parseline>
+     72d:	83 c4 10             	add    $0x10,%esp
+     730:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    peek(&s, es, "");
+     733:	83 ec 04             	sub    $0x4,%esp
+     736:	68 9e 16 00 00       	push   $0x169e
+     73b:	ff 75 f4             	push   -0xc(%ebp)
+     73e:	8d 45 08             	lea    0x8(%ebp),%eax
+     741:	50                   	push   %eax
+     742:	e8 43 ff ff ff       	call   68a <peek>
+     747:	83 c4 10             	add    $0x10,%esp
+    if(s != es){
+     74a:	8b 45 08             	mov    0x8(%ebp),%eax
+     74d:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+     750:	74 26                	je     778 <parsecmd+0x78>
+        printf(2, "leftovers: %s\n", s);
+     752:	8b 45 08             	mov    0x8(%ebp),%eax
+     755:	83 ec 04             	sub    $0x4,%esp
+     758:	50                   	push   %eax
+     759:	68 9f 16 00 00       	push   $0x169f
+     75e:	6a 02                	push   $0x2
+     760:	e8 11 0b 00 00       	call   1276 <printf>
+     765:	83 c4 10             	add    $0x10,%esp
+        panic("syntax");
+     768:	83 ec 0c             	sub    $0xc,%esp
+     76b:	68 ae 16 00 00       	push   $0x16ae
+     770:	e8 14 fc ff ff       	call   389 <panic>
+     775:	83 c4 10             	add    $0x10,%esp
+    }
+    nulterminate(cmd);
+     778:	83 ec 0c             	sub    $0xc,%esp
+     77b:	ff 75 f0             	push   -0x10(%ebp)
+     77e:	e8 ef 03 00 00       	call   b72 <nulterminate>
+     783:	83 c4 10             	add    $0x10,%esp
+    return cmd;
+     786:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+     789:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     78c:	c9                   	leave
+     78d:	c3                   	ret
+
+0000078e <parseline>:
+
+struct cmd*
+parseline(char **ps, char *es)
+{
+     78e:	55                   	push   %ebp
+     78f:	89 e5                	mov    %esp,%ebp
+     791:	83 ec 18             	sub    $0x18,%esp
+    struct cmd *cmd;
+
+    cmd = parsepipe(ps, es);
+     794:	83 ec 08             	sub    $0x8,%esp
+     797:	ff 75 0c             	push   0xc(%ebp)
+     79a:	ff 75 08             	push   0x8(%ebp)
+     79d:	e8 99 00 00 00       	call   83b <parsepipe>
+     7a2:	83 c4 10             	add    $0x10,%esp
+     7a5:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    while(peek(ps, es, "&")){
+     7a8:	eb 23                	jmp    7cd <parseline+0x3f>
+        gettoken(ps, es, 0, 0);
+     7aa:	6a 00                	push   $0x0
+     7ac:	6a 00                	push   $0x0
+     7ae:	ff 75 0c             	push   0xc(%ebp)
+     7b1:	ff 75 08             	push   0x8(%ebp)
+     7b4:	e8 81 fd ff ff       	call   53a <gettoken>
+     7b9:	83 c4 10             	add    $0x10,%esp
+        cmd = backcmd(cmd);
+     7bc:	83 ec 0c             	sub    $0xc,%esp
+     7bf:	ff 75 f4             	push   -0xc(%ebp)
+     7c2:	e8 34 fd ff ff       	call   4fb <backcmd>
+     7c7:	83 c4 10             	add    $0x10,%esp
+     7ca:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    while(peek(ps, es, "&")){
+     7cd:	83 ec 04             	sub    $0x4,%esp
+     7d0:	68 b5 16 00 00       	push   $0x16b5
+     7d5:	ff 75 0c             	push   0xc(%ebp)
+     7d8:	ff 75 08             	push   0x8(%ebp)
+     7db:	e8 aa fe ff ff       	call   68a <peek>
+     7e0:	83 c4 10             	add    $0x10,%esp
+     7e3:	85 c0                	test   %eax,%eax
+     7e5:	75 c3                	jne    7aa <parseline+0x1c>
+    }
+    if(peek(ps, es, ";")){
+     7e7:	83 ec 04             	sub    $0x4,%esp
+     7ea:	68 b7 16 00 00       	push   $0x16b7
+     7ef:	ff 75 0c             	push   0xc(%ebp)
+     7f2:	ff 75 08             	push   0x8(%ebp)
+     7f5:	e8 90 fe ff ff       	call   68a <peek>
+     7fa:	83 c4 10             	add    $0x10,%esp
+     7fd:	85 c0                	test   %eax,%eax
+     7ff:	74 35                	je     836 <parseline+0xa8>
+        gettoken(ps, es, 0, 0);
+     801:	6a 00                	push   $0x0
+     803:	6a 00                	push   $0x0
+     805:	ff 75 0c             	push   0xc(%ebp)
+     808:	ff 75 08             	push   0x8(%ebp)
+     80b:	e8 2a fd ff ff       	call   53a <gettoken>
+     810:	83 c4 10             	add    $0x10,%esp
+        cmd = listcmd(cmd, parseline(ps, es));
+     813:	83 ec 08             	sub    $0x8,%esp
+     816:	ff 75 0c             	push   0xc(%ebp)
+     819:	ff 75 08             	push   0x8(%ebp)
+     81c:	e8 6d ff ff ff       	call   78e <parseline>
+     821:	83 c4 10             	add    $0x10,%esp
+     824:	83 ec 08             	sub    $0x8,%esp
+     827:	50                   	push   %eax
+     828:	ff 75 f4             	push   -0xc(%ebp)
+     82b:	e8 83 fc ff ff       	call   4b3 <listcmd>
+     830:	83 c4 10             	add    $0x10,%esp
+     833:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    }
+    return cmd;
+     836:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+     839:	c9                   	leave
+     83a:	c3                   	ret
+
+0000083b <parsepipe>:
+
+struct cmd*
+parsepipe(char **ps, char *es)
+{
+     83b:	55                   	push   %ebp
+     83c:	89 e5                	mov    %esp,%ebp
+     83e:	83 ec 18             	sub    $0x18,%esp
+    struct cmd *cmd;
+
+    cmd = parseexec(ps, es);
+     841:	83 ec 08             	sub    $0x8,%esp
+     844:	ff 75 0c             	push   0xc(%ebp)
+     847:	ff 75 08             	push   0x8(%ebp)
+     84a:	e8 f0 01 00 00       	call   a3f <parseexec>
+     84f:	83 c4 10             	add    $0x10,%esp
+     852:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(peek(ps, es, "|")){
+     855:	83 ec 04             	sub    $0x4,%esp
+     858:	68 b9 16 00 00       	push   $0x16b9
+     85d:	ff 75 0c             	push   0xc(%ebp)
+     860:	ff 75 08             	push   0x8(%ebp)
+     863:	e8 22 fe ff ff       	call   68a <peek>
+     868:	83 c4 10             	add    $0x10,%esp
+     86b:	85 c0                	test   %eax,%eax
+     86d:	74 35                	je     8a4 <parsepipe+0x69>
+        gettoken(ps, es, 0, 0);
+     86f:	6a 00                	push   $0x0
+     871:	6a 00                	push   $0x0
+     873:	ff 75 0c             	push   0xc(%ebp)
+     876:	ff 75 08             	push   0x8(%ebp)
+     879:	e8 bc fc ff ff       	call   53a <gettoken>
+     87e:	83 c4 10             	add    $0x10,%esp
+        cmd = pipecmd(cmd, parsepipe(ps, es));
+     881:	83 ec 08             	sub    $0x8,%esp
+     884:	ff 75 0c             	push   0xc(%ebp)
+     887:	ff 75 08             	push   0x8(%ebp)
+     88a:	e8 ac ff ff ff       	call   83b <parsepipe>
+     88f:	83 c4 10             	add    $0x10,%esp
+     892:	83 ec 08             	sub    $0x8,%esp
+     895:	50                   	push   %eax
+     896:	ff 75 f4             	push   -0xc(%ebp)
+     899:	e8 cd fb ff ff       	call   46b <pipecmd>
+     89e:	83 c4 10             	add    $0x10,%esp
+     8a1:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    }
+    return cmd;
+     8a4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+     8a7:	c9                   	leave
+     8a8:	c3                   	ret
+
+000008a9 <parseredirs>:
+
+struct cmd*
+parseredirs(struct cmd *cmd, char **ps, char *es)
+{
+     8a9:	55                   	push   %ebp
+     8aa:	89 e5                	mov    %esp,%ebp
+     8ac:	83 ec 18             	sub    $0x18,%esp
+    int tok;
+    char *q, *eq;
+
+    while(peek(ps, es, "<>")){
+     8af:	e9 ba 00 00 00       	jmp    96e <parseredirs+0xc5>
+        tok = gettoken(ps, es, 0, 0);
+     8b4:	6a 00                	push   $0x0
+     8b6:	6a 00                	push   $0x0
+     8b8:	ff 75 10             	push   0x10(%ebp)
+     8bb:	ff 75 0c             	push   0xc(%ebp)
+     8be:	e8 77 fc ff ff       	call   53a <gettoken>
+     8c3:	83 c4 10             	add    $0x10,%esp
+     8c6:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        if(gettoken(ps, es, &q, &eq) != 'a')
+     8c9:	8d 45 ec             	lea    -0x14(%ebp),%eax
+     8cc:	50                   	push   %eax
+     8cd:	8d 45 f0             	lea    -0x10(%ebp),%eax
+     8d0:	50                   	push   %eax
+     8d1:	ff 75 10             	push   0x10(%ebp)
+     8d4:	ff 75 0c             	push   0xc(%ebp)
+     8d7:	e8 5e fc ff ff       	call   53a <gettoken>
+     8dc:	83 c4 10             	add    $0x10,%esp
+     8df:	83 f8 61             	cmp    $0x61,%eax
+     8e2:	74 10                	je     8f4 <parseredirs+0x4b>
+            panic("missing file for redirection");
+     8e4:	83 ec 0c             	sub    $0xc,%esp
+     8e7:	68 bb 16 00 00       	push   $0x16bb
+     8ec:	e8 98 fa ff ff       	call   389 <panic>
+     8f1:	83 c4 10             	add    $0x10,%esp
+        switch(tok){
+     8f4:	83 7d f4 3e          	cmpl   $0x3e,-0xc(%ebp)
+     8f8:	74 31                	je     92b <parseredirs+0x82>
+     8fa:	83 7d f4 3e          	cmpl   $0x3e,-0xc(%ebp)
+     8fe:	7f 6e                	jg     96e <parseredirs+0xc5>
+     900:	83 7d f4 2b          	cmpl   $0x2b,-0xc(%ebp)
+     904:	74 47                	je     94d <parseredirs+0xa4>
+     906:	83 7d f4 3c          	cmpl   $0x3c,-0xc(%ebp)
+     90a:	75 62                	jne    96e <parseredirs+0xc5>
+        case '<':
+            cmd = redircmd(cmd, q, eq, O_RDONLY, 0);
+     90c:	8b 55 ec             	mov    -0x14(%ebp),%edx
+     90f:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     912:	83 ec 0c             	sub    $0xc,%esp
+     915:	6a 00                	push   $0x0
+     917:	6a 00                	push   $0x0
+     919:	52                   	push   %edx
+     91a:	50                   	push   %eax
+     91b:	ff 75 08             	push   0x8(%ebp)
+     91e:	e8 e5 fa ff ff       	call   408 <redircmd>
+     923:	83 c4 20             	add    $0x20,%esp
+     926:	89 45 08             	mov    %eax,0x8(%ebp)
+            break;
+     929:	eb 43                	jmp    96e <parseredirs+0xc5>
+        case '>':
+            cmd = redircmd(cmd, q, eq, O_WRONLY|O_CREATE, 1);
+     92b:	8b 55 ec             	mov    -0x14(%ebp),%edx
+     92e:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     931:	83 ec 0c             	sub    $0xc,%esp
+     934:	6a 01                	push   $0x1
+     936:	68 01 02 00 00       	push   $0x201
+     93b:	52                   	push   %edx
+     93c:	50                   	push   %eax
+     93d:	ff 75 08             	push   0x8(%ebp)
+     940:	e8 c3 fa ff ff       	call   408 <redircmd>
+     945:	83 c4 20             	add    $0x20,%esp
+     948:	89 45 08             	mov    %eax,0x8(%ebp)
+            break;
+     94b:	eb 21                	jmp    96e <parseredirs+0xc5>
+        case '+':    // >>
+            cmd = redircmd(cmd, q, eq, O_WRONLY|O_CREATE, 1);
+     94d:	8b 55 ec             	mov    -0x14(%ebp),%edx
+     950:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     953:	83 ec 0c             	sub    $0xc,%esp
+     956:	6a 01                	push   $0x1
+     958:	68 01 02 00 00       	push   $0x201
+     95d:	52                   	push   %edx
+     95e:	50                   	push   %eax
+     95f:	ff 75 08             	push   0x8(%ebp)
+     962:	e8 a1 fa ff ff       	call   408 <redircmd>
+     967:	83 c4 20             	add    $0x20,%esp
+     96a:	89 45 08             	mov    %eax,0x8(%ebp)
+            break;
+     96d:	90                   	nop
+    while(peek(ps, es, "<>")){
+     96e:	83 ec 04             	sub    $0x4,%esp
+     971:	68 d8 16 00 00       	push   $0x16d8
+     976:	ff 75 10             	push   0x10(%ebp)
+     979:	ff 75 0c             	push   0xc(%ebp)
+     97c:	e8 09 fd ff ff       	call   68a <peek>
+     981:	83 c4 10             	add    $0x10,%esp
+     984:	85 c0                	test   %eax,%eax
+     986:	0f 85 28 ff ff ff    	jne    8b4 <parseredirs+0xb>
+        }
+    }
+    return cmd;
+     98c:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+     98f:	c9                   	leave
+     990:	c3                   	ret
+
+00000991 <parseblock>:
+
+struct cmd*
+parseblock(char **ps, char *es)
+{
+     991:	55                   	push   %ebp
+     992:	89 e5                	mov    %esp,%ebp
+     994:	83 ec 18             	sub    $0x18,%esp
+    struct cmd *cmd;
+
+    if(!peek(ps, es, "("))
+     997:	83 ec 04             	sub    $0x4,%esp
+     99a:	68 db 16 00 00       	push   $0x16db
+     99f:	ff 75 0c             	push   0xc(%ebp)
+     9a2:	ff 75 08             	push   0x8(%ebp)
+     9a5:	e8 e0 fc ff ff       	call   68a <peek>
+     9aa:	83 c4 10             	add    $0x10,%esp
+     9ad:	85 c0                	test   %eax,%eax
+     9af:	75 10                	jne    9c1 <parseblock+0x30>
+        panic("parseblock");
+     9b1:	83 ec 0c             	sub    $0xc,%esp
+     9b4:	68 dd 16 00 00       	push   $0x16dd
+     9b9:	e8 cb f9 ff ff       	call   389 <panic>
+     9be:	83 c4 10             	add    $0x10,%esp
+    gettoken(ps, es, 0, 0);
+     9c1:	6a 00                	push   $0x0
+     9c3:	6a 00                	push   $0x0
+     9c5:	ff 75 0c             	push   0xc(%ebp)
+     9c8:	ff 75 08             	push   0x8(%ebp)
+     9cb:	e8 6a fb ff ff       	call   53a <gettoken>
+     9d0:	83 c4 10             	add    $0x10,%esp
+    cmd = parseline(ps, es);
+     9d3:	83 ec 08             	sub    $0x8,%esp
+     9d6:	ff 75 0c             	push   0xc(%ebp)
+     9d9:	ff 75 08             	push   0x8(%ebp)
+     9dc:	e8 ad fd ff ff       	call   78e <parseline>
+     9e1:	83 c4 10             	add    $0x10,%esp
+     9e4:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(!peek(ps, es, ")"))
+     9e7:	83 ec 04             	sub    $0x4,%esp
+     9ea:	68 e8 16 00 00       	push   $0x16e8
+     9ef:	ff 75 0c             	push   0xc(%ebp)
+     9f2:	ff 75 08             	push   0x8(%ebp)
+     9f5:	e8 90 fc ff ff       	call   68a <peek>
+     9fa:	83 c4 10             	add    $0x10,%esp
+     9fd:	85 c0                	test   %eax,%eax
+     9ff:	75 10                	jne    a11 <parseblock+0x80>
+        panic("syntax - missing )");
+     a01:	83 ec 0c             	sub    $0xc,%esp
+     a04:	68 ea 16 00 00       	push   $0x16ea
+     a09:	e8 7b f9 ff ff       	call   389 <panic>
+     a0e:	83 c4 10             	add    $0x10,%esp
+    gettoken(ps, es, 0, 0);
+     a11:	6a 00                	push   $0x0
+     a13:	6a 00                	push   $0x0
+     a15:	ff 75 0c             	push   0xc(%ebp)
+     a18:	ff 75 08             	push   0x8(%ebp)
+     a1b:	e8 1a fb ff ff       	call   53a <gettoken>
+     a20:	83 c4 10             	add    $0x10,%esp
+    cmd = parseredirs(cmd, ps, es);
+     a23:	83 ec 04             	sub    $0x4,%esp
+     a26:	ff 75 0c             	push   0xc(%ebp)
+     a29:	ff 75 08             	push   0x8(%ebp)
+     a2c:	ff 75 f4             	push   -0xc(%ebp)
+     a2f:	e8 75 fe ff ff       	call   8a9 <parseredirs>
+     a34:	83 c4 10             	add    $0x10,%esp
+     a37:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    return cmd;
+     a3a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+     a3d:	c9                   	leave
+     a3e:	c3                   	ret
+
+00000a3f <parseexec>:
+
+struct cmd*
+parseexec(char **ps, char *es)
+{
+     a3f:	55                   	push   %ebp
+     a40:	89 e5                	mov    %esp,%ebp
+     a42:	83 ec 28             	sub    $0x28,%esp
+    char *q, *eq;
+    int tok, argc;
+    struct execcmd *cmd;
+    struct cmd *ret;
+
+    if(peek(ps, es, "("))
+     a45:	83 ec 04             	sub    $0x4,%esp
+     a48:	68 db 16 00 00       	push   $0x16db
+     a4d:	ff 75 0c             	push   0xc(%ebp)
+     a50:	ff 75 08             	push   0x8(%ebp)
+     a53:	e8 32 fc ff ff       	call   68a <peek>
+     a58:	83 c4 10             	add    $0x10,%esp
+     a5b:	85 c0                	test   %eax,%eax
+     a5d:	74 16                	je     a75 <parseexec+0x36>
+        return parseblock(ps, es);
+     a5f:	83 ec 08             	sub    $0x8,%esp
+     a62:	ff 75 0c             	push   0xc(%ebp)
+     a65:	ff 75 08             	push   0x8(%ebp)
+     a68:	e8 24 ff ff ff       	call   991 <parseblock>
+     a6d:	83 c4 10             	add    $0x10,%esp
+     a70:	e9 fb 00 00 00       	jmp    b70 <parseexec+0x131>
+
+    ret = execcmd();
+     a75:	e8 58 f9 ff ff       	call   3d2 <execcmd>
+     a7a:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    cmd = (struct execcmd*)ret;
+     a7d:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     a80:	89 45 ec             	mov    %eax,-0x14(%ebp)
+
+    argc = 0;
+     a83:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    ret = parseredirs(ret, ps, es);
+     a8a:	83 ec 04             	sub    $0x4,%esp
+     a8d:	ff 75 0c             	push   0xc(%ebp)
+     a90:	ff 75 08             	push   0x8(%ebp)
+     a93:	ff 75 f0             	push   -0x10(%ebp)
+     a96:	e8 0e fe ff ff       	call   8a9 <parseredirs>
+     a9b:	83 c4 10             	add    $0x10,%esp
+     a9e:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    while(!peek(ps, es, "|)&;")){
+     aa1:	e9 87 00 00 00       	jmp    b2d <parseexec+0xee>
+        if((tok=gettoken(ps, es, &q, &eq)) == 0)
+     aa6:	8d 45 e0             	lea    -0x20(%ebp),%eax
+     aa9:	50                   	push   %eax
+     aaa:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+     aad:	50                   	push   %eax
+     aae:	ff 75 0c             	push   0xc(%ebp)
+     ab1:	ff 75 08             	push   0x8(%ebp)
+     ab4:	e8 81 fa ff ff       	call   53a <gettoken>
+     ab9:	83 c4 10             	add    $0x10,%esp
+     abc:	89 45 e8             	mov    %eax,-0x18(%ebp)
+     abf:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+     ac3:	0f 84 84 00 00 00    	je     b4d <parseexec+0x10e>
+            break;
+        if(tok != 'a')
+     ac9:	83 7d e8 61          	cmpl   $0x61,-0x18(%ebp)
+     acd:	74 10                	je     adf <parseexec+0xa0>
+            panic("syntax");
+     acf:	83 ec 0c             	sub    $0xc,%esp
+     ad2:	68 ae 16 00 00       	push   $0x16ae
+     ad7:	e8 ad f8 ff ff       	call   389 <panic>
+     adc:	83 c4 10             	add    $0x10,%esp
+        cmd->argv[argc] = q;
+     adf:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+     ae2:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     ae5:	8b 55 f4             	mov    -0xc(%ebp),%edx
+     ae8:	89 4c 90 04          	mov    %ecx,0x4(%eax,%edx,4)
+        cmd->eargv[argc] = eq;
+     aec:	8b 55 e0             	mov    -0x20(%ebp),%edx
+     aef:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     af2:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+     af5:	83 c1 08             	add    $0x8,%ecx
+     af8:	89 54 88 0c          	mov    %edx,0xc(%eax,%ecx,4)
+        argc++;
+     afc:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+        if(argc >= MAXARGS)
+     b00:	83 7d f4 09          	cmpl   $0x9,-0xc(%ebp)
+     b04:	7e 10                	jle    b16 <parseexec+0xd7>
+            panic("too many args");
+     b06:	83 ec 0c             	sub    $0xc,%esp
+     b09:	68 fd 16 00 00       	push   $0x16fd
+     b0e:	e8 76 f8 ff ff       	call   389 <panic>
+     b13:	83 c4 10             	add    $0x10,%esp
+        ret = parseredirs(ret, ps, es);
+     b16:	83 ec 04             	sub    $0x4,%esp
+     b19:	ff 75 0c             	push   0xc(%ebp)
+     b1c:	ff 75 08             	push   0x8(%ebp)
+     b1f:	ff 75 f0             	push   -0x10(%ebp)
+     b22:	e8 82 fd ff ff       	call   8a9 <parseredirs>
+     b27:	83 c4 10             	add    $0x10,%esp
+     b2a:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    while(!peek(ps, es, "|)&;")){
+     b2d:	83 ec 04             	sub    $0x4,%esp
+     b30:	68 0b 17 00 00       	push   $0x170b
+     b35:	ff 75 0c             	push   0xc(%ebp)
+     b38:	ff 75 08             	push   0x8(%ebp)
+     b3b:	e8 4a fb ff ff       	call   68a <peek>
+     b40:	83 c4 10             	add    $0x10,%esp
+     b43:	85 c0                	test   %eax,%eax
+     b45:	0f 84 5b ff ff ff    	je     aa6 <parseexec+0x67>
+     b4b:	eb 01                	jmp    b4e <parseexec+0x10f>
+            break;
+     b4d:	90                   	nop
+    }
+    cmd->argv[argc] = 0;
+     b4e:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     b51:	8b 55 f4             	mov    -0xc(%ebp),%edx
+     b54:	c7 44 90 04 00 00 00 	movl   $0x0,0x4(%eax,%edx,4)
+     b5b:	00 
+    cmd->eargv[argc] = 0;
+     b5c:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     b5f:	8b 55 f4             	mov    -0xc(%ebp),%edx
+     b62:	83 c2 08             	add    $0x8,%edx
+     b65:	c7 44 90 0c 00 00 00 	movl   $0x0,0xc(%eax,%edx,4)
+     b6c:	00 
+    return ret;
+     b6d:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+     b70:	c9                   	leave
+     b71:	c3                   	ret
+
+00000b72 <nulterminate>:
+
+// NUL-terminate all the counted strings.
+struct cmd*
+nulterminate(struct cmd *cmd)
+{
+     b72:	55                   	push   %ebp
+     b73:	89 e5                	mov    %esp,%ebp
+     b75:	83 ec 28             	sub    $0x28,%esp
+    struct execcmd *ecmd;
+    struct listcmd *lcmd;
+    struct pipecmd *pcmd;
+    struct redircmd *rcmd;
+
+    if(cmd == 0)
+     b78:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+     b7c:	75 0a                	jne    b88 <nulterminate+0x16>
+        return 0;
+     b7e:	b8 00 00 00 00       	mov    $0x0,%eax
+     b83:	e9 e4 00 00 00       	jmp    c6c <nulterminate+0xfa>
+
+    switch(cmd->type){
+     b88:	8b 45 08             	mov    0x8(%ebp),%eax
+     b8b:	8b 00                	mov    (%eax),%eax
+     b8d:	83 f8 05             	cmp    $0x5,%eax
+     b90:	0f 87 d3 00 00 00    	ja     c69 <nulterminate+0xf7>
+     b96:	8b 04 85 10 17 00 00 	mov    0x1710(,%eax,4),%eax
+     b9d:	ff e0                	jmp    *%eax
+    case EXEC:
+        ecmd = (struct execcmd*)cmd;
+     b9f:	8b 45 08             	mov    0x8(%ebp),%eax
+     ba2:	89 45 e0             	mov    %eax,-0x20(%ebp)
+        for(i=0; ecmd->argv[i]; i++)
+     ba5:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     bac:	eb 14                	jmp    bc2 <nulterminate+0x50>
+            *ecmd->eargv[i] = 0;
+     bae:	8b 45 e0             	mov    -0x20(%ebp),%eax
+     bb1:	8b 55 f4             	mov    -0xc(%ebp),%edx
+     bb4:	83 c2 08             	add    $0x8,%edx
+     bb7:	8b 44 90 0c          	mov    0xc(%eax,%edx,4),%eax
+     bbb:	c6 00 00             	movb   $0x0,(%eax)
+        for(i=0; ecmd->argv[i]; i++)
+     bbe:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+     bc2:	8b 45 e0             	mov    -0x20(%ebp),%eax
+     bc5:	8b 55 f4             	mov    -0xc(%ebp),%edx
+     bc8:	8b 44 90 04          	mov    0x4(%eax,%edx,4),%eax
+     bcc:	85 c0                	test   %eax,%eax
+     bce:	75 de                	jne    bae <nulterminate+0x3c>
+        break;
+     bd0:	e9 94 00 00 00       	jmp    c69 <nulterminate+0xf7>
+
+    case REDIR:
+        rcmd = (struct redircmd*)cmd;
+     bd5:	8b 45 08             	mov    0x8(%ebp),%eax
+     bd8:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        nulterminate(rcmd->cmd);
+     bdb:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     bde:	8b 40 04             	mov    0x4(%eax),%eax
+     be1:	83 ec 0c             	sub    $0xc,%esp
+     be4:	50                   	push   %eax
+     be5:	e8 88 ff ff ff       	call   b72 <nulterminate>
+     bea:	83 c4 10             	add    $0x10,%esp
+        *rcmd->efile = 0;
+     bed:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     bf0:	8b 40 0c             	mov    0xc(%eax),%eax
+     bf3:	c6 00 00             	movb   $0x0,(%eax)
+        break;
+     bf6:	eb 71                	jmp    c69 <nulterminate+0xf7>
+
+    case PIPE:
+        pcmd = (struct pipecmd*)cmd;
+     bf8:	8b 45 08             	mov    0x8(%ebp),%eax
+     bfb:	89 45 e8             	mov    %eax,-0x18(%ebp)
+        nulterminate(pcmd->left);
+     bfe:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     c01:	8b 40 04             	mov    0x4(%eax),%eax
+     c04:	83 ec 0c             	sub    $0xc,%esp
+     c07:	50                   	push   %eax
+     c08:	e8 65 ff ff ff       	call   b72 <nulterminate>
+     c0d:	83 c4 10             	add    $0x10,%esp
+        nulterminate(pcmd->right);
+     c10:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     c13:	8b 40 08             	mov    0x8(%eax),%eax
+     c16:	83 ec 0c             	sub    $0xc,%esp
+     c19:	50                   	push   %eax
+     c1a:	e8 53 ff ff ff       	call   b72 <nulterminate>
+     c1f:	83 c4 10             	add    $0x10,%esp
+        break;
+     c22:	eb 45                	jmp    c69 <nulterminate+0xf7>
+
+    case LIST:
+        lcmd = (struct listcmd*)cmd;
+     c24:	8b 45 08             	mov    0x8(%ebp),%eax
+     c27:	89 45 ec             	mov    %eax,-0x14(%ebp)
+        nulterminate(lcmd->left);
+     c2a:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     c2d:	8b 40 04             	mov    0x4(%eax),%eax
+     c30:	83 ec 0c             	sub    $0xc,%esp
+     c33:	50                   	push   %eax
+     c34:	e8 39 ff ff ff       	call   b72 <nulterminate>
+     c39:	83 c4 10             	add    $0x10,%esp
+        nulterminate(lcmd->right);
+     c3c:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     c3f:	8b 40 08             	mov    0x8(%eax),%eax
+     c42:	83 ec 0c             	sub    $0xc,%esp
+     c45:	50                   	push   %eax
+     c46:	e8 27 ff ff ff       	call   b72 <nulterminate>
+     c4b:	83 c4 10             	add    $0x10,%esp
+        break;
+     c4e:	eb 19                	jmp    c69 <nulterminate+0xf7>
+
+    case BACK:
+        bcmd = (struct backcmd*)cmd;
+     c50:	8b 45 08             	mov    0x8(%ebp),%eax
+     c53:	89 45 f0             	mov    %eax,-0x10(%ebp)
+        nulterminate(bcmd->cmd);
+     c56:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     c59:	8b 40 04             	mov    0x4(%eax),%eax
+     c5c:	83 ec 0c             	sub    $0xc,%esp
+     c5f:	50                   	push   %eax
+     c60:	e8 0d ff ff ff       	call   b72 <nulterminate>
+     c65:	83 c4 10             	add    $0x10,%esp
+        break;
+     c68:	90                   	nop
+    }
+    return cmd;
+     c69:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+     c6c:	c9                   	leave
+     c6d:	c3                   	ret
+
+00000c6e <stosb>:
+strchr(const char *s, char c)
+{
+    for(; *s; s++)
+        if(*s == c)
+            return (char*)s;
+    return 0;
+     c6e:	55                   	push   %ebp
+     c6f:	89 e5                	mov    %esp,%ebp
+     c71:	57                   	push   %edi
+     c72:	53                   	push   %ebx
+}
+     c73:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     c76:	8b 55 10             	mov    0x10(%ebp),%edx
+     c79:	8b 45 0c             	mov    0xc(%ebp),%eax
+     c7c:	89 cb                	mov    %ecx,%ebx
+     c7e:	89 df                	mov    %ebx,%edi
+     c80:	89 d1                	mov    %edx,%ecx
+     c82:	fc                   	cld
+     c83:	f3 aa                	rep stos %al,%es:(%edi)
+     c85:	89 ca                	mov    %ecx,%edx
+     c87:	89 fb                	mov    %edi,%ebx
+     c89:	89 5d 08             	mov    %ebx,0x8(%ebp)
+     c8c:	89 55 10             	mov    %edx,0x10(%ebp)
+
+char*
+gets(char *buf, int max)
+{
+     c8f:	90                   	nop
+     c90:	5b                   	pop    %ebx
+     c91:	5f                   	pop    %edi
+     c92:	5d                   	pop    %ebp
+     c93:	c3                   	ret
+
+00000c94 <strcpy>:
+{
+     c94:	55                   	push   %ebp
+     c95:	89 e5                	mov    %esp,%ebp
+     c97:	83 ec 10             	sub    $0x10,%esp
+    os = s;
+     c9a:	8b 45 08             	mov    0x8(%ebp),%eax
+     c9d:	89 45 fc             	mov    %eax,-0x4(%ebp)
+    while((*s++ = *t++) != 0)
+     ca0:	90                   	nop
+     ca1:	8b 55 0c             	mov    0xc(%ebp),%edx
+     ca4:	8d 42 01             	lea    0x1(%edx),%eax
+     ca7:	89 45 0c             	mov    %eax,0xc(%ebp)
+     caa:	8b 45 08             	mov    0x8(%ebp),%eax
+     cad:	8d 48 01             	lea    0x1(%eax),%ecx
+     cb0:	89 4d 08             	mov    %ecx,0x8(%ebp)
+     cb3:	0f b6 12             	movzbl (%edx),%edx
+     cb6:	88 10                	mov    %dl,(%eax)
+     cb8:	0f b6 00             	movzbl (%eax),%eax
+     cbb:	84 c0                	test   %al,%al
+     cbd:	75 e2                	jne    ca1 <strcpy+0xd>
+    return os;
+     cbf:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+     cc2:	c9                   	leave
+     cc3:	c3                   	ret
+
+00000cc4 <strcmp>:
+{
+     cc4:	55                   	push   %ebp
+     cc5:	89 e5                	mov    %esp,%ebp
+    while(*p && *p == *q)
+     cc7:	eb 08                	jmp    cd1 <strcmp+0xd>
+        p++, q++;
+     cc9:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+     ccd:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+    while(*p && *p == *q)
+     cd1:	8b 45 08             	mov    0x8(%ebp),%eax
+     cd4:	0f b6 00             	movzbl (%eax),%eax
+     cd7:	84 c0                	test   %al,%al
+     cd9:	74 10                	je     ceb <strcmp+0x27>
+     cdb:	8b 45 08             	mov    0x8(%ebp),%eax
+     cde:	0f b6 10             	movzbl (%eax),%edx
+     ce1:	8b 45 0c             	mov    0xc(%ebp),%eax
+     ce4:	0f b6 00             	movzbl (%eax),%eax
+     ce7:	38 c2                	cmp    %al,%dl
+     ce9:	74 de                	je     cc9 <strcmp+0x5>
+    return (uchar)*p - (uchar)*q;
+     ceb:	8b 45 08             	mov    0x8(%ebp),%eax
+     cee:	0f b6 00             	movzbl (%eax),%eax
+     cf1:	0f b6 d0             	movzbl %al,%edx
+     cf4:	8b 45 0c             	mov    0xc(%ebp),%eax
+     cf7:	0f b6 00             	movzbl (%eax),%eax
+     cfa:	0f b6 c0             	movzbl %al,%eax
+     cfd:	29 c2                	sub    %eax,%edx
+     cff:	89 d0                	mov    %edx,%eax
+}
+     d01:	5d                   	pop    %ebp
+     d02:	c3                   	ret
+
+00000d03 <strlen>:
+{
+     d03:	55                   	push   %ebp
+     d04:	89 e5                	mov    %esp,%ebp
+     d06:	83 ec 10             	sub    $0x10,%esp
+    for(n = 0; s[n]; n++)
+     d09:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+     d10:	eb 04                	jmp    d16 <strlen+0x13>
+     d12:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+     d16:	8b 55 fc             	mov    -0x4(%ebp),%edx
+     d19:	8b 45 08             	mov    0x8(%ebp),%eax
+     d1c:	01 d0                	add    %edx,%eax
+     d1e:	0f b6 00             	movzbl (%eax),%eax
+     d21:	84 c0                	test   %al,%al
+     d23:	75 ed                	jne    d12 <strlen+0xf>
+    return n;
+     d25:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+     d28:	c9                   	leave
+     d29:	c3                   	ret
+
+00000d2a <memset>:
+{
+     d2a:	55                   	push   %ebp
+     d2b:	89 e5                	mov    %esp,%ebp
+    stosb(dst, c, n);
+     d2d:	8b 45 10             	mov    0x10(%ebp),%eax
+     d30:	50                   	push   %eax
+     d31:	ff 75 0c             	push   0xc(%ebp)
+     d34:	ff 75 08             	push   0x8(%ebp)
+     d37:	e8 32 ff ff ff       	call   c6e <stosb>
+     d3c:	83 c4 0c             	add    $0xc,%esp
+    return dst;
+     d3f:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+     d42:	c9                   	leave
+     d43:	c3                   	ret
+
+00000d44 <strchr>:
+{
+     d44:	55                   	push   %ebp
+     d45:	89 e5                	mov    %esp,%ebp
+     d47:	83 ec 04             	sub    $0x4,%esp
+     d4a:	8b 45 0c             	mov    0xc(%ebp),%eax
+     d4d:	88 45 fc             	mov    %al,-0x4(%ebp)
+    for(; *s; s++)
+     d50:	eb 14                	jmp    d66 <strchr+0x22>
+        if(*s == c)
+     d52:	8b 45 08             	mov    0x8(%ebp),%eax
+     d55:	0f b6 00             	movzbl (%eax),%eax
+     d58:	38 45 fc             	cmp    %al,-0x4(%ebp)
+     d5b:	75 05                	jne    d62 <strchr+0x1e>
+            return (char*)s;
+     d5d:	8b 45 08             	mov    0x8(%ebp),%eax
+     d60:	eb 13                	jmp    d75 <strchr+0x31>
+    for(; *s; s++)
+     d62:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+     d66:	8b 45 08             	mov    0x8(%ebp),%eax
+     d69:	0f b6 00             	movzbl (%eax),%eax
+     d6c:	84 c0                	test   %al,%al
+     d6e:	75 e2                	jne    d52 <strchr+0xe>
+    return 0;
+     d70:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     d75:	c9                   	leave
+     d76:	c3                   	ret
+
+00000d77 <gets>:
+{
+     d77:	55                   	push   %ebp
+     d78:	89 e5                	mov    %esp,%ebp
+     d7a:	83 ec 18             	sub    $0x18,%esp
+    int i, cc;
+    char c;
+
+    for(i=0; i+1 < max; ){
+     d7d:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     d84:	eb 42                	jmp    dc8 <gets+0x51>
+        cc = read(0, &c, 1);
+     d86:	83 ec 04             	sub    $0x4,%esp
+     d89:	6a 01                	push   $0x1
+     d8b:	8d 45 ef             	lea    -0x11(%ebp),%eax
+     d8e:	50                   	push   %eax
+     d8f:	6a 00                	push   $0x0
+     d91:	e8 f7 01 00 00       	call   f8d <read>
+     d96:	83 c4 10             	add    $0x10,%esp
+     d99:	89 45 f0             	mov    %eax,-0x10(%ebp)
+        if(cc < 1)
+     d9c:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+     da0:	7e 33                	jle    dd5 <gets+0x5e>
+            break;
+        buf[i++] = c;
+     da2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     da5:	8d 50 01             	lea    0x1(%eax),%edx
+     da8:	89 55 f4             	mov    %edx,-0xc(%ebp)
+     dab:	89 c2                	mov    %eax,%edx
+     dad:	8b 45 08             	mov    0x8(%ebp),%eax
+     db0:	01 c2                	add    %eax,%edx
+     db2:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+     db6:	88 02                	mov    %al,(%edx)
+        if(c == '\n' || c == '\r')
+     db8:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+     dbc:	3c 0a                	cmp    $0xa,%al
+     dbe:	74 16                	je     dd6 <gets+0x5f>
+     dc0:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+     dc4:	3c 0d                	cmp    $0xd,%al
+     dc6:	74 0e                	je     dd6 <gets+0x5f>
+    for(i=0; i+1 < max; ){
+     dc8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     dcb:	83 c0 01             	add    $0x1,%eax
+     dce:	39 45 0c             	cmp    %eax,0xc(%ebp)
+     dd1:	7f b3                	jg     d86 <gets+0xf>
+     dd3:	eb 01                	jmp    dd6 <gets+0x5f>
+            break;
+     dd5:	90                   	nop
+            break;
+    }
+    buf[i] = '\0';
+     dd6:	8b 55 f4             	mov    -0xc(%ebp),%edx
+     dd9:	8b 45 08             	mov    0x8(%ebp),%eax
+     ddc:	01 d0                	add    %edx,%eax
+     dde:	c6 00 00             	movb   $0x0,(%eax)
+    return buf;
+     de1:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+     de4:	c9                   	leave
+     de5:	c3                   	ret
+
+00000de6 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+     de6:	55                   	push   %ebp
+     de7:	89 e5                	mov    %esp,%ebp
+     de9:	83 ec 18             	sub    $0x18,%esp
+    int fd;
+    int r;
+
+    fd = open(n, O_RDONLY);
+     dec:	83 ec 08             	sub    $0x8,%esp
+     def:	6a 00                	push   $0x0
+     df1:	ff 75 08             	push   0x8(%ebp)
+     df4:	e8 c6 01 00 00       	call   fbf <open>
+     df9:	83 c4 10             	add    $0x10,%esp
+     dfc:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(fd < 0)
+     dff:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     e03:	79 07                	jns    e0c <stat+0x26>
+        return -1;
+     e05:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     e0a:	eb 25                	jmp    e31 <stat+0x4b>
+    r = fstat(fd, st);
+     e0c:	83 ec 08             	sub    $0x8,%esp
+     e0f:	ff 75 0c             	push   0xc(%ebp)
+     e12:	ff 75 f4             	push   -0xc(%ebp)
+     e15:	e8 c3 01 00 00       	call   fdd <fstat>
+     e1a:	83 c4 10             	add    $0x10,%esp
+     e1d:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    close(fd);
+     e20:	83 ec 0c             	sub    $0xc,%esp
+     e23:	ff 75 f4             	push   -0xc(%ebp)
+     e26:	e8 76 01 00 00       	call   fa1 <close>
+     e2b:	83 c4 10             	add    $0x10,%esp
+    return r;
+     e2e:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+     e31:	c9                   	leave
+     e32:	c3                   	ret
+
+00000e33 <atoi>:
+
+int
+atoi(const char *s)
+{
+     e33:	55                   	push   %ebp
+     e34:	89 e5                	mov    %esp,%ebp
+     e36:	83 ec 10             	sub    $0x10,%esp
+    int n;
+
+    n = 0;
+     e39:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+    while('0' <= *s && *s <= '9')
+     e40:	eb 25                	jmp    e67 <atoi+0x34>
+        n = n*10 + *s++ - '0';
+     e42:	8b 55 fc             	mov    -0x4(%ebp),%edx
+     e45:	89 d0                	mov    %edx,%eax
+     e47:	c1 e0 02             	shl    $0x2,%eax
+     e4a:	01 d0                	add    %edx,%eax
+     e4c:	01 c0                	add    %eax,%eax
+     e4e:	89 c1                	mov    %eax,%ecx
+     e50:	8b 45 08             	mov    0x8(%ebp),%eax
+     e53:	8d 50 01             	lea    0x1(%eax),%edx
+     e56:	89 55 08             	mov    %edx,0x8(%ebp)
+     e59:	0f b6 00             	movzbl (%eax),%eax
+     e5c:	0f be c0             	movsbl %al,%eax
+     e5f:	01 c8                	add    %ecx,%eax
+     e61:	83 e8 30             	sub    $0x30,%eax
+     e64:	89 45 fc             	mov    %eax,-0x4(%ebp)
+    while('0' <= *s && *s <= '9')
+     e67:	8b 45 08             	mov    0x8(%ebp),%eax
+     e6a:	0f b6 00             	movzbl (%eax),%eax
+     e6d:	3c 2f                	cmp    $0x2f,%al
+     e6f:	7e 0a                	jle    e7b <atoi+0x48>
+     e71:	8b 45 08             	mov    0x8(%ebp),%eax
+     e74:	0f b6 00             	movzbl (%eax),%eax
+     e77:	3c 39                	cmp    $0x39,%al
+     e79:	7e c7                	jle    e42 <atoi+0xf>
+    return n;
+     e7b:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+     e7e:	c9                   	leave
+     e7f:	c3                   	ret
+
+00000e80 <nice>:
+
+// Add inc to the caller's nice value; return the new value.
+int
+nice(int inc)
+{
+     e80:	55                   	push   %ebp
+     e81:	89 e5                	mov    %esp,%ebp
+     e83:	83 ec 18             	sub    $0x18,%esp
+    int n;
+
+    n = getpriority(0) + inc;
+     e86:	83 ec 0c             	sub    $0xc,%esp
+     e89:	6a 00                	push   $0x0
+     e8b:	e8 d9 01 00 00       	call   1069 <getpriority>
+     e90:	83 c4 10             	add    $0x10,%esp
+     e93:	8b 55 08             	mov    0x8(%ebp),%edx
+     e96:	01 d0                	add    %edx,%eax
+     e98:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(n < 0)
+     e9b:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     e9f:	79 07                	jns    ea8 <nice+0x28>
+        n = 0;
+     ea1:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    if(n > NICEMAX)
+     ea8:	83 7d f4 13          	cmpl   $0x13,-0xc(%ebp)
+     eac:	7e 07                	jle    eb5 <nice+0x35>
+        n = NICEMAX;
+     eae:	c7 45 f4 13 00 00 00 	movl   $0x13,-0xc(%ebp)
+    if(setpriority(0, n) < 0)
+     eb5:	83 ec 08             	sub    $0x8,%esp
+     eb8:	ff 75 f4             	push   -0xc(%ebp)
+     ebb:	6a 00                	push   $0x0
+     ebd:	e8 b1 01 00 00       	call   1073 <setpriority>
+     ec2:	83 c4 10             	add    $0x10,%esp
+     ec5:	85 c0                	test   %eax,%eax
+     ec7:	79 07                	jns    ed0 <nice+0x50>
+        return -1;
+     ec9:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     ece:	eb 03                	jmp    ed3 <nice+0x53>
+    return n;
+     ed0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+     ed3:	c9                   	leave
+     ed4:	c3                   	ret
+
+00000ed5 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+     ed5:	55                   	push   %ebp
+     ed6:	89 e5                	mov    %esp,%ebp
+     ed8:	83 ec 10             	sub    $0x10,%esp
+    char *dst;
+    const char *src;
+
+    dst = vdst;
+     edb:	8b 45 08             	mov    0x8(%ebp),%eax
+     ede:	89 45 fc             	mov    %eax,-0x4(%ebp)
+    src = vsrc;
+     ee1:	8b 45 0c             	mov    0xc(%ebp),%eax
+     ee4:	89 45 f8             	mov    %eax,-0x8(%ebp)
+    while(n-- > 0)
+     ee7:	eb 17                	jmp    f00 <memmove+0x2b>
+        *dst++ = *src++;
+     ee9:	8b 55 f8             	mov    -0x8(%ebp),%edx
+     eec:	8d 42 01             	lea    0x1(%edx),%eax
+     eef:	89 45 f8             	mov    %eax,-0x8(%ebp)
+     ef2:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     ef5:	8d 48 01             	lea    0x1(%eax),%ecx
+     ef8:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+     efb:	0f b6 12             	movzbl (%edx),%edx
+     efe:	88 10                	mov    %dl,(%eax)
+    while(n-- > 0)
+     f00:	8b 45 10             	mov    0x10(%ebp),%eax
+     f03:	8d 50 ff             	lea    -0x1(%eax),%edx
+     f06:	89 55 10             	mov    %edx,0x10(%ebp)
+     f09:	85 c0                	test   %eax,%eax
+     f0b:	7f dc                	jg     ee9 <memmove+0x14>
+    return vdst;
+     f0d:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+     f10:	c9                   	leave
+     f11:	c3                   	ret
+
+00000f12 <dosyscall>:
+sysmode:
+    .long 0
+
+    .text
+dosyscall:
+    cmpl $0, sysmode
+     f12:	83 3d e0 1b 00 00 00 	cmpl   $0x0,0x1be0
+    jg 2f
+     f19:	7f 0c                	jg     f27 <dosyscall+0x15>
+    jl 1f
+     f1b:	7c 07                	jl     f24 <dosyscall+0x12>
+    call sepcheck
+     f1d:	e8 27 00 00 00       	call   f49 <sepcheck>
+    jmp dosyscall
+     f22:	eb ee                	jmp    f12 <dosyscall>
+1:
+    int $T_SYSCALL
+     f24:	cd 40                	int    $0x40
+    ret
+     f26:	c3                   	ret
+2:
+    pushl %ebx
+     f27:	53                   	push   %ebx
+    pushl %esi
+     f28:	56                   	push   %esi
+    pushl %edi
+     f29:	57                   	push   %edi
+    pushl %ebp
+     f2a:	55                   	push   %ebp
+    movl 20(%esp), %ebx
+     f2b:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+    movl 24(%esp), %esi
+     f2f:	8b 74 24 18          	mov    0x18(%esp),%esi
+    movl 28(%esp), %edi
+     f33:	8b 7c 24 1c          	mov    0x1c(%esp),%edi
+    movl 32(%esp), %ebp
+     f37:	8b 6c 24 20          	mov    0x20(%esp),%ebp
+    movl %esp, %ecx
+     f3b:	89 e1                	mov    %esp,%ecx
+    movl $3f, %edx
+     f3d:	ba 44 0f 00 00       	mov    $0xf44,%edx
+    sysenter
+     f42:	0f 34                	sysenter
+3:
+    popl %ebp
+     f44:	5d                   	pop    %ebp
+    popl %edi
+     f45:	5f                   	pop    %edi
+    popl %esi
+     f46:	5e                   	pop    %esi
+    popl %ebx
+     f47:	5b                   	pop    %ebx
+    ret
+     f48:	c3                   	ret
+
+00000f49 <sepcheck>:
+
+# Set sysmode from cpuid's SEP flag.    Preserves %eax.
+sepcheck:
+    pushl %eax
+     f49:	50                   	push   %eax
+    pushl %ebx
+     f4a:	53                   	push   %ebx
+    movl $1, %eax
+     f4b:	b8 01 00 00 00       	mov    $0x1,%eax
+    cpuid
+     f50:	0f a2                	cpuid
+    movl $-1, sysmode
+     f52:	c7 05 e0 1b 00 00 ff 	movl   $0xffffffff,0x1be0
+     f59:	ff ff ff 
+    testl $0x800, %edx
+     f5c:	f7 c2 00 08 00 00    	test   $0x800,%edx
+    jz 1f
+     f62:	74 0a                	je     f6e <sepcheck+0x25>
+    movl $1, sysmode
+     f64:	c7 05 e0 1b 00 00 01 	movl   $0x1,0x1be0
+     f6b:	00 00 00 
+1:
+    popl %ebx
+     f6e:	5b                   	pop    %ebx
+    popl %eax
+     f6f:	58                   	pop    %eax
+    ret
+     f70:	c3                   	ret
+
+00000f71 <fork>:
+
+SYSCALL(fork)
+     f71:	b8 01 00 00 00       	mov    $0x1,%eax
+     f76:	eb 9a                	jmp    f12 <dosyscall>
+
+00000f78 <exit>:
+SYSCALL(exit)
+     f78:	b8 02 00 00 00       	mov    $0x2,%eax
+     f7d:	eb 93                	jmp    f12 <dosyscall>
+
+00000f7f <wait>:
+SYSCALL(wait)
+     f7f:	b8 03 00 00 00       	mov    $0x3,%eax
+     f84:	eb 8c                	jmp    f12 <dosyscall>
+
+00000f86 <pipe>:
+SYSCALL(pipe)
+     f86:	b8 04 00 00 00       	mov    $0x4,%eax
+     f8b:	eb 85                	jmp    f12 <dosyscall>
+
+00000f8d <read>:
+SYSCALL(read)
+     f8d:	b8 05 00 00 00       	mov    $0x5,%eax
+     f92:	e9 7b ff ff ff       	jmp    f12 <dosyscall>
+
+00000f97 <write>:
+SYSCALL(write)
+     f97:	b8 10 00 00 00       	mov    $0x10,%eax
+     f9c:	e9 71 ff ff ff       	jmp    f12 <dosyscall>
+
+00000fa1 <close>:
+SYSCALL(close)
+     fa1:	b8 15 00 00 00       	mov    $0x15,%eax
+     fa6:	e9 67 ff ff ff       	jmp    f12 <dosyscall>
+
+00000fab <kill>:
+SYSCALL(kill)
+     fab:	b8 06 00 00 00       	mov    $0x6,%eax
+     fb0:	e9 5d ff ff ff       	jmp    f12 <dosyscall>
+
+00000fb5 <exec>:
+SYSCALL(exec)
+     fb5:	b8 07 00 00 00       	mov    $0x7,%eax
+     fba:	e9 53 ff ff ff       	jmp    f12 <dosyscall>
+
+00000fbf <open>:
+SYSCALL(open)
+     fbf:	b8 0f 00 00 00       	mov    $0xf,%eax
+     fc4:	e9 49 ff ff ff       	jmp    f12 <dosyscall>
+
+00000fc9 <mknod>:
+SYSCALL(mknod)
+     fc9:	b8 11 00 00 00       	mov    $0x11,%eax
+     fce:	e9 3f ff ff ff       	jmp    f12 <dosyscall>
+
+00000fd3 <unlink>:
+SYSCALL(unlink)
+     fd3:	b8 12 00 00 00       	mov    $0x12,%eax
+     fd8:	e9 35 ff ff ff       	jmp    f12 <dosyscall>
+
+00000fdd <fstat>:
+SYSCALL(fstat)
+     fdd:	b8 08 00 00 00       	mov    $0x8,%eax
+     fe2:	e9 2b ff ff ff       	jmp    f12 <dosyscall>
+
+00000fe7 <link>:
+SYSCALL(link)
+     fe7:	b8 13 00 00 00       	mov    $0x13,%eax
+     fec:	e9 21 ff ff ff       	jmp    f12 <dosyscall>
+
+00000ff1 <mkdir>:
+SYSCALL(mkdir)
+     ff1:	b8 14 00 00 00       	mov    $0x14,%eax
+     ff6:	e9 17 ff ff ff       	jmp    f12 <dosyscall>
+
+00000ffb <chdir>:
+SYSCALL(chdir)
+     ffb:	b8 09 00 00 00       	mov    $0x9,%eax
+    1000:	e9 0d ff ff ff       	jmp    f12 <dosyscall>
+
+00001005 <dup>:
+SYSCALL(dup)
+    1005:	b8 0a 00 00 00       	mov    $0xa,%eax
+    100a:	e9 03 ff ff ff       	jmp    f12 <dosyscall>
+
+0000100f <getpid>:
+SYSCALL(getpid)
+    100f:	b8 0b 00 00 00       	mov    $0xb,%eax
+    1014:	e9 f9 fe ff ff       	jmp    f12 <dosyscall>
+
+00001019 <sbrk>:
+SYSCALL(sbrk)
+    1019:	b8 0c 00 00 00       	mov    $0xc,%eax
+    101e:	e9 ef fe ff ff       	jmp    f12 <dosyscall>
+
+00001023 <sleep>:
+SYSCALL(sleep)
+    1023:	b8 0d 00 00 00       	mov    $0xd,%eax
+    1028:	e9 e5 fe ff ff       	jmp    f12 <dosyscall>
+
+0000102d <uptime>:
+SYSCALL(uptime)
+    102d:	b8 0e 00 00 00       	mov    $0xe,%eax
+    1032:	e9 db fe ff ff       	jmp    f12 <dosyscall>
+
+00001037 <date>:
+SYSCALL(date)
+    1037:	b8 16 00 00 00       	mov    $0x16,%eax
+    103c:	e9 d1 fe ff ff       	jmp    f12 <dosyscall>
+
+00001041 <dup2>:
+SYSCALL(dup2)
+    1041:	b8 17 00 00 00       	mov    $0x17,%eax
+    1046:	e9 c7 fe ff ff       	jmp    f12 <dosyscall>
+
+0000104b <uffd>:
+SYSCALL(uffd)
+    104b:	b8 1a 00 00 00       	mov    $0x1a,%eax
+    1050:	e9 bd fe ff ff       	jmp    f12 <dosyscall>
+
+00001055 <uffdregister>:
+SYSCALL(uffdregister)
+    1055:	b8 1b 00 00 00       	mov    $0x1b,%eax
+    105a:	e9 b3 fe ff ff       	jmp    f12 <dosyscall>
+
+0000105f <uffdcopy>:
+SYSCALL(uffdcopy)
+    105f:	b8 1c 00 00 00       	mov    $0x1c,%eax
+    1064:	e9 a9 fe ff ff       	jmp    f12 <dosyscall>
+
+00001069 <getpriority>:
+SYSCALL(getpriority)
+    1069:	b8 1d 00 00 00       	mov    $0x1d,%eax
+    106e:	e9 9f fe ff ff       	jmp    f12 <dosyscall>
+
+00001073 <setpriority>:
+SYSCALL(setpriority)
+    1073:	b8 1e 00 00 00       	mov    $0x1e,%eax
+    1078:	e9 95 fe ff ff       	jmp    f12 <dosyscall>
+
+0000107d <setweight>:
+SYSCALL(setweight)
+    107d:	b8 1f 00 00 00       	mov    $0x1f,%eax
+    1082:	e9 8b fe ff ff       	jmp    f12 <dosyscall>
+
+00001087 <setgroup>:
+SYSCALL(setgroup)
+    1087:	b8 20 00 00 00       	mov    $0x20,%eax
+    108c:	e9 81 fe ff ff       	jmp    f12 <dosyscall>
+
+00001091 <schedinfo>:
+SYSCALL(schedinfo)
+    1091:	b8 21 00 00 00       	mov    $0x21,%eax
+    1096:	e9 77 fe ff ff       	jmp    f12 <dosyscall>
+
+0000109b <nanosleep>:
+SYSCALL(nanosleep)
+    109b:	b8 22 00 00 00       	mov    $0x22,%eax
+    10a0:	e9 6d fe ff ff       	jmp    f12 <dosyscall>
+
+000010a5 <clock_nanosleep>:
+SYSCALL(clock_nanosleep)
+    10a5:	b8 23 00 00 00       	mov    $0x23,%eax
+    10aa:	e9 63 fe ff ff       	jmp    f12 <dosyscall>
+
+000010af <clock_gettime>:
+SYSCALL(clock_gettime)
+    10af:	b8 24 00 00 00       	mov    $0x24,%eax
+    10b4:	e9 59 fe ff ff       	jmp    f12 <dosyscall>
+
+000010b9 <sched_setaffinity>:
+SYSCALL(sched_setaffinity)
+    10b9:	b8 25 00 00 00       	mov    $0x25,%eax
+    10be:	e9 4f fe ff ff       	jmp    f12 <dosyscall>
+
+000010c3 <sched_getaffinity>:
+SYSCALL(sched_getaffinity)
+    10c3:	b8 26 00 00 00       	mov    $0x26,%eax
+    10c8:	e9 45 fe ff ff       	jmp    f12 <dosyscall>
+
+000010cd <irqaffinity>:
+SYSCALL(irqaffinity)
+    10cd:	b8 27 00 00 00       	mov    $0x27,%eax
+    10d2:	e9 3b fe ff ff       	jmp    f12 <dosyscall>
+
+000010d7 <getrusage>:
+SYSCALL(getrusage)
+    10d7:	b8 28 00 00 00       	mov    $0x28,%eax
+    10dc:	e9 31 fe ff ff       	jmp    f12 <dosyscall>
+
+000010e1 <times>:
+SYSCALL(times)
+    10e1:	b8 29 00 00 00       	mov    $0x29,%eax
+    10e6:	e9 27 fe ff ff       	jmp    f12 <dosyscall>
+
+000010eb <schedlat>:
+SYSCALL(schedlat)
+    10eb:	b8 2a 00 00 00       	mov    $0x2a,%eax
+    10f0:	e9 1d fe ff ff       	jmp    f12 <dosyscall>
+
+000010f5 <sched_setscheduler>:
+SYSCALL(sched_setscheduler)
+    10f5:	b8 2b 00 00 00       	mov    $0x2b,%eax
+    10fa:	e9 13 fe ff ff       	jmp    f12 <dosyscall>
+
+000010ff <sched_getscheduler>:
+SYSCALL(sched_getscheduler)
+    10ff:	b8 2c 00 00 00       	mov    $0x2c,%eax
+    1104:	e9 09 fe ff ff       	jmp    f12 <dosyscall>
+
+00001109 <sched_getparam>:
+SYSCALL(sched_getparam)
+    1109:	b8 2d 00 00 00       	mov    $0x2d,%eax
+    110e:	e9 ff fd ff ff       	jmp    f12 <dosyscall>
+
+00001113 <lockstat>:
+SYSCALL(lockstat)
+    1113:	b8 2e 00 00 00       	mov    $0x2e,%eax
+    1118:	e9 f5 fd ff ff       	jmp    f12 <dosyscall>
+
+0000111d <ioring_setup>:
+SYSCALL(ioring_setup)
+    111d:	b8 2f 00 00 00       	mov    $0x2f,%eax
+    1122:	e9 eb fd ff ff       	jmp    f12 <dosyscall>
+
+00001127 <ioring_enter>:
+SYSCALL(ioring_enter)
+    1127:	b8 30 00 00 00       	mov    $0x30,%eax
+    112c:	e9 e1 fd ff ff       	jmp    f12 <dosyscall>
+
+00001131 <readv>:
+SYSCALL(readv)
+    1131:	b8 31 00 00 00       	mov    $0x31,%eax
+    1136:	e9 d7 fd ff ff       	jmp    f12 <dosyscall>
+
+0000113b <writev>:
+SYSCALL(writev)
+    113b:	b8 32 00 00 00       	mov    $0x32,%eax
+    1140:	e9 cd fd ff ff       	jmp    f12 <dosyscall>
+
+00001145 <pread>:
+SYSCALL(pread)
+    1145:	b8 33 00 00 00       	mov    $0x33,%eax
+    114a:	e9 c3 fd ff ff       	jmp    f12 <dosyscall>
+
+0000114f <pwrite>:
+SYSCALL(pwrite)
+    114f:	b8 34 00 00 00       	mov    $0x34,%eax
+    1154:	e9 b9 fd ff ff       	jmp    f12 <dosyscall>
+
+00001159 <sendfile>:
+SYSCALL(sendfile)
+    1159:	b8 35 00 00 00       	mov    $0x35,%eax
+    115e:	e9 af fd ff ff       	jmp    f12 <dosyscall>
+
+00001163 <splice>:
+SYSCALL(splice)
+    1163:	b8 36 00 00 00       	mov    $0x36,%eax
+    1168:	e9 a5 fd ff ff       	jmp    f12 <dosyscall>
+
+0000116d <sysstat>:
+SYSCALL(sysstat)
+    116d:	b8 37 00 00 00       	mov    $0x37,%eax
+    1172:	e9 9b fd ff ff       	jmp    f12 <dosyscall>
+
+00001177 <strace>:
+SYSCALL(strace)
+    1177:	b8 38 00 00 00       	mov    $0x38,%eax
+    117c:	e9 91 fd ff ff       	jmp    f12 <dosyscall>
+
+00001181 <straceread>:
+SYSCALL(straceread)
+    1181:	b8 39 00 00 00       	mov    $0x39,%eax
+    1186:	e9 87 fd ff ff       	jmp    f12 <dosyscall>
+
+0000118b <alarm>:
+
+# alarm and rstoregs keep to int $T_SYSCALL: rstoregs restores
+# %ecx and %edx, which sysexit would clobber.
+.globl alarm
+    alarm:
+        pushl $rstoregs
+    118b:	68 9b 11 00 00       	push   $0x119b
+        movl $SYS_alarm, %eax
+    1190:	b8 18 00 00 00       	mov    $0x18,%eax
+        int $T_SYSCALL
+    1195:	cd 40                	int    $0x40
+        add $0x04, %esp
+    1197:	83 c4 04             	add    $0x4,%esp
+        ret
+    119a:	c3                   	ret
+
+0000119b <rstoregs>:
+
+.globl rstoregs
+    rstoregs:
+        movl $SYS_rstoregs, %eax
+    119b:	b8 19 00 00 00       	mov    $0x19,%eax
+        int $T_SYSCALL
+    11a0:	cd 40                	int    $0x40
+
+000011a2 <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+    11a2:	55                   	push   %ebp
+    11a3:	89 e5                	mov    %esp,%ebp
+    11a5:	83 ec 18             	sub    $0x18,%esp
+    11a8:	8b 45 0c             	mov    0xc(%ebp),%eax
+    11ab:	88 45 f4             	mov    %al,-0xc(%ebp)
+    write(fd, &c, 1);
+    11ae:	83 ec 04             	sub    $0x4,%esp
+    11b1:	6a 01                	push   $0x1
+    11b3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+    11b6:	50                   	push   %eax
+    11b7:	ff 75 08             	push   0x8(%ebp)
+    11ba:	e8 d8 fd ff ff       	call   f97 <write>
+    11bf:	83 c4 10             	add    $0x10,%esp
+}
+    11c2:	90                   	nop
+    11c3:	c9                   	leave
+    11c4:	c3                   	ret
+
+000011c5 <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+    11c5:	55                   	push   %ebp
+    11c6:	89 e5                	mov    %esp,%ebp
+    11c8:	83 ec 28             	sub    $0x28,%esp
+    static char digits[] = "0123456789ABCDEF";
+    char buf[16];
+    int i, neg;
+    uint x;
+
+    neg = 0;
+    11cb:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+    if(sgn && xx < 0){
+    11d2:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+    11d6:	74 17                	je     11ef <printint+0x2a>
+    11d8:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+    11dc:	79 11                	jns    11ef <printint+0x2a>
+        neg = 1;
+    11de:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+        x = -xx;
+    11e5:	8b 45 0c             	mov    0xc(%ebp),%eax
+    11e8:	f7 d8                	neg    %eax
+    11ea:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    11ed:	eb 06                	jmp    11f5 <printint+0x30>
+    } else {
+        x = xx;
+    11ef:	8b 45 0c             	mov    0xc(%ebp),%eax
+    11f2:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    }
+
+    i = 0;
+    11f5:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    do{
+        buf[i++] = digits[x % base];
+    11fc:	8b 4d 10             	mov    0x10(%ebp),%ecx
+    11ff:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    1202:	ba 00 00 00 00       	mov    $0x0,%edx
+    1207:	f7 f1                	div    %ecx
+    1209:	89 d1                	mov    %edx,%ecx
+    120b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    120e:	8d 50 01             	lea    0x1(%eax),%edx
+    1211:	89 55 f4             	mov    %edx,-0xc(%ebp)
+    1214:	0f b6 91 e4 1b 00 00 	movzbl 0x1be4(%ecx),%edx
+    121b:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+    }while((x /= base) != 0);
+    121f:	8b 4d 10             	mov    0x10(%ebp),%ecx
+    1222:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    1225:	ba 00 00 00 00       	mov    $0x0,%edx
+    122a:	f7 f1                	div    %ecx
+    122c:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    122f:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    1233:	75 c7                	jne    11fc <printint+0x37>
+    if(neg)
+    1235:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    1239:	74 2d                	je     1268 <printint+0xa3>
+        buf[i++] = '-';
+    123b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    123e:	8d 50 01             	lea    0x1(%eax),%edx
+    1241:	89 55 f4             	mov    %edx,-0xc(%ebp)
+    1244:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+    while(--i >= 0)
+    1249:	eb 1d                	jmp    1268 <printint+0xa3>
+        putc(fd, buf[i]);
+    124b:	8d 55 dc             	lea    -0x24(%ebp),%edx
+    124e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1251:	01 d0                	add    %edx,%eax
+    1253:	0f b6 00             	movzbl (%eax),%eax
+    1256:	0f be c0             	movsbl %al,%eax
+    1259:	83 ec 08             	sub    $0x8,%esp
+    125c:	50                   	push   %eax
+    125d:	ff 75 08             	push   0x8(%ebp)
+    1260:	e8 3d ff ff ff       	call   11a2 <putc>
+    1265:	83 c4 10             	add    $0x10,%esp
+    while(--i >= 0)
+    1268:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+    126c:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    1270:	79 d9                	jns    124b <printint+0x86>
+}
+    1272:	90                   	nop
+    1273:	90                   	nop
+    1274:	c9                   	leave
+    1275:	c3                   	ret
+
+00001276 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+    1276:	55                   	push   %ebp
+    1277:	89 e5                	mov    %esp,%ebp
+    1279:	83 ec 28             	sub    $0x28,%esp
+    char *s;
+    int c, i, state;
+    uint *ap;
+
+    state = 0;
+    127c:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+    ap = (uint*)(void*)&fmt + 1;
+    1283:	8d 45 0c             	lea    0xc(%ebp),%eax
+    1286:	83 c0 04             	add    $0x4,%eax
+    1289:	89 45 e8             	mov    %eax,-0x18(%ebp)
+    for(i = 0; fmt[i]; i++){
+    128c:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+    1293:	e9 59 01 00 00       	jmp    13f1 <printf+0x17b>
+        c = fmt[i] & 0xff;
+    1298:	8b 55 0c             	mov    0xc(%ebp),%edx
+    129b:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    129e:	01 d0                	add    %edx,%eax
+    12a0:	0f b6 00             	movzbl (%eax),%eax
+    12a3:	0f be c0             	movsbl %al,%eax
+    12a6:	25 ff 00 00 00       	and    $0xff,%eax
+    12ab:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        if(state == 0){
+    12ae:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    12b2:	75 2c                	jne    12e0 <printf+0x6a>
+            if(c == '%'){
+    12b4:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+    12b8:	75 0c                	jne    12c6 <printf+0x50>
+                state = '%';
+    12ba:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+    12c1:	e9 27 01 00 00       	jmp    13ed <printf+0x177>
+            } else {
+                putc(fd, c);
+    12c6:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    12c9:	0f be c0             	movsbl %al,%eax
+    12cc:	83 ec 08             	sub    $0x8,%esp
+    12cf:	50                   	push   %eax
+    12d0:	ff 75 08             	push   0x8(%ebp)
+    12d3:	e8 ca fe ff ff       	call   11a2 <putc>
+    12d8:	83 c4 10             	add    $0x10,%esp
+    12db:	e9 0d 01 00 00       	jmp    13ed <printf+0x177>
+            }
+        } else if(state == '%'){
+    12e0:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+    12e4:	0f 85 03 01 00 00    	jne    13ed <printf+0x177>
+            if(c == 'd'){
+    12ea:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+    12ee:	75 1e                	jne    130e <printf+0x98>
+                printint(fd, *ap, 10, 1);
+    12f0:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    12f3:	8b 00                	mov    (%eax),%eax
+    12f5:	6a 01                	push   $0x1
+    12f7:	6a 0a                	push   $0xa
+    12f9:	50                   	push   %eax
+    12fa:	ff 75 08             	push   0x8(%ebp)
+    12fd:	e8 c3 fe ff ff       	call   11c5 <printint>
+    1302:	83 c4 10             	add    $0x10,%esp
+                ap++;
+    1305:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+    1309:	e9 d8 00 00 00       	jmp    13e6 <printf+0x170>
+            } else if(c == 'x' || c == 'p'){
+    130e:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+    1312:	74 06                	je     131a <printf+0xa4>
+    1314:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+    1318:	75 1e                	jne    1338 <printf+0xc2>
+                printint(fd, *ap, 16, 0);
+    131a:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    131d:	8b 00                	mov    (%eax),%eax
+    131f:	6a 00                	push   $0x0
+    1321:	6a 10                	push   $0x10
+    1323:	50                   	push   %eax
+    1324:	ff 75 08             	push   0x8(%ebp)
+    1327:	e8 99 fe ff ff       	call   11c5 <printint>
+    132c:	83 c4 10             	add    $0x10,%esp
+                ap++;
+    132f:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+    1333:	e9 ae 00 00 00       	jmp    13e6 <printf+0x170>
+            } else if(c == 's'){
+    1338:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+    133c:	75 43                	jne    1381 <printf+0x10b>
+                s = (char*)*ap;
+    133e:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    1341:	8b 00                	mov    (%eax),%eax
+    1343:	89 45 f4             	mov    %eax,-0xc(%ebp)
+                ap++;
+    1346:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+                if(s == 0)
+    134a:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    134e:	75 25                	jne    1375 <printf+0xff>
+                    s = "(null)";
+    1350:	c7 45 f4 28 17 00 00 	movl   $0x1728,-0xc(%ebp)
+                while(*s != 0){
+    1357:	eb 1c                	jmp    1375 <printf+0xff>
+                    putc(fd, *s);
+    1359:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    135c:	0f b6 00             	movzbl (%eax),%eax
+    135f:	0f be c0             	movsbl %al,%eax
+    1362:	83 ec 08             	sub    $0x8,%esp
+    1365:	50                   	push   %eax
+    1366:	ff 75 08             	push   0x8(%ebp)
+    1369:	e8 34 fe ff ff       	call   11a2 <putc>
+    136e:	83 c4 10             	add    $0x10,%esp
+                    s++;
+    1371:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+                while(*s != 0){
+    1375:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1378:	0f b6 00             	movzbl (%eax),%eax
+    137b:	84 c0                	test   %al,%al
+    137d:	75 da                	jne    1359 <printf+0xe3>
+    137f:	eb 65                	jmp    13e6 <printf+0x170>
+                }
+            } else if(c == 'c'){
+    1381:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+    1385:	75 1d                	jne    13a4 <printf+0x12e>
+                putc(fd, *ap);
+    1387:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    138a:	8b 00                	mov    (%eax),%eax
+    138c:	0f be c0             	movsbl %al,%eax
+    138f:	83 ec 08             	sub    $0x8,%esp
+    1392:	50                   	push   %eax
+    1393:	ff 75 08             	push   0x8(%ebp)
+    1396:	e8 07 fe ff ff       	call   11a2 <putc>
+    139b:	83 c4 10             	add    $0x10,%esp
+                ap++;
+    139e:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+    13a2:	eb 42                	jmp    13e6 <printf+0x170>
+            } else if(c == '%'){
+    13a4:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+    13a8:	75 17                	jne    13c1 <printf+0x14b>
+                putc(fd, c);
+    13aa:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    13ad:	0f be c0             	movsbl %al,%eax
+    13b0:	83 ec 08             	sub    $0x8,%esp
+    13b3:	50                   	push   %eax
+    13b4:	ff 75 08             	push   0x8(%ebp)
+    13b7:	e8 e6 fd ff ff       	call   11a2 <putc>
+    13bc:	83 c4 10             	add    $0x10,%esp
+    13bf:	eb 25                	jmp    13e6 <printf+0x170>
+            } else {
+                // Unknown % sequence.    Print it to draw attention.
+                putc(fd, '%');
+    13c1:	83 ec 08             	sub    $0x8,%esp
+    13c4:	6a 25                	push   $0x25
+    13c6:	ff 75 08             	push   0x8(%ebp)
+    13c9:	e8 d4 fd ff ff       	call   11a2 <putc>
+    13ce:	83 c4 10             	add    $0x10,%esp
+                putc(fd, c);
+    13d1:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    13d4:	0f be c0             	movsbl %al,%eax
+    13d7:	83 ec 08             	sub    $0x8,%esp
+    13da:	50                   	push   %eax
+    13db:	ff 75 08             	push   0x8(%ebp)
+    13de:	e8 bf fd ff ff       	call   11a2 <putc>
+    13e3:	83 c4 10             	add    $0x10,%esp
+            }
+            state = 0;
+    13e6:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+    for(i = 0; fmt[i]; i++){
+    13ed:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+    13f1:	8b 55 0c             	mov    0xc(%ebp),%edx
+    13f4:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    13f7:	01 d0                	add    %edx,%eax
+    13f9:	0f b6 00             	movzbl (%eax),%eax
+    13fc:	84 c0                	test   %al,%al
+    13fe:	0f 85 94 fe ff ff    	jne    1298 <printf+0x22>
+        }
+    }
+}
+    1404:	90                   	nop
+    1405:	90                   	nop
+    1406:	c9                   	leave
+    1407:	c3                   	ret
+
+00001408 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+    1408:	55                   	push   %ebp
+    1409:	89 e5                	mov    %esp,%ebp
+    140b:	83 ec 10             	sub    $0x10,%esp
+    Header *bp, *p;
+
+    bp = (Header*)ap - 1;
+    140e:	8b 45 08             	mov    0x8(%ebp),%eax
+    1411:	83 e8 08             	sub    $0x8,%eax
+    1414:	89 45 f8             	mov    %eax,-0x8(%ebp)
+    for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    1417:	a1 6c 1c 00 00       	mov    0x1c6c,%eax
+    141c:	89 45 fc             	mov    %eax,-0x4(%ebp)
+    141f:	eb 24                	jmp    1445 <free+0x3d>
+        if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    1421:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    1424:	8b 00                	mov    (%eax),%eax
+    1426:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+    1429:	72 12                	jb     143d <free+0x35>
+    142b:	8b 45 f8             	mov    -0x8(%ebp),%eax
+    142e:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+    1431:	72 24                	jb     1457 <free+0x4f>
+    1433:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    1436:	8b 00                	mov    (%eax),%eax
+    1438:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+    143b:	72 1a                	jb     1457 <free+0x4f>
+    for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    143d:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    1440:	8b 00                	mov    (%eax),%eax
+    1442:	89 45 fc             	mov    %eax,-0x4(%ebp)
+    1445:	8b 45 f8             	mov    -0x8(%ebp),%eax
+    1448:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+    144b:	73 d4                	jae    1421 <free+0x19>
+    144d:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    1450:	8b 00                	mov    (%eax),%eax
+    1452:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+    1455:	73 ca                	jae    1421 <free+0x19>
+            break;
+    if(bp + bp->s.size == p->s.ptr){
+    1457:	8b 45 f8             	mov    -0x8(%ebp),%eax
+    145a:	8b 40 04             	mov    0x4(%eax),%eax
+    145d:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+    1464:	8b 45 f8             	mov    -0x8(%ebp),%eax
+    1467:	01 c2                	add    %eax,%edx
+    1469:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    146c:	8b 00                	mov    (%eax),%eax
+    146e:	39 c2                	cmp    %eax,%edx
+    1470:	75 24                	jne    1496 <free+0x8e>
+        bp->s.size += p->s.ptr->s.size;
+    1472:	8b 45 f8             	mov    -0x8(%ebp),%eax
+    1475:	8b 50 04             	mov    0x4(%eax),%edx
+    1478:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    147b:	8b 00                	mov    (%eax),%eax
+    147d:	8b 40 04             	mov    0x4(%eax),%eax
+    1480:	01 c2                	add    %eax,%edx
+    1482:	8b 45 f8             	mov    -0x8(%ebp),%eax
+    1485:	89 50 04             	mov    %edx,0x4(%eax)
+        bp->s.ptr = p->s.ptr->s.ptr;
+    1488:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    148b:	8b 00                	mov    (%eax),%eax
+    148d:	8b 10                	mov    (%eax),%edx
+    148f:	8b 45 f8             	mov    -0x8(%ebp),%eax
+    1492:	89 10                	mov    %edx,(%eax)
+    1494:	eb 0a                	jmp    14a0 <free+0x98>
+    } else
+        bp->s.ptr = p->s.ptr;
+    1496:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    1499:	8b 10                	mov    (%eax),%edx
+    149b:	8b 45 f8             	mov    -0x8(%ebp),%eax
+    149e:	89 10                	mov    %edx,(%eax)
+    if(p + p->s.size == bp){
+    14a0:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    14a3:	8b 40 04             	mov    0x4(%eax),%eax
+    14a6:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+    14ad:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    14b0:	01 d0                	add    %edx,%eax
+    14b2:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+    14b5:	75 20                	jne    14d7 <free+0xcf>
+        p->s.size += bp->s.size;
+    14b7:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    14ba:	8b 50 04             	mov    0x4(%eax),%edx
+    14bd:	8b 45 f8             	mov    -0x8(%ebp),%eax
+    14c0:	8b 40 04             	mov    0x4(%eax),%eax
+    14c3:	01 c2                	add    %eax,%edx
+    14c5:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    14c8:	89 50 04             	mov    %edx,0x4(%eax)
+        p->s.ptr = bp->s.ptr;
+    14cb:	8b 45 f8             	mov    -0x8(%ebp),%eax
+    14ce:	8b 10                	mov    (%eax),%edx
+    14d0:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    14d3:	89 10                	mov    %edx,(%eax)
+    14d5:	eb 08                	jmp    14df <free+0xd7>
+    } else
+        p->s.ptr = bp;
+    14d7:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    14da:	8b 55 f8             	mov    -0x8(%ebp),%edx
+    14dd:	89 10                	mov    %edx,(%eax)
+    freep = p;
+    14df:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    14e2:	a3 6c 1c 00 00       	mov    %eax,0x1c6c
+}
+    14e7:	90                   	nop
+    14e8:	c9                   	leave
+    14e9:	c3                   	ret
+
+000014ea <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+    14ea:	55                   	push   %ebp
+    14eb:	89 e5                	mov    %esp,%ebp
+    14ed:	83 ec 18             	sub    $0x18,%esp
+    char *p;
+    Header *hp;
+
+    if(nu < 4096)
+    14f0:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+    14f7:	77 07                	ja     1500 <morecore+0x16>
+        nu = 4096;
+    14f9:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+    p = sbrk(nu * sizeof(Header));
+    1500:	8b 45 08             	mov    0x8(%ebp),%eax
+    1503:	c1 e0 03             	shl    $0x3,%eax
+    1506:	83 ec 0c             	sub    $0xc,%esp
+    1509:	50                   	push   %eax
+    150a:	e8 0a fb ff ff       	call   1019 <sbrk>
+    150f:	83 c4 10             	add    $0x10,%esp
+    1512:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p == (char*)-1)
+    1515:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+    1519:	75 07                	jne    1522 <morecore+0x38>
+        return 0;
+    151b:	b8 00 00 00 00       	mov    $0x0,%eax
+    1520:	eb 26                	jmp    1548 <morecore+0x5e>
+    hp = (Header*)p;
+    1522:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1525:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    hp->s.size = nu;
+    1528:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    152b:	8b 55 08             	mov    0x8(%ebp),%edx
+    152e:	89 50 04             	mov    %edx,0x4(%eax)
+    free((void*)(hp + 1));
+    1531:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    1534:	83 c0 08             	add    $0x8,%eax
+    1537:	83 ec 0c             	sub    $0xc,%esp
+    153a:	50                   	push   %eax
+    153b:	e8 c8 fe ff ff       	call   1408 <free>
+    1540:	83 c4 10             	add    $0x10,%esp
+    return freep;
+    1543:	a1 6c 1c 00 00       	mov    0x1c6c,%eax
+}
+    1548:	c9                   	leave
+    1549:	c3                   	ret
+
+0000154a <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+    154a:	55                   	push   %ebp
+    154b:	89 e5                	mov    %esp,%ebp
+    154d:	83 ec 18             	sub    $0x18,%esp
+    Header *p, *prevp;
+    uint nunits;
+
+    nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    1550:	8b 45 08             	mov    0x8(%ebp),%eax
+    1553:	83 c0 07             	add    $0x7,%eax
+    1556:	c1 e8 03             	shr    $0x3,%eax
+    1559:	83 c0 01             	add    $0x1,%eax
+    155c:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    if((prevp = freep) == 0){
+    155f:	a1 6c 1c 00 00       	mov    0x1c6c,%eax
+    1564:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    1567:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    156b:	75 23                	jne    1590 <malloc+0x46>
+        base.s.ptr = freep = prevp = &base;
+    156d:	c7 45 f0 64 1c 00 00 	movl   $0x1c64,-0x10(%ebp)
+    1574:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    1577:	a3 6c 1c 00 00       	mov    %eax,0x1c6c
+    157c:	a1 6c 1c 00 00       	mov    0x1c6c,%eax
+    1581:	a3 64 1c 00 00       	mov    %eax,0x1c64
+        base.s.size = 0;
+    1586:	c7 05 68 1c 00 00 00 	movl   $0x0,0x1c68
+    158d:	00 00 00 
+    }
+    for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    1590:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    1593:	8b 00                	mov    (%eax),%eax
+    1595:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        if(p->s.size >= nunits){
+    1598:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    159b:	8b 40 04             	mov    0x4(%eax),%eax
+    159e:	3b 45 ec             	cmp    -0x14(%ebp),%eax
+    15a1:	72 4d                	jb     15f0 <malloc+0xa6>
+            if(p->s.size == nunits)
+    15a3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    15a6:	8b 40 04             	mov    0x4(%eax),%eax
+    15a9:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+    15ac:	75 0c                	jne    15ba <malloc+0x70>
+                prevp->s.ptr = p->s.ptr;
+    15ae:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    15b1:	8b 10                	mov    (%eax),%edx
+    15b3:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    15b6:	89 10                	mov    %edx,(%eax)
+    15b8:	eb 26                	jmp    15e0 <malloc+0x96>
+            else {
+                p->s.size -= nunits;
+    15ba:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    15bd:	8b 40 04             	mov    0x4(%eax),%eax
+    15c0:	2b 45 ec             	sub    -0x14(%ebp),%eax
+    15c3:	89 c2                	mov    %eax,%edx
+    15c5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    15c8:	89 50 04             	mov    %edx,0x4(%eax)
+                p += p->s.size;
+    15cb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    15ce:	8b 40 04             	mov    0x4(%eax),%eax
+    15d1:	c1 e0 03             	shl    $0x3,%eax
+    15d4:	01 45 f4             	add    %eax,-0xc(%ebp)
+                p->s.size = nunits;
+    15d7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    15da:	8b 55 ec             	mov    -0x14(%ebp),%edx
+    15dd:	89 50 04             	mov    %edx,0x4(%eax)
+            }
+            freep = prevp;
+    15e0:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    15e3:	a3 6c 1c 00 00       	mov    %eax,0x1c6c
+            return (void*)(p + 1);
+    15e8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    15eb:	83 c0 08             	add    $0x8,%eax
+    15ee:	eb 3b                	jmp    162b <malloc+0xe1>
+        }
+        if(p == freep)
+    15f0:	a1 6c 1c 00 00       	mov    0x1c6c,%eax
+    15f5:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+    15f8:	75 1e                	jne    1618 <malloc+0xce>
+            if((p = morecore(nunits)) == 0)
+    15fa:	83 ec 0c             	sub    $0xc,%esp
+    15fd:	ff 75 ec             	push   -0x14(%ebp)
+    1600:	e8 e5 fe ff ff       	call   14ea <morecore>
+    1605:	83 c4 10             	add    $0x10,%esp
+    1608:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    160b:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    160f:	75 07                	jne    1618 <malloc+0xce>
+                return 0;
+    1611:	b8 00 00 00 00       	mov    $0x0,%eax
+    1616:	eb 13                	jmp    162b <malloc+0xe1>
+    for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    1618:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    161b:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    161e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1621:	8b 00                	mov    (%eax),%eax
+    1623:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        if(p->s.size >= nunits){
+    1626:	e9 6d ff ff ff       	jmp    1598 <malloc+0x4e>
+    }
+}
+    162b:	c9                   	leave
+    162c:	c3                   	ret
@@ -0,0 +1,2337 @@
+
+_shares:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <list>:
+
+struct schedinfo info[NINFO];
+
+void
+list(void)
+{
+       0:	55                   	push   %ebp
+       1:	89 e5                	mov    %esp,%ebp
+       3:	57                   	push   %edi
+       4:	56                   	push   %esi
+       5:	53                   	push   %ebx
+       6:	83 ec 3c             	sub    $0x3c,%esp
+    int i, j, n, nproc;
+    uint total, used;
+
+    n = schedinfo(info, NINFO);
+       9:	83 ec 08             	sub    $0x8,%esp
+       c:	6a 40                	push   $0x40
+       e:	68 a0 17 00 00       	push   $0x17a0
+      13:	e8 a7 0d 00 00       	call   dbf <schedinfo>
+      18:	83 c4 10             	add    $0x10,%esp
+      1b:	89 45 d0             	mov    %eax,-0x30(%ebp)
+    total = 0;
+      1e:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+    for(i = 0; i < n; i++)
+      25:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+      2c:	eb 1b                	jmp    49 <list+0x49>
+        total += info[i].runtime;
+      2e:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+      31:	89 d0                	mov    %edx,%eax
+      33:	c1 e0 02             	shl    $0x2,%eax
+      36:	01 d0                	add    %edx,%eax
+      38:	c1 e0 03             	shl    $0x3,%eax
+      3b:	05 b4 17 00 00       	add    $0x17b4,%eax
+      40:	8b 00                	mov    (%eax),%eax
+      42:	01 45 d8             	add    %eax,-0x28(%ebp)
+    for(i = 0; i < n; i++)
+      45:	83 45 e4 01          	addl   $0x1,-0x1c(%ebp)
+      49:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+      4c:	3b 45 d0             	cmp    -0x30(%ebp),%eax
+      4f:	7c dd                	jl     2e <list+0x2e>
+    printf(1, "pid\tgroup\tweight\tprio\tMcyc\tshare\tname\n");
+      51:	83 ec 08             	sub    $0x8,%esp
+      54:	68 5c 13 00 00       	push   $0x135c
+      59:	6a 01                	push   $0x1
+      5b:	e8 44 0f 00 00       	call   fa4 <printf>
+      60:	83 c4 10             	add    $0x10,%esp
+    for(i = 0; i < n; i++)
+      63:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+      6a:	e9 d1 00 00 00       	jmp    140 <list+0x140>
+        printf(1, "%d\t%d\t%d\t%d\t%d\t%d%%\t%s\n", info[i].pid,
+            info[i].group, info[i].weight, info[i].prio, info[i].runtime,
+            total ? info[i].runtime*100/total : 0, info[i].name);
+      6f:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+      72:	89 d0                	mov    %edx,%eax
+      74:	c1 e0 02             	shl    $0x2,%eax
+      77:	01 d0                	add    %edx,%eax
+      79:	c1 e0 03             	shl    $0x3,%eax
+      7c:	83 c0 10             	add    $0x10,%eax
+      7f:	05 a0 17 00 00       	add    $0x17a0,%eax
+      84:	83 c0 08             	add    $0x8,%eax
+      87:	89 45 c0             	mov    %eax,-0x40(%ebp)
+        printf(1, "%d\t%d\t%d\t%d\t%d\t%d%%\t%s\n", info[i].pid,
+      8a:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+      8e:	74 24                	je     b4 <list+0xb4>
+            total ? info[i].runtime*100/total : 0, info[i].name);
+      90:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+      93:	89 d0                	mov    %edx,%eax
+      95:	c1 e0 02             	shl    $0x2,%eax
+      98:	01 d0                	add    %edx,%eax
+      9a:	c1 e0 03             	shl    $0x3,%eax
+      9d:	05 b4 17 00 00       	add    $0x17b4,%eax
+      a2:	8b 00                	mov    (%eax),%eax
+      a4:	6b c0 64             	imul   $0x64,%eax,%eax
+        printf(1, "%d\t%d\t%d\t%d\t%d\t%d%%\t%s\n", info[i].pid,
+      a7:	ba 00 00 00 00       	mov    $0x0,%edx
+      ac:	f7 75 d8             	divl   -0x28(%ebp)
+      af:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+      b2:	eb 07                	jmp    bb <list+0xbb>
+      b4:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%ebp)
+      bb:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+      be:	89 d0                	mov    %edx,%eax
+      c0:	c1 e0 02             	shl    $0x2,%eax
+      c3:	01 d0                	add    %edx,%eax
+      c5:	c1 e0 03             	shl    $0x3,%eax
+      c8:	05 b4 17 00 00       	add    $0x17b4,%eax
+      cd:	8b 38                	mov    (%eax),%edi
+      cf:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+      d2:	89 d0                	mov    %edx,%eax
+      d4:	c1 e0 02             	shl    $0x2,%eax
+      d7:	01 d0                	add    %edx,%eax
+      d9:	c1 e0 03             	shl    $0x3,%eax
+      dc:	05 b0 17 00 00       	add    $0x17b0,%eax
+      e1:	8b 30                	mov    (%eax),%esi
+      e3:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+      e6:	89 d0                	mov    %edx,%eax
+      e8:	c1 e0 02             	shl    $0x2,%eax
+      eb:	01 d0                	add    %edx,%eax
+      ed:	c1 e0 03             	shl    $0x3,%eax
+      f0:	05 a8 17 00 00       	add    $0x17a8,%eax
+      f5:	8b 18                	mov    (%eax),%ebx
+      f7:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+      fa:	89 d0                	mov    %edx,%eax
+      fc:	c1 e0 02             	shl    $0x2,%eax
+      ff:	01 d0                	add    %edx,%eax
+     101:	c1 e0 03             	shl    $0x3,%eax
+     104:	05 a4 17 00 00       	add    $0x17a4,%eax
+     109:	8b 08                	mov    (%eax),%ecx
+     10b:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+     10e:	89 d0                	mov    %edx,%eax
+     110:	c1 e0 02             	shl    $0x2,%eax
+     113:	01 d0                	add    %edx,%eax
+     115:	c1 e0 03             	shl    $0x3,%eax
+     118:	05 a0 17 00 00       	add    $0x17a0,%eax
+     11d:	8b 00                	mov    (%eax),%eax
+     11f:	83 ec 0c             	sub    $0xc,%esp
+     122:	ff 75 c0             	push   -0x40(%ebp)
+     125:	ff 75 c4             	push   -0x3c(%ebp)
+     128:	57                   	push   %edi
+     129:	56                   	push   %esi
+     12a:	53                   	push   %ebx
+     12b:	51                   	push   %ecx
+     12c:	50                   	push   %eax
+     12d:	68 83 13 00 00       	push   $0x1383
+     132:	6a 01                	push   $0x1
+     134:	e8 6b 0e 00 00       	call   fa4 <printf>
+     139:	83 c4 30             	add    $0x30,%esp
+    for(i = 0; i < n; i++)
+     13c:	83 45 e4 01          	addl   $0x1,-0x1c(%ebp)
+     140:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     143:	3b 45 d0             	cmp    -0x30(%ebp),%eax
+     146:	0f 8c 23 ff ff ff    	jl     6f <list+0x6f>
+
+    // Then each group, at its first member.
+    printf(1, "\ngroup\tweight\tprocs\tMcyc\tshare\n");
+     14c:	83 ec 08             	sub    $0x8,%esp
+     14f:	68 9c 13 00 00       	push   $0x139c
+     154:	6a 01                	push   $0x1
+     156:	e8 49 0e 00 00       	call   fa4 <printf>
+     15b:	83 c4 10             	add    $0x10,%esp
+    for(i = 0; i < n; i++){
+     15e:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+     165:	e9 3c 01 00 00       	jmp    2a6 <list+0x2a6>
+        if(info[i].group == 0)
+     16a:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+     16d:	89 d0                	mov    %edx,%eax
+     16f:	c1 e0 02             	shl    $0x2,%eax
+     172:	01 d0                	add    %edx,%eax
+     174:	c1 e0 03             	shl    $0x3,%eax
+     177:	05 a4 17 00 00       	add    $0x17a4,%eax
+     17c:	8b 00                	mov    (%eax),%eax
+     17e:	85 c0                	test   %eax,%eax
+     180:	0f 84 18 01 00 00    	je     29e <list+0x29e>
+            continue;
+        for(j = 0; j < i && info[j].group != info[i].group; j++)
+     186:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%ebp)
+     18d:	eb 04                	jmp    193 <list+0x193>
+     18f:	83 45 e0 01          	addl   $0x1,-0x20(%ebp)
+     193:	8b 45 e0             	mov    -0x20(%ebp),%eax
+     196:	3b 45 e4             	cmp    -0x1c(%ebp),%eax
+     199:	7d 2c                	jge    1c7 <list+0x1c7>
+     19b:	8b 55 e0             	mov    -0x20(%ebp),%edx
+     19e:	89 d0                	mov    %edx,%eax
+     1a0:	c1 e0 02             	shl    $0x2,%eax
+     1a3:	01 d0                	add    %edx,%eax
+     1a5:	c1 e0 03             	shl    $0x3,%eax
+     1a8:	05 a4 17 00 00       	add    $0x17a4,%eax
+     1ad:	8b 08                	mov    (%eax),%ecx
+     1af:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+     1b2:	89 d0                	mov    %edx,%eax
+     1b4:	c1 e0 02             	shl    $0x2,%eax
+     1b7:	01 d0                	add    %edx,%eax
+     1b9:	c1 e0 03             	shl    $0x3,%eax
+     1bc:	05 a4 17 00 00       	add    $0x17a4,%eax
+     1c1:	8b 00                	mov    (%eax),%eax
+     1c3:	39 c1                	cmp    %eax,%ecx
+     1c5:	75 c8                	jne    18f <list+0x18f>
+            ;
+        if(j < i)
+     1c7:	8b 45 e0             	mov    -0x20(%ebp),%eax
+     1ca:	3b 45 e4             	cmp    -0x1c(%ebp),%eax
+     1cd:	0f 8c ce 00 00 00    	jl     2a1 <list+0x2a1>
+            continue;
+        used = nproc = 0;
+     1d3:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%ebp)
+     1da:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+        for(j = i; j < n; j++){
+     1e1:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     1e4:	89 45 e0             	mov    %eax,-0x20(%ebp)
+     1e7:	eb 4b                	jmp    234 <list+0x234>
+            if(info[j].group == info[i].group){
+     1e9:	8b 55 e0             	mov    -0x20(%ebp),%edx
+     1ec:	89 d0                	mov    %edx,%eax
+     1ee:	c1 e0 02             	shl    $0x2,%eax
+     1f1:	01 d0                	add    %edx,%eax
+     1f3:	c1 e0 03             	shl    $0x3,%eax
+     1f6:	05 a4 17 00 00       	add    $0x17a4,%eax
+     1fb:	8b 08                	mov    (%eax),%ecx
+     1fd:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+     200:	89 d0                	mov    %edx,%eax
+     202:	c1 e0 02             	shl    $0x2,%eax
+     205:	01 d0                	add    %edx,%eax
+     207:	c1 e0 03             	shl    $0x3,%eax
+     20a:	05 a4 17 00 00       	add    $0x17a4,%eax
+     20f:	8b 00                	mov    (%eax),%eax
+     211:	39 c1                	cmp    %eax,%ecx
+     213:	75 1b                	jne    230 <list+0x230>
+                used += info[j].runtime;
+     215:	8b 55 e0             	mov    -0x20(%ebp),%edx
+     218:	89 d0                	mov    %edx,%eax
+     21a:	c1 e0 02             	shl    $0x2,%eax
+     21d:	01 d0                	add    %edx,%eax
+     21f:	c1 e0 03             	shl    $0x3,%eax
+     222:	05 b4 17 00 00       	add    $0x17b4,%eax
+     227:	8b 00                	mov    (%eax),%eax
+     229:	01 45 d4             	add    %eax,-0x2c(%ebp)
+                nproc++;
+     22c:	83 45 dc 01          	addl   $0x1,-0x24(%ebp)
+        for(j = i; j < n; j++){
+     230:	83 45 e0 01          	addl   $0x1,-0x20(%ebp)
+     234:	8b 45 e0             	mov    -0x20(%ebp),%eax
+     237:	3b 45 d0             	cmp    -0x30(%ebp),%eax
+     23a:	7c ad                	jl     1e9 <list+0x1e9>
+            }
+        }
+        printf(1, "%d\t%d\t%d\t%d\t%d%%\n", info[i].group,
+     23c:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+     240:	74 12                	je     254 <list+0x254>
+            info[i].gweight, nproc, used, total ? used*100/total : 0);
+     242:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+     245:	6b c0 64             	imul   $0x64,%eax,%eax
+        printf(1, "%d\t%d\t%d\t%d\t%d%%\n", info[i].group,
+     248:	ba 00 00 00 00       	mov    $0x0,%edx
+     24d:	f7 75 d8             	divl   -0x28(%ebp)
+     250:	89 c3                	mov    %eax,%ebx
+     252:	eb 05                	jmp    259 <list+0x259>
+     254:	bb 00 00 00 00       	mov    $0x0,%ebx
+     259:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+     25c:	89 d0                	mov    %edx,%eax
+     25e:	c1 e0 02             	shl    $0x2,%eax
+     261:	01 d0                	add    %edx,%eax
+     263:	c1 e0 03             	shl    $0x3,%eax
+     266:	05 ac 17 00 00       	add    $0x17ac,%eax
+     26b:	8b 08                	mov    (%eax),%ecx
+     26d:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+     270:	89 d0                	mov    %edx,%eax
+     272:	c1 e0 02             	shl    $0x2,%eax
+     275:	01 d0                	add    %edx,%eax
+     277:	c1 e0 03             	shl    $0x3,%eax
+     27a:	05 a4 17 00 00       	add    $0x17a4,%eax
+     27f:	8b 00                	mov    (%eax),%eax
+     281:	83 ec 04             	sub    $0x4,%esp
+     284:	53                   	push   %ebx
+     285:	ff 75 d4             	push   -0x2c(%ebp)
+     288:	ff 75 dc             	push   -0x24(%ebp)
+     28b:	51                   	push   %ecx
+     28c:	50                   	push   %eax
+     28d:	68 bc 13 00 00       	push   $0x13bc
+     292:	6a 01                	push   $0x1
+     294:	e8 0b 0d 00 00       	call   fa4 <printf>
+     299:	83 c4 20             	add    $0x20,%esp
+     29c:	eb 04                	jmp    2a2 <list+0x2a2>
+            continue;
+     29e:	90                   	nop
+     29f:	eb 01                	jmp    2a2 <list+0x2a2>
+            continue;
+     2a1:	90                   	nop
+    for(i = 0; i < n; i++){
+     2a2:	83 45 e4 01          	addl   $0x1,-0x1c(%ebp)
+     2a6:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     2a9:	3b 45 d0             	cmp    -0x30(%ebp),%eax
+     2ac:	0f 8c b8 fe ff ff    	jl     16a <list+0x16a>
+    }
+}
+     2b2:	90                   	nop
+     2b3:	90                   	nop
+     2b4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     2b7:	5b                   	pop    %ebx
+     2b8:	5e                   	pop    %esi
+     2b9:	5f                   	pop    %edi
+     2ba:	5d                   	pop    %ebp
+     2bb:	c3                   	ret
+
+000002bc <runtime>:
+
+// Return the runtime of process pid, or 0 if it is gone.
+uint
+runtime(int pid)
+{
+     2bc:	55                   	push   %ebp
+     2bd:	89 e5                	mov    %esp,%ebp
+     2bf:	83 ec 18             	sub    $0x18,%esp
+    int i, n;
+
+    n = schedinfo(info, NINFO);
+     2c2:	83 ec 08             	sub    $0x8,%esp
+     2c5:	6a 40                	push   $0x40
+     2c7:	68 a0 17 00 00       	push   $0x17a0
+     2cc:	e8 ee 0a 00 00       	call   dbf <schedinfo>
+     2d1:	83 c4 10             	add    $0x10,%esp
+     2d4:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    for(i = 0; i < n; i++)
+     2d7:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     2de:	eb 33                	jmp    313 <runtime+0x57>
+        if(info[i].pid == pid)
+     2e0:	8b 55 f4             	mov    -0xc(%ebp),%edx
+     2e3:	89 d0                	mov    %edx,%eax
+     2e5:	c1 e0 02             	shl    $0x2,%eax
+     2e8:	01 d0                	add    %edx,%eax
+     2ea:	c1 e0 03             	shl    $0x3,%eax
+     2ed:	05 a0 17 00 00       	add    $0x17a0,%eax
+     2f2:	8b 00                	mov    (%eax),%eax
+     2f4:	39 45 08             	cmp    %eax,0x8(%ebp)
+     2f7:	75 16                	jne    30f <runtime+0x53>
+            return info[i].runtime;
+     2f9:	8b 55 f4             	mov    -0xc(%ebp),%edx
+     2fc:	89 d0                	mov    %edx,%eax
+     2fe:	c1 e0 02             	shl    $0x2,%eax
+     301:	01 d0                	add    %edx,%eax
+     303:	c1 e0 03             	shl    $0x3,%eax
+     306:	05 b4 17 00 00       	add    $0x17b4,%eax
+     30b:	8b 00                	mov    (%eax),%eax
+     30d:	eb 11                	jmp    320 <runtime+0x64>
+    for(i = 0; i < n; i++)
+     30f:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+     313:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     316:	3b 45 f0             	cmp    -0x10(%ebp),%eax
+     319:	7c c5                	jl     2e0 <runtime+0x24>
+    return 0;
+     31b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     320:	c9                   	leave
+     321:	c3                   	ret
+
+00000322 <test>:
+
+void
+test(int nw, int *w)
+{
+     322:	55                   	push   %ebp
+     323:	89 e5                	mov    %esp,%ebp
+     325:	53                   	push   %ebx
+     326:	83 ec 74             	sub    $0x74,%esp
+    int i, wsum, pids[NSPIN];
+    uint start[NSPIN], used[NSPIN], total;
+    volatile int j;
+
+    wsum = 0;
+     329:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+    for(i = 0; i < nw; i++){
+     330:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     337:	e9 9b 00 00 00       	jmp    3d7 <test+0xb5>
+        wsum += w[i];
+     33c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     33f:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+     346:	8b 45 0c             	mov    0xc(%ebp),%eax
+     349:	01 d0                	add    %edx,%eax
+     34b:	8b 00                	mov    (%eax),%eax
+     34d:	01 45 f0             	add    %eax,-0x10(%ebp)
+        pids[i] = fork();
+     350:	e8 4a 09 00 00       	call   c9f <fork>
+     355:	8b 55 f4             	mov    -0xc(%ebp),%edx
+     358:	89 44 95 cc          	mov    %eax,-0x34(%ebp,%edx,4)
+        if(pids[i] < 0){
+     35c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     35f:	8b 44 85 cc          	mov    -0x34(%ebp,%eax,4),%eax
+     363:	85 c0                	test   %eax,%eax
+     365:	79 17                	jns    37e <test+0x5c>
+            printf(2, "shares: fork failed\n");
+     367:	83 ec 08             	sub    $0x8,%esp
+     36a:	68 ce 13 00 00       	push   $0x13ce
+     36f:	6a 02                	push   $0x2
+     371:	e8 2e 0c 00 00       	call   fa4 <printf>
+     376:	83 c4 10             	add    $0x10,%esp
+            exit();
+     379:	e8 28 09 00 00       	call   ca6 <exit>
+        }
+        if(pids[i] == 0){
+     37e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     381:	8b 44 85 cc          	mov    -0x34(%ebp,%eax,4),%eax
+     385:	85 c0                	test   %eax,%eax
+     387:	75 4a                	jne    3d3 <test+0xb1>
+            setgroup(GROUP);
+     389:	83 ec 0c             	sub    $0xc,%esp
+     38c:	6a 4d                	push   $0x4d
+     38e:	e8 22 0a 00 00       	call   db5 <setgroup>
+     393:	83 c4 10             	add    $0x10,%esp
+            setweight(0, w[i]);
+     396:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     399:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+     3a0:	8b 45 0c             	mov    0xc(%ebp),%eax
+     3a3:	01 d0                	add    %edx,%eax
+     3a5:	8b 00                	mov    (%eax),%eax
+     3a7:	83 ec 08             	sub    $0x8,%esp
+     3aa:	50                   	push   %eax
+     3ab:	6a 00                	push   $0x0
+     3ad:	e8 f9 09 00 00       	call   dab <setweight>
+     3b2:	83 c4 10             	add    $0x10,%esp
+            for(;;)
+                for(j = 0; j < 1000000; j++)
+     3b5:	c7 45 88 00 00 00 00 	movl   $0x0,-0x78(%ebp)
+     3bc:	eb 09                	jmp    3c7 <test+0xa5>
+     3be:	8b 45 88             	mov    -0x78(%ebp),%eax
+     3c1:	83 c0 01             	add    $0x1,%eax
+     3c4:	89 45 88             	mov    %eax,-0x78(%ebp)
+     3c7:	8b 45 88             	mov    -0x78(%ebp),%eax
+     3ca:	3d 3f 42 0f 00       	cmp    $0xf423f,%eax
+     3cf:	7e ed                	jle    3be <test+0x9c>
+     3d1:	eb e2                	jmp    3b5 <test+0x93>
+    for(i = 0; i < nw; i++){
+     3d3:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+     3d7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     3da:	3b 45 08             	cmp    0x8(%ebp),%eax
+     3dd:	0f 8c 59 ff ff ff    	jl     33c <test+0x1a>
+                    ;
+        }
+    }
+
+    sleep(50);
+     3e3:	83 ec 0c             	sub    $0xc,%esp
+     3e6:	6a 32                	push   $0x32
+     3e8:	e8 64 09 00 00       	call   d51 <sleep>
+     3ed:	83 c4 10             	add    $0x10,%esp
+    for(i = 0; i < nw; i++)
+     3f0:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     3f7:	eb 1e                	jmp    417 <test+0xf5>
+        start[i] = runtime(pids[i]);
+     3f9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     3fc:	8b 44 85 cc          	mov    -0x34(%ebp,%eax,4),%eax
+     400:	83 ec 0c             	sub    $0xc,%esp
+     403:	50                   	push   %eax
+     404:	e8 b3 fe ff ff       	call   2bc <runtime>
+     409:	83 c4 10             	add    $0x10,%esp
+     40c:	8b 55 f4             	mov    -0xc(%ebp),%edx
+     40f:	89 44 95 ac          	mov    %eax,-0x54(%ebp,%edx,4)
+    for(i = 0; i < nw; i++)
+     413:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+     417:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     41a:	3b 45 08             	cmp    0x8(%ebp),%eax
+     41d:	7c da                	jl     3f9 <test+0xd7>
+    sleep(500);
+     41f:	83 ec 0c             	sub    $0xc,%esp
+     422:	68 f4 01 00 00       	push   $0x1f4
+     427:	e8 25 09 00 00       	call   d51 <sleep>
+     42c:	83 c4 10             	add    $0x10,%esp
+    total = 0;
+     42f:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+    for(i = 0; i < nw; i++){
+     436:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     43d:	eb 33                	jmp    472 <test+0x150>
+        used[i] = runtime(pids[i]) - start[i];
+     43f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     442:	8b 44 85 cc          	mov    -0x34(%ebp,%eax,4),%eax
+     446:	83 ec 0c             	sub    $0xc,%esp
+     449:	50                   	push   %eax
+     44a:	e8 6d fe ff ff       	call   2bc <runtime>
+     44f:	83 c4 10             	add    $0x10,%esp
+     452:	89 c2                	mov    %eax,%edx
+     454:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     457:	8b 44 85 ac          	mov    -0x54(%ebp,%eax,4),%eax
+     45b:	29 c2                	sub    %eax,%edx
+     45d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     460:	89 54 85 8c          	mov    %edx,-0x74(%ebp,%eax,4)
+        total += used[i];
+     464:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     467:	8b 44 85 8c          	mov    -0x74(%ebp,%eax,4),%eax
+     46b:	01 45 ec             	add    %eax,-0x14(%ebp)
+    for(i = 0; i < nw; i++){
+     46e:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+     472:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     475:	3b 45 08             	cmp    0x8(%ebp),%eax
+     478:	7c c5                	jl     43f <test+0x11d>
+    }
+    for(i = 0; i < nw; i++){
+     47a:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     481:	eb 1c                	jmp    49f <test+0x17d>
+        kill(pids[i]);
+     483:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     486:	8b 44 85 cc          	mov    -0x34(%ebp,%eax,4),%eax
+     48a:	83 ec 0c             	sub    $0xc,%esp
+     48d:	50                   	push   %eax
+     48e:	e8 46 08 00 00       	call   cd9 <kill>
+     493:	83 c4 10             	add    $0x10,%esp
+        wait();
+     496:	e8 12 08 00 00       	call   cad <wait>
+    for(i = 0; i < nw; i++){
+     49b:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+     49f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     4a2:	3b 45 08             	cmp    0x8(%ebp),%eax
+     4a5:	7c dc                	jl     483 <test+0x161>
+    }
+
+    printf(1, "weight\twant\tgot\n");
+     4a7:	83 ec 08             	sub    $0x8,%esp
+     4aa:	68 e3 13 00 00       	push   $0x13e3
+     4af:	6a 01                	push   $0x1
+     4b1:	e8 ee 0a 00 00       	call   fa4 <printf>
+     4b6:	83 c4 10             	add    $0x10,%esp
+    for(i = 0; i < nw; i++)
+     4b9:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     4c0:	eb 65                	jmp    527 <test+0x205>
+        printf(1, "%d\t%d%%\t%d%%\n", w[i], w[i]*100/wsum,
+     4c2:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+     4c6:	74 16                	je     4de <test+0x1bc>
+            total ? used[i]*100/total : 0);
+     4c8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     4cb:	8b 44 85 8c          	mov    -0x74(%ebp,%eax,4),%eax
+     4cf:	6b c0 64             	imul   $0x64,%eax,%eax
+        printf(1, "%d\t%d%%\t%d%%\n", w[i], w[i]*100/wsum,
+     4d2:	ba 00 00 00 00       	mov    $0x0,%edx
+     4d7:	f7 75 ec             	divl   -0x14(%ebp)
+     4da:	89 c1                	mov    %eax,%ecx
+     4dc:	eb 05                	jmp    4e3 <test+0x1c1>
+     4de:	b9 00 00 00 00       	mov    $0x0,%ecx
+     4e3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     4e6:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+     4ed:	8b 45 0c             	mov    0xc(%ebp),%eax
+     4f0:	01 d0                	add    %edx,%eax
+     4f2:	8b 00                	mov    (%eax),%eax
+     4f4:	6b c0 64             	imul   $0x64,%eax,%eax
+     4f7:	99                   	cltd
+     4f8:	f7 7d f0             	idivl  -0x10(%ebp)
+     4fb:	89 c3                	mov    %eax,%ebx
+     4fd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     500:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+     507:	8b 45 0c             	mov    0xc(%ebp),%eax
+     50a:	01 d0                	add    %edx,%eax
+     50c:	8b 00                	mov    (%eax),%eax
+     50e:	83 ec 0c             	sub    $0xc,%esp
+     511:	51                   	push   %ecx
+     512:	53                   	push   %ebx
+     513:	50                   	push   %eax
+     514:	68 f4 13 00 00       	push   $0x13f4
+     519:	6a 01                	push   $0x1
+     51b:	e8 84 0a 00 00       	call   fa4 <printf>
+     520:	83 c4 20             	add    $0x20,%esp
+    for(i = 0; i < nw; i++)
+     523:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+     527:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     52a:	3b 45 08             	cmp    0x8(%ebp),%eax
+     52d:	7c 93                	jl     4c2 <test+0x1a0>
+}
+     52f:	90                   	nop
+     530:	90                   	nop
+     531:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     534:	c9                   	leave
+     535:	c3                   	ret
+
+00000536 <gtest>:
+
+// Group i gets weight w[i] and i+1 spinners of the default weight;
+// each group should get its weight's share whatever its size.
+void
+gtest(int nw, int *w)
+{
+     536:	55                   	push   %ebp
+     537:	89 e5                	mov    %esp,%ebp
+     539:	56                   	push   %esi
+     53a:	53                   	push   %ebx
+     53b:	83 c4 80             	add    $0xffffff80,%esp
+    int i, k, n, wsum, pids[NGSPIN][NGSPIN];
+    uint start[NGSPIN], used[NGSPIN], total;
+    volatile int j;
+
+    wsum = 0;
+     53e:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+    for(i = 0; i < nw; i++){
+     545:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     54c:	e9 e7 00 00 00       	jmp    638 <gtest+0x102>
+        wsum += w[i];
+     551:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     554:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+     55b:	8b 45 0c             	mov    0xc(%ebp),%eax
+     55e:	01 d0                	add    %edx,%eax
+     560:	8b 00                	mov    (%eax),%eax
+     562:	01 45 e8             	add    %eax,-0x18(%ebp)
+        for(k = 0; k <= i; k++){
+     565:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+     56c:	e9 b7 00 00 00       	jmp    628 <gtest+0xf2>
+            pids[i][k] = fork();
+     571:	e8 29 07 00 00       	call   c9f <fork>
+     576:	8b 55 f4             	mov    -0xc(%ebp),%edx
+     579:	8d 0c 95 00 00 00 00 	lea    0x0(,%edx,4),%ecx
+     580:	8b 55 f0             	mov    -0x10(%ebp),%edx
+     583:	01 ca                	add    %ecx,%edx
+     585:	89 44 95 a4          	mov    %eax,-0x5c(%ebp,%edx,4)
+            if(pids[i][k] < 0){
+     589:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     58c:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+     593:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     596:	01 d0                	add    %edx,%eax
+     598:	8b 44 85 a4          	mov    -0x5c(%ebp,%eax,4),%eax
+     59c:	85 c0                	test   %eax,%eax
+     59e:	79 17                	jns    5b7 <gtest+0x81>
+                printf(2, "shares: fork failed\n");
+     5a0:	83 ec 08             	sub    $0x8,%esp
+     5a3:	68 ce 13 00 00       	push   $0x13ce
+     5a8:	6a 02                	push   $0x2
+     5aa:	e8 f5 09 00 00       	call   fa4 <printf>
+     5af:	83 c4 10             	add    $0x10,%esp
+                exit();
+     5b2:	e8 ef 06 00 00       	call   ca6 <exit>
+            }
+            if(pids[i][k] == 0){
+     5b7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     5ba:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+     5c1:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     5c4:	01 d0                	add    %edx,%eax
+     5c6:	8b 44 85 a4          	mov    -0x5c(%ebp,%eax,4),%eax
+     5ca:	85 c0                	test   %eax,%eax
+     5cc:	75 56                	jne    624 <gtest+0xee>
+                setgroup(GROUP+1+i);
+     5ce:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     5d1:	83 c0 4e             	add    $0x4e,%eax
+     5d4:	83 ec 0c             	sub    $0xc,%esp
+     5d7:	50                   	push   %eax
+     5d8:	e8 d8 07 00 00       	call   db5 <setgroup>
+     5dd:	83 c4 10             	add    $0x10,%esp
+                setweight(-(GROUP+1+i), w[i]);
+     5e0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     5e3:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+     5ea:	8b 45 0c             	mov    0xc(%ebp),%eax
+     5ed:	01 d0                	add    %edx,%eax
+     5ef:	8b 10                	mov    (%eax),%edx
+     5f1:	b8 b2 ff ff ff       	mov    $0xffffffb2,%eax
+     5f6:	2b 45 f4             	sub    -0xc(%ebp),%eax
+     5f9:	83 ec 08             	sub    $0x8,%esp
+     5fc:	52                   	push   %edx
+     5fd:	50                   	push   %eax
+     5fe:	e8 a8 07 00 00       	call   dab <setweight>
+     603:	83 c4 10             	add    $0x10,%esp
+                for(;;)
+                    for(j = 0; j < 1000000; j++)
+     606:	c7 45 80 00 00 00 00 	movl   $0x0,-0x80(%ebp)
+     60d:	eb 09                	jmp    618 <gtest+0xe2>
+     60f:	8b 45 80             	mov    -0x80(%ebp),%eax
+     612:	83 c0 01             	add    $0x1,%eax
+     615:	89 45 80             	mov    %eax,-0x80(%ebp)
+     618:	8b 45 80             	mov    -0x80(%ebp),%eax
+     61b:	3d 3f 42 0f 00       	cmp    $0xf423f,%eax
+     620:	7e ed                	jle    60f <gtest+0xd9>
+     622:	eb e2                	jmp    606 <gtest+0xd0>
+        for(k = 0; k <= i; k++){
+     624:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+     628:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     62b:	3b 45 f4             	cmp    -0xc(%ebp),%eax
+     62e:	0f 8e 3d ff ff ff    	jle    571 <gtest+0x3b>
+    for(i = 0; i < nw; i++){
+     634:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+     638:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     63b:	3b 45 08             	cmp    0x8(%ebp),%eax
+     63e:	0f 8c 0d ff ff ff    	jl     551 <gtest+0x1b>
+                        ;
+            }
+        }
+    }
+
+    sleep(50);
+     644:	83 ec 0c             	sub    $0xc,%esp
+     647:	6a 32                	push   $0x32
+     649:	e8 03 07 00 00       	call   d51 <sleep>
+     64e:	83 c4 10             	add    $0x10,%esp
+    for(i = 0; i < nw; i++)
+     651:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     658:	eb 53                	jmp    6ad <gtest+0x177>
+        for(k = 0, start[i] = 0; k <= i; k++)
+     65a:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+     661:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     664:	c7 44 85 94 00 00 00 	movl   $0x0,-0x6c(%ebp,%eax,4)
+     66b:	00 
+     66c:	eb 33                	jmp    6a1 <gtest+0x16b>
+            start[i] += runtime(pids[i][k]);
+     66e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     671:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+     678:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     67b:	01 d0                	add    %edx,%eax
+     67d:	8b 44 85 a4          	mov    -0x5c(%ebp,%eax,4),%eax
+     681:	83 ec 0c             	sub    $0xc,%esp
+     684:	50                   	push   %eax
+     685:	e8 32 fc ff ff       	call   2bc <runtime>
+     68a:	83 c4 10             	add    $0x10,%esp
+     68d:	8b 55 f4             	mov    -0xc(%ebp),%edx
+     690:	8b 54 95 94          	mov    -0x6c(%ebp,%edx,4),%edx
+     694:	01 c2                	add    %eax,%edx
+     696:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     699:	89 54 85 94          	mov    %edx,-0x6c(%ebp,%eax,4)
+        for(k = 0, start[i] = 0; k <= i; k++)
+     69d:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+     6a1:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     6a4:	3b 45 f4             	cmp    -0xc(%ebp),%eax
+     6a7:	7e c5                	jle    66e <gtest+0x138>
+    for(i = 0; i < nw; i++)
+     6a9:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+     6ad:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     6b0:	3b 45 08             	cmp    0x8(%ebp),%eax
+     6b3:	7c a5                	jl     65a <gtest+0x124>
+    sleep(500);
+     6b5:	83 ec 0c             	sub    $0xc,%esp
+     6b8:	68 f4 01 00 00       	push   $0x1f4
+     6bd:	e8 8f 06 00 00       	call   d51 <sleep>
+     6c2:	83 c4 10             	add    $0x10,%esp
+    total = 0;
+     6c5:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+    for(i = 0; i < nw; i++){
+     6cc:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     6d3:	eb 74                	jmp    749 <gtest+0x213>
+        for(k = 0, used[i] = 0; k <= i; k++)
+     6d5:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+     6dc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     6df:	c7 44 85 84 00 00 00 	movl   $0x0,-0x7c(%ebp,%eax,4)
+     6e6:	00 
+     6e7:	eb 33                	jmp    71c <gtest+0x1e6>
+            used[i] += runtime(pids[i][k]);
+     6e9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     6ec:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+     6f3:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     6f6:	01 d0                	add    %edx,%eax
+     6f8:	8b 44 85 a4          	mov    -0x5c(%ebp,%eax,4),%eax
+     6fc:	83 ec 0c             	sub    $0xc,%esp
+     6ff:	50                   	push   %eax
+     700:	e8 b7 fb ff ff       	call   2bc <runtime>
+     705:	83 c4 10             	add    $0x10,%esp
+     708:	8b 55 f4             	mov    -0xc(%ebp),%edx
+     70b:	8b 54 95 84          	mov    -0x7c(%ebp,%edx,4),%edx
+     70f:	01 c2                	add    %eax,%edx
+     711:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     714:	89 54 85 84          	mov    %edx,-0x7c(%ebp,%eax,4)
+        for(k = 0, used[i] = 0; k <= i; k++)
+     718:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+     71c:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     71f:	3b 45 f4             	cmp    -0xc(%ebp),%eax
+     722:	7e c5                	jle    6e9 <gtest+0x1b3>
+        used[i] -= start[i];
+     724:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     727:	8b 54 85 84          	mov    -0x7c(%ebp,%eax,4),%edx
+     72b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     72e:	8b 44 85 94          	mov    -0x6c(%ebp,%eax,4),%eax
+     732:	29 c2                	sub    %eax,%edx
+     734:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     737:	89 54 85 84          	mov    %edx,-0x7c(%ebp,%eax,4)
+        total += used[i];
+     73b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     73e:	8b 44 85 84          	mov    -0x7c(%ebp,%eax,4),%eax
+     742:	01 45 e4             	add    %eax,-0x1c(%ebp)
+    for(i = 0; i < nw; i++){
+     745:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+     749:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     74c:	3b 45 08             	cmp    0x8(%ebp),%eax
+     74f:	7c 84                	jl     6d5 <gtest+0x19f>
+    }
+    for(i = 0, n = 0; i < nw; i++){
+     751:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     758:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+     75f:	eb 3c                	jmp    79d <gtest+0x267>
+        for(k = 0; k <= i; k++, n++)
+     761:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+     768:	eb 27                	jmp    791 <gtest+0x25b>
+            kill(pids[i][k]);
+     76a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     76d:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+     774:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     777:	01 d0                	add    %edx,%eax
+     779:	8b 44 85 a4          	mov    -0x5c(%ebp,%eax,4),%eax
+     77d:	83 ec 0c             	sub    $0xc,%esp
+     780:	50                   	push   %eax
+     781:	e8 53 05 00 00       	call   cd9 <kill>
+     786:	83 c4 10             	add    $0x10,%esp
+        for(k = 0; k <= i; k++, n++)
+     789:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+     78d:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+     791:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     794:	3b 45 f4             	cmp    -0xc(%ebp),%eax
+     797:	7e d1                	jle    76a <gtest+0x234>
+    for(i = 0, n = 0; i < nw; i++){
+     799:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+     79d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     7a0:	3b 45 08             	cmp    0x8(%ebp),%eax
+     7a3:	7c bc                	jl     761 <gtest+0x22b>
+    }
+    while(n-- > 0)
+     7a5:	eb 05                	jmp    7ac <gtest+0x276>
+        wait();
+     7a7:	e8 01 05 00 00       	call   cad <wait>
+    while(n-- > 0)
+     7ac:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     7af:	8d 50 ff             	lea    -0x1(%eax),%edx
+     7b2:	89 55 ec             	mov    %edx,-0x14(%ebp)
+     7b5:	85 c0                	test   %eax,%eax
+     7b7:	7f ee                	jg     7a7 <gtest+0x271>
+
+    printf(1, "group\tweight\tprocs\twant\tgot\n");
+     7b9:	83 ec 08             	sub    $0x8,%esp
+     7bc:	68 02 14 00 00       	push   $0x1402
+     7c1:	6a 01                	push   $0x1
+     7c3:	e8 dc 07 00 00       	call   fa4 <printf>
+     7c8:	83 c4 10             	add    $0x10,%esp
+    for(i = 0; i < nw; i++)
+     7cb:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     7d2:	eb 73                	jmp    847 <gtest+0x311>
+        printf(1, "%d\t%d\t%d\t%d%%\t%d%%\n", GROUP+1+i, w[i], i+1,
+     7d4:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+     7d8:	74 16                	je     7f0 <gtest+0x2ba>
+            w[i]*100/wsum, total ? used[i]*100/total : 0);
+     7da:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     7dd:	8b 44 85 84          	mov    -0x7c(%ebp,%eax,4),%eax
+     7e1:	6b c0 64             	imul   $0x64,%eax,%eax
+        printf(1, "%d\t%d\t%d\t%d%%\t%d%%\n", GROUP+1+i, w[i], i+1,
+     7e4:	ba 00 00 00 00       	mov    $0x0,%edx
+     7e9:	f7 75 e4             	divl   -0x1c(%ebp)
+     7ec:	89 c3                	mov    %eax,%ebx
+     7ee:	eb 05                	jmp    7f5 <gtest+0x2bf>
+     7f0:	bb 00 00 00 00       	mov    $0x0,%ebx
+            w[i]*100/wsum, total ? used[i]*100/total : 0);
+     7f5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     7f8:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+     7ff:	8b 45 0c             	mov    0xc(%ebp),%eax
+     802:	01 d0                	add    %edx,%eax
+     804:	8b 00                	mov    (%eax),%eax
+     806:	6b c0 64             	imul   $0x64,%eax,%eax
+        printf(1, "%d\t%d\t%d\t%d%%\t%d%%\n", GROUP+1+i, w[i], i+1,
+     809:	99                   	cltd
+     80a:	f7 7d e8             	idivl  -0x18(%ebp)
+     80d:	89 c6                	mov    %eax,%esi
+     80f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     812:	8d 48 01             	lea    0x1(%eax),%ecx
+     815:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     818:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+     81f:	8b 45 0c             	mov    0xc(%ebp),%eax
+     822:	01 d0                	add    %edx,%eax
+     824:	8b 00                	mov    (%eax),%eax
+     826:	8b 55 f4             	mov    -0xc(%ebp),%edx
+     829:	83 c2 4e             	add    $0x4e,%edx
+     82c:	83 ec 04             	sub    $0x4,%esp
+     82f:	53                   	push   %ebx
+     830:	56                   	push   %esi
+     831:	51                   	push   %ecx
+     832:	50                   	push   %eax
+     833:	52                   	push   %edx
+     834:	68 1f 14 00 00       	push   $0x141f
+     839:	6a 01                	push   $0x1
+     83b:	e8 64 07 00 00       	call   fa4 <printf>
+     840:	83 c4 20             	add    $0x20,%esp
+    for(i = 0; i < nw; i++)
+     843:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+     847:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     84a:	3b 45 08             	cmp    0x8(%ebp),%eax
+     84d:	7c 85                	jl     7d4 <gtest+0x29e>
+}
+     84f:	90                   	nop
+     850:	90                   	nop
+     851:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     854:	5b                   	pop    %ebx
+     855:	5e                   	pop    %esi
+     856:	5d                   	pop    %ebp
+     857:	c3                   	ret
+
+00000858 <main>:
+
+int
+main(int argc, char *argv[])
+{
+     858:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+     85c:	83 e4 f0             	and    $0xfffffff0,%esp
+     85f:	ff 71 fc             	push   -0x4(%ecx)
+     862:	55                   	push   %ebp
+     863:	89 e5                	mov    %esp,%ebp
+     865:	53                   	push   %ebx
+     866:	51                   	push   %ecx
+     867:	83 ec 30             	sub    $0x30,%esp
+     86a:	89 cb                	mov    %ecx,%ebx
+    int i, nw, w[NSPIN];
+
+    if(argc < 2){
+     86c:	83 3b 01             	cmpl   $0x1,(%ebx)
+     86f:	7f 0a                	jg     87b <main+0x23>
+        list();
+     871:	e8 8a f7 ff ff       	call   0 <list>
+        exit();
+     876:	e8 2b 04 00 00       	call   ca6 <exit>
+    }
+    if(strcmp(argv[1], "-t") != 0 && strcmp(argv[1], "-g") != 0){
+     87b:	8b 43 04             	mov    0x4(%ebx),%eax
+     87e:	83 c0 04             	add    $0x4,%eax
+     881:	8b 00                	mov    (%eax),%eax
+     883:	83 ec 08             	sub    $0x8,%esp
+     886:	68 33 14 00 00       	push   $0x1433
+     88b:	50                   	push   %eax
+     88c:	e8 61 01 00 00       	call   9f2 <strcmp>
+     891:	83 c4 10             	add    $0x10,%esp
+     894:	85 c0                	test   %eax,%eax
+     896:	74 34                	je     8cc <main+0x74>
+     898:	8b 43 04             	mov    0x4(%ebx),%eax
+     89b:	83 c0 04             	add    $0x4,%eax
+     89e:	8b 00                	mov    (%eax),%eax
+     8a0:	83 ec 08             	sub    $0x8,%esp
+     8a3:	68 36 14 00 00       	push   $0x1436
+     8a8:	50                   	push   %eax
+     8a9:	e8 44 01 00 00       	call   9f2 <strcmp>
+     8ae:	83 c4 10             	add    $0x10,%esp
+     8b1:	85 c0                	test   %eax,%eax
+     8b3:	74 17                	je     8cc <main+0x74>
+        printf(2, "usage: shares [-t|-g [weight...]]\n");
+     8b5:	83 ec 08             	sub    $0x8,%esp
+     8b8:	68 3c 14 00 00       	push   $0x143c
+     8bd:	6a 02                	push   $0x2
+     8bf:	e8 e0 06 00 00       	call   fa4 <printf>
+     8c4:	83 c4 10             	add    $0x10,%esp
+        exit();
+     8c7:	e8 da 03 00 00       	call   ca6 <exit>
+    }
+    nw = 0;
+     8cc:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+    for(i = 2; i < argc && nw < (argv[1][1] == 'g' ? NGSPIN : NSPIN); i++)
+     8d3:	c7 45 f4 02 00 00 00 	movl   $0x2,-0xc(%ebp)
+     8da:	eb 37                	jmp    913 <main+0xbb>
+        if((w[nw] = atoi(argv[i])) > 0)
+     8dc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     8df:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+     8e6:	8b 43 04             	mov    0x4(%ebx),%eax
+     8e9:	01 d0                	add    %edx,%eax
+     8eb:	8b 00                	mov    (%eax),%eax
+     8ed:	83 ec 0c             	sub    $0xc,%esp
+     8f0:	50                   	push   %eax
+     8f1:	e8 6b 02 00 00       	call   b61 <atoi>
+     8f6:	83 c4 10             	add    $0x10,%esp
+     8f9:	8b 55 f0             	mov    -0x10(%ebp),%edx
+     8fc:	89 44 95 d0          	mov    %eax,-0x30(%ebp,%edx,4)
+     900:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     903:	8b 44 85 d0          	mov    -0x30(%ebp,%eax,4),%eax
+     907:	85 c0                	test   %eax,%eax
+     909:	7e 04                	jle    90f <main+0xb7>
+            nw++;
+     90b:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+    for(i = 2; i < argc && nw < (argv[1][1] == 'g' ? NGSPIN : NSPIN); i++)
+     90f:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+     913:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     916:	3b 03                	cmp    (%ebx),%eax
+     918:	7d 23                	jge    93d <main+0xe5>
+     91a:	8b 43 04             	mov    0x4(%ebx),%eax
+     91d:	83 c0 04             	add    $0x4,%eax
+     920:	8b 00                	mov    (%eax),%eax
+     922:	83 c0 01             	add    $0x1,%eax
+     925:	0f b6 00             	movzbl (%eax),%eax
+     928:	3c 67                	cmp    $0x67,%al
+     92a:	75 07                	jne    933 <main+0xdb>
+     92c:	b8 04 00 00 00       	mov    $0x4,%eax
+     931:	eb 05                	jmp    938 <main+0xe0>
+     933:	b8 08 00 00 00       	mov    $0x8,%eax
+     938:	3b 45 f0             	cmp    -0x10(%ebp),%eax
+     93b:	7f 9f                	jg     8dc <main+0x84>
+    if(nw == 0){
+     93d:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+     941:	75 1c                	jne    95f <main+0x107>
+        w[0] = 1024;
+     943:	c7 45 d0 00 04 00 00 	movl   $0x400,-0x30(%ebp)
+        w[1] = 2048;
+     94a:	c7 45 d4 00 08 00 00 	movl   $0x800,-0x2c(%ebp)
+        w[2] = 4096;
+     951:	c7 45 d8 00 10 00 00 	movl   $0x1000,-0x28(%ebp)
+        nw = 3;
+     958:	c7 45 f0 03 00 00 00 	movl   $0x3,-0x10(%ebp)
+    }
+    if(argv[1][1] == 'g')
+     95f:	8b 43 04             	mov    0x4(%ebx),%eax
+     962:	83 c0 04             	add    $0x4,%eax
+     965:	8b 00                	mov    (%eax),%eax
+     967:	83 c0 01             	add    $0x1,%eax
+     96a:	0f b6 00             	movzbl (%eax),%eax
+     96d:	3c 67                	cmp    $0x67,%al
+     96f:	75 14                	jne    985 <main+0x12d>
+        gtest(nw, w);
+     971:	83 ec 08             	sub    $0x8,%esp
+     974:	8d 45 d0             	lea    -0x30(%ebp),%eax
+     977:	50                   	push   %eax
+     978:	ff 75 f0             	push   -0x10(%ebp)
+     97b:	e8 b6 fb ff ff       	call   536 <gtest>
+     980:	83 c4 10             	add    $0x10,%esp
+     983:	eb 12                	jmp    997 <main+0x13f>
+    else
+        test(nw, w);
+     985:	83 ec 08             	sub    $0x8,%esp
+     988:	8d 45 d0             	lea    -0x30(%ebp),%eax
+     98b:	50                   	push   %eax
+     98c:	ff 75 f0             	push   -0x10(%ebp)
+     98f:	e8 8e f9 ff ff       	call   322 <test>
+     994:	83 c4 10             	add    $0x10,%esp
+    exit();
+     997:	e8 0a 03 00 00       	call   ca6 <exit>
+
+0000099c <stosb>:
+strchr(const char *s, char c)
+{
+    for(; *s; s++)
+        if(*s == c)
+            return (char*)s;
+    return 0;
+     99c:	55                   	push   %ebp
+     99d:	89 e5                	mov    %esp,%ebp
+     99f:	57                   	push   %edi
+     9a0:	53                   	push   %ebx
+}
+     9a1:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     9a4:	8b 55 10             	mov    0x10(%ebp),%edx
+     9a7:	8b 45 0c             	mov    0xc(%ebp),%eax
+     9aa:	89 cb                	mov    %ecx,%ebx
+     9ac:	89 df                	mov    %ebx,%edi
+     9ae:	89 d1                	mov    %edx,%ecx
+     9b0:	fc                   	cld
+     9b1:	f3 aa                	rep stos %al,%es:(%edi)
+     9b3:	89 ca                	mov    %ecx,%edx
+     9b5:	89 fb                	mov    %edi,%ebx
+     9b7:	89 5d 08             	mov    %ebx,0x8(%ebp)
+     9ba:	89 55 10             	mov    %edx,0x10(%ebp)
+
+char*
+gets(char *buf, int max)
+{
+     9bd:	90                   	nop
+     9be:	5b                   	pop    %ebx
+     9bf:	5f                   	pop    %edi
+     9c0:	5d                   	pop    %ebp
+     9c1:	c3                   	ret
+
+000009c2 <strcpy>:
+{
+     9c2:	55                   	push   %ebp
+     9c3:	89 e5                	mov    %esp,%ebp
+     9c5:	83 ec 10             	sub    $0x10,%esp
+    os = s;
+     9c8:	8b 45 08             	mov    0x8(%ebp),%eax
+     9cb:	89 45 fc             	mov    %eax,-0x4(%ebp)
+    while((*s++ = *t++) != 0)
+     9ce:	90                   	nop
+     9cf:	8b 55 0c             	mov    0xc(%ebp),%edx
+     9d2:	8d 42 01             	lea    0x1(%edx),%eax
+     9d5:	89 45 0c             	mov    %eax,0xc(%ebp)
+     9d8:	8b 45 08             	mov    0x8(%ebp),%eax
+     9db:	8d 48 01             	lea    0x1(%eax),%ecx
+     9de:	89 4d 08             	mov    %ecx,0x8(%ebp)
+     9e1:	0f b6 12             	movzbl (%edx),%edx
+     9e4:	88 10                	mov    %dl,(%eax)
+     9e6:	0f b6 00             	movzbl (%eax),%eax
+     9e9:	84 c0                	test   %al,%al
+     9eb:	75 e2                	jne    9cf <strcpy+0xd>
+    return os;
+     9ed:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+     9f0:	c9                   	leave
+     9f1:	c3                   	ret
+
+000009f2 <strcmp>:
+{
+     9f2:	55                   	push   %ebp
+     9f3:	89 e5                	mov    %esp,%ebp
+    while(*p && *p == *q)
+     9f5:	eb 08                	jmp    9ff <strcmp+0xd>
+        p++, q++;
+     9f7:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+     9fb:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+    while(*p && *p == *q)
+     9ff:	8b 45 08             	mov    0x8(%ebp),%eax
+     a02:	0f b6 00             	movzbl (%eax),%eax
+     a05:	84 c0                	test   %al,%al
+     a07:	74 10                	je     a19 <strcmp+0x27>
+     a09:	8b 45 08             	mov    0x8(%ebp),%eax
+     a0c:	0f b6 10             	movzbl (%eax),%edx
+     a0f:	8b 45 0c             	mov    0xc(%ebp),%eax
+     a12:	0f b6 00             	movzbl (%eax),%eax
+     a15:	38 c2                	cmp    %al,%dl
+     a17:	74 de                	je     9f7 <strcmp+0x5>
+    return (uchar)*p - (uchar)*q;
+     a19:	8b 45 08             	mov    0x8(%ebp),%eax
+     a1c:	0f b6 00             	movzbl (%eax),%eax
+     a1f:	0f b6 d0             	movzbl %al,%edx
+     a22:	8b 45 0c             	mov    0xc(%ebp),%eax
+     a25:	0f b6 00             	movzbl (%eax),%eax
+     a28:	0f b6 c0             	movzbl %al,%eax
+     a2b:	29 c2                	sub    %eax,%edx
+     a2d:	89 d0                	mov    %edx,%eax
+}
+     a2f:	5d                   	pop    %ebp
+     a30:	c3                   	ret
+
+00000a31 <strlen>:
+{
+     a31:	55                   	push   %ebp
+     a32:	89 e5                	mov    %esp,%ebp
+     a34:	83 ec 10             	sub    $0x10,%esp
+    for(n = 0; s[n]; n++)
+     a37:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+     a3e:	eb 04                	jmp    a44 <strlen+0x13>
+     a40:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+     a44:	8b 55 fc             	mov    -0x4(%ebp),%edx
+     a47:	8b 45 08             	mov    0x8(%ebp),%eax
+     a4a:	01 d0                	add    %edx,%eax
+     a4c:	0f b6 00             	movzbl (%eax),%eax
+     a4f:	84 c0                	test   %al,%al
+     a51:	75 ed                	jne    a40 <strlen+0xf>
+    return n;
+     a53:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+     a56:	c9                   	leave
+     a57:	c3                   	ret
+
+00000a58 <memset>:
+{
+     a58:	55                   	push   %ebp
+     a59:	89 e5                	mov    %esp,%ebp
+    stosb(dst, c, n);
+     a5b:	8b 45 10             	mov    0x10(%ebp),%eax
+     a5e:	50                   	push   %eax
+     a5f:	ff 75 0c             	push   0xc(%ebp)
+     a62:	ff 75 08             	push   0x8(%ebp)
+     a65:	e8 32 ff ff ff       	call   99c <stosb>
+     a6a:	83 c4 0c             	add    $0xc,%esp
+    return dst;
+     a6d:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+     a70:	c9                   	leave
+     a71:	c3                   	ret
+
+00000a72 <strchr>:
+{
+     a72:	55                   	push   %ebp
+     a73:	89 e5                	mov    %esp,%ebp
+     a75:	83 ec 04             	sub    $0x4,%esp
+     a78:	8b 45 0c             	mov    0xc(%ebp),%eax
+     a7b:	88 45 fc             	mov    %al,-0x4(%ebp)
+    for(; *s; s++)
+     a7e:	eb 14                	jmp    a94 <strchr+0x22>
+        if(*s == c)
+     a80:	8b 45 08             	mov    0x8(%ebp),%eax
+     a83:	0f b6 00             	movzbl (%eax),%eax
+     a86:	38 45 fc             	cmp    %al,-0x4(%ebp)
+     a89:	75 05                	jne    a90 <strchr+0x1e>
+            return (char*)s;
+     a8b:	8b 45 08             	mov    0x8(%ebp),%eax
+     a8e:	eb 13                	jmp    aa3 <strchr+0x31>
+    for(; *s; s++)
+     a90:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+     a94:	8b 45 08             	mov    0x8(%ebp),%eax
+     a97:	0f b6 00             	movzbl (%eax),%eax
+     a9a:	84 c0                	test   %al,%al
+     a9c:	75 e2                	jne    a80 <strchr+0xe>
+    return 0;
+     a9e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     aa3:	c9                   	leave
+     aa4:	c3                   	ret
+
+00000aa5 <gets>:
+{
+     aa5:	55                   	push   %ebp
+     aa6:	89 e5                	mov    %esp,%ebp
+     aa8:	83 ec 18             	sub    $0x18,%esp
+    int i, cc;
+    char c;
+
+    for(i=0; i+1 < max; ){
+     aab:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     ab2:	eb 42                	jmp    af6 <gets+0x51>
+        cc = read(0, &c, 1);
+     ab4:	83 ec 04             	sub    $0x4,%esp
+     ab7:	6a 01                	push   $0x1
+     ab9:	8d 45 ef             	lea    -0x11(%ebp),%eax
+     abc:	50                   	push   %eax
+     abd:	6a 00                	push   $0x0
+     abf:	e8 f7 01 00 00       	call   cbb <read>
+     ac4:	83 c4 10             	add    $0x10,%esp
+     ac7:	89 45 f0             	mov    %eax,-0x10(%ebp)
+        if(cc < 1)
+     aca:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+     ace:	7e 33                	jle    b03 <gets+0x5e>
+            break;
+        buf[i++] = c;
+     ad0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     ad3:	8d 50 01             	lea    0x1(%eax),%edx
+     ad6:	89 55 f4             	mov    %edx,-0xc(%ebp)
+     ad9:	89 c2                	mov    %eax,%edx
+     adb:	8b 45 08             	mov    0x8(%ebp),%eax
+     ade:	01 c2                	add    %eax,%edx
+     ae0:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+     ae4:	88 02                	mov    %al,(%edx)
+        if(c == '\n' || c == '\r')
+     ae6:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+     aea:	3c 0a                	cmp    $0xa,%al
+     aec:	74 16                	je     b04 <gets+0x5f>
+     aee:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+     af2:	3c 0d                	cmp    $0xd,%al
+     af4:	74 0e                	je     b04 <gets+0x5f>
+    for(i=0; i+1 < max; ){
+     af6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     af9:	83 c0 01             	add    $0x1,%eax
+     afc:	39 45 0c             	cmp    %eax,0xc(%ebp)
+     aff:	7f b3                	jg     ab4 <gets+0xf>
+     b01:	eb 01                	jmp    b04 <gets+0x5f>
+            break;
+     b03:	90                   	nop
+            break;
+    }
+    buf[i] = '\0';
+     b04:	8b 55 f4             	mov    -0xc(%ebp),%edx
+     b07:	8b 45 08             	mov    0x8(%ebp),%eax
+     b0a:	01 d0                	add    %edx,%eax
+     b0c:	c6 00 00             	movb   $0x0,(%eax)
+    return buf;
+     b0f:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+     b12:	c9                   	leave
+     b13:	c3                   	ret
+
+00000b14 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+     b14:	55                   	push   %ebp
+     b15:	89 e5                	mov    %esp,%ebp
+     b17:	83 ec 18             	sub    $0x18,%esp
+    int fd;
+    int r;
+
+    fd = open(n, O_RDONLY);
+     b1a:	83 ec 08             	sub    $0x8,%esp
+     b1d:	6a 00                	push   $0x0
+     b1f:	ff 75 08             	push   0x8(%ebp)
+     b22:	e8 c6 01 00 00       	call   ced <open>
+     b27:	83 c4 10             	add    $0x10,%esp
+     b2a:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(fd < 0)
+     b2d:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     b31:	79 07                	jns    b3a <stat+0x26>
+        return -1;
+     b33:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     b38:	eb 25                	jmp    b5f <stat+0x4b>
+    r = fstat(fd, st);
+     b3a:	83 ec 08             	sub    $0x8,%esp
+     b3d:	ff 75 0c             	push   0xc(%ebp)
+     b40:	ff 75 f4             	push   -0xc(%ebp)
+     b43:	e8 c3 01 00 00       	call   d0b <fstat>
+     b48:	83 c4 10             	add    $0x10,%esp
+     b4b:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    close(fd);
+     b4e:	83 ec 0c             	sub    $0xc,%esp
+     b51:	ff 75 f4             	push   -0xc(%ebp)
+     b54:	e8 76 01 00 00       	call   ccf <close>
+     b59:	83 c4 10             	add    $0x10,%esp
+    return r;
+     b5c:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+     b5f:	c9                   	leave
+     b60:	c3                   	ret
+
+00000b61 <atoi>:
+
+int
+atoi(const char *s)
+{
+     b61:	55                   	push   %ebp
+     b62:	89 e5                	mov    %esp,%ebp
+     b64:	83 ec 10             	sub    $0x10,%esp
+    int n;
+
+    n = 0;
+     b67:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+    while('0' <= *s && *s <= '9')
+     b6e:	eb 25                	jmp    b95 <atoi+0x34>
+        n = n*10 + *s++ - '0';
+     b70:	8b 55 fc             	mov    -0x4(%ebp),%edx
+     b73:	89 d0                	mov    %edx,%eax
+     b75:	c1 e0 02             	shl    $0x2,%eax
+     b78:	01 d0                	add    %edx,%eax
+     b7a:	01 c0                	add    %eax,%eax
+     b7c:	89 c1                	mov    %eax,%ecx
+     b7e:	8b 45 08             	mov    0x8(%ebp),%eax
+     b81:	8d 50 01             	lea    0x1(%eax),%edx
+     b84:	89 55 08             	mov    %edx,0x8(%ebp)
+     b87:	0f b6 00             	movzbl (%eax),%eax
+     b8a:	0f be c0             	movsbl %al,%eax
+     b8d:	01 c8                	add    %ecx,%eax
+     b8f:	83 e8 30             	sub    $0x30,%eax
+     b92:	89 45 fc             	mov    %eax,-0x4(%ebp)
+    while('0' <= *s && *s <= '9')
+     b95:	8b 45 08             	mov    0x8(%ebp),%eax
+     b98:	0f b6 00             	movzbl (%eax),%eax
+     b9b:	3c 2f                	cmp    $0x2f,%al
+     b9d:	7e 0a                	jle    ba9 <atoi+0x48>
+     b9f:	8b 45 08             	mov    0x8(%ebp),%eax
+     ba2:	0f b6 00             	movzbl (%eax),%eax
+     ba5:	3c 39                	cmp    $0x39,%al
+     ba7:	7e c7                	jle    b70 <atoi+0xf>
+    return n;
+     ba9:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+     bac:	c9                   	leave
+     bad:	c3                   	ret
+
+00000bae <nice>:
+
+// Add inc to the caller's nice value; return the new value.
+int
+nice(int inc)
+{
+     bae:	55                   	push   %ebp
+     baf:	89 e5                	mov    %esp,%ebp
+     bb1:	83 ec 18             	sub    $0x18,%esp
+    int n;
+
+    n = getpriority(0) + inc;
+     bb4:	83 ec 0c             	sub    $0xc,%esp
+     bb7:	6a 00                	push   $0x0
+     bb9:	e8 d9 01 00 00       	call   d97 <getpriority>
+     bbe:	83 c4 10             	add    $0x10,%esp
+     bc1:	8b 55 08             	mov    0x8(%ebp),%edx
+     bc4:	01 d0                	add    %edx,%eax
+     bc6:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(n < 0)
+     bc9:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     bcd:	79 07                	jns    bd6 <nice+0x28>
+        n = 0;
+     bcf:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    if(n > NICEMAX)
+     bd6:	83 7d f4 13          	cmpl   $0x13,-0xc(%ebp)
+     bda:	7e 07                	jle    be3 <nice+0x35>
+        n = NICEMAX;
+     bdc:	c7 45 f4 13 00 00 00 	movl   $0x13,-0xc(%ebp)
+    if(setpriority(0, n) < 0)
+     be3:	83 ec 08             	sub    $0x8,%esp
+     be6:	ff 75 f4             	push   -0xc(%ebp)
+     be9:	6a 00                	push   $0x0
+     beb:	e8 b1 01 00 00       	call   da1 <setpriority>
+     bf0:	83 c4 10             	add    $0x10,%esp
+     bf3:	85 c0                	test   %eax,%eax
+     bf5:	79 07                	jns    bfe <nice+0x50>
+        return -1;
+     bf7:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     bfc:	eb 03                	jmp    c01 <nice+0x53>
+    return n;
+     bfe:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+     c01:	c9                   	leave
+     c02:	c3                   	ret
+
+00000c03 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+     c03:	55                   	push   %ebp
+     c04:	89 e5                	mov    %esp,%ebp
+     c06:	83 ec 10             	sub    $0x10,%esp
+    char *dst;
+    const char *src;
+
+    dst = vdst;
+     c09:	8b 45 08             	mov    0x8(%ebp),%eax
+     c0c:	89 45 fc             	mov    %eax,-0x4(%ebp)
+    src = vsrc;
+     c0f:	8b 45 0c             	mov    0xc(%ebp),%eax
+     c12:	89 45 f8             	mov    %eax,-0x8(%ebp)
+    while(n-- > 0)
+     c15:	eb 17                	jmp    c2e <memmove+0x2b>
+        *dst++ = *src++;
+     c17:	8b 55 f8             	mov    -0x8(%ebp),%edx
+     c1a:	8d 42 01             	lea    0x1(%edx),%eax
+     c1d:	89 45 f8             	mov    %eax,-0x8(%ebp)
+     c20:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     c23:	8d 48 01             	lea    0x1(%eax),%ecx
+     c26:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+     c29:	0f b6 12             	movzbl (%edx),%edx
+     c2c:	88 10                	mov    %dl,(%eax)
+    while(n-- > 0)
+     c2e:	8b 45 10             	mov    0x10(%ebp),%eax
+     c31:	8d 50 ff             	lea    -0x1(%eax),%edx
+     c34:	89 55 10             	mov    %edx,0x10(%ebp)
+     c37:	85 c0                	test   %eax,%eax
+     c39:	7f dc                	jg     c17 <memmove+0x14>
+    return vdst;
+     c3b:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+     c3e:	c9                   	leave
+     c3f:	c3                   	ret
+
+00000c40 <dosyscall>:
+sysmode:
+    .long 0
+
+    .text
+dosyscall:
+    cmpl $0, sysmode
+     c40:	83 3d 70 17 00 00 00 	cmpl   $0x0,0x1770
+    jg 2f
+     c47:	7f 0c                	jg     c55 <dosyscall+0x15>
+    jl 1f
+     c49:	7c 07                	jl     c52 <dosyscall+0x12>
+    call sepcheck
+     c4b:	e8 27 00 00 00       	call   c77 <sepcheck>
+    jmp dosyscall
+     c50:	eb ee                	jmp    c40 <dosyscall>
+1:
+    int $T_SYSCALL
+     c52:	cd 40                	int    $0x40
+    ret
+     c54:	c3                   	ret
+2:
+    pushl %ebx
+     c55:	53                   	push   %ebx
+    pushl %esi
+     c56:	56                   	push   %esi
+    pushl %edi
+     c57:	57                   	push   %edi
+    pushl %ebp
+     c58:	55                   	push   %ebp
+    movl 20(%esp), %ebx
+     c59:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+    movl 24(%esp), %esi
+     c5d:	8b 74 24 18          	mov    0x18(%esp),%esi
+    movl 28(%esp), %edi
+     c61:	8b 7c 24 1c          	mov    0x1c(%esp),%edi
+    movl 32(%esp), %ebp
+     c65:	8b 6c 24 20          	mov    0x20(%esp),%ebp
+    movl %esp, %ecx
+     c69:	89 e1                	mov    %esp,%ecx
+    movl $3f, %edx
+     c6b:	ba 72 0c 00 00       	mov    $0xc72,%edx
+    sysenter
+     c70:	0f 34                	sysenter
+3:
+    popl %ebp
+     c72:	5d                   	pop    %ebp
+    popl %edi
+     c73:	5f                   	pop    %edi
+    popl %esi
+     c74:	5e                   	pop    %esi
+    popl %ebx
+     c75:	5b                   	pop    %ebx
+    ret
+     c76:	c3                   	ret
+
+00000c77 <sepcheck>:
+
+# Set sysmode from cpuid's SEP flag.    Preserves %eax.
+sepcheck:
+    pushl %eax
+     c77:	50                   	push   %eax
+    pushl %ebx
+     c78:	53                   	push   %ebx
+    movl $1, %eax
+     c79:	b8 01 00 00 00       	mov    $0x1,%eax
+    cpuid
+     c7e:	0f a2                	cpuid
+    movl $-1, sysmode
+     c80:	c7 05 70 17 00 00 ff 	movl   $0xffffffff,0x1770
+     c87:	ff ff ff 
+    testl $0x800, %edx
+     c8a:	f7 c2 00 08 00 00    	test   $0x800,%edx
+    jz 1f
+     c90:	74 0a                	je     c9c <sepcheck+0x25>
+    movl $1, sysmode
+     c92:	c7 05 70 17 00 00 01 	movl   $0x1,0x1770
+     c99:	00 00 00 
+1:
+    popl %ebx
+     c9c:	5b                   	pop    %ebx
+    popl %eax
+     c9d:	58                   	pop    %eax
+    ret
+     c9e:	c3                   	ret
+
+00000c9f <fork>:
+
+SYSCALL(fork)
+     c9f:	b8 01 00 00 00       	mov    $0x1,%eax
+     ca4:	eb 9a                	jmp    c40 <dosyscall>
+
+00000ca6 <exit>:
+SYSCALL(exit)
+     ca6:	b8 02 00 00 00       	mov    $0x2,%eax
+     cab:	eb 93                	jmp    c40 <dosyscall>
+
+00000cad <wait>:
+SYSCALL(wait)
+     cad:	b8 03 00 00 00       	mov    $0x3,%eax
+     cb2:	eb 8c                	jmp    c40 <dosyscall>
+
+00000cb4 <pipe>:
+SYSCALL(pipe)
+     cb4:	b8 04 00 00 00       	mov    $0x4,%eax
+     cb9:	eb 85                	jmp    c40 <dosyscall>
+
+00000cbb <read>:
+SYSCALL(read)
+     cbb:	b8 05 00 00 00       	mov    $0x5,%eax
+     cc0:	e9 7b ff ff ff       	jmp    c40 <dosyscall>
+
+00000cc5 <write>:
+SYSCALL(write)
+     cc5:	b8 10 00 00 00       	mov    $0x10,%eax
+     cca:	e9 71 ff ff ff       	jmp    c40 <dosyscall>
+
+00000ccf <close>:
+SYSCALL(close)
+     ccf:	b8 15 00 00 00       	mov    $0x15,%eax
+     cd4:	e9 67 ff ff ff       	jmp    c40 <dosyscall>
+
+00000cd9 <kill>:
+SYSCALL(kill)
+     cd9:	b8 06 00 00 00       	mov    $0x6,%eax
+     cde:	e9 5d ff ff ff       	jmp    c40 <dosyscall>
+
+00000ce3 <exec>:
+SYSCALL(exec)
+     ce3:	b8 07 00 00 00       	mov    $0x7,%eax
+     ce8:	e9 53 ff ff ff       	jmp    c40 <dosyscall>
+
+00000ced <open>:
+SYSCALL(open)
+     ced:	b8 0f 00 00 00       	mov    $0xf,%eax
+     cf2:	e9 49 ff ff ff       	jmp    c40 <dosyscall>
+
+00000cf7 <mknod>:
+SYSCALL(mknod)
+     cf7:	b8 11 00 00 00       	mov    $0x11,%eax
+     cfc:	e9 3f ff ff ff       	jmp    c40 <dosyscall>
+
+00000d01 <unlink>:
+SYSCALL(unlink)
+     d01:	b8 12 00 00 00       	mov    $0x12,%eax
+     d06:	e9 35 ff ff ff       	jmp    c40 <dosyscall>
+
+00000d0b <fstat>:
+SYSCALL(fstat)
+     d0b:	b8 08 00 00 00       	mov    $0x8,%eax
+     d10:	e9 2b ff ff ff       	jmp    c40 <dosyscall>
+
+00000d15 <link>:
+SYSCALL(link)
+     d15:	b8 13 00 00 00       	mov    $0x13,%eax
+     d1a:	e9 21 ff ff ff       	jmp    c40 <dosyscall>
+
+00000d1f <mkdir>:
+SYSCALL(mkdir)
+     d1f:	b8 14 00 00 00       	mov    $0x14,%eax
+     d24:	e9 17 ff ff ff       	jmp    c40 <dosyscall>
+
+00000d29 <chdir>:
+SYSCALL(chdir)
+     d29:	b8 09 00 00 00       	mov    $0x9,%eax
+     d2e:	e9 0d ff ff ff       	jmp    c40 <dosyscall>
+
+00000d33 <dup>:
+SYSCALL(dup)
+     d33:	b8 0a 00 00 00       	mov    $0xa,%eax
+     d38:	e9 03 ff ff ff       	jmp    c40 <dosyscall>
+
+00000d3d <getpid>:
+SYSCALL(getpid)
+     d3d:	b8 0b 00 00 00       	mov    $0xb,%eax
+     d42:	e9 f9 fe ff ff       	jmp    c40 <dosyscall>
+
+00000d47 <sbrk>:
+SYSCALL(sbrk)
+     d47:	b8 0c 00 00 00       	mov    $0xc,%eax
+     d4c:	e9 ef fe ff ff       	jmp    c40 <dosyscall>
+
+00000d51 <sleep>:
+SYSCALL(sleep)
+     d51:	b8 0d 00 00 00       	mov    $0xd,%eax
+     d56:	e9 e5 fe ff ff       	jmp    c40 <dosyscall>
+
+00000d5b <uptime>:
+SYSCALL(uptime)
+     d5b:	b8 0e 00 00 00       	mov    $0xe,%eax
+     d60:	e9 db fe ff ff       	jmp    c40 <dosyscall>
+
+00000d65 <date>:
+SYSCALL(date)
+     d65:	b8 16 00 00 00       	mov    $0x16,%eax
+     d6a:	e9 d1 fe ff ff       	jmp    c40 <dosyscall>
+
+00000d6f <dup2>:
+SYSCALL(dup2)
+     d6f:	b8 17 00 00 00       	mov    $0x17,%eax
+     d74:	e9 c7 fe ff ff       	jmp    c40 <dosyscall>
+
+00000d79 <uffd>:
+SYSCALL(uffd)
+     d79:	b8 1a 00 00 00       	mov    $0x1a,%eax
+     d7e:	e9 bd fe ff ff       	jmp    c40 <dosyscall>
+
+00000d83 <uffdregister>:
+SYSCALL(uffdregister)
+     d83:	b8 1b 00 00 00       	mov    $0x1b,%eax
+     d88:	e9 b3 fe ff ff       	jmp    c40 <dosyscall>
+
+00000d8d <uffdcopy>:
+SYSCALL(uffdcopy)
+     d8d:	b8 1c 00 00 00       	mov    $0x1c,%eax
+     d92:	e9 a9 fe ff ff       	jmp    c40 <dosyscall>
+
+00000d97 <getpriority>:
+SYSCALL(getpriority)
+     d97:	b8 1d 00 00 00       	mov    $0x1d,%eax
+     d9c:	e9 9f fe ff ff       	jmp    c40 <dosyscall>
+
+00000da1 <setpriority>:
+SYSCALL(setpriority)
+     da1:	b8 1e 00 00 00       	mov    $0x1e,%eax
+     da6:	e9 95 fe ff ff       	jmp    c40 <dosyscall>
+
+00000dab <setweight>:
+SYSCALL(setweight)
+     dab:	b8 1f 00 00 00       	mov    $0x1f,%eax
+     db0:	e9 8b fe ff ff       	jmp    c40 <dosyscall>
+
+00000db5 <setgroup>:
+SYSCALL(setgroup)
+     db5:	b8 20 00 00 00       	mov    $0x20,%eax
+     dba:	e9 81 fe ff ff       	jmp    c40 <dosyscall>
+
+00000dbf <schedinfo>:
+SYSCALL(schedinfo)
+     dbf:	b8 21 00 00 00       	mov    $0x21,%eax
+     dc4:	e9 77 fe ff ff       	jmp    c40 <dosyscall>
+
+00000dc9 <nanosleep>:
+SYSCALL(nanosleep)
+     dc9:	b8 22 00 00 00       	mov    $0x22,%eax
+     dce:	e9 6d fe ff ff       	jmp    c40 <dosyscall>
+
+00000dd3 <clock_nanosleep>:
+SYSCALL(clock_nanosleep)
+     dd3:	b8 23 00 00 00       	mov    $0x23,%eax
+     dd8:	e9 63 fe ff ff       	jmp    c40 <dosyscall>
+
+00000ddd <clock_gettime>:
+SYSCALL(clock_gettime)
+     ddd:	b8 24 00 00 00       	mov    $0x24,%eax
+     de2:	e9 59 fe ff ff       	jmp    c40 <dosyscall>
+
+00000de7 <sched_setaffinity>:
+SYSCALL(sched_setaffinity)
+     de7:	b8 25 00 00 00       	mov    $0x25,%eax
+     dec:	e9 4f fe ff ff       	jmp    c40 <dosyscall>
+
+00000df1 <sched_getaffinity>:
+SYSCALL(sched_getaffinity)
+     df1:	b8 26 00 00 00       	mov    $0x26,%eax
+     df6:	e9 45 fe ff ff       	jmp    c40 <dosyscall>
+
+00000dfb <irqaffinity>:
+SYSCALL(irqaffinity)
+     dfb:	b8 27 00 00 00       	mov    $0x27,%eax
+     e00:	e9 3b fe ff ff       	jmp    c40 <dosyscall>
+
+00000e05 <getrusage>:
+SYSCALL(getrusage)
+     e05:	b8 28 00 00 00       	mov    $0x28,%eax
+     e0a:	e9 31 fe ff ff       	jmp    c40 <dosyscall>
+
+00000e0f <times>:
+SYSCALL(times)
+     e0f:	b8 29 00 00 00       	mov    $0x29,%eax
+     e14:	e9 27 fe ff ff       	jmp    c40 <dosyscall>
+
+00000e19 <schedlat>:
+SYSCALL(schedlat)
+     e19:	b8 2a 00 00 00       	mov    $0x2a,%eax
+     e1e:	e9 1d fe ff ff       	jmp    c40 <dosyscall>
+
+00000e23 <sched_setscheduler>:
+SYSCALL(sched_setscheduler)
+     e23:	b8 2b 00 00 00       	mov    $0x2b,%eax
+     e28:	e9 13 fe ff ff       	jmp    c40 <dosyscall>
+
+00000e2d <sched_getscheduler>:
+SYSCALL(sched_getscheduler)
+     e2d:	b8 2c 00 00 00       	mov    $0x2c,%eax
+     e32:	e9 09 fe ff ff       	jmp    c40 <dosyscall>
+
+00000e37 <sched_getparam>:
+SYSCALL(sched_getparam)
+     e37:	b8 2d 00 00 00       	mov    $0x2d,%eax
+     e3c:	e9 ff fd ff ff       	jmp    c40 <dosyscall>
+
+00000e41 <lockstat>:
+SYSCALL(lockstat)
+     e41:	b8 2e 00 00 00       	mov    $0x2e,%eax
+     e46:	e9 f5 fd ff ff       	jmp    c40 <dosyscall>
+
+00000e4b <ioring_setup>:
+SYSCALL(ioring_setup)
+     e4b:	b8 2f 00 00 00       	mov    $0x2f,%eax
+     e50:	e9 eb fd ff ff       	jmp    c40 <dosyscall>
+
+00000e55 <ioring_enter>:
+SYSCALL(ioring_enter)
+     e55:	b8 30 00 00 00       	mov    $0x30,%eax
+     e5a:	e9 e1 fd ff ff       	jmp    c40 <dosyscall>
+
+00000e5f <readv>:
+SYSCALL(readv)
+     e5f:	b8 31 00 00 00       	mov    $0x31,%eax
+     e64:	e9 d7 fd ff ff       	jmp    c40 <dosyscall>
+
+00000e69 <writev>:
+SYSCALL(writev)
+     e69:	b8 32 00 00 00       	mov    $0x32,%eax
+     e6e:	e9 cd fd ff ff       	jmp    c40 <dosyscall>
+
+00000e73 <pread>:
+SYSCALL(pread)
+     e73:	b8 33 00 00 00       	mov    $0x33,%eax
+     e78:	e9 c3 fd ff ff       	jmp    c40 <dosyscall>
+
+00000e7d <pwrite>:
+SYSCALL(pwrite)
+     e7d:	b8 34 00 00 00       	mov    $0x34,%eax
+     e82:	e9 b9 fd ff ff       	jmp    c40 <dosyscall>
+
+00000e87 <sendfile>:
+SYSCALL(sendfile)
+     e87:	b8 35 00 00 00       	mov    $0x35,%eax
+     e8c:	e9 af fd ff ff       	jmp    c40 <dosyscall>
+
+00000e91 <splice>:
+SYSCALL(splice)
+     e91:	b8 36 00 00 00       	mov    $0x36,%eax
+     e96:	e9 a5 fd ff ff       	jmp    c40 <dosyscall>
+
+00000e9b <sysstat>:
+SYSCALL(sysstat)
+     e9b:	b8 37 00 00 00       	mov    $0x37,%eax
+     ea0:	e9 9b fd ff ff       	jmp    c40 <dosyscall>
+
+00000ea5 <strace>:
+SYSCALL(strace)
+     ea5:	b8 38 00 00 00       	mov    $0x38,%eax
+     eaa:	e9 91 fd ff ff       	jmp    c40 <dosyscall>
+
+00000eaf <straceread>:
+SYSCALL(straceread)
+     eaf:	b8 39 00 00 00       	mov    $0x39,%eax
+     eb4:	e9 87 fd ff ff       	jmp    c40 <dosyscall>
+
+00000eb9 <alarm>:
+
+# alarm and rstoregs keep to int $T_SYSCALL: rstoregs restores
+# %ecx and %edx, which sysexit would clobber.
+.globl alarm
+    alarm:
+        pushl $rstoregs
+     eb9:	68 c9 0e 00 00       	push   $0xec9
+        movl $SYS_alarm, %eax
+     ebe:	b8 18 00 00 00       	mov    $0x18,%eax
+        int $T_SYSCALL
+     ec3:	cd 40                	int    $0x40
+        add $0x04, %esp
+     ec5:	83 c4 04             	add    $0x4,%esp
+        ret
+     ec8:	c3                   	ret
+
+00000ec9 <rstoregs>:
+
+.globl rstoregs
+    rstoregs:
+        movl $SYS_rstoregs, %eax
+     ec9:	b8 19 00 00 00       	mov    $0x19,%eax
+        int $T_SYSCALL
+     ece:	cd 40                	int    $0x40
+
+00000ed0 <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+     ed0:	55                   	push   %ebp
+     ed1:	89 e5                	mov    %esp,%ebp
+     ed3:	83 ec 18             	sub    $0x18,%esp
+     ed6:	8b 45 0c             	mov    0xc(%ebp),%eax
+     ed9:	88 45 f4             	mov    %al,-0xc(%ebp)
+    write(fd, &c, 1);
+     edc:	83 ec 04             	sub    $0x4,%esp
+     edf:	6a 01                	push   $0x1
+     ee1:	8d 45 f4             	lea    -0xc(%ebp),%eax
+     ee4:	50                   	push   %eax
+     ee5:	ff 75 08             	push   0x8(%ebp)
+     ee8:	e8 d8 fd ff ff       	call   cc5 <write>
+     eed:	83 c4 10             	add    $0x10,%esp
+}
+     ef0:	90                   	nop
+     ef1:	c9                   	leave
+     ef2:	c3                   	ret
+
+00000ef3 <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+     ef3:	55                   	push   %ebp
+     ef4:	89 e5                	mov    %esp,%ebp
+     ef6:	83 ec 28             	sub    $0x28,%esp
+    static char digits[] = "0123456789ABCDEF";
+    char buf[16];
+    int i, neg;
+    uint x;
+
+    neg = 0;
+     ef9:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+    if(sgn && xx < 0){
+     f00:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+     f04:	74 17                	je     f1d <printint+0x2a>
+     f06:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+     f0a:	79 11                	jns    f1d <printint+0x2a>
+        neg = 1;
+     f0c:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+        x = -xx;
+     f13:	8b 45 0c             	mov    0xc(%ebp),%eax
+     f16:	f7 d8                	neg    %eax
+     f18:	89 45 ec             	mov    %eax,-0x14(%ebp)
+     f1b:	eb 06                	jmp    f23 <printint+0x30>
+    } else {
+        x = xx;
+     f1d:	8b 45 0c             	mov    0xc(%ebp),%eax
+     f20:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    }
+
+    i = 0;
+     f23:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    do{
+        buf[i++] = digits[x % base];
+     f2a:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     f2d:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     f30:	ba 00 00 00 00       	mov    $0x0,%edx
+     f35:	f7 f1                	div    %ecx
+     f37:	89 d1                	mov    %edx,%ecx
+     f39:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     f3c:	8d 50 01             	lea    0x1(%eax),%edx
+     f3f:	89 55 f4             	mov    %edx,-0xc(%ebp)
+     f42:	0f b6 91 74 17 00 00 	movzbl 0x1774(%ecx),%edx
+     f49:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+    }while((x /= base) != 0);
+     f4d:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     f50:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     f53:	ba 00 00 00 00       	mov    $0x0,%edx
+     f58:	f7 f1                	div    %ecx
+     f5a:	89 45 ec             	mov    %eax,-0x14(%ebp)
+     f5d:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+     f61:	75 c7                	jne    f2a <printint+0x37>
+    if(neg)
+     f63:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+     f67:	74 2d                	je     f96 <printint+0xa3>
+        buf[i++] = '-';
+     f69:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     f6c:	8d 50 01             	lea    0x1(%eax),%edx
+     f6f:	89 55 f4             	mov    %edx,-0xc(%ebp)
+     f72:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+    while(--i >= 0)
+     f77:	eb 1d                	jmp    f96 <printint+0xa3>
+        putc(fd, buf[i]);
+     f79:	8d 55 dc             	lea    -0x24(%ebp),%edx
+     f7c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     f7f:	01 d0                	add    %edx,%eax
+     f81:	0f b6 00             	movzbl (%eax),%eax
+     f84:	0f be c0             	movsbl %al,%eax
+     f87:	83 ec 08             	sub    $0x8,%esp
+     f8a:	50                   	push   %eax
+     f8b:	ff 75 08             	push   0x8(%ebp)
+     f8e:	e8 3d ff ff ff       	call   ed0 <putc>
+     f93:	83 c4 10             	add    $0x10,%esp
+    while(--i >= 0)
+     f96:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+     f9a:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     f9e:	79 d9                	jns    f79 <printint+0x86>
+}
+     fa0:	90                   	nop
+     fa1:	90                   	nop
+     fa2:	c9                   	leave
+     fa3:	c3                   	ret
+
+00000fa4 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+     fa4:	55                   	push   %ebp
+     fa5:	89 e5                	mov    %esp,%ebp
+     fa7:	83 ec 28             	sub    $0x28,%esp
+    char *s;
+    int c, i, state;
+    uint *ap;
+
+    state = 0;
+     faa:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+    ap = (uint*)(void*)&fmt + 1;
+     fb1:	8d 45 0c             	lea    0xc(%ebp),%eax
+     fb4:	83 c0 04             	add    $0x4,%eax
+     fb7:	89 45 e8             	mov    %eax,-0x18(%ebp)
+    for(i = 0; fmt[i]; i++){
+     fba:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+     fc1:	e9 59 01 00 00       	jmp    111f <printf+0x17b>
+        c = fmt[i] & 0xff;
+     fc6:	8b 55 0c             	mov    0xc(%ebp),%edx
+     fc9:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     fcc:	01 d0                	add    %edx,%eax
+     fce:	0f b6 00             	movzbl (%eax),%eax
+     fd1:	0f be c0             	movsbl %al,%eax
+     fd4:	25 ff 00 00 00       	and    $0xff,%eax
+     fd9:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        if(state == 0){
+     fdc:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+     fe0:	75 2c                	jne    100e <printf+0x6a>
+            if(c == '%'){
+     fe2:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+     fe6:	75 0c                	jne    ff4 <printf+0x50>
+                state = '%';
+     fe8:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+     fef:	e9 27 01 00 00       	jmp    111b <printf+0x177>
+            } else {
+                putc(fd, c);
+     ff4:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     ff7:	0f be c0             	movsbl %al,%eax
+     ffa:	83 ec 08             	sub    $0x8,%esp
+     ffd:	50                   	push   %eax
+     ffe:	ff 75 08             	push   0x8(%ebp)
+    1001:	e8 ca fe ff ff       	call   ed0 <putc>
+    1006:	83 c4 10             	add    $0x10,%esp
+    1009:	e9 0d 01 00 00       	jmp    111b <printf+0x177>
+            }
+        } else if(state == '%'){
+    100e:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+    1012:	0f 85 03 01 00 00    	jne    111b <printf+0x177>
+            if(c == 'd'){
+    1018:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+    101c:	75 1e                	jne    103c <printf+0x98>
+                printint(fd, *ap, 10, 1);
+    101e:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    1021:	8b 00                	mov    (%eax),%eax
+    1023:	6a 01                	push   $0x1
+    1025:	6a 0a                	push   $0xa
+    1027:	50                   	push   %eax
+    1028:	ff 75 08             	push   0x8(%ebp)
+    102b:	e8 c3 fe ff ff       	call   ef3 <printint>
+    1030:	83 c4 10             	add    $0x10,%esp
+                ap++;
+    1033:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+    1037:	e9 d8 00 00 00       	jmp    1114 <printf+0x170>
+            } else if(c == 'x' || c == 'p'){
+    103c:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+    1040:	74 06                	je     1048 <printf+0xa4>
+    1042:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+    1046:	75 1e                	jne    1066 <printf+0xc2>
+                printint(fd, *ap, 16, 0);
+    1048:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    104b:	8b 00                	mov    (%eax),%eax
+    104d:	6a 00                	push   $0x0
+    104f:	6a 10                	push   $0x10
+    1051:	50                   	push   %eax
+    1052:	ff 75 08             	push   0x8(%ebp)
+    1055:	e8 99 fe ff ff       	call   ef3 <printint>
+    105a:	83 c4 10             	add    $0x10,%esp
+                ap++;
+    105d:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+    1061:	e9 ae 00 00 00       	jmp    1114 <printf+0x170>
+            } else if(c == 's'){
+    1066:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+    106a:	75 43                	jne    10af <printf+0x10b>
+                s = (char*)*ap;
+    106c:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    106f:	8b 00                	mov    (%eax),%eax
+    1071:	89 45 f4             	mov    %eax,-0xc(%ebp)
+                ap++;
+    1074:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+                if(s == 0)
+    1078:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    107c:	75 25                	jne    10a3 <printf+0xff>
+                    s = "(null)";
+    107e:	c7 45 f4 5f 14 00 00 	movl   $0x145f,-0xc(%ebp)
+                while(*s != 0){
+    1085:	eb 1c                	jmp    10a3 <printf+0xff>
+                    putc(fd, *s);
+    1087:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    108a:	0f b6 00             	movzbl (%eax),%eax
+    108d:	0f be c0             	movsbl %al,%eax
+    1090:	83 ec 08             	sub    $0x8,%esp
+    1093:	50                   	push   %eax
+    1094:	ff 75 08             	push   0x8(%ebp)
+    1097:	e8 34 fe ff ff       	call   ed0 <putc>
+    109c:	83 c4 10             	add    $0x10,%esp
+                    s++;
+    109f:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+                while(*s != 0){
+    10a3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    10a6:	0f b6 00             	movzbl (%eax),%eax
+    10a9:	84 c0                	test   %al,%al
+    10ab:	75 da                	jne    1087 <printf+0xe3>
+    10ad:	eb 65                	jmp    1114 <printf+0x170>
+                }
+            } else if(c == 'c'){
+    10af:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+    10b3:	75 1d                	jne    10d2 <printf+0x12e>
+                putc(fd, *ap);
+    10b5:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    10b8:	8b 00                	mov    (%eax),%eax
+    10ba:	0f be c0             	movsbl %al,%eax
+    10bd:	83 ec 08             	sub    $0x8,%esp
+    10c0:	50                   	push   %eax
+    10c1:	ff 75 08             	push   0x8(%ebp)
+    10c4:	e8 07 fe ff ff       	call   ed0 <putc>
+    10c9:	83 c4 10             	add    $0x10,%esp
+                ap++;
+    10cc:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+    10d0:	eb 42                	jmp    1114 <printf+0x170>
+            } else if(c == '%'){
+    10d2:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+    10d6:	75 17                	jne    10ef <printf+0x14b>
+                putc(fd, c);
+    10d8:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    10db:	0f be c0             	movsbl %al,%eax
+    10de:	83 ec 08             	sub    $0x8,%esp
+    10e1:	50                   	push   %eax
+    10e2:	ff 75 08             	push   0x8(%ebp)
+    10e5:	e8 e6 fd ff ff       	call   ed0 <putc>
+    10ea:	83 c4 10             	add    $0x10,%esp
+    10ed:	eb 25                	jmp    1114 <printf+0x170>
+            } else {
+                // Unknown % sequence.    Print it to draw attention.
+                putc(fd, '%');
+    10ef:	83 ec 08             	sub    $0x8,%esp
+    10f2:	6a 25                	push   $0x25
+    10f4:	ff 75 08             	push   0x8(%ebp)
+    10f7:	e8 d4 fd ff ff       	call   ed0 <putc>
+    10fc:	83 c4 10             	add    $0x10,%esp
+                putc(fd, c);
+    10ff:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    1102:	0f be c0             	movsbl %al,%eax
+    1105:	83 ec 08             	sub    $0x8,%esp
+    1108:	50                   	push   %eax
+    1109:	ff 75 08             	push   0x8(%ebp)
+    110c:	e8 bf fd ff ff       	call   ed0 <putc>
+    1111:	83 c4 10             	add    $0x10,%esp
+            }
+            state = 0;
+    1114:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+    for(i = 0; fmt[i]; i++){
+    111b:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+    111f:	8b 55 0c             	mov    0xc(%ebp),%edx
+    1122:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    1125:	01 d0                	add    %edx,%eax
+    1127:	0f b6 00             	movzbl (%eax),%eax
+    112a:	84 c0                	test   %al,%al
+    112c:	0f 85 94 fe ff ff    	jne    fc6 <printf+0x22>
+        }
+    }
+}
+    1132:	90                   	nop
+    1133:	90                   	nop
+    1134:	c9                   	leave
+    1135:	c3                   	ret
+
+00001136 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+    1136:	55                   	push   %ebp
+    1137:	89 e5                	mov    %esp,%ebp
+    1139:	83 ec 10             	sub    $0x10,%esp
+    Header *bp, *p;
+
+    bp = (Header*)ap - 1;
+    113c:	8b 45 08             	mov    0x8(%ebp),%eax
+    113f:	83 e8 08             	sub    $0x8,%eax
+    1142:	89 45 f8             	mov    %eax,-0x8(%ebp)
+    for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    1145:	a1 a8 21 00 00       	mov    0x21a8,%eax
+    114a:	89 45 fc             	mov    %eax,-0x4(%ebp)
+    114d:	eb 24                	jmp    1173 <free+0x3d>
+        if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    114f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    1152:	8b 00                	mov    (%eax),%eax
+    1154:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+    1157:	72 12                	jb     116b <free+0x35>
+    1159:	8b 45 f8             	mov    -0x8(%ebp),%eax
+    115c:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+    115f:	72 24                	jb     1185 <free+0x4f>
+    1161:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    1164:	8b 00                	mov    (%eax),%eax
+    1166:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+    1169:	72 1a                	jb     1185 <free+0x4f>
+    for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    116b:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    116e:	8b 00                	mov    (%eax),%eax
+    1170:	89 45 fc             	mov    %eax,-0x4(%ebp)
+    1173:	8b 45 f8             	mov    -0x8(%ebp),%eax
+    1176:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+    1179:	73 d4                	jae    114f <free+0x19>
+    117b:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    117e:	8b 00                	mov    (%eax),%eax
+    1180:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+    1183:	73 ca                	jae    114f <free+0x19>
+            break;
+    if(bp + bp->s.size == p->s.ptr){
+    1185:	8b 45 f8             	mov    -0x8(%ebp),%eax
+    1188:	8b 40 04             	mov    0x4(%eax),%eax
+    118b:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+    1192:	8b 45 f8             	mov    -0x8(%ebp),%eax
+    1195:	01 c2                	add    %eax,%edx
+    1197:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    119a:	8b 00                	mov    (%eax),%eax
+    119c:	39 c2                	cmp    %eax,%edx
+    119e:	75 24                	jne    11c4 <free+0x8e>
+        bp->s.size += p->s.ptr->s.size;
+    11a0:	8b 45 f8             	mov    -0x8(%ebp),%eax
+    11a3:	8b 50 04             	mov    0x4(%eax),%edx
+    11a6:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    11a9:	8b 00                	mov    (%eax),%eax
+    11ab:	8b 40 04             	mov    0x4(%eax),%eax
+    11ae:	01 c2                	add    %eax,%edx
+    11b0:	8b 45 f8             	mov    -0x8(%ebp),%eax
+    11b3:	89 50 04             	mov    %edx,0x4(%eax)
+        bp->s.ptr = p->s.ptr->s.ptr;
+    11b6:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    11b9:	8b 00                	mov    (%eax),%eax
+    11bb:	8b 10                	mov    (%eax),%edx
+    11bd:	8b 45 f8             	mov    -0x8(%ebp),%eax
+    11c0:	89 10                	mov    %edx,(%eax)
+    11c2:	eb 0a                	jmp    11ce <free+0x98>
+    } else
+        bp->s.ptr = p->s.ptr;
+    11c4:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    11c7:	8b 10                	mov    (%eax),%edx
+    11c9:	8b 45 f8             	mov    -0x8(%ebp),%eax
+    11cc:	89 10                	mov    %edx,(%eax)
+    if(p + p->s.size == bp){
+    11ce:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    11d1:	8b 40 04             	mov    0x4(%eax),%eax
+    11d4:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+    11db:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    11de:	01 d0                	add    %edx,%eax
+    11e0:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+    11e3:	75 20                	jne    1205 <free+0xcf>
+        p->s.size += bp->s.size;
+    11e5:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    11e8:	8b 50 04             	mov    0x4(%eax),%edx
+    11eb:	8b 45 f8             	mov    -0x8(%ebp),%eax
+    11ee:	8b 40 04             	mov    0x4(%eax),%eax
+    11f1:	01 c2                	add    %eax,%edx
+    11f3:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    11f6:	89 50 04             	mov    %edx,0x4(%eax)
+        p->s.ptr = bp->s.ptr;
+    11f9:	8b 45 f8             	mov    -0x8(%ebp),%eax
+    11fc:	8b 10                	mov    (%eax),%edx
+    11fe:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    1201:	89 10                	mov    %edx,(%eax)
+    1203:	eb 08                	jmp    120d <free+0xd7>
+    } else
+        p->s.ptr = bp;
+    1205:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    1208:	8b 55 f8             	mov    -0x8(%ebp),%edx
+    120b:	89 10                	mov    %edx,(%eax)
+    freep = p;
+    120d:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    1210:	a3 a8 21 00 00       	mov    %eax,0x21a8
+}
+    1215:	90                   	nop
+    1216:	c9                   	leave
+    1217:	c3                   	ret
+
+00001218 <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+    1218:	55                   	push   %ebp
+    1219:	89 e5                	mov    %esp,%ebp
+    121b:	83 ec 18             	sub    $0x18,%esp
+    char *p;
+    Header *hp;
+
+    if(nu < 4096)
+    121e:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+    1225:	77 07                	ja     122e <morecore+0x16>
+        nu = 4096;
+    1227:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+    p = sbrk(nu * sizeof(Header));
+    122e:	8b 45 08             	mov    0x8(%ebp),%eax
+    1231:	c1 e0 03             	shl    $0x3,%eax
+    1234:	83 ec 0c             	sub    $0xc,%esp
+    1237:	50                   	push   %eax
+    1238:	e8 0a fb ff ff       	call   d47 <sbrk>
+    123d:	83 c4 10             	add    $0x10,%esp
+    1240:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p == (char*)-1)
+    1243:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+    1247:	75 07                	jne    1250 <morecore+0x38>
+        return 0;
+    1249:	b8 00 00 00 00       	mov    $0x0,%eax
+    124e:	eb 26                	jmp    1276 <morecore+0x5e>
+    hp = (Header*)p;
+    1250:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1253:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    hp->s.size = nu;
+    1256:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    1259:	8b 55 08             	mov    0x8(%ebp),%edx
+    125c:	89 50 04             	mov    %edx,0x4(%eax)
+    free((void*)(hp + 1));
+    125f:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    1262:	83 c0 08             	add    $0x8,%eax
+    1265:	83 ec 0c             	sub    $0xc,%esp
+    1268:	50                   	push   %eax
+    1269:	e8 c8 fe ff ff       	call   1136 <free>
+    126e:	83 c4 10             	add    $0x10,%esp
+    return freep;
+    1271:	a1 a8 21 00 00       	mov    0x21a8,%eax
+}
+    1276:	c9                   	leave
+    1277:	c3                   	ret
+
+00001278 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+    1278:	55                   	push   %ebp
+    1279:	89 e5                	mov    %esp,%ebp
+    127b:	83 ec 18             	sub    $0x18,%esp
+    Header *p, *prevp;
+    uint nunits;
+
+    nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    127e:	8b 45 08             	mov    0x8(%ebp),%eax
+    1281:	83 c0 07             	add    $0x7,%eax
+    1284:	c1 e8 03             	shr    $0x3,%eax
+    1287:	83 c0 01             	add    $0x1,%eax
+    128a:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    if((prevp = freep) == 0){
+    128d:	a1 a8 21 00 00       	mov    0x21a8,%eax
+    1292:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    1295:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    1299:	75 23                	jne    12be <malloc+0x46>
+        base.s.ptr = freep = prevp = &base;
+    129b:	c7 45 f0 a0 21 00 00 	movl   $0x21a0,-0x10(%ebp)
+    12a2:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    12a5:	a3 a8 21 00 00       	mov    %eax,0x21a8
+    12aa:	a1 a8 21 00 00       	mov    0x21a8,%eax
+    12af:	a3 a0 21 00 00       	mov    %eax,0x21a0
+        base.s.size = 0;
+    12b4:	c7 05 a4 21 00 00 00 	movl   $0x0,0x21a4
+    12bb:	00 00 00 
+    }
+    for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    12be:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    12c1:	8b 00                	mov    (%eax),%eax
+    12c3:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        if(p->s.size >= nunits){
+    12c6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    12c9:	8b 40 04             	mov    0x4(%eax),%eax
+    12cc:	3b 45 ec             	cmp    -0x14(%ebp),%eax
+    12cf:	72 4d                	jb     131e <malloc+0xa6>
+            if(p->s.size == nunits)
+    12d1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    12d4:	8b 40 04             	mov    0x4(%eax),%eax
+    12d7:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+    12da:	75 0c                	jne    12e8 <malloc+0x70>
+                prevp->s.ptr = p->s.ptr;
+    12dc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    12df:	8b 10                	mov    (%eax),%edx
+    12e1:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    12e4:	89 10                	mov    %edx,(%eax)
+    12e6:	eb 26                	jmp    130e <malloc+0x96>
+            else {
+                p->s.size -= nunits;
+    12e8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    12eb:	8b 40 04             	mov    0x4(%eax),%eax
+    12ee:	2b 45 ec             	sub    -0x14(%ebp),%eax
+    12f1:	89 c2                	mov    %eax,%edx
+    12f3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    12f6:	89 50 04             	mov    %edx,0x4(%eax)
+                p += p->s.size;
+    12f9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    12fc:	8b 40 04             	mov    0x4(%eax),%eax
+    12ff:	c1 e0 03             	shl    $0x3,%eax
+    1302:	01 45 f4             	add    %eax,-0xc(%ebp)
+                p->s.size = nunits;
+    1305:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1308:	8b 55 ec             	mov    -0x14(%ebp),%edx
+    130b:	89 50 04             	mov    %edx,0x4(%eax)
+            }
+            freep = prevp;
+    130e:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    1311:	a3 a8 21 00 00       	mov    %eax,0x21a8
+            return (void*)(p + 1);
+    1316:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1319:	83 c0 08             	add    $0x8,%eax
+    131c:	eb 3b                	jmp    1359 <malloc+0xe1>
+        }
+        if(p == freep)
+    131e:	a1 a8 21 00 00       	mov    0x21a8,%eax
+    1323:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+    1326:	75 1e                	jne    1346 <malloc+0xce>
+            if((p = morecore(nunits)) == 0)
+    1328:	83 ec 0c             	sub    $0xc,%esp
+    132b:	ff 75 ec             	push   -0x14(%ebp)
+    132e:	e8 e5 fe ff ff       	call   1218 <morecore>
+    1333:	83 c4 10             	add    $0x10,%esp
+    1336:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    1339:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    133d:	75 07                	jne    1346 <malloc+0xce>
+                return 0;
+    133f:	b8 00 00 00 00       	mov    $0x0,%eax
+    1344:	eb 13                	jmp    1359 <malloc+0xe1>
+    for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    1346:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1349:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    134c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    134f:	8b 00                	mov    (%eax),%eax
+    1351:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        if(p->s.size >= nunits){
+    1354:	e9 6d ff ff ff       	jmp    12c6 <malloc+0x4e>
+    }
+}
+    1359:	c9                   	leave
+    135a:	c3                   	ret
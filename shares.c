@@ -0,0 +1,200 @@
+// Report the cpu share each process and share group has received.
+//
+//    shares            cpu time used by every live process and group
+//    shares -t [w...]  run one spinner per weight (default 1 2 4)
+//                      in a fresh group and report their shares
+//    shares -g [w...]  run a group per weight, the ith with i+1
+//                      spinners, and report the groups' shares
+//
+// For the numbers to match the weights the spinners must compete
+// for the same cpu; boot with CPUS=1.
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "param.h"
+#include "sched.h"
+
+#define NINFO 64
+#define NSPIN 8
+#define GROUP 77
+#define NGSPIN 4
+
+struct schedinfo info[NINFO];
+
+void
+list(void)
+{
+    int i, j, n, nproc;
+    uint total, used;
+
+    n = schedinfo(info, NINFO);
+    total = 0;
+    for(i = 0; i < n; i++)
+        total += info[i].runtime;
+    printf(1, "pid\tgroup\tweight\tprio\tMcyc\tshare\tname\n");
+    for(i = 0; i < n; i++)
+        printf(1, "%d\t%d\t%d\t%d\t%d\t%d%%\t%s\n", info[i].pid,
+            info[i].group, info[i].weight, info[i].prio, info[i].runtime,
+            total ? info[i].runtime*100/total : 0, info[i].name);
+
+    // Then each group, at its first member.
+    printf(1, "\ngroup\tweight\tprocs\tMcyc\tshare\n");
+    for(i = 0; i < n; i++){
+        if(info[i].group == 0)
+            continue;
+        for(j = 0; j < i && info[j].group != info[i].group; j++)
+            ;
+        if(j < i)
+            continue;
+        used = nproc = 0;
+        for(j = i; j < n; j++){
+            if(info[j].group == info[i].group){
+                used += info[j].runtime;
+                nproc++;
+            }
+        }
+        printf(1, "%d\t%d\t%d\t%d\t%d%%\n", info[i].group,
+            info[i].gweight, nproc, used, total ? used*100/total : 0);
+    }
+}
+
+// Return the runtime of process pid, or 0 if it is gone.
+uint
+runtime(int pid)
+{
+    int i, n;
+
+    n = schedinfo(info, NINFO);
+    for(i = 0; i < n; i++)
+        if(info[i].pid == pid)
+            return info[i].runtime;
+    return 0;
+}
+
+void
+test(int nw, int *w)
+{
+    int i, wsum, pids[NSPIN];
+    uint start[NSPIN], used[NSPIN], total;
+    volatile int j;
+
+    wsum = 0;
+    for(i = 0; i < nw; i++){
+        wsum += w[i];
+        pids[i] = fork();
+        if(pids[i] < 0){
+            printf(2, "shares: fork failed\n");
+            exit();
+        }
+        if(pids[i] == 0){
+            setgroup(GROUP);
+            setweight(0, w[i]);
+            for(;;)
+                for(j = 0; j < 1000000; j++)
+                    ;
+        }
+    }
+
+    sleep(50);
+    for(i = 0; i < nw; i++)
+        start[i] = runtime(pids[i]);
+    sleep(500);
+    total = 0;
+    for(i = 0; i < nw; i++){
+        used[i] = runtime(pids[i]) - start[i];
+        total += used[i];
+    }
+    for(i = 0; i < nw; i++){
+        kill(pids[i]);
+        wait();
+    }
+
+    printf(1, "weight\twant\tgot\n");
+    for(i = 0; i < nw; i++)
+        printf(1, "%d\t%d%%\t%d%%\n", w[i], w[i]*100/wsum,
+            total ? used[i]*100/total : 0);
+}
+
+// Group i gets weight w[i] and i+1 spinners of the default weight;
+// each group should get its weight's share whatever its size.
+void
+gtest(int nw, int *w)
+{
+    int i, k, n, wsum, pids[NGSPIN][NGSPIN];
+    uint start[NGSPIN], used[NGSPIN], total;
+    volatile int j;
+
+    wsum = 0;
+    for(i = 0; i < nw; i++){
+        wsum += w[i];
+        for(k = 0; k <= i; k++){
+            pids[i][k] = fork();
+            if(pids[i][k] < 0){
+                printf(2, "shares: fork failed\n");
+                exit();
+            }
+            if(pids[i][k] == 0){
+                setgroup(GROUP+1+i);
+                setweight(-(GROUP+1+i), w[i]);
+                for(;;)
+                    for(j = 0; j < 1000000; j++)
+                        ;
+            }
+        }
+    }
+
+    sleep(50);
+    for(i = 0; i < nw; i++)
+        for(k = 0, start[i] = 0; k <= i; k++)
+            start[i] += runtime(pids[i][k]);
+    sleep(500);
+    total = 0;
+    for(i = 0; i < nw; i++){
+        for(k = 0, used[i] = 0; k <= i; k++)
+            used[i] += runtime(pids[i][k]);
+        used[i] -= start[i];
+        total += used[i];
+    }
+    for(i = 0, n = 0; i < nw; i++){
+        for(k = 0; k <= i; k++, n++)
+            kill(pids[i][k]);
+    }
+    while(n-- > 0)
+        wait();
+
+    printf(1, "group\tweight\tprocs\twant\tgot\n");
+    for(i = 0; i < nw; i++)
+        printf(1, "%d\t%d\t%d\t%d%%\t%d%%\n", GROUP+1+i, w[i], i+1,
+            w[i]*100/wsum, total ? used[i]*100/total : 0);
+}
+
+int
+main(int argc, char *argv[])
+{
+    int i, nw, w[NSPIN];
+
+    if(argc < 2){
+        list();
+        exit();
+    }
+    if(strcmp(argv[1], "-t") != 0 && strcmp(argv[1], "-g") != 0){
+        printf(2, "usage: shares [-t|-g [weight...]]\n");
+        exit();
+    }
+    nw = 0;
+    for(i = 2; i < argc && nw < (argv[1][1] == 'g' ? NGSPIN : NSPIN); i++)
+        if((w[nw] = atoi(argv[i])) > 0)
+            nw++;
+    if(nw == 0){
+        w[0] = 1024;
+        w[1] = 2048;
+        w[2] = 4096;
+        nw = 3;
+    }
+    if(argv[1][1] == 'g')
+        gtest(nw, w);
+    else
+        test(nw, w);
+    exit();
+}
@@ -1,4 +1,11 @@
 // Sleeping locks
+//
+// Adaptive: an acquirer that finds the lock held spins for a
+// while if the holder is running on another cpu, since buffer and
+// inode locks are usually held only briefly; otherwise it joins a
+// FIFO queue and sleeps.  releasesleep() hands the lock straight
+// to the first waiter, so the lock stays held and nobody can
+// barge in ahead of the queue.
 
 #include "types.h"
 #include "defs.h"
@@ -6,51 +13,124 @@
 #include "x86.h"
 #include "memlayout.h"
 #include "mmu.h"
-#include "proc.h"
 #include "spinlock.h"
+#include "proc.h"
 #include "sleeplock.h"
 
+#define SPINUS    20    // longest optimistic spin, in us
+
 void
 initsleeplock(struct sleeplock *lk, char *name)
 {
     initlock(&lk->lk, "sleep lock", 0);
     lk->name = name;
     lk->locked = 0;
+    lk->head = lk->tail = 0;
+    lk->owner = 0;
     lk->pid = 0;
+    lk->class = lockclass(name, 1);
+    lk->acqts = 0;
+}
+
+// Take lk if it is free.    Return 1 if we got it.
+static int
+trylock(struct sleeplock *lk)
+{
+    return lk->locked == 0 && cmpxchg(&lk->locked, 0, 1) == 0;
+}
+
+// Spin while lk's holder is running, in the hope that it lets go
+// soon.    Give up after SPINUS or once the holder is not running.
+// Return 1 if we got lk.
+static int
+optspin(struct sleeplock *lk)
+{
+    struct proc *o;
+    uint64 end;
+
+    end = rdtsc() + tsckhz / 1000 * SPINUS;
+    while(rdtsc() < end){
+        if(trylock(lk))
+            return 1;
+        // Procs are never freed, so o is safe to look at
+        // even if it has let go of lk meanwhile.
+        o = lk->owner;
+        if(o && o->state != RUNNING)
+            break;
+        pause();
+    }
+    return 0;
 }
 
 void
 acquiresleep(struct sleeplock *lk)
 {
-    acquire(&lk->lk);
-    while (lk->locked) {
-        sleep(lk, &lk->lk);
+    struct proc *p = myproc();
+    uint pcs[10];
+    uint64 t0;
+
+    t0 = 0;
+    if(!trylock(lk)){
+        if(lockstaton)
+            t0 = rdtsc();
+        if(!optspin(lk)){
+            acquire(&lk->lk);
+            if(!trylock(lk)){
+                // Queue up; releasesleep() makes us the owner.
+                p->slnext = 0;
+                if(lk->tail)
+                    lk->tail->slnext = p;
+                else
+                    lk->head = p;
+                lk->tail = p;
+                while(lk->owner != p)
+                    sleep(&p->slnext, &lk->lk);
+            }
+            release(&lk->lk);
+        }
+    }
+    lk->owner = p;
+    lk->pid = p->pid;
+    if(lockstaton){
+        getcallerpcs(&lk, pcs);
+        lockstatacquire(lk->class, pcs[0], t0 != 0, t0 ? rdtsc() - t0 : 0);
+        lk->acqts = rdtsc();
     }
-    lk->locked = 1;
-    lk->pid = myproc()->pid;
-    release(&lk->lk);
 }
 
 void
 releasesleep(struct sleeplock *lk)
 {
+    struct proc *next;
+
+    if(lk->acqts){
+        lockstatrelease(lk->class, rdtsc() - lk->acqts);
+        lk->acqts = 0;
+    }
     acquire(&lk->lk);
-    lk->locked = 0;
-    lk->pid = 0;
-    wakeup(lk);
+    if((next = lk->head) != 0){
+        // Hand off: lk stays locked, on next's behalf.
+        lk->head = next->slnext;
+        if(lk->tail == next)
+            lk->tail = 0;
+        next->slnext = 0;
+        lk->owner = next;
+        lk->pid = next->pid;
+        wakeup(&next->slnext);
+    } else {
+        lk->owner = 0;
+        lk->pid = 0;
+        __sync_synchronize();
+        lk->locked = 0;
+    }
     release(&lk->lk);
 }
 
+// Is the calling process holding lk?    No lock is needed: only
+// the holder makes owner itself, and it clears owner, or passes it
+// on, before letting go.
 int
 holdingsleep(struct sleeplock *lk)
 {
-    int r;
-    
-    acquire(&lk->lk);
-    r = lk->locked && (lk->pid == myproc()->pid);
-    release(&lk->lk);
-    return r;
+    return lk->locked && lk->owner == myproc();
 }
-
-
-
@@ -1,10 +1,15 @@
 // Long-term locks for processes
 struct sleeplock {
-    uint locked;             // Is the lock held?
-    struct spinlock lk; // spinlock protecting this sleep lock
+    volatile uint locked;    // Is the lock held?
+    struct spinlock lk; // spinlock protecting the waiter queue
+    struct proc *head;       // Waiting processes, first come first
+    struct proc *tail;
+    struct proc *owner;      // Process holding lock
     
     // For debugging:
     char *name;                // Name of lock.
     int pid;                     // Process holding lock
+    struct lockclass *class;    // For lockstat
+    uint64 acqts;            // TSC when acquired, if lockstat is on
 };
 
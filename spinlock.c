@@ -6,8 +6,8 @@
 #include "x86.h"
 #include "memlayout.h"
 #include "mmu.h"
-#include "proc.h"
 #include "spinlock.h"
+#include "proc.h"
 
 /*
     add cli param 
@@ -20,9 +20,12 @@ void
 initlock(struct spinlock *lk, char *name, uint cli)
 {
     lk->name = name;
-    lk->locked = 0;
+    lk->next = 0;
+    lk->owner = 0;
     lk->cpu = 0;
     lk->cli = cli;
+    lk->class = lockclass(name, 0);
+    lk->acqts = 0;
 }
 
 // Acquire the lock.
@@ -32,6 +35,9 @@ initlock(struct spinlock *lk, char *name, uint cli)
 void
 acquire(struct spinlock *lk)
 { 
+    uint ticket;
+    uint64 t0;
+
     // pushcli();  // disable interrupts to avoid deadlock.
 
     // if necessery(when the lock is used in interrupt handler),
@@ -40,9 +46,16 @@ acquire(struct spinlock *lk)
     if(lk->cli && holding(lk))  // if lk->cli = 1 we should not check holding , because holding checks cpu field
         panic("acquire");
 
-    // The xchg is atomic.
-    while(xchg(&lk->locked, 1) != 0)
-        ;
+    // The xadd is atomic.    Waiters only read owner while they
+    // spin, so the line is shared until the holder releases.
+    ticket = xadd(&lk->next, 1);
+    t0 = 0;
+    if(lk->owner != ticket){
+        if(lockstaton)
+            t0 = rdtsc();
+        while(lk->owner != ticket)
+            pause();
+    }
 
     // Tell the C compiler and the processor to not move loads or stores
     // past this point, to ensure that the critical section's memory
@@ -52,7 +65,11 @@ acquire(struct spinlock *lk)
     // Record info about lock acquisition for debugging.
     if(lk->cli)             // if lk->cli = 1, we should not set cpu field
         lk->cpu = mycpu();
-    getcallerpcs(&lk, lk->pcs);
+    if(lockstaton){
+        getcallerpcs(&lk, lk->pcs);
+        lockstatacquire(lk->class, lk->pcs[0], t0 != 0, t0 ? rdtsc() - t0 : 0);
+        lk->acqts = rdtsc();
+    }
 }
 
 // Release the lock.
@@ -62,6 +79,10 @@ release(struct spinlock *lk)
     if(lk->cli && !holding(lk))  // if lk->cli = 1 we should not check holding , because holding checks cpu field
         panic("release");
 
+    if(lk->acqts){
+        lockstatrelease(lk->class, rdtsc() - lk->acqts);
+        lk->acqts = 0;
+    }
     lk->pcs[0] = 0;
     lk->cpu = 0;
 
@@ -72,10 +93,9 @@ release(struct spinlock *lk)
     // stores; __sync_synchronize() tells them both not to.
     __sync_synchronize();
 
-    // Release the lock, equivalent to lk->locked = 0.
-    // This code can't use a C assignment, since it might
-    // not be atomic. A real OS would use C atomics here.
-    asm volatile("movl $0, %0" : "+m" (lk->locked) : );
+    // Serve the next ticket.    Only the holder writes owner, so
+    // a plain read-modify-write will do; the store is atomic.
+    lk->owner = lk->owner + 1;
 
     // popcli();
     popclii(lk->cli);
@@ -105,7 +125,7 @@ holding(struct spinlock *lock)
 {
     int r;
     pushcli();
-    r = lock->locked && lock->cpu == mycpu();
+    r = lock->owner != lock->next && lock->cpu == mycpu();
     popcli();
     return r;
 }
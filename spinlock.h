@@ -1,11 +1,16 @@
-// Mutual exclusion lock.
+// Mutual exclusion lock.    A ticket lock: each acquirer takes the
+// next ticket and waits for owner to reach it, so waiters are
+// served in order.    The lock is held while owner != next.
 struct spinlock {
-    uint locked;             // Is the lock held?
+    volatile uint next;      // Next ticket to hand out
+    volatile uint owner;     // Ticket being served
     uint cli;             // when the lock is held, should we cli?
     // For debugging:
     char *name;                // Name of lock.
     struct cpu *cpu;     // The cpu holding the lock.
     uint pcs[10];            // The call stack (an array of program counters)
-                                         // that locked the lock.
+                                         // that locked the lock, if lockstat is on.
+    struct lockclass *class;    // For lockstat
+    uint64 acqts;            // TSC when acquired, if lockstat is on
 };
 
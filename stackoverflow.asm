@@ -0,0 +1,1377 @@
+
+_stackoverflow:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <endlessrecursion>:
+#include "user.h"
+#include "date.h"
+
+
+void endlessrecursion()
+{
+   0:	55                   	push   %ebp
+   1:	89 e5                	mov    %esp,%ebp
+   3:	83 ec 08             	sub    $0x8,%esp
+    endlessrecursion();
+   6:	e8 f5 ff ff ff       	call   0 <endlessrecursion>
+}
+   b:	90                   	nop
+   c:	c9                   	leave
+   d:	c3                   	ret
+
+0000000e <main>:
+
+int
+main(int argc, char *argv[])
+{
+   e:	55                   	push   %ebp
+   f:	89 e5                	mov    %esp,%ebp
+  11:	83 e4 f0             	and    $0xfffffff0,%esp
+    endlessrecursion();
+  14:	e8 e7 ff ff ff       	call   0 <endlessrecursion>
+    exit();
+  19:	e8 0a 03 00 00       	call   328 <exit>
+
+0000001e <stosb>:
+strchr(const char *s, char c)
+{
+    for(; *s; s++)
+        if(*s == c)
+            return (char*)s;
+    return 0;
+  1e:	55                   	push   %ebp
+  1f:	89 e5                	mov    %esp,%ebp
+  21:	57                   	push   %edi
+  22:	53                   	push   %ebx
+}
+  23:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  26:	8b 55 10             	mov    0x10(%ebp),%edx
+  29:	8b 45 0c             	mov    0xc(%ebp),%eax
+  2c:	89 cb                	mov    %ecx,%ebx
+  2e:	89 df                	mov    %ebx,%edi
+  30:	89 d1                	mov    %edx,%ecx
+  32:	fc                   	cld
+  33:	f3 aa                	rep stos %al,%es:(%edi)
+  35:	89 ca                	mov    %ecx,%edx
+  37:	89 fb                	mov    %edi,%ebx
+  39:	89 5d 08             	mov    %ebx,0x8(%ebp)
+  3c:	89 55 10             	mov    %edx,0x10(%ebp)
+
+char*
+gets(char *buf, int max)
+{
+  3f:	90                   	nop
+  40:	5b                   	pop    %ebx
+  41:	5f                   	pop    %edi
+  42:	5d                   	pop    %ebp
+  43:	c3                   	ret
+
+00000044 <strcpy>:
+{
+  44:	55                   	push   %ebp
+  45:	89 e5                	mov    %esp,%ebp
+  47:	83 ec 10             	sub    $0x10,%esp
+    os = s;
+  4a:	8b 45 08             	mov    0x8(%ebp),%eax
+  4d:	89 45 fc             	mov    %eax,-0x4(%ebp)
+    while((*s++ = *t++) != 0)
+  50:	90                   	nop
+  51:	8b 55 0c             	mov    0xc(%ebp),%edx
+  54:	8d 42 01             	lea    0x1(%edx),%eax
+  57:	89 45 0c             	mov    %eax,0xc(%ebp)
+  5a:	8b 45 08             	mov    0x8(%ebp),%eax
+  5d:	8d 48 01             	lea    0x1(%eax),%ecx
+  60:	89 4d 08             	mov    %ecx,0x8(%ebp)
+  63:	0f b6 12             	movzbl (%edx),%edx
+  66:	88 10                	mov    %dl,(%eax)
+  68:	0f b6 00             	movzbl (%eax),%eax
+  6b:	84 c0                	test   %al,%al
+  6d:	75 e2                	jne    51 <strcpy+0xd>
+    return os;
+  6f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+  72:	c9                   	leave
+  73:	c3                   	ret
+
+00000074 <strcmp>:
+{
+  74:	55                   	push   %ebp
+  75:	89 e5                	mov    %esp,%ebp
+    while(*p && *p == *q)
+  77:	eb 08                	jmp    81 <strcmp+0xd>
+        p++, q++;
+  79:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+  7d:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+    while(*p && *p == *q)
+  81:	8b 45 08             	mov    0x8(%ebp),%eax
+  84:	0f b6 00             	movzbl (%eax),%eax
+  87:	84 c0                	test   %al,%al
+  89:	74 10                	je     9b <strcmp+0x27>
+  8b:	8b 45 08             	mov    0x8(%ebp),%eax
+  8e:	0f b6 10             	movzbl (%eax),%edx
+  91:	8b 45 0c             	mov    0xc(%ebp),%eax
+  94:	0f b6 00             	movzbl (%eax),%eax
+  97:	38 c2                	cmp    %al,%dl
+  99:	74 de                	je     79 <strcmp+0x5>
+    return (uchar)*p - (uchar)*q;
+  9b:	8b 45 08             	mov    0x8(%ebp),%eax
+  9e:	0f b6 00             	movzbl (%eax),%eax
+  a1:	0f b6 d0             	movzbl %al,%edx
+  a4:	8b 45 0c             	mov    0xc(%ebp),%eax
+  a7:	0f b6 00             	movzbl (%eax),%eax
+  aa:	0f b6 c0             	movzbl %al,%eax
+  ad:	29 c2                	sub    %eax,%edx
+  af:	89 d0                	mov    %edx,%eax
+}
+  b1:	5d                   	pop    %ebp
+  b2:	c3                   	ret
+
+000000b3 <strlen>:
+{
+  b3:	55                   	push   %ebp
+  b4:	89 e5                	mov    %esp,%ebp
+  b6:	83 ec 10             	sub    $0x10,%esp
+    for(n = 0; s[n]; n++)
+  b9:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  c0:	eb 04                	jmp    c6 <strlen+0x13>
+  c2:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+  c6:	8b 55 fc             	mov    -0x4(%ebp),%edx
+  c9:	8b 45 08             	mov    0x8(%ebp),%eax
+  cc:	01 d0                	add    %edx,%eax
+  ce:	0f b6 00             	movzbl (%eax),%eax
+  d1:	84 c0                	test   %al,%al
+  d3:	75 ed                	jne    c2 <strlen+0xf>
+    return n;
+  d5:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+  d8:	c9                   	leave
+  d9:	c3                   	ret
+
+000000da <memset>:
+{
+  da:	55                   	push   %ebp
+  db:	89 e5                	mov    %esp,%ebp
+    stosb(dst, c, n);
+  dd:	8b 45 10             	mov    0x10(%ebp),%eax
+  e0:	50                   	push   %eax
+  e1:	ff 75 0c             	push   0xc(%ebp)
+  e4:	ff 75 08             	push   0x8(%ebp)
+  e7:	e8 32 ff ff ff       	call   1e <stosb>
+  ec:	83 c4 0c             	add    $0xc,%esp
+    return dst;
+  ef:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+  f2:	c9                   	leave
+  f3:	c3                   	ret
+
+000000f4 <strchr>:
+{
+  f4:	55                   	push   %ebp
+  f5:	89 e5                	mov    %esp,%ebp
+  f7:	83 ec 04             	sub    $0x4,%esp
+  fa:	8b 45 0c             	mov    0xc(%ebp),%eax
+  fd:	88 45 fc             	mov    %al,-0x4(%ebp)
+    for(; *s; s++)
+ 100:	eb 14                	jmp    116 <strchr+0x22>
+        if(*s == c)
+ 102:	8b 45 08             	mov    0x8(%ebp),%eax
+ 105:	0f b6 00             	movzbl (%eax),%eax
+ 108:	38 45 fc             	cmp    %al,-0x4(%ebp)
+ 10b:	75 05                	jne    112 <strchr+0x1e>
+            return (char*)s;
+ 10d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 110:	eb 13                	jmp    125 <strchr+0x31>
+    for(; *s; s++)
+ 112:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 116:	8b 45 08             	mov    0x8(%ebp),%eax
+ 119:	0f b6 00             	movzbl (%eax),%eax
+ 11c:	84 c0                	test   %al,%al
+ 11e:	75 e2                	jne    102 <strchr+0xe>
+    return 0;
+ 120:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 125:	c9                   	leave
+ 126:	c3                   	ret
+
+00000127 <gets>:
+{
+ 127:	55                   	push   %ebp
+ 128:	89 e5                	mov    %esp,%ebp
+ 12a:	83 ec 18             	sub    $0x18,%esp
+    int i, cc;
+    char c;
+
+    for(i=0; i+1 < max; ){
+ 12d:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 134:	eb 42                	jmp    178 <gets+0x51>
+        cc = read(0, &c, 1);
+ 136:	83 ec 04             	sub    $0x4,%esp
+ 139:	6a 01                	push   $0x1
+ 13b:	8d 45 ef             	lea    -0x11(%ebp),%eax
+ 13e:	50                   	push   %eax
+ 13f:	6a 00                	push   $0x0
+ 141:	e8 f7 01 00 00       	call   33d <read>
+ 146:	83 c4 10             	add    $0x10,%esp
+ 149:	89 45 f0             	mov    %eax,-0x10(%ebp)
+        if(cc < 1)
+ 14c:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 150:	7e 33                	jle    185 <gets+0x5e>
+            break;
+        buf[i++] = c;
+ 152:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 155:	8d 50 01             	lea    0x1(%eax),%edx
+ 158:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 15b:	89 c2                	mov    %eax,%edx
+ 15d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 160:	01 c2                	add    %eax,%edx
+ 162:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 166:	88 02                	mov    %al,(%edx)
+        if(c == '\n' || c == '\r')
+ 168:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 16c:	3c 0a                	cmp    $0xa,%al
+ 16e:	74 16                	je     186 <gets+0x5f>
+ 170:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 174:	3c 0d                	cmp    $0xd,%al
+ 176:	74 0e                	je     186 <gets+0x5f>
+    for(i=0; i+1 < max; ){
+ 178:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 17b:	83 c0 01             	add    $0x1,%eax
+ 17e:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 181:	7f b3                	jg     136 <gets+0xf>
+ 183:	eb 01                	jmp    186 <gets+0x5f>
+            break;
+ 185:	90                   	nop
+            break;
+    }
+    buf[i] = '\0';
+ 186:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 189:	8b 45 08             	mov    0x8(%ebp),%eax
+ 18c:	01 d0                	add    %edx,%eax
+ 18e:	c6 00 00             	movb   $0x0,(%eax)
+    return buf;
+ 191:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 194:	c9                   	leave
+ 195:	c3                   	ret
+
+00000196 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 196:	55                   	push   %ebp
+ 197:	89 e5                	mov    %esp,%ebp
+ 199:	83 ec 18             	sub    $0x18,%esp
+    int fd;
+    int r;
+
+    fd = open(n, O_RDONLY);
+ 19c:	83 ec 08             	sub    $0x8,%esp
+ 19f:	6a 00                	push   $0x0
+ 1a1:	ff 75 08             	push   0x8(%ebp)
+ 1a4:	e8 c6 01 00 00       	call   36f <open>
+ 1a9:	83 c4 10             	add    $0x10,%esp
+ 1ac:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(fd < 0)
+ 1af:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 1b3:	79 07                	jns    1bc <stat+0x26>
+        return -1;
+ 1b5:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 1ba:	eb 25                	jmp    1e1 <stat+0x4b>
+    r = fstat(fd, st);
+ 1bc:	83 ec 08             	sub    $0x8,%esp
+ 1bf:	ff 75 0c             	push   0xc(%ebp)
+ 1c2:	ff 75 f4             	push   -0xc(%ebp)
+ 1c5:	e8 c3 01 00 00       	call   38d <fstat>
+ 1ca:	83 c4 10             	add    $0x10,%esp
+ 1cd:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    close(fd);
+ 1d0:	83 ec 0c             	sub    $0xc,%esp
+ 1d3:	ff 75 f4             	push   -0xc(%ebp)
+ 1d6:	e8 76 01 00 00       	call   351 <close>
+ 1db:	83 c4 10             	add    $0x10,%esp
+    return r;
+ 1de:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ 1e1:	c9                   	leave
+ 1e2:	c3                   	ret
+
+000001e3 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 1e3:	55                   	push   %ebp
+ 1e4:	89 e5                	mov    %esp,%ebp
+ 1e6:	83 ec 10             	sub    $0x10,%esp
+    int n;
+
+    n = 0;
+ 1e9:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+    while('0' <= *s && *s <= '9')
+ 1f0:	eb 25                	jmp    217 <atoi+0x34>
+        n = n*10 + *s++ - '0';
+ 1f2:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 1f5:	89 d0                	mov    %edx,%eax
+ 1f7:	c1 e0 02             	shl    $0x2,%eax
+ 1fa:	01 d0                	add    %edx,%eax
+ 1fc:	01 c0                	add    %eax,%eax
+ 1fe:	89 c1                	mov    %eax,%ecx
+ 200:	8b 45 08             	mov    0x8(%ebp),%eax
+ 203:	8d 50 01             	lea    0x1(%eax),%edx
+ 206:	89 55 08             	mov    %edx,0x8(%ebp)
+ 209:	0f b6 00             	movzbl (%eax),%eax
+ 20c:	0f be c0             	movsbl %al,%eax
+ 20f:	01 c8                	add    %ecx,%eax
+ 211:	83 e8 30             	sub    $0x30,%eax
+ 214:	89 45 fc             	mov    %eax,-0x4(%ebp)
+    while('0' <= *s && *s <= '9')
+ 217:	8b 45 08             	mov    0x8(%ebp),%eax
+ 21a:	0f b6 00             	movzbl (%eax),%eax
+ 21d:	3c 2f                	cmp    $0x2f,%al
+ 21f:	7e 0a                	jle    22b <atoi+0x48>
+ 221:	8b 45 08             	mov    0x8(%ebp),%eax
+ 224:	0f b6 00             	movzbl (%eax),%eax
+ 227:	3c 39                	cmp    $0x39,%al
+ 229:	7e c7                	jle    1f2 <atoi+0xf>
+    return n;
+ 22b:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 22e:	c9                   	leave
+ 22f:	c3                   	ret
+
+00000230 <nice>:
+
+// Add inc to the caller's nice value; return the new value.
+int
+nice(int inc)
+{
+ 230:	55                   	push   %ebp
+ 231:	89 e5                	mov    %esp,%ebp
+ 233:	83 ec 18             	sub    $0x18,%esp
+    int n;
+
+    n = getpriority(0) + inc;
+ 236:	83 ec 0c             	sub    $0xc,%esp
+ 239:	6a 00                	push   $0x0
+ 23b:	e8 d9 01 00 00       	call   419 <getpriority>
+ 240:	83 c4 10             	add    $0x10,%esp
+ 243:	8b 55 08             	mov    0x8(%ebp),%edx
+ 246:	01 d0                	add    %edx,%eax
+ 248:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(n < 0)
+ 24b:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 24f:	79 07                	jns    258 <nice+0x28>
+        n = 0;
+ 251:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    if(n > NICEMAX)
+ 258:	83 7d f4 13          	cmpl   $0x13,-0xc(%ebp)
+ 25c:	7e 07                	jle    265 <nice+0x35>
+        n = NICEMAX;
+ 25e:	c7 45 f4 13 00 00 00 	movl   $0x13,-0xc(%ebp)
+    if(setpriority(0, n) < 0)
+ 265:	83 ec 08             	sub    $0x8,%esp
+ 268:	ff 75 f4             	push   -0xc(%ebp)
+ 26b:	6a 00                	push   $0x0
+ 26d:	e8 b1 01 00 00       	call   423 <setpriority>
+ 272:	83 c4 10             	add    $0x10,%esp
+ 275:	85 c0                	test   %eax,%eax
+ 277:	79 07                	jns    280 <nice+0x50>
+        return -1;
+ 279:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 27e:	eb 03                	jmp    283 <nice+0x53>
+    return n;
+ 280:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+ 283:	c9                   	leave
+ 284:	c3                   	ret
+
+00000285 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 285:	55                   	push   %ebp
+ 286:	89 e5                	mov    %esp,%ebp
+ 288:	83 ec 10             	sub    $0x10,%esp
+    char *dst;
+    const char *src;
+
+    dst = vdst;
+ 28b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 28e:	89 45 fc             	mov    %eax,-0x4(%ebp)
+    src = vsrc;
+ 291:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 294:	89 45 f8             	mov    %eax,-0x8(%ebp)
+    while(n-- > 0)
+ 297:	eb 17                	jmp    2b0 <memmove+0x2b>
+        *dst++ = *src++;
+ 299:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 29c:	8d 42 01             	lea    0x1(%edx),%eax
+ 29f:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 2a2:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 2a5:	8d 48 01             	lea    0x1(%eax),%ecx
+ 2a8:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+ 2ab:	0f b6 12             	movzbl (%edx),%edx
+ 2ae:	88 10                	mov    %dl,(%eax)
+    while(n-- > 0)
+ 2b0:	8b 45 10             	mov    0x10(%ebp),%eax
+ 2b3:	8d 50 ff             	lea    -0x1(%eax),%edx
+ 2b6:	89 55 10             	mov    %edx,0x10(%ebp)
+ 2b9:	85 c0                	test   %eax,%eax
+ 2bb:	7f dc                	jg     299 <memmove+0x14>
+    return vdst;
+ 2bd:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 2c0:	c9                   	leave
+ 2c1:	c3                   	ret
+
+000002c2 <dosyscall>:
+sysmode:
+    .long 0
+
+    .text
+dosyscall:
+    cmpl $0, sysmode
+ 2c2:	83 3d 60 0c 00 00 00 	cmpl   $0x0,0xc60
+    jg 2f
+ 2c9:	7f 0c                	jg     2d7 <dosyscall+0x15>
+    jl 1f
+ 2cb:	7c 07                	jl     2d4 <dosyscall+0x12>
+    call sepcheck
+ 2cd:	e8 27 00 00 00       	call   2f9 <sepcheck>
+    jmp dosyscall
+ 2d2:	eb ee                	jmp    2c2 <dosyscall>
+1:
+    int $T_SYSCALL
+ 2d4:	cd 40                	int    $0x40
+    ret
+ 2d6:	c3                   	ret
+2:
+    pushl %ebx
+ 2d7:	53                   	push   %ebx
+    pushl %esi
+ 2d8:	56                   	push   %esi
+    pushl %edi
+ 2d9:	57                   	push   %edi
+    pushl %ebp
+ 2da:	55                   	push   %ebp
+    movl 20(%esp), %ebx
+ 2db:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+    movl 24(%esp), %esi
+ 2df:	8b 74 24 18          	mov    0x18(%esp),%esi
+    movl 28(%esp), %edi
+ 2e3:	8b 7c 24 1c          	mov    0x1c(%esp),%edi
+    movl 32(%esp), %ebp
+ 2e7:	8b 6c 24 20          	mov    0x20(%esp),%ebp
+    movl %esp, %ecx
+ 2eb:	89 e1                	mov    %esp,%ecx
+    movl $3f, %edx
+ 2ed:	ba f4 02 00 00       	mov    $0x2f4,%edx
+    sysenter
+ 2f2:	0f 34                	sysenter
+3:
+    popl %ebp
+ 2f4:	5d                   	pop    %ebp
+    popl %edi
+ 2f5:	5f                   	pop    %edi
+    popl %esi
+ 2f6:	5e                   	pop    %esi
+    popl %ebx
+ 2f7:	5b                   	pop    %ebx
+    ret
+ 2f8:	c3                   	ret
+
+000002f9 <sepcheck>:
+
+# Set sysmode from cpuid's SEP flag.    Preserves %eax.
+sepcheck:
+    pushl %eax
+ 2f9:	50                   	push   %eax
+    pushl %ebx
+ 2fa:	53                   	push   %ebx
+    movl $1, %eax
+ 2fb:	b8 01 00 00 00       	mov    $0x1,%eax
+    cpuid
+ 300:	0f a2                	cpuid
+    movl $-1, sysmode
+ 302:	c7 05 60 0c 00 00 ff 	movl   $0xffffffff,0xc60
+ 309:	ff ff ff 
+    testl $0x800, %edx
+ 30c:	f7 c2 00 08 00 00    	test   $0x800,%edx
+    jz 1f
+ 312:	74 0a                	je     31e <sepcheck+0x25>
+    movl $1, sysmode
+ 314:	c7 05 60 0c 00 00 01 	movl   $0x1,0xc60
+ 31b:	00 00 00 
+1:
+    popl %ebx
+ 31e:	5b                   	pop    %ebx
+    popl %eax
+ 31f:	58                   	pop    %eax
+    ret
+ 320:	c3                   	ret
+
+00000321 <fork>:
+
+SYSCALL(fork)
+ 321:	b8 01 00 00 00       	mov    $0x1,%eax
+ 326:	eb 9a                	jmp    2c2 <dosyscall>
+
+00000328 <exit>:
+SYSCALL(exit)
+ 328:	b8 02 00 00 00       	mov    $0x2,%eax
+ 32d:	eb 93                	jmp    2c2 <dosyscall>
+
+0000032f <wait>:
+SYSCALL(wait)
+ 32f:	b8 03 00 00 00       	mov    $0x3,%eax
+ 334:	eb 8c                	jmp    2c2 <dosyscall>
+
+00000336 <pipe>:
+SYSCALL(pipe)
+ 336:	b8 04 00 00 00       	mov    $0x4,%eax
+ 33b:	eb 85                	jmp    2c2 <dosyscall>
+
+0000033d <read>:
+SYSCALL(read)
+ 33d:	b8 05 00 00 00       	mov    $0x5,%eax
+ 342:	e9 7b ff ff ff       	jmp    2c2 <dosyscall>
+
+00000347 <write>:
+SYSCALL(write)
+ 347:	b8 10 00 00 00       	mov    $0x10,%eax
+ 34c:	e9 71 ff ff ff       	jmp    2c2 <dosyscall>
+
+00000351 <close>:
+SYSCALL(close)
+ 351:	b8 15 00 00 00       	mov    $0x15,%eax
+ 356:	e9 67 ff ff ff       	jmp    2c2 <dosyscall>
+
+0000035b <kill>:
+SYSCALL(kill)
+ 35b:	b8 06 00 00 00       	mov    $0x6,%eax
+ 360:	e9 5d ff ff ff       	jmp    2c2 <dosyscall>
+
+00000365 <exec>:
+SYSCALL(exec)
+ 365:	b8 07 00 00 00       	mov    $0x7,%eax
+ 36a:	e9 53 ff ff ff       	jmp    2c2 <dosyscall>
+
+0000036f <open>:
+SYSCALL(open)
+ 36f:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 374:	e9 49 ff ff ff       	jmp    2c2 <dosyscall>
+
+00000379 <mknod>:
+SYSCALL(mknod)
+ 379:	b8 11 00 00 00       	mov    $0x11,%eax
+ 37e:	e9 3f ff ff ff       	jmp    2c2 <dosyscall>
+
+00000383 <unlink>:
+SYSCALL(unlink)
+ 383:	b8 12 00 00 00       	mov    $0x12,%eax
+ 388:	e9 35 ff ff ff       	jmp    2c2 <dosyscall>
+
+0000038d <fstat>:
+SYSCALL(fstat)
+ 38d:	b8 08 00 00 00       	mov    $0x8,%eax
+ 392:	e9 2b ff ff ff       	jmp    2c2 <dosyscall>
+
+00000397 <link>:
+SYSCALL(link)
+ 397:	b8 13 00 00 00       	mov    $0x13,%eax
+ 39c:	e9 21 ff ff ff       	jmp    2c2 <dosyscall>
+
+000003a1 <mkdir>:
+SYSCALL(mkdir)
+ 3a1:	b8 14 00 00 00       	mov    $0x14,%eax
+ 3a6:	e9 17 ff ff ff       	jmp    2c2 <dosyscall>
+
+000003ab <chdir>:
+SYSCALL(chdir)
+ 3ab:	b8 09 00 00 00       	mov    $0x9,%eax
+ 3b0:	e9 0d ff ff ff       	jmp    2c2 <dosyscall>
+
+000003b5 <dup>:
+SYSCALL(dup)
+ 3b5:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 3ba:	e9 03 ff ff ff       	jmp    2c2 <dosyscall>
+
+000003bf <getpid>:
+SYSCALL(getpid)
+ 3bf:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 3c4:	e9 f9 fe ff ff       	jmp    2c2 <dosyscall>
+
+000003c9 <sbrk>:
+SYSCALL(sbrk)
+ 3c9:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 3ce:	e9 ef fe ff ff       	jmp    2c2 <dosyscall>
+
+000003d3 <sleep>:
+SYSCALL(sleep)
+ 3d3:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 3d8:	e9 e5 fe ff ff       	jmp    2c2 <dosyscall>
+
+000003dd <uptime>:
+SYSCALL(uptime)
+ 3dd:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 3e2:	e9 db fe ff ff       	jmp    2c2 <dosyscall>
+
+000003e7 <date>:
+SYSCALL(date)
+ 3e7:	b8 16 00 00 00       	mov    $0x16,%eax
+ 3ec:	e9 d1 fe ff ff       	jmp    2c2 <dosyscall>
+
+000003f1 <dup2>:
+SYSCALL(dup2)
+ 3f1:	b8 17 00 00 00       	mov    $0x17,%eax
+ 3f6:	e9 c7 fe ff ff       	jmp    2c2 <dosyscall>
+
+000003fb <uffd>:
+SYSCALL(uffd)
+ 3fb:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 400:	e9 bd fe ff ff       	jmp    2c2 <dosyscall>
+
+00000405 <uffdregister>:
+SYSCALL(uffdregister)
+ 405:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 40a:	e9 b3 fe ff ff       	jmp    2c2 <dosyscall>
+
+0000040f <uffdcopy>:
+SYSCALL(uffdcopy)
+ 40f:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 414:	e9 a9 fe ff ff       	jmp    2c2 <dosyscall>
+
+00000419 <getpriority>:
+SYSCALL(getpriority)
+ 419:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 41e:	e9 9f fe ff ff       	jmp    2c2 <dosyscall>
+
+00000423 <setpriority>:
+SYSCALL(setpriority)
+ 423:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 428:	e9 95 fe ff ff       	jmp    2c2 <dosyscall>
+
+0000042d <setweight>:
+SYSCALL(setweight)
+ 42d:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 432:	e9 8b fe ff ff       	jmp    2c2 <dosyscall>
+
+00000437 <setgroup>:
+SYSCALL(setgroup)
+ 437:	b8 20 00 00 00       	mov    $0x20,%eax
+ 43c:	e9 81 fe ff ff       	jmp    2c2 <dosyscall>
+
+00000441 <schedinfo>:
+SYSCALL(schedinfo)
+ 441:	b8 21 00 00 00       	mov    $0x21,%eax
+ 446:	e9 77 fe ff ff       	jmp    2c2 <dosyscall>
+
+0000044b <nanosleep>:
+SYSCALL(nanosleep)
+ 44b:	b8 22 00 00 00       	mov    $0x22,%eax
+ 450:	e9 6d fe ff ff       	jmp    2c2 <dosyscall>
+
+00000455 <clock_nanosleep>:
+SYSCALL(clock_nanosleep)
+ 455:	b8 23 00 00 00       	mov    $0x23,%eax
+ 45a:	e9 63 fe ff ff       	jmp    2c2 <dosyscall>
+
+0000045f <clock_gettime>:
+SYSCALL(clock_gettime)
+ 45f:	b8 24 00 00 00       	mov    $0x24,%eax
+ 464:	e9 59 fe ff ff       	jmp    2c2 <dosyscall>
+
+00000469 <sched_setaffinity>:
+SYSCALL(sched_setaffinity)
+ 469:	b8 25 00 00 00       	mov    $0x25,%eax
+ 46e:	e9 4f fe ff ff       	jmp    2c2 <dosyscall>
+
+00000473 <sched_getaffinity>:
+SYSCALL(sched_getaffinity)
+ 473:	b8 26 00 00 00       	mov    $0x26,%eax
+ 478:	e9 45 fe ff ff       	jmp    2c2 <dosyscall>
+
+0000047d <irqaffinity>:
+SYSCALL(irqaffinity)
+ 47d:	b8 27 00 00 00       	mov    $0x27,%eax
+ 482:	e9 3b fe ff ff       	jmp    2c2 <dosyscall>
+
+00000487 <getrusage>:
+SYSCALL(getrusage)
+ 487:	b8 28 00 00 00       	mov    $0x28,%eax
+ 48c:	e9 31 fe ff ff       	jmp    2c2 <dosyscall>
+
+00000491 <times>:
+SYSCALL(times)
+ 491:	b8 29 00 00 00       	mov    $0x29,%eax
+ 496:	e9 27 fe ff ff       	jmp    2c2 <dosyscall>
+
+0000049b <schedlat>:
+SYSCALL(schedlat)
+ 49b:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 4a0:	e9 1d fe ff ff       	jmp    2c2 <dosyscall>
+
+000004a5 <sched_setscheduler>:
+SYSCALL(sched_setscheduler)
+ 4a5:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 4aa:	e9 13 fe ff ff       	jmp    2c2 <dosyscall>
+
+000004af <sched_getscheduler>:
+SYSCALL(sched_getscheduler)
+ 4af:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 4b4:	e9 09 fe ff ff       	jmp    2c2 <dosyscall>
+
+000004b9 <sched_getparam>:
+SYSCALL(sched_getparam)
+ 4b9:	b8 2d 00 00 00       	mov    $0x2d,%eax
+ 4be:	e9 ff fd ff ff       	jmp    2c2 <dosyscall>
+
+000004c3 <lockstat>:
+SYSCALL(lockstat)
+ 4c3:	b8 2e 00 00 00       	mov    $0x2e,%eax
+ 4c8:	e9 f5 fd ff ff       	jmp    2c2 <dosyscall>
+
+000004cd <ioring_setup>:
+SYSCALL(ioring_setup)
+ 4cd:	b8 2f 00 00 00       	mov    $0x2f,%eax
+ 4d2:	e9 eb fd ff ff       	jmp    2c2 <dosyscall>
+
+000004d7 <ioring_enter>:
+SYSCALL(ioring_enter)
+ 4d7:	b8 30 00 00 00       	mov    $0x30,%eax
+ 4dc:	e9 e1 fd ff ff       	jmp    2c2 <dosyscall>
+
+000004e1 <readv>:
+SYSCALL(readv)
+ 4e1:	b8 31 00 00 00       	mov    $0x31,%eax
+ 4e6:	e9 d7 fd ff ff       	jmp    2c2 <dosyscall>
+
+000004eb <writev>:
+SYSCALL(writev)
+ 4eb:	b8 32 00 00 00       	mov    $0x32,%eax
+ 4f0:	e9 cd fd ff ff       	jmp    2c2 <dosyscall>
+
+000004f5 <pread>:
+SYSCALL(pread)
+ 4f5:	b8 33 00 00 00       	mov    $0x33,%eax
+ 4fa:	e9 c3 fd ff ff       	jmp    2c2 <dosyscall>
+
+000004ff <pwrite>:
+SYSCALL(pwrite)
+ 4ff:	b8 34 00 00 00       	mov    $0x34,%eax
+ 504:	e9 b9 fd ff ff       	jmp    2c2 <dosyscall>
+
+00000509 <sendfile>:
+SYSCALL(sendfile)
+ 509:	b8 35 00 00 00       	mov    $0x35,%eax
+ 50e:	e9 af fd ff ff       	jmp    2c2 <dosyscall>
+
+00000513 <splice>:
+SYSCALL(splice)
+ 513:	b8 36 00 00 00       	mov    $0x36,%eax
+ 518:	e9 a5 fd ff ff       	jmp    2c2 <dosyscall>
+
+0000051d <sysstat>:
+SYSCALL(sysstat)
+ 51d:	b8 37 00 00 00       	mov    $0x37,%eax
+ 522:	e9 9b fd ff ff       	jmp    2c2 <dosyscall>
+
+00000527 <strace>:
+SYSCALL(strace)
+ 527:	b8 38 00 00 00       	mov    $0x38,%eax
+ 52c:	e9 91 fd ff ff       	jmp    2c2 <dosyscall>
+
+00000531 <straceread>:
+SYSCALL(straceread)
+ 531:	b8 39 00 00 00       	mov    $0x39,%eax
+ 536:	e9 87 fd ff ff       	jmp    2c2 <dosyscall>
+
+0000053b <alarm>:
+
+# alarm and rstoregs keep to int $T_SYSCALL: rstoregs restores
+# %ecx and %edx, which sysexit would clobber.
+.globl alarm
+    alarm:
+        pushl $rstoregs
+ 53b:	68 4b 05 00 00       	push   $0x54b
+        movl $SYS_alarm, %eax
+ 540:	b8 18 00 00 00       	mov    $0x18,%eax
+        int $T_SYSCALL
+ 545:	cd 40                	int    $0x40
+        add $0x04, %esp
+ 547:	83 c4 04             	add    $0x4,%esp
+        ret
+ 54a:	c3                   	ret
+
+0000054b <rstoregs>:
+
+.globl rstoregs
+    rstoregs:
+        movl $SYS_rstoregs, %eax
+ 54b:	b8 19 00 00 00       	mov    $0x19,%eax
+        int $T_SYSCALL
+ 550:	cd 40                	int    $0x40
+
+00000552 <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 552:	55                   	push   %ebp
+ 553:	89 e5                	mov    %esp,%ebp
+ 555:	83 ec 18             	sub    $0x18,%esp
+ 558:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 55b:	88 45 f4             	mov    %al,-0xc(%ebp)
+    write(fd, &c, 1);
+ 55e:	83 ec 04             	sub    $0x4,%esp
+ 561:	6a 01                	push   $0x1
+ 563:	8d 45 f4             	lea    -0xc(%ebp),%eax
+ 566:	50                   	push   %eax
+ 567:	ff 75 08             	push   0x8(%ebp)
+ 56a:	e8 d8 fd ff ff       	call   347 <write>
+ 56f:	83 c4 10             	add    $0x10,%esp
+}
+ 572:	90                   	nop
+ 573:	c9                   	leave
+ 574:	c3                   	ret
+
+00000575 <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 575:	55                   	push   %ebp
+ 576:	89 e5                	mov    %esp,%ebp
+ 578:	83 ec 28             	sub    $0x28,%esp
+    static char digits[] = "0123456789ABCDEF";
+    char buf[16];
+    int i, neg;
+    uint x;
+
+    neg = 0;
+ 57b:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+    if(sgn && xx < 0){
+ 582:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+ 586:	74 17                	je     59f <printint+0x2a>
+ 588:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 58c:	79 11                	jns    59f <printint+0x2a>
+        neg = 1;
+ 58e:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+        x = -xx;
+ 595:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 598:	f7 d8                	neg    %eax
+ 59a:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 59d:	eb 06                	jmp    5a5 <printint+0x30>
+    } else {
+        x = xx;
+ 59f:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 5a2:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    }
+
+    i = 0;
+ 5a5:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    do{
+        buf[i++] = digits[x % base];
+ 5ac:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 5af:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 5b2:	ba 00 00 00 00       	mov    $0x0,%edx
+ 5b7:	f7 f1                	div    %ecx
+ 5b9:	89 d1                	mov    %edx,%ecx
+ 5bb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 5be:	8d 50 01             	lea    0x1(%eax),%edx
+ 5c1:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 5c4:	0f b6 91 64 0c 00 00 	movzbl 0xc64(%ecx),%edx
+ 5cb:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+    }while((x /= base) != 0);
+ 5cf:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 5d2:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 5d5:	ba 00 00 00 00       	mov    $0x0,%edx
+ 5da:	f7 f1                	div    %ecx
+ 5dc:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 5df:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 5e3:	75 c7                	jne    5ac <printint+0x37>
+    if(neg)
+ 5e5:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 5e9:	74 2d                	je     618 <printint+0xa3>
+        buf[i++] = '-';
+ 5eb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 5ee:	8d 50 01             	lea    0x1(%eax),%edx
+ 5f1:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 5f4:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+    while(--i >= 0)
+ 5f9:	eb 1d                	jmp    618 <printint+0xa3>
+        putc(fd, buf[i]);
+ 5fb:	8d 55 dc             	lea    -0x24(%ebp),%edx
+ 5fe:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 601:	01 d0                	add    %edx,%eax
+ 603:	0f b6 00             	movzbl (%eax),%eax
+ 606:	0f be c0             	movsbl %al,%eax
+ 609:	83 ec 08             	sub    $0x8,%esp
+ 60c:	50                   	push   %eax
+ 60d:	ff 75 08             	push   0x8(%ebp)
+ 610:	e8 3d ff ff ff       	call   552 <putc>
+ 615:	83 c4 10             	add    $0x10,%esp
+    while(--i >= 0)
+ 618:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+ 61c:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 620:	79 d9                	jns    5fb <printint+0x86>
+}
+ 622:	90                   	nop
+ 623:	90                   	nop
+ 624:	c9                   	leave
+ 625:	c3                   	ret
+
+00000626 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 626:	55                   	push   %ebp
+ 627:	89 e5                	mov    %esp,%ebp
+ 629:	83 ec 28             	sub    $0x28,%esp
+    char *s;
+    int c, i, state;
+    uint *ap;
+
+    state = 0;
+ 62c:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+    ap = (uint*)(void*)&fmt + 1;
+ 633:	8d 45 0c             	lea    0xc(%ebp),%eax
+ 636:	83 c0 04             	add    $0x4,%eax
+ 639:	89 45 e8             	mov    %eax,-0x18(%ebp)
+    for(i = 0; fmt[i]; i++){
+ 63c:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 643:	e9 59 01 00 00       	jmp    7a1 <printf+0x17b>
+        c = fmt[i] & 0xff;
+ 648:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 64b:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 64e:	01 d0                	add    %edx,%eax
+ 650:	0f b6 00             	movzbl (%eax),%eax
+ 653:	0f be c0             	movsbl %al,%eax
+ 656:	25 ff 00 00 00       	and    $0xff,%eax
+ 65b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        if(state == 0){
+ 65e:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 662:	75 2c                	jne    690 <printf+0x6a>
+            if(c == '%'){
+ 664:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 668:	75 0c                	jne    676 <printf+0x50>
+                state = '%';
+ 66a:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+ 671:	e9 27 01 00 00       	jmp    79d <printf+0x177>
+            } else {
+                putc(fd, c);
+ 676:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 679:	0f be c0             	movsbl %al,%eax
+ 67c:	83 ec 08             	sub    $0x8,%esp
+ 67f:	50                   	push   %eax
+ 680:	ff 75 08             	push   0x8(%ebp)
+ 683:	e8 ca fe ff ff       	call   552 <putc>
+ 688:	83 c4 10             	add    $0x10,%esp
+ 68b:	e9 0d 01 00 00       	jmp    79d <printf+0x177>
+            }
+        } else if(state == '%'){
+ 690:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+ 694:	0f 85 03 01 00 00    	jne    79d <printf+0x177>
+            if(c == 'd'){
+ 69a:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+ 69e:	75 1e                	jne    6be <printf+0x98>
+                printint(fd, *ap, 10, 1);
+ 6a0:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 6a3:	8b 00                	mov    (%eax),%eax
+ 6a5:	6a 01                	push   $0x1
+ 6a7:	6a 0a                	push   $0xa
+ 6a9:	50                   	push   %eax
+ 6aa:	ff 75 08             	push   0x8(%ebp)
+ 6ad:	e8 c3 fe ff ff       	call   575 <printint>
+ 6b2:	83 c4 10             	add    $0x10,%esp
+                ap++;
+ 6b5:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 6b9:	e9 d8 00 00 00       	jmp    796 <printf+0x170>
+            } else if(c == 'x' || c == 'p'){
+ 6be:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+ 6c2:	74 06                	je     6ca <printf+0xa4>
+ 6c4:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+ 6c8:	75 1e                	jne    6e8 <printf+0xc2>
+                printint(fd, *ap, 16, 0);
+ 6ca:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 6cd:	8b 00                	mov    (%eax),%eax
+ 6cf:	6a 00                	push   $0x0
+ 6d1:	6a 10                	push   $0x10
+ 6d3:	50                   	push   %eax
+ 6d4:	ff 75 08             	push   0x8(%ebp)
+ 6d7:	e8 99 fe ff ff       	call   575 <printint>
+ 6dc:	83 c4 10             	add    $0x10,%esp
+                ap++;
+ 6df:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 6e3:	e9 ae 00 00 00       	jmp    796 <printf+0x170>
+            } else if(c == 's'){
+ 6e8:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+ 6ec:	75 43                	jne    731 <printf+0x10b>
+                s = (char*)*ap;
+ 6ee:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 6f1:	8b 00                	mov    (%eax),%eax
+ 6f3:	89 45 f4             	mov    %eax,-0xc(%ebp)
+                ap++;
+ 6f6:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+                if(s == 0)
+ 6fa:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 6fe:	75 25                	jne    725 <printf+0xff>
+                    s = "(null)";
+ 700:	c7 45 f4 dd 09 00 00 	movl   $0x9dd,-0xc(%ebp)
+                while(*s != 0){
+ 707:	eb 1c                	jmp    725 <printf+0xff>
+                    putc(fd, *s);
+ 709:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 70c:	0f b6 00             	movzbl (%eax),%eax
+ 70f:	0f be c0             	movsbl %al,%eax
+ 712:	83 ec 08             	sub    $0x8,%esp
+ 715:	50                   	push   %eax
+ 716:	ff 75 08             	push   0x8(%ebp)
+ 719:	e8 34 fe ff ff       	call   552 <putc>
+ 71e:	83 c4 10             	add    $0x10,%esp
+                    s++;
+ 721:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+                while(*s != 0){
+ 725:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 728:	0f b6 00             	movzbl (%eax),%eax
+ 72b:	84 c0                	test   %al,%al
+ 72d:	75 da                	jne    709 <printf+0xe3>
+ 72f:	eb 65                	jmp    796 <printf+0x170>
+                }
+            } else if(c == 'c'){
+ 731:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+ 735:	75 1d                	jne    754 <printf+0x12e>
+                putc(fd, *ap);
+ 737:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 73a:	8b 00                	mov    (%eax),%eax
+ 73c:	0f be c0             	movsbl %al,%eax
+ 73f:	83 ec 08             	sub    $0x8,%esp
+ 742:	50                   	push   %eax
+ 743:	ff 75 08             	push   0x8(%ebp)
+ 746:	e8 07 fe ff ff       	call   552 <putc>
+ 74b:	83 c4 10             	add    $0x10,%esp
+                ap++;
+ 74e:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 752:	eb 42                	jmp    796 <printf+0x170>
+            } else if(c == '%'){
+ 754:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 758:	75 17                	jne    771 <printf+0x14b>
+                putc(fd, c);
+ 75a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 75d:	0f be c0             	movsbl %al,%eax
+ 760:	83 ec 08             	sub    $0x8,%esp
+ 763:	50                   	push   %eax
+ 764:	ff 75 08             	push   0x8(%ebp)
+ 767:	e8 e6 fd ff ff       	call   552 <putc>
+ 76c:	83 c4 10             	add    $0x10,%esp
+ 76f:	eb 25                	jmp    796 <printf+0x170>
+            } else {
+                // Unknown % sequence.    Print it to draw attention.
+                putc(fd, '%');
+ 771:	83 ec 08             	sub    $0x8,%esp
+ 774:	6a 25                	push   $0x25
+ 776:	ff 75 08             	push   0x8(%ebp)
+ 779:	e8 d4 fd ff ff       	call   552 <putc>
+ 77e:	83 c4 10             	add    $0x10,%esp
+                putc(fd, c);
+ 781:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 784:	0f be c0             	movsbl %al,%eax
+ 787:	83 ec 08             	sub    $0x8,%esp
+ 78a:	50                   	push   %eax
+ 78b:	ff 75 08             	push   0x8(%ebp)
+ 78e:	e8 bf fd ff ff       	call   552 <putc>
+ 793:	83 c4 10             	add    $0x10,%esp
+            }
+            state = 0;
+ 796:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+    for(i = 0; fmt[i]; i++){
+ 79d:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ 7a1:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 7a4:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 7a7:	01 d0                	add    %edx,%eax
+ 7a9:	0f b6 00             	movzbl (%eax),%eax
+ 7ac:	84 c0                	test   %al,%al
+ 7ae:	0f 85 94 fe ff ff    	jne    648 <printf+0x22>
+        }
+    }
+}
+ 7b4:	90                   	nop
+ 7b5:	90                   	nop
+ 7b6:	c9                   	leave
+ 7b7:	c3                   	ret
+
+000007b8 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 7b8:	55                   	push   %ebp
+ 7b9:	89 e5                	mov    %esp,%ebp
+ 7bb:	83 ec 10             	sub    $0x10,%esp
+    Header *bp, *p;
+
+    bp = (Header*)ap - 1;
+ 7be:	8b 45 08             	mov    0x8(%ebp),%eax
+ 7c1:	83 e8 08             	sub    $0x8,%eax
+ 7c4:	89 45 f8             	mov    %eax,-0x8(%ebp)
+    for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 7c7:	a1 80 0c 00 00       	mov    0xc80,%eax
+ 7cc:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 7cf:	eb 24                	jmp    7f5 <free+0x3d>
+        if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 7d1:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 7d4:	8b 00                	mov    (%eax),%eax
+ 7d6:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 7d9:	72 12                	jb     7ed <free+0x35>
+ 7db:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 7de:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 7e1:	72 24                	jb     807 <free+0x4f>
+ 7e3:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 7e6:	8b 00                	mov    (%eax),%eax
+ 7e8:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 7eb:	72 1a                	jb     807 <free+0x4f>
+    for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 7ed:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 7f0:	8b 00                	mov    (%eax),%eax
+ 7f2:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 7f5:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 7f8:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 7fb:	73 d4                	jae    7d1 <free+0x19>
+ 7fd:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 800:	8b 00                	mov    (%eax),%eax
+ 802:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 805:	73 ca                	jae    7d1 <free+0x19>
+            break;
+    if(bp + bp->s.size == p->s.ptr){
+ 807:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 80a:	8b 40 04             	mov    0x4(%eax),%eax
+ 80d:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 814:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 817:	01 c2                	add    %eax,%edx
+ 819:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 81c:	8b 00                	mov    (%eax),%eax
+ 81e:	39 c2                	cmp    %eax,%edx
+ 820:	75 24                	jne    846 <free+0x8e>
+        bp->s.size += p->s.ptr->s.size;
+ 822:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 825:	8b 50 04             	mov    0x4(%eax),%edx
+ 828:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 82b:	8b 00                	mov    (%eax),%eax
+ 82d:	8b 40 04             	mov    0x4(%eax),%eax
+ 830:	01 c2                	add    %eax,%edx
+ 832:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 835:	89 50 04             	mov    %edx,0x4(%eax)
+        bp->s.ptr = p->s.ptr->s.ptr;
+ 838:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 83b:	8b 00                	mov    (%eax),%eax
+ 83d:	8b 10                	mov    (%eax),%edx
+ 83f:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 842:	89 10                	mov    %edx,(%eax)
+ 844:	eb 0a                	jmp    850 <free+0x98>
+    } else
+        bp->s.ptr = p->s.ptr;
+ 846:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 849:	8b 10                	mov    (%eax),%edx
+ 84b:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 84e:	89 10                	mov    %edx,(%eax)
+    if(p + p->s.size == bp){
+ 850:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 853:	8b 40 04             	mov    0x4(%eax),%eax
+ 856:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 85d:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 860:	01 d0                	add    %edx,%eax
+ 862:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 865:	75 20                	jne    887 <free+0xcf>
+        p->s.size += bp->s.size;
+ 867:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 86a:	8b 50 04             	mov    0x4(%eax),%edx
+ 86d:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 870:	8b 40 04             	mov    0x4(%eax),%eax
+ 873:	01 c2                	add    %eax,%edx
+ 875:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 878:	89 50 04             	mov    %edx,0x4(%eax)
+        p->s.ptr = bp->s.ptr;
+ 87b:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 87e:	8b 10                	mov    (%eax),%edx
+ 880:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 883:	89 10                	mov    %edx,(%eax)
+ 885:	eb 08                	jmp    88f <free+0xd7>
+    } else
+        p->s.ptr = bp;
+ 887:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 88a:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 88d:	89 10                	mov    %edx,(%eax)
+    freep = p;
+ 88f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 892:	a3 80 0c 00 00       	mov    %eax,0xc80
+}
+ 897:	90                   	nop
+ 898:	c9                   	leave
+ 899:	c3                   	ret
+
+0000089a <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+ 89a:	55                   	push   %ebp
+ 89b:	89 e5                	mov    %esp,%ebp
+ 89d:	83 ec 18             	sub    $0x18,%esp
+    char *p;
+    Header *hp;
+
+    if(nu < 4096)
+ 8a0:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+ 8a7:	77 07                	ja     8b0 <morecore+0x16>
+        nu = 4096;
+ 8a9:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+    p = sbrk(nu * sizeof(Header));
+ 8b0:	8b 45 08             	mov    0x8(%ebp),%eax
+ 8b3:	c1 e0 03             	shl    $0x3,%eax
+ 8b6:	83 ec 0c             	sub    $0xc,%esp
+ 8b9:	50                   	push   %eax
+ 8ba:	e8 0a fb ff ff       	call   3c9 <sbrk>
+ 8bf:	83 c4 10             	add    $0x10,%esp
+ 8c2:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p == (char*)-1)
+ 8c5:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+ 8c9:	75 07                	jne    8d2 <morecore+0x38>
+        return 0;
+ 8cb:	b8 00 00 00 00       	mov    $0x0,%eax
+ 8d0:	eb 26                	jmp    8f8 <morecore+0x5e>
+    hp = (Header*)p;
+ 8d2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 8d5:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    hp->s.size = nu;
+ 8d8:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 8db:	8b 55 08             	mov    0x8(%ebp),%edx
+ 8de:	89 50 04             	mov    %edx,0x4(%eax)
+    free((void*)(hp + 1));
+ 8e1:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 8e4:	83 c0 08             	add    $0x8,%eax
+ 8e7:	83 ec 0c             	sub    $0xc,%esp
+ 8ea:	50                   	push   %eax
+ 8eb:	e8 c8 fe ff ff       	call   7b8 <free>
+ 8f0:	83 c4 10             	add    $0x10,%esp
+    return freep;
+ 8f3:	a1 80 0c 00 00       	mov    0xc80,%eax
+}
+ 8f8:	c9                   	leave
+ 8f9:	c3                   	ret
+
+000008fa <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ 8fa:	55                   	push   %ebp
+ 8fb:	89 e5                	mov    %esp,%ebp
+ 8fd:	83 ec 18             	sub    $0x18,%esp
+    Header *p, *prevp;
+    uint nunits;
+
+    nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 900:	8b 45 08             	mov    0x8(%ebp),%eax
+ 903:	83 c0 07             	add    $0x7,%eax
+ 906:	c1 e8 03             	shr    $0x3,%eax
+ 909:	83 c0 01             	add    $0x1,%eax
+ 90c:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    if((prevp = freep) == 0){
+ 90f:	a1 80 0c 00 00       	mov    0xc80,%eax
+ 914:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ 917:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 91b:	75 23                	jne    940 <malloc+0x46>
+        base.s.ptr = freep = prevp = &base;
+ 91d:	c7 45 f0 78 0c 00 00 	movl   $0xc78,-0x10(%ebp)
+ 924:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 927:	a3 80 0c 00 00       	mov    %eax,0xc80
+ 92c:	a1 80 0c 00 00       	mov    0xc80,%eax
+ 931:	a3 78 0c 00 00       	mov    %eax,0xc78
+        base.s.size = 0;
+ 936:	c7 05 7c 0c 00 00 00 	movl   $0x0,0xc7c
+ 93d:	00 00 00 
+    }
+    for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 940:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 943:	8b 00                	mov    (%eax),%eax
+ 945:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        if(p->s.size >= nunits){
+ 948:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 94b:	8b 40 04             	mov    0x4(%eax),%eax
+ 94e:	3b 45 ec             	cmp    -0x14(%ebp),%eax
+ 951:	72 4d                	jb     9a0 <malloc+0xa6>
+            if(p->s.size == nunits)
+ 953:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 956:	8b 40 04             	mov    0x4(%eax),%eax
+ 959:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+ 95c:	75 0c                	jne    96a <malloc+0x70>
+                prevp->s.ptr = p->s.ptr;
+ 95e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 961:	8b 10                	mov    (%eax),%edx
+ 963:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 966:	89 10                	mov    %edx,(%eax)
+ 968:	eb 26                	jmp    990 <malloc+0x96>
+            else {
+                p->s.size -= nunits;
+ 96a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 96d:	8b 40 04             	mov    0x4(%eax),%eax
+ 970:	2b 45 ec             	sub    -0x14(%ebp),%eax
+ 973:	89 c2                	mov    %eax,%edx
+ 975:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 978:	89 50 04             	mov    %edx,0x4(%eax)
+                p += p->s.size;
+ 97b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 97e:	8b 40 04             	mov    0x4(%eax),%eax
+ 981:	c1 e0 03             	shl    $0x3,%eax
+ 984:	01 45 f4             	add    %eax,-0xc(%ebp)
+                p->s.size = nunits;
+ 987:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 98a:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 98d:	89 50 04             	mov    %edx,0x4(%eax)
+            }
+            freep = prevp;
+ 990:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 993:	a3 80 0c 00 00       	mov    %eax,0xc80
+            return (void*)(p + 1);
+ 998:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 99b:	83 c0 08             	add    $0x8,%eax
+ 99e:	eb 3b                	jmp    9db <malloc+0xe1>
+        }
+        if(p == freep)
+ 9a0:	a1 80 0c 00 00       	mov    0xc80,%eax
+ 9a5:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ 9a8:	75 1e                	jne    9c8 <malloc+0xce>
+            if((p = morecore(nunits)) == 0)
+ 9aa:	83 ec 0c             	sub    $0xc,%esp
+ 9ad:	ff 75 ec             	push   -0x14(%ebp)
+ 9b0:	e8 e5 fe ff ff       	call   89a <morecore>
+ 9b5:	83 c4 10             	add    $0x10,%esp
+ 9b8:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ 9bb:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 9bf:	75 07                	jne    9c8 <malloc+0xce>
+                return 0;
+ 9c1:	b8 00 00 00 00       	mov    $0x0,%eax
+ 9c6:	eb 13                	jmp    9db <malloc+0xe1>
+    for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 9c8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 9cb:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ 9ce:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 9d1:	8b 00                	mov    (%eax),%eax
+ 9d3:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        if(p->s.size >= nunits){
+ 9d6:	e9 6d ff ff ff       	jmp    948 <malloc+0x4e>
+    }
+}
+ 9db:	c9                   	leave
+ 9dc:	c3                   	ret
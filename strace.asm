@@ -0,0 +1,1628 @@
+
+_strace:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <follow>:
+
+// Print the records of every traced process but skip, until
+// tracing stops.
+void
+follow(int skip)
+{
+   0:	55                   	push   %ebp
+   1:	89 e5                	mov    %esp,%ebp
+   3:	83 ec 18             	sub    $0x18,%esp
+    struct stracerec *r;
+    int i, j, n;
+
+    while((n = straceread(recs, NREC)) > 0){
+   6:	e9 f9 00 00 00       	jmp    104 <follow+0x104>
+        for(i = 0; i < n; i++){
+   b:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  12:	e9 e1 00 00 00       	jmp    f8 <follow+0xf8>
+            r = &recs[i];
+  17:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  1a:	c1 e0 05             	shl    $0x5,%eax
+  1d:	05 a0 22 00 00       	add    $0x22a0,%eax
+  22:	89 45 e8             	mov    %eax,-0x18(%ebp)
+            if(r->pid == skip)
+  25:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  28:	8b 00                	mov    (%eax),%eax
+  2a:	39 45 08             	cmp    %eax,0x8(%ebp)
+  2d:	0f 84 c0 00 00 00    	je     f3 <follow+0xf3>
+                continue;
+            if(r->num < NSYSCALL && names[r->num].name[0])
+  33:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  36:	8b 40 04             	mov    0x4(%eax),%eax
+  39:	83 f8 3f             	cmp    $0x3f,%eax
+  3c:	7f 3c                	jg     7a <follow+0x7a>
+  3e:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  41:	8b 40 04             	mov    0x4(%eax),%eax
+  44:	6b c0 4c             	imul   $0x4c,%eax,%eax
+  47:	05 a0 0f 00 00       	add    $0xfa0,%eax
+  4c:	0f b6 00             	movzbl (%eax),%eax
+  4f:	84 c0                	test   %al,%al
+  51:	74 27                	je     7a <follow+0x7a>
+                printf(2, "%d %s(", r->pid, names[r->num].name);
+  53:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  56:	8b 40 04             	mov    0x4(%eax),%eax
+  59:	6b c0 4c             	imul   $0x4c,%eax,%eax
+  5c:	8d 90 a0 0f 00 00    	lea    0xfa0(%eax),%edx
+  62:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  65:	8b 00                	mov    (%eax),%eax
+  67:	52                   	push   %edx
+  68:	50                   	push   %eax
+  69:	68 4c 0c 00 00       	push   $0xc4c
+  6e:	6a 02                	push   $0x2
+  70:	e8 20 08 00 00       	call   895 <printf>
+  75:	83 c4 10             	add    $0x10,%esp
+  78:	eb 1c                	jmp    96 <follow+0x96>
+            else
+                printf(2, "%d sys%d(", r->pid, r->num);
+  7a:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  7d:	8b 50 04             	mov    0x4(%eax),%edx
+  80:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  83:	8b 00                	mov    (%eax),%eax
+  85:	52                   	push   %edx
+  86:	50                   	push   %eax
+  87:	68 53 0c 00 00       	push   $0xc53
+  8c:	6a 02                	push   $0x2
+  8e:	e8 02 08 00 00       	call   895 <printf>
+  93:	83 c4 10             	add    $0x10,%esp
+            for(j = 0; j < NSTRACEARG; j++)
+  96:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  9d:	eb 2f                	jmp    ce <follow+0xce>
+                printf(2, j ? ", %x" : "%x", r->arg[j]);
+  9f:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  a2:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  a5:	8b 44 90 08          	mov    0x8(%eax,%edx,4),%eax
+  a9:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+  ad:	74 07                	je     b6 <follow+0xb6>
+  af:	ba 5d 0c 00 00       	mov    $0xc5d,%edx
+  b4:	eb 05                	jmp    bb <follow+0xbb>
+  b6:	ba 62 0c 00 00       	mov    $0xc62,%edx
+  bb:	83 ec 04             	sub    $0x4,%esp
+  be:	50                   	push   %eax
+  bf:	52                   	push   %edx
+  c0:	6a 02                	push   $0x2
+  c2:	e8 ce 07 00 00       	call   895 <printf>
+  c7:	83 c4 10             	add    $0x10,%esp
+            for(j = 0; j < NSTRACEARG; j++)
+  ca:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+  ce:	83 7d f0 03          	cmpl   $0x3,-0x10(%ebp)
+  d2:	7e cb                	jle    9f <follow+0x9f>
+            printf(2, ") = %d <%d>\n", r->ret, r->cycles);
+  d4:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  d7:	8b 50 1c             	mov    0x1c(%eax),%edx
+  da:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  dd:	8b 40 18             	mov    0x18(%eax),%eax
+  e0:	52                   	push   %edx
+  e1:	50                   	push   %eax
+  e2:	68 65 0c 00 00       	push   $0xc65
+  e7:	6a 02                	push   $0x2
+  e9:	e8 a7 07 00 00       	call   895 <printf>
+  ee:	83 c4 10             	add    $0x10,%esp
+  f1:	eb 01                	jmp    f4 <follow+0xf4>
+                continue;
+  f3:	90                   	nop
+        for(i = 0; i < n; i++){
+  f4:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+  f8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  fb:	3b 45 ec             	cmp    -0x14(%ebp),%eax
+  fe:	0f 8c 13 ff ff ff    	jl     17 <follow+0x17>
+    while((n = straceread(recs, NREC)) > 0){
+ 104:	83 ec 08             	sub    $0x8,%esp
+ 107:	6a 10                	push   $0x10
+ 109:	68 a0 22 00 00       	push   $0x22a0
+ 10e:	e8 8d 06 00 00       	call   7a0 <straceread>
+ 113:	83 c4 10             	add    $0x10,%esp
+ 116:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 119:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 11d:	0f 8f e8 fe ff ff    	jg     b <follow+0xb>
+        }
+    }
+}
+ 123:	90                   	nop
+ 124:	90                   	nop
+ 125:	c9                   	leave
+ 126:	c3                   	ret
+
+00000127 <main>:
+
+int
+main(int argc, char *argv[])
+{
+ 127:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+ 12b:	83 e4 f0             	and    $0xfffffff0,%esp
+ 12e:	ff 71 fc             	push   -0x4(%ecx)
+ 131:	55                   	push   %ebp
+ 132:	89 e5                	mov    %esp,%ebp
+ 134:	53                   	push   %ebx
+ 135:	51                   	push   %ecx
+ 136:	83 ec 10             	sub    $0x10,%esp
+ 139:	89 cb                	mov    %ecx,%ebx
+    int pid;
+
+    if(argc < 2){
+ 13b:	83 3b 01             	cmpl   $0x1,(%ebx)
+ 13e:	7f 17                	jg     157 <main+0x30>
+        printf(2, "usage: strace cmd [arg...] | strace -p pid\n");
+ 140:	83 ec 08             	sub    $0x8,%esp
+ 143:	68 74 0c 00 00       	push   $0xc74
+ 148:	6a 02                	push   $0x2
+ 14a:	e8 46 07 00 00       	call   895 <printf>
+ 14f:	83 c4 10             	add    $0x10,%esp
+        exit();
+ 152:	e8 40 04 00 00       	call   597 <exit>
+    }
+    sysstat(SYSSTAT_READ, 0, names, NSYSCALL);
+ 157:	6a 40                	push   $0x40
+ 159:	68 a0 0f 00 00       	push   $0xfa0
+ 15e:	6a 00                	push   $0x0
+ 160:	6a 00                	push   $0x0
+ 162:	e8 25 06 00 00       	call   78c <sysstat>
+ 167:	83 c4 10             	add    $0x10,%esp
+
+    if(strcmp(argv[1], "-p") == 0){
+ 16a:	8b 43 04             	mov    0x4(%ebx),%eax
+ 16d:	83 c0 04             	add    $0x4,%eax
+ 170:	8b 00                	mov    (%eax),%eax
+ 172:	83 ec 08             	sub    $0x8,%esp
+ 175:	68 a0 0c 00 00       	push   $0xca0
+ 17a:	50                   	push   %eax
+ 17b:	e8 63 01 00 00       	call   2e3 <strcmp>
+ 180:	83 c4 10             	add    $0x10,%esp
+ 183:	85 c0                	test   %eax,%eax
+ 185:	75 67                	jne    1ee <main+0xc7>
+        if(argc < 3 || strace(atoi(argv[2]), 1) < 0){
+ 187:	83 3b 02             	cmpl   $0x2,(%ebx)
+ 18a:	7e 26                	jle    1b2 <main+0x8b>
+ 18c:	8b 43 04             	mov    0x4(%ebx),%eax
+ 18f:	83 c0 08             	add    $0x8,%eax
+ 192:	8b 00                	mov    (%eax),%eax
+ 194:	83 ec 0c             	sub    $0xc,%esp
+ 197:	50                   	push   %eax
+ 198:	e8 b5 02 00 00       	call   452 <atoi>
+ 19d:	83 c4 10             	add    $0x10,%esp
+ 1a0:	83 ec 08             	sub    $0x8,%esp
+ 1a3:	6a 01                	push   $0x1
+ 1a5:	50                   	push   %eax
+ 1a6:	e8 eb 05 00 00       	call   796 <strace>
+ 1ab:	83 c4 10             	add    $0x10,%esp
+ 1ae:	85 c0                	test   %eax,%eax
+ 1b0:	79 2a                	jns    1dc <main+0xb5>
+            printf(2, "strace: no process %s\n", argc < 3 ? "" : argv[2]);
+ 1b2:	83 3b 02             	cmpl   $0x2,(%ebx)
+ 1b5:	7e 08                	jle    1bf <main+0x98>
+ 1b7:	8b 43 04             	mov    0x4(%ebx),%eax
+ 1ba:	8b 40 08             	mov    0x8(%eax),%eax
+ 1bd:	eb 05                	jmp    1c4 <main+0x9d>
+ 1bf:	b8 a3 0c 00 00       	mov    $0xca3,%eax
+ 1c4:	83 ec 04             	sub    $0x4,%esp
+ 1c7:	50                   	push   %eax
+ 1c8:	68 a4 0c 00 00       	push   $0xca4
+ 1cd:	6a 02                	push   $0x2
+ 1cf:	e8 c1 06 00 00       	call   895 <printf>
+ 1d4:	83 c4 10             	add    $0x10,%esp
+            exit();
+ 1d7:	e8 bb 03 00 00       	call   597 <exit>
+        }
+        follow(0);
+ 1dc:	83 ec 0c             	sub    $0xc,%esp
+ 1df:	6a 00                	push   $0x0
+ 1e1:	e8 1a fe ff ff       	call   0 <follow>
+ 1e6:	83 c4 10             	add    $0x10,%esp
+        exit();
+ 1e9:	e8 a9 03 00 00       	call   597 <exit>
+    }
+
+    // Trace ourselves across the fork, so the child is traced
+    // from its first call, then stop.
+    strace(0, 1);
+ 1ee:	83 ec 08             	sub    $0x8,%esp
+ 1f1:	6a 01                	push   $0x1
+ 1f3:	6a 00                	push   $0x0
+ 1f5:	e8 9c 05 00 00       	call   796 <strace>
+ 1fa:	83 c4 10             	add    $0x10,%esp
+    pid = fork();
+ 1fd:	e8 8e 03 00 00       	call   590 <fork>
+ 202:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(pid == 0){
+ 205:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 209:	75 3b                	jne    246 <main+0x11f>
+        exec(argv[1], argv + 1);
+ 20b:	8b 43 04             	mov    0x4(%ebx),%eax
+ 20e:	8d 50 04             	lea    0x4(%eax),%edx
+ 211:	8b 43 04             	mov    0x4(%ebx),%eax
+ 214:	83 c0 04             	add    $0x4,%eax
+ 217:	8b 00                	mov    (%eax),%eax
+ 219:	83 ec 08             	sub    $0x8,%esp
+ 21c:	52                   	push   %edx
+ 21d:	50                   	push   %eax
+ 21e:	e8 b1 03 00 00       	call   5d4 <exec>
+ 223:	83 c4 10             	add    $0x10,%esp
+        printf(2, "strace: exec %s failed\n", argv[1]);
+ 226:	8b 43 04             	mov    0x4(%ebx),%eax
+ 229:	83 c0 04             	add    $0x4,%eax
+ 22c:	8b 00                	mov    (%eax),%eax
+ 22e:	83 ec 04             	sub    $0x4,%esp
+ 231:	50                   	push   %eax
+ 232:	68 bb 0c 00 00       	push   $0xcbb
+ 237:	6a 02                	push   $0x2
+ 239:	e8 57 06 00 00       	call   895 <printf>
+ 23e:	83 c4 10             	add    $0x10,%esp
+        exit();
+ 241:	e8 51 03 00 00       	call   597 <exit>
+    }
+    strace(0, 0);
+ 246:	83 ec 08             	sub    $0x8,%esp
+ 249:	6a 00                	push   $0x0
+ 24b:	6a 00                	push   $0x0
+ 24d:	e8 44 05 00 00       	call   796 <strace>
+ 252:	83 c4 10             	add    $0x10,%esp
+    if(pid < 0){
+ 255:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 259:	79 17                	jns    272 <main+0x14b>
+        printf(2, "strace: fork failed\n");
+ 25b:	83 ec 08             	sub    $0x8,%esp
+ 25e:	68 d3 0c 00 00       	push   $0xcd3
+ 263:	6a 02                	push   $0x2
+ 265:	e8 2b 06 00 00       	call   895 <printf>
+ 26a:	83 c4 10             	add    $0x10,%esp
+        exit();
+ 26d:	e8 25 03 00 00       	call   597 <exit>
+    }
+    follow(getpid());
+ 272:	e8 b7 03 00 00       	call   62e <getpid>
+ 277:	83 ec 0c             	sub    $0xc,%esp
+ 27a:	50                   	push   %eax
+ 27b:	e8 80 fd ff ff       	call   0 <follow>
+ 280:	83 c4 10             	add    $0x10,%esp
+    wait();
+ 283:	e8 16 03 00 00       	call   59e <wait>
+    exit();
+ 288:	e8 0a 03 00 00       	call   597 <exit>
+
+0000028d <stosb>:
+strchr(const char *s, char c)
+{
+    for(; *s; s++)
+        if(*s == c)
+            return (char*)s;
+    return 0;
+ 28d:	55                   	push   %ebp
+ 28e:	89 e5                	mov    %esp,%ebp
+ 290:	57                   	push   %edi
+ 291:	53                   	push   %ebx
+}
+ 292:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 295:	8b 55 10             	mov    0x10(%ebp),%edx
+ 298:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 29b:	89 cb                	mov    %ecx,%ebx
+ 29d:	89 df                	mov    %ebx,%edi
+ 29f:	89 d1                	mov    %edx,%ecx
+ 2a1:	fc                   	cld
+ 2a2:	f3 aa                	rep stos %al,%es:(%edi)
+ 2a4:	89 ca                	mov    %ecx,%edx
+ 2a6:	89 fb                	mov    %edi,%ebx
+ 2a8:	89 5d 08             	mov    %ebx,0x8(%ebp)
+ 2ab:	89 55 10             	mov    %edx,0x10(%ebp)
+
+char*
+gets(char *buf, int max)
+{
+ 2ae:	90                   	nop
+ 2af:	5b                   	pop    %ebx
+ 2b0:	5f                   	pop    %edi
+ 2b1:	5d                   	pop    %ebp
+ 2b2:	c3                   	ret
+
+000002b3 <strcpy>:
+{
+ 2b3:	55                   	push   %ebp
+ 2b4:	89 e5                	mov    %esp,%ebp
+ 2b6:	83 ec 10             	sub    $0x10,%esp
+    os = s;
+ 2b9:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2bc:	89 45 fc             	mov    %eax,-0x4(%ebp)
+    while((*s++ = *t++) != 0)
+ 2bf:	90                   	nop
+ 2c0:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 2c3:	8d 42 01             	lea    0x1(%edx),%eax
+ 2c6:	89 45 0c             	mov    %eax,0xc(%ebp)
+ 2c9:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2cc:	8d 48 01             	lea    0x1(%eax),%ecx
+ 2cf:	89 4d 08             	mov    %ecx,0x8(%ebp)
+ 2d2:	0f b6 12             	movzbl (%edx),%edx
+ 2d5:	88 10                	mov    %dl,(%eax)
+ 2d7:	0f b6 00             	movzbl (%eax),%eax
+ 2da:	84 c0                	test   %al,%al
+ 2dc:	75 e2                	jne    2c0 <strcpy+0xd>
+    return os;
+ 2de:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 2e1:	c9                   	leave
+ 2e2:	c3                   	ret
+
+000002e3 <strcmp>:
+{
+ 2e3:	55                   	push   %ebp
+ 2e4:	89 e5                	mov    %esp,%ebp
+    while(*p && *p == *q)
+ 2e6:	eb 08                	jmp    2f0 <strcmp+0xd>
+        p++, q++;
+ 2e8:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 2ec:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+    while(*p && *p == *q)
+ 2f0:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2f3:	0f b6 00             	movzbl (%eax),%eax
+ 2f6:	84 c0                	test   %al,%al
+ 2f8:	74 10                	je     30a <strcmp+0x27>
+ 2fa:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2fd:	0f b6 10             	movzbl (%eax),%edx
+ 300:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 303:	0f b6 00             	movzbl (%eax),%eax
+ 306:	38 c2                	cmp    %al,%dl
+ 308:	74 de                	je     2e8 <strcmp+0x5>
+    return (uchar)*p - (uchar)*q;
+ 30a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 30d:	0f b6 00             	movzbl (%eax),%eax
+ 310:	0f b6 d0             	movzbl %al,%edx
+ 313:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 316:	0f b6 00             	movzbl (%eax),%eax
+ 319:	0f b6 c0             	movzbl %al,%eax
+ 31c:	29 c2                	sub    %eax,%edx
+ 31e:	89 d0                	mov    %edx,%eax
+}
+ 320:	5d                   	pop    %ebp
+ 321:	c3                   	ret
+
+00000322 <strlen>:
+{
+ 322:	55                   	push   %ebp
+ 323:	89 e5                	mov    %esp,%ebp
+ 325:	83 ec 10             	sub    $0x10,%esp
+    for(n = 0; s[n]; n++)
+ 328:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ 32f:	eb 04                	jmp    335 <strlen+0x13>
+ 331:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 335:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 338:	8b 45 08             	mov    0x8(%ebp),%eax
+ 33b:	01 d0                	add    %edx,%eax
+ 33d:	0f b6 00             	movzbl (%eax),%eax
+ 340:	84 c0                	test   %al,%al
+ 342:	75 ed                	jne    331 <strlen+0xf>
+    return n;
+ 344:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 347:	c9                   	leave
+ 348:	c3                   	ret
+
+00000349 <memset>:
+{
+ 349:	55                   	push   %ebp
+ 34a:	89 e5                	mov    %esp,%ebp
+    stosb(dst, c, n);
+ 34c:	8b 45 10             	mov    0x10(%ebp),%eax
+ 34f:	50                   	push   %eax
+ 350:	ff 75 0c             	push   0xc(%ebp)
+ 353:	ff 75 08             	push   0x8(%ebp)
+ 356:	e8 32 ff ff ff       	call   28d <stosb>
+ 35b:	83 c4 0c             	add    $0xc,%esp
+    return dst;
+ 35e:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 361:	c9                   	leave
+ 362:	c3                   	ret
+
+00000363 <strchr>:
+{
+ 363:	55                   	push   %ebp
+ 364:	89 e5                	mov    %esp,%ebp
+ 366:	83 ec 04             	sub    $0x4,%esp
+ 369:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 36c:	88 45 fc             	mov    %al,-0x4(%ebp)
+    for(; *s; s++)
+ 36f:	eb 14                	jmp    385 <strchr+0x22>
+        if(*s == c)
+ 371:	8b 45 08             	mov    0x8(%ebp),%eax
+ 374:	0f b6 00             	movzbl (%eax),%eax
+ 377:	38 45 fc             	cmp    %al,-0x4(%ebp)
+ 37a:	75 05                	jne    381 <strchr+0x1e>
+            return (char*)s;
+ 37c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 37f:	eb 13                	jmp    394 <strchr+0x31>
+    for(; *s; s++)
+ 381:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 385:	8b 45 08             	mov    0x8(%ebp),%eax
+ 388:	0f b6 00             	movzbl (%eax),%eax
+ 38b:	84 c0                	test   %al,%al
+ 38d:	75 e2                	jne    371 <strchr+0xe>
+    return 0;
+ 38f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 394:	c9                   	leave
+ 395:	c3                   	ret
+
+00000396 <gets>:
+{
+ 396:	55                   	push   %ebp
+ 397:	89 e5                	mov    %esp,%ebp
+ 399:	83 ec 18             	sub    $0x18,%esp
+    int i, cc;
+    char c;
+
+    for(i=0; i+1 < max; ){
+ 39c:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 3a3:	eb 42                	jmp    3e7 <gets+0x51>
+        cc = read(0, &c, 1);
+ 3a5:	83 ec 04             	sub    $0x4,%esp
+ 3a8:	6a 01                	push   $0x1
+ 3aa:	8d 45 ef             	lea    -0x11(%ebp),%eax
+ 3ad:	50                   	push   %eax
+ 3ae:	6a 00                	push   $0x0
+ 3b0:	e8 f7 01 00 00       	call   5ac <read>
+ 3b5:	83 c4 10             	add    $0x10,%esp
+ 3b8:	89 45 f0             	mov    %eax,-0x10(%ebp)
+        if(cc < 1)
+ 3bb:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 3bf:	7e 33                	jle    3f4 <gets+0x5e>
+            break;
+        buf[i++] = c;
+ 3c1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 3c4:	8d 50 01             	lea    0x1(%eax),%edx
+ 3c7:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 3ca:	89 c2                	mov    %eax,%edx
+ 3cc:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3cf:	01 c2                	add    %eax,%edx
+ 3d1:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 3d5:	88 02                	mov    %al,(%edx)
+        if(c == '\n' || c == '\r')
+ 3d7:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 3db:	3c 0a                	cmp    $0xa,%al
+ 3dd:	74 16                	je     3f5 <gets+0x5f>
+ 3df:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 3e3:	3c 0d                	cmp    $0xd,%al
+ 3e5:	74 0e                	je     3f5 <gets+0x5f>
+    for(i=0; i+1 < max; ){
+ 3e7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 3ea:	83 c0 01             	add    $0x1,%eax
+ 3ed:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 3f0:	7f b3                	jg     3a5 <gets+0xf>
+ 3f2:	eb 01                	jmp    3f5 <gets+0x5f>
+            break;
+ 3f4:	90                   	nop
+            break;
+    }
+    buf[i] = '\0';
+ 3f5:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 3f8:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3fb:	01 d0                	add    %edx,%eax
+ 3fd:	c6 00 00             	movb   $0x0,(%eax)
+    return buf;
+ 400:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 403:	c9                   	leave
+ 404:	c3                   	ret
+
+00000405 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 405:	55                   	push   %ebp
+ 406:	89 e5                	mov    %esp,%ebp
+ 408:	83 ec 18             	sub    $0x18,%esp
+    int fd;
+    int r;
+
+    fd = open(n, O_RDONLY);
+ 40b:	83 ec 08             	sub    $0x8,%esp
+ 40e:	6a 00                	push   $0x0
+ 410:	ff 75 08             	push   0x8(%ebp)
+ 413:	e8 c6 01 00 00       	call   5de <open>
+ 418:	83 c4 10             	add    $0x10,%esp
+ 41b:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(fd < 0)
+ 41e:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 422:	79 07                	jns    42b <stat+0x26>
+        return -1;
+ 424:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 429:	eb 25                	jmp    450 <stat+0x4b>
+    r = fstat(fd, st);
+ 42b:	83 ec 08             	sub    $0x8,%esp
+ 42e:	ff 75 0c             	push   0xc(%ebp)
+ 431:	ff 75 f4             	push   -0xc(%ebp)
+ 434:	e8 c3 01 00 00       	call   5fc <fstat>
+ 439:	83 c4 10             	add    $0x10,%esp
+ 43c:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    close(fd);
+ 43f:	83 ec 0c             	sub    $0xc,%esp
+ 442:	ff 75 f4             	push   -0xc(%ebp)
+ 445:	e8 76 01 00 00       	call   5c0 <close>
+ 44a:	83 c4 10             	add    $0x10,%esp
+    return r;
+ 44d:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ 450:	c9                   	leave
+ 451:	c3                   	ret
+
+00000452 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 452:	55                   	push   %ebp
+ 453:	89 e5                	mov    %esp,%ebp
+ 455:	83 ec 10             	sub    $0x10,%esp
+    int n;
+
+    n = 0;
+ 458:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+    while('0' <= *s && *s <= '9')
+ 45f:	eb 25                	jmp    486 <atoi+0x34>
+        n = n*10 + *s++ - '0';
+ 461:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 464:	89 d0                	mov    %edx,%eax
+ 466:	c1 e0 02             	shl    $0x2,%eax
+ 469:	01 d0                	add    %edx,%eax
+ 46b:	01 c0                	add    %eax,%eax
+ 46d:	89 c1                	mov    %eax,%ecx
+ 46f:	8b 45 08             	mov    0x8(%ebp),%eax
+ 472:	8d 50 01             	lea    0x1(%eax),%edx
+ 475:	89 55 08             	mov    %edx,0x8(%ebp)
+ 478:	0f b6 00             	movzbl (%eax),%eax
+ 47b:	0f be c0             	movsbl %al,%eax
+ 47e:	01 c8                	add    %ecx,%eax
+ 480:	83 e8 30             	sub    $0x30,%eax
+ 483:	89 45 fc             	mov    %eax,-0x4(%ebp)
+    while('0' <= *s && *s <= '9')
+ 486:	8b 45 08             	mov    0x8(%ebp),%eax
+ 489:	0f b6 00             	movzbl (%eax),%eax
+ 48c:	3c 2f                	cmp    $0x2f,%al
+ 48e:	7e 0a                	jle    49a <atoi+0x48>
+ 490:	8b 45 08             	mov    0x8(%ebp),%eax
+ 493:	0f b6 00             	movzbl (%eax),%eax
+ 496:	3c 39                	cmp    $0x39,%al
+ 498:	7e c7                	jle    461 <atoi+0xf>
+    return n;
+ 49a:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 49d:	c9                   	leave
+ 49e:	c3                   	ret
+
+0000049f <nice>:
+
+// Add inc to the caller's nice value; return the new value.
+int
+nice(int inc)
+{
+ 49f:	55                   	push   %ebp
+ 4a0:	89 e5                	mov    %esp,%ebp
+ 4a2:	83 ec 18             	sub    $0x18,%esp
+    int n;
+
+    n = getpriority(0) + inc;
+ 4a5:	83 ec 0c             	sub    $0xc,%esp
+ 4a8:	6a 00                	push   $0x0
+ 4aa:	e8 d9 01 00 00       	call   688 <getpriority>
+ 4af:	83 c4 10             	add    $0x10,%esp
+ 4b2:	8b 55 08             	mov    0x8(%ebp),%edx
+ 4b5:	01 d0                	add    %edx,%eax
+ 4b7:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(n < 0)
+ 4ba:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 4be:	79 07                	jns    4c7 <nice+0x28>
+        n = 0;
+ 4c0:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    if(n > NICEMAX)
+ 4c7:	83 7d f4 13          	cmpl   $0x13,-0xc(%ebp)
+ 4cb:	7e 07                	jle    4d4 <nice+0x35>
+        n = NICEMAX;
+ 4cd:	c7 45 f4 13 00 00 00 	movl   $0x13,-0xc(%ebp)
+    if(setpriority(0, n) < 0)
+ 4d4:	83 ec 08             	sub    $0x8,%esp
+ 4d7:	ff 75 f4             	push   -0xc(%ebp)
+ 4da:	6a 00                	push   $0x0
+ 4dc:	e8 b1 01 00 00       	call   692 <setpriority>
+ 4e1:	83 c4 10             	add    $0x10,%esp
+ 4e4:	85 c0                	test   %eax,%eax
+ 4e6:	79 07                	jns    4ef <nice+0x50>
+        return -1;
+ 4e8:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 4ed:	eb 03                	jmp    4f2 <nice+0x53>
+    return n;
+ 4ef:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+ 4f2:	c9                   	leave
+ 4f3:	c3                   	ret
+
+000004f4 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 4f4:	55                   	push   %ebp
+ 4f5:	89 e5                	mov    %esp,%ebp
+ 4f7:	83 ec 10             	sub    $0x10,%esp
+    char *dst;
+    const char *src;
+
+    dst = vdst;
+ 4fa:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4fd:	89 45 fc             	mov    %eax,-0x4(%ebp)
+    src = vsrc;
+ 500:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 503:	89 45 f8             	mov    %eax,-0x8(%ebp)
+    while(n-- > 0)
+ 506:	eb 17                	jmp    51f <memmove+0x2b>
+        *dst++ = *src++;
+ 508:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 50b:	8d 42 01             	lea    0x1(%edx),%eax
+ 50e:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 511:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 514:	8d 48 01             	lea    0x1(%eax),%ecx
+ 517:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+ 51a:	0f b6 12             	movzbl (%edx),%edx
+ 51d:	88 10                	mov    %dl,(%eax)
+    while(n-- > 0)
+ 51f:	8b 45 10             	mov    0x10(%ebp),%eax
+ 522:	8d 50 ff             	lea    -0x1(%eax),%edx
+ 525:	89 55 10             	mov    %edx,0x10(%ebp)
+ 528:	85 c0                	test   %eax,%eax
+ 52a:	7f dc                	jg     508 <memmove+0x14>
+    return vdst;
+ 52c:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 52f:	c9                   	leave
+ 530:	c3                   	ret
+
+00000531 <dosyscall>:
+sysmode:
+    .long 0
+
+    .text
+dosyscall:
+    cmpl $0, sysmode
+ 531:	83 3d 78 0f 00 00 00 	cmpl   $0x0,0xf78
+    jg 2f
+ 538:	7f 0c                	jg     546 <dosyscall+0x15>
+    jl 1f
+ 53a:	7c 07                	jl     543 <dosyscall+0x12>
+    call sepcheck
+ 53c:	e8 27 00 00 00       	call   568 <sepcheck>
+    jmp dosyscall
+ 541:	eb ee                	jmp    531 <dosyscall>
+1:
+    int $T_SYSCALL
+ 543:	cd 40                	int    $0x40
+    ret
+ 545:	c3                   	ret
+2:
+    pushl %ebx
+ 546:	53                   	push   %ebx
+    pushl %esi
+ 547:	56                   	push   %esi
+    pushl %edi
+ 548:	57                   	push   %edi
+    pushl %ebp
+ 549:	55                   	push   %ebp
+    movl 20(%esp), %ebx
+ 54a:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+    movl 24(%esp), %esi
+ 54e:	8b 74 24 18          	mov    0x18(%esp),%esi
+    movl 28(%esp), %edi
+ 552:	8b 7c 24 1c          	mov    0x1c(%esp),%edi
+    movl 32(%esp), %ebp
+ 556:	8b 6c 24 20          	mov    0x20(%esp),%ebp
+    movl %esp, %ecx
+ 55a:	89 e1                	mov    %esp,%ecx
+    movl $3f, %edx
+ 55c:	ba 63 05 00 00       	mov    $0x563,%edx
+    sysenter
+ 561:	0f 34                	sysenter
+3:
+    popl %ebp
+ 563:	5d                   	pop    %ebp
+    popl %edi
+ 564:	5f                   	pop    %edi
+    popl %esi
+ 565:	5e                   	pop    %esi
+    popl %ebx
+ 566:	5b                   	pop    %ebx
+    ret
+ 567:	c3                   	ret
+
+00000568 <sepcheck>:
+
+# Set sysmode from cpuid's SEP flag.    Preserves %eax.
+sepcheck:
+    pushl %eax
+ 568:	50                   	push   %eax
+    pushl %ebx
+ 569:	53                   	push   %ebx
+    movl $1, %eax
+ 56a:	b8 01 00 00 00       	mov    $0x1,%eax
+    cpuid
+ 56f:	0f a2                	cpuid
+    movl $-1, sysmode
+ 571:	c7 05 78 0f 00 00 ff 	movl   $0xffffffff,0xf78
+ 578:	ff ff ff 
+    testl $0x800, %edx
+ 57b:	f7 c2 00 08 00 00    	test   $0x800,%edx
+    jz 1f
+ 581:	74 0a                	je     58d <sepcheck+0x25>
+    movl $1, sysmode
+ 583:	c7 05 78 0f 00 00 01 	movl   $0x1,0xf78
+ 58a:	00 00 00 
+1:
+    popl %ebx
+ 58d:	5b                   	pop    %ebx
+    popl %eax
+ 58e:	58                   	pop    %eax
+    ret
+ 58f:	c3                   	ret
+
+00000590 <fork>:
+
+SYSCALL(fork)
+ 590:	b8 01 00 00 00       	mov    $0x1,%eax
+ 595:	eb 9a                	jmp    531 <dosyscall>
+
+00000597 <exit>:
+SYSCALL(exit)
+ 597:	b8 02 00 00 00       	mov    $0x2,%eax
+ 59c:	eb 93                	jmp    531 <dosyscall>
+
+0000059e <wait>:
+SYSCALL(wait)
+ 59e:	b8 03 00 00 00       	mov    $0x3,%eax
+ 5a3:	eb 8c                	jmp    531 <dosyscall>
+
+000005a5 <pipe>:
+SYSCALL(pipe)
+ 5a5:	b8 04 00 00 00       	mov    $0x4,%eax
+ 5aa:	eb 85                	jmp    531 <dosyscall>
+
+000005ac <read>:
+SYSCALL(read)
+ 5ac:	b8 05 00 00 00       	mov    $0x5,%eax
+ 5b1:	e9 7b ff ff ff       	jmp    531 <dosyscall>
+
+000005b6 <write>:
+SYSCALL(write)
+ 5b6:	b8 10 00 00 00       	mov    $0x10,%eax
+ 5bb:	e9 71 ff ff ff       	jmp    531 <dosyscall>
+
+000005c0 <close>:
+SYSCALL(close)
+ 5c0:	b8 15 00 00 00       	mov    $0x15,%eax
+ 5c5:	e9 67 ff ff ff       	jmp    531 <dosyscall>
+
+000005ca <kill>:
+SYSCALL(kill)
+ 5ca:	b8 06 00 00 00       	mov    $0x6,%eax
+ 5cf:	e9 5d ff ff ff       	jmp    531 <dosyscall>
+
+000005d4 <exec>:
+SYSCALL(exec)
+ 5d4:	b8 07 00 00 00       	mov    $0x7,%eax
+ 5d9:	e9 53 ff ff ff       	jmp    531 <dosyscall>
+
+000005de <open>:
+SYSCALL(open)
+ 5de:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 5e3:	e9 49 ff ff ff       	jmp    531 <dosyscall>
+
+000005e8 <mknod>:
+SYSCALL(mknod)
+ 5e8:	b8 11 00 00 00       	mov    $0x11,%eax
+ 5ed:	e9 3f ff ff ff       	jmp    531 <dosyscall>
+
+000005f2 <unlink>:
+SYSCALL(unlink)
+ 5f2:	b8 12 00 00 00       	mov    $0x12,%eax
+ 5f7:	e9 35 ff ff ff       	jmp    531 <dosyscall>
+
+000005fc <fstat>:
+SYSCALL(fstat)
+ 5fc:	b8 08 00 00 00       	mov    $0x8,%eax
+ 601:	e9 2b ff ff ff       	jmp    531 <dosyscall>
+
+00000606 <link>:
+SYSCALL(link)
+ 606:	b8 13 00 00 00       	mov    $0x13,%eax
+ 60b:	e9 21 ff ff ff       	jmp    531 <dosyscall>
+
+00000610 <mkdir>:
+SYSCALL(mkdir)
+ 610:	b8 14 00 00 00       	mov    $0x14,%eax
+ 615:	e9 17 ff ff ff       	jmp    531 <dosyscall>
+
+0000061a <chdir>:
+SYSCALL(chdir)
+ 61a:	b8 09 00 00 00       	mov    $0x9,%eax
+ 61f:	e9 0d ff ff ff       	jmp    531 <dosyscall>
+
+00000624 <dup>:
+SYSCALL(dup)
+ 624:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 629:	e9 03 ff ff ff       	jmp    531 <dosyscall>
+
+0000062e <getpid>:
+SYSCALL(getpid)
+ 62e:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 633:	e9 f9 fe ff ff       	jmp    531 <dosyscall>
+
+00000638 <sbrk>:
+SYSCALL(sbrk)
+ 638:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 63d:	e9 ef fe ff ff       	jmp    531 <dosyscall>
+
+00000642 <sleep>:
+SYSCALL(sleep)
+ 642:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 647:	e9 e5 fe ff ff       	jmp    531 <dosyscall>
+
+0000064c <uptime>:
+SYSCALL(uptime)
+ 64c:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 651:	e9 db fe ff ff       	jmp    531 <dosyscall>
+
+00000656 <date>:
+SYSCALL(date)
+ 656:	b8 16 00 00 00       	mov    $0x16,%eax
+ 65b:	e9 d1 fe ff ff       	jmp    531 <dosyscall>
+
+00000660 <dup2>:
+SYSCALL(dup2)
+ 660:	b8 17 00 00 00       	mov    $0x17,%eax
+ 665:	e9 c7 fe ff ff       	jmp    531 <dosyscall>
+
+0000066a <uffd>:
+SYSCALL(uffd)
+ 66a:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 66f:	e9 bd fe ff ff       	jmp    531 <dosyscall>
+
+00000674 <uffdregister>:
+SYSCALL(uffdregister)
+ 674:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 679:	e9 b3 fe ff ff       	jmp    531 <dosyscall>
+
+0000067e <uffdcopy>:
+SYSCALL(uffdcopy)
+ 67e:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 683:	e9 a9 fe ff ff       	jmp    531 <dosyscall>
+
+00000688 <getpriority>:
+SYSCALL(getpriority)
+ 688:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 68d:	e9 9f fe ff ff       	jmp    531 <dosyscall>
+
+00000692 <setpriority>:
+SYSCALL(setpriority)
+ 692:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 697:	e9 95 fe ff ff       	jmp    531 <dosyscall>
+
+0000069c <setweight>:
+SYSCALL(setweight)
+ 69c:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 6a1:	e9 8b fe ff ff       	jmp    531 <dosyscall>
+
+000006a6 <setgroup>:
+SYSCALL(setgroup)
+ 6a6:	b8 20 00 00 00       	mov    $0x20,%eax
+ 6ab:	e9 81 fe ff ff       	jmp    531 <dosyscall>
+
+000006b0 <schedinfo>:
+SYSCALL(schedinfo)
+ 6b0:	b8 21 00 00 00       	mov    $0x21,%eax
+ 6b5:	e9 77 fe ff ff       	jmp    531 <dosyscall>
+
+000006ba <nanosleep>:
+SYSCALL(nanosleep)
+ 6ba:	b8 22 00 00 00       	mov    $0x22,%eax
+ 6bf:	e9 6d fe ff ff       	jmp    531 <dosyscall>
+
+000006c4 <clock_nanosleep>:
+SYSCALL(clock_nanosleep)
+ 6c4:	b8 23 00 00 00       	mov    $0x23,%eax
+ 6c9:	e9 63 fe ff ff       	jmp    531 <dosyscall>
+
+000006ce <clock_gettime>:
+SYSCALL(clock_gettime)
+ 6ce:	b8 24 00 00 00       	mov    $0x24,%eax
+ 6d3:	e9 59 fe ff ff       	jmp    531 <dosyscall>
+
+000006d8 <sched_setaffinity>:
+SYSCALL(sched_setaffinity)
+ 6d8:	b8 25 00 00 00       	mov    $0x25,%eax
+ 6dd:	e9 4f fe ff ff       	jmp    531 <dosyscall>
+
+000006e2 <sched_getaffinity>:
+SYSCALL(sched_getaffinity)
+ 6e2:	b8 26 00 00 00       	mov    $0x26,%eax
+ 6e7:	e9 45 fe ff ff       	jmp    531 <dosyscall>
+
+000006ec <irqaffinity>:
+SYSCALL(irqaffinity)
+ 6ec:	b8 27 00 00 00       	mov    $0x27,%eax
+ 6f1:	e9 3b fe ff ff       	jmp    531 <dosyscall>
+
+000006f6 <getrusage>:
+SYSCALL(getrusage)
+ 6f6:	b8 28 00 00 00       	mov    $0x28,%eax
+ 6fb:	e9 31 fe ff ff       	jmp    531 <dosyscall>
+
+00000700 <times>:
+SYSCALL(times)
+ 700:	b8 29 00 00 00       	mov    $0x29,%eax
+ 705:	e9 27 fe ff ff       	jmp    531 <dosyscall>
+
+0000070a <schedlat>:
+SYSCALL(schedlat)
+ 70a:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 70f:	e9 1d fe ff ff       	jmp    531 <dosyscall>
+
+00000714 <sched_setscheduler>:
+SYSCALL(sched_setscheduler)
+ 714:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 719:	e9 13 fe ff ff       	jmp    531 <dosyscall>
+
+0000071e <sched_getscheduler>:
+SYSCALL(sched_getscheduler)
+ 71e:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 723:	e9 09 fe ff ff       	jmp    531 <dosyscall>
+
+00000728 <sched_getparam>:
+SYSCALL(sched_getparam)
+ 728:	b8 2d 00 00 00       	mov    $0x2d,%eax
+ 72d:	e9 ff fd ff ff       	jmp    531 <dosyscall>
+
+00000732 <lockstat>:
+SYSCALL(lockstat)
+ 732:	b8 2e 00 00 00       	mov    $0x2e,%eax
+ 737:	e9 f5 fd ff ff       	jmp    531 <dosyscall>
+
+0000073c <ioring_setup>:
+SYSCALL(ioring_setup)
+ 73c:	b8 2f 00 00 00       	mov    $0x2f,%eax
+ 741:	e9 eb fd ff ff       	jmp    531 <dosyscall>
+
+00000746 <ioring_enter>:
+SYSCALL(ioring_enter)
+ 746:	b8 30 00 00 00       	mov    $0x30,%eax
+ 74b:	e9 e1 fd ff ff       	jmp    531 <dosyscall>
+
+00000750 <readv>:
+SYSCALL(readv)
+ 750:	b8 31 00 00 00       	mov    $0x31,%eax
+ 755:	e9 d7 fd ff ff       	jmp    531 <dosyscall>
+
+0000075a <writev>:
+SYSCALL(writev)
+ 75a:	b8 32 00 00 00       	mov    $0x32,%eax
+ 75f:	e9 cd fd ff ff       	jmp    531 <dosyscall>
+
+00000764 <pread>:
+SYSCALL(pread)
+ 764:	b8 33 00 00 00       	mov    $0x33,%eax
+ 769:	e9 c3 fd ff ff       	jmp    531 <dosyscall>
+
+0000076e <pwrite>:
+SYSCALL(pwrite)
+ 76e:	b8 34 00 00 00       	mov    $0x34,%eax
+ 773:	e9 b9 fd ff ff       	jmp    531 <dosyscall>
+
+00000778 <sendfile>:
+SYSCALL(sendfile)
+ 778:	b8 35 00 00 00       	mov    $0x35,%eax
+ 77d:	e9 af fd ff ff       	jmp    531 <dosyscall>
+
+00000782 <splice>:
+SYSCALL(splice)
+ 782:	b8 36 00 00 00       	mov    $0x36,%eax
+ 787:	e9 a5 fd ff ff       	jmp    531 <dosyscall>
+
+0000078c <sysstat>:
+SYSCALL(sysstat)
+ 78c:	b8 37 00 00 00       	mov    $0x37,%eax
+ 791:	e9 9b fd ff ff       	jmp    531 <dosyscall>
+
+00000796 <strace>:
+SYSCALL(strace)
+ 796:	b8 38 00 00 00       	mov    $0x38,%eax
+ 79b:	e9 91 fd ff ff       	jmp    531 <dosyscall>
+
+000007a0 <straceread>:
+SYSCALL(straceread)
+ 7a0:	b8 39 00 00 00       	mov    $0x39,%eax
+ 7a5:	e9 87 fd ff ff       	jmp    531 <dosyscall>
+
+000007aa <alarm>:
+
+# alarm and rstoregs keep to int $T_SYSCALL: rstoregs restores
+# %ecx and %edx, which sysexit would clobber.
+.globl alarm
+    alarm:
+        pushl $rstoregs
+ 7aa:	68 ba 07 00 00       	push   $0x7ba
+        movl $SYS_alarm, %eax
+ 7af:	b8 18 00 00 00       	mov    $0x18,%eax
+        int $T_SYSCALL
+ 7b4:	cd 40                	int    $0x40
+        add $0x04, %esp
+ 7b6:	83 c4 04             	add    $0x4,%esp
+        ret
+ 7b9:	c3                   	ret
+
+000007ba <rstoregs>:
+
+.globl rstoregs
+    rstoregs:
+        movl $SYS_rstoregs, %eax
+ 7ba:	b8 19 00 00 00       	mov    $0x19,%eax
+        int $T_SYSCALL
+ 7bf:	cd 40                	int    $0x40
+
+000007c1 <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 7c1:	55                   	push   %ebp
+ 7c2:	89 e5                	mov    %esp,%ebp
+ 7c4:	83 ec 18             	sub    $0x18,%esp
+ 7c7:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 7ca:	88 45 f4             	mov    %al,-0xc(%ebp)
+    write(fd, &c, 1);
+ 7cd:	83 ec 04             	sub    $0x4,%esp
+ 7d0:	6a 01                	push   $0x1
+ 7d2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+ 7d5:	50                   	push   %eax
+ 7d6:	ff 75 08             	push   0x8(%ebp)
+ 7d9:	e8 d8 fd ff ff       	call   5b6 <write>
+ 7de:	83 c4 10             	add    $0x10,%esp
+}
+ 7e1:	90                   	nop
+ 7e2:	c9                   	leave
+ 7e3:	c3                   	ret
+
+000007e4 <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 7e4:	55                   	push   %ebp
+ 7e5:	89 e5                	mov    %esp,%ebp
+ 7e7:	83 ec 28             	sub    $0x28,%esp
+    static char digits[] = "0123456789ABCDEF";
+    char buf[16];
+    int i, neg;
+    uint x;
+
+    neg = 0;
+ 7ea:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+    if(sgn && xx < 0){
+ 7f1:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+ 7f5:	74 17                	je     80e <printint+0x2a>
+ 7f7:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 7fb:	79 11                	jns    80e <printint+0x2a>
+        neg = 1;
+ 7fd:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+        x = -xx;
+ 804:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 807:	f7 d8                	neg    %eax
+ 809:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 80c:	eb 06                	jmp    814 <printint+0x30>
+    } else {
+        x = xx;
+ 80e:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 811:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    }
+
+    i = 0;
+ 814:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    do{
+        buf[i++] = digits[x % base];
+ 81b:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 81e:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 821:	ba 00 00 00 00       	mov    $0x0,%edx
+ 826:	f7 f1                	div    %ecx
+ 828:	89 d1                	mov    %edx,%ecx
+ 82a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 82d:	8d 50 01             	lea    0x1(%eax),%edx
+ 830:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 833:	0f b6 91 7c 0f 00 00 	movzbl 0xf7c(%ecx),%edx
+ 83a:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+    }while((x /= base) != 0);
+ 83e:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 841:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 844:	ba 00 00 00 00       	mov    $0x0,%edx
+ 849:	f7 f1                	div    %ecx
+ 84b:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 84e:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 852:	75 c7                	jne    81b <printint+0x37>
+    if(neg)
+ 854:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 858:	74 2d                	je     887 <printint+0xa3>
+        buf[i++] = '-';
+ 85a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 85d:	8d 50 01             	lea    0x1(%eax),%edx
+ 860:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 863:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+    while(--i >= 0)
+ 868:	eb 1d                	jmp    887 <printint+0xa3>
+        putc(fd, buf[i]);
+ 86a:	8d 55 dc             	lea    -0x24(%ebp),%edx
+ 86d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 870:	01 d0                	add    %edx,%eax
+ 872:	0f b6 00             	movzbl (%eax),%eax
+ 875:	0f be c0             	movsbl %al,%eax
+ 878:	83 ec 08             	sub    $0x8,%esp
+ 87b:	50                   	push   %eax
+ 87c:	ff 75 08             	push   0x8(%ebp)
+ 87f:	e8 3d ff ff ff       	call   7c1 <putc>
+ 884:	83 c4 10             	add    $0x10,%esp
+    while(--i >= 0)
+ 887:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+ 88b:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 88f:	79 d9                	jns    86a <printint+0x86>
+}
+ 891:	90                   	nop
+ 892:	90                   	nop
+ 893:	c9                   	leave
+ 894:	c3                   	ret
+
+00000895 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 895:	55                   	push   %ebp
+ 896:	89 e5                	mov    %esp,%ebp
+ 898:	83 ec 28             	sub    $0x28,%esp
+    char *s;
+    int c, i, state;
+    uint *ap;
+
+    state = 0;
+ 89b:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+    ap = (uint*)(void*)&fmt + 1;
+ 8a2:	8d 45 0c             	lea    0xc(%ebp),%eax
+ 8a5:	83 c0 04             	add    $0x4,%eax
+ 8a8:	89 45 e8             	mov    %eax,-0x18(%ebp)
+    for(i = 0; fmt[i]; i++){
+ 8ab:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 8b2:	e9 59 01 00 00       	jmp    a10 <printf+0x17b>
+        c = fmt[i] & 0xff;
+ 8b7:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 8ba:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 8bd:	01 d0                	add    %edx,%eax
+ 8bf:	0f b6 00             	movzbl (%eax),%eax
+ 8c2:	0f be c0             	movsbl %al,%eax
+ 8c5:	25 ff 00 00 00       	and    $0xff,%eax
+ 8ca:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        if(state == 0){
+ 8cd:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 8d1:	75 2c                	jne    8ff <printf+0x6a>
+            if(c == '%'){
+ 8d3:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 8d7:	75 0c                	jne    8e5 <printf+0x50>
+                state = '%';
+ 8d9:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+ 8e0:	e9 27 01 00 00       	jmp    a0c <printf+0x177>
+            } else {
+                putc(fd, c);
+ 8e5:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 8e8:	0f be c0             	movsbl %al,%eax
+ 8eb:	83 ec 08             	sub    $0x8,%esp
+ 8ee:	50                   	push   %eax
+ 8ef:	ff 75 08             	push   0x8(%ebp)
+ 8f2:	e8 ca fe ff ff       	call   7c1 <putc>
+ 8f7:	83 c4 10             	add    $0x10,%esp
+ 8fa:	e9 0d 01 00 00       	jmp    a0c <printf+0x177>
+            }
+        } else if(state == '%'){
+ 8ff:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+ 903:	0f 85 03 01 00 00    	jne    a0c <printf+0x177>
+            if(c == 'd'){
+ 909:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+ 90d:	75 1e                	jne    92d <printf+0x98>
+                printint(fd, *ap, 10, 1);
+ 90f:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 912:	8b 00                	mov    (%eax),%eax
+ 914:	6a 01                	push   $0x1
+ 916:	6a 0a                	push   $0xa
+ 918:	50                   	push   %eax
+ 919:	ff 75 08             	push   0x8(%ebp)
+ 91c:	e8 c3 fe ff ff       	call   7e4 <printint>
+ 921:	83 c4 10             	add    $0x10,%esp
+                ap++;
+ 924:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 928:	e9 d8 00 00 00       	jmp    a05 <printf+0x170>
+            } else if(c == 'x' || c == 'p'){
+ 92d:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+ 931:	74 06                	je     939 <printf+0xa4>
+ 933:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+ 937:	75 1e                	jne    957 <printf+0xc2>
+                printint(fd, *ap, 16, 0);
+ 939:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 93c:	8b 00                	mov    (%eax),%eax
+ 93e:	6a 00                	push   $0x0
+ 940:	6a 10                	push   $0x10
+ 942:	50                   	push   %eax
+ 943:	ff 75 08             	push   0x8(%ebp)
+ 946:	e8 99 fe ff ff       	call   7e4 <printint>
+ 94b:	83 c4 10             	add    $0x10,%esp
+                ap++;
+ 94e:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 952:	e9 ae 00 00 00       	jmp    a05 <printf+0x170>
+            } else if(c == 's'){
+ 957:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+ 95b:	75 43                	jne    9a0 <printf+0x10b>
+                s = (char*)*ap;
+ 95d:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 960:	8b 00                	mov    (%eax),%eax
+ 962:	89 45 f4             	mov    %eax,-0xc(%ebp)
+                ap++;
+ 965:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+                if(s == 0)
+ 969:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 96d:	75 25                	jne    994 <printf+0xff>
+                    s = "(null)";
+ 96f:	c7 45 f4 e8 0c 00 00 	movl   $0xce8,-0xc(%ebp)
+                while(*s != 0){
+ 976:	eb 1c                	jmp    994 <printf+0xff>
+                    putc(fd, *s);
+ 978:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 97b:	0f b6 00             	movzbl (%eax),%eax
+ 97e:	0f be c0             	movsbl %al,%eax
+ 981:	83 ec 08             	sub    $0x8,%esp
+ 984:	50                   	push   %eax
+ 985:	ff 75 08             	push   0x8(%ebp)
+ 988:	e8 34 fe ff ff       	call   7c1 <putc>
+ 98d:	83 c4 10             	add    $0x10,%esp
+                    s++;
+ 990:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+                while(*s != 0){
+ 994:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 997:	0f b6 00             	movzbl (%eax),%eax
+ 99a:	84 c0                	test   %al,%al
+ 99c:	75 da                	jne    978 <printf+0xe3>
+ 99e:	eb 65                	jmp    a05 <printf+0x170>
+                }
+            } else if(c == 'c'){
+ 9a0:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+ 9a4:	75 1d                	jne    9c3 <printf+0x12e>
+                putc(fd, *ap);
+ 9a6:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 9a9:	8b 00                	mov    (%eax),%eax
+ 9ab:	0f be c0             	movsbl %al,%eax
+ 9ae:	83 ec 08             	sub    $0x8,%esp
+ 9b1:	50                   	push   %eax
+ 9b2:	ff 75 08             	push   0x8(%ebp)
+ 9b5:	e8 07 fe ff ff       	call   7c1 <putc>
+ 9ba:	83 c4 10             	add    $0x10,%esp
+                ap++;
+ 9bd:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 9c1:	eb 42                	jmp    a05 <printf+0x170>
+            } else if(c == '%'){
+ 9c3:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 9c7:	75 17                	jne    9e0 <printf+0x14b>
+                putc(fd, c);
+ 9c9:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 9cc:	0f be c0             	movsbl %al,%eax
+ 9cf:	83 ec 08             	sub    $0x8,%esp
+ 9d2:	50                   	push   %eax
+ 9d3:	ff 75 08             	push   0x8(%ebp)
+ 9d6:	e8 e6 fd ff ff       	call   7c1 <putc>
+ 9db:	83 c4 10             	add    $0x10,%esp
+ 9de:	eb 25                	jmp    a05 <printf+0x170>
+            } else {
+                // Unknown % sequence.    Print it to draw attention.
+                putc(fd, '%');
+ 9e0:	83 ec 08             	sub    $0x8,%esp
+ 9e3:	6a 25                	push   $0x25
+ 9e5:	ff 75 08             	push   0x8(%ebp)
+ 9e8:	e8 d4 fd ff ff       	call   7c1 <putc>
+ 9ed:	83 c4 10             	add    $0x10,%esp
+                putc(fd, c);
+ 9f0:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 9f3:	0f be c0             	movsbl %al,%eax
+ 9f6:	83 ec 08             	sub    $0x8,%esp
+ 9f9:	50                   	push   %eax
+ 9fa:	ff 75 08             	push   0x8(%ebp)
+ 9fd:	e8 bf fd ff ff       	call   7c1 <putc>
+ a02:	83 c4 10             	add    $0x10,%esp
+            }
+            state = 0;
+ a05:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+    for(i = 0; fmt[i]; i++){
+ a0c:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ a10:	8b 55 0c             	mov    0xc(%ebp),%edx
+ a13:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ a16:	01 d0                	add    %edx,%eax
+ a18:	0f b6 00             	movzbl (%eax),%eax
+ a1b:	84 c0                	test   %al,%al
+ a1d:	0f 85 94 fe ff ff    	jne    8b7 <printf+0x22>
+        }
+    }
+}
+ a23:	90                   	nop
+ a24:	90                   	nop
+ a25:	c9                   	leave
+ a26:	c3                   	ret
+
+00000a27 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ a27:	55                   	push   %ebp
+ a28:	89 e5                	mov    %esp,%ebp
+ a2a:	83 ec 10             	sub    $0x10,%esp
+    Header *bp, *p;
+
+    bp = (Header*)ap - 1;
+ a2d:	8b 45 08             	mov    0x8(%ebp),%eax
+ a30:	83 e8 08             	sub    $0x8,%eax
+ a33:	89 45 f8             	mov    %eax,-0x8(%ebp)
+    for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ a36:	a1 a8 24 00 00       	mov    0x24a8,%eax
+ a3b:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ a3e:	eb 24                	jmp    a64 <free+0x3d>
+        if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ a40:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a43:	8b 00                	mov    (%eax),%eax
+ a45:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ a48:	72 12                	jb     a5c <free+0x35>
+ a4a:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ a4d:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ a50:	72 24                	jb     a76 <free+0x4f>
+ a52:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a55:	8b 00                	mov    (%eax),%eax
+ a57:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ a5a:	72 1a                	jb     a76 <free+0x4f>
+    for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ a5c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a5f:	8b 00                	mov    (%eax),%eax
+ a61:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ a64:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ a67:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ a6a:	73 d4                	jae    a40 <free+0x19>
+ a6c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a6f:	8b 00                	mov    (%eax),%eax
+ a71:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ a74:	73 ca                	jae    a40 <free+0x19>
+            break;
+    if(bp + bp->s.size == p->s.ptr){
+ a76:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ a79:	8b 40 04             	mov    0x4(%eax),%eax
+ a7c:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ a83:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ a86:	01 c2                	add    %eax,%edx
+ a88:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a8b:	8b 00                	mov    (%eax),%eax
+ a8d:	39 c2                	cmp    %eax,%edx
+ a8f:	75 24                	jne    ab5 <free+0x8e>
+        bp->s.size += p->s.ptr->s.size;
+ a91:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ a94:	8b 50 04             	mov    0x4(%eax),%edx
+ a97:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a9a:	8b 00                	mov    (%eax),%eax
+ a9c:	8b 40 04             	mov    0x4(%eax),%eax
+ a9f:	01 c2                	add    %eax,%edx
+ aa1:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ aa4:	89 50 04             	mov    %edx,0x4(%eax)
+        bp->s.ptr = p->s.ptr->s.ptr;
+ aa7:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ aaa:	8b 00                	mov    (%eax),%eax
+ aac:	8b 10                	mov    (%eax),%edx
+ aae:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ ab1:	89 10                	mov    %edx,(%eax)
+ ab3:	eb 0a                	jmp    abf <free+0x98>
+    } else
+        bp->s.ptr = p->s.ptr;
+ ab5:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ ab8:	8b 10                	mov    (%eax),%edx
+ aba:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ abd:	89 10                	mov    %edx,(%eax)
+    if(p + p->s.size == bp){
+ abf:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ ac2:	8b 40 04             	mov    0x4(%eax),%eax
+ ac5:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ acc:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ acf:	01 d0                	add    %edx,%eax
+ ad1:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ ad4:	75 20                	jne    af6 <free+0xcf>
+        p->s.size += bp->s.size;
+ ad6:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ ad9:	8b 50 04             	mov    0x4(%eax),%edx
+ adc:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ adf:	8b 40 04             	mov    0x4(%eax),%eax
+ ae2:	01 c2                	add    %eax,%edx
+ ae4:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ ae7:	89 50 04             	mov    %edx,0x4(%eax)
+        p->s.ptr = bp->s.ptr;
+ aea:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ aed:	8b 10                	mov    (%eax),%edx
+ aef:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ af2:	89 10                	mov    %edx,(%eax)
+ af4:	eb 08                	jmp    afe <free+0xd7>
+    } else
+        p->s.ptr = bp;
+ af6:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ af9:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ afc:	89 10                	mov    %edx,(%eax)
+    freep = p;
+ afe:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b01:	a3 a8 24 00 00       	mov    %eax,0x24a8
+}
+ b06:	90                   	nop
+ b07:	c9                   	leave
+ b08:	c3                   	ret
+
+00000b09 <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+ b09:	55                   	push   %ebp
+ b0a:	89 e5                	mov    %esp,%ebp
+ b0c:	83 ec 18             	sub    $0x18,%esp
+    char *p;
+    Header *hp;
+
+    if(nu < 4096)
+ b0f:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+ b16:	77 07                	ja     b1f <morecore+0x16>
+        nu = 4096;
+ b18:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+    p = sbrk(nu * sizeof(Header));
+ b1f:	8b 45 08             	mov    0x8(%ebp),%eax
+ b22:	c1 e0 03             	shl    $0x3,%eax
+ b25:	83 ec 0c             	sub    $0xc,%esp
+ b28:	50                   	push   %eax
+ b29:	e8 0a fb ff ff       	call   638 <sbrk>
+ b2e:	83 c4 10             	add    $0x10,%esp
+ b31:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p == (char*)-1)
+ b34:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+ b38:	75 07                	jne    b41 <morecore+0x38>
+        return 0;
+ b3a:	b8 00 00 00 00       	mov    $0x0,%eax
+ b3f:	eb 26                	jmp    b67 <morecore+0x5e>
+    hp = (Header*)p;
+ b41:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b44:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    hp->s.size = nu;
+ b47:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ b4a:	8b 55 08             	mov    0x8(%ebp),%edx
+ b4d:	89 50 04             	mov    %edx,0x4(%eax)
+    free((void*)(hp + 1));
+ b50:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ b53:	83 c0 08             	add    $0x8,%eax
+ b56:	83 ec 0c             	sub    $0xc,%esp
+ b59:	50                   	push   %eax
+ b5a:	e8 c8 fe ff ff       	call   a27 <free>
+ b5f:	83 c4 10             	add    $0x10,%esp
+    return freep;
+ b62:	a1 a8 24 00 00       	mov    0x24a8,%eax
+}
+ b67:	c9                   	leave
+ b68:	c3                   	ret
+
+00000b69 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ b69:	55                   	push   %ebp
+ b6a:	89 e5                	mov    %esp,%ebp
+ b6c:	83 ec 18             	sub    $0x18,%esp
+    Header *p, *prevp;
+    uint nunits;
+
+    nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ b6f:	8b 45 08             	mov    0x8(%ebp),%eax
+ b72:	83 c0 07             	add    $0x7,%eax
+ b75:	c1 e8 03             	shr    $0x3,%eax
+ b78:	83 c0 01             	add    $0x1,%eax
+ b7b:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    if((prevp = freep) == 0){
+ b7e:	a1 a8 24 00 00       	mov    0x24a8,%eax
+ b83:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ b86:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ b8a:	75 23                	jne    baf <malloc+0x46>
+        base.s.ptr = freep = prevp = &base;
+ b8c:	c7 45 f0 a0 24 00 00 	movl   $0x24a0,-0x10(%ebp)
+ b93:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ b96:	a3 a8 24 00 00       	mov    %eax,0x24a8
+ b9b:	a1 a8 24 00 00       	mov    0x24a8,%eax
+ ba0:	a3 a0 24 00 00       	mov    %eax,0x24a0
+        base.s.size = 0;
+ ba5:	c7 05 a4 24 00 00 00 	movl   $0x0,0x24a4
+ bac:	00 00 00 
+    }
+    for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ baf:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ bb2:	8b 00                	mov    (%eax),%eax
+ bb4:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        if(p->s.size >= nunits){
+ bb7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ bba:	8b 40 04             	mov    0x4(%eax),%eax
+ bbd:	3b 45 ec             	cmp    -0x14(%ebp),%eax
+ bc0:	72 4d                	jb     c0f <malloc+0xa6>
+            if(p->s.size == nunits)
+ bc2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ bc5:	8b 40 04             	mov    0x4(%eax),%eax
+ bc8:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+ bcb:	75 0c                	jne    bd9 <malloc+0x70>
+                prevp->s.ptr = p->s.ptr;
+ bcd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ bd0:	8b 10                	mov    (%eax),%edx
+ bd2:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ bd5:	89 10                	mov    %edx,(%eax)
+ bd7:	eb 26                	jmp    bff <malloc+0x96>
+            else {
+                p->s.size -= nunits;
+ bd9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ bdc:	8b 40 04             	mov    0x4(%eax),%eax
+ bdf:	2b 45 ec             	sub    -0x14(%ebp),%eax
+ be2:	89 c2                	mov    %eax,%edx
+ be4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ be7:	89 50 04             	mov    %edx,0x4(%eax)
+                p += p->s.size;
+ bea:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ bed:	8b 40 04             	mov    0x4(%eax),%eax
+ bf0:	c1 e0 03             	shl    $0x3,%eax
+ bf3:	01 45 f4             	add    %eax,-0xc(%ebp)
+                p->s.size = nunits;
+ bf6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ bf9:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ bfc:	89 50 04             	mov    %edx,0x4(%eax)
+            }
+            freep = prevp;
+ bff:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ c02:	a3 a8 24 00 00       	mov    %eax,0x24a8
+            return (void*)(p + 1);
+ c07:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ c0a:	83 c0 08             	add    $0x8,%eax
+ c0d:	eb 3b                	jmp    c4a <malloc+0xe1>
+        }
+        if(p == freep)
+ c0f:	a1 a8 24 00 00       	mov    0x24a8,%eax
+ c14:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ c17:	75 1e                	jne    c37 <malloc+0xce>
+            if((p = morecore(nunits)) == 0)
+ c19:	83 ec 0c             	sub    $0xc,%esp
+ c1c:	ff 75 ec             	push   -0x14(%ebp)
+ c1f:	e8 e5 fe ff ff       	call   b09 <morecore>
+ c24:	83 c4 10             	add    $0x10,%esp
+ c27:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ c2a:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ c2e:	75 07                	jne    c37 <malloc+0xce>
+                return 0;
+ c30:	b8 00 00 00 00       	mov    $0x0,%eax
+ c35:	eb 13                	jmp    c4a <malloc+0xe1>
+    for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ c37:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ c3a:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ c3d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ c40:	8b 00                	mov    (%eax),%eax
+ c42:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        if(p->s.size >= nunits){
+ c45:	e9 6d ff ff ff       	jmp    bb7 <malloc+0x4e>
+    }
+}
+ c4a:	c9                   	leave
+ c4b:	c3                   	ret
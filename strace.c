@@ -0,0 +1,81 @@
+// Trace system calls.
+//
+//    strace cmd [arg...]    run cmd, printing each call it and its
+//                           children make as it returns
+//    strace -p pid          trace process pid until it exits
+//
+// Each line shows the pid, the call, its first few argument words
+// in hex, its return value, and the TSC cycles it took.
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "sysstat.h"
+
+#define NREC 16
+
+struct sysstat names[NSYSCALL];
+struct stracerec recs[NREC];
+
+// Print the records of every traced process but skip, until
+// tracing stops.
+void
+follow(int skip)
+{
+    struct stracerec *r;
+    int i, j, n;
+
+    while((n = straceread(recs, NREC)) > 0){
+        for(i = 0; i < n; i++){
+            r = &recs[i];
+            if(r->pid == skip)
+                continue;
+            if(r->num < NSYSCALL && names[r->num].name[0])
+                printf(2, "%d %s(", r->pid, names[r->num].name);
+            else
+                printf(2, "%d sys%d(", r->pid, r->num);
+            for(j = 0; j < NSTRACEARG; j++)
+                printf(2, j ? ", %x" : "%x", r->arg[j]);
+            printf(2, ") = %d <%d>\n", r->ret, r->cycles);
+        }
+    }
+}
+
+int
+main(int argc, char *argv[])
+{
+    int pid;
+
+    if(argc < 2){
+        printf(2, "usage: strace cmd [arg...] | strace -p pid\n");
+        exit();
+    }
+    sysstat(SYSSTAT_READ, 0, names, NSYSCALL);
+
+    if(strcmp(argv[1], "-p") == 0){
+        if(argc < 3 || strace(atoi(argv[2]), 1) < 0){
+            printf(2, "strace: no process %s\n", argc < 3 ? "" : argv[2]);
+            exit();
+        }
+        follow(0);
+        exit();
+    }
+
+    // Trace ourselves across the fork, so the child is traced
+    // from its first call, then stop.
+    strace(0, 1);
+    pid = fork();
+    if(pid == 0){
+        exec(argv[1], argv + 1);
+        printf(2, "strace: exec %s failed\n", argv[1]);
+        exit();
+    }
+    strace(0, 0);
+    if(pid < 0){
+        printf(2, "strace: fork failed\n");
+        exit();
+    }
+    follow(getpid());
+    wait();
+    exit();
+}
@@ -0,0 +1,1484 @@
+
+_stressfs:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "fs.h"
+#include "fcntl.h"
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	51                   	push   %ecx
+   e:	81 ec 24 02 00 00    	sub    $0x224,%esp
+    int fd, i;
+    char path[] = "stressfs0";
+  14:	c7 45 e6 73 74 72 65 	movl   $0x65727473,-0x1a(%ebp)
+  1b:	c7 45 ea 73 73 66 73 	movl   $0x73667373,-0x16(%ebp)
+  22:	66 c7 45 ee 30 00    	movw   $0x30,-0x12(%ebp)
+    char data[512];
+
+    printf(1, "stressfs starting\n");
+  28:	83 ec 08             	sub    $0x8,%esp
+  2b:	68 11 0b 00 00       	push   $0xb11
+  30:	6a 01                	push   $0x1
+  32:	e8 23 07 00 00       	call   75a <printf>
+  37:	83 c4 10             	add    $0x10,%esp
+    memset(data, 'a', sizeof(data));
+  3a:	83 ec 04             	sub    $0x4,%esp
+  3d:	68 00 02 00 00       	push   $0x200
+  42:	6a 61                	push   $0x61
+  44:	8d 85 e6 fd ff ff    	lea    -0x21a(%ebp),%eax
+  4a:	50                   	push   %eax
+  4b:	e8 be 01 00 00       	call   20e <memset>
+  50:	83 c4 10             	add    $0x10,%esp
+
+    for(i = 0; i < 4; i++)
+  53:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  5a:	eb 0d                	jmp    69 <main+0x69>
+        if(fork() > 0)
+  5c:	e8 f4 03 00 00       	call   455 <fork>
+  61:	85 c0                	test   %eax,%eax
+  63:	7f 0c                	jg     71 <main+0x71>
+    for(i = 0; i < 4; i++)
+  65:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+  69:	83 7d f4 03          	cmpl   $0x3,-0xc(%ebp)
+  6d:	7e ed                	jle    5c <main+0x5c>
+  6f:	eb 01                	jmp    72 <main+0x72>
+            break;
+  71:	90                   	nop
+
+    printf(1, "write %d\n", i);
+  72:	83 ec 04             	sub    $0x4,%esp
+  75:	ff 75 f4             	push   -0xc(%ebp)
+  78:	68 24 0b 00 00       	push   $0xb24
+  7d:	6a 01                	push   $0x1
+  7f:	e8 d6 06 00 00       	call   75a <printf>
+  84:	83 c4 10             	add    $0x10,%esp
+
+    path[8] += i;
+  87:	0f b6 45 ee          	movzbl -0x12(%ebp),%eax
+  8b:	89 c2                	mov    %eax,%edx
+  8d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  90:	01 d0                	add    %edx,%eax
+  92:	88 45 ee             	mov    %al,-0x12(%ebp)
+    fd = open(path, O_CREATE | O_RDWR);
+  95:	83 ec 08             	sub    $0x8,%esp
+  98:	68 02 02 00 00       	push   $0x202
+  9d:	8d 45 e6             	lea    -0x1a(%ebp),%eax
+  a0:	50                   	push   %eax
+  a1:	e8 fd 03 00 00       	call   4a3 <open>
+  a6:	83 c4 10             	add    $0x10,%esp
+  a9:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    for(i = 0; i < 20; i++)
+  ac:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  b3:	eb 1e                	jmp    d3 <main+0xd3>
+//        printf(fd, "%d\n", i);
+        write(fd, data, sizeof(data));
+  b5:	83 ec 04             	sub    $0x4,%esp
+  b8:	68 00 02 00 00       	push   $0x200
+  bd:	8d 85 e6 fd ff ff    	lea    -0x21a(%ebp),%eax
+  c3:	50                   	push   %eax
+  c4:	ff 75 f0             	push   -0x10(%ebp)
+  c7:	e8 af 03 00 00       	call   47b <write>
+  cc:	83 c4 10             	add    $0x10,%esp
+    for(i = 0; i < 20; i++)
+  cf:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+  d3:	83 7d f4 13          	cmpl   $0x13,-0xc(%ebp)
+  d7:	7e dc                	jle    b5 <main+0xb5>
+    close(fd);
+  d9:	83 ec 0c             	sub    $0xc,%esp
+  dc:	ff 75 f0             	push   -0x10(%ebp)
+  df:	e8 a1 03 00 00       	call   485 <close>
+  e4:	83 c4 10             	add    $0x10,%esp
+
+    printf(1, "read\n");
+  e7:	83 ec 08             	sub    $0x8,%esp
+  ea:	68 2e 0b 00 00       	push   $0xb2e
+  ef:	6a 01                	push   $0x1
+  f1:	e8 64 06 00 00       	call   75a <printf>
+  f6:	83 c4 10             	add    $0x10,%esp
+
+    fd = open(path, O_RDONLY);
+  f9:	83 ec 08             	sub    $0x8,%esp
+  fc:	6a 00                	push   $0x0
+  fe:	8d 45 e6             	lea    -0x1a(%ebp),%eax
+ 101:	50                   	push   %eax
+ 102:	e8 9c 03 00 00       	call   4a3 <open>
+ 107:	83 c4 10             	add    $0x10,%esp
+ 10a:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    for (i = 0; i < 20; i++)
+ 10d:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 114:	eb 1e                	jmp    134 <main+0x134>
+        read(fd, data, sizeof(data));
+ 116:	83 ec 04             	sub    $0x4,%esp
+ 119:	68 00 02 00 00       	push   $0x200
+ 11e:	8d 85 e6 fd ff ff    	lea    -0x21a(%ebp),%eax
+ 124:	50                   	push   %eax
+ 125:	ff 75 f0             	push   -0x10(%ebp)
+ 128:	e8 44 03 00 00       	call   471 <read>
+ 12d:	83 c4 10             	add    $0x10,%esp
+    for (i = 0; i < 20; i++)
+ 130:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+ 134:	83 7d f4 13          	cmpl   $0x13,-0xc(%ebp)
+ 138:	7e dc                	jle    116 <main+0x116>
+    close(fd);
+ 13a:	83 ec 0c             	sub    $0xc,%esp
+ 13d:	ff 75 f0             	push   -0x10(%ebp)
+ 140:	e8 40 03 00 00       	call   485 <close>
+ 145:	83 c4 10             	add    $0x10,%esp
+
+    wait();
+ 148:	e8 16 03 00 00       	call   463 <wait>
+
+    exit();
+ 14d:	e8 0a 03 00 00       	call   45c <exit>
+
+00000152 <stosb>:
+strchr(const char *s, char c)
+{
+    for(; *s; s++)
+        if(*s == c)
+            return (char*)s;
+    return 0;
+ 152:	55                   	push   %ebp
+ 153:	89 e5                	mov    %esp,%ebp
+ 155:	57                   	push   %edi
+ 156:	53                   	push   %ebx
+}
+ 157:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 15a:	8b 55 10             	mov    0x10(%ebp),%edx
+ 15d:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 160:	89 cb                	mov    %ecx,%ebx
+ 162:	89 df                	mov    %ebx,%edi
+ 164:	89 d1                	mov    %edx,%ecx
+ 166:	fc                   	cld
+ 167:	f3 aa                	rep stos %al,%es:(%edi)
+ 169:	89 ca                	mov    %ecx,%edx
+ 16b:	89 fb                	mov    %edi,%ebx
+ 16d:	89 5d 08             	mov    %ebx,0x8(%ebp)
+ 170:	89 55 10             	mov    %edx,0x10(%ebp)
+
+char*
+gets(char *buf, int max)
+{
+ 173:	90                   	nop
+ 174:	5b                   	pop    %ebx
+ 175:	5f                   	pop    %edi
+ 176:	5d                   	pop    %ebp
+ 177:	c3                   	ret
+
+00000178 <strcpy>:
+{
+ 178:	55                   	push   %ebp
+ 179:	89 e5                	mov    %esp,%ebp
+ 17b:	83 ec 10             	sub    $0x10,%esp
+    os = s;
+ 17e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 181:	89 45 fc             	mov    %eax,-0x4(%ebp)
+    while((*s++ = *t++) != 0)
+ 184:	90                   	nop
+ 185:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 188:	8d 42 01             	lea    0x1(%edx),%eax
+ 18b:	89 45 0c             	mov    %eax,0xc(%ebp)
+ 18e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 191:	8d 48 01             	lea    0x1(%eax),%ecx
+ 194:	89 4d 08             	mov    %ecx,0x8(%ebp)
+ 197:	0f b6 12             	movzbl (%edx),%edx
+ 19a:	88 10                	mov    %dl,(%eax)
+ 19c:	0f b6 00             	movzbl (%eax),%eax
+ 19f:	84 c0                	test   %al,%al
+ 1a1:	75 e2                	jne    185 <strcpy+0xd>
+    return os;
+ 1a3:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 1a6:	c9                   	leave
+ 1a7:	c3                   	ret
+
+000001a8 <strcmp>:
+{
+ 1a8:	55                   	push   %ebp
+ 1a9:	89 e5                	mov    %esp,%ebp
+    while(*p && *p == *q)
+ 1ab:	eb 08                	jmp    1b5 <strcmp+0xd>
+        p++, q++;
+ 1ad:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 1b1:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+    while(*p && *p == *q)
+ 1b5:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1b8:	0f b6 00             	movzbl (%eax),%eax
+ 1bb:	84 c0                	test   %al,%al
+ 1bd:	74 10                	je     1cf <strcmp+0x27>
+ 1bf:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1c2:	0f b6 10             	movzbl (%eax),%edx
+ 1c5:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 1c8:	0f b6 00             	movzbl (%eax),%eax
+ 1cb:	38 c2                	cmp    %al,%dl
+ 1cd:	74 de                	je     1ad <strcmp+0x5>
+    return (uchar)*p - (uchar)*q;
+ 1cf:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1d2:	0f b6 00             	movzbl (%eax),%eax
+ 1d5:	0f b6 d0             	movzbl %al,%edx
+ 1d8:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 1db:	0f b6 00             	movzbl (%eax),%eax
+ 1de:	0f b6 c0             	movzbl %al,%eax
+ 1e1:	29 c2                	sub    %eax,%edx
+ 1e3:	89 d0                	mov    %edx,%eax
+}
+ 1e5:	5d                   	pop    %ebp
+ 1e6:	c3                   	ret
+
+000001e7 <strlen>:
+{
+ 1e7:	55                   	push   %ebp
+ 1e8:	89 e5                	mov    %esp,%ebp
+ 1ea:	83 ec 10             	sub    $0x10,%esp
+    for(n = 0; s[n]; n++)
+ 1ed:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ 1f4:	eb 04                	jmp    1fa <strlen+0x13>
+ 1f6:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 1fa:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 1fd:	8b 45 08             	mov    0x8(%ebp),%eax
+ 200:	01 d0                	add    %edx,%eax
+ 202:	0f b6 00             	movzbl (%eax),%eax
+ 205:	84 c0                	test   %al,%al
+ 207:	75 ed                	jne    1f6 <strlen+0xf>
+    return n;
+ 209:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 20c:	c9                   	leave
+ 20d:	c3                   	ret
+
+0000020e <memset>:
+{
+ 20e:	55                   	push   %ebp
+ 20f:	89 e5                	mov    %esp,%ebp
+    stosb(dst, c, n);
+ 211:	8b 45 10             	mov    0x10(%ebp),%eax
+ 214:	50                   	push   %eax
+ 215:	ff 75 0c             	push   0xc(%ebp)
+ 218:	ff 75 08             	push   0x8(%ebp)
+ 21b:	e8 32 ff ff ff       	call   152 <stosb>
+ 220:	83 c4 0c             	add    $0xc,%esp
+    return dst;
+ 223:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 226:	c9                   	leave
+ 227:	c3                   	ret
+
+00000228 <strchr>:
+{
+ 228:	55                   	push   %ebp
+ 229:	89 e5                	mov    %esp,%ebp
+ 22b:	83 ec 04             	sub    $0x4,%esp
+ 22e:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 231:	88 45 fc             	mov    %al,-0x4(%ebp)
+    for(; *s; s++)
+ 234:	eb 14                	jmp    24a <strchr+0x22>
+        if(*s == c)
+ 236:	8b 45 08             	mov    0x8(%ebp),%eax
+ 239:	0f b6 00             	movzbl (%eax),%eax
+ 23c:	38 45 fc             	cmp    %al,-0x4(%ebp)
+ 23f:	75 05                	jne    246 <strchr+0x1e>
+            return (char*)s;
+ 241:	8b 45 08             	mov    0x8(%ebp),%eax
+ 244:	eb 13                	jmp    259 <strchr+0x31>
+    for(; *s; s++)
+ 246:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 24a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 24d:	0f b6 00             	movzbl (%eax),%eax
+ 250:	84 c0                	test   %al,%al
+ 252:	75 e2                	jne    236 <strchr+0xe>
+    return 0;
+ 254:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 259:	c9                   	leave
+ 25a:	c3                   	ret
+
+0000025b <gets>:
+{
+ 25b:	55                   	push   %ebp
+ 25c:	89 e5                	mov    %esp,%ebp
+ 25e:	83 ec 18             	sub    $0x18,%esp
+    int i, cc;
+    char c;
+
+    for(i=0; i+1 < max; ){
+ 261:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 268:	eb 42                	jmp    2ac <gets+0x51>
+        cc = read(0, &c, 1);
+ 26a:	83 ec 04             	sub    $0x4,%esp
+ 26d:	6a 01                	push   $0x1
+ 26f:	8d 45 ef             	lea    -0x11(%ebp),%eax
+ 272:	50                   	push   %eax
+ 273:	6a 00                	push   $0x0
+ 275:	e8 f7 01 00 00       	call   471 <read>
+ 27a:	83 c4 10             	add    $0x10,%esp
+ 27d:	89 45 f0             	mov    %eax,-0x10(%ebp)
+        if(cc < 1)
+ 280:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 284:	7e 33                	jle    2b9 <gets+0x5e>
+            break;
+        buf[i++] = c;
+ 286:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 289:	8d 50 01             	lea    0x1(%eax),%edx
+ 28c:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 28f:	89 c2                	mov    %eax,%edx
+ 291:	8b 45 08             	mov    0x8(%ebp),%eax
+ 294:	01 c2                	add    %eax,%edx
+ 296:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 29a:	88 02                	mov    %al,(%edx)
+        if(c == '\n' || c == '\r')
+ 29c:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 2a0:	3c 0a                	cmp    $0xa,%al
+ 2a2:	74 16                	je     2ba <gets+0x5f>
+ 2a4:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 2a8:	3c 0d                	cmp    $0xd,%al
+ 2aa:	74 0e                	je     2ba <gets+0x5f>
+    for(i=0; i+1 < max; ){
+ 2ac:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 2af:	83 c0 01             	add    $0x1,%eax
+ 2b2:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 2b5:	7f b3                	jg     26a <gets+0xf>
+ 2b7:	eb 01                	jmp    2ba <gets+0x5f>
+            break;
+ 2b9:	90                   	nop
+            break;
+    }
+    buf[i] = '\0';
+ 2ba:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 2bd:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2c0:	01 d0                	add    %edx,%eax
+ 2c2:	c6 00 00             	movb   $0x0,(%eax)
+    return buf;
+ 2c5:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 2c8:	c9                   	leave
+ 2c9:	c3                   	ret
+
+000002ca <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 2ca:	55                   	push   %ebp
+ 2cb:	89 e5                	mov    %esp,%ebp
+ 2cd:	83 ec 18             	sub    $0x18,%esp
+    int fd;
+    int r;
+
+    fd = open(n, O_RDONLY);
+ 2d0:	83 ec 08             	sub    $0x8,%esp
+ 2d3:	6a 00                	push   $0x0
+ 2d5:	ff 75 08             	push   0x8(%ebp)
+ 2d8:	e8 c6 01 00 00       	call   4a3 <open>
+ 2dd:	83 c4 10             	add    $0x10,%esp
+ 2e0:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(fd < 0)
+ 2e3:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 2e7:	79 07                	jns    2f0 <stat+0x26>
+        return -1;
+ 2e9:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 2ee:	eb 25                	jmp    315 <stat+0x4b>
+    r = fstat(fd, st);
+ 2f0:	83 ec 08             	sub    $0x8,%esp
+ 2f3:	ff 75 0c             	push   0xc(%ebp)
+ 2f6:	ff 75 f4             	push   -0xc(%ebp)
+ 2f9:	e8 c3 01 00 00       	call   4c1 <fstat>
+ 2fe:	83 c4 10             	add    $0x10,%esp
+ 301:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    close(fd);
+ 304:	83 ec 0c             	sub    $0xc,%esp
+ 307:	ff 75 f4             	push   -0xc(%ebp)
+ 30a:	e8 76 01 00 00       	call   485 <close>
+ 30f:	83 c4 10             	add    $0x10,%esp
+    return r;
+ 312:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ 315:	c9                   	leave
+ 316:	c3                   	ret
+
+00000317 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 317:	55                   	push   %ebp
+ 318:	89 e5                	mov    %esp,%ebp
+ 31a:	83 ec 10             	sub    $0x10,%esp
+    int n;
+
+    n = 0;
+ 31d:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+    while('0' <= *s && *s <= '9')
+ 324:	eb 25                	jmp    34b <atoi+0x34>
+        n = n*10 + *s++ - '0';
+ 326:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 329:	89 d0                	mov    %edx,%eax
+ 32b:	c1 e0 02             	shl    $0x2,%eax
+ 32e:	01 d0                	add    %edx,%eax
+ 330:	01 c0                	add    %eax,%eax
+ 332:	89 c1                	mov    %eax,%ecx
+ 334:	8b 45 08             	mov    0x8(%ebp),%eax
+ 337:	8d 50 01             	lea    0x1(%eax),%edx
+ 33a:	89 55 08             	mov    %edx,0x8(%ebp)
+ 33d:	0f b6 00             	movzbl (%eax),%eax
+ 340:	0f be c0             	movsbl %al,%eax
+ 343:	01 c8                	add    %ecx,%eax
+ 345:	83 e8 30             	sub    $0x30,%eax
+ 348:	89 45 fc             	mov    %eax,-0x4(%ebp)
+    while('0' <= *s && *s <= '9')
+ 34b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 34e:	0f b6 00             	movzbl (%eax),%eax
+ 351:	3c 2f                	cmp    $0x2f,%al
+ 353:	7e 0a                	jle    35f <atoi+0x48>
+ 355:	8b 45 08             	mov    0x8(%ebp),%eax
+ 358:	0f b6 00             	movzbl (%eax),%eax
+ 35b:	3c 39                	cmp    $0x39,%al
+ 35d:	7e c7                	jle    326 <atoi+0xf>
+    return n;
+ 35f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 362:	c9                   	leave
+ 363:	c3                   	ret
+
+00000364 <nice>:
+
+// Add inc to the caller's nice value; return the new value.
+int
+nice(int inc)
+{
+ 364:	55                   	push   %ebp
+ 365:	89 e5                	mov    %esp,%ebp
+ 367:	83 ec 18             	sub    $0x18,%esp
+    int n;
+
+    n = getpriority(0) + inc;
+ 36a:	83 ec 0c             	sub    $0xc,%esp
+ 36d:	6a 00                	push   $0x0
+ 36f:	e8 d9 01 00 00       	call   54d <getpriority>
+ 374:	83 c4 10             	add    $0x10,%esp
+ 377:	8b 55 08             	mov    0x8(%ebp),%edx
+ 37a:	01 d0                	add    %edx,%eax
+ 37c:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(n < 0)
+ 37f:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 383:	79 07                	jns    38c <nice+0x28>
+        n = 0;
+ 385:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    if(n > NICEMAX)
+ 38c:	83 7d f4 13          	cmpl   $0x13,-0xc(%ebp)
+ 390:	7e 07                	jle    399 <nice+0x35>
+        n = NICEMAX;
+ 392:	c7 45 f4 13 00 00 00 	movl   $0x13,-0xc(%ebp)
+    if(setpriority(0, n) < 0)
+ 399:	83 ec 08             	sub    $0x8,%esp
+ 39c:	ff 75 f4             	push   -0xc(%ebp)
+ 39f:	6a 00                	push   $0x0
+ 3a1:	e8 b1 01 00 00       	call   557 <setpriority>
+ 3a6:	83 c4 10             	add    $0x10,%esp
+ 3a9:	85 c0                	test   %eax,%eax
+ 3ab:	79 07                	jns    3b4 <nice+0x50>
+        return -1;
+ 3ad:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 3b2:	eb 03                	jmp    3b7 <nice+0x53>
+    return n;
+ 3b4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+ 3b7:	c9                   	leave
+ 3b8:	c3                   	ret
+
+000003b9 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 3b9:	55                   	push   %ebp
+ 3ba:	89 e5                	mov    %esp,%ebp
+ 3bc:	83 ec 10             	sub    $0x10,%esp
+    char *dst;
+    const char *src;
+
+    dst = vdst;
+ 3bf:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3c2:	89 45 fc             	mov    %eax,-0x4(%ebp)
+    src = vsrc;
+ 3c5:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 3c8:	89 45 f8             	mov    %eax,-0x8(%ebp)
+    while(n-- > 0)
+ 3cb:	eb 17                	jmp    3e4 <memmove+0x2b>
+        *dst++ = *src++;
+ 3cd:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 3d0:	8d 42 01             	lea    0x1(%edx),%eax
+ 3d3:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 3d6:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 3d9:	8d 48 01             	lea    0x1(%eax),%ecx
+ 3dc:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+ 3df:	0f b6 12             	movzbl (%edx),%edx
+ 3e2:	88 10                	mov    %dl,(%eax)
+    while(n-- > 0)
+ 3e4:	8b 45 10             	mov    0x10(%ebp),%eax
+ 3e7:	8d 50 ff             	lea    -0x1(%eax),%edx
+ 3ea:	89 55 10             	mov    %edx,0x10(%ebp)
+ 3ed:	85 c0                	test   %eax,%eax
+ 3ef:	7f dc                	jg     3cd <memmove+0x14>
+    return vdst;
+ 3f1:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 3f4:	c9                   	leave
+ 3f5:	c3                   	ret
+
+000003f6 <dosyscall>:
+sysmode:
+    .long 0
+
+    .text
+dosyscall:
+    cmpl $0, sysmode
+ 3f6:	83 3d a0 0d 00 00 00 	cmpl   $0x0,0xda0
+    jg 2f
+ 3fd:	7f 0c                	jg     40b <dosyscall+0x15>
+    jl 1f
+ 3ff:	7c 07                	jl     408 <dosyscall+0x12>
+    call sepcheck
+ 401:	e8 27 00 00 00       	call   42d <sepcheck>
+    jmp dosyscall
+ 406:	eb ee                	jmp    3f6 <dosyscall>
+1:
+    int $T_SYSCALL
+ 408:	cd 40                	int    $0x40
+    ret
+ 40a:	c3                   	ret
+2:
+    pushl %ebx
+ 40b:	53                   	push   %ebx
+    pushl %esi
+ 40c:	56                   	push   %esi
+    pushl %edi
+ 40d:	57                   	push   %edi
+    pushl %ebp
+ 40e:	55                   	push   %ebp
+    movl 20(%esp), %ebx
+ 40f:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+    movl 24(%esp), %esi
+ 413:	8b 74 24 18          	mov    0x18(%esp),%esi
+    movl 28(%esp), %edi
+ 417:	8b 7c 24 1c          	mov    0x1c(%esp),%edi
+    movl 32(%esp), %ebp
+ 41b:	8b 6c 24 20          	mov    0x20(%esp),%ebp
+    movl %esp, %ecx
+ 41f:	89 e1                	mov    %esp,%ecx
+    movl $3f, %edx
+ 421:	ba 28 04 00 00       	mov    $0x428,%edx
+    sysenter
+ 426:	0f 34                	sysenter
+3:
+    popl %ebp
+ 428:	5d                   	pop    %ebp
+    popl %edi
+ 429:	5f                   	pop    %edi
+    popl %esi
+ 42a:	5e                   	pop    %esi
+    popl %ebx
+ 42b:	5b                   	pop    %ebx
+    ret
+ 42c:	c3                   	ret
+
+0000042d <sepcheck>:
+
+# Set sysmode from cpuid's SEP flag.    Preserves %eax.
+sepcheck:
+    pushl %eax
+ 42d:	50                   	push   %eax
+    pushl %ebx
+ 42e:	53                   	push   %ebx
+    movl $1, %eax
+ 42f:	b8 01 00 00 00       	mov    $0x1,%eax
+    cpuid
+ 434:	0f a2                	cpuid
+    movl $-1, sysmode
+ 436:	c7 05 a0 0d 00 00 ff 	movl   $0xffffffff,0xda0
+ 43d:	ff ff ff 
+    testl $0x800, %edx
+ 440:	f7 c2 00 08 00 00    	test   $0x800,%edx
+    jz 1f
+ 446:	74 0a                	je     452 <sepcheck+0x25>
+    movl $1, sysmode
+ 448:	c7 05 a0 0d 00 00 01 	movl   $0x1,0xda0
+ 44f:	00 00 00 
+1:
+    popl %ebx
+ 452:	5b                   	pop    %ebx
+    popl %eax
+ 453:	58                   	pop    %eax
+    ret
+ 454:	c3                   	ret
+
+00000455 <fork>:
+
+SYSCALL(fork)
+ 455:	b8 01 00 00 00       	mov    $0x1,%eax
+ 45a:	eb 9a                	jmp    3f6 <dosyscall>
+
+0000045c <exit>:
+SYSCALL(exit)
+ 45c:	b8 02 00 00 00       	mov    $0x2,%eax
+ 461:	eb 93                	jmp    3f6 <dosyscall>
+
+00000463 <wait>:
+SYSCALL(wait)
+ 463:	b8 03 00 00 00       	mov    $0x3,%eax
+ 468:	eb 8c                	jmp    3f6 <dosyscall>
+
+0000046a <pipe>:
+SYSCALL(pipe)
+ 46a:	b8 04 00 00 00       	mov    $0x4,%eax
+ 46f:	eb 85                	jmp    3f6 <dosyscall>
+
+00000471 <read>:
+SYSCALL(read)
+ 471:	b8 05 00 00 00       	mov    $0x5,%eax
+ 476:	e9 7b ff ff ff       	jmp    3f6 <dosyscall>
+
+0000047b <write>:
+SYSCALL(write)
+ 47b:	b8 10 00 00 00       	mov    $0x10,%eax
+ 480:	e9 71 ff ff ff       	jmp    3f6 <dosyscall>
+
+00000485 <close>:
+SYSCALL(close)
+ 485:	b8 15 00 00 00       	mov    $0x15,%eax
+ 48a:	e9 67 ff ff ff       	jmp    3f6 <dosyscall>
+
+0000048f <kill>:
+SYSCALL(kill)
+ 48f:	b8 06 00 00 00       	mov    $0x6,%eax
+ 494:	e9 5d ff ff ff       	jmp    3f6 <dosyscall>
+
+00000499 <exec>:
+SYSCALL(exec)
+ 499:	b8 07 00 00 00       	mov    $0x7,%eax
+ 49e:	e9 53 ff ff ff       	jmp    3f6 <dosyscall>
+
+000004a3 <open>:
+SYSCALL(open)
+ 4a3:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 4a8:	e9 49 ff ff ff       	jmp    3f6 <dosyscall>
+
+000004ad <mknod>:
+SYSCALL(mknod)
+ 4ad:	b8 11 00 00 00       	mov    $0x11,%eax
+ 4b2:	e9 3f ff ff ff       	jmp    3f6 <dosyscall>
+
+000004b7 <unlink>:
+SYSCALL(unlink)
+ 4b7:	b8 12 00 00 00       	mov    $0x12,%eax
+ 4bc:	e9 35 ff ff ff       	jmp    3f6 <dosyscall>
+
+000004c1 <fstat>:
+SYSCALL(fstat)
+ 4c1:	b8 08 00 00 00       	mov    $0x8,%eax
+ 4c6:	e9 2b ff ff ff       	jmp    3f6 <dosyscall>
+
+000004cb <link>:
+SYSCALL(link)
+ 4cb:	b8 13 00 00 00       	mov    $0x13,%eax
+ 4d0:	e9 21 ff ff ff       	jmp    3f6 <dosyscall>
+
+000004d5 <mkdir>:
+SYSCALL(mkdir)
+ 4d5:	b8 14 00 00 00       	mov    $0x14,%eax
+ 4da:	e9 17 ff ff ff       	jmp    3f6 <dosyscall>
+
+000004df <chdir>:
+SYSCALL(chdir)
+ 4df:	b8 09 00 00 00       	mov    $0x9,%eax
+ 4e4:	e9 0d ff ff ff       	jmp    3f6 <dosyscall>
+
+000004e9 <dup>:
+SYSCALL(dup)
+ 4e9:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 4ee:	e9 03 ff ff ff       	jmp    3f6 <dosyscall>
+
+000004f3 <getpid>:
+SYSCALL(getpid)
+ 4f3:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 4f8:	e9 f9 fe ff ff       	jmp    3f6 <dosyscall>
+
+000004fd <sbrk>:
+SYSCALL(sbrk)
+ 4fd:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 502:	e9 ef fe ff ff       	jmp    3f6 <dosyscall>
+
+00000507 <sleep>:
+SYSCALL(sleep)
+ 507:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 50c:	e9 e5 fe ff ff       	jmp    3f6 <dosyscall>
+
+00000511 <uptime>:
+SYSCALL(uptime)
+ 511:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 516:	e9 db fe ff ff       	jmp    3f6 <dosyscall>
+
+0000051b <date>:
+SYSCALL(date)
+ 51b:	b8 16 00 00 00       	mov    $0x16,%eax
+ 520:	e9 d1 fe ff ff       	jmp    3f6 <dosyscall>
+
+00000525 <dup2>:
+SYSCALL(dup2)
+ 525:	b8 17 00 00 00       	mov    $0x17,%eax
+ 52a:	e9 c7 fe ff ff       	jmp    3f6 <dosyscall>
+
+0000052f <uffd>:
+SYSCALL(uffd)
+ 52f:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 534:	e9 bd fe ff ff       	jmp    3f6 <dosyscall>
+
+00000539 <uffdregister>:
+SYSCALL(uffdregister)
+ 539:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 53e:	e9 b3 fe ff ff       	jmp    3f6 <dosyscall>
+
+00000543 <uffdcopy>:
+SYSCALL(uffdcopy)
+ 543:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 548:	e9 a9 fe ff ff       	jmp    3f6 <dosyscall>
+
+0000054d <getpriority>:
+SYSCALL(getpriority)
+ 54d:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 552:	e9 9f fe ff ff       	jmp    3f6 <dosyscall>
+
+00000557 <setpriority>:
+SYSCALL(setpriority)
+ 557:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 55c:	e9 95 fe ff ff       	jmp    3f6 <dosyscall>
+
+00000561 <setweight>:
+SYSCALL(setweight)
+ 561:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 566:	e9 8b fe ff ff       	jmp    3f6 <dosyscall>
+
+0000056b <setgroup>:
+SYSCALL(setgroup)
+ 56b:	b8 20 00 00 00       	mov    $0x20,%eax
+ 570:	e9 81 fe ff ff       	jmp    3f6 <dosyscall>
+
+00000575 <schedinfo>:
+SYSCALL(schedinfo)
+ 575:	b8 21 00 00 00       	mov    $0x21,%eax
+ 57a:	e9 77 fe ff ff       	jmp    3f6 <dosyscall>
+
+0000057f <nanosleep>:
+SYSCALL(nanosleep)
+ 57f:	b8 22 00 00 00       	mov    $0x22,%eax
+ 584:	e9 6d fe ff ff       	jmp    3f6 <dosyscall>
+
+00000589 <clock_nanosleep>:
+SYSCALL(clock_nanosleep)
+ 589:	b8 23 00 00 00       	mov    $0x23,%eax
+ 58e:	e9 63 fe ff ff       	jmp    3f6 <dosyscall>
+
+00000593 <clock_gettime>:
+SYSCALL(clock_gettime)
+ 593:	b8 24 00 00 00       	mov    $0x24,%eax
+ 598:	e9 59 fe ff ff       	jmp    3f6 <dosyscall>
+
+0000059d <sched_setaffinity>:
+SYSCALL(sched_setaffinity)
+ 59d:	b8 25 00 00 00       	mov    $0x25,%eax
+ 5a2:	e9 4f fe ff ff       	jmp    3f6 <dosyscall>
+
+000005a7 <sched_getaffinity>:
+SYSCALL(sched_getaffinity)
+ 5a7:	b8 26 00 00 00       	mov    $0x26,%eax
+ 5ac:	e9 45 fe ff ff       	jmp    3f6 <dosyscall>
+
+000005b1 <irqaffinity>:
+SYSCALL(irqaffinity)
+ 5b1:	b8 27 00 00 00       	mov    $0x27,%eax
+ 5b6:	e9 3b fe ff ff       	jmp    3f6 <dosyscall>
+
+000005bb <getrusage>:
+SYSCALL(getrusage)
+ 5bb:	b8 28 00 00 00       	mov    $0x28,%eax
+ 5c0:	e9 31 fe ff ff       	jmp    3f6 <dosyscall>
+
+000005c5 <times>:
+SYSCALL(times)
+ 5c5:	b8 29 00 00 00       	mov    $0x29,%eax
+ 5ca:	e9 27 fe ff ff       	jmp    3f6 <dosyscall>
+
+000005cf <schedlat>:
+SYSCALL(schedlat)
+ 5cf:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 5d4:	e9 1d fe ff ff       	jmp    3f6 <dosyscall>
+
+000005d9 <sched_setscheduler>:
+SYSCALL(sched_setscheduler)
+ 5d9:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 5de:	e9 13 fe ff ff       	jmp    3f6 <dosyscall>
+
+000005e3 <sched_getscheduler>:
+SYSCALL(sched_getscheduler)
+ 5e3:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 5e8:	e9 09 fe ff ff       	jmp    3f6 <dosyscall>
+
+000005ed <sched_getparam>:
+SYSCALL(sched_getparam)
+ 5ed:	b8 2d 00 00 00       	mov    $0x2d,%eax
+ 5f2:	e9 ff fd ff ff       	jmp    3f6 <dosyscall>
+
+000005f7 <lockstat>:
+SYSCALL(lockstat)
+ 5f7:	b8 2e 00 00 00       	mov    $0x2e,%eax
+ 5fc:	e9 f5 fd ff ff       	jmp    3f6 <dosyscall>
+
+00000601 <ioring_setup>:
+SYSCALL(ioring_setup)
+ 601:	b8 2f 00 00 00       	mov    $0x2f,%eax
+ 606:	e9 eb fd ff ff       	jmp    3f6 <dosyscall>
+
+0000060b <ioring_enter>:
+SYSCALL(ioring_enter)
+ 60b:	b8 30 00 00 00       	mov    $0x30,%eax
+ 610:	e9 e1 fd ff ff       	jmp    3f6 <dosyscall>
+
+00000615 <readv>:
+SYSCALL(readv)
+ 615:	b8 31 00 00 00       	mov    $0x31,%eax
+ 61a:	e9 d7 fd ff ff       	jmp    3f6 <dosyscall>
+
+0000061f <writev>:
+SYSCALL(writev)
+ 61f:	b8 32 00 00 00       	mov    $0x32,%eax
+ 624:	e9 cd fd ff ff       	jmp    3f6 <dosyscall>
+
+00000629 <pread>:
+SYSCALL(pread)
+ 629:	b8 33 00 00 00       	mov    $0x33,%eax
+ 62e:	e9 c3 fd ff ff       	jmp    3f6 <dosyscall>
+
+00000633 <pwrite>:
+SYSCALL(pwrite)
+ 633:	b8 34 00 00 00       	mov    $0x34,%eax
+ 638:	e9 b9 fd ff ff       	jmp    3f6 <dosyscall>
+
+0000063d <sendfile>:
+SYSCALL(sendfile)
+ 63d:	b8 35 00 00 00       	mov    $0x35,%eax
+ 642:	e9 af fd ff ff       	jmp    3f6 <dosyscall>
+
+00000647 <splice>:
+SYSCALL(splice)
+ 647:	b8 36 00 00 00       	mov    $0x36,%eax
+ 64c:	e9 a5 fd ff ff       	jmp    3f6 <dosyscall>
+
+00000651 <sysstat>:
+SYSCALL(sysstat)
+ 651:	b8 37 00 00 00       	mov    $0x37,%eax
+ 656:	e9 9b fd ff ff       	jmp    3f6 <dosyscall>
+
+0000065b <strace>:
+SYSCALL(strace)
+ 65b:	b8 38 00 00 00       	mov    $0x38,%eax
+ 660:	e9 91 fd ff ff       	jmp    3f6 <dosyscall>
+
+00000665 <straceread>:
+SYSCALL(straceread)
+ 665:	b8 39 00 00 00       	mov    $0x39,%eax
+ 66a:	e9 87 fd ff ff       	jmp    3f6 <dosyscall>
+
+0000066f <alarm>:
+
+# alarm and rstoregs keep to int $T_SYSCALL: rstoregs restores
+# %ecx and %edx, which sysexit would clobber.
+.globl alarm
+    alarm:
+        pushl $rstoregs
+ 66f:	68 7f 06 00 00       	push   $0x67f
+        movl $SYS_alarm, %eax
+ 674:	b8 18 00 00 00       	mov    $0x18,%eax
+        int $T_SYSCALL
+ 679:	cd 40                	int    $0x40
+        add $0x04, %esp
+ 67b:	83 c4 04             	add    $0x4,%esp
+        ret
+ 67e:	c3                   	ret
+
+0000067f <rstoregs>:
+
+.globl rstoregs
+    rstoregs:
+        movl $SYS_rstoregs, %eax
+ 67f:	b8 19 00 00 00       	mov    $0x19,%eax
+        int $T_SYSCALL
+ 684:	cd 40                	int    $0x40
+
+00000686 <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 686:	55                   	push   %ebp
+ 687:	89 e5                	mov    %esp,%ebp
+ 689:	83 ec 18             	sub    $0x18,%esp
+ 68c:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 68f:	88 45 f4             	mov    %al,-0xc(%ebp)
+    write(fd, &c, 1);
+ 692:	83 ec 04             	sub    $0x4,%esp
+ 695:	6a 01                	push   $0x1
+ 697:	8d 45 f4             	lea    -0xc(%ebp),%eax
+ 69a:	50                   	push   %eax
+ 69b:	ff 75 08             	push   0x8(%ebp)
+ 69e:	e8 d8 fd ff ff       	call   47b <write>
+ 6a3:	83 c4 10             	add    $0x10,%esp
+}
+ 6a6:	90                   	nop
+ 6a7:	c9                   	leave
+ 6a8:	c3                   	ret
+
+000006a9 <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 6a9:	55                   	push   %ebp
+ 6aa:	89 e5                	mov    %esp,%ebp
+ 6ac:	83 ec 28             	sub    $0x28,%esp
+    static char digits[] = "0123456789ABCDEF";
+    char buf[16];
+    int i, neg;
+    uint x;
+
+    neg = 0;
+ 6af:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+    if(sgn && xx < 0){
+ 6b6:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+ 6ba:	74 17                	je     6d3 <printint+0x2a>
+ 6bc:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 6c0:	79 11                	jns    6d3 <printint+0x2a>
+        neg = 1;
+ 6c2:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+        x = -xx;
+ 6c9:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 6cc:	f7 d8                	neg    %eax
+ 6ce:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 6d1:	eb 06                	jmp    6d9 <printint+0x30>
+    } else {
+        x = xx;
+ 6d3:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 6d6:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    }
+
+    i = 0;
+ 6d9:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    do{
+        buf[i++] = digits[x % base];
+ 6e0:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 6e3:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 6e6:	ba 00 00 00 00       	mov    $0x0,%edx
+ 6eb:	f7 f1                	div    %ecx
+ 6ed:	89 d1                	mov    %edx,%ecx
+ 6ef:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 6f2:	8d 50 01             	lea    0x1(%eax),%edx
+ 6f5:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 6f8:	0f b6 91 a4 0d 00 00 	movzbl 0xda4(%ecx),%edx
+ 6ff:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+    }while((x /= base) != 0);
+ 703:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 706:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 709:	ba 00 00 00 00       	mov    $0x0,%edx
+ 70e:	f7 f1                	div    %ecx
+ 710:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 713:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 717:	75 c7                	jne    6e0 <printint+0x37>
+    if(neg)
+ 719:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 71d:	74 2d                	je     74c <printint+0xa3>
+        buf[i++] = '-';
+ 71f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 722:	8d 50 01             	lea    0x1(%eax),%edx
+ 725:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 728:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+    while(--i >= 0)
+ 72d:	eb 1d                	jmp    74c <printint+0xa3>
+        putc(fd, buf[i]);
+ 72f:	8d 55 dc             	lea    -0x24(%ebp),%edx
+ 732:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 735:	01 d0                	add    %edx,%eax
+ 737:	0f b6 00             	movzbl (%eax),%eax
+ 73a:	0f be c0             	movsbl %al,%eax
+ 73d:	83 ec 08             	sub    $0x8,%esp
+ 740:	50                   	push   %eax
+ 741:	ff 75 08             	push   0x8(%ebp)
+ 744:	e8 3d ff ff ff       	call   686 <putc>
+ 749:	83 c4 10             	add    $0x10,%esp
+    while(--i >= 0)
+ 74c:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+ 750:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 754:	79 d9                	jns    72f <printint+0x86>
+}
+ 756:	90                   	nop
+ 757:	90                   	nop
+ 758:	c9                   	leave
+ 759:	c3                   	ret
+
+0000075a <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 75a:	55                   	push   %ebp
+ 75b:	89 e5                	mov    %esp,%ebp
+ 75d:	83 ec 28             	sub    $0x28,%esp
+    char *s;
+    int c, i, state;
+    uint *ap;
+
+    state = 0;
+ 760:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+    ap = (uint*)(void*)&fmt + 1;
+ 767:	8d 45 0c             	lea    0xc(%ebp),%eax
+ 76a:	83 c0 04             	add    $0x4,%eax
+ 76d:	89 45 e8             	mov    %eax,-0x18(%ebp)
+    for(i = 0; fmt[i]; i++){
+ 770:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 777:	e9 59 01 00 00       	jmp    8d5 <printf+0x17b>
+        c = fmt[i] & 0xff;
+ 77c:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 77f:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 782:	01 d0                	add    %edx,%eax
+ 784:	0f b6 00             	movzbl (%eax),%eax
+ 787:	0f be c0             	movsbl %al,%eax
+ 78a:	25 ff 00 00 00       	and    $0xff,%eax
+ 78f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        if(state == 0){
+ 792:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 796:	75 2c                	jne    7c4 <printf+0x6a>
+            if(c == '%'){
+ 798:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 79c:	75 0c                	jne    7aa <printf+0x50>
+                state = '%';
+ 79e:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+ 7a5:	e9 27 01 00 00       	jmp    8d1 <printf+0x177>
+            } else {
+                putc(fd, c);
+ 7aa:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 7ad:	0f be c0             	movsbl %al,%eax
+ 7b0:	83 ec 08             	sub    $0x8,%esp
+ 7b3:	50                   	push   %eax
+ 7b4:	ff 75 08             	push   0x8(%ebp)
+ 7b7:	e8 ca fe ff ff       	call   686 <putc>
+ 7bc:	83 c4 10             	add    $0x10,%esp
+ 7bf:	e9 0d 01 00 00       	jmp    8d1 <printf+0x177>
+            }
+        } else if(state == '%'){
+ 7c4:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+ 7c8:	0f 85 03 01 00 00    	jne    8d1 <printf+0x177>
+            if(c == 'd'){
+ 7ce:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+ 7d2:	75 1e                	jne    7f2 <printf+0x98>
+                printint(fd, *ap, 10, 1);
+ 7d4:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 7d7:	8b 00                	mov    (%eax),%eax
+ 7d9:	6a 01                	push   $0x1
+ 7db:	6a 0a                	push   $0xa
+ 7dd:	50                   	push   %eax
+ 7de:	ff 75 08             	push   0x8(%ebp)
+ 7e1:	e8 c3 fe ff ff       	call   6a9 <printint>
+ 7e6:	83 c4 10             	add    $0x10,%esp
+                ap++;
+ 7e9:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 7ed:	e9 d8 00 00 00       	jmp    8ca <printf+0x170>
+            } else if(c == 'x' || c == 'p'){
+ 7f2:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+ 7f6:	74 06                	je     7fe <printf+0xa4>
+ 7f8:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+ 7fc:	75 1e                	jne    81c <printf+0xc2>
+                printint(fd, *ap, 16, 0);
+ 7fe:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 801:	8b 00                	mov    (%eax),%eax
+ 803:	6a 00                	push   $0x0
+ 805:	6a 10                	push   $0x10
+ 807:	50                   	push   %eax
+ 808:	ff 75 08             	push   0x8(%ebp)
+ 80b:	e8 99 fe ff ff       	call   6a9 <printint>
+ 810:	83 c4 10             	add    $0x10,%esp
+                ap++;
+ 813:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 817:	e9 ae 00 00 00       	jmp    8ca <printf+0x170>
+            } else if(c == 's'){
+ 81c:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+ 820:	75 43                	jne    865 <printf+0x10b>
+                s = (char*)*ap;
+ 822:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 825:	8b 00                	mov    (%eax),%eax
+ 827:	89 45 f4             	mov    %eax,-0xc(%ebp)
+                ap++;
+ 82a:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+                if(s == 0)
+ 82e:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 832:	75 25                	jne    859 <printf+0xff>
+                    s = "(null)";
+ 834:	c7 45 f4 34 0b 00 00 	movl   $0xb34,-0xc(%ebp)
+                while(*s != 0){
+ 83b:	eb 1c                	jmp    859 <printf+0xff>
+                    putc(fd, *s);
+ 83d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 840:	0f b6 00             	movzbl (%eax),%eax
+ 843:	0f be c0             	movsbl %al,%eax
+ 846:	83 ec 08             	sub    $0x8,%esp
+ 849:	50                   	push   %eax
+ 84a:	ff 75 08             	push   0x8(%ebp)
+ 84d:	e8 34 fe ff ff       	call   686 <putc>
+ 852:	83 c4 10             	add    $0x10,%esp
+                    s++;
+ 855:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+                while(*s != 0){
+ 859:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 85c:	0f b6 00             	movzbl (%eax),%eax
+ 85f:	84 c0                	test   %al,%al
+ 861:	75 da                	jne    83d <printf+0xe3>
+ 863:	eb 65                	jmp    8ca <printf+0x170>
+                }
+            } else if(c == 'c'){
+ 865:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+ 869:	75 1d                	jne    888 <printf+0x12e>
+                putc(fd, *ap);
+ 86b:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 86e:	8b 00                	mov    (%eax),%eax
+ 870:	0f be c0             	movsbl %al,%eax
+ 873:	83 ec 08             	sub    $0x8,%esp
+ 876:	50                   	push   %eax
+ 877:	ff 75 08             	push   0x8(%ebp)
+ 87a:	e8 07 fe ff ff       	call   686 <putc>
+ 87f:	83 c4 10             	add    $0x10,%esp
+                ap++;
+ 882:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 886:	eb 42                	jmp    8ca <printf+0x170>
+            } else if(c == '%'){
+ 888:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 88c:	75 17                	jne    8a5 <printf+0x14b>
+                putc(fd, c);
+ 88e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 891:	0f be c0             	movsbl %al,%eax
+ 894:	83 ec 08             	sub    $0x8,%esp
+ 897:	50                   	push   %eax
+ 898:	ff 75 08             	push   0x8(%ebp)
+ 89b:	e8 e6 fd ff ff       	call   686 <putc>
+ 8a0:	83 c4 10             	add    $0x10,%esp
+ 8a3:	eb 25                	jmp    8ca <printf+0x170>
+            } else {
+                // Unknown % sequence.    Print it to draw attention.
+                putc(fd, '%');
+ 8a5:	83 ec 08             	sub    $0x8,%esp
+ 8a8:	6a 25                	push   $0x25
+ 8aa:	ff 75 08             	push   0x8(%ebp)
+ 8ad:	e8 d4 fd ff ff       	call   686 <putc>
+ 8b2:	83 c4 10             	add    $0x10,%esp
+                putc(fd, c);
+ 8b5:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 8b8:	0f be c0             	movsbl %al,%eax
+ 8bb:	83 ec 08             	sub    $0x8,%esp
+ 8be:	50                   	push   %eax
+ 8bf:	ff 75 08             	push   0x8(%ebp)
+ 8c2:	e8 bf fd ff ff       	call   686 <putc>
+ 8c7:	83 c4 10             	add    $0x10,%esp
+            }
+            state = 0;
+ 8ca:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+    for(i = 0; fmt[i]; i++){
+ 8d1:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ 8d5:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 8d8:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 8db:	01 d0                	add    %edx,%eax
+ 8dd:	0f b6 00             	movzbl (%eax),%eax
+ 8e0:	84 c0                	test   %al,%al
+ 8e2:	0f 85 94 fe ff ff    	jne    77c <printf+0x22>
+        }
+    }
+}
+ 8e8:	90                   	nop
+ 8e9:	90                   	nop
+ 8ea:	c9                   	leave
+ 8eb:	c3                   	ret
+
+000008ec <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 8ec:	55                   	push   %ebp
+ 8ed:	89 e5                	mov    %esp,%ebp
+ 8ef:	83 ec 10             	sub    $0x10,%esp
+    Header *bp, *p;
+
+    bp = (Header*)ap - 1;
+ 8f2:	8b 45 08             	mov    0x8(%ebp),%eax
+ 8f5:	83 e8 08             	sub    $0x8,%eax
+ 8f8:	89 45 f8             	mov    %eax,-0x8(%ebp)
+    for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 8fb:	a1 c0 0d 00 00       	mov    0xdc0,%eax
+ 900:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 903:	eb 24                	jmp    929 <free+0x3d>
+        if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 905:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 908:	8b 00                	mov    (%eax),%eax
+ 90a:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 90d:	72 12                	jb     921 <free+0x35>
+ 90f:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 912:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 915:	72 24                	jb     93b <free+0x4f>
+ 917:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 91a:	8b 00                	mov    (%eax),%eax
+ 91c:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 91f:	72 1a                	jb     93b <free+0x4f>
+    for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 921:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 924:	8b 00                	mov    (%eax),%eax
+ 926:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 929:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 92c:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 92f:	73 d4                	jae    905 <free+0x19>
+ 931:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 934:	8b 00                	mov    (%eax),%eax
+ 936:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 939:	73 ca                	jae    905 <free+0x19>
+            break;
+    if(bp + bp->s.size == p->s.ptr){
+ 93b:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 93e:	8b 40 04             	mov    0x4(%eax),%eax
+ 941:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 948:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 94b:	01 c2                	add    %eax,%edx
+ 94d:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 950:	8b 00                	mov    (%eax),%eax
+ 952:	39 c2                	cmp    %eax,%edx
+ 954:	75 24                	jne    97a <free+0x8e>
+        bp->s.size += p->s.ptr->s.size;
+ 956:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 959:	8b 50 04             	mov    0x4(%eax),%edx
+ 95c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 95f:	8b 00                	mov    (%eax),%eax
+ 961:	8b 40 04             	mov    0x4(%eax),%eax
+ 964:	01 c2                	add    %eax,%edx
+ 966:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 969:	89 50 04             	mov    %edx,0x4(%eax)
+        bp->s.ptr = p->s.ptr->s.ptr;
+ 96c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 96f:	8b 00                	mov    (%eax),%eax
+ 971:	8b 10                	mov    (%eax),%edx
+ 973:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 976:	89 10                	mov    %edx,(%eax)
+ 978:	eb 0a                	jmp    984 <free+0x98>
+    } else
+        bp->s.ptr = p->s.ptr;
+ 97a:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 97d:	8b 10                	mov    (%eax),%edx
+ 97f:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 982:	89 10                	mov    %edx,(%eax)
+    if(p + p->s.size == bp){
+ 984:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 987:	8b 40 04             	mov    0x4(%eax),%eax
+ 98a:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 991:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 994:	01 d0                	add    %edx,%eax
+ 996:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 999:	75 20                	jne    9bb <free+0xcf>
+        p->s.size += bp->s.size;
+ 99b:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 99e:	8b 50 04             	mov    0x4(%eax),%edx
+ 9a1:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 9a4:	8b 40 04             	mov    0x4(%eax),%eax
+ 9a7:	01 c2                	add    %eax,%edx
+ 9a9:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 9ac:	89 50 04             	mov    %edx,0x4(%eax)
+        p->s.ptr = bp->s.ptr;
+ 9af:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 9b2:	8b 10                	mov    (%eax),%edx
+ 9b4:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 9b7:	89 10                	mov    %edx,(%eax)
+ 9b9:	eb 08                	jmp    9c3 <free+0xd7>
+    } else
+        p->s.ptr = bp;
+ 9bb:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 9be:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 9c1:	89 10                	mov    %edx,(%eax)
+    freep = p;
+ 9c3:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 9c6:	a3 c0 0d 00 00       	mov    %eax,0xdc0
+}
+ 9cb:	90                   	nop
+ 9cc:	c9                   	leave
+ 9cd:	c3                   	ret
+
+000009ce <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+ 9ce:	55                   	push   %ebp
+ 9cf:	89 e5                	mov    %esp,%ebp
+ 9d1:	83 ec 18             	sub    $0x18,%esp
+    char *p;
+    Header *hp;
+
+    if(nu < 4096)
+ 9d4:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+ 9db:	77 07                	ja     9e4 <morecore+0x16>
+        nu = 4096;
+ 9dd:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+    p = sbrk(nu * sizeof(Header));
+ 9e4:	8b 45 08             	mov    0x8(%ebp),%eax
+ 9e7:	c1 e0 03             	shl    $0x3,%eax
+ 9ea:	83 ec 0c             	sub    $0xc,%esp
+ 9ed:	50                   	push   %eax
+ 9ee:	e8 0a fb ff ff       	call   4fd <sbrk>
+ 9f3:	83 c4 10             	add    $0x10,%esp
+ 9f6:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p == (char*)-1)
+ 9f9:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+ 9fd:	75 07                	jne    a06 <morecore+0x38>
+        return 0;
+ 9ff:	b8 00 00 00 00       	mov    $0x0,%eax
+ a04:	eb 26                	jmp    a2c <morecore+0x5e>
+    hp = (Header*)p;
+ a06:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a09:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    hp->s.size = nu;
+ a0c:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ a0f:	8b 55 08             	mov    0x8(%ebp),%edx
+ a12:	89 50 04             	mov    %edx,0x4(%eax)
+    free((void*)(hp + 1));
+ a15:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ a18:	83 c0 08             	add    $0x8,%eax
+ a1b:	83 ec 0c             	sub    $0xc,%esp
+ a1e:	50                   	push   %eax
+ a1f:	e8 c8 fe ff ff       	call   8ec <free>
+ a24:	83 c4 10             	add    $0x10,%esp
+    return freep;
+ a27:	a1 c0 0d 00 00       	mov    0xdc0,%eax
+}
+ a2c:	c9                   	leave
+ a2d:	c3                   	ret
+
+00000a2e <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ a2e:	55                   	push   %ebp
+ a2f:	89 e5                	mov    %esp,%ebp
+ a31:	83 ec 18             	sub    $0x18,%esp
+    Header *p, *prevp;
+    uint nunits;
+
+    nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ a34:	8b 45 08             	mov    0x8(%ebp),%eax
+ a37:	83 c0 07             	add    $0x7,%eax
+ a3a:	c1 e8 03             	shr    $0x3,%eax
+ a3d:	83 c0 01             	add    $0x1,%eax
+ a40:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    if((prevp = freep) == 0){
+ a43:	a1 c0 0d 00 00       	mov    0xdc0,%eax
+ a48:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ a4b:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ a4f:	75 23                	jne    a74 <malloc+0x46>
+        base.s.ptr = freep = prevp = &base;
+ a51:	c7 45 f0 b8 0d 00 00 	movl   $0xdb8,-0x10(%ebp)
+ a58:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ a5b:	a3 c0 0d 00 00       	mov    %eax,0xdc0
+ a60:	a1 c0 0d 00 00       	mov    0xdc0,%eax
+ a65:	a3 b8 0d 00 00       	mov    %eax,0xdb8
+        base.s.size = 0;
+ a6a:	c7 05 bc 0d 00 00 00 	movl   $0x0,0xdbc
+ a71:	00 00 00 
+    }
+    for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ a74:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ a77:	8b 00                	mov    (%eax),%eax
+ a79:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        if(p->s.size >= nunits){
+ a7c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a7f:	8b 40 04             	mov    0x4(%eax),%eax
+ a82:	3b 45 ec             	cmp    -0x14(%ebp),%eax
+ a85:	72 4d                	jb     ad4 <malloc+0xa6>
+            if(p->s.size == nunits)
+ a87:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a8a:	8b 40 04             	mov    0x4(%eax),%eax
+ a8d:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+ a90:	75 0c                	jne    a9e <malloc+0x70>
+                prevp->s.ptr = p->s.ptr;
+ a92:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a95:	8b 10                	mov    (%eax),%edx
+ a97:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ a9a:	89 10                	mov    %edx,(%eax)
+ a9c:	eb 26                	jmp    ac4 <malloc+0x96>
+            else {
+                p->s.size -= nunits;
+ a9e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ aa1:	8b 40 04             	mov    0x4(%eax),%eax
+ aa4:	2b 45 ec             	sub    -0x14(%ebp),%eax
+ aa7:	89 c2                	mov    %eax,%edx
+ aa9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ aac:	89 50 04             	mov    %edx,0x4(%eax)
+                p += p->s.size;
+ aaf:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ ab2:	8b 40 04             	mov    0x4(%eax),%eax
+ ab5:	c1 e0 03             	shl    $0x3,%eax
+ ab8:	01 45 f4             	add    %eax,-0xc(%ebp)
+                p->s.size = nunits;
+ abb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ abe:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ ac1:	89 50 04             	mov    %edx,0x4(%eax)
+            }
+            freep = prevp;
+ ac4:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ ac7:	a3 c0 0d 00 00       	mov    %eax,0xdc0
+            return (void*)(p + 1);
+ acc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ acf:	83 c0 08             	add    $0x8,%eax
+ ad2:	eb 3b                	jmp    b0f <malloc+0xe1>
+        }
+        if(p == freep)
+ ad4:	a1 c0 0d 00 00       	mov    0xdc0,%eax
+ ad9:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ adc:	75 1e                	jne    afc <malloc+0xce>
+            if((p = morecore(nunits)) == 0)
+ ade:	83 ec 0c             	sub    $0xc,%esp
+ ae1:	ff 75 ec             	push   -0x14(%ebp)
+ ae4:	e8 e5 fe ff ff       	call   9ce <morecore>
+ ae9:	83 c4 10             	add    $0x10,%esp
+ aec:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ aef:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ af3:	75 07                	jne    afc <malloc+0xce>
+                return 0;
+ af5:	b8 00 00 00 00       	mov    $0x0,%eax
+ afa:	eb 13                	jmp    b0f <malloc+0xe1>
+    for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ afc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ aff:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ b02:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b05:	8b 00                	mov    (%eax),%eax
+ b07:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        if(p->s.size >= nunits){
+ b0a:	e9 6d ff ff ff       	jmp    a7c <malloc+0x4e>
+    }
+}
+ b0f:	c9                   	leave
+ b10:	c3                   	ret
@@ -3,15 +3,24 @@
 #include "param.h"
 #include "memlayout.h"
 #include "mmu.h"
+#include "spinlock.h"
 #include "proc.h"
 #include "x86.h"
+#include "traps.h"
 #include "syscall.h"
+#include "sysstat.h"
 
 // User code makes a system call with INT T_SYSCALL.
 // System call number in %eax.
 // Arguments on the stack, from the user call to the C
 // library system call function. The saved user %esp points
 // to a saved program counter, and then the first argument.
+//
+// Or with sysenter (tf->trapno is T_SYSENTER), passing the first
+// NREGARG arguments in %ebx, %esi, %edi and %ebp.    The user stub
+// pushed those registers first, so the saved %esp is NREGARG words
+// below the saved program counter.
+#define NREGARG 4
 
 // Fetch the int at addr from the current process.
 
@@ -26,6 +35,14 @@ static int checkaddr(uint addr)
         return 1;
     return 0;
 }
+
+// Return 1 if the n bytes at addr lie within the current process.
+int
+checkrange(uint addr, uint n)
+{
+    return addr + n >= addr && checkaddr(addr) && checkaddr(addr+n-1);
+}
+
 int
 fetchint(uint addr, int *ip)
 {
@@ -60,9 +77,17 @@ fetchstr(uint addr, char **pp)
 int
 argint(int n, int *ip)
 {
-    // cprintf("argint\n");
-    // cprintf("%d\n", (myproc()->tf->esp) + 4 + 4*n);
-    return fetchint((myproc()->tf->esp) + 4 + 4*n, ip);
+    struct trapframe *tf = myproc()->tf;
+
+    if(tf->trapno != T_SYSENTER)
+        return fetchint(tf->esp + 4 + 4*n, ip);
+    switch(n){
+    case 0: *ip = tf->ebx; return 0;
+    case 1: *ip = tf->esi; return 0;
+    case 2: *ip = tf->edi; return 0;
+    case 3: *ip = tf->ebp; return 0;
+    }
+    return fetchint(tf->esp + 4*NREGARG + 4 + 4*n, ip);
 }
 
 // Fetch the nth word-sized system call argument as a pointer
@@ -79,6 +104,7 @@ argptr(int n, char **pp, int size)
     if(size < 0 || !checkaddr(i) || !checkaddr(i+size-1))
         return -1;
     *pp = (char*)i;
+    uffdfaultin(myproc(), i, size);
     return 0;
 }
 
@@ -121,6 +147,38 @@ extern int sys_date(void);
 extern int sys_dup2(void);
 extern int sys_alarm(void);
 extern int sys_rstoregs(void);
+extern int sys_uffd(void);
+extern int sys_uffdregister(void);
+extern int sys_uffdcopy(void);
+extern int sys_getpriority(void);
+extern int sys_setpriority(void);
+extern int sys_setweight(void);
+extern int sys_setgroup(void);
+extern int sys_schedinfo(void);
+extern int sys_nanosleep(void);
+extern int sys_clock_nanosleep(void);
+extern int sys_clock_gettime(void);
+extern int sys_sched_setaffinity(void);
+extern int sys_sched_getaffinity(void);
+extern int sys_irqaffinity(void);
+extern int sys_getrusage(void);
+extern int sys_times(void);
+extern int sys_schedlat(void);
+extern int sys_sched_setscheduler(void);
+extern int sys_sched_getscheduler(void);
+extern int sys_sched_getparam(void);
+extern int sys_lockstat(void);
+extern int sys_ioring_setup(void);
+extern int sys_ioring_enter(void);
+extern int sys_readv(void);
+extern int sys_writev(void);
+extern int sys_pread(void);
+extern int sys_pwrite(void);
+extern int sys_sendfile(void);
+extern int sys_splice(void);
+extern int sys_sysstat(void);
+extern int sys_strace(void);
+extern int sys_straceread(void);
 
 static int (*syscalls[])(void) = {
 [SYS_fork]        sys_fork,
@@ -147,11 +205,42 @@ static int (*syscalls[])(void) = {
 [SYS_date]        sys_date,
 [SYS_dup2]        sys_dup2,
 [SYS_alarm]       sys_alarm,
-[SYS_rstoregs]    sys_rstoregs 
+[SYS_rstoregs]    sys_rstoregs,
+[SYS_uffd]        sys_uffd,
+[SYS_uffdregister] sys_uffdregister,
+[SYS_uffdcopy]    sys_uffdcopy,
+[SYS_getpriority] sys_getpriority,
+[SYS_setpriority] sys_setpriority,
+[SYS_setweight]   sys_setweight,
+[SYS_setgroup]    sys_setgroup,
+[SYS_schedinfo]   sys_schedinfo,
+[SYS_nanosleep]   sys_nanosleep,
+[SYS_clock_nanosleep] sys_clock_nanosleep,
+[SYS_clock_gettime] sys_clock_gettime,
+[SYS_sched_setaffinity] sys_sched_setaffinity,
+[SYS_sched_getaffinity] sys_sched_getaffinity,
+[SYS_irqaffinity] sys_irqaffinity,
+[SYS_getrusage]   sys_getrusage,
+[SYS_times]       sys_times,
+[SYS_schedlat]    sys_schedlat,
+[SYS_sched_setscheduler] sys_sched_setscheduler,
+[SYS_sched_getscheduler] sys_sched_getscheduler,
+[SYS_sched_getparam] sys_sched_getparam,
+[SYS_lockstat]    sys_lockstat,
+[SYS_ioring_setup] sys_ioring_setup,
+[SYS_ioring_enter] sys_ioring_enter,
+[SYS_readv]       sys_readv,
+[SYS_writev]      sys_writev,
+[SYS_pread]       sys_pread,
+[SYS_pwrite]      sys_pwrite,
+[SYS_sendfile]    sys_sendfile,
+[SYS_splice]      sys_splice,
+[SYS_sysstat]     sys_sysstat,
+[SYS_strace]      sys_strace,
+[SYS_straceread]  sys_straceread,
 };
 
 // #define SYSCALL_TRACE
-#ifdef SYSCALL_TRACE
 static char *syscall_names[] = {
 [SYS_fork]        "fork",
 [SYS_exit]        "exit",
@@ -177,19 +266,70 @@ static char *syscall_names[] = {
 [SYS_date]        "date",
 [SYS_dup2]        "dup2",
 [SYS_alarm]       "alarm",
-[SYS_rstoregs]    "rstoregs" 
+[SYS_rstoregs]    "rstoregs",
+[SYS_uffd]        "uffd",
+[SYS_uffdregister] "uffdregister",
+[SYS_uffdcopy]    "uffdcopy",
+[SYS_getpriority] "getpriority",
+[SYS_setpriority] "setpriority",
+[SYS_setweight]   "setweight",
+[SYS_setgroup]    "setgroup",
+[SYS_schedinfo]   "schedinfo",
+[SYS_nanosleep]   "nanosleep",
+[SYS_clock_nanosleep] "clock_nanosleep",
+[SYS_clock_gettime] "clock_gettime",
+[SYS_sched_setaffinity] "sched_setaffinity",
+[SYS_sched_getaffinity] "sched_getaffinity",
+[SYS_irqaffinity] "irqaffinity",
+[SYS_getrusage]   "getrusage",
+[SYS_times]       "times",
+[SYS_schedlat]    "schedlat",
+[SYS_sched_setscheduler] "sched_setscheduler",
+[SYS_sched_getscheduler] "sched_getscheduler",
+[SYS_sched_getparam] "sched_getparam",
+[SYS_lockstat]    "lockstat",
+[SYS_ioring_setup] "ioring_setup",
+[SYS_ioring_enter] "ioring_enter",
+[SYS_readv]       "readv",
+[SYS_writev]      "writev",
+[SYS_pread]       "pread",
+[SYS_pwrite]      "pwrite",
+[SYS_sendfile]    "sendfile",
+[SYS_splice]      "splice",
+[SYS_sysstat]     "sysstat",
+[SYS_strace]      "strace",
+[SYS_straceread]  "straceread",
 };
-#endif
+
+// Return the name of system call num, or 0 if there is none.
+char*
+syscallname(int num)
+{
+    if(num <= 0 || num >= NELEM(syscall_names))
+        return 0;
+    return syscall_names[num];
+}
 
 void
 syscall(void)
 {
-    int num;
+    int num, i;
     struct proc *curproc = myproc();
+    uint arg[NSTRACEARG];
+    uint64 t0;
 
     num = curproc->tf->eax;
     if(num > 0 && num < NELEM(syscalls) && syscalls[num]) {
-        curproc->tf->eax = syscalls[num]();
+        if(sysstaton || curproc->straced){
+            // Fetch the arguments first; exec replaces them.
+            for(i = 0; i < NSTRACEARG; i++)
+                if(!curproc->straced || argint(i, (int*)&arg[i]) < 0)
+                    arg[i] = 0;
+            t0 = rdtsc();
+            curproc->tf->eax = syscalls[num]();
+            syscallstat(num, arg, curproc->tf->eax, rdtsc() - t0);
+        } else
+            curproc->tf->eax = syscalls[num]();
 #ifdef SYSCALL_TRACE
         cprintf("%s -> %d\n", syscall_names[num], curproc->tf->eax);
 #endif        
@@ -24,3 +24,35 @@
 #define SYS_dup2     23
 #define SYS_alarm    24
 #define SYS_rstoregs 25
+#define SYS_uffd     26
+#define SYS_uffdregister 27
+#define SYS_uffdcopy 28
+#define SYS_getpriority 29
+#define SYS_setpriority 30
+#define SYS_setweight 31
+#define SYS_setgroup 32
+#define SYS_schedinfo 33
+#define SYS_nanosleep 34
+#define SYS_clock_nanosleep 35
+#define SYS_clock_gettime 36
+#define SYS_sched_setaffinity 37
+#define SYS_sched_getaffinity 38
+#define SYS_irqaffinity 39
+#define SYS_getrusage 40
+#define SYS_times 41
+#define SYS_schedlat 42
+#define SYS_sched_setscheduler 43
+#define SYS_sched_getscheduler 44
+#define SYS_sched_getparam 45
+#define SYS_lockstat 46
+#define SYS_ioring_setup 47
+#define SYS_ioring_enter 48
+#define SYS_readv 49
+#define SYS_writev 50
+#define SYS_pread 51
+#define SYS_pwrite 52
+#define SYS_sendfile 53
+#define SYS_splice 54
+#define SYS_sysstat 55
+#define SYS_strace 56
+#define SYS_straceread 57
@@ -9,12 +9,14 @@
 #include "param.h"
 #include "stat.h"
 #include "mmu.h"
+#include "spinlock.h"
 #include "proc.h"
 #include "fs.h"
-#include "spinlock.h"
 #include "sleeplock.h"
 #include "file.h"
 #include "fcntl.h"
+#include "ioring.h"
+#include "uio.h"
 
 // Fetch the nth word-sized system call argument as a file descriptor
 // and return both the descriptor and the corresponding struct file.
@@ -107,6 +109,143 @@ sys_write(void)
     return filewrite(f, p, n);
 }
 
+// Fetch the iovec array that is the nth system call argument,
+// with its count in argument n+1, into iov, checking that each
+// buffer lies within the process.    Copied, since the process
+// could change its own copy while the kernel walks it.
+// Return the count, or -1.
+static int
+argiov(int n, struct iovec *iov)
+{
+    struct iovec *uiov;
+    int i, cnt;
+
+    if(argint(n+1, &cnt) < 0 || cnt < 0 || cnt > IOV_MAX ||
+       argptr(n, (void*)&uiov, cnt*sizeof(*uiov)) < 0)
+        return -1;
+    for(i = 0; i < cnt; i++){
+        iov[i] = uiov[i];
+        if(iov[i].iov_len > 0 && !checkrange((uint)iov[i].iov_base, iov[i].iov_len))
+            return -1;
+        uffdfaultin(myproc(), (uint)iov[i].iov_base, iov[i].iov_len);
+    }
+    return cnt;
+}
+
+int
+sys_readv(void)
+{
+    struct file *f;
+    struct iovec iov[IOV_MAX];
+    int cnt;
+
+    if(argfd(0, 0, &f) < 0 || (cnt = argiov(1, iov)) < 0)
+        return -1;
+    return filereadv(f, iov, cnt);
+}
+
+int
+sys_writev(void)
+{
+    struct file *f;
+    struct iovec iov[IOV_MAX];
+    int cnt;
+
+    if(argfd(0, 0, &f) < 0 || (cnt = argiov(1, iov)) < 0)
+        return -1;
+    return filewritev(f, iov, cnt);
+}
+
+int
+sys_pread(void)
+{
+    struct file *f;
+    int n, off;
+    char *p;
+
+    if(argfd(0, 0, &f) < 0 || argint(2, &n) < 0 || argptr(1, &p, n) < 0 ||
+       argint(3, &off) < 0 || off < 0)
+        return -1;
+    return filepread(f, p, n, off);
+}
+
+int
+sys_pwrite(void)
+{
+    struct file *f;
+    int n, off;
+    char *p;
+
+    if(argfd(0, 0, &f) < 0 || argint(2, &n) < 0 || argptr(1, &p, n) < 0 ||
+       argint(3, &off) < 0 || off < 0)
+        return -1;
+    return filepwrite(f, p, n, off);
+}
+
+// Fetch the nth system call argument, a pointer to a file offset
+// or 0, into *pp.
+static int
+argoff(int n, int **pp)
+{
+    int a;
+
+    if(argint(n, &a) < 0)
+        return -1;
+    if(a == 0){
+        *pp = 0;
+        return 0;
+    }
+    if(argptr(n, (void*)pp, sizeof(**pp)) < 0 || **pp < 0)
+        return -1;
+    return 0;
+}
+
+// Copy n bytes of file in, from *off if off is not 0 and from
+// its own offset otherwise, to out, which may be a pipe.
+int
+sys_sendfile(void)
+{
+    struct file *in, *out;
+    int *off, n, r;
+    uint o;
+
+    if(argfd(0, 0, &out) < 0 || argfd(1, 0, &in) < 0 || argoff(2, &off) < 0 ||
+       argint(3, &n) < 0 || in->type != FD_INODE)
+        return -1;
+    if(off == 0)
+        return filesplice(in, &in->off, out, &out->off, n);
+    o = *off;
+    if((r = filesplice(in, &o, out, &out->off, n)) > 0)
+        *off = o;
+    return r;
+}
+
+// Move up to n bytes from fdin to fdout, one of which must be a
+// pipe.    Offsets work as for sendfile(); a pipe has none.
+int
+sys_splice(void)
+{
+    struct file *in, *out;
+    int *inoff, *outoff, n, r;
+    uint io, oo;
+
+    if(argfd(0, 0, &in) < 0 || argoff(1, &inoff) < 0 || argfd(2, 0, &out) < 0 ||
+       argoff(3, &outoff) < 0 || argint(4, &n) < 0)
+        return -1;
+    if(in->type != FD_PIPE && out->type != FD_PIPE)
+        return -1;
+    if((inoff && in->type == FD_PIPE) || (outoff && out->type == FD_PIPE))
+        return -1;
+    io = inoff ? *inoff : in->off;
+    oo = outoff ? *outoff : out->off;
+    r = filesplice(in, inoff ? &io : &in->off, out, outoff ? &oo : &out->off, n);
+    if(r > 0 && inoff)
+        *inoff = io;
+    if(r > 0 && outoff)
+        *outoff = oo;
+    return r;
+}
+
 int
 sys_close(void)
 {
@@ -120,6 +259,15 @@ sys_close(void)
     return 0;
 }
 
+// Return the open file for descriptor fd, or 0.
+static struct file*
+fdfile(int fd)
+{
+    if(fd < 0 || fd >= NOFILE)
+        return 0;
+    return myproc()->ofile[fd];
+}
+
 int
 sys_fstat(void)
 {
@@ -235,6 +383,7 @@ sys_unlink(void)
     memset(&de, 0, sizeof(de));
     if(writei(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
         panic("unlink: writei");
+    ncacheremove(dp->dev, dp->inum, name);
     if(ip->type == T_DIR){
         dp->nlink--;
         iupdate(dp);
@@ -299,17 +448,13 @@ create(char *path, short type, short major, short minor)
     return ip;
 }
 
-int
-sys_open(void)
+static int
+openpath(char *path, int omode)
 {
-    char *path;
-    int fd, omode;
+    int fd;
     struct file *f;
     struct inode *ip;
 
-    if(argstr(0, &path) < 0 || argint(1, &omode) < 0)
-        return -1;
-
     begin_op();
 
     if(omode & O_CREATE){
@@ -349,6 +494,17 @@ sys_open(void)
     return fd;
 }
 
+int
+sys_open(void)
+{
+    char *path;
+    int omode;
+
+    if(argstr(0, &path) < 0 || argint(1, &omode) < 0)
+        return -1;
+    return openpath(path, omode);
+}
+
 int
 sys_mkdir(void)
 {
@@ -459,3 +615,125 @@ sys_pipe(void)
     fd[1] = fd1;
     return 0;
 }
+
+int
+sys_uffd(void)
+{
+    struct file *f;
+    int fd;
+
+    if(uffdalloc(&f) < 0)
+        return -1;
+    if((fd = fdalloc(f)) < 0){
+        fileclose(f);
+        return -1;
+    }
+    return fd;
+}
+
+int
+sys_uffdregister(void)
+{
+    struct file *f;
+    int addr, len;
+
+    if(argfd(0, 0, &f) < 0 || argint(1, &addr) < 0 || argint(2, &len) < 0)
+        return -1;
+    if(f->type != FD_UFFD)
+        return -1;
+    return uffdregister(f->uffd, addr, len);
+}
+
+int
+sys_uffdcopy(void)
+{
+    struct file *f;
+    int dst;
+    char *src;
+
+    if(argfd(0, 0, &f) < 0 || argint(1, &dst) < 0 || argptr(2, &src, PGSIZE) < 0)
+        return -1;
+    if(f->type != FD_UFFD)
+        return -1;
+    return uffdcopy(f->uffd, dst, src);
+}
+
+int
+sys_ioring_setup(void)
+{
+    struct file *f;
+    uint *addr;
+    int fd;
+
+    if(argptr(0, (char**)&addr, sizeof(*addr)) < 0)
+        return -1;
+    if(ioringalloc(&f, addr) < 0)
+        return -1;
+    if((fd = fdalloc(f)) < 0){
+        fileclose(f);
+        return -1;
+    }
+    return fd;
+}
+
+// Run one operation taken from a ring.    Opens and closes touch
+// the descriptor table, so they run here, in the process that
+// owns it; the rest go to the ioring workers.
+static void
+ioringop(struct ioctx *ctx, struct iosqe *e)
+{
+    struct file *f;
+    char *path;
+    int res;
+
+    res = -1;
+    switch(e->op){
+    case IOOP_NOP:
+        res = 0;
+        break;
+    case IOOP_OPEN:
+        if(fetchstr(e->addr, &path) >= 0)
+            res = openpath(path, e->len);
+        break;
+    case IOOP_CLOSE:
+        if((f = fdfile(e->fd)) != 0){
+            myproc()->ofile[e->fd] = 0;
+            fileclose(f);
+            res = 0;
+        }
+        break;
+    case IOOP_READ:
+    case IOOP_WRITE:
+    case IOOP_FSYNC:
+        if((f = fdfile(e->fd)) != 0){
+            ioringsubmit(ctx, filedup(f), e);
+            return;
+        }
+        break;
+    }
+    ioringpost(ctx, e->data, res);
+}
+
+// Take up to n entries from ring fd's submission ring, then wait
+// until at least min completions are ready or nothing is in flight.
+// Return the number of entries taken.
+int
+sys_ioring_enter(void)
+{
+    struct file *f;
+    struct iosqe e;
+    int n, min, i;
+
+    if(argfd(0, 0, &f) < 0 || argint(1, &n) < 0 || argint(2, &min) < 0)
+        return -1;
+    if(f->type != FD_IORING)
+        return -1;
+    // An entry may close fd itself.
+    filedup(f);
+    for(i = 0; i < n && ioringnext(f->ioctx, &e); i++)
+        ioringop(f->ioctx, &e);
+    if(min > 0 && ioringwait(f->ioctx, min) < 0)
+        i = -1;
+    fileclose(f);
+    return i;
+}
@@ -5,7 +5,12 @@
 #include "param.h"
 #include "memlayout.h"
 #include "mmu.h"
+#include "spinlock.h"
 #include "proc.h"
+#include "sched.h"
+#include "resource.h"
+#include "lockstat.h"
+#include "sysstat.h"
 
 struct callerregs {
     uint eax;
@@ -43,6 +48,253 @@ sys_kill(void)
     return kill(pid);
 }
 
+int
+sys_getpriority(void)
+{
+    int pid;
+
+    if(argint(0, &pid) < 0)
+        return -1;
+    return getpriority(pid);
+}
+
+int
+sys_setpriority(void)
+{
+    int pid, nice;
+
+    if(argint(0, &pid) < 0 || argint(1, &nice) < 0)
+        return -1;
+    return setpriority(pid, nice);
+}
+
+int
+sys_setweight(void)
+{
+    int pid, weight;
+
+    if(argint(0, &pid) < 0 || argint(1, &weight) < 0)
+        return -1;
+    return setweight(pid, weight);
+}
+
+int
+sys_setgroup(void)
+{
+    int gid;
+
+    if(argint(0, &gid) < 0)
+        return -1;
+    return setgroup(gid);
+}
+
+int
+sys_schedinfo(void)
+{
+    struct schedinfo *si;
+    int n;
+
+    if(argint(1, &n) < 0 || n < 0)
+        return -1;
+    // There are never more than MAXPROC to copy, and a larger n
+    // could overflow the size checked below.
+    if(n > MAXPROC)
+        n = MAXPROC;
+    if(argptr(0, (void*)&si, n*sizeof(*si)) < 0)
+        return -1;
+    return schedinfo(si, n);
+}
+
+int
+sys_schedlat(void)
+{
+    struct schedlat *sl;
+    int cpu, reset;
+
+    if(argint(0, &cpu) < 0 || argptr(1, (void*)&sl, sizeof(*sl)) < 0 ||
+       argint(2, &reset) < 0)
+        return -1;
+    return schedlat(cpu, sl, reset);
+}
+
+int
+sys_sched_setscheduler(void)
+{
+    int pid, policy, prio;
+
+    if(argint(0, &pid) < 0 || argint(1, &policy) < 0 || argint(2, &prio) < 0)
+        return -1;
+    return setscheduler(pid, policy, prio);
+}
+
+int
+sys_sched_getscheduler(void)
+{
+    int pid;
+
+    if(argint(0, &pid) < 0)
+        return -1;
+    return getscheduler(pid);
+}
+
+int
+sys_sched_getparam(void)
+{
+    int pid;
+
+    if(argint(0, &pid) < 0)
+        return -1;
+    return getrtprio(pid);
+}
+
+int
+sys_sched_setaffinity(void)
+{
+    int pid, mask;
+
+    if(argint(0, &pid) < 0 || argint(1, &mask) < 0)
+        return -1;
+    return setaffinity(pid, mask);
+}
+
+int
+sys_sched_getaffinity(void)
+{
+    int pid;
+
+    if(argint(0, &pid) < 0)
+        return -1;
+    return getaffinity(pid);
+}
+
+// Route device interrupt irq to cpu.
+int
+sys_irqaffinity(void)
+{
+    int irq, cpu;
+
+    if(argint(0, &irq) < 0 || argint(1, &cpu) < 0)
+        return -1;
+    if(cpu < 0 || cpu >= ncpu)
+        return -1;
+    return ioapicroute(irq, cpus[cpu].apicid);
+}
+
+// Read, reset, or turn on or off the lock statistics.
+int
+sys_lockstat(void)
+{
+    struct lockstat *ls;
+    int cmd, n;
+
+    if(argint(0, &cmd) < 0 || argint(2, &n) < 0 || n < 0)
+        return -1;
+    if(n > NLOCKCLASS)
+        n = NLOCKCLASS;
+    ls = 0;
+    if(cmd == LOCKSTAT_READ && argptr(1, (void*)&ls, n*sizeof(*ls)) < 0)
+        return -1;
+    return lockstat(cmd, ls, n);
+}
+
+int
+sys_sysstat(void)
+{
+    struct sysstat *st;
+    int cmd, pid, n;
+
+    if(argint(0, &cmd) < 0 || argint(1, &pid) < 0 || argint(3, &n) < 0 || n < 0)
+        return -1;
+    if(n > NSYSCALL)
+        n = NSYSCALL;
+    st = 0;
+    if(cmd == SYSSTAT_READ && argptr(2, (void*)&st, n*sizeof(*st)) < 0)
+        return -1;
+    return sysstat(cmd, pid, st, n);
+}
+
+int
+sys_strace(void)
+{
+    int pid, on;
+
+    if(argint(0, &pid) < 0 || argint(1, &on) < 0)
+        return -1;
+    return setstrace(pid, on);
+}
+
+int
+sys_straceread(void)
+{
+    struct stracerec *r;
+    int n;
+
+    if(argint(1, &n) < 0 || n < 0)
+        return -1;
+    if(n > STRACEBATCH)
+        n = STRACEBATCH;
+    if(argptr(0, (void*)&r, n*sizeof(*r)) < 0)
+        return -1;
+    return straceread(r, n);
+}
+
+static void
+totimeval(uint64 cycles, struct timeval *tv)
+{
+    uint sec, nsec;
+
+    cyclestons(cycles, &sec, &nsec);
+    tv->tv_sec = sec;
+    tv->tv_usec = nsec / 1000;
+}
+
+int
+sys_getrusage(void)
+{
+    int who;
+    struct rusage *r;
+    struct pusage *u;
+
+    if(argint(0, &who) < 0 || argptr(1, (void*)&r, sizeof(*r)) < 0)
+        return -1;
+    if(who == RUSAGE_SELF){
+        acct(0);
+        u = &myproc()->ru;
+    } else if(who == RUSAGE_CHILDREN)
+        u = &myproc()->cru;
+    else
+        return -1;
+    totimeval(u->utime, &r->ru_utime);
+    totimeval(u->stime, &r->ru_stime);
+    r->ru_minflt = u->minflt;
+    r->ru_majflt = u->majflt;
+    r->ru_inblock = u->inblock;
+    r->ru_oublock = u->oublock;
+    r->ru_nvcsw = u->nvcsw;
+    r->ru_nivcsw = u->nivcsw;
+    return 0;
+}
+
+// Return ticks since boot, and fill in the caller's and its
+// waited-for children's times in ticks.
+int
+sys_times(void)
+{
+    struct tms *t;
+    struct proc *curproc = myproc();
+    uint tickcycles;
+
+    if(argptr(0, (void*)&t, sizeof(*t)) < 0)
+        return -1;
+    acct(0);
+    tickcycles = tsckhz * (1000/HZ);
+    t->tms_utime = divu64(curproc->ru.utime, tickcycles);
+    t->tms_stime = divu64(curproc->ru.stime, tickcycles);
+    t->tms_cutime = divu64(curproc->cru.utime, tickcycles);
+    t->tms_cstime = divu64(curproc->cru.stime, tickcycles);
+    return readticks();
+}
+
 int
 sys_getpid(void)
 {
@@ -67,22 +319,28 @@ sys_sbrk(void)
     return a;
 }
 
+// Sleep on the process's own timer, so that each tick wakes
+// only the sleepers whose time is up.
 int
 sys_sleep(void)
 {
     int n;
     uint ticks0;
+    struct proc *curproc = myproc();
 
     if(argint(0, &n) < 0)
         return -1;
     acquire(&tickslock);
     ticks0 = ticks;
+    if(ticks - ticks0 < n)
+        timerset(&curproc->sleeptimer, ticks0 + n, wakeup, &curproc->sleeptimer);
     while(ticks - ticks0 < n){
-        if(myproc()->killed){
+        if(curproc->killed){
+            timerdel(&curproc->sleeptimer);
             release(&tickslock);
             return -1;
         }
-        sleep(&ticks, &tickslock);
+        sleep(&curproc->sleeptimer, &tickslock);
     }
     release(&tickslock);
     return 0;
@@ -93,12 +351,85 @@ sys_sleep(void)
 int
 sys_uptime(void)
 {
-    uint xticks;
+    return readticks();
+}
 
-    acquire(&tickslock);
-    xticks = ticks;
-    release(&tickslock);
-    return xticks;
+// Sleep for req on clock clk, or until req if TIMER_ABSTIME is
+// set in flags.    Only CLOCK_MONOTONIC has absolute deadlines.
+// If interrupted, store the time left in rem if it is not 0.
+static int
+nanosleep1(int clk, int flags, struct timespec *req, struct timespec *rem)
+{
+    uint64 deadline, now;
+    uint sec, nsec;
+
+    if(req->tv_sec < 0 || req->tv_nsec < 0 || req->tv_nsec >= 1000000000)
+        return -1;
+    if(flags & TIMER_ABSTIME){
+        if(clk != CLOCK_MONOTONIC)
+            return -1;
+        deadline = boottsc + nstocycles(req->tv_sec, req->tv_nsec);
+    } else {
+        if(clk != CLOCK_MONOTONIC && clk != CLOCK_REALTIME)
+            return -1;
+        deadline = rdtsc() + nstocycles(req->tv_sec, req->tv_nsec);
+    }
+    if(hrsleep(deadline) < 0){
+        if(rem && !(flags & TIMER_ABSTIME)){
+            now = rdtsc();
+            cyclestons(deadline > now ? deadline - now : 0, &sec, &nsec);
+            rem->tv_sec = sec;
+            rem->tv_nsec = nsec;
+        }
+        return -1;
+    }
+    return 0;
+}
+
+int
+sys_nanosleep(void)
+{
+    struct timespec *req, *rem;
+    int r;
+
+    if(argptr(0, (void*)&req, sizeof(*req)) < 0 || argint(1, &r) < 0)
+        return -1;
+    rem = 0;
+    if(r && argptr(1, (void*)&rem, sizeof(*rem)) < 0)
+        return -1;
+    return nanosleep1(CLOCK_MONOTONIC, 0, req, rem);
+}
+
+int
+sys_clock_nanosleep(void)
+{
+    struct timespec *req, *rem;
+    int clk, flags, r;
+
+    if(argint(0, &clk) < 0 || argint(1, &flags) < 0 ||
+        argptr(2, (void*)&req, sizeof(*req)) < 0 || argint(3, &r) < 0)
+        return -1;
+    rem = 0;
+    if(r && argptr(3, (void*)&rem, sizeof(*rem)) < 0)
+        return -1;
+    return nanosleep1(clk, flags, req, rem);
+}
+
+int
+sys_clock_gettime(void)
+{
+    struct timespec *ts;
+    int clk;
+    uint sec, nsec;
+
+    if(argint(0, &clk) < 0 || argptr(1, (void*)&ts, sizeof(*ts)) < 0)
+        return -1;
+    if(clk != CLOCK_MONOTONIC)
+        return -1;
+    cyclestons(rdtsc() - boottsc, &sec, &nsec);
+    ts->tv_sec = sec;
+    ts->tv_nsec = nsec;
+    return 0;
 }
 
 int
@@ -112,23 +443,41 @@ sys_date(void)
     return 0;
 }
 
+// Called from the timer queue every alarmticks ticks;
+// trap() enters the handler when p next returns to user space.
+static void
+alarmfire(void *arg)
+{
+    struct proc *p = arg;
+
+    p->alarmpending = 1;
+    timerset(&p->alarmtimer, ticks + p->alarmticks, alarmfire, p);
+}
+
 int
 sys_alarm(void)
 {
-    int ticks;
+    int n;
     uint handler;
     uint handlerret;
+    struct proc *curproc = myproc();
 
     if(argptr(-1, (char**)&handlerret, 0) < 0)
         return -1; 
-    if(argint(1, &ticks) < 0)
+    if(argint(1, &n) < 0)
         return -1;
     if(argptr(2, (char**)&handler, 0) < 0)
         return -1;
-    myproc()->alarmticks = ticks;
-    myproc()->alarmticksleft = ticks;
-    myproc()->alarmhandler = handler;
-    myproc()->alarmhandlerret = handlerret;
+    acquire(&tickslock);
+    curproc->alarmticks = n;
+    curproc->alarmhandler = handler;
+    curproc->alarmhandlerret = handlerret;
+    curproc->alarmpending = 0;
+    if(n > 0)
+        timerset(&curproc->alarmtimer, ticks + n, alarmfire, curproc);
+    else
+        timerdel(&curproc->alarmtimer);
+    release(&tickslock);
     return 0;
 }
 
@@ -0,0 +1,209 @@
+// System call statistics and tracing.
+//
+// While sysstat is on, syscall() times each call and counts it in
+// a table per cpu, so that updating the counts needs no lock, and
+// in a page of the calling process's own; sysstat() adds them up.
+// Independently, each call made by a process that strace() has
+// marked goes into a ring of records, which straceread() drains.
+// A traced process's children are traced too.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "x86.h"
+#include "mmu.h"
+#include "spinlock.h"
+#include "proc.h"
+#include "sysstat.h"
+
+#define NSTRACE      256    // Records kept; the oldest are dropped
+
+// One call's counts.    A process keeps NSYSCALL of these in a page.
+struct syscount {
+    uint count;
+    uint64 cycles;
+    uint hist[NSYSBUCKET];
+};
+
+static struct syscount cpucount[NCPU][NSYSCALL];
+
+int sysstaton;
+
+static struct {
+    struct spinlock lock;
+    struct stracerec rec[NSTRACE];
+    uint head;              // Oldest record not yet read
+    uint tail;              // Where the next record goes
+    int ntraced;            // Live processes being traced
+} straceq;
+
+void
+sysstatinit(void)
+{
+    if(NSYSCALL * sizeof(struct syscount) > PGSIZE)
+        panic("sysstatinit");
+    initlock(&straceq.lock, "strace", 1);
+}
+
+static void
+count(struct syscount *c, uint64 cycles)
+{
+    uint i;
+
+    if(cycles >> 32)
+        i = NSYSBUCKET-1;
+    else if(cycles < 256)
+        i = 0;
+    else
+        i = (bsr(cycles) - 8) / 2;
+    if(i >= NSYSBUCKET)
+        i = NSYSBUCKET-1;
+    c->count++;
+    c->cycles += cycles;
+    c->hist[i]++;
+}
+
+// Record that the current process's call num, with arguments
+// arg, returned ret after cycles.    Called by syscall().
+void
+syscallstat(int num, uint *arg, int ret, uint64 cycles)
+{
+    struct proc *p = myproc();
+    struct stracerec *r;
+    int i;
+
+    if(num < 0 || num >= NSYSCALL)
+        return;
+    if(sysstaton){
+        pushcli();
+        count(&cpucount[cpuid()][num], cycles);
+        popcli();
+        // Only p writes its page, and wait() frees it.
+        if(p->sysstat == 0 && (p->sysstat = (struct syscount*)kalloc()) != 0)
+            memset(p->sysstat, 0, PGSIZE);
+        if(p->sysstat)
+            count(&p->sysstat[num], cycles);
+    }
+    if(p->straced){
+        acquire(&straceq.lock);
+        if(straceq.tail - straceq.head == NSTRACE)
+            straceq.head++;
+        r = &straceq.rec[straceq.tail++ % NSTRACE];
+        r->pid = p->pid;
+        r->num = num;
+        for(i = 0; i < NSTRACEARG; i++)
+            r->arg[i] = arg[i];
+        r->ret = ret;
+        r->cycles = cycles >> 32 ? ~0 : cycles;
+        wakeone(&straceq.head);
+        release(&straceq.lock);
+    }
+}
+
+// A process has started (delta 1) or stopped (-1) being traced.
+void
+stracecount(int delta)
+{
+    acquire(&straceq.lock);
+    straceq.ntraced += delta;
+    if(straceq.ntraced == 0)
+        wakeup(&straceq.head);
+    release(&straceq.lock);
+}
+
+// Take up to n of the oldest trace records into r, waiting for
+// one if there are none and some process is still being traced.
+// Return how many were taken: 0 once tracing is over, -1 if killed.
+int
+straceread(struct stracerec *r, int n)
+{
+    struct stracerec buf[STRACEBATCH];
+    int i;
+
+    if(n > STRACEBATCH)
+        n = STRACEBATCH;
+    acquire(&straceq.lock);
+    while(straceq.head == straceq.tail && straceq.ntraced > 0){
+        if(myproc()->killed){
+            release(&straceq.lock);
+            return -1;
+        }
+        sleep(&straceq.head, &straceq.lock);
+    }
+    for(i = 0; i < n && straceq.head != straceq.tail; i++)
+        buf[i] = straceq.rec[straceq.head++ % NSTRACE];
+    if(straceq.head != straceq.tail)
+        wakeone(&straceq.head);
+    release(&straceq.lock);
+    // Copy out without the lock; the process's page may fault.
+    memmove(r, buf, i*sizeof(buf[0]));
+    return i;
+}
+
+// Add c into st.
+static void
+addcount(struct sysstat *st, struct syscount *c)
+{
+    int i;
+
+    st->count += c->count;
+    st->cycles += c->cycles;
+    for(i = 0; i < NSYSBUCKET; i++)
+        st->hist[i] += c->hist[i];
+}
+
+// Carry out sysstat command cmd.    SYSSTAT_READ fills in st[i] for
+// call number i, up to n of them, with the counts of process pid,
+// or of all processes if pid is 0, and returns how many it filled.
+// SYSSTAT_RESET zeroes the counts of all processes taken together,
+// and those of pid if it is not 0.    The others return 0.
+// The counts are read and reset without locks, so a count racing
+// with either may be off by one.
+int
+sysstat(int cmd, int pid, struct sysstat *st, int n)
+{
+    struct syscount *page;
+    char *name;
+    int i, c;
+
+    switch(cmd){
+    case SYSSTAT_READ:
+        if(n > NSYSCALL)
+            n = NSYSCALL;
+        page = 0;
+        if(pid != 0){
+            if((page = (struct syscount*)kalloc()) == 0)
+                return -1;
+            memset(page, 0, PGSIZE);
+            if(syscounts(pid, (char*)page, 0) < 0){
+                kfree((char*)page);
+                return -1;
+            }
+        }
+        for(i = 0; i < n; i++){
+            memset(&st[i], 0, sizeof(st[i]));
+            if((name = syscallname(i)) != 0)
+                safestrcpy(st[i].name, name, sizeof(st[i].name));
+            if(page)
+                addcount(&st[i], &page[i]);
+            else
+                for(c = 0; c < ncpu; c++)
+                    addcount(&st[i], &cpucount[c][i]);
+        }
+        if(page)
+            kfree((char*)page);
+        return n;
+    case SYSSTAT_ON:
+        sysstaton = 1;
+        return 0;
+    case SYSSTAT_OFF:
+        sysstaton = 0;
+        return 0;
+    case SYSSTAT_RESET:
+        memset(cpucount, 0, sizeof(cpucount));
+        if(pid != 0 && syscounts(pid, 0, 1) < 0)
+            return -1;
+        return 0;
+    }
+    return -1;
+}
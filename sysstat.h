@@ -0,0 +1,31 @@
+// System call statistics and tracing, for sysstat(), strace()
+// and straceread().
+#define SYSSTAT_READ    0   // copy out one struct sysstat per call number
+#define SYSSTAT_ON      1   // start counting
+#define SYSSTAT_OFF     2   // stop counting
+#define SYSSTAT_RESET   3   // zero the counts
+
+#define NSYSCALL       64   // call numbers counted, from 0
+#define NSYSBUCKET     12   // latency histogram buckets
+#define NSTRACEARG      4   // arguments kept per traced call
+#define STRACEBATCH    16   // most records one straceread() returns
+
+// Counts for one system call, made by all processes or by one.
+// Times are in TSC cycles.    Bucket i of hist counts calls that took
+// 2^(8+2i) to 2^(10+2i) cycles; the first and last buckets also
+// count anything quicker and slower.
+struct sysstat {
+    char name[16];          // empty if there is no such call
+    uint count;
+    uint64 cycles;          // total time spent in the call
+    uint hist[NSYSBUCKET];
+};
+
+// One traced system call.
+struct stracerec {
+    int pid;
+    int num;
+    uint arg[NSTRACEARG];   // the first few words of arguments
+    int ret;
+    uint cycles;            // time spent in the call, at most ~0
+};
@@ -0,0 +1,1863 @@
+
+_sysstats:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <printu64>:
+
+// Print v in decimal.    There is no 64-bit division here, so
+// divide by 10 sixteen bits at a time.
+void
+printu64(uint64 v)
+{
+   0:	55                   	push   %ebp
+   1:	89 e5                	mov    %esp,%ebp
+   3:	83 ec 48             	sub    $0x48,%esp
+   6:	8b 45 08             	mov    0x8(%ebp),%eax
+   9:	89 45 c0             	mov    %eax,-0x40(%ebp)
+   c:	8b 45 0c             	mov    0xc(%ebp),%eax
+   f:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+    ushort w[4];
+    char buf[24];
+    uint r, more;
+    int i, n;
+
+    for(i = 0; i < 4; i++)
+  12:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  19:	eb 2f                	jmp    4a <printu64+0x4a>
+        w[i] = v >> (48 - 16*i);
+  1b:	b8 03 00 00 00       	mov    $0x3,%eax
+  20:	2b 45 ec             	sub    -0x14(%ebp),%eax
+  23:	c1 e0 04             	shl    $0x4,%eax
+  26:	89 c1                	mov    %eax,%ecx
+  28:	8b 45 c0             	mov    -0x40(%ebp),%eax
+  2b:	8b 55 c4             	mov    -0x3c(%ebp),%edx
+  2e:	0f ad d0             	shrd   %cl,%edx,%eax
+  31:	d3 ea                	shr    %cl,%edx
+  33:	f6 c1 20             	test   $0x20,%cl
+  36:	74 04                	je     3c <printu64+0x3c>
+  38:	89 d0                	mov    %edx,%eax
+  3a:	31 d2                	xor    %edx,%edx
+  3c:	89 c2                	mov    %eax,%edx
+  3e:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  41:	66 89 54 45 e0       	mov    %dx,-0x20(%ebp,%eax,2)
+    for(i = 0; i < 4; i++)
+  46:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+  4a:	83 7d ec 03          	cmpl   $0x3,-0x14(%ebp)
+  4e:	7e cb                	jle    1b <printu64+0x1b>
+    n = sizeof(buf) - 1;
+  50:	c7 45 e8 17 00 00 00 	movl   $0x17,-0x18(%ebp)
+    buf[n] = 0;
+  57:	8d 55 c8             	lea    -0x38(%ebp),%edx
+  5a:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  5d:	01 d0                	add    %edx,%eax
+  5f:	c6 00 00             	movb   $0x0,(%eax)
+    do {
+        r = 0;
+  62:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+        more = 0;
+  69:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+        for(i = 0; i < 4; i++){
+  70:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  77:	eb 62                	jmp    db <printu64+0xdb>
+            r = (r << 16) | w[i];
+  79:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  7c:	c1 e0 10             	shl    $0x10,%eax
+  7f:	89 c2                	mov    %eax,%edx
+  81:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  84:	0f b7 44 45 e0       	movzwl -0x20(%ebp,%eax,2),%eax
+  89:	0f b7 c0             	movzwl %ax,%eax
+  8c:	09 d0                	or     %edx,%eax
+  8e:	89 45 f4             	mov    %eax,-0xc(%ebp)
+            w[i] = r / 10;
+  91:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  94:	ba cd cc cc cc       	mov    $0xcccccccd,%edx
+  99:	f7 e2                	mul    %edx
+  9b:	89 d0                	mov    %edx,%eax
+  9d:	c1 e8 03             	shr    $0x3,%eax
+  a0:	89 c2                	mov    %eax,%edx
+  a2:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  a5:	66 89 54 45 e0       	mov    %dx,-0x20(%ebp,%eax,2)
+            r %= 10;
+  aa:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+  ad:	ba cd cc cc cc       	mov    $0xcccccccd,%edx
+  b2:	89 c8                	mov    %ecx,%eax
+  b4:	f7 e2                	mul    %edx
+  b6:	c1 ea 03             	shr    $0x3,%edx
+  b9:	89 d0                	mov    %edx,%eax
+  bb:	c1 e0 02             	shl    $0x2,%eax
+  be:	01 d0                	add    %edx,%eax
+  c0:	01 c0                	add    %eax,%eax
+  c2:	29 c1                	sub    %eax,%ecx
+  c4:	89 ca                	mov    %ecx,%edx
+  c6:	89 55 f4             	mov    %edx,-0xc(%ebp)
+            more |= w[i];
+  c9:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  cc:	0f b7 44 45 e0       	movzwl -0x20(%ebp,%eax,2),%eax
+  d1:	0f b7 c0             	movzwl %ax,%eax
+  d4:	09 45 f0             	or     %eax,-0x10(%ebp)
+        for(i = 0; i < 4; i++){
+  d7:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+  db:	83 7d ec 03          	cmpl   $0x3,-0x14(%ebp)
+  df:	7e 98                	jle    79 <printu64+0x79>
+        }
+        buf[--n] = '0' + r;
+  e1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  e4:	83 c0 30             	add    $0x30,%eax
+  e7:	83 6d e8 01          	subl   $0x1,-0x18(%ebp)
+  eb:	89 c1                	mov    %eax,%ecx
+  ed:	8d 55 c8             	lea    -0x38(%ebp),%edx
+  f0:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  f3:	01 d0                	add    %edx,%eax
+  f5:	88 08                	mov    %cl,(%eax)
+    } while(more);
+  f7:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+  fb:	0f 85 61 ff ff ff    	jne    62 <printu64+0x62>
+    printf(1, "%s", buf + n);
+ 101:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 104:	8d 55 c8             	lea    -0x38(%ebp),%edx
+ 107:	01 d0                	add    %edx,%eax
+ 109:	83 ec 04             	sub    $0x4,%esp
+ 10c:	50                   	push   %eax
+ 10d:	68 a3 0e 00 00       	push   $0xea3
+ 112:	6a 01                	push   $0x1
+ 114:	e8 d3 09 00 00       	call   aec <printf>
+ 119:	83 c4 10             	add    $0x10,%esp
+}
+ 11c:	90                   	nop
+ 11d:	c9                   	leave
+ 11e:	c3                   	ret
+
+0000011f <report>:
+
+// Print the calls that were made, most time first.
+void
+report(int pid)
+{
+ 11f:	55                   	push   %ebp
+ 120:	89 e5                	mov    %esp,%ebp
+ 122:	57                   	push   %edi
+ 123:	56                   	push   %esi
+ 124:	53                   	push   %ebx
+ 125:	83 ec 6c             	sub    $0x6c,%esp
+    struct sysstat t;
+    int i, j, n;
+
+    if((n = sysstat(SYSSTAT_READ, pid, stats, NSYSCALL)) < 0){
+ 128:	6a 40                	push   $0x40
+ 12a:	68 00 12 00 00       	push   $0x1200
+ 12f:	ff 75 08             	push   0x8(%ebp)
+ 132:	6a 00                	push   $0x0
+ 134:	e8 aa 08 00 00       	call   9e3 <sysstat>
+ 139:	83 c4 10             	add    $0x10,%esp
+ 13c:	89 45 dc             	mov    %eax,-0x24(%ebp)
+ 13f:	83 7d dc 00          	cmpl   $0x0,-0x24(%ebp)
+ 143:	79 1a                	jns    15f <report+0x40>
+        printf(2, "sysstats: no process %d\n", pid);
+ 145:	83 ec 04             	sub    $0x4,%esp
+ 148:	ff 75 08             	push   0x8(%ebp)
+ 14b:	68 a6 0e 00 00       	push   $0xea6
+ 150:	6a 02                	push   $0x2
+ 152:	e8 95 09 00 00       	call   aec <printf>
+ 157:	83 c4 10             	add    $0x10,%esp
+        exit();
+ 15a:	e8 8f 06 00 00       	call   7ee <exit>
+    }
+    for(i = 0; i < n; i++){
+ 15f:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+ 166:	e9 ac 00 00 00       	jmp    217 <report+0xf8>
+        for(j = i+1; j < n; j++){
+ 16b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 16e:	83 c0 01             	add    $0x1,%eax
+ 171:	89 45 e0             	mov    %eax,-0x20(%ebp)
+ 174:	e9 8e 00 00 00       	jmp    207 <report+0xe8>
+            if(stats[j].cycles > stats[i].cycles){
+ 179:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ 17c:	6b c0 4c             	imul   $0x4c,%eax,%eax
+ 17f:	05 10 12 00 00       	add    $0x1210,%eax
+ 184:	8b 50 08             	mov    0x8(%eax),%edx
+ 187:	8b 40 04             	mov    0x4(%eax),%eax
+ 18a:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ 18d:	6b c9 4c             	imul   $0x4c,%ecx,%ecx
+ 190:	81 c1 10 12 00 00    	add    $0x1210,%ecx
+ 196:	8b 59 08             	mov    0x8(%ecx),%ebx
+ 199:	8b 49 04             	mov    0x4(%ecx),%ecx
+ 19c:	39 c1                	cmp    %eax,%ecx
+ 19e:	19 d3                	sbb    %edx,%ebx
+ 1a0:	73 61                	jae    203 <report+0xe4>
+                t = stats[i];
+ 1a2:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 1a5:	6b c0 4c             	imul   $0x4c,%eax,%eax
+ 1a8:	8d 90 00 12 00 00    	lea    0x1200(%eax),%edx
+ 1ae:	8d 45 90             	lea    -0x70(%ebp),%eax
+ 1b1:	89 d3                	mov    %edx,%ebx
+ 1b3:	ba 13 00 00 00       	mov    $0x13,%edx
+ 1b8:	89 c7                	mov    %eax,%edi
+ 1ba:	89 de                	mov    %ebx,%esi
+ 1bc:	89 d1                	mov    %edx,%ecx
+ 1be:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+                stats[i] = stats[j];
+ 1c0:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 1c3:	6b c0 4c             	imul   $0x4c,%eax,%eax
+ 1c6:	8d 90 00 12 00 00    	lea    0x1200(%eax),%edx
+ 1cc:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ 1cf:	6b c0 4c             	imul   $0x4c,%eax,%eax
+ 1d2:	05 00 12 00 00       	add    $0x1200,%eax
+ 1d7:	89 c3                	mov    %eax,%ebx
+ 1d9:	b8 13 00 00 00       	mov    $0x13,%eax
+ 1de:	89 d7                	mov    %edx,%edi
+ 1e0:	89 de                	mov    %ebx,%esi
+ 1e2:	89 c1                	mov    %eax,%ecx
+ 1e4:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+                stats[j] = t;
+ 1e6:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ 1e9:	6b c0 4c             	imul   $0x4c,%eax,%eax
+ 1ec:	05 00 12 00 00       	add    $0x1200,%eax
+ 1f1:	89 c3                	mov    %eax,%ebx
+ 1f3:	8d 45 90             	lea    -0x70(%ebp),%eax
+ 1f6:	ba 13 00 00 00       	mov    $0x13,%edx
+ 1fb:	89 df                	mov    %ebx,%edi
+ 1fd:	89 c6                	mov    %eax,%esi
+ 1ff:	89 d1                	mov    %edx,%ecx
+ 201:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+        for(j = i+1; j < n; j++){
+ 203:	83 45 e0 01          	addl   $0x1,-0x20(%ebp)
+ 207:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ 20a:	3b 45 dc             	cmp    -0x24(%ebp),%eax
+ 20d:	0f 8c 66 ff ff ff    	jl     179 <report+0x5a>
+    for(i = 0; i < n; i++){
+ 213:	83 45 e4 01          	addl   $0x1,-0x1c(%ebp)
+ 217:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 21a:	3b 45 dc             	cmp    -0x24(%ebp),%eax
+ 21d:	0f 8c 48 ff ff ff    	jl     16b <report+0x4c>
+            }
+        }
+    }
+    for(i = 0; i < n && stats[i].count; i++){
+ 223:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+ 22a:	e9 da 00 00 00       	jmp    309 <report+0x1ea>
+        printf(1, "%s: %d calls, ", stats[i].name, stats[i].count);
+ 22f:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 232:	6b c0 4c             	imul   $0x4c,%eax,%eax
+ 235:	05 10 12 00 00       	add    $0x1210,%eax
+ 23a:	8b 00                	mov    (%eax),%eax
+ 23c:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+ 23f:	6b d2 4c             	imul   $0x4c,%edx,%edx
+ 242:	81 c2 00 12 00 00    	add    $0x1200,%edx
+ 248:	50                   	push   %eax
+ 249:	52                   	push   %edx
+ 24a:	68 bf 0e 00 00       	push   $0xebf
+ 24f:	6a 01                	push   $0x1
+ 251:	e8 96 08 00 00       	call   aec <printf>
+ 256:	83 c4 10             	add    $0x10,%esp
+        printu64(stats[i].cycles);
+ 259:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 25c:	6b c0 4c             	imul   $0x4c,%eax,%eax
+ 25f:	05 10 12 00 00       	add    $0x1210,%eax
+ 264:	8b 50 08             	mov    0x8(%eax),%edx
+ 267:	8b 40 04             	mov    0x4(%eax),%eax
+ 26a:	83 ec 08             	sub    $0x8,%esp
+ 26d:	52                   	push   %edx
+ 26e:	50                   	push   %eax
+ 26f:	e8 8c fd ff ff       	call   0 <printu64>
+ 274:	83 c4 10             	add    $0x10,%esp
+        printf(1, " cycles\n   ");
+ 277:	83 ec 08             	sub    $0x8,%esp
+ 27a:	68 ce 0e 00 00       	push   $0xece
+ 27f:	6a 01                	push   $0x1
+ 281:	e8 66 08 00 00       	call   aec <printf>
+ 286:	83 c4 10             	add    $0x10,%esp
+        for(j = 0; j < NSYSBUCKET; j++)
+ 289:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%ebp)
+ 290:	eb 5b                	jmp    2ed <report+0x1ce>
+            if(stats[i].hist[j])
+ 292:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+ 295:	89 d0                	mov    %edx,%eax
+ 297:	c1 e0 03             	shl    $0x3,%eax
+ 29a:	01 d0                	add    %edx,%eax
+ 29c:	01 c0                	add    %eax,%eax
+ 29e:	01 d0                	add    %edx,%eax
+ 2a0:	8b 55 e0             	mov    -0x20(%ebp),%edx
+ 2a3:	01 d0                	add    %edx,%eax
+ 2a5:	83 c0 04             	add    $0x4,%eax
+ 2a8:	8b 04 85 0c 12 00 00 	mov    0x120c(,%eax,4),%eax
+ 2af:	85 c0                	test   %eax,%eax
+ 2b1:	74 36                	je     2e9 <report+0x1ca>
+                printf(1, " 2^%d:%d", 8 + 2*j, stats[i].hist[j]);
+ 2b3:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+ 2b6:	89 d0                	mov    %edx,%eax
+ 2b8:	c1 e0 03             	shl    $0x3,%eax
+ 2bb:	01 d0                	add    %edx,%eax
+ 2bd:	01 c0                	add    %eax,%eax
+ 2bf:	01 d0                	add    %edx,%eax
+ 2c1:	8b 55 e0             	mov    -0x20(%ebp),%edx
+ 2c4:	01 d0                	add    %edx,%eax
+ 2c6:	83 c0 04             	add    $0x4,%eax
+ 2c9:	8b 04 85 0c 12 00 00 	mov    0x120c(,%eax,4),%eax
+ 2d0:	8b 55 e0             	mov    -0x20(%ebp),%edx
+ 2d3:	83 c2 04             	add    $0x4,%edx
+ 2d6:	01 d2                	add    %edx,%edx
+ 2d8:	50                   	push   %eax
+ 2d9:	52                   	push   %edx
+ 2da:	68 da 0e 00 00       	push   $0xeda
+ 2df:	6a 01                	push   $0x1
+ 2e1:	e8 06 08 00 00       	call   aec <printf>
+ 2e6:	83 c4 10             	add    $0x10,%esp
+        for(j = 0; j < NSYSBUCKET; j++)
+ 2e9:	83 45 e0 01          	addl   $0x1,-0x20(%ebp)
+ 2ed:	83 7d e0 0b          	cmpl   $0xb,-0x20(%ebp)
+ 2f1:	7e 9f                	jle    292 <report+0x173>
+        printf(1, "\n");
+ 2f3:	83 ec 08             	sub    $0x8,%esp
+ 2f6:	68 e3 0e 00 00       	push   $0xee3
+ 2fb:	6a 01                	push   $0x1
+ 2fd:	e8 ea 07 00 00       	call   aec <printf>
+ 302:	83 c4 10             	add    $0x10,%esp
+    for(i = 0; i < n && stats[i].count; i++){
+ 305:	83 45 e4 01          	addl   $0x1,-0x1c(%ebp)
+ 309:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 30c:	3b 45 dc             	cmp    -0x24(%ebp),%eax
+ 30f:	7d 15                	jge    326 <report+0x207>
+ 311:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 314:	6b c0 4c             	imul   $0x4c,%eax,%eax
+ 317:	05 10 12 00 00       	add    $0x1210,%eax
+ 31c:	8b 00                	mov    (%eax),%eax
+ 31e:	85 c0                	test   %eax,%eax
+ 320:	0f 85 09 ff ff ff    	jne    22f <report+0x110>
+    }
+}
+ 326:	90                   	nop
+ 327:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 32a:	5b                   	pop    %ebx
+ 32b:	5e                   	pop    %esi
+ 32c:	5f                   	pop    %edi
+ 32d:	5d                   	pop    %ebp
+ 32e:	c3                   	ret
+
+0000032f <main>:
+
+int
+main(int argc, char *argv[])
+{
+ 32f:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+ 333:	83 e4 f0             	and    $0xfffffff0,%esp
+ 336:	ff 71 fc             	push   -0x4(%ecx)
+ 339:	55                   	push   %ebp
+ 33a:	89 e5                	mov    %esp,%ebp
+ 33c:	53                   	push   %ebx
+ 33d:	51                   	push   %ecx
+ 33e:	83 ec 10             	sub    $0x10,%esp
+ 341:	89 cb                	mov    %ecx,%ebx
+    int pid;
+
+    if(argc < 2){
+ 343:	83 3b 01             	cmpl   $0x1,(%ebx)
+ 346:	7f 12                	jg     35a <main+0x2b>
+        report(0);
+ 348:	83 ec 0c             	sub    $0xc,%esp
+ 34b:	6a 00                	push   $0x0
+ 34d:	e8 cd fd ff ff       	call   11f <report>
+ 352:	83 c4 10             	add    $0x10,%esp
+        exit();
+ 355:	e8 94 04 00 00       	call   7ee <exit>
+    }
+    if(strcmp(argv[1], "-p") == 0 && argc > 2)
+ 35a:	8b 43 04             	mov    0x4(%ebx),%eax
+ 35d:	83 c0 04             	add    $0x4,%eax
+ 360:	8b 00                	mov    (%eax),%eax
+ 362:	83 ec 08             	sub    $0x8,%esp
+ 365:	68 e5 0e 00 00       	push   $0xee5
+ 36a:	50                   	push   %eax
+ 36b:	e8 ca 01 00 00       	call   53a <strcmp>
+ 370:	83 c4 10             	add    $0x10,%esp
+ 373:	85 c0                	test   %eax,%eax
+ 375:	75 2a                	jne    3a1 <main+0x72>
+ 377:	83 3b 02             	cmpl   $0x2,(%ebx)
+ 37a:	7e 25                	jle    3a1 <main+0x72>
+        report(atoi(argv[2]));
+ 37c:	8b 43 04             	mov    0x4(%ebx),%eax
+ 37f:	83 c0 08             	add    $0x8,%eax
+ 382:	8b 00                	mov    (%eax),%eax
+ 384:	83 ec 0c             	sub    $0xc,%esp
+ 387:	50                   	push   %eax
+ 388:	e8 1c 03 00 00       	call   6a9 <atoi>
+ 38d:	83 c4 10             	add    $0x10,%esp
+ 390:	83 ec 0c             	sub    $0xc,%esp
+ 393:	50                   	push   %eax
+ 394:	e8 86 fd ff ff       	call   11f <report>
+ 399:	83 c4 10             	add    $0x10,%esp
+ 39c:	e9 3e 01 00 00       	jmp    4df <main+0x1b0>
+    else if(strcmp(argv[1], "on") == 0)
+ 3a1:	8b 43 04             	mov    0x4(%ebx),%eax
+ 3a4:	83 c0 04             	add    $0x4,%eax
+ 3a7:	8b 00                	mov    (%eax),%eax
+ 3a9:	83 ec 08             	sub    $0x8,%esp
+ 3ac:	68 e8 0e 00 00       	push   $0xee8
+ 3b1:	50                   	push   %eax
+ 3b2:	e8 83 01 00 00       	call   53a <strcmp>
+ 3b7:	83 c4 10             	add    $0x10,%esp
+ 3ba:	85 c0                	test   %eax,%eax
+ 3bc:	75 15                	jne    3d3 <main+0xa4>
+        sysstat(SYSSTAT_ON, 0, 0, 0);
+ 3be:	6a 00                	push   $0x0
+ 3c0:	6a 00                	push   $0x0
+ 3c2:	6a 00                	push   $0x0
+ 3c4:	6a 01                	push   $0x1
+ 3c6:	e8 18 06 00 00       	call   9e3 <sysstat>
+ 3cb:	83 c4 10             	add    $0x10,%esp
+ 3ce:	e9 0c 01 00 00       	jmp    4df <main+0x1b0>
+    else if(strcmp(argv[1], "off") == 0)
+ 3d3:	8b 43 04             	mov    0x4(%ebx),%eax
+ 3d6:	83 c0 04             	add    $0x4,%eax
+ 3d9:	8b 00                	mov    (%eax),%eax
+ 3db:	83 ec 08             	sub    $0x8,%esp
+ 3de:	68 eb 0e 00 00       	push   $0xeeb
+ 3e3:	50                   	push   %eax
+ 3e4:	e8 51 01 00 00       	call   53a <strcmp>
+ 3e9:	83 c4 10             	add    $0x10,%esp
+ 3ec:	85 c0                	test   %eax,%eax
+ 3ee:	75 15                	jne    405 <main+0xd6>
+        sysstat(SYSSTAT_OFF, 0, 0, 0);
+ 3f0:	6a 00                	push   $0x0
+ 3f2:	6a 00                	push   $0x0
+ 3f4:	6a 00                	push   $0x0
+ 3f6:	6a 02                	push   $0x2
+ 3f8:	e8 e6 05 00 00       	call   9e3 <sysstat>
+ 3fd:	83 c4 10             	add    $0x10,%esp
+ 400:	e9 da 00 00 00       	jmp    4df <main+0x1b0>
+    else if(strcmp(argv[1], "reset") == 0)
+ 405:	8b 43 04             	mov    0x4(%ebx),%eax
+ 408:	83 c0 04             	add    $0x4,%eax
+ 40b:	8b 00                	mov    (%eax),%eax
+ 40d:	83 ec 08             	sub    $0x8,%esp
+ 410:	68 ef 0e 00 00       	push   $0xeef
+ 415:	50                   	push   %eax
+ 416:	e8 1f 01 00 00       	call   53a <strcmp>
+ 41b:	83 c4 10             	add    $0x10,%esp
+ 41e:	85 c0                	test   %eax,%eax
+ 420:	75 15                	jne    437 <main+0x108>
+        sysstat(SYSSTAT_RESET, 0, 0, 0);
+ 422:	6a 00                	push   $0x0
+ 424:	6a 00                	push   $0x0
+ 426:	6a 00                	push   $0x0
+ 428:	6a 03                	push   $0x3
+ 42a:	e8 b4 05 00 00       	call   9e3 <sysstat>
+ 42f:	83 c4 10             	add    $0x10,%esp
+ 432:	e9 a8 00 00 00       	jmp    4df <main+0x1b0>
+    else {
+        sysstat(SYSSTAT_RESET, 0, 0, 0);
+ 437:	6a 00                	push   $0x0
+ 439:	6a 00                	push   $0x0
+ 43b:	6a 00                	push   $0x0
+ 43d:	6a 03                	push   $0x3
+ 43f:	e8 9f 05 00 00       	call   9e3 <sysstat>
+ 444:	83 c4 10             	add    $0x10,%esp
+        sysstat(SYSSTAT_ON, 0, 0, 0);
+ 447:	6a 00                	push   $0x0
+ 449:	6a 00                	push   $0x0
+ 44b:	6a 00                	push   $0x0
+ 44d:	6a 01                	push   $0x1
+ 44f:	e8 8f 05 00 00       	call   9e3 <sysstat>
+ 454:	83 c4 10             	add    $0x10,%esp
+        pid = fork();
+ 457:	e8 8b 03 00 00       	call   7e7 <fork>
+ 45c:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        if(pid < 0){
+ 45f:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 463:	79 17                	jns    47c <main+0x14d>
+            printf(2, "sysstats: fork failed\n");
+ 465:	83 ec 08             	sub    $0x8,%esp
+ 468:	68 f5 0e 00 00       	push   $0xef5
+ 46d:	6a 02                	push   $0x2
+ 46f:	e8 78 06 00 00       	call   aec <printf>
+ 474:	83 c4 10             	add    $0x10,%esp
+            exit();
+ 477:	e8 72 03 00 00       	call   7ee <exit>
+        }
+        if(pid == 0){
+ 47c:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 480:	75 3b                	jne    4bd <main+0x18e>
+            exec(argv[1], argv + 1);
+ 482:	8b 43 04             	mov    0x4(%ebx),%eax
+ 485:	8d 50 04             	lea    0x4(%eax),%edx
+ 488:	8b 43 04             	mov    0x4(%ebx),%eax
+ 48b:	83 c0 04             	add    $0x4,%eax
+ 48e:	8b 00                	mov    (%eax),%eax
+ 490:	83 ec 08             	sub    $0x8,%esp
+ 493:	52                   	push   %edx
+ 494:	50                   	push   %eax
+ 495:	e8 91 03 00 00       	call   82b <exec>
+ 49a:	83 c4 10             	add    $0x10,%esp
+            printf(2, "sysstats: exec %s failed\n", argv[1]);
+ 49d:	8b 43 04             	mov    0x4(%ebx),%eax
+ 4a0:	83 c0 04             	add    $0x4,%eax
+ 4a3:	8b 00                	mov    (%eax),%eax
+ 4a5:	83 ec 04             	sub    $0x4,%esp
+ 4a8:	50                   	push   %eax
+ 4a9:	68 0c 0f 00 00       	push   $0xf0c
+ 4ae:	6a 02                	push   $0x2
+ 4b0:	e8 37 06 00 00       	call   aec <printf>
+ 4b5:	83 c4 10             	add    $0x10,%esp
+            exit();
+ 4b8:	e8 31 03 00 00       	call   7ee <exit>
+        }
+        wait();
+ 4bd:	e8 33 03 00 00       	call   7f5 <wait>
+        sysstat(SYSSTAT_OFF, 0, 0, 0);
+ 4c2:	6a 00                	push   $0x0
+ 4c4:	6a 00                	push   $0x0
+ 4c6:	6a 00                	push   $0x0
+ 4c8:	6a 02                	push   $0x2
+ 4ca:	e8 14 05 00 00       	call   9e3 <sysstat>
+ 4cf:	83 c4 10             	add    $0x10,%esp
+        report(0);
+ 4d2:	83 ec 0c             	sub    $0xc,%esp
+ 4d5:	6a 00                	push   $0x0
+ 4d7:	e8 43 fc ff ff       	call   11f <report>
+ 4dc:	83 c4 10             	add    $0x10,%esp
+    }
+    exit();
+ 4df:	e8 0a 03 00 00       	call   7ee <exit>
+
+000004e4 <stosb>:
+strchr(const char *s, char c)
+{
+    for(; *s; s++)
+        if(*s == c)
+            return (char*)s;
+    return 0;
+ 4e4:	55                   	push   %ebp
+ 4e5:	89 e5                	mov    %esp,%ebp
+ 4e7:	57                   	push   %edi
+ 4e8:	53                   	push   %ebx
+}
+ 4e9:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 4ec:	8b 55 10             	mov    0x10(%ebp),%edx
+ 4ef:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 4f2:	89 cb                	mov    %ecx,%ebx
+ 4f4:	89 df                	mov    %ebx,%edi
+ 4f6:	89 d1                	mov    %edx,%ecx
+ 4f8:	fc                   	cld
+ 4f9:	f3 aa                	rep stos %al,%es:(%edi)
+ 4fb:	89 ca                	mov    %ecx,%edx
+ 4fd:	89 fb                	mov    %edi,%ebx
+ 4ff:	89 5d 08             	mov    %ebx,0x8(%ebp)
+ 502:	89 55 10             	mov    %edx,0x10(%ebp)
+
+char*
+gets(char *buf, int max)
+{
+ 505:	90                   	nop
+ 506:	5b                   	pop    %ebx
+ 507:	5f                   	pop    %edi
+ 508:	5d                   	pop    %ebp
+ 509:	c3                   	ret
+
+0000050a <strcpy>:
+{
+ 50a:	55                   	push   %ebp
+ 50b:	89 e5                	mov    %esp,%ebp
+ 50d:	83 ec 10             	sub    $0x10,%esp
+    os = s;
+ 510:	8b 45 08             	mov    0x8(%ebp),%eax
+ 513:	89 45 fc             	mov    %eax,-0x4(%ebp)
+    while((*s++ = *t++) != 0)
+ 516:	90                   	nop
+ 517:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 51a:	8d 42 01             	lea    0x1(%edx),%eax
+ 51d:	89 45 0c             	mov    %eax,0xc(%ebp)
+ 520:	8b 45 08             	mov    0x8(%ebp),%eax
+ 523:	8d 48 01             	lea    0x1(%eax),%ecx
+ 526:	89 4d 08             	mov    %ecx,0x8(%ebp)
+ 529:	0f b6 12             	movzbl (%edx),%edx
+ 52c:	88 10                	mov    %dl,(%eax)
+ 52e:	0f b6 00             	movzbl (%eax),%eax
+ 531:	84 c0                	test   %al,%al
+ 533:	75 e2                	jne    517 <strcpy+0xd>
+    return os;
+ 535:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 538:	c9                   	leave
+ 539:	c3                   	ret
+
+0000053a <strcmp>:
+{
+ 53a:	55                   	push   %ebp
+ 53b:	89 e5                	mov    %esp,%ebp
+    while(*p && *p == *q)
+ 53d:	eb 08                	jmp    547 <strcmp+0xd>
+        p++, q++;
+ 53f:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 543:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+    while(*p && *p == *q)
+ 547:	8b 45 08             	mov    0x8(%ebp),%eax
+ 54a:	0f b6 00             	movzbl (%eax),%eax
+ 54d:	84 c0                	test   %al,%al
+ 54f:	74 10                	je     561 <strcmp+0x27>
+ 551:	8b 45 08             	mov    0x8(%ebp),%eax
+ 554:	0f b6 10             	movzbl (%eax),%edx
+ 557:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 55a:	0f b6 00             	movzbl (%eax),%eax
+ 55d:	38 c2                	cmp    %al,%dl
+ 55f:	74 de                	je     53f <strcmp+0x5>
+    return (uchar)*p - (uchar)*q;
+ 561:	8b 45 08             	mov    0x8(%ebp),%eax
+ 564:	0f b6 00             	movzbl (%eax),%eax
+ 567:	0f b6 d0             	movzbl %al,%edx
+ 56a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 56d:	0f b6 00             	movzbl (%eax),%eax
+ 570:	0f b6 c0             	movzbl %al,%eax
+ 573:	29 c2                	sub    %eax,%edx
+ 575:	89 d0                	mov    %edx,%eax
+}
+ 577:	5d                   	pop    %ebp
+ 578:	c3                   	ret
+
+00000579 <strlen>:
+{
+ 579:	55                   	push   %ebp
+ 57a:	89 e5                	mov    %esp,%ebp
+ 57c:	83 ec 10             	sub    $0x10,%esp
+    for(n = 0; s[n]; n++)
+ 57f:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ 586:	eb 04                	jmp    58c <strlen+0x13>
+ 588:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 58c:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 58f:	8b 45 08             	mov    0x8(%ebp),%eax
+ 592:	01 d0                	add    %edx,%eax
+ 594:	0f b6 00             	movzbl (%eax),%eax
+ 597:	84 c0                	test   %al,%al
+ 599:	75 ed                	jne    588 <strlen+0xf>
+    return n;
+ 59b:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 59e:	c9                   	leave
+ 59f:	c3                   	ret
+
+000005a0 <memset>:
+{
+ 5a0:	55                   	push   %ebp
+ 5a1:	89 e5                	mov    %esp,%ebp
+    stosb(dst, c, n);
+ 5a3:	8b 45 10             	mov    0x10(%ebp),%eax
+ 5a6:	50                   	push   %eax
+ 5a7:	ff 75 0c             	push   0xc(%ebp)
+ 5aa:	ff 75 08             	push   0x8(%ebp)
+ 5ad:	e8 32 ff ff ff       	call   4e4 <stosb>
+ 5b2:	83 c4 0c             	add    $0xc,%esp
+    return dst;
+ 5b5:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 5b8:	c9                   	leave
+ 5b9:	c3                   	ret
+
+000005ba <strchr>:
+{
+ 5ba:	55                   	push   %ebp
+ 5bb:	89 e5                	mov    %esp,%ebp
+ 5bd:	83 ec 04             	sub    $0x4,%esp
+ 5c0:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 5c3:	88 45 fc             	mov    %al,-0x4(%ebp)
+    for(; *s; s++)
+ 5c6:	eb 14                	jmp    5dc <strchr+0x22>
+        if(*s == c)
+ 5c8:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5cb:	0f b6 00             	movzbl (%eax),%eax
+ 5ce:	38 45 fc             	cmp    %al,-0x4(%ebp)
+ 5d1:	75 05                	jne    5d8 <strchr+0x1e>
+            return (char*)s;
+ 5d3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5d6:	eb 13                	jmp    5eb <strchr+0x31>
+    for(; *s; s++)
+ 5d8:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 5dc:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5df:	0f b6 00             	movzbl (%eax),%eax
+ 5e2:	84 c0                	test   %al,%al
+ 5e4:	75 e2                	jne    5c8 <strchr+0xe>
+    return 0;
+ 5e6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 5eb:	c9                   	leave
+ 5ec:	c3                   	ret
+
+000005ed <gets>:
+{
+ 5ed:	55                   	push   %ebp
+ 5ee:	89 e5                	mov    %esp,%ebp
+ 5f0:	83 ec 18             	sub    $0x18,%esp
+    int i, cc;
+    char c;
+
+    for(i=0; i+1 < max; ){
+ 5f3:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 5fa:	eb 42                	jmp    63e <gets+0x51>
+        cc = read(0, &c, 1);
+ 5fc:	83 ec 04             	sub    $0x4,%esp
+ 5ff:	6a 01                	push   $0x1
+ 601:	8d 45 ef             	lea    -0x11(%ebp),%eax
+ 604:	50                   	push   %eax
+ 605:	6a 00                	push   $0x0
+ 607:	e8 f7 01 00 00       	call   803 <read>
+ 60c:	83 c4 10             	add    $0x10,%esp
+ 60f:	89 45 f0             	mov    %eax,-0x10(%ebp)
+        if(cc < 1)
+ 612:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 616:	7e 33                	jle    64b <gets+0x5e>
+            break;
+        buf[i++] = c;
+ 618:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 61b:	8d 50 01             	lea    0x1(%eax),%edx
+ 61e:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 621:	89 c2                	mov    %eax,%edx
+ 623:	8b 45 08             	mov    0x8(%ebp),%eax
+ 626:	01 c2                	add    %eax,%edx
+ 628:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 62c:	88 02                	mov    %al,(%edx)
+        if(c == '\n' || c == '\r')
+ 62e:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 632:	3c 0a                	cmp    $0xa,%al
+ 634:	74 16                	je     64c <gets+0x5f>
+ 636:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 63a:	3c 0d                	cmp    $0xd,%al
+ 63c:	74 0e                	je     64c <gets+0x5f>
+    for(i=0; i+1 < max; ){
+ 63e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 641:	83 c0 01             	add    $0x1,%eax
+ 644:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 647:	7f b3                	jg     5fc <gets+0xf>
+ 649:	eb 01                	jmp    64c <gets+0x5f>
+            break;
+ 64b:	90                   	nop
+            break;
+    }
+    buf[i] = '\0';
+ 64c:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 64f:	8b 45 08             	mov    0x8(%ebp),%eax
+ 652:	01 d0                	add    %edx,%eax
+ 654:	c6 00 00             	movb   $0x0,(%eax)
+    return buf;
+ 657:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 65a:	c9                   	leave
+ 65b:	c3                   	ret
+
+0000065c <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 65c:	55                   	push   %ebp
+ 65d:	89 e5                	mov    %esp,%ebp
+ 65f:	83 ec 18             	sub    $0x18,%esp
+    int fd;
+    int r;
+
+    fd = open(n, O_RDONLY);
+ 662:	83 ec 08             	sub    $0x8,%esp
+ 665:	6a 00                	push   $0x0
+ 667:	ff 75 08             	push   0x8(%ebp)
+ 66a:	e8 c6 01 00 00       	call   835 <open>
+ 66f:	83 c4 10             	add    $0x10,%esp
+ 672:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(fd < 0)
+ 675:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 679:	79 07                	jns    682 <stat+0x26>
+        return -1;
+ 67b:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 680:	eb 25                	jmp    6a7 <stat+0x4b>
+    r = fstat(fd, st);
+ 682:	83 ec 08             	sub    $0x8,%esp
+ 685:	ff 75 0c             	push   0xc(%ebp)
+ 688:	ff 75 f4             	push   -0xc(%ebp)
+ 68b:	e8 c3 01 00 00       	call   853 <fstat>
+ 690:	83 c4 10             	add    $0x10,%esp
+ 693:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    close(fd);
+ 696:	83 ec 0c             	sub    $0xc,%esp
+ 699:	ff 75 f4             	push   -0xc(%ebp)
+ 69c:	e8 76 01 00 00       	call   817 <close>
+ 6a1:	83 c4 10             	add    $0x10,%esp
+    return r;
+ 6a4:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ 6a7:	c9                   	leave
+ 6a8:	c3                   	ret
+
+000006a9 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 6a9:	55                   	push   %ebp
+ 6aa:	89 e5                	mov    %esp,%ebp
+ 6ac:	83 ec 10             	sub    $0x10,%esp
+    int n;
+
+    n = 0;
+ 6af:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+    while('0' <= *s && *s <= '9')
+ 6b6:	eb 25                	jmp    6dd <atoi+0x34>
+        n = n*10 + *s++ - '0';
+ 6b8:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 6bb:	89 d0                	mov    %edx,%eax
+ 6bd:	c1 e0 02             	shl    $0x2,%eax
+ 6c0:	01 d0                	add    %edx,%eax
+ 6c2:	01 c0                	add    %eax,%eax
+ 6c4:	89 c1                	mov    %eax,%ecx
+ 6c6:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6c9:	8d 50 01             	lea    0x1(%eax),%edx
+ 6cc:	89 55 08             	mov    %edx,0x8(%ebp)
+ 6cf:	0f b6 00             	movzbl (%eax),%eax
+ 6d2:	0f be c0             	movsbl %al,%eax
+ 6d5:	01 c8                	add    %ecx,%eax
+ 6d7:	83 e8 30             	sub    $0x30,%eax
+ 6da:	89 45 fc             	mov    %eax,-0x4(%ebp)
+    while('0' <= *s && *s <= '9')
+ 6dd:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6e0:	0f b6 00             	movzbl (%eax),%eax
+ 6e3:	3c 2f                	cmp    $0x2f,%al
+ 6e5:	7e 0a                	jle    6f1 <atoi+0x48>
+ 6e7:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6ea:	0f b6 00             	movzbl (%eax),%eax
+ 6ed:	3c 39                	cmp    $0x39,%al
+ 6ef:	7e c7                	jle    6b8 <atoi+0xf>
+    return n;
+ 6f1:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 6f4:	c9                   	leave
+ 6f5:	c3                   	ret
+
+000006f6 <nice>:
+
+// Add inc to the caller's nice value; return the new value.
+int
+nice(int inc)
+{
+ 6f6:	55                   	push   %ebp
+ 6f7:	89 e5                	mov    %esp,%ebp
+ 6f9:	83 ec 18             	sub    $0x18,%esp
+    int n;
+
+    n = getpriority(0) + inc;
+ 6fc:	83 ec 0c             	sub    $0xc,%esp
+ 6ff:	6a 00                	push   $0x0
+ 701:	e8 d9 01 00 00       	call   8df <getpriority>
+ 706:	83 c4 10             	add    $0x10,%esp
+ 709:	8b 55 08             	mov    0x8(%ebp),%edx
+ 70c:	01 d0                	add    %edx,%eax
+ 70e:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(n < 0)
+ 711:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 715:	79 07                	jns    71e <nice+0x28>
+        n = 0;
+ 717:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    if(n > NICEMAX)
+ 71e:	83 7d f4 13          	cmpl   $0x13,-0xc(%ebp)
+ 722:	7e 07                	jle    72b <nice+0x35>
+        n = NICEMAX;
+ 724:	c7 45 f4 13 00 00 00 	movl   $0x13,-0xc(%ebp)
+    if(setpriority(0, n) < 0)
+ 72b:	83 ec 08             	sub    $0x8,%esp
+ 72e:	ff 75 f4             	push   -0xc(%ebp)
+ 731:	6a 00                	push   $0x0
+ 733:	e8 b1 01 00 00       	call   8e9 <setpriority>
+ 738:	83 c4 10             	add    $0x10,%esp
+ 73b:	85 c0                	test   %eax,%eax
+ 73d:	79 07                	jns    746 <nice+0x50>
+        return -1;
+ 73f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 744:	eb 03                	jmp    749 <nice+0x53>
+    return n;
+ 746:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+ 749:	c9                   	leave
+ 74a:	c3                   	ret
+
+0000074b <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 74b:	55                   	push   %ebp
+ 74c:	89 e5                	mov    %esp,%ebp
+ 74e:	83 ec 10             	sub    $0x10,%esp
+    char *dst;
+    const char *src;
+
+    dst = vdst;
+ 751:	8b 45 08             	mov    0x8(%ebp),%eax
+ 754:	89 45 fc             	mov    %eax,-0x4(%ebp)
+    src = vsrc;
+ 757:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 75a:	89 45 f8             	mov    %eax,-0x8(%ebp)
+    while(n-- > 0)
+ 75d:	eb 17                	jmp    776 <memmove+0x2b>
+        *dst++ = *src++;
+ 75f:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 762:	8d 42 01             	lea    0x1(%edx),%eax
+ 765:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 768:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 76b:	8d 48 01             	lea    0x1(%eax),%ecx
+ 76e:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+ 771:	0f b6 12             	movzbl (%edx),%edx
+ 774:	88 10                	mov    %dl,(%eax)
+    while(n-- > 0)
+ 776:	8b 45 10             	mov    0x10(%ebp),%eax
+ 779:	8d 50 ff             	lea    -0x1(%eax),%edx
+ 77c:	89 55 10             	mov    %edx,0x10(%ebp)
+ 77f:	85 c0                	test   %eax,%eax
+ 781:	7f dc                	jg     75f <memmove+0x14>
+    return vdst;
+ 783:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 786:	c9                   	leave
+ 787:	c3                   	ret
+
+00000788 <dosyscall>:
+sysmode:
+    .long 0
+
+    .text
+dosyscall:
+    cmpl $0, sysmode
+ 788:	83 3d e8 11 00 00 00 	cmpl   $0x0,0x11e8
+    jg 2f
+ 78f:	7f 0c                	jg     79d <dosyscall+0x15>
+    jl 1f
+ 791:	7c 07                	jl     79a <dosyscall+0x12>
+    call sepcheck
+ 793:	e8 27 00 00 00       	call   7bf <sepcheck>
+    jmp dosyscall
+ 798:	eb ee                	jmp    788 <dosyscall>
+1:
+    int $T_SYSCALL
+ 79a:	cd 40                	int    $0x40
+    ret
+ 79c:	c3                   	ret
+2:
+    pushl %ebx
+ 79d:	53                   	push   %ebx
+    pushl %esi
+ 79e:	56                   	push   %esi
+    pushl %edi
+ 79f:	57                   	push   %edi
+    pushl %ebp
+ 7a0:	55                   	push   %ebp
+    movl 20(%esp), %ebx
+ 7a1:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+    movl 24(%esp), %esi
+ 7a5:	8b 74 24 18          	mov    0x18(%esp),%esi
+    movl 28(%esp), %edi
+ 7a9:	8b 7c 24 1c          	mov    0x1c(%esp),%edi
+    movl 32(%esp), %ebp
+ 7ad:	8b 6c 24 20          	mov    0x20(%esp),%ebp
+    movl %esp, %ecx
+ 7b1:	89 e1                	mov    %esp,%ecx
+    movl $3f, %edx
+ 7b3:	ba ba 07 00 00       	mov    $0x7ba,%edx
+    sysenter
+ 7b8:	0f 34                	sysenter
+3:
+    popl %ebp
+ 7ba:	5d                   	pop    %ebp
+    popl %edi
+ 7bb:	5f                   	pop    %edi
+    popl %esi
+ 7bc:	5e                   	pop    %esi
+    popl %ebx
+ 7bd:	5b                   	pop    %ebx
+    ret
+ 7be:	c3                   	ret
+
+000007bf <sepcheck>:
+
+# Set sysmode from cpuid's SEP flag.    Preserves %eax.
+sepcheck:
+    pushl %eax
+ 7bf:	50                   	push   %eax
+    pushl %ebx
+ 7c0:	53                   	push   %ebx
+    movl $1, %eax
+ 7c1:	b8 01 00 00 00       	mov    $0x1,%eax
+    cpuid
+ 7c6:	0f a2                	cpuid
+    movl $-1, sysmode
+ 7c8:	c7 05 e8 11 00 00 ff 	movl   $0xffffffff,0x11e8
+ 7cf:	ff ff ff 
+    testl $0x800, %edx
+ 7d2:	f7 c2 00 08 00 00    	test   $0x800,%edx
+    jz 1f
+ 7d8:	74 0a                	je     7e4 <sepcheck+0x25>
+    movl $1, sysmode
+ 7da:	c7 05 e8 11 00 00 01 	movl   $0x1,0x11e8
+ 7e1:	00 00 00 
+1:
+    popl %ebx
+ 7e4:	5b                   	pop    %ebx
+    popl %eax
+ 7e5:	58                   	pop    %eax
+    ret
+ 7e6:	c3                   	ret
+
+000007e7 <fork>:
+
+SYSCALL(fork)
+ 7e7:	b8 01 00 00 00       	mov    $0x1,%eax
+ 7ec:	eb 9a                	jmp    788 <dosyscall>
+
+000007ee <exit>:
+SYSCALL(exit)
+ 7ee:	b8 02 00 00 00       	mov    $0x2,%eax
+ 7f3:	eb 93                	jmp    788 <dosyscall>
+
+000007f5 <wait>:
+SYSCALL(wait)
+ 7f5:	b8 03 00 00 00       	mov    $0x3,%eax
+ 7fa:	eb 8c                	jmp    788 <dosyscall>
+
+000007fc <pipe>:
+SYSCALL(pipe)
+ 7fc:	b8 04 00 00 00       	mov    $0x4,%eax
+ 801:	eb 85                	jmp    788 <dosyscall>
+
+00000803 <read>:
+SYSCALL(read)
+ 803:	b8 05 00 00 00       	mov    $0x5,%eax
+ 808:	e9 7b ff ff ff       	jmp    788 <dosyscall>
+
+0000080d <write>:
+SYSCALL(write)
+ 80d:	b8 10 00 00 00       	mov    $0x10,%eax
+ 812:	e9 71 ff ff ff       	jmp    788 <dosyscall>
+
+00000817 <close>:
+SYSCALL(close)
+ 817:	b8 15 00 00 00       	mov    $0x15,%eax
+ 81c:	e9 67 ff ff ff       	jmp    788 <dosyscall>
+
+00000821 <kill>:
+SYSCALL(kill)
+ 821:	b8 06 00 00 00       	mov    $0x6,%eax
+ 826:	e9 5d ff ff ff       	jmp    788 <dosyscall>
+
+0000082b <exec>:
+SYSCALL(exec)
+ 82b:	b8 07 00 00 00       	mov    $0x7,%eax
+ 830:	e9 53 ff ff ff       	jmp    788 <dosyscall>
+
+00000835 <open>:
+SYSCALL(open)
+ 835:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 83a:	e9 49 ff ff ff       	jmp    788 <dosyscall>
+
+0000083f <mknod>:
+SYSCALL(mknod)
+ 83f:	b8 11 00 00 00       	mov    $0x11,%eax
+ 844:	e9 3f ff ff ff       	jmp    788 <dosyscall>
+
+00000849 <unlink>:
+SYSCALL(unlink)
+ 849:	b8 12 00 00 00       	mov    $0x12,%eax
+ 84e:	e9 35 ff ff ff       	jmp    788 <dosyscall>
+
+00000853 <fstat>:
+SYSCALL(fstat)
+ 853:	b8 08 00 00 00       	mov    $0x8,%eax
+ 858:	e9 2b ff ff ff       	jmp    788 <dosyscall>
+
+0000085d <link>:
+SYSCALL(link)
+ 85d:	b8 13 00 00 00       	mov    $0x13,%eax
+ 862:	e9 21 ff ff ff       	jmp    788 <dosyscall>
+
+00000867 <mkdir>:
+SYSCALL(mkdir)
+ 867:	b8 14 00 00 00       	mov    $0x14,%eax
+ 86c:	e9 17 ff ff ff       	jmp    788 <dosyscall>
+
+00000871 <chdir>:
+SYSCALL(chdir)
+ 871:	b8 09 00 00 00       	mov    $0x9,%eax
+ 876:	e9 0d ff ff ff       	jmp    788 <dosyscall>
+
+0000087b <dup>:
+SYSCALL(dup)
+ 87b:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 880:	e9 03 ff ff ff       	jmp    788 <dosyscall>
+
+00000885 <getpid>:
+SYSCALL(getpid)
+ 885:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 88a:	e9 f9 fe ff ff       	jmp    788 <dosyscall>
+
+0000088f <sbrk>:
+SYSCALL(sbrk)
+ 88f:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 894:	e9 ef fe ff ff       	jmp    788 <dosyscall>
+
+00000899 <sleep>:
+SYSCALL(sleep)
+ 899:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 89e:	e9 e5 fe ff ff       	jmp    788 <dosyscall>
+
+000008a3 <uptime>:
+SYSCALL(uptime)
+ 8a3:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 8a8:	e9 db fe ff ff       	jmp    788 <dosyscall>
+
+000008ad <date>:
+SYSCALL(date)
+ 8ad:	b8 16 00 00 00       	mov    $0x16,%eax
+ 8b2:	e9 d1 fe ff ff       	jmp    788 <dosyscall>
+
+000008b7 <dup2>:
+SYSCALL(dup2)
+ 8b7:	b8 17 00 00 00       	mov    $0x17,%eax
+ 8bc:	e9 c7 fe ff ff       	jmp    788 <dosyscall>
+
+000008c1 <uffd>:
+SYSCALL(uffd)
+ 8c1:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 8c6:	e9 bd fe ff ff       	jmp    788 <dosyscall>
+
+000008cb <uffdregister>:
+SYSCALL(uffdregister)
+ 8cb:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 8d0:	e9 b3 fe ff ff       	jmp    788 <dosyscall>
+
+000008d5 <uffdcopy>:
+SYSCALL(uffdcopy)
+ 8d5:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 8da:	e9 a9 fe ff ff       	jmp    788 <dosyscall>
+
+000008df <getpriority>:
+SYSCALL(getpriority)
+ 8df:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 8e4:	e9 9f fe ff ff       	jmp    788 <dosyscall>
+
+000008e9 <setpriority>:
+SYSCALL(setpriority)
+ 8e9:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 8ee:	e9 95 fe ff ff       	jmp    788 <dosyscall>
+
+000008f3 <setweight>:
+SYSCALL(setweight)
+ 8f3:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 8f8:	e9 8b fe ff ff       	jmp    788 <dosyscall>
+
+000008fd <setgroup>:
+SYSCALL(setgroup)
+ 8fd:	b8 20 00 00 00       	mov    $0x20,%eax
+ 902:	e9 81 fe ff ff       	jmp    788 <dosyscall>
+
+00000907 <schedinfo>:
+SYSCALL(schedinfo)
+ 907:	b8 21 00 00 00       	mov    $0x21,%eax
+ 90c:	e9 77 fe ff ff       	jmp    788 <dosyscall>
+
+00000911 <nanosleep>:
+SYSCALL(nanosleep)
+ 911:	b8 22 00 00 00       	mov    $0x22,%eax
+ 916:	e9 6d fe ff ff       	jmp    788 <dosyscall>
+
+0000091b <clock_nanosleep>:
+SYSCALL(clock_nanosleep)
+ 91b:	b8 23 00 00 00       	mov    $0x23,%eax
+ 920:	e9 63 fe ff ff       	jmp    788 <dosyscall>
+
+00000925 <clock_gettime>:
+SYSCALL(clock_gettime)
+ 925:	b8 24 00 00 00       	mov    $0x24,%eax
+ 92a:	e9 59 fe ff ff       	jmp    788 <dosyscall>
+
+0000092f <sched_setaffinity>:
+SYSCALL(sched_setaffinity)
+ 92f:	b8 25 00 00 00       	mov    $0x25,%eax
+ 934:	e9 4f fe ff ff       	jmp    788 <dosyscall>
+
+00000939 <sched_getaffinity>:
+SYSCALL(sched_getaffinity)
+ 939:	b8 26 00 00 00       	mov    $0x26,%eax
+ 93e:	e9 45 fe ff ff       	jmp    788 <dosyscall>
+
+00000943 <irqaffinity>:
+SYSCALL(irqaffinity)
+ 943:	b8 27 00 00 00       	mov    $0x27,%eax
+ 948:	e9 3b fe ff ff       	jmp    788 <dosyscall>
+
+0000094d <getrusage>:
+SYSCALL(getrusage)
+ 94d:	b8 28 00 00 00       	mov    $0x28,%eax
+ 952:	e9 31 fe ff ff       	jmp    788 <dosyscall>
+
+00000957 <times>:
+SYSCALL(times)
+ 957:	b8 29 00 00 00       	mov    $0x29,%eax
+ 95c:	e9 27 fe ff ff       	jmp    788 <dosyscall>
+
+00000961 <schedlat>:
+SYSCALL(schedlat)
+ 961:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 966:	e9 1d fe ff ff       	jmp    788 <dosyscall>
+
+0000096b <sched_setscheduler>:
+SYSCALL(sched_setscheduler)
+ 96b:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 970:	e9 13 fe ff ff       	jmp    788 <dosyscall>
+
+00000975 <sched_getscheduler>:
+SYSCALL(sched_getscheduler)
+ 975:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 97a:	e9 09 fe ff ff       	jmp    788 <dosyscall>
+
+0000097f <sched_getparam>:
+SYSCALL(sched_getparam)
+ 97f:	b8 2d 00 00 00       	mov    $0x2d,%eax
+ 984:	e9 ff fd ff ff       	jmp    788 <dosyscall>
+
+00000989 <lockstat>:
+SYSCALL(lockstat)
+ 989:	b8 2e 00 00 00       	mov    $0x2e,%eax
+ 98e:	e9 f5 fd ff ff       	jmp    788 <dosyscall>
+
+00000993 <ioring_setup>:
+SYSCALL(ioring_setup)
+ 993:	b8 2f 00 00 00       	mov    $0x2f,%eax
+ 998:	e9 eb fd ff ff       	jmp    788 <dosyscall>
+
+0000099d <ioring_enter>:
+SYSCALL(ioring_enter)
+ 99d:	b8 30 00 00 00       	mov    $0x30,%eax
+ 9a2:	e9 e1 fd ff ff       	jmp    788 <dosyscall>
+
+000009a7 <readv>:
+SYSCALL(readv)
+ 9a7:	b8 31 00 00 00       	mov    $0x31,%eax
+ 9ac:	e9 d7 fd ff ff       	jmp    788 <dosyscall>
+
+000009b1 <writev>:
+SYSCALL(writev)
+ 9b1:	b8 32 00 00 00       	mov    $0x32,%eax
+ 9b6:	e9 cd fd ff ff       	jmp    788 <dosyscall>
+
+000009bb <pread>:
+SYSCALL(pread)
+ 9bb:	b8 33 00 00 00       	mov    $0x33,%eax
+ 9c0:	e9 c3 fd ff ff       	jmp    788 <dosyscall>
+
+000009c5 <pwrite>:
+SYSCALL(pwrite)
+ 9c5:	b8 34 00 00 00       	mov    $0x34,%eax
+ 9ca:	e9 b9 fd ff ff       	jmp    788 <dosyscall>
+
+000009cf <sendfile>:
+SYSCALL(sendfile)
+ 9cf:	b8 35 00 00 00       	mov    $0x35,%eax
+ 9d4:	e9 af fd ff ff       	jmp    788 <dosyscall>
+
+000009d9 <splice>:
+SYSCALL(splice)
+ 9d9:	b8 36 00 00 00       	mov    $0x36,%eax
+ 9de:	e9 a5 fd ff ff       	jmp    788 <dosyscall>
+
+000009e3 <sysstat>:
+SYSCALL(sysstat)
+ 9e3:	b8 37 00 00 00       	mov    $0x37,%eax
+ 9e8:	e9 9b fd ff ff       	jmp    788 <dosyscall>
+
+000009ed <strace>:
+SYSCALL(strace)
+ 9ed:	b8 38 00 00 00       	mov    $0x38,%eax
+ 9f2:	e9 91 fd ff ff       	jmp    788 <dosyscall>
+
+000009f7 <straceread>:
+SYSCALL(straceread)
+ 9f7:	b8 39 00 00 00       	mov    $0x39,%eax
+ 9fc:	e9 87 fd ff ff       	jmp    788 <dosyscall>
+
+00000a01 <alarm>:
+
+# alarm and rstoregs keep to int $T_SYSCALL: rstoregs restores
+# %ecx and %edx, which sysexit would clobber.
+.globl alarm
+    alarm:
+        pushl $rstoregs
+ a01:	68 11 0a 00 00       	push   $0xa11
+        movl $SYS_alarm, %eax
+ a06:	b8 18 00 00 00       	mov    $0x18,%eax
+        int $T_SYSCALL
+ a0b:	cd 40                	int    $0x40
+        add $0x04, %esp
+ a0d:	83 c4 04             	add    $0x4,%esp
+        ret
+ a10:	c3                   	ret
+
+00000a11 <rstoregs>:
+
+.globl rstoregs
+    rstoregs:
+        movl $SYS_rstoregs, %eax
+ a11:	b8 19 00 00 00       	mov    $0x19,%eax
+        int $T_SYSCALL
+ a16:	cd 40                	int    $0x40
+
+00000a18 <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ a18:	55                   	push   %ebp
+ a19:	89 e5                	mov    %esp,%ebp
+ a1b:	83 ec 18             	sub    $0x18,%esp
+ a1e:	8b 45 0c             	mov    0xc(%ebp),%eax
+ a21:	88 45 f4             	mov    %al,-0xc(%ebp)
+    write(fd, &c, 1);
+ a24:	83 ec 04             	sub    $0x4,%esp
+ a27:	6a 01                	push   $0x1
+ a29:	8d 45 f4             	lea    -0xc(%ebp),%eax
+ a2c:	50                   	push   %eax
+ a2d:	ff 75 08             	push   0x8(%ebp)
+ a30:	e8 d8 fd ff ff       	call   80d <write>
+ a35:	83 c4 10             	add    $0x10,%esp
+}
+ a38:	90                   	nop
+ a39:	c9                   	leave
+ a3a:	c3                   	ret
+
+00000a3b <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ a3b:	55                   	push   %ebp
+ a3c:	89 e5                	mov    %esp,%ebp
+ a3e:	83 ec 28             	sub    $0x28,%esp
+    static char digits[] = "0123456789ABCDEF";
+    char buf[16];
+    int i, neg;
+    uint x;
+
+    neg = 0;
+ a41:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+    if(sgn && xx < 0){
+ a48:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+ a4c:	74 17                	je     a65 <printint+0x2a>
+ a4e:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ a52:	79 11                	jns    a65 <printint+0x2a>
+        neg = 1;
+ a54:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+        x = -xx;
+ a5b:	8b 45 0c             	mov    0xc(%ebp),%eax
+ a5e:	f7 d8                	neg    %eax
+ a60:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ a63:	eb 06                	jmp    a6b <printint+0x30>
+    } else {
+        x = xx;
+ a65:	8b 45 0c             	mov    0xc(%ebp),%eax
+ a68:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    }
+
+    i = 0;
+ a6b:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    do{
+        buf[i++] = digits[x % base];
+ a72:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ a75:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ a78:	ba 00 00 00 00       	mov    $0x0,%edx
+ a7d:	f7 f1                	div    %ecx
+ a7f:	89 d1                	mov    %edx,%ecx
+ a81:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a84:	8d 50 01             	lea    0x1(%eax),%edx
+ a87:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ a8a:	0f b6 91 ec 11 00 00 	movzbl 0x11ec(%ecx),%edx
+ a91:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+    }while((x /= base) != 0);
+ a95:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ a98:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ a9b:	ba 00 00 00 00       	mov    $0x0,%edx
+ aa0:	f7 f1                	div    %ecx
+ aa2:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ aa5:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ aa9:	75 c7                	jne    a72 <printint+0x37>
+    if(neg)
+ aab:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ aaf:	74 2d                	je     ade <printint+0xa3>
+        buf[i++] = '-';
+ ab1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ ab4:	8d 50 01             	lea    0x1(%eax),%edx
+ ab7:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ aba:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+    while(--i >= 0)
+ abf:	eb 1d                	jmp    ade <printint+0xa3>
+        putc(fd, buf[i]);
+ ac1:	8d 55 dc             	lea    -0x24(%ebp),%edx
+ ac4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ ac7:	01 d0                	add    %edx,%eax
+ ac9:	0f b6 00             	movzbl (%eax),%eax
+ acc:	0f be c0             	movsbl %al,%eax
+ acf:	83 ec 08             	sub    $0x8,%esp
+ ad2:	50                   	push   %eax
+ ad3:	ff 75 08             	push   0x8(%ebp)
+ ad6:	e8 3d ff ff ff       	call   a18 <putc>
+ adb:	83 c4 10             	add    $0x10,%esp
+    while(--i >= 0)
+ ade:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+ ae2:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ ae6:	79 d9                	jns    ac1 <printint+0x86>
+}
+ ae8:	90                   	nop
+ ae9:	90                   	nop
+ aea:	c9                   	leave
+ aeb:	c3                   	ret
+
+00000aec <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ aec:	55                   	push   %ebp
+ aed:	89 e5                	mov    %esp,%ebp
+ aef:	83 ec 28             	sub    $0x28,%esp
+    char *s;
+    int c, i, state;
+    uint *ap;
+
+    state = 0;
+ af2:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+    ap = (uint*)(void*)&fmt + 1;
+ af9:	8d 45 0c             	lea    0xc(%ebp),%eax
+ afc:	83 c0 04             	add    $0x4,%eax
+ aff:	89 45 e8             	mov    %eax,-0x18(%ebp)
+    for(i = 0; fmt[i]; i++){
+ b02:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ b09:	e9 59 01 00 00       	jmp    c67 <printf+0x17b>
+        c = fmt[i] & 0xff;
+ b0e:	8b 55 0c             	mov    0xc(%ebp),%edx
+ b11:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ b14:	01 d0                	add    %edx,%eax
+ b16:	0f b6 00             	movzbl (%eax),%eax
+ b19:	0f be c0             	movsbl %al,%eax
+ b1c:	25 ff 00 00 00       	and    $0xff,%eax
+ b21:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        if(state == 0){
+ b24:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ b28:	75 2c                	jne    b56 <printf+0x6a>
+            if(c == '%'){
+ b2a:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ b2e:	75 0c                	jne    b3c <printf+0x50>
+                state = '%';
+ b30:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+ b37:	e9 27 01 00 00       	jmp    c63 <printf+0x177>
+            } else {
+                putc(fd, c);
+ b3c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ b3f:	0f be c0             	movsbl %al,%eax
+ b42:	83 ec 08             	sub    $0x8,%esp
+ b45:	50                   	push   %eax
+ b46:	ff 75 08             	push   0x8(%ebp)
+ b49:	e8 ca fe ff ff       	call   a18 <putc>
+ b4e:	83 c4 10             	add    $0x10,%esp
+ b51:	e9 0d 01 00 00       	jmp    c63 <printf+0x177>
+            }
+        } else if(state == '%'){
+ b56:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+ b5a:	0f 85 03 01 00 00    	jne    c63 <printf+0x177>
+            if(c == 'd'){
+ b60:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+ b64:	75 1e                	jne    b84 <printf+0x98>
+                printint(fd, *ap, 10, 1);
+ b66:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ b69:	8b 00                	mov    (%eax),%eax
+ b6b:	6a 01                	push   $0x1
+ b6d:	6a 0a                	push   $0xa
+ b6f:	50                   	push   %eax
+ b70:	ff 75 08             	push   0x8(%ebp)
+ b73:	e8 c3 fe ff ff       	call   a3b <printint>
+ b78:	83 c4 10             	add    $0x10,%esp
+                ap++;
+ b7b:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ b7f:	e9 d8 00 00 00       	jmp    c5c <printf+0x170>
+            } else if(c == 'x' || c == 'p'){
+ b84:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+ b88:	74 06                	je     b90 <printf+0xa4>
+ b8a:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+ b8e:	75 1e                	jne    bae <printf+0xc2>
+                printint(fd, *ap, 16, 0);
+ b90:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ b93:	8b 00                	mov    (%eax),%eax
+ b95:	6a 00                	push   $0x0
+ b97:	6a 10                	push   $0x10
+ b99:	50                   	push   %eax
+ b9a:	ff 75 08             	push   0x8(%ebp)
+ b9d:	e8 99 fe ff ff       	call   a3b <printint>
+ ba2:	83 c4 10             	add    $0x10,%esp
+                ap++;
+ ba5:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ ba9:	e9 ae 00 00 00       	jmp    c5c <printf+0x170>
+            } else if(c == 's'){
+ bae:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+ bb2:	75 43                	jne    bf7 <printf+0x10b>
+                s = (char*)*ap;
+ bb4:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ bb7:	8b 00                	mov    (%eax),%eax
+ bb9:	89 45 f4             	mov    %eax,-0xc(%ebp)
+                ap++;
+ bbc:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+                if(s == 0)
+ bc0:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ bc4:	75 25                	jne    beb <printf+0xff>
+                    s = "(null)";
+ bc6:	c7 45 f4 26 0f 00 00 	movl   $0xf26,-0xc(%ebp)
+                while(*s != 0){
+ bcd:	eb 1c                	jmp    beb <printf+0xff>
+                    putc(fd, *s);
+ bcf:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ bd2:	0f b6 00             	movzbl (%eax),%eax
+ bd5:	0f be c0             	movsbl %al,%eax
+ bd8:	83 ec 08             	sub    $0x8,%esp
+ bdb:	50                   	push   %eax
+ bdc:	ff 75 08             	push   0x8(%ebp)
+ bdf:	e8 34 fe ff ff       	call   a18 <putc>
+ be4:	83 c4 10             	add    $0x10,%esp
+                    s++;
+ be7:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+                while(*s != 0){
+ beb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ bee:	0f b6 00             	movzbl (%eax),%eax
+ bf1:	84 c0                	test   %al,%al
+ bf3:	75 da                	jne    bcf <printf+0xe3>
+ bf5:	eb 65                	jmp    c5c <printf+0x170>
+                }
+            } else if(c == 'c'){
+ bf7:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+ bfb:	75 1d                	jne    c1a <printf+0x12e>
+                putc(fd, *ap);
+ bfd:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ c00:	8b 00                	mov    (%eax),%eax
+ c02:	0f be c0             	movsbl %al,%eax
+ c05:	83 ec 08             	sub    $0x8,%esp
+ c08:	50                   	push   %eax
+ c09:	ff 75 08             	push   0x8(%ebp)
+ c0c:	e8 07 fe ff ff       	call   a18 <putc>
+ c11:	83 c4 10             	add    $0x10,%esp
+                ap++;
+ c14:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ c18:	eb 42                	jmp    c5c <printf+0x170>
+            } else if(c == '%'){
+ c1a:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ c1e:	75 17                	jne    c37 <printf+0x14b>
+                putc(fd, c);
+ c20:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ c23:	0f be c0             	movsbl %al,%eax
+ c26:	83 ec 08             	sub    $0x8,%esp
+ c29:	50                   	push   %eax
+ c2a:	ff 75 08             	push   0x8(%ebp)
+ c2d:	e8 e6 fd ff ff       	call   a18 <putc>
+ c32:	83 c4 10             	add    $0x10,%esp
+ c35:	eb 25                	jmp    c5c <printf+0x170>
+            } else {
+                // Unknown % sequence.    Print it to draw attention.
+                putc(fd, '%');
+ c37:	83 ec 08             	sub    $0x8,%esp
+ c3a:	6a 25                	push   $0x25
+ c3c:	ff 75 08             	push   0x8(%ebp)
+ c3f:	e8 d4 fd ff ff       	call   a18 <putc>
+ c44:	83 c4 10             	add    $0x10,%esp
+                putc(fd, c);
+ c47:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ c4a:	0f be c0             	movsbl %al,%eax
+ c4d:	83 ec 08             	sub    $0x8,%esp
+ c50:	50                   	push   %eax
+ c51:	ff 75 08             	push   0x8(%ebp)
+ c54:	e8 bf fd ff ff       	call   a18 <putc>
+ c59:	83 c4 10             	add    $0x10,%esp
+            }
+            state = 0;
+ c5c:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+    for(i = 0; fmt[i]; i++){
+ c63:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ c67:	8b 55 0c             	mov    0xc(%ebp),%edx
+ c6a:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ c6d:	01 d0                	add    %edx,%eax
+ c6f:	0f b6 00             	movzbl (%eax),%eax
+ c72:	84 c0                	test   %al,%al
+ c74:	0f 85 94 fe ff ff    	jne    b0e <printf+0x22>
+        }
+    }
+}
+ c7a:	90                   	nop
+ c7b:	90                   	nop
+ c7c:	c9                   	leave
+ c7d:	c3                   	ret
+
+00000c7e <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ c7e:	55                   	push   %ebp
+ c7f:	89 e5                	mov    %esp,%ebp
+ c81:	83 ec 10             	sub    $0x10,%esp
+    Header *bp, *p;
+
+    bp = (Header*)ap - 1;
+ c84:	8b 45 08             	mov    0x8(%ebp),%eax
+ c87:	83 e8 08             	sub    $0x8,%eax
+ c8a:	89 45 f8             	mov    %eax,-0x8(%ebp)
+    for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ c8d:	a1 08 25 00 00       	mov    0x2508,%eax
+ c92:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ c95:	eb 24                	jmp    cbb <free+0x3d>
+        if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ c97:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ c9a:	8b 00                	mov    (%eax),%eax
+ c9c:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ c9f:	72 12                	jb     cb3 <free+0x35>
+ ca1:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ ca4:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ ca7:	72 24                	jb     ccd <free+0x4f>
+ ca9:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ cac:	8b 00                	mov    (%eax),%eax
+ cae:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ cb1:	72 1a                	jb     ccd <free+0x4f>
+    for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ cb3:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ cb6:	8b 00                	mov    (%eax),%eax
+ cb8:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ cbb:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ cbe:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ cc1:	73 d4                	jae    c97 <free+0x19>
+ cc3:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ cc6:	8b 00                	mov    (%eax),%eax
+ cc8:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ ccb:	73 ca                	jae    c97 <free+0x19>
+            break;
+    if(bp + bp->s.size == p->s.ptr){
+ ccd:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ cd0:	8b 40 04             	mov    0x4(%eax),%eax
+ cd3:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ cda:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ cdd:	01 c2                	add    %eax,%edx
+ cdf:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ ce2:	8b 00                	mov    (%eax),%eax
+ ce4:	39 c2                	cmp    %eax,%edx
+ ce6:	75 24                	jne    d0c <free+0x8e>
+        bp->s.size += p->s.ptr->s.size;
+ ce8:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ ceb:	8b 50 04             	mov    0x4(%eax),%edx
+ cee:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ cf1:	8b 00                	mov    (%eax),%eax
+ cf3:	8b 40 04             	mov    0x4(%eax),%eax
+ cf6:	01 c2                	add    %eax,%edx
+ cf8:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ cfb:	89 50 04             	mov    %edx,0x4(%eax)
+        bp->s.ptr = p->s.ptr->s.ptr;
+ cfe:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ d01:	8b 00                	mov    (%eax),%eax
+ d03:	8b 10                	mov    (%eax),%edx
+ d05:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ d08:	89 10                	mov    %edx,(%eax)
+ d0a:	eb 0a                	jmp    d16 <free+0x98>
+    } else
+        bp->s.ptr = p->s.ptr;
+ d0c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ d0f:	8b 10                	mov    (%eax),%edx
+ d11:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ d14:	89 10                	mov    %edx,(%eax)
+    if(p + p->s.size == bp){
+ d16:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ d19:	8b 40 04             	mov    0x4(%eax),%eax
+ d1c:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ d23:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ d26:	01 d0                	add    %edx,%eax
+ d28:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ d2b:	75 20                	jne    d4d <free+0xcf>
+        p->s.size += bp->s.size;
+ d2d:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ d30:	8b 50 04             	mov    0x4(%eax),%edx
+ d33:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ d36:	8b 40 04             	mov    0x4(%eax),%eax
+ d39:	01 c2                	add    %eax,%edx
+ d3b:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ d3e:	89 50 04             	mov    %edx,0x4(%eax)
+        p->s.ptr = bp->s.ptr;
+ d41:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ d44:	8b 10                	mov    (%eax),%edx
+ d46:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ d49:	89 10                	mov    %edx,(%eax)
+ d4b:	eb 08                	jmp    d55 <free+0xd7>
+    } else
+        p->s.ptr = bp;
+ d4d:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ d50:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ d53:	89 10                	mov    %edx,(%eax)
+    freep = p;
+ d55:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ d58:	a3 08 25 00 00       	mov    %eax,0x2508
+}
+ d5d:	90                   	nop
+ d5e:	c9                   	leave
+ d5f:	c3                   	ret
+
+00000d60 <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+ d60:	55                   	push   %ebp
+ d61:	89 e5                	mov    %esp,%ebp
+ d63:	83 ec 18             	sub    $0x18,%esp
+    char *p;
+    Header *hp;
+
+    if(nu < 4096)
+ d66:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+ d6d:	77 07                	ja     d76 <morecore+0x16>
+        nu = 4096;
+ d6f:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+    p = sbrk(nu * sizeof(Header));
+ d76:	8b 45 08             	mov    0x8(%ebp),%eax
+ d79:	c1 e0 03             	shl    $0x3,%eax
+ d7c:	83 ec 0c             	sub    $0xc,%esp
+ d7f:	50                   	push   %eax
+ d80:	e8 0a fb ff ff       	call   88f <sbrk>
+ d85:	83 c4 10             	add    $0x10,%esp
+ d88:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p == (char*)-1)
+ d8b:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+ d8f:	75 07                	jne    d98 <morecore+0x38>
+        return 0;
+ d91:	b8 00 00 00 00       	mov    $0x0,%eax
+ d96:	eb 26                	jmp    dbe <morecore+0x5e>
+    hp = (Header*)p;
+ d98:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ d9b:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    hp->s.size = nu;
+ d9e:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ da1:	8b 55 08             	mov    0x8(%ebp),%edx
+ da4:	89 50 04             	mov    %edx,0x4(%eax)
+    free((void*)(hp + 1));
+ da7:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ daa:	83 c0 08             	add    $0x8,%eax
+ dad:	83 ec 0c             	sub    $0xc,%esp
+ db0:	50                   	push   %eax
+ db1:	e8 c8 fe ff ff       	call   c7e <free>
+ db6:	83 c4 10             	add    $0x10,%esp
+    return freep;
+ db9:	a1 08 25 00 00       	mov    0x2508,%eax
+}
+ dbe:	c9                   	leave
+ dbf:	c3                   	ret
+
+00000dc0 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ dc0:	55                   	push   %ebp
+ dc1:	89 e5                	mov    %esp,%ebp
+ dc3:	83 ec 18             	sub    $0x18,%esp
+    Header *p, *prevp;
+    uint nunits;
+
+    nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ dc6:	8b 45 08             	mov    0x8(%ebp),%eax
+ dc9:	83 c0 07             	add    $0x7,%eax
+ dcc:	c1 e8 03             	shr    $0x3,%eax
+ dcf:	83 c0 01             	add    $0x1,%eax
+ dd2:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    if((prevp = freep) == 0){
+ dd5:	a1 08 25 00 00       	mov    0x2508,%eax
+ dda:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ ddd:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ de1:	75 23                	jne    e06 <malloc+0x46>
+        base.s.ptr = freep = prevp = &base;
+ de3:	c7 45 f0 00 25 00 00 	movl   $0x2500,-0x10(%ebp)
+ dea:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ ded:	a3 08 25 00 00       	mov    %eax,0x2508
+ df2:	a1 08 25 00 00       	mov    0x2508,%eax
+ df7:	a3 00 25 00 00       	mov    %eax,0x2500
+        base.s.size = 0;
+ dfc:	c7 05 04 25 00 00 00 	movl   $0x0,0x2504
+ e03:	00 00 00 
+    }
+    for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ e06:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ e09:	8b 00                	mov    (%eax),%eax
+ e0b:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        if(p->s.size >= nunits){
+ e0e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ e11:	8b 40 04             	mov    0x4(%eax),%eax
+ e14:	3b 45 ec             	cmp    -0x14(%ebp),%eax
+ e17:	72 4d                	jb     e66 <malloc+0xa6>
+            if(p->s.size == nunits)
+ e19:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ e1c:	8b 40 04             	mov    0x4(%eax),%eax
+ e1f:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+ e22:	75 0c                	jne    e30 <malloc+0x70>
+                prevp->s.ptr = p->s.ptr;
+ e24:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ e27:	8b 10                	mov    (%eax),%edx
+ e29:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ e2c:	89 10                	mov    %edx,(%eax)
+ e2e:	eb 26                	jmp    e56 <malloc+0x96>
+            else {
+                p->s.size -= nunits;
+ e30:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ e33:	8b 40 04             	mov    0x4(%eax),%eax
+ e36:	2b 45 ec             	sub    -0x14(%ebp),%eax
+ e39:	89 c2                	mov    %eax,%edx
+ e3b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ e3e:	89 50 04             	mov    %edx,0x4(%eax)
+                p += p->s.size;
+ e41:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ e44:	8b 40 04             	mov    0x4(%eax),%eax
+ e47:	c1 e0 03             	shl    $0x3,%eax
+ e4a:	01 45 f4             	add    %eax,-0xc(%ebp)
+                p->s.size = nunits;
+ e4d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ e50:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ e53:	89 50 04             	mov    %edx,0x4(%eax)
+            }
+            freep = prevp;
+ e56:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ e59:	a3 08 25 00 00       	mov    %eax,0x2508
+            return (void*)(p + 1);
+ e5e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ e61:	83 c0 08             	add    $0x8,%eax
+ e64:	eb 3b                	jmp    ea1 <malloc+0xe1>
+        }
+        if(p == freep)
+ e66:	a1 08 25 00 00       	mov    0x2508,%eax
+ e6b:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ e6e:	75 1e                	jne    e8e <malloc+0xce>
+            if((p = morecore(nunits)) == 0)
+ e70:	83 ec 0c             	sub    $0xc,%esp
+ e73:	ff 75 ec             	push   -0x14(%ebp)
+ e76:	e8 e5 fe ff ff       	call   d60 <morecore>
+ e7b:	83 c4 10             	add    $0x10,%esp
+ e7e:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ e81:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ e85:	75 07                	jne    e8e <malloc+0xce>
+                return 0;
+ e87:	b8 00 00 00 00       	mov    $0x0,%eax
+ e8c:	eb 13                	jmp    ea1 <malloc+0xe1>
+    for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ e8e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ e91:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ e94:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ e97:	8b 00                	mov    (%eax),%eax
+ e99:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        if(p->s.size >= nunits){
+ e9c:	e9 6d ff ff ff       	jmp    e0e <malloc+0x4e>
+    }
+}
+ ea1:	c9                   	leave
+ ea2:	c3                   	ret
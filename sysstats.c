@@ -0,0 +1,112 @@
+// Report system call counts and latencies.
+//
+//    sysstats                 print the counts of all processes
+//    sysstats -p pid          print those of process pid
+//    sysstats on|off|reset    start, stop or zero the counting
+//    sysstats cmd [arg...]    count while cmd runs, then print
+//
+// Times are in TSC cycles.  Each call's histogram is printed as the
+// lower bound of each non-empty bucket, in log2 cycles, and its count.
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "sysstat.h"
+
+struct sysstat stats[NSYSCALL];
+
+// Print v in decimal.    There is no 64-bit division here, so
+// divide by 10 sixteen bits at a time.
+void
+printu64(uint64 v)
+{
+    ushort w[4];
+    char buf[24];
+    uint r, more;
+    int i, n;
+
+    for(i = 0; i < 4; i++)
+        w[i] = v >> (48 - 16*i);
+    n = sizeof(buf) - 1;
+    buf[n] = 0;
+    do {
+        r = 0;
+        more = 0;
+        for(i = 0; i < 4; i++){
+            r = (r << 16) | w[i];
+            w[i] = r / 10;
+            r %= 10;
+            more |= w[i];
+        }
+        buf[--n] = '0' + r;
+    } while(more);
+    printf(1, "%s", buf + n);
+}
+
+// Print the calls that were made, most time first.
+void
+report(int pid)
+{
+    struct sysstat t;
+    int i, j, n;
+
+    if((n = sysstat(SYSSTAT_READ, pid, stats, NSYSCALL)) < 0){
+        printf(2, "sysstats: no process %d\n", pid);
+        exit();
+    }
+    for(i = 0; i < n; i++){
+        for(j = i+1; j < n; j++){
+            if(stats[j].cycles > stats[i].cycles){
+                t = stats[i];
+                stats[i] = stats[j];
+                stats[j] = t;
+            }
+        }
+    }
+    for(i = 0; i < n && stats[i].count; i++){
+        printf(1, "%s: %d calls, ", stats[i].name, stats[i].count);
+        printu64(stats[i].cycles);
+        printf(1, " cycles\n   ");
+        for(j = 0; j < NSYSBUCKET; j++)
+            if(stats[i].hist[j])
+                printf(1, " 2^%d:%d", 8 + 2*j, stats[i].hist[j]);
+        printf(1, "\n");
+    }
+}
+
+int
+main(int argc, char *argv[])
+{
+    int pid;
+
+    if(argc < 2){
+        report(0);
+        exit();
+    }
+    if(strcmp(argv[1], "-p") == 0 && argc > 2)
+        report(atoi(argv[2]));
+    else if(strcmp(argv[1], "on") == 0)
+        sysstat(SYSSTAT_ON, 0, 0, 0);
+    else if(strcmp(argv[1], "off") == 0)
+        sysstat(SYSSTAT_OFF, 0, 0, 0);
+    else if(strcmp(argv[1], "reset") == 0)
+        sysstat(SYSSTAT_RESET, 0, 0, 0);
+    else {
+        sysstat(SYSSTAT_RESET, 0, 0, 0);
+        sysstat(SYSSTAT_ON, 0, 0, 0);
+        pid = fork();
+        if(pid < 0){
+            printf(2, "sysstats: fork failed\n");
+            exit();
+        }
+        if(pid == 0){
+            exec(argv[1], argv + 1);
+            printf(2, "sysstats: exec %s failed\n", argv[1]);
+            exit();
+        }
+        wait();
+        sysstat(SYSSTAT_OFF, 0, 0, 0);
+        report(0);
+    }
+    exit();
+}
@@ -0,0 +1,1683 @@
+
+_taskset:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <parsemask>:
+#include "stat.h"
+#include "user.h"
+
+uint
+parsemask(char *s)
+{
+   0:	55                   	push   %ebp
+   1:	89 e5                	mov    %esp,%ebp
+   3:	83 ec 18             	sub    $0x18,%esp
+    uint n;
+
+    if(s[0] != '0' || (s[1] != 'x' && s[1] != 'X'))
+   6:	8b 45 08             	mov    0x8(%ebp),%eax
+   9:	0f b6 00             	movzbl (%eax),%eax
+   c:	3c 30                	cmp    $0x30,%al
+   e:	75 1a                	jne    2a <parsemask+0x2a>
+  10:	8b 45 08             	mov    0x8(%ebp),%eax
+  13:	83 c0 01             	add    $0x1,%eax
+  16:	0f b6 00             	movzbl (%eax),%eax
+  19:	3c 78                	cmp    $0x78,%al
+  1b:	74 20                	je     3d <parsemask+0x3d>
+  1d:	8b 45 08             	mov    0x8(%ebp),%eax
+  20:	83 c0 01             	add    $0x1,%eax
+  23:	0f b6 00             	movzbl (%eax),%eax
+  26:	3c 58                	cmp    $0x58,%al
+  28:	74 13                	je     3d <parsemask+0x3d>
+        return atoi(s);
+  2a:	83 ec 0c             	sub    $0xc,%esp
+  2d:	ff 75 08             	push   0x8(%ebp)
+  30:	e8 8d 04 00 00       	call   4c2 <atoi>
+  35:	83 c4 10             	add    $0x10,%esp
+  38:	e9 b0 00 00 00       	jmp    ed <parsemask+0xed>
+    n = 0;
+  3d:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    for(s += 2; *s; s++){
+  44:	83 45 08 02          	addl   $0x2,0x8(%ebp)
+  48:	e9 8f 00 00 00       	jmp    dc <parsemask+0xdc>
+        if('0' <= *s && *s <= '9')
+  4d:	8b 45 08             	mov    0x8(%ebp),%eax
+  50:	0f b6 00             	movzbl (%eax),%eax
+  53:	3c 2f                	cmp    $0x2f,%al
+  55:	7e 25                	jle    7c <parsemask+0x7c>
+  57:	8b 45 08             	mov    0x8(%ebp),%eax
+  5a:	0f b6 00             	movzbl (%eax),%eax
+  5d:	3c 39                	cmp    $0x39,%al
+  5f:	7f 1b                	jg     7c <parsemask+0x7c>
+            n = n*16 + *s - '0';
+  61:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  64:	c1 e0 04             	shl    $0x4,%eax
+  67:	89 c2                	mov    %eax,%edx
+  69:	8b 45 08             	mov    0x8(%ebp),%eax
+  6c:	0f b6 00             	movzbl (%eax),%eax
+  6f:	0f be c0             	movsbl %al,%eax
+  72:	01 d0                	add    %edx,%eax
+  74:	83 e8 30             	sub    $0x30,%eax
+  77:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  7a:	eb 5c                	jmp    d8 <parsemask+0xd8>
+        else if('a' <= *s && *s <= 'f')
+  7c:	8b 45 08             	mov    0x8(%ebp),%eax
+  7f:	0f b6 00             	movzbl (%eax),%eax
+  82:	3c 60                	cmp    $0x60,%al
+  84:	7e 25                	jle    ab <parsemask+0xab>
+  86:	8b 45 08             	mov    0x8(%ebp),%eax
+  89:	0f b6 00             	movzbl (%eax),%eax
+  8c:	3c 66                	cmp    $0x66,%al
+  8e:	7f 1b                	jg     ab <parsemask+0xab>
+            n = n*16 + *s - 'a' + 10;
+  90:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  93:	c1 e0 04             	shl    $0x4,%eax
+  96:	89 c2                	mov    %eax,%edx
+  98:	8b 45 08             	mov    0x8(%ebp),%eax
+  9b:	0f b6 00             	movzbl (%eax),%eax
+  9e:	0f be c0             	movsbl %al,%eax
+  a1:	01 d0                	add    %edx,%eax
+  a3:	83 e8 57             	sub    $0x57,%eax
+  a6:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  a9:	eb 2d                	jmp    d8 <parsemask+0xd8>
+        else if('A' <= *s && *s <= 'F')
+  ab:	8b 45 08             	mov    0x8(%ebp),%eax
+  ae:	0f b6 00             	movzbl (%eax),%eax
+  b1:	3c 40                	cmp    $0x40,%al
+  b3:	7e 35                	jle    ea <parsemask+0xea>
+  b5:	8b 45 08             	mov    0x8(%ebp),%eax
+  b8:	0f b6 00             	movzbl (%eax),%eax
+  bb:	3c 46                	cmp    $0x46,%al
+  bd:	7f 2b                	jg     ea <parsemask+0xea>
+            n = n*16 + *s - 'A' + 10;
+  bf:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  c2:	c1 e0 04             	shl    $0x4,%eax
+  c5:	89 c2                	mov    %eax,%edx
+  c7:	8b 45 08             	mov    0x8(%ebp),%eax
+  ca:	0f b6 00             	movzbl (%eax),%eax
+  cd:	0f be c0             	movsbl %al,%eax
+  d0:	01 d0                	add    %edx,%eax
+  d2:	83 e8 37             	sub    $0x37,%eax
+  d5:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    for(s += 2; *s; s++){
+  d8:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+  dc:	8b 45 08             	mov    0x8(%ebp),%eax
+  df:	0f b6 00             	movzbl (%eax),%eax
+  e2:	84 c0                	test   %al,%al
+  e4:	0f 85 63 ff ff ff    	jne    4d <parsemask+0x4d>
+        else
+            break;
+    }
+    return n;
+  ea:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+  ed:	c9                   	leave
+  ee:	c3                   	ret
+
+000000ef <usage>:
+
+void
+usage(void)
+{
+  ef:	55                   	push   %ebp
+  f0:	89 e5                	mov    %esp,%ebp
+  f2:	83 ec 08             	sub    $0x8,%esp
+    printf(2, "usage: taskset mask cmd [arg...]\n"
+  f5:	83 ec 08             	sub    $0x8,%esp
+  f8:	68 bc 0c 00 00       	push   $0xcbc
+  fd:	6a 02                	push   $0x2
+  ff:	e8 01 08 00 00       	call   905 <printf>
+ 104:	83 c4 10             	add    $0x10,%esp
+        "       taskset -p pid [mask]\n"
+        "       taskset -i irq cpu\n");
+    exit();
+ 107:	e8 fb 04 00 00       	call   607 <exit>
+
+0000010c <main>:
+}
+
+int
+main(int argc, char *argv[])
+{
+ 10c:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+ 110:	83 e4 f0             	and    $0xfffffff0,%esp
+ 113:	ff 71 fc             	push   -0x4(%ecx)
+ 116:	55                   	push   %ebp
+ 117:	89 e5                	mov    %esp,%ebp
+ 119:	56                   	push   %esi
+ 11a:	53                   	push   %ebx
+ 11b:	51                   	push   %ecx
+ 11c:	83 ec 1c             	sub    $0x1c,%esp
+ 11f:	89 cb                	mov    %ecx,%ebx
+    int pid, mask;
+
+    if(argc < 3)
+ 121:	83 3b 02             	cmpl   $0x2,(%ebx)
+ 124:	7f 05                	jg     12b <main+0x1f>
+        usage();
+ 126:	e8 c4 ff ff ff       	call   ef <usage>
+    if(strcmp(argv[1], "-i") == 0){
+ 12b:	8b 43 04             	mov    0x4(%ebx),%eax
+ 12e:	83 c0 04             	add    $0x4,%eax
+ 131:	8b 00                	mov    (%eax),%eax
+ 133:	83 ec 08             	sub    $0x8,%esp
+ 136:	68 15 0d 00 00       	push   $0xd15
+ 13b:	50                   	push   %eax
+ 13c:	e8 12 02 00 00       	call   353 <strcmp>
+ 141:	83 c4 10             	add    $0x10,%esp
+ 144:	85 c0                	test   %eax,%eax
+ 146:	75 6b                	jne    1b3 <main+0xa7>
+        if(argc != 4)
+ 148:	83 3b 04             	cmpl   $0x4,(%ebx)
+ 14b:	74 05                	je     152 <main+0x46>
+            usage();
+ 14d:	e8 9d ff ff ff       	call   ef <usage>
+        if(irqaffinity(atoi(argv[2]), atoi(argv[3])) < 0)
+ 152:	8b 43 04             	mov    0x4(%ebx),%eax
+ 155:	83 c0 0c             	add    $0xc,%eax
+ 158:	8b 00                	mov    (%eax),%eax
+ 15a:	83 ec 0c             	sub    $0xc,%esp
+ 15d:	50                   	push   %eax
+ 15e:	e8 5f 03 00 00       	call   4c2 <atoi>
+ 163:	83 c4 10             	add    $0x10,%esp
+ 166:	89 c6                	mov    %eax,%esi
+ 168:	8b 43 04             	mov    0x4(%ebx),%eax
+ 16b:	83 c0 08             	add    $0x8,%eax
+ 16e:	8b 00                	mov    (%eax),%eax
+ 170:	83 ec 0c             	sub    $0xc,%esp
+ 173:	50                   	push   %eax
+ 174:	e8 49 03 00 00       	call   4c2 <atoi>
+ 179:	83 c4 10             	add    $0x10,%esp
+ 17c:	83 ec 08             	sub    $0x8,%esp
+ 17f:	56                   	push   %esi
+ 180:	50                   	push   %eax
+ 181:	e8 d6 05 00 00       	call   75c <irqaffinity>
+ 186:	83 c4 10             	add    $0x10,%esp
+ 189:	85 c0                	test   %eax,%eax
+ 18b:	79 21                	jns    1ae <main+0xa2>
+            printf(2, "taskset: cannot route irq %s to cpu %s\n", argv[2], argv[3]);
+ 18d:	8b 43 04             	mov    0x4(%ebx),%eax
+ 190:	83 c0 0c             	add    $0xc,%eax
+ 193:	8b 10                	mov    (%eax),%edx
+ 195:	8b 43 04             	mov    0x4(%ebx),%eax
+ 198:	83 c0 08             	add    $0x8,%eax
+ 19b:	8b 00                	mov    (%eax),%eax
+ 19d:	52                   	push   %edx
+ 19e:	50                   	push   %eax
+ 19f:	68 18 0d 00 00       	push   $0xd18
+ 1a4:	6a 02                	push   $0x2
+ 1a6:	e8 5a 07 00 00       	call   905 <printf>
+ 1ab:	83 c4 10             	add    $0x10,%esp
+        exit();
+ 1ae:	e8 54 04 00 00       	call   607 <exit>
+    }
+    if(strcmp(argv[1], "-p") == 0){
+ 1b3:	8b 43 04             	mov    0x4(%ebx),%eax
+ 1b6:	83 c0 04             	add    $0x4,%eax
+ 1b9:	8b 00                	mov    (%eax),%eax
+ 1bb:	83 ec 08             	sub    $0x8,%esp
+ 1be:	68 40 0d 00 00       	push   $0xd40
+ 1c3:	50                   	push   %eax
+ 1c4:	e8 8a 01 00 00       	call   353 <strcmp>
+ 1c9:	83 c4 10             	add    $0x10,%esp
+ 1cc:	85 c0                	test   %eax,%eax
+ 1ce:	0f 85 a8 00 00 00    	jne    27c <main+0x170>
+        pid = atoi(argv[2]);
+ 1d4:	8b 43 04             	mov    0x4(%ebx),%eax
+ 1d7:	83 c0 08             	add    $0x8,%eax
+ 1da:	8b 00                	mov    (%eax),%eax
+ 1dc:	83 ec 0c             	sub    $0xc,%esp
+ 1df:	50                   	push   %eax
+ 1e0:	e8 dd 02 00 00       	call   4c2 <atoi>
+ 1e5:	83 c4 10             	add    $0x10,%esp
+ 1e8:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        if(argc > 3 && sched_setaffinity(pid, parsemask(argv[3])) < 0){
+ 1eb:	83 3b 03             	cmpl   $0x3,(%ebx)
+ 1ee:	7e 41                	jle    231 <main+0x125>
+ 1f0:	8b 43 04             	mov    0x4(%ebx),%eax
+ 1f3:	83 c0 0c             	add    $0xc,%eax
+ 1f6:	8b 00                	mov    (%eax),%eax
+ 1f8:	83 ec 0c             	sub    $0xc,%esp
+ 1fb:	50                   	push   %eax
+ 1fc:	e8 ff fd ff ff       	call   0 <parsemask>
+ 201:	83 c4 10             	add    $0x10,%esp
+ 204:	83 ec 08             	sub    $0x8,%esp
+ 207:	50                   	push   %eax
+ 208:	ff 75 e4             	push   -0x1c(%ebp)
+ 20b:	e8 38 05 00 00       	call   748 <sched_setaffinity>
+ 210:	83 c4 10             	add    $0x10,%esp
+ 213:	85 c0                	test   %eax,%eax
+ 215:	79 1a                	jns    231 <main+0x125>
+            printf(2, "taskset: cannot set affinity of %d\n", pid);
+ 217:	83 ec 04             	sub    $0x4,%esp
+ 21a:	ff 75 e4             	push   -0x1c(%ebp)
+ 21d:	68 44 0d 00 00       	push   $0xd44
+ 222:	6a 02                	push   $0x2
+ 224:	e8 dc 06 00 00       	call   905 <printf>
+ 229:	83 c4 10             	add    $0x10,%esp
+            exit();
+ 22c:	e8 d6 03 00 00       	call   607 <exit>
+        }
+        if((mask = sched_getaffinity(pid)) < 0){
+ 231:	83 ec 0c             	sub    $0xc,%esp
+ 234:	ff 75 e4             	push   -0x1c(%ebp)
+ 237:	e8 16 05 00 00       	call   752 <sched_getaffinity>
+ 23c:	83 c4 10             	add    $0x10,%esp
+ 23f:	89 45 e0             	mov    %eax,-0x20(%ebp)
+ 242:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+ 246:	79 1a                	jns    262 <main+0x156>
+            printf(2, "taskset: no process %d\n", pid);
+ 248:	83 ec 04             	sub    $0x4,%esp
+ 24b:	ff 75 e4             	push   -0x1c(%ebp)
+ 24e:	68 68 0d 00 00       	push   $0xd68
+ 253:	6a 02                	push   $0x2
+ 255:	e8 ab 06 00 00       	call   905 <printf>
+ 25a:	83 c4 10             	add    $0x10,%esp
+            exit();
+ 25d:	e8 a5 03 00 00       	call   607 <exit>
+        }
+        printf(1, "pid %d mask 0x%x\n", pid, mask);
+ 262:	ff 75 e0             	push   -0x20(%ebp)
+ 265:	ff 75 e4             	push   -0x1c(%ebp)
+ 268:	68 80 0d 00 00       	push   $0xd80
+ 26d:	6a 01                	push   $0x1
+ 26f:	e8 91 06 00 00       	call   905 <printf>
+ 274:	83 c4 10             	add    $0x10,%esp
+        exit();
+ 277:	e8 8b 03 00 00       	call   607 <exit>
+    }
+    if(sched_setaffinity(0, parsemask(argv[1])) < 0){
+ 27c:	8b 43 04             	mov    0x4(%ebx),%eax
+ 27f:	83 c0 04             	add    $0x4,%eax
+ 282:	8b 00                	mov    (%eax),%eax
+ 284:	83 ec 0c             	sub    $0xc,%esp
+ 287:	50                   	push   %eax
+ 288:	e8 73 fd ff ff       	call   0 <parsemask>
+ 28d:	83 c4 10             	add    $0x10,%esp
+ 290:	83 ec 08             	sub    $0x8,%esp
+ 293:	50                   	push   %eax
+ 294:	6a 00                	push   $0x0
+ 296:	e8 ad 04 00 00       	call   748 <sched_setaffinity>
+ 29b:	83 c4 10             	add    $0x10,%esp
+ 29e:	85 c0                	test   %eax,%eax
+ 2a0:	79 20                	jns    2c2 <main+0x1b6>
+        printf(2, "taskset: bad mask %s\n", argv[1]);
+ 2a2:	8b 43 04             	mov    0x4(%ebx),%eax
+ 2a5:	83 c0 04             	add    $0x4,%eax
+ 2a8:	8b 00                	mov    (%eax),%eax
+ 2aa:	83 ec 04             	sub    $0x4,%esp
+ 2ad:	50                   	push   %eax
+ 2ae:	68 92 0d 00 00       	push   $0xd92
+ 2b3:	6a 02                	push   $0x2
+ 2b5:	e8 4b 06 00 00       	call   905 <printf>
+ 2ba:	83 c4 10             	add    $0x10,%esp
+        exit();
+ 2bd:	e8 45 03 00 00       	call   607 <exit>
+    }
+    exec(argv[2], argv+2);
+ 2c2:	8b 43 04             	mov    0x4(%ebx),%eax
+ 2c5:	8d 50 08             	lea    0x8(%eax),%edx
+ 2c8:	8b 43 04             	mov    0x4(%ebx),%eax
+ 2cb:	83 c0 08             	add    $0x8,%eax
+ 2ce:	8b 00                	mov    (%eax),%eax
+ 2d0:	83 ec 08             	sub    $0x8,%esp
+ 2d3:	52                   	push   %edx
+ 2d4:	50                   	push   %eax
+ 2d5:	e8 6a 03 00 00       	call   644 <exec>
+ 2da:	83 c4 10             	add    $0x10,%esp
+    printf(2, "taskset: exec %s failed\n", argv[2]);
+ 2dd:	8b 43 04             	mov    0x4(%ebx),%eax
+ 2e0:	83 c0 08             	add    $0x8,%eax
+ 2e3:	8b 00                	mov    (%eax),%eax
+ 2e5:	83 ec 04             	sub    $0x4,%esp
+ 2e8:	50                   	push   %eax
+ 2e9:	68 a8 0d 00 00       	push   $0xda8
+ 2ee:	6a 02                	push   $0x2
+ 2f0:	e8 10 06 00 00       	call   905 <printf>
+ 2f5:	83 c4 10             	add    $0x10,%esp
+    exit();
+ 2f8:	e8 0a 03 00 00       	call   607 <exit>
+
+000002fd <stosb>:
+strchr(const char *s, char c)
+{
+    for(; *s; s++)
+        if(*s == c)
+            return (char*)s;
+    return 0;
+ 2fd:	55                   	push   %ebp
+ 2fe:	89 e5                	mov    %esp,%ebp
+ 300:	57                   	push   %edi
+ 301:	53                   	push   %ebx
+}
+ 302:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 305:	8b 55 10             	mov    0x10(%ebp),%edx
+ 308:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 30b:	89 cb                	mov    %ecx,%ebx
+ 30d:	89 df                	mov    %ebx,%edi
+ 30f:	89 d1                	mov    %edx,%ecx
+ 311:	fc                   	cld
+ 312:	f3 aa                	rep stos %al,%es:(%edi)
+ 314:	89 ca                	mov    %ecx,%edx
+ 316:	89 fb                	mov    %edi,%ebx
+ 318:	89 5d 08             	mov    %ebx,0x8(%ebp)
+ 31b:	89 55 10             	mov    %edx,0x10(%ebp)
+
+char*
+gets(char *buf, int max)
+{
+ 31e:	90                   	nop
+ 31f:	5b                   	pop    %ebx
+ 320:	5f                   	pop    %edi
+ 321:	5d                   	pop    %ebp
+ 322:	c3                   	ret
+
+00000323 <strcpy>:
+{
+ 323:	55                   	push   %ebp
+ 324:	89 e5                	mov    %esp,%ebp
+ 326:	83 ec 10             	sub    $0x10,%esp
+    os = s;
+ 329:	8b 45 08             	mov    0x8(%ebp),%eax
+ 32c:	89 45 fc             	mov    %eax,-0x4(%ebp)
+    while((*s++ = *t++) != 0)
+ 32f:	90                   	nop
+ 330:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 333:	8d 42 01             	lea    0x1(%edx),%eax
+ 336:	89 45 0c             	mov    %eax,0xc(%ebp)
+ 339:	8b 45 08             	mov    0x8(%ebp),%eax
+ 33c:	8d 48 01             	lea    0x1(%eax),%ecx
+ 33f:	89 4d 08             	mov    %ecx,0x8(%ebp)
+ 342:	0f b6 12             	movzbl (%edx),%edx
+ 345:	88 10                	mov    %dl,(%eax)
+ 347:	0f b6 00             	movzbl (%eax),%eax
+ 34a:	84 c0                	test   %al,%al
+ 34c:	75 e2                	jne    330 <strcpy+0xd>
+    return os;
+ 34e:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 351:	c9                   	leave
+ 352:	c3                   	ret
+
+00000353 <strcmp>:
+{
+ 353:	55                   	push   %ebp
+ 354:	89 e5                	mov    %esp,%ebp
+    while(*p && *p == *q)
+ 356:	eb 08                	jmp    360 <strcmp+0xd>
+        p++, q++;
+ 358:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 35c:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+    while(*p && *p == *q)
+ 360:	8b 45 08             	mov    0x8(%ebp),%eax
+ 363:	0f b6 00             	movzbl (%eax),%eax
+ 366:	84 c0                	test   %al,%al
+ 368:	74 10                	je     37a <strcmp+0x27>
+ 36a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 36d:	0f b6 10             	movzbl (%eax),%edx
+ 370:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 373:	0f b6 00             	movzbl (%eax),%eax
+ 376:	38 c2                	cmp    %al,%dl
+ 378:	74 de                	je     358 <strcmp+0x5>
+    return (uchar)*p - (uchar)*q;
+ 37a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 37d:	0f b6 00             	movzbl (%eax),%eax
+ 380:	0f b6 d0             	movzbl %al,%edx
+ 383:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 386:	0f b6 00             	movzbl (%eax),%eax
+ 389:	0f b6 c0             	movzbl %al,%eax
+ 38c:	29 c2                	sub    %eax,%edx
+ 38e:	89 d0                	mov    %edx,%eax
+}
+ 390:	5d                   	pop    %ebp
+ 391:	c3                   	ret
+
+00000392 <strlen>:
+{
+ 392:	55                   	push   %ebp
+ 393:	89 e5                	mov    %esp,%ebp
+ 395:	83 ec 10             	sub    $0x10,%esp
+    for(n = 0; s[n]; n++)
+ 398:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ 39f:	eb 04                	jmp    3a5 <strlen+0x13>
+ 3a1:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 3a5:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 3a8:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3ab:	01 d0                	add    %edx,%eax
+ 3ad:	0f b6 00             	movzbl (%eax),%eax
+ 3b0:	84 c0                	test   %al,%al
+ 3b2:	75 ed                	jne    3a1 <strlen+0xf>
+    return n;
+ 3b4:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 3b7:	c9                   	leave
+ 3b8:	c3                   	ret
+
+000003b9 <memset>:
+{
+ 3b9:	55                   	push   %ebp
+ 3ba:	89 e5                	mov    %esp,%ebp
+    stosb(dst, c, n);
+ 3bc:	8b 45 10             	mov    0x10(%ebp),%eax
+ 3bf:	50                   	push   %eax
+ 3c0:	ff 75 0c             	push   0xc(%ebp)
+ 3c3:	ff 75 08             	push   0x8(%ebp)
+ 3c6:	e8 32 ff ff ff       	call   2fd <stosb>
+ 3cb:	83 c4 0c             	add    $0xc,%esp
+    return dst;
+ 3ce:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 3d1:	c9                   	leave
+ 3d2:	c3                   	ret
+
+000003d3 <strchr>:
+{
+ 3d3:	55                   	push   %ebp
+ 3d4:	89 e5                	mov    %esp,%ebp
+ 3d6:	83 ec 04             	sub    $0x4,%esp
+ 3d9:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 3dc:	88 45 fc             	mov    %al,-0x4(%ebp)
+    for(; *s; s++)
+ 3df:	eb 14                	jmp    3f5 <strchr+0x22>
+        if(*s == c)
+ 3e1:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3e4:	0f b6 00             	movzbl (%eax),%eax
+ 3e7:	38 45 fc             	cmp    %al,-0x4(%ebp)
+ 3ea:	75 05                	jne    3f1 <strchr+0x1e>
+            return (char*)s;
+ 3ec:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3ef:	eb 13                	jmp    404 <strchr+0x31>
+    for(; *s; s++)
+ 3f1:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 3f5:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3f8:	0f b6 00             	movzbl (%eax),%eax
+ 3fb:	84 c0                	test   %al,%al
+ 3fd:	75 e2                	jne    3e1 <strchr+0xe>
+    return 0;
+ 3ff:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 404:	c9                   	leave
+ 405:	c3                   	ret
+
+00000406 <gets>:
+{
+ 406:	55                   	push   %ebp
+ 407:	89 e5                	mov    %esp,%ebp
+ 409:	83 ec 18             	sub    $0x18,%esp
+    int i, cc;
+    char c;
+
+    for(i=0; i+1 < max; ){
+ 40c:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 413:	eb 42                	jmp    457 <gets+0x51>
+        cc = read(0, &c, 1);
+ 415:	83 ec 04             	sub    $0x4,%esp
+ 418:	6a 01                	push   $0x1
+ 41a:	8d 45 ef             	lea    -0x11(%ebp),%eax
+ 41d:	50                   	push   %eax
+ 41e:	6a 00                	push   $0x0
+ 420:	e8 f7 01 00 00       	call   61c <read>
+ 425:	83 c4 10             	add    $0x10,%esp
+ 428:	89 45 f0             	mov    %eax,-0x10(%ebp)
+        if(cc < 1)
+ 42b:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 42f:	7e 33                	jle    464 <gets+0x5e>
+            break;
+        buf[i++] = c;
+ 431:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 434:	8d 50 01             	lea    0x1(%eax),%edx
+ 437:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 43a:	89 c2                	mov    %eax,%edx
+ 43c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 43f:	01 c2                	add    %eax,%edx
+ 441:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 445:	88 02                	mov    %al,(%edx)
+        if(c == '\n' || c == '\r')
+ 447:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 44b:	3c 0a                	cmp    $0xa,%al
+ 44d:	74 16                	je     465 <gets+0x5f>
+ 44f:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 453:	3c 0d                	cmp    $0xd,%al
+ 455:	74 0e                	je     465 <gets+0x5f>
+    for(i=0; i+1 < max; ){
+ 457:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 45a:	83 c0 01             	add    $0x1,%eax
+ 45d:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 460:	7f b3                	jg     415 <gets+0xf>
+ 462:	eb 01                	jmp    465 <gets+0x5f>
+            break;
+ 464:	90                   	nop
+            break;
+    }
+    buf[i] = '\0';
+ 465:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 468:	8b 45 08             	mov    0x8(%ebp),%eax
+ 46b:	01 d0                	add    %edx,%eax
+ 46d:	c6 00 00             	movb   $0x0,(%eax)
+    return buf;
+ 470:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 473:	c9                   	leave
+ 474:	c3                   	ret
+
+00000475 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 475:	55                   	push   %ebp
+ 476:	89 e5                	mov    %esp,%ebp
+ 478:	83 ec 18             	sub    $0x18,%esp
+    int fd;
+    int r;
+
+    fd = open(n, O_RDONLY);
+ 47b:	83 ec 08             	sub    $0x8,%esp
+ 47e:	6a 00                	push   $0x0
+ 480:	ff 75 08             	push   0x8(%ebp)
+ 483:	e8 c6 01 00 00       	call   64e <open>
+ 488:	83 c4 10             	add    $0x10,%esp
+ 48b:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(fd < 0)
+ 48e:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 492:	79 07                	jns    49b <stat+0x26>
+        return -1;
+ 494:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 499:	eb 25                	jmp    4c0 <stat+0x4b>
+    r = fstat(fd, st);
+ 49b:	83 ec 08             	sub    $0x8,%esp
+ 49e:	ff 75 0c             	push   0xc(%ebp)
+ 4a1:	ff 75 f4             	push   -0xc(%ebp)
+ 4a4:	e8 c3 01 00 00       	call   66c <fstat>
+ 4a9:	83 c4 10             	add    $0x10,%esp
+ 4ac:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    close(fd);
+ 4af:	83 ec 0c             	sub    $0xc,%esp
+ 4b2:	ff 75 f4             	push   -0xc(%ebp)
+ 4b5:	e8 76 01 00 00       	call   630 <close>
+ 4ba:	83 c4 10             	add    $0x10,%esp
+    return r;
+ 4bd:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ 4c0:	c9                   	leave
+ 4c1:	c3                   	ret
+
+000004c2 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 4c2:	55                   	push   %ebp
+ 4c3:	89 e5                	mov    %esp,%ebp
+ 4c5:	83 ec 10             	sub    $0x10,%esp
+    int n;
+
+    n = 0;
+ 4c8:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+    while('0' <= *s && *s <= '9')
+ 4cf:	eb 25                	jmp    4f6 <atoi+0x34>
+        n = n*10 + *s++ - '0';
+ 4d1:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 4d4:	89 d0                	mov    %edx,%eax
+ 4d6:	c1 e0 02             	shl    $0x2,%eax
+ 4d9:	01 d0                	add    %edx,%eax
+ 4db:	01 c0                	add    %eax,%eax
+ 4dd:	89 c1                	mov    %eax,%ecx
+ 4df:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4e2:	8d 50 01             	lea    0x1(%eax),%edx
+ 4e5:	89 55 08             	mov    %edx,0x8(%ebp)
+ 4e8:	0f b6 00             	movzbl (%eax),%eax
+ 4eb:	0f be c0             	movsbl %al,%eax
+ 4ee:	01 c8                	add    %ecx,%eax
+ 4f0:	83 e8 30             	sub    $0x30,%eax
+ 4f3:	89 45 fc             	mov    %eax,-0x4(%ebp)
+    while('0' <= *s && *s <= '9')
+ 4f6:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4f9:	0f b6 00             	movzbl (%eax),%eax
+ 4fc:	3c 2f                	cmp    $0x2f,%al
+ 4fe:	7e 0a                	jle    50a <atoi+0x48>
+ 500:	8b 45 08             	mov    0x8(%ebp),%eax
+ 503:	0f b6 00             	movzbl (%eax),%eax
+ 506:	3c 39                	cmp    $0x39,%al
+ 508:	7e c7                	jle    4d1 <atoi+0xf>
+    return n;
+ 50a:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 50d:	c9                   	leave
+ 50e:	c3                   	ret
+
+0000050f <nice>:
+
+// Add inc to the caller's nice value; return the new value.
+int
+nice(int inc)
+{
+ 50f:	55                   	push   %ebp
+ 510:	89 e5                	mov    %esp,%ebp
+ 512:	83 ec 18             	sub    $0x18,%esp
+    int n;
+
+    n = getpriority(0) + inc;
+ 515:	83 ec 0c             	sub    $0xc,%esp
+ 518:	6a 00                	push   $0x0
+ 51a:	e8 d9 01 00 00       	call   6f8 <getpriority>
+ 51f:	83 c4 10             	add    $0x10,%esp
+ 522:	8b 55 08             	mov    0x8(%ebp),%edx
+ 525:	01 d0                	add    %edx,%eax
+ 527:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(n < 0)
+ 52a:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 52e:	79 07                	jns    537 <nice+0x28>
+        n = 0;
+ 530:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    if(n > NICEMAX)
+ 537:	83 7d f4 13          	cmpl   $0x13,-0xc(%ebp)
+ 53b:	7e 07                	jle    544 <nice+0x35>
+        n = NICEMAX;
+ 53d:	c7 45 f4 13 00 00 00 	movl   $0x13,-0xc(%ebp)
+    if(setpriority(0, n) < 0)
+ 544:	83 ec 08             	sub    $0x8,%esp
+ 547:	ff 75 f4             	push   -0xc(%ebp)
+ 54a:	6a 00                	push   $0x0
+ 54c:	e8 b1 01 00 00       	call   702 <setpriority>
+ 551:	83 c4 10             	add    $0x10,%esp
+ 554:	85 c0                	test   %eax,%eax
+ 556:	79 07                	jns    55f <nice+0x50>
+        return -1;
+ 558:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 55d:	eb 03                	jmp    562 <nice+0x53>
+    return n;
+ 55f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+ 562:	c9                   	leave
+ 563:	c3                   	ret
+
+00000564 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 564:	55                   	push   %ebp
+ 565:	89 e5                	mov    %esp,%ebp
+ 567:	83 ec 10             	sub    $0x10,%esp
+    char *dst;
+    const char *src;
+
+    dst = vdst;
+ 56a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 56d:	89 45 fc             	mov    %eax,-0x4(%ebp)
+    src = vsrc;
+ 570:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 573:	89 45 f8             	mov    %eax,-0x8(%ebp)
+    while(n-- > 0)
+ 576:	eb 17                	jmp    58f <memmove+0x2b>
+        *dst++ = *src++;
+ 578:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 57b:	8d 42 01             	lea    0x1(%edx),%eax
+ 57e:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 581:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 584:	8d 48 01             	lea    0x1(%eax),%ecx
+ 587:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+ 58a:	0f b6 12             	movzbl (%edx),%edx
+ 58d:	88 10                	mov    %dl,(%eax)
+    while(n-- > 0)
+ 58f:	8b 45 10             	mov    0x10(%ebp),%eax
+ 592:	8d 50 ff             	lea    -0x1(%eax),%edx
+ 595:	89 55 10             	mov    %edx,0x10(%ebp)
+ 598:	85 c0                	test   %eax,%eax
+ 59a:	7f dc                	jg     578 <memmove+0x14>
+    return vdst;
+ 59c:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 59f:	c9                   	leave
+ 5a0:	c3                   	ret
+
+000005a1 <dosyscall>:
+sysmode:
+    .long 0
+
+    .text
+dosyscall:
+    cmpl $0, sysmode
+ 5a1:	83 3d 70 10 00 00 00 	cmpl   $0x0,0x1070
+    jg 2f
+ 5a8:	7f 0c                	jg     5b6 <dosyscall+0x15>
+    jl 1f
+ 5aa:	7c 07                	jl     5b3 <dosyscall+0x12>
+    call sepcheck
+ 5ac:	e8 27 00 00 00       	call   5d8 <sepcheck>
+    jmp dosyscall
+ 5b1:	eb ee                	jmp    5a1 <dosyscall>
+1:
+    int $T_SYSCALL
+ 5b3:	cd 40                	int    $0x40
+    ret
+ 5b5:	c3                   	ret
+2:
+    pushl %ebx
+ 5b6:	53                   	push   %ebx
+    pushl %esi
+ 5b7:	56                   	push   %esi
+    pushl %edi
+ 5b8:	57                   	push   %edi
+    pushl %ebp
+ 5b9:	55                   	push   %ebp
+    movl 20(%esp), %ebx
+ 5ba:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+    movl 24(%esp), %esi
+ 5be:	8b 74 24 18          	mov    0x18(%esp),%esi
+    movl 28(%esp), %edi
+ 5c2:	8b 7c 24 1c          	mov    0x1c(%esp),%edi
+    movl 32(%esp), %ebp
+ 5c6:	8b 6c 24 20          	mov    0x20(%esp),%ebp
+    movl %esp, %ecx
+ 5ca:	89 e1                	mov    %esp,%ecx
+    movl $3f, %edx
+ 5cc:	ba d3 05 00 00       	mov    $0x5d3,%edx
+    sysenter
+ 5d1:	0f 34                	sysenter
+3:
+    popl %ebp
+ 5d3:	5d                   	pop    %ebp
+    popl %edi
+ 5d4:	5f                   	pop    %edi
+    popl %esi
+ 5d5:	5e                   	pop    %esi
+    popl %ebx
+ 5d6:	5b                   	pop    %ebx
+    ret
+ 5d7:	c3                   	ret
+
+000005d8 <sepcheck>:
+
+# Set sysmode from cpuid's SEP flag.    Preserves %eax.
+sepcheck:
+    pushl %eax
+ 5d8:	50                   	push   %eax
+    pushl %ebx
+ 5d9:	53                   	push   %ebx
+    movl $1, %eax
+ 5da:	b8 01 00 00 00       	mov    $0x1,%eax
+    cpuid
+ 5df:	0f a2                	cpuid
+    movl $-1, sysmode
+ 5e1:	c7 05 70 10 00 00 ff 	movl   $0xffffffff,0x1070
+ 5e8:	ff ff ff 
+    testl $0x800, %edx
+ 5eb:	f7 c2 00 08 00 00    	test   $0x800,%edx
+    jz 1f
+ 5f1:	74 0a                	je     5fd <sepcheck+0x25>
+    movl $1, sysmode
+ 5f3:	c7 05 70 10 00 00 01 	movl   $0x1,0x1070
+ 5fa:	00 00 00 
+1:
+    popl %ebx
+ 5fd:	5b                   	pop    %ebx
+    popl %eax
+ 5fe:	58                   	pop    %eax
+    ret
+ 5ff:	c3                   	ret
+
+00000600 <fork>:
+
+SYSCALL(fork)
+ 600:	b8 01 00 00 00       	mov    $0x1,%eax
+ 605:	eb 9a                	jmp    5a1 <dosyscall>
+
+00000607 <exit>:
+SYSCALL(exit)
+ 607:	b8 02 00 00 00       	mov    $0x2,%eax
+ 60c:	eb 93                	jmp    5a1 <dosyscall>
+
+0000060e <wait>:
+SYSCALL(wait)
+ 60e:	b8 03 00 00 00       	mov    $0x3,%eax
+ 613:	eb 8c                	jmp    5a1 <dosyscall>
+
+00000615 <pipe>:
+SYSCALL(pipe)
+ 615:	b8 04 00 00 00       	mov    $0x4,%eax
+ 61a:	eb 85                	jmp    5a1 <dosyscall>
+
+0000061c <read>:
+SYSCALL(read)
+ 61c:	b8 05 00 00 00       	mov    $0x5,%eax
+ 621:	e9 7b ff ff ff       	jmp    5a1 <dosyscall>
+
+00000626 <write>:
+SYSCALL(write)
+ 626:	b8 10 00 00 00       	mov    $0x10,%eax
+ 62b:	e9 71 ff ff ff       	jmp    5a1 <dosyscall>
+
+00000630 <close>:
+SYSCALL(close)
+ 630:	b8 15 00 00 00       	mov    $0x15,%eax
+ 635:	e9 67 ff ff ff       	jmp    5a1 <dosyscall>
+
+0000063a <kill>:
+SYSCALL(kill)
+ 63a:	b8 06 00 00 00       	mov    $0x6,%eax
+ 63f:	e9 5d ff ff ff       	jmp    5a1 <dosyscall>
+
+00000644 <exec>:
+SYSCALL(exec)
+ 644:	b8 07 00 00 00       	mov    $0x7,%eax
+ 649:	e9 53 ff ff ff       	jmp    5a1 <dosyscall>
+
+0000064e <open>:
+SYSCALL(open)
+ 64e:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 653:	e9 49 ff ff ff       	jmp    5a1 <dosyscall>
+
+00000658 <mknod>:
+SYSCALL(mknod)
+ 658:	b8 11 00 00 00       	mov    $0x11,%eax
+ 65d:	e9 3f ff ff ff       	jmp    5a1 <dosyscall>
+
+00000662 <unlink>:
+SYSCALL(unlink)
+ 662:	b8 12 00 00 00       	mov    $0x12,%eax
+ 667:	e9 35 ff ff ff       	jmp    5a1 <dosyscall>
+
+0000066c <fstat>:
+SYSCALL(fstat)
+ 66c:	b8 08 00 00 00       	mov    $0x8,%eax
+ 671:	e9 2b ff ff ff       	jmp    5a1 <dosyscall>
+
+00000676 <link>:
+SYSCALL(link)
+ 676:	b8 13 00 00 00       	mov    $0x13,%eax
+ 67b:	e9 21 ff ff ff       	jmp    5a1 <dosyscall>
+
+00000680 <mkdir>:
+SYSCALL(mkdir)
+ 680:	b8 14 00 00 00       	mov    $0x14,%eax
+ 685:	e9 17 ff ff ff       	jmp    5a1 <dosyscall>
+
+0000068a <chdir>:
+SYSCALL(chdir)
+ 68a:	b8 09 00 00 00       	mov    $0x9,%eax
+ 68f:	e9 0d ff ff ff       	jmp    5a1 <dosyscall>
+
+00000694 <dup>:
+SYSCALL(dup)
+ 694:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 699:	e9 03 ff ff ff       	jmp    5a1 <dosyscall>
+
+0000069e <getpid>:
+SYSCALL(getpid)
+ 69e:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 6a3:	e9 f9 fe ff ff       	jmp    5a1 <dosyscall>
+
+000006a8 <sbrk>:
+SYSCALL(sbrk)
+ 6a8:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 6ad:	e9 ef fe ff ff       	jmp    5a1 <dosyscall>
+
+000006b2 <sleep>:
+SYSCALL(sleep)
+ 6b2:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 6b7:	e9 e5 fe ff ff       	jmp    5a1 <dosyscall>
+
+000006bc <uptime>:
+SYSCALL(uptime)
+ 6bc:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 6c1:	e9 db fe ff ff       	jmp    5a1 <dosyscall>
+
+000006c6 <date>:
+SYSCALL(date)
+ 6c6:	b8 16 00 00 00       	mov    $0x16,%eax
+ 6cb:	e9 d1 fe ff ff       	jmp    5a1 <dosyscall>
+
+000006d0 <dup2>:
+SYSCALL(dup2)
+ 6d0:	b8 17 00 00 00       	mov    $0x17,%eax
+ 6d5:	e9 c7 fe ff ff       	jmp    5a1 <dosyscall>
+
+000006da <uffd>:
+SYSCALL(uffd)
+ 6da:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 6df:	e9 bd fe ff ff       	jmp    5a1 <dosyscall>
+
+000006e4 <uffdregister>:
+SYSCALL(uffdregister)
+ 6e4:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 6e9:	e9 b3 fe ff ff       	jmp    5a1 <dosyscall>
+
+000006ee <uffdcopy>:
+SYSCALL(uffdcopy)
+ 6ee:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 6f3:	e9 a9 fe ff ff       	jmp    5a1 <dosyscall>
+
+000006f8 <getpriority>:
+SYSCALL(getpriority)
+ 6f8:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 6fd:	e9 9f fe ff ff       	jmp    5a1 <dosyscall>
+
+00000702 <setpriority>:
+SYSCALL(setpriority)
+ 702:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 707:	e9 95 fe ff ff       	jmp    5a1 <dosyscall>
+
+0000070c <setweight>:
+SYSCALL(setweight)
+ 70c:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 711:	e9 8b fe ff ff       	jmp    5a1 <dosyscall>
+
+00000716 <setgroup>:
+SYSCALL(setgroup)
+ 716:	b8 20 00 00 00       	mov    $0x20,%eax
+ 71b:	e9 81 fe ff ff       	jmp    5a1 <dosyscall>
+
+00000720 <schedinfo>:
+SYSCALL(schedinfo)
+ 720:	b8 21 00 00 00       	mov    $0x21,%eax
+ 725:	e9 77 fe ff ff       	jmp    5a1 <dosyscall>
+
+0000072a <nanosleep>:
+SYSCALL(nanosleep)
+ 72a:	b8 22 00 00 00       	mov    $0x22,%eax
+ 72f:	e9 6d fe ff ff       	jmp    5a1 <dosyscall>
+
+00000734 <clock_nanosleep>:
+SYSCALL(clock_nanosleep)
+ 734:	b8 23 00 00 00       	mov    $0x23,%eax
+ 739:	e9 63 fe ff ff       	jmp    5a1 <dosyscall>
+
+0000073e <clock_gettime>:
+SYSCALL(clock_gettime)
+ 73e:	b8 24 00 00 00       	mov    $0x24,%eax
+ 743:	e9 59 fe ff ff       	jmp    5a1 <dosyscall>
+
+00000748 <sched_setaffinity>:
+SYSCALL(sched_setaffinity)
+ 748:	b8 25 00 00 00       	mov    $0x25,%eax
+ 74d:	e9 4f fe ff ff       	jmp    5a1 <dosyscall>
+
+00000752 <sched_getaffinity>:
+SYSCALL(sched_getaffinity)
+ 752:	b8 26 00 00 00       	mov    $0x26,%eax
+ 757:	e9 45 fe ff ff       	jmp    5a1 <dosyscall>
+
+0000075c <irqaffinity>:
+SYSCALL(irqaffinity)
+ 75c:	b8 27 00 00 00       	mov    $0x27,%eax
+ 761:	e9 3b fe ff ff       	jmp    5a1 <dosyscall>
+
+00000766 <getrusage>:
+SYSCALL(getrusage)
+ 766:	b8 28 00 00 00       	mov    $0x28,%eax
+ 76b:	e9 31 fe ff ff       	jmp    5a1 <dosyscall>
+
+00000770 <times>:
+SYSCALL(times)
+ 770:	b8 29 00 00 00       	mov    $0x29,%eax
+ 775:	e9 27 fe ff ff       	jmp    5a1 <dosyscall>
+
+0000077a <schedlat>:
+SYSCALL(schedlat)
+ 77a:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 77f:	e9 1d fe ff ff       	jmp    5a1 <dosyscall>
+
+00000784 <sched_setscheduler>:
+SYSCALL(sched_setscheduler)
+ 784:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 789:	e9 13 fe ff ff       	jmp    5a1 <dosyscall>
+
+0000078e <sched_getscheduler>:
+SYSCALL(sched_getscheduler)
+ 78e:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 793:	e9 09 fe ff ff       	jmp    5a1 <dosyscall>
+
+00000798 <sched_getparam>:
+SYSCALL(sched_getparam)
+ 798:	b8 2d 00 00 00       	mov    $0x2d,%eax
+ 79d:	e9 ff fd ff ff       	jmp    5a1 <dosyscall>
+
+000007a2 <lockstat>:
+SYSCALL(lockstat)
+ 7a2:	b8 2e 00 00 00       	mov    $0x2e,%eax
+ 7a7:	e9 f5 fd ff ff       	jmp    5a1 <dosyscall>
+
+000007ac <ioring_setup>:
+SYSCALL(ioring_setup)
+ 7ac:	b8 2f 00 00 00       	mov    $0x2f,%eax
+ 7b1:	e9 eb fd ff ff       	jmp    5a1 <dosyscall>
+
+000007b6 <ioring_enter>:
+SYSCALL(ioring_enter)
+ 7b6:	b8 30 00 00 00       	mov    $0x30,%eax
+ 7bb:	e9 e1 fd ff ff       	jmp    5a1 <dosyscall>
+
+000007c0 <readv>:
+SYSCALL(readv)
+ 7c0:	b8 31 00 00 00       	mov    $0x31,%eax
+ 7c5:	e9 d7 fd ff ff       	jmp    5a1 <dosyscall>
+
+000007ca <writev>:
+SYSCALL(writev)
+ 7ca:	b8 32 00 00 00       	mov    $0x32,%eax
+ 7cf:	e9 cd fd ff ff       	jmp    5a1 <dosyscall>
+
+000007d4 <pread>:
+SYSCALL(pread)
+ 7d4:	b8 33 00 00 00       	mov    $0x33,%eax
+ 7d9:	e9 c3 fd ff ff       	jmp    5a1 <dosyscall>
+
+000007de <pwrite>:
+SYSCALL(pwrite)
+ 7de:	b8 34 00 00 00       	mov    $0x34,%eax
+ 7e3:	e9 b9 fd ff ff       	jmp    5a1 <dosyscall>
+
+000007e8 <sendfile>:
+SYSCALL(sendfile)
+ 7e8:	b8 35 00 00 00       	mov    $0x35,%eax
+ 7ed:	e9 af fd ff ff       	jmp    5a1 <dosyscall>
+
+000007f2 <splice>:
+SYSCALL(splice)
+ 7f2:	b8 36 00 00 00       	mov    $0x36,%eax
+ 7f7:	e9 a5 fd ff ff       	jmp    5a1 <dosyscall>
+
+000007fc <sysstat>:
+SYSCALL(sysstat)
+ 7fc:	b8 37 00 00 00       	mov    $0x37,%eax
+ 801:	e9 9b fd ff ff       	jmp    5a1 <dosyscall>
+
+00000806 <strace>:
+SYSCALL(strace)
+ 806:	b8 38 00 00 00       	mov    $0x38,%eax
+ 80b:	e9 91 fd ff ff       	jmp    5a1 <dosyscall>
+
+00000810 <straceread>:
+SYSCALL(straceread)
+ 810:	b8 39 00 00 00       	mov    $0x39,%eax
+ 815:	e9 87 fd ff ff       	jmp    5a1 <dosyscall>
+
+0000081a <alarm>:
+
+# alarm and rstoregs keep to int $T_SYSCALL: rstoregs restores
+# %ecx and %edx, which sysexit would clobber.
+.globl alarm
+    alarm:
+        pushl $rstoregs
+ 81a:	68 2a 08 00 00       	push   $0x82a
+        movl $SYS_alarm, %eax
+ 81f:	b8 18 00 00 00       	mov    $0x18,%eax
+        int $T_SYSCALL
+ 824:	cd 40                	int    $0x40
+        add $0x04, %esp
+ 826:	83 c4 04             	add    $0x4,%esp
+        ret
+ 829:	c3                   	ret
+
+0000082a <rstoregs>:
+
+.globl rstoregs
+    rstoregs:
+        movl $SYS_rstoregs, %eax
+ 82a:	b8 19 00 00 00       	mov    $0x19,%eax
+        int $T_SYSCALL
+ 82f:	cd 40                	int    $0x40
+
+00000831 <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 831:	55                   	push   %ebp
+ 832:	89 e5                	mov    %esp,%ebp
+ 834:	83 ec 18             	sub    $0x18,%esp
+ 837:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 83a:	88 45 f4             	mov    %al,-0xc(%ebp)
+    write(fd, &c, 1);
+ 83d:	83 ec 04             	sub    $0x4,%esp
+ 840:	6a 01                	push   $0x1
+ 842:	8d 45 f4             	lea    -0xc(%ebp),%eax
+ 845:	50                   	push   %eax
+ 846:	ff 75 08             	push   0x8(%ebp)
+ 849:	e8 d8 fd ff ff       	call   626 <write>
+ 84e:	83 c4 10             	add    $0x10,%esp
+}
+ 851:	90                   	nop
+ 852:	c9                   	leave
+ 853:	c3                   	ret
+
+00000854 <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 854:	55                   	push   %ebp
+ 855:	89 e5                	mov    %esp,%ebp
+ 857:	83 ec 28             	sub    $0x28,%esp
+    static char digits[] = "0123456789ABCDEF";
+    char buf[16];
+    int i, neg;
+    uint x;
+
+    neg = 0;
+ 85a:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+    if(sgn && xx < 0){
+ 861:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+ 865:	74 17                	je     87e <printint+0x2a>
+ 867:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 86b:	79 11                	jns    87e <printint+0x2a>
+        neg = 1;
+ 86d:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+        x = -xx;
+ 874:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 877:	f7 d8                	neg    %eax
+ 879:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 87c:	eb 06                	jmp    884 <printint+0x30>
+    } else {
+        x = xx;
+ 87e:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 881:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    }
+
+    i = 0;
+ 884:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    do{
+        buf[i++] = digits[x % base];
+ 88b:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 88e:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 891:	ba 00 00 00 00       	mov    $0x0,%edx
+ 896:	f7 f1                	div    %ecx
+ 898:	89 d1                	mov    %edx,%ecx
+ 89a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 89d:	8d 50 01             	lea    0x1(%eax),%edx
+ 8a0:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 8a3:	0f b6 91 74 10 00 00 	movzbl 0x1074(%ecx),%edx
+ 8aa:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+    }while((x /= base) != 0);
+ 8ae:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 8b1:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 8b4:	ba 00 00 00 00       	mov    $0x0,%edx
+ 8b9:	f7 f1                	div    %ecx
+ 8bb:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 8be:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 8c2:	75 c7                	jne    88b <printint+0x37>
+    if(neg)
+ 8c4:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 8c8:	74 2d                	je     8f7 <printint+0xa3>
+        buf[i++] = '-';
+ 8ca:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 8cd:	8d 50 01             	lea    0x1(%eax),%edx
+ 8d0:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 8d3:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+    while(--i >= 0)
+ 8d8:	eb 1d                	jmp    8f7 <printint+0xa3>
+        putc(fd, buf[i]);
+ 8da:	8d 55 dc             	lea    -0x24(%ebp),%edx
+ 8dd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 8e0:	01 d0                	add    %edx,%eax
+ 8e2:	0f b6 00             	movzbl (%eax),%eax
+ 8e5:	0f be c0             	movsbl %al,%eax
+ 8e8:	83 ec 08             	sub    $0x8,%esp
+ 8eb:	50                   	push   %eax
+ 8ec:	ff 75 08             	push   0x8(%ebp)
+ 8ef:	e8 3d ff ff ff       	call   831 <putc>
+ 8f4:	83 c4 10             	add    $0x10,%esp
+    while(--i >= 0)
+ 8f7:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+ 8fb:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 8ff:	79 d9                	jns    8da <printint+0x86>
+}
+ 901:	90                   	nop
+ 902:	90                   	nop
+ 903:	c9                   	leave
+ 904:	c3                   	ret
+
+00000905 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 905:	55                   	push   %ebp
+ 906:	89 e5                	mov    %esp,%ebp
+ 908:	83 ec 28             	sub    $0x28,%esp
+    char *s;
+    int c, i, state;
+    uint *ap;
+
+    state = 0;
+ 90b:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+    ap = (uint*)(void*)&fmt + 1;
+ 912:	8d 45 0c             	lea    0xc(%ebp),%eax
+ 915:	83 c0 04             	add    $0x4,%eax
+ 918:	89 45 e8             	mov    %eax,-0x18(%ebp)
+    for(i = 0; fmt[i]; i++){
+ 91b:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 922:	e9 59 01 00 00       	jmp    a80 <printf+0x17b>
+        c = fmt[i] & 0xff;
+ 927:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 92a:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 92d:	01 d0                	add    %edx,%eax
+ 92f:	0f b6 00             	movzbl (%eax),%eax
+ 932:	0f be c0             	movsbl %al,%eax
+ 935:	25 ff 00 00 00       	and    $0xff,%eax
+ 93a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        if(state == 0){
+ 93d:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 941:	75 2c                	jne    96f <printf+0x6a>
+            if(c == '%'){
+ 943:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 947:	75 0c                	jne    955 <printf+0x50>
+                state = '%';
+ 949:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+ 950:	e9 27 01 00 00       	jmp    a7c <printf+0x177>
+            } else {
+                putc(fd, c);
+ 955:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 958:	0f be c0             	movsbl %al,%eax
+ 95b:	83 ec 08             	sub    $0x8,%esp
+ 95e:	50                   	push   %eax
+ 95f:	ff 75 08             	push   0x8(%ebp)
+ 962:	e8 ca fe ff ff       	call   831 <putc>
+ 967:	83 c4 10             	add    $0x10,%esp
+ 96a:	e9 0d 01 00 00       	jmp    a7c <printf+0x177>
+            }
+        } else if(state == '%'){
+ 96f:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+ 973:	0f 85 03 01 00 00    	jne    a7c <printf+0x177>
+            if(c == 'd'){
+ 979:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+ 97d:	75 1e                	jne    99d <printf+0x98>
+                printint(fd, *ap, 10, 1);
+ 97f:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 982:	8b 00                	mov    (%eax),%eax
+ 984:	6a 01                	push   $0x1
+ 986:	6a 0a                	push   $0xa
+ 988:	50                   	push   %eax
+ 989:	ff 75 08             	push   0x8(%ebp)
+ 98c:	e8 c3 fe ff ff       	call   854 <printint>
+ 991:	83 c4 10             	add    $0x10,%esp
+                ap++;
+ 994:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 998:	e9 d8 00 00 00       	jmp    a75 <printf+0x170>
+            } else if(c == 'x' || c == 'p'){
+ 99d:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+ 9a1:	74 06                	je     9a9 <printf+0xa4>
+ 9a3:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+ 9a7:	75 1e                	jne    9c7 <printf+0xc2>
+                printint(fd, *ap, 16, 0);
+ 9a9:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 9ac:	8b 00                	mov    (%eax),%eax
+ 9ae:	6a 00                	push   $0x0
+ 9b0:	6a 10                	push   $0x10
+ 9b2:	50                   	push   %eax
+ 9b3:	ff 75 08             	push   0x8(%ebp)
+ 9b6:	e8 99 fe ff ff       	call   854 <printint>
+ 9bb:	83 c4 10             	add    $0x10,%esp
+                ap++;
+ 9be:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 9c2:	e9 ae 00 00 00       	jmp    a75 <printf+0x170>
+            } else if(c == 's'){
+ 9c7:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+ 9cb:	75 43                	jne    a10 <printf+0x10b>
+                s = (char*)*ap;
+ 9cd:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 9d0:	8b 00                	mov    (%eax),%eax
+ 9d2:	89 45 f4             	mov    %eax,-0xc(%ebp)
+                ap++;
+ 9d5:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+                if(s == 0)
+ 9d9:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 9dd:	75 25                	jne    a04 <printf+0xff>
+                    s = "(null)";
+ 9df:	c7 45 f4 c1 0d 00 00 	movl   $0xdc1,-0xc(%ebp)
+                while(*s != 0){
+ 9e6:	eb 1c                	jmp    a04 <printf+0xff>
+                    putc(fd, *s);
+ 9e8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 9eb:	0f b6 00             	movzbl (%eax),%eax
+ 9ee:	0f be c0             	movsbl %al,%eax
+ 9f1:	83 ec 08             	sub    $0x8,%esp
+ 9f4:	50                   	push   %eax
+ 9f5:	ff 75 08             	push   0x8(%ebp)
+ 9f8:	e8 34 fe ff ff       	call   831 <putc>
+ 9fd:	83 c4 10             	add    $0x10,%esp
+                    s++;
+ a00:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+                while(*s != 0){
+ a04:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a07:	0f b6 00             	movzbl (%eax),%eax
+ a0a:	84 c0                	test   %al,%al
+ a0c:	75 da                	jne    9e8 <printf+0xe3>
+ a0e:	eb 65                	jmp    a75 <printf+0x170>
+                }
+            } else if(c == 'c'){
+ a10:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+ a14:	75 1d                	jne    a33 <printf+0x12e>
+                putc(fd, *ap);
+ a16:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ a19:	8b 00                	mov    (%eax),%eax
+ a1b:	0f be c0             	movsbl %al,%eax
+ a1e:	83 ec 08             	sub    $0x8,%esp
+ a21:	50                   	push   %eax
+ a22:	ff 75 08             	push   0x8(%ebp)
+ a25:	e8 07 fe ff ff       	call   831 <putc>
+ a2a:	83 c4 10             	add    $0x10,%esp
+                ap++;
+ a2d:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ a31:	eb 42                	jmp    a75 <printf+0x170>
+            } else if(c == '%'){
+ a33:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ a37:	75 17                	jne    a50 <printf+0x14b>
+                putc(fd, c);
+ a39:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ a3c:	0f be c0             	movsbl %al,%eax
+ a3f:	83 ec 08             	sub    $0x8,%esp
+ a42:	50                   	push   %eax
+ a43:	ff 75 08             	push   0x8(%ebp)
+ a46:	e8 e6 fd ff ff       	call   831 <putc>
+ a4b:	83 c4 10             	add    $0x10,%esp
+ a4e:	eb 25                	jmp    a75 <printf+0x170>
+            } else {
+                // Unknown % sequence.    Print it to draw attention.
+                putc(fd, '%');
+ a50:	83 ec 08             	sub    $0x8,%esp
+ a53:	6a 25                	push   $0x25
+ a55:	ff 75 08             	push   0x8(%ebp)
+ a58:	e8 d4 fd ff ff       	call   831 <putc>
+ a5d:	83 c4 10             	add    $0x10,%esp
+                putc(fd, c);
+ a60:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ a63:	0f be c0             	movsbl %al,%eax
+ a66:	83 ec 08             	sub    $0x8,%esp
+ a69:	50                   	push   %eax
+ a6a:	ff 75 08             	push   0x8(%ebp)
+ a6d:	e8 bf fd ff ff       	call   831 <putc>
+ a72:	83 c4 10             	add    $0x10,%esp
+            }
+            state = 0;
+ a75:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+    for(i = 0; fmt[i]; i++){
+ a7c:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ a80:	8b 55 0c             	mov    0xc(%ebp),%edx
+ a83:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ a86:	01 d0                	add    %edx,%eax
+ a88:	0f b6 00             	movzbl (%eax),%eax
+ a8b:	84 c0                	test   %al,%al
+ a8d:	0f 85 94 fe ff ff    	jne    927 <printf+0x22>
+        }
+    }
+}
+ a93:	90                   	nop
+ a94:	90                   	nop
+ a95:	c9                   	leave
+ a96:	c3                   	ret
+
+00000a97 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ a97:	55                   	push   %ebp
+ a98:	89 e5                	mov    %esp,%ebp
+ a9a:	83 ec 10             	sub    $0x10,%esp
+    Header *bp, *p;
+
+    bp = (Header*)ap - 1;
+ a9d:	8b 45 08             	mov    0x8(%ebp),%eax
+ aa0:	83 e8 08             	sub    $0x8,%eax
+ aa3:	89 45 f8             	mov    %eax,-0x8(%ebp)
+    for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ aa6:	a1 90 10 00 00       	mov    0x1090,%eax
+ aab:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ aae:	eb 24                	jmp    ad4 <free+0x3d>
+        if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ ab0:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ ab3:	8b 00                	mov    (%eax),%eax
+ ab5:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ ab8:	72 12                	jb     acc <free+0x35>
+ aba:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ abd:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ ac0:	72 24                	jb     ae6 <free+0x4f>
+ ac2:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ ac5:	8b 00                	mov    (%eax),%eax
+ ac7:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ aca:	72 1a                	jb     ae6 <free+0x4f>
+    for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ acc:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ acf:	8b 00                	mov    (%eax),%eax
+ ad1:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ ad4:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ ad7:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ ada:	73 d4                	jae    ab0 <free+0x19>
+ adc:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ adf:	8b 00                	mov    (%eax),%eax
+ ae1:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ ae4:	73 ca                	jae    ab0 <free+0x19>
+            break;
+    if(bp + bp->s.size == p->s.ptr){
+ ae6:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ ae9:	8b 40 04             	mov    0x4(%eax),%eax
+ aec:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ af3:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ af6:	01 c2                	add    %eax,%edx
+ af8:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ afb:	8b 00                	mov    (%eax),%eax
+ afd:	39 c2                	cmp    %eax,%edx
+ aff:	75 24                	jne    b25 <free+0x8e>
+        bp->s.size += p->s.ptr->s.size;
+ b01:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ b04:	8b 50 04             	mov    0x4(%eax),%edx
+ b07:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b0a:	8b 00                	mov    (%eax),%eax
+ b0c:	8b 40 04             	mov    0x4(%eax),%eax
+ b0f:	01 c2                	add    %eax,%edx
+ b11:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ b14:	89 50 04             	mov    %edx,0x4(%eax)
+        bp->s.ptr = p->s.ptr->s.ptr;
+ b17:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b1a:	8b 00                	mov    (%eax),%eax
+ b1c:	8b 10                	mov    (%eax),%edx
+ b1e:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ b21:	89 10                	mov    %edx,(%eax)
+ b23:	eb 0a                	jmp    b2f <free+0x98>
+    } else
+        bp->s.ptr = p->s.ptr;
+ b25:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b28:	8b 10                	mov    (%eax),%edx
+ b2a:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ b2d:	89 10                	mov    %edx,(%eax)
+    if(p + p->s.size == bp){
+ b2f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b32:	8b 40 04             	mov    0x4(%eax),%eax
+ b35:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ b3c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b3f:	01 d0                	add    %edx,%eax
+ b41:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ b44:	75 20                	jne    b66 <free+0xcf>
+        p->s.size += bp->s.size;
+ b46:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b49:	8b 50 04             	mov    0x4(%eax),%edx
+ b4c:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ b4f:	8b 40 04             	mov    0x4(%eax),%eax
+ b52:	01 c2                	add    %eax,%edx
+ b54:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b57:	89 50 04             	mov    %edx,0x4(%eax)
+        p->s.ptr = bp->s.ptr;
+ b5a:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ b5d:	8b 10                	mov    (%eax),%edx
+ b5f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b62:	89 10                	mov    %edx,(%eax)
+ b64:	eb 08                	jmp    b6e <free+0xd7>
+    } else
+        p->s.ptr = bp;
+ b66:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b69:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ b6c:	89 10                	mov    %edx,(%eax)
+    freep = p;
+ b6e:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b71:	a3 90 10 00 00       	mov    %eax,0x1090
+}
+ b76:	90                   	nop
+ b77:	c9                   	leave
+ b78:	c3                   	ret
+
+00000b79 <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+ b79:	55                   	push   %ebp
+ b7a:	89 e5                	mov    %esp,%ebp
+ b7c:	83 ec 18             	sub    $0x18,%esp
+    char *p;
+    Header *hp;
+
+    if(nu < 4096)
+ b7f:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+ b86:	77 07                	ja     b8f <morecore+0x16>
+        nu = 4096;
+ b88:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+    p = sbrk(nu * sizeof(Header));
+ b8f:	8b 45 08             	mov    0x8(%ebp),%eax
+ b92:	c1 e0 03             	shl    $0x3,%eax
+ b95:	83 ec 0c             	sub    $0xc,%esp
+ b98:	50                   	push   %eax
+ b99:	e8 0a fb ff ff       	call   6a8 <sbrk>
+ b9e:	83 c4 10             	add    $0x10,%esp
+ ba1:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p == (char*)-1)
+ ba4:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+ ba8:	75 07                	jne    bb1 <morecore+0x38>
+        return 0;
+ baa:	b8 00 00 00 00       	mov    $0x0,%eax
+ baf:	eb 26                	jmp    bd7 <morecore+0x5e>
+    hp = (Header*)p;
+ bb1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ bb4:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    hp->s.size = nu;
+ bb7:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ bba:	8b 55 08             	mov    0x8(%ebp),%edx
+ bbd:	89 50 04             	mov    %edx,0x4(%eax)
+    free((void*)(hp + 1));
+ bc0:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ bc3:	83 c0 08             	add    $0x8,%eax
+ bc6:	83 ec 0c             	sub    $0xc,%esp
+ bc9:	50                   	push   %eax
+ bca:	e8 c8 fe ff ff       	call   a97 <free>
+ bcf:	83 c4 10             	add    $0x10,%esp
+    return freep;
+ bd2:	a1 90 10 00 00       	mov    0x1090,%eax
+}
+ bd7:	c9                   	leave
+ bd8:	c3                   	ret
+
+00000bd9 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ bd9:	55                   	push   %ebp
+ bda:	89 e5                	mov    %esp,%ebp
+ bdc:	83 ec 18             	sub    $0x18,%esp
+    Header *p, *prevp;
+    uint nunits;
+
+    nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ bdf:	8b 45 08             	mov    0x8(%ebp),%eax
+ be2:	83 c0 07             	add    $0x7,%eax
+ be5:	c1 e8 03             	shr    $0x3,%eax
+ be8:	83 c0 01             	add    $0x1,%eax
+ beb:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    if((prevp = freep) == 0){
+ bee:	a1 90 10 00 00       	mov    0x1090,%eax
+ bf3:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ bf6:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ bfa:	75 23                	jne    c1f <malloc+0x46>
+        base.s.ptr = freep = prevp = &base;
+ bfc:	c7 45 f0 88 10 00 00 	movl   $0x1088,-0x10(%ebp)
+ c03:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ c06:	a3 90 10 00 00       	mov    %eax,0x1090
+ c0b:	a1 90 10 00 00       	mov    0x1090,%eax
+ c10:	a3 88 10 00 00       	mov    %eax,0x1088
+        base.s.size = 0;
+ c15:	c7 05 8c 10 00 00 00 	movl   $0x0,0x108c
+ c1c:	00 00 00 
+    }
+    for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ c1f:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ c22:	8b 00                	mov    (%eax),%eax
+ c24:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        if(p->s.size >= nunits){
+ c27:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ c2a:	8b 40 04             	mov    0x4(%eax),%eax
+ c2d:	3b 45 ec             	cmp    -0x14(%ebp),%eax
+ c30:	72 4d                	jb     c7f <malloc+0xa6>
+            if(p->s.size == nunits)
+ c32:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ c35:	8b 40 04             	mov    0x4(%eax),%eax
+ c38:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+ c3b:	75 0c                	jne    c49 <malloc+0x70>
+                prevp->s.ptr = p->s.ptr;
+ c3d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ c40:	8b 10                	mov    (%eax),%edx
+ c42:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ c45:	89 10                	mov    %edx,(%eax)
+ c47:	eb 26                	jmp    c6f <malloc+0x96>
+            else {
+                p->s.size -= nunits;
+ c49:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ c4c:	8b 40 04             	mov    0x4(%eax),%eax
+ c4f:	2b 45 ec             	sub    -0x14(%ebp),%eax
+ c52:	89 c2                	mov    %eax,%edx
+ c54:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ c57:	89 50 04             	mov    %edx,0x4(%eax)
+                p += p->s.size;
+ c5a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ c5d:	8b 40 04             	mov    0x4(%eax),%eax
+ c60:	c1 e0 03             	shl    $0x3,%eax
+ c63:	01 45 f4             	add    %eax,-0xc(%ebp)
+                p->s.size = nunits;
+ c66:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ c69:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ c6c:	89 50 04             	mov    %edx,0x4(%eax)
+            }
+            freep = prevp;
+ c6f:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ c72:	a3 90 10 00 00       	mov    %eax,0x1090
+            return (void*)(p + 1);
+ c77:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ c7a:	83 c0 08             	add    $0x8,%eax
+ c7d:	eb 3b                	jmp    cba <malloc+0xe1>
+        }
+        if(p == freep)
+ c7f:	a1 90 10 00 00       	mov    0x1090,%eax
+ c84:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ c87:	75 1e                	jne    ca7 <malloc+0xce>
+            if((p = morecore(nunits)) == 0)
+ c89:	83 ec 0c             	sub    $0xc,%esp
+ c8c:	ff 75 ec             	push   -0x14(%ebp)
+ c8f:	e8 e5 fe ff ff       	call   b79 <morecore>
+ c94:	83 c4 10             	add    $0x10,%esp
+ c97:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ c9a:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ c9e:	75 07                	jne    ca7 <malloc+0xce>
+                return 0;
+ ca0:	b8 00 00 00 00       	mov    $0x0,%eax
+ ca5:	eb 13                	jmp    cba <malloc+0xe1>
+    for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ ca7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ caa:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ cad:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ cb0:	8b 00                	mov    (%eax),%eax
+ cb2:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        if(p->s.size >= nunits){
+ cb5:	e9 6d ff ff ff       	jmp    c27 <malloc+0x4e>
+    }
+}
+ cba:	c9                   	leave
+ cbb:	c3                   	ret
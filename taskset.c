@@ -0,0 +1,77 @@
+// Set cpu affinity and interrupt routing.
+//
+//    taskset mask cmd [arg...]    run cmd on the cpus in mask
+//    taskset -p pid [mask]        show or set the mask of pid
+//    taskset -i irq cpu           route device interrupt irq to cpu
+//
+// Masks are bit i for cpu i, in decimal or 0x hex.
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+
+uint
+parsemask(char *s)
+{
+    uint n;
+
+    if(s[0] != '0' || (s[1] != 'x' && s[1] != 'X'))
+        return atoi(s);
+    n = 0;
+    for(s += 2; *s; s++){
+        if('0' <= *s && *s <= '9')
+            n = n*16 + *s - '0';
+        else if('a' <= *s && *s <= 'f')
+            n = n*16 + *s - 'a' + 10;
+        else if('A' <= *s && *s <= 'F')
+            n = n*16 + *s - 'A' + 10;
+        else
+            break;
+    }
+    return n;
+}
+
+void
+usage(void)
+{
+    printf(2, "usage: taskset mask cmd [arg...]\n"
+        "       taskset -p pid [mask]\n"
+        "       taskset -i irq cpu\n");
+    exit();
+}
+
+int
+main(int argc, char *argv[])
+{
+    int pid, mask;
+
+    if(argc < 3)
+        usage();
+    if(strcmp(argv[1], "-i") == 0){
+        if(argc != 4)
+            usage();
+        if(irqaffinity(atoi(argv[2]), atoi(argv[3])) < 0)
+            printf(2, "taskset: cannot route irq %s to cpu %s\n", argv[2], argv[3]);
+        exit();
+    }
+    if(strcmp(argv[1], "-p") == 0){
+        pid = atoi(argv[2]);
+        if(argc > 3 && sched_setaffinity(pid, parsemask(argv[3])) < 0){
+            printf(2, "taskset: cannot set affinity of %d\n", pid);
+            exit();
+        }
+        if((mask = sched_getaffinity(pid)) < 0){
+            printf(2, "taskset: no process %d\n", pid);
+            exit();
+        }
+        printf(1, "pid %d mask 0x%x\n", pid, mask);
+        exit();
+    }
+    if(sched_setaffinity(0, parsemask(argv[1])) < 0){
+        printf(2, "taskset: bad mask %s\n", argv[1]);
+        exit();
+    }
+    exec(argv[2], argv+2);
+    printf(2, "taskset: exec %s failed\n", argv[2]);
+    exit();
+}
@@ -0,0 +1,1525 @@
+
+_time:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <ms>:
+#include "user.h"
+#include "resource.h"
+
+int
+ms(struct timeval *tv)
+{
+   0:	55                   	push   %ebp
+   1:	89 e5                	mov    %esp,%ebp
+   3:	53                   	push   %ebx
+    return tv->tv_sec * 1000 + tv->tv_usec / 1000;
+   4:	8b 45 08             	mov    0x8(%ebp),%eax
+   7:	8b 00                	mov    (%eax),%eax
+   9:	69 d8 e8 03 00 00    	imul   $0x3e8,%eax,%ebx
+   f:	8b 45 08             	mov    0x8(%ebp),%eax
+  12:	8b 48 04             	mov    0x4(%eax),%ecx
+  15:	ba d3 4d 62 10       	mov    $0x10624dd3,%edx
+  1a:	89 c8                	mov    %ecx,%eax
+  1c:	f7 ea                	imul   %edx
+  1e:	c1 fa 06             	sar    $0x6,%edx
+  21:	89 c8                	mov    %ecx,%eax
+  23:	c1 f8 1f             	sar    $0x1f,%eax
+  26:	29 c2                	sub    %eax,%edx
+  28:	8d 04 13             	lea    (%ebx,%edx,1),%eax
+}
+  2b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  2e:	c9                   	leave
+  2f:	c3                   	ret
+
+00000030 <main>:
+
+int
+main(int argc, char *argv[])
+{
+  30:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+  34:	83 e4 f0             	and    $0xfffffff0,%esp
+  37:	ff 71 fc             	push   -0x4(%ecx)
+  3a:	55                   	push   %ebp
+  3b:	89 e5                	mov    %esp,%ebp
+  3d:	56                   	push   %esi
+  3e:	53                   	push   %ebx
+  3f:	51                   	push   %ecx
+  40:	83 ec 3c             	sub    $0x3c,%esp
+  43:	89 cb                	mov    %ecx,%ebx
+    struct rusage ru;
+    int pid, t0;
+
+    if(argc < 2){
+  45:	83 3b 01             	cmpl   $0x1,(%ebx)
+  48:	7f 17                	jg     61 <main+0x31>
+        printf(2, "usage: time cmd [arg...]\n");
+  4a:	83 ec 08             	sub    $0x8,%esp
+  4d:	68 40 0b 00 00       	push   $0xb40
+  52:	6a 02                	push   $0x2
+  54:	e8 2f 07 00 00       	call   788 <printf>
+  59:	83 c4 10             	add    $0x10,%esp
+        exit();
+  5c:	e8 29 04 00 00       	call   48a <exit>
+    }
+    t0 = uptime();
+  61:	e8 d9 04 00 00       	call   53f <uptime>
+  66:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    pid = fork();
+  69:	e8 15 04 00 00       	call   483 <fork>
+  6e:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    if(pid < 0){
+  71:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  75:	79 17                	jns    8e <main+0x5e>
+        printf(2, "time: fork failed\n");
+  77:	83 ec 08             	sub    $0x8,%esp
+  7a:	68 5a 0b 00 00       	push   $0xb5a
+  7f:	6a 02                	push   $0x2
+  81:	e8 02 07 00 00       	call   788 <printf>
+  86:	83 c4 10             	add    $0x10,%esp
+        exit();
+  89:	e8 fc 03 00 00       	call   48a <exit>
+    }
+    if(pid == 0){
+  8e:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  92:	75 3b                	jne    cf <main+0x9f>
+        exec(argv[1], argv+1);
+  94:	8b 43 04             	mov    0x4(%ebx),%eax
+  97:	8d 50 04             	lea    0x4(%eax),%edx
+  9a:	8b 43 04             	mov    0x4(%ebx),%eax
+  9d:	83 c0 04             	add    $0x4,%eax
+  a0:	8b 00                	mov    (%eax),%eax
+  a2:	83 ec 08             	sub    $0x8,%esp
+  a5:	52                   	push   %edx
+  a6:	50                   	push   %eax
+  a7:	e8 1b 04 00 00       	call   4c7 <exec>
+  ac:	83 c4 10             	add    $0x10,%esp
+        printf(2, "time: exec %s failed\n", argv[1]);
+  af:	8b 43 04             	mov    0x4(%ebx),%eax
+  b2:	83 c0 04             	add    $0x4,%eax
+  b5:	8b 00                	mov    (%eax),%eax
+  b7:	83 ec 04             	sub    $0x4,%esp
+  ba:	50                   	push   %eax
+  bb:	68 6d 0b 00 00       	push   $0xb6d
+  c0:	6a 02                	push   $0x2
+  c2:	e8 c1 06 00 00       	call   788 <printf>
+  c7:	83 c4 10             	add    $0x10,%esp
+        exit();
+  ca:	e8 bb 03 00 00       	call   48a <exit>
+    }
+    wait();
+  cf:	e8 bd 03 00 00       	call   491 <wait>
+    if(getrusage(RUSAGE_CHILDREN, &ru) < 0){
+  d4:	83 ec 08             	sub    $0x8,%esp
+  d7:	8d 45 b8             	lea    -0x48(%ebp),%eax
+  da:	50                   	push   %eax
+  db:	6a ff                	push   $0xffffffff
+  dd:	e8 07 05 00 00       	call   5e9 <getrusage>
+  e2:	83 c4 10             	add    $0x10,%esp
+  e5:	85 c0                	test   %eax,%eax
+  e7:	79 17                	jns    100 <main+0xd0>
+        printf(2, "time: getrusage failed\n");
+  e9:	83 ec 08             	sub    $0x8,%esp
+  ec:	68 83 0b 00 00       	push   $0xb83
+  f1:	6a 02                	push   $0x2
+  f3:	e8 90 06 00 00       	call   788 <printf>
+  f8:	83 c4 10             	add    $0x10,%esp
+        exit();
+  fb:	e8 8a 03 00 00       	call   48a <exit>
+    }
+    printf(2, "real %d ticks, user %d ms, sys %d ms\n",
+ 100:	83 ec 0c             	sub    $0xc,%esp
+ 103:	8d 45 b8             	lea    -0x48(%ebp),%eax
+ 106:	83 c0 08             	add    $0x8,%eax
+ 109:	50                   	push   %eax
+ 10a:	e8 f1 fe ff ff       	call   0 <ms>
+ 10f:	83 c4 10             	add    $0x10,%esp
+ 112:	89 c6                	mov    %eax,%esi
+ 114:	83 ec 0c             	sub    $0xc,%esp
+ 117:	8d 45 b8             	lea    -0x48(%ebp),%eax
+ 11a:	50                   	push   %eax
+ 11b:	e8 e0 fe ff ff       	call   0 <ms>
+ 120:	83 c4 10             	add    $0x10,%esp
+ 123:	89 c3                	mov    %eax,%ebx
+        uptime() - t0, ms(&ru.ru_utime), ms(&ru.ru_stime));
+ 125:	e8 15 04 00 00       	call   53f <uptime>
+    printf(2, "real %d ticks, user %d ms, sys %d ms\n",
+ 12a:	2b 45 e4             	sub    -0x1c(%ebp),%eax
+ 12d:	83 ec 0c             	sub    $0xc,%esp
+ 130:	56                   	push   %esi
+ 131:	53                   	push   %ebx
+ 132:	50                   	push   %eax
+ 133:	68 9c 0b 00 00       	push   $0xb9c
+ 138:	6a 02                	push   $0x2
+ 13a:	e8 49 06 00 00       	call   788 <printf>
+ 13f:	83 c4 20             	add    $0x20,%esp
+    printf(2, "%d minor + %d major faults, %d blocks in, %d blocks out\n",
+ 142:	8b 5d d4             	mov    -0x2c(%ebp),%ebx
+ 145:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+ 148:	8b 55 cc             	mov    -0x34(%ebp),%edx
+ 14b:	8b 45 c8             	mov    -0x38(%ebp),%eax
+ 14e:	83 ec 08             	sub    $0x8,%esp
+ 151:	53                   	push   %ebx
+ 152:	51                   	push   %ecx
+ 153:	52                   	push   %edx
+ 154:	50                   	push   %eax
+ 155:	68 c4 0b 00 00       	push   $0xbc4
+ 15a:	6a 02                	push   $0x2
+ 15c:	e8 27 06 00 00       	call   788 <printf>
+ 161:	83 c4 20             	add    $0x20,%esp
+        ru.ru_minflt, ru.ru_majflt, ru.ru_inblock, ru.ru_oublock);
+    printf(2, "%d voluntary + %d involuntary context switches\n",
+ 164:	8b 55 dc             	mov    -0x24(%ebp),%edx
+ 167:	8b 45 d8             	mov    -0x28(%ebp),%eax
+ 16a:	52                   	push   %edx
+ 16b:	50                   	push   %eax
+ 16c:	68 00 0c 00 00       	push   $0xc00
+ 171:	6a 02                	push   $0x2
+ 173:	e8 10 06 00 00       	call   788 <printf>
+ 178:	83 c4 10             	add    $0x10,%esp
+        ru.ru_nvcsw, ru.ru_nivcsw);
+    exit();
+ 17b:	e8 0a 03 00 00       	call   48a <exit>
+
+00000180 <stosb>:
+strchr(const char *s, char c)
+{
+    for(; *s; s++)
+        if(*s == c)
+            return (char*)s;
+    return 0;
+ 180:	55                   	push   %ebp
+ 181:	89 e5                	mov    %esp,%ebp
+ 183:	57                   	push   %edi
+ 184:	53                   	push   %ebx
+}
+ 185:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 188:	8b 55 10             	mov    0x10(%ebp),%edx
+ 18b:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 18e:	89 cb                	mov    %ecx,%ebx
+ 190:	89 df                	mov    %ebx,%edi
+ 192:	89 d1                	mov    %edx,%ecx
+ 194:	fc                   	cld
+ 195:	f3 aa                	rep stos %al,%es:(%edi)
+ 197:	89 ca                	mov    %ecx,%edx
+ 199:	89 fb                	mov    %edi,%ebx
+ 19b:	89 5d 08             	mov    %ebx,0x8(%ebp)
+ 19e:	89 55 10             	mov    %edx,0x10(%ebp)
+
+char*
+gets(char *buf, int max)
+{
+ 1a1:	90                   	nop
+ 1a2:	5b                   	pop    %ebx
+ 1a3:	5f                   	pop    %edi
+ 1a4:	5d                   	pop    %ebp
+ 1a5:	c3                   	ret
+
+000001a6 <strcpy>:
+{
+ 1a6:	55                   	push   %ebp
+ 1a7:	89 e5                	mov    %esp,%ebp
+ 1a9:	83 ec 10             	sub    $0x10,%esp
+    os = s;
+ 1ac:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1af:	89 45 fc             	mov    %eax,-0x4(%ebp)
+    while((*s++ = *t++) != 0)
+ 1b2:	90                   	nop
+ 1b3:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 1b6:	8d 42 01             	lea    0x1(%edx),%eax
+ 1b9:	89 45 0c             	mov    %eax,0xc(%ebp)
+ 1bc:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1bf:	8d 48 01             	lea    0x1(%eax),%ecx
+ 1c2:	89 4d 08             	mov    %ecx,0x8(%ebp)
+ 1c5:	0f b6 12             	movzbl (%edx),%edx
+ 1c8:	88 10                	mov    %dl,(%eax)
+ 1ca:	0f b6 00             	movzbl (%eax),%eax
+ 1cd:	84 c0                	test   %al,%al
+ 1cf:	75 e2                	jne    1b3 <strcpy+0xd>
+    return os;
+ 1d1:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 1d4:	c9                   	leave
+ 1d5:	c3                   	ret
+
+000001d6 <strcmp>:
+{
+ 1d6:	55                   	push   %ebp
+ 1d7:	89 e5                	mov    %esp,%ebp
+    while(*p && *p == *q)
+ 1d9:	eb 08                	jmp    1e3 <strcmp+0xd>
+        p++, q++;
+ 1db:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 1df:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+    while(*p && *p == *q)
+ 1e3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1e6:	0f b6 00             	movzbl (%eax),%eax
+ 1e9:	84 c0                	test   %al,%al
+ 1eb:	74 10                	je     1fd <strcmp+0x27>
+ 1ed:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1f0:	0f b6 10             	movzbl (%eax),%edx
+ 1f3:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 1f6:	0f b6 00             	movzbl (%eax),%eax
+ 1f9:	38 c2                	cmp    %al,%dl
+ 1fb:	74 de                	je     1db <strcmp+0x5>
+    return (uchar)*p - (uchar)*q;
+ 1fd:	8b 45 08             	mov    0x8(%ebp),%eax
+ 200:	0f b6 00             	movzbl (%eax),%eax
+ 203:	0f b6 d0             	movzbl %al,%edx
+ 206:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 209:	0f b6 00             	movzbl (%eax),%eax
+ 20c:	0f b6 c0             	movzbl %al,%eax
+ 20f:	29 c2                	sub    %eax,%edx
+ 211:	89 d0                	mov    %edx,%eax
+}
+ 213:	5d                   	pop    %ebp
+ 214:	c3                   	ret
+
+00000215 <strlen>:
+{
+ 215:	55                   	push   %ebp
+ 216:	89 e5                	mov    %esp,%ebp
+ 218:	83 ec 10             	sub    $0x10,%esp
+    for(n = 0; s[n]; n++)
+ 21b:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ 222:	eb 04                	jmp    228 <strlen+0x13>
+ 224:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 228:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 22b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 22e:	01 d0                	add    %edx,%eax
+ 230:	0f b6 00             	movzbl (%eax),%eax
+ 233:	84 c0                	test   %al,%al
+ 235:	75 ed                	jne    224 <strlen+0xf>
+    return n;
+ 237:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 23a:	c9                   	leave
+ 23b:	c3                   	ret
+
+0000023c <memset>:
+{
+ 23c:	55                   	push   %ebp
+ 23d:	89 e5                	mov    %esp,%ebp
+    stosb(dst, c, n);
+ 23f:	8b 45 10             	mov    0x10(%ebp),%eax
+ 242:	50                   	push   %eax
+ 243:	ff 75 0c             	push   0xc(%ebp)
+ 246:	ff 75 08             	push   0x8(%ebp)
+ 249:	e8 32 ff ff ff       	call   180 <stosb>
+ 24e:	83 c4 0c             	add    $0xc,%esp
+    return dst;
+ 251:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 254:	c9                   	leave
+ 255:	c3                   	ret
+
+00000256 <strchr>:
+{
+ 256:	55                   	push   %ebp
+ 257:	89 e5                	mov    %esp,%ebp
+ 259:	83 ec 04             	sub    $0x4,%esp
+ 25c:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 25f:	88 45 fc             	mov    %al,-0x4(%ebp)
+    for(; *s; s++)
+ 262:	eb 14                	jmp    278 <strchr+0x22>
+        if(*s == c)
+ 264:	8b 45 08             	mov    0x8(%ebp),%eax
+ 267:	0f b6 00             	movzbl (%eax),%eax
+ 26a:	38 45 fc             	cmp    %al,-0x4(%ebp)
+ 26d:	75 05                	jne    274 <strchr+0x1e>
+            return (char*)s;
+ 26f:	8b 45 08             	mov    0x8(%ebp),%eax
+ 272:	eb 13                	jmp    287 <strchr+0x31>
+    for(; *s; s++)
+ 274:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 278:	8b 45 08             	mov    0x8(%ebp),%eax
+ 27b:	0f b6 00             	movzbl (%eax),%eax
+ 27e:	84 c0                	test   %al,%al
+ 280:	75 e2                	jne    264 <strchr+0xe>
+    return 0;
+ 282:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 287:	c9                   	leave
+ 288:	c3                   	ret
+
+00000289 <gets>:
+{
+ 289:	55                   	push   %ebp
+ 28a:	89 e5                	mov    %esp,%ebp
+ 28c:	83 ec 18             	sub    $0x18,%esp
+    int i, cc;
+    char c;
+
+    for(i=0; i+1 < max; ){
+ 28f:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 296:	eb 42                	jmp    2da <gets+0x51>
+        cc = read(0, &c, 1);
+ 298:	83 ec 04             	sub    $0x4,%esp
+ 29b:	6a 01                	push   $0x1
+ 29d:	8d 45 ef             	lea    -0x11(%ebp),%eax
+ 2a0:	50                   	push   %eax
+ 2a1:	6a 00                	push   $0x0
+ 2a3:	e8 f7 01 00 00       	call   49f <read>
+ 2a8:	83 c4 10             	add    $0x10,%esp
+ 2ab:	89 45 f0             	mov    %eax,-0x10(%ebp)
+        if(cc < 1)
+ 2ae:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 2b2:	7e 33                	jle    2e7 <gets+0x5e>
+            break;
+        buf[i++] = c;
+ 2b4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 2b7:	8d 50 01             	lea    0x1(%eax),%edx
+ 2ba:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 2bd:	89 c2                	mov    %eax,%edx
+ 2bf:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2c2:	01 c2                	add    %eax,%edx
+ 2c4:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 2c8:	88 02                	mov    %al,(%edx)
+        if(c == '\n' || c == '\r')
+ 2ca:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 2ce:	3c 0a                	cmp    $0xa,%al
+ 2d0:	74 16                	je     2e8 <gets+0x5f>
+ 2d2:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 2d6:	3c 0d                	cmp    $0xd,%al
+ 2d8:	74 0e                	je     2e8 <gets+0x5f>
+    for(i=0; i+1 < max; ){
+ 2da:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 2dd:	83 c0 01             	add    $0x1,%eax
+ 2e0:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 2e3:	7f b3                	jg     298 <gets+0xf>
+ 2e5:	eb 01                	jmp    2e8 <gets+0x5f>
+            break;
+ 2e7:	90                   	nop
+            break;
+    }
+    buf[i] = '\0';
+ 2e8:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 2eb:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2ee:	01 d0                	add    %edx,%eax
+ 2f0:	c6 00 00             	movb   $0x0,(%eax)
+    return buf;
+ 2f3:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 2f6:	c9                   	leave
+ 2f7:	c3                   	ret
+
+000002f8 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 2f8:	55                   	push   %ebp
+ 2f9:	89 e5                	mov    %esp,%ebp
+ 2fb:	83 ec 18             	sub    $0x18,%esp
+    int fd;
+    int r;
+
+    fd = open(n, O_RDONLY);
+ 2fe:	83 ec 08             	sub    $0x8,%esp
+ 301:	6a 00                	push   $0x0
+ 303:	ff 75 08             	push   0x8(%ebp)
+ 306:	e8 c6 01 00 00       	call   4d1 <open>
+ 30b:	83 c4 10             	add    $0x10,%esp
+ 30e:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(fd < 0)
+ 311:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 315:	79 07                	jns    31e <stat+0x26>
+        return -1;
+ 317:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 31c:	eb 25                	jmp    343 <stat+0x4b>
+    r = fstat(fd, st);
+ 31e:	83 ec 08             	sub    $0x8,%esp
+ 321:	ff 75 0c             	push   0xc(%ebp)
+ 324:	ff 75 f4             	push   -0xc(%ebp)
+ 327:	e8 c3 01 00 00       	call   4ef <fstat>
+ 32c:	83 c4 10             	add    $0x10,%esp
+ 32f:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    close(fd);
+ 332:	83 ec 0c             	sub    $0xc,%esp
+ 335:	ff 75 f4             	push   -0xc(%ebp)
+ 338:	e8 76 01 00 00       	call   4b3 <close>
+ 33d:	83 c4 10             	add    $0x10,%esp
+    return r;
+ 340:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ 343:	c9                   	leave
+ 344:	c3                   	ret
+
+00000345 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 345:	55                   	push   %ebp
+ 346:	89 e5                	mov    %esp,%ebp
+ 348:	83 ec 10             	sub    $0x10,%esp
+    int n;
+
+    n = 0;
+ 34b:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+    while('0' <= *s && *s <= '9')
+ 352:	eb 25                	jmp    379 <atoi+0x34>
+        n = n*10 + *s++ - '0';
+ 354:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 357:	89 d0                	mov    %edx,%eax
+ 359:	c1 e0 02             	shl    $0x2,%eax
+ 35c:	01 d0                	add    %edx,%eax
+ 35e:	01 c0                	add    %eax,%eax
+ 360:	89 c1                	mov    %eax,%ecx
+ 362:	8b 45 08             	mov    0x8(%ebp),%eax
+ 365:	8d 50 01             	lea    0x1(%eax),%edx
+ 368:	89 55 08             	mov    %edx,0x8(%ebp)
+ 36b:	0f b6 00             	movzbl (%eax),%eax
+ 36e:	0f be c0             	movsbl %al,%eax
+ 371:	01 c8                	add    %ecx,%eax
+ 373:	83 e8 30             	sub    $0x30,%eax
+ 376:	89 45 fc             	mov    %eax,-0x4(%ebp)
+    while('0' <= *s && *s <= '9')
+ 379:	8b 45 08             	mov    0x8(%ebp),%eax
+ 37c:	0f b6 00             	movzbl (%eax),%eax
+ 37f:	3c 2f                	cmp    $0x2f,%al
+ 381:	7e 0a                	jle    38d <atoi+0x48>
+ 383:	8b 45 08             	mov    0x8(%ebp),%eax
+ 386:	0f b6 00             	movzbl (%eax),%eax
+ 389:	3c 39                	cmp    $0x39,%al
+ 38b:	7e c7                	jle    354 <atoi+0xf>
+    return n;
+ 38d:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 390:	c9                   	leave
+ 391:	c3                   	ret
+
+00000392 <nice>:
+
+// Add inc to the caller's nice value; return the new value.
+int
+nice(int inc)
+{
+ 392:	55                   	push   %ebp
+ 393:	89 e5                	mov    %esp,%ebp
+ 395:	83 ec 18             	sub    $0x18,%esp
+    int n;
+
+    n = getpriority(0) + inc;
+ 398:	83 ec 0c             	sub    $0xc,%esp
+ 39b:	6a 00                	push   $0x0
+ 39d:	e8 d9 01 00 00       	call   57b <getpriority>
+ 3a2:	83 c4 10             	add    $0x10,%esp
+ 3a5:	8b 55 08             	mov    0x8(%ebp),%edx
+ 3a8:	01 d0                	add    %edx,%eax
+ 3aa:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(n < 0)
+ 3ad:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 3b1:	79 07                	jns    3ba <nice+0x28>
+        n = 0;
+ 3b3:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    if(n > NICEMAX)
+ 3ba:	83 7d f4 13          	cmpl   $0x13,-0xc(%ebp)
+ 3be:	7e 07                	jle    3c7 <nice+0x35>
+        n = NICEMAX;
+ 3c0:	c7 45 f4 13 00 00 00 	movl   $0x13,-0xc(%ebp)
+    if(setpriority(0, n) < 0)
+ 3c7:	83 ec 08             	sub    $0x8,%esp
+ 3ca:	ff 75 f4             	push   -0xc(%ebp)
+ 3cd:	6a 00                	push   $0x0
+ 3cf:	e8 b1 01 00 00       	call   585 <setpriority>
+ 3d4:	83 c4 10             	add    $0x10,%esp
+ 3d7:	85 c0                	test   %eax,%eax
+ 3d9:	79 07                	jns    3e2 <nice+0x50>
+        return -1;
+ 3db:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 3e0:	eb 03                	jmp    3e5 <nice+0x53>
+    return n;
+ 3e2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+ 3e5:	c9                   	leave
+ 3e6:	c3                   	ret
+
+000003e7 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 3e7:	55                   	push   %ebp
+ 3e8:	89 e5                	mov    %esp,%ebp
+ 3ea:	83 ec 10             	sub    $0x10,%esp
+    char *dst;
+    const char *src;
+
+    dst = vdst;
+ 3ed:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3f0:	89 45 fc             	mov    %eax,-0x4(%ebp)
+    src = vsrc;
+ 3f3:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 3f6:	89 45 f8             	mov    %eax,-0x8(%ebp)
+    while(n-- > 0)
+ 3f9:	eb 17                	jmp    412 <memmove+0x2b>
+        *dst++ = *src++;
+ 3fb:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 3fe:	8d 42 01             	lea    0x1(%edx),%eax
+ 401:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 404:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 407:	8d 48 01             	lea    0x1(%eax),%ecx
+ 40a:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+ 40d:	0f b6 12             	movzbl (%edx),%edx
+ 410:	88 10                	mov    %dl,(%eax)
+    while(n-- > 0)
+ 412:	8b 45 10             	mov    0x10(%ebp),%eax
+ 415:	8d 50 ff             	lea    -0x1(%eax),%edx
+ 418:	89 55 10             	mov    %edx,0x10(%ebp)
+ 41b:	85 c0                	test   %eax,%eax
+ 41d:	7f dc                	jg     3fb <memmove+0x14>
+    return vdst;
+ 41f:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 422:	c9                   	leave
+ 423:	c3                   	ret
+
+00000424 <dosyscall>:
+sysmode:
+    .long 0
+
+    .text
+dosyscall:
+    cmpl $0, sysmode
+ 424:	83 3d c8 0e 00 00 00 	cmpl   $0x0,0xec8
+    jg 2f
+ 42b:	7f 0c                	jg     439 <dosyscall+0x15>
+    jl 1f
+ 42d:	7c 07                	jl     436 <dosyscall+0x12>
+    call sepcheck
+ 42f:	e8 27 00 00 00       	call   45b <sepcheck>
+    jmp dosyscall
+ 434:	eb ee                	jmp    424 <dosyscall>
+1:
+    int $T_SYSCALL
+ 436:	cd 40                	int    $0x40
+    ret
+ 438:	c3                   	ret
+2:
+    pushl %ebx
+ 439:	53                   	push   %ebx
+    pushl %esi
+ 43a:	56                   	push   %esi
+    pushl %edi
+ 43b:	57                   	push   %edi
+    pushl %ebp
+ 43c:	55                   	push   %ebp
+    movl 20(%esp), %ebx
+ 43d:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+    movl 24(%esp), %esi
+ 441:	8b 74 24 18          	mov    0x18(%esp),%esi
+    movl 28(%esp), %edi
+ 445:	8b 7c 24 1c          	mov    0x1c(%esp),%edi
+    movl 32(%esp), %ebp
+ 449:	8b 6c 24 20          	mov    0x20(%esp),%ebp
+    movl %esp, %ecx
+ 44d:	89 e1                	mov    %esp,%ecx
+    movl $3f, %edx
+ 44f:	ba 56 04 00 00       	mov    $0x456,%edx
+    sysenter
+ 454:	0f 34                	sysenter
+3:
+    popl %ebp
+ 456:	5d                   	pop    %ebp
+    popl %edi
+ 457:	5f                   	pop    %edi
+    popl %esi
+ 458:	5e                   	pop    %esi
+    popl %ebx
+ 459:	5b                   	pop    %ebx
+    ret
+ 45a:	c3                   	ret
+
+0000045b <sepcheck>:
+
+# Set sysmode from cpuid's SEP flag.    Preserves %eax.
+sepcheck:
+    pushl %eax
+ 45b:	50                   	push   %eax
+    pushl %ebx
+ 45c:	53                   	push   %ebx
+    movl $1, %eax
+ 45d:	b8 01 00 00 00       	mov    $0x1,%eax
+    cpuid
+ 462:	0f a2                	cpuid
+    movl $-1, sysmode
+ 464:	c7 05 c8 0e 00 00 ff 	movl   $0xffffffff,0xec8
+ 46b:	ff ff ff 
+    testl $0x800, %edx
+ 46e:	f7 c2 00 08 00 00    	test   $0x800,%edx
+    jz 1f
+ 474:	74 0a                	je     480 <sepcheck+0x25>
+    movl $1, sysmode
+ 476:	c7 05 c8 0e 00 00 01 	movl   $0x1,0xec8
+ 47d:	00 00 00 
+1:
+    popl %ebx
+ 480:	5b                   	pop    %ebx
+    popl %eax
+ 481:	58                   	pop    %eax
+    ret
+ 482:	c3                   	ret
+
+00000483 <fork>:
+
+SYSCALL(fork)
+ 483:	b8 01 00 00 00       	mov    $0x1,%eax
+ 488:	eb 9a                	jmp    424 <dosyscall>
+
+0000048a <exit>:
+SYSCALL(exit)
+ 48a:	b8 02 00 00 00       	mov    $0x2,%eax
+ 48f:	eb 93                	jmp    424 <dosyscall>
+
+00000491 <wait>:
+SYSCALL(wait)
+ 491:	b8 03 00 00 00       	mov    $0x3,%eax
+ 496:	eb 8c                	jmp    424 <dosyscall>
+
+00000498 <pipe>:
+SYSCALL(pipe)
+ 498:	b8 04 00 00 00       	mov    $0x4,%eax
+ 49d:	eb 85                	jmp    424 <dosyscall>
+
+0000049f <read>:
+SYSCALL(read)
+ 49f:	b8 05 00 00 00       	mov    $0x5,%eax
+ 4a4:	e9 7b ff ff ff       	jmp    424 <dosyscall>
+
+000004a9 <write>:
+SYSCALL(write)
+ 4a9:	b8 10 00 00 00       	mov    $0x10,%eax
+ 4ae:	e9 71 ff ff ff       	jmp    424 <dosyscall>
+
+000004b3 <close>:
+SYSCALL(close)
+ 4b3:	b8 15 00 00 00       	mov    $0x15,%eax
+ 4b8:	e9 67 ff ff ff       	jmp    424 <dosyscall>
+
+000004bd <kill>:
+SYSCALL(kill)
+ 4bd:	b8 06 00 00 00       	mov    $0x6,%eax
+ 4c2:	e9 5d ff ff ff       	jmp    424 <dosyscall>
+
+000004c7 <exec>:
+SYSCALL(exec)
+ 4c7:	b8 07 00 00 00       	mov    $0x7,%eax
+ 4cc:	e9 53 ff ff ff       	jmp    424 <dosyscall>
+
+000004d1 <open>:
+SYSCALL(open)
+ 4d1:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 4d6:	e9 49 ff ff ff       	jmp    424 <dosyscall>
+
+000004db <mknod>:
+SYSCALL(mknod)
+ 4db:	b8 11 00 00 00       	mov    $0x11,%eax
+ 4e0:	e9 3f ff ff ff       	jmp    424 <dosyscall>
+
+000004e5 <unlink>:
+SYSCALL(unlink)
+ 4e5:	b8 12 00 00 00       	mov    $0x12,%eax
+ 4ea:	e9 35 ff ff ff       	jmp    424 <dosyscall>
+
+000004ef <fstat>:
+SYSCALL(fstat)
+ 4ef:	b8 08 00 00 00       	mov    $0x8,%eax
+ 4f4:	e9 2b ff ff ff       	jmp    424 <dosyscall>
+
+000004f9 <link>:
+SYSCALL(link)
+ 4f9:	b8 13 00 00 00       	mov    $0x13,%eax
+ 4fe:	e9 21 ff ff ff       	jmp    424 <dosyscall>
+
+00000503 <mkdir>:
+SYSCALL(mkdir)
+ 503:	b8 14 00 00 00       	mov    $0x14,%eax
+ 508:	e9 17 ff ff ff       	jmp    424 <dosyscall>
+
+0000050d <chdir>:
+SYSCALL(chdir)
+ 50d:	b8 09 00 00 00       	mov    $0x9,%eax
+ 512:	e9 0d ff ff ff       	jmp    424 <dosyscall>
+
+00000517 <dup>:
+SYSCALL(dup)
+ 517:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 51c:	e9 03 ff ff ff       	jmp    424 <dosyscall>
+
+00000521 <getpid>:
+SYSCALL(getpid)
+ 521:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 526:	e9 f9 fe ff ff       	jmp    424 <dosyscall>
+
+0000052b <sbrk>:
+SYSCALL(sbrk)
+ 52b:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 530:	e9 ef fe ff ff       	jmp    424 <dosyscall>
+
+00000535 <sleep>:
+SYSCALL(sleep)
+ 535:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 53a:	e9 e5 fe ff ff       	jmp    424 <dosyscall>
+
+0000053f <uptime>:
+SYSCALL(uptime)
+ 53f:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 544:	e9 db fe ff ff       	jmp    424 <dosyscall>
+
+00000549 <date>:
+SYSCALL(date)
+ 549:	b8 16 00 00 00       	mov    $0x16,%eax
+ 54e:	e9 d1 fe ff ff       	jmp    424 <dosyscall>
+
+00000553 <dup2>:
+SYSCALL(dup2)
+ 553:	b8 17 00 00 00       	mov    $0x17,%eax
+ 558:	e9 c7 fe ff ff       	jmp    424 <dosyscall>
+
+0000055d <uffd>:
+SYSCALL(uffd)
+ 55d:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 562:	e9 bd fe ff ff       	jmp    424 <dosyscall>
+
+00000567 <uffdregister>:
+SYSCALL(uffdregister)
+ 567:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 56c:	e9 b3 fe ff ff       	jmp    424 <dosyscall>
+
+00000571 <uffdcopy>:
+SYSCALL(uffdcopy)
+ 571:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 576:	e9 a9 fe ff ff       	jmp    424 <dosyscall>
+
+0000057b <getpriority>:
+SYSCALL(getpriority)
+ 57b:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 580:	e9 9f fe ff ff       	jmp    424 <dosyscall>
+
+00000585 <setpriority>:
+SYSCALL(setpriority)
+ 585:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 58a:	e9 95 fe ff ff       	jmp    424 <dosyscall>
+
+0000058f <setweight>:
+SYSCALL(setweight)
+ 58f:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 594:	e9 8b fe ff ff       	jmp    424 <dosyscall>
+
+00000599 <setgroup>:
+SYSCALL(setgroup)
+ 599:	b8 20 00 00 00       	mov    $0x20,%eax
+ 59e:	e9 81 fe ff ff       	jmp    424 <dosyscall>
+
+000005a3 <schedinfo>:
+SYSCALL(schedinfo)
+ 5a3:	b8 21 00 00 00       	mov    $0x21,%eax
+ 5a8:	e9 77 fe ff ff       	jmp    424 <dosyscall>
+
+000005ad <nanosleep>:
+SYSCALL(nanosleep)
+ 5ad:	b8 22 00 00 00       	mov    $0x22,%eax
+ 5b2:	e9 6d fe ff ff       	jmp    424 <dosyscall>
+
+000005b7 <clock_nanosleep>:
+SYSCALL(clock_nanosleep)
+ 5b7:	b8 23 00 00 00       	mov    $0x23,%eax
+ 5bc:	e9 63 fe ff ff       	jmp    424 <dosyscall>
+
+000005c1 <clock_gettime>:
+SYSCALL(clock_gettime)
+ 5c1:	b8 24 00 00 00       	mov    $0x24,%eax
+ 5c6:	e9 59 fe ff ff       	jmp    424 <dosyscall>
+
+000005cb <sched_setaffinity>:
+SYSCALL(sched_setaffinity)
+ 5cb:	b8 25 00 00 00       	mov    $0x25,%eax
+ 5d0:	e9 4f fe ff ff       	jmp    424 <dosyscall>
+
+000005d5 <sched_getaffinity>:
+SYSCALL(sched_getaffinity)
+ 5d5:	b8 26 00 00 00       	mov    $0x26,%eax
+ 5da:	e9 45 fe ff ff       	jmp    424 <dosyscall>
+
+000005df <irqaffinity>:
+SYSCALL(irqaffinity)
+ 5df:	b8 27 00 00 00       	mov    $0x27,%eax
+ 5e4:	e9 3b fe ff ff       	jmp    424 <dosyscall>
+
+000005e9 <getrusage>:
+SYSCALL(getrusage)
+ 5e9:	b8 28 00 00 00       	mov    $0x28,%eax
+ 5ee:	e9 31 fe ff ff       	jmp    424 <dosyscall>
+
+000005f3 <times>:
+SYSCALL(times)
+ 5f3:	b8 29 00 00 00       	mov    $0x29,%eax
+ 5f8:	e9 27 fe ff ff       	jmp    424 <dosyscall>
+
+000005fd <schedlat>:
+SYSCALL(schedlat)
+ 5fd:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 602:	e9 1d fe ff ff       	jmp    424 <dosyscall>
+
+00000607 <sched_setscheduler>:
+SYSCALL(sched_setscheduler)
+ 607:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 60c:	e9 13 fe ff ff       	jmp    424 <dosyscall>
+
+00000611 <sched_getscheduler>:
+SYSCALL(sched_getscheduler)
+ 611:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 616:	e9 09 fe ff ff       	jmp    424 <dosyscall>
+
+0000061b <sched_getparam>:
+SYSCALL(sched_getparam)
+ 61b:	b8 2d 00 00 00       	mov    $0x2d,%eax
+ 620:	e9 ff fd ff ff       	jmp    424 <dosyscall>
+
+00000625 <lockstat>:
+SYSCALL(lockstat)
+ 625:	b8 2e 00 00 00       	mov    $0x2e,%eax
+ 62a:	e9 f5 fd ff ff       	jmp    424 <dosyscall>
+
+0000062f <ioring_setup>:
+SYSCALL(ioring_setup)
+ 62f:	b8 2f 00 00 00       	mov    $0x2f,%eax
+ 634:	e9 eb fd ff ff       	jmp    424 <dosyscall>
+
+00000639 <ioring_enter>:
+SYSCALL(ioring_enter)
+ 639:	b8 30 00 00 00       	mov    $0x30,%eax
+ 63e:	e9 e1 fd ff ff       	jmp    424 <dosyscall>
+
+00000643 <readv>:
+SYSCALL(readv)
+ 643:	b8 31 00 00 00       	mov    $0x31,%eax
+ 648:	e9 d7 fd ff ff       	jmp    424 <dosyscall>
+
+0000064d <writev>:
+SYSCALL(writev)
+ 64d:	b8 32 00 00 00       	mov    $0x32,%eax
+ 652:	e9 cd fd ff ff       	jmp    424 <dosyscall>
+
+00000657 <pread>:
+SYSCALL(pread)
+ 657:	b8 33 00 00 00       	mov    $0x33,%eax
+ 65c:	e9 c3 fd ff ff       	jmp    424 <dosyscall>
+
+00000661 <pwrite>:
+SYSCALL(pwrite)
+ 661:	b8 34 00 00 00       	mov    $0x34,%eax
+ 666:	e9 b9 fd ff ff       	jmp    424 <dosyscall>
+
+0000066b <sendfile>:
+SYSCALL(sendfile)
+ 66b:	b8 35 00 00 00       	mov    $0x35,%eax
+ 670:	e9 af fd ff ff       	jmp    424 <dosyscall>
+
+00000675 <splice>:
+SYSCALL(splice)
+ 675:	b8 36 00 00 00       	mov    $0x36,%eax
+ 67a:	e9 a5 fd ff ff       	jmp    424 <dosyscall>
+
+0000067f <sysstat>:
+SYSCALL(sysstat)
+ 67f:	b8 37 00 00 00       	mov    $0x37,%eax
+ 684:	e9 9b fd ff ff       	jmp    424 <dosyscall>
+
+00000689 <strace>:
+SYSCALL(strace)
+ 689:	b8 38 00 00 00       	mov    $0x38,%eax
+ 68e:	e9 91 fd ff ff       	jmp    424 <dosyscall>
+
+00000693 <straceread>:
+SYSCALL(straceread)
+ 693:	b8 39 00 00 00       	mov    $0x39,%eax
+ 698:	e9 87 fd ff ff       	jmp    424 <dosyscall>
+
+0000069d <alarm>:
+
+# alarm and rstoregs keep to int $T_SYSCALL: rstoregs restores
+# %ecx and %edx, which sysexit would clobber.
+.globl alarm
+    alarm:
+        pushl $rstoregs
+ 69d:	68 ad 06 00 00       	push   $0x6ad
+        movl $SYS_alarm, %eax
+ 6a2:	b8 18 00 00 00       	mov    $0x18,%eax
+        int $T_SYSCALL
+ 6a7:	cd 40                	int    $0x40
+        add $0x04, %esp
+ 6a9:	83 c4 04             	add    $0x4,%esp
+        ret
+ 6ac:	c3                   	ret
+
+000006ad <rstoregs>:
+
+.globl rstoregs
+    rstoregs:
+        movl $SYS_rstoregs, %eax
+ 6ad:	b8 19 00 00 00       	mov    $0x19,%eax
+        int $T_SYSCALL
+ 6b2:	cd 40                	int    $0x40
+
+000006b4 <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 6b4:	55                   	push   %ebp
+ 6b5:	89 e5                	mov    %esp,%ebp
+ 6b7:	83 ec 18             	sub    $0x18,%esp
+ 6ba:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 6bd:	88 45 f4             	mov    %al,-0xc(%ebp)
+    write(fd, &c, 1);
+ 6c0:	83 ec 04             	sub    $0x4,%esp
+ 6c3:	6a 01                	push   $0x1
+ 6c5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+ 6c8:	50                   	push   %eax
+ 6c9:	ff 75 08             	push   0x8(%ebp)
+ 6cc:	e8 d8 fd ff ff       	call   4a9 <write>
+ 6d1:	83 c4 10             	add    $0x10,%esp
+}
+ 6d4:	90                   	nop
+ 6d5:	c9                   	leave
+ 6d6:	c3                   	ret
+
+000006d7 <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 6d7:	55                   	push   %ebp
+ 6d8:	89 e5                	mov    %esp,%ebp
+ 6da:	83 ec 28             	sub    $0x28,%esp
+    static char digits[] = "0123456789ABCDEF";
+    char buf[16];
+    int i, neg;
+    uint x;
+
+    neg = 0;
+ 6dd:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+    if(sgn && xx < 0){
+ 6e4:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+ 6e8:	74 17                	je     701 <printint+0x2a>
+ 6ea:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 6ee:	79 11                	jns    701 <printint+0x2a>
+        neg = 1;
+ 6f0:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+        x = -xx;
+ 6f7:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 6fa:	f7 d8                	neg    %eax
+ 6fc:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 6ff:	eb 06                	jmp    707 <printint+0x30>
+    } else {
+        x = xx;
+ 701:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 704:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    }
+
+    i = 0;
+ 707:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    do{
+        buf[i++] = digits[x % base];
+ 70e:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 711:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 714:	ba 00 00 00 00       	mov    $0x0,%edx
+ 719:	f7 f1                	div    %ecx
+ 71b:	89 d1                	mov    %edx,%ecx
+ 71d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 720:	8d 50 01             	lea    0x1(%eax),%edx
+ 723:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 726:	0f b6 91 cc 0e 00 00 	movzbl 0xecc(%ecx),%edx
+ 72d:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+    }while((x /= base) != 0);
+ 731:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 734:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 737:	ba 00 00 00 00       	mov    $0x0,%edx
+ 73c:	f7 f1                	div    %ecx
+ 73e:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 741:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 745:	75 c7                	jne    70e <printint+0x37>
+    if(neg)
+ 747:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 74b:	74 2d                	je     77a <printint+0xa3>
+        buf[i++] = '-';
+ 74d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 750:	8d 50 01             	lea    0x1(%eax),%edx
+ 753:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 756:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+    while(--i >= 0)
+ 75b:	eb 1d                	jmp    77a <printint+0xa3>
+        putc(fd, buf[i]);
+ 75d:	8d 55 dc             	lea    -0x24(%ebp),%edx
+ 760:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 763:	01 d0                	add    %edx,%eax
+ 765:	0f b6 00             	movzbl (%eax),%eax
+ 768:	0f be c0             	movsbl %al,%eax
+ 76b:	83 ec 08             	sub    $0x8,%esp
+ 76e:	50                   	push   %eax
+ 76f:	ff 75 08             	push   0x8(%ebp)
+ 772:	e8 3d ff ff ff       	call   6b4 <putc>
+ 777:	83 c4 10             	add    $0x10,%esp
+    while(--i >= 0)
+ 77a:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+ 77e:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 782:	79 d9                	jns    75d <printint+0x86>
+}
+ 784:	90                   	nop
+ 785:	90                   	nop
+ 786:	c9                   	leave
+ 787:	c3                   	ret
+
+00000788 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 788:	55                   	push   %ebp
+ 789:	89 e5                	mov    %esp,%ebp
+ 78b:	83 ec 28             	sub    $0x28,%esp
+    char *s;
+    int c, i, state;
+    uint *ap;
+
+    state = 0;
+ 78e:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+    ap = (uint*)(void*)&fmt + 1;
+ 795:	8d 45 0c             	lea    0xc(%ebp),%eax
+ 798:	83 c0 04             	add    $0x4,%eax
+ 79b:	89 45 e8             	mov    %eax,-0x18(%ebp)
+    for(i = 0; fmt[i]; i++){
+ 79e:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 7a5:	e9 59 01 00 00       	jmp    903 <printf+0x17b>
+        c = fmt[i] & 0xff;
+ 7aa:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 7ad:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 7b0:	01 d0                	add    %edx,%eax
+ 7b2:	0f b6 00             	movzbl (%eax),%eax
+ 7b5:	0f be c0             	movsbl %al,%eax
+ 7b8:	25 ff 00 00 00       	and    $0xff,%eax
+ 7bd:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        if(state == 0){
+ 7c0:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 7c4:	75 2c                	jne    7f2 <printf+0x6a>
+            if(c == '%'){
+ 7c6:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 7ca:	75 0c                	jne    7d8 <printf+0x50>
+                state = '%';
+ 7cc:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+ 7d3:	e9 27 01 00 00       	jmp    8ff <printf+0x177>
+            } else {
+                putc(fd, c);
+ 7d8:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 7db:	0f be c0             	movsbl %al,%eax
+ 7de:	83 ec 08             	sub    $0x8,%esp
+ 7e1:	50                   	push   %eax
+ 7e2:	ff 75 08             	push   0x8(%ebp)
+ 7e5:	e8 ca fe ff ff       	call   6b4 <putc>
+ 7ea:	83 c4 10             	add    $0x10,%esp
+ 7ed:	e9 0d 01 00 00       	jmp    8ff <printf+0x177>
+            }
+        } else if(state == '%'){
+ 7f2:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+ 7f6:	0f 85 03 01 00 00    	jne    8ff <printf+0x177>
+            if(c == 'd'){
+ 7fc:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+ 800:	75 1e                	jne    820 <printf+0x98>
+                printint(fd, *ap, 10, 1);
+ 802:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 805:	8b 00                	mov    (%eax),%eax
+ 807:	6a 01                	push   $0x1
+ 809:	6a 0a                	push   $0xa
+ 80b:	50                   	push   %eax
+ 80c:	ff 75 08             	push   0x8(%ebp)
+ 80f:	e8 c3 fe ff ff       	call   6d7 <printint>
+ 814:	83 c4 10             	add    $0x10,%esp
+                ap++;
+ 817:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 81b:	e9 d8 00 00 00       	jmp    8f8 <printf+0x170>
+            } else if(c == 'x' || c == 'p'){
+ 820:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+ 824:	74 06                	je     82c <printf+0xa4>
+ 826:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+ 82a:	75 1e                	jne    84a <printf+0xc2>
+                printint(fd, *ap, 16, 0);
+ 82c:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 82f:	8b 00                	mov    (%eax),%eax
+ 831:	6a 00                	push   $0x0
+ 833:	6a 10                	push   $0x10
+ 835:	50                   	push   %eax
+ 836:	ff 75 08             	push   0x8(%ebp)
+ 839:	e8 99 fe ff ff       	call   6d7 <printint>
+ 83e:	83 c4 10             	add    $0x10,%esp
+                ap++;
+ 841:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 845:	e9 ae 00 00 00       	jmp    8f8 <printf+0x170>
+            } else if(c == 's'){
+ 84a:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+ 84e:	75 43                	jne    893 <printf+0x10b>
+                s = (char*)*ap;
+ 850:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 853:	8b 00                	mov    (%eax),%eax
+ 855:	89 45 f4             	mov    %eax,-0xc(%ebp)
+                ap++;
+ 858:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+                if(s == 0)
+ 85c:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 860:	75 25                	jne    887 <printf+0xff>
+                    s = "(null)";
+ 862:	c7 45 f4 30 0c 00 00 	movl   $0xc30,-0xc(%ebp)
+                while(*s != 0){
+ 869:	eb 1c                	jmp    887 <printf+0xff>
+                    putc(fd, *s);
+ 86b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 86e:	0f b6 00             	movzbl (%eax),%eax
+ 871:	0f be c0             	movsbl %al,%eax
+ 874:	83 ec 08             	sub    $0x8,%esp
+ 877:	50                   	push   %eax
+ 878:	ff 75 08             	push   0x8(%ebp)
+ 87b:	e8 34 fe ff ff       	call   6b4 <putc>
+ 880:	83 c4 10             	add    $0x10,%esp
+                    s++;
+ 883:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+                while(*s != 0){
+ 887:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 88a:	0f b6 00             	movzbl (%eax),%eax
+ 88d:	84 c0                	test   %al,%al
+ 88f:	75 da                	jne    86b <printf+0xe3>
+ 891:	eb 65                	jmp    8f8 <printf+0x170>
+                }
+            } else if(c == 'c'){
+ 893:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+ 897:	75 1d                	jne    8b6 <printf+0x12e>
+                putc(fd, *ap);
+ 899:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 89c:	8b 00                	mov    (%eax),%eax
+ 89e:	0f be c0             	movsbl %al,%eax
+ 8a1:	83 ec 08             	sub    $0x8,%esp
+ 8a4:	50                   	push   %eax
+ 8a5:	ff 75 08             	push   0x8(%ebp)
+ 8a8:	e8 07 fe ff ff       	call   6b4 <putc>
+ 8ad:	83 c4 10             	add    $0x10,%esp
+                ap++;
+ 8b0:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 8b4:	eb 42                	jmp    8f8 <printf+0x170>
+            } else if(c == '%'){
+ 8b6:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 8ba:	75 17                	jne    8d3 <printf+0x14b>
+                putc(fd, c);
+ 8bc:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 8bf:	0f be c0             	movsbl %al,%eax
+ 8c2:	83 ec 08             	sub    $0x8,%esp
+ 8c5:	50                   	push   %eax
+ 8c6:	ff 75 08             	push   0x8(%ebp)
+ 8c9:	e8 e6 fd ff ff       	call   6b4 <putc>
+ 8ce:	83 c4 10             	add    $0x10,%esp
+ 8d1:	eb 25                	jmp    8f8 <printf+0x170>
+            } else {
+                // Unknown % sequence.    Print it to draw attention.
+                putc(fd, '%');
+ 8d3:	83 ec 08             	sub    $0x8,%esp
+ 8d6:	6a 25                	push   $0x25
+ 8d8:	ff 75 08             	push   0x8(%ebp)
+ 8db:	e8 d4 fd ff ff       	call   6b4 <putc>
+ 8e0:	83 c4 10             	add    $0x10,%esp
+                putc(fd, c);
+ 8e3:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 8e6:	0f be c0             	movsbl %al,%eax
+ 8e9:	83 ec 08             	sub    $0x8,%esp
+ 8ec:	50                   	push   %eax
+ 8ed:	ff 75 08             	push   0x8(%ebp)
+ 8f0:	e8 bf fd ff ff       	call   6b4 <putc>
+ 8f5:	83 c4 10             	add    $0x10,%esp
+            }
+            state = 0;
+ 8f8:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+    for(i = 0; fmt[i]; i++){
+ 8ff:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ 903:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 906:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 909:	01 d0                	add    %edx,%eax
+ 90b:	0f b6 00             	movzbl (%eax),%eax
+ 90e:	84 c0                	test   %al,%al
+ 910:	0f 85 94 fe ff ff    	jne    7aa <printf+0x22>
+        }
+    }
+}
+ 916:	90                   	nop
+ 917:	90                   	nop
+ 918:	c9                   	leave
+ 919:	c3                   	ret
+
+0000091a <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 91a:	55                   	push   %ebp
+ 91b:	89 e5                	mov    %esp,%ebp
+ 91d:	83 ec 10             	sub    $0x10,%esp
+    Header *bp, *p;
+
+    bp = (Header*)ap - 1;
+ 920:	8b 45 08             	mov    0x8(%ebp),%eax
+ 923:	83 e8 08             	sub    $0x8,%eax
+ 926:	89 45 f8             	mov    %eax,-0x8(%ebp)
+    for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 929:	a1 e8 0e 00 00       	mov    0xee8,%eax
+ 92e:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 931:	eb 24                	jmp    957 <free+0x3d>
+        if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 933:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 936:	8b 00                	mov    (%eax),%eax
+ 938:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 93b:	72 12                	jb     94f <free+0x35>
+ 93d:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 940:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 943:	72 24                	jb     969 <free+0x4f>
+ 945:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 948:	8b 00                	mov    (%eax),%eax
+ 94a:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 94d:	72 1a                	jb     969 <free+0x4f>
+    for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 94f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 952:	8b 00                	mov    (%eax),%eax
+ 954:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 957:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 95a:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 95d:	73 d4                	jae    933 <free+0x19>
+ 95f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 962:	8b 00                	mov    (%eax),%eax
+ 964:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 967:	73 ca                	jae    933 <free+0x19>
+            break;
+    if(bp + bp->s.size == p->s.ptr){
+ 969:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 96c:	8b 40 04             	mov    0x4(%eax),%eax
+ 96f:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 976:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 979:	01 c2                	add    %eax,%edx
+ 97b:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 97e:	8b 00                	mov    (%eax),%eax
+ 980:	39 c2                	cmp    %eax,%edx
+ 982:	75 24                	jne    9a8 <free+0x8e>
+        bp->s.size += p->s.ptr->s.size;
+ 984:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 987:	8b 50 04             	mov    0x4(%eax),%edx
+ 98a:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 98d:	8b 00                	mov    (%eax),%eax
+ 98f:	8b 40 04             	mov    0x4(%eax),%eax
+ 992:	01 c2                	add    %eax,%edx
+ 994:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 997:	89 50 04             	mov    %edx,0x4(%eax)
+        bp->s.ptr = p->s.ptr->s.ptr;
+ 99a:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 99d:	8b 00                	mov    (%eax),%eax
+ 99f:	8b 10                	mov    (%eax),%edx
+ 9a1:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 9a4:	89 10                	mov    %edx,(%eax)
+ 9a6:	eb 0a                	jmp    9b2 <free+0x98>
+    } else
+        bp->s.ptr = p->s.ptr;
+ 9a8:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 9ab:	8b 10                	mov    (%eax),%edx
+ 9ad:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 9b0:	89 10                	mov    %edx,(%eax)
+    if(p + p->s.size == bp){
+ 9b2:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 9b5:	8b 40 04             	mov    0x4(%eax),%eax
+ 9b8:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 9bf:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 9c2:	01 d0                	add    %edx,%eax
+ 9c4:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 9c7:	75 20                	jne    9e9 <free+0xcf>
+        p->s.size += bp->s.size;
+ 9c9:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 9cc:	8b 50 04             	mov    0x4(%eax),%edx
+ 9cf:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 9d2:	8b 40 04             	mov    0x4(%eax),%eax
+ 9d5:	01 c2                	add    %eax,%edx
+ 9d7:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 9da:	89 50 04             	mov    %edx,0x4(%eax)
+        p->s.ptr = bp->s.ptr;
+ 9dd:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 9e0:	8b 10                	mov    (%eax),%edx
+ 9e2:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 9e5:	89 10                	mov    %edx,(%eax)
+ 9e7:	eb 08                	jmp    9f1 <free+0xd7>
+    } else
+        p->s.ptr = bp;
+ 9e9:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 9ec:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 9ef:	89 10                	mov    %edx,(%eax)
+    freep = p;
+ 9f1:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 9f4:	a3 e8 0e 00 00       	mov    %eax,0xee8
+}
+ 9f9:	90                   	nop
+ 9fa:	c9                   	leave
+ 9fb:	c3                   	ret
+
+000009fc <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+ 9fc:	55                   	push   %ebp
+ 9fd:	89 e5                	mov    %esp,%ebp
+ 9ff:	83 ec 18             	sub    $0x18,%esp
+    char *p;
+    Header *hp;
+
+    if(nu < 4096)
+ a02:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+ a09:	77 07                	ja     a12 <morecore+0x16>
+        nu = 4096;
+ a0b:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+    p = sbrk(nu * sizeof(Header));
+ a12:	8b 45 08             	mov    0x8(%ebp),%eax
+ a15:	c1 e0 03             	shl    $0x3,%eax
+ a18:	83 ec 0c             	sub    $0xc,%esp
+ a1b:	50                   	push   %eax
+ a1c:	e8 0a fb ff ff       	call   52b <sbrk>
+ a21:	83 c4 10             	add    $0x10,%esp
+ a24:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p == (char*)-1)
+ a27:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+ a2b:	75 07                	jne    a34 <morecore+0x38>
+        return 0;
+ a2d:	b8 00 00 00 00       	mov    $0x0,%eax
+ a32:	eb 26                	jmp    a5a <morecore+0x5e>
+    hp = (Header*)p;
+ a34:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a37:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    hp->s.size = nu;
+ a3a:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ a3d:	8b 55 08             	mov    0x8(%ebp),%edx
+ a40:	89 50 04             	mov    %edx,0x4(%eax)
+    free((void*)(hp + 1));
+ a43:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ a46:	83 c0 08             	add    $0x8,%eax
+ a49:	83 ec 0c             	sub    $0xc,%esp
+ a4c:	50                   	push   %eax
+ a4d:	e8 c8 fe ff ff       	call   91a <free>
+ a52:	83 c4 10             	add    $0x10,%esp
+    return freep;
+ a55:	a1 e8 0e 00 00       	mov    0xee8,%eax
+}
+ a5a:	c9                   	leave
+ a5b:	c3                   	ret
+
+00000a5c <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ a5c:	55                   	push   %ebp
+ a5d:	89 e5                	mov    %esp,%ebp
+ a5f:	83 ec 18             	sub    $0x18,%esp
+    Header *p, *prevp;
+    uint nunits;
+
+    nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ a62:	8b 45 08             	mov    0x8(%ebp),%eax
+ a65:	83 c0 07             	add    $0x7,%eax
+ a68:	c1 e8 03             	shr    $0x3,%eax
+ a6b:	83 c0 01             	add    $0x1,%eax
+ a6e:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    if((prevp = freep) == 0){
+ a71:	a1 e8 0e 00 00       	mov    0xee8,%eax
+ a76:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ a79:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ a7d:	75 23                	jne    aa2 <malloc+0x46>
+        base.s.ptr = freep = prevp = &base;
+ a7f:	c7 45 f0 e0 0e 00 00 	movl   $0xee0,-0x10(%ebp)
+ a86:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ a89:	a3 e8 0e 00 00       	mov    %eax,0xee8
+ a8e:	a1 e8 0e 00 00       	mov    0xee8,%eax
+ a93:	a3 e0 0e 00 00       	mov    %eax,0xee0
+        base.s.size = 0;
+ a98:	c7 05 e4 0e 00 00 00 	movl   $0x0,0xee4
+ a9f:	00 00 00 
+    }
+    for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ aa2:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ aa5:	8b 00                	mov    (%eax),%eax
+ aa7:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        if(p->s.size >= nunits){
+ aaa:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ aad:	8b 40 04             	mov    0x4(%eax),%eax
+ ab0:	3b 45 ec             	cmp    -0x14(%ebp),%eax
+ ab3:	72 4d                	jb     b02 <malloc+0xa6>
+            if(p->s.size == nunits)
+ ab5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ ab8:	8b 40 04             	mov    0x4(%eax),%eax
+ abb:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+ abe:	75 0c                	jne    acc <malloc+0x70>
+                prevp->s.ptr = p->s.ptr;
+ ac0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ ac3:	8b 10                	mov    (%eax),%edx
+ ac5:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ ac8:	89 10                	mov    %edx,(%eax)
+ aca:	eb 26                	jmp    af2 <malloc+0x96>
+            else {
+                p->s.size -= nunits;
+ acc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ acf:	8b 40 04             	mov    0x4(%eax),%eax
+ ad2:	2b 45 ec             	sub    -0x14(%ebp),%eax
+ ad5:	89 c2                	mov    %eax,%edx
+ ad7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ ada:	89 50 04             	mov    %edx,0x4(%eax)
+                p += p->s.size;
+ add:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ ae0:	8b 40 04             	mov    0x4(%eax),%eax
+ ae3:	c1 e0 03             	shl    $0x3,%eax
+ ae6:	01 45 f4             	add    %eax,-0xc(%ebp)
+                p->s.size = nunits;
+ ae9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ aec:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ aef:	89 50 04             	mov    %edx,0x4(%eax)
+            }
+            freep = prevp;
+ af2:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ af5:	a3 e8 0e 00 00       	mov    %eax,0xee8
+            return (void*)(p + 1);
+ afa:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ afd:	83 c0 08             	add    $0x8,%eax
+ b00:	eb 3b                	jmp    b3d <malloc+0xe1>
+        }
+        if(p == freep)
+ b02:	a1 e8 0e 00 00       	mov    0xee8,%eax
+ b07:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ b0a:	75 1e                	jne    b2a <malloc+0xce>
+            if((p = morecore(nunits)) == 0)
+ b0c:	83 ec 0c             	sub    $0xc,%esp
+ b0f:	ff 75 ec             	push   -0x14(%ebp)
+ b12:	e8 e5 fe ff ff       	call   9fc <morecore>
+ b17:	83 c4 10             	add    $0x10,%esp
+ b1a:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ b1d:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ b21:	75 07                	jne    b2a <malloc+0xce>
+                return 0;
+ b23:	b8 00 00 00 00       	mov    $0x0,%eax
+ b28:	eb 13                	jmp    b3d <malloc+0xe1>
+    for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ b2a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b2d:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ b30:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b33:	8b 00                	mov    (%eax),%eax
+ b35:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        if(p->s.size >= nunits){
+ b38:	e9 6d ff ff ff       	jmp    aaa <malloc+0x4e>
+    }
+}
+ b3d:	c9                   	leave
+ b3e:	c3                   	ret
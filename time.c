@@ -0,0 +1,49 @@
+// Run a command and report the resources it used.
+//
+//    time cmd [arg...]
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "resource.h"
+
+int
+ms(struct timeval *tv)
+{
+    return tv->tv_sec * 1000 + tv->tv_usec / 1000;
+}
+
+int
+main(int argc, char *argv[])
+{
+    struct rusage ru;
+    int pid, t0;
+
+    if(argc < 2){
+        printf(2, "usage: time cmd [arg...]\n");
+        exit();
+    }
+    t0 = uptime();
+    pid = fork();
+    if(pid < 0){
+        printf(2, "time: fork failed\n");
+        exit();
+    }
+    if(pid == 0){
+        exec(argv[1], argv+1);
+        printf(2, "time: exec %s failed\n", argv[1]);
+        exit();
+    }
+    wait();
+    if(getrusage(RUSAGE_CHILDREN, &ru) < 0){
+        printf(2, "time: getrusage failed\n");
+        exit();
+    }
+    printf(2, "real %d ticks, user %d ms, sys %d ms\n",
+        uptime() - t0, ms(&ru.ru_utime), ms(&ru.ru_stime));
+    printf(2, "%d minor + %d major faults, %d blocks in, %d blocks out\n",
+        ru.ru_minflt, ru.ru_majflt, ru.ru_inblock, ru.ru_oublock);
+    printf(2, "%d voluntary + %d involuntary context switches\n",
+        ru.ru_nvcsw, ru.ru_nivcsw);
+    exit();
+}
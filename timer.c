@@ -0,0 +1,83 @@
+// Timer queue: deadlines in ticks, kept on a hashed timing wheel.
+//
+// A timer waits in slot expires % NTSLOT.    On each tick CPU 0
+// looks only at the slot for that tick and runs the timers there
+// whose deadline has come, so the cost of a tick follows the number
+// of timers due around now, not the number of sleeping processes.
+// Timers more than NTSLOT ticks away stay in their slot until a
+// later lap.
+//
+// tickslock protects the wheel and every queued timer, and is held
+// while the timer functions run.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "mmu.h"
+#include "spinlock.h"
+#include "proc.h"
+
+#define NTSLOT    64
+
+static struct timer *wheel[NTSLOT];
+
+// Unlink t if it is queued.    Caller must hold tickslock.
+void
+timerdel(struct timer *t)
+{
+    if(!holding(&tickslock))
+        panic("timerdel");
+    if(t->pprev == 0)
+        return;
+    *t->pprev = t->next;
+    if(t->next)
+        t->next->pprev = t->pprev;
+    t->next = 0;
+    t->pprev = 0;
+}
+
+// Arrange for fn(arg) to be called at tick expires, replacing any
+// deadline t already had.    A deadline that has already passed
+// fires on the next tick.    Caller must hold tickslock.
+void
+timerset(struct timer *t, uint expires, void (*fn)(void*), void *arg)
+{
+    struct timer **slot;
+
+    timerdel(t);
+    if((int)(expires - ticks) <= 0)
+        expires = ticks + 1;
+    t->expires = expires;
+    t->fn = fn;
+    t->arg = arg;
+    slot = &wheel[expires % NTSLOT];
+    t->next = *slot;
+    if(t->next)
+        t->next->pprev = &t->next;
+    t->pprev = slot;
+    *slot = t;
+}
+
+// Run the timers due at tick now.    Called by CPU 0 on every tick,
+// with tickslock held.    A timer function may re-arm its own timer
+// but must not touch other timers that fire on the same tick.
+void
+timerexpire(uint now)
+{
+    struct timer *t, *next, *due;
+
+    due = 0;
+    for(t = wheel[now % NTSLOT]; t; t = next){
+        next = t->next;
+        if((int)(t->expires - now) <= 0){
+            timerdel(t);
+            t->next = due;
+            due = t;
+        }
+    }
+    while((t = due) != 0){
+        due = t->next;
+        t->next = 0;
+        t->fn(t->arg);
+    }
+}
@@ -3,15 +3,17 @@
 #include "param.h"
 #include "memlayout.h"
 #include "mmu.h"
+#include "spinlock.h"
 #include "proc.h"
+#include "rwlock.h"
 #include "x86.h"
 #include "traps.h"
-#include "spinlock.h"
 
 // Interrupt descriptor table (shared by all CPUs).
 struct gatedesc idt[256];
 extern uint vectors[];    // in vectors.S: array of 256 entry pointers
-struct spinlock tickslock;
+struct spinlock tickslock;    // Protects the timer queue
+struct seqlock tickseq;         // Lets ticks be read without tickslock
 uint ticks;
 
 #define FEC_US 0x004
@@ -40,6 +42,20 @@ tvinit(void)
     SETGATE(idt[T_SYSCALL], 1, SEG_KCODE<<3, vectors[T_SYSCALL], DPL_USER);
 
     initlock(&tickslock, "time", 1);
+    initseqlock(&tickseq, "ticks");
+}
+
+// Return ticks without contending for tickslock.
+uint
+readticks(void)
+{
+    uint s, t;
+
+    do {
+        s = readseqbegin(&tickseq);
+        t = ticks;
+    } while(readseqretry(&tickseq, s));
+    return t;
 }
 
 void
@@ -48,74 +64,145 @@ idtinit(void)
     lidt(idt, sizeof(idt));
 }
 
+extern char sysentry[];
+
+// Send this cpu's sysenters to sysentry in trapasm.S, if it has
+// the instruction.    The MSRs are set once: sysentry starts on the
+// cpu's task state and takes the kernel stack from the ts.esp0
+// that switchuvm() keeps up to date.    sysenter leaves EFLAGS.TF
+// alone, so a process that sets it takes a debug trap at sysentry
+// in the kernel, on whatever %esp points at; cpu->sysstack, just
+// below ts, is there to take it, and trap() clears TF.
+void
+sysenterinit(void)
+{
+    uint a, b, c, d;
+
+    cpuinfo(1, &a, &b, &c, &d);
+    if((d & CPUID_SEP) == 0)
+        return;
+    wrmsr(MSR_SYSENTER_CS, SEG_KCODE<<3);
+    wrmsr(MSR_SYSENTER_ESP, (uint)&mycpu()->ts);
+    wrmsr(MSR_SYSENTER_EIP, (uint)sysentry);
+}
+
+// Enter curproc's alarm handler on the way back to user space.
+// The alarm timer set alarmpending; an alarm that fires while the
+// handler is still running is dropped.
+static void
+alarmdeliver(struct proc *curproc, struct trapframe *tf)
+{
+    curproc->alarmpending = 0;
+    if(curproc->inalarmhandler || curproc->alarmhandler == 0)
+        return;
+    if((tf->esp-24) < curproc->stack.start){
+        char *mem = 0;
+        if(curproc->stack.sz >= MAXSTACK)
+            goto bad;
+        if((mem = kalloc()) == 0)
+            goto bad;
+        memset(mem, 0, PGSIZE);    
+        if(mappage(curproc->pgdir, (void*)PGROUNDDOWN(tf->esp-24), V2P(mem), PTE_W|PTE_U) < 0){
+            kfree(mem);
+            goto bad;
+        }
+        curproc->stack.start -= PGSIZE;
+        curproc->stack.sz += PGSIZE;
+        tlb_invalidate(curproc->pgdir, (void *)(tf->esp-24));
+    }
+    curproc->inalarmhandler = 1;
+    /*  ----------------------
+        |eip edx ecx eax      |
+        ----------------------
+        |保存的寄存器的值的地址|
+        ----------------------
+        |rstoregs 地址       |
+        --------------------  <--esp
+    */
+    *(uint*)(tf->esp - 4) = tf->eip;
+    *(uint*)(tf->esp - 8) = tf->edx;
+    *(uint*)(tf->esp - 12) = tf->ecx;
+    *(uint*)(tf->esp - 16) = tf->eax;
+    *(uint*)(tf->esp - 20) = tf->esp - 16; // 保存的寄存器的值的地址
+    *(uint*)(tf->esp - 24) = curproc->alarmhandlerret ;   // rstoregs的地址
+    tf->esp -= 24;
+    tf->eip = (uint)curproc->alarmhandler;
+    return;
+
+bad:
+    curproc->killed = 1;
+    curproc->alarmhandler = 0;
+    curproc->alarmhandlerret = 0;
+    curproc->alarmticks = 0;
+    acquire(&tickslock);
+    timerdel(&curproc->alarmtimer);
+    release(&tickslock);
+}
+
+// Make the system call in tf for the current process, and do
+// what must be done before it returns to user space.
+static void
+dosyscall(struct trapframe *tf)
+{
+    struct proc *curproc = myproc();
+
+    if(curproc->killed)
+        exit();
+    curproc->tf = tf;
+    syscall();
+    if(needresched())
+        yield();
+    if(curproc->alarmpending)
+        alarmdeliver(curproc, tf);
+    if(curproc->killed)
+        exit();
+    acct(0);
+}
+
+// sysentry's way in: a system call made with sysenter, which
+// needs none of trap()'s interrupt and fault handling.
+void
+fastsyscall(struct trapframe *tf)
+{
+    acct(1);
+    dosyscall(tf);
+}
+
 //PAGEBREAK: 41
 void
 trap(struct trapframe *tf)
 {
+    // Single-stepped into sysentry: on cpu->sysstack with
+    // interrupts off.    Drop TF and let sysentry go on.
+    if(tf->trapno == T_DEBUG && tf->eip == (uint)sysentry){
+        tf->eflags &= ~FL_TF;
+        return;
+    }
+    acct((tf->cs&3) == DPL_USER);
     if(tf->trapno == T_SYSCALL){
-        if(myproc()->killed)
-            exit();
-        myproc()->tf = tf;
-        syscall();
-        if(myproc()->killed)
-            exit();
+        dosyscall(tf);
         return;
     }
     struct proc *curproc = myproc();
+    int tick = 0;
     switch(tf->trapno){
     case T_IRQ0 + IRQ_TIMER:
-        if(cpuid() == 0){
+        tick = hrtimerintr();
+        if(tick && cpuid() == 0){
             acquire(&tickslock);
-            ticks++;    
-            wakeup(&ticks);
+            writeseqlock(&tickseq);
+            ticks++;
+            writesequnlock(&tickseq);
+            vdsotick(ticks);
+            timerexpire(ticks);
             release(&tickslock);
         }
-        if(curproc != 0 && (tf->cs & 3) == 3 
-            && curproc->alarmhandler && --curproc->alarmticksleft == 0){
-            curproc->alarmticksleft = curproc->alarmticks;
-            if(!curproc->inalarmhandler){
-                if((tf->esp-24) < curproc->stack.start){
-                    char *mem = 0;
-                    if(curproc->stack.sz >= MAXSTACK)
-                        goto bad;
-                    if((mem = kalloc()) == 0)
-                        goto bad;
-                    memset(mem, 0, PGSIZE);    
-                    if(mappage(curproc->pgdir, (void*)PGROUNDDOWN(tf->esp-24), V2P(mem), PTE_W|PTE_U) < 0){
-                        kfree(mem);
-                        goto bad;
-                    }
-                    curproc->stack.start -= PGSIZE;
-                    curproc->stack.sz += PGSIZE;
-                    tlb_invalidate(curproc->pgdir, (void *)(tf->esp-24));
-                }
-                curproc->inalarmhandler = 1;
-                /*  ----------------------
-                    |eip edx ecx eax      |
-                    ----------------------
-                    |保存的寄存器的值的地址|
-                    ----------------------
-                    |rstoregs 地址       |
-                    --------------------  <--esp
-                */
-                *(uint*)(tf->esp - 4) = tf->eip;
-                *(uint*)(tf->esp - 8) = tf->edx;
-                *(uint*)(tf->esp - 12) = tf->ecx;
-                *(uint*)(tf->esp - 16) = tf->eax;
-                *(uint*)(tf->esp - 20) = tf->esp - 16; // 保存的寄存器的值的地址
-                *(uint*)(tf->esp - 24) = curproc->alarmhandlerret ;   // rstoregs的地址
-                tf->esp -= 24;
-                tf->eip = (uint)curproc->alarmhandler;
-                goto timerack;
-            }
-            bad:
-                curproc->killed = 1;
-                curproc->alarmhandler = 0;
-                curproc->alarmhandlerret = 0;
-                curproc->alarmticks = 0;
-                curproc->alarmticksleft = 0;
-        }
-    timerack:
+        lapiceoi();
+        break;
+    case T_IRQ0 + IRQ_RESCHED:
+        // Woken from idle(), and the scheduler loop does the rest;
+        // or asked to preempt, and needresched() below says so.
+        mycpu()->nwake++;
         lapiceoi();
         break;
     case T_IRQ0 + IRQ_IDE:
@@ -166,6 +253,14 @@ trap(struct trapframe *tf)
                 goto buildmap;
             }
             if(curproc->heap.start <= faddr && faddr < curproc->heap.start + curproc->heap.sz){
+                // Registered with a uffd: let the handler process supply
+                // the page.    Not for kernel-mode faults, which may hold
+                // fs locks the handler needs; system calls fault their
+                // buffers in beforehand with uffdfaultin().
+                if(curproc->uffd && (tf->cs&3) == DPL_USER && uffdfault(curproc, faddr)){
+                    curproc->ru.majflt++;
+                    break;
+                }
                 // lazy allocation
                 if((mem = kalloc()) == 0){
                     cprintf("trap out of memory(2)\n");
@@ -195,6 +290,7 @@ trap(struct trapframe *tf)
                 goto truepgfault;
             }
             tlb_invalidate(curproc->pgdir, (void *)faddr);
+            curproc->ru.minflt++;
             break;   
         }    
 
@@ -232,13 +328,20 @@ trapend:
     if(curproc && curproc->killed && (tf->cs&3) == DPL_USER)
         exit();
 
-    // Force process to give up CPU on clock tick.
+    if(curproc && curproc->alarmpending && (tf->cs&3) == DPL_USER)
+        alarmdeliver(curproc, tf);
+
+    // Force process to give up CPU when its time slice is used up
+    // or a better-priority process is waiting.
     // If interrupts were on while locks held, would need to check nlock.
     if(curproc && curproc->state == RUNNING &&
-        tf->trapno == T_IRQ0+IRQ_TIMER)
+        ((tf->trapno == T_IRQ0+IRQ_TIMER && schedtick(tick)) || needresched()))
         yield();
 
     // Check if the process has been killed since we yielded
     if(curproc && curproc->killed && (tf->cs&3) == DPL_USER)
         exit();
+
+    if((tf->cs&3) == DPL_USER)
+        acct(0);
 }
@@ -26,6 +26,7 @@
 // processor defined exceptions or interrupt vectors.
 #define T_SYSCALL             64            // system call
 #define T_DEFAULT            500            // catchall
+#define T_SYSENTER           501            // not a vector: system call by sysenter
 
 #define T_IRQ0                    32            // IRQ 0 corresponds to int T_IRQ
 
@@ -34,5 +35,6 @@
 #define IRQ_COM1                 4
 #define IRQ_IDE                 14
 #define IRQ_ERROR             19
+#define IRQ_RESCHED           20    // reschedule IPI between cpus
 #define IRQ_SPURIOUS        31
 
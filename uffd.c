@@ -0,0 +1,253 @@
+// Userspace page-fault delegation.
+//
+// A process creates a uffd, registers a range of its heap with it,
+// and passes the descriptor to a handler process (usually by fork).
+// Faults in the registered range are not zero-filled by trap();
+// instead the faulting process sleeps while the handler read()s a
+// struct uffdmsg describing the fault and resolves it with
+// uffdcopy(), which installs a page of the handler's choosing in
+// the faulting process's address space.    Faults the kernel takes
+// on a process's behalf are zero-filled instead; system calls get
+// their user buffers supplied up front with uffdfaultin().
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "memlayout.h"
+#include "mmu.h"
+#include "spinlock.h"
+#include "proc.h"
+#include "fs.h"
+#include "sleeplock.h"
+#include "file.h"
+#include "uffd.h"
+
+struct uffd {
+    struct spinlock lock;
+    struct proc *owner;     // registered process, 0 after exit or exec
+    uint start;             // registered range, page aligned
+    uint end;
+    int pending;            // owner is blocked on faultaddr
+    int delivered;          // pending fault has been read by the handler
+    uint faultaddr;
+    int fileopen;           // some struct file still refers to this uffd
+};
+
+int
+uffdalloc(struct file **f)
+{
+    struct uffd *u;
+
+    u = 0;
+    if((*f = filealloc()) == 0)
+        goto bad;
+    if((u = (struct uffd*)kalloc()) == 0)
+        goto bad;
+    initlock(&u->lock, "uffd", 1);
+    u->owner = 0;
+    u->start = u->end = 0;
+    u->pending = 0;
+    u->delivered = 0;
+    u->faultaddr = 0;
+    u->fileopen = 1;
+    (*f)->type = FD_UFFD;
+    (*f)->readable = 1;
+    (*f)->writable = 0;
+    (*f)->uffd = u;
+    return 0;
+
+ bad:
+    if(*f)
+        fileclose(*f);
+    return -1;
+}
+
+// Register [start, start+len) of the current process with u.
+// A process can be registered with at most one uffd.
+int
+uffdregister(struct uffd *u, uint start, uint len)
+{
+    struct proc *curproc = myproc();
+
+    if(start % PGSIZE || len % PGSIZE || len == 0)
+        return -1;
+    if(start < curproc->heap.start || start + len < start || start + len > KERNBASE)
+        return -1;
+    if(curproc->uffd && curproc->uffd != u)
+        return -1;
+
+    acquire(&u->lock);
+    if(u->owner && u->owner != curproc){
+        release(&u->lock);
+        return -1;
+    }
+    u->owner = curproc;
+    u->start = start;
+    u->end = start + len;
+    curproc->uffd = u;
+    release(&u->lock);
+    return 0;
+}
+
+// Free u if nothing refers to it any more.
+// Called with u->lock held; releases it.
+static void
+uffdfree(struct uffd *u)
+{
+    if(u->owner == 0 && u->fileopen == 0){
+        release(&u->lock);
+        kfree((char*)u);
+    } else
+        release(&u->lock);
+}
+
+// The last file referring to u has been closed.
+// Faults in the range fall back to zero-fill from now on.
+void
+uffdclose(struct uffd *u)
+{
+    acquire(&u->lock);
+    u->fileopen = 0;
+    wakeup(&u->pending);
+    uffdfree(u);
+}
+
+// p is exiting or replacing its address space;
+// the handler must not touch p->pgdir any more.
+void
+uffddetach(struct proc *p)
+{
+    struct uffd *u = p->uffd;
+
+    acquire(&u->lock);
+    p->uffd = 0;
+    u->owner = 0;
+    u->pending = 0;
+    wakeup(&u->faultaddr);
+    uffdfree(u);
+}
+
+// Called by trap() for a not-present fault at va in p's heap.
+// Returns 1 if the handler installed the page, 0 if the caller
+// should fall back to zero-fill (not registered, no handler left,
+// or p was killed while waiting).
+// Sleeps, so the caller must not hold any spinlock.
+int
+uffdfault(struct proc *p, uint va)
+{
+    struct uffd *u = p->uffd;
+
+    va = PGROUNDDOWN(va);
+    acquire(&u->lock);
+    if(!u->fileopen || va < u->start || va >= u->end){
+        release(&u->lock);
+        return 0;
+    }
+    u->faultaddr = va;
+    u->pending = 1;
+    u->delivered = 0;
+    wakeup(&u->faultaddr);
+    while(u->pending){
+        if(p->killed || !u->fileopen){
+            u->pending = 0;
+            release(&u->lock);
+            return 0;
+        }
+        sleep(&u->pending, &u->lock);
+    }
+    release(&u->lock);
+    return 1;
+}
+
+// Have the handler supply any not-present pages of [va, va+len)
+// in p's heap.    System calls call this for their user buffers
+// before taking any fs lock: trap() zero-fills kernel-mode faults
+// rather than sleep for a handler that may need those locks.
+void
+uffdfaultin(struct proc *p, uint va, uint len)
+{
+    pte_t *pte;
+    uint a, last;
+
+    if(p->uffd == 0 || len == 0)
+        return;
+    last = PGROUNDDOWN(va + len - 1);
+    for(a = PGROUNDDOWN(va); !p->killed; a += PGSIZE){
+        if(p->heap.start <= a && a < p->heap.start + p->heap.sz){
+            pte = walkpgdir(p->pgdir, (void*)a, 0);
+            if((pte == 0 || !(*pte & PTE_P)) && uffdfault(p, a))
+                p->ru.majflt++;
+        }
+        if(a == last)
+            break;
+    }
+}
+
+// Wait for a fault and describe it to the handler.
+// Returns 0 once the owner has gone away.
+int
+uffdread(struct uffd *u, char *addr, int n)
+{
+    struct uffdmsg m;
+
+    if(n < sizeof(m))
+        return -1;
+    acquire(&u->lock);
+    while(!u->pending || u->delivered){
+        if(u->owner == 0){
+            release(&u->lock);
+            return 0;
+        }
+        if(myproc()->killed){
+            release(&u->lock);
+            return -1;
+        }
+        sleep(&u->faultaddr, &u->lock);
+    }
+    m.addr = u->faultaddr;
+    m.pid = u->owner->pid;
+    u->delivered = 1;
+    release(&u->lock);
+
+    memmove(addr, (char*)&m, sizeof(m));
+    return sizeof(m);
+}
+
+// Install a copy of the page at src (in the caller's address space)
+// at dst in the owner's address space, and wake the owner if it was
+// waiting for dst.  The owner must be blocked on a fault, so that
+// nothing else is changing its page table; neighbouring pages of the
+// range may be filled ahead of time while it waits.
+int
+uffdcopy(struct uffd *u, uint dst, char *src)
+{
+    char *mem;
+    pte_t *pte;
+
+    if(dst % PGSIZE)
+        return -1;
+    // Copy before taking u->lock: reading src may itself fault.
+    if((mem = kalloc()) == 0)
+        return -1;
+    memmove(mem, src, PGSIZE);
+
+    acquire(&u->lock);
+    if(u->owner == 0 || !u->pending || dst < u->start || dst >= u->end)
+        goto bad;
+    pte = walkpgdir(u->owner->pgdir, (void*)dst, 0);
+    if(pte && (*pte & PTE_P))
+        goto bad;
+    if(mappage(u->owner->pgdir, (void*)dst, V2P(mem), PTE_W|PTE_U) < 0)
+        goto bad;
+    if(dst == u->faultaddr){
+        u->pending = 0;
+        wakeup(&u->pending);
+    }
+    release(&u->lock);
+    return 0;
+
+ bad:
+    release(&u->lock);
+    kfree(mem);
+    return -1;
+}
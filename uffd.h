@@ -0,0 +1,5 @@
+// Message read() from a uffd descriptor by the handler process.
+struct uffdmsg {
+    uint addr;    // page-aligned faulting address
+    int pid;      // process blocked on the fault
+};
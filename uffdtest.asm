@@ -0,0 +1,1603 @@
+
+_uffdtest:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <handler>:
+#define PGSIZE 4096
+#define NPAGES 8
+
+void
+handler(int fd)
+{
+   0:	55                   	push   %ebp
+   1:	89 e5                	mov    %esp,%ebp
+   3:	53                   	push   %ebx
+   4:	83 ec 14             	sub    $0x14,%esp
+    struct uffdmsg m;
+    uint *page;
+    int i;
+
+    page = (uint*)malloc(PGSIZE);
+   7:	83 ec 0c             	sub    $0xc,%esp
+   a:	68 00 10 00 00       	push   $0x1000
+   f:	e8 16 0b 00 00       	call   b2a <malloc>
+  14:	83 c4 10             	add    $0x10,%esp
+  17:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    while(read(fd, &m, sizeof(m)) == sizeof(m)){
+  1a:	eb 63                	jmp    7f <handler+0x7f>
+        for(i = 0; i < PGSIZE/4; i++)
+  1c:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  23:	eb 1d                	jmp    42 <handler+0x42>
+            page[i] = m.addr + i;
+  25:	8b 4d e8             	mov    -0x18(%ebp),%ecx
+  28:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  2b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  2e:	8d 1c 85 00 00 00 00 	lea    0x0(,%eax,4),%ebx
+  35:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  38:	01 d8                	add    %ebx,%eax
+  3a:	01 ca                	add    %ecx,%edx
+  3c:	89 10                	mov    %edx,(%eax)
+        for(i = 0; i < PGSIZE/4; i++)
+  3e:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+  42:	81 7d f4 ff 03 00 00 	cmpl   $0x3ff,-0xc(%ebp)
+  49:	7e da                	jle    25 <handler+0x25>
+        if(uffdcopy(fd, (void*)m.addr, page) < 0){
+  4b:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  4e:	83 ec 04             	sub    $0x4,%esp
+  51:	ff 75 f0             	push   -0x10(%ebp)
+  54:	50                   	push   %eax
+  55:	ff 75 08             	push   0x8(%ebp)
+  58:	e8 e2 05 00 00       	call   63f <uffdcopy>
+  5d:	83 c4 10             	add    $0x10,%esp
+  60:	85 c0                	test   %eax,%eax
+  62:	79 1b                	jns    7f <handler+0x7f>
+            printf(1, "uffdcopy %x failed\n", m.addr);
+  64:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  67:	83 ec 04             	sub    $0x4,%esp
+  6a:	50                   	push   %eax
+  6b:	68 0d 0c 00 00       	push   $0xc0d
+  70:	6a 01                	push   $0x1
+  72:	e8 df 07 00 00       	call   856 <printf>
+  77:	83 c4 10             	add    $0x10,%esp
+            exit();
+  7a:	e8 d9 04 00 00       	call   558 <exit>
+    while(read(fd, &m, sizeof(m)) == sizeof(m)){
+  7f:	83 ec 04             	sub    $0x4,%esp
+  82:	6a 08                	push   $0x8
+  84:	8d 45 e8             	lea    -0x18(%ebp),%eax
+  87:	50                   	push   %eax
+  88:	ff 75 08             	push   0x8(%ebp)
+  8b:	e8 dd 04 00 00       	call   56d <read>
+  90:	83 c4 10             	add    $0x10,%esp
+  93:	83 f8 08             	cmp    $0x8,%eax
+  96:	74 84                	je     1c <handler+0x1c>
+        }
+    }
+    exit();
+  98:	e8 bb 04 00 00       	call   558 <exit>
+
+0000009d <main>:
+}
+
+int
+main(int argc, char *argv[])
+{
+  9d:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+  a1:	83 e4 f0             	and    $0xfffffff0,%esp
+  a4:	ff 71 fc             	push   -0x4(%ecx)
+  a7:	55                   	push   %ebp
+  a8:	89 e5                	mov    %esp,%ebp
+  aa:	51                   	push   %ecx
+  ab:	83 ec 24             	sub    $0x24,%esp
+    char *base;
+    uint *p;
+    int fd, pid, i;
+
+    printf(1, "uffdtest starting\n");
+  ae:	83 ec 08             	sub    $0x8,%esp
+  b1:	68 21 0c 00 00       	push   $0xc21
+  b6:	6a 01                	push   $0x1
+  b8:	e8 99 07 00 00       	call   856 <printf>
+  bd:	83 c4 10             	add    $0x10,%esp
+    base = sbrk(NPAGES*PGSIZE + PGSIZE);
+  c0:	83 ec 0c             	sub    $0xc,%esp
+  c3:	68 00 90 00 00       	push   $0x9000
+  c8:	e8 2c 05 00 00       	call   5f9 <sbrk>
+  cd:	83 c4 10             	add    $0x10,%esp
+  d0:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    base = (char*)(((uint)base + PGSIZE - 1) & ~(PGSIZE - 1));
+  d3:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  d6:	05 ff 0f 00 00       	add    $0xfff,%eax
+  db:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  e0:	89 45 f0             	mov    %eax,-0x10(%ebp)
+
+    if((fd = uffd()) < 0){
+  e3:	e8 43 05 00 00       	call   62b <uffd>
+  e8:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  eb:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+  ef:	79 17                	jns    108 <main+0x6b>
+        printf(1, "uffd failed\n");
+  f1:	83 ec 08             	sub    $0x8,%esp
+  f4:	68 34 0c 00 00       	push   $0xc34
+  f9:	6a 01                	push   $0x1
+  fb:	e8 56 07 00 00       	call   856 <printf>
+ 100:	83 c4 10             	add    $0x10,%esp
+        exit();
+ 103:	e8 50 04 00 00       	call   558 <exit>
+    }
+    if(uffdregister(fd, base, NPAGES*PGSIZE) < 0){
+ 108:	83 ec 04             	sub    $0x4,%esp
+ 10b:	68 00 80 00 00       	push   $0x8000
+ 110:	ff 75 f0             	push   -0x10(%ebp)
+ 113:	ff 75 ec             	push   -0x14(%ebp)
+ 116:	e8 1a 05 00 00       	call   635 <uffdregister>
+ 11b:	83 c4 10             	add    $0x10,%esp
+ 11e:	85 c0                	test   %eax,%eax
+ 120:	79 17                	jns    139 <main+0x9c>
+        printf(1, "uffdregister failed\n");
+ 122:	83 ec 08             	sub    $0x8,%esp
+ 125:	68 41 0c 00 00       	push   $0xc41
+ 12a:	6a 01                	push   $0x1
+ 12c:	e8 25 07 00 00       	call   856 <printf>
+ 131:	83 c4 10             	add    $0x10,%esp
+        exit();
+ 134:	e8 1f 04 00 00       	call   558 <exit>
+    }
+    pid = fork();
+ 139:	e8 13 04 00 00       	call   551 <fork>
+ 13e:	89 45 e8             	mov    %eax,-0x18(%ebp)
+    if(pid < 0){
+ 141:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+ 145:	79 17                	jns    15e <main+0xc1>
+        printf(1, "fork failed\n");
+ 147:	83 ec 08             	sub    $0x8,%esp
+ 14a:	68 56 0c 00 00       	push   $0xc56
+ 14f:	6a 01                	push   $0x1
+ 151:	e8 00 07 00 00       	call   856 <printf>
+ 156:	83 c4 10             	add    $0x10,%esp
+        exit();
+ 159:	e8 fa 03 00 00       	call   558 <exit>
+    }
+    if(pid == 0)
+ 15e:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+ 162:	75 0e                	jne    172 <main+0xd5>
+        handler(fd);
+ 164:	83 ec 0c             	sub    $0xc,%esp
+ 167:	ff 75 ec             	push   -0x14(%ebp)
+ 16a:	e8 91 fe ff ff       	call   0 <handler>
+ 16f:	83 c4 10             	add    $0x10,%esp
+
+    // Touch pages out of order; each must arrive filled by the handler.
+    for(i = NPAGES - 1; i >= 0; i -= 2){
+ 172:	c7 45 f4 07 00 00 00 	movl   $0x7,-0xc(%ebp)
+ 179:	eb 50                	jmp    1cb <main+0x12e>
+        p = (uint*)(base + i*PGSIZE);
+ 17b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 17e:	c1 e0 0c             	shl    $0xc,%eax
+ 181:	89 c2                	mov    %eax,%edx
+ 183:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 186:	01 d0                	add    %edx,%eax
+ 188:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        if(p[5] != (uint)p + 5){
+ 18b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 18e:	83 c0 14             	add    $0x14,%eax
+ 191:	8b 10                	mov    (%eax),%edx
+ 193:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 196:	83 c0 05             	add    $0x5,%eax
+ 199:	39 c2                	cmp    %eax,%edx
+ 19b:	74 2a                	je     1c7 <main+0x12a>
+            printf(1, "page %d: got %x want %x\n", i, p[5], (uint)p + 5);
+ 19d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 1a0:	8d 50 05             	lea    0x5(%eax),%edx
+ 1a3:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 1a6:	83 c0 14             	add    $0x14,%eax
+ 1a9:	8b 00                	mov    (%eax),%eax
+ 1ab:	83 ec 0c             	sub    $0xc,%esp
+ 1ae:	52                   	push   %edx
+ 1af:	50                   	push   %eax
+ 1b0:	ff 75 f4             	push   -0xc(%ebp)
+ 1b3:	68 63 0c 00 00       	push   $0xc63
+ 1b8:	6a 01                	push   $0x1
+ 1ba:	e8 97 06 00 00       	call   856 <printf>
+ 1bf:	83 c4 20             	add    $0x20,%esp
+            exit();
+ 1c2:	e8 91 03 00 00       	call   558 <exit>
+    for(i = NPAGES - 1; i >= 0; i -= 2){
+ 1c7:	83 6d f4 02          	subl   $0x2,-0xc(%ebp)
+ 1cb:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 1cf:	79 aa                	jns    17b <main+0xde>
+        }
+    }
+    for(i = 0; i < NPAGES; i += 2){
+ 1d1:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 1d8:	eb 44                	jmp    21e <main+0x181>
+        p = (uint*)(base + i*PGSIZE);
+ 1da:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 1dd:	c1 e0 0c             	shl    $0xc,%eax
+ 1e0:	89 c2                	mov    %eax,%edx
+ 1e2:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 1e5:	01 d0                	add    %edx,%eax
+ 1e7:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        if(p[PGSIZE/4 - 1] != (uint)p + PGSIZE/4 - 1){
+ 1ea:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 1ed:	05 fc 0f 00 00       	add    $0xffc,%eax
+ 1f2:	8b 10                	mov    (%eax),%edx
+ 1f4:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 1f7:	05 ff 03 00 00       	add    $0x3ff,%eax
+ 1fc:	39 c2                	cmp    %eax,%edx
+ 1fe:	74 1a                	je     21a <main+0x17d>
+            printf(1, "page %d: bad contents\n", i);
+ 200:	83 ec 04             	sub    $0x4,%esp
+ 203:	ff 75 f4             	push   -0xc(%ebp)
+ 206:	68 7c 0c 00 00       	push   $0xc7c
+ 20b:	6a 01                	push   $0x1
+ 20d:	e8 44 06 00 00       	call   856 <printf>
+ 212:	83 c4 10             	add    $0x10,%esp
+            exit();
+ 215:	e8 3e 03 00 00       	call   558 <exit>
+    for(i = 0; i < NPAGES; i += 2){
+ 21a:	83 45 f4 02          	addl   $0x2,-0xc(%ebp)
+ 21e:	83 7d f4 07          	cmpl   $0x7,-0xc(%ebp)
+ 222:	7e b6                	jle    1da <main+0x13d>
+        }
+    }
+
+    kill(pid);
+ 224:	83 ec 0c             	sub    $0xc,%esp
+ 227:	ff 75 e8             	push   -0x18(%ebp)
+ 22a:	e8 5c 03 00 00       	call   58b <kill>
+ 22f:	83 c4 10             	add    $0x10,%esp
+    wait();
+ 232:	e8 28 03 00 00       	call   55f <wait>
+    printf(1, "uffdtest ok\n");
+ 237:	83 ec 08             	sub    $0x8,%esp
+ 23a:	68 93 0c 00 00       	push   $0xc93
+ 23f:	6a 01                	push   $0x1
+ 241:	e8 10 06 00 00       	call   856 <printf>
+ 246:	83 c4 10             	add    $0x10,%esp
+    exit();
+ 249:	e8 0a 03 00 00       	call   558 <exit>
+
+0000024e <stosb>:
+strchr(const char *s, char c)
+{
+    for(; *s; s++)
+        if(*s == c)
+            return (char*)s;
+    return 0;
+ 24e:	55                   	push   %ebp
+ 24f:	89 e5                	mov    %esp,%ebp
+ 251:	57                   	push   %edi
+ 252:	53                   	push   %ebx
+}
+ 253:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 256:	8b 55 10             	mov    0x10(%ebp),%edx
+ 259:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 25c:	89 cb                	mov    %ecx,%ebx
+ 25e:	89 df                	mov    %ebx,%edi
+ 260:	89 d1                	mov    %edx,%ecx
+ 262:	fc                   	cld
+ 263:	f3 aa                	rep stos %al,%es:(%edi)
+ 265:	89 ca                	mov    %ecx,%edx
+ 267:	89 fb                	mov    %edi,%ebx
+ 269:	89 5d 08             	mov    %ebx,0x8(%ebp)
+ 26c:	89 55 10             	mov    %edx,0x10(%ebp)
+
+char*
+gets(char *buf, int max)
+{
+ 26f:	90                   	nop
+ 270:	5b                   	pop    %ebx
+ 271:	5f                   	pop    %edi
+ 272:	5d                   	pop    %ebp
+ 273:	c3                   	ret
+
+00000274 <strcpy>:
+{
+ 274:	55                   	push   %ebp
+ 275:	89 e5                	mov    %esp,%ebp
+ 277:	83 ec 10             	sub    $0x10,%esp
+    os = s;
+ 27a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 27d:	89 45 fc             	mov    %eax,-0x4(%ebp)
+    while((*s++ = *t++) != 0)
+ 280:	90                   	nop
+ 281:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 284:	8d 42 01             	lea    0x1(%edx),%eax
+ 287:	89 45 0c             	mov    %eax,0xc(%ebp)
+ 28a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 28d:	8d 48 01             	lea    0x1(%eax),%ecx
+ 290:	89 4d 08             	mov    %ecx,0x8(%ebp)
+ 293:	0f b6 12             	movzbl (%edx),%edx
+ 296:	88 10                	mov    %dl,(%eax)
+ 298:	0f b6 00             	movzbl (%eax),%eax
+ 29b:	84 c0                	test   %al,%al
+ 29d:	75 e2                	jne    281 <strcpy+0xd>
+    return os;
+ 29f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 2a2:	c9                   	leave
+ 2a3:	c3                   	ret
+
+000002a4 <strcmp>:
+{
+ 2a4:	55                   	push   %ebp
+ 2a5:	89 e5                	mov    %esp,%ebp
+    while(*p && *p == *q)
+ 2a7:	eb 08                	jmp    2b1 <strcmp+0xd>
+        p++, q++;
+ 2a9:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 2ad:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+    while(*p && *p == *q)
+ 2b1:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2b4:	0f b6 00             	movzbl (%eax),%eax
+ 2b7:	84 c0                	test   %al,%al
+ 2b9:	74 10                	je     2cb <strcmp+0x27>
+ 2bb:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2be:	0f b6 10             	movzbl (%eax),%edx
+ 2c1:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 2c4:	0f b6 00             	movzbl (%eax),%eax
+ 2c7:	38 c2                	cmp    %al,%dl
+ 2c9:	74 de                	je     2a9 <strcmp+0x5>
+    return (uchar)*p - (uchar)*q;
+ 2cb:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2ce:	0f b6 00             	movzbl (%eax),%eax
+ 2d1:	0f b6 d0             	movzbl %al,%edx
+ 2d4:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 2d7:	0f b6 00             	movzbl (%eax),%eax
+ 2da:	0f b6 c0             	movzbl %al,%eax
+ 2dd:	29 c2                	sub    %eax,%edx
+ 2df:	89 d0                	mov    %edx,%eax
+}
+ 2e1:	5d                   	pop    %ebp
+ 2e2:	c3                   	ret
+
+000002e3 <strlen>:
+{
+ 2e3:	55                   	push   %ebp
+ 2e4:	89 e5                	mov    %esp,%ebp
+ 2e6:	83 ec 10             	sub    $0x10,%esp
+    for(n = 0; s[n]; n++)
+ 2e9:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ 2f0:	eb 04                	jmp    2f6 <strlen+0x13>
+ 2f2:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 2f6:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 2f9:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2fc:	01 d0                	add    %edx,%eax
+ 2fe:	0f b6 00             	movzbl (%eax),%eax
+ 301:	84 c0                	test   %al,%al
+ 303:	75 ed                	jne    2f2 <strlen+0xf>
+    return n;
+ 305:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 308:	c9                   	leave
+ 309:	c3                   	ret
+
+0000030a <memset>:
+{
+ 30a:	55                   	push   %ebp
+ 30b:	89 e5                	mov    %esp,%ebp
+    stosb(dst, c, n);
+ 30d:	8b 45 10             	mov    0x10(%ebp),%eax
+ 310:	50                   	push   %eax
+ 311:	ff 75 0c             	push   0xc(%ebp)
+ 314:	ff 75 08             	push   0x8(%ebp)
+ 317:	e8 32 ff ff ff       	call   24e <stosb>
+ 31c:	83 c4 0c             	add    $0xc,%esp
+    return dst;
+ 31f:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 322:	c9                   	leave
+ 323:	c3                   	ret
+
+00000324 <strchr>:
+{
+ 324:	55                   	push   %ebp
+ 325:	89 e5                	mov    %esp,%ebp
+ 327:	83 ec 04             	sub    $0x4,%esp
+ 32a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 32d:	88 45 fc             	mov    %al,-0x4(%ebp)
+    for(; *s; s++)
+ 330:	eb 14                	jmp    346 <strchr+0x22>
+        if(*s == c)
+ 332:	8b 45 08             	mov    0x8(%ebp),%eax
+ 335:	0f b6 00             	movzbl (%eax),%eax
+ 338:	38 45 fc             	cmp    %al,-0x4(%ebp)
+ 33b:	75 05                	jne    342 <strchr+0x1e>
+            return (char*)s;
+ 33d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 340:	eb 13                	jmp    355 <strchr+0x31>
+    for(; *s; s++)
+ 342:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 346:	8b 45 08             	mov    0x8(%ebp),%eax
+ 349:	0f b6 00             	movzbl (%eax),%eax
+ 34c:	84 c0                	test   %al,%al
+ 34e:	75 e2                	jne    332 <strchr+0xe>
+    return 0;
+ 350:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 355:	c9                   	leave
+ 356:	c3                   	ret
+
+00000357 <gets>:
+{
+ 357:	55                   	push   %ebp
+ 358:	89 e5                	mov    %esp,%ebp
+ 35a:	83 ec 18             	sub    $0x18,%esp
+    int i, cc;
+    char c;
+
+    for(i=0; i+1 < max; ){
+ 35d:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 364:	eb 42                	jmp    3a8 <gets+0x51>
+        cc = read(0, &c, 1);
+ 366:	83 ec 04             	sub    $0x4,%esp
+ 369:	6a 01                	push   $0x1
+ 36b:	8d 45 ef             	lea    -0x11(%ebp),%eax
+ 36e:	50                   	push   %eax
+ 36f:	6a 00                	push   $0x0
+ 371:	e8 f7 01 00 00       	call   56d <read>
+ 376:	83 c4 10             	add    $0x10,%esp
+ 379:	89 45 f0             	mov    %eax,-0x10(%ebp)
+        if(cc < 1)
+ 37c:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 380:	7e 33                	jle    3b5 <gets+0x5e>
+            break;
+        buf[i++] = c;
+ 382:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 385:	8d 50 01             	lea    0x1(%eax),%edx
+ 388:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 38b:	89 c2                	mov    %eax,%edx
+ 38d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 390:	01 c2                	add    %eax,%edx
+ 392:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 396:	88 02                	mov    %al,(%edx)
+        if(c == '\n' || c == '\r')
+ 398:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 39c:	3c 0a                	cmp    $0xa,%al
+ 39e:	74 16                	je     3b6 <gets+0x5f>
+ 3a0:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 3a4:	3c 0d                	cmp    $0xd,%al
+ 3a6:	74 0e                	je     3b6 <gets+0x5f>
+    for(i=0; i+1 < max; ){
+ 3a8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 3ab:	83 c0 01             	add    $0x1,%eax
+ 3ae:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 3b1:	7f b3                	jg     366 <gets+0xf>
+ 3b3:	eb 01                	jmp    3b6 <gets+0x5f>
+            break;
+ 3b5:	90                   	nop
+            break;
+    }
+    buf[i] = '\0';
+ 3b6:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 3b9:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3bc:	01 d0                	add    %edx,%eax
+ 3be:	c6 00 00             	movb   $0x0,(%eax)
+    return buf;
+ 3c1:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 3c4:	c9                   	leave
+ 3c5:	c3                   	ret
+
+000003c6 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 3c6:	55                   	push   %ebp
+ 3c7:	89 e5                	mov    %esp,%ebp
+ 3c9:	83 ec 18             	sub    $0x18,%esp
+    int fd;
+    int r;
+
+    fd = open(n, O_RDONLY);
+ 3cc:	83 ec 08             	sub    $0x8,%esp
+ 3cf:	6a 00                	push   $0x0
+ 3d1:	ff 75 08             	push   0x8(%ebp)
+ 3d4:	e8 c6 01 00 00       	call   59f <open>
+ 3d9:	83 c4 10             	add    $0x10,%esp
+ 3dc:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(fd < 0)
+ 3df:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 3e3:	79 07                	jns    3ec <stat+0x26>
+        return -1;
+ 3e5:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 3ea:	eb 25                	jmp    411 <stat+0x4b>
+    r = fstat(fd, st);
+ 3ec:	83 ec 08             	sub    $0x8,%esp
+ 3ef:	ff 75 0c             	push   0xc(%ebp)
+ 3f2:	ff 75 f4             	push   -0xc(%ebp)
+ 3f5:	e8 c3 01 00 00       	call   5bd <fstat>
+ 3fa:	83 c4 10             	add    $0x10,%esp
+ 3fd:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    close(fd);
+ 400:	83 ec 0c             	sub    $0xc,%esp
+ 403:	ff 75 f4             	push   -0xc(%ebp)
+ 406:	e8 76 01 00 00       	call   581 <close>
+ 40b:	83 c4 10             	add    $0x10,%esp
+    return r;
+ 40e:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ 411:	c9                   	leave
+ 412:	c3                   	ret
+
+00000413 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 413:	55                   	push   %ebp
+ 414:	89 e5                	mov    %esp,%ebp
+ 416:	83 ec 10             	sub    $0x10,%esp
+    int n;
+
+    n = 0;
+ 419:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+    while('0' <= *s && *s <= '9')
+ 420:	eb 25                	jmp    447 <atoi+0x34>
+        n = n*10 + *s++ - '0';
+ 422:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 425:	89 d0                	mov    %edx,%eax
+ 427:	c1 e0 02             	shl    $0x2,%eax
+ 42a:	01 d0                	add    %edx,%eax
+ 42c:	01 c0                	add    %eax,%eax
+ 42e:	89 c1                	mov    %eax,%ecx
+ 430:	8b 45 08             	mov    0x8(%ebp),%eax
+ 433:	8d 50 01             	lea    0x1(%eax),%edx
+ 436:	89 55 08             	mov    %edx,0x8(%ebp)
+ 439:	0f b6 00             	movzbl (%eax),%eax
+ 43c:	0f be c0             	movsbl %al,%eax
+ 43f:	01 c8                	add    %ecx,%eax
+ 441:	83 e8 30             	sub    $0x30,%eax
+ 444:	89 45 fc             	mov    %eax,-0x4(%ebp)
+    while('0' <= *s && *s <= '9')
+ 447:	8b 45 08             	mov    0x8(%ebp),%eax
+ 44a:	0f b6 00             	movzbl (%eax),%eax
+ 44d:	3c 2f                	cmp    $0x2f,%al
+ 44f:	7e 0a                	jle    45b <atoi+0x48>
+ 451:	8b 45 08             	mov    0x8(%ebp),%eax
+ 454:	0f b6 00             	movzbl (%eax),%eax
+ 457:	3c 39                	cmp    $0x39,%al
+ 459:	7e c7                	jle    422 <atoi+0xf>
+    return n;
+ 45b:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 45e:	c9                   	leave
+ 45f:	c3                   	ret
+
+00000460 <nice>:
+
+// Add inc to the caller's nice value; return the new value.
+int
+nice(int inc)
+{
+ 460:	55                   	push   %ebp
+ 461:	89 e5                	mov    %esp,%ebp
+ 463:	83 ec 18             	sub    $0x18,%esp
+    int n;
+
+    n = getpriority(0) + inc;
+ 466:	83 ec 0c             	sub    $0xc,%esp
+ 469:	6a 00                	push   $0x0
+ 46b:	e8 d9 01 00 00       	call   649 <getpriority>
+ 470:	83 c4 10             	add    $0x10,%esp
+ 473:	8b 55 08             	mov    0x8(%ebp),%edx
+ 476:	01 d0                	add    %edx,%eax
+ 478:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(n < 0)
+ 47b:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 47f:	79 07                	jns    488 <nice+0x28>
+        n = 0;
+ 481:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    if(n > NICEMAX)
+ 488:	83 7d f4 13          	cmpl   $0x13,-0xc(%ebp)
+ 48c:	7e 07                	jle    495 <nice+0x35>
+        n = NICEMAX;
+ 48e:	c7 45 f4 13 00 00 00 	movl   $0x13,-0xc(%ebp)
+    if(setpriority(0, n) < 0)
+ 495:	83 ec 08             	sub    $0x8,%esp
+ 498:	ff 75 f4             	push   -0xc(%ebp)
+ 49b:	6a 00                	push   $0x0
+ 49d:	e8 b1 01 00 00       	call   653 <setpriority>
+ 4a2:	83 c4 10             	add    $0x10,%esp
+ 4a5:	85 c0                	test   %eax,%eax
+ 4a7:	79 07                	jns    4b0 <nice+0x50>
+        return -1;
+ 4a9:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 4ae:	eb 03                	jmp    4b3 <nice+0x53>
+    return n;
+ 4b0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+ 4b3:	c9                   	leave
+ 4b4:	c3                   	ret
+
+000004b5 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 4b5:	55                   	push   %ebp
+ 4b6:	89 e5                	mov    %esp,%ebp
+ 4b8:	83 ec 10             	sub    $0x10,%esp
+    char *dst;
+    const char *src;
+
+    dst = vdst;
+ 4bb:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4be:	89 45 fc             	mov    %eax,-0x4(%ebp)
+    src = vsrc;
+ 4c1:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 4c4:	89 45 f8             	mov    %eax,-0x8(%ebp)
+    while(n-- > 0)
+ 4c7:	eb 17                	jmp    4e0 <memmove+0x2b>
+        *dst++ = *src++;
+ 4c9:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 4cc:	8d 42 01             	lea    0x1(%edx),%eax
+ 4cf:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 4d2:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 4d5:	8d 48 01             	lea    0x1(%eax),%ecx
+ 4d8:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+ 4db:	0f b6 12             	movzbl (%edx),%edx
+ 4de:	88 10                	mov    %dl,(%eax)
+    while(n-- > 0)
+ 4e0:	8b 45 10             	mov    0x10(%ebp),%eax
+ 4e3:	8d 50 ff             	lea    -0x1(%eax),%edx
+ 4e6:	89 55 10             	mov    %edx,0x10(%ebp)
+ 4e9:	85 c0                	test   %eax,%eax
+ 4eb:	7f dc                	jg     4c9 <memmove+0x14>
+    return vdst;
+ 4ed:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 4f0:	c9                   	leave
+ 4f1:	c3                   	ret
+
+000004f2 <dosyscall>:
+sysmode:
+    .long 0
+
+    .text
+dosyscall:
+    cmpl $0, sysmode
+ 4f2:	83 3d 28 0f 00 00 00 	cmpl   $0x0,0xf28
+    jg 2f
+ 4f9:	7f 0c                	jg     507 <dosyscall+0x15>
+    jl 1f
+ 4fb:	7c 07                	jl     504 <dosyscall+0x12>
+    call sepcheck
+ 4fd:	e8 27 00 00 00       	call   529 <sepcheck>
+    jmp dosyscall
+ 502:	eb ee                	jmp    4f2 <dosyscall>
+1:
+    int $T_SYSCALL
+ 504:	cd 40                	int    $0x40
+    ret
+ 506:	c3                   	ret
+2:
+    pushl %ebx
+ 507:	53                   	push   %ebx
+    pushl %esi
+ 508:	56                   	push   %esi
+    pushl %edi
+ 509:	57                   	push   %edi
+    pushl %ebp
+ 50a:	55                   	push   %ebp
+    movl 20(%esp), %ebx
+ 50b:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+    movl 24(%esp), %esi
+ 50f:	8b 74 24 18          	mov    0x18(%esp),%esi
+    movl 28(%esp), %edi
+ 513:	8b 7c 24 1c          	mov    0x1c(%esp),%edi
+    movl 32(%esp), %ebp
+ 517:	8b 6c 24 20          	mov    0x20(%esp),%ebp
+    movl %esp, %ecx
+ 51b:	89 e1                	mov    %esp,%ecx
+    movl $3f, %edx
+ 51d:	ba 24 05 00 00       	mov    $0x524,%edx
+    sysenter
+ 522:	0f 34                	sysenter
+3:
+    popl %ebp
+ 524:	5d                   	pop    %ebp
+    popl %edi
+ 525:	5f                   	pop    %edi
+    popl %esi
+ 526:	5e                   	pop    %esi
+    popl %ebx
+ 527:	5b                   	pop    %ebx
+    ret
+ 528:	c3                   	ret
+
+00000529 <sepcheck>:
+
+# Set sysmode from cpuid's SEP flag.    Preserves %eax.
+sepcheck:
+    pushl %eax
+ 529:	50                   	push   %eax
+    pushl %ebx
+ 52a:	53                   	push   %ebx
+    movl $1, %eax
+ 52b:	b8 01 00 00 00       	mov    $0x1,%eax
+    cpuid
+ 530:	0f a2                	cpuid
+    movl $-1, sysmode
+ 532:	c7 05 28 0f 00 00 ff 	movl   $0xffffffff,0xf28
+ 539:	ff ff ff 
+    testl $0x800, %edx
+ 53c:	f7 c2 00 08 00 00    	test   $0x800,%edx
+    jz 1f
+ 542:	74 0a                	je     54e <sepcheck+0x25>
+    movl $1, sysmode
+ 544:	c7 05 28 0f 00 00 01 	movl   $0x1,0xf28
+ 54b:	00 00 00 
+1:
+    popl %ebx
+ 54e:	5b                   	pop    %ebx
+    popl %eax
+ 54f:	58                   	pop    %eax
+    ret
+ 550:	c3                   	ret
+
+00000551 <fork>:
+
+SYSCALL(fork)
+ 551:	b8 01 00 00 00       	mov    $0x1,%eax
+ 556:	eb 9a                	jmp    4f2 <dosyscall>
+
+00000558 <exit>:
+SYSCALL(exit)
+ 558:	b8 02 00 00 00       	mov    $0x2,%eax
+ 55d:	eb 93                	jmp    4f2 <dosyscall>
+
+0000055f <wait>:
+SYSCALL(wait)
+ 55f:	b8 03 00 00 00       	mov    $0x3,%eax
+ 564:	eb 8c                	jmp    4f2 <dosyscall>
+
+00000566 <pipe>:
+SYSCALL(pipe)
+ 566:	b8 04 00 00 00       	mov    $0x4,%eax
+ 56b:	eb 85                	jmp    4f2 <dosyscall>
+
+0000056d <read>:
+SYSCALL(read)
+ 56d:	b8 05 00 00 00       	mov    $0x5,%eax
+ 572:	e9 7b ff ff ff       	jmp    4f2 <dosyscall>
+
+00000577 <write>:
+SYSCALL(write)
+ 577:	b8 10 00 00 00       	mov    $0x10,%eax
+ 57c:	e9 71 ff ff ff       	jmp    4f2 <dosyscall>
+
+00000581 <close>:
+SYSCALL(close)
+ 581:	b8 15 00 00 00       	mov    $0x15,%eax
+ 586:	e9 67 ff ff ff       	jmp    4f2 <dosyscall>
+
+0000058b <kill>:
+SYSCALL(kill)
+ 58b:	b8 06 00 00 00       	mov    $0x6,%eax
+ 590:	e9 5d ff ff ff       	jmp    4f2 <dosyscall>
+
+00000595 <exec>:
+SYSCALL(exec)
+ 595:	b8 07 00 00 00       	mov    $0x7,%eax
+ 59a:	e9 53 ff ff ff       	jmp    4f2 <dosyscall>
+
+0000059f <open>:
+SYSCALL(open)
+ 59f:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 5a4:	e9 49 ff ff ff       	jmp    4f2 <dosyscall>
+
+000005a9 <mknod>:
+SYSCALL(mknod)
+ 5a9:	b8 11 00 00 00       	mov    $0x11,%eax
+ 5ae:	e9 3f ff ff ff       	jmp    4f2 <dosyscall>
+
+000005b3 <unlink>:
+SYSCALL(unlink)
+ 5b3:	b8 12 00 00 00       	mov    $0x12,%eax
+ 5b8:	e9 35 ff ff ff       	jmp    4f2 <dosyscall>
+
+000005bd <fstat>:
+SYSCALL(fstat)
+ 5bd:	b8 08 00 00 00       	mov    $0x8,%eax
+ 5c2:	e9 2b ff ff ff       	jmp    4f2 <dosyscall>
+
+000005c7 <link>:
+SYSCALL(link)
+ 5c7:	b8 13 00 00 00       	mov    $0x13,%eax
+ 5cc:	e9 21 ff ff ff       	jmp    4f2 <dosyscall>
+
+000005d1 <mkdir>:
+SYSCALL(mkdir)
+ 5d1:	b8 14 00 00 00       	mov    $0x14,%eax
+ 5d6:	e9 17 ff ff ff       	jmp    4f2 <dosyscall>
+
+000005db <chdir>:
+SYSCALL(chdir)
+ 5db:	b8 09 00 00 00       	mov    $0x9,%eax
+ 5e0:	e9 0d ff ff ff       	jmp    4f2 <dosyscall>
+
+000005e5 <dup>:
+SYSCALL(dup)
+ 5e5:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 5ea:	e9 03 ff ff ff       	jmp    4f2 <dosyscall>
+
+000005ef <getpid>:
+SYSCALL(getpid)
+ 5ef:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 5f4:	e9 f9 fe ff ff       	jmp    4f2 <dosyscall>
+
+000005f9 <sbrk>:
+SYSCALL(sbrk)
+ 5f9:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 5fe:	e9 ef fe ff ff       	jmp    4f2 <dosyscall>
+
+00000603 <sleep>:
+SYSCALL(sleep)
+ 603:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 608:	e9 e5 fe ff ff       	jmp    4f2 <dosyscall>
+
+0000060d <uptime>:
+SYSCALL(uptime)
+ 60d:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 612:	e9 db fe ff ff       	jmp    4f2 <dosyscall>
+
+00000617 <date>:
+SYSCALL(date)
+ 617:	b8 16 00 00 00       	mov    $0x16,%eax
+ 61c:	e9 d1 fe ff ff       	jmp    4f2 <dosyscall>
+
+00000621 <dup2>:
+SYSCALL(dup2)
+ 621:	b8 17 00 00 00       	mov    $0x17,%eax
+ 626:	e9 c7 fe ff ff       	jmp    4f2 <dosyscall>
+
+0000062b <uffd>:
+SYSCALL(uffd)
+ 62b:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 630:	e9 bd fe ff ff       	jmp    4f2 <dosyscall>
+
+00000635 <uffdregister>:
+SYSCALL(uffdregister)
+ 635:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 63a:	e9 b3 fe ff ff       	jmp    4f2 <dosyscall>
+
+0000063f <uffdcopy>:
+SYSCALL(uffdcopy)
+ 63f:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 644:	e9 a9 fe ff ff       	jmp    4f2 <dosyscall>
+
+00000649 <getpriority>:
+SYSCALL(getpriority)
+ 649:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 64e:	e9 9f fe ff ff       	jmp    4f2 <dosyscall>
+
+00000653 <setpriority>:
+SYSCALL(setpriority)
+ 653:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 658:	e9 95 fe ff ff       	jmp    4f2 <dosyscall>
+
+0000065d <setweight>:
+SYSCALL(setweight)
+ 65d:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 662:	e9 8b fe ff ff       	jmp    4f2 <dosyscall>
+
+00000667 <setgroup>:
+SYSCALL(setgroup)
+ 667:	b8 20 00 00 00       	mov    $0x20,%eax
+ 66c:	e9 81 fe ff ff       	jmp    4f2 <dosyscall>
+
+00000671 <schedinfo>:
+SYSCALL(schedinfo)
+ 671:	b8 21 00 00 00       	mov    $0x21,%eax
+ 676:	e9 77 fe ff ff       	jmp    4f2 <dosyscall>
+
+0000067b <nanosleep>:
+SYSCALL(nanosleep)
+ 67b:	b8 22 00 00 00       	mov    $0x22,%eax
+ 680:	e9 6d fe ff ff       	jmp    4f2 <dosyscall>
+
+00000685 <clock_nanosleep>:
+SYSCALL(clock_nanosleep)
+ 685:	b8 23 00 00 00       	mov    $0x23,%eax
+ 68a:	e9 63 fe ff ff       	jmp    4f2 <dosyscall>
+
+0000068f <clock_gettime>:
+SYSCALL(clock_gettime)
+ 68f:	b8 24 00 00 00       	mov    $0x24,%eax
+ 694:	e9 59 fe ff ff       	jmp    4f2 <dosyscall>
+
+00000699 <sched_setaffinity>:
+SYSCALL(sched_setaffinity)
+ 699:	b8 25 00 00 00       	mov    $0x25,%eax
+ 69e:	e9 4f fe ff ff       	jmp    4f2 <dosyscall>
+
+000006a3 <sched_getaffinity>:
+SYSCALL(sched_getaffinity)
+ 6a3:	b8 26 00 00 00       	mov    $0x26,%eax
+ 6a8:	e9 45 fe ff ff       	jmp    4f2 <dosyscall>
+
+000006ad <irqaffinity>:
+SYSCALL(irqaffinity)
+ 6ad:	b8 27 00 00 00       	mov    $0x27,%eax
+ 6b2:	e9 3b fe ff ff       	jmp    4f2 <dosyscall>
+
+000006b7 <getrusage>:
+SYSCALL(getrusage)
+ 6b7:	b8 28 00 00 00       	mov    $0x28,%eax
+ 6bc:	e9 31 fe ff ff       	jmp    4f2 <dosyscall>
+
+000006c1 <times>:
+SYSCALL(times)
+ 6c1:	b8 29 00 00 00       	mov    $0x29,%eax
+ 6c6:	e9 27 fe ff ff       	jmp    4f2 <dosyscall>
+
+000006cb <schedlat>:
+SYSCALL(schedlat)
+ 6cb:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 6d0:	e9 1d fe ff ff       	jmp    4f2 <dosyscall>
+
+000006d5 <sched_setscheduler>:
+SYSCALL(sched_setscheduler)
+ 6d5:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 6da:	e9 13 fe ff ff       	jmp    4f2 <dosyscall>
+
+000006df <sched_getscheduler>:
+SYSCALL(sched_getscheduler)
+ 6df:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 6e4:	e9 09 fe ff ff       	jmp    4f2 <dosyscall>
+
+000006e9 <sched_getparam>:
+SYSCALL(sched_getparam)
+ 6e9:	b8 2d 00 00 00       	mov    $0x2d,%eax
+ 6ee:	e9 ff fd ff ff       	jmp    4f2 <dosyscall>
+
+000006f3 <lockstat>:
+SYSCALL(lockstat)
+ 6f3:	b8 2e 00 00 00       	mov    $0x2e,%eax
+ 6f8:	e9 f5 fd ff ff       	jmp    4f2 <dosyscall>
+
+000006fd <ioring_setup>:
+SYSCALL(ioring_setup)
+ 6fd:	b8 2f 00 00 00       	mov    $0x2f,%eax
+ 702:	e9 eb fd ff ff       	jmp    4f2 <dosyscall>
+
+00000707 <ioring_enter>:
+SYSCALL(ioring_enter)
+ 707:	b8 30 00 00 00       	mov    $0x30,%eax
+ 70c:	e9 e1 fd ff ff       	jmp    4f2 <dosyscall>
+
+00000711 <readv>:
+SYSCALL(readv)
+ 711:	b8 31 00 00 00       	mov    $0x31,%eax
+ 716:	e9 d7 fd ff ff       	jmp    4f2 <dosyscall>
+
+0000071b <writev>:
+SYSCALL(writev)
+ 71b:	b8 32 00 00 00       	mov    $0x32,%eax
+ 720:	e9 cd fd ff ff       	jmp    4f2 <dosyscall>
+
+00000725 <pread>:
+SYSCALL(pread)
+ 725:	b8 33 00 00 00       	mov    $0x33,%eax
+ 72a:	e9 c3 fd ff ff       	jmp    4f2 <dosyscall>
+
+0000072f <pwrite>:
+SYSCALL(pwrite)
+ 72f:	b8 34 00 00 00       	mov    $0x34,%eax
+ 734:	e9 b9 fd ff ff       	jmp    4f2 <dosyscall>
+
+00000739 <sendfile>:
+SYSCALL(sendfile)
+ 739:	b8 35 00 00 00       	mov    $0x35,%eax
+ 73e:	e9 af fd ff ff       	jmp    4f2 <dosyscall>
+
+00000743 <splice>:
+SYSCALL(splice)
+ 743:	b8 36 00 00 00       	mov    $0x36,%eax
+ 748:	e9 a5 fd ff ff       	jmp    4f2 <dosyscall>
+
+0000074d <sysstat>:
+SYSCALL(sysstat)
+ 74d:	b8 37 00 00 00       	mov    $0x37,%eax
+ 752:	e9 9b fd ff ff       	jmp    4f2 <dosyscall>
+
+00000757 <strace>:
+SYSCALL(strace)
+ 757:	b8 38 00 00 00       	mov    $0x38,%eax
+ 75c:	e9 91 fd ff ff       	jmp    4f2 <dosyscall>
+
+00000761 <straceread>:
+SYSCALL(straceread)
+ 761:	b8 39 00 00 00       	mov    $0x39,%eax
+ 766:	e9 87 fd ff ff       	jmp    4f2 <dosyscall>
+
+0000076b <alarm>:
+
+# alarm and rstoregs keep to int $T_SYSCALL: rstoregs restores
+# %ecx and %edx, which sysexit would clobber.
+.globl alarm
+    alarm:
+        pushl $rstoregs
+ 76b:	68 7b 07 00 00       	push   $0x77b
+        movl $SYS_alarm, %eax
+ 770:	b8 18 00 00 00       	mov    $0x18,%eax
+        int $T_SYSCALL
+ 775:	cd 40                	int    $0x40
+        add $0x04, %esp
+ 777:	83 c4 04             	add    $0x4,%esp
+        ret
+ 77a:	c3                   	ret
+
+0000077b <rstoregs>:
+
+.globl rstoregs
+    rstoregs:
+        movl $SYS_rstoregs, %eax
+ 77b:	b8 19 00 00 00       	mov    $0x19,%eax
+        int $T_SYSCALL
+ 780:	cd 40                	int    $0x40
+
+00000782 <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 782:	55                   	push   %ebp
+ 783:	89 e5                	mov    %esp,%ebp
+ 785:	83 ec 18             	sub    $0x18,%esp
+ 788:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 78b:	88 45 f4             	mov    %al,-0xc(%ebp)
+    write(fd, &c, 1);
+ 78e:	83 ec 04             	sub    $0x4,%esp
+ 791:	6a 01                	push   $0x1
+ 793:	8d 45 f4             	lea    -0xc(%ebp),%eax
+ 796:	50                   	push   %eax
+ 797:	ff 75 08             	push   0x8(%ebp)
+ 79a:	e8 d8 fd ff ff       	call   577 <write>
+ 79f:	83 c4 10             	add    $0x10,%esp
+}
+ 7a2:	90                   	nop
+ 7a3:	c9                   	leave
+ 7a4:	c3                   	ret
+
+000007a5 <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 7a5:	55                   	push   %ebp
+ 7a6:	89 e5                	mov    %esp,%ebp
+ 7a8:	83 ec 28             	sub    $0x28,%esp
+    static char digits[] = "0123456789ABCDEF";
+    char buf[16];
+    int i, neg;
+    uint x;
+
+    neg = 0;
+ 7ab:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+    if(sgn && xx < 0){
+ 7b2:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+ 7b6:	74 17                	je     7cf <printint+0x2a>
+ 7b8:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 7bc:	79 11                	jns    7cf <printint+0x2a>
+        neg = 1;
+ 7be:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+        x = -xx;
+ 7c5:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 7c8:	f7 d8                	neg    %eax
+ 7ca:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 7cd:	eb 06                	jmp    7d5 <printint+0x30>
+    } else {
+        x = xx;
+ 7cf:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 7d2:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    }
+
+    i = 0;
+ 7d5:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    do{
+        buf[i++] = digits[x % base];
+ 7dc:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 7df:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 7e2:	ba 00 00 00 00       	mov    $0x0,%edx
+ 7e7:	f7 f1                	div    %ecx
+ 7e9:	89 d1                	mov    %edx,%ecx
+ 7eb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 7ee:	8d 50 01             	lea    0x1(%eax),%edx
+ 7f1:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 7f4:	0f b6 91 2c 0f 00 00 	movzbl 0xf2c(%ecx),%edx
+ 7fb:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+    }while((x /= base) != 0);
+ 7ff:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 802:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 805:	ba 00 00 00 00       	mov    $0x0,%edx
+ 80a:	f7 f1                	div    %ecx
+ 80c:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 80f:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 813:	75 c7                	jne    7dc <printint+0x37>
+    if(neg)
+ 815:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 819:	74 2d                	je     848 <printint+0xa3>
+        buf[i++] = '-';
+ 81b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 81e:	8d 50 01             	lea    0x1(%eax),%edx
+ 821:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 824:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+    while(--i >= 0)
+ 829:	eb 1d                	jmp    848 <printint+0xa3>
+        putc(fd, buf[i]);
+ 82b:	8d 55 dc             	lea    -0x24(%ebp),%edx
+ 82e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 831:	01 d0                	add    %edx,%eax
+ 833:	0f b6 00             	movzbl (%eax),%eax
+ 836:	0f be c0             	movsbl %al,%eax
+ 839:	83 ec 08             	sub    $0x8,%esp
+ 83c:	50                   	push   %eax
+ 83d:	ff 75 08             	push   0x8(%ebp)
+ 840:	e8 3d ff ff ff       	call   782 <putc>
+ 845:	83 c4 10             	add    $0x10,%esp
+    while(--i >= 0)
+ 848:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+ 84c:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 850:	79 d9                	jns    82b <printint+0x86>
+}
+ 852:	90                   	nop
+ 853:	90                   	nop
+ 854:	c9                   	leave
+ 855:	c3                   	ret
+
+00000856 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 856:	55                   	push   %ebp
+ 857:	89 e5                	mov    %esp,%ebp
+ 859:	83 ec 28             	sub    $0x28,%esp
+    char *s;
+    int c, i, state;
+    uint *ap;
+
+    state = 0;
+ 85c:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+    ap = (uint*)(void*)&fmt + 1;
+ 863:	8d 45 0c             	lea    0xc(%ebp),%eax
+ 866:	83 c0 04             	add    $0x4,%eax
+ 869:	89 45 e8             	mov    %eax,-0x18(%ebp)
+    for(i = 0; fmt[i]; i++){
+ 86c:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 873:	e9 59 01 00 00       	jmp    9d1 <printf+0x17b>
+        c = fmt[i] & 0xff;
+ 878:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 87b:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 87e:	01 d0                	add    %edx,%eax
+ 880:	0f b6 00             	movzbl (%eax),%eax
+ 883:	0f be c0             	movsbl %al,%eax
+ 886:	25 ff 00 00 00       	and    $0xff,%eax
+ 88b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        if(state == 0){
+ 88e:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 892:	75 2c                	jne    8c0 <printf+0x6a>
+            if(c == '%'){
+ 894:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 898:	75 0c                	jne    8a6 <printf+0x50>
+                state = '%';
+ 89a:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+ 8a1:	e9 27 01 00 00       	jmp    9cd <printf+0x177>
+            } else {
+                putc(fd, c);
+ 8a6:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 8a9:	0f be c0             	movsbl %al,%eax
+ 8ac:	83 ec 08             	sub    $0x8,%esp
+ 8af:	50                   	push   %eax
+ 8b0:	ff 75 08             	push   0x8(%ebp)
+ 8b3:	e8 ca fe ff ff       	call   782 <putc>
+ 8b8:	83 c4 10             	add    $0x10,%esp
+ 8bb:	e9 0d 01 00 00       	jmp    9cd <printf+0x177>
+            }
+        } else if(state == '%'){
+ 8c0:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+ 8c4:	0f 85 03 01 00 00    	jne    9cd <printf+0x177>
+            if(c == 'd'){
+ 8ca:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+ 8ce:	75 1e                	jne    8ee <printf+0x98>
+                printint(fd, *ap, 10, 1);
+ 8d0:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 8d3:	8b 00                	mov    (%eax),%eax
+ 8d5:	6a 01                	push   $0x1
+ 8d7:	6a 0a                	push   $0xa
+ 8d9:	50                   	push   %eax
+ 8da:	ff 75 08             	push   0x8(%ebp)
+ 8dd:	e8 c3 fe ff ff       	call   7a5 <printint>
+ 8e2:	83 c4 10             	add    $0x10,%esp
+                ap++;
+ 8e5:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 8e9:	e9 d8 00 00 00       	jmp    9c6 <printf+0x170>
+            } else if(c == 'x' || c == 'p'){
+ 8ee:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+ 8f2:	74 06                	je     8fa <printf+0xa4>
+ 8f4:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+ 8f8:	75 1e                	jne    918 <printf+0xc2>
+                printint(fd, *ap, 16, 0);
+ 8fa:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 8fd:	8b 00                	mov    (%eax),%eax
+ 8ff:	6a 00                	push   $0x0
+ 901:	6a 10                	push   $0x10
+ 903:	50                   	push   %eax
+ 904:	ff 75 08             	push   0x8(%ebp)
+ 907:	e8 99 fe ff ff       	call   7a5 <printint>
+ 90c:	83 c4 10             	add    $0x10,%esp
+                ap++;
+ 90f:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 913:	e9 ae 00 00 00       	jmp    9c6 <printf+0x170>
+            } else if(c == 's'){
+ 918:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+ 91c:	75 43                	jne    961 <printf+0x10b>
+                s = (char*)*ap;
+ 91e:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 921:	8b 00                	mov    (%eax),%eax
+ 923:	89 45 f4             	mov    %eax,-0xc(%ebp)
+                ap++;
+ 926:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+                if(s == 0)
+ 92a:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 92e:	75 25                	jne    955 <printf+0xff>
+                    s = "(null)";
+ 930:	c7 45 f4 a0 0c 00 00 	movl   $0xca0,-0xc(%ebp)
+                while(*s != 0){
+ 937:	eb 1c                	jmp    955 <printf+0xff>
+                    putc(fd, *s);
+ 939:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 93c:	0f b6 00             	movzbl (%eax),%eax
+ 93f:	0f be c0             	movsbl %al,%eax
+ 942:	83 ec 08             	sub    $0x8,%esp
+ 945:	50                   	push   %eax
+ 946:	ff 75 08             	push   0x8(%ebp)
+ 949:	e8 34 fe ff ff       	call   782 <putc>
+ 94e:	83 c4 10             	add    $0x10,%esp
+                    s++;
+ 951:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+                while(*s != 0){
+ 955:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 958:	0f b6 00             	movzbl (%eax),%eax
+ 95b:	84 c0                	test   %al,%al
+ 95d:	75 da                	jne    939 <printf+0xe3>
+ 95f:	eb 65                	jmp    9c6 <printf+0x170>
+                }
+            } else if(c == 'c'){
+ 961:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+ 965:	75 1d                	jne    984 <printf+0x12e>
+                putc(fd, *ap);
+ 967:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 96a:	8b 00                	mov    (%eax),%eax
+ 96c:	0f be c0             	movsbl %al,%eax
+ 96f:	83 ec 08             	sub    $0x8,%esp
+ 972:	50                   	push   %eax
+ 973:	ff 75 08             	push   0x8(%ebp)
+ 976:	e8 07 fe ff ff       	call   782 <putc>
+ 97b:	83 c4 10             	add    $0x10,%esp
+                ap++;
+ 97e:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 982:	eb 42                	jmp    9c6 <printf+0x170>
+            } else if(c == '%'){
+ 984:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 988:	75 17                	jne    9a1 <printf+0x14b>
+                putc(fd, c);
+ 98a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 98d:	0f be c0             	movsbl %al,%eax
+ 990:	83 ec 08             	sub    $0x8,%esp
+ 993:	50                   	push   %eax
+ 994:	ff 75 08             	push   0x8(%ebp)
+ 997:	e8 e6 fd ff ff       	call   782 <putc>
+ 99c:	83 c4 10             	add    $0x10,%esp
+ 99f:	eb 25                	jmp    9c6 <printf+0x170>
+            } else {
+                // Unknown % sequence.    Print it to draw attention.
+                putc(fd, '%');
+ 9a1:	83 ec 08             	sub    $0x8,%esp
+ 9a4:	6a 25                	push   $0x25
+ 9a6:	ff 75 08             	push   0x8(%ebp)
+ 9a9:	e8 d4 fd ff ff       	call   782 <putc>
+ 9ae:	83 c4 10             	add    $0x10,%esp
+                putc(fd, c);
+ 9b1:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 9b4:	0f be c0             	movsbl %al,%eax
+ 9b7:	83 ec 08             	sub    $0x8,%esp
+ 9ba:	50                   	push   %eax
+ 9bb:	ff 75 08             	push   0x8(%ebp)
+ 9be:	e8 bf fd ff ff       	call   782 <putc>
+ 9c3:	83 c4 10             	add    $0x10,%esp
+            }
+            state = 0;
+ 9c6:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+    for(i = 0; fmt[i]; i++){
+ 9cd:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ 9d1:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 9d4:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 9d7:	01 d0                	add    %edx,%eax
+ 9d9:	0f b6 00             	movzbl (%eax),%eax
+ 9dc:	84 c0                	test   %al,%al
+ 9de:	0f 85 94 fe ff ff    	jne    878 <printf+0x22>
+        }
+    }
+}
+ 9e4:	90                   	nop
+ 9e5:	90                   	nop
+ 9e6:	c9                   	leave
+ 9e7:	c3                   	ret
+
+000009e8 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 9e8:	55                   	push   %ebp
+ 9e9:	89 e5                	mov    %esp,%ebp
+ 9eb:	83 ec 10             	sub    $0x10,%esp
+    Header *bp, *p;
+
+    bp = (Header*)ap - 1;
+ 9ee:	8b 45 08             	mov    0x8(%ebp),%eax
+ 9f1:	83 e8 08             	sub    $0x8,%eax
+ 9f4:	89 45 f8             	mov    %eax,-0x8(%ebp)
+    for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 9f7:	a1 48 0f 00 00       	mov    0xf48,%eax
+ 9fc:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 9ff:	eb 24                	jmp    a25 <free+0x3d>
+        if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ a01:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a04:	8b 00                	mov    (%eax),%eax
+ a06:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ a09:	72 12                	jb     a1d <free+0x35>
+ a0b:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ a0e:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ a11:	72 24                	jb     a37 <free+0x4f>
+ a13:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a16:	8b 00                	mov    (%eax),%eax
+ a18:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ a1b:	72 1a                	jb     a37 <free+0x4f>
+    for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ a1d:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a20:	8b 00                	mov    (%eax),%eax
+ a22:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ a25:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ a28:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ a2b:	73 d4                	jae    a01 <free+0x19>
+ a2d:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a30:	8b 00                	mov    (%eax),%eax
+ a32:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ a35:	73 ca                	jae    a01 <free+0x19>
+            break;
+    if(bp + bp->s.size == p->s.ptr){
+ a37:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ a3a:	8b 40 04             	mov    0x4(%eax),%eax
+ a3d:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ a44:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ a47:	01 c2                	add    %eax,%edx
+ a49:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a4c:	8b 00                	mov    (%eax),%eax
+ a4e:	39 c2                	cmp    %eax,%edx
+ a50:	75 24                	jne    a76 <free+0x8e>
+        bp->s.size += p->s.ptr->s.size;
+ a52:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ a55:	8b 50 04             	mov    0x4(%eax),%edx
+ a58:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a5b:	8b 00                	mov    (%eax),%eax
+ a5d:	8b 40 04             	mov    0x4(%eax),%eax
+ a60:	01 c2                	add    %eax,%edx
+ a62:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ a65:	89 50 04             	mov    %edx,0x4(%eax)
+        bp->s.ptr = p->s.ptr->s.ptr;
+ a68:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a6b:	8b 00                	mov    (%eax),%eax
+ a6d:	8b 10                	mov    (%eax),%edx
+ a6f:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ a72:	89 10                	mov    %edx,(%eax)
+ a74:	eb 0a                	jmp    a80 <free+0x98>
+    } else
+        bp->s.ptr = p->s.ptr;
+ a76:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a79:	8b 10                	mov    (%eax),%edx
+ a7b:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ a7e:	89 10                	mov    %edx,(%eax)
+    if(p + p->s.size == bp){
+ a80:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a83:	8b 40 04             	mov    0x4(%eax),%eax
+ a86:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ a8d:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a90:	01 d0                	add    %edx,%eax
+ a92:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ a95:	75 20                	jne    ab7 <free+0xcf>
+        p->s.size += bp->s.size;
+ a97:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a9a:	8b 50 04             	mov    0x4(%eax),%edx
+ a9d:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ aa0:	8b 40 04             	mov    0x4(%eax),%eax
+ aa3:	01 c2                	add    %eax,%edx
+ aa5:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ aa8:	89 50 04             	mov    %edx,0x4(%eax)
+        p->s.ptr = bp->s.ptr;
+ aab:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ aae:	8b 10                	mov    (%eax),%edx
+ ab0:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ ab3:	89 10                	mov    %edx,(%eax)
+ ab5:	eb 08                	jmp    abf <free+0xd7>
+    } else
+        p->s.ptr = bp;
+ ab7:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ aba:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ abd:	89 10                	mov    %edx,(%eax)
+    freep = p;
+ abf:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ ac2:	a3 48 0f 00 00       	mov    %eax,0xf48
+}
+ ac7:	90                   	nop
+ ac8:	c9                   	leave
+ ac9:	c3                   	ret
+
+00000aca <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+ aca:	55                   	push   %ebp
+ acb:	89 e5                	mov    %esp,%ebp
+ acd:	83 ec 18             	sub    $0x18,%esp
+    char *p;
+    Header *hp;
+
+    if(nu < 4096)
+ ad0:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+ ad7:	77 07                	ja     ae0 <morecore+0x16>
+        nu = 4096;
+ ad9:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+    p = sbrk(nu * sizeof(Header));
+ ae0:	8b 45 08             	mov    0x8(%ebp),%eax
+ ae3:	c1 e0 03             	shl    $0x3,%eax
+ ae6:	83 ec 0c             	sub    $0xc,%esp
+ ae9:	50                   	push   %eax
+ aea:	e8 0a fb ff ff       	call   5f9 <sbrk>
+ aef:	83 c4 10             	add    $0x10,%esp
+ af2:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p == (char*)-1)
+ af5:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+ af9:	75 07                	jne    b02 <morecore+0x38>
+        return 0;
+ afb:	b8 00 00 00 00       	mov    $0x0,%eax
+ b00:	eb 26                	jmp    b28 <morecore+0x5e>
+    hp = (Header*)p;
+ b02:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b05:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    hp->s.size = nu;
+ b08:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ b0b:	8b 55 08             	mov    0x8(%ebp),%edx
+ b0e:	89 50 04             	mov    %edx,0x4(%eax)
+    free((void*)(hp + 1));
+ b11:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ b14:	83 c0 08             	add    $0x8,%eax
+ b17:	83 ec 0c             	sub    $0xc,%esp
+ b1a:	50                   	push   %eax
+ b1b:	e8 c8 fe ff ff       	call   9e8 <free>
+ b20:	83 c4 10             	add    $0x10,%esp
+    return freep;
+ b23:	a1 48 0f 00 00       	mov    0xf48,%eax
+}
+ b28:	c9                   	leave
+ b29:	c3                   	ret
+
+00000b2a <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ b2a:	55                   	push   %ebp
+ b2b:	89 e5                	mov    %esp,%ebp
+ b2d:	83 ec 18             	sub    $0x18,%esp
+    Header *p, *prevp;
+    uint nunits;
+
+    nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ b30:	8b 45 08             	mov    0x8(%ebp),%eax
+ b33:	83 c0 07             	add    $0x7,%eax
+ b36:	c1 e8 03             	shr    $0x3,%eax
+ b39:	83 c0 01             	add    $0x1,%eax
+ b3c:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    if((prevp = freep) == 0){
+ b3f:	a1 48 0f 00 00       	mov    0xf48,%eax
+ b44:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ b47:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ b4b:	75 23                	jne    b70 <malloc+0x46>
+        base.s.ptr = freep = prevp = &base;
+ b4d:	c7 45 f0 40 0f 00 00 	movl   $0xf40,-0x10(%ebp)
+ b54:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ b57:	a3 48 0f 00 00       	mov    %eax,0xf48
+ b5c:	a1 48 0f 00 00       	mov    0xf48,%eax
+ b61:	a3 40 0f 00 00       	mov    %eax,0xf40
+        base.s.size = 0;
+ b66:	c7 05 44 0f 00 00 00 	movl   $0x0,0xf44
+ b6d:	00 00 00 
+    }
+    for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ b70:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ b73:	8b 00                	mov    (%eax),%eax
+ b75:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        if(p->s.size >= nunits){
+ b78:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b7b:	8b 40 04             	mov    0x4(%eax),%eax
+ b7e:	3b 45 ec             	cmp    -0x14(%ebp),%eax
+ b81:	72 4d                	jb     bd0 <malloc+0xa6>
+            if(p->s.size == nunits)
+ b83:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b86:	8b 40 04             	mov    0x4(%eax),%eax
+ b89:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+ b8c:	75 0c                	jne    b9a <malloc+0x70>
+                prevp->s.ptr = p->s.ptr;
+ b8e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b91:	8b 10                	mov    (%eax),%edx
+ b93:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ b96:	89 10                	mov    %edx,(%eax)
+ b98:	eb 26                	jmp    bc0 <malloc+0x96>
+            else {
+                p->s.size -= nunits;
+ b9a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b9d:	8b 40 04             	mov    0x4(%eax),%eax
+ ba0:	2b 45 ec             	sub    -0x14(%ebp),%eax
+ ba3:	89 c2                	mov    %eax,%edx
+ ba5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ ba8:	89 50 04             	mov    %edx,0x4(%eax)
+                p += p->s.size;
+ bab:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ bae:	8b 40 04             	mov    0x4(%eax),%eax
+ bb1:	c1 e0 03             	shl    $0x3,%eax
+ bb4:	01 45 f4             	add    %eax,-0xc(%ebp)
+                p->s.size = nunits;
+ bb7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ bba:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ bbd:	89 50 04             	mov    %edx,0x4(%eax)
+            }
+            freep = prevp;
+ bc0:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ bc3:	a3 48 0f 00 00       	mov    %eax,0xf48
+            return (void*)(p + 1);
+ bc8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ bcb:	83 c0 08             	add    $0x8,%eax
+ bce:	eb 3b                	jmp    c0b <malloc+0xe1>
+        }
+        if(p == freep)
+ bd0:	a1 48 0f 00 00       	mov    0xf48,%eax
+ bd5:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ bd8:	75 1e                	jne    bf8 <malloc+0xce>
+            if((p = morecore(nunits)) == 0)
+ bda:	83 ec 0c             	sub    $0xc,%esp
+ bdd:	ff 75 ec             	push   -0x14(%ebp)
+ be0:	e8 e5 fe ff ff       	call   aca <morecore>
+ be5:	83 c4 10             	add    $0x10,%esp
+ be8:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ beb:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ bef:	75 07                	jne    bf8 <malloc+0xce>
+                return 0;
+ bf1:	b8 00 00 00 00       	mov    $0x0,%eax
+ bf6:	eb 13                	jmp    c0b <malloc+0xe1>
+    for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ bf8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ bfb:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ bfe:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ c01:	8b 00                	mov    (%eax),%eax
+ c03:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        if(p->s.size >= nunits){
+ c06:	e9 6d ff ff ff       	jmp    b78 <malloc+0x4e>
+    }
+}
+ c0b:	c9                   	leave
+ c0c:	c3                   	ret
@@ -0,0 +1,78 @@
+// Test userspace page-fault delegation: a handler child fills
+// each page of the parent's registered heap range on first touch.
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "uffd.h"
+
+#define PGSIZE 4096
+#define NPAGES 8
+
+void
+handler(int fd)
+{
+    struct uffdmsg m;
+    uint *page;
+    int i;
+
+    page = (uint*)malloc(PGSIZE);
+    while(read(fd, &m, sizeof(m)) == sizeof(m)){
+        for(i = 0; i < PGSIZE/4; i++)
+            page[i] = m.addr + i;
+        if(uffdcopy(fd, (void*)m.addr, page) < 0){
+            printf(1, "uffdcopy %x failed\n", m.addr);
+            exit();
+        }
+    }
+    exit();
+}
+
+int
+main(int argc, char *argv[])
+{
+    char *base;
+    uint *p;
+    int fd, pid, i;
+
+    printf(1, "uffdtest starting\n");
+    base = sbrk(NPAGES*PGSIZE + PGSIZE);
+    base = (char*)(((uint)base + PGSIZE - 1) & ~(PGSIZE - 1));
+
+    if((fd = uffd()) < 0){
+        printf(1, "uffd failed\n");
+        exit();
+    }
+    if(uffdregister(fd, base, NPAGES*PGSIZE) < 0){
+        printf(1, "uffdregister failed\n");
+        exit();
+    }
+    pid = fork();
+    if(pid < 0){
+        printf(1, "fork failed\n");
+        exit();
+    }
+    if(pid == 0)
+        handler(fd);
+
+    // Touch pages out of order; each must arrive filled by the handler.
+    for(i = NPAGES - 1; i >= 0; i -= 2){
+        p = (uint*)(base + i*PGSIZE);
+        if(p[5] != (uint)p + 5){
+            printf(1, "page %d: got %x want %x\n", i, p[5], (uint)p + 5);
+            exit();
+        }
+    }
+    for(i = 0; i < NPAGES; i += 2){
+        p = (uint*)(base + i*PGSIZE);
+        if(p[PGSIZE/4 - 1] != (uint)p + PGSIZE/4 - 1){
+            printf(1, "page %d: bad contents\n", i);
+            exit();
+        }
+    }
+
+    kill(pid);
+    wait();
+    printf(1, "uffdtest ok\n");
+    exit();
+}
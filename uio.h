@@ -0,0 +1,8 @@
+// Buffers for readv() and writev().
+
+#define IOV_MAX    16    // Most buffers in one call
+
+struct iovec {
+    void *iov_base;
+    uint iov_len;
+};
@@ -1,4 +1,5 @@
 #include "types.h"
+#include "param.h"
 #include "stat.h"
 #include "fcntl.h"
 #include "user.h"
@@ -92,6 +93,22 @@ atoi(const char *s)
     return n;
 }
 
+// Add inc to the caller's nice value; return the new value.
+int
+nice(int inc)
+{
+    int n;
+
+    n = getpriority(0) + inc;
+    if(n < 0)
+        n = 0;
+    if(n > NICEMAX)
+        n = NICEMAX;
+    if(setpriority(0, n) < 0)
+        return -1;
+    return n;
+}
+
 void*
 memmove(void *vdst, const void *vsrc, int n)
 {
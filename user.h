@@ -1,5 +1,15 @@
 struct stat;
 struct rtcdate;
+struct schedinfo;
+struct schedlat;
+struct timespec;
+struct rusage;
+struct tms;
+struct lockstat;
+struct ioring;
+struct iovec;
+struct sysstat;
+struct stracerec;
 
 // system calls
 int fork(void);
@@ -27,6 +37,38 @@ int date(struct rtcdate*);
 int dup2(int, int);
 int alarm(int, void(*)());
 int rstoregs(void);
+int uffd(void);
+int uffdregister(int, void*, int);
+int uffdcopy(int, void*, void*);
+int getpriority(int);
+int setpriority(int, int);
+int setweight(int, int);
+int setgroup(int);
+int schedinfo(struct schedinfo*, int);
+int nanosleep(struct timespec*, struct timespec*);
+int clock_nanosleep(int, int, struct timespec*, struct timespec*);
+int clock_gettime(int, struct timespec*);
+int sched_setaffinity(int, uint);
+int sched_getaffinity(int);
+int irqaffinity(int, int);
+int getrusage(int, struct rusage*);
+int times(struct tms*);
+int schedlat(int, struct schedlat*, int);
+int sched_setscheduler(int, int, int);
+int sched_getscheduler(int);
+int sched_getparam(int);
+int lockstat(int, struct lockstat*, int);
+int ioring_setup(struct ioring**);
+int ioring_enter(int, int, int);
+int readv(int, struct iovec*, int);
+int writev(int, struct iovec*, int);
+int pread(int, void*, int, int);
+int pwrite(int, const void*, int, int);
+int sendfile(int, int, int*, int);
+int splice(int, int*, int, int*, int);
+int sysstat(int, int, struct sysstat*, int);
+int strace(int, int);
+int straceread(struct stracerec*, int);
 
 // ulib.c
 int stat(const char*, struct stat*);
@@ -41,3 +83,10 @@ void* memset(void*, int, uint);
 void* malloc(uint);
 void free(void*);
 int atoi(const char*);
+int nice(int);
+
+// uvdso.c
+int vgetpid(void);
+int vuptime(void);
+int vclock_gettime(int, struct timespec*);
+int vdate(struct rtcdate*);
@@ -0,0 +1,9870 @@
+
+_usertests:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <iputtest>:
+int stdout = 1;
+
+// does chdir() call iput(p->cwd) in a transaction?
+void
+iputtest(void)
+{
+       0:	55                   	push   %ebp
+       1:	89 e5                	mov    %esp,%ebp
+       3:	83 ec 08             	sub    $0x8,%esp
+    printf(stdout, "iput test\n");
+       6:	a1 6c 81 00 00       	mov    0x816c,%eax
+       b:	83 ec 08             	sub    $0x8,%esp
+       e:	68 5e 5b 00 00       	push   $0x5b5e
+      13:	50                   	push   %eax
+      14:	e8 c8 53 00 00       	call   53e1 <printf>
+      19:	83 c4 10             	add    $0x10,%esp
+
+    if(mkdir("iputdir") < 0){
+      1c:	83 ec 0c             	sub    $0xc,%esp
+      1f:	68 69 5b 00 00       	push   $0x5b69
+      24:	e8 33 51 00 00       	call   515c <mkdir>
+      29:	83 c4 10             	add    $0x10,%esp
+      2c:	85 c0                	test   %eax,%eax
+      2e:	79 1b                	jns    4b <iputtest+0x4b>
+        printf(stdout, "mkdir failed\n");
+      30:	a1 6c 81 00 00       	mov    0x816c,%eax
+      35:	83 ec 08             	sub    $0x8,%esp
+      38:	68 71 5b 00 00       	push   $0x5b71
+      3d:	50                   	push   %eax
+      3e:	e8 9e 53 00 00       	call   53e1 <printf>
+      43:	83 c4 10             	add    $0x10,%esp
+        exit();
+      46:	e8 98 50 00 00       	call   50e3 <exit>
+    }
+    if(chdir("iputdir") < 0){
+      4b:	83 ec 0c             	sub    $0xc,%esp
+      4e:	68 69 5b 00 00       	push   $0x5b69
+      53:	e8 0e 51 00 00       	call   5166 <chdir>
+      58:	83 c4 10             	add    $0x10,%esp
+      5b:	85 c0                	test   %eax,%eax
+      5d:	79 1b                	jns    7a <iputtest+0x7a>
+        printf(stdout, "chdir iputdir failed\n");
+      5f:	a1 6c 81 00 00       	mov    0x816c,%eax
+      64:	83 ec 08             	sub    $0x8,%esp
+      67:	68 7f 5b 00 00       	push   $0x5b7f
+      6c:	50                   	push   %eax
+      6d:	e8 6f 53 00 00       	call   53e1 <printf>
+      72:	83 c4 10             	add    $0x10,%esp
+        exit();
+      75:	e8 69 50 00 00       	call   50e3 <exit>
+    }
+    if(unlink("../iputdir") < 0){
+      7a:	83 ec 0c             	sub    $0xc,%esp
+      7d:	68 95 5b 00 00       	push   $0x5b95
+      82:	e8 b7 50 00 00       	call   513e <unlink>
+      87:	83 c4 10             	add    $0x10,%esp
+      8a:	85 c0                	test   %eax,%eax
+      8c:	79 1b                	jns    a9 <iputtest+0xa9>
+        printf(stdout, "unlink ../iputdir failed\n");
+      8e:	a1 6c 81 00 00       	mov    0x816c,%eax
+      93:	83 ec 08             	sub    $0x8,%esp
+      96:	68 a0 5b 00 00       	push   $0x5ba0
+      9b:	50                   	push   %eax
+      9c:	e8 40 53 00 00       	call   53e1 <printf>
+      a1:	83 c4 10             	add    $0x10,%esp
+        exit();
+      a4:	e8 3a 50 00 00       	call   50e3 <exit>
+    }
+    if(chdir("/") < 0){
+      a9:	83 ec 0c             	sub    $0xc,%esp
+      ac:	68 ba 5b 00 00       	push   $0x5bba
+      b1:	e8 b0 50 00 00       	call   5166 <chdir>
+      b6:	83 c4 10             	add    $0x10,%esp
+      b9:	85 c0                	test   %eax,%eax
+      bb:	79 1b                	jns    d8 <iputtest+0xd8>
+        printf(stdout, "chdir / failed\n");
+      bd:	a1 6c 81 00 00       	mov    0x816c,%eax
+      c2:	83 ec 08             	sub    $0x8,%esp
+      c5:	68 bc 5b 00 00       	push   $0x5bbc
+      ca:	50                   	push   %eax
+      cb:	e8 11 53 00 00       	call   53e1 <printf>
+      d0:	83 c4 10             	add    $0x10,%esp
+        exit();
+      d3:	e8 0b 50 00 00       	call   50e3 <exit>
+    }
+    printf(stdout, "iput test ok\n");
+      d8:	a1 6c 81 00 00       	mov    0x816c,%eax
+      dd:	83 ec 08             	sub    $0x8,%esp
+      e0:	68 cc 5b 00 00       	push   $0x5bcc
+      e5:	50                   	push   %eax
+      e6:	e8 f6 52 00 00       	call   53e1 <printf>
+      eb:	83 c4 10             	add    $0x10,%esp
+}
+      ee:	90                   	nop
+      ef:	c9                   	leave
+      f0:	c3                   	ret
+
+000000f1 <exitiputtest>:
+
+// does exit() call iput(p->cwd) in a transaction?
+void
+exitiputtest(void)
+{
+      f1:	55                   	push   %ebp
+      f2:	89 e5                	mov    %esp,%ebp
+      f4:	83 ec 18             	sub    $0x18,%esp
+    int pid;
+
+    printf(stdout, "exitiput test\n");
+      f7:	a1 6c 81 00 00       	mov    0x816c,%eax
+      fc:	83 ec 08             	sub    $0x8,%esp
+      ff:	68 da 5b 00 00       	push   $0x5bda
+     104:	50                   	push   %eax
+     105:	e8 d7 52 00 00       	call   53e1 <printf>
+     10a:	83 c4 10             	add    $0x10,%esp
+
+    pid = fork();
+     10d:	e8 ca 4f 00 00       	call   50dc <fork>
+     112:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(pid < 0){
+     115:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     119:	79 1b                	jns    136 <exitiputtest+0x45>
+        printf(stdout, "fork failed\n");
+     11b:	a1 6c 81 00 00       	mov    0x816c,%eax
+     120:	83 ec 08             	sub    $0x8,%esp
+     123:	68 e9 5b 00 00       	push   $0x5be9
+     128:	50                   	push   %eax
+     129:	e8 b3 52 00 00       	call   53e1 <printf>
+     12e:	83 c4 10             	add    $0x10,%esp
+        exit();
+     131:	e8 ad 4f 00 00       	call   50e3 <exit>
+    }
+    if(pid == 0){
+     136:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     13a:	0f 85 92 00 00 00    	jne    1d2 <exitiputtest+0xe1>
+        if(mkdir("iputdir") < 0){
+     140:	83 ec 0c             	sub    $0xc,%esp
+     143:	68 69 5b 00 00       	push   $0x5b69
+     148:	e8 0f 50 00 00       	call   515c <mkdir>
+     14d:	83 c4 10             	add    $0x10,%esp
+     150:	85 c0                	test   %eax,%eax
+     152:	79 1b                	jns    16f <exitiputtest+0x7e>
+            printf(stdout, "mkdir failed\n");
+     154:	a1 6c 81 00 00       	mov    0x816c,%eax
+     159:	83 ec 08             	sub    $0x8,%esp
+     15c:	68 71 5b 00 00       	push   $0x5b71
+     161:	50                   	push   %eax
+     162:	e8 7a 52 00 00       	call   53e1 <printf>
+     167:	83 c4 10             	add    $0x10,%esp
+            exit();
+     16a:	e8 74 4f 00 00       	call   50e3 <exit>
+        }
+        if(chdir("iputdir") < 0){
+     16f:	83 ec 0c             	sub    $0xc,%esp
+     172:	68 69 5b 00 00       	push   $0x5b69
+     177:	e8 ea 4f 00 00       	call   5166 <chdir>
+     17c:	83 c4 10             	add    $0x10,%esp
+     17f:	85 c0                	test   %eax,%eax
+     181:	79 1b                	jns    19e <exitiputtest+0xad>
+            printf(stdout, "child chdir failed\n");
+     183:	a1 6c 81 00 00       	mov    0x816c,%eax
+     188:	83 ec 08             	sub    $0x8,%esp
+     18b:	68 f6 5b 00 00       	push   $0x5bf6
+     190:	50                   	push   %eax
+     191:	e8 4b 52 00 00       	call   53e1 <printf>
+     196:	83 c4 10             	add    $0x10,%esp
+            exit();
+     199:	e8 45 4f 00 00       	call   50e3 <exit>
+        }
+        if(unlink("../iputdir") < 0){
+     19e:	83 ec 0c             	sub    $0xc,%esp
+     1a1:	68 95 5b 00 00       	push   $0x5b95
+     1a6:	e8 93 4f 00 00       	call   513e <unlink>
+     1ab:	83 c4 10             	add    $0x10,%esp
+     1ae:	85 c0                	test   %eax,%eax
+     1b0:	79 1b                	jns    1cd <exitiputtest+0xdc>
+            printf(stdout, "unlink ../iputdir failed\n");
+     1b2:	a1 6c 81 00 00       	mov    0x816c,%eax
+     1b7:	83 ec 08             	sub    $0x8,%esp
+     1ba:	68 a0 5b 00 00       	push   $0x5ba0
+     1bf:	50                   	push   %eax
+     1c0:	e8 1c 52 00 00       	call   53e1 <printf>
+     1c5:	83 c4 10             	add    $0x10,%esp
+            exit();
+     1c8:	e8 16 4f 00 00       	call   50e3 <exit>
+        }
+        exit();
+     1cd:	e8 11 4f 00 00       	call   50e3 <exit>
+    }
+    wait();
+     1d2:	e8 13 4f 00 00       	call   50ea <wait>
+    printf(stdout, "exitiput test ok\n");
+     1d7:	a1 6c 81 00 00       	mov    0x816c,%eax
+     1dc:	83 ec 08             	sub    $0x8,%esp
+     1df:	68 0a 5c 00 00       	push   $0x5c0a
+     1e4:	50                   	push   %eax
+     1e5:	e8 f7 51 00 00       	call   53e1 <printf>
+     1ea:	83 c4 10             	add    $0x10,%esp
+}
+     1ed:	90                   	nop
+     1ee:	c9                   	leave
+     1ef:	c3                   	ret
+
+000001f0 <openiputtest>:
+//            for(i = 0; i < 10000; i++)
+//                yield();
+//        }
+void
+openiputtest(void)
+{
+     1f0:	55                   	push   %ebp
+     1f1:	89 e5                	mov    %esp,%ebp
+     1f3:	83 ec 18             	sub    $0x18,%esp
+    int pid;
+
+    printf(stdout, "openiput test\n");
+     1f6:	a1 6c 81 00 00       	mov    0x816c,%eax
+     1fb:	83 ec 08             	sub    $0x8,%esp
+     1fe:	68 1c 5c 00 00       	push   $0x5c1c
+     203:	50                   	push   %eax
+     204:	e8 d8 51 00 00       	call   53e1 <printf>
+     209:	83 c4 10             	add    $0x10,%esp
+    if(mkdir("oidir") < 0){
+     20c:	83 ec 0c             	sub    $0xc,%esp
+     20f:	68 2b 5c 00 00       	push   $0x5c2b
+     214:	e8 43 4f 00 00       	call   515c <mkdir>
+     219:	83 c4 10             	add    $0x10,%esp
+     21c:	85 c0                	test   %eax,%eax
+     21e:	79 1b                	jns    23b <openiputtest+0x4b>
+        printf(stdout, "mkdir oidir failed\n");
+     220:	a1 6c 81 00 00       	mov    0x816c,%eax
+     225:	83 ec 08             	sub    $0x8,%esp
+     228:	68 31 5c 00 00       	push   $0x5c31
+     22d:	50                   	push   %eax
+     22e:	e8 ae 51 00 00       	call   53e1 <printf>
+     233:	83 c4 10             	add    $0x10,%esp
+        exit();
+     236:	e8 a8 4e 00 00       	call   50e3 <exit>
+    }
+    pid = fork();
+     23b:	e8 9c 4e 00 00       	call   50dc <fork>
+     240:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(pid < 0){
+     243:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     247:	79 1b                	jns    264 <openiputtest+0x74>
+        printf(stdout, "fork failed\n");
+     249:	a1 6c 81 00 00       	mov    0x816c,%eax
+     24e:	83 ec 08             	sub    $0x8,%esp
+     251:	68 e9 5b 00 00       	push   $0x5be9
+     256:	50                   	push   %eax
+     257:	e8 85 51 00 00       	call   53e1 <printf>
+     25c:	83 c4 10             	add    $0x10,%esp
+        exit();
+     25f:	e8 7f 4e 00 00       	call   50e3 <exit>
+    }
+    if(pid == 0){
+     264:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     268:	75 3b                	jne    2a5 <openiputtest+0xb5>
+        int fd = open("oidir", O_RDWR);
+     26a:	83 ec 08             	sub    $0x8,%esp
+     26d:	6a 02                	push   $0x2
+     26f:	68 2b 5c 00 00       	push   $0x5c2b
+     274:	e8 b1 4e 00 00       	call   512a <open>
+     279:	83 c4 10             	add    $0x10,%esp
+     27c:	89 45 f0             	mov    %eax,-0x10(%ebp)
+        if(fd >= 0){
+     27f:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+     283:	78 1b                	js     2a0 <openiputtest+0xb0>
+            printf(stdout, "open directory for write succeeded\n");
+     285:	a1 6c 81 00 00       	mov    0x816c,%eax
+     28a:	83 ec 08             	sub    $0x8,%esp
+     28d:	68 48 5c 00 00       	push   $0x5c48
+     292:	50                   	push   %eax
+     293:	e8 49 51 00 00       	call   53e1 <printf>
+     298:	83 c4 10             	add    $0x10,%esp
+            exit();
+     29b:	e8 43 4e 00 00       	call   50e3 <exit>
+        }
+        exit();
+     2a0:	e8 3e 4e 00 00       	call   50e3 <exit>
+    }
+    sleep(1);
+     2a5:	83 ec 0c             	sub    $0xc,%esp
+     2a8:	6a 01                	push   $0x1
+     2aa:	e8 df 4e 00 00       	call   518e <sleep>
+     2af:	83 c4 10             	add    $0x10,%esp
+    if(unlink("oidir") != 0){
+     2b2:	83 ec 0c             	sub    $0xc,%esp
+     2b5:	68 2b 5c 00 00       	push   $0x5c2b
+     2ba:	e8 7f 4e 00 00       	call   513e <unlink>
+     2bf:	83 c4 10             	add    $0x10,%esp
+     2c2:	85 c0                	test   %eax,%eax
+     2c4:	74 1b                	je     2e1 <openiputtest+0xf1>
+        printf(stdout, "unlink failed\n");
+     2c6:	a1 6c 81 00 00       	mov    0x816c,%eax
+     2cb:	83 ec 08             	sub    $0x8,%esp
+     2ce:	68 6c 5c 00 00       	push   $0x5c6c
+     2d3:	50                   	push   %eax
+     2d4:	e8 08 51 00 00       	call   53e1 <printf>
+     2d9:	83 c4 10             	add    $0x10,%esp
+        exit();
+     2dc:	e8 02 4e 00 00       	call   50e3 <exit>
+    }
+    wait();
+     2e1:	e8 04 4e 00 00       	call   50ea <wait>
+    printf(stdout, "openiput test ok\n");
+     2e6:	a1 6c 81 00 00       	mov    0x816c,%eax
+     2eb:	83 ec 08             	sub    $0x8,%esp
+     2ee:	68 7b 5c 00 00       	push   $0x5c7b
+     2f3:	50                   	push   %eax
+     2f4:	e8 e8 50 00 00       	call   53e1 <printf>
+     2f9:	83 c4 10             	add    $0x10,%esp
+}
+     2fc:	90                   	nop
+     2fd:	c9                   	leave
+     2fe:	c3                   	ret
+
+000002ff <opentest>:
+
+// simple file system tests
+
+void
+opentest(void)
+{
+     2ff:	55                   	push   %ebp
+     300:	89 e5                	mov    %esp,%ebp
+     302:	83 ec 18             	sub    $0x18,%esp
+    int fd;
+
+    printf(stdout, "open test\n");
+     305:	a1 6c 81 00 00       	mov    0x816c,%eax
+     30a:	83 ec 08             	sub    $0x8,%esp
+     30d:	68 8d 5c 00 00       	push   $0x5c8d
+     312:	50                   	push   %eax
+     313:	e8 c9 50 00 00       	call   53e1 <printf>
+     318:	83 c4 10             	add    $0x10,%esp
+    fd = open("echo", 0);
+     31b:	83 ec 08             	sub    $0x8,%esp
+     31e:	6a 00                	push   $0x0
+     320:	68 48 5b 00 00       	push   $0x5b48
+     325:	e8 00 4e 00 00       	call   512a <open>
+     32a:	83 c4 10             	add    $0x10,%esp
+     32d:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(fd < 0){
+     330:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     334:	79 1b                	jns    351 <opentest+0x52>
+        printf(stdout, "open echo failed!\n");
+     336:	a1 6c 81 00 00       	mov    0x816c,%eax
+     33b:	83 ec 08             	sub    $0x8,%esp
+     33e:	68 98 5c 00 00       	push   $0x5c98
+     343:	50                   	push   %eax
+     344:	e8 98 50 00 00       	call   53e1 <printf>
+     349:	83 c4 10             	add    $0x10,%esp
+        exit();
+     34c:	e8 92 4d 00 00       	call   50e3 <exit>
+    }
+    close(fd);
+     351:	83 ec 0c             	sub    $0xc,%esp
+     354:	ff 75 f4             	push   -0xc(%ebp)
+     357:	e8 b0 4d 00 00       	call   510c <close>
+     35c:	83 c4 10             	add    $0x10,%esp
+    fd = open("doesnotexist", 0);
+     35f:	83 ec 08             	sub    $0x8,%esp
+     362:	6a 00                	push   $0x0
+     364:	68 ab 5c 00 00       	push   $0x5cab
+     369:	e8 bc 4d 00 00       	call   512a <open>
+     36e:	83 c4 10             	add    $0x10,%esp
+     371:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(fd >= 0){
+     374:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     378:	78 1b                	js     395 <opentest+0x96>
+        printf(stdout, "open doesnotexist succeeded!\n");
+     37a:	a1 6c 81 00 00       	mov    0x816c,%eax
+     37f:	83 ec 08             	sub    $0x8,%esp
+     382:	68 b8 5c 00 00       	push   $0x5cb8
+     387:	50                   	push   %eax
+     388:	e8 54 50 00 00       	call   53e1 <printf>
+     38d:	83 c4 10             	add    $0x10,%esp
+        exit();
+     390:	e8 4e 4d 00 00       	call   50e3 <exit>
+    }
+    printf(stdout, "open test ok\n");
+     395:	a1 6c 81 00 00       	mov    0x816c,%eax
+     39a:	83 ec 08             	sub    $0x8,%esp
+     39d:	68 d6 5c 00 00       	push   $0x5cd6
+     3a2:	50                   	push   %eax
+     3a3:	e8 39 50 00 00       	call   53e1 <printf>
+     3a8:	83 c4 10             	add    $0x10,%esp
+}
+     3ab:	90                   	nop
+     3ac:	c9                   	leave
+     3ad:	c3                   	ret
+
+000003ae <writetest>:
+
+void
+writetest(void)
+{
+     3ae:	55                   	push   %ebp
+     3af:	89 e5                	mov    %esp,%ebp
+     3b1:	83 ec 18             	sub    $0x18,%esp
+    int fd;
+    int i;
+
+    printf(stdout, "small file test\n");
+     3b4:	a1 6c 81 00 00       	mov    0x816c,%eax
+     3b9:	83 ec 08             	sub    $0x8,%esp
+     3bc:	68 e4 5c 00 00       	push   $0x5ce4
+     3c1:	50                   	push   %eax
+     3c2:	e8 1a 50 00 00       	call   53e1 <printf>
+     3c7:	83 c4 10             	add    $0x10,%esp
+    fd = open("small", O_CREATE|O_RDWR);
+     3ca:	83 ec 08             	sub    $0x8,%esp
+     3cd:	68 02 02 00 00       	push   $0x202
+     3d2:	68 f5 5c 00 00       	push   $0x5cf5
+     3d7:	e8 4e 4d 00 00       	call   512a <open>
+     3dc:	83 c4 10             	add    $0x10,%esp
+     3df:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(fd >= 0){
+     3e2:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+     3e6:	78 22                	js     40a <writetest+0x5c>
+        printf(stdout, "creat small succeeded; ok\n");
+     3e8:	a1 6c 81 00 00       	mov    0x816c,%eax
+     3ed:	83 ec 08             	sub    $0x8,%esp
+     3f0:	68 fb 5c 00 00       	push   $0x5cfb
+     3f5:	50                   	push   %eax
+     3f6:	e8 e6 4f 00 00       	call   53e1 <printf>
+     3fb:	83 c4 10             	add    $0x10,%esp
+    } else {
+        printf(stdout, "error: creat small failed!\n");
+        exit();
+    }
+    for(i = 0; i < 100; i++){
+     3fe:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     405:	e9 8f 00 00 00       	jmp    499 <writetest+0xeb>
+        printf(stdout, "error: creat small failed!\n");
+     40a:	a1 6c 81 00 00       	mov    0x816c,%eax
+     40f:	83 ec 08             	sub    $0x8,%esp
+     412:	68 16 5d 00 00       	push   $0x5d16
+     417:	50                   	push   %eax
+     418:	e8 c4 4f 00 00       	call   53e1 <printf>
+     41d:	83 c4 10             	add    $0x10,%esp
+        exit();
+     420:	e8 be 4c 00 00       	call   50e3 <exit>
+        if(write(fd, "aaaaaaaaaa", 10) != 10){
+     425:	83 ec 04             	sub    $0x4,%esp
+     428:	6a 0a                	push   $0xa
+     42a:	68 32 5d 00 00       	push   $0x5d32
+     42f:	ff 75 f0             	push   -0x10(%ebp)
+     432:	e8 cb 4c 00 00       	call   5102 <write>
+     437:	83 c4 10             	add    $0x10,%esp
+     43a:	83 f8 0a             	cmp    $0xa,%eax
+     43d:	74 1e                	je     45d <writetest+0xaf>
+            printf(stdout, "error: write aa %d new file failed\n", i);
+     43f:	a1 6c 81 00 00       	mov    0x816c,%eax
+     444:	83 ec 04             	sub    $0x4,%esp
+     447:	ff 75 f4             	push   -0xc(%ebp)
+     44a:	68 40 5d 00 00       	push   $0x5d40
+     44f:	50                   	push   %eax
+     450:	e8 8c 4f 00 00       	call   53e1 <printf>
+     455:	83 c4 10             	add    $0x10,%esp
+            exit();
+     458:	e8 86 4c 00 00       	call   50e3 <exit>
+        }
+        if(write(fd, "bbbbbbbbbb", 10) != 10){
+     45d:	83 ec 04             	sub    $0x4,%esp
+     460:	6a 0a                	push   $0xa
+     462:	68 64 5d 00 00       	push   $0x5d64
+     467:	ff 75 f0             	push   -0x10(%ebp)
+     46a:	e8 93 4c 00 00       	call   5102 <write>
+     46f:	83 c4 10             	add    $0x10,%esp
+     472:	83 f8 0a             	cmp    $0xa,%eax
+     475:	74 1e                	je     495 <writetest+0xe7>
+            printf(stdout, "error: write bb %d new file failed\n", i);
+     477:	a1 6c 81 00 00       	mov    0x816c,%eax
+     47c:	83 ec 04             	sub    $0x4,%esp
+     47f:	ff 75 f4             	push   -0xc(%ebp)
+     482:	68 70 5d 00 00       	push   $0x5d70
+     487:	50                   	push   %eax
+     488:	e8 54 4f 00 00       	call   53e1 <printf>
+     48d:	83 c4 10             	add    $0x10,%esp
+            exit();
+     490:	e8 4e 4c 00 00       	call   50e3 <exit>
+    for(i = 0; i < 100; i++){
+     495:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+     499:	83 7d f4 63          	cmpl   $0x63,-0xc(%ebp)
+     49d:	7e 86                	jle    425 <writetest+0x77>
+        }
+    }
+    printf(stdout, "writes ok\n");
+     49f:	a1 6c 81 00 00       	mov    0x816c,%eax
+     4a4:	83 ec 08             	sub    $0x8,%esp
+     4a7:	68 94 5d 00 00       	push   $0x5d94
+     4ac:	50                   	push   %eax
+     4ad:	e8 2f 4f 00 00       	call   53e1 <printf>
+     4b2:	83 c4 10             	add    $0x10,%esp
+    close(fd);
+     4b5:	83 ec 0c             	sub    $0xc,%esp
+     4b8:	ff 75 f0             	push   -0x10(%ebp)
+     4bb:	e8 4c 4c 00 00       	call   510c <close>
+     4c0:	83 c4 10             	add    $0x10,%esp
+    fd = open("small", O_RDONLY);
+     4c3:	83 ec 08             	sub    $0x8,%esp
+     4c6:	6a 00                	push   $0x0
+     4c8:	68 f5 5c 00 00       	push   $0x5cf5
+     4cd:	e8 58 4c 00 00       	call   512a <open>
+     4d2:	83 c4 10             	add    $0x10,%esp
+     4d5:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(fd >= 0){
+     4d8:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+     4dc:	78 3c                	js     51a <writetest+0x16c>
+        printf(stdout, "open small succeeded ok\n");
+     4de:	a1 6c 81 00 00       	mov    0x816c,%eax
+     4e3:	83 ec 08             	sub    $0x8,%esp
+     4e6:	68 9f 5d 00 00       	push   $0x5d9f
+     4eb:	50                   	push   %eax
+     4ec:	e8 f0 4e 00 00       	call   53e1 <printf>
+     4f1:	83 c4 10             	add    $0x10,%esp
+    } else {
+        printf(stdout, "error: open small failed!\n");
+        exit();
+    }
+    i = read(fd, buf, 2000);
+     4f4:	83 ec 04             	sub    $0x4,%esp
+     4f7:	68 d0 07 00 00       	push   $0x7d0
+     4fc:	68 a0 81 00 00       	push   $0x81a0
+     501:	ff 75 f0             	push   -0x10(%ebp)
+     504:	e8 ef 4b 00 00       	call   50f8 <read>
+     509:	83 c4 10             	add    $0x10,%esp
+     50c:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(i == 2000){
+     50f:	81 7d f4 d0 07 00 00 	cmpl   $0x7d0,-0xc(%ebp)
+     516:	75 57                	jne    56f <writetest+0x1c1>
+     518:	eb 1b                	jmp    535 <writetest+0x187>
+        printf(stdout, "error: open small failed!\n");
+     51a:	a1 6c 81 00 00       	mov    0x816c,%eax
+     51f:	83 ec 08             	sub    $0x8,%esp
+     522:	68 b8 5d 00 00       	push   $0x5db8
+     527:	50                   	push   %eax
+     528:	e8 b4 4e 00 00       	call   53e1 <printf>
+     52d:	83 c4 10             	add    $0x10,%esp
+        exit();
+     530:	e8 ae 4b 00 00       	call   50e3 <exit>
+        printf(stdout, "read succeeded ok\n");
+     535:	a1 6c 81 00 00       	mov    0x816c,%eax
+     53a:	83 ec 08             	sub    $0x8,%esp
+     53d:	68 d3 5d 00 00       	push   $0x5dd3
+     542:	50                   	push   %eax
+     543:	e8 99 4e 00 00       	call   53e1 <printf>
+     548:	83 c4 10             	add    $0x10,%esp
+    } else {
+        printf(stdout, "read failed\n");
+        exit();
+    }
+    close(fd);
+     54b:	83 ec 0c             	sub    $0xc,%esp
+     54e:	ff 75 f0             	push   -0x10(%ebp)
+     551:	e8 b6 4b 00 00       	call   510c <close>
+     556:	83 c4 10             	add    $0x10,%esp
+
+    if(unlink("small") < 0){
+     559:	83 ec 0c             	sub    $0xc,%esp
+     55c:	68 f5 5c 00 00       	push   $0x5cf5
+     561:	e8 d8 4b 00 00       	call   513e <unlink>
+     566:	83 c4 10             	add    $0x10,%esp
+     569:	85 c0                	test   %eax,%eax
+     56b:	79 38                	jns    5a5 <writetest+0x1f7>
+     56d:	eb 1b                	jmp    58a <writetest+0x1dc>
+        printf(stdout, "read failed\n");
+     56f:	a1 6c 81 00 00       	mov    0x816c,%eax
+     574:	83 ec 08             	sub    $0x8,%esp
+     577:	68 e6 5d 00 00       	push   $0x5de6
+     57c:	50                   	push   %eax
+     57d:	e8 5f 4e 00 00       	call   53e1 <printf>
+     582:	83 c4 10             	add    $0x10,%esp
+        exit();
+     585:	e8 59 4b 00 00       	call   50e3 <exit>
+        printf(stdout, "unlink small failed\n");
+     58a:	a1 6c 81 00 00       	mov    0x816c,%eax
+     58f:	83 ec 08             	sub    $0x8,%esp
+     592:	68 f3 5d 00 00       	push   $0x5df3
+     597:	50                   	push   %eax
+     598:	e8 44 4e 00 00       	call   53e1 <printf>
+     59d:	83 c4 10             	add    $0x10,%esp
+        exit();
+     5a0:	e8 3e 4b 00 00       	call   50e3 <exit>
+    }
+    printf(stdout, "small file test ok\n");
+     5a5:	a1 6c 81 00 00       	mov    0x816c,%eax
+     5aa:	83 ec 08             	sub    $0x8,%esp
+     5ad:	68 08 5e 00 00       	push   $0x5e08
+     5b2:	50                   	push   %eax
+     5b3:	e8 29 4e 00 00       	call   53e1 <printf>
+     5b8:	83 c4 10             	add    $0x10,%esp
+}
+     5bb:	90                   	nop
+     5bc:	c9                   	leave
+     5bd:	c3                   	ret
+
+000005be <writetest1>:
+
+void
+writetest1(void)
+{
+     5be:	55                   	push   %ebp
+     5bf:	89 e5                	mov    %esp,%ebp
+     5c1:	83 ec 18             	sub    $0x18,%esp
+    int i, fd, n;
+
+    printf(stdout, "big files test\n");
+     5c4:	a1 6c 81 00 00       	mov    0x816c,%eax
+     5c9:	83 ec 08             	sub    $0x8,%esp
+     5cc:	68 1c 5e 00 00       	push   $0x5e1c
+     5d1:	50                   	push   %eax
+     5d2:	e8 0a 4e 00 00       	call   53e1 <printf>
+     5d7:	83 c4 10             	add    $0x10,%esp
+
+    fd = open("big", O_CREATE|O_RDWR);
+     5da:	83 ec 08             	sub    $0x8,%esp
+     5dd:	68 02 02 00 00       	push   $0x202
+     5e2:	68 2c 5e 00 00       	push   $0x5e2c
+     5e7:	e8 3e 4b 00 00       	call   512a <open>
+     5ec:	83 c4 10             	add    $0x10,%esp
+     5ef:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    if(fd < 0){
+     5f2:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+     5f6:	79 1b                	jns    613 <writetest1+0x55>
+        printf(stdout, "error: creat big failed!\n");
+     5f8:	a1 6c 81 00 00       	mov    0x816c,%eax
+     5fd:	83 ec 08             	sub    $0x8,%esp
+     600:	68 30 5e 00 00       	push   $0x5e30
+     605:	50                   	push   %eax
+     606:	e8 d6 4d 00 00       	call   53e1 <printf>
+     60b:	83 c4 10             	add    $0x10,%esp
+        exit();
+     60e:	e8 d0 4a 00 00       	call   50e3 <exit>
+    }
+
+    for(i = 0; i < MAXFILE; i++){
+     613:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     61a:	eb 4b                	jmp    667 <writetest1+0xa9>
+        ((int*)buf)[0] = i;
+     61c:	ba a0 81 00 00       	mov    $0x81a0,%edx
+     621:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     624:	89 02                	mov    %eax,(%edx)
+        if(write(fd, buf, 512) != 512){
+     626:	83 ec 04             	sub    $0x4,%esp
+     629:	68 00 02 00 00       	push   $0x200
+     62e:	68 a0 81 00 00       	push   $0x81a0
+     633:	ff 75 ec             	push   -0x14(%ebp)
+     636:	e8 c7 4a 00 00       	call   5102 <write>
+     63b:	83 c4 10             	add    $0x10,%esp
+     63e:	3d 00 02 00 00       	cmp    $0x200,%eax
+     643:	74 1e                	je     663 <writetest1+0xa5>
+            printf(stdout, "error: write big file failed\n", i);
+     645:	a1 6c 81 00 00       	mov    0x816c,%eax
+     64a:	83 ec 04             	sub    $0x4,%esp
+     64d:	ff 75 f4             	push   -0xc(%ebp)
+     650:	68 4a 5e 00 00       	push   $0x5e4a
+     655:	50                   	push   %eax
+     656:	e8 86 4d 00 00       	call   53e1 <printf>
+     65b:	83 c4 10             	add    $0x10,%esp
+            exit();
+     65e:	e8 80 4a 00 00       	call   50e3 <exit>
+    for(i = 0; i < MAXFILE; i++){
+     663:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+     667:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     66a:	3d 8b 00 00 00       	cmp    $0x8b,%eax
+     66f:	76 ab                	jbe    61c <writetest1+0x5e>
+        }
+    }
+
+    close(fd);
+     671:	83 ec 0c             	sub    $0xc,%esp
+     674:	ff 75 ec             	push   -0x14(%ebp)
+     677:	e8 90 4a 00 00       	call   510c <close>
+     67c:	83 c4 10             	add    $0x10,%esp
+
+    fd = open("big", O_RDONLY);
+     67f:	83 ec 08             	sub    $0x8,%esp
+     682:	6a 00                	push   $0x0
+     684:	68 2c 5e 00 00       	push   $0x5e2c
+     689:	e8 9c 4a 00 00       	call   512a <open>
+     68e:	83 c4 10             	add    $0x10,%esp
+     691:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    if(fd < 0){
+     694:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+     698:	79 1b                	jns    6b5 <writetest1+0xf7>
+        printf(stdout, "error: open big failed!\n");
+     69a:	a1 6c 81 00 00       	mov    0x816c,%eax
+     69f:	83 ec 08             	sub    $0x8,%esp
+     6a2:	68 68 5e 00 00       	push   $0x5e68
+     6a7:	50                   	push   %eax
+     6a8:	e8 34 4d 00 00       	call   53e1 <printf>
+     6ad:	83 c4 10             	add    $0x10,%esp
+        exit();
+     6b0:	e8 2e 4a 00 00       	call   50e3 <exit>
+    }
+
+    n = 0;
+     6b5:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+    for(;;){
+        i = read(fd, buf, 512);
+     6bc:	83 ec 04             	sub    $0x4,%esp
+     6bf:	68 00 02 00 00       	push   $0x200
+     6c4:	68 a0 81 00 00       	push   $0x81a0
+     6c9:	ff 75 ec             	push   -0x14(%ebp)
+     6cc:	e8 27 4a 00 00       	call   50f8 <read>
+     6d1:	83 c4 10             	add    $0x10,%esp
+     6d4:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        if(i == 0){
+     6d7:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     6db:	75 27                	jne    704 <writetest1+0x146>
+            if(n == MAXFILE - 1){
+     6dd:	81 7d f0 8b 00 00 00 	cmpl   $0x8b,-0x10(%ebp)
+     6e4:	75 7d                	jne    763 <writetest1+0x1a5>
+                printf(stdout, "read only %d blocks from big", n);
+     6e6:	a1 6c 81 00 00       	mov    0x816c,%eax
+     6eb:	83 ec 04             	sub    $0x4,%esp
+     6ee:	ff 75 f0             	push   -0x10(%ebp)
+     6f1:	68 81 5e 00 00       	push   $0x5e81
+     6f6:	50                   	push   %eax
+     6f7:	e8 e5 4c 00 00       	call   53e1 <printf>
+     6fc:	83 c4 10             	add    $0x10,%esp
+                exit();
+     6ff:	e8 df 49 00 00       	call   50e3 <exit>
+            }
+            break;
+        } else if(i != 512){
+     704:	81 7d f4 00 02 00 00 	cmpl   $0x200,-0xc(%ebp)
+     70b:	74 1e                	je     72b <writetest1+0x16d>
+            printf(stdout, "read failed %d\n", i);
+     70d:	a1 6c 81 00 00       	mov    0x816c,%eax
+     712:	83 ec 04             	sub    $0x4,%esp
+     715:	ff 75 f4             	push   -0xc(%ebp)
+     718:	68 9e 5e 00 00       	push   $0x5e9e
+     71d:	50                   	push   %eax
+     71e:	e8 be 4c 00 00       	call   53e1 <printf>
+     723:	83 c4 10             	add    $0x10,%esp
+            exit();
+     726:	e8 b8 49 00 00       	call   50e3 <exit>
+        }
+        if(((int*)buf)[0] != n){
+     72b:	b8 a0 81 00 00       	mov    $0x81a0,%eax
+     730:	8b 00                	mov    (%eax),%eax
+     732:	39 45 f0             	cmp    %eax,-0x10(%ebp)
+     735:	74 23                	je     75a <writetest1+0x19c>
+            printf(stdout, "read content of block %d is %d\n",
+                         n, ((int*)buf)[0]);
+     737:	b8 a0 81 00 00       	mov    $0x81a0,%eax
+            printf(stdout, "read content of block %d is %d\n",
+     73c:	8b 10                	mov    (%eax),%edx
+     73e:	a1 6c 81 00 00       	mov    0x816c,%eax
+     743:	52                   	push   %edx
+     744:	ff 75 f0             	push   -0x10(%ebp)
+     747:	68 b0 5e 00 00       	push   $0x5eb0
+     74c:	50                   	push   %eax
+     74d:	e8 8f 4c 00 00       	call   53e1 <printf>
+     752:	83 c4 10             	add    $0x10,%esp
+            exit();
+     755:	e8 89 49 00 00       	call   50e3 <exit>
+        }
+        n++;
+     75a:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+        i = read(fd, buf, 512);
+     75e:	e9 59 ff ff ff       	jmp    6bc <writetest1+0xfe>
+            break;
+     763:	90                   	nop
+    }
+    close(fd);
+     764:	83 ec 0c             	sub    $0xc,%esp
+     767:	ff 75 ec             	push   -0x14(%ebp)
+     76a:	e8 9d 49 00 00       	call   510c <close>
+     76f:	83 c4 10             	add    $0x10,%esp
+    if(unlink("big") < 0){
+     772:	83 ec 0c             	sub    $0xc,%esp
+     775:	68 2c 5e 00 00       	push   $0x5e2c
+     77a:	e8 bf 49 00 00       	call   513e <unlink>
+     77f:	83 c4 10             	add    $0x10,%esp
+     782:	85 c0                	test   %eax,%eax
+     784:	79 1b                	jns    7a1 <writetest1+0x1e3>
+        printf(stdout, "unlink big failed\n");
+     786:	a1 6c 81 00 00       	mov    0x816c,%eax
+     78b:	83 ec 08             	sub    $0x8,%esp
+     78e:	68 d0 5e 00 00       	push   $0x5ed0
+     793:	50                   	push   %eax
+     794:	e8 48 4c 00 00       	call   53e1 <printf>
+     799:	83 c4 10             	add    $0x10,%esp
+        exit();
+     79c:	e8 42 49 00 00       	call   50e3 <exit>
+    }
+    printf(stdout, "big files ok\n");
+     7a1:	a1 6c 81 00 00       	mov    0x816c,%eax
+     7a6:	83 ec 08             	sub    $0x8,%esp
+     7a9:	68 e3 5e 00 00       	push   $0x5ee3
+     7ae:	50                   	push   %eax
+     7af:	e8 2d 4c 00 00       	call   53e1 <printf>
+     7b4:	83 c4 10             	add    $0x10,%esp
+}
+     7b7:	90                   	nop
+     7b8:	c9                   	leave
+     7b9:	c3                   	ret
+
+000007ba <createtest>:
+
+void
+createtest(void)
+{
+     7ba:	55                   	push   %ebp
+     7bb:	89 e5                	mov    %esp,%ebp
+     7bd:	83 ec 18             	sub    $0x18,%esp
+    int i, fd;
+
+    printf(stdout, "many creates, followed by unlink test\n");
+     7c0:	a1 6c 81 00 00       	mov    0x816c,%eax
+     7c5:	83 ec 08             	sub    $0x8,%esp
+     7c8:	68 f4 5e 00 00       	push   $0x5ef4
+     7cd:	50                   	push   %eax
+     7ce:	e8 0e 4c 00 00       	call   53e1 <printf>
+     7d3:	83 c4 10             	add    $0x10,%esp
+
+    name[0] = 'a';
+     7d6:	c6 05 a0 a1 00 00 61 	movb   $0x61,0xa1a0
+    name[2] = '\0';
+     7dd:	c6 05 a2 a1 00 00 00 	movb   $0x0,0xa1a2
+    for(i = 0; i < 52; i++){
+     7e4:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     7eb:	eb 35                	jmp    822 <createtest+0x68>
+        name[1] = '0' + i;
+     7ed:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     7f0:	83 c0 30             	add    $0x30,%eax
+     7f3:	a2 a1 a1 00 00       	mov    %al,0xa1a1
+        fd = open(name, O_CREATE|O_RDWR);
+     7f8:	83 ec 08             	sub    $0x8,%esp
+     7fb:	68 02 02 00 00       	push   $0x202
+     800:	68 a0 a1 00 00       	push   $0xa1a0
+     805:	e8 20 49 00 00       	call   512a <open>
+     80a:	83 c4 10             	add    $0x10,%esp
+     80d:	89 45 f0             	mov    %eax,-0x10(%ebp)
+        close(fd);
+     810:	83 ec 0c             	sub    $0xc,%esp
+     813:	ff 75 f0             	push   -0x10(%ebp)
+     816:	e8 f1 48 00 00       	call   510c <close>
+     81b:	83 c4 10             	add    $0x10,%esp
+    for(i = 0; i < 52; i++){
+     81e:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+     822:	83 7d f4 33          	cmpl   $0x33,-0xc(%ebp)
+     826:	7e c5                	jle    7ed <createtest+0x33>
+    }
+    name[0] = 'a';
+     828:	c6 05 a0 a1 00 00 61 	movb   $0x61,0xa1a0
+    name[2] = '\0';
+     82f:	c6 05 a2 a1 00 00 00 	movb   $0x0,0xa1a2
+    for(i = 0; i < 52; i++){
+     836:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     83d:	eb 1f                	jmp    85e <createtest+0xa4>
+        name[1] = '0' + i;
+     83f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     842:	83 c0 30             	add    $0x30,%eax
+     845:	a2 a1 a1 00 00       	mov    %al,0xa1a1
+        unlink(name);
+     84a:	83 ec 0c             	sub    $0xc,%esp
+     84d:	68 a0 a1 00 00       	push   $0xa1a0
+     852:	e8 e7 48 00 00       	call   513e <unlink>
+     857:	83 c4 10             	add    $0x10,%esp
+    for(i = 0; i < 52; i++){
+     85a:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+     85e:	83 7d f4 33          	cmpl   $0x33,-0xc(%ebp)
+     862:	7e db                	jle    83f <createtest+0x85>
+    }
+    printf(stdout, "many creates, followed by unlink; ok\n");
+     864:	a1 6c 81 00 00       	mov    0x816c,%eax
+     869:	83 ec 08             	sub    $0x8,%esp
+     86c:	68 1c 5f 00 00       	push   $0x5f1c
+     871:	50                   	push   %eax
+     872:	e8 6a 4b 00 00       	call   53e1 <printf>
+     877:	83 c4 10             	add    $0x10,%esp
+}
+     87a:	90                   	nop
+     87b:	c9                   	leave
+     87c:	c3                   	ret
+
+0000087d <dirtest>:
+
+void dirtest(void)
+{
+     87d:	55                   	push   %ebp
+     87e:	89 e5                	mov    %esp,%ebp
+     880:	83 ec 08             	sub    $0x8,%esp
+    printf(stdout, "mkdir test\n");
+     883:	a1 6c 81 00 00       	mov    0x816c,%eax
+     888:	83 ec 08             	sub    $0x8,%esp
+     88b:	68 42 5f 00 00       	push   $0x5f42
+     890:	50                   	push   %eax
+     891:	e8 4b 4b 00 00       	call   53e1 <printf>
+     896:	83 c4 10             	add    $0x10,%esp
+
+    if(mkdir("dir0") < 0){
+     899:	83 ec 0c             	sub    $0xc,%esp
+     89c:	68 4e 5f 00 00       	push   $0x5f4e
+     8a1:	e8 b6 48 00 00       	call   515c <mkdir>
+     8a6:	83 c4 10             	add    $0x10,%esp
+     8a9:	85 c0                	test   %eax,%eax
+     8ab:	79 1b                	jns    8c8 <dirtest+0x4b>
+        printf(stdout, "mkdir failed\n");
+     8ad:	a1 6c 81 00 00       	mov    0x816c,%eax
+     8b2:	83 ec 08             	sub    $0x8,%esp
+     8b5:	68 71 5b 00 00       	push   $0x5b71
+     8ba:	50                   	push   %eax
+     8bb:	e8 21 4b 00 00       	call   53e1 <printf>
+     8c0:	83 c4 10             	add    $0x10,%esp
+        exit();
+     8c3:	e8 1b 48 00 00       	call   50e3 <exit>
+    }
+
+    if(chdir("dir0") < 0){
+     8c8:	83 ec 0c             	sub    $0xc,%esp
+     8cb:	68 4e 5f 00 00       	push   $0x5f4e
+     8d0:	e8 91 48 00 00       	call   5166 <chdir>
+     8d5:	83 c4 10             	add    $0x10,%esp
+     8d8:	85 c0                	test   %eax,%eax
+     8da:	79 1b                	jns    8f7 <dirtest+0x7a>
+        printf(stdout, "chdir dir0 failed\n");
+     8dc:	a1 6c 81 00 00       	mov    0x816c,%eax
+     8e1:	83 ec 08             	sub    $0x8,%esp
+     8e4:	68 53 5f 00 00       	push   $0x5f53
+     8e9:	50                   	push   %eax
+     8ea:	e8 f2 4a 00 00       	call   53e1 <printf>
+     8ef:	83 c4 10             	add    $0x10,%esp
+        exit();
+     8f2:	e8 ec 47 00 00       	call   50e3 <exit>
+    }
+
+    if(chdir("..") < 0){
+     8f7:	83 ec 0c             	sub    $0xc,%esp
+     8fa:	68 66 5f 00 00       	push   $0x5f66
+     8ff:	e8 62 48 00 00       	call   5166 <chdir>
+     904:	83 c4 10             	add    $0x10,%esp
+     907:	85 c0                	test   %eax,%eax
+     909:	79 1b                	jns    926 <dirtest+0xa9>
+        printf(stdout, "chdir .. failed\n");
+     90b:	a1 6c 81 00 00       	mov    0x816c,%eax
+     910:	83 ec 08             	sub    $0x8,%esp
+     913:	68 69 5f 00 00       	push   $0x5f69
+     918:	50                   	push   %eax
+     919:	e8 c3 4a 00 00       	call   53e1 <printf>
+     91e:	83 c4 10             	add    $0x10,%esp
+        exit();
+     921:	e8 bd 47 00 00       	call   50e3 <exit>
+    }
+
+    if(unlink("dir0") < 0){
+     926:	83 ec 0c             	sub    $0xc,%esp
+     929:	68 4e 5f 00 00       	push   $0x5f4e
+     92e:	e8 0b 48 00 00       	call   513e <unlink>
+     933:	83 c4 10             	add    $0x10,%esp
+     936:	85 c0                	test   %eax,%eax
+     938:	79 1b                	jns    955 <dirtest+0xd8>
+        printf(stdout, "unlink dir0 failed\n");
+     93a:	a1 6c 81 00 00       	mov    0x816c,%eax
+     93f:	83 ec 08             	sub    $0x8,%esp
+     942:	68 7a 5f 00 00       	push   $0x5f7a
+     947:	50                   	push   %eax
+     948:	e8 94 4a 00 00       	call   53e1 <printf>
+     94d:	83 c4 10             	add    $0x10,%esp
+        exit();
+     950:	e8 8e 47 00 00       	call   50e3 <exit>
+    }
+    printf(stdout, "mkdir test ok\n");
+     955:	a1 6c 81 00 00       	mov    0x816c,%eax
+     95a:	83 ec 08             	sub    $0x8,%esp
+     95d:	68 8e 5f 00 00       	push   $0x5f8e
+     962:	50                   	push   %eax
+     963:	e8 79 4a 00 00       	call   53e1 <printf>
+     968:	83 c4 10             	add    $0x10,%esp
+}
+     96b:	90                   	nop
+     96c:	c9                   	leave
+     96d:	c3                   	ret
+
+0000096e <exectest>:
+
+void
+exectest(void)
+{
+     96e:	55                   	push   %ebp
+     96f:	89 e5                	mov    %esp,%ebp
+     971:	83 ec 08             	sub    $0x8,%esp
+    printf(stdout, "exec test\n");
+     974:	a1 6c 81 00 00       	mov    0x816c,%eax
+     979:	83 ec 08             	sub    $0x8,%esp
+     97c:	68 9d 5f 00 00       	push   $0x5f9d
+     981:	50                   	push   %eax
+     982:	e8 5a 4a 00 00       	call   53e1 <printf>
+     987:	83 c4 10             	add    $0x10,%esp
+    if(exec("echo", echoargv) < 0){
+     98a:	83 ec 08             	sub    $0x8,%esp
+     98d:	68 58 81 00 00       	push   $0x8158
+     992:	68 48 5b 00 00       	push   $0x5b48
+     997:	e8 84 47 00 00       	call   5120 <exec>
+     99c:	83 c4 10             	add    $0x10,%esp
+     99f:	85 c0                	test   %eax,%eax
+     9a1:	79 1b                	jns    9be <exectest+0x50>
+        printf(stdout, "exec echo failed\n");
+     9a3:	a1 6c 81 00 00       	mov    0x816c,%eax
+     9a8:	83 ec 08             	sub    $0x8,%esp
+     9ab:	68 a8 5f 00 00       	push   $0x5fa8
+     9b0:	50                   	push   %eax
+     9b1:	e8 2b 4a 00 00       	call   53e1 <printf>
+     9b6:	83 c4 10             	add    $0x10,%esp
+        exit();
+     9b9:	e8 25 47 00 00       	call   50e3 <exit>
+    }
+}
+     9be:	90                   	nop
+     9bf:	c9                   	leave
+     9c0:	c3                   	ret
+
+000009c1 <pipe1>:
+
+// simple fork and pipe read/write
+
+void
+pipe1(void)
+{
+     9c1:	55                   	push   %ebp
+     9c2:	89 e5                	mov    %esp,%ebp
+     9c4:	83 ec 28             	sub    $0x28,%esp
+    int fds[2], pid;
+    int seq, i, n, cc, total;
+
+    if(pipe(fds) != 0){
+     9c7:	83 ec 0c             	sub    $0xc,%esp
+     9ca:	8d 45 d8             	lea    -0x28(%ebp),%eax
+     9cd:	50                   	push   %eax
+     9ce:	e8 1e 47 00 00       	call   50f1 <pipe>
+     9d3:	83 c4 10             	add    $0x10,%esp
+     9d6:	85 c0                	test   %eax,%eax
+     9d8:	74 17                	je     9f1 <pipe1+0x30>
+        printf(1, "pipe() failed\n");
+     9da:	83 ec 08             	sub    $0x8,%esp
+     9dd:	68 ba 5f 00 00       	push   $0x5fba
+     9e2:	6a 01                	push   $0x1
+     9e4:	e8 f8 49 00 00       	call   53e1 <printf>
+     9e9:	83 c4 10             	add    $0x10,%esp
+        exit();
+     9ec:	e8 f2 46 00 00       	call   50e3 <exit>
+    }
+    pid = fork();
+     9f1:	e8 e6 46 00 00       	call   50dc <fork>
+     9f6:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    seq = 0;
+     9f9:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    if(pid == 0){
+     a00:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+     a04:	0f 85 89 00 00 00    	jne    a93 <pipe1+0xd2>
+        close(fds[0]);
+     a0a:	8b 45 d8             	mov    -0x28(%ebp),%eax
+     a0d:	83 ec 0c             	sub    $0xc,%esp
+     a10:	50                   	push   %eax
+     a11:	e8 f6 46 00 00       	call   510c <close>
+     a16:	83 c4 10             	add    $0x10,%esp
+        for(n = 0; n < 5; n++){
+     a19:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+     a20:	eb 66                	jmp    a88 <pipe1+0xc7>
+            for(i = 0; i < 1033; i++)
+     a22:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+     a29:	eb 19                	jmp    a44 <pipe1+0x83>
+                buf[i] = seq++;
+     a2b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     a2e:	8d 50 01             	lea    0x1(%eax),%edx
+     a31:	89 55 f4             	mov    %edx,-0xc(%ebp)
+     a34:	89 c2                	mov    %eax,%edx
+     a36:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     a39:	05 a0 81 00 00       	add    $0x81a0,%eax
+     a3e:	88 10                	mov    %dl,(%eax)
+            for(i = 0; i < 1033; i++)
+     a40:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+     a44:	81 7d f0 08 04 00 00 	cmpl   $0x408,-0x10(%ebp)
+     a4b:	7e de                	jle    a2b <pipe1+0x6a>
+            if(write(fds[1], buf, 1033) != 1033){
+     a4d:	8b 45 dc             	mov    -0x24(%ebp),%eax
+     a50:	83 ec 04             	sub    $0x4,%esp
+     a53:	68 09 04 00 00       	push   $0x409
+     a58:	68 a0 81 00 00       	push   $0x81a0
+     a5d:	50                   	push   %eax
+     a5e:	e8 9f 46 00 00       	call   5102 <write>
+     a63:	83 c4 10             	add    $0x10,%esp
+     a66:	3d 09 04 00 00       	cmp    $0x409,%eax
+     a6b:	74 17                	je     a84 <pipe1+0xc3>
+                printf(1, "pipe1 oops 1\n");
+     a6d:	83 ec 08             	sub    $0x8,%esp
+     a70:	68 c9 5f 00 00       	push   $0x5fc9
+     a75:	6a 01                	push   $0x1
+     a77:	e8 65 49 00 00       	call   53e1 <printf>
+     a7c:	83 c4 10             	add    $0x10,%esp
+                exit();
+     a7f:	e8 5f 46 00 00       	call   50e3 <exit>
+        for(n = 0; n < 5; n++){
+     a84:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+     a88:	83 7d ec 04          	cmpl   $0x4,-0x14(%ebp)
+     a8c:	7e 94                	jle    a22 <pipe1+0x61>
+            }
+        }
+        exit();
+     a8e:	e8 50 46 00 00       	call   50e3 <exit>
+    } else if(pid > 0){
+     a93:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+     a97:	0f 8e f4 00 00 00    	jle    b91 <pipe1+0x1d0>
+        close(fds[1]);
+     a9d:	8b 45 dc             	mov    -0x24(%ebp),%eax
+     aa0:	83 ec 0c             	sub    $0xc,%esp
+     aa3:	50                   	push   %eax
+     aa4:	e8 63 46 00 00       	call   510c <close>
+     aa9:	83 c4 10             	add    $0x10,%esp
+        total = 0;
+     aac:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+        cc = 1;
+     ab3:	c7 45 e8 01 00 00 00 	movl   $0x1,-0x18(%ebp)
+        while((n = read(fds[0], buf, cc)) > 0){
+     aba:	eb 66                	jmp    b22 <pipe1+0x161>
+            for(i = 0; i < n; i++){
+     abc:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+     ac3:	eb 3b                	jmp    b00 <pipe1+0x13f>
+                if((buf[i] & 0xff) != (seq++ & 0xff)){
+     ac5:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     ac8:	05 a0 81 00 00       	add    $0x81a0,%eax
+     acd:	0f b6 00             	movzbl (%eax),%eax
+     ad0:	0f be c8             	movsbl %al,%ecx
+     ad3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     ad6:	8d 50 01             	lea    0x1(%eax),%edx
+     ad9:	89 55 f4             	mov    %edx,-0xc(%ebp)
+     adc:	31 c8                	xor    %ecx,%eax
+     ade:	0f b6 c0             	movzbl %al,%eax
+     ae1:	85 c0                	test   %eax,%eax
+     ae3:	74 17                	je     afc <pipe1+0x13b>
+                    printf(1, "pipe1 oops 2\n");
+     ae5:	83 ec 08             	sub    $0x8,%esp
+     ae8:	68 d7 5f 00 00       	push   $0x5fd7
+     aed:	6a 01                	push   $0x1
+     aef:	e8 ed 48 00 00       	call   53e1 <printf>
+     af4:	83 c4 10             	add    $0x10,%esp
+     af7:	e9 ac 00 00 00       	jmp    ba8 <pipe1+0x1e7>
+            for(i = 0; i < n; i++){
+     afc:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+     b00:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     b03:	3b 45 ec             	cmp    -0x14(%ebp),%eax
+     b06:	7c bd                	jl     ac5 <pipe1+0x104>
+                    return;
+                }
+            }
+            total += n;
+     b08:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     b0b:	01 45 e4             	add    %eax,-0x1c(%ebp)
+            cc = cc * 2;
+     b0e:	d1 65 e8             	shll   -0x18(%ebp)
+            if(cc > sizeof(buf))
+     b11:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     b14:	3d 00 20 00 00       	cmp    $0x2000,%eax
+     b19:	76 07                	jbe    b22 <pipe1+0x161>
+                cc = sizeof(buf);
+     b1b:	c7 45 e8 00 20 00 00 	movl   $0x2000,-0x18(%ebp)
+        while((n = read(fds[0], buf, cc)) > 0){
+     b22:	8b 45 d8             	mov    -0x28(%ebp),%eax
+     b25:	83 ec 04             	sub    $0x4,%esp
+     b28:	ff 75 e8             	push   -0x18(%ebp)
+     b2b:	68 a0 81 00 00       	push   $0x81a0
+     b30:	50                   	push   %eax
+     b31:	e8 c2 45 00 00       	call   50f8 <read>
+     b36:	83 c4 10             	add    $0x10,%esp
+     b39:	89 45 ec             	mov    %eax,-0x14(%ebp)
+     b3c:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+     b40:	0f 8f 76 ff ff ff    	jg     abc <pipe1+0xfb>
+        }
+        if(total != 5 * 1033){
+     b46:	81 7d e4 2d 14 00 00 	cmpl   $0x142d,-0x1c(%ebp)
+     b4d:	74 1a                	je     b69 <pipe1+0x1a8>
+            printf(1, "pipe1 oops 3 total %d\n", total);
+     b4f:	83 ec 04             	sub    $0x4,%esp
+     b52:	ff 75 e4             	push   -0x1c(%ebp)
+     b55:	68 e5 5f 00 00       	push   $0x5fe5
+     b5a:	6a 01                	push   $0x1
+     b5c:	e8 80 48 00 00       	call   53e1 <printf>
+     b61:	83 c4 10             	add    $0x10,%esp
+            exit();
+     b64:	e8 7a 45 00 00       	call   50e3 <exit>
+        }
+        close(fds[0]);
+     b69:	8b 45 d8             	mov    -0x28(%ebp),%eax
+     b6c:	83 ec 0c             	sub    $0xc,%esp
+     b6f:	50                   	push   %eax
+     b70:	e8 97 45 00 00       	call   510c <close>
+     b75:	83 c4 10             	add    $0x10,%esp
+        wait();
+     b78:	e8 6d 45 00 00       	call   50ea <wait>
+    } else {
+        printf(1, "fork() failed\n");
+        exit();
+    }
+    printf(1, "pipe1 ok\n");
+     b7d:	83 ec 08             	sub    $0x8,%esp
+     b80:	68 0b 60 00 00       	push   $0x600b
+     b85:	6a 01                	push   $0x1
+     b87:	e8 55 48 00 00       	call   53e1 <printf>
+     b8c:	83 c4 10             	add    $0x10,%esp
+     b8f:	eb 17                	jmp    ba8 <pipe1+0x1e7>
+        printf(1, "fork() failed\n");
+     b91:	83 ec 08             	sub    $0x8,%esp
+     b94:	68 fc 5f 00 00       	push   $0x5ffc
+     b99:	6a 01                	push   $0x1
+     b9b:	e8 41 48 00 00       	call   53e1 <printf>
+     ba0:	83 c4 10             	add    $0x10,%esp
+        exit();
+     ba3:	e8 3b 45 00 00       	call   50e3 <exit>
+}
+     ba8:	c9                   	leave
+     ba9:	c3                   	ret
+
+00000baa <preempt>:
+
+// meant to be run w/ at most two CPUs
+void
+preempt(void)
+{
+     baa:	55                   	push   %ebp
+     bab:	89 e5                	mov    %esp,%ebp
+     bad:	83 ec 28             	sub    $0x28,%esp
+    int pid1, pid2, pid3;
+    int pfds[2];
+
+    printf(1, "preempt: ");
+     bb0:	83 ec 08             	sub    $0x8,%esp
+     bb3:	68 15 60 00 00       	push   $0x6015
+     bb8:	6a 01                	push   $0x1
+     bba:	e8 22 48 00 00       	call   53e1 <printf>
+     bbf:	83 c4 10             	add    $0x10,%esp
+    pid1 = fork();
+     bc2:	e8 15 45 00 00       	call   50dc <fork>
+     bc7:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(pid1 == 0)
+     bca:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     bce:	75 03                	jne    bd3 <preempt+0x29>
+        for(;;)
+     bd0:	90                   	nop
+     bd1:	eb fd                	jmp    bd0 <preempt+0x26>
+            ;
+
+    pid2 = fork();
+     bd3:	e8 04 45 00 00       	call   50dc <fork>
+     bd8:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(pid2 == 0)
+     bdb:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+     bdf:	75 03                	jne    be4 <preempt+0x3a>
+        for(;;)
+     be1:	90                   	nop
+     be2:	eb fd                	jmp    be1 <preempt+0x37>
+            ;
+
+    pipe(pfds);
+     be4:	83 ec 0c             	sub    $0xc,%esp
+     be7:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+     bea:	50                   	push   %eax
+     beb:	e8 01 45 00 00       	call   50f1 <pipe>
+     bf0:	83 c4 10             	add    $0x10,%esp
+    pid3 = fork();
+     bf3:	e8 e4 44 00 00       	call   50dc <fork>
+     bf8:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    if(pid3 == 0){
+     bfb:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+     bff:	75 4e                	jne    c4f <preempt+0xa5>
+        close(pfds[0]);
+     c01:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     c04:	83 ec 0c             	sub    $0xc,%esp
+     c07:	50                   	push   %eax
+     c08:	e8 ff 44 00 00       	call   510c <close>
+     c0d:	83 c4 10             	add    $0x10,%esp
+        if(write(pfds[1], "x", 1) != 1)
+     c10:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     c13:	83 ec 04             	sub    $0x4,%esp
+     c16:	6a 01                	push   $0x1
+     c18:	68 1f 60 00 00       	push   $0x601f
+     c1d:	50                   	push   %eax
+     c1e:	e8 df 44 00 00       	call   5102 <write>
+     c23:	83 c4 10             	add    $0x10,%esp
+     c26:	83 f8 01             	cmp    $0x1,%eax
+     c29:	74 12                	je     c3d <preempt+0x93>
+            printf(1, "preempt write error");
+     c2b:	83 ec 08             	sub    $0x8,%esp
+     c2e:	68 21 60 00 00       	push   $0x6021
+     c33:	6a 01                	push   $0x1
+     c35:	e8 a7 47 00 00       	call   53e1 <printf>
+     c3a:	83 c4 10             	add    $0x10,%esp
+        close(pfds[1]);
+     c3d:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     c40:	83 ec 0c             	sub    $0xc,%esp
+     c43:	50                   	push   %eax
+     c44:	e8 c3 44 00 00       	call   510c <close>
+     c49:	83 c4 10             	add    $0x10,%esp
+        for(;;)
+     c4c:	90                   	nop
+     c4d:	eb fd                	jmp    c4c <preempt+0xa2>
+            ;
+    }
+
+    close(pfds[1]);
+     c4f:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     c52:	83 ec 0c             	sub    $0xc,%esp
+     c55:	50                   	push   %eax
+     c56:	e8 b1 44 00 00       	call   510c <close>
+     c5b:	83 c4 10             	add    $0x10,%esp
+    if(read(pfds[0], buf, sizeof(buf)) != 1){
+     c5e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     c61:	83 ec 04             	sub    $0x4,%esp
+     c64:	68 00 20 00 00       	push   $0x2000
+     c69:	68 a0 81 00 00       	push   $0x81a0
+     c6e:	50                   	push   %eax
+     c6f:	e8 84 44 00 00       	call   50f8 <read>
+     c74:	83 c4 10             	add    $0x10,%esp
+     c77:	83 f8 01             	cmp    $0x1,%eax
+     c7a:	74 14                	je     c90 <preempt+0xe6>
+        printf(1, "preempt read error");
+     c7c:	83 ec 08             	sub    $0x8,%esp
+     c7f:	68 35 60 00 00       	push   $0x6035
+     c84:	6a 01                	push   $0x1
+     c86:	e8 56 47 00 00       	call   53e1 <printf>
+     c8b:	83 c4 10             	add    $0x10,%esp
+     c8e:	eb 7e                	jmp    d0e <preempt+0x164>
+        return;
+    }
+    close(pfds[0]);
+     c90:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     c93:	83 ec 0c             	sub    $0xc,%esp
+     c96:	50                   	push   %eax
+     c97:	e8 70 44 00 00       	call   510c <close>
+     c9c:	83 c4 10             	add    $0x10,%esp
+    printf(1, "kill... ");
+     c9f:	83 ec 08             	sub    $0x8,%esp
+     ca2:	68 48 60 00 00       	push   $0x6048
+     ca7:	6a 01                	push   $0x1
+     ca9:	e8 33 47 00 00       	call   53e1 <printf>
+     cae:	83 c4 10             	add    $0x10,%esp
+    kill(pid1);
+     cb1:	83 ec 0c             	sub    $0xc,%esp
+     cb4:	ff 75 f4             	push   -0xc(%ebp)
+     cb7:	e8 5a 44 00 00       	call   5116 <kill>
+     cbc:	83 c4 10             	add    $0x10,%esp
+    kill(pid2);
+     cbf:	83 ec 0c             	sub    $0xc,%esp
+     cc2:	ff 75 f0             	push   -0x10(%ebp)
+     cc5:	e8 4c 44 00 00       	call   5116 <kill>
+     cca:	83 c4 10             	add    $0x10,%esp
+    kill(pid3);
+     ccd:	83 ec 0c             	sub    $0xc,%esp
+     cd0:	ff 75 ec             	push   -0x14(%ebp)
+     cd3:	e8 3e 44 00 00       	call   5116 <kill>
+     cd8:	83 c4 10             	add    $0x10,%esp
+    printf(1, "wait... ");
+     cdb:	83 ec 08             	sub    $0x8,%esp
+     cde:	68 51 60 00 00       	push   $0x6051
+     ce3:	6a 01                	push   $0x1
+     ce5:	e8 f7 46 00 00       	call   53e1 <printf>
+     cea:	83 c4 10             	add    $0x10,%esp
+    wait();
+     ced:	e8 f8 43 00 00       	call   50ea <wait>
+    wait();
+     cf2:	e8 f3 43 00 00       	call   50ea <wait>
+    wait();
+     cf7:	e8 ee 43 00 00       	call   50ea <wait>
+    printf(1, "preempt ok\n");
+     cfc:	83 ec 08             	sub    $0x8,%esp
+     cff:	68 5a 60 00 00       	push   $0x605a
+     d04:	6a 01                	push   $0x1
+     d06:	e8 d6 46 00 00       	call   53e1 <printf>
+     d0b:	83 c4 10             	add    $0x10,%esp
+}
+     d0e:	c9                   	leave
+     d0f:	c3                   	ret
+
+00000d10 <exitwait>:
+
+// try to find any races between exit and wait
+void
+exitwait(void)
+{
+     d10:	55                   	push   %ebp
+     d11:	89 e5                	mov    %esp,%ebp
+     d13:	83 ec 18             	sub    $0x18,%esp
+    int i, pid;
+
+    for(i = 0; i < 100; i++){
+     d16:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     d1d:	eb 4f                	jmp    d6e <exitwait+0x5e>
+        pid = fork();
+     d1f:	e8 b8 43 00 00       	call   50dc <fork>
+     d24:	89 45 f0             	mov    %eax,-0x10(%ebp)
+        if(pid < 0){
+     d27:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+     d2b:	79 14                	jns    d41 <exitwait+0x31>
+            printf(1, "fork failed\n");
+     d2d:	83 ec 08             	sub    $0x8,%esp
+     d30:	68 e9 5b 00 00       	push   $0x5be9
+     d35:	6a 01                	push   $0x1
+     d37:	e8 a5 46 00 00       	call   53e1 <printf>
+     d3c:	83 c4 10             	add    $0x10,%esp
+            return;
+     d3f:	eb 45                	jmp    d86 <exitwait+0x76>
+        }
+        if(pid){
+     d41:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+     d45:	74 1e                	je     d65 <exitwait+0x55>
+            if(wait() != pid){
+     d47:	e8 9e 43 00 00       	call   50ea <wait>
+     d4c:	39 45 f0             	cmp    %eax,-0x10(%ebp)
+     d4f:	74 19                	je     d6a <exitwait+0x5a>
+                printf(1, "wait wrong pid\n");
+     d51:	83 ec 08             	sub    $0x8,%esp
+     d54:	68 66 60 00 00       	push   $0x6066
+     d59:	6a 01                	push   $0x1
+     d5b:	e8 81 46 00 00       	call   53e1 <printf>
+     d60:	83 c4 10             	add    $0x10,%esp
+                return;
+     d63:	eb 21                	jmp    d86 <exitwait+0x76>
+            }
+        } else {
+            exit();
+     d65:	e8 79 43 00 00       	call   50e3 <exit>
+    for(i = 0; i < 100; i++){
+     d6a:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+     d6e:	83 7d f4 63          	cmpl   $0x63,-0xc(%ebp)
+     d72:	7e ab                	jle    d1f <exitwait+0xf>
+        }
+    }
+    printf(1, "exitwait ok\n");
+     d74:	83 ec 08             	sub    $0x8,%esp
+     d77:	68 76 60 00 00       	push   $0x6076
+     d7c:	6a 01                	push   $0x1
+     d7e:	e8 5e 46 00 00       	call   53e1 <printf>
+     d83:	83 c4 10             	add    $0x10,%esp
+}
+     d86:	c9                   	leave
+     d87:	c3                   	ret
+
+00000d88 <nanosleeptest>:
+
+// nanosleep must sleep at least as long as asked, even for
+// less than a tick, and clock_gettime must see the time pass.
+void
+nanosleeptest(void)
+{
+     d88:	55                   	push   %ebp
+     d89:	89 e5                	mov    %esp,%ebp
+     d8b:	53                   	push   %ebx
+     d8c:	83 ec 24             	sub    $0x24,%esp
+    struct timespec req, t0, t1;
+    int i, us;
+
+    printf(stdout, "nanosleep test\n");
+     d8f:	a1 6c 81 00 00       	mov    0x816c,%eax
+     d94:	83 ec 08             	sub    $0x8,%esp
+     d97:	68 83 60 00 00       	push   $0x6083
+     d9c:	50                   	push   %eax
+     d9d:	e8 3f 46 00 00       	call   53e1 <printf>
+     da2:	83 c4 10             	add    $0x10,%esp
+    req.tv_sec = 0;
+     da5:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+    req.tv_nsec = 500000;
+     dac:	c7 45 ec 20 a1 07 00 	movl   $0x7a120,-0x14(%ebp)
+    for(i = 0; i < 10; i++){
+     db3:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     dba:	e9 cd 00 00 00       	jmp    e8c <nanosleeptest+0x104>
+        if(clock_gettime(CLOCK_MONOTONIC, &t0) < 0){
+     dbf:	83 ec 08             	sub    $0x8,%esp
+     dc2:	8d 45 e0             	lea    -0x20(%ebp),%eax
+     dc5:	50                   	push   %eax
+     dc6:	6a 01                	push   $0x1
+     dc8:	e8 4d 44 00 00       	call   521a <clock_gettime>
+     dcd:	83 c4 10             	add    $0x10,%esp
+     dd0:	85 c0                	test   %eax,%eax
+     dd2:	79 1b                	jns    def <nanosleeptest+0x67>
+            printf(stdout, "clock_gettime failed\n");
+     dd4:	a1 6c 81 00 00       	mov    0x816c,%eax
+     dd9:	83 ec 08             	sub    $0x8,%esp
+     ddc:	68 93 60 00 00       	push   $0x6093
+     de1:	50                   	push   %eax
+     de2:	e8 fa 45 00 00       	call   53e1 <printf>
+     de7:	83 c4 10             	add    $0x10,%esp
+            exit();
+     dea:	e8 f4 42 00 00       	call   50e3 <exit>
+        }
+        if(nanosleep(&req, 0) < 0){
+     def:	83 ec 08             	sub    $0x8,%esp
+     df2:	6a 00                	push   $0x0
+     df4:	8d 45 e8             	lea    -0x18(%ebp),%eax
+     df7:	50                   	push   %eax
+     df8:	e8 09 44 00 00       	call   5206 <nanosleep>
+     dfd:	83 c4 10             	add    $0x10,%esp
+     e00:	85 c0                	test   %eax,%eax
+     e02:	79 1b                	jns    e1f <nanosleeptest+0x97>
+            printf(stdout, "nanosleep failed\n");
+     e04:	a1 6c 81 00 00       	mov    0x816c,%eax
+     e09:	83 ec 08             	sub    $0x8,%esp
+     e0c:	68 a9 60 00 00       	push   $0x60a9
+     e11:	50                   	push   %eax
+     e12:	e8 ca 45 00 00       	call   53e1 <printf>
+     e17:	83 c4 10             	add    $0x10,%esp
+            exit();
+     e1a:	e8 c4 42 00 00       	call   50e3 <exit>
+        }
+        clock_gettime(CLOCK_MONOTONIC, &t1);
+     e1f:	83 ec 08             	sub    $0x8,%esp
+     e22:	8d 45 d8             	lea    -0x28(%ebp),%eax
+     e25:	50                   	push   %eax
+     e26:	6a 01                	push   $0x1
+     e28:	e8 ed 43 00 00       	call   521a <clock_gettime>
+     e2d:	83 c4 10             	add    $0x10,%esp
+        us = (t1.tv_sec - t0.tv_sec) * 1000000 + (t1.tv_nsec - t0.tv_nsec) / 1000;
+     e30:	8b 55 d8             	mov    -0x28(%ebp),%edx
+     e33:	8b 45 e0             	mov    -0x20(%ebp),%eax
+     e36:	29 c2                	sub    %eax,%edx
+     e38:	69 da 40 42 0f 00    	imul   $0xf4240,%edx,%ebx
+     e3e:	8b 55 dc             	mov    -0x24(%ebp),%edx
+     e41:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     e44:	89 d1                	mov    %edx,%ecx
+     e46:	29 c1                	sub    %eax,%ecx
+     e48:	ba d3 4d 62 10       	mov    $0x10624dd3,%edx
+     e4d:	89 c8                	mov    %ecx,%eax
+     e4f:	f7 ea                	imul   %edx
+     e51:	c1 fa 06             	sar    $0x6,%edx
+     e54:	89 c8                	mov    %ecx,%eax
+     e56:	c1 f8 1f             	sar    $0x1f,%eax
+     e59:	29 c2                	sub    %eax,%edx
+     e5b:	8d 04 13             	lea    (%ebx,%edx,1),%eax
+     e5e:	89 45 f0             	mov    %eax,-0x10(%ebp)
+        if(us < 500){
+     e61:	81 7d f0 f3 01 00 00 	cmpl   $0x1f3,-0x10(%ebp)
+     e68:	7f 1e                	jg     e88 <nanosleeptest+0x100>
+            printf(stdout, "nanosleep woke after %d us\n", us);
+     e6a:	a1 6c 81 00 00       	mov    0x816c,%eax
+     e6f:	83 ec 04             	sub    $0x4,%esp
+     e72:	ff 75 f0             	push   -0x10(%ebp)
+     e75:	68 bb 60 00 00       	push   $0x60bb
+     e7a:	50                   	push   %eax
+     e7b:	e8 61 45 00 00       	call   53e1 <printf>
+     e80:	83 c4 10             	add    $0x10,%esp
+            exit();
+     e83:	e8 5b 42 00 00       	call   50e3 <exit>
+    for(i = 0; i < 10; i++){
+     e88:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+     e8c:	83 7d f4 09          	cmpl   $0x9,-0xc(%ebp)
+     e90:	0f 8e 29 ff ff ff    	jle    dbf <nanosleeptest+0x37>
+        }
+    }
+    req.tv_nsec = 1000000000;
+     e96:	c7 45 ec 00 ca 9a 3b 	movl   $0x3b9aca00,-0x14(%ebp)
+    if(nanosleep(&req, 0) >= 0){
+     e9d:	83 ec 08             	sub    $0x8,%esp
+     ea0:	6a 00                	push   $0x0
+     ea2:	8d 45 e8             	lea    -0x18(%ebp),%eax
+     ea5:	50                   	push   %eax
+     ea6:	e8 5b 43 00 00       	call   5206 <nanosleep>
+     eab:	83 c4 10             	add    $0x10,%esp
+     eae:	85 c0                	test   %eax,%eax
+     eb0:	78 1b                	js     ecd <nanosleeptest+0x145>
+        printf(stdout, "nanosleep accepted tv_nsec of 1s\n");
+     eb2:	a1 6c 81 00 00       	mov    0x816c,%eax
+     eb7:	83 ec 08             	sub    $0x8,%esp
+     eba:	68 d8 60 00 00       	push   $0x60d8
+     ebf:	50                   	push   %eax
+     ec0:	e8 1c 45 00 00       	call   53e1 <printf>
+     ec5:	83 c4 10             	add    $0x10,%esp
+        exit();
+     ec8:	e8 16 42 00 00       	call   50e3 <exit>
+    }
+    printf(stdout, "nanosleep ok\n");
+     ecd:	a1 6c 81 00 00       	mov    0x816c,%eax
+     ed2:	83 ec 08             	sub    $0x8,%esp
+     ed5:	68 fa 60 00 00       	push   $0x60fa
+     eda:	50                   	push   %eax
+     edb:	e8 01 45 00 00       	call   53e1 <printf>
+     ee0:	83 c4 10             	add    $0x10,%esp
+}
+     ee3:	90                   	nop
+     ee4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     ee7:	c9                   	leave
+     ee8:	c3                   	ret
+
+00000ee9 <rttest>:
+// A real-time process spinning on a cpu must not shut out the
+// normal processes there: once it has had most of a window the cpu
+// is throttled, so the parent, pinned to the same cpu, still runs.
+void
+rttest(void)
+{
+     ee9:	55                   	push   %ebp
+     eea:	89 e5                	mov    %esp,%ebp
+     eec:	83 ec 18             	sub    $0x18,%esp
+    int pid;
+
+    printf(stdout, "rt test\n");
+     eef:	a1 6c 81 00 00       	mov    0x816c,%eax
+     ef4:	83 ec 08             	sub    $0x8,%esp
+     ef7:	68 08 61 00 00       	push   $0x6108
+     efc:	50                   	push   %eax
+     efd:	e8 df 44 00 00       	call   53e1 <printf>
+     f02:	83 c4 10             	add    $0x10,%esp
+    if(sched_setscheduler(0, SCHED_FIFO, 0) >= 0 ||
+     f05:	83 ec 04             	sub    $0x4,%esp
+     f08:	6a 00                	push   $0x0
+     f0a:	6a 01                	push   $0x1
+     f0c:	6a 00                	push   $0x0
+     f0e:	e8 4d 43 00 00       	call   5260 <sched_setscheduler>
+     f13:	83 c4 10             	add    $0x10,%esp
+     f16:	85 c0                	test   %eax,%eax
+     f18:	79 15                	jns    f2f <rttest+0x46>
+       sched_setscheduler(0, SCHED_FIFO, SCHED_PRIOMAX+1) >= 0){
+     f1a:	83 ec 04             	sub    $0x4,%esp
+     f1d:	6a 64                	push   $0x64
+     f1f:	6a 01                	push   $0x1
+     f21:	6a 00                	push   $0x0
+     f23:	e8 38 43 00 00       	call   5260 <sched_setscheduler>
+     f28:	83 c4 10             	add    $0x10,%esp
+    if(sched_setscheduler(0, SCHED_FIFO, 0) >= 0 ||
+     f2b:	85 c0                	test   %eax,%eax
+     f2d:	78 1b                	js     f4a <rttest+0x61>
+        printf(stdout, "sched_setscheduler accepted a bad priority\n");
+     f2f:	a1 6c 81 00 00       	mov    0x816c,%eax
+     f34:	83 ec 08             	sub    $0x8,%esp
+     f37:	68 14 61 00 00       	push   $0x6114
+     f3c:	50                   	push   %eax
+     f3d:	e8 9f 44 00 00       	call   53e1 <printf>
+     f42:	83 c4 10             	add    $0x10,%esp
+        exit();
+     f45:	e8 99 41 00 00       	call   50e3 <exit>
+    }
+    sched_setaffinity(0, 1);
+     f4a:	83 ec 08             	sub    $0x8,%esp
+     f4d:	6a 01                	push   $0x1
+     f4f:	6a 00                	push   $0x0
+     f51:	e8 ce 42 00 00       	call   5224 <sched_setaffinity>
+     f56:	83 c4 10             	add    $0x10,%esp
+    pid = fork();
+     f59:	e8 7e 41 00 00       	call   50dc <fork>
+     f5e:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(pid < 0){
+     f61:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     f65:	79 1b                	jns    f82 <rttest+0x99>
+        printf(stdout, "fork failed\n");
+     f67:	a1 6c 81 00 00       	mov    0x816c,%eax
+     f6c:	83 ec 08             	sub    $0x8,%esp
+     f6f:	68 e9 5b 00 00       	push   $0x5be9
+     f74:	50                   	push   %eax
+     f75:	e8 67 44 00 00       	call   53e1 <printf>
+     f7a:	83 c4 10             	add    $0x10,%esp
+        exit();
+     f7d:	e8 61 41 00 00       	call   50e3 <exit>
+    }
+    if(pid == 0){
+     f82:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     f86:	75 56                	jne    fde <rttest+0xf5>
+        if(sched_setscheduler(0, SCHED_FIFO, 1) < 0 ||
+     f88:	83 ec 04             	sub    $0x4,%esp
+     f8b:	6a 01                	push   $0x1
+     f8d:	6a 01                	push   $0x1
+     f8f:	6a 00                	push   $0x0
+     f91:	e8 ca 42 00 00       	call   5260 <sched_setscheduler>
+     f96:	83 c4 10             	add    $0x10,%esp
+     f99:	85 c0                	test   %eax,%eax
+     f9b:	78 24                	js     fc1 <rttest+0xd8>
+           sched_getscheduler(0) != SCHED_FIFO || sched_getparam(0) != 1){
+     f9d:	83 ec 0c             	sub    $0xc,%esp
+     fa0:	6a 00                	push   $0x0
+     fa2:	e8 c3 42 00 00       	call   526a <sched_getscheduler>
+     fa7:	83 c4 10             	add    $0x10,%esp
+        if(sched_setscheduler(0, SCHED_FIFO, 1) < 0 ||
+     faa:	83 f8 01             	cmp    $0x1,%eax
+     fad:	75 12                	jne    fc1 <rttest+0xd8>
+           sched_getscheduler(0) != SCHED_FIFO || sched_getparam(0) != 1){
+     faf:	83 ec 0c             	sub    $0xc,%esp
+     fb2:	6a 00                	push   $0x0
+     fb4:	e8 bb 42 00 00       	call   5274 <sched_getparam>
+     fb9:	83 c4 10             	add    $0x10,%esp
+     fbc:	83 f8 01             	cmp    $0x1,%eax
+     fbf:	74 1b                	je     fdc <rttest+0xf3>
+            printf(stdout, "sched_setscheduler failed\n");
+     fc1:	a1 6c 81 00 00       	mov    0x816c,%eax
+     fc6:	83 ec 08             	sub    $0x8,%esp
+     fc9:	68 40 61 00 00       	push   $0x6140
+     fce:	50                   	push   %eax
+     fcf:	e8 0d 44 00 00       	call   53e1 <printf>
+     fd4:	83 c4 10             	add    $0x10,%esp
+            exit();
+     fd7:	e8 07 41 00 00       	call   50e3 <exit>
+        }
+        for(;;)
+     fdc:	eb fe                	jmp    fdc <rttest+0xf3>
+            ;
+    }
+    sleep(10);
+     fde:	83 ec 0c             	sub    $0xc,%esp
+     fe1:	6a 0a                	push   $0xa
+     fe3:	e8 a6 41 00 00       	call   518e <sleep>
+     fe8:	83 c4 10             	add    $0x10,%esp
+    kill(pid);
+     feb:	83 ec 0c             	sub    $0xc,%esp
+     fee:	ff 75 f4             	push   -0xc(%ebp)
+     ff1:	e8 20 41 00 00       	call   5116 <kill>
+     ff6:	83 c4 10             	add    $0x10,%esp
+    wait();
+     ff9:	e8 ec 40 00 00       	call   50ea <wait>
+    sched_setaffinity(0, ~0);
+     ffe:	83 ec 08             	sub    $0x8,%esp
+    1001:	6a ff                	push   $0xffffffff
+    1003:	6a 00                	push   $0x0
+    1005:	e8 1a 42 00 00       	call   5224 <sched_setaffinity>
+    100a:	83 c4 10             	add    $0x10,%esp
+    if(sched_getscheduler(0) != SCHED_OTHER){
+    100d:	83 ec 0c             	sub    $0xc,%esp
+    1010:	6a 00                	push   $0x0
+    1012:	e8 53 42 00 00       	call   526a <sched_getscheduler>
+    1017:	83 c4 10             	add    $0x10,%esp
+    101a:	85 c0                	test   %eax,%eax
+    101c:	74 1b                	je     1039 <rttest+0x150>
+        printf(stdout, "parent became real-time\n");
+    101e:	a1 6c 81 00 00       	mov    0x816c,%eax
+    1023:	83 ec 08             	sub    $0x8,%esp
+    1026:	68 5b 61 00 00       	push   $0x615b
+    102b:	50                   	push   %eax
+    102c:	e8 b0 43 00 00       	call   53e1 <printf>
+    1031:	83 c4 10             	add    $0x10,%esp
+        exit();
+    1034:	e8 aa 40 00 00       	call   50e3 <exit>
+    }
+    printf(stdout, "rt ok\n");
+    1039:	a1 6c 81 00 00       	mov    0x816c,%eax
+    103e:	83 ec 08             	sub    $0x8,%esp
+    1041:	68 74 61 00 00       	push   $0x6174
+    1046:	50                   	push   %eax
+    1047:	e8 95 43 00 00       	call   53e1 <printf>
+    104c:	83 c4 10             	add    $0x10,%esp
+}
+    104f:	90                   	nop
+    1050:	c9                   	leave
+    1051:	c3                   	ret
+
+00001052 <vectortest>:
+// writev gathers buffers into one write and readv scatters them
+// back; pread and pwrite use their own offset and leave the
+// descriptor's alone.
+void
+vectortest(void)
+{
+    1052:	55                   	push   %ebp
+    1053:	89 e5                	mov    %esp,%ebp
+    1055:	53                   	push   %ebx
+    1056:	83 ec 44             	sub    $0x44,%esp
+    static char big[3000];
+    char hdr[4], tail[8], got[8];
+    struct iovec iov[3];
+    int fd, fds[2], i;
+
+    printf(stdout, "vector test\n");
+    1059:	a1 6c 81 00 00       	mov    0x816c,%eax
+    105e:	83 ec 08             	sub    $0x8,%esp
+    1061:	68 7b 61 00 00       	push   $0x617b
+    1066:	50                   	push   %eax
+    1067:	e8 75 43 00 00       	call   53e1 <printf>
+    106c:	83 c4 10             	add    $0x10,%esp
+    for(i = 0; i < sizeof(big); i++)
+    106f:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    1076:	eb 33                	jmp    10ab <vectortest+0x59>
+        big[i] = i % 251;
+    1078:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+    107b:	ba bf bf 8c 82       	mov    $0x828cbfbf,%edx
+    1080:	89 c8                	mov    %ecx,%eax
+    1082:	f7 ea                	imul   %edx
+    1084:	8d 04 0a             	lea    (%edx,%ecx,1),%eax
+    1087:	c1 f8 07             	sar    $0x7,%eax
+    108a:	89 ca                	mov    %ecx,%edx
+    108c:	c1 fa 1f             	sar    $0x1f,%edx
+    108f:	29 d0                	sub    %edx,%eax
+    1091:	69 d0 fb 00 00 00    	imul   $0xfb,%eax,%edx
+    1097:	89 c8                	mov    %ecx,%eax
+    1099:	29 d0                	sub    %edx,%eax
+    109b:	89 c2                	mov    %eax,%edx
+    109d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    10a0:	05 e0 c8 00 00       	add    $0xc8e0,%eax
+    10a5:	88 10                	mov    %dl,(%eax)
+    for(i = 0; i < sizeof(big); i++)
+    10a7:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    10ab:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    10ae:	3d b7 0b 00 00       	cmp    $0xbb7,%eax
+    10b3:	76 c3                	jbe    1078 <vectortest+0x26>
+    memmove(hdr, "HDR", 4);
+    10b5:	83 ec 04             	sub    $0x4,%esp
+    10b8:	6a 04                	push   $0x4
+    10ba:	68 88 61 00 00       	push   $0x6188
+    10bf:	8d 45 ec             	lea    -0x14(%ebp),%eax
+    10c2:	50                   	push   %eax
+    10c3:	e8 78 3f 00 00       	call   5040 <memmove>
+    10c8:	83 c4 10             	add    $0x10,%esp
+    memmove(tail, "TAILTAI", 8);
+    10cb:	83 ec 04             	sub    $0x4,%esp
+    10ce:	6a 08                	push   $0x8
+    10d0:	68 8c 61 00 00       	push   $0x618c
+    10d5:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+    10d8:	50                   	push   %eax
+    10d9:	e8 62 3f 00 00       	call   5040 <memmove>
+    10de:	83 c4 10             	add    $0x10,%esp
+
+    fd = open("vecfile", O_CREATE|O_RDWR);
+    10e1:	83 ec 08             	sub    $0x8,%esp
+    10e4:	68 02 02 00 00       	push   $0x202
+    10e9:	68 94 61 00 00       	push   $0x6194
+    10ee:	e8 37 40 00 00       	call   512a <open>
+    10f3:	83 c4 10             	add    $0x10,%esp
+    10f6:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(fd < 0){
+    10f9:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    10fd:	79 1b                	jns    111a <vectortest+0xc8>
+        printf(stdout, "create vecfile failed\n");
+    10ff:	a1 6c 81 00 00       	mov    0x816c,%eax
+    1104:	83 ec 08             	sub    $0x8,%esp
+    1107:	68 9c 61 00 00       	push   $0x619c
+    110c:	50                   	push   %eax
+    110d:	e8 cf 42 00 00       	call   53e1 <printf>
+    1112:	83 c4 10             	add    $0x10,%esp
+        exit();
+    1115:	e8 c9 3f 00 00       	call   50e3 <exit>
+    }
+    iov[0].iov_base = hdr;
+    111a:	8d 45 ec             	lea    -0x14(%ebp),%eax
+    111d:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+    iov[0].iov_len = sizeof(hdr);
+    1120:	c7 45 c8 04 00 00 00 	movl   $0x4,-0x38(%ebp)
+    iov[1].iov_base = big;
+    1127:	c7 45 cc e0 c8 00 00 	movl   $0xc8e0,-0x34(%ebp)
+    iov[1].iov_len = sizeof(big);
+    112e:	c7 45 d0 b8 0b 00 00 	movl   $0xbb8,-0x30(%ebp)
+    iov[2].iov_base = tail;
+    1135:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+    1138:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+    iov[2].iov_len = sizeof(tail);
+    113b:	c7 45 d8 08 00 00 00 	movl   $0x8,-0x28(%ebp)
+    if(writev(fd, iov, 3) != sizeof(hdr) + sizeof(big) + sizeof(tail)){
+    1142:	83 ec 04             	sub    $0x4,%esp
+    1145:	6a 03                	push   $0x3
+    1147:	8d 45 c4             	lea    -0x3c(%ebp),%eax
+    114a:	50                   	push   %eax
+    114b:	ff 75 f0             	push   -0x10(%ebp)
+    114e:	e8 53 41 00 00       	call   52a6 <writev>
+    1153:	83 c4 10             	add    $0x10,%esp
+    1156:	3d c4 0b 00 00       	cmp    $0xbc4,%eax
+    115b:	74 1b                	je     1178 <vectortest+0x126>
+        printf(stdout, "writev failed\n");
+    115d:	a1 6c 81 00 00       	mov    0x816c,%eax
+    1162:	83 ec 08             	sub    $0x8,%esp
+    1165:	68 b3 61 00 00       	push   $0x61b3
+    116a:	50                   	push   %eax
+    116b:	e8 71 42 00 00       	call   53e1 <printf>
+    1170:	83 c4 10             	add    $0x10,%esp
+        exit();
+    1173:	e8 6b 3f 00 00       	call   50e3 <exit>
+    }
+    if(writev(fd, iov, IOV_MAX+1) >= 0){
+    1178:	83 ec 04             	sub    $0x4,%esp
+    117b:	6a 11                	push   $0x11
+    117d:	8d 45 c4             	lea    -0x3c(%ebp),%eax
+    1180:	50                   	push   %eax
+    1181:	ff 75 f0             	push   -0x10(%ebp)
+    1184:	e8 1d 41 00 00       	call   52a6 <writev>
+    1189:	83 c4 10             	add    $0x10,%esp
+    118c:	85 c0                	test   %eax,%eax
+    118e:	78 1b                	js     11ab <vectortest+0x159>
+        printf(stdout, "writev took too many buffers\n");
+    1190:	a1 6c 81 00 00       	mov    0x816c,%eax
+    1195:	83 ec 08             	sub    $0x8,%esp
+    1198:	68 c2 61 00 00       	push   $0x61c2
+    119d:	50                   	push   %eax
+    119e:	e8 3e 42 00 00       	call   53e1 <printf>
+    11a3:	83 c4 10             	add    $0x10,%esp
+        exit();
+    11a6:	e8 38 3f 00 00       	call   50e3 <exit>
+    }
+
+    // Overwrite the header in place, then read the tail by offset.
+    if(pwrite(fd, "hdr", 4, 0) != 4 ||
+    11ab:	6a 00                	push   $0x0
+    11ad:	6a 04                	push   $0x4
+    11af:	68 e0 61 00 00       	push   $0x61e0
+    11b4:	ff 75 f0             	push   -0x10(%ebp)
+    11b7:	e8 fe 40 00 00       	call   52ba <pwrite>
+    11bc:	83 c4 10             	add    $0x10,%esp
+    11bf:	83 f8 04             	cmp    $0x4,%eax
+    11c2:	75 33                	jne    11f7 <vectortest+0x1a5>
+       pread(fd, got, sizeof(got), sizeof(hdr) + sizeof(big)) != sizeof(got) ||
+    11c4:	68 bc 0b 00 00       	push   $0xbbc
+    11c9:	6a 08                	push   $0x8
+    11cb:	8d 45 dc             	lea    -0x24(%ebp),%eax
+    11ce:	50                   	push   %eax
+    11cf:	ff 75 f0             	push   -0x10(%ebp)
+    11d2:	e8 d9 40 00 00       	call   52b0 <pread>
+    11d7:	83 c4 10             	add    $0x10,%esp
+    if(pwrite(fd, "hdr", 4, 0) != 4 ||
+    11da:	83 f8 08             	cmp    $0x8,%eax
+    11dd:	75 18                	jne    11f7 <vectortest+0x1a5>
+       strcmp(got, "TAILTAI") != 0){
+    11df:	83 ec 08             	sub    $0x8,%esp
+    11e2:	68 8c 61 00 00       	push   $0x618c
+    11e7:	8d 45 dc             	lea    -0x24(%ebp),%eax
+    11ea:	50                   	push   %eax
+    11eb:	e8 3f 3c 00 00       	call   4e2f <strcmp>
+    11f0:	83 c4 10             	add    $0x10,%esp
+       pread(fd, got, sizeof(got), sizeof(hdr) + sizeof(big)) != sizeof(got) ||
+    11f3:	85 c0                	test   %eax,%eax
+    11f5:	74 1b                	je     1212 <vectortest+0x1c0>
+        printf(stdout, "pread/pwrite failed\n");
+    11f7:	a1 6c 81 00 00       	mov    0x816c,%eax
+    11fc:	83 ec 08             	sub    $0x8,%esp
+    11ff:	68 e4 61 00 00       	push   $0x61e4
+    1204:	50                   	push   %eax
+    1205:	e8 d7 41 00 00       	call   53e1 <printf>
+    120a:	83 c4 10             	add    $0x10,%esp
+        exit();
+    120d:	e8 d1 3e 00 00       	call   50e3 <exit>
+    }
+    // The offset is still at the end of the writev.
+    if(read(fd, got, 1) != 0){
+    1212:	83 ec 04             	sub    $0x4,%esp
+    1215:	6a 01                	push   $0x1
+    1217:	8d 45 dc             	lea    -0x24(%ebp),%eax
+    121a:	50                   	push   %eax
+    121b:	ff 75 f0             	push   -0x10(%ebp)
+    121e:	e8 d5 3e 00 00       	call   50f8 <read>
+    1223:	83 c4 10             	add    $0x10,%esp
+    1226:	85 c0                	test   %eax,%eax
+    1228:	74 1b                	je     1245 <vectortest+0x1f3>
+        printf(stdout, "pread/pwrite moved the offset\n");
+    122a:	a1 6c 81 00 00       	mov    0x816c,%eax
+    122f:	83 ec 08             	sub    $0x8,%esp
+    1232:	68 fc 61 00 00       	push   $0x61fc
+    1237:	50                   	push   %eax
+    1238:	e8 a4 41 00 00       	call   53e1 <printf>
+    123d:	83 c4 10             	add    $0x10,%esp
+        exit();
+    1240:	e8 9e 3e 00 00       	call   50e3 <exit>
+    }
+    close(fd);
+    1245:	83 ec 0c             	sub    $0xc,%esp
+    1248:	ff 75 f0             	push   -0x10(%ebp)
+    124b:	e8 bc 3e 00 00       	call   510c <close>
+    1250:	83 c4 10             	add    $0x10,%esp
+
+    fd = open("vecfile", O_RDONLY);
+    1253:	83 ec 08             	sub    $0x8,%esp
+    1256:	6a 00                	push   $0x0
+    1258:	68 94 61 00 00       	push   $0x6194
+    125d:	e8 c8 3e 00 00       	call   512a <open>
+    1262:	83 c4 10             	add    $0x10,%esp
+    1265:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    memset(big, 0, sizeof(big));
+    1268:	83 ec 04             	sub    $0x4,%esp
+    126b:	68 b8 0b 00 00       	push   $0xbb8
+    1270:	6a 00                	push   $0x0
+    1272:	68 e0 c8 00 00       	push   $0xc8e0
+    1277:	e8 19 3c 00 00       	call   4e95 <memset>
+    127c:	83 c4 10             	add    $0x10,%esp
+    memset(tail, 0, sizeof(tail));
+    127f:	83 ec 04             	sub    $0x4,%esp
+    1282:	6a 08                	push   $0x8
+    1284:	6a 00                	push   $0x0
+    1286:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+    1289:	50                   	push   %eax
+    128a:	e8 06 3c 00 00       	call   4e95 <memset>
+    128f:	83 c4 10             	add    $0x10,%esp
+    if(readv(fd, iov, 3) != sizeof(hdr) + sizeof(big) + sizeof(tail) ||
+    1292:	83 ec 04             	sub    $0x4,%esp
+    1295:	6a 03                	push   $0x3
+    1297:	8d 45 c4             	lea    -0x3c(%ebp),%eax
+    129a:	50                   	push   %eax
+    129b:	ff 75 f0             	push   -0x10(%ebp)
+    129e:	e8 f9 3f 00 00       	call   529c <readv>
+    12a3:	83 c4 10             	add    $0x10,%esp
+    12a6:	3d c4 0b 00 00       	cmp    $0xbc4,%eax
+    12ab:	75 30                	jne    12dd <vectortest+0x28b>
+       strcmp(hdr, "hdr") != 0 || strcmp(tail, "TAILTAI") != 0){
+    12ad:	83 ec 08             	sub    $0x8,%esp
+    12b0:	68 e0 61 00 00       	push   $0x61e0
+    12b5:	8d 45 ec             	lea    -0x14(%ebp),%eax
+    12b8:	50                   	push   %eax
+    12b9:	e8 71 3b 00 00       	call   4e2f <strcmp>
+    12be:	83 c4 10             	add    $0x10,%esp
+    if(readv(fd, iov, 3) != sizeof(hdr) + sizeof(big) + sizeof(tail) ||
+    12c1:	85 c0                	test   %eax,%eax
+    12c3:	75 18                	jne    12dd <vectortest+0x28b>
+       strcmp(hdr, "hdr") != 0 || strcmp(tail, "TAILTAI") != 0){
+    12c5:	83 ec 08             	sub    $0x8,%esp
+    12c8:	68 8c 61 00 00       	push   $0x618c
+    12cd:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+    12d0:	50                   	push   %eax
+    12d1:	e8 59 3b 00 00       	call   4e2f <strcmp>
+    12d6:	83 c4 10             	add    $0x10,%esp
+    12d9:	85 c0                	test   %eax,%eax
+    12db:	74 1b                	je     12f8 <vectortest+0x2a6>
+        printf(stdout, "readv failed\n");
+    12dd:	a1 6c 81 00 00       	mov    0x816c,%eax
+    12e2:	83 ec 08             	sub    $0x8,%esp
+    12e5:	68 1b 62 00 00       	push   $0x621b
+    12ea:	50                   	push   %eax
+    12eb:	e8 f1 40 00 00       	call   53e1 <printf>
+    12f0:	83 c4 10             	add    $0x10,%esp
+        exit();
+    12f3:	e8 eb 3d 00 00       	call   50e3 <exit>
+    }
+    for(i = 0; i < sizeof(big); i++){
+    12f8:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    12ff:	eb 54                	jmp    1355 <vectortest+0x303>
+        if(big[i] != (char)(i % 251)){
+    1301:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1304:	05 e0 c8 00 00       	add    $0xc8e0,%eax
+    1309:	0f b6 18             	movzbl (%eax),%ebx
+    130c:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+    130f:	ba bf bf 8c 82       	mov    $0x828cbfbf,%edx
+    1314:	89 c8                	mov    %ecx,%eax
+    1316:	f7 ea                	imul   %edx
+    1318:	8d 04 0a             	lea    (%edx,%ecx,1),%eax
+    131b:	c1 f8 07             	sar    $0x7,%eax
+    131e:	89 ca                	mov    %ecx,%edx
+    1320:	c1 fa 1f             	sar    $0x1f,%edx
+    1323:	29 d0                	sub    %edx,%eax
+    1325:	69 d0 fb 00 00 00    	imul   $0xfb,%eax,%edx
+    132b:	89 c8                	mov    %ecx,%eax
+    132d:	29 d0                	sub    %edx,%eax
+    132f:	38 c3                	cmp    %al,%bl
+    1331:	74 1e                	je     1351 <vectortest+0x2ff>
+            printf(stdout, "readv data wrong at %d\n", i);
+    1333:	a1 6c 81 00 00       	mov    0x816c,%eax
+    1338:	83 ec 04             	sub    $0x4,%esp
+    133b:	ff 75 f4             	push   -0xc(%ebp)
+    133e:	68 29 62 00 00       	push   $0x6229
+    1343:	50                   	push   %eax
+    1344:	e8 98 40 00 00       	call   53e1 <printf>
+    1349:	83 c4 10             	add    $0x10,%esp
+            exit();
+    134c:	e8 92 3d 00 00       	call   50e3 <exit>
+    for(i = 0; i < sizeof(big); i++){
+    1351:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    1355:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1358:	3d b7 0b 00 00       	cmp    $0xbb7,%eax
+    135d:	76 a2                	jbe    1301 <vectortest+0x2af>
+        }
+    }
+    close(fd);
+    135f:	83 ec 0c             	sub    $0xc,%esp
+    1362:	ff 75 f0             	push   -0x10(%ebp)
+    1365:	e8 a2 3d 00 00       	call   510c <close>
+    136a:	83 c4 10             	add    $0x10,%esp
+    unlink("vecfile");
+    136d:	83 ec 0c             	sub    $0xc,%esp
+    1370:	68 94 61 00 00       	push   $0x6194
+    1375:	e8 c4 3d 00 00       	call   513e <unlink>
+    137a:	83 c4 10             	add    $0x10,%esp
+
+    // No buffers, or only empty ones, read nothing from an empty
+    // pipe rather than waiting.
+    if(pipe(fds) != 0){
+    137d:	83 ec 0c             	sub    $0xc,%esp
+    1380:	8d 45 bc             	lea    -0x44(%ebp),%eax
+    1383:	50                   	push   %eax
+    1384:	e8 68 3d 00 00       	call   50f1 <pipe>
+    1389:	83 c4 10             	add    $0x10,%esp
+    138c:	85 c0                	test   %eax,%eax
+    138e:	74 1b                	je     13ab <vectortest+0x359>
+        printf(stdout, "pipe() failed\n");
+    1390:	a1 6c 81 00 00       	mov    0x816c,%eax
+    1395:	83 ec 08             	sub    $0x8,%esp
+    1398:	68 ba 5f 00 00       	push   $0x5fba
+    139d:	50                   	push   %eax
+    139e:	e8 3e 40 00 00       	call   53e1 <printf>
+    13a3:	83 c4 10             	add    $0x10,%esp
+        exit();
+    13a6:	e8 38 3d 00 00       	call   50e3 <exit>
+    }
+    iov[0].iov_len = 0;
+    13ab:	c7 45 c8 00 00 00 00 	movl   $0x0,-0x38(%ebp)
+    if(readv(fds[0], iov, 0) != 0 || readv(fds[0], iov, 1) != 0){
+    13b2:	8b 45 bc             	mov    -0x44(%ebp),%eax
+    13b5:	83 ec 04             	sub    $0x4,%esp
+    13b8:	6a 00                	push   $0x0
+    13ba:	8d 55 c4             	lea    -0x3c(%ebp),%edx
+    13bd:	52                   	push   %edx
+    13be:	50                   	push   %eax
+    13bf:	e8 d8 3e 00 00       	call   529c <readv>
+    13c4:	83 c4 10             	add    $0x10,%esp
+    13c7:	85 c0                	test   %eax,%eax
+    13c9:	75 19                	jne    13e4 <vectortest+0x392>
+    13cb:	8b 45 bc             	mov    -0x44(%ebp),%eax
+    13ce:	83 ec 04             	sub    $0x4,%esp
+    13d1:	6a 01                	push   $0x1
+    13d3:	8d 55 c4             	lea    -0x3c(%ebp),%edx
+    13d6:	52                   	push   %edx
+    13d7:	50                   	push   %eax
+    13d8:	e8 bf 3e 00 00       	call   529c <readv>
+    13dd:	83 c4 10             	add    $0x10,%esp
+    13e0:	85 c0                	test   %eax,%eax
+    13e2:	74 1b                	je     13ff <vectortest+0x3ad>
+        printf(stdout, "readv of no buffers failed\n");
+    13e4:	a1 6c 81 00 00       	mov    0x816c,%eax
+    13e9:	83 ec 08             	sub    $0x8,%esp
+    13ec:	68 41 62 00 00       	push   $0x6241
+    13f1:	50                   	push   %eax
+    13f2:	e8 ea 3f 00 00       	call   53e1 <printf>
+    13f7:	83 c4 10             	add    $0x10,%esp
+        exit();
+    13fa:	e8 e4 3c 00 00       	call   50e3 <exit>
+    }
+    close(fds[0]);
+    13ff:	8b 45 bc             	mov    -0x44(%ebp),%eax
+    1402:	83 ec 0c             	sub    $0xc,%esp
+    1405:	50                   	push   %eax
+    1406:	e8 01 3d 00 00       	call   510c <close>
+    140b:	83 c4 10             	add    $0x10,%esp
+    close(fds[1]);
+    140e:	8b 45 c0             	mov    -0x40(%ebp),%eax
+    1411:	83 ec 0c             	sub    $0xc,%esp
+    1414:	50                   	push   %eax
+    1415:	e8 f2 3c 00 00       	call   510c <close>
+    141a:	83 c4 10             	add    $0x10,%esp
+    printf(stdout, "vector ok\n");
+    141d:	a1 6c 81 00 00       	mov    0x816c,%eax
+    1422:	83 ec 08             	sub    $0x8,%esp
+    1425:	68 5d 62 00 00       	push   $0x625d
+    142a:	50                   	push   %eax
+    142b:	e8 b1 3f 00 00       	call   53e1 <printf>
+    1430:	83 c4 10             	add    $0x10,%esp
+}
+    1433:	90                   	nop
+    1434:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1437:	c9                   	leave
+    1438:	c3                   	ret
+
+00001439 <splicetest>:
+// sendfile() a file into a pipe for a child to check, with and
+// without an offset, and splice() what a child writes into a pipe
+// into a file.
+void
+splicetest(void)
+{
+    1439:	55                   	push   %ebp
+    143a:	89 e5                	mov    %esp,%ebp
+    143c:	83 ec 28             	sub    $0x28,%esp
+    static char data[2000], got[2000];
+    int fd, fds[2], i, n, off, pid;
+
+    printf(stdout, "splice test\n");
+    143f:	a1 6c 81 00 00       	mov    0x816c,%eax
+    1444:	83 ec 08             	sub    $0x8,%esp
+    1447:	68 68 62 00 00       	push   $0x6268
+    144c:	50                   	push   %eax
+    144d:	e8 8f 3f 00 00       	call   53e1 <printf>
+    1452:	83 c4 10             	add    $0x10,%esp
+    for(i = 0; i < sizeof(data); i++)
+    1455:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    145c:	eb 33                	jmp    1491 <splicetest+0x58>
+        data[i] = i % 253;
+    145e:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+    1461:	ba a9 8d 84 81       	mov    $0x81848da9,%edx
+    1466:	89 c8                	mov    %ecx,%eax
+    1468:	f7 ea                	imul   %edx
+    146a:	8d 04 0a             	lea    (%edx,%ecx,1),%eax
+    146d:	c1 f8 07             	sar    $0x7,%eax
+    1470:	89 ca                	mov    %ecx,%edx
+    1472:	c1 fa 1f             	sar    $0x1f,%edx
+    1475:	29 d0                	sub    %edx,%eax
+    1477:	69 d0 fd 00 00 00    	imul   $0xfd,%eax,%edx
+    147d:	89 c8                	mov    %ecx,%eax
+    147f:	29 d0                	sub    %edx,%eax
+    1481:	89 c2                	mov    %eax,%edx
+    1483:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1486:	05 a0 d4 00 00       	add    $0xd4a0,%eax
+    148b:	88 10                	mov    %dl,(%eax)
+    for(i = 0; i < sizeof(data); i++)
+    148d:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    1491:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1494:	3d cf 07 00 00       	cmp    $0x7cf,%eax
+    1499:	76 c3                	jbe    145e <splicetest+0x25>
+    fd = open("splicefile", O_CREATE|O_RDWR);
+    149b:	83 ec 08             	sub    $0x8,%esp
+    149e:	68 02 02 00 00       	push   $0x202
+    14a3:	68 75 62 00 00       	push   $0x6275
+    14a8:	e8 7d 3c 00 00       	call   512a <open>
+    14ad:	83 c4 10             	add    $0x10,%esp
+    14b0:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    if(fd < 0 || write(fd, data, sizeof(data)) != sizeof(data)){
+    14b3:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    14b7:	78 1f                	js     14d8 <splicetest+0x9f>
+    14b9:	83 ec 04             	sub    $0x4,%esp
+    14bc:	68 d0 07 00 00       	push   $0x7d0
+    14c1:	68 a0 d4 00 00       	push   $0xd4a0
+    14c6:	ff 75 ec             	push   -0x14(%ebp)
+    14c9:	e8 34 3c 00 00       	call   5102 <write>
+    14ce:	83 c4 10             	add    $0x10,%esp
+    14d1:	3d d0 07 00 00       	cmp    $0x7d0,%eax
+    14d6:	74 1b                	je     14f3 <splicetest+0xba>
+        printf(stdout, "create splicefile failed\n");
+    14d8:	a1 6c 81 00 00       	mov    0x816c,%eax
+    14dd:	83 ec 08             	sub    $0x8,%esp
+    14e0:	68 80 62 00 00       	push   $0x6280
+    14e5:	50                   	push   %eax
+    14e6:	e8 f6 3e 00 00       	call   53e1 <printf>
+    14eb:	83 c4 10             	add    $0x10,%esp
+        exit();
+    14ee:	e8 f0 3b 00 00       	call   50e3 <exit>
+    }
+    close(fd);
+    14f3:	83 ec 0c             	sub    $0xc,%esp
+    14f6:	ff 75 ec             	push   -0x14(%ebp)
+    14f9:	e8 0e 3c 00 00       	call   510c <close>
+    14fe:	83 c4 10             	add    $0x10,%esp
+
+    if(pipe(fds) != 0){
+    1501:	83 ec 0c             	sub    $0xc,%esp
+    1504:	8d 45 e0             	lea    -0x20(%ebp),%eax
+    1507:	50                   	push   %eax
+    1508:	e8 e4 3b 00 00       	call   50f1 <pipe>
+    150d:	83 c4 10             	add    $0x10,%esp
+    1510:	85 c0                	test   %eax,%eax
+    1512:	74 1b                	je     152f <splicetest+0xf6>
+        printf(stdout, "pipe() failed\n");
+    1514:	a1 6c 81 00 00       	mov    0x816c,%eax
+    1519:	83 ec 08             	sub    $0x8,%esp
+    151c:	68 ba 5f 00 00       	push   $0x5fba
+    1521:	50                   	push   %eax
+    1522:	e8 ba 3e 00 00       	call   53e1 <printf>
+    1527:	83 c4 10             	add    $0x10,%esp
+        exit();
+    152a:	e8 b4 3b 00 00       	call   50e3 <exit>
+    }
+    pid = fork();
+    152f:	e8 a8 3b 00 00       	call   50dc <fork>
+    1534:	89 45 e8             	mov    %eax,-0x18(%ebp)
+    if(pid < 0){
+    1537:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    153b:	79 1b                	jns    1558 <splicetest+0x11f>
+        printf(stdout, "fork failed\n");
+    153d:	a1 6c 81 00 00       	mov    0x816c,%eax
+    1542:	83 ec 08             	sub    $0x8,%esp
+    1545:	68 e9 5b 00 00       	push   $0x5be9
+    154a:	50                   	push   %eax
+    154b:	e8 91 3e 00 00       	call   53e1 <printf>
+    1550:	83 c4 10             	add    $0x10,%esp
+        exit();
+    1553:	e8 8b 3b 00 00       	call   50e3 <exit>
+    }
+    if(pid == 0){
+    1558:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    155c:	0f 85 c8 00 00 00    	jne    162a <splicetest+0x1f1>
+        close(fds[1]);
+    1562:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    1565:	83 ec 0c             	sub    $0xc,%esp
+    1568:	50                   	push   %eax
+    1569:	e8 9e 3b 00 00       	call   510c <close>
+    156e:	83 c4 10             	add    $0x10,%esp
+        for(n = 0; (i = read(fds[0], got + n, sizeof(got) - n)) > 0; n += i)
+    1571:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+    1578:	eb 06                	jmp    1580 <splicetest+0x147>
+    157a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    157d:	01 45 f0             	add    %eax,-0x10(%ebp)
+    1580:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    1583:	ba d0 07 00 00       	mov    $0x7d0,%edx
+    1588:	29 c2                	sub    %eax,%edx
+    158a:	89 d1                	mov    %edx,%ecx
+    158c:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    158f:	8d 90 80 dc 00 00    	lea    0xdc80(%eax),%edx
+    1595:	8b 45 e0             	mov    -0x20(%ebp),%eax
+    1598:	83 ec 04             	sub    $0x4,%esp
+    159b:	51                   	push   %ecx
+    159c:	52                   	push   %edx
+    159d:	50                   	push   %eax
+    159e:	e8 55 3b 00 00       	call   50f8 <read>
+    15a3:	83 c4 10             	add    $0x10,%esp
+    15a6:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    15a9:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    15ad:	7f cb                	jg     157a <splicetest+0x141>
+            ;
+        if(n != sizeof(data) - 100){
+    15af:	81 7d f0 6c 07 00 00 	cmpl   $0x76c,-0x10(%ebp)
+    15b6:	74 1e                	je     15d6 <splicetest+0x19d>
+            printf(stdout, "sendfile: child got %d bytes\n", n);
+    15b8:	a1 6c 81 00 00       	mov    0x816c,%eax
+    15bd:	83 ec 04             	sub    $0x4,%esp
+    15c0:	ff 75 f0             	push   -0x10(%ebp)
+    15c3:	68 9a 62 00 00       	push   $0x629a
+    15c8:	50                   	push   %eax
+    15c9:	e8 13 3e 00 00       	call   53e1 <printf>
+    15ce:	83 c4 10             	add    $0x10,%esp
+            exit();
+    15d1:	e8 0d 3b 00 00       	call   50e3 <exit>
+        }
+        for(i = 0; i < n; i++){
+    15d6:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    15dd:	eb 3e                	jmp    161d <splicetest+0x1e4>
+            if(got[i] != data[100 + i]){
+    15df:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    15e2:	05 80 dc 00 00       	add    $0xdc80,%eax
+    15e7:	0f b6 10             	movzbl (%eax),%edx
+    15ea:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    15ed:	83 c0 64             	add    $0x64,%eax
+    15f0:	0f b6 80 a0 d4 00 00 	movzbl 0xd4a0(%eax),%eax
+    15f7:	38 c2                	cmp    %al,%dl
+    15f9:	74 1e                	je     1619 <splicetest+0x1e0>
+                printf(stdout, "sendfile: wrong byte at %d\n", i);
+    15fb:	a1 6c 81 00 00       	mov    0x816c,%eax
+    1600:	83 ec 04             	sub    $0x4,%esp
+    1603:	ff 75 f4             	push   -0xc(%ebp)
+    1606:	68 b8 62 00 00       	push   $0x62b8
+    160b:	50                   	push   %eax
+    160c:	e8 d0 3d 00 00       	call   53e1 <printf>
+    1611:	83 c4 10             	add    $0x10,%esp
+                exit();
+    1614:	e8 ca 3a 00 00       	call   50e3 <exit>
+        for(i = 0; i < n; i++){
+    1619:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    161d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1620:	3b 45 f0             	cmp    -0x10(%ebp),%eax
+    1623:	7c ba                	jl     15df <splicetest+0x1a6>
+            }
+        }
+        exit();
+    1625:	e8 b9 3a 00 00       	call   50e3 <exit>
+    }
+    close(fds[0]);
+    162a:	8b 45 e0             	mov    -0x20(%ebp),%eax
+    162d:	83 ec 0c             	sub    $0xc,%esp
+    1630:	50                   	push   %eax
+    1631:	e8 d6 3a 00 00       	call   510c <close>
+    1636:	83 c4 10             	add    $0x10,%esp
+    fd = open("splicefile", O_RDONLY);
+    1639:	83 ec 08             	sub    $0x8,%esp
+    163c:	6a 00                	push   $0x0
+    163e:	68 75 62 00 00       	push   $0x6275
+    1643:	e8 e2 3a 00 00       	call   512a <open>
+    1648:	83 c4 10             	add    $0x10,%esp
+    164b:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    off = 100;
+    164e:	c7 45 dc 64 00 00 00 	movl   $0x64,-0x24(%ebp)
+    if(sendfile(fds[1], fd, &off, 1000) != 1000 || off != 1100){
+    1655:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    1658:	68 e8 03 00 00       	push   $0x3e8
+    165d:	8d 55 dc             	lea    -0x24(%ebp),%edx
+    1660:	52                   	push   %edx
+    1661:	ff 75 ec             	push   -0x14(%ebp)
+    1664:	50                   	push   %eax
+    1665:	e8 5a 3c 00 00       	call   52c4 <sendfile>
+    166a:	83 c4 10             	add    $0x10,%esp
+    166d:	3d e8 03 00 00       	cmp    $0x3e8,%eax
+    1672:	75 0a                	jne    167e <splicetest+0x245>
+    1674:	8b 45 dc             	mov    -0x24(%ebp),%eax
+    1677:	3d 4c 04 00 00       	cmp    $0x44c,%eax
+    167c:	74 1b                	je     1699 <splicetest+0x260>
+        printf(stdout, "sendfile with offset failed\n");
+    167e:	a1 6c 81 00 00       	mov    0x816c,%eax
+    1683:	83 ec 08             	sub    $0x8,%esp
+    1686:	68 d4 62 00 00       	push   $0x62d4
+    168b:	50                   	push   %eax
+    168c:	e8 50 3d 00 00       	call   53e1 <printf>
+    1691:	83 c4 10             	add    $0x10,%esp
+        exit();
+    1694:	e8 4a 3a 00 00       	call   50e3 <exit>
+    }
+    // fd's own offset is still 0.
+    if(read(fd, got, 1100) != 1100 || got[0] != data[0] || sendfile(fds[1], fd, 0, sizeof(data)) != sizeof(data) - 1100 ||
+    1699:	83 ec 04             	sub    $0x4,%esp
+    169c:	68 4c 04 00 00       	push   $0x44c
+    16a1:	68 80 dc 00 00       	push   $0xdc80
+    16a6:	ff 75 ec             	push   -0x14(%ebp)
+    16a9:	e8 4a 3a 00 00       	call   50f8 <read>
+    16ae:	83 c4 10             	add    $0x10,%esp
+    16b1:	3d 4c 04 00 00       	cmp    $0x44c,%eax
+    16b6:	75 46                	jne    16fe <splicetest+0x2c5>
+    16b8:	0f b6 15 80 dc 00 00 	movzbl 0xdc80,%edx
+    16bf:	0f b6 05 a0 d4 00 00 	movzbl 0xd4a0,%eax
+    16c6:	38 c2                	cmp    %al,%dl
+    16c8:	75 34                	jne    16fe <splicetest+0x2c5>
+    16ca:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    16cd:	68 d0 07 00 00       	push   $0x7d0
+    16d2:	6a 00                	push   $0x0
+    16d4:	ff 75 ec             	push   -0x14(%ebp)
+    16d7:	50                   	push   %eax
+    16d8:	e8 e7 3b 00 00       	call   52c4 <sendfile>
+    16dd:	83 c4 10             	add    $0x10,%esp
+    16e0:	3d 84 03 00 00       	cmp    $0x384,%eax
+    16e5:	75 17                	jne    16fe <splicetest+0x2c5>
+       sendfile(fds[1], fd, 0, 10) != 0){
+    16e7:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    16ea:	6a 0a                	push   $0xa
+    16ec:	6a 00                	push   $0x0
+    16ee:	ff 75 ec             	push   -0x14(%ebp)
+    16f1:	50                   	push   %eax
+    16f2:	e8 cd 3b 00 00       	call   52c4 <sendfile>
+    16f7:	83 c4 10             	add    $0x10,%esp
+    if(read(fd, got, 1100) != 1100 || got[0] != data[0] || sendfile(fds[1], fd, 0, sizeof(data)) != sizeof(data) - 1100 ||
+    16fa:	85 c0                	test   %eax,%eax
+    16fc:	74 1b                	je     1719 <splicetest+0x2e0>
+        printf(stdout, "sendfile failed\n");
+    16fe:	a1 6c 81 00 00       	mov    0x816c,%eax
+    1703:	83 ec 08             	sub    $0x8,%esp
+    1706:	68 f1 62 00 00       	push   $0x62f1
+    170b:	50                   	push   %eax
+    170c:	e8 d0 3c 00 00       	call   53e1 <printf>
+    1711:	83 c4 10             	add    $0x10,%esp
+        exit();
+    1714:	e8 ca 39 00 00       	call   50e3 <exit>
+    }
+    close(fd);
+    1719:	83 ec 0c             	sub    $0xc,%esp
+    171c:	ff 75 ec             	push   -0x14(%ebp)
+    171f:	e8 e8 39 00 00       	call   510c <close>
+    1724:	83 c4 10             	add    $0x10,%esp
+    close(fds[1]);
+    1727:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    172a:	83 ec 0c             	sub    $0xc,%esp
+    172d:	50                   	push   %eax
+    172e:	e8 d9 39 00 00       	call   510c <close>
+    1733:	83 c4 10             	add    $0x10,%esp
+    wait();
+    1736:	e8 af 39 00 00       	call   50ea <wait>
+
+    if(pipe(fds) != 0){
+    173b:	83 ec 0c             	sub    $0xc,%esp
+    173e:	8d 45 e0             	lea    -0x20(%ebp),%eax
+    1741:	50                   	push   %eax
+    1742:	e8 aa 39 00 00       	call   50f1 <pipe>
+    1747:	83 c4 10             	add    $0x10,%esp
+    174a:	85 c0                	test   %eax,%eax
+    174c:	74 1b                	je     1769 <splicetest+0x330>
+        printf(stdout, "pipe() failed\n");
+    174e:	a1 6c 81 00 00       	mov    0x816c,%eax
+    1753:	83 ec 08             	sub    $0x8,%esp
+    1756:	68 ba 5f 00 00       	push   $0x5fba
+    175b:	50                   	push   %eax
+    175c:	e8 80 3c 00 00       	call   53e1 <printf>
+    1761:	83 c4 10             	add    $0x10,%esp
+        exit();
+    1764:	e8 7a 39 00 00       	call   50e3 <exit>
+    }
+    pid = fork();
+    1769:	e8 6e 39 00 00       	call   50dc <fork>
+    176e:	89 45 e8             	mov    %eax,-0x18(%ebp)
+    if(pid < 0){
+    1771:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    1775:	79 1b                	jns    1792 <splicetest+0x359>
+        printf(stdout, "fork failed\n");
+    1777:	a1 6c 81 00 00       	mov    0x816c,%eax
+    177c:	83 ec 08             	sub    $0x8,%esp
+    177f:	68 e9 5b 00 00       	push   $0x5be9
+    1784:	50                   	push   %eax
+    1785:	e8 57 3c 00 00       	call   53e1 <printf>
+    178a:	83 c4 10             	add    $0x10,%esp
+        exit();
+    178d:	e8 51 39 00 00       	call   50e3 <exit>
+    }
+    if(pid == 0){
+    1792:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    1796:	75 2d                	jne    17c5 <splicetest+0x38c>
+        close(fds[0]);
+    1798:	8b 45 e0             	mov    -0x20(%ebp),%eax
+    179b:	83 ec 0c             	sub    $0xc,%esp
+    179e:	50                   	push   %eax
+    179f:	e8 68 39 00 00       	call   510c <close>
+    17a4:	83 c4 10             	add    $0x10,%esp
+        write(fds[1], data, sizeof(data));
+    17a7:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    17aa:	83 ec 04             	sub    $0x4,%esp
+    17ad:	68 d0 07 00 00       	push   $0x7d0
+    17b2:	68 a0 d4 00 00       	push   $0xd4a0
+    17b7:	50                   	push   %eax
+    17b8:	e8 45 39 00 00       	call   5102 <write>
+    17bd:	83 c4 10             	add    $0x10,%esp
+        exit();
+    17c0:	e8 1e 39 00 00       	call   50e3 <exit>
+    }
+    close(fds[1]);
+    17c5:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    17c8:	83 ec 0c             	sub    $0xc,%esp
+    17cb:	50                   	push   %eax
+    17cc:	e8 3b 39 00 00       	call   510c <close>
+    17d1:	83 c4 10             	add    $0x10,%esp
+    fd = open("splicefile2", O_CREATE|O_RDWR);
+    17d4:	83 ec 08             	sub    $0x8,%esp
+    17d7:	68 02 02 00 00       	push   $0x202
+    17dc:	68 02 63 00 00       	push   $0x6302
+    17e1:	e8 44 39 00 00       	call   512a <open>
+    17e6:	83 c4 10             	add    $0x10,%esp
+    17e9:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    if((n = splice(fds[0], 0, fd, 0, 10)) <= 0 || splice(fd, 0, fd, 0, 10) >= 0){
+    17ec:	8b 45 e0             	mov    -0x20(%ebp),%eax
+    17ef:	83 ec 0c             	sub    $0xc,%esp
+    17f2:	6a 0a                	push   $0xa
+    17f4:	6a 00                	push   $0x0
+    17f6:	ff 75 ec             	push   -0x14(%ebp)
+    17f9:	6a 00                	push   $0x0
+    17fb:	50                   	push   %eax
+    17fc:	e8 cd 3a 00 00       	call   52ce <splice>
+    1801:	83 c4 20             	add    $0x20,%esp
+    1804:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    1807:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    180b:	7e 1b                	jle    1828 <splicetest+0x3ef>
+    180d:	83 ec 0c             	sub    $0xc,%esp
+    1810:	6a 0a                	push   $0xa
+    1812:	6a 00                	push   $0x0
+    1814:	ff 75 ec             	push   -0x14(%ebp)
+    1817:	6a 00                	push   $0x0
+    1819:	ff 75 ec             	push   -0x14(%ebp)
+    181c:	e8 ad 3a 00 00       	call   52ce <splice>
+    1821:	83 c4 20             	add    $0x20,%esp
+    1824:	85 c0                	test   %eax,%eax
+    1826:	78 21                	js     1849 <splicetest+0x410>
+        printf(stdout, "splice failed\n");
+    1828:	a1 6c 81 00 00       	mov    0x816c,%eax
+    182d:	83 ec 08             	sub    $0x8,%esp
+    1830:	68 0e 63 00 00       	push   $0x630e
+    1835:	50                   	push   %eax
+    1836:	e8 a6 3b 00 00       	call   53e1 <printf>
+    183b:	83 c4 10             	add    $0x10,%esp
+        exit();
+    183e:	e8 a0 38 00 00       	call   50e3 <exit>
+    }
+    for(; (i = splice(fds[0], 0, fd, 0, sizeof(data))) > 0; n += i)
+    1843:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1846:	01 45 f0             	add    %eax,-0x10(%ebp)
+    1849:	8b 45 e0             	mov    -0x20(%ebp),%eax
+    184c:	83 ec 0c             	sub    $0xc,%esp
+    184f:	68 d0 07 00 00       	push   $0x7d0
+    1854:	6a 00                	push   $0x0
+    1856:	ff 75 ec             	push   -0x14(%ebp)
+    1859:	6a 00                	push   $0x0
+    185b:	50                   	push   %eax
+    185c:	e8 6d 3a 00 00       	call   52ce <splice>
+    1861:	83 c4 20             	add    $0x20,%esp
+    1864:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    1867:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    186b:	7f d6                	jg     1843 <splicetest+0x40a>
+        ;
+    close(fds[0]);
+    186d:	8b 45 e0             	mov    -0x20(%ebp),%eax
+    1870:	83 ec 0c             	sub    $0xc,%esp
+    1873:	50                   	push   %eax
+    1874:	e8 93 38 00 00       	call   510c <close>
+    1879:	83 c4 10             	add    $0x10,%esp
+    wait();
+    187c:	e8 69 38 00 00       	call   50ea <wait>
+    if(n != sizeof(data) || pread(fd, got, sizeof(got), 0) != sizeof(got)){
+    1881:	81 7d f0 d0 07 00 00 	cmpl   $0x7d0,-0x10(%ebp)
+    1888:	75 1e                	jne    18a8 <splicetest+0x46f>
+    188a:	6a 00                	push   $0x0
+    188c:	68 d0 07 00 00       	push   $0x7d0
+    1891:	68 80 dc 00 00       	push   $0xdc80
+    1896:	ff 75 ec             	push   -0x14(%ebp)
+    1899:	e8 12 3a 00 00       	call   52b0 <pread>
+    189e:	83 c4 10             	add    $0x10,%esp
+    18a1:	3d d0 07 00 00       	cmp    $0x7d0,%eax
+    18a6:	74 1e                	je     18c6 <splicetest+0x48d>
+        printf(stdout, "splice moved %d bytes\n", n);
+    18a8:	a1 6c 81 00 00       	mov    0x816c,%eax
+    18ad:	83 ec 04             	sub    $0x4,%esp
+    18b0:	ff 75 f0             	push   -0x10(%ebp)
+    18b3:	68 1d 63 00 00       	push   $0x631d
+    18b8:	50                   	push   %eax
+    18b9:	e8 23 3b 00 00       	call   53e1 <printf>
+    18be:	83 c4 10             	add    $0x10,%esp
+        exit();
+    18c1:	e8 1d 38 00 00       	call   50e3 <exit>
+    }
+    for(i = 0; i < sizeof(data); i++){
+    18c6:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    18cd:	eb 3c                	jmp    190b <splicetest+0x4d2>
+        if(got[i] != data[i]){
+    18cf:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    18d2:	05 80 dc 00 00       	add    $0xdc80,%eax
+    18d7:	0f b6 10             	movzbl (%eax),%edx
+    18da:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    18dd:	05 a0 d4 00 00       	add    $0xd4a0,%eax
+    18e2:	0f b6 00             	movzbl (%eax),%eax
+    18e5:	38 c2                	cmp    %al,%dl
+    18e7:	74 1e                	je     1907 <splicetest+0x4ce>
+            printf(stdout, "splice: wrong byte at %d\n", i);
+    18e9:	a1 6c 81 00 00       	mov    0x816c,%eax
+    18ee:	83 ec 04             	sub    $0x4,%esp
+    18f1:	ff 75 f4             	push   -0xc(%ebp)
+    18f4:	68 34 63 00 00       	push   $0x6334
+    18f9:	50                   	push   %eax
+    18fa:	e8 e2 3a 00 00       	call   53e1 <printf>
+    18ff:	83 c4 10             	add    $0x10,%esp
+            exit();
+    1902:	e8 dc 37 00 00       	call   50e3 <exit>
+    for(i = 0; i < sizeof(data); i++){
+    1907:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    190b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    190e:	3d cf 07 00 00       	cmp    $0x7cf,%eax
+    1913:	76 ba                	jbe    18cf <splicetest+0x496>
+        }
+    }
+    close(fd);
+    1915:	83 ec 0c             	sub    $0xc,%esp
+    1918:	ff 75 ec             	push   -0x14(%ebp)
+    191b:	e8 ec 37 00 00       	call   510c <close>
+    1920:	83 c4 10             	add    $0x10,%esp
+    unlink("splicefile");
+    1923:	83 ec 0c             	sub    $0xc,%esp
+    1926:	68 75 62 00 00       	push   $0x6275
+    192b:	e8 0e 38 00 00       	call   513e <unlink>
+    1930:	83 c4 10             	add    $0x10,%esp
+    unlink("splicefile2");
+    1933:	83 ec 0c             	sub    $0xc,%esp
+    1936:	68 02 63 00 00       	push   $0x6302
+    193b:	e8 fe 37 00 00       	call   513e <unlink>
+    1940:	83 c4 10             	add    $0x10,%esp
+    printf(stdout, "splice ok\n");
+    1943:	a1 6c 81 00 00       	mov    0x816c,%eax
+    1948:	83 ec 08             	sub    $0x8,%esp
+    194b:	68 4e 63 00 00       	push   $0x634e
+    1950:	50                   	push   %eax
+    1951:	e8 8b 3a 00 00       	call   53e1 <printf>
+    1956:	83 c4 10             	add    $0x10,%esp
+}
+    1959:	90                   	nop
+    195a:	c9                   	leave
+    195b:	c3                   	ret
+
+0000195c <sysstattest>:
+
+// Calls are counted for the caller while sysstat is on, and a
+// traced call shows up in the trace ring with its return value.
+void
+sysstattest(void)
+{
+    195c:	55                   	push   %ebp
+    195d:	89 e5                	mov    %esp,%ebp
+    195f:	81 ec 98 00 00 00    	sub    $0x98,%esp
+    static struct sysstat st[NSYSCALL];
+    struct stracerec r[4];
+    int i, n, pid, found;
+
+    printf(stdout, "sysstat test\n");
+    1965:	a1 6c 81 00 00       	mov    0x816c,%eax
+    196a:	83 ec 08             	sub    $0x8,%esp
+    196d:	68 59 63 00 00       	push   $0x6359
+    1972:	50                   	push   %eax
+    1973:	e8 69 3a 00 00       	call   53e1 <printf>
+    1978:	83 c4 10             	add    $0x10,%esp
+    pid = getpid();
+    197b:	e8 fa 37 00 00       	call   517a <getpid>
+    1980:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    sysstat(SYSSTAT_RESET, pid, 0, 0);
+    1983:	6a 00                	push   $0x0
+    1985:	6a 00                	push   $0x0
+    1987:	ff 75 ec             	push   -0x14(%ebp)
+    198a:	6a 03                	push   $0x3
+    198c:	e8 47 39 00 00       	call   52d8 <sysstat>
+    1991:	83 c4 10             	add    $0x10,%esp
+    sysstat(SYSSTAT_ON, 0, 0, 0);
+    1994:	6a 00                	push   $0x0
+    1996:	6a 00                	push   $0x0
+    1998:	6a 00                	push   $0x0
+    199a:	6a 01                	push   $0x1
+    199c:	e8 37 39 00 00       	call   52d8 <sysstat>
+    19a1:	83 c4 10             	add    $0x10,%esp
+    for(i = 0; i < 10; i++)
+    19a4:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    19ab:	eb 09                	jmp    19b6 <sysstattest+0x5a>
+        getpid();
+    19ad:	e8 c8 37 00 00       	call   517a <getpid>
+    for(i = 0; i < 10; i++)
+    19b2:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    19b6:	83 7d f4 09          	cmpl   $0x9,-0xc(%ebp)
+    19ba:	7e f1                	jle    19ad <sysstattest+0x51>
+    sysstat(SYSSTAT_OFF, 0, 0, 0);
+    19bc:	6a 00                	push   $0x0
+    19be:	6a 00                	push   $0x0
+    19c0:	6a 00                	push   $0x0
+    19c2:	6a 02                	push   $0x2
+    19c4:	e8 0f 39 00 00       	call   52d8 <sysstat>
+    19c9:	83 c4 10             	add    $0x10,%esp
+    if(sysstat(SYSSTAT_READ, pid, st, NSYSCALL) != NSYSCALL ||
+    19cc:	6a 40                	push   $0x40
+    19ce:	68 60 e4 00 00       	push   $0xe460
+    19d3:	ff 75 ec             	push   -0x14(%ebp)
+    19d6:	6a 00                	push   $0x0
+    19d8:	e8 fb 38 00 00       	call   52d8 <sysstat>
+    19dd:	83 c4 10             	add    $0x10,%esp
+    19e0:	83 f8 40             	cmp    $0x40,%eax
+    19e3:	75 23                	jne    1a08 <sysstattest+0xac>
+       st[SYS_getpid].count < 10 || strcmp(st[SYS_getpid].name, "getpid") != 0){
+    19e5:	a1 b4 e7 00 00       	mov    0xe7b4,%eax
+    if(sysstat(SYSSTAT_READ, pid, st, NSYSCALL) != NSYSCALL ||
+    19ea:	83 f8 09             	cmp    $0x9,%eax
+    19ed:	76 19                	jbe    1a08 <sysstattest+0xac>
+       st[SYS_getpid].count < 10 || strcmp(st[SYS_getpid].name, "getpid") != 0){
+    19ef:	83 ec 08             	sub    $0x8,%esp
+    19f2:	68 67 63 00 00       	push   $0x6367
+    19f7:	68 a4 e7 00 00       	push   $0xe7a4
+    19fc:	e8 2e 34 00 00       	call   4e2f <strcmp>
+    1a01:	83 c4 10             	add    $0x10,%esp
+    1a04:	85 c0                	test   %eax,%eax
+    1a06:	74 1b                	je     1a23 <sysstattest+0xc7>
+        printf(stdout, "sysstat did not count getpid\n");
+    1a08:	a1 6c 81 00 00       	mov    0x816c,%eax
+    1a0d:	83 ec 08             	sub    $0x8,%esp
+    1a10:	68 6e 63 00 00       	push   $0x636e
+    1a15:	50                   	push   %eax
+    1a16:	e8 c6 39 00 00       	call   53e1 <printf>
+    1a1b:	83 c4 10             	add    $0x10,%esp
+        exit();
+    1a1e:	e8 c0 36 00 00       	call   50e3 <exit>
+    }
+
+    if(strace(0, 1) < 0){
+    1a23:	83 ec 08             	sub    $0x8,%esp
+    1a26:	6a 01                	push   $0x1
+    1a28:	6a 00                	push   $0x0
+    1a2a:	e8 b3 38 00 00       	call   52e2 <strace>
+    1a2f:	83 c4 10             	add    $0x10,%esp
+    1a32:	85 c0                	test   %eax,%eax
+    1a34:	79 1b                	jns    1a51 <sysstattest+0xf5>
+        printf(stdout, "strace failed\n");
+    1a36:	a1 6c 81 00 00       	mov    0x816c,%eax
+    1a3b:	83 ec 08             	sub    $0x8,%esp
+    1a3e:	68 8c 63 00 00       	push   $0x638c
+    1a43:	50                   	push   %eax
+    1a44:	e8 98 39 00 00       	call   53e1 <printf>
+    1a49:	83 c4 10             	add    $0x10,%esp
+        exit();
+    1a4c:	e8 92 36 00 00       	call   50e3 <exit>
+    }
+    getpid();
+    1a51:	e8 24 37 00 00       	call   517a <getpid>
+    strace(0, 0);
+    1a56:	83 ec 08             	sub    $0x8,%esp
+    1a59:	6a 00                	push   $0x0
+    1a5b:	6a 00                	push   $0x0
+    1a5d:	e8 80 38 00 00       	call   52e2 <strace>
+    1a62:	83 c4 10             	add    $0x10,%esp
+    found = 0;
+    1a65:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+    while((n = straceread(r, 4)) > 0)
+    1a6c:	eb 5f                	jmp    1acd <sysstattest+0x171>
+        for(i = 0; i < n; i++)
+    1a6e:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    1a75:	eb 4e                	jmp    1ac5 <sysstattest+0x169>
+            if(r[i].pid == pid && r[i].num == SYS_getpid && r[i].ret == pid)
+    1a77:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1a7a:	c1 e0 05             	shl    $0x5,%eax
+    1a7d:	8d 40 f8             	lea    -0x8(%eax),%eax
+    1a80:	01 e8                	add    %ebp,%eax
+    1a82:	2d 90 00 00 00       	sub    $0x90,%eax
+    1a87:	8b 00                	mov    (%eax),%eax
+    1a89:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+    1a8c:	75 33                	jne    1ac1 <sysstattest+0x165>
+    1a8e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1a91:	c1 e0 05             	shl    $0x5,%eax
+    1a94:	8d 40 f8             	lea    -0x8(%eax),%eax
+    1a97:	01 e8                	add    %ebp,%eax
+    1a99:	2d 8c 00 00 00       	sub    $0x8c,%eax
+    1a9e:	8b 00                	mov    (%eax),%eax
+    1aa0:	83 f8 0b             	cmp    $0xb,%eax
+    1aa3:	75 1c                	jne    1ac1 <sysstattest+0x165>
+    1aa5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1aa8:	c1 e0 05             	shl    $0x5,%eax
+    1aab:	8d 40 f8             	lea    -0x8(%eax),%eax
+    1aae:	01 e8                	add    %ebp,%eax
+    1ab0:	83 e8 78             	sub    $0x78,%eax
+    1ab3:	8b 00                	mov    (%eax),%eax
+    1ab5:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+    1ab8:	75 07                	jne    1ac1 <sysstattest+0x165>
+                found = 1;
+    1aba:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+        for(i = 0; i < n; i++)
+    1ac1:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    1ac5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1ac8:	3b 45 e8             	cmp    -0x18(%ebp),%eax
+    1acb:	7c aa                	jl     1a77 <sysstattest+0x11b>
+    while((n = straceread(r, 4)) > 0)
+    1acd:	83 ec 08             	sub    $0x8,%esp
+    1ad0:	6a 04                	push   $0x4
+    1ad2:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+    1ad8:	50                   	push   %eax
+    1ad9:	e8 0e 38 00 00       	call   52ec <straceread>
+    1ade:	83 c4 10             	add    $0x10,%esp
+    1ae1:	89 45 e8             	mov    %eax,-0x18(%ebp)
+    1ae4:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    1ae8:	7f 84                	jg     1a6e <sysstattest+0x112>
+    if(!found){
+    1aea:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    1aee:	75 1b                	jne    1b0b <sysstattest+0x1af>
+        printf(stdout, "traced getpid not recorded\n");
+    1af0:	a1 6c 81 00 00       	mov    0x816c,%eax
+    1af5:	83 ec 08             	sub    $0x8,%esp
+    1af8:	68 9b 63 00 00       	push   $0x639b
+    1afd:	50                   	push   %eax
+    1afe:	e8 de 38 00 00       	call   53e1 <printf>
+    1b03:	83 c4 10             	add    $0x10,%esp
+        exit();
+    1b06:	e8 d8 35 00 00       	call   50e3 <exit>
+    }
+    printf(stdout, "sysstat ok\n");
+    1b0b:	a1 6c 81 00 00       	mov    0x816c,%eax
+    1b10:	83 ec 08             	sub    $0x8,%esp
+    1b13:	68 b7 63 00 00       	push   $0x63b7
+    1b18:	50                   	push   %eax
+    1b19:	e8 c3 38 00 00       	call   53e1 <printf>
+    1b1e:	83 c4 10             	add    $0x10,%esp
+}
+    1b21:	90                   	nop
+    1b22:	c9                   	leave
+    1b23:	c3                   	ret
+
+00001b24 <vdsotest>:
+
+// The vdso functions must agree with the system calls they stand
+// in for, in a forked child too.
+void
+vdsotest(void)
+{
+    1b24:	55                   	push   %ebp
+    1b25:	89 e5                	mov    %esp,%ebp
+    1b27:	53                   	push   %ebx
+    1b28:	83 ec 24             	sub    $0x24,%esp
+    struct timespec a, b;
+    int pid, t;
+
+    printf(stdout, "vdso test\n");
+    1b2b:	a1 6c 81 00 00       	mov    0x816c,%eax
+    1b30:	83 ec 08             	sub    $0x8,%esp
+    1b33:	68 c3 63 00 00       	push   $0x63c3
+    1b38:	50                   	push   %eax
+    1b39:	e8 a3 38 00 00       	call   53e1 <printf>
+    1b3e:	83 c4 10             	add    $0x10,%esp
+    t = uptime();
+    1b41:	e8 52 36 00 00       	call   5198 <uptime>
+    1b46:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(vgetpid() != getpid() || vuptime() < t || vuptime() > t + 2){
+    1b49:	e8 cc 3c 00 00       	call   581a <vgetpid>
+    1b4e:	89 c3                	mov    %eax,%ebx
+    1b50:	e8 25 36 00 00       	call   517a <getpid>
+    1b55:	39 c3                	cmp    %eax,%ebx
+    1b57:	75 19                	jne    1b72 <vdsotest+0x4e>
+    1b59:	e8 c8 3c 00 00       	call   5826 <vuptime>
+    1b5e:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+    1b61:	7f 0f                	jg     1b72 <vdsotest+0x4e>
+    1b63:	e8 be 3c 00 00       	call   5826 <vuptime>
+    1b68:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    1b6b:	83 c2 02             	add    $0x2,%edx
+    1b6e:	39 d0                	cmp    %edx,%eax
+    1b70:	7e 1b                	jle    1b8d <vdsotest+0x69>
+        printf(stdout, "vdso disagrees with system calls\n");
+    1b72:	a1 6c 81 00 00       	mov    0x816c,%eax
+    1b77:	83 ec 08             	sub    $0x8,%esp
+    1b7a:	68 d0 63 00 00       	push   $0x63d0
+    1b7f:	50                   	push   %eax
+    1b80:	e8 5c 38 00 00       	call   53e1 <printf>
+    1b85:	83 c4 10             	add    $0x10,%esp
+        exit();
+    1b88:	e8 56 35 00 00       	call   50e3 <exit>
+    }
+    clock_gettime(CLOCK_MONOTONIC, &a);
+    1b8d:	83 ec 08             	sub    $0x8,%esp
+    1b90:	8d 45 e8             	lea    -0x18(%ebp),%eax
+    1b93:	50                   	push   %eax
+    1b94:	6a 01                	push   $0x1
+    1b96:	e8 7f 36 00 00       	call   521a <clock_gettime>
+    1b9b:	83 c4 10             	add    $0x10,%esp
+    if(vclock_gettime(CLOCK_MONOTONIC, &b) < 0 || b.tv_sec < a.tv_sec ||
+    1b9e:	83 ec 08             	sub    $0x8,%esp
+    1ba1:	8d 45 e0             	lea    -0x20(%ebp),%eax
+    1ba4:	50                   	push   %eax
+    1ba5:	6a 01                	push   $0x1
+    1ba7:	e8 86 3c 00 00       	call   5832 <vclock_gettime>
+    1bac:	83 c4 10             	add    $0x10,%esp
+    1baf:	85 c0                	test   %eax,%eax
+    1bb1:	78 1e                	js     1bd1 <vdsotest+0xad>
+    1bb3:	8b 55 e0             	mov    -0x20(%ebp),%edx
+    1bb6:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    1bb9:	39 c2                	cmp    %eax,%edx
+    1bbb:	7c 14                	jl     1bd1 <vdsotest+0xad>
+       (b.tv_sec == a.tv_sec && b.tv_nsec < a.tv_nsec)){
+    1bbd:	8b 55 e0             	mov    -0x20(%ebp),%edx
+    1bc0:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    if(vclock_gettime(CLOCK_MONOTONIC, &b) < 0 || b.tv_sec < a.tv_sec ||
+    1bc3:	39 c2                	cmp    %eax,%edx
+    1bc5:	75 25                	jne    1bec <vdsotest+0xc8>
+       (b.tv_sec == a.tv_sec && b.tv_nsec < a.tv_nsec)){
+    1bc7:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+    1bca:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    1bcd:	39 c2                	cmp    %eax,%edx
+    1bcf:	7d 1b                	jge    1bec <vdsotest+0xc8>
+        printf(stdout, "vclock_gettime went backwards\n");
+    1bd1:	a1 6c 81 00 00       	mov    0x816c,%eax
+    1bd6:	83 ec 08             	sub    $0x8,%esp
+    1bd9:	68 f4 63 00 00       	push   $0x63f4
+    1bde:	50                   	push   %eax
+    1bdf:	e8 fd 37 00 00       	call   53e1 <printf>
+    1be4:	83 c4 10             	add    $0x10,%esp
+        exit();
+    1be7:	e8 f7 34 00 00       	call   50e3 <exit>
+    }
+    pid = fork();
+    1bec:	e8 eb 34 00 00       	call   50dc <fork>
+    1bf1:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(pid < 0){
+    1bf4:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    1bf8:	79 1b                	jns    1c15 <vdsotest+0xf1>
+        printf(stdout, "fork failed\n");
+    1bfa:	a1 6c 81 00 00       	mov    0x816c,%eax
+    1bff:	83 ec 08             	sub    $0x8,%esp
+    1c02:	68 e9 5b 00 00       	push   $0x5be9
+    1c07:	50                   	push   %eax
+    1c08:	e8 d4 37 00 00       	call   53e1 <printf>
+    1c0d:	83 c4 10             	add    $0x10,%esp
+        exit();
+    1c10:	e8 ce 34 00 00       	call   50e3 <exit>
+    }
+    if(pid == 0){
+    1c15:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    1c19:	75 30                	jne    1c4b <vdsotest+0x127>
+        if(vgetpid() != getpid()){
+    1c1b:	e8 fa 3b 00 00       	call   581a <vgetpid>
+    1c20:	89 c3                	mov    %eax,%ebx
+    1c22:	e8 53 35 00 00       	call   517a <getpid>
+    1c27:	39 c3                	cmp    %eax,%ebx
+    1c29:	74 1b                	je     1c46 <vdsotest+0x122>
+            printf(stdout, "vgetpid wrong in child\n");
+    1c2b:	a1 6c 81 00 00       	mov    0x816c,%eax
+    1c30:	83 ec 08             	sub    $0x8,%esp
+    1c33:	68 13 64 00 00       	push   $0x6413
+    1c38:	50                   	push   %eax
+    1c39:	e8 a3 37 00 00       	call   53e1 <printf>
+    1c3e:	83 c4 10             	add    $0x10,%esp
+            exit();
+    1c41:	e8 9d 34 00 00       	call   50e3 <exit>
+        }
+        exit();
+    1c46:	e8 98 34 00 00       	call   50e3 <exit>
+    }
+    wait();
+    1c4b:	e8 9a 34 00 00       	call   50ea <wait>
+    printf(stdout, "vdso ok\n");
+    1c50:	a1 6c 81 00 00       	mov    0x816c,%eax
+    1c55:	83 ec 08             	sub    $0x8,%esp
+    1c58:	68 2b 64 00 00       	push   $0x642b
+    1c5d:	50                   	push   %eax
+    1c5e:	e8 7e 37 00 00       	call   53e1 <printf>
+    1c63:	83 c4 10             	add    $0x10,%esp
+}
+    1c66:	90                   	nop
+    1c67:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1c6a:	c9                   	leave
+    1c6b:	c3                   	ret
+
+00001c6c <mem>:
+
+void
+mem(void)
+{
+    1c6c:	55                   	push   %ebp
+    1c6d:	89 e5                	mov    %esp,%ebp
+    1c6f:	83 ec 18             	sub    $0x18,%esp
+    void *m1, *m2;
+    int pid, ppid;
+
+    printf(1, "mem test\n");
+    1c72:	83 ec 08             	sub    $0x8,%esp
+    1c75:	68 34 64 00 00       	push   $0x6434
+    1c7a:	6a 01                	push   $0x1
+    1c7c:	e8 60 37 00 00       	call   53e1 <printf>
+    1c81:	83 c4 10             	add    $0x10,%esp
+    ppid = getpid();
+    1c84:	e8 f1 34 00 00       	call   517a <getpid>
+    1c89:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if((pid = fork()) == 0){
+    1c8c:	e8 4b 34 00 00       	call   50dc <fork>
+    1c91:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    1c94:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    1c98:	0f 85 b7 00 00 00    	jne    1d55 <mem+0xe9>
+        m1 = 0;
+    1c9e:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+        while((m2 = malloc(10001)) != 0){
+    1ca5:	eb 0e                	jmp    1cb5 <mem+0x49>
+            *(char**)m2 = m1;
+    1ca7:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    1caa:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    1cad:	89 10                	mov    %edx,(%eax)
+            m1 = m2;
+    1caf:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    1cb2:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        while((m2 = malloc(10001)) != 0){
+    1cb5:	83 ec 0c             	sub    $0xc,%esp
+    1cb8:	68 11 27 00 00       	push   $0x2711
+    1cbd:	e8 f3 39 00 00       	call   56b5 <malloc>
+    1cc2:	83 c4 10             	add    $0x10,%esp
+    1cc5:	89 45 e8             	mov    %eax,-0x18(%ebp)
+    1cc8:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    1ccc:	75 d9                	jne    1ca7 <mem+0x3b>
+        }
+        while(m1){
+    1cce:	eb 1c                	jmp    1cec <mem+0x80>
+            m2 = *(char**)m1;
+    1cd0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1cd3:	8b 00                	mov    (%eax),%eax
+    1cd5:	89 45 e8             	mov    %eax,-0x18(%ebp)
+            free(m1);
+    1cd8:	83 ec 0c             	sub    $0xc,%esp
+    1cdb:	ff 75 f4             	push   -0xc(%ebp)
+    1cde:	e8 90 38 00 00       	call   5573 <free>
+    1ce3:	83 c4 10             	add    $0x10,%esp
+            m1 = m2;
+    1ce6:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    1ce9:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        while(m1){
+    1cec:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    1cf0:	75 de                	jne    1cd0 <mem+0x64>
+        }
+        m1 = malloc(1024*20);
+    1cf2:	83 ec 0c             	sub    $0xc,%esp
+    1cf5:	68 00 50 00 00       	push   $0x5000
+    1cfa:	e8 b6 39 00 00       	call   56b5 <malloc>
+    1cff:	83 c4 10             	add    $0x10,%esp
+    1d02:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        if(m1 == 0){
+    1d05:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    1d09:	75 25                	jne    1d30 <mem+0xc4>
+            printf(1, "couldn't allocate mem?!!\n");
+    1d0b:	83 ec 08             	sub    $0x8,%esp
+    1d0e:	68 3e 64 00 00       	push   $0x643e
+    1d13:	6a 01                	push   $0x1
+    1d15:	e8 c7 36 00 00       	call   53e1 <printf>
+    1d1a:	83 c4 10             	add    $0x10,%esp
+            kill(ppid);
+    1d1d:	83 ec 0c             	sub    $0xc,%esp
+    1d20:	ff 75 f0             	push   -0x10(%ebp)
+    1d23:	e8 ee 33 00 00       	call   5116 <kill>
+    1d28:	83 c4 10             	add    $0x10,%esp
+            exit();
+    1d2b:	e8 b3 33 00 00       	call   50e3 <exit>
+        }
+        free(m1);
+    1d30:	83 ec 0c             	sub    $0xc,%esp
+    1d33:	ff 75 f4             	push   -0xc(%ebp)
+    1d36:	e8 38 38 00 00       	call   5573 <free>
+    1d3b:	83 c4 10             	add    $0x10,%esp
+        printf(1, "mem ok\n");
+    1d3e:	83 ec 08             	sub    $0x8,%esp
+    1d41:	68 58 64 00 00       	push   $0x6458
+    1d46:	6a 01                	push   $0x1
+    1d48:	e8 94 36 00 00       	call   53e1 <printf>
+    1d4d:	83 c4 10             	add    $0x10,%esp
+        exit();
+    1d50:	e8 8e 33 00 00       	call   50e3 <exit>
+    } else {
+        wait();
+    1d55:	e8 90 33 00 00       	call   50ea <wait>
+    }
+}
+    1d5a:	90                   	nop
+    1d5b:	c9                   	leave
+    1d5c:	c3                   	ret
+
+00001d5d <sharedfd>:
+
+// two processes write to the same file descriptor
+// is the offset shared? does inode locking work?
+void
+sharedfd(void)
+{
+    1d5d:	55                   	push   %ebp
+    1d5e:	89 e5                	mov    %esp,%ebp
+    1d60:	83 ec 38             	sub    $0x38,%esp
+    int fd, pid, i, n, nc, np;
+    char buf[10];
+
+    printf(1, "sharedfd test\n");
+    1d63:	83 ec 08             	sub    $0x8,%esp
+    1d66:	68 60 64 00 00       	push   $0x6460
+    1d6b:	6a 01                	push   $0x1
+    1d6d:	e8 6f 36 00 00       	call   53e1 <printf>
+    1d72:	83 c4 10             	add    $0x10,%esp
+
+    unlink("sharedfd");
+    1d75:	83 ec 0c             	sub    $0xc,%esp
+    1d78:	68 6f 64 00 00       	push   $0x646f
+    1d7d:	e8 bc 33 00 00       	call   513e <unlink>
+    1d82:	83 c4 10             	add    $0x10,%esp
+    fd = open("sharedfd", O_CREATE|O_RDWR);
+    1d85:	83 ec 08             	sub    $0x8,%esp
+    1d88:	68 02 02 00 00       	push   $0x202
+    1d8d:	68 6f 64 00 00       	push   $0x646f
+    1d92:	e8 93 33 00 00       	call   512a <open>
+    1d97:	83 c4 10             	add    $0x10,%esp
+    1d9a:	89 45 e8             	mov    %eax,-0x18(%ebp)
+    if(fd < 0){
+    1d9d:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    1da1:	79 17                	jns    1dba <sharedfd+0x5d>
+        printf(1, "fstests: cannot open sharedfd for writing");
+    1da3:	83 ec 08             	sub    $0x8,%esp
+    1da6:	68 78 64 00 00       	push   $0x6478
+    1dab:	6a 01                	push   $0x1
+    1dad:	e8 2f 36 00 00       	call   53e1 <printf>
+    1db2:	83 c4 10             	add    $0x10,%esp
+        return;
+    1db5:	e9 84 01 00 00       	jmp    1f3e <sharedfd+0x1e1>
+    }
+    pid = fork();
+    1dba:	e8 1d 33 00 00       	call   50dc <fork>
+    1dbf:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    memset(buf, pid==0?'c':'p', sizeof(buf));
+    1dc2:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+    1dc6:	75 07                	jne    1dcf <sharedfd+0x72>
+    1dc8:	b8 63 00 00 00       	mov    $0x63,%eax
+    1dcd:	eb 05                	jmp    1dd4 <sharedfd+0x77>
+    1dcf:	b8 70 00 00 00       	mov    $0x70,%eax
+    1dd4:	83 ec 04             	sub    $0x4,%esp
+    1dd7:	6a 0a                	push   $0xa
+    1dd9:	50                   	push   %eax
+    1dda:	8d 45 d6             	lea    -0x2a(%ebp),%eax
+    1ddd:	50                   	push   %eax
+    1dde:	e8 b2 30 00 00       	call   4e95 <memset>
+    1de3:	83 c4 10             	add    $0x10,%esp
+    for(i = 0; i < 1000; i++){
+    1de6:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    1ded:	eb 31                	jmp    1e20 <sharedfd+0xc3>
+        if(write(fd, buf, sizeof(buf)) != sizeof(buf)){
+    1def:	83 ec 04             	sub    $0x4,%esp
+    1df2:	6a 0a                	push   $0xa
+    1df4:	8d 45 d6             	lea    -0x2a(%ebp),%eax
+    1df7:	50                   	push   %eax
+    1df8:	ff 75 e8             	push   -0x18(%ebp)
+    1dfb:	e8 02 33 00 00       	call   5102 <write>
+    1e00:	83 c4 10             	add    $0x10,%esp
+    1e03:	83 f8 0a             	cmp    $0xa,%eax
+    1e06:	74 14                	je     1e1c <sharedfd+0xbf>
+            printf(1, "fstests: write sharedfd failed\n");
+    1e08:	83 ec 08             	sub    $0x8,%esp
+    1e0b:	68 a4 64 00 00       	push   $0x64a4
+    1e10:	6a 01                	push   $0x1
+    1e12:	e8 ca 35 00 00       	call   53e1 <printf>
+    1e17:	83 c4 10             	add    $0x10,%esp
+            break;
+    1e1a:	eb 0d                	jmp    1e29 <sharedfd+0xcc>
+    for(i = 0; i < 1000; i++){
+    1e1c:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    1e20:	81 7d f4 e7 03 00 00 	cmpl   $0x3e7,-0xc(%ebp)
+    1e27:	7e c6                	jle    1def <sharedfd+0x92>
+        }
+    }
+    if(pid == 0)
+    1e29:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+    1e2d:	75 05                	jne    1e34 <sharedfd+0xd7>
+        exit();
+    1e2f:	e8 af 32 00 00       	call   50e3 <exit>
+    else
+        wait();
+    1e34:	e8 b1 32 00 00       	call   50ea <wait>
+    close(fd);
+    1e39:	83 ec 0c             	sub    $0xc,%esp
+    1e3c:	ff 75 e8             	push   -0x18(%ebp)
+    1e3f:	e8 c8 32 00 00       	call   510c <close>
+    1e44:	83 c4 10             	add    $0x10,%esp
+    fd = open("sharedfd", 0);
+    1e47:	83 ec 08             	sub    $0x8,%esp
+    1e4a:	6a 00                	push   $0x0
+    1e4c:	68 6f 64 00 00       	push   $0x646f
+    1e51:	e8 d4 32 00 00       	call   512a <open>
+    1e56:	83 c4 10             	add    $0x10,%esp
+    1e59:	89 45 e8             	mov    %eax,-0x18(%ebp)
+    if(fd < 0){
+    1e5c:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    1e60:	79 17                	jns    1e79 <sharedfd+0x11c>
+        printf(1, "fstests: cannot open sharedfd for reading\n");
+    1e62:	83 ec 08             	sub    $0x8,%esp
+    1e65:	68 c4 64 00 00       	push   $0x64c4
+    1e6a:	6a 01                	push   $0x1
+    1e6c:	e8 70 35 00 00       	call   53e1 <printf>
+    1e71:	83 c4 10             	add    $0x10,%esp
+        return;
+    1e74:	e9 c5 00 00 00       	jmp    1f3e <sharedfd+0x1e1>
+    }
+    nc = np = 0;
+    1e79:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+    1e80:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    1e83:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    while((n = read(fd, buf, sizeof(buf))) > 0){
+    1e86:	eb 3b                	jmp    1ec3 <sharedfd+0x166>
+        for(i = 0; i < sizeof(buf); i++){
+    1e88:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    1e8f:	eb 2a                	jmp    1ebb <sharedfd+0x15e>
+            if(buf[i] == 'c')
+    1e91:	8d 55 d6             	lea    -0x2a(%ebp),%edx
+    1e94:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1e97:	01 d0                	add    %edx,%eax
+    1e99:	0f b6 00             	movzbl (%eax),%eax
+    1e9c:	3c 63                	cmp    $0x63,%al
+    1e9e:	75 04                	jne    1ea4 <sharedfd+0x147>
+                nc++;
+    1ea0:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+            if(buf[i] == 'p')
+    1ea4:	8d 55 d6             	lea    -0x2a(%ebp),%edx
+    1ea7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1eaa:	01 d0                	add    %edx,%eax
+    1eac:	0f b6 00             	movzbl (%eax),%eax
+    1eaf:	3c 70                	cmp    $0x70,%al
+    1eb1:	75 04                	jne    1eb7 <sharedfd+0x15a>
+                np++;
+    1eb3:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+        for(i = 0; i < sizeof(buf); i++){
+    1eb7:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    1ebb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1ebe:	83 f8 09             	cmp    $0x9,%eax
+    1ec1:	76 ce                	jbe    1e91 <sharedfd+0x134>
+    while((n = read(fd, buf, sizeof(buf))) > 0){
+    1ec3:	83 ec 04             	sub    $0x4,%esp
+    1ec6:	6a 0a                	push   $0xa
+    1ec8:	8d 45 d6             	lea    -0x2a(%ebp),%eax
+    1ecb:	50                   	push   %eax
+    1ecc:	ff 75 e8             	push   -0x18(%ebp)
+    1ecf:	e8 24 32 00 00       	call   50f8 <read>
+    1ed4:	83 c4 10             	add    $0x10,%esp
+    1ed7:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    1eda:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+    1ede:	7f a8                	jg     1e88 <sharedfd+0x12b>
+        }
+    }
+    close(fd);
+    1ee0:	83 ec 0c             	sub    $0xc,%esp
+    1ee3:	ff 75 e8             	push   -0x18(%ebp)
+    1ee6:	e8 21 32 00 00       	call   510c <close>
+    1eeb:	83 c4 10             	add    $0x10,%esp
+    unlink("sharedfd");
+    1eee:	83 ec 0c             	sub    $0xc,%esp
+    1ef1:	68 6f 64 00 00       	push   $0x646f
+    1ef6:	e8 43 32 00 00       	call   513e <unlink>
+    1efb:	83 c4 10             	add    $0x10,%esp
+    if(nc == 10000 && np == 10000){
+    1efe:	81 7d f0 10 27 00 00 	cmpl   $0x2710,-0x10(%ebp)
+    1f05:	75 1d                	jne    1f24 <sharedfd+0x1c7>
+    1f07:	81 7d ec 10 27 00 00 	cmpl   $0x2710,-0x14(%ebp)
+    1f0e:	75 14                	jne    1f24 <sharedfd+0x1c7>
+        printf(1, "sharedfd ok\n");
+    1f10:	83 ec 08             	sub    $0x8,%esp
+    1f13:	68 ef 64 00 00       	push   $0x64ef
+    1f18:	6a 01                	push   $0x1
+    1f1a:	e8 c2 34 00 00       	call   53e1 <printf>
+    1f1f:	83 c4 10             	add    $0x10,%esp
+    1f22:	eb 1a                	jmp    1f3e <sharedfd+0x1e1>
+    } else {
+        printf(1, "sharedfd oops %d %d\n", nc, np);
+    1f24:	ff 75 ec             	push   -0x14(%ebp)
+    1f27:	ff 75 f0             	push   -0x10(%ebp)
+    1f2a:	68 fc 64 00 00       	push   $0x64fc
+    1f2f:	6a 01                	push   $0x1
+    1f31:	e8 ab 34 00 00       	call   53e1 <printf>
+    1f36:	83 c4 10             	add    $0x10,%esp
+        exit();
+    1f39:	e8 a5 31 00 00       	call   50e3 <exit>
+    }
+}
+    1f3e:	c9                   	leave
+    1f3f:	c3                   	ret
+
+00001f40 <fourfiles>:
+
+// four processes write different files at the same
+// time, to test block allocation.
+void
+fourfiles(void)
+{
+    1f40:	55                   	push   %ebp
+    1f41:	89 e5                	mov    %esp,%ebp
+    1f43:	83 ec 38             	sub    $0x38,%esp
+    int fd, pid, i, j, n, total, pi;
+    char *names[] = { "f0", "f1", "f2", "f3" };
+    1f46:	c7 45 c8 11 65 00 00 	movl   $0x6511,-0x38(%ebp)
+    1f4d:	c7 45 cc 14 65 00 00 	movl   $0x6514,-0x34(%ebp)
+    1f54:	c7 45 d0 17 65 00 00 	movl   $0x6517,-0x30(%ebp)
+    1f5b:	c7 45 d4 1a 65 00 00 	movl   $0x651a,-0x2c(%ebp)
+    char *fname;
+
+    printf(1, "fourfiles test\n");
+    1f62:	83 ec 08             	sub    $0x8,%esp
+    1f65:	68 1d 65 00 00       	push   $0x651d
+    1f6a:	6a 01                	push   $0x1
+    1f6c:	e8 70 34 00 00       	call   53e1 <printf>
+    1f71:	83 c4 10             	add    $0x10,%esp
+
+    for(pi = 0; pi < 4; pi++){
+    1f74:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+    1f7b:	e9 f0 00 00 00       	jmp    2070 <fourfiles+0x130>
+        fname = names[pi];
+    1f80:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    1f83:	8b 44 85 c8          	mov    -0x38(%ebp,%eax,4),%eax
+    1f87:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        unlink(fname);
+    1f8a:	83 ec 0c             	sub    $0xc,%esp
+    1f8d:	ff 75 e4             	push   -0x1c(%ebp)
+    1f90:	e8 a9 31 00 00       	call   513e <unlink>
+    1f95:	83 c4 10             	add    $0x10,%esp
+
+        pid = fork();
+    1f98:	e8 3f 31 00 00       	call   50dc <fork>
+    1f9d:	89 45 d8             	mov    %eax,-0x28(%ebp)
+        if(pid < 0){
+    1fa0:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+    1fa4:	79 17                	jns    1fbd <fourfiles+0x7d>
+            printf(1, "fork failed\n");
+    1fa6:	83 ec 08             	sub    $0x8,%esp
+    1fa9:	68 e9 5b 00 00       	push   $0x5be9
+    1fae:	6a 01                	push   $0x1
+    1fb0:	e8 2c 34 00 00       	call   53e1 <printf>
+    1fb5:	83 c4 10             	add    $0x10,%esp
+            exit();
+    1fb8:	e8 26 31 00 00       	call   50e3 <exit>
+        }
+
+        if(pid == 0){
+    1fbd:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+    1fc1:	0f 85 a5 00 00 00    	jne    206c <fourfiles+0x12c>
+            fd = open(fname, O_CREATE | O_RDWR);
+    1fc7:	83 ec 08             	sub    $0x8,%esp
+    1fca:	68 02 02 00 00       	push   $0x202
+    1fcf:	ff 75 e4             	push   -0x1c(%ebp)
+    1fd2:	e8 53 31 00 00       	call   512a <open>
+    1fd7:	83 c4 10             	add    $0x10,%esp
+    1fda:	89 45 e0             	mov    %eax,-0x20(%ebp)
+            if(fd < 0){
+    1fdd:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+    1fe1:	79 17                	jns    1ffa <fourfiles+0xba>
+                printf(1, "create failed\n");
+    1fe3:	83 ec 08             	sub    $0x8,%esp
+    1fe6:	68 2d 65 00 00       	push   $0x652d
+    1feb:	6a 01                	push   $0x1
+    1fed:	e8 ef 33 00 00       	call   53e1 <printf>
+    1ff2:	83 c4 10             	add    $0x10,%esp
+                exit();
+    1ff5:	e8 e9 30 00 00       	call   50e3 <exit>
+            }
+
+            memset(buf, '0'+pi, 512);
+    1ffa:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    1ffd:	83 c0 30             	add    $0x30,%eax
+    2000:	83 ec 04             	sub    $0x4,%esp
+    2003:	68 00 02 00 00       	push   $0x200
+    2008:	50                   	push   %eax
+    2009:	68 a0 81 00 00       	push   $0x81a0
+    200e:	e8 82 2e 00 00       	call   4e95 <memset>
+    2013:	83 c4 10             	add    $0x10,%esp
+            for(i = 0; i < 12; i++){
+    2016:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    201d:	eb 42                	jmp    2061 <fourfiles+0x121>
+                if((n = write(fd, buf, 500)) != 500){
+    201f:	83 ec 04             	sub    $0x4,%esp
+    2022:	68 f4 01 00 00       	push   $0x1f4
+    2027:	68 a0 81 00 00       	push   $0x81a0
+    202c:	ff 75 e0             	push   -0x20(%ebp)
+    202f:	e8 ce 30 00 00       	call   5102 <write>
+    2034:	83 c4 10             	add    $0x10,%esp
+    2037:	89 45 dc             	mov    %eax,-0x24(%ebp)
+    203a:	81 7d dc f4 01 00 00 	cmpl   $0x1f4,-0x24(%ebp)
+    2041:	74 1a                	je     205d <fourfiles+0x11d>
+                    printf(1, "write failed %d\n", n);
+    2043:	83 ec 04             	sub    $0x4,%esp
+    2046:	ff 75 dc             	push   -0x24(%ebp)
+    2049:	68 3c 65 00 00       	push   $0x653c
+    204e:	6a 01                	push   $0x1
+    2050:	e8 8c 33 00 00       	call   53e1 <printf>
+    2055:	83 c4 10             	add    $0x10,%esp
+                    exit();
+    2058:	e8 86 30 00 00       	call   50e3 <exit>
+            for(i = 0; i < 12; i++){
+    205d:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    2061:	83 7d f4 0b          	cmpl   $0xb,-0xc(%ebp)
+    2065:	7e b8                	jle    201f <fourfiles+0xdf>
+                }
+            }
+            exit();
+    2067:	e8 77 30 00 00       	call   50e3 <exit>
+    for(pi = 0; pi < 4; pi++){
+    206c:	83 45 e8 01          	addl   $0x1,-0x18(%ebp)
+    2070:	83 7d e8 03          	cmpl   $0x3,-0x18(%ebp)
+    2074:	0f 8e 06 ff ff ff    	jle    1f80 <fourfiles+0x40>
+        }
+    }
+
+    for(pi = 0; pi < 4; pi++){
+    207a:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+    2081:	eb 09                	jmp    208c <fourfiles+0x14c>
+        wait();
+    2083:	e8 62 30 00 00       	call   50ea <wait>
+    for(pi = 0; pi < 4; pi++){
+    2088:	83 45 e8 01          	addl   $0x1,-0x18(%ebp)
+    208c:	83 7d e8 03          	cmpl   $0x3,-0x18(%ebp)
+    2090:	7e f1                	jle    2083 <fourfiles+0x143>
+    }
+
+    for(i = 0; i < 2; i++){
+    2092:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    2099:	e9 d4 00 00 00       	jmp    2172 <fourfiles+0x232>
+        fname = names[i];
+    209e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    20a1:	8b 44 85 c8          	mov    -0x38(%ebp,%eax,4),%eax
+    20a5:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        fd = open(fname, 0);
+    20a8:	83 ec 08             	sub    $0x8,%esp
+    20ab:	6a 00                	push   $0x0
+    20ad:	ff 75 e4             	push   -0x1c(%ebp)
+    20b0:	e8 75 30 00 00       	call   512a <open>
+    20b5:	83 c4 10             	add    $0x10,%esp
+    20b8:	89 45 e0             	mov    %eax,-0x20(%ebp)
+        total = 0;
+    20bb:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+        while((n = read(fd, buf, sizeof(buf))) > 0){
+    20c2:	eb 4a                	jmp    210e <fourfiles+0x1ce>
+            for(j = 0; j < n; j++){
+    20c4:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+    20cb:	eb 33                	jmp    2100 <fourfiles+0x1c0>
+                if(buf[j] != '0'+i){
+    20cd:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    20d0:	05 a0 81 00 00       	add    $0x81a0,%eax
+    20d5:	0f b6 00             	movzbl (%eax),%eax
+    20d8:	0f be d0             	movsbl %al,%edx
+    20db:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    20de:	83 c0 30             	add    $0x30,%eax
+    20e1:	39 c2                	cmp    %eax,%edx
+    20e3:	74 17                	je     20fc <fourfiles+0x1bc>
+                    printf(1, "wrong char\n");
+    20e5:	83 ec 08             	sub    $0x8,%esp
+    20e8:	68 4d 65 00 00       	push   $0x654d
+    20ed:	6a 01                	push   $0x1
+    20ef:	e8 ed 32 00 00       	call   53e1 <printf>
+    20f4:	83 c4 10             	add    $0x10,%esp
+                    exit();
+    20f7:	e8 e7 2f 00 00       	call   50e3 <exit>
+            for(j = 0; j < n; j++){
+    20fc:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+    2100:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    2103:	3b 45 dc             	cmp    -0x24(%ebp),%eax
+    2106:	7c c5                	jl     20cd <fourfiles+0x18d>
+                }
+            }
+            total += n;
+    2108:	8b 45 dc             	mov    -0x24(%ebp),%eax
+    210b:	01 45 ec             	add    %eax,-0x14(%ebp)
+        while((n = read(fd, buf, sizeof(buf))) > 0){
+    210e:	83 ec 04             	sub    $0x4,%esp
+    2111:	68 00 20 00 00       	push   $0x2000
+    2116:	68 a0 81 00 00       	push   $0x81a0
+    211b:	ff 75 e0             	push   -0x20(%ebp)
+    211e:	e8 d5 2f 00 00       	call   50f8 <read>
+    2123:	83 c4 10             	add    $0x10,%esp
+    2126:	89 45 dc             	mov    %eax,-0x24(%ebp)
+    2129:	83 7d dc 00          	cmpl   $0x0,-0x24(%ebp)
+    212d:	7f 95                	jg     20c4 <fourfiles+0x184>
+        }
+        close(fd);
+    212f:	83 ec 0c             	sub    $0xc,%esp
+    2132:	ff 75 e0             	push   -0x20(%ebp)
+    2135:	e8 d2 2f 00 00       	call   510c <close>
+    213a:	83 c4 10             	add    $0x10,%esp
+        if(total != 12*500){
+    213d:	81 7d ec 70 17 00 00 	cmpl   $0x1770,-0x14(%ebp)
+    2144:	74 1a                	je     2160 <fourfiles+0x220>
+            printf(1, "wrong length %d\n", total);
+    2146:	83 ec 04             	sub    $0x4,%esp
+    2149:	ff 75 ec             	push   -0x14(%ebp)
+    214c:	68 59 65 00 00       	push   $0x6559
+    2151:	6a 01                	push   $0x1
+    2153:	e8 89 32 00 00       	call   53e1 <printf>
+    2158:	83 c4 10             	add    $0x10,%esp
+            exit();
+    215b:	e8 83 2f 00 00       	call   50e3 <exit>
+        }
+        unlink(fname);
+    2160:	83 ec 0c             	sub    $0xc,%esp
+    2163:	ff 75 e4             	push   -0x1c(%ebp)
+    2166:	e8 d3 2f 00 00       	call   513e <unlink>
+    216b:	83 c4 10             	add    $0x10,%esp
+    for(i = 0; i < 2; i++){
+    216e:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    2172:	83 7d f4 01          	cmpl   $0x1,-0xc(%ebp)
+    2176:	0f 8e 22 ff ff ff    	jle    209e <fourfiles+0x15e>
+    }
+
+    printf(1, "fourfiles ok\n");
+    217c:	83 ec 08             	sub    $0x8,%esp
+    217f:	68 6a 65 00 00       	push   $0x656a
+    2184:	6a 01                	push   $0x1
+    2186:	e8 56 32 00 00       	call   53e1 <printf>
+    218b:	83 c4 10             	add    $0x10,%esp
+}
+    218e:	90                   	nop
+    218f:	c9                   	leave
+    2190:	c3                   	ret
+
+00002191 <createdelete>:
+
+// four processes create and delete different files in same directory
+void
+createdelete(void)
+{
+    2191:	55                   	push   %ebp
+    2192:	89 e5                	mov    %esp,%ebp
+    2194:	83 ec 38             	sub    $0x38,%esp
+    enum { N = 20 };
+    int pid, i, fd, pi;
+    char name[32];
+
+    printf(1, "createdelete test\n");
+    2197:	83 ec 08             	sub    $0x8,%esp
+    219a:	68 78 65 00 00       	push   $0x6578
+    219f:	6a 01                	push   $0x1
+    21a1:	e8 3b 32 00 00       	call   53e1 <printf>
+    21a6:	83 c4 10             	add    $0x10,%esp
+
+    for(pi = 0; pi < 4; pi++){
+    21a9:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+    21b0:	e9 f6 00 00 00       	jmp    22ab <createdelete+0x11a>
+        pid = fork();
+    21b5:	e8 22 2f 00 00       	call   50dc <fork>
+    21ba:	89 45 e8             	mov    %eax,-0x18(%ebp)
+        if(pid < 0){
+    21bd:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    21c1:	79 17                	jns    21da <createdelete+0x49>
+            printf(1, "fork failed\n");
+    21c3:	83 ec 08             	sub    $0x8,%esp
+    21c6:	68 e9 5b 00 00       	push   $0x5be9
+    21cb:	6a 01                	push   $0x1
+    21cd:	e8 0f 32 00 00       	call   53e1 <printf>
+    21d2:	83 c4 10             	add    $0x10,%esp
+            exit();
+    21d5:	e8 09 2f 00 00       	call   50e3 <exit>
+        }
+
+        if(pid == 0){
+    21da:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    21de:	0f 85 c3 00 00 00    	jne    22a7 <createdelete+0x116>
+            name[0] = 'p' + pi;
+    21e4:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    21e7:	83 c0 70             	add    $0x70,%eax
+    21ea:	88 45 c8             	mov    %al,-0x38(%ebp)
+            name[2] = '\0';
+    21ed:	c6 45 ca 00          	movb   $0x0,-0x36(%ebp)
+            for(i = 0; i < N; i++){
+    21f1:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    21f8:	e9 9b 00 00 00       	jmp    2298 <createdelete+0x107>
+                name[1] = '0' + i;
+    21fd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    2200:	83 c0 30             	add    $0x30,%eax
+    2203:	88 45 c9             	mov    %al,-0x37(%ebp)
+                fd = open(name, O_CREATE | O_RDWR);
+    2206:	83 ec 08             	sub    $0x8,%esp
+    2209:	68 02 02 00 00       	push   $0x202
+    220e:	8d 45 c8             	lea    -0x38(%ebp),%eax
+    2211:	50                   	push   %eax
+    2212:	e8 13 2f 00 00       	call   512a <open>
+    2217:	83 c4 10             	add    $0x10,%esp
+    221a:	89 45 ec             	mov    %eax,-0x14(%ebp)
+                if(fd < 0){
+    221d:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    2221:	79 17                	jns    223a <createdelete+0xa9>
+                    printf(1, "create failed\n");
+    2223:	83 ec 08             	sub    $0x8,%esp
+    2226:	68 2d 65 00 00       	push   $0x652d
+    222b:	6a 01                	push   $0x1
+    222d:	e8 af 31 00 00       	call   53e1 <printf>
+    2232:	83 c4 10             	add    $0x10,%esp
+                    exit();
+    2235:	e8 a9 2e 00 00       	call   50e3 <exit>
+                }
+                close(fd);
+    223a:	83 ec 0c             	sub    $0xc,%esp
+    223d:	ff 75 ec             	push   -0x14(%ebp)
+    2240:	e8 c7 2e 00 00       	call   510c <close>
+    2245:	83 c4 10             	add    $0x10,%esp
+                if(i > 0 && (i % 2 ) == 0){
+    2248:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    224c:	7e 46                	jle    2294 <createdelete+0x103>
+    224e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    2251:	83 e0 01             	and    $0x1,%eax
+    2254:	85 c0                	test   %eax,%eax
+    2256:	75 3c                	jne    2294 <createdelete+0x103>
+                    name[1] = '0' + (i / 2);
+    2258:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    225b:	89 c2                	mov    %eax,%edx
+    225d:	c1 ea 1f             	shr    $0x1f,%edx
+    2260:	01 d0                	add    %edx,%eax
+    2262:	d1 f8                	sar    %eax
+    2264:	83 c0 30             	add    $0x30,%eax
+    2267:	88 45 c9             	mov    %al,-0x37(%ebp)
+                    if(unlink(name) < 0){
+    226a:	83 ec 0c             	sub    $0xc,%esp
+    226d:	8d 45 c8             	lea    -0x38(%ebp),%eax
+    2270:	50                   	push   %eax
+    2271:	e8 c8 2e 00 00       	call   513e <unlink>
+    2276:	83 c4 10             	add    $0x10,%esp
+    2279:	85 c0                	test   %eax,%eax
+    227b:	79 17                	jns    2294 <createdelete+0x103>
+                        printf(1, "unlink failed\n");
+    227d:	83 ec 08             	sub    $0x8,%esp
+    2280:	68 6c 5c 00 00       	push   $0x5c6c
+    2285:	6a 01                	push   $0x1
+    2287:	e8 55 31 00 00       	call   53e1 <printf>
+    228c:	83 c4 10             	add    $0x10,%esp
+                        exit();
+    228f:	e8 4f 2e 00 00       	call   50e3 <exit>
+            for(i = 0; i < N; i++){
+    2294:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    2298:	83 7d f4 13          	cmpl   $0x13,-0xc(%ebp)
+    229c:	0f 8e 5b ff ff ff    	jle    21fd <createdelete+0x6c>
+                    }
+                }
+            }
+            exit();
+    22a2:	e8 3c 2e 00 00       	call   50e3 <exit>
+    for(pi = 0; pi < 4; pi++){
+    22a7:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+    22ab:	83 7d f0 03          	cmpl   $0x3,-0x10(%ebp)
+    22af:	0f 8e 00 ff ff ff    	jle    21b5 <createdelete+0x24>
+        }
+    }
+
+    for(pi = 0; pi < 4; pi++){
+    22b5:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+    22bc:	eb 09                	jmp    22c7 <createdelete+0x136>
+        wait();
+    22be:	e8 27 2e 00 00       	call   50ea <wait>
+    for(pi = 0; pi < 4; pi++){
+    22c3:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+    22c7:	83 7d f0 03          	cmpl   $0x3,-0x10(%ebp)
+    22cb:	7e f1                	jle    22be <createdelete+0x12d>
+    }
+
+    name[0] = name[1] = name[2] = 0;
+    22cd:	c6 45 ca 00          	movb   $0x0,-0x36(%ebp)
+    22d1:	0f b6 45 ca          	movzbl -0x36(%ebp),%eax
+    22d5:	88 45 c9             	mov    %al,-0x37(%ebp)
+    22d8:	0f b6 45 c9          	movzbl -0x37(%ebp),%eax
+    22dc:	88 45 c8             	mov    %al,-0x38(%ebp)
+    for(i = 0; i < N; i++){
+    22df:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    22e6:	e9 b2 00 00 00       	jmp    239d <createdelete+0x20c>
+        for(pi = 0; pi < 4; pi++){
+    22eb:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+    22f2:	e9 98 00 00 00       	jmp    238f <createdelete+0x1fe>
+            name[0] = 'p' + pi;
+    22f7:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    22fa:	83 c0 70             	add    $0x70,%eax
+    22fd:	88 45 c8             	mov    %al,-0x38(%ebp)
+            name[1] = '0' + i;
+    2300:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    2303:	83 c0 30             	add    $0x30,%eax
+    2306:	88 45 c9             	mov    %al,-0x37(%ebp)
+            fd = open(name, 0);
+    2309:	83 ec 08             	sub    $0x8,%esp
+    230c:	6a 00                	push   $0x0
+    230e:	8d 45 c8             	lea    -0x38(%ebp),%eax
+    2311:	50                   	push   %eax
+    2312:	e8 13 2e 00 00       	call   512a <open>
+    2317:	83 c4 10             	add    $0x10,%esp
+    231a:	89 45 ec             	mov    %eax,-0x14(%ebp)
+            if((i == 0 || i >= N/2) && fd < 0){
+    231d:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    2321:	74 06                	je     2329 <createdelete+0x198>
+    2323:	83 7d f4 09          	cmpl   $0x9,-0xc(%ebp)
+    2327:	7e 21                	jle    234a <createdelete+0x1b9>
+    2329:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    232d:	79 1b                	jns    234a <createdelete+0x1b9>
+                printf(1, "oops createdelete %s didn't exist\n", name);
+    232f:	83 ec 04             	sub    $0x4,%esp
+    2332:	8d 45 c8             	lea    -0x38(%ebp),%eax
+    2335:	50                   	push   %eax
+    2336:	68 8c 65 00 00       	push   $0x658c
+    233b:	6a 01                	push   $0x1
+    233d:	e8 9f 30 00 00       	call   53e1 <printf>
+    2342:	83 c4 10             	add    $0x10,%esp
+                exit();
+    2345:	e8 99 2d 00 00       	call   50e3 <exit>
+            } else if((i >= 1 && i < N/2) && fd >= 0){
+    234a:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    234e:	7e 27                	jle    2377 <createdelete+0x1e6>
+    2350:	83 7d f4 09          	cmpl   $0x9,-0xc(%ebp)
+    2354:	7f 21                	jg     2377 <createdelete+0x1e6>
+    2356:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    235a:	78 1b                	js     2377 <createdelete+0x1e6>
+                printf(1, "oops createdelete %s did exist\n", name);
+    235c:	83 ec 04             	sub    $0x4,%esp
+    235f:	8d 45 c8             	lea    -0x38(%ebp),%eax
+    2362:	50                   	push   %eax
+    2363:	68 b0 65 00 00       	push   $0x65b0
+    2368:	6a 01                	push   $0x1
+    236a:	e8 72 30 00 00       	call   53e1 <printf>
+    236f:	83 c4 10             	add    $0x10,%esp
+                exit();
+    2372:	e8 6c 2d 00 00       	call   50e3 <exit>
+            }
+            if(fd >= 0)
+    2377:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    237b:	78 0e                	js     238b <createdelete+0x1fa>
+                close(fd);
+    237d:	83 ec 0c             	sub    $0xc,%esp
+    2380:	ff 75 ec             	push   -0x14(%ebp)
+    2383:	e8 84 2d 00 00       	call   510c <close>
+    2388:	83 c4 10             	add    $0x10,%esp
+        for(pi = 0; pi < 4; pi++){
+    238b:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+    238f:	83 7d f0 03          	cmpl   $0x3,-0x10(%ebp)
+    2393:	0f 8e 5e ff ff ff    	jle    22f7 <createdelete+0x166>
+    for(i = 0; i < N; i++){
+    2399:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    239d:	83 7d f4 13          	cmpl   $0x13,-0xc(%ebp)
+    23a1:	0f 8e 44 ff ff ff    	jle    22eb <createdelete+0x15a>
+        }
+    }
+
+    for(i = 0; i < N; i++){
+    23a7:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    23ae:	eb 38                	jmp    23e8 <createdelete+0x257>
+        for(pi = 0; pi < 4; pi++){
+    23b0:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+    23b7:	eb 25                	jmp    23de <createdelete+0x24d>
+            name[0] = 'p' + i;
+    23b9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    23bc:	83 c0 70             	add    $0x70,%eax
+    23bf:	88 45 c8             	mov    %al,-0x38(%ebp)
+            name[1] = '0' + i;
+    23c2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    23c5:	83 c0 30             	add    $0x30,%eax
+    23c8:	88 45 c9             	mov    %al,-0x37(%ebp)
+            unlink(name);
+    23cb:	83 ec 0c             	sub    $0xc,%esp
+    23ce:	8d 45 c8             	lea    -0x38(%ebp),%eax
+    23d1:	50                   	push   %eax
+    23d2:	e8 67 2d 00 00       	call   513e <unlink>
+    23d7:	83 c4 10             	add    $0x10,%esp
+        for(pi = 0; pi < 4; pi++){
+    23da:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+    23de:	83 7d f0 03          	cmpl   $0x3,-0x10(%ebp)
+    23e2:	7e d5                	jle    23b9 <createdelete+0x228>
+    for(i = 0; i < N; i++){
+    23e4:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    23e8:	83 7d f4 13          	cmpl   $0x13,-0xc(%ebp)
+    23ec:	7e c2                	jle    23b0 <createdelete+0x21f>
+        }
+    }
+
+    printf(1, "createdelete ok\n");
+    23ee:	83 ec 08             	sub    $0x8,%esp
+    23f1:	68 d0 65 00 00       	push   $0x65d0
+    23f6:	6a 01                	push   $0x1
+    23f8:	e8 e4 2f 00 00       	call   53e1 <printf>
+    23fd:	83 c4 10             	add    $0x10,%esp
+}
+    2400:	90                   	nop
+    2401:	c9                   	leave
+    2402:	c3                   	ret
+
+00002403 <unlinkread>:
+
+// can I unlink a file and still read it?
+void
+unlinkread(void)
+{
+    2403:	55                   	push   %ebp
+    2404:	89 e5                	mov    %esp,%ebp
+    2406:	83 ec 18             	sub    $0x18,%esp
+    int fd, fd1;
+
+    printf(1, "unlinkread test\n");
+    2409:	83 ec 08             	sub    $0x8,%esp
+    240c:	68 e1 65 00 00       	push   $0x65e1
+    2411:	6a 01                	push   $0x1
+    2413:	e8 c9 2f 00 00       	call   53e1 <printf>
+    2418:	83 c4 10             	add    $0x10,%esp
+    fd = open("unlinkread", O_CREATE | O_RDWR);
+    241b:	83 ec 08             	sub    $0x8,%esp
+    241e:	68 02 02 00 00       	push   $0x202
+    2423:	68 f2 65 00 00       	push   $0x65f2
+    2428:	e8 fd 2c 00 00       	call   512a <open>
+    242d:	83 c4 10             	add    $0x10,%esp
+    2430:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(fd < 0){
+    2433:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    2437:	79 17                	jns    2450 <unlinkread+0x4d>
+        printf(1, "create unlinkread failed\n");
+    2439:	83 ec 08             	sub    $0x8,%esp
+    243c:	68 fd 65 00 00       	push   $0x65fd
+    2441:	6a 01                	push   $0x1
+    2443:	e8 99 2f 00 00       	call   53e1 <printf>
+    2448:	83 c4 10             	add    $0x10,%esp
+        exit();
+    244b:	e8 93 2c 00 00       	call   50e3 <exit>
+    }
+    write(fd, "hello", 5);
+    2450:	83 ec 04             	sub    $0x4,%esp
+    2453:	6a 05                	push   $0x5
+    2455:	68 17 66 00 00       	push   $0x6617
+    245a:	ff 75 f4             	push   -0xc(%ebp)
+    245d:	e8 a0 2c 00 00       	call   5102 <write>
+    2462:	83 c4 10             	add    $0x10,%esp
+    close(fd);
+    2465:	83 ec 0c             	sub    $0xc,%esp
+    2468:	ff 75 f4             	push   -0xc(%ebp)
+    246b:	e8 9c 2c 00 00       	call   510c <close>
+    2470:	83 c4 10             	add    $0x10,%esp
+
+    fd = open("unlinkread", O_RDWR);
+    2473:	83 ec 08             	sub    $0x8,%esp
+    2476:	6a 02                	push   $0x2
+    2478:	68 f2 65 00 00       	push   $0x65f2
+    247d:	e8 a8 2c 00 00       	call   512a <open>
+    2482:	83 c4 10             	add    $0x10,%esp
+    2485:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(fd < 0){
+    2488:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    248c:	79 17                	jns    24a5 <unlinkread+0xa2>
+        printf(1, "open unlinkread failed\n");
+    248e:	83 ec 08             	sub    $0x8,%esp
+    2491:	68 1d 66 00 00       	push   $0x661d
+    2496:	6a 01                	push   $0x1
+    2498:	e8 44 2f 00 00       	call   53e1 <printf>
+    249d:	83 c4 10             	add    $0x10,%esp
+        exit();
+    24a0:	e8 3e 2c 00 00       	call   50e3 <exit>
+    }
+    if(unlink("unlinkread") != 0){
+    24a5:	83 ec 0c             	sub    $0xc,%esp
+    24a8:	68 f2 65 00 00       	push   $0x65f2
+    24ad:	e8 8c 2c 00 00       	call   513e <unlink>
+    24b2:	83 c4 10             	add    $0x10,%esp
+    24b5:	85 c0                	test   %eax,%eax
+    24b7:	74 17                	je     24d0 <unlinkread+0xcd>
+        printf(1, "unlink unlinkread failed\n");
+    24b9:	83 ec 08             	sub    $0x8,%esp
+    24bc:	68 35 66 00 00       	push   $0x6635
+    24c1:	6a 01                	push   $0x1
+    24c3:	e8 19 2f 00 00       	call   53e1 <printf>
+    24c8:	83 c4 10             	add    $0x10,%esp
+        exit();
+    24cb:	e8 13 2c 00 00       	call   50e3 <exit>
+    }
+
+    fd1 = open("unlinkread", O_CREATE | O_RDWR);
+    24d0:	83 ec 08             	sub    $0x8,%esp
+    24d3:	68 02 02 00 00       	push   $0x202
+    24d8:	68 f2 65 00 00       	push   $0x65f2
+    24dd:	e8 48 2c 00 00       	call   512a <open>
+    24e2:	83 c4 10             	add    $0x10,%esp
+    24e5:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    write(fd1, "yyy", 3);
+    24e8:	83 ec 04             	sub    $0x4,%esp
+    24eb:	6a 03                	push   $0x3
+    24ed:	68 4f 66 00 00       	push   $0x664f
+    24f2:	ff 75 f0             	push   -0x10(%ebp)
+    24f5:	e8 08 2c 00 00       	call   5102 <write>
+    24fa:	83 c4 10             	add    $0x10,%esp
+    close(fd1);
+    24fd:	83 ec 0c             	sub    $0xc,%esp
+    2500:	ff 75 f0             	push   -0x10(%ebp)
+    2503:	e8 04 2c 00 00       	call   510c <close>
+    2508:	83 c4 10             	add    $0x10,%esp
+
+    if(read(fd, buf, sizeof(buf)) != 5){
+    250b:	83 ec 04             	sub    $0x4,%esp
+    250e:	68 00 20 00 00       	push   $0x2000
+    2513:	68 a0 81 00 00       	push   $0x81a0
+    2518:	ff 75 f4             	push   -0xc(%ebp)
+    251b:	e8 d8 2b 00 00       	call   50f8 <read>
+    2520:	83 c4 10             	add    $0x10,%esp
+    2523:	83 f8 05             	cmp    $0x5,%eax
+    2526:	74 17                	je     253f <unlinkread+0x13c>
+        printf(1, "unlinkread read failed");
+    2528:	83 ec 08             	sub    $0x8,%esp
+    252b:	68 53 66 00 00       	push   $0x6653
+    2530:	6a 01                	push   $0x1
+    2532:	e8 aa 2e 00 00       	call   53e1 <printf>
+    2537:	83 c4 10             	add    $0x10,%esp
+        exit();
+    253a:	e8 a4 2b 00 00       	call   50e3 <exit>
+    }
+    if(buf[0] != 'h'){
+    253f:	0f b6 05 a0 81 00 00 	movzbl 0x81a0,%eax
+    2546:	3c 68                	cmp    $0x68,%al
+    2548:	74 17                	je     2561 <unlinkread+0x15e>
+        printf(1, "unlinkread wrong data\n");
+    254a:	83 ec 08             	sub    $0x8,%esp
+    254d:	68 6a 66 00 00       	push   $0x666a
+    2552:	6a 01                	push   $0x1
+    2554:	e8 88 2e 00 00       	call   53e1 <printf>
+    2559:	83 c4 10             	add    $0x10,%esp
+        exit();
+    255c:	e8 82 2b 00 00       	call   50e3 <exit>
+    }
+    if(write(fd, buf, 10) != 10){
+    2561:	83 ec 04             	sub    $0x4,%esp
+    2564:	6a 0a                	push   $0xa
+    2566:	68 a0 81 00 00       	push   $0x81a0
+    256b:	ff 75 f4             	push   -0xc(%ebp)
+    256e:	e8 8f 2b 00 00       	call   5102 <write>
+    2573:	83 c4 10             	add    $0x10,%esp
+    2576:	83 f8 0a             	cmp    $0xa,%eax
+    2579:	74 17                	je     2592 <unlinkread+0x18f>
+        printf(1, "unlinkread write failed\n");
+    257b:	83 ec 08             	sub    $0x8,%esp
+    257e:	68 81 66 00 00       	push   $0x6681
+    2583:	6a 01                	push   $0x1
+    2585:	e8 57 2e 00 00       	call   53e1 <printf>
+    258a:	83 c4 10             	add    $0x10,%esp
+        exit();
+    258d:	e8 51 2b 00 00       	call   50e3 <exit>
+    }
+    close(fd);
+    2592:	83 ec 0c             	sub    $0xc,%esp
+    2595:	ff 75 f4             	push   -0xc(%ebp)
+    2598:	e8 6f 2b 00 00       	call   510c <close>
+    259d:	83 c4 10             	add    $0x10,%esp
+    unlink("unlinkread");
+    25a0:	83 ec 0c             	sub    $0xc,%esp
+    25a3:	68 f2 65 00 00       	push   $0x65f2
+    25a8:	e8 91 2b 00 00       	call   513e <unlink>
+    25ad:	83 c4 10             	add    $0x10,%esp
+    printf(1, "unlinkread ok\n");
+    25b0:	83 ec 08             	sub    $0x8,%esp
+    25b3:	68 9a 66 00 00       	push   $0x669a
+    25b8:	6a 01                	push   $0x1
+    25ba:	e8 22 2e 00 00       	call   53e1 <printf>
+    25bf:	83 c4 10             	add    $0x10,%esp
+}
+    25c2:	90                   	nop
+    25c3:	c9                   	leave
+    25c4:	c3                   	ret
+
+000025c5 <linktest>:
+
+void
+linktest(void)
+{
+    25c5:	55                   	push   %ebp
+    25c6:	89 e5                	mov    %esp,%ebp
+    25c8:	83 ec 18             	sub    $0x18,%esp
+    int fd;
+
+    printf(1, "linktest\n");
+    25cb:	83 ec 08             	sub    $0x8,%esp
+    25ce:	68 a9 66 00 00       	push   $0x66a9
+    25d3:	6a 01                	push   $0x1
+    25d5:	e8 07 2e 00 00       	call   53e1 <printf>
+    25da:	83 c4 10             	add    $0x10,%esp
+
+    unlink("lf1");
+    25dd:	83 ec 0c             	sub    $0xc,%esp
+    25e0:	68 b3 66 00 00       	push   $0x66b3
+    25e5:	e8 54 2b 00 00       	call   513e <unlink>
+    25ea:	83 c4 10             	add    $0x10,%esp
+    unlink("lf2");
+    25ed:	83 ec 0c             	sub    $0xc,%esp
+    25f0:	68 b7 66 00 00       	push   $0x66b7
+    25f5:	e8 44 2b 00 00       	call   513e <unlink>
+    25fa:	83 c4 10             	add    $0x10,%esp
+
+    fd = open("lf1", O_CREATE|O_RDWR);
+    25fd:	83 ec 08             	sub    $0x8,%esp
+    2600:	68 02 02 00 00       	push   $0x202
+    2605:	68 b3 66 00 00       	push   $0x66b3
+    260a:	e8 1b 2b 00 00       	call   512a <open>
+    260f:	83 c4 10             	add    $0x10,%esp
+    2612:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(fd < 0){
+    2615:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    2619:	79 17                	jns    2632 <linktest+0x6d>
+        printf(1, "create lf1 failed\n");
+    261b:	83 ec 08             	sub    $0x8,%esp
+    261e:	68 bb 66 00 00       	push   $0x66bb
+    2623:	6a 01                	push   $0x1
+    2625:	e8 b7 2d 00 00       	call   53e1 <printf>
+    262a:	83 c4 10             	add    $0x10,%esp
+        exit();
+    262d:	e8 b1 2a 00 00       	call   50e3 <exit>
+    }
+    if(write(fd, "hello", 5) != 5){
+    2632:	83 ec 04             	sub    $0x4,%esp
+    2635:	6a 05                	push   $0x5
+    2637:	68 17 66 00 00       	push   $0x6617
+    263c:	ff 75 f4             	push   -0xc(%ebp)
+    263f:	e8 be 2a 00 00       	call   5102 <write>
+    2644:	83 c4 10             	add    $0x10,%esp
+    2647:	83 f8 05             	cmp    $0x5,%eax
+    264a:	74 17                	je     2663 <linktest+0x9e>
+        printf(1, "write lf1 failed\n");
+    264c:	83 ec 08             	sub    $0x8,%esp
+    264f:	68 ce 66 00 00       	push   $0x66ce
+    2654:	6a 01                	push   $0x1
+    2656:	e8 86 2d 00 00       	call   53e1 <printf>
+    265b:	83 c4 10             	add    $0x10,%esp
+        exit();
+    265e:	e8 80 2a 00 00       	call   50e3 <exit>
+    }
+    close(fd);
+    2663:	83 ec 0c             	sub    $0xc,%esp
+    2666:	ff 75 f4             	push   -0xc(%ebp)
+    2669:	e8 9e 2a 00 00       	call   510c <close>
+    266e:	83 c4 10             	add    $0x10,%esp
+
+    if(link("lf1", "lf2") < 0){
+    2671:	83 ec 08             	sub    $0x8,%esp
+    2674:	68 b7 66 00 00       	push   $0x66b7
+    2679:	68 b3 66 00 00       	push   $0x66b3
+    267e:	e8 cf 2a 00 00       	call   5152 <link>
+    2683:	83 c4 10             	add    $0x10,%esp
+    2686:	85 c0                	test   %eax,%eax
+    2688:	79 17                	jns    26a1 <linktest+0xdc>
+        printf(1, "link lf1 lf2 failed\n");
+    268a:	83 ec 08             	sub    $0x8,%esp
+    268d:	68 e0 66 00 00       	push   $0x66e0
+    2692:	6a 01                	push   $0x1
+    2694:	e8 48 2d 00 00       	call   53e1 <printf>
+    2699:	83 c4 10             	add    $0x10,%esp
+        exit();
+    269c:	e8 42 2a 00 00       	call   50e3 <exit>
+    }
+    unlink("lf1");
+    26a1:	83 ec 0c             	sub    $0xc,%esp
+    26a4:	68 b3 66 00 00       	push   $0x66b3
+    26a9:	e8 90 2a 00 00       	call   513e <unlink>
+    26ae:	83 c4 10             	add    $0x10,%esp
+
+    if(open("lf1", 0) >= 0){
+    26b1:	83 ec 08             	sub    $0x8,%esp
+    26b4:	6a 00                	push   $0x0
+    26b6:	68 b3 66 00 00       	push   $0x66b3
+    26bb:	e8 6a 2a 00 00       	call   512a <open>
+    26c0:	83 c4 10             	add    $0x10,%esp
+    26c3:	85 c0                	test   %eax,%eax
+    26c5:	78 17                	js     26de <linktest+0x119>
+        printf(1, "unlinked lf1 but it is still there!\n");
+    26c7:	83 ec 08             	sub    $0x8,%esp
+    26ca:	68 f8 66 00 00       	push   $0x66f8
+    26cf:	6a 01                	push   $0x1
+    26d1:	e8 0b 2d 00 00       	call   53e1 <printf>
+    26d6:	83 c4 10             	add    $0x10,%esp
+        exit();
+    26d9:	e8 05 2a 00 00       	call   50e3 <exit>
+    }
+
+    fd = open("lf2", 0);
+    26de:	83 ec 08             	sub    $0x8,%esp
+    26e1:	6a 00                	push   $0x0
+    26e3:	68 b7 66 00 00       	push   $0x66b7
+    26e8:	e8 3d 2a 00 00       	call   512a <open>
+    26ed:	83 c4 10             	add    $0x10,%esp
+    26f0:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(fd < 0){
+    26f3:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    26f7:	79 17                	jns    2710 <linktest+0x14b>
+        printf(1, "open lf2 failed\n");
+    26f9:	83 ec 08             	sub    $0x8,%esp
+    26fc:	68 1d 67 00 00       	push   $0x671d
+    2701:	6a 01                	push   $0x1
+    2703:	e8 d9 2c 00 00       	call   53e1 <printf>
+    2708:	83 c4 10             	add    $0x10,%esp
+        exit();
+    270b:	e8 d3 29 00 00       	call   50e3 <exit>
+    }
+    if(read(fd, buf, sizeof(buf)) != 5){
+    2710:	83 ec 04             	sub    $0x4,%esp
+    2713:	68 00 20 00 00       	push   $0x2000
+    2718:	68 a0 81 00 00       	push   $0x81a0
+    271d:	ff 75 f4             	push   -0xc(%ebp)
+    2720:	e8 d3 29 00 00       	call   50f8 <read>
+    2725:	83 c4 10             	add    $0x10,%esp
+    2728:	83 f8 05             	cmp    $0x5,%eax
+    272b:	74 17                	je     2744 <linktest+0x17f>
+        printf(1, "read lf2 failed\n");
+    272d:	83 ec 08             	sub    $0x8,%esp
+    2730:	68 2e 67 00 00       	push   $0x672e
+    2735:	6a 01                	push   $0x1
+    2737:	e8 a5 2c 00 00       	call   53e1 <printf>
+    273c:	83 c4 10             	add    $0x10,%esp
+        exit();
+    273f:	e8 9f 29 00 00       	call   50e3 <exit>
+    }
+    close(fd);
+    2744:	83 ec 0c             	sub    $0xc,%esp
+    2747:	ff 75 f4             	push   -0xc(%ebp)
+    274a:	e8 bd 29 00 00       	call   510c <close>
+    274f:	83 c4 10             	add    $0x10,%esp
+
+    if(link("lf2", "lf2") >= 0){
+    2752:	83 ec 08             	sub    $0x8,%esp
+    2755:	68 b7 66 00 00       	push   $0x66b7
+    275a:	68 b7 66 00 00       	push   $0x66b7
+    275f:	e8 ee 29 00 00       	call   5152 <link>
+    2764:	83 c4 10             	add    $0x10,%esp
+    2767:	85 c0                	test   %eax,%eax
+    2769:	78 17                	js     2782 <linktest+0x1bd>
+        printf(1, "link lf2 lf2 succeeded! oops\n");
+    276b:	83 ec 08             	sub    $0x8,%esp
+    276e:	68 3f 67 00 00       	push   $0x673f
+    2773:	6a 01                	push   $0x1
+    2775:	e8 67 2c 00 00       	call   53e1 <printf>
+    277a:	83 c4 10             	add    $0x10,%esp
+        exit();
+    277d:	e8 61 29 00 00       	call   50e3 <exit>
+    }
+
+    unlink("lf2");
+    2782:	83 ec 0c             	sub    $0xc,%esp
+    2785:	68 b7 66 00 00       	push   $0x66b7
+    278a:	e8 af 29 00 00       	call   513e <unlink>
+    278f:	83 c4 10             	add    $0x10,%esp
+    if(link("lf2", "lf1") >= 0){
+    2792:	83 ec 08             	sub    $0x8,%esp
+    2795:	68 b3 66 00 00       	push   $0x66b3
+    279a:	68 b7 66 00 00       	push   $0x66b7
+    279f:	e8 ae 29 00 00       	call   5152 <link>
+    27a4:	83 c4 10             	add    $0x10,%esp
+    27a7:	85 c0                	test   %eax,%eax
+    27a9:	78 17                	js     27c2 <linktest+0x1fd>
+        printf(1, "link non-existant succeeded! oops\n");
+    27ab:	83 ec 08             	sub    $0x8,%esp
+    27ae:	68 60 67 00 00       	push   $0x6760
+    27b3:	6a 01                	push   $0x1
+    27b5:	e8 27 2c 00 00       	call   53e1 <printf>
+    27ba:	83 c4 10             	add    $0x10,%esp
+        exit();
+    27bd:	e8 21 29 00 00       	call   50e3 <exit>
+    }
+
+    if(link(".", "lf1") >= 0){
+    27c2:	83 ec 08             	sub    $0x8,%esp
+    27c5:	68 b3 66 00 00       	push   $0x66b3
+    27ca:	68 83 67 00 00       	push   $0x6783
+    27cf:	e8 7e 29 00 00       	call   5152 <link>
+    27d4:	83 c4 10             	add    $0x10,%esp
+    27d7:	85 c0                	test   %eax,%eax
+    27d9:	78 17                	js     27f2 <linktest+0x22d>
+        printf(1, "link . lf1 succeeded! oops\n");
+    27db:	83 ec 08             	sub    $0x8,%esp
+    27de:	68 85 67 00 00       	push   $0x6785
+    27e3:	6a 01                	push   $0x1
+    27e5:	e8 f7 2b 00 00       	call   53e1 <printf>
+    27ea:	83 c4 10             	add    $0x10,%esp
+        exit();
+    27ed:	e8 f1 28 00 00       	call   50e3 <exit>
+    }
+
+    printf(1, "linktest ok\n");
+    27f2:	83 ec 08             	sub    $0x8,%esp
+    27f5:	68 a1 67 00 00       	push   $0x67a1
+    27fa:	6a 01                	push   $0x1
+    27fc:	e8 e0 2b 00 00       	call   53e1 <printf>
+    2801:	83 c4 10             	add    $0x10,%esp
+}
+    2804:	90                   	nop
+    2805:	c9                   	leave
+    2806:	c3                   	ret
+
+00002807 <concreate>:
+
+// test concurrent create/link/unlink of the same file
+void
+concreate(void)
+{
+    2807:	55                   	push   %ebp
+    2808:	89 e5                	mov    %esp,%ebp
+    280a:	83 ec 58             	sub    $0x58,%esp
+    struct {
+        ushort inum;
+        char name[14];
+    } de;
+
+    printf(1, "concreate test\n");
+    280d:	83 ec 08             	sub    $0x8,%esp
+    2810:	68 ae 67 00 00       	push   $0x67ae
+    2815:	6a 01                	push   $0x1
+    2817:	e8 c5 2b 00 00       	call   53e1 <printf>
+    281c:	83 c4 10             	add    $0x10,%esp
+    file[0] = 'C';
+    281f:	c6 45 e5 43          	movb   $0x43,-0x1b(%ebp)
+    file[2] = '\0';
+    2823:	c6 45 e7 00          	movb   $0x0,-0x19(%ebp)
+    for(i = 0; i < 40; i++){
+    2827:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    282e:	e9 fc 00 00 00       	jmp    292f <concreate+0x128>
+        file[1] = '0' + i;
+    2833:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    2836:	83 c0 30             	add    $0x30,%eax
+    2839:	88 45 e6             	mov    %al,-0x1a(%ebp)
+        unlink(file);
+    283c:	83 ec 0c             	sub    $0xc,%esp
+    283f:	8d 45 e5             	lea    -0x1b(%ebp),%eax
+    2842:	50                   	push   %eax
+    2843:	e8 f6 28 00 00       	call   513e <unlink>
+    2848:	83 c4 10             	add    $0x10,%esp
+        pid = fork();
+    284b:	e8 8c 28 00 00       	call   50dc <fork>
+    2850:	89 45 e8             	mov    %eax,-0x18(%ebp)
+        if(pid && (i % 3) == 1){
+    2853:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    2857:	74 3b                	je     2894 <concreate+0x8d>
+    2859:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+    285c:	ba 56 55 55 55       	mov    $0x55555556,%edx
+    2861:	89 c8                	mov    %ecx,%eax
+    2863:	f7 ea                	imul   %edx
+    2865:	89 c8                	mov    %ecx,%eax
+    2867:	c1 f8 1f             	sar    $0x1f,%eax
+    286a:	29 c2                	sub    %eax,%edx
+    286c:	89 d0                	mov    %edx,%eax
+    286e:	01 c0                	add    %eax,%eax
+    2870:	01 d0                	add    %edx,%eax
+    2872:	29 c1                	sub    %eax,%ecx
+    2874:	89 ca                	mov    %ecx,%edx
+    2876:	83 fa 01             	cmp    $0x1,%edx
+    2879:	75 19                	jne    2894 <concreate+0x8d>
+            link("C0", file);
+    287b:	83 ec 08             	sub    $0x8,%esp
+    287e:	8d 45 e5             	lea    -0x1b(%ebp),%eax
+    2881:	50                   	push   %eax
+    2882:	68 be 67 00 00       	push   $0x67be
+    2887:	e8 c6 28 00 00       	call   5152 <link>
+    288c:	83 c4 10             	add    $0x10,%esp
+    288f:	e9 87 00 00 00       	jmp    291b <concreate+0x114>
+        } else if(pid == 0 && (i % 5) == 1){
+    2894:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    2898:	75 3b                	jne    28d5 <concreate+0xce>
+    289a:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+    289d:	ba 67 66 66 66       	mov    $0x66666667,%edx
+    28a2:	89 c8                	mov    %ecx,%eax
+    28a4:	f7 ea                	imul   %edx
+    28a6:	d1 fa                	sar    %edx
+    28a8:	89 c8                	mov    %ecx,%eax
+    28aa:	c1 f8 1f             	sar    $0x1f,%eax
+    28ad:	29 c2                	sub    %eax,%edx
+    28af:	89 d0                	mov    %edx,%eax
+    28b1:	c1 e0 02             	shl    $0x2,%eax
+    28b4:	01 d0                	add    %edx,%eax
+    28b6:	29 c1                	sub    %eax,%ecx
+    28b8:	89 ca                	mov    %ecx,%edx
+    28ba:	83 fa 01             	cmp    $0x1,%edx
+    28bd:	75 16                	jne    28d5 <concreate+0xce>
+            link("C0", file);
+    28bf:	83 ec 08             	sub    $0x8,%esp
+    28c2:	8d 45 e5             	lea    -0x1b(%ebp),%eax
+    28c5:	50                   	push   %eax
+    28c6:	68 be 67 00 00       	push   $0x67be
+    28cb:	e8 82 28 00 00       	call   5152 <link>
+    28d0:	83 c4 10             	add    $0x10,%esp
+    28d3:	eb 46                	jmp    291b <concreate+0x114>
+        } else {
+            fd = open(file, O_CREATE | O_RDWR);
+    28d5:	83 ec 08             	sub    $0x8,%esp
+    28d8:	68 02 02 00 00       	push   $0x202
+    28dd:	8d 45 e5             	lea    -0x1b(%ebp),%eax
+    28e0:	50                   	push   %eax
+    28e1:	e8 44 28 00 00       	call   512a <open>
+    28e6:	83 c4 10             	add    $0x10,%esp
+    28e9:	89 45 ec             	mov    %eax,-0x14(%ebp)
+            if(fd < 0){
+    28ec:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    28f0:	79 1b                	jns    290d <concreate+0x106>
+                printf(1, "concreate create %s failed\n", file);
+    28f2:	83 ec 04             	sub    $0x4,%esp
+    28f5:	8d 45 e5             	lea    -0x1b(%ebp),%eax
+    28f8:	50                   	push   %eax
+    28f9:	68 c1 67 00 00       	push   $0x67c1
+    28fe:	6a 01                	push   $0x1
+    2900:	e8 dc 2a 00 00       	call   53e1 <printf>
+    2905:	83 c4 10             	add    $0x10,%esp
+                exit();
+    2908:	e8 d6 27 00 00       	call   50e3 <exit>
+            }
+            close(fd);
+    290d:	83 ec 0c             	sub    $0xc,%esp
+    2910:	ff 75 ec             	push   -0x14(%ebp)
+    2913:	e8 f4 27 00 00       	call   510c <close>
+    2918:	83 c4 10             	add    $0x10,%esp
+        }
+        if(pid == 0)
+    291b:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    291f:	75 05                	jne    2926 <concreate+0x11f>
+            exit();
+    2921:	e8 bd 27 00 00       	call   50e3 <exit>
+        else
+            wait();
+    2926:	e8 bf 27 00 00       	call   50ea <wait>
+    for(i = 0; i < 40; i++){
+    292b:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    292f:	83 7d f4 27          	cmpl   $0x27,-0xc(%ebp)
+    2933:	0f 8e fa fe ff ff    	jle    2833 <concreate+0x2c>
+    }
+
+    memset(fa, 0, sizeof(fa));
+    2939:	83 ec 04             	sub    $0x4,%esp
+    293c:	6a 28                	push   $0x28
+    293e:	6a 00                	push   $0x0
+    2940:	8d 45 bd             	lea    -0x43(%ebp),%eax
+    2943:	50                   	push   %eax
+    2944:	e8 4c 25 00 00       	call   4e95 <memset>
+    2949:	83 c4 10             	add    $0x10,%esp
+    fd = open(".", 0);
+    294c:	83 ec 08             	sub    $0x8,%esp
+    294f:	6a 00                	push   $0x0
+    2951:	68 83 67 00 00       	push   $0x6783
+    2956:	e8 cf 27 00 00       	call   512a <open>
+    295b:	83 c4 10             	add    $0x10,%esp
+    295e:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    n = 0;
+    2961:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+    while(read(fd, &de, sizeof(de)) > 0){
+    2968:	e9 99 00 00 00       	jmp    2a06 <concreate+0x1ff>
+        if(de.inum == 0)
+    296d:	0f b7 45 ac          	movzwl -0x54(%ebp),%eax
+    2971:	66 85 c0             	test   %ax,%ax
+    2974:	0f 84 8b 00 00 00    	je     2a05 <concreate+0x1fe>
+            continue;
+        if(de.name[0] == 'C' && de.name[2] == '\0'){
+    297a:	0f b6 45 ae          	movzbl -0x52(%ebp),%eax
+    297e:	3c 43                	cmp    $0x43,%al
+    2980:	0f 85 80 00 00 00    	jne    2a06 <concreate+0x1ff>
+    2986:	0f b6 45 b0          	movzbl -0x50(%ebp),%eax
+    298a:	84 c0                	test   %al,%al
+    298c:	75 78                	jne    2a06 <concreate+0x1ff>
+            i = de.name[1] - '0';
+    298e:	0f b6 45 af          	movzbl -0x51(%ebp),%eax
+    2992:	0f be c0             	movsbl %al,%eax
+    2995:	83 e8 30             	sub    $0x30,%eax
+    2998:	89 45 f4             	mov    %eax,-0xc(%ebp)
+            if(i < 0 || i >= sizeof(fa)){
+    299b:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    299f:	78 08                	js     29a9 <concreate+0x1a2>
+    29a1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    29a4:	83 f8 27             	cmp    $0x27,%eax
+    29a7:	76 1e                	jbe    29c7 <concreate+0x1c0>
+                printf(1, "concreate weird file %s\n", de.name);
+    29a9:	83 ec 04             	sub    $0x4,%esp
+    29ac:	8d 45 ac             	lea    -0x54(%ebp),%eax
+    29af:	83 c0 02             	add    $0x2,%eax
+    29b2:	50                   	push   %eax
+    29b3:	68 dd 67 00 00       	push   $0x67dd
+    29b8:	6a 01                	push   $0x1
+    29ba:	e8 22 2a 00 00       	call   53e1 <printf>
+    29bf:	83 c4 10             	add    $0x10,%esp
+                exit();
+    29c2:	e8 1c 27 00 00       	call   50e3 <exit>
+            }
+            if(fa[i]){
+    29c7:	8d 55 bd             	lea    -0x43(%ebp),%edx
+    29ca:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    29cd:	01 d0                	add    %edx,%eax
+    29cf:	0f b6 00             	movzbl (%eax),%eax
+    29d2:	84 c0                	test   %al,%al
+    29d4:	74 1e                	je     29f4 <concreate+0x1ed>
+                printf(1, "concreate duplicate file %s\n", de.name);
+    29d6:	83 ec 04             	sub    $0x4,%esp
+    29d9:	8d 45 ac             	lea    -0x54(%ebp),%eax
+    29dc:	83 c0 02             	add    $0x2,%eax
+    29df:	50                   	push   %eax
+    29e0:	68 f6 67 00 00       	push   $0x67f6
+    29e5:	6a 01                	push   $0x1
+    29e7:	e8 f5 29 00 00       	call   53e1 <printf>
+    29ec:	83 c4 10             	add    $0x10,%esp
+                exit();
+    29ef:	e8 ef 26 00 00       	call   50e3 <exit>
+            }
+            fa[i] = 1;
+    29f4:	8d 55 bd             	lea    -0x43(%ebp),%edx
+    29f7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    29fa:	01 d0                	add    %edx,%eax
+    29fc:	c6 00 01             	movb   $0x1,(%eax)
+            n++;
+    29ff:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+    2a03:	eb 01                	jmp    2a06 <concreate+0x1ff>
+            continue;
+    2a05:	90                   	nop
+    while(read(fd, &de, sizeof(de)) > 0){
+    2a06:	83 ec 04             	sub    $0x4,%esp
+    2a09:	6a 10                	push   $0x10
+    2a0b:	8d 45 ac             	lea    -0x54(%ebp),%eax
+    2a0e:	50                   	push   %eax
+    2a0f:	ff 75 ec             	push   -0x14(%ebp)
+    2a12:	e8 e1 26 00 00       	call   50f8 <read>
+    2a17:	83 c4 10             	add    $0x10,%esp
+    2a1a:	85 c0                	test   %eax,%eax
+    2a1c:	0f 8f 4b ff ff ff    	jg     296d <concreate+0x166>
+        }
+    }
+    close(fd);
+    2a22:	83 ec 0c             	sub    $0xc,%esp
+    2a25:	ff 75 ec             	push   -0x14(%ebp)
+    2a28:	e8 df 26 00 00       	call   510c <close>
+    2a2d:	83 c4 10             	add    $0x10,%esp
+
+    if(n != 40){
+    2a30:	83 7d f0 28          	cmpl   $0x28,-0x10(%ebp)
+    2a34:	74 17                	je     2a4d <concreate+0x246>
+        printf(1, "concreate not enough files in directory listing\n");
+    2a36:	83 ec 08             	sub    $0x8,%esp
+    2a39:	68 14 68 00 00       	push   $0x6814
+    2a3e:	6a 01                	push   $0x1
+    2a40:	e8 9c 29 00 00       	call   53e1 <printf>
+    2a45:	83 c4 10             	add    $0x10,%esp
+        exit();
+    2a48:	e8 96 26 00 00       	call   50e3 <exit>
+    }
+
+    for(i = 0; i < 40; i++){
+    2a4d:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    2a54:	e9 43 01 00 00       	jmp    2b9c <concreate+0x395>
+        file[1] = '0' + i;
+    2a59:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    2a5c:	83 c0 30             	add    $0x30,%eax
+    2a5f:	88 45 e6             	mov    %al,-0x1a(%ebp)
+        pid = fork();
+    2a62:	e8 75 26 00 00       	call   50dc <fork>
+    2a67:	89 45 e8             	mov    %eax,-0x18(%ebp)
+        if(pid < 0){
+    2a6a:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    2a6e:	79 17                	jns    2a87 <concreate+0x280>
+            printf(1, "fork failed\n");
+    2a70:	83 ec 08             	sub    $0x8,%esp
+    2a73:	68 e9 5b 00 00       	push   $0x5be9
+    2a78:	6a 01                	push   $0x1
+    2a7a:	e8 62 29 00 00       	call   53e1 <printf>
+    2a7f:	83 c4 10             	add    $0x10,%esp
+            exit();
+    2a82:	e8 5c 26 00 00       	call   50e3 <exit>
+        }
+        if(((i % 3) == 0 && pid == 0) ||
+    2a87:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+    2a8a:	ba 56 55 55 55       	mov    $0x55555556,%edx
+    2a8f:	89 c8                	mov    %ecx,%eax
+    2a91:	f7 ea                	imul   %edx
+    2a93:	89 c8                	mov    %ecx,%eax
+    2a95:	c1 f8 1f             	sar    $0x1f,%eax
+    2a98:	29 c2                	sub    %eax,%edx
+    2a9a:	89 d0                	mov    %edx,%eax
+    2a9c:	01 c0                	add    %eax,%eax
+    2a9e:	01 d0                	add    %edx,%eax
+    2aa0:	29 c1                	sub    %eax,%ecx
+    2aa2:	89 ca                	mov    %ecx,%edx
+    2aa4:	85 d2                	test   %edx,%edx
+    2aa6:	75 06                	jne    2aae <concreate+0x2a7>
+    2aa8:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    2aac:	74 28                	je     2ad6 <concreate+0x2cf>
+             ((i % 3) == 1 && pid != 0)){
+    2aae:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+    2ab1:	ba 56 55 55 55       	mov    $0x55555556,%edx
+    2ab6:	89 c8                	mov    %ecx,%eax
+    2ab8:	f7 ea                	imul   %edx
+    2aba:	89 c8                	mov    %ecx,%eax
+    2abc:	c1 f8 1f             	sar    $0x1f,%eax
+    2abf:	29 c2                	sub    %eax,%edx
+    2ac1:	89 d0                	mov    %edx,%eax
+    2ac3:	01 c0                	add    %eax,%eax
+    2ac5:	01 d0                	add    %edx,%eax
+    2ac7:	29 c1                	sub    %eax,%ecx
+    2ac9:	89 ca                	mov    %ecx,%edx
+        if(((i % 3) == 0 && pid == 0) ||
+    2acb:	83 fa 01             	cmp    $0x1,%edx
+    2ace:	75 7c                	jne    2b4c <concreate+0x345>
+             ((i % 3) == 1 && pid != 0)){
+    2ad0:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    2ad4:	74 76                	je     2b4c <concreate+0x345>
+            close(open(file, 0));
+    2ad6:	83 ec 08             	sub    $0x8,%esp
+    2ad9:	6a 00                	push   $0x0
+    2adb:	8d 45 e5             	lea    -0x1b(%ebp),%eax
+    2ade:	50                   	push   %eax
+    2adf:	e8 46 26 00 00       	call   512a <open>
+    2ae4:	83 c4 10             	add    $0x10,%esp
+    2ae7:	83 ec 0c             	sub    $0xc,%esp
+    2aea:	50                   	push   %eax
+    2aeb:	e8 1c 26 00 00       	call   510c <close>
+    2af0:	83 c4 10             	add    $0x10,%esp
+            close(open(file, 0));
+    2af3:	83 ec 08             	sub    $0x8,%esp
+    2af6:	6a 00                	push   $0x0
+    2af8:	8d 45 e5             	lea    -0x1b(%ebp),%eax
+    2afb:	50                   	push   %eax
+    2afc:	e8 29 26 00 00       	call   512a <open>
+    2b01:	83 c4 10             	add    $0x10,%esp
+    2b04:	83 ec 0c             	sub    $0xc,%esp
+    2b07:	50                   	push   %eax
+    2b08:	e8 ff 25 00 00       	call   510c <close>
+    2b0d:	83 c4 10             	add    $0x10,%esp
+            close(open(file, 0));
+    2b10:	83 ec 08             	sub    $0x8,%esp
+    2b13:	6a 00                	push   $0x0
+    2b15:	8d 45 e5             	lea    -0x1b(%ebp),%eax
+    2b18:	50                   	push   %eax
+    2b19:	e8 0c 26 00 00       	call   512a <open>
+    2b1e:	83 c4 10             	add    $0x10,%esp
+    2b21:	83 ec 0c             	sub    $0xc,%esp
+    2b24:	50                   	push   %eax
+    2b25:	e8 e2 25 00 00       	call   510c <close>
+    2b2a:	83 c4 10             	add    $0x10,%esp
+            close(open(file, 0));
+    2b2d:	83 ec 08             	sub    $0x8,%esp
+    2b30:	6a 00                	push   $0x0
+    2b32:	8d 45 e5             	lea    -0x1b(%ebp),%eax
+    2b35:	50                   	push   %eax
+    2b36:	e8 ef 25 00 00       	call   512a <open>
+    2b3b:	83 c4 10             	add    $0x10,%esp
+    2b3e:	83 ec 0c             	sub    $0xc,%esp
+    2b41:	50                   	push   %eax
+    2b42:	e8 c5 25 00 00       	call   510c <close>
+    2b47:	83 c4 10             	add    $0x10,%esp
+    2b4a:	eb 3c                	jmp    2b88 <concreate+0x381>
+        } else {
+            unlink(file);
+    2b4c:	83 ec 0c             	sub    $0xc,%esp
+    2b4f:	8d 45 e5             	lea    -0x1b(%ebp),%eax
+    2b52:	50                   	push   %eax
+    2b53:	e8 e6 25 00 00       	call   513e <unlink>
+    2b58:	83 c4 10             	add    $0x10,%esp
+            unlink(file);
+    2b5b:	83 ec 0c             	sub    $0xc,%esp
+    2b5e:	8d 45 e5             	lea    -0x1b(%ebp),%eax
+    2b61:	50                   	push   %eax
+    2b62:	e8 d7 25 00 00       	call   513e <unlink>
+    2b67:	83 c4 10             	add    $0x10,%esp
+            unlink(file);
+    2b6a:	83 ec 0c             	sub    $0xc,%esp
+    2b6d:	8d 45 e5             	lea    -0x1b(%ebp),%eax
+    2b70:	50                   	push   %eax
+    2b71:	e8 c8 25 00 00       	call   513e <unlink>
+    2b76:	83 c4 10             	add    $0x10,%esp
+            unlink(file);
+    2b79:	83 ec 0c             	sub    $0xc,%esp
+    2b7c:	8d 45 e5             	lea    -0x1b(%ebp),%eax
+    2b7f:	50                   	push   %eax
+    2b80:	e8 b9 25 00 00       	call   513e <unlink>
+    2b85:	83 c4 10             	add    $0x10,%esp
+        }
+        if(pid == 0)
+    2b88:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    2b8c:	75 05                	jne    2b93 <concreate+0x38c>
+            exit();
+    2b8e:	e8 50 25 00 00       	call   50e3 <exit>
+        else
+            wait();
+    2b93:	e8 52 25 00 00       	call   50ea <wait>
+    for(i = 0; i < 40; i++){
+    2b98:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    2b9c:	83 7d f4 27          	cmpl   $0x27,-0xc(%ebp)
+    2ba0:	0f 8e b3 fe ff ff    	jle    2a59 <concreate+0x252>
+    }
+
+    printf(1, "concreate ok\n");
+    2ba6:	83 ec 08             	sub    $0x8,%esp
+    2ba9:	68 45 68 00 00       	push   $0x6845
+    2bae:	6a 01                	push   $0x1
+    2bb0:	e8 2c 28 00 00       	call   53e1 <printf>
+    2bb5:	83 c4 10             	add    $0x10,%esp
+}
+    2bb8:	90                   	nop
+    2bb9:	c9                   	leave
+    2bba:	c3                   	ret
+
+00002bbb <linkunlink>:
+
+// another concurrent link/unlink/create test,
+// to look for deadlocks.
+void
+linkunlink()
+{
+    2bbb:	55                   	push   %ebp
+    2bbc:	89 e5                	mov    %esp,%ebp
+    2bbe:	83 ec 18             	sub    $0x18,%esp
+    int pid, i;
+
+    printf(1, "linkunlink test\n");
+    2bc1:	83 ec 08             	sub    $0x8,%esp
+    2bc4:	68 53 68 00 00       	push   $0x6853
+    2bc9:	6a 01                	push   $0x1
+    2bcb:	e8 11 28 00 00       	call   53e1 <printf>
+    2bd0:	83 c4 10             	add    $0x10,%esp
+
+    unlink("x");
+    2bd3:	83 ec 0c             	sub    $0xc,%esp
+    2bd6:	68 1f 60 00 00       	push   $0x601f
+    2bdb:	e8 5e 25 00 00       	call   513e <unlink>
+    2be0:	83 c4 10             	add    $0x10,%esp
+    pid = fork();
+    2be3:	e8 f4 24 00 00       	call   50dc <fork>
+    2be8:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    if(pid < 0){
+    2beb:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    2bef:	79 17                	jns    2c08 <linkunlink+0x4d>
+        printf(1, "fork failed\n");
+    2bf1:	83 ec 08             	sub    $0x8,%esp
+    2bf4:	68 e9 5b 00 00       	push   $0x5be9
+    2bf9:	6a 01                	push   $0x1
+    2bfb:	e8 e1 27 00 00       	call   53e1 <printf>
+    2c00:	83 c4 10             	add    $0x10,%esp
+        exit();
+    2c03:	e8 db 24 00 00       	call   50e3 <exit>
+    }
+
+    unsigned int x = (pid ? 1 : 97);
+    2c08:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    2c0c:	74 07                	je     2c15 <linkunlink+0x5a>
+    2c0e:	b8 01 00 00 00       	mov    $0x1,%eax
+    2c13:	eb 05                	jmp    2c1a <linkunlink+0x5f>
+    2c15:	b8 61 00 00 00       	mov    $0x61,%eax
+    2c1a:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    for(i = 0; i < 100; i++){
+    2c1d:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    2c24:	e9 98 00 00 00       	jmp    2cc1 <linkunlink+0x106>
+        x = x * 1103515245 + 12345;
+    2c29:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    2c2c:	69 c0 6d 4e c6 41    	imul   $0x41c64e6d,%eax,%eax
+    2c32:	05 39 30 00 00       	add    $0x3039,%eax
+    2c37:	89 45 f0             	mov    %eax,-0x10(%ebp)
+        if((x % 3) == 0){
+    2c3a:	8b 4d f0             	mov    -0x10(%ebp),%ecx
+    2c3d:	ba ab aa aa aa       	mov    $0xaaaaaaab,%edx
+    2c42:	89 c8                	mov    %ecx,%eax
+    2c44:	f7 e2                	mul    %edx
+    2c46:	d1 ea                	shr    %edx
+    2c48:	89 d0                	mov    %edx,%eax
+    2c4a:	01 c0                	add    %eax,%eax
+    2c4c:	01 d0                	add    %edx,%eax
+    2c4e:	29 c1                	sub    %eax,%ecx
+    2c50:	89 ca                	mov    %ecx,%edx
+    2c52:	85 d2                	test   %edx,%edx
+    2c54:	75 23                	jne    2c79 <linkunlink+0xbe>
+            close(open("x", O_RDWR | O_CREATE));
+    2c56:	83 ec 08             	sub    $0x8,%esp
+    2c59:	68 02 02 00 00       	push   $0x202
+    2c5e:	68 1f 60 00 00       	push   $0x601f
+    2c63:	e8 c2 24 00 00       	call   512a <open>
+    2c68:	83 c4 10             	add    $0x10,%esp
+    2c6b:	83 ec 0c             	sub    $0xc,%esp
+    2c6e:	50                   	push   %eax
+    2c6f:	e8 98 24 00 00       	call   510c <close>
+    2c74:	83 c4 10             	add    $0x10,%esp
+    2c77:	eb 44                	jmp    2cbd <linkunlink+0x102>
+        } else if((x % 3) == 1){
+    2c79:	8b 4d f0             	mov    -0x10(%ebp),%ecx
+    2c7c:	ba ab aa aa aa       	mov    $0xaaaaaaab,%edx
+    2c81:	89 c8                	mov    %ecx,%eax
+    2c83:	f7 e2                	mul    %edx
+    2c85:	d1 ea                	shr    %edx
+    2c87:	89 d0                	mov    %edx,%eax
+    2c89:	01 c0                	add    %eax,%eax
+    2c8b:	01 d0                	add    %edx,%eax
+    2c8d:	29 c1                	sub    %eax,%ecx
+    2c8f:	89 ca                	mov    %ecx,%edx
+    2c91:	83 fa 01             	cmp    $0x1,%edx
+    2c94:	75 17                	jne    2cad <linkunlink+0xf2>
+            link("cat", "x");
+    2c96:	83 ec 08             	sub    $0x8,%esp
+    2c99:	68 1f 60 00 00       	push   $0x601f
+    2c9e:	68 64 68 00 00       	push   $0x6864
+    2ca3:	e8 aa 24 00 00       	call   5152 <link>
+    2ca8:	83 c4 10             	add    $0x10,%esp
+    2cab:	eb 10                	jmp    2cbd <linkunlink+0x102>
+        } else {
+            unlink("x");
+    2cad:	83 ec 0c             	sub    $0xc,%esp
+    2cb0:	68 1f 60 00 00       	push   $0x601f
+    2cb5:	e8 84 24 00 00       	call   513e <unlink>
+    2cba:	83 c4 10             	add    $0x10,%esp
+    for(i = 0; i < 100; i++){
+    2cbd:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    2cc1:	83 7d f4 63          	cmpl   $0x63,-0xc(%ebp)
+    2cc5:	0f 8e 5e ff ff ff    	jle    2c29 <linkunlink+0x6e>
+        }
+    }
+
+    if(pid)
+    2ccb:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    2ccf:	74 07                	je     2cd8 <linkunlink+0x11d>
+        wait();
+    2cd1:	e8 14 24 00 00       	call   50ea <wait>
+    2cd6:	eb 05                	jmp    2cdd <linkunlink+0x122>
+    else
+        exit();
+    2cd8:	e8 06 24 00 00       	call   50e3 <exit>
+
+    printf(1, "linkunlink ok\n");
+    2cdd:	83 ec 08             	sub    $0x8,%esp
+    2ce0:	68 68 68 00 00       	push   $0x6868
+    2ce5:	6a 01                	push   $0x1
+    2ce7:	e8 f5 26 00 00       	call   53e1 <printf>
+    2cec:	83 c4 10             	add    $0x10,%esp
+}
+    2cef:	90                   	nop
+    2cf0:	c9                   	leave
+    2cf1:	c3                   	ret
+
+00002cf2 <bigdir>:
+
+// directory that uses indirect blocks
+void
+bigdir(void)
+{
+    2cf2:	55                   	push   %ebp
+    2cf3:	89 e5                	mov    %esp,%ebp
+    2cf5:	83 ec 28             	sub    $0x28,%esp
+    int i, fd;
+    char name[10];
+
+    printf(1, "bigdir test\n");
+    2cf8:	83 ec 08             	sub    $0x8,%esp
+    2cfb:	68 77 68 00 00       	push   $0x6877
+    2d00:	6a 01                	push   $0x1
+    2d02:	e8 da 26 00 00       	call   53e1 <printf>
+    2d07:	83 c4 10             	add    $0x10,%esp
+    unlink("bd");
+    2d0a:	83 ec 0c             	sub    $0xc,%esp
+    2d0d:	68 84 68 00 00       	push   $0x6884
+    2d12:	e8 27 24 00 00       	call   513e <unlink>
+    2d17:	83 c4 10             	add    $0x10,%esp
+
+    fd = open("bd", O_CREATE);
+    2d1a:	83 ec 08             	sub    $0x8,%esp
+    2d1d:	68 00 02 00 00       	push   $0x200
+    2d22:	68 84 68 00 00       	push   $0x6884
+    2d27:	e8 fe 23 00 00       	call   512a <open>
+    2d2c:	83 c4 10             	add    $0x10,%esp
+    2d2f:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(fd < 0){
+    2d32:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    2d36:	79 17                	jns    2d4f <bigdir+0x5d>
+        printf(1, "bigdir create failed\n");
+    2d38:	83 ec 08             	sub    $0x8,%esp
+    2d3b:	68 87 68 00 00       	push   $0x6887
+    2d40:	6a 01                	push   $0x1
+    2d42:	e8 9a 26 00 00       	call   53e1 <printf>
+    2d47:	83 c4 10             	add    $0x10,%esp
+        exit();
+    2d4a:	e8 94 23 00 00       	call   50e3 <exit>
+    }
+    close(fd);
+    2d4f:	83 ec 0c             	sub    $0xc,%esp
+    2d52:	ff 75 f0             	push   -0x10(%ebp)
+    2d55:	e8 b2 23 00 00       	call   510c <close>
+    2d5a:	83 c4 10             	add    $0x10,%esp
+
+    for(i = 0; i < 500; i++){
+    2d5d:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    2d64:	eb 69                	jmp    2dcf <bigdir+0xdd>
+        name[0] = 'x';
+    2d66:	c6 45 e6 78          	movb   $0x78,-0x1a(%ebp)
+        name[1] = '0' + (i / 64);
+    2d6a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    2d6d:	8d 50 3f             	lea    0x3f(%eax),%edx
+    2d70:	85 c0                	test   %eax,%eax
+    2d72:	0f 48 c2             	cmovs  %edx,%eax
+    2d75:	c1 f8 06             	sar    $0x6,%eax
+    2d78:	83 c0 30             	add    $0x30,%eax
+    2d7b:	88 45 e7             	mov    %al,-0x19(%ebp)
+        name[2] = '0' + (i % 64);
+    2d7e:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    2d81:	89 d0                	mov    %edx,%eax
+    2d83:	c1 f8 1f             	sar    $0x1f,%eax
+    2d86:	c1 e8 1a             	shr    $0x1a,%eax
+    2d89:	01 c2                	add    %eax,%edx
+    2d8b:	83 e2 3f             	and    $0x3f,%edx
+    2d8e:	29 c2                	sub    %eax,%edx
+    2d90:	89 d0                	mov    %edx,%eax
+    2d92:	83 c0 30             	add    $0x30,%eax
+    2d95:	88 45 e8             	mov    %al,-0x18(%ebp)
+        name[3] = '\0';
+    2d98:	c6 45 e9 00          	movb   $0x0,-0x17(%ebp)
+        if(link("bd", name) != 0){
+    2d9c:	83 ec 08             	sub    $0x8,%esp
+    2d9f:	8d 45 e6             	lea    -0x1a(%ebp),%eax
+    2da2:	50                   	push   %eax
+    2da3:	68 84 68 00 00       	push   $0x6884
+    2da8:	e8 a5 23 00 00       	call   5152 <link>
+    2dad:	83 c4 10             	add    $0x10,%esp
+    2db0:	85 c0                	test   %eax,%eax
+    2db2:	74 17                	je     2dcb <bigdir+0xd9>
+            printf(1, "bigdir link failed\n");
+    2db4:	83 ec 08             	sub    $0x8,%esp
+    2db7:	68 9d 68 00 00       	push   $0x689d
+    2dbc:	6a 01                	push   $0x1
+    2dbe:	e8 1e 26 00 00       	call   53e1 <printf>
+    2dc3:	83 c4 10             	add    $0x10,%esp
+            exit();
+    2dc6:	e8 18 23 00 00       	call   50e3 <exit>
+    for(i = 0; i < 500; i++){
+    2dcb:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    2dcf:	81 7d f4 f3 01 00 00 	cmpl   $0x1f3,-0xc(%ebp)
+    2dd6:	7e 8e                	jle    2d66 <bigdir+0x74>
+        }
+    }
+
+    unlink("bd");
+    2dd8:	83 ec 0c             	sub    $0xc,%esp
+    2ddb:	68 84 68 00 00       	push   $0x6884
+    2de0:	e8 59 23 00 00       	call   513e <unlink>
+    2de5:	83 c4 10             	add    $0x10,%esp
+    for(i = 0; i < 500; i++){
+    2de8:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    2def:	eb 64                	jmp    2e55 <bigdir+0x163>
+        name[0] = 'x';
+    2df1:	c6 45 e6 78          	movb   $0x78,-0x1a(%ebp)
+        name[1] = '0' + (i / 64);
+    2df5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    2df8:	8d 50 3f             	lea    0x3f(%eax),%edx
+    2dfb:	85 c0                	test   %eax,%eax
+    2dfd:	0f 48 c2             	cmovs  %edx,%eax
+    2e00:	c1 f8 06             	sar    $0x6,%eax
+    2e03:	83 c0 30             	add    $0x30,%eax
+    2e06:	88 45 e7             	mov    %al,-0x19(%ebp)
+        name[2] = '0' + (i % 64);
+    2e09:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    2e0c:	89 d0                	mov    %edx,%eax
+    2e0e:	c1 f8 1f             	sar    $0x1f,%eax
+    2e11:	c1 e8 1a             	shr    $0x1a,%eax
+    2e14:	01 c2                	add    %eax,%edx
+    2e16:	83 e2 3f             	and    $0x3f,%edx
+    2e19:	29 c2                	sub    %eax,%edx
+    2e1b:	89 d0                	mov    %edx,%eax
+    2e1d:	83 c0 30             	add    $0x30,%eax
+    2e20:	88 45 e8             	mov    %al,-0x18(%ebp)
+        name[3] = '\0';
+    2e23:	c6 45 e9 00          	movb   $0x0,-0x17(%ebp)
+        if(unlink(name) != 0){
+    2e27:	83 ec 0c             	sub    $0xc,%esp
+    2e2a:	8d 45 e6             	lea    -0x1a(%ebp),%eax
+    2e2d:	50                   	push   %eax
+    2e2e:	e8 0b 23 00 00       	call   513e <unlink>
+    2e33:	83 c4 10             	add    $0x10,%esp
+    2e36:	85 c0                	test   %eax,%eax
+    2e38:	74 17                	je     2e51 <bigdir+0x15f>
+            printf(1, "bigdir unlink failed");
+    2e3a:	83 ec 08             	sub    $0x8,%esp
+    2e3d:	68 b1 68 00 00       	push   $0x68b1
+    2e42:	6a 01                	push   $0x1
+    2e44:	e8 98 25 00 00       	call   53e1 <printf>
+    2e49:	83 c4 10             	add    $0x10,%esp
+            exit();
+    2e4c:	e8 92 22 00 00       	call   50e3 <exit>
+    for(i = 0; i < 500; i++){
+    2e51:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    2e55:	81 7d f4 f3 01 00 00 	cmpl   $0x1f3,-0xc(%ebp)
+    2e5c:	7e 93                	jle    2df1 <bigdir+0xff>
+        }
+    }
+
+    printf(1, "bigdir ok\n");
+    2e5e:	83 ec 08             	sub    $0x8,%esp
+    2e61:	68 c6 68 00 00       	push   $0x68c6
+    2e66:	6a 01                	push   $0x1
+    2e68:	e8 74 25 00 00       	call   53e1 <printf>
+    2e6d:	83 c4 10             	add    $0x10,%esp
+}
+    2e70:	90                   	nop
+    2e71:	c9                   	leave
+    2e72:	c3                   	ret
+
+00002e73 <subdir>:
+
+void
+subdir(void)
+{
+    2e73:	55                   	push   %ebp
+    2e74:	89 e5                	mov    %esp,%ebp
+    2e76:	83 ec 18             	sub    $0x18,%esp
+    int fd, cc;
+
+    printf(1, "subdir test\n");
+    2e79:	83 ec 08             	sub    $0x8,%esp
+    2e7c:	68 d1 68 00 00       	push   $0x68d1
+    2e81:	6a 01                	push   $0x1
+    2e83:	e8 59 25 00 00       	call   53e1 <printf>
+    2e88:	83 c4 10             	add    $0x10,%esp
+
+    unlink("ff");
+    2e8b:	83 ec 0c             	sub    $0xc,%esp
+    2e8e:	68 de 68 00 00       	push   $0x68de
+    2e93:	e8 a6 22 00 00       	call   513e <unlink>
+    2e98:	83 c4 10             	add    $0x10,%esp
+    if(mkdir("dd") != 0){
+    2e9b:	83 ec 0c             	sub    $0xc,%esp
+    2e9e:	68 e1 68 00 00       	push   $0x68e1
+    2ea3:	e8 b4 22 00 00       	call   515c <mkdir>
+    2ea8:	83 c4 10             	add    $0x10,%esp
+    2eab:	85 c0                	test   %eax,%eax
+    2ead:	74 17                	je     2ec6 <subdir+0x53>
+        printf(1, "subdir mkdir dd failed\n");
+    2eaf:	83 ec 08             	sub    $0x8,%esp
+    2eb2:	68 e4 68 00 00       	push   $0x68e4
+    2eb7:	6a 01                	push   $0x1
+    2eb9:	e8 23 25 00 00       	call   53e1 <printf>
+    2ebe:	83 c4 10             	add    $0x10,%esp
+        exit();
+    2ec1:	e8 1d 22 00 00       	call   50e3 <exit>
+    }
+
+    fd = open("dd/ff", O_CREATE | O_RDWR);
+    2ec6:	83 ec 08             	sub    $0x8,%esp
+    2ec9:	68 02 02 00 00       	push   $0x202
+    2ece:	68 fc 68 00 00       	push   $0x68fc
+    2ed3:	e8 52 22 00 00       	call   512a <open>
+    2ed8:	83 c4 10             	add    $0x10,%esp
+    2edb:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(fd < 0){
+    2ede:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    2ee2:	79 17                	jns    2efb <subdir+0x88>
+        printf(1, "create dd/ff failed\n");
+    2ee4:	83 ec 08             	sub    $0x8,%esp
+    2ee7:	68 02 69 00 00       	push   $0x6902
+    2eec:	6a 01                	push   $0x1
+    2eee:	e8 ee 24 00 00       	call   53e1 <printf>
+    2ef3:	83 c4 10             	add    $0x10,%esp
+        exit();
+    2ef6:	e8 e8 21 00 00       	call   50e3 <exit>
+    }
+    write(fd, "ff", 2);
+    2efb:	83 ec 04             	sub    $0x4,%esp
+    2efe:	6a 02                	push   $0x2
+    2f00:	68 de 68 00 00       	push   $0x68de
+    2f05:	ff 75 f4             	push   -0xc(%ebp)
+    2f08:	e8 f5 21 00 00       	call   5102 <write>
+    2f0d:	83 c4 10             	add    $0x10,%esp
+    close(fd);
+    2f10:	83 ec 0c             	sub    $0xc,%esp
+    2f13:	ff 75 f4             	push   -0xc(%ebp)
+    2f16:	e8 f1 21 00 00       	call   510c <close>
+    2f1b:	83 c4 10             	add    $0x10,%esp
+
+    if(unlink("dd") >= 0){
+    2f1e:	83 ec 0c             	sub    $0xc,%esp
+    2f21:	68 e1 68 00 00       	push   $0x68e1
+    2f26:	e8 13 22 00 00       	call   513e <unlink>
+    2f2b:	83 c4 10             	add    $0x10,%esp
+    2f2e:	85 c0                	test   %eax,%eax
+    2f30:	78 17                	js     2f49 <subdir+0xd6>
+        printf(1, "unlink dd (non-empty dir) succeeded!\n");
+    2f32:	83 ec 08             	sub    $0x8,%esp
+    2f35:	68 18 69 00 00       	push   $0x6918
+    2f3a:	6a 01                	push   $0x1
+    2f3c:	e8 a0 24 00 00       	call   53e1 <printf>
+    2f41:	83 c4 10             	add    $0x10,%esp
+        exit();
+    2f44:	e8 9a 21 00 00       	call   50e3 <exit>
+    }
+
+    if(mkdir("/dd/dd") != 0){
+    2f49:	83 ec 0c             	sub    $0xc,%esp
+    2f4c:	68 3e 69 00 00       	push   $0x693e
+    2f51:	e8 06 22 00 00       	call   515c <mkdir>
+    2f56:	83 c4 10             	add    $0x10,%esp
+    2f59:	85 c0                	test   %eax,%eax
+    2f5b:	74 17                	je     2f74 <subdir+0x101>
+        printf(1, "subdir mkdir dd/dd failed\n");
+    2f5d:	83 ec 08             	sub    $0x8,%esp
+    2f60:	68 45 69 00 00       	push   $0x6945
+    2f65:	6a 01                	push   $0x1
+    2f67:	e8 75 24 00 00       	call   53e1 <printf>
+    2f6c:	83 c4 10             	add    $0x10,%esp
+        exit();
+    2f6f:	e8 6f 21 00 00       	call   50e3 <exit>
+    }
+
+    fd = open("dd/dd/ff", O_CREATE | O_RDWR);
+    2f74:	83 ec 08             	sub    $0x8,%esp
+    2f77:	68 02 02 00 00       	push   $0x202
+    2f7c:	68 60 69 00 00       	push   $0x6960
+    2f81:	e8 a4 21 00 00       	call   512a <open>
+    2f86:	83 c4 10             	add    $0x10,%esp
+    2f89:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(fd < 0){
+    2f8c:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    2f90:	79 17                	jns    2fa9 <subdir+0x136>
+        printf(1, "create dd/dd/ff failed\n");
+    2f92:	83 ec 08             	sub    $0x8,%esp
+    2f95:	68 69 69 00 00       	push   $0x6969
+    2f9a:	6a 01                	push   $0x1
+    2f9c:	e8 40 24 00 00       	call   53e1 <printf>
+    2fa1:	83 c4 10             	add    $0x10,%esp
+        exit();
+    2fa4:	e8 3a 21 00 00       	call   50e3 <exit>
+    }
+    write(fd, "FF", 2);
+    2fa9:	83 ec 04             	sub    $0x4,%esp
+    2fac:	6a 02                	push   $0x2
+    2fae:	68 81 69 00 00       	push   $0x6981
+    2fb3:	ff 75 f4             	push   -0xc(%ebp)
+    2fb6:	e8 47 21 00 00       	call   5102 <write>
+    2fbb:	83 c4 10             	add    $0x10,%esp
+    close(fd);
+    2fbe:	83 ec 0c             	sub    $0xc,%esp
+    2fc1:	ff 75 f4             	push   -0xc(%ebp)
+    2fc4:	e8 43 21 00 00       	call   510c <close>
+    2fc9:	83 c4 10             	add    $0x10,%esp
+
+    fd = open("dd/dd/../ff", 0);
+    2fcc:	83 ec 08             	sub    $0x8,%esp
+    2fcf:	6a 00                	push   $0x0
+    2fd1:	68 84 69 00 00       	push   $0x6984
+    2fd6:	e8 4f 21 00 00       	call   512a <open>
+    2fdb:	83 c4 10             	add    $0x10,%esp
+    2fde:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(fd < 0){
+    2fe1:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    2fe5:	79 17                	jns    2ffe <subdir+0x18b>
+        printf(1, "open dd/dd/../ff failed\n");
+    2fe7:	83 ec 08             	sub    $0x8,%esp
+    2fea:	68 90 69 00 00       	push   $0x6990
+    2fef:	6a 01                	push   $0x1
+    2ff1:	e8 eb 23 00 00       	call   53e1 <printf>
+    2ff6:	83 c4 10             	add    $0x10,%esp
+        exit();
+    2ff9:	e8 e5 20 00 00       	call   50e3 <exit>
+    }
+    cc = read(fd, buf, sizeof(buf));
+    2ffe:	83 ec 04             	sub    $0x4,%esp
+    3001:	68 00 20 00 00       	push   $0x2000
+    3006:	68 a0 81 00 00       	push   $0x81a0
+    300b:	ff 75 f4             	push   -0xc(%ebp)
+    300e:	e8 e5 20 00 00       	call   50f8 <read>
+    3013:	83 c4 10             	add    $0x10,%esp
+    3016:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(cc != 2 || buf[0] != 'f'){
+    3019:	83 7d f0 02          	cmpl   $0x2,-0x10(%ebp)
+    301d:	75 0b                	jne    302a <subdir+0x1b7>
+    301f:	0f b6 05 a0 81 00 00 	movzbl 0x81a0,%eax
+    3026:	3c 66                	cmp    $0x66,%al
+    3028:	74 17                	je     3041 <subdir+0x1ce>
+        printf(1, "dd/dd/../ff wrong content\n");
+    302a:	83 ec 08             	sub    $0x8,%esp
+    302d:	68 a9 69 00 00       	push   $0x69a9
+    3032:	6a 01                	push   $0x1
+    3034:	e8 a8 23 00 00       	call   53e1 <printf>
+    3039:	83 c4 10             	add    $0x10,%esp
+        exit();
+    303c:	e8 a2 20 00 00       	call   50e3 <exit>
+    }
+    close(fd);
+    3041:	83 ec 0c             	sub    $0xc,%esp
+    3044:	ff 75 f4             	push   -0xc(%ebp)
+    3047:	e8 c0 20 00 00       	call   510c <close>
+    304c:	83 c4 10             	add    $0x10,%esp
+
+    if(link("dd/dd/ff", "dd/dd/ffff") != 0){
+    304f:	83 ec 08             	sub    $0x8,%esp
+    3052:	68 c4 69 00 00       	push   $0x69c4
+    3057:	68 60 69 00 00       	push   $0x6960
+    305c:	e8 f1 20 00 00       	call   5152 <link>
+    3061:	83 c4 10             	add    $0x10,%esp
+    3064:	85 c0                	test   %eax,%eax
+    3066:	74 17                	je     307f <subdir+0x20c>
+        printf(1, "link dd/dd/ff dd/dd/ffff failed\n");
+    3068:	83 ec 08             	sub    $0x8,%esp
+    306b:	68 d0 69 00 00       	push   $0x69d0
+    3070:	6a 01                	push   $0x1
+    3072:	e8 6a 23 00 00       	call   53e1 <printf>
+    3077:	83 c4 10             	add    $0x10,%esp
+        exit();
+    307a:	e8 64 20 00 00       	call   50e3 <exit>
+    }
+
+    if(unlink("dd/dd/ff") != 0){
+    307f:	83 ec 0c             	sub    $0xc,%esp
+    3082:	68 60 69 00 00       	push   $0x6960
+    3087:	e8 b2 20 00 00       	call   513e <unlink>
+    308c:	83 c4 10             	add    $0x10,%esp
+    308f:	85 c0                	test   %eax,%eax
+    3091:	74 17                	je     30aa <subdir+0x237>
+        printf(1, "unlink dd/dd/ff failed\n");
+    3093:	83 ec 08             	sub    $0x8,%esp
+    3096:	68 f1 69 00 00       	push   $0x69f1
+    309b:	6a 01                	push   $0x1
+    309d:	e8 3f 23 00 00       	call   53e1 <printf>
+    30a2:	83 c4 10             	add    $0x10,%esp
+        exit();
+    30a5:	e8 39 20 00 00       	call   50e3 <exit>
+    }
+    if(open("dd/dd/ff", O_RDONLY) >= 0){
+    30aa:	83 ec 08             	sub    $0x8,%esp
+    30ad:	6a 00                	push   $0x0
+    30af:	68 60 69 00 00       	push   $0x6960
+    30b4:	e8 71 20 00 00       	call   512a <open>
+    30b9:	83 c4 10             	add    $0x10,%esp
+    30bc:	85 c0                	test   %eax,%eax
+    30be:	78 17                	js     30d7 <subdir+0x264>
+        printf(1, "open (unlinked) dd/dd/ff succeeded\n");
+    30c0:	83 ec 08             	sub    $0x8,%esp
+    30c3:	68 0c 6a 00 00       	push   $0x6a0c
+    30c8:	6a 01                	push   $0x1
+    30ca:	e8 12 23 00 00       	call   53e1 <printf>
+    30cf:	83 c4 10             	add    $0x10,%esp
+        exit();
+    30d2:	e8 0c 20 00 00       	call   50e3 <exit>
+    }
+
+    if(chdir("dd") != 0){
+    30d7:	83 ec 0c             	sub    $0xc,%esp
+    30da:	68 e1 68 00 00       	push   $0x68e1
+    30df:	e8 82 20 00 00       	call   5166 <chdir>
+    30e4:	83 c4 10             	add    $0x10,%esp
+    30e7:	85 c0                	test   %eax,%eax
+    30e9:	74 17                	je     3102 <subdir+0x28f>
+        printf(1, "chdir dd failed\n");
+    30eb:	83 ec 08             	sub    $0x8,%esp
+    30ee:	68 30 6a 00 00       	push   $0x6a30
+    30f3:	6a 01                	push   $0x1
+    30f5:	e8 e7 22 00 00       	call   53e1 <printf>
+    30fa:	83 c4 10             	add    $0x10,%esp
+        exit();
+    30fd:	e8 e1 1f 00 00       	call   50e3 <exit>
+    }
+    if(chdir("dd/../../dd") != 0){
+    3102:	83 ec 0c             	sub    $0xc,%esp
+    3105:	68 41 6a 00 00       	push   $0x6a41
+    310a:	e8 57 20 00 00       	call   5166 <chdir>
+    310f:	83 c4 10             	add    $0x10,%esp
+    3112:	85 c0                	test   %eax,%eax
+    3114:	74 17                	je     312d <subdir+0x2ba>
+        printf(1, "chdir dd/../../dd failed\n");
+    3116:	83 ec 08             	sub    $0x8,%esp
+    3119:	68 4d 6a 00 00       	push   $0x6a4d
+    311e:	6a 01                	push   $0x1
+    3120:	e8 bc 22 00 00       	call   53e1 <printf>
+    3125:	83 c4 10             	add    $0x10,%esp
+        exit();
+    3128:	e8 b6 1f 00 00       	call   50e3 <exit>
+    }
+    if(chdir("dd/../../../dd") != 0){
+    312d:	83 ec 0c             	sub    $0xc,%esp
+    3130:	68 67 6a 00 00       	push   $0x6a67
+    3135:	e8 2c 20 00 00       	call   5166 <chdir>
+    313a:	83 c4 10             	add    $0x10,%esp
+    313d:	85 c0                	test   %eax,%eax
+    313f:	74 17                	je     3158 <subdir+0x2e5>
+        printf(1, "chdir dd/../../dd failed\n");
+    3141:	83 ec 08             	sub    $0x8,%esp
+    3144:	68 4d 6a 00 00       	push   $0x6a4d
+    3149:	6a 01                	push   $0x1
+    314b:	e8 91 22 00 00       	call   53e1 <printf>
+    3150:	83 c4 10             	add    $0x10,%esp
+        exit();
+    3153:	e8 8b 1f 00 00       	call   50e3 <exit>
+    }
+    if(chdir("./..") != 0){
+    3158:	83 ec 0c             	sub    $0xc,%esp
+    315b:	68 76 6a 00 00       	push   $0x6a76
+    3160:	e8 01 20 00 00       	call   5166 <chdir>
+    3165:	83 c4 10             	add    $0x10,%esp
+    3168:	85 c0                	test   %eax,%eax
+    316a:	74 17                	je     3183 <subdir+0x310>
+        printf(1, "chdir ./.. failed\n");
+    316c:	83 ec 08             	sub    $0x8,%esp
+    316f:	68 7b 6a 00 00       	push   $0x6a7b
+    3174:	6a 01                	push   $0x1
+    3176:	e8 66 22 00 00       	call   53e1 <printf>
+    317b:	83 c4 10             	add    $0x10,%esp
+        exit();
+    317e:	e8 60 1f 00 00       	call   50e3 <exit>
+    }
+
+    fd = open("dd/dd/ffff", 0);
+    3183:	83 ec 08             	sub    $0x8,%esp
+    3186:	6a 00                	push   $0x0
+    3188:	68 c4 69 00 00       	push   $0x69c4
+    318d:	e8 98 1f 00 00       	call   512a <open>
+    3192:	83 c4 10             	add    $0x10,%esp
+    3195:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(fd < 0){
+    3198:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    319c:	79 17                	jns    31b5 <subdir+0x342>
+        printf(1, "open dd/dd/ffff failed\n");
+    319e:	83 ec 08             	sub    $0x8,%esp
+    31a1:	68 8e 6a 00 00       	push   $0x6a8e
+    31a6:	6a 01                	push   $0x1
+    31a8:	e8 34 22 00 00       	call   53e1 <printf>
+    31ad:	83 c4 10             	add    $0x10,%esp
+        exit();
+    31b0:	e8 2e 1f 00 00       	call   50e3 <exit>
+    }
+    if(read(fd, buf, sizeof(buf)) != 2){
+    31b5:	83 ec 04             	sub    $0x4,%esp
+    31b8:	68 00 20 00 00       	push   $0x2000
+    31bd:	68 a0 81 00 00       	push   $0x81a0
+    31c2:	ff 75 f4             	push   -0xc(%ebp)
+    31c5:	e8 2e 1f 00 00       	call   50f8 <read>
+    31ca:	83 c4 10             	add    $0x10,%esp
+    31cd:	83 f8 02             	cmp    $0x2,%eax
+    31d0:	74 17                	je     31e9 <subdir+0x376>
+        printf(1, "read dd/dd/ffff wrong len\n");
+    31d2:	83 ec 08             	sub    $0x8,%esp
+    31d5:	68 a6 6a 00 00       	push   $0x6aa6
+    31da:	6a 01                	push   $0x1
+    31dc:	e8 00 22 00 00       	call   53e1 <printf>
+    31e1:	83 c4 10             	add    $0x10,%esp
+        exit();
+    31e4:	e8 fa 1e 00 00       	call   50e3 <exit>
+    }
+    close(fd);
+    31e9:	83 ec 0c             	sub    $0xc,%esp
+    31ec:	ff 75 f4             	push   -0xc(%ebp)
+    31ef:	e8 18 1f 00 00       	call   510c <close>
+    31f4:	83 c4 10             	add    $0x10,%esp
+
+    if(open("dd/dd/ff", O_RDONLY) >= 0){
+    31f7:	83 ec 08             	sub    $0x8,%esp
+    31fa:	6a 00                	push   $0x0
+    31fc:	68 60 69 00 00       	push   $0x6960
+    3201:	e8 24 1f 00 00       	call   512a <open>
+    3206:	83 c4 10             	add    $0x10,%esp
+    3209:	85 c0                	test   %eax,%eax
+    320b:	78 17                	js     3224 <subdir+0x3b1>
+        printf(1, "open (unlinked) dd/dd/ff succeeded!\n");
+    320d:	83 ec 08             	sub    $0x8,%esp
+    3210:	68 c4 6a 00 00       	push   $0x6ac4
+    3215:	6a 01                	push   $0x1
+    3217:	e8 c5 21 00 00       	call   53e1 <printf>
+    321c:	83 c4 10             	add    $0x10,%esp
+        exit();
+    321f:	e8 bf 1e 00 00       	call   50e3 <exit>
+    }
+
+    if(open("dd/ff/ff", O_CREATE|O_RDWR) >= 0){
+    3224:	83 ec 08             	sub    $0x8,%esp
+    3227:	68 02 02 00 00       	push   $0x202
+    322c:	68 e9 6a 00 00       	push   $0x6ae9
+    3231:	e8 f4 1e 00 00       	call   512a <open>
+    3236:	83 c4 10             	add    $0x10,%esp
+    3239:	85 c0                	test   %eax,%eax
+    323b:	78 17                	js     3254 <subdir+0x3e1>
+        printf(1, "create dd/ff/ff succeeded!\n");
+    323d:	83 ec 08             	sub    $0x8,%esp
+    3240:	68 f2 6a 00 00       	push   $0x6af2
+    3245:	6a 01                	push   $0x1
+    3247:	e8 95 21 00 00       	call   53e1 <printf>
+    324c:	83 c4 10             	add    $0x10,%esp
+        exit();
+    324f:	e8 8f 1e 00 00       	call   50e3 <exit>
+    }
+    if(open("dd/xx/ff", O_CREATE|O_RDWR) >= 0){
+    3254:	83 ec 08             	sub    $0x8,%esp
+    3257:	68 02 02 00 00       	push   $0x202
+    325c:	68 0e 6b 00 00       	push   $0x6b0e
+    3261:	e8 c4 1e 00 00       	call   512a <open>
+    3266:	83 c4 10             	add    $0x10,%esp
+    3269:	85 c0                	test   %eax,%eax
+    326b:	78 17                	js     3284 <subdir+0x411>
+        printf(1, "create dd/xx/ff succeeded!\n");
+    326d:	83 ec 08             	sub    $0x8,%esp
+    3270:	68 17 6b 00 00       	push   $0x6b17
+    3275:	6a 01                	push   $0x1
+    3277:	e8 65 21 00 00       	call   53e1 <printf>
+    327c:	83 c4 10             	add    $0x10,%esp
+        exit();
+    327f:	e8 5f 1e 00 00       	call   50e3 <exit>
+    }
+    if(open("dd", O_CREATE) >= 0){
+    3284:	83 ec 08             	sub    $0x8,%esp
+    3287:	68 00 02 00 00       	push   $0x200
+    328c:	68 e1 68 00 00       	push   $0x68e1
+    3291:	e8 94 1e 00 00       	call   512a <open>
+    3296:	83 c4 10             	add    $0x10,%esp
+    3299:	85 c0                	test   %eax,%eax
+    329b:	78 17                	js     32b4 <subdir+0x441>
+        printf(1, "create dd succeeded!\n");
+    329d:	83 ec 08             	sub    $0x8,%esp
+    32a0:	68 33 6b 00 00       	push   $0x6b33
+    32a5:	6a 01                	push   $0x1
+    32a7:	e8 35 21 00 00       	call   53e1 <printf>
+    32ac:	83 c4 10             	add    $0x10,%esp
+        exit();
+    32af:	e8 2f 1e 00 00       	call   50e3 <exit>
+    }
+    if(open("dd", O_RDWR) >= 0){
+    32b4:	83 ec 08             	sub    $0x8,%esp
+    32b7:	6a 02                	push   $0x2
+    32b9:	68 e1 68 00 00       	push   $0x68e1
+    32be:	e8 67 1e 00 00       	call   512a <open>
+    32c3:	83 c4 10             	add    $0x10,%esp
+    32c6:	85 c0                	test   %eax,%eax
+    32c8:	78 17                	js     32e1 <subdir+0x46e>
+        printf(1, "open dd rdwr succeeded!\n");
+    32ca:	83 ec 08             	sub    $0x8,%esp
+    32cd:	68 49 6b 00 00       	push   $0x6b49
+    32d2:	6a 01                	push   $0x1
+    32d4:	e8 08 21 00 00       	call   53e1 <printf>
+    32d9:	83 c4 10             	add    $0x10,%esp
+        exit();
+    32dc:	e8 02 1e 00 00       	call   50e3 <exit>
+    }
+    if(open("dd", O_WRONLY) >= 0){
+    32e1:	83 ec 08             	sub    $0x8,%esp
+    32e4:	6a 01                	push   $0x1
+    32e6:	68 e1 68 00 00       	push   $0x68e1
+    32eb:	e8 3a 1e 00 00       	call   512a <open>
+    32f0:	83 c4 10             	add    $0x10,%esp
+    32f3:	85 c0                	test   %eax,%eax
+    32f5:	78 17                	js     330e <subdir+0x49b>
+        printf(1, "open dd wronly succeeded!\n");
+    32f7:	83 ec 08             	sub    $0x8,%esp
+    32fa:	68 62 6b 00 00       	push   $0x6b62
+    32ff:	6a 01                	push   $0x1
+    3301:	e8 db 20 00 00       	call   53e1 <printf>
+    3306:	83 c4 10             	add    $0x10,%esp
+        exit();
+    3309:	e8 d5 1d 00 00       	call   50e3 <exit>
+    }
+    if(link("dd/ff/ff", "dd/dd/xx") == 0){
+    330e:	83 ec 08             	sub    $0x8,%esp
+    3311:	68 7d 6b 00 00       	push   $0x6b7d
+    3316:	68 e9 6a 00 00       	push   $0x6ae9
+    331b:	e8 32 1e 00 00       	call   5152 <link>
+    3320:	83 c4 10             	add    $0x10,%esp
+    3323:	85 c0                	test   %eax,%eax
+    3325:	75 17                	jne    333e <subdir+0x4cb>
+        printf(1, "link dd/ff/ff dd/dd/xx succeeded!\n");
+    3327:	83 ec 08             	sub    $0x8,%esp
+    332a:	68 88 6b 00 00       	push   $0x6b88
+    332f:	6a 01                	push   $0x1
+    3331:	e8 ab 20 00 00       	call   53e1 <printf>
+    3336:	83 c4 10             	add    $0x10,%esp
+        exit();
+    3339:	e8 a5 1d 00 00       	call   50e3 <exit>
+    }
+    if(link("dd/xx/ff", "dd/dd/xx") == 0){
+    333e:	83 ec 08             	sub    $0x8,%esp
+    3341:	68 7d 6b 00 00       	push   $0x6b7d
+    3346:	68 0e 6b 00 00       	push   $0x6b0e
+    334b:	e8 02 1e 00 00       	call   5152 <link>
+    3350:	83 c4 10             	add    $0x10,%esp
+    3353:	85 c0                	test   %eax,%eax
+    3355:	75 17                	jne    336e <subdir+0x4fb>
+        printf(1, "link dd/xx/ff dd/dd/xx succeeded!\n");
+    3357:	83 ec 08             	sub    $0x8,%esp
+    335a:	68 ac 6b 00 00       	push   $0x6bac
+    335f:	6a 01                	push   $0x1
+    3361:	e8 7b 20 00 00       	call   53e1 <printf>
+    3366:	83 c4 10             	add    $0x10,%esp
+        exit();
+    3369:	e8 75 1d 00 00       	call   50e3 <exit>
+    }
+    if(link("dd/ff", "dd/dd/ffff") == 0){
+    336e:	83 ec 08             	sub    $0x8,%esp
+    3371:	68 c4 69 00 00       	push   $0x69c4
+    3376:	68 fc 68 00 00       	push   $0x68fc
+    337b:	e8 d2 1d 00 00       	call   5152 <link>
+    3380:	83 c4 10             	add    $0x10,%esp
+    3383:	85 c0                	test   %eax,%eax
+    3385:	75 17                	jne    339e <subdir+0x52b>
+        printf(1, "link dd/ff dd/dd/ffff succeeded!\n");
+    3387:	83 ec 08             	sub    $0x8,%esp
+    338a:	68 d0 6b 00 00       	push   $0x6bd0
+    338f:	6a 01                	push   $0x1
+    3391:	e8 4b 20 00 00       	call   53e1 <printf>
+    3396:	83 c4 10             	add    $0x10,%esp
+        exit();
+    3399:	e8 45 1d 00 00       	call   50e3 <exit>
+    }
+    if(mkdir("dd/ff/ff") == 0){
+    339e:	83 ec 0c             	sub    $0xc,%esp
+    33a1:	68 e9 6a 00 00       	push   $0x6ae9
+    33a6:	e8 b1 1d 00 00       	call   515c <mkdir>
+    33ab:	83 c4 10             	add    $0x10,%esp
+    33ae:	85 c0                	test   %eax,%eax
+    33b0:	75 17                	jne    33c9 <subdir+0x556>
+        printf(1, "mkdir dd/ff/ff succeeded!\n");
+    33b2:	83 ec 08             	sub    $0x8,%esp
+    33b5:	68 f2 6b 00 00       	push   $0x6bf2
+    33ba:	6a 01                	push   $0x1
+    33bc:	e8 20 20 00 00       	call   53e1 <printf>
+    33c1:	83 c4 10             	add    $0x10,%esp
+        exit();
+    33c4:	e8 1a 1d 00 00       	call   50e3 <exit>
+    }
+    if(mkdir("dd/xx/ff") == 0){
+    33c9:	83 ec 0c             	sub    $0xc,%esp
+    33cc:	68 0e 6b 00 00       	push   $0x6b0e
+    33d1:	e8 86 1d 00 00       	call   515c <mkdir>
+    33d6:	83 c4 10             	add    $0x10,%esp
+    33d9:	85 c0                	test   %eax,%eax
+    33db:	75 17                	jne    33f4 <subdir+0x581>
+        printf(1, "mkdir dd/xx/ff succeeded!\n");
+    33dd:	83 ec 08             	sub    $0x8,%esp
+    33e0:	68 0d 6c 00 00       	push   $0x6c0d
+    33e5:	6a 01                	push   $0x1
+    33e7:	e8 f5 1f 00 00       	call   53e1 <printf>
+    33ec:	83 c4 10             	add    $0x10,%esp
+        exit();
+    33ef:	e8 ef 1c 00 00       	call   50e3 <exit>
+    }
+    if(mkdir("dd/dd/ffff") == 0){
+    33f4:	83 ec 0c             	sub    $0xc,%esp
+    33f7:	68 c4 69 00 00       	push   $0x69c4
+    33fc:	e8 5b 1d 00 00       	call   515c <mkdir>
+    3401:	83 c4 10             	add    $0x10,%esp
+    3404:	85 c0                	test   %eax,%eax
+    3406:	75 17                	jne    341f <subdir+0x5ac>
+        printf(1, "mkdir dd/dd/ffff succeeded!\n");
+    3408:	83 ec 08             	sub    $0x8,%esp
+    340b:	68 28 6c 00 00       	push   $0x6c28
+    3410:	6a 01                	push   $0x1
+    3412:	e8 ca 1f 00 00       	call   53e1 <printf>
+    3417:	83 c4 10             	add    $0x10,%esp
+        exit();
+    341a:	e8 c4 1c 00 00       	call   50e3 <exit>
+    }
+    if(unlink("dd/xx/ff") == 0){
+    341f:	83 ec 0c             	sub    $0xc,%esp
+    3422:	68 0e 6b 00 00       	push   $0x6b0e
+    3427:	e8 12 1d 00 00       	call   513e <unlink>
+    342c:	83 c4 10             	add    $0x10,%esp
+    342f:	85 c0                	test   %eax,%eax
+    3431:	75 17                	jne    344a <subdir+0x5d7>
+        printf(1, "unlink dd/xx/ff succeeded!\n");
+    3433:	83 ec 08             	sub    $0x8,%esp
+    3436:	68 45 6c 00 00       	push   $0x6c45
+    343b:	6a 01                	push   $0x1
+    343d:	e8 9f 1f 00 00       	call   53e1 <printf>
+    3442:	83 c4 10             	add    $0x10,%esp
+        exit();
+    3445:	e8 99 1c 00 00       	call   50e3 <exit>
+    }
+    if(unlink("dd/ff/ff") == 0){
+    344a:	83 ec 0c             	sub    $0xc,%esp
+    344d:	68 e9 6a 00 00       	push   $0x6ae9
+    3452:	e8 e7 1c 00 00       	call   513e <unlink>
+    3457:	83 c4 10             	add    $0x10,%esp
+    345a:	85 c0                	test   %eax,%eax
+    345c:	75 17                	jne    3475 <subdir+0x602>
+        printf(1, "unlink dd/ff/ff succeeded!\n");
+    345e:	83 ec 08             	sub    $0x8,%esp
+    3461:	68 61 6c 00 00       	push   $0x6c61
+    3466:	6a 01                	push   $0x1
+    3468:	e8 74 1f 00 00       	call   53e1 <printf>
+    346d:	83 c4 10             	add    $0x10,%esp
+        exit();
+    3470:	e8 6e 1c 00 00       	call   50e3 <exit>
+    }
+    if(chdir("dd/ff") == 0){
+    3475:	83 ec 0c             	sub    $0xc,%esp
+    3478:	68 fc 68 00 00       	push   $0x68fc
+    347d:	e8 e4 1c 00 00       	call   5166 <chdir>
+    3482:	83 c4 10             	add    $0x10,%esp
+    3485:	85 c0                	test   %eax,%eax
+    3487:	75 17                	jne    34a0 <subdir+0x62d>
+        printf(1, "chdir dd/ff succeeded!\n");
+    3489:	83 ec 08             	sub    $0x8,%esp
+    348c:	68 7d 6c 00 00       	push   $0x6c7d
+    3491:	6a 01                	push   $0x1
+    3493:	e8 49 1f 00 00       	call   53e1 <printf>
+    3498:	83 c4 10             	add    $0x10,%esp
+        exit();
+    349b:	e8 43 1c 00 00       	call   50e3 <exit>
+    }
+    if(chdir("dd/xx") == 0){
+    34a0:	83 ec 0c             	sub    $0xc,%esp
+    34a3:	68 95 6c 00 00       	push   $0x6c95
+    34a8:	e8 b9 1c 00 00       	call   5166 <chdir>
+    34ad:	83 c4 10             	add    $0x10,%esp
+    34b0:	85 c0                	test   %eax,%eax
+    34b2:	75 17                	jne    34cb <subdir+0x658>
+        printf(1, "chdir dd/xx succeeded!\n");
+    34b4:	83 ec 08             	sub    $0x8,%esp
+    34b7:	68 9b 6c 00 00       	push   $0x6c9b
+    34bc:	6a 01                	push   $0x1
+    34be:	e8 1e 1f 00 00       	call   53e1 <printf>
+    34c3:	83 c4 10             	add    $0x10,%esp
+        exit();
+    34c6:	e8 18 1c 00 00       	call   50e3 <exit>
+    }
+
+    if(unlink("dd/dd/ffff") != 0){
+    34cb:	83 ec 0c             	sub    $0xc,%esp
+    34ce:	68 c4 69 00 00       	push   $0x69c4
+    34d3:	e8 66 1c 00 00       	call   513e <unlink>
+    34d8:	83 c4 10             	add    $0x10,%esp
+    34db:	85 c0                	test   %eax,%eax
+    34dd:	74 17                	je     34f6 <subdir+0x683>
+        printf(1, "unlink dd/dd/ff failed\n");
+    34df:	83 ec 08             	sub    $0x8,%esp
+    34e2:	68 f1 69 00 00       	push   $0x69f1
+    34e7:	6a 01                	push   $0x1
+    34e9:	e8 f3 1e 00 00       	call   53e1 <printf>
+    34ee:	83 c4 10             	add    $0x10,%esp
+        exit();
+    34f1:	e8 ed 1b 00 00       	call   50e3 <exit>
+    }
+    if(unlink("dd/ff") != 0){
+    34f6:	83 ec 0c             	sub    $0xc,%esp
+    34f9:	68 fc 68 00 00       	push   $0x68fc
+    34fe:	e8 3b 1c 00 00       	call   513e <unlink>
+    3503:	83 c4 10             	add    $0x10,%esp
+    3506:	85 c0                	test   %eax,%eax
+    3508:	74 17                	je     3521 <subdir+0x6ae>
+        printf(1, "unlink dd/ff failed\n");
+    350a:	83 ec 08             	sub    $0x8,%esp
+    350d:	68 b3 6c 00 00       	push   $0x6cb3
+    3512:	6a 01                	push   $0x1
+    3514:	e8 c8 1e 00 00       	call   53e1 <printf>
+    3519:	83 c4 10             	add    $0x10,%esp
+        exit();
+    351c:	e8 c2 1b 00 00       	call   50e3 <exit>
+    }
+    if(unlink("dd") == 0){
+    3521:	83 ec 0c             	sub    $0xc,%esp
+    3524:	68 e1 68 00 00       	push   $0x68e1
+    3529:	e8 10 1c 00 00       	call   513e <unlink>
+    352e:	83 c4 10             	add    $0x10,%esp
+    3531:	85 c0                	test   %eax,%eax
+    3533:	75 17                	jne    354c <subdir+0x6d9>
+        printf(1, "unlink non-empty dd succeeded!\n");
+    3535:	83 ec 08             	sub    $0x8,%esp
+    3538:	68 c8 6c 00 00       	push   $0x6cc8
+    353d:	6a 01                	push   $0x1
+    353f:	e8 9d 1e 00 00       	call   53e1 <printf>
+    3544:	83 c4 10             	add    $0x10,%esp
+        exit();
+    3547:	e8 97 1b 00 00       	call   50e3 <exit>
+    }
+    if(unlink("dd/dd") < 0){
+    354c:	83 ec 0c             	sub    $0xc,%esp
+    354f:	68 e8 6c 00 00       	push   $0x6ce8
+    3554:	e8 e5 1b 00 00       	call   513e <unlink>
+    3559:	83 c4 10             	add    $0x10,%esp
+    355c:	85 c0                	test   %eax,%eax
+    355e:	79 17                	jns    3577 <subdir+0x704>
+        printf(1, "unlink dd/dd failed\n");
+    3560:	83 ec 08             	sub    $0x8,%esp
+    3563:	68 ee 6c 00 00       	push   $0x6cee
+    3568:	6a 01                	push   $0x1
+    356a:	e8 72 1e 00 00       	call   53e1 <printf>
+    356f:	83 c4 10             	add    $0x10,%esp
+        exit();
+    3572:	e8 6c 1b 00 00       	call   50e3 <exit>
+    }
+    if(unlink("dd") < 0){
+    3577:	83 ec 0c             	sub    $0xc,%esp
+    357a:	68 e1 68 00 00       	push   $0x68e1
+    357f:	e8 ba 1b 00 00       	call   513e <unlink>
+    3584:	83 c4 10             	add    $0x10,%esp
+    3587:	85 c0                	test   %eax,%eax
+    3589:	79 17                	jns    35a2 <subdir+0x72f>
+        printf(1, "unlink dd failed\n");
+    358b:	83 ec 08             	sub    $0x8,%esp
+    358e:	68 03 6d 00 00       	push   $0x6d03
+    3593:	6a 01                	push   $0x1
+    3595:	e8 47 1e 00 00       	call   53e1 <printf>
+    359a:	83 c4 10             	add    $0x10,%esp
+        exit();
+    359d:	e8 41 1b 00 00       	call   50e3 <exit>
+    }
+
+    printf(1, "subdir ok\n");
+    35a2:	83 ec 08             	sub    $0x8,%esp
+    35a5:	68 15 6d 00 00       	push   $0x6d15
+    35aa:	6a 01                	push   $0x1
+    35ac:	e8 30 1e 00 00       	call   53e1 <printf>
+    35b1:	83 c4 10             	add    $0x10,%esp
+}
+    35b4:	90                   	nop
+    35b5:	c9                   	leave
+    35b6:	c3                   	ret
+
+000035b7 <bigwrite>:
+
+// test writes that are larger than the log.
+void
+bigwrite(void)
+{
+    35b7:	55                   	push   %ebp
+    35b8:	89 e5                	mov    %esp,%ebp
+    35ba:	83 ec 18             	sub    $0x18,%esp
+    int fd, sz;
+
+    printf(1, "bigwrite test\n");
+    35bd:	83 ec 08             	sub    $0x8,%esp
+    35c0:	68 20 6d 00 00       	push   $0x6d20
+    35c5:	6a 01                	push   $0x1
+    35c7:	e8 15 1e 00 00       	call   53e1 <printf>
+    35cc:	83 c4 10             	add    $0x10,%esp
+
+    unlink("bigwrite");
+    35cf:	83 ec 0c             	sub    $0xc,%esp
+    35d2:	68 2f 6d 00 00       	push   $0x6d2f
+    35d7:	e8 62 1b 00 00       	call   513e <unlink>
+    35dc:	83 c4 10             	add    $0x10,%esp
+    for(sz = 499; sz < 12*512; sz += 471){
+    35df:	c7 45 f4 f3 01 00 00 	movl   $0x1f3,-0xc(%ebp)
+    35e6:	e9 a8 00 00 00       	jmp    3693 <bigwrite+0xdc>
+        fd = open("bigwrite", O_CREATE | O_RDWR);
+    35eb:	83 ec 08             	sub    $0x8,%esp
+    35ee:	68 02 02 00 00       	push   $0x202
+    35f3:	68 2f 6d 00 00       	push   $0x6d2f
+    35f8:	e8 2d 1b 00 00       	call   512a <open>
+    35fd:	83 c4 10             	add    $0x10,%esp
+    3600:	89 45 ec             	mov    %eax,-0x14(%ebp)
+        if(fd < 0){
+    3603:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    3607:	79 17                	jns    3620 <bigwrite+0x69>
+            printf(1, "cannot create bigwrite\n");
+    3609:	83 ec 08             	sub    $0x8,%esp
+    360c:	68 38 6d 00 00       	push   $0x6d38
+    3611:	6a 01                	push   $0x1
+    3613:	e8 c9 1d 00 00       	call   53e1 <printf>
+    3618:	83 c4 10             	add    $0x10,%esp
+            exit();
+    361b:	e8 c3 1a 00 00       	call   50e3 <exit>
+        }
+        int i;
+        for(i = 0; i < 2; i++){
+    3620:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+    3627:	eb 3f                	jmp    3668 <bigwrite+0xb1>
+            int cc = write(fd, buf, sz);
+    3629:	83 ec 04             	sub    $0x4,%esp
+    362c:	ff 75 f4             	push   -0xc(%ebp)
+    362f:	68 a0 81 00 00       	push   $0x81a0
+    3634:	ff 75 ec             	push   -0x14(%ebp)
+    3637:	e8 c6 1a 00 00       	call   5102 <write>
+    363c:	83 c4 10             	add    $0x10,%esp
+    363f:	89 45 e8             	mov    %eax,-0x18(%ebp)
+            if(cc != sz){
+    3642:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    3645:	3b 45 f4             	cmp    -0xc(%ebp),%eax
+    3648:	74 1a                	je     3664 <bigwrite+0xad>
+                printf(1, "write(%d) ret %d\n", sz, cc);
+    364a:	ff 75 e8             	push   -0x18(%ebp)
+    364d:	ff 75 f4             	push   -0xc(%ebp)
+    3650:	68 50 6d 00 00       	push   $0x6d50
+    3655:	6a 01                	push   $0x1
+    3657:	e8 85 1d 00 00       	call   53e1 <printf>
+    365c:	83 c4 10             	add    $0x10,%esp
+                exit();
+    365f:	e8 7f 1a 00 00       	call   50e3 <exit>
+        for(i = 0; i < 2; i++){
+    3664:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+    3668:	83 7d f0 01          	cmpl   $0x1,-0x10(%ebp)
+    366c:	7e bb                	jle    3629 <bigwrite+0x72>
+            }
+        }
+        close(fd);
+    366e:	83 ec 0c             	sub    $0xc,%esp
+    3671:	ff 75 ec             	push   -0x14(%ebp)
+    3674:	e8 93 1a 00 00       	call   510c <close>
+    3679:	83 c4 10             	add    $0x10,%esp
+        unlink("bigwrite");
+    367c:	83 ec 0c             	sub    $0xc,%esp
+    367f:	68 2f 6d 00 00       	push   $0x6d2f
+    3684:	e8 b5 1a 00 00       	call   513e <unlink>
+    3689:	83 c4 10             	add    $0x10,%esp
+    for(sz = 499; sz < 12*512; sz += 471){
+    368c:	81 45 f4 d7 01 00 00 	addl   $0x1d7,-0xc(%ebp)
+    3693:	81 7d f4 ff 17 00 00 	cmpl   $0x17ff,-0xc(%ebp)
+    369a:	0f 8e 4b ff ff ff    	jle    35eb <bigwrite+0x34>
+    }
+
+    printf(1, "bigwrite ok\n");
+    36a0:	83 ec 08             	sub    $0x8,%esp
+    36a3:	68 62 6d 00 00       	push   $0x6d62
+    36a8:	6a 01                	push   $0x1
+    36aa:	e8 32 1d 00 00       	call   53e1 <printf>
+    36af:	83 c4 10             	add    $0x10,%esp
+}
+    36b2:	90                   	nop
+    36b3:	c9                   	leave
+    36b4:	c3                   	ret
+
+000036b5 <bigfile>:
+
+void
+bigfile(void)
+{
+    36b5:	55                   	push   %ebp
+    36b6:	89 e5                	mov    %esp,%ebp
+    36b8:	83 ec 18             	sub    $0x18,%esp
+    int fd, i, total, cc;
+
+    printf(1, "bigfile test\n");
+    36bb:	83 ec 08             	sub    $0x8,%esp
+    36be:	68 6f 6d 00 00       	push   $0x6d6f
+    36c3:	6a 01                	push   $0x1
+    36c5:	e8 17 1d 00 00       	call   53e1 <printf>
+    36ca:	83 c4 10             	add    $0x10,%esp
+
+    unlink("bigfile");
+    36cd:	83 ec 0c             	sub    $0xc,%esp
+    36d0:	68 7d 6d 00 00       	push   $0x6d7d
+    36d5:	e8 64 1a 00 00       	call   513e <unlink>
+    36da:	83 c4 10             	add    $0x10,%esp
+    fd = open("bigfile", O_CREATE | O_RDWR);
+    36dd:	83 ec 08             	sub    $0x8,%esp
+    36e0:	68 02 02 00 00       	push   $0x202
+    36e5:	68 7d 6d 00 00       	push   $0x6d7d
+    36ea:	e8 3b 1a 00 00       	call   512a <open>
+    36ef:	83 c4 10             	add    $0x10,%esp
+    36f2:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    if(fd < 0){
+    36f5:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    36f9:	79 17                	jns    3712 <bigfile+0x5d>
+        printf(1, "cannot create bigfile");
+    36fb:	83 ec 08             	sub    $0x8,%esp
+    36fe:	68 85 6d 00 00       	push   $0x6d85
+    3703:	6a 01                	push   $0x1
+    3705:	e8 d7 1c 00 00       	call   53e1 <printf>
+    370a:	83 c4 10             	add    $0x10,%esp
+        exit();
+    370d:	e8 d1 19 00 00       	call   50e3 <exit>
+    }
+    for(i = 0; i < 20; i++){
+    3712:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    3719:	eb 52                	jmp    376d <bigfile+0xb8>
+        memset(buf, i, 600);
+    371b:	83 ec 04             	sub    $0x4,%esp
+    371e:	68 58 02 00 00       	push   $0x258
+    3723:	ff 75 f4             	push   -0xc(%ebp)
+    3726:	68 a0 81 00 00       	push   $0x81a0
+    372b:	e8 65 17 00 00       	call   4e95 <memset>
+    3730:	83 c4 10             	add    $0x10,%esp
+        if(write(fd, buf, 600) != 600){
+    3733:	83 ec 04             	sub    $0x4,%esp
+    3736:	68 58 02 00 00       	push   $0x258
+    373b:	68 a0 81 00 00       	push   $0x81a0
+    3740:	ff 75 ec             	push   -0x14(%ebp)
+    3743:	e8 ba 19 00 00       	call   5102 <write>
+    3748:	83 c4 10             	add    $0x10,%esp
+    374b:	3d 58 02 00 00       	cmp    $0x258,%eax
+    3750:	74 17                	je     3769 <bigfile+0xb4>
+            printf(1, "write bigfile failed\n");
+    3752:	83 ec 08             	sub    $0x8,%esp
+    3755:	68 9b 6d 00 00       	push   $0x6d9b
+    375a:	6a 01                	push   $0x1
+    375c:	e8 80 1c 00 00       	call   53e1 <printf>
+    3761:	83 c4 10             	add    $0x10,%esp
+            exit();
+    3764:	e8 7a 19 00 00       	call   50e3 <exit>
+    for(i = 0; i < 20; i++){
+    3769:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    376d:	83 7d f4 13          	cmpl   $0x13,-0xc(%ebp)
+    3771:	7e a8                	jle    371b <bigfile+0x66>
+        }
+    }
+    close(fd);
+    3773:	83 ec 0c             	sub    $0xc,%esp
+    3776:	ff 75 ec             	push   -0x14(%ebp)
+    3779:	e8 8e 19 00 00       	call   510c <close>
+    377e:	83 c4 10             	add    $0x10,%esp
+
+    fd = open("bigfile", 0);
+    3781:	83 ec 08             	sub    $0x8,%esp
+    3784:	6a 00                	push   $0x0
+    3786:	68 7d 6d 00 00       	push   $0x6d7d
+    378b:	e8 9a 19 00 00       	call   512a <open>
+    3790:	83 c4 10             	add    $0x10,%esp
+    3793:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    if(fd < 0){
+    3796:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    379a:	79 17                	jns    37b3 <bigfile+0xfe>
+        printf(1, "cannot open bigfile\n");
+    379c:	83 ec 08             	sub    $0x8,%esp
+    379f:	68 b1 6d 00 00       	push   $0x6db1
+    37a4:	6a 01                	push   $0x1
+    37a6:	e8 36 1c 00 00       	call   53e1 <printf>
+    37ab:	83 c4 10             	add    $0x10,%esp
+        exit();
+    37ae:	e8 30 19 00 00       	call   50e3 <exit>
+    }
+    total = 0;
+    37b3:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+    for(i = 0; ; i++){
+    37ba:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+        cc = read(fd, buf, 300);
+    37c1:	83 ec 04             	sub    $0x4,%esp
+    37c4:	68 2c 01 00 00       	push   $0x12c
+    37c9:	68 a0 81 00 00       	push   $0x81a0
+    37ce:	ff 75 ec             	push   -0x14(%ebp)
+    37d1:	e8 22 19 00 00       	call   50f8 <read>
+    37d6:	83 c4 10             	add    $0x10,%esp
+    37d9:	89 45 e8             	mov    %eax,-0x18(%ebp)
+        if(cc < 0){
+    37dc:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    37e0:	79 17                	jns    37f9 <bigfile+0x144>
+            printf(1, "read bigfile failed\n");
+    37e2:	83 ec 08             	sub    $0x8,%esp
+    37e5:	68 c6 6d 00 00       	push   $0x6dc6
+    37ea:	6a 01                	push   $0x1
+    37ec:	e8 f0 1b 00 00       	call   53e1 <printf>
+    37f1:	83 c4 10             	add    $0x10,%esp
+            exit();
+    37f4:	e8 ea 18 00 00       	call   50e3 <exit>
+        }
+        if(cc == 0)
+    37f9:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    37fd:	74 7a                	je     3879 <bigfile+0x1c4>
+            break;
+        if(cc != 300){
+    37ff:	81 7d e8 2c 01 00 00 	cmpl   $0x12c,-0x18(%ebp)
+    3806:	74 17                	je     381f <bigfile+0x16a>
+            printf(1, "short read bigfile\n");
+    3808:	83 ec 08             	sub    $0x8,%esp
+    380b:	68 db 6d 00 00       	push   $0x6ddb
+    3810:	6a 01                	push   $0x1
+    3812:	e8 ca 1b 00 00       	call   53e1 <printf>
+    3817:	83 c4 10             	add    $0x10,%esp
+            exit();
+    381a:	e8 c4 18 00 00       	call   50e3 <exit>
+        }
+        if(buf[0] != i/2 || buf[299] != i/2){
+    381f:	0f b6 05 a0 81 00 00 	movzbl 0x81a0,%eax
+    3826:	0f be d0             	movsbl %al,%edx
+    3829:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    382c:	89 c1                	mov    %eax,%ecx
+    382e:	c1 e9 1f             	shr    $0x1f,%ecx
+    3831:	01 c8                	add    %ecx,%eax
+    3833:	d1 f8                	sar    %eax
+    3835:	39 c2                	cmp    %eax,%edx
+    3837:	75 1a                	jne    3853 <bigfile+0x19e>
+    3839:	0f b6 05 cb 82 00 00 	movzbl 0x82cb,%eax
+    3840:	0f be d0             	movsbl %al,%edx
+    3843:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    3846:	89 c1                	mov    %eax,%ecx
+    3848:	c1 e9 1f             	shr    $0x1f,%ecx
+    384b:	01 c8                	add    %ecx,%eax
+    384d:	d1 f8                	sar    %eax
+    384f:	39 c2                	cmp    %eax,%edx
+    3851:	74 17                	je     386a <bigfile+0x1b5>
+            printf(1, "read bigfile wrong data\n");
+    3853:	83 ec 08             	sub    $0x8,%esp
+    3856:	68 ef 6d 00 00       	push   $0x6def
+    385b:	6a 01                	push   $0x1
+    385d:	e8 7f 1b 00 00       	call   53e1 <printf>
+    3862:	83 c4 10             	add    $0x10,%esp
+            exit();
+    3865:	e8 79 18 00 00       	call   50e3 <exit>
+        }
+        total += cc;
+    386a:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    386d:	01 45 f0             	add    %eax,-0x10(%ebp)
+    for(i = 0; ; i++){
+    3870:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+        cc = read(fd, buf, 300);
+    3874:	e9 48 ff ff ff       	jmp    37c1 <bigfile+0x10c>
+            break;
+    3879:	90                   	nop
+    }
+    close(fd);
+    387a:	83 ec 0c             	sub    $0xc,%esp
+    387d:	ff 75 ec             	push   -0x14(%ebp)
+    3880:	e8 87 18 00 00       	call   510c <close>
+    3885:	83 c4 10             	add    $0x10,%esp
+    if(total != 20*600){
+    3888:	81 7d f0 e0 2e 00 00 	cmpl   $0x2ee0,-0x10(%ebp)
+    388f:	74 17                	je     38a8 <bigfile+0x1f3>
+        printf(1, "read bigfile wrong total\n");
+    3891:	83 ec 08             	sub    $0x8,%esp
+    3894:	68 08 6e 00 00       	push   $0x6e08
+    3899:	6a 01                	push   $0x1
+    389b:	e8 41 1b 00 00       	call   53e1 <printf>
+    38a0:	83 c4 10             	add    $0x10,%esp
+        exit();
+    38a3:	e8 3b 18 00 00       	call   50e3 <exit>
+    }
+    unlink("bigfile");
+    38a8:	83 ec 0c             	sub    $0xc,%esp
+    38ab:	68 7d 6d 00 00       	push   $0x6d7d
+    38b0:	e8 89 18 00 00       	call   513e <unlink>
+    38b5:	83 c4 10             	add    $0x10,%esp
+
+    printf(1, "bigfile test ok\n");
+    38b8:	83 ec 08             	sub    $0x8,%esp
+    38bb:	68 22 6e 00 00       	push   $0x6e22
+    38c0:	6a 01                	push   $0x1
+    38c2:	e8 1a 1b 00 00       	call   53e1 <printf>
+    38c7:	83 c4 10             	add    $0x10,%esp
+}
+    38ca:	90                   	nop
+    38cb:	c9                   	leave
+    38cc:	c3                   	ret
+
+000038cd <fourteen>:
+
+void
+fourteen(void)
+{
+    38cd:	55                   	push   %ebp
+    38ce:	89 e5                	mov    %esp,%ebp
+    38d0:	83 ec 18             	sub    $0x18,%esp
+    int fd;
+
+    // DIRSIZ is 14.
+    printf(1, "fourteen test\n");
+    38d3:	83 ec 08             	sub    $0x8,%esp
+    38d6:	68 33 6e 00 00       	push   $0x6e33
+    38db:	6a 01                	push   $0x1
+    38dd:	e8 ff 1a 00 00       	call   53e1 <printf>
+    38e2:	83 c4 10             	add    $0x10,%esp
+
+    if(mkdir("12345678901234") != 0){
+    38e5:	83 ec 0c             	sub    $0xc,%esp
+    38e8:	68 42 6e 00 00       	push   $0x6e42
+    38ed:	e8 6a 18 00 00       	call   515c <mkdir>
+    38f2:	83 c4 10             	add    $0x10,%esp
+    38f5:	85 c0                	test   %eax,%eax
+    38f7:	74 17                	je     3910 <fourteen+0x43>
+        printf(1, "mkdir 12345678901234 failed\n");
+    38f9:	83 ec 08             	sub    $0x8,%esp
+    38fc:	68 51 6e 00 00       	push   $0x6e51
+    3901:	6a 01                	push   $0x1
+    3903:	e8 d9 1a 00 00       	call   53e1 <printf>
+    3908:	83 c4 10             	add    $0x10,%esp
+        exit();
+    390b:	e8 d3 17 00 00       	call   50e3 <exit>
+    }
+    if(mkdir("12345678901234/123456789012345") != 0){
+    3910:	83 ec 0c             	sub    $0xc,%esp
+    3913:	68 70 6e 00 00       	push   $0x6e70
+    3918:	e8 3f 18 00 00       	call   515c <mkdir>
+    391d:	83 c4 10             	add    $0x10,%esp
+    3920:	85 c0                	test   %eax,%eax
+    3922:	74 17                	je     393b <fourteen+0x6e>
+        printf(1, "mkdir 12345678901234/123456789012345 failed\n");
+    3924:	83 ec 08             	sub    $0x8,%esp
+    3927:	68 90 6e 00 00       	push   $0x6e90
+    392c:	6a 01                	push   $0x1
+    392e:	e8 ae 1a 00 00       	call   53e1 <printf>
+    3933:	83 c4 10             	add    $0x10,%esp
+        exit();
+    3936:	e8 a8 17 00 00       	call   50e3 <exit>
+    }
+    fd = open("123456789012345/123456789012345/123456789012345", O_CREATE);
+    393b:	83 ec 08             	sub    $0x8,%esp
+    393e:	68 00 02 00 00       	push   $0x200
+    3943:	68 c0 6e 00 00       	push   $0x6ec0
+    3948:	e8 dd 17 00 00       	call   512a <open>
+    394d:	83 c4 10             	add    $0x10,%esp
+    3950:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(fd < 0){
+    3953:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    3957:	79 17                	jns    3970 <fourteen+0xa3>
+        printf(1, "create 123456789012345/123456789012345/123456789012345 failed\n");
+    3959:	83 ec 08             	sub    $0x8,%esp
+    395c:	68 f0 6e 00 00       	push   $0x6ef0
+    3961:	6a 01                	push   $0x1
+    3963:	e8 79 1a 00 00       	call   53e1 <printf>
+    3968:	83 c4 10             	add    $0x10,%esp
+        exit();
+    396b:	e8 73 17 00 00       	call   50e3 <exit>
+    }
+    close(fd);
+    3970:	83 ec 0c             	sub    $0xc,%esp
+    3973:	ff 75 f4             	push   -0xc(%ebp)
+    3976:	e8 91 17 00 00       	call   510c <close>
+    397b:	83 c4 10             	add    $0x10,%esp
+    fd = open("12345678901234/12345678901234/12345678901234", 0);
+    397e:	83 ec 08             	sub    $0x8,%esp
+    3981:	6a 00                	push   $0x0
+    3983:	68 30 6f 00 00       	push   $0x6f30
+    3988:	e8 9d 17 00 00       	call   512a <open>
+    398d:	83 c4 10             	add    $0x10,%esp
+    3990:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(fd < 0){
+    3993:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    3997:	79 17                	jns    39b0 <fourteen+0xe3>
+        printf(1, "open 12345678901234/12345678901234/12345678901234 failed\n");
+    3999:	83 ec 08             	sub    $0x8,%esp
+    399c:	68 60 6f 00 00       	push   $0x6f60
+    39a1:	6a 01                	push   $0x1
+    39a3:	e8 39 1a 00 00       	call   53e1 <printf>
+    39a8:	83 c4 10             	add    $0x10,%esp
+        exit();
+    39ab:	e8 33 17 00 00       	call   50e3 <exit>
+    }
+    close(fd);
+    39b0:	83 ec 0c             	sub    $0xc,%esp
+    39b3:	ff 75 f4             	push   -0xc(%ebp)
+    39b6:	e8 51 17 00 00       	call   510c <close>
+    39bb:	83 c4 10             	add    $0x10,%esp
+
+    if(mkdir("12345678901234/12345678901234") == 0){
+    39be:	83 ec 0c             	sub    $0xc,%esp
+    39c1:	68 9a 6f 00 00       	push   $0x6f9a
+    39c6:	e8 91 17 00 00       	call   515c <mkdir>
+    39cb:	83 c4 10             	add    $0x10,%esp
+    39ce:	85 c0                	test   %eax,%eax
+    39d0:	75 17                	jne    39e9 <fourteen+0x11c>
+        printf(1, "mkdir 12345678901234/12345678901234 succeeded!\n");
+    39d2:	83 ec 08             	sub    $0x8,%esp
+    39d5:	68 b8 6f 00 00       	push   $0x6fb8
+    39da:	6a 01                	push   $0x1
+    39dc:	e8 00 1a 00 00       	call   53e1 <printf>
+    39e1:	83 c4 10             	add    $0x10,%esp
+        exit();
+    39e4:	e8 fa 16 00 00       	call   50e3 <exit>
+    }
+    if(mkdir("123456789012345/12345678901234") == 0){
+    39e9:	83 ec 0c             	sub    $0xc,%esp
+    39ec:	68 e8 6f 00 00       	push   $0x6fe8
+    39f1:	e8 66 17 00 00       	call   515c <mkdir>
+    39f6:	83 c4 10             	add    $0x10,%esp
+    39f9:	85 c0                	test   %eax,%eax
+    39fb:	75 17                	jne    3a14 <fourteen+0x147>
+        printf(1, "mkdir 12345678901234/123456789012345 succeeded!\n");
+    39fd:	83 ec 08             	sub    $0x8,%esp
+    3a00:	68 08 70 00 00       	push   $0x7008
+    3a05:	6a 01                	push   $0x1
+    3a07:	e8 d5 19 00 00       	call   53e1 <printf>
+    3a0c:	83 c4 10             	add    $0x10,%esp
+        exit();
+    3a0f:	e8 cf 16 00 00       	call   50e3 <exit>
+    }
+
+    printf(1, "fourteen ok\n");
+    3a14:	83 ec 08             	sub    $0x8,%esp
+    3a17:	68 39 70 00 00       	push   $0x7039
+    3a1c:	6a 01                	push   $0x1
+    3a1e:	e8 be 19 00 00       	call   53e1 <printf>
+    3a23:	83 c4 10             	add    $0x10,%esp
+}
+    3a26:	90                   	nop
+    3a27:	c9                   	leave
+    3a28:	c3                   	ret
+
+00003a29 <rmdot>:
+
+void
+rmdot(void)
+{
+    3a29:	55                   	push   %ebp
+    3a2a:	89 e5                	mov    %esp,%ebp
+    3a2c:	83 ec 08             	sub    $0x8,%esp
+    printf(1, "rmdot test\n");
+    3a2f:	83 ec 08             	sub    $0x8,%esp
+    3a32:	68 46 70 00 00       	push   $0x7046
+    3a37:	6a 01                	push   $0x1
+    3a39:	e8 a3 19 00 00       	call   53e1 <printf>
+    3a3e:	83 c4 10             	add    $0x10,%esp
+    if(mkdir("dots") != 0){
+    3a41:	83 ec 0c             	sub    $0xc,%esp
+    3a44:	68 52 70 00 00       	push   $0x7052
+    3a49:	e8 0e 17 00 00       	call   515c <mkdir>
+    3a4e:	83 c4 10             	add    $0x10,%esp
+    3a51:	85 c0                	test   %eax,%eax
+    3a53:	74 17                	je     3a6c <rmdot+0x43>
+        printf(1, "mkdir dots failed\n");
+    3a55:	83 ec 08             	sub    $0x8,%esp
+    3a58:	68 57 70 00 00       	push   $0x7057
+    3a5d:	6a 01                	push   $0x1
+    3a5f:	e8 7d 19 00 00       	call   53e1 <printf>
+    3a64:	83 c4 10             	add    $0x10,%esp
+        exit();
+    3a67:	e8 77 16 00 00       	call   50e3 <exit>
+    }
+    if(chdir("dots") != 0){
+    3a6c:	83 ec 0c             	sub    $0xc,%esp
+    3a6f:	68 52 70 00 00       	push   $0x7052
+    3a74:	e8 ed 16 00 00       	call   5166 <chdir>
+    3a79:	83 c4 10             	add    $0x10,%esp
+    3a7c:	85 c0                	test   %eax,%eax
+    3a7e:	74 17                	je     3a97 <rmdot+0x6e>
+        printf(1, "chdir dots failed\n");
+    3a80:	83 ec 08             	sub    $0x8,%esp
+    3a83:	68 6a 70 00 00       	push   $0x706a
+    3a88:	6a 01                	push   $0x1
+    3a8a:	e8 52 19 00 00       	call   53e1 <printf>
+    3a8f:	83 c4 10             	add    $0x10,%esp
+        exit();
+    3a92:	e8 4c 16 00 00       	call   50e3 <exit>
+    }
+    if(unlink(".") == 0){
+    3a97:	83 ec 0c             	sub    $0xc,%esp
+    3a9a:	68 83 67 00 00       	push   $0x6783
+    3a9f:	e8 9a 16 00 00       	call   513e <unlink>
+    3aa4:	83 c4 10             	add    $0x10,%esp
+    3aa7:	85 c0                	test   %eax,%eax
+    3aa9:	75 17                	jne    3ac2 <rmdot+0x99>
+        printf(1, "rm . worked!\n");
+    3aab:	83 ec 08             	sub    $0x8,%esp
+    3aae:	68 7d 70 00 00       	push   $0x707d
+    3ab3:	6a 01                	push   $0x1
+    3ab5:	e8 27 19 00 00       	call   53e1 <printf>
+    3aba:	83 c4 10             	add    $0x10,%esp
+        exit();
+    3abd:	e8 21 16 00 00       	call   50e3 <exit>
+    }
+    if(unlink("..") == 0){
+    3ac2:	83 ec 0c             	sub    $0xc,%esp
+    3ac5:	68 66 5f 00 00       	push   $0x5f66
+    3aca:	e8 6f 16 00 00       	call   513e <unlink>
+    3acf:	83 c4 10             	add    $0x10,%esp
+    3ad2:	85 c0                	test   %eax,%eax
+    3ad4:	75 17                	jne    3aed <rmdot+0xc4>
+        printf(1, "rm .. worked!\n");
+    3ad6:	83 ec 08             	sub    $0x8,%esp
+    3ad9:	68 8b 70 00 00       	push   $0x708b
+    3ade:	6a 01                	push   $0x1
+    3ae0:	e8 fc 18 00 00       	call   53e1 <printf>
+    3ae5:	83 c4 10             	add    $0x10,%esp
+        exit();
+    3ae8:	e8 f6 15 00 00       	call   50e3 <exit>
+    }
+    if(chdir("/") != 0){
+    3aed:	83 ec 0c             	sub    $0xc,%esp
+    3af0:	68 ba 5b 00 00       	push   $0x5bba
+    3af5:	e8 6c 16 00 00       	call   5166 <chdir>
+    3afa:	83 c4 10             	add    $0x10,%esp
+    3afd:	85 c0                	test   %eax,%eax
+    3aff:	74 17                	je     3b18 <rmdot+0xef>
+        printf(1, "chdir / failed\n");
+    3b01:	83 ec 08             	sub    $0x8,%esp
+    3b04:	68 bc 5b 00 00       	push   $0x5bbc
+    3b09:	6a 01                	push   $0x1
+    3b0b:	e8 d1 18 00 00       	call   53e1 <printf>
+    3b10:	83 c4 10             	add    $0x10,%esp
+        exit();
+    3b13:	e8 cb 15 00 00       	call   50e3 <exit>
+    }
+    if(unlink("dots/.") == 0){
+    3b18:	83 ec 0c             	sub    $0xc,%esp
+    3b1b:	68 9a 70 00 00       	push   $0x709a
+    3b20:	e8 19 16 00 00       	call   513e <unlink>
+    3b25:	83 c4 10             	add    $0x10,%esp
+    3b28:	85 c0                	test   %eax,%eax
+    3b2a:	75 17                	jne    3b43 <rmdot+0x11a>
+        printf(1, "unlink dots/. worked!\n");
+    3b2c:	83 ec 08             	sub    $0x8,%esp
+    3b2f:	68 a1 70 00 00       	push   $0x70a1
+    3b34:	6a 01                	push   $0x1
+    3b36:	e8 a6 18 00 00       	call   53e1 <printf>
+    3b3b:	83 c4 10             	add    $0x10,%esp
+        exit();
+    3b3e:	e8 a0 15 00 00       	call   50e3 <exit>
+    }
+    if(unlink("dots/..") == 0){
+    3b43:	83 ec 0c             	sub    $0xc,%esp
+    3b46:	68 b8 70 00 00       	push   $0x70b8
+    3b4b:	e8 ee 15 00 00       	call   513e <unlink>
+    3b50:	83 c4 10             	add    $0x10,%esp
+    3b53:	85 c0                	test   %eax,%eax
+    3b55:	75 17                	jne    3b6e <rmdot+0x145>
+        printf(1, "unlink dots/.. worked!\n");
+    3b57:	83 ec 08             	sub    $0x8,%esp
+    3b5a:	68 c0 70 00 00       	push   $0x70c0
+    3b5f:	6a 01                	push   $0x1
+    3b61:	e8 7b 18 00 00       	call   53e1 <printf>
+    3b66:	83 c4 10             	add    $0x10,%esp
+        exit();
+    3b69:	e8 75 15 00 00       	call   50e3 <exit>
+    }
+    if(unlink("dots") != 0){
+    3b6e:	83 ec 0c             	sub    $0xc,%esp
+    3b71:	68 52 70 00 00       	push   $0x7052
+    3b76:	e8 c3 15 00 00       	call   513e <unlink>
+    3b7b:	83 c4 10             	add    $0x10,%esp
+    3b7e:	85 c0                	test   %eax,%eax
+    3b80:	74 17                	je     3b99 <rmdot+0x170>
+        printf(1, "unlink dots failed!\n");
+    3b82:	83 ec 08             	sub    $0x8,%esp
+    3b85:	68 d8 70 00 00       	push   $0x70d8
+    3b8a:	6a 01                	push   $0x1
+    3b8c:	e8 50 18 00 00       	call   53e1 <printf>
+    3b91:	83 c4 10             	add    $0x10,%esp
+        exit();
+    3b94:	e8 4a 15 00 00       	call   50e3 <exit>
+    }
+    printf(1, "rmdot ok\n");
+    3b99:	83 ec 08             	sub    $0x8,%esp
+    3b9c:	68 ed 70 00 00       	push   $0x70ed
+    3ba1:	6a 01                	push   $0x1
+    3ba3:	e8 39 18 00 00       	call   53e1 <printf>
+    3ba8:	83 c4 10             	add    $0x10,%esp
+}
+    3bab:	90                   	nop
+    3bac:	c9                   	leave
+    3bad:	c3                   	ret
+
+00003bae <ncachefile>:
+
+// Once a file's name is in the name cache, a path that uses the
+// file as a directory must still fail rather than reach dirlookup().
+void
+ncachefile(void)
+{
+    3bae:	55                   	push   %ebp
+    3baf:	89 e5                	mov    %esp,%ebp
+    3bb1:	83 ec 18             	sub    $0x18,%esp
+    int fd;
+
+    printf(1, "ncache file test\n");
+    3bb4:	83 ec 08             	sub    $0x8,%esp
+    3bb7:	68 f7 70 00 00       	push   $0x70f7
+    3bbc:	6a 01                	push   $0x1
+    3bbe:	e8 1e 18 00 00       	call   53e1 <printf>
+    3bc3:	83 c4 10             	add    $0x10,%esp
+    fd = open("ncfile", O_CREATE|O_RDWR);
+    3bc6:	83 ec 08             	sub    $0x8,%esp
+    3bc9:	68 02 02 00 00       	push   $0x202
+    3bce:	68 09 71 00 00       	push   $0x7109
+    3bd3:	e8 52 15 00 00       	call   512a <open>
+    3bd8:	83 c4 10             	add    $0x10,%esp
+    3bdb:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(fd < 0){
+    3bde:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    3be2:	79 17                	jns    3bfb <ncachefile+0x4d>
+        printf(1, "create ncfile failed\n");
+    3be4:	83 ec 08             	sub    $0x8,%esp
+    3be7:	68 10 71 00 00       	push   $0x7110
+    3bec:	6a 01                	push   $0x1
+    3bee:	e8 ee 17 00 00       	call   53e1 <printf>
+    3bf3:	83 c4 10             	add    $0x10,%esp
+        exit();
+    3bf6:	e8 e8 14 00 00       	call   50e3 <exit>
+    }
+    close(fd);
+    3bfb:	83 ec 0c             	sub    $0xc,%esp
+    3bfe:	ff 75 f4             	push   -0xc(%ebp)
+    3c01:	e8 06 15 00 00       	call   510c <close>
+    3c06:	83 c4 10             	add    $0x10,%esp
+    // Look it up twice, so the second comes from the cache.
+    if(chdir("ncfile") == 0 || chdir("ncfile") == 0){
+    3c09:	83 ec 0c             	sub    $0xc,%esp
+    3c0c:	68 09 71 00 00       	push   $0x7109
+    3c11:	e8 50 15 00 00       	call   5166 <chdir>
+    3c16:	83 c4 10             	add    $0x10,%esp
+    3c19:	85 c0                	test   %eax,%eax
+    3c1b:	74 14                	je     3c31 <ncachefile+0x83>
+    3c1d:	83 ec 0c             	sub    $0xc,%esp
+    3c20:	68 09 71 00 00       	push   $0x7109
+    3c25:	e8 3c 15 00 00       	call   5166 <chdir>
+    3c2a:	83 c4 10             	add    $0x10,%esp
+    3c2d:	85 c0                	test   %eax,%eax
+    3c2f:	75 17                	jne    3c48 <ncachefile+0x9a>
+        printf(1, "chdir ncfile succeeded!\n");
+    3c31:	83 ec 08             	sub    $0x8,%esp
+    3c34:	68 26 71 00 00       	push   $0x7126
+    3c39:	6a 01                	push   $0x1
+    3c3b:	e8 a1 17 00 00       	call   53e1 <printf>
+    3c40:	83 c4 10             	add    $0x10,%esp
+        exit();
+    3c43:	e8 9b 14 00 00       	call   50e3 <exit>
+    }
+    if(open("ncfile/xx", O_CREATE) >= 0 || mkdir("ncfile/xx") == 0 ||
+    3c48:	83 ec 08             	sub    $0x8,%esp
+    3c4b:	68 00 02 00 00       	push   $0x200
+    3c50:	68 3f 71 00 00       	push   $0x713f
+    3c55:	e8 d0 14 00 00       	call   512a <open>
+    3c5a:	83 c4 10             	add    $0x10,%esp
+    3c5d:	85 c0                	test   %eax,%eax
+    3c5f:	79 41                	jns    3ca2 <ncachefile+0xf4>
+    3c61:	83 ec 0c             	sub    $0xc,%esp
+    3c64:	68 3f 71 00 00       	push   $0x713f
+    3c69:	e8 ee 14 00 00       	call   515c <mkdir>
+    3c6e:	83 c4 10             	add    $0x10,%esp
+    3c71:	85 c0                	test   %eax,%eax
+    3c73:	74 2d                	je     3ca2 <ncachefile+0xf4>
+       link("README", "ncfile/xx") == 0 || unlink("ncfile/xx") == 0){
+    3c75:	83 ec 08             	sub    $0x8,%esp
+    3c78:	68 3f 71 00 00       	push   $0x713f
+    3c7d:	68 49 71 00 00       	push   $0x7149
+    3c82:	e8 cb 14 00 00       	call   5152 <link>
+    3c87:	83 c4 10             	add    $0x10,%esp
+    if(open("ncfile/xx", O_CREATE) >= 0 || mkdir("ncfile/xx") == 0 ||
+    3c8a:	85 c0                	test   %eax,%eax
+    3c8c:	74 14                	je     3ca2 <ncachefile+0xf4>
+       link("README", "ncfile/xx") == 0 || unlink("ncfile/xx") == 0){
+    3c8e:	83 ec 0c             	sub    $0xc,%esp
+    3c91:	68 3f 71 00 00       	push   $0x713f
+    3c96:	e8 a3 14 00 00       	call   513e <unlink>
+    3c9b:	83 c4 10             	add    $0x10,%esp
+    3c9e:	85 c0                	test   %eax,%eax
+    3ca0:	75 17                	jne    3cb9 <ncachefile+0x10b>
+        printf(1, "ncfile used as a directory\n");
+    3ca2:	83 ec 08             	sub    $0x8,%esp
+    3ca5:	68 50 71 00 00       	push   $0x7150
+    3caa:	6a 01                	push   $0x1
+    3cac:	e8 30 17 00 00       	call   53e1 <printf>
+    3cb1:	83 c4 10             	add    $0x10,%esp
+        exit();
+    3cb4:	e8 2a 14 00 00       	call   50e3 <exit>
+    }
+    unlink("ncfile");
+    3cb9:	83 ec 0c             	sub    $0xc,%esp
+    3cbc:	68 09 71 00 00       	push   $0x7109
+    3cc1:	e8 78 14 00 00       	call   513e <unlink>
+    3cc6:	83 c4 10             	add    $0x10,%esp
+    printf(1, "ncache file ok\n");
+    3cc9:	83 ec 08             	sub    $0x8,%esp
+    3ccc:	68 6c 71 00 00       	push   $0x716c
+    3cd1:	6a 01                	push   $0x1
+    3cd3:	e8 09 17 00 00       	call   53e1 <printf>
+    3cd8:	83 c4 10             	add    $0x10,%esp
+}
+    3cdb:	90                   	nop
+    3cdc:	c9                   	leave
+    3cdd:	c3                   	ret
+
+00003cde <dirfile>:
+
+void
+dirfile(void)
+{
+    3cde:	55                   	push   %ebp
+    3cdf:	89 e5                	mov    %esp,%ebp
+    3ce1:	83 ec 18             	sub    $0x18,%esp
+    int fd;
+
+    printf(1, "dir vs file\n");
+    3ce4:	83 ec 08             	sub    $0x8,%esp
+    3ce7:	68 7c 71 00 00       	push   $0x717c
+    3cec:	6a 01                	push   $0x1
+    3cee:	e8 ee 16 00 00       	call   53e1 <printf>
+    3cf3:	83 c4 10             	add    $0x10,%esp
+
+    fd = open("dirfile", O_CREATE);
+    3cf6:	83 ec 08             	sub    $0x8,%esp
+    3cf9:	68 00 02 00 00       	push   $0x200
+    3cfe:	68 89 71 00 00       	push   $0x7189
+    3d03:	e8 22 14 00 00       	call   512a <open>
+    3d08:	83 c4 10             	add    $0x10,%esp
+    3d0b:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(fd < 0){
+    3d0e:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    3d12:	79 17                	jns    3d2b <dirfile+0x4d>
+        printf(1, "create dirfile failed\n");
+    3d14:	83 ec 08             	sub    $0x8,%esp
+    3d17:	68 91 71 00 00       	push   $0x7191
+    3d1c:	6a 01                	push   $0x1
+    3d1e:	e8 be 16 00 00       	call   53e1 <printf>
+    3d23:	83 c4 10             	add    $0x10,%esp
+        exit();
+    3d26:	e8 b8 13 00 00       	call   50e3 <exit>
+    }
+    close(fd);
+    3d2b:	83 ec 0c             	sub    $0xc,%esp
+    3d2e:	ff 75 f4             	push   -0xc(%ebp)
+    3d31:	e8 d6 13 00 00       	call   510c <close>
+    3d36:	83 c4 10             	add    $0x10,%esp
+    if(chdir("dirfile") == 0){
+    3d39:	83 ec 0c             	sub    $0xc,%esp
+    3d3c:	68 89 71 00 00       	push   $0x7189
+    3d41:	e8 20 14 00 00       	call   5166 <chdir>
+    3d46:	83 c4 10             	add    $0x10,%esp
+    3d49:	85 c0                	test   %eax,%eax
+    3d4b:	75 17                	jne    3d64 <dirfile+0x86>
+        printf(1, "chdir dirfile succeeded!\n");
+    3d4d:	83 ec 08             	sub    $0x8,%esp
+    3d50:	68 a8 71 00 00       	push   $0x71a8
+    3d55:	6a 01                	push   $0x1
+    3d57:	e8 85 16 00 00       	call   53e1 <printf>
+    3d5c:	83 c4 10             	add    $0x10,%esp
+        exit();
+    3d5f:	e8 7f 13 00 00       	call   50e3 <exit>
+    }
+    fd = open("dirfile/xx", 0);
+    3d64:	83 ec 08             	sub    $0x8,%esp
+    3d67:	6a 00                	push   $0x0
+    3d69:	68 c2 71 00 00       	push   $0x71c2
+    3d6e:	e8 b7 13 00 00       	call   512a <open>
+    3d73:	83 c4 10             	add    $0x10,%esp
+    3d76:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(fd >= 0){
+    3d79:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    3d7d:	78 17                	js     3d96 <dirfile+0xb8>
+        printf(1, "create dirfile/xx succeeded!\n");
+    3d7f:	83 ec 08             	sub    $0x8,%esp
+    3d82:	68 cd 71 00 00       	push   $0x71cd
+    3d87:	6a 01                	push   $0x1
+    3d89:	e8 53 16 00 00       	call   53e1 <printf>
+    3d8e:	83 c4 10             	add    $0x10,%esp
+        exit();
+    3d91:	e8 4d 13 00 00       	call   50e3 <exit>
+    }
+    fd = open("dirfile/xx", O_CREATE);
+    3d96:	83 ec 08             	sub    $0x8,%esp
+    3d99:	68 00 02 00 00       	push   $0x200
+    3d9e:	68 c2 71 00 00       	push   $0x71c2
+    3da3:	e8 82 13 00 00       	call   512a <open>
+    3da8:	83 c4 10             	add    $0x10,%esp
+    3dab:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(fd >= 0){
+    3dae:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    3db2:	78 17                	js     3dcb <dirfile+0xed>
+        printf(1, "create dirfile/xx succeeded!\n");
+    3db4:	83 ec 08             	sub    $0x8,%esp
+    3db7:	68 cd 71 00 00       	push   $0x71cd
+    3dbc:	6a 01                	push   $0x1
+    3dbe:	e8 1e 16 00 00       	call   53e1 <printf>
+    3dc3:	83 c4 10             	add    $0x10,%esp
+        exit();
+    3dc6:	e8 18 13 00 00       	call   50e3 <exit>
+    }
+    if(mkdir("dirfile/xx") == 0){
+    3dcb:	83 ec 0c             	sub    $0xc,%esp
+    3dce:	68 c2 71 00 00       	push   $0x71c2
+    3dd3:	e8 84 13 00 00       	call   515c <mkdir>
+    3dd8:	83 c4 10             	add    $0x10,%esp
+    3ddb:	85 c0                	test   %eax,%eax
+    3ddd:	75 17                	jne    3df6 <dirfile+0x118>
+        printf(1, "mkdir dirfile/xx succeeded!\n");
+    3ddf:	83 ec 08             	sub    $0x8,%esp
+    3de2:	68 eb 71 00 00       	push   $0x71eb
+    3de7:	6a 01                	push   $0x1
+    3de9:	e8 f3 15 00 00       	call   53e1 <printf>
+    3dee:	83 c4 10             	add    $0x10,%esp
+        exit();
+    3df1:	e8 ed 12 00 00       	call   50e3 <exit>
+    }
+    if(unlink("dirfile/xx") == 0){
+    3df6:	83 ec 0c             	sub    $0xc,%esp
+    3df9:	68 c2 71 00 00       	push   $0x71c2
+    3dfe:	e8 3b 13 00 00       	call   513e <unlink>
+    3e03:	83 c4 10             	add    $0x10,%esp
+    3e06:	85 c0                	test   %eax,%eax
+    3e08:	75 17                	jne    3e21 <dirfile+0x143>
+        printf(1, "unlink dirfile/xx succeeded!\n");
+    3e0a:	83 ec 08             	sub    $0x8,%esp
+    3e0d:	68 08 72 00 00       	push   $0x7208
+    3e12:	6a 01                	push   $0x1
+    3e14:	e8 c8 15 00 00       	call   53e1 <printf>
+    3e19:	83 c4 10             	add    $0x10,%esp
+        exit();
+    3e1c:	e8 c2 12 00 00       	call   50e3 <exit>
+    }
+    if(link("README", "dirfile/xx") == 0){
+    3e21:	83 ec 08             	sub    $0x8,%esp
+    3e24:	68 c2 71 00 00       	push   $0x71c2
+    3e29:	68 49 71 00 00       	push   $0x7149
+    3e2e:	e8 1f 13 00 00       	call   5152 <link>
+    3e33:	83 c4 10             	add    $0x10,%esp
+    3e36:	85 c0                	test   %eax,%eax
+    3e38:	75 17                	jne    3e51 <dirfile+0x173>
+        printf(1, "link to dirfile/xx succeeded!\n");
+    3e3a:	83 ec 08             	sub    $0x8,%esp
+    3e3d:	68 28 72 00 00       	push   $0x7228
+    3e42:	6a 01                	push   $0x1
+    3e44:	e8 98 15 00 00       	call   53e1 <printf>
+    3e49:	83 c4 10             	add    $0x10,%esp
+        exit();
+    3e4c:	e8 92 12 00 00       	call   50e3 <exit>
+    }
+    if(unlink("dirfile") != 0){
+    3e51:	83 ec 0c             	sub    $0xc,%esp
+    3e54:	68 89 71 00 00       	push   $0x7189
+    3e59:	e8 e0 12 00 00       	call   513e <unlink>
+    3e5e:	83 c4 10             	add    $0x10,%esp
+    3e61:	85 c0                	test   %eax,%eax
+    3e63:	74 17                	je     3e7c <dirfile+0x19e>
+        printf(1, "unlink dirfile failed!\n");
+    3e65:	83 ec 08             	sub    $0x8,%esp
+    3e68:	68 47 72 00 00       	push   $0x7247
+    3e6d:	6a 01                	push   $0x1
+    3e6f:	e8 6d 15 00 00       	call   53e1 <printf>
+    3e74:	83 c4 10             	add    $0x10,%esp
+        exit();
+    3e77:	e8 67 12 00 00       	call   50e3 <exit>
+    }
+
+    fd = open(".", O_RDWR);
+    3e7c:	83 ec 08             	sub    $0x8,%esp
+    3e7f:	6a 02                	push   $0x2
+    3e81:	68 83 67 00 00       	push   $0x6783
+    3e86:	e8 9f 12 00 00       	call   512a <open>
+    3e8b:	83 c4 10             	add    $0x10,%esp
+    3e8e:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(fd >= 0){
+    3e91:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    3e95:	78 17                	js     3eae <dirfile+0x1d0>
+        printf(1, "open . for writing succeeded!\n");
+    3e97:	83 ec 08             	sub    $0x8,%esp
+    3e9a:	68 60 72 00 00       	push   $0x7260
+    3e9f:	6a 01                	push   $0x1
+    3ea1:	e8 3b 15 00 00       	call   53e1 <printf>
+    3ea6:	83 c4 10             	add    $0x10,%esp
+        exit();
+    3ea9:	e8 35 12 00 00       	call   50e3 <exit>
+    }
+    fd = open(".", 0);
+    3eae:	83 ec 08             	sub    $0x8,%esp
+    3eb1:	6a 00                	push   $0x0
+    3eb3:	68 83 67 00 00       	push   $0x6783
+    3eb8:	e8 6d 12 00 00       	call   512a <open>
+    3ebd:	83 c4 10             	add    $0x10,%esp
+    3ec0:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(write(fd, "x", 1) > 0){
+    3ec3:	83 ec 04             	sub    $0x4,%esp
+    3ec6:	6a 01                	push   $0x1
+    3ec8:	68 1f 60 00 00       	push   $0x601f
+    3ecd:	ff 75 f4             	push   -0xc(%ebp)
+    3ed0:	e8 2d 12 00 00       	call   5102 <write>
+    3ed5:	83 c4 10             	add    $0x10,%esp
+    3ed8:	85 c0                	test   %eax,%eax
+    3eda:	7e 17                	jle    3ef3 <dirfile+0x215>
+        printf(1, "write . succeeded!\n");
+    3edc:	83 ec 08             	sub    $0x8,%esp
+    3edf:	68 7f 72 00 00       	push   $0x727f
+    3ee4:	6a 01                	push   $0x1
+    3ee6:	e8 f6 14 00 00       	call   53e1 <printf>
+    3eeb:	83 c4 10             	add    $0x10,%esp
+        exit();
+    3eee:	e8 f0 11 00 00       	call   50e3 <exit>
+    }
+    close(fd);
+    3ef3:	83 ec 0c             	sub    $0xc,%esp
+    3ef6:	ff 75 f4             	push   -0xc(%ebp)
+    3ef9:	e8 0e 12 00 00       	call   510c <close>
+    3efe:	83 c4 10             	add    $0x10,%esp
+
+    printf(1, "dir vs file OK\n");
+    3f01:	83 ec 08             	sub    $0x8,%esp
+    3f04:	68 93 72 00 00       	push   $0x7293
+    3f09:	6a 01                	push   $0x1
+    3f0b:	e8 d1 14 00 00       	call   53e1 <printf>
+    3f10:	83 c4 10             	add    $0x10,%esp
+}
+    3f13:	90                   	nop
+    3f14:	c9                   	leave
+    3f15:	c3                   	ret
+
+00003f16 <iref>:
+
+// test that iput() is called at the end of _namei()
+void
+iref(void)
+{
+    3f16:	55                   	push   %ebp
+    3f17:	89 e5                	mov    %esp,%ebp
+    3f19:	83 ec 18             	sub    $0x18,%esp
+    int i, fd;
+
+    printf(1, "empty file name\n");
+    3f1c:	83 ec 08             	sub    $0x8,%esp
+    3f1f:	68 a3 72 00 00       	push   $0x72a3
+    3f24:	6a 01                	push   $0x1
+    3f26:	e8 b6 14 00 00       	call   53e1 <printf>
+    3f2b:	83 c4 10             	add    $0x10,%esp
+
+    // the 50 is NINODE
+    for(i = 0; i < 50 + 1; i++){
+    3f2e:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    3f35:	e9 e7 00 00 00       	jmp    4021 <iref+0x10b>
+        if(mkdir("irefd") != 0){
+    3f3a:	83 ec 0c             	sub    $0xc,%esp
+    3f3d:	68 b4 72 00 00       	push   $0x72b4
+    3f42:	e8 15 12 00 00       	call   515c <mkdir>
+    3f47:	83 c4 10             	add    $0x10,%esp
+    3f4a:	85 c0                	test   %eax,%eax
+    3f4c:	74 17                	je     3f65 <iref+0x4f>
+            printf(1, "mkdir irefd failed\n");
+    3f4e:	83 ec 08             	sub    $0x8,%esp
+    3f51:	68 ba 72 00 00       	push   $0x72ba
+    3f56:	6a 01                	push   $0x1
+    3f58:	e8 84 14 00 00       	call   53e1 <printf>
+    3f5d:	83 c4 10             	add    $0x10,%esp
+            exit();
+    3f60:	e8 7e 11 00 00       	call   50e3 <exit>
+        }
+        if(chdir("irefd") != 0){
+    3f65:	83 ec 0c             	sub    $0xc,%esp
+    3f68:	68 b4 72 00 00       	push   $0x72b4
+    3f6d:	e8 f4 11 00 00       	call   5166 <chdir>
+    3f72:	83 c4 10             	add    $0x10,%esp
+    3f75:	85 c0                	test   %eax,%eax
+    3f77:	74 17                	je     3f90 <iref+0x7a>
+            printf(1, "chdir irefd failed\n");
+    3f79:	83 ec 08             	sub    $0x8,%esp
+    3f7c:	68 ce 72 00 00       	push   $0x72ce
+    3f81:	6a 01                	push   $0x1
+    3f83:	e8 59 14 00 00       	call   53e1 <printf>
+    3f88:	83 c4 10             	add    $0x10,%esp
+            exit();
+    3f8b:	e8 53 11 00 00       	call   50e3 <exit>
+        }
+
+        mkdir("");
+    3f90:	83 ec 0c             	sub    $0xc,%esp
+    3f93:	68 e2 72 00 00       	push   $0x72e2
+    3f98:	e8 bf 11 00 00       	call   515c <mkdir>
+    3f9d:	83 c4 10             	add    $0x10,%esp
+        link("README", "");
+    3fa0:	83 ec 08             	sub    $0x8,%esp
+    3fa3:	68 e2 72 00 00       	push   $0x72e2
+    3fa8:	68 49 71 00 00       	push   $0x7149
+    3fad:	e8 a0 11 00 00       	call   5152 <link>
+    3fb2:	83 c4 10             	add    $0x10,%esp
+        fd = open("", O_CREATE);
+    3fb5:	83 ec 08             	sub    $0x8,%esp
+    3fb8:	68 00 02 00 00       	push   $0x200
+    3fbd:	68 e2 72 00 00       	push   $0x72e2
+    3fc2:	e8 63 11 00 00       	call   512a <open>
+    3fc7:	83 c4 10             	add    $0x10,%esp
+    3fca:	89 45 f0             	mov    %eax,-0x10(%ebp)
+        if(fd >= 0)
+    3fcd:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    3fd1:	78 0e                	js     3fe1 <iref+0xcb>
+            close(fd);
+    3fd3:	83 ec 0c             	sub    $0xc,%esp
+    3fd6:	ff 75 f0             	push   -0x10(%ebp)
+    3fd9:	e8 2e 11 00 00       	call   510c <close>
+    3fde:	83 c4 10             	add    $0x10,%esp
+        fd = open("xx", O_CREATE);
+    3fe1:	83 ec 08             	sub    $0x8,%esp
+    3fe4:	68 00 02 00 00       	push   $0x200
+    3fe9:	68 e3 72 00 00       	push   $0x72e3
+    3fee:	e8 37 11 00 00       	call   512a <open>
+    3ff3:	83 c4 10             	add    $0x10,%esp
+    3ff6:	89 45 f0             	mov    %eax,-0x10(%ebp)
+        if(fd >= 0)
+    3ff9:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    3ffd:	78 0e                	js     400d <iref+0xf7>
+            close(fd);
+    3fff:	83 ec 0c             	sub    $0xc,%esp
+    4002:	ff 75 f0             	push   -0x10(%ebp)
+    4005:	e8 02 11 00 00       	call   510c <close>
+    400a:	83 c4 10             	add    $0x10,%esp
+        unlink("xx");
+    400d:	83 ec 0c             	sub    $0xc,%esp
+    4010:	68 e3 72 00 00       	push   $0x72e3
+    4015:	e8 24 11 00 00       	call   513e <unlink>
+    401a:	83 c4 10             	add    $0x10,%esp
+    for(i = 0; i < 50 + 1; i++){
+    401d:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    4021:	83 7d f4 32          	cmpl   $0x32,-0xc(%ebp)
+    4025:	0f 8e 0f ff ff ff    	jle    3f3a <iref+0x24>
+    }
+
+    chdir("/");
+    402b:	83 ec 0c             	sub    $0xc,%esp
+    402e:	68 ba 5b 00 00       	push   $0x5bba
+    4033:	e8 2e 11 00 00       	call   5166 <chdir>
+    4038:	83 c4 10             	add    $0x10,%esp
+    printf(1, "empty file name OK\n");
+    403b:	83 ec 08             	sub    $0x8,%esp
+    403e:	68 e6 72 00 00       	push   $0x72e6
+    4043:	6a 01                	push   $0x1
+    4045:	e8 97 13 00 00       	call   53e1 <printf>
+    404a:	83 c4 10             	add    $0x10,%esp
+}
+    404d:	90                   	nop
+    404e:	c9                   	leave
+    404f:	c3                   	ret
+
+00004050 <forktest>:
+// test that fork fails gracefully
+// the forktest binary also does this, but it runs out of proc entries first.
+// inside the bigger usertests binary, we run out of memory first.
+void
+forktest(void)
+{
+    4050:	55                   	push   %ebp
+    4051:	89 e5                	mov    %esp,%ebp
+    4053:	83 ec 18             	sub    $0x18,%esp
+    int n, pid;
+
+    printf(1, "fork test\n");
+    4056:	83 ec 08             	sub    $0x8,%esp
+    4059:	68 fa 72 00 00       	push   $0x72fa
+    405e:	6a 01                	push   $0x1
+    4060:	e8 7c 13 00 00       	call   53e1 <printf>
+    4065:	83 c4 10             	add    $0x10,%esp
+
+    for(n=0; n<1000; n++){
+    4068:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    406f:	eb 1d                	jmp    408e <forktest+0x3e>
+        pid = fork();
+    4071:	e8 66 10 00 00       	call   50dc <fork>
+    4076:	89 45 f0             	mov    %eax,-0x10(%ebp)
+        if(pid < 0)
+    4079:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    407d:	78 1a                	js     4099 <forktest+0x49>
+            break;
+        if(pid == 0)
+    407f:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    4083:	75 05                	jne    408a <forktest+0x3a>
+            exit();
+    4085:	e8 59 10 00 00       	call   50e3 <exit>
+    for(n=0; n<1000; n++){
+    408a:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    408e:	81 7d f4 e7 03 00 00 	cmpl   $0x3e7,-0xc(%ebp)
+    4095:	7e da                	jle    4071 <forktest+0x21>
+    4097:	eb 01                	jmp    409a <forktest+0x4a>
+            break;
+    4099:	90                   	nop
+    }
+
+    if(n == 1000){
+    409a:	81 7d f4 e8 03 00 00 	cmpl   $0x3e8,-0xc(%ebp)
+    40a1:	75 3b                	jne    40de <forktest+0x8e>
+        printf(1, "fork claimed to work 1000 times!\n");
+    40a3:	83 ec 08             	sub    $0x8,%esp
+    40a6:	68 08 73 00 00       	push   $0x7308
+    40ab:	6a 01                	push   $0x1
+    40ad:	e8 2f 13 00 00       	call   53e1 <printf>
+    40b2:	83 c4 10             	add    $0x10,%esp
+        exit();
+    40b5:	e8 29 10 00 00       	call   50e3 <exit>
+    }
+
+    for(; n > 0; n--){
+        if(wait() < 0){
+    40ba:	e8 2b 10 00 00       	call   50ea <wait>
+    40bf:	85 c0                	test   %eax,%eax
+    40c1:	79 17                	jns    40da <forktest+0x8a>
+            printf(1, "wait stopped early\n");
+    40c3:	83 ec 08             	sub    $0x8,%esp
+    40c6:	68 2a 73 00 00       	push   $0x732a
+    40cb:	6a 01                	push   $0x1
+    40cd:	e8 0f 13 00 00       	call   53e1 <printf>
+    40d2:	83 c4 10             	add    $0x10,%esp
+            exit();
+    40d5:	e8 09 10 00 00       	call   50e3 <exit>
+    for(; n > 0; n--){
+    40da:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+    40de:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    40e2:	7f d6                	jg     40ba <forktest+0x6a>
+        }
+    }
+
+    if(wait() != -1){
+    40e4:	e8 01 10 00 00       	call   50ea <wait>
+    40e9:	83 f8 ff             	cmp    $0xffffffff,%eax
+    40ec:	74 17                	je     4105 <forktest+0xb5>
+        printf(1, "wait got too many\n");
+    40ee:	83 ec 08             	sub    $0x8,%esp
+    40f1:	68 3e 73 00 00       	push   $0x733e
+    40f6:	6a 01                	push   $0x1
+    40f8:	e8 e4 12 00 00       	call   53e1 <printf>
+    40fd:	83 c4 10             	add    $0x10,%esp
+        exit();
+    4100:	e8 de 0f 00 00       	call   50e3 <exit>
+    }
+
+    printf(1, "fork test OK\n");
+    4105:	83 ec 08             	sub    $0x8,%esp
+    4108:	68 51 73 00 00       	push   $0x7351
+    410d:	6a 01                	push   $0x1
+    410f:	e8 cd 12 00 00       	call   53e1 <printf>
+    4114:	83 c4 10             	add    $0x10,%esp
+}
+    4117:	90                   	nop
+    4118:	c9                   	leave
+    4119:	c3                   	ret
+
+0000411a <sbrktest>:
+
+void
+sbrktest(void)
+{
+    411a:	55                   	push   %ebp
+    411b:	89 e5                	mov    %esp,%ebp
+    411d:	83 ec 68             	sub    $0x68,%esp
+    int fds[2], pid, pids[10], ppid;
+    char *a, *b, *c, *lastaddr, *oldbrk, *p, scratch;
+    uint amt;
+
+    printf(stdout, "sbrk test\n");
+    4120:	a1 6c 81 00 00       	mov    0x816c,%eax
+    4125:	83 ec 08             	sub    $0x8,%esp
+    4128:	68 5f 73 00 00       	push   $0x735f
+    412d:	50                   	push   %eax
+    412e:	e8 ae 12 00 00       	call   53e1 <printf>
+    4133:	83 c4 10             	add    $0x10,%esp
+    oldbrk = sbrk(0);
+    4136:	83 ec 0c             	sub    $0xc,%esp
+    4139:	6a 00                	push   $0x0
+    413b:	e8 44 10 00 00       	call   5184 <sbrk>
+    4140:	83 c4 10             	add    $0x10,%esp
+    4143:	89 45 ec             	mov    %eax,-0x14(%ebp)
+
+    // can one sbrk() less than a page?
+    a = sbrk(0);
+    4146:	83 ec 0c             	sub    $0xc,%esp
+    4149:	6a 00                	push   $0x0
+    414b:	e8 34 10 00 00       	call   5184 <sbrk>
+    4150:	83 c4 10             	add    $0x10,%esp
+    4153:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    int i;
+    for(i = 0; i < 5000; i++){
+    4156:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+    415d:	eb 4f                	jmp    41ae <sbrktest+0x94>
+        b = sbrk(1);
+    415f:	83 ec 0c             	sub    $0xc,%esp
+    4162:	6a 01                	push   $0x1
+    4164:	e8 1b 10 00 00       	call   5184 <sbrk>
+    4169:	83 c4 10             	add    $0x10,%esp
+    416c:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(b != a){
+    416f:	8b 45 d0             	mov    -0x30(%ebp),%eax
+    4172:	3b 45 f4             	cmp    -0xc(%ebp),%eax
+    4175:	74 24                	je     419b <sbrktest+0x81>
+            printf(stdout, "sbrk test failed %d %x %x\n", i, a, b);
+    4177:	a1 6c 81 00 00       	mov    0x816c,%eax
+    417c:	83 ec 0c             	sub    $0xc,%esp
+    417f:	ff 75 d0             	push   -0x30(%ebp)
+    4182:	ff 75 f4             	push   -0xc(%ebp)
+    4185:	ff 75 f0             	push   -0x10(%ebp)
+    4188:	68 6a 73 00 00       	push   $0x736a
+    418d:	50                   	push   %eax
+    418e:	e8 4e 12 00 00       	call   53e1 <printf>
+    4193:	83 c4 20             	add    $0x20,%esp
+            exit();
+    4196:	e8 48 0f 00 00       	call   50e3 <exit>
+        }
+        *b = 1;
+    419b:	8b 45 d0             	mov    -0x30(%ebp),%eax
+    419e:	c6 00 01             	movb   $0x1,(%eax)
+        a = b + 1;
+    41a1:	8b 45 d0             	mov    -0x30(%ebp),%eax
+    41a4:	83 c0 01             	add    $0x1,%eax
+    41a7:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    for(i = 0; i < 5000; i++){
+    41aa:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+    41ae:	81 7d f0 87 13 00 00 	cmpl   $0x1387,-0x10(%ebp)
+    41b5:	7e a8                	jle    415f <sbrktest+0x45>
+    }
+    pid = fork();
+    41b7:	e8 20 0f 00 00       	call   50dc <fork>
+    41bc:	89 45 e8             	mov    %eax,-0x18(%ebp)
+    if(pid < 0){
+    41bf:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    41c3:	79 1b                	jns    41e0 <sbrktest+0xc6>
+        printf(stdout, "sbrk test fork failed\n");
+    41c5:	a1 6c 81 00 00       	mov    0x816c,%eax
+    41ca:	83 ec 08             	sub    $0x8,%esp
+    41cd:	68 85 73 00 00       	push   $0x7385
+    41d2:	50                   	push   %eax
+    41d3:	e8 09 12 00 00       	call   53e1 <printf>
+    41d8:	83 c4 10             	add    $0x10,%esp
+        exit();
+    41db:	e8 03 0f 00 00       	call   50e3 <exit>
+    }
+    c = sbrk(1);
+    41e0:	83 ec 0c             	sub    $0xc,%esp
+    41e3:	6a 01                	push   $0x1
+    41e5:	e8 9a 0f 00 00       	call   5184 <sbrk>
+    41ea:	83 c4 10             	add    $0x10,%esp
+    41ed:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    c = sbrk(1);
+    41f0:	83 ec 0c             	sub    $0xc,%esp
+    41f3:	6a 01                	push   $0x1
+    41f5:	e8 8a 0f 00 00       	call   5184 <sbrk>
+    41fa:	83 c4 10             	add    $0x10,%esp
+    41fd:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(c != a + 1){
+    4200:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    4203:	83 c0 01             	add    $0x1,%eax
+    4206:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+    4209:	74 1b                	je     4226 <sbrktest+0x10c>
+        printf(stdout, "sbrk test failed post-fork\n");
+    420b:	a1 6c 81 00 00       	mov    0x816c,%eax
+    4210:	83 ec 08             	sub    $0x8,%esp
+    4213:	68 9c 73 00 00       	push   $0x739c
+    4218:	50                   	push   %eax
+    4219:	e8 c3 11 00 00       	call   53e1 <printf>
+    421e:	83 c4 10             	add    $0x10,%esp
+        exit();
+    4221:	e8 bd 0e 00 00       	call   50e3 <exit>
+    }
+    if(pid == 0)
+    4226:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    422a:	75 05                	jne    4231 <sbrktest+0x117>
+        exit();
+    422c:	e8 b2 0e 00 00       	call   50e3 <exit>
+    wait();
+    4231:	e8 b4 0e 00 00       	call   50ea <wait>
+
+    // can one grow address space to something big?
+#define BIG (100*1024*1024)
+    a = sbrk(0);
+    4236:	83 ec 0c             	sub    $0xc,%esp
+    4239:	6a 00                	push   $0x0
+    423b:	e8 44 0f 00 00       	call   5184 <sbrk>
+    4240:	83 c4 10             	add    $0x10,%esp
+    4243:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    amt = (BIG) - (uint)a;
+    4246:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    4249:	ba 00 00 40 06       	mov    $0x6400000,%edx
+    424e:	29 c2                	sub    %eax,%edx
+    4250:	89 55 e0             	mov    %edx,-0x20(%ebp)
+    p = sbrk(amt);
+    4253:	8b 45 e0             	mov    -0x20(%ebp),%eax
+    4256:	83 ec 0c             	sub    $0xc,%esp
+    4259:	50                   	push   %eax
+    425a:	e8 25 0f 00 00       	call   5184 <sbrk>
+    425f:	83 c4 10             	add    $0x10,%esp
+    4262:	89 45 dc             	mov    %eax,-0x24(%ebp)
+    if (p != a) {
+    4265:	8b 45 dc             	mov    -0x24(%ebp),%eax
+    4268:	3b 45 f4             	cmp    -0xc(%ebp),%eax
+    426b:	74 1b                	je     4288 <sbrktest+0x16e>
+        printf(stdout, "sbrk test failed to grow big address space; enough phys mem?\n");
+    426d:	a1 6c 81 00 00       	mov    0x816c,%eax
+    4272:	83 ec 08             	sub    $0x8,%esp
+    4275:	68 b8 73 00 00       	push   $0x73b8
+    427a:	50                   	push   %eax
+    427b:	e8 61 11 00 00       	call   53e1 <printf>
+    4280:	83 c4 10             	add    $0x10,%esp
+        exit();
+    4283:	e8 5b 0e 00 00       	call   50e3 <exit>
+    }
+    lastaddr = (char*) (BIG-1);
+    4288:	c7 45 d8 ff ff 3f 06 	movl   $0x63fffff,-0x28(%ebp)
+    *lastaddr = 99;
+    428f:	8b 45 d8             	mov    -0x28(%ebp),%eax
+    4292:	c6 00 63             	movb   $0x63,(%eax)
+
+    // can one de-allocate?
+    a = sbrk(0);
+    4295:	83 ec 0c             	sub    $0xc,%esp
+    4298:	6a 00                	push   $0x0
+    429a:	e8 e5 0e 00 00       	call   5184 <sbrk>
+    429f:	83 c4 10             	add    $0x10,%esp
+    42a2:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    c = sbrk(-4096);
+    42a5:	83 ec 0c             	sub    $0xc,%esp
+    42a8:	68 00 f0 ff ff       	push   $0xfffff000
+    42ad:	e8 d2 0e 00 00       	call   5184 <sbrk>
+    42b2:	83 c4 10             	add    $0x10,%esp
+    42b5:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(c == (char*)0xffffffff){
+    42b8:	83 7d e4 ff          	cmpl   $0xffffffff,-0x1c(%ebp)
+    42bc:	75 1b                	jne    42d9 <sbrktest+0x1bf>
+        printf(stdout, "sbrk could not deallocate\n");
+    42be:	a1 6c 81 00 00       	mov    0x816c,%eax
+    42c3:	83 ec 08             	sub    $0x8,%esp
+    42c6:	68 f6 73 00 00       	push   $0x73f6
+    42cb:	50                   	push   %eax
+    42cc:	e8 10 11 00 00       	call   53e1 <printf>
+    42d1:	83 c4 10             	add    $0x10,%esp
+        exit();
+    42d4:	e8 0a 0e 00 00       	call   50e3 <exit>
+    }
+    c = sbrk(0);
+    42d9:	83 ec 0c             	sub    $0xc,%esp
+    42dc:	6a 00                	push   $0x0
+    42de:	e8 a1 0e 00 00       	call   5184 <sbrk>
+    42e3:	83 c4 10             	add    $0x10,%esp
+    42e6:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(c != a - 4096){
+    42e9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    42ec:	2d 00 10 00 00       	sub    $0x1000,%eax
+    42f1:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+    42f4:	74 1e                	je     4314 <sbrktest+0x1fa>
+        printf(stdout, "sbrk deallocation produced wrong address, a %x c %x\n", a, c);
+    42f6:	a1 6c 81 00 00       	mov    0x816c,%eax
+    42fb:	ff 75 e4             	push   -0x1c(%ebp)
+    42fe:	ff 75 f4             	push   -0xc(%ebp)
+    4301:	68 14 74 00 00       	push   $0x7414
+    4306:	50                   	push   %eax
+    4307:	e8 d5 10 00 00       	call   53e1 <printf>
+    430c:	83 c4 10             	add    $0x10,%esp
+        exit();
+    430f:	e8 cf 0d 00 00       	call   50e3 <exit>
+    }
+
+    // can one re-allocate that page?
+    a = sbrk(0);
+    4314:	83 ec 0c             	sub    $0xc,%esp
+    4317:	6a 00                	push   $0x0
+    4319:	e8 66 0e 00 00       	call   5184 <sbrk>
+    431e:	83 c4 10             	add    $0x10,%esp
+    4321:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    c = sbrk(4096);
+    4324:	83 ec 0c             	sub    $0xc,%esp
+    4327:	68 00 10 00 00       	push   $0x1000
+    432c:	e8 53 0e 00 00       	call   5184 <sbrk>
+    4331:	83 c4 10             	add    $0x10,%esp
+    4334:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(c != a || sbrk(0) != a + 4096){
+    4337:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    433a:	3b 45 f4             	cmp    -0xc(%ebp),%eax
+    433d:	75 1a                	jne    4359 <sbrktest+0x23f>
+    433f:	83 ec 0c             	sub    $0xc,%esp
+    4342:	6a 00                	push   $0x0
+    4344:	e8 3b 0e 00 00       	call   5184 <sbrk>
+    4349:	83 c4 10             	add    $0x10,%esp
+    434c:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    434f:	81 c2 00 10 00 00    	add    $0x1000,%edx
+    4355:	39 d0                	cmp    %edx,%eax
+    4357:	74 1e                	je     4377 <sbrktest+0x25d>
+        printf(stdout, "sbrk re-allocation failed, a %x c %x\n", a, c);
+    4359:	a1 6c 81 00 00       	mov    0x816c,%eax
+    435e:	ff 75 e4             	push   -0x1c(%ebp)
+    4361:	ff 75 f4             	push   -0xc(%ebp)
+    4364:	68 4c 74 00 00       	push   $0x744c
+    4369:	50                   	push   %eax
+    436a:	e8 72 10 00 00       	call   53e1 <printf>
+    436f:	83 c4 10             	add    $0x10,%esp
+        exit();
+    4372:	e8 6c 0d 00 00       	call   50e3 <exit>
+    }
+    if(*lastaddr == 99){
+    4377:	8b 45 d8             	mov    -0x28(%ebp),%eax
+    437a:	0f b6 00             	movzbl (%eax),%eax
+    437d:	3c 63                	cmp    $0x63,%al
+    437f:	75 1b                	jne    439c <sbrktest+0x282>
+        // should be zero
+        printf(stdout, "sbrk de-allocation didn't really deallocate\n");
+    4381:	a1 6c 81 00 00       	mov    0x816c,%eax
+    4386:	83 ec 08             	sub    $0x8,%esp
+    4389:	68 74 74 00 00       	push   $0x7474
+    438e:	50                   	push   %eax
+    438f:	e8 4d 10 00 00       	call   53e1 <printf>
+    4394:	83 c4 10             	add    $0x10,%esp
+        exit();
+    4397:	e8 47 0d 00 00       	call   50e3 <exit>
+    }
+
+    a = sbrk(0);
+    439c:	83 ec 0c             	sub    $0xc,%esp
+    439f:	6a 00                	push   $0x0
+    43a1:	e8 de 0d 00 00       	call   5184 <sbrk>
+    43a6:	83 c4 10             	add    $0x10,%esp
+    43a9:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    c = sbrk(-(sbrk(0) - oldbrk));
+    43ac:	83 ec 0c             	sub    $0xc,%esp
+    43af:	6a 00                	push   $0x0
+    43b1:	e8 ce 0d 00 00       	call   5184 <sbrk>
+    43b6:	83 c4 10             	add    $0x10,%esp
+    43b9:	8b 55 ec             	mov    -0x14(%ebp),%edx
+    43bc:	29 c2                	sub    %eax,%edx
+    43be:	83 ec 0c             	sub    $0xc,%esp
+    43c1:	52                   	push   %edx
+    43c2:	e8 bd 0d 00 00       	call   5184 <sbrk>
+    43c7:	83 c4 10             	add    $0x10,%esp
+    43ca:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(c != a){
+    43cd:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    43d0:	3b 45 f4             	cmp    -0xc(%ebp),%eax
+    43d3:	74 1e                	je     43f3 <sbrktest+0x2d9>
+        printf(stdout, "sbrk downsize failed, a %x c %x\n", a, c);
+    43d5:	a1 6c 81 00 00       	mov    0x816c,%eax
+    43da:	ff 75 e4             	push   -0x1c(%ebp)
+    43dd:	ff 75 f4             	push   -0xc(%ebp)
+    43e0:	68 a4 74 00 00       	push   $0x74a4
+    43e5:	50                   	push   %eax
+    43e6:	e8 f6 0f 00 00       	call   53e1 <printf>
+    43eb:	83 c4 10             	add    $0x10,%esp
+        exit();
+    43ee:	e8 f0 0c 00 00       	call   50e3 <exit>
+    }
+
+    // can we read the kernel's memory?
+    for(a = (char*)(KERNBASE); a < (char*) (KERNBASE+2000000); a += 50000){
+    43f3:	c7 45 f4 00 00 00 80 	movl   $0x80000000,-0xc(%ebp)
+    43fa:	eb 76                	jmp    4472 <sbrktest+0x358>
+        ppid = getpid();
+    43fc:	e8 79 0d 00 00       	call   517a <getpid>
+    4401:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+        pid = fork();
+    4404:	e8 d3 0c 00 00       	call   50dc <fork>
+    4409:	89 45 e8             	mov    %eax,-0x18(%ebp)
+        if(pid < 0){
+    440c:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    4410:	79 1b                	jns    442d <sbrktest+0x313>
+            printf(stdout, "fork failed\n");
+    4412:	a1 6c 81 00 00       	mov    0x816c,%eax
+    4417:	83 ec 08             	sub    $0x8,%esp
+    441a:	68 e9 5b 00 00       	push   $0x5be9
+    441f:	50                   	push   %eax
+    4420:	e8 bc 0f 00 00       	call   53e1 <printf>
+    4425:	83 c4 10             	add    $0x10,%esp
+            exit();
+    4428:	e8 b6 0c 00 00       	call   50e3 <exit>
+        }
+        if(pid == 0){
+    442d:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    4431:	75 33                	jne    4466 <sbrktest+0x34c>
+            printf(stdout, "oops could read %x = %x\n", a, *a);
+    4433:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    4436:	0f b6 00             	movzbl (%eax),%eax
+    4439:	0f be d0             	movsbl %al,%edx
+    443c:	a1 6c 81 00 00       	mov    0x816c,%eax
+    4441:	52                   	push   %edx
+    4442:	ff 75 f4             	push   -0xc(%ebp)
+    4445:	68 c5 74 00 00       	push   $0x74c5
+    444a:	50                   	push   %eax
+    444b:	e8 91 0f 00 00       	call   53e1 <printf>
+    4450:	83 c4 10             	add    $0x10,%esp
+            kill(ppid);
+    4453:	83 ec 0c             	sub    $0xc,%esp
+    4456:	ff 75 d4             	push   -0x2c(%ebp)
+    4459:	e8 b8 0c 00 00       	call   5116 <kill>
+    445e:	83 c4 10             	add    $0x10,%esp
+            exit();
+    4461:	e8 7d 0c 00 00       	call   50e3 <exit>
+        }
+        wait();
+    4466:	e8 7f 0c 00 00       	call   50ea <wait>
+    for(a = (char*)(KERNBASE); a < (char*) (KERNBASE+2000000); a += 50000){
+    446b:	81 45 f4 50 c3 00 00 	addl   $0xc350,-0xc(%ebp)
+    4472:	81 7d f4 7f 84 1e 80 	cmpl   $0x801e847f,-0xc(%ebp)
+    4479:	76 81                	jbe    43fc <sbrktest+0x2e2>
+    }
+
+    // if we run the system out of memory, does it clean up the last
+    // failed allocation?
+    if(pipe(fds) != 0){
+    447b:	83 ec 0c             	sub    $0xc,%esp
+    447e:	8d 45 c8             	lea    -0x38(%ebp),%eax
+    4481:	50                   	push   %eax
+    4482:	e8 6a 0c 00 00       	call   50f1 <pipe>
+    4487:	83 c4 10             	add    $0x10,%esp
+    448a:	85 c0                	test   %eax,%eax
+    448c:	74 17                	je     44a5 <sbrktest+0x38b>
+        printf(1, "pipe() failed\n");
+    448e:	83 ec 08             	sub    $0x8,%esp
+    4491:	68 ba 5f 00 00       	push   $0x5fba
+    4496:	6a 01                	push   $0x1
+    4498:	e8 44 0f 00 00       	call   53e1 <printf>
+    449d:	83 c4 10             	add    $0x10,%esp
+        exit();
+    44a0:	e8 3e 0c 00 00       	call   50e3 <exit>
+    }
+    for(i = 0; i < sizeof(pids)/sizeof(pids[0]); i++){
+    44a5:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+    44ac:	e9 86 00 00 00       	jmp    4537 <sbrktest+0x41d>
+        if((pids[i] = fork()) == 0){
+    44b1:	e8 26 0c 00 00       	call   50dc <fork>
+    44b6:	8b 55 f0             	mov    -0x10(%ebp),%edx
+    44b9:	89 44 95 a0          	mov    %eax,-0x60(%ebp,%edx,4)
+    44bd:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    44c0:	8b 44 85 a0          	mov    -0x60(%ebp,%eax,4),%eax
+    44c4:	85 c0                	test   %eax,%eax
+    44c6:	75 4a                	jne    4512 <sbrktest+0x3f8>
+            // allocate a lot of memory
+            sbrk(BIG - (uint)sbrk(0));
+    44c8:	83 ec 0c             	sub    $0xc,%esp
+    44cb:	6a 00                	push   $0x0
+    44cd:	e8 b2 0c 00 00       	call   5184 <sbrk>
+    44d2:	83 c4 10             	add    $0x10,%esp
+    44d5:	89 c2                	mov    %eax,%edx
+    44d7:	b8 00 00 40 06       	mov    $0x6400000,%eax
+    44dc:	29 d0                	sub    %edx,%eax
+    44de:	83 ec 0c             	sub    $0xc,%esp
+    44e1:	50                   	push   %eax
+    44e2:	e8 9d 0c 00 00       	call   5184 <sbrk>
+    44e7:	83 c4 10             	add    $0x10,%esp
+            write(fds[1], "x", 1);
+    44ea:	8b 45 cc             	mov    -0x34(%ebp),%eax
+    44ed:	83 ec 04             	sub    $0x4,%esp
+    44f0:	6a 01                	push   $0x1
+    44f2:	68 1f 60 00 00       	push   $0x601f
+    44f7:	50                   	push   %eax
+    44f8:	e8 05 0c 00 00       	call   5102 <write>
+    44fd:	83 c4 10             	add    $0x10,%esp
+            // sit around until killed
+            for(;;) sleep(1000);
+    4500:	83 ec 0c             	sub    $0xc,%esp
+    4503:	68 e8 03 00 00       	push   $0x3e8
+    4508:	e8 81 0c 00 00       	call   518e <sleep>
+    450d:	83 c4 10             	add    $0x10,%esp
+    4510:	eb ee                	jmp    4500 <sbrktest+0x3e6>
+        }
+        if(pids[i] != -1)
+    4512:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    4515:	8b 44 85 a0          	mov    -0x60(%ebp,%eax,4),%eax
+    4519:	83 f8 ff             	cmp    $0xffffffff,%eax
+    451c:	74 15                	je     4533 <sbrktest+0x419>
+            read(fds[0], &scratch, 1);
+    451e:	8b 45 c8             	mov    -0x38(%ebp),%eax
+    4521:	83 ec 04             	sub    $0x4,%esp
+    4524:	6a 01                	push   $0x1
+    4526:	8d 55 9f             	lea    -0x61(%ebp),%edx
+    4529:	52                   	push   %edx
+    452a:	50                   	push   %eax
+    452b:	e8 c8 0b 00 00       	call   50f8 <read>
+    4530:	83 c4 10             	add    $0x10,%esp
+    for(i = 0; i < sizeof(pids)/sizeof(pids[0]); i++){
+    4533:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+    4537:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    453a:	83 f8 09             	cmp    $0x9,%eax
+    453d:	0f 86 6e ff ff ff    	jbe    44b1 <sbrktest+0x397>
+    }
+    // if those failed allocations freed up the pages they did allocate,
+    // we'll be able to allocate here
+    c = sbrk(4096);
+    4543:	83 ec 0c             	sub    $0xc,%esp
+    4546:	68 00 10 00 00       	push   $0x1000
+    454b:	e8 34 0c 00 00       	call   5184 <sbrk>
+    4550:	83 c4 10             	add    $0x10,%esp
+    4553:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    for(i = 0; i < sizeof(pids)/sizeof(pids[0]); i++){
+    4556:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+    455d:	eb 2b                	jmp    458a <sbrktest+0x470>
+        if(pids[i] == -1)
+    455f:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    4562:	8b 44 85 a0          	mov    -0x60(%ebp,%eax,4),%eax
+    4566:	83 f8 ff             	cmp    $0xffffffff,%eax
+    4569:	74 1a                	je     4585 <sbrktest+0x46b>
+            continue;
+        kill(pids[i]);
+    456b:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    456e:	8b 44 85 a0          	mov    -0x60(%ebp,%eax,4),%eax
+    4572:	83 ec 0c             	sub    $0xc,%esp
+    4575:	50                   	push   %eax
+    4576:	e8 9b 0b 00 00       	call   5116 <kill>
+    457b:	83 c4 10             	add    $0x10,%esp
+        wait();
+    457e:	e8 67 0b 00 00       	call   50ea <wait>
+    4583:	eb 01                	jmp    4586 <sbrktest+0x46c>
+            continue;
+    4585:	90                   	nop
+    for(i = 0; i < sizeof(pids)/sizeof(pids[0]); i++){
+    4586:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+    458a:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    458d:	83 f8 09             	cmp    $0x9,%eax
+    4590:	76 cd                	jbe    455f <sbrktest+0x445>
+    }
+    if(c == (char*)0xffffffff){
+    4592:	83 7d e4 ff          	cmpl   $0xffffffff,-0x1c(%ebp)
+    4596:	75 1b                	jne    45b3 <sbrktest+0x499>
+        printf(stdout, "failed sbrk leaked memory\n");
+    4598:	a1 6c 81 00 00       	mov    0x816c,%eax
+    459d:	83 ec 08             	sub    $0x8,%esp
+    45a0:	68 de 74 00 00       	push   $0x74de
+    45a5:	50                   	push   %eax
+    45a6:	e8 36 0e 00 00       	call   53e1 <printf>
+    45ab:	83 c4 10             	add    $0x10,%esp
+        exit();
+    45ae:	e8 30 0b 00 00       	call   50e3 <exit>
+    }
+
+    if(sbrk(0) > oldbrk)
+    45b3:	83 ec 0c             	sub    $0xc,%esp
+    45b6:	6a 00                	push   $0x0
+    45b8:	e8 c7 0b 00 00       	call   5184 <sbrk>
+    45bd:	83 c4 10             	add    $0x10,%esp
+    45c0:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+    45c3:	73 1e                	jae    45e3 <sbrktest+0x4c9>
+        sbrk(-(sbrk(0) - oldbrk));
+    45c5:	83 ec 0c             	sub    $0xc,%esp
+    45c8:	6a 00                	push   $0x0
+    45ca:	e8 b5 0b 00 00       	call   5184 <sbrk>
+    45cf:	83 c4 10             	add    $0x10,%esp
+    45d2:	8b 55 ec             	mov    -0x14(%ebp),%edx
+    45d5:	29 c2                	sub    %eax,%edx
+    45d7:	83 ec 0c             	sub    $0xc,%esp
+    45da:	52                   	push   %edx
+    45db:	e8 a4 0b 00 00       	call   5184 <sbrk>
+    45e0:	83 c4 10             	add    $0x10,%esp
+
+    printf(stdout, "sbrk test OK\n");
+    45e3:	a1 6c 81 00 00       	mov    0x816c,%eax
+    45e8:	83 ec 08             	sub    $0x8,%esp
+    45eb:	68 f9 74 00 00       	push   $0x74f9
+    45f0:	50                   	push   %eax
+    45f1:	e8 eb 0d 00 00       	call   53e1 <printf>
+    45f6:	83 c4 10             	add    $0x10,%esp
+}
+    45f9:	90                   	nop
+    45fa:	c9                   	leave
+    45fb:	c3                   	ret
+
+000045fc <validateint>:
+
+void
+validateint(int *p)
+{
+    45fc:	55                   	push   %ebp
+    45fd:	89 e5                	mov    %esp,%ebp
+    45ff:	53                   	push   %ebx
+    4600:	83 ec 10             	sub    $0x10,%esp
+    int res;
+    asm("mov %%esp, %%ebx\n\t"
+    4603:	b8 0d 00 00 00       	mov    $0xd,%eax
+    4608:	8b 55 08             	mov    0x8(%ebp),%edx
+    460b:	89 d1                	mov    %edx,%ecx
+    460d:	89 e3                	mov    %esp,%ebx
+    460f:	89 cc                	mov    %ecx,%esp
+    4611:	cd 40                	int    $0x40
+    4613:	89 dc                	mov    %ebx,%esp
+    4615:	89 45 f8             	mov    %eax,-0x8(%ebp)
+            "int %2\n\t"
+            "mov %%ebx, %%esp" :
+            "=a" (res) :
+            "a" (SYS_sleep), "n" (T_SYSCALL), "c" (p) :
+            "ebx");
+}
+    4618:	90                   	nop
+    4619:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    461c:	c9                   	leave
+    461d:	c3                   	ret
+
+0000461e <validatetest>:
+
+void
+validatetest(void)
+{
+    461e:	55                   	push   %ebp
+    461f:	89 e5                	mov    %esp,%ebp
+    4621:	83 ec 18             	sub    $0x18,%esp
+    int hi, pid;
+    uint p;
+
+    printf(stdout, "validate test\n");
+    4624:	a1 6c 81 00 00       	mov    0x816c,%eax
+    4629:	83 ec 08             	sub    $0x8,%esp
+    462c:	68 07 75 00 00       	push   $0x7507
+    4631:	50                   	push   %eax
+    4632:	e8 aa 0d 00 00       	call   53e1 <printf>
+    4637:	83 c4 10             	add    $0x10,%esp
+    hi = 1100*1024;
+    463a:	c7 45 f0 00 30 11 00 	movl   $0x113000,-0x10(%ebp)
+
+    for(p = 0; p <= (uint)hi; p += 4096){
+    4641:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    4648:	e9 8a 00 00 00       	jmp    46d7 <validatetest+0xb9>
+        if((pid = fork()) == 0){
+    464d:	e8 8a 0a 00 00       	call   50dc <fork>
+    4652:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    4655:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    4659:	75 14                	jne    466f <validatetest+0x51>
+            // try to crash the kernel by passing in a badly placed integer
+            validateint((int*)p);
+    465b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    465e:	83 ec 0c             	sub    $0xc,%esp
+    4661:	50                   	push   %eax
+    4662:	e8 95 ff ff ff       	call   45fc <validateint>
+    4667:	83 c4 10             	add    $0x10,%esp
+            exit();
+    466a:	e8 74 0a 00 00       	call   50e3 <exit>
+        }
+        sleep(0);
+    466f:	83 ec 0c             	sub    $0xc,%esp
+    4672:	6a 00                	push   $0x0
+    4674:	e8 15 0b 00 00       	call   518e <sleep>
+    4679:	83 c4 10             	add    $0x10,%esp
+        sleep(0);
+    467c:	83 ec 0c             	sub    $0xc,%esp
+    467f:	6a 00                	push   $0x0
+    4681:	e8 08 0b 00 00       	call   518e <sleep>
+    4686:	83 c4 10             	add    $0x10,%esp
+        kill(pid);
+    4689:	83 ec 0c             	sub    $0xc,%esp
+    468c:	ff 75 ec             	push   -0x14(%ebp)
+    468f:	e8 82 0a 00 00       	call   5116 <kill>
+    4694:	83 c4 10             	add    $0x10,%esp
+        wait();
+    4697:	e8 4e 0a 00 00       	call   50ea <wait>
+
+        // try to crash the kernel by passing in a bad string pointer
+        if(link("nosuchfile", (char*)p) != -1){
+    469c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    469f:	83 ec 08             	sub    $0x8,%esp
+    46a2:	50                   	push   %eax
+    46a3:	68 16 75 00 00       	push   $0x7516
+    46a8:	e8 a5 0a 00 00       	call   5152 <link>
+    46ad:	83 c4 10             	add    $0x10,%esp
+    46b0:	83 f8 ff             	cmp    $0xffffffff,%eax
+    46b3:	74 1b                	je     46d0 <validatetest+0xb2>
+            printf(stdout, "link should not succeed\n");
+    46b5:	a1 6c 81 00 00       	mov    0x816c,%eax
+    46ba:	83 ec 08             	sub    $0x8,%esp
+    46bd:	68 21 75 00 00       	push   $0x7521
+    46c2:	50                   	push   %eax
+    46c3:	e8 19 0d 00 00       	call   53e1 <printf>
+    46c8:	83 c4 10             	add    $0x10,%esp
+            exit();
+    46cb:	e8 13 0a 00 00       	call   50e3 <exit>
+    for(p = 0; p <= (uint)hi; p += 4096){
+    46d0:	81 45 f4 00 10 00 00 	addl   $0x1000,-0xc(%ebp)
+    46d7:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    46da:	3b 45 f4             	cmp    -0xc(%ebp),%eax
+    46dd:	0f 83 6a ff ff ff    	jae    464d <validatetest+0x2f>
+        }
+    }
+
+    printf(stdout, "validate ok\n");
+    46e3:	a1 6c 81 00 00       	mov    0x816c,%eax
+    46e8:	83 ec 08             	sub    $0x8,%esp
+    46eb:	68 3a 75 00 00       	push   $0x753a
+    46f0:	50                   	push   %eax
+    46f1:	e8 eb 0c 00 00       	call   53e1 <printf>
+    46f6:	83 c4 10             	add    $0x10,%esp
+}
+    46f9:	90                   	nop
+    46fa:	c9                   	leave
+    46fb:	c3                   	ret
+
+000046fc <bsstest>:
+
+// does unintialized data start out zero?
+char uninit[10000];
+void
+bsstest(void)
+{
+    46fc:	55                   	push   %ebp
+    46fd:	89 e5                	mov    %esp,%ebp
+    46ff:	83 ec 18             	sub    $0x18,%esp
+    int i;
+
+    printf(stdout, "bss test\n");
+    4702:	a1 6c 81 00 00       	mov    0x816c,%eax
+    4707:	83 ec 08             	sub    $0x8,%esp
+    470a:	68 47 75 00 00       	push   $0x7547
+    470f:	50                   	push   %eax
+    4710:	e8 cc 0c 00 00       	call   53e1 <printf>
+    4715:	83 c4 10             	add    $0x10,%esp
+    for(i = 0; i < sizeof(uninit); i++){
+    4718:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    471f:	eb 2e                	jmp    474f <bsstest+0x53>
+        if(uninit[i] != '\0'){
+    4721:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    4724:	05 c0 a1 00 00       	add    $0xa1c0,%eax
+    4729:	0f b6 00             	movzbl (%eax),%eax
+    472c:	84 c0                	test   %al,%al
+    472e:	74 1b                	je     474b <bsstest+0x4f>
+            printf(stdout, "bss test failed\n");
+    4730:	a1 6c 81 00 00       	mov    0x816c,%eax
+    4735:	83 ec 08             	sub    $0x8,%esp
+    4738:	68 51 75 00 00       	push   $0x7551
+    473d:	50                   	push   %eax
+    473e:	e8 9e 0c 00 00       	call   53e1 <printf>
+    4743:	83 c4 10             	add    $0x10,%esp
+            exit();
+    4746:	e8 98 09 00 00       	call   50e3 <exit>
+    for(i = 0; i < sizeof(uninit); i++){
+    474b:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    474f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    4752:	3d 0f 27 00 00       	cmp    $0x270f,%eax
+    4757:	76 c8                	jbe    4721 <bsstest+0x25>
+        }
+    }
+    printf(stdout, "bss test ok\n");
+    4759:	a1 6c 81 00 00       	mov    0x816c,%eax
+    475e:	83 ec 08             	sub    $0x8,%esp
+    4761:	68 62 75 00 00       	push   $0x7562
+    4766:	50                   	push   %eax
+    4767:	e8 75 0c 00 00       	call   53e1 <printf>
+    476c:	83 c4 10             	add    $0x10,%esp
+}
+    476f:	90                   	nop
+    4770:	c9                   	leave
+    4771:	c3                   	ret
+
+00004772 <bigargtest>:
+// does exec return an error if the arguments
+// are larger than a page? or does it write
+// below the stack and wreck the instructions/data?
+void
+bigargtest(void)
+{
+    4772:	55                   	push   %ebp
+    4773:	89 e5                	mov    %esp,%ebp
+    4775:	83 ec 18             	sub    $0x18,%esp
+    int pid, fd;
+
+    unlink("bigarg-ok");
+    4778:	83 ec 0c             	sub    $0xc,%esp
+    477b:	68 6f 75 00 00       	push   $0x756f
+    4780:	e8 b9 09 00 00       	call   513e <unlink>
+    4785:	83 c4 10             	add    $0x10,%esp
+    pid = fork();
+    4788:	e8 4f 09 00 00       	call   50dc <fork>
+    478d:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(pid == 0){
+    4790:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    4794:	0f 85 97 00 00 00    	jne    4831 <bigargtest+0xbf>
+        static char *args[MAXARG];
+        int i;
+        for(i = 0; i < MAXARG-1; i++)
+    479a:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    47a1:	eb 12                	jmp    47b5 <bigargtest+0x43>
+            args[i] = "bigargs test: failed\n                                                                                                                                                                                                                                                                                                                                                                                                             ";
+    47a3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    47a6:	c7 04 85 60 f7 00 00 	movl   $0x757c,0xf760(,%eax,4)
+    47ad:	7c 75 00 00 
+        for(i = 0; i < MAXARG-1; i++)
+    47b1:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    47b5:	83 7d f4 1e          	cmpl   $0x1e,-0xc(%ebp)
+    47b9:	7e e8                	jle    47a3 <bigargtest+0x31>
+        args[MAXARG-1] = 0;
+    47bb:	c7 05 dc f7 00 00 00 	movl   $0x0,0xf7dc
+    47c2:	00 00 00 
+        printf(stdout, "bigarg test\n");
+    47c5:	a1 6c 81 00 00       	mov    0x816c,%eax
+    47ca:	83 ec 08             	sub    $0x8,%esp
+    47cd:	68 1f 77 00 00       	push   $0x771f
+    47d2:	50                   	push   %eax
+    47d3:	e8 09 0c 00 00       	call   53e1 <printf>
+    47d8:	83 c4 10             	add    $0x10,%esp
+        exec("echo", args);
+    47db:	83 ec 08             	sub    $0x8,%esp
+    47de:	68 60 f7 00 00       	push   $0xf760
+    47e3:	68 48 5b 00 00       	push   $0x5b48
+    47e8:	e8 33 09 00 00       	call   5120 <exec>
+    47ed:	83 c4 10             	add    $0x10,%esp
+        printf(stdout, "bigarg test ok\n");
+    47f0:	a1 6c 81 00 00       	mov    0x816c,%eax
+    47f5:	83 ec 08             	sub    $0x8,%esp
+    47f8:	68 2c 77 00 00       	push   $0x772c
+    47fd:	50                   	push   %eax
+    47fe:	e8 de 0b 00 00       	call   53e1 <printf>
+    4803:	83 c4 10             	add    $0x10,%esp
+        fd = open("bigarg-ok", O_CREATE);
+    4806:	83 ec 08             	sub    $0x8,%esp
+    4809:	68 00 02 00 00       	push   $0x200
+    480e:	68 6f 75 00 00       	push   $0x756f
+    4813:	e8 12 09 00 00       	call   512a <open>
+    4818:	83 c4 10             	add    $0x10,%esp
+    481b:	89 45 ec             	mov    %eax,-0x14(%ebp)
+        close(fd);
+    481e:	83 ec 0c             	sub    $0xc,%esp
+    4821:	ff 75 ec             	push   -0x14(%ebp)
+    4824:	e8 e3 08 00 00       	call   510c <close>
+    4829:	83 c4 10             	add    $0x10,%esp
+        exit();
+    482c:	e8 b2 08 00 00       	call   50e3 <exit>
+    } else if(pid < 0){
+    4831:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    4835:	79 1b                	jns    4852 <bigargtest+0xe0>
+        printf(stdout, "bigargtest: fork failed\n");
+    4837:	a1 6c 81 00 00       	mov    0x816c,%eax
+    483c:	83 ec 08             	sub    $0x8,%esp
+    483f:	68 3c 77 00 00       	push   $0x773c
+    4844:	50                   	push   %eax
+    4845:	e8 97 0b 00 00       	call   53e1 <printf>
+    484a:	83 c4 10             	add    $0x10,%esp
+        exit();
+    484d:	e8 91 08 00 00       	call   50e3 <exit>
+    }
+    wait();
+    4852:	e8 93 08 00 00       	call   50ea <wait>
+    fd = open("bigarg-ok", 0);
+    4857:	83 ec 08             	sub    $0x8,%esp
+    485a:	6a 00                	push   $0x0
+    485c:	68 6f 75 00 00       	push   $0x756f
+    4861:	e8 c4 08 00 00       	call   512a <open>
+    4866:	83 c4 10             	add    $0x10,%esp
+    4869:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    if(fd < 0){
+    486c:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    4870:	79 1b                	jns    488d <bigargtest+0x11b>
+        printf(stdout, "bigarg test failed!\n");
+    4872:	a1 6c 81 00 00       	mov    0x816c,%eax
+    4877:	83 ec 08             	sub    $0x8,%esp
+    487a:	68 55 77 00 00       	push   $0x7755
+    487f:	50                   	push   %eax
+    4880:	e8 5c 0b 00 00       	call   53e1 <printf>
+    4885:	83 c4 10             	add    $0x10,%esp
+        exit();
+    4888:	e8 56 08 00 00       	call   50e3 <exit>
+    }
+    close(fd);
+    488d:	83 ec 0c             	sub    $0xc,%esp
+    4890:	ff 75 ec             	push   -0x14(%ebp)
+    4893:	e8 74 08 00 00       	call   510c <close>
+    4898:	83 c4 10             	add    $0x10,%esp
+    unlink("bigarg-ok");
+    489b:	83 ec 0c             	sub    $0xc,%esp
+    489e:	68 6f 75 00 00       	push   $0x756f
+    48a3:	e8 96 08 00 00       	call   513e <unlink>
+    48a8:	83 c4 10             	add    $0x10,%esp
+}
+    48ab:	90                   	nop
+    48ac:	c9                   	leave
+    48ad:	c3                   	ret
+
+000048ae <fsfull>:
+
+// what happens when the file system runs out of blocks?
+// answer: balloc panics, so this test is not useful.
+void
+fsfull()
+{
+    48ae:	55                   	push   %ebp
+    48af:	89 e5                	mov    %esp,%ebp
+    48b1:	53                   	push   %ebx
+    48b2:	83 ec 64             	sub    $0x64,%esp
+    int nfiles;
+    int fsblocks = 0;
+    48b5:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+
+    printf(1, "fsfull test\n");
+    48bc:	83 ec 08             	sub    $0x8,%esp
+    48bf:	68 6a 77 00 00       	push   $0x776a
+    48c4:	6a 01                	push   $0x1
+    48c6:	e8 16 0b 00 00       	call   53e1 <printf>
+    48cb:	83 c4 10             	add    $0x10,%esp
+
+    for(nfiles = 0; ; nfiles++){
+    48ce:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+        char name[64];
+        name[0] = 'f';
+    48d5:	c6 45 a4 66          	movb   $0x66,-0x5c(%ebp)
+        name[1] = '0' + nfiles / 1000;
+    48d9:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+    48dc:	ba d3 4d 62 10       	mov    $0x10624dd3,%edx
+    48e1:	89 c8                	mov    %ecx,%eax
+    48e3:	f7 ea                	imul   %edx
+    48e5:	c1 fa 06             	sar    $0x6,%edx
+    48e8:	89 c8                	mov    %ecx,%eax
+    48ea:	c1 f8 1f             	sar    $0x1f,%eax
+    48ed:	29 c2                	sub    %eax,%edx
+    48ef:	89 d0                	mov    %edx,%eax
+    48f1:	83 c0 30             	add    $0x30,%eax
+    48f4:	88 45 a5             	mov    %al,-0x5b(%ebp)
+        name[2] = '0' + (nfiles % 1000) / 100;
+    48f7:	8b 5d f4             	mov    -0xc(%ebp),%ebx
+    48fa:	ba d3 4d 62 10       	mov    $0x10624dd3,%edx
+    48ff:	89 d8                	mov    %ebx,%eax
+    4901:	f7 ea                	imul   %edx
+    4903:	c1 fa 06             	sar    $0x6,%edx
+    4906:	89 d8                	mov    %ebx,%eax
+    4908:	c1 f8 1f             	sar    $0x1f,%eax
+    490b:	89 d1                	mov    %edx,%ecx
+    490d:	29 c1                	sub    %eax,%ecx
+    490f:	69 c1 e8 03 00 00    	imul   $0x3e8,%ecx,%eax
+    4915:	29 c3                	sub    %eax,%ebx
+    4917:	89 d9                	mov    %ebx,%ecx
+    4919:	ba 1f 85 eb 51       	mov    $0x51eb851f,%edx
+    491e:	89 c8                	mov    %ecx,%eax
+    4920:	f7 ea                	imul   %edx
+    4922:	c1 fa 05             	sar    $0x5,%edx
+    4925:	89 c8                	mov    %ecx,%eax
+    4927:	c1 f8 1f             	sar    $0x1f,%eax
+    492a:	29 c2                	sub    %eax,%edx
+    492c:	89 d0                	mov    %edx,%eax
+    492e:	83 c0 30             	add    $0x30,%eax
+    4931:	88 45 a6             	mov    %al,-0x5a(%ebp)
+        name[3] = '0' + (nfiles % 100) / 10;
+    4934:	8b 5d f4             	mov    -0xc(%ebp),%ebx
+    4937:	ba 1f 85 eb 51       	mov    $0x51eb851f,%edx
+    493c:	89 d8                	mov    %ebx,%eax
+    493e:	f7 ea                	imul   %edx
+    4940:	c1 fa 05             	sar    $0x5,%edx
+    4943:	89 d8                	mov    %ebx,%eax
+    4945:	c1 f8 1f             	sar    $0x1f,%eax
+    4948:	89 d1                	mov    %edx,%ecx
+    494a:	29 c1                	sub    %eax,%ecx
+    494c:	6b c1 64             	imul   $0x64,%ecx,%eax
+    494f:	29 c3                	sub    %eax,%ebx
+    4951:	89 d9                	mov    %ebx,%ecx
+    4953:	ba 67 66 66 66       	mov    $0x66666667,%edx
+    4958:	89 c8                	mov    %ecx,%eax
+    495a:	f7 ea                	imul   %edx
+    495c:	c1 fa 02             	sar    $0x2,%edx
+    495f:	89 c8                	mov    %ecx,%eax
+    4961:	c1 f8 1f             	sar    $0x1f,%eax
+    4964:	29 c2                	sub    %eax,%edx
+    4966:	89 d0                	mov    %edx,%eax
+    4968:	83 c0 30             	add    $0x30,%eax
+    496b:	88 45 a7             	mov    %al,-0x59(%ebp)
+        name[4] = '0' + (nfiles % 10);
+    496e:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+    4971:	ba 67 66 66 66       	mov    $0x66666667,%edx
+    4976:	89 c8                	mov    %ecx,%eax
+    4978:	f7 ea                	imul   %edx
+    497a:	c1 fa 02             	sar    $0x2,%edx
+    497d:	89 c8                	mov    %ecx,%eax
+    497f:	c1 f8 1f             	sar    $0x1f,%eax
+    4982:	29 c2                	sub    %eax,%edx
+    4984:	89 d0                	mov    %edx,%eax
+    4986:	c1 e0 02             	shl    $0x2,%eax
+    4989:	01 d0                	add    %edx,%eax
+    498b:	01 c0                	add    %eax,%eax
+    498d:	29 c1                	sub    %eax,%ecx
+    498f:	89 ca                	mov    %ecx,%edx
+    4991:	89 d0                	mov    %edx,%eax
+    4993:	83 c0 30             	add    $0x30,%eax
+    4996:	88 45 a8             	mov    %al,-0x58(%ebp)
+        name[5] = '\0';
+    4999:	c6 45 a9 00          	movb   $0x0,-0x57(%ebp)
+        printf(1, "writing %s\n", name);
+    499d:	83 ec 04             	sub    $0x4,%esp
+    49a0:	8d 45 a4             	lea    -0x5c(%ebp),%eax
+    49a3:	50                   	push   %eax
+    49a4:	68 77 77 00 00       	push   $0x7777
+    49a9:	6a 01                	push   $0x1
+    49ab:	e8 31 0a 00 00       	call   53e1 <printf>
+    49b0:	83 c4 10             	add    $0x10,%esp
+        int fd = open(name, O_CREATE|O_RDWR);
+    49b3:	83 ec 08             	sub    $0x8,%esp
+    49b6:	68 02 02 00 00       	push   $0x202
+    49bb:	8d 45 a4             	lea    -0x5c(%ebp),%eax
+    49be:	50                   	push   %eax
+    49bf:	e8 66 07 00 00       	call   512a <open>
+    49c4:	83 c4 10             	add    $0x10,%esp
+    49c7:	89 45 e8             	mov    %eax,-0x18(%ebp)
+        if(fd < 0){
+    49ca:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    49ce:	79 18                	jns    49e8 <fsfull+0x13a>
+            printf(1, "open %s failed\n", name);
+    49d0:	83 ec 04             	sub    $0x4,%esp
+    49d3:	8d 45 a4             	lea    -0x5c(%ebp),%eax
+    49d6:	50                   	push   %eax
+    49d7:	68 83 77 00 00       	push   $0x7783
+    49dc:	6a 01                	push   $0x1
+    49de:	e8 fe 09 00 00       	call   53e1 <printf>
+    49e3:	83 c4 10             	add    $0x10,%esp
+            break;
+    49e6:	eb 6b                	jmp    4a53 <fsfull+0x1a5>
+        }
+        int total = 0;
+    49e8:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+        while(1){
+            int cc = write(fd, buf, 512);
+    49ef:	83 ec 04             	sub    $0x4,%esp
+    49f2:	68 00 02 00 00       	push   $0x200
+    49f7:	68 a0 81 00 00       	push   $0x81a0
+    49fc:	ff 75 e8             	push   -0x18(%ebp)
+    49ff:	e8 fe 06 00 00       	call   5102 <write>
+    4a04:	83 c4 10             	add    $0x10,%esp
+    4a07:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+            if(cc < 512)
+    4a0a:	81 7d e4 ff 01 00 00 	cmpl   $0x1ff,-0x1c(%ebp)
+    4a11:	7e 0c                	jle    4a1f <fsfull+0x171>
+                break;
+            total += cc;
+    4a13:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    4a16:	01 45 ec             	add    %eax,-0x14(%ebp)
+            fsblocks++;
+    4a19:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+        while(1){
+    4a1d:	eb d0                	jmp    49ef <fsfull+0x141>
+                break;
+    4a1f:	90                   	nop
+        }
+        printf(1, "wrote %d bytes\n", total);
+    4a20:	83 ec 04             	sub    $0x4,%esp
+    4a23:	ff 75 ec             	push   -0x14(%ebp)
+    4a26:	68 93 77 00 00       	push   $0x7793
+    4a2b:	6a 01                	push   $0x1
+    4a2d:	e8 af 09 00 00       	call   53e1 <printf>
+    4a32:	83 c4 10             	add    $0x10,%esp
+        close(fd);
+    4a35:	83 ec 0c             	sub    $0xc,%esp
+    4a38:	ff 75 e8             	push   -0x18(%ebp)
+    4a3b:	e8 cc 06 00 00       	call   510c <close>
+    4a40:	83 c4 10             	add    $0x10,%esp
+        if(total == 0)
+    4a43:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    4a47:	74 09                	je     4a52 <fsfull+0x1a4>
+    for(nfiles = 0; ; nfiles++){
+    4a49:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    4a4d:	e9 83 fe ff ff       	jmp    48d5 <fsfull+0x27>
+            break;
+    4a52:	90                   	nop
+    }
+
+    while(nfiles >= 0){
+    4a53:	e9 db 00 00 00       	jmp    4b33 <fsfull+0x285>
+        char name[64];
+        name[0] = 'f';
+    4a58:	c6 45 a4 66          	movb   $0x66,-0x5c(%ebp)
+        name[1] = '0' + nfiles / 1000;
+    4a5c:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+    4a5f:	ba d3 4d 62 10       	mov    $0x10624dd3,%edx
+    4a64:	89 c8                	mov    %ecx,%eax
+    4a66:	f7 ea                	imul   %edx
+    4a68:	c1 fa 06             	sar    $0x6,%edx
+    4a6b:	89 c8                	mov    %ecx,%eax
+    4a6d:	c1 f8 1f             	sar    $0x1f,%eax
+    4a70:	29 c2                	sub    %eax,%edx
+    4a72:	89 d0                	mov    %edx,%eax
+    4a74:	83 c0 30             	add    $0x30,%eax
+    4a77:	88 45 a5             	mov    %al,-0x5b(%ebp)
+        name[2] = '0' + (nfiles % 1000) / 100;
+    4a7a:	8b 5d f4             	mov    -0xc(%ebp),%ebx
+    4a7d:	ba d3 4d 62 10       	mov    $0x10624dd3,%edx
+    4a82:	89 d8                	mov    %ebx,%eax
+    4a84:	f7 ea                	imul   %edx
+    4a86:	c1 fa 06             	sar    $0x6,%edx
+    4a89:	89 d8                	mov    %ebx,%eax
+    4a8b:	c1 f8 1f             	sar    $0x1f,%eax
+    4a8e:	89 d1                	mov    %edx,%ecx
+    4a90:	29 c1                	sub    %eax,%ecx
+    4a92:	69 c1 e8 03 00 00    	imul   $0x3e8,%ecx,%eax
+    4a98:	29 c3                	sub    %eax,%ebx
+    4a9a:	89 d9                	mov    %ebx,%ecx
+    4a9c:	ba 1f 85 eb 51       	mov    $0x51eb851f,%edx
+    4aa1:	89 c8                	mov    %ecx,%eax
+    4aa3:	f7 ea                	imul   %edx
+    4aa5:	c1 fa 05             	sar    $0x5,%edx
+    4aa8:	89 c8                	mov    %ecx,%eax
+    4aaa:	c1 f8 1f             	sar    $0x1f,%eax
+    4aad:	29 c2                	sub    %eax,%edx
+    4aaf:	89 d0                	mov    %edx,%eax
+    4ab1:	83 c0 30             	add    $0x30,%eax
+    4ab4:	88 45 a6             	mov    %al,-0x5a(%ebp)
+        name[3] = '0' + (nfiles % 100) / 10;
+    4ab7:	8b 5d f4             	mov    -0xc(%ebp),%ebx
+    4aba:	ba 1f 85 eb 51       	mov    $0x51eb851f,%edx
+    4abf:	89 d8                	mov    %ebx,%eax
+    4ac1:	f7 ea                	imul   %edx
+    4ac3:	c1 fa 05             	sar    $0x5,%edx
+    4ac6:	89 d8                	mov    %ebx,%eax
+    4ac8:	c1 f8 1f             	sar    $0x1f,%eax
+    4acb:	89 d1                	mov    %edx,%ecx
+    4acd:	29 c1                	sub    %eax,%ecx
+    4acf:	6b c1 64             	imul   $0x64,%ecx,%eax
+    4ad2:	29 c3                	sub    %eax,%ebx
+    4ad4:	89 d9                	mov    %ebx,%ecx
+    4ad6:	ba 67 66 66 66       	mov    $0x66666667,%edx
+    4adb:	89 c8                	mov    %ecx,%eax
+    4add:	f7 ea                	imul   %edx
+    4adf:	c1 fa 02             	sar    $0x2,%edx
+    4ae2:	89 c8                	mov    %ecx,%eax
+    4ae4:	c1 f8 1f             	sar    $0x1f,%eax
+    4ae7:	29 c2                	sub    %eax,%edx
+    4ae9:	89 d0                	mov    %edx,%eax
+    4aeb:	83 c0 30             	add    $0x30,%eax
+    4aee:	88 45 a7             	mov    %al,-0x59(%ebp)
+        name[4] = '0' + (nfiles % 10);
+    4af1:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+    4af4:	ba 67 66 66 66       	mov    $0x66666667,%edx
+    4af9:	89 c8                	mov    %ecx,%eax
+    4afb:	f7 ea                	imul   %edx
+    4afd:	c1 fa 02             	sar    $0x2,%edx
+    4b00:	89 c8                	mov    %ecx,%eax
+    4b02:	c1 f8 1f             	sar    $0x1f,%eax
+    4b05:	29 c2                	sub    %eax,%edx
+    4b07:	89 d0                	mov    %edx,%eax
+    4b09:	c1 e0 02             	shl    $0x2,%eax
+    4b0c:	01 d0                	add    %edx,%eax
+    4b0e:	01 c0                	add    %eax,%eax
+    4b10:	29 c1                	sub    %eax,%ecx
+    4b12:	89 ca                	mov    %ecx,%edx
+    4b14:	89 d0                	mov    %edx,%eax
+    4b16:	83 c0 30             	add    $0x30,%eax
+    4b19:	88 45 a8             	mov    %al,-0x58(%ebp)
+        name[5] = '\0';
+    4b1c:	c6 45 a9 00          	movb   $0x0,-0x57(%ebp)
+        unlink(name);
+    4b20:	83 ec 0c             	sub    $0xc,%esp
+    4b23:	8d 45 a4             	lea    -0x5c(%ebp),%eax
+    4b26:	50                   	push   %eax
+    4b27:	e8 12 06 00 00       	call   513e <unlink>
+    4b2c:	83 c4 10             	add    $0x10,%esp
+        nfiles--;
+    4b2f:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+    while(nfiles >= 0){
+    4b33:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    4b37:	0f 89 1b ff ff ff    	jns    4a58 <fsfull+0x1aa>
+    }
+
+    printf(1, "fsfull test finished\n");
+    4b3d:	83 ec 08             	sub    $0x8,%esp
+    4b40:	68 a3 77 00 00       	push   $0x77a3
+    4b45:	6a 01                	push   $0x1
+    4b47:	e8 95 08 00 00       	call   53e1 <printf>
+    4b4c:	83 c4 10             	add    $0x10,%esp
+}
+    4b4f:	90                   	nop
+    4b50:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    4b53:	c9                   	leave
+    4b54:	c3                   	ret
+
+00004b55 <uio>:
+
+void
+uio()
+{
+    4b55:	55                   	push   %ebp
+    4b56:	89 e5                	mov    %esp,%ebp
+    4b58:	83 ec 18             	sub    $0x18,%esp
+    #define RTC_ADDR 0x70
+    #define RTC_DATA 0x71
+
+    ushort port = 0;
+    4b5b:	66 c7 45 f6 00 00    	movw   $0x0,-0xa(%ebp)
+    uchar val = 0;
+    4b61:	c6 45 f5 00          	movb   $0x0,-0xb(%ebp)
+    int pid;
+
+    printf(1, "uio test\n");
+    4b65:	83 ec 08             	sub    $0x8,%esp
+    4b68:	68 b9 77 00 00       	push   $0x77b9
+    4b6d:	6a 01                	push   $0x1
+    4b6f:	e8 6d 08 00 00       	call   53e1 <printf>
+    4b74:	83 c4 10             	add    $0x10,%esp
+    pid = fork();
+    4b77:	e8 60 05 00 00       	call   50dc <fork>
+    4b7c:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(pid == 0){
+    4b7f:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    4b83:	75 3a                	jne    4bbf <uio+0x6a>
+        port = RTC_ADDR;
+    4b85:	66 c7 45 f6 70 00    	movw   $0x70,-0xa(%ebp)
+        val = 0x09;    /* year */
+    4b8b:	c6 45 f5 09          	movb   $0x9,-0xb(%ebp)
+        /* http://wiki.osdev.org/Inline_Assembly/Examples */
+        asm volatile("outb %0,%1"::"a"(val), "d" (port));
+    4b8f:	0f b6 45 f5          	movzbl -0xb(%ebp),%eax
+    4b93:	0f b7 55 f6          	movzwl -0xa(%ebp),%edx
+    4b97:	ee                   	out    %al,(%dx)
+        port = RTC_DATA;
+    4b98:	66 c7 45 f6 71 00    	movw   $0x71,-0xa(%ebp)
+        asm volatile("inb %1,%0" : "=a" (val) : "d" (port));
+    4b9e:	0f b7 45 f6          	movzwl -0xa(%ebp),%eax
+    4ba2:	89 c2                	mov    %eax,%edx
+    4ba4:	ec                   	in     (%dx),%al
+    4ba5:	88 45 f5             	mov    %al,-0xb(%ebp)
+        printf(1, "uio: uio succeeded; test FAILED\n");
+    4ba8:	83 ec 08             	sub    $0x8,%esp
+    4bab:	68 c4 77 00 00       	push   $0x77c4
+    4bb0:	6a 01                	push   $0x1
+    4bb2:	e8 2a 08 00 00       	call   53e1 <printf>
+    4bb7:	83 c4 10             	add    $0x10,%esp
+        exit();
+    4bba:	e8 24 05 00 00       	call   50e3 <exit>
+    } else if(pid < 0){
+    4bbf:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    4bc3:	79 17                	jns    4bdc <uio+0x87>
+        printf (1, "fork failed\n");
+    4bc5:	83 ec 08             	sub    $0x8,%esp
+    4bc8:	68 e9 5b 00 00       	push   $0x5be9
+    4bcd:	6a 01                	push   $0x1
+    4bcf:	e8 0d 08 00 00       	call   53e1 <printf>
+    4bd4:	83 c4 10             	add    $0x10,%esp
+        exit();
+    4bd7:	e8 07 05 00 00       	call   50e3 <exit>
+    }
+    wait();
+    4bdc:	e8 09 05 00 00       	call   50ea <wait>
+    printf(1, "uio test done\n");
+    4be1:	83 ec 08             	sub    $0x8,%esp
+    4be4:	68 e5 77 00 00       	push   $0x77e5
+    4be9:	6a 01                	push   $0x1
+    4beb:	e8 f1 07 00 00       	call   53e1 <printf>
+    4bf0:	83 c4 10             	add    $0x10,%esp
+}
+    4bf3:	90                   	nop
+    4bf4:	c9                   	leave
+    4bf5:	c3                   	ret
+
+00004bf6 <argptest>:
+
+void argptest()
+{
+    4bf6:	55                   	push   %ebp
+    4bf7:	89 e5                	mov    %esp,%ebp
+    4bf9:	83 ec 18             	sub    $0x18,%esp
+    int fd;
+    fd = open("init", O_RDONLY);
+    4bfc:	83 ec 08             	sub    $0x8,%esp
+    4bff:	6a 00                	push   $0x0
+    4c01:	68 f4 77 00 00       	push   $0x77f4
+    4c06:	e8 1f 05 00 00       	call   512a <open>
+    4c0b:	83 c4 10             	add    $0x10,%esp
+    4c0e:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if (fd < 0) {
+    4c11:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    4c15:	79 17                	jns    4c2e <argptest+0x38>
+        printf(2, "open failed\n");
+    4c17:	83 ec 08             	sub    $0x8,%esp
+    4c1a:	68 f9 77 00 00       	push   $0x77f9
+    4c1f:	6a 02                	push   $0x2
+    4c21:	e8 bb 07 00 00       	call   53e1 <printf>
+    4c26:	83 c4 10             	add    $0x10,%esp
+        exit();
+    4c29:	e8 b5 04 00 00       	call   50e3 <exit>
+    }
+    read(fd, sbrk(0) - 1, -1);
+    4c2e:	83 ec 0c             	sub    $0xc,%esp
+    4c31:	6a 00                	push   $0x0
+    4c33:	e8 4c 05 00 00       	call   5184 <sbrk>
+    4c38:	83 c4 10             	add    $0x10,%esp
+    4c3b:	83 e8 01             	sub    $0x1,%eax
+    4c3e:	83 ec 04             	sub    $0x4,%esp
+    4c41:	6a ff                	push   $0xffffffff
+    4c43:	50                   	push   %eax
+    4c44:	ff 75 f4             	push   -0xc(%ebp)
+    4c47:	e8 ac 04 00 00       	call   50f8 <read>
+    4c4c:	83 c4 10             	add    $0x10,%esp
+    close(fd);
+    4c4f:	83 ec 0c             	sub    $0xc,%esp
+    4c52:	ff 75 f4             	push   -0xc(%ebp)
+    4c55:	e8 b2 04 00 00       	call   510c <close>
+    4c5a:	83 c4 10             	add    $0x10,%esp
+    printf(1, "arg test passed\n");
+    4c5d:	83 ec 08             	sub    $0x8,%esp
+    4c60:	68 06 78 00 00       	push   $0x7806
+    4c65:	6a 01                	push   $0x1
+    4c67:	e8 75 07 00 00       	call   53e1 <printf>
+    4c6c:	83 c4 10             	add    $0x10,%esp
+}
+    4c6f:	90                   	nop
+    4c70:	c9                   	leave
+    4c71:	c3                   	ret
+
+00004c72 <rand>:
+
+unsigned long randstate = 1;
+unsigned int
+rand()
+{
+    4c72:	55                   	push   %ebp
+    4c73:	89 e5                	mov    %esp,%ebp
+    randstate = randstate * 1664525 + 1013904223;
+    4c75:	a1 70 81 00 00       	mov    0x8170,%eax
+    4c7a:	69 c0 0d 66 19 00    	imul   $0x19660d,%eax,%eax
+    4c80:	05 5f f3 6e 3c       	add    $0x3c6ef35f,%eax
+    4c85:	a3 70 81 00 00       	mov    %eax,0x8170
+    return randstate;
+    4c8a:	a1 70 81 00 00       	mov    0x8170,%eax
+}
+    4c8f:	5d                   	pop    %ebp
+    4c90:	c3                   	ret
+
+00004c91 <main>:
+
+int
+main(int argc, char *argv[])
+{
+    4c91:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+    4c95:	83 e4 f0             	and    $0xfffffff0,%esp
+    4c98:	ff 71 fc             	push   -0x4(%ecx)
+    4c9b:	55                   	push   %ebp
+    4c9c:	89 e5                	mov    %esp,%ebp
+    4c9e:	51                   	push   %ecx
+    4c9f:	83 ec 04             	sub    $0x4,%esp
+    printf(1, "usertests starting\n");
+    4ca2:	83 ec 08             	sub    $0x8,%esp
+    4ca5:	68 17 78 00 00       	push   $0x7817
+    4caa:	6a 01                	push   $0x1
+    4cac:	e8 30 07 00 00       	call   53e1 <printf>
+    4cb1:	83 c4 10             	add    $0x10,%esp
+
+    if(open("usertests.ran", 0) >= 0){
+    4cb4:	83 ec 08             	sub    $0x8,%esp
+    4cb7:	6a 00                	push   $0x0
+    4cb9:	68 2b 78 00 00       	push   $0x782b
+    4cbe:	e8 67 04 00 00       	call   512a <open>
+    4cc3:	83 c4 10             	add    $0x10,%esp
+    4cc6:	85 c0                	test   %eax,%eax
+    4cc8:	78 17                	js     4ce1 <main+0x50>
+        printf(1, "already ran user tests -- rebuild fs.img\n");
+    4cca:	83 ec 08             	sub    $0x8,%esp
+    4ccd:	68 3c 78 00 00       	push   $0x783c
+    4cd2:	6a 01                	push   $0x1
+    4cd4:	e8 08 07 00 00       	call   53e1 <printf>
+    4cd9:	83 c4 10             	add    $0x10,%esp
+        exit();
+    4cdc:	e8 02 04 00 00       	call   50e3 <exit>
+    }
+    close(open("usertests.ran", O_CREATE));
+    4ce1:	83 ec 08             	sub    $0x8,%esp
+    4ce4:	68 00 02 00 00       	push   $0x200
+    4ce9:	68 2b 78 00 00       	push   $0x782b
+    4cee:	e8 37 04 00 00       	call   512a <open>
+    4cf3:	83 c4 10             	add    $0x10,%esp
+    4cf6:	83 ec 0c             	sub    $0xc,%esp
+    4cf9:	50                   	push   %eax
+    4cfa:	e8 0d 04 00 00       	call   510c <close>
+    4cff:	83 c4 10             	add    $0x10,%esp
+
+    argptest();
+    4d02:	e8 ef fe ff ff       	call   4bf6 <argptest>
+    createdelete();
+    4d07:	e8 85 d4 ff ff       	call   2191 <createdelete>
+    linkunlink();
+    4d0c:	e8 aa de ff ff       	call   2bbb <linkunlink>
+    concreate();
+    4d11:	e8 f1 da ff ff       	call   2807 <concreate>
+    fourfiles();
+    4d16:	e8 25 d2 ff ff       	call   1f40 <fourfiles>
+    sharedfd();
+    4d1b:	e8 3d d0 ff ff       	call   1d5d <sharedfd>
+
+    bigargtest();
+    4d20:	e8 4d fa ff ff       	call   4772 <bigargtest>
+    bigwrite();
+    4d25:	e8 8d e8 ff ff       	call   35b7 <bigwrite>
+    bigargtest();
+    4d2a:	e8 43 fa ff ff       	call   4772 <bigargtest>
+    bsstest();
+    4d2f:	e8 c8 f9 ff ff       	call   46fc <bsstest>
+    sbrktest();
+    4d34:	e8 e1 f3 ff ff       	call   411a <sbrktest>
+    validatetest();
+    4d39:	e8 e0 f8 ff ff       	call   461e <validatetest>
+
+    opentest();
+    4d3e:	e8 bc b5 ff ff       	call   2ff <opentest>
+    writetest();
+    4d43:	e8 66 b6 ff ff       	call   3ae <writetest>
+    writetest1();
+    4d48:	e8 71 b8 ff ff       	call   5be <writetest1>
+    createtest();
+    4d4d:	e8 68 ba ff ff       	call   7ba <createtest>
+    vectortest();
+    4d52:	e8 fb c2 ff ff       	call   1052 <vectortest>
+    splicetest();
+    4d57:	e8 dd c6 ff ff       	call   1439 <splicetest>
+
+    openiputtest();
+    4d5c:	e8 8f b4 ff ff       	call   1f0 <openiputtest>
+    exitiputtest();
+    4d61:	e8 8b b3 ff ff       	call   f1 <exitiputtest>
+    iputtest();
+    4d66:	e8 95 b2 ff ff       	call   0 <iputtest>
+
+    mem();
+    4d6b:	e8 fc ce ff ff       	call   1c6c <mem>
+    pipe1();
+    4d70:	e8 4c bc ff ff       	call   9c1 <pipe1>
+    preempt();
+    4d75:	e8 30 be ff ff       	call   baa <preempt>
+    exitwait();
+    4d7a:	e8 91 bf ff ff       	call   d10 <exitwait>
+    nanosleeptest();
+    4d7f:	e8 04 c0 ff ff       	call   d88 <nanosleeptest>
+    rttest();
+    4d84:	e8 60 c1 ff ff       	call   ee9 <rttest>
+    vdsotest();
+    4d89:	e8 96 cd ff ff       	call   1b24 <vdsotest>
+    sysstattest();
+    4d8e:	e8 c9 cb ff ff       	call   195c <sysstattest>
+
+    rmdot();
+    4d93:	e8 91 ec ff ff       	call   3a29 <rmdot>
+    fourteen();
+    4d98:	e8 30 eb ff ff       	call   38cd <fourteen>
+    bigfile();
+    4d9d:	e8 13 e9 ff ff       	call   36b5 <bigfile>
+    subdir();
+    4da2:	e8 cc e0 ff ff       	call   2e73 <subdir>
+    linktest();
+    4da7:	e8 19 d8 ff ff       	call   25c5 <linktest>
+    unlinkread();
+    4dac:	e8 52 d6 ff ff       	call   2403 <unlinkread>
+    dirfile();
+    4db1:	e8 28 ef ff ff       	call   3cde <dirfile>
+    ncachefile();
+    4db6:	e8 f3 ed ff ff       	call   3bae <ncachefile>
+    iref();
+    4dbb:	e8 56 f1 ff ff       	call   3f16 <iref>
+    forktest();
+    4dc0:	e8 8b f2 ff ff       	call   4050 <forktest>
+    bigdir(); // slow
+    4dc5:	e8 28 df ff ff       	call   2cf2 <bigdir>
+
+    uio();
+    4dca:	e8 86 fd ff ff       	call   4b55 <uio>
+
+    exectest();
+    4dcf:	e8 9a bb ff ff       	call   96e <exectest>
+
+    exit();
+    4dd4:	e8 0a 03 00 00       	call   50e3 <exit>
+
+00004dd9 <stosb>:
+strchr(const char *s, char c)
+{
+    for(; *s; s++)
+        if(*s == c)
+            return (char*)s;
+    return 0;
+    4dd9:	55                   	push   %ebp
+    4dda:	89 e5                	mov    %esp,%ebp
+    4ddc:	57                   	push   %edi
+    4ddd:	53                   	push   %ebx
+}
+    4dde:	8b 4d 08             	mov    0x8(%ebp),%ecx
+    4de1:	8b 55 10             	mov    0x10(%ebp),%edx
+    4de4:	8b 45 0c             	mov    0xc(%ebp),%eax
+    4de7:	89 cb                	mov    %ecx,%ebx
+    4de9:	89 df                	mov    %ebx,%edi
+    4deb:	89 d1                	mov    %edx,%ecx
+    4ded:	fc                   	cld
+    4dee:	f3 aa                	rep stos %al,%es:(%edi)
+    4df0:	89 ca                	mov    %ecx,%edx
+    4df2:	89 fb                	mov    %edi,%ebx
+    4df4:	89 5d 08             	mov    %ebx,0x8(%ebp)
+    4df7:	89 55 10             	mov    %edx,0x10(%ebp)
+
+char*
+gets(char *buf, int max)
+{
+    4dfa:	90                   	nop
+    4dfb:	5b                   	pop    %ebx
+    4dfc:	5f                   	pop    %edi
+    4dfd:	5d                   	pop    %ebp
+    4dfe:	c3                   	ret
+
+00004dff <strcpy>:
+{
+    4dff:	55                   	push   %ebp
+    4e00:	89 e5                	mov    %esp,%ebp
+    4e02:	83 ec 10             	sub    $0x10,%esp
+    os = s;
+    4e05:	8b 45 08             	mov    0x8(%ebp),%eax
+    4e08:	89 45 fc             	mov    %eax,-0x4(%ebp)
+    while((*s++ = *t++) != 0)
+    4e0b:	90                   	nop
+    4e0c:	8b 55 0c             	mov    0xc(%ebp),%edx
+    4e0f:	8d 42 01             	lea    0x1(%edx),%eax
+    4e12:	89 45 0c             	mov    %eax,0xc(%ebp)
+    4e15:	8b 45 08             	mov    0x8(%ebp),%eax
+    4e18:	8d 48 01             	lea    0x1(%eax),%ecx
+    4e1b:	89 4d 08             	mov    %ecx,0x8(%ebp)
+    4e1e:	0f b6 12             	movzbl (%edx),%edx
+    4e21:	88 10                	mov    %dl,(%eax)
+    4e23:	0f b6 00             	movzbl (%eax),%eax
+    4e26:	84 c0                	test   %al,%al
+    4e28:	75 e2                	jne    4e0c <strcpy+0xd>
+    return os;
+    4e2a:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+    4e2d:	c9                   	leave
+    4e2e:	c3                   	ret
+
+00004e2f <strcmp>:
+{
+    4e2f:	55                   	push   %ebp
+    4e30:	89 e5                	mov    %esp,%ebp
+    while(*p && *p == *q)
+    4e32:	eb 08                	jmp    4e3c <strcmp+0xd>
+        p++, q++;
+    4e34:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+    4e38:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+    while(*p && *p == *q)
+    4e3c:	8b 45 08             	mov    0x8(%ebp),%eax
+    4e3f:	0f b6 00             	movzbl (%eax),%eax
+    4e42:	84 c0                	test   %al,%al
+    4e44:	74 10                	je     4e56 <strcmp+0x27>
+    4e46:	8b 45 08             	mov    0x8(%ebp),%eax
+    4e49:	0f b6 10             	movzbl (%eax),%edx
+    4e4c:	8b 45 0c             	mov    0xc(%ebp),%eax
+    4e4f:	0f b6 00             	movzbl (%eax),%eax
+    4e52:	38 c2                	cmp    %al,%dl
+    4e54:	74 de                	je     4e34 <strcmp+0x5>
+    return (uchar)*p - (uchar)*q;
+    4e56:	8b 45 08             	mov    0x8(%ebp),%eax
+    4e59:	0f b6 00             	movzbl (%eax),%eax
+    4e5c:	0f b6 d0             	movzbl %al,%edx
+    4e5f:	8b 45 0c             	mov    0xc(%ebp),%eax
+    4e62:	0f b6 00             	movzbl (%eax),%eax
+    4e65:	0f b6 c0             	movzbl %al,%eax
+    4e68:	29 c2                	sub    %eax,%edx
+    4e6a:	89 d0                	mov    %edx,%eax
+}
+    4e6c:	5d                   	pop    %ebp
+    4e6d:	c3                   	ret
+
+00004e6e <strlen>:
+{
+    4e6e:	55                   	push   %ebp
+    4e6f:	89 e5                	mov    %esp,%ebp
+    4e71:	83 ec 10             	sub    $0x10,%esp
+    for(n = 0; s[n]; n++)
+    4e74:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+    4e7b:	eb 04                	jmp    4e81 <strlen+0x13>
+    4e7d:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+    4e81:	8b 55 fc             	mov    -0x4(%ebp),%edx
+    4e84:	8b 45 08             	mov    0x8(%ebp),%eax
+    4e87:	01 d0                	add    %edx,%eax
+    4e89:	0f b6 00             	movzbl (%eax),%eax
+    4e8c:	84 c0                	test   %al,%al
+    4e8e:	75 ed                	jne    4e7d <strlen+0xf>
+    return n;
+    4e90:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+    4e93:	c9                   	leave
+    4e94:	c3                   	ret
+
+00004e95 <memset>:
+{
+    4e95:	55                   	push   %ebp
+    4e96:	89 e5                	mov    %esp,%ebp
+    stosb(dst, c, n);
+    4e98:	8b 45 10             	mov    0x10(%ebp),%eax
+    4e9b:	50                   	push   %eax
+    4e9c:	ff 75 0c             	push   0xc(%ebp)
+    4e9f:	ff 75 08             	push   0x8(%ebp)
+    4ea2:	e8 32 ff ff ff       	call   4dd9 <stosb>
+    4ea7:	83 c4 0c             	add    $0xc,%esp
+    return dst;
+    4eaa:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+    4ead:	c9                   	leave
+    4eae:	c3                   	ret
+
+00004eaf <strchr>:
+{
+    4eaf:	55                   	push   %ebp
+    4eb0:	89 e5                	mov    %esp,%ebp
+    4eb2:	83 ec 04             	sub    $0x4,%esp
+    4eb5:	8b 45 0c             	mov    0xc(%ebp),%eax
+    4eb8:	88 45 fc             	mov    %al,-0x4(%ebp)
+    for(; *s; s++)
+    4ebb:	eb 14                	jmp    4ed1 <strchr+0x22>
+        if(*s == c)
+    4ebd:	8b 45 08             	mov    0x8(%ebp),%eax
+    4ec0:	0f b6 00             	movzbl (%eax),%eax
+    4ec3:	38 45 fc             	cmp    %al,-0x4(%ebp)
+    4ec6:	75 05                	jne    4ecd <strchr+0x1e>
+            return (char*)s;
+    4ec8:	8b 45 08             	mov    0x8(%ebp),%eax
+    4ecb:	eb 13                	jmp    4ee0 <strchr+0x31>
+    for(; *s; s++)
+    4ecd:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+    4ed1:	8b 45 08             	mov    0x8(%ebp),%eax
+    4ed4:	0f b6 00             	movzbl (%eax),%eax
+    4ed7:	84 c0                	test   %al,%al
+    4ed9:	75 e2                	jne    4ebd <strchr+0xe>
+    return 0;
+    4edb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    4ee0:	c9                   	leave
+    4ee1:	c3                   	ret
+
+00004ee2 <gets>:
+{
+    4ee2:	55                   	push   %ebp
+    4ee3:	89 e5                	mov    %esp,%ebp
+    4ee5:	83 ec 18             	sub    $0x18,%esp
+    int i, cc;
+    char c;
+
+    for(i=0; i+1 < max; ){
+    4ee8:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    4eef:	eb 42                	jmp    4f33 <gets+0x51>
+        cc = read(0, &c, 1);
+    4ef1:	83 ec 04             	sub    $0x4,%esp
+    4ef4:	6a 01                	push   $0x1
+    4ef6:	8d 45 ef             	lea    -0x11(%ebp),%eax
+    4ef9:	50                   	push   %eax
+    4efa:	6a 00                	push   $0x0
+    4efc:	e8 f7 01 00 00       	call   50f8 <read>
+    4f01:	83 c4 10             	add    $0x10,%esp
+    4f04:	89 45 f0             	mov    %eax,-0x10(%ebp)
+        if(cc < 1)
+    4f07:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    4f0b:	7e 33                	jle    4f40 <gets+0x5e>
+            break;
+        buf[i++] = c;
+    4f0d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    4f10:	8d 50 01             	lea    0x1(%eax),%edx
+    4f13:	89 55 f4             	mov    %edx,-0xc(%ebp)
+    4f16:	89 c2                	mov    %eax,%edx
+    4f18:	8b 45 08             	mov    0x8(%ebp),%eax
+    4f1b:	01 c2                	add    %eax,%edx
+    4f1d:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+    4f21:	88 02                	mov    %al,(%edx)
+        if(c == '\n' || c == '\r')
+    4f23:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+    4f27:	3c 0a                	cmp    $0xa,%al
+    4f29:	74 16                	je     4f41 <gets+0x5f>
+    4f2b:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+    4f2f:	3c 0d                	cmp    $0xd,%al
+    4f31:	74 0e                	je     4f41 <gets+0x5f>
+    for(i=0; i+1 < max; ){
+    4f33:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    4f36:	83 c0 01             	add    $0x1,%eax
+    4f39:	39 45 0c             	cmp    %eax,0xc(%ebp)
+    4f3c:	7f b3                	jg     4ef1 <gets+0xf>
+    4f3e:	eb 01                	jmp    4f41 <gets+0x5f>
+            break;
+    4f40:	90                   	nop
+            break;
+    }
+    buf[i] = '\0';
+    4f41:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    4f44:	8b 45 08             	mov    0x8(%ebp),%eax
+    4f47:	01 d0                	add    %edx,%eax
+    4f49:	c6 00 00             	movb   $0x0,(%eax)
+    return buf;
+    4f4c:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+    4f4f:	c9                   	leave
+    4f50:	c3                   	ret
+
+00004f51 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+    4f51:	55                   	push   %ebp
+    4f52:	89 e5                	mov    %esp,%ebp
+    4f54:	83 ec 18             	sub    $0x18,%esp
+    int fd;
+    int r;
+
+    fd = open(n, O_RDONLY);
+    4f57:	83 ec 08             	sub    $0x8,%esp
+    4f5a:	6a 00                	push   $0x0
+    4f5c:	ff 75 08             	push   0x8(%ebp)
+    4f5f:	e8 c6 01 00 00       	call   512a <open>
+    4f64:	83 c4 10             	add    $0x10,%esp
+    4f67:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(fd < 0)
+    4f6a:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    4f6e:	79 07                	jns    4f77 <stat+0x26>
+        return -1;
+    4f70:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    4f75:	eb 25                	jmp    4f9c <stat+0x4b>
+    r = fstat(fd, st);
+    4f77:	83 ec 08             	sub    $0x8,%esp
+    4f7a:	ff 75 0c             	push   0xc(%ebp)
+    4f7d:	ff 75 f4             	push   -0xc(%ebp)
+    4f80:	e8 c3 01 00 00       	call   5148 <fstat>
+    4f85:	83 c4 10             	add    $0x10,%esp
+    4f88:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    close(fd);
+    4f8b:	83 ec 0c             	sub    $0xc,%esp
+    4f8e:	ff 75 f4             	push   -0xc(%ebp)
+    4f91:	e8 76 01 00 00       	call   510c <close>
+    4f96:	83 c4 10             	add    $0x10,%esp
+    return r;
+    4f99:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+    4f9c:	c9                   	leave
+    4f9d:	c3                   	ret
+
+00004f9e <atoi>:
+
+int
+atoi(const char *s)
+{
+    4f9e:	55                   	push   %ebp
+    4f9f:	89 e5                	mov    %esp,%ebp
+    4fa1:	83 ec 10             	sub    $0x10,%esp
+    int n;
+
+    n = 0;
+    4fa4:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+    while('0' <= *s && *s <= '9')
+    4fab:	eb 25                	jmp    4fd2 <atoi+0x34>
+        n = n*10 + *s++ - '0';
+    4fad:	8b 55 fc             	mov    -0x4(%ebp),%edx
+    4fb0:	89 d0                	mov    %edx,%eax
+    4fb2:	c1 e0 02             	shl    $0x2,%eax
+    4fb5:	01 d0                	add    %edx,%eax
+    4fb7:	01 c0                	add    %eax,%eax
+    4fb9:	89 c1                	mov    %eax,%ecx
+    4fbb:	8b 45 08             	mov    0x8(%ebp),%eax
+    4fbe:	8d 50 01             	lea    0x1(%eax),%edx
+    4fc1:	89 55 08             	mov    %edx,0x8(%ebp)
+    4fc4:	0f b6 00             	movzbl (%eax),%eax
+    4fc7:	0f be c0             	movsbl %al,%eax
+    4fca:	01 c8                	add    %ecx,%eax
+    4fcc:	83 e8 30             	sub    $0x30,%eax
+    4fcf:	89 45 fc             	mov    %eax,-0x4(%ebp)
+    while('0' <= *s && *s <= '9')
+    4fd2:	8b 45 08             	mov    0x8(%ebp),%eax
+    4fd5:	0f b6 00             	movzbl (%eax),%eax
+    4fd8:	3c 2f                	cmp    $0x2f,%al
+    4fda:	7e 0a                	jle    4fe6 <atoi+0x48>
+    4fdc:	8b 45 08             	mov    0x8(%ebp),%eax
+    4fdf:	0f b6 00             	movzbl (%eax),%eax
+    4fe2:	3c 39                	cmp    $0x39,%al
+    4fe4:	7e c7                	jle    4fad <atoi+0xf>
+    return n;
+    4fe6:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+    4fe9:	c9                   	leave
+    4fea:	c3                   	ret
+
+00004feb <nice>:
+
+// Add inc to the caller's nice value; return the new value.
+int
+nice(int inc)
+{
+    4feb:	55                   	push   %ebp
+    4fec:	89 e5                	mov    %esp,%ebp
+    4fee:	83 ec 18             	sub    $0x18,%esp
+    int n;
+
+    n = getpriority(0) + inc;
+    4ff1:	83 ec 0c             	sub    $0xc,%esp
+    4ff4:	6a 00                	push   $0x0
+    4ff6:	e8 d9 01 00 00       	call   51d4 <getpriority>
+    4ffb:	83 c4 10             	add    $0x10,%esp
+    4ffe:	8b 55 08             	mov    0x8(%ebp),%edx
+    5001:	01 d0                	add    %edx,%eax
+    5003:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(n < 0)
+    5006:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    500a:	79 07                	jns    5013 <nice+0x28>
+        n = 0;
+    500c:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    if(n > NICEMAX)
+    5013:	83 7d f4 13          	cmpl   $0x13,-0xc(%ebp)
+    5017:	7e 07                	jle    5020 <nice+0x35>
+        n = NICEMAX;
+    5019:	c7 45 f4 13 00 00 00 	movl   $0x13,-0xc(%ebp)
+    if(setpriority(0, n) < 0)
+    5020:	83 ec 08             	sub    $0x8,%esp
+    5023:	ff 75 f4             	push   -0xc(%ebp)
+    5026:	6a 00                	push   $0x0
+    5028:	e8 b1 01 00 00       	call   51de <setpriority>
+    502d:	83 c4 10             	add    $0x10,%esp
+    5030:	85 c0                	test   %eax,%eax
+    5032:	79 07                	jns    503b <nice+0x50>
+        return -1;
+    5034:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    5039:	eb 03                	jmp    503e <nice+0x53>
+    return n;
+    503b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+    503e:	c9                   	leave
+    503f:	c3                   	ret
+
+00005040 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+    5040:	55                   	push   %ebp
+    5041:	89 e5                	mov    %esp,%ebp
+    5043:	83 ec 10             	sub    $0x10,%esp
+    char *dst;
+    const char *src;
+
+    dst = vdst;
+    5046:	8b 45 08             	mov    0x8(%ebp),%eax
+    5049:	89 45 fc             	mov    %eax,-0x4(%ebp)
+    src = vsrc;
+    504c:	8b 45 0c             	mov    0xc(%ebp),%eax
+    504f:	89 45 f8             	mov    %eax,-0x8(%ebp)
+    while(n-- > 0)
+    5052:	eb 17                	jmp    506b <memmove+0x2b>
+        *dst++ = *src++;
+    5054:	8b 55 f8             	mov    -0x8(%ebp),%edx
+    5057:	8d 42 01             	lea    0x1(%edx),%eax
+    505a:	89 45 f8             	mov    %eax,-0x8(%ebp)
+    505d:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    5060:	8d 48 01             	lea    0x1(%eax),%ecx
+    5063:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+    5066:	0f b6 12             	movzbl (%edx),%edx
+    5069:	88 10                	mov    %dl,(%eax)
+    while(n-- > 0)
+    506b:	8b 45 10             	mov    0x10(%ebp),%eax
+    506e:	8d 50 ff             	lea    -0x1(%eax),%edx
+    5071:	89 55 10             	mov    %edx,0x10(%ebp)
+    5074:	85 c0                	test   %eax,%eax
+    5076:	7f dc                	jg     5054 <memmove+0x14>
+    return vdst;
+    5078:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+    507b:	c9                   	leave
+    507c:	c3                   	ret
+
+0000507d <dosyscall>:
+sysmode:
+    .long 0
+
+    .text
+dosyscall:
+    cmpl $0, sysmode
+    507d:	83 3d 74 81 00 00 00 	cmpl   $0x0,0x8174
+    jg 2f
+    5084:	7f 0c                	jg     5092 <dosyscall+0x15>
+    jl 1f
+    5086:	7c 07                	jl     508f <dosyscall+0x12>
+    call sepcheck
+    5088:	e8 27 00 00 00       	call   50b4 <sepcheck>
+    jmp dosyscall
+    508d:	eb ee                	jmp    507d <dosyscall>
+1:
+    int $T_SYSCALL
+    508f:	cd 40                	int    $0x40
+    ret
+    5091:	c3                   	ret
+2:
+    pushl %ebx
+    5092:	53                   	push   %ebx
+    pushl %esi
+    5093:	56                   	push   %esi
+    pushl %edi
+    5094:	57                   	push   %edi
+    pushl %ebp
+    5095:	55                   	push   %ebp
+    movl 20(%esp), %ebx
+    5096:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+    movl 24(%esp), %esi
+    509a:	8b 74 24 18          	mov    0x18(%esp),%esi
+    movl 28(%esp), %edi
+    509e:	8b 7c 24 1c          	mov    0x1c(%esp),%edi
+    movl 32(%esp), %ebp
+    50a2:	8b 6c 24 20          	mov    0x20(%esp),%ebp
+    movl %esp, %ecx
+    50a6:	89 e1                	mov    %esp,%ecx
+    movl $3f, %edx
+    50a8:	ba af 50 00 00       	mov    $0x50af,%edx
+    sysenter
+    50ad:	0f 34                	sysenter
+3:
+    popl %ebp
+    50af:	5d                   	pop    %ebp
+    popl %edi
+    50b0:	5f                   	pop    %edi
+    popl %esi
+    50b1:	5e                   	pop    %esi
+    popl %ebx
+    50b2:	5b                   	pop    %ebx
+    ret
+    50b3:	c3                   	ret
+
+000050b4 <sepcheck>:
+
+# Set sysmode from cpuid's SEP flag.    Preserves %eax.
+sepcheck:
+    pushl %eax
+    50b4:	50                   	push   %eax
+    pushl %ebx
+    50b5:	53                   	push   %ebx
+    movl $1, %eax
+    50b6:	b8 01 00 00 00       	mov    $0x1,%eax
+    cpuid
+    50bb:	0f a2                	cpuid
+    movl $-1, sysmode
+    50bd:	c7 05 74 81 00 00 ff 	movl   $0xffffffff,0x8174
+    50c4:	ff ff ff 
+    testl $0x800, %edx
+    50c7:	f7 c2 00 08 00 00    	test   $0x800,%edx
+    jz 1f
+    50cd:	74 0a                	je     50d9 <sepcheck+0x25>
+    movl $1, sysmode
+    50cf:	c7 05 74 81 00 00 01 	movl   $0x1,0x8174
+    50d6:	00 00 00 
+1:
+    popl %ebx
+    50d9:	5b                   	pop    %ebx
+    popl %eax
+    50da:	58                   	pop    %eax
+    ret
+    50db:	c3                   	ret
+
+000050dc <fork>:
+
+SYSCALL(fork)
+    50dc:	b8 01 00 00 00       	mov    $0x1,%eax
+    50e1:	eb 9a                	jmp    507d <dosyscall>
+
+000050e3 <exit>:
+SYSCALL(exit)
+    50e3:	b8 02 00 00 00       	mov    $0x2,%eax
+    50e8:	eb 93                	jmp    507d <dosyscall>
+
+000050ea <wait>:
+SYSCALL(wait)
+    50ea:	b8 03 00 00 00       	mov    $0x3,%eax
+    50ef:	eb 8c                	jmp    507d <dosyscall>
+
+000050f1 <pipe>:
+SYSCALL(pipe)
+    50f1:	b8 04 00 00 00       	mov    $0x4,%eax
+    50f6:	eb 85                	jmp    507d <dosyscall>
+
+000050f8 <read>:
+SYSCALL(read)
+    50f8:	b8 05 00 00 00       	mov    $0x5,%eax
+    50fd:	e9 7b ff ff ff       	jmp    507d <dosyscall>
+
+00005102 <write>:
+SYSCALL(write)
+    5102:	b8 10 00 00 00       	mov    $0x10,%eax
+    5107:	e9 71 ff ff ff       	jmp    507d <dosyscall>
+
+0000510c <close>:
+SYSCALL(close)
+    510c:	b8 15 00 00 00       	mov    $0x15,%eax
+    5111:	e9 67 ff ff ff       	jmp    507d <dosyscall>
+
+00005116 <kill>:
+SYSCALL(kill)
+    5116:	b8 06 00 00 00       	mov    $0x6,%eax
+    511b:	e9 5d ff ff ff       	jmp    507d <dosyscall>
+
+00005120 <exec>:
+SYSCALL(exec)
+    5120:	b8 07 00 00 00       	mov    $0x7,%eax
+    5125:	e9 53 ff ff ff       	jmp    507d <dosyscall>
+
+0000512a <open>:
+SYSCALL(open)
+    512a:	b8 0f 00 00 00       	mov    $0xf,%eax
+    512f:	e9 49 ff ff ff       	jmp    507d <dosyscall>
+
+00005134 <mknod>:
+SYSCALL(mknod)
+    5134:	b8 11 00 00 00       	mov    $0x11,%eax
+    5139:	e9 3f ff ff ff       	jmp    507d <dosyscall>
+
+0000513e <unlink>:
+SYSCALL(unlink)
+    513e:	b8 12 00 00 00       	mov    $0x12,%eax
+    5143:	e9 35 ff ff ff       	jmp    507d <dosyscall>
+
+00005148 <fstat>:
+SYSCALL(fstat)
+    5148:	b8 08 00 00 00       	mov    $0x8,%eax
+    514d:	e9 2b ff ff ff       	jmp    507d <dosyscall>
+
+00005152 <link>:
+SYSCALL(link)
+    5152:	b8 13 00 00 00       	mov    $0x13,%eax
+    5157:	e9 21 ff ff ff       	jmp    507d <dosyscall>
+
+0000515c <mkdir>:
+SYSCALL(mkdir)
+    515c:	b8 14 00 00 00       	mov    $0x14,%eax
+    5161:	e9 17 ff ff ff       	jmp    507d <dosyscall>
+
+00005166 <chdir>:
+SYSCALL(chdir)
+    5166:	b8 09 00 00 00       	mov    $0x9,%eax
+    516b:	e9 0d ff ff ff       	jmp    507d <dosyscall>
+
+00005170 <dup>:
+SYSCALL(dup)
+    5170:	b8 0a 00 00 00       	mov    $0xa,%eax
+    5175:	e9 03 ff ff ff       	jmp    507d <dosyscall>
+
+0000517a <getpid>:
+SYSCALL(getpid)
+    517a:	b8 0b 00 00 00       	mov    $0xb,%eax
+    517f:	e9 f9 fe ff ff       	jmp    507d <dosyscall>
+
+00005184 <sbrk>:
+SYSCALL(sbrk)
+    5184:	b8 0c 00 00 00       	mov    $0xc,%eax
+    5189:	e9 ef fe ff ff       	jmp    507d <dosyscall>
+
+0000518e <sleep>:
+SYSCALL(sleep)
+    518e:	b8 0d 00 00 00       	mov    $0xd,%eax
+    5193:	e9 e5 fe ff ff       	jmp    507d <dosyscall>
+
+00005198 <uptime>:
+SYSCALL(uptime)
+    5198:	b8 0e 00 00 00       	mov    $0xe,%eax
+    519d:	e9 db fe ff ff       	jmp    507d <dosyscall>
+
+000051a2 <date>:
+SYSCALL(date)
+    51a2:	b8 16 00 00 00       	mov    $0x16,%eax
+    51a7:	e9 d1 fe ff ff       	jmp    507d <dosyscall>
+
+000051ac <dup2>:
+SYSCALL(dup2)
+    51ac:	b8 17 00 00 00       	mov    $0x17,%eax
+    51b1:	e9 c7 fe ff ff       	jmp    507d <dosyscall>
+
+000051b6 <uffd>:
+SYSCALL(uffd)
+    51b6:	b8 1a 00 00 00       	mov    $0x1a,%eax
+    51bb:	e9 bd fe ff ff       	jmp    507d <dosyscall>
+
+000051c0 <uffdregister>:
+SYSCALL(uffdregister)
+    51c0:	b8 1b 00 00 00       	mov    $0x1b,%eax
+    51c5:	e9 b3 fe ff ff       	jmp    507d <dosyscall>
+
+000051ca <uffdcopy>:
+SYSCALL(uffdcopy)
+    51ca:	b8 1c 00 00 00       	mov    $0x1c,%eax
+    51cf:	e9 a9 fe ff ff       	jmp    507d <dosyscall>
+
+000051d4 <getpriority>:
+SYSCALL(getpriority)
+    51d4:	b8 1d 00 00 00       	mov    $0x1d,%eax
+    51d9:	e9 9f fe ff ff       	jmp    507d <dosyscall>
+
+000051de <setpriority>:
+SYSCALL(setpriority)
+    51de:	b8 1e 00 00 00       	mov    $0x1e,%eax
+    51e3:	e9 95 fe ff ff       	jmp    507d <dosyscall>
+
+000051e8 <setweight>:
+SYSCALL(setweight)
+    51e8:	b8 1f 00 00 00       	mov    $0x1f,%eax
+    51ed:	e9 8b fe ff ff       	jmp    507d <dosyscall>
+
+000051f2 <setgroup>:
+SYSCALL(setgroup)
+    51f2:	b8 20 00 00 00       	mov    $0x20,%eax
+    51f7:	e9 81 fe ff ff       	jmp    507d <dosyscall>
+
+000051fc <schedinfo>:
+SYSCALL(schedinfo)
+    51fc:	b8 21 00 00 00       	mov    $0x21,%eax
+    5201:	e9 77 fe ff ff       	jmp    507d <dosyscall>
+
+00005206 <nanosleep>:
+SYSCALL(nanosleep)
+    5206:	b8 22 00 00 00       	mov    $0x22,%eax
+    520b:	e9 6d fe ff ff       	jmp    507d <dosyscall>
+
+00005210 <clock_nanosleep>:
+SYSCALL(clock_nanosleep)
+    5210:	b8 23 00 00 00       	mov    $0x23,%eax
+    5215:	e9 63 fe ff ff       	jmp    507d <dosyscall>
+
+0000521a <clock_gettime>:
+SYSCALL(clock_gettime)
+    521a:	b8 24 00 00 00       	mov    $0x24,%eax
+    521f:	e9 59 fe ff ff       	jmp    507d <dosyscall>
+
+00005224 <sched_setaffinity>:
+SYSCALL(sched_setaffinity)
+    5224:	b8 25 00 00 00       	mov    $0x25,%eax
+    5229:	e9 4f fe ff ff       	jmp    507d <dosyscall>
+
+0000522e <sched_getaffinity>:
+SYSCALL(sched_getaffinity)
+    522e:	b8 26 00 00 00       	mov    $0x26,%eax
+    5233:	e9 45 fe ff ff       	jmp    507d <dosyscall>
+
+00005238 <irqaffinity>:
+SYSCALL(irqaffinity)
+    5238:	b8 27 00 00 00       	mov    $0x27,%eax
+    523d:	e9 3b fe ff ff       	jmp    507d <dosyscall>
+
+00005242 <getrusage>:
+SYSCALL(getrusage)
+    5242:	b8 28 00 00 00       	mov    $0x28,%eax
+    5247:	e9 31 fe ff ff       	jmp    507d <dosyscall>
+
+0000524c <times>:
+SYSCALL(times)
+    524c:	b8 29 00 00 00       	mov    $0x29,%eax
+    5251:	e9 27 fe ff ff       	jmp    507d <dosyscall>
+
+00005256 <schedlat>:
+SYSCALL(schedlat)
+    5256:	b8 2a 00 00 00       	mov    $0x2a,%eax
+    525b:	e9 1d fe ff ff       	jmp    507d <dosyscall>
+
+00005260 <sched_setscheduler>:
+SYSCALL(sched_setscheduler)
+    5260:	b8 2b 00 00 00       	mov    $0x2b,%eax
+    5265:	e9 13 fe ff ff       	jmp    507d <dosyscall>
+
+0000526a <sched_getscheduler>:
+SYSCALL(sched_getscheduler)
+    526a:	b8 2c 00 00 00       	mov    $0x2c,%eax
+    526f:	e9 09 fe ff ff       	jmp    507d <dosyscall>
+
+00005274 <sched_getparam>:
+SYSCALL(sched_getparam)
+    5274:	b8 2d 00 00 00       	mov    $0x2d,%eax
+    5279:	e9 ff fd ff ff       	jmp    507d <dosyscall>
+
+0000527e <lockstat>:
+SYSCALL(lockstat)
+    527e:	b8 2e 00 00 00       	mov    $0x2e,%eax
+    5283:	e9 f5 fd ff ff       	jmp    507d <dosyscall>
+
+00005288 <ioring_setup>:
+SYSCALL(ioring_setup)
+    5288:	b8 2f 00 00 00       	mov    $0x2f,%eax
+    528d:	e9 eb fd ff ff       	jmp    507d <dosyscall>
+
+00005292 <ioring_enter>:
+SYSCALL(ioring_enter)
+    5292:	b8 30 00 00 00       	mov    $0x30,%eax
+    5297:	e9 e1 fd ff ff       	jmp    507d <dosyscall>
+
+0000529c <readv>:
+SYSCALL(readv)
+    529c:	b8 31 00 00 00       	mov    $0x31,%eax
+    52a1:	e9 d7 fd ff ff       	jmp    507d <dosyscall>
+
+000052a6 <writev>:
+SYSCALL(writev)
+    52a6:	b8 32 00 00 00       	mov    $0x32,%eax
+    52ab:	e9 cd fd ff ff       	jmp    507d <dosyscall>
+
+000052b0 <pread>:
+SYSCALL(pread)
+    52b0:	b8 33 00 00 00       	mov    $0x33,%eax
+    52b5:	e9 c3 fd ff ff       	jmp    507d <dosyscall>
+
+000052ba <pwrite>:
+SYSCALL(pwrite)
+    52ba:	b8 34 00 00 00       	mov    $0x34,%eax
+    52bf:	e9 b9 fd ff ff       	jmp    507d <dosyscall>
+
+000052c4 <sendfile>:
+SYSCALL(sendfile)
+    52c4:	b8 35 00 00 00       	mov    $0x35,%eax
+    52c9:	e9 af fd ff ff       	jmp    507d <dosyscall>
+
+000052ce <splice>:
+SYSCALL(splice)
+    52ce:	b8 36 00 00 00       	mov    $0x36,%eax
+    52d3:	e9 a5 fd ff ff       	jmp    507d <dosyscall>
+
+000052d8 <sysstat>:
+SYSCALL(sysstat)
+    52d8:	b8 37 00 00 00       	mov    $0x37,%eax
+    52dd:	e9 9b fd ff ff       	jmp    507d <dosyscall>
+
+000052e2 <strace>:
+SYSCALL(strace)
+    52e2:	b8 38 00 00 00       	mov    $0x38,%eax
+    52e7:	e9 91 fd ff ff       	jmp    507d <dosyscall>
+
+000052ec <straceread>:
+SYSCALL(straceread)
+    52ec:	b8 39 00 00 00       	mov    $0x39,%eax
+    52f1:	e9 87 fd ff ff       	jmp    507d <dosyscall>
+
+000052f6 <alarm>:
+
+# alarm and rstoregs keep to int $T_SYSCALL: rstoregs restores
+# %ecx and %edx, which sysexit would clobber.
+.globl alarm
+    alarm:
+        pushl $rstoregs
+    52f6:	68 06 53 00 00       	push   $0x5306
+        movl $SYS_alarm, %eax
+    52fb:	b8 18 00 00 00       	mov    $0x18,%eax
+        int $T_SYSCALL
+    5300:	cd 40                	int    $0x40
+        add $0x04, %esp
+    5302:	83 c4 04             	add    $0x4,%esp
+        ret
+    5305:	c3                   	ret
+
+00005306 <rstoregs>:
+
+.globl rstoregs
+    rstoregs:
+        movl $SYS_rstoregs, %eax
+    5306:	b8 19 00 00 00       	mov    $0x19,%eax
+        int $T_SYSCALL
+    530b:	cd 40                	int    $0x40
+
+0000530d <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+    530d:	55                   	push   %ebp
+    530e:	89 e5                	mov    %esp,%ebp
+    5310:	83 ec 18             	sub    $0x18,%esp
+    5313:	8b 45 0c             	mov    0xc(%ebp),%eax
+    5316:	88 45 f4             	mov    %al,-0xc(%ebp)
+    write(fd, &c, 1);
+    5319:	83 ec 04             	sub    $0x4,%esp
+    531c:	6a 01                	push   $0x1
+    531e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+    5321:	50                   	push   %eax
+    5322:	ff 75 08             	push   0x8(%ebp)
+    5325:	e8 d8 fd ff ff       	call   5102 <write>
+    532a:	83 c4 10             	add    $0x10,%esp
+}
+    532d:	90                   	nop
+    532e:	c9                   	leave
+    532f:	c3                   	ret
+
+00005330 <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+    5330:	55                   	push   %ebp
+    5331:	89 e5                	mov    %esp,%ebp
+    5333:	83 ec 28             	sub    $0x28,%esp
+    static char digits[] = "0123456789ABCDEF";
+    char buf[16];
+    int i, neg;
+    uint x;
+
+    neg = 0;
+    5336:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+    if(sgn && xx < 0){
+    533d:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+    5341:	74 17                	je     535a <printint+0x2a>
+    5343:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+    5347:	79 11                	jns    535a <printint+0x2a>
+        neg = 1;
+    5349:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+        x = -xx;
+    5350:	8b 45 0c             	mov    0xc(%ebp),%eax
+    5353:	f7 d8                	neg    %eax
+    5355:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    5358:	eb 06                	jmp    5360 <printint+0x30>
+    } else {
+        x = xx;
+    535a:	8b 45 0c             	mov    0xc(%ebp),%eax
+    535d:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    }
+
+    i = 0;
+    5360:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    do{
+        buf[i++] = digits[x % base];
+    5367:	8b 4d 10             	mov    0x10(%ebp),%ecx
+    536a:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    536d:	ba 00 00 00 00       	mov    $0x0,%edx
+    5372:	f7 f1                	div    %ecx
+    5374:	89 d1                	mov    %edx,%ecx
+    5376:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    5379:	8d 50 01             	lea    0x1(%eax),%edx
+    537c:	89 55 f4             	mov    %edx,-0xc(%ebp)
+    537f:	0f b6 91 78 81 00 00 	movzbl 0x8178(%ecx),%edx
+    5386:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+    }while((x /= base) != 0);
+    538a:	8b 4d 10             	mov    0x10(%ebp),%ecx
+    538d:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    5390:	ba 00 00 00 00       	mov    $0x0,%edx
+    5395:	f7 f1                	div    %ecx
+    5397:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    539a:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    539e:	75 c7                	jne    5367 <printint+0x37>
+    if(neg)
+    53a0:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    53a4:	74 2d                	je     53d3 <printint+0xa3>
+        buf[i++] = '-';
+    53a6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    53a9:	8d 50 01             	lea    0x1(%eax),%edx
+    53ac:	89 55 f4             	mov    %edx,-0xc(%ebp)
+    53af:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+    while(--i >= 0)
+    53b4:	eb 1d                	jmp    53d3 <printint+0xa3>
+        putc(fd, buf[i]);
+    53b6:	8d 55 dc             	lea    -0x24(%ebp),%edx
+    53b9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    53bc:	01 d0                	add    %edx,%eax
+    53be:	0f b6 00             	movzbl (%eax),%eax
+    53c1:	0f be c0             	movsbl %al,%eax
+    53c4:	83 ec 08             	sub    $0x8,%esp
+    53c7:	50                   	push   %eax
+    53c8:	ff 75 08             	push   0x8(%ebp)
+    53cb:	e8 3d ff ff ff       	call   530d <putc>
+    53d0:	83 c4 10             	add    $0x10,%esp
+    while(--i >= 0)
+    53d3:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+    53d7:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    53db:	79 d9                	jns    53b6 <printint+0x86>
+}
+    53dd:	90                   	nop
+    53de:	90                   	nop
+    53df:	c9                   	leave
+    53e0:	c3                   	ret
+
+000053e1 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+    53e1:	55                   	push   %ebp
+    53e2:	89 e5                	mov    %esp,%ebp
+    53e4:	83 ec 28             	sub    $0x28,%esp
+    char *s;
+    int c, i, state;
+    uint *ap;
+
+    state = 0;
+    53e7:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+    ap = (uint*)(void*)&fmt + 1;
+    53ee:	8d 45 0c             	lea    0xc(%ebp),%eax
+    53f1:	83 c0 04             	add    $0x4,%eax
+    53f4:	89 45 e8             	mov    %eax,-0x18(%ebp)
+    for(i = 0; fmt[i]; i++){
+    53f7:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+    53fe:	e9 59 01 00 00       	jmp    555c <printf+0x17b>
+        c = fmt[i] & 0xff;
+    5403:	8b 55 0c             	mov    0xc(%ebp),%edx
+    5406:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    5409:	01 d0                	add    %edx,%eax
+    540b:	0f b6 00             	movzbl (%eax),%eax
+    540e:	0f be c0             	movsbl %al,%eax
+    5411:	25 ff 00 00 00       	and    $0xff,%eax
+    5416:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        if(state == 0){
+    5419:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    541d:	75 2c                	jne    544b <printf+0x6a>
+            if(c == '%'){
+    541f:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+    5423:	75 0c                	jne    5431 <printf+0x50>
+                state = '%';
+    5425:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+    542c:	e9 27 01 00 00       	jmp    5558 <printf+0x177>
+            } else {
+                putc(fd, c);
+    5431:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    5434:	0f be c0             	movsbl %al,%eax
+    5437:	83 ec 08             	sub    $0x8,%esp
+    543a:	50                   	push   %eax
+    543b:	ff 75 08             	push   0x8(%ebp)
+    543e:	e8 ca fe ff ff       	call   530d <putc>
+    5443:	83 c4 10             	add    $0x10,%esp
+    5446:	e9 0d 01 00 00       	jmp    5558 <printf+0x177>
+            }
+        } else if(state == '%'){
+    544b:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+    544f:	0f 85 03 01 00 00    	jne    5558 <printf+0x177>
+            if(c == 'd'){
+    5455:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+    5459:	75 1e                	jne    5479 <printf+0x98>
+                printint(fd, *ap, 10, 1);
+    545b:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    545e:	8b 00                	mov    (%eax),%eax
+    5460:	6a 01                	push   $0x1
+    5462:	6a 0a                	push   $0xa
+    5464:	50                   	push   %eax
+    5465:	ff 75 08             	push   0x8(%ebp)
+    5468:	e8 c3 fe ff ff       	call   5330 <printint>
+    546d:	83 c4 10             	add    $0x10,%esp
+                ap++;
+    5470:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+    5474:	e9 d8 00 00 00       	jmp    5551 <printf+0x170>
+            } else if(c == 'x' || c == 'p'){
+    5479:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+    547d:	74 06                	je     5485 <printf+0xa4>
+    547f:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+    5483:	75 1e                	jne    54a3 <printf+0xc2>
+                printint(fd, *ap, 16, 0);
+    5485:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    5488:	8b 00                	mov    (%eax),%eax
+    548a:	6a 00                	push   $0x0
+    548c:	6a 10                	push   $0x10
+    548e:	50                   	push   %eax
+    548f:	ff 75 08             	push   0x8(%ebp)
+    5492:	e8 99 fe ff ff       	call   5330 <printint>
+    5497:	83 c4 10             	add    $0x10,%esp
+                ap++;
+    549a:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+    549e:	e9 ae 00 00 00       	jmp    5551 <printf+0x170>
+            } else if(c == 's'){
+    54a3:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+    54a7:	75 43                	jne    54ec <printf+0x10b>
+                s = (char*)*ap;
+    54a9:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    54ac:	8b 00                	mov    (%eax),%eax
+    54ae:	89 45 f4             	mov    %eax,-0xc(%ebp)
+                ap++;
+    54b1:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+                if(s == 0)
+    54b5:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    54b9:	75 25                	jne    54e0 <printf+0xff>
+                    s = "(null)";
+    54bb:	c7 45 f4 66 78 00 00 	movl   $0x7866,-0xc(%ebp)
+                while(*s != 0){
+    54c2:	eb 1c                	jmp    54e0 <printf+0xff>
+                    putc(fd, *s);
+    54c4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    54c7:	0f b6 00             	movzbl (%eax),%eax
+    54ca:	0f be c0             	movsbl %al,%eax
+    54cd:	83 ec 08             	sub    $0x8,%esp
+    54d0:	50                   	push   %eax
+    54d1:	ff 75 08             	push   0x8(%ebp)
+    54d4:	e8 34 fe ff ff       	call   530d <putc>
+    54d9:	83 c4 10             	add    $0x10,%esp
+                    s++;
+    54dc:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+                while(*s != 0){
+    54e0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    54e3:	0f b6 00             	movzbl (%eax),%eax
+    54e6:	84 c0                	test   %al,%al
+    54e8:	75 da                	jne    54c4 <printf+0xe3>
+    54ea:	eb 65                	jmp    5551 <printf+0x170>
+                }
+            } else if(c == 'c'){
+    54ec:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+    54f0:	75 1d                	jne    550f <printf+0x12e>
+                putc(fd, *ap);
+    54f2:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    54f5:	8b 00                	mov    (%eax),%eax
+    54f7:	0f be c0             	movsbl %al,%eax
+    54fa:	83 ec 08             	sub    $0x8,%esp
+    54fd:	50                   	push   %eax
+    54fe:	ff 75 08             	push   0x8(%ebp)
+    5501:	e8 07 fe ff ff       	call   530d <putc>
+    5506:	83 c4 10             	add    $0x10,%esp
+                ap++;
+    5509:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+    550d:	eb 42                	jmp    5551 <printf+0x170>
+            } else if(c == '%'){
+    550f:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+    5513:	75 17                	jne    552c <printf+0x14b>
+                putc(fd, c);
+    5515:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    5518:	0f be c0             	movsbl %al,%eax
+    551b:	83 ec 08             	sub    $0x8,%esp
+    551e:	50                   	push   %eax
+    551f:	ff 75 08             	push   0x8(%ebp)
+    5522:	e8 e6 fd ff ff       	call   530d <putc>
+    5527:	83 c4 10             	add    $0x10,%esp
+    552a:	eb 25                	jmp    5551 <printf+0x170>
+            } else {
+                // Unknown % sequence.    Print it to draw attention.
+                putc(fd, '%');
+    552c:	83 ec 08             	sub    $0x8,%esp
+    552f:	6a 25                	push   $0x25
+    5531:	ff 75 08             	push   0x8(%ebp)
+    5534:	e8 d4 fd ff ff       	call   530d <putc>
+    5539:	83 c4 10             	add    $0x10,%esp
+                putc(fd, c);
+    553c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    553f:	0f be c0             	movsbl %al,%eax
+    5542:	83 ec 08             	sub    $0x8,%esp
+    5545:	50                   	push   %eax
+    5546:	ff 75 08             	push   0x8(%ebp)
+    5549:	e8 bf fd ff ff       	call   530d <putc>
+    554e:	83 c4 10             	add    $0x10,%esp
+            }
+            state = 0;
+    5551:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+    for(i = 0; fmt[i]; i++){
+    5558:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+    555c:	8b 55 0c             	mov    0xc(%ebp),%edx
+    555f:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    5562:	01 d0                	add    %edx,%eax
+    5564:	0f b6 00             	movzbl (%eax),%eax
+    5567:	84 c0                	test   %al,%al
+    5569:	0f 85 94 fe ff ff    	jne    5403 <printf+0x22>
+        }
+    }
+}
+    556f:	90                   	nop
+    5570:	90                   	nop
+    5571:	c9                   	leave
+    5572:	c3                   	ret
+
+00005573 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+    5573:	55                   	push   %ebp
+    5574:	89 e5                	mov    %esp,%ebp
+    5576:	83 ec 10             	sub    $0x10,%esp
+    Header *bp, *p;
+
+    bp = (Header*)ap - 1;
+    5579:	8b 45 08             	mov    0x8(%ebp),%eax
+    557c:	83 e8 08             	sub    $0x8,%eax
+    557f:	89 45 f8             	mov    %eax,-0x8(%ebp)
+    for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    5582:	a1 e8 f7 00 00       	mov    0xf7e8,%eax
+    5587:	89 45 fc             	mov    %eax,-0x4(%ebp)
+    558a:	eb 24                	jmp    55b0 <free+0x3d>
+        if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    558c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    558f:	8b 00                	mov    (%eax),%eax
+    5591:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+    5594:	72 12                	jb     55a8 <free+0x35>
+    5596:	8b 45 f8             	mov    -0x8(%ebp),%eax
+    5599:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+    559c:	72 24                	jb     55c2 <free+0x4f>
+    559e:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    55a1:	8b 00                	mov    (%eax),%eax
+    55a3:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+    55a6:	72 1a                	jb     55c2 <free+0x4f>
+    for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    55a8:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    55ab:	8b 00                	mov    (%eax),%eax
+    55ad:	89 45 fc             	mov    %eax,-0x4(%ebp)
+    55b0:	8b 45 f8             	mov    -0x8(%ebp),%eax
+    55b3:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+    55b6:	73 d4                	jae    558c <free+0x19>
+    55b8:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    55bb:	8b 00                	mov    (%eax),%eax
+    55bd:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+    55c0:	73 ca                	jae    558c <free+0x19>
+            break;
+    if(bp + bp->s.size == p->s.ptr){
+    55c2:	8b 45 f8             	mov    -0x8(%ebp),%eax
+    55c5:	8b 40 04             	mov    0x4(%eax),%eax
+    55c8:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+    55cf:	8b 45 f8             	mov    -0x8(%ebp),%eax
+    55d2:	01 c2                	add    %eax,%edx
+    55d4:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    55d7:	8b 00                	mov    (%eax),%eax
+    55d9:	39 c2                	cmp    %eax,%edx
+    55db:	75 24                	jne    5601 <free+0x8e>
+        bp->s.size += p->s.ptr->s.size;
+    55dd:	8b 45 f8             	mov    -0x8(%ebp),%eax
+    55e0:	8b 50 04             	mov    0x4(%eax),%edx
+    55e3:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    55e6:	8b 00                	mov    (%eax),%eax
+    55e8:	8b 40 04             	mov    0x4(%eax),%eax
+    55eb:	01 c2                	add    %eax,%edx
+    55ed:	8b 45 f8             	mov    -0x8(%ebp),%eax
+    55f0:	89 50 04             	mov    %edx,0x4(%eax)
+        bp->s.ptr = p->s.ptr->s.ptr;
+    55f3:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    55f6:	8b 00                	mov    (%eax),%eax
+    55f8:	8b 10                	mov    (%eax),%edx
+    55fa:	8b 45 f8             	mov    -0x8(%ebp),%eax
+    55fd:	89 10                	mov    %edx,(%eax)
+    55ff:	eb 0a                	jmp    560b <free+0x98>
+    } else
+        bp->s.ptr = p->s.ptr;
+    5601:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    5604:	8b 10                	mov    (%eax),%edx
+    5606:	8b 45 f8             	mov    -0x8(%ebp),%eax
+    5609:	89 10                	mov    %edx,(%eax)
+    if(p + p->s.size == bp){
+    560b:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    560e:	8b 40 04             	mov    0x4(%eax),%eax
+    5611:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+    5618:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    561b:	01 d0                	add    %edx,%eax
+    561d:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+    5620:	75 20                	jne    5642 <free+0xcf>
+        p->s.size += bp->s.size;
+    5622:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    5625:	8b 50 04             	mov    0x4(%eax),%edx
+    5628:	8b 45 f8             	mov    -0x8(%ebp),%eax
+    562b:	8b 40 04             	mov    0x4(%eax),%eax
+    562e:	01 c2                	add    %eax,%edx
+    5630:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    5633:	89 50 04             	mov    %edx,0x4(%eax)
+        p->s.ptr = bp->s.ptr;
+    5636:	8b 45 f8             	mov    -0x8(%ebp),%eax
+    5639:	8b 10                	mov    (%eax),%edx
+    563b:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    563e:	89 10                	mov    %edx,(%eax)
+    5640:	eb 08                	jmp    564a <free+0xd7>
+    } else
+        p->s.ptr = bp;
+    5642:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    5645:	8b 55 f8             	mov    -0x8(%ebp),%edx
+    5648:	89 10                	mov    %edx,(%eax)
+    freep = p;
+    564a:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    564d:	a3 e8 f7 00 00       	mov    %eax,0xf7e8
+}
+    5652:	90                   	nop
+    5653:	c9                   	leave
+    5654:	c3                   	ret
+
+00005655 <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+    5655:	55                   	push   %ebp
+    5656:	89 e5                	mov    %esp,%ebp
+    5658:	83 ec 18             	sub    $0x18,%esp
+    char *p;
+    Header *hp;
+
+    if(nu < 4096)
+    565b:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+    5662:	77 07                	ja     566b <morecore+0x16>
+        nu = 4096;
+    5664:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+    p = sbrk(nu * sizeof(Header));
+    566b:	8b 45 08             	mov    0x8(%ebp),%eax
+    566e:	c1 e0 03             	shl    $0x3,%eax
+    5671:	83 ec 0c             	sub    $0xc,%esp
+    5674:	50                   	push   %eax
+    5675:	e8 0a fb ff ff       	call   5184 <sbrk>
+    567a:	83 c4 10             	add    $0x10,%esp
+    567d:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p == (char*)-1)
+    5680:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+    5684:	75 07                	jne    568d <morecore+0x38>
+        return 0;
+    5686:	b8 00 00 00 00       	mov    $0x0,%eax
+    568b:	eb 26                	jmp    56b3 <morecore+0x5e>
+    hp = (Header*)p;
+    568d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    5690:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    hp->s.size = nu;
+    5693:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    5696:	8b 55 08             	mov    0x8(%ebp),%edx
+    5699:	89 50 04             	mov    %edx,0x4(%eax)
+    free((void*)(hp + 1));
+    569c:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    569f:	83 c0 08             	add    $0x8,%eax
+    56a2:	83 ec 0c             	sub    $0xc,%esp
+    56a5:	50                   	push   %eax
+    56a6:	e8 c8 fe ff ff       	call   5573 <free>
+    56ab:	83 c4 10             	add    $0x10,%esp
+    return freep;
+    56ae:	a1 e8 f7 00 00       	mov    0xf7e8,%eax
+}
+    56b3:	c9                   	leave
+    56b4:	c3                   	ret
+
+000056b5 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+    56b5:	55                   	push   %ebp
+    56b6:	89 e5                	mov    %esp,%ebp
+    56b8:	83 ec 18             	sub    $0x18,%esp
+    Header *p, *prevp;
+    uint nunits;
+
+    nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    56bb:	8b 45 08             	mov    0x8(%ebp),%eax
+    56be:	83 c0 07             	add    $0x7,%eax
+    56c1:	c1 e8 03             	shr    $0x3,%eax
+    56c4:	83 c0 01             	add    $0x1,%eax
+    56c7:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    if((prevp = freep) == 0){
+    56ca:	a1 e8 f7 00 00       	mov    0xf7e8,%eax
+    56cf:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    56d2:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    56d6:	75 23                	jne    56fb <malloc+0x46>
+        base.s.ptr = freep = prevp = &base;
+    56d8:	c7 45 f0 e0 f7 00 00 	movl   $0xf7e0,-0x10(%ebp)
+    56df:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    56e2:	a3 e8 f7 00 00       	mov    %eax,0xf7e8
+    56e7:	a1 e8 f7 00 00       	mov    0xf7e8,%eax
+    56ec:	a3 e0 f7 00 00       	mov    %eax,0xf7e0
+        base.s.size = 0;
+    56f1:	c7 05 e4 f7 00 00 00 	movl   $0x0,0xf7e4
+    56f8:	00 00 00 
+    }
+    for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    56fb:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    56fe:	8b 00                	mov    (%eax),%eax
+    5700:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        if(p->s.size >= nunits){
+    5703:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    5706:	8b 40 04             	mov    0x4(%eax),%eax
+    5709:	3b 45 ec             	cmp    -0x14(%ebp),%eax
+    570c:	72 4d                	jb     575b <malloc+0xa6>
+            if(p->s.size == nunits)
+    570e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    5711:	8b 40 04             	mov    0x4(%eax),%eax
+    5714:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+    5717:	75 0c                	jne    5725 <malloc+0x70>
+                prevp->s.ptr = p->s.ptr;
+    5719:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    571c:	8b 10                	mov    (%eax),%edx
+    571e:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    5721:	89 10                	mov    %edx,(%eax)
+    5723:	eb 26                	jmp    574b <malloc+0x96>
+            else {
+                p->s.size -= nunits;
+    5725:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    5728:	8b 40 04             	mov    0x4(%eax),%eax
+    572b:	2b 45 ec             	sub    -0x14(%ebp),%eax
+    572e:	89 c2                	mov    %eax,%edx
+    5730:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    5733:	89 50 04             	mov    %edx,0x4(%eax)
+                p += p->s.size;
+    5736:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    5739:	8b 40 04             	mov    0x4(%eax),%eax
+    573c:	c1 e0 03             	shl    $0x3,%eax
+    573f:	01 45 f4             	add    %eax,-0xc(%ebp)
+                p->s.size = nunits;
+    5742:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    5745:	8b 55 ec             	mov    -0x14(%ebp),%edx
+    5748:	89 50 04             	mov    %edx,0x4(%eax)
+            }
+            freep = prevp;
+    574b:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    574e:	a3 e8 f7 00 00       	mov    %eax,0xf7e8
+            return (void*)(p + 1);
+    5753:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    5756:	83 c0 08             	add    $0x8,%eax
+    5759:	eb 3b                	jmp    5796 <malloc+0xe1>
+        }
+        if(p == freep)
+    575b:	a1 e8 f7 00 00       	mov    0xf7e8,%eax
+    5760:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+    5763:	75 1e                	jne    5783 <malloc+0xce>
+            if((p = morecore(nunits)) == 0)
+    5765:	83 ec 0c             	sub    $0xc,%esp
+    5768:	ff 75 ec             	push   -0x14(%ebp)
+    576b:	e8 e5 fe ff ff       	call   5655 <morecore>
+    5770:	83 c4 10             	add    $0x10,%esp
+    5773:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    5776:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    577a:	75 07                	jne    5783 <malloc+0xce>
+                return 0;
+    577c:	b8 00 00 00 00       	mov    $0x0,%eax
+    5781:	eb 13                	jmp    5796 <malloc+0xe1>
+    for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    5783:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    5786:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    5789:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    578c:	8b 00                	mov    (%eax),%eax
+    578e:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        if(p->s.size >= nunits){
+    5791:	e9 6d ff ff ff       	jmp    5703 <malloc+0x4e>
+    }
+}
+    5796:	c9                   	leave
+    5797:	c3                   	ret
+
+00005798 <rdtsc>:
+    5798:	55                   	push   %ebp
+    5799:	89 e5                	mov    %esp,%ebp
+    579b:	83 ec 10             	sub    $0x10,%esp
+    579e:	0f 31                	rdtsc
+    57a0:	89 45 f8             	mov    %eax,-0x8(%ebp)
+    57a3:	89 55 fc             	mov    %edx,-0x4(%ebp)
+    57a6:	8b 45 f8             	mov    -0x8(%ebp),%eax
+    57a9:	8b 55 fc             	mov    -0x4(%ebp),%edx
+    57ac:	c9                   	leave
+    57ad:	c3                   	ret
+
+000057ae <divu64>:
+    57ae:	55                   	push   %ebp
+    57af:	89 e5                	mov    %esp,%ebp
+    57b1:	53                   	push   %ebx
+    57b2:	83 ec 1c             	sub    $0x1c,%esp
+    57b5:	8b 45 08             	mov    0x8(%ebp),%eax
+    57b8:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    57bb:	8b 45 0c             	mov    0xc(%ebp),%eax
+    57be:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    57c1:	8b 45 e0             	mov    -0x20(%ebp),%eax
+    57c4:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+    57c7:	89 d0                	mov    %edx,%eax
+    57c9:	31 d2                	xor    %edx,%edx
+    57cb:	ba 00 00 00 00       	mov    $0x0,%edx
+    57d0:	f7 75 10             	divl   0x10(%ebp)
+    57d3:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    57d6:	8b 45 e0             	mov    -0x20(%ebp),%eax
+    57d9:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+    57dc:	89 d0                	mov    %edx,%eax
+    57de:	31 d2                	xor    %edx,%edx
+    57e0:	ba 00 00 00 00       	mov    $0x0,%edx
+    57e5:	f7 75 10             	divl   0x10(%ebp)
+    57e8:	89 55 f0             	mov    %edx,-0x10(%ebp)
+    57eb:	8b 45 e0             	mov    -0x20(%ebp),%eax
+    57ee:	8b 55 f0             	mov    -0x10(%ebp),%edx
+    57f1:	f7 75 10             	divl   0x10(%ebp)
+    57f4:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    57f7:	89 55 f0             	mov    %edx,-0x10(%ebp)
+    57fa:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    57fd:	ba 00 00 00 00       	mov    $0x0,%edx
+    5802:	89 c2                	mov    %eax,%edx
+    5804:	b8 00 00 00 00       	mov    $0x0,%eax
+    5809:	8b 4d ec             	mov    -0x14(%ebp),%ecx
+    580c:	bb 00 00 00 00       	mov    $0x0,%ebx
+    5811:	09 c8                	or     %ecx,%eax
+    5813:	09 da                	or     %ebx,%edx
+    5815:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    5818:	c9                   	leave
+    5819:	c3                   	ret
+
+0000581a <vgetpid>:
+{
+    581a:	55                   	push   %ebp
+    581b:	89 e5                	mov    %esp,%ebp
+    return vdsoproc->pid;
+    581d:	b8 00 f0 ff 7f       	mov    $0x7ffff000,%eax
+    5822:	8b 00                	mov    (%eax),%eax
+}
+    5824:	5d                   	pop    %ebp
+    5825:	c3                   	ret
+
+00005826 <vuptime>:
+{
+    5826:	55                   	push   %ebp
+    5827:	89 e5                	mov    %esp,%ebp
+    return vdso->ticks;
+    5829:	b8 00 e0 ff 7f       	mov    $0x7fffe000,%eax
+    582e:	8b 00                	mov    (%eax),%eax
+}
+    5830:	5d                   	pop    %ebp
+    5831:	c3                   	ret
+
+00005832 <vclock_gettime>:
+{
+    5832:	55                   	push   %ebp
+    5833:	89 e5                	mov    %esp,%ebp
+    5835:	56                   	push   %esi
+    5836:	53                   	push   %ebx
+    5837:	83 ec 20             	sub    $0x20,%esp
+    if(clk != CLOCK_MONOTONIC && clk != CLOCK_REALTIME)
+    583a:	83 7d 08 01          	cmpl   $0x1,0x8(%ebp)
+    583e:	74 10                	je     5850 <vclock_gettime+0x1e>
+    5840:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+    5844:	74 0a                	je     5850 <vclock_gettime+0x1e>
+        return -1;
+    5846:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    584b:	e9 16 01 00 00       	jmp    5966 <vclock_gettime+0x134>
+    cycles = rdtsc() - vdso->boottsc;
+    5850:	e8 43 ff ff ff       	call   5798 <rdtsc>
+    5855:	b9 00 e0 ff 7f       	mov    $0x7fffe000,%ecx
+    585a:	8b 59 0c             	mov    0xc(%ecx),%ebx
+    585d:	8b 49 08             	mov    0x8(%ecx),%ecx
+    5860:	29 c8                	sub    %ecx,%eax
+    5862:	19 da                	sbb    %ebx,%edx
+    5864:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    5867:	89 55 f4             	mov    %edx,-0xc(%ebp)
+    ms = divu64(cycles, vdso->tsckhz);
+    586a:	b8 00 e0 ff 7f       	mov    $0x7fffe000,%eax
+    586f:	8b 40 04             	mov    0x4(%eax),%eax
+    5872:	83 ec 04             	sub    $0x4,%esp
+    5875:	50                   	push   %eax
+    5876:	ff 75 f4             	push   -0xc(%ebp)
+    5879:	ff 75 f0             	push   -0x10(%ebp)
+    587c:	e8 2d ff ff ff       	call   57ae <divu64>
+    5881:	83 c4 10             	add    $0x10,%esp
+    5884:	89 45 e8             	mov    %eax,-0x18(%ebp)
+    5887:	89 55 ec             	mov    %edx,-0x14(%ebp)
+    cycles -= ms * vdso->tsckhz;
+    588a:	b8 00 e0 ff 7f       	mov    $0x7fffe000,%eax
+    588f:	8b 40 04             	mov    0x4(%eax),%eax
+    5892:	ba 00 00 00 00       	mov    $0x0,%edx
+    5897:	8b 4d e8             	mov    -0x18(%ebp),%ecx
+    589a:	89 cb                	mov    %ecx,%ebx
+    589c:	0f af da             	imul   %edx,%ebx
+    589f:	8b 4d ec             	mov    -0x14(%ebp),%ecx
+    58a2:	0f af c8             	imul   %eax,%ecx
+    58a5:	01 d9                	add    %ebx,%ecx
+    58a7:	f7 65 e8             	mull   -0x18(%ebp)
+    58aa:	01 d1                	add    %edx,%ecx
+    58ac:	89 ca                	mov    %ecx,%edx
+    58ae:	29 45 f0             	sub    %eax,-0x10(%ebp)
+    58b1:	19 55 f4             	sbb    %edx,-0xc(%ebp)
+    sec = divu64(ms, 1000);
+    58b4:	83 ec 04             	sub    $0x4,%esp
+    58b7:	68 e8 03 00 00       	push   $0x3e8
+    58bc:	ff 75 ec             	push   -0x14(%ebp)
+    58bf:	ff 75 e8             	push   -0x18(%ebp)
+    58c2:	e8 e7 fe ff ff       	call   57ae <divu64>
+    58c7:	83 c4 10             	add    $0x10,%esp
+    58ca:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    ts->tv_sec = sec;
+    58cd:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+    58d0:	8b 45 0c             	mov    0xc(%ebp),%eax
+    58d3:	89 10                	mov    %edx,(%eax)
+    ts->tv_nsec = (ms - (uint64)sec * 1000) * 1000000 +
+    58d5:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    58d8:	ba 00 00 00 00       	mov    $0x0,%edx
+    58dd:	69 da e8 03 00 00    	imul   $0x3e8,%edx,%ebx
+    58e3:	6b c8 00             	imul   $0x0,%eax,%ecx
+    58e6:	01 d9                	add    %ebx,%ecx
+    58e8:	bb e8 03 00 00       	mov    $0x3e8,%ebx
+    58ed:	f7 e3                	mul    %ebx
+    58ef:	01 d1                	add    %edx,%ecx
+    58f1:	89 ca                	mov    %ecx,%edx
+    58f3:	8b 4d e8             	mov    -0x18(%ebp),%ecx
+    58f6:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+    58f9:	29 c1                	sub    %eax,%ecx
+    58fb:	19 d3                	sbb    %edx,%ebx
+    58fd:	89 c8                	mov    %ecx,%eax
+    58ff:	69 d8 40 42 0f 00    	imul   $0xf4240,%eax,%ebx
+        (uint)divu64(cycles * 1000000, vdso->tsckhz);
+    5905:	b8 00 e0 ff 7f       	mov    $0x7fffe000,%eax
+    590a:	8b 48 04             	mov    0x4(%eax),%ecx
+    590d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    5910:	69 d0 40 42 0f 00    	imul   $0xf4240,%eax,%edx
+    5916:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    5919:	6b c0 00             	imul   $0x0,%eax,%eax
+    591c:	8d 34 02             	lea    (%edx,%eax,1),%esi
+    591f:	b8 40 42 0f 00       	mov    $0xf4240,%eax
+    5924:	f7 65 f0             	mull   -0x10(%ebp)
+    5927:	01 d6                	add    %edx,%esi
+    5929:	89 f2                	mov    %esi,%edx
+    592b:	83 ec 04             	sub    $0x4,%esp
+    592e:	51                   	push   %ecx
+    592f:	52                   	push   %edx
+    5930:	50                   	push   %eax
+    5931:	e8 78 fe ff ff       	call   57ae <divu64>
+    5936:	83 c4 10             	add    $0x10,%esp
+    ts->tv_nsec = (ms - (uint64)sec * 1000) * 1000000 +
+    5939:	01 d8                	add    %ebx,%eax
+    593b:	89 c2                	mov    %eax,%edx
+    593d:	8b 45 0c             	mov    0xc(%ebp),%eax
+    5940:	89 50 04             	mov    %edx,0x4(%eax)
+    if(clk == CLOCK_REALTIME)
+    5943:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+    5947:	75 18                	jne    5961 <vclock_gettime+0x12f>
+        ts->tv_sec += vdso->bootsec;
+    5949:	8b 45 0c             	mov    0xc(%ebp),%eax
+    594c:	8b 00                	mov    (%eax),%eax
+    594e:	89 c2                	mov    %eax,%edx
+    5950:	b8 00 e0 ff 7f       	mov    $0x7fffe000,%eax
+    5955:	8b 40 10             	mov    0x10(%eax),%eax
+    5958:	01 d0                	add    %edx,%eax
+    595a:	89 c2                	mov    %eax,%edx
+    595c:	8b 45 0c             	mov    0xc(%ebp),%eax
+    595f:	89 10                	mov    %edx,(%eax)
+    return 0;
+    5961:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    5966:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    5969:	5b                   	pop    %ebx
+    596a:	5e                   	pop    %esi
+    596b:	5d                   	pop    %ebp
+    596c:	c3                   	ret
+
+0000596d <vdate>:
+{
+    596d:	55                   	push   %ebp
+    596e:	89 e5                	mov    %esp,%ebp
+    5970:	83 ec 30             	sub    $0x30,%esp
+    vclock_gettime(CLOCK_REALTIME, &ts);
+    5973:	8d 45 dc             	lea    -0x24(%ebp),%eax
+    5976:	50                   	push   %eax
+    5977:	6a 00                	push   $0x0
+    5979:	e8 b4 fe ff ff       	call   5832 <vclock_gettime>
+    597e:	83 c4 08             	add    $0x8,%esp
+    s = ts.tv_sec;
+    5981:	8b 45 dc             	mov    -0x24(%ebp),%eax
+    5984:	89 45 fc             	mov    %eax,-0x4(%ebp)
+    days = s / 86400;
+    5987:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    598a:	ba 07 45 2e c2       	mov    $0xc22e4507,%edx
+    598f:	f7 e2                	mul    %edx
+    5991:	89 d0                	mov    %edx,%eax
+    5993:	c1 e8 10             	shr    $0x10,%eax
+    5996:	89 45 f8             	mov    %eax,-0x8(%ebp)
+    s %= 86400;
+    5999:	8b 4d fc             	mov    -0x4(%ebp),%ecx
+    599c:	ba 07 45 2e c2       	mov    $0xc22e4507,%edx
+    59a1:	89 c8                	mov    %ecx,%eax
+    59a3:	f7 e2                	mul    %edx
+    59a5:	89 d0                	mov    %edx,%eax
+    59a7:	c1 e8 10             	shr    $0x10,%eax
+    59aa:	69 c0 80 51 01 00    	imul   $0x15180,%eax,%eax
+    59b0:	29 c1                	sub    %eax,%ecx
+    59b2:	89 ca                	mov    %ecx,%edx
+    59b4:	89 55 fc             	mov    %edx,-0x4(%ebp)
+    r->hour = s / 3600;
+    59b7:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    59ba:	ba c5 b3 a2 91       	mov    $0x91a2b3c5,%edx
+    59bf:	f7 e2                	mul    %edx
+    59c1:	c1 ea 0b             	shr    $0xb,%edx
+    59c4:	8b 45 08             	mov    0x8(%ebp),%eax
+    59c7:	89 50 08             	mov    %edx,0x8(%eax)
+    r->minute = s / 60 % 60;
+    59ca:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    59cd:	ba 89 88 88 88       	mov    $0x88888889,%edx
+    59d2:	f7 e2                	mul    %edx
+    59d4:	89 d1                	mov    %edx,%ecx
+    59d6:	c1 e9 05             	shr    $0x5,%ecx
+    59d9:	ba 89 88 88 88       	mov    $0x88888889,%edx
+    59de:	89 c8                	mov    %ecx,%eax
+    59e0:	f7 e2                	mul    %edx
+    59e2:	89 d0                	mov    %edx,%eax
+    59e4:	c1 e8 05             	shr    $0x5,%eax
+    59e7:	6b d0 3c             	imul   $0x3c,%eax,%edx
+    59ea:	89 c8                	mov    %ecx,%eax
+    59ec:	29 d0                	sub    %edx,%eax
+    59ee:	8b 55 08             	mov    0x8(%ebp),%edx
+    59f1:	89 42 04             	mov    %eax,0x4(%edx)
+    r->second = s % 60;
+    59f4:	8b 4d fc             	mov    -0x4(%ebp),%ecx
+    59f7:	ba 89 88 88 88       	mov    $0x88888889,%edx
+    59fc:	89 c8                	mov    %ecx,%eax
+    59fe:	f7 e2                	mul    %edx
+    5a00:	89 d0                	mov    %edx,%eax
+    5a02:	c1 e8 05             	shr    $0x5,%eax
+    5a05:	6b d0 3c             	imul   $0x3c,%eax,%edx
+    5a08:	89 c8                	mov    %ecx,%eax
+    5a0a:	29 d0                	sub    %edx,%eax
+    5a0c:	8b 55 08             	mov    0x8(%ebp),%edx
+    5a0f:	89 02                	mov    %eax,(%edx)
+    days += 719468;
+    5a11:	81 45 f8 6c fa 0a 00 	addl   $0xafa6c,-0x8(%ebp)
+    era = days / 146097;
+    5a18:	8b 45 f8             	mov    -0x8(%ebp),%eax
+    5a1b:	ba bd 06 6b 39       	mov    $0x396b06bd,%edx
+    5a20:	f7 e2                	mul    %edx
+    5a22:	89 d0                	mov    %edx,%eax
+    5a24:	c1 e8 0f             	shr    $0xf,%eax
+    5a27:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    doe = days - era * 146097;
+    5a2a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    5a2d:	69 c0 b1 3a 02 00    	imul   $0x23ab1,%eax,%eax
+    5a33:	8b 55 f8             	mov    -0x8(%ebp),%edx
+    5a36:	29 c2                	sub    %eax,%edx
+    5a38:	89 55 f0             	mov    %edx,-0x10(%ebp)
+    yoe = (doe - doe/1460 + doe/36524 - doe/146096) / 365;
+    5a3b:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    5a3e:	c1 e8 02             	shr    $0x2,%eax
+    5a41:	ba d9 7c c6 59       	mov    $0x59c67cd9,%edx
+    5a46:	f7 e2                	mul    %edx
+    5a48:	89 d0                	mov    %edx,%eax
+    5a4a:	c1 e8 07             	shr    $0x7,%eax
+    5a4d:	8b 55 f0             	mov    -0x10(%ebp),%edx
+    5a50:	89 d1                	mov    %edx,%ecx
+    5a52:	29 c1                	sub    %eax,%ecx
+    5a54:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    5a57:	c1 e8 02             	shr    $0x2,%eax
+    5a5a:	ba 7f 20 6b 39       	mov    $0x396b207f,%edx
+    5a5f:	f7 e2                	mul    %edx
+    5a61:	89 d0                	mov    %edx,%eax
+    5a63:	c1 e8 0b             	shr    $0xb,%eax
+    5a66:	01 c1                	add    %eax,%ecx
+    5a68:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    5a6b:	c1 e8 04             	shr    $0x4,%eax
+    5a6e:	ba 41 d6 72 00       	mov    $0x72d641,%edx
+    5a73:	f7 e2                	mul    %edx
+    5a75:	89 d0                	mov    %edx,%eax
+    5a77:	c1 e8 04             	shr    $0x4,%eax
+    5a7a:	29 c1                	sub    %eax,%ecx
+    5a7c:	ba 61 f3 19 67       	mov    $0x6719f361,%edx
+    5a81:	89 c8                	mov    %ecx,%eax
+    5a83:	f7 e2                	mul    %edx
+    5a85:	89 c8                	mov    %ecx,%eax
+    5a87:	29 d0                	sub    %edx,%eax
+    5a89:	d1 e8                	shr    %eax
+    5a8b:	01 d0                	add    %edx,%eax
+    5a8d:	c1 e8 08             	shr    $0x8,%eax
+    5a90:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    doy = doe - (365*yoe + yoe/4 - yoe/100);
+    5a93:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    5a96:	ba 1f 85 eb 51       	mov    $0x51eb851f,%edx
+    5a9b:	f7 e2                	mul    %edx
+    5a9d:	89 d1                	mov    %edx,%ecx
+    5a9f:	c1 e9 05             	shr    $0x5,%ecx
+    5aa2:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    5aa5:	69 c0 6d 01 00 00    	imul   $0x16d,%eax,%eax
+    5aab:	8b 55 ec             	mov    -0x14(%ebp),%edx
+    5aae:	c1 ea 02             	shr    $0x2,%edx
+    5ab1:	01 d0                	add    %edx,%eax
+    5ab3:	29 c1                	sub    %eax,%ecx
+    5ab5:	89 ca                	mov    %ecx,%edx
+    5ab7:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    5aba:	01 d0                	add    %edx,%eax
+    5abc:	89 45 e8             	mov    %eax,-0x18(%ebp)
+    mp = (5*doy + 2) / 153;
+    5abf:	8b 55 e8             	mov    -0x18(%ebp),%edx
+    5ac2:	89 d0                	mov    %edx,%eax
+    5ac4:	c1 e0 02             	shl    $0x2,%eax
+    5ac7:	01 d0                	add    %edx,%eax
+    5ac9:	83 c0 02             	add    $0x2,%eax
+    5acc:	ba d7 80 2b d6       	mov    $0xd62b80d7,%edx
+    5ad1:	f7 e2                	mul    %edx
+    5ad3:	89 d0                	mov    %edx,%eax
+    5ad5:	c1 e8 07             	shr    $0x7,%eax
+    5ad8:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    r->day = doy - (153*mp + 2)/5 + 1;
+    5adb:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    5ade:	69 c0 99 00 00 00    	imul   $0x99,%eax,%eax
+    5ae4:	83 c0 02             	add    $0x2,%eax
+    5ae7:	ba cd cc cc cc       	mov    $0xcccccccd,%edx
+    5aec:	f7 e2                	mul    %edx
+    5aee:	89 d0                	mov    %edx,%eax
+    5af0:	c1 e8 02             	shr    $0x2,%eax
+    5af3:	8b 55 e8             	mov    -0x18(%ebp),%edx
+    5af6:	29 c2                	sub    %eax,%edx
+    5af8:	83 c2 01             	add    $0x1,%edx
+    5afb:	8b 45 08             	mov    0x8(%ebp),%eax
+    5afe:	89 50 0c             	mov    %edx,0xc(%eax)
+    r->month = mp < 10 ? mp + 3 : mp - 9;
+    5b01:	83 7d e4 09          	cmpl   $0x9,-0x1c(%ebp)
+    5b05:	77 08                	ja     5b0f <vdate+0x1a2>
+    5b07:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    5b0a:	83 c0 03             	add    $0x3,%eax
+    5b0d:	eb 06                	jmp    5b15 <vdate+0x1a8>
+    5b0f:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    5b12:	83 e8 09             	sub    $0x9,%eax
+    5b15:	8b 55 08             	mov    0x8(%ebp),%edx
+    5b18:	89 42 10             	mov    %eax,0x10(%edx)
+    r->year = yoe + era * 400 + (r->month <= 2);
+    5b1b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    5b1e:	69 d0 90 01 00 00    	imul   $0x190,%eax,%edx
+    5b24:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    5b27:	01 c2                	add    %eax,%edx
+    5b29:	8b 45 08             	mov    0x8(%ebp),%eax
+    5b2c:	8b 40 10             	mov    0x10(%eax),%eax
+    5b2f:	83 f8 02             	cmp    $0x2,%eax
+    5b32:	0f 96 c0             	setbe  %al
+    5b35:	0f b6 c0             	movzbl %al,%eax
+    5b38:	01 c2                	add    %eax,%edx
+    5b3a:	8b 45 08             	mov    0x8(%ebp),%eax
+    5b3d:	89 50 14             	mov    %edx,0x14(%eax)
+    return 0;
+    5b40:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    5b45:	c9                   	leave
+    5b46:	c3                   	ret
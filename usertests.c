@@ -7,6 +7,10 @@
 #include "syscall.h"
 #include "traps.h"
 #include "memlayout.h"
+#include "date.h"
+#include "uio.h"
+#include "sysstat.h"
+#include "sched.h"
 
 char buf[8192];
 char name[3];
@@ -424,6 +428,342 @@ exitwait(void)
     printf(1, "exitwait ok\n");
 }
 
+// nanosleep must sleep at least as long as asked, even for
+// less than a tick, and clock_gettime must see the time pass.
+void
+nanosleeptest(void)
+{
+    struct timespec req, t0, t1;
+    int i, us;
+
+    printf(stdout, "nanosleep test\n");
+    req.tv_sec = 0;
+    req.tv_nsec = 500000;
+    for(i = 0; i < 10; i++){
+        if(clock_gettime(CLOCK_MONOTONIC, &t0) < 0){
+            printf(stdout, "clock_gettime failed\n");
+            exit();
+        }
+        if(nanosleep(&req, 0) < 0){
+            printf(stdout, "nanosleep failed\n");
+            exit();
+        }
+        clock_gettime(CLOCK_MONOTONIC, &t1);
+        us = (t1.tv_sec - t0.tv_sec) * 1000000 + (t1.tv_nsec - t0.tv_nsec) / 1000;
+        if(us < 500){
+            printf(stdout, "nanosleep woke after %d us\n", us);
+            exit();
+        }
+    }
+    req.tv_nsec = 1000000000;
+    if(nanosleep(&req, 0) >= 0){
+        printf(stdout, "nanosleep accepted tv_nsec of 1s\n");
+        exit();
+    }
+    printf(stdout, "nanosleep ok\n");
+}
+
+// A real-time process spinning on a cpu must not shut out the
+// normal processes there: once it has had most of a window the cpu
+// is throttled, so the parent, pinned to the same cpu, still runs.
+void
+rttest(void)
+{
+    int pid;
+
+    printf(stdout, "rt test\n");
+    if(sched_setscheduler(0, SCHED_FIFO, 0) >= 0 ||
+       sched_setscheduler(0, SCHED_FIFO, SCHED_PRIOMAX+1) >= 0){
+        printf(stdout, "sched_setscheduler accepted a bad priority\n");
+        exit();
+    }
+    sched_setaffinity(0, 1);
+    pid = fork();
+    if(pid < 0){
+        printf(stdout, "fork failed\n");
+        exit();
+    }
+    if(pid == 0){
+        if(sched_setscheduler(0, SCHED_FIFO, 1) < 0 ||
+           sched_getscheduler(0) != SCHED_FIFO || sched_getparam(0) != 1){
+            printf(stdout, "sched_setscheduler failed\n");
+            exit();
+        }
+        for(;;)
+            ;
+    }
+    sleep(10);
+    kill(pid);
+    wait();
+    sched_setaffinity(0, ~0);
+    if(sched_getscheduler(0) != SCHED_OTHER){
+        printf(stdout, "parent became real-time\n");
+        exit();
+    }
+    printf(stdout, "rt ok\n");
+}
+
+// writev gathers buffers into one write and readv scatters them
+// back; pread and pwrite use their own offset and leave the
+// descriptor's alone.
+void
+vectortest(void)
+{
+    static char big[3000];
+    char hdr[4], tail[8], got[8];
+    struct iovec iov[3];
+    int fd, fds[2], i;
+
+    printf(stdout, "vector test\n");
+    for(i = 0; i < sizeof(big); i++)
+        big[i] = i % 251;
+    memmove(hdr, "HDR", 4);
+    memmove(tail, "TAILTAI", 8);
+
+    fd = open("vecfile", O_CREATE|O_RDWR);
+    if(fd < 0){
+        printf(stdout, "create vecfile failed\n");
+        exit();
+    }
+    iov[0].iov_base = hdr;
+    iov[0].iov_len = sizeof(hdr);
+    iov[1].iov_base = big;
+    iov[1].iov_len = sizeof(big);
+    iov[2].iov_base = tail;
+    iov[2].iov_len = sizeof(tail);
+    if(writev(fd, iov, 3) != sizeof(hdr) + sizeof(big) + sizeof(tail)){
+        printf(stdout, "writev failed\n");
+        exit();
+    }
+    if(writev(fd, iov, IOV_MAX+1) >= 0){
+        printf(stdout, "writev took too many buffers\n");
+        exit();
+    }
+
+    // Overwrite the header in place, then read the tail by offset.
+    if(pwrite(fd, "hdr", 4, 0) != 4 ||
+       pread(fd, got, sizeof(got), sizeof(hdr) + sizeof(big)) != sizeof(got) ||
+       strcmp(got, "TAILTAI") != 0){
+        printf(stdout, "pread/pwrite failed\n");
+        exit();
+    }
+    // The offset is still at the end of the writev.
+    if(read(fd, got, 1) != 0){
+        printf(stdout, "pread/pwrite moved the offset\n");
+        exit();
+    }
+    close(fd);
+
+    fd = open("vecfile", O_RDONLY);
+    memset(big, 0, sizeof(big));
+    memset(tail, 0, sizeof(tail));
+    if(readv(fd, iov, 3) != sizeof(hdr) + sizeof(big) + sizeof(tail) ||
+       strcmp(hdr, "hdr") != 0 || strcmp(tail, "TAILTAI") != 0){
+        printf(stdout, "readv failed\n");
+        exit();
+    }
+    for(i = 0; i < sizeof(big); i++){
+        if(big[i] != (char)(i % 251)){
+            printf(stdout, "readv data wrong at %d\n", i);
+            exit();
+        }
+    }
+    close(fd);
+    unlink("vecfile");
+
+    // No buffers, or only empty ones, read nothing from an empty
+    // pipe rather than waiting.
+    if(pipe(fds) != 0){
+        printf(stdout, "pipe() failed\n");
+        exit();
+    }
+    iov[0].iov_len = 0;
+    if(readv(fds[0], iov, 0) != 0 || readv(fds[0], iov, 1) != 0){
+        printf(stdout, "readv of no buffers failed\n");
+        exit();
+    }
+    close(fds[0]);
+    close(fds[1]);
+    printf(stdout, "vector ok\n");
+}
+
+// sendfile() a file into a pipe for a child to check, with and
+// without an offset, and splice() what a child writes into a pipe
+// into a file.
+void
+splicetest(void)
+{
+    static char data[2000], got[2000];
+    int fd, fds[2], i, n, off, pid;
+
+    printf(stdout, "splice test\n");
+    for(i = 0; i < sizeof(data); i++)
+        data[i] = i % 253;
+    fd = open("splicefile", O_CREATE|O_RDWR);
+    if(fd < 0 || write(fd, data, sizeof(data)) != sizeof(data)){
+        printf(stdout, "create splicefile failed\n");
+        exit();
+    }
+    close(fd);
+
+    if(pipe(fds) != 0){
+        printf(stdout, "pipe() failed\n");
+        exit();
+    }
+    pid = fork();
+    if(pid < 0){
+        printf(stdout, "fork failed\n");
+        exit();
+    }
+    if(pid == 0){
+        close(fds[1]);
+        for(n = 0; (i = read(fds[0], got + n, sizeof(got) - n)) > 0; n += i)
+            ;
+        if(n != sizeof(data) - 100){
+            printf(stdout, "sendfile: child got %d bytes\n", n);
+            exit();
+        }
+        for(i = 0; i < n; i++){
+            if(got[i] != data[100 + i]){
+                printf(stdout, "sendfile: wrong byte at %d\n", i);
+                exit();
+            }
+        }
+        exit();
+    }
+    close(fds[0]);
+    fd = open("splicefile", O_RDONLY);
+    off = 100;
+    if(sendfile(fds[1], fd, &off, 1000) != 1000 || off != 1100){
+        printf(stdout, "sendfile with offset failed\n");
+        exit();
+    }
+    // fd's own offset is still 0.
+    if(read(fd, got, 1100) != 1100 || got[0] != data[0] || sendfile(fds[1], fd, 0, sizeof(data)) != sizeof(data) - 1100 ||
+       sendfile(fds[1], fd, 0, 10) != 0){
+        printf(stdout, "sendfile failed\n");
+        exit();
+    }
+    close(fd);
+    close(fds[1]);
+    wait();
+
+    if(pipe(fds) != 0){
+        printf(stdout, "pipe() failed\n");
+        exit();
+    }
+    pid = fork();
+    if(pid < 0){
+        printf(stdout, "fork failed\n");
+        exit();
+    }
+    if(pid == 0){
+        close(fds[0]);
+        write(fds[1], data, sizeof(data));
+        exit();
+    }
+    close(fds[1]);
+    fd = open("splicefile2", O_CREATE|O_RDWR);
+    if((n = splice(fds[0], 0, fd, 0, 10)) <= 0 || splice(fd, 0, fd, 0, 10) >= 0){
+        printf(stdout, "splice failed\n");
+        exit();
+    }
+    for(; (i = splice(fds[0], 0, fd, 0, sizeof(data))) > 0; n += i)
+        ;
+    close(fds[0]);
+    wait();
+    if(n != sizeof(data) || pread(fd, got, sizeof(got), 0) != sizeof(got)){
+        printf(stdout, "splice moved %d bytes\n", n);
+        exit();
+    }
+    for(i = 0; i < sizeof(data); i++){
+        if(got[i] != data[i]){
+            printf(stdout, "splice: wrong byte at %d\n", i);
+            exit();
+        }
+    }
+    close(fd);
+    unlink("splicefile");
+    unlink("splicefile2");
+    printf(stdout, "splice ok\n");
+}
+
+// Calls are counted for the caller while sysstat is on, and a
+// traced call shows up in the trace ring with its return value.
+void
+sysstattest(void)
+{
+    static struct sysstat st[NSYSCALL];
+    struct stracerec r[4];
+    int i, n, pid, found;
+
+    printf(stdout, "sysstat test\n");
+    pid = getpid();
+    sysstat(SYSSTAT_RESET, pid, 0, 0);
+    sysstat(SYSSTAT_ON, 0, 0, 0);
+    for(i = 0; i < 10; i++)
+        getpid();
+    sysstat(SYSSTAT_OFF, 0, 0, 0);
+    if(sysstat(SYSSTAT_READ, pid, st, NSYSCALL) != NSYSCALL ||
+       st[SYS_getpid].count < 10 || strcmp(st[SYS_getpid].name, "getpid") != 0){
+        printf(stdout, "sysstat did not count getpid\n");
+        exit();
+    }
+
+    if(strace(0, 1) < 0){
+        printf(stdout, "strace failed\n");
+        exit();
+    }
+    getpid();
+    strace(0, 0);
+    found = 0;
+    while((n = straceread(r, 4)) > 0)
+        for(i = 0; i < n; i++)
+            if(r[i].pid == pid && r[i].num == SYS_getpid && r[i].ret == pid)
+                found = 1;
+    if(!found){
+        printf(stdout, "traced getpid not recorded\n");
+        exit();
+    }
+    printf(stdout, "sysstat ok\n");
+}
+
+// The vdso functions must agree with the system calls they stand
+// in for, in a forked child too.
+void
+vdsotest(void)
+{
+    struct timespec a, b;
+    int pid, t;
+
+    printf(stdout, "vdso test\n");
+    t = uptime();
+    if(vgetpid() != getpid() || vuptime() < t || vuptime() > t + 2){
+        printf(stdout, "vdso disagrees with system calls\n");
+        exit();
+    }
+    clock_gettime(CLOCK_MONOTONIC, &a);
+    if(vclock_gettime(CLOCK_MONOTONIC, &b) < 0 || b.tv_sec < a.tv_sec ||
+       (b.tv_sec == a.tv_sec && b.tv_nsec < a.tv_nsec)){
+        printf(stdout, "vclock_gettime went backwards\n");
+        exit();
+    }
+    pid = fork();
+    if(pid < 0){
+        printf(stdout, "fork failed\n");
+        exit();
+    }
+    if(pid == 0){
+        if(vgetpid() != getpid()){
+            printf(stdout, "vgetpid wrong in child\n");
+            exit();
+        }
+        exit();
+    }
+    wait();
+    printf(stdout, "vdso ok\n");
+}
+
 void
 mem(void)
 {
@@ -1280,6 +1620,34 @@ rmdot(void)
     printf(1, "rmdot ok\n");
 }
 
+// Once a file's name is in the name cache, a path that uses the
+// file as a directory must still fail rather than reach dirlookup().
+void
+ncachefile(void)
+{
+    int fd;
+
+    printf(1, "ncache file test\n");
+    fd = open("ncfile", O_CREATE|O_RDWR);
+    if(fd < 0){
+        printf(1, "create ncfile failed\n");
+        exit();
+    }
+    close(fd);
+    // Look it up twice, so the second comes from the cache.
+    if(chdir("ncfile") == 0 || chdir("ncfile") == 0){
+        printf(1, "chdir ncfile succeeded!\n");
+        exit();
+    }
+    if(open("ncfile/xx", O_CREATE) >= 0 || mkdir("ncfile/xx") == 0 ||
+       link("README", "ncfile/xx") == 0 || unlink("ncfile/xx") == 0){
+        printf(1, "ncfile used as a directory\n");
+        exit();
+    }
+    unlink("ncfile");
+    printf(1, "ncache file ok\n");
+}
+
 void
 dirfile(void)
 {
@@ -1774,6 +2142,8 @@ main(int argc, char *argv[])
     writetest();
     writetest1();
     createtest();
+    vectortest();
+    splicetest();
 
     openiputtest();
     exitiputtest();
@@ -1783,6 +2153,10 @@ main(int argc, char *argv[])
     pipe1();
     preempt();
     exitwait();
+    nanosleeptest();
+    rttest();
+    vdsotest();
+    sysstattest();
 
     rmdot();
     fourteen();
@@ -1791,6 +2165,7 @@ main(int argc, char *argv[])
     linktest();
     unlinkread();
     dirfile();
+    ncachefile();
     iref();
     forktest();
     bigdir(); // slow
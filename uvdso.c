@@ -0,0 +1,74 @@
+// Time and pid from the kernel's read-only pages (vdso.h),
+// without a system call.    Kept out of ulib.c so that only the
+// programs that use them carry the calendar code; link uvdso.o.
+
+#include "types.h"
+#include "user.h"
+#include "x86.h"
+#include "date.h"
+#include "vdso.h"
+
+#define vdso      ((struct vdso*)VDSOADDR)
+#define vdsoproc  ((struct vdsoproc*)VDSOPROC)
+
+int
+vgetpid(void)
+{
+    return vdsoproc->pid;
+}
+
+int
+vuptime(void)
+{
+    return vdso->ticks;
+}
+
+// As clock_gettime(), for CLOCK_MONOTONIC and CLOCK_REALTIME.
+int
+vclock_gettime(int clk, struct timespec *ts)
+{
+    uint64 cycles, ms;
+    uint sec;
+
+    if(clk != CLOCK_MONOTONIC && clk != CLOCK_REALTIME)
+        return -1;
+    cycles = rdtsc() - vdso->boottsc;
+    ms = divu64(cycles, vdso->tsckhz);
+    cycles -= ms * vdso->tsckhz;
+    sec = divu64(ms, 1000);
+    ts->tv_sec = sec;
+    ts->tv_nsec = (ms - (uint64)sec * 1000) * 1000000 +
+        (uint)divu64(cycles * 1000000, vdso->tsckhz);
+    if(clk == CLOCK_REALTIME)
+        ts->tv_sec += vdso->bootsec;
+    return 0;
+}
+
+// As date(), from the boot-time RTC reading and the TSC.
+int
+vdate(struct rtcdate *r)
+{
+    struct timespec ts;
+    uint s, days, era, doe, yoe, doy, mp;
+
+    vclock_gettime(CLOCK_REALTIME, &ts);
+    s = ts.tv_sec;
+    days = s / 86400;
+    s %= 86400;
+    r->hour = s / 3600;
+    r->minute = s / 60 % 60;
+    r->second = s % 60;
+
+    // Civil date from days since 1970, with years starting in
+    // March so that the leap day comes last.
+    days += 719468;
+    era = days / 146097;
+    doe = days - era * 146097;
+    yoe = (doe - doe/1460 + doe/36524 - doe/146096) / 365;
+    doy = doe - (365*yoe + yoe/4 - yoe/100);
+    mp = (5*doy + 2) / 153;
+    r->day = doy - (153*mp + 2)/5 + 1;
+    r->month = mp < 10 ? mp + 3 : mp - 9;
+    r->year = yoe + era * 400 + (r->month <= 2);
+    return 0;
+}
@@ -0,0 +1,75 @@
+// The user-readable kernel data pages described in vdso.h.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "memlayout.h"
+#include "mmu.h"
+#include "x86.h"
+#include "date.h"
+#include "vdso.h"
+
+static struct vdso *vdso;
+
+// Seconds since 1970 at time r.    Counts years from March, so
+// that the leap day falls at the end of the year.
+static uint
+rtcsecs(struct rtcdate *r)
+{
+    uint y, m, days;
+
+    y = r->year;
+    m = r->month;
+    if(m <= 2){
+        y--;
+        m += 12;
+    }
+    days = 365*y + y/4 - y/100 + y/400 + (153*(m-3) + 2)/5 + r->day - 719469;
+    return ((days*24 + r->hour)*60 + r->minute)*60 + r->second;
+}
+
+// Set up the shared page.    Must run after the TSC is calibrated.
+void
+vdsoinit(void)
+{
+    struct rtcdate r;
+
+    if((vdso = (struct vdso*)kalloc()) == 0)
+        panic("vdsoinit");
+    memset(vdso, 0, PGSIZE);
+    // Keep a reference of the kernel's own, so that unmapping
+    // the page from the last process does not free it.
+    kincref(V2P(vdso));
+
+    cmostime(&r);
+    vdso->tsckhz = tsckhz;
+    vdso->boottsc = boottsc;
+    vdso->bootsec = rtcsecs(&r) - divu64(divu64(rdtsc() - boottsc, tsckhz), 1000);
+}
+
+// Map the shared page and a page holding pid's constants into
+// pgdir.    Return -1 if out of memory.
+int
+vdsomap(pde_t *pgdir, int pid)
+{
+    struct vdsoproc *vp;
+
+    if((vp = (struct vdsoproc*)kalloc()) == 0)
+        return -1;
+    memset(vp, 0, PGSIZE);
+    vp->pid = pid;
+    if(mappage(pgdir, (char*)VDSOPROC, V2P(vp), PTE_U) < 0){
+        kfree((char*)vp);
+        return -1;
+    }
+    if(mappage(pgdir, (char*)VDSOADDR, V2P(vdso), PTE_U) < 0)
+        return -1;
+    return 0;
+}
+
+// Called by trap() as ticks advances.
+void
+vdsotick(uint t)
+{
+    vdso->ticks = t;
+}
@@ -0,0 +1,18 @@
+// Pages the kernel maps read-only into every process, so that
+// ulib can read the time and the pid without a system call.
+
+#define VDSOADDR    0x7FFFE000        // struct vdso; 2 pages below KERNBASE
+#define VDSOPROC    (VDSOADDR+4096)   // struct vdsoproc
+
+// Shared by all processes.    Set up at boot; only ticks changes.
+struct vdso {
+    volatile uint ticks;    // As uptime() returns
+    uint tsckhz;            // TSC cycles per ms
+    uint64 boottsc;         // TSC at the zero of CLOCK_MONOTONIC
+    uint bootsec;           // Seconds since 1970 at boottsc, from the RTC
+};
+
+// One per process.
+struct vdsoproc {
+    int pid;
+};
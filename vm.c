@@ -4,9 +4,10 @@
 #include "x86.h"
 #include "memlayout.h"
 #include "mmu.h"
+#include "spinlock.h"
 #include "proc.h"
 #include "elf.h"
-#include "spinlock.h"
+#include "vdso.h"
 
 extern char data[];    // defined by kernel.ld
 pde_t *kpgdir;    // for use in scheduler()
@@ -164,7 +165,8 @@ switchuvm(struct proc *p)
     // forbids I/O instructions (e.g., inb and outb) from user space
     mycpu()->ts.iomb = (ushort) 0xFFFF;
     ltr(SEG_TSS << 3);
-    lcr3(V2P(p->pgdir));    // switch to process's address space
+    if(rcr3() != V2P(p->pgdir))    // reloading flushes the TLB
+        lcr3(V2P(p->pgdir));    // switch to process's address space
     popcli();
 }
 
@@ -235,7 +237,7 @@ allocuvm(pde_t *pgdir, uint vstart, uint vend)
 int expandheap(pde_t *pgdir, struct mm_area *area, int sz)
 {
     int newsz = area->sz + sz;
-    if(area->start + newsz > KERNBASE)
+    if(area->start + newsz > VDSOADDR)
         return -1;
     area->sz = newsz; 
     return 0;
@@ -411,7 +413,7 @@ copyseg(pde_t *opgdir, pde_t *npgdir, struct mm_area *seg)
         if((*pte1 & PTE_P)){     
             if(!(*pte1 & PTE_U))
                 panic("copyseg");
-            if((*pte1 & (PTE_W | PTE_COW))){
+            if((*pte1 & (PTE_W | PTE_COW)) && !(*pte1 & PTE_SHARED)){
                 *pte1 |= PTE_COW;
                 *pte1 &= ~PTE_W; 
             }
@@ -428,6 +430,50 @@ bad:
     return 0;
 }
 
+// Fault in the user pages under [va, va+len) of the current
+// process, for writing if write is set, and take a reference to
+// each, so that the kernel can reach them through the physical
+// addresses stored in pa[] even after the process moves on.    The
+// range must have been checked with checkrange().
+// Return the number of pages, or -1.
+int
+pinuvm(uint va, uint len, int write, uint *pa)
+{
+    pde_t *pgdir = myproc()->pgdir;
+    volatile char *b;
+    pte_t *pte;
+    uint a;
+    int n;
+
+    n = 0;
+    for(a = PGROUNDDOWN(va); a < va + len; a += PGSIZE){
+        // Let trap() allocate the page or break COW on it.
+        b = (volatile char*)(a < va ? va : a);
+        if(write)
+            *b = *b;
+        else
+            (void)*b;
+        pte = walkpgdir(pgdir, (void*)a, 0);
+        if(pte == 0 || !(*pte & PTE_P) || (write && !(*pte & PTE_W))){
+            unpinuvm(pa, n);
+            return -1;
+        }
+        pa[n] = PTE_ADDR(*pte);
+        kincref(pa[n++]);
+    }
+    return n;
+}
+
+// Drop the references taken by pinuvm().
+void
+unpinuvm(uint *pa, int n)
+{
+    int i;
+
+    for(i = 0; i < n; i++)
+        kdecref(pa[i]);
+}
+
 //PAGEBREAK!
 // Map user virtual address to kernel address.
 char*
@@ -0,0 +1,1536 @@
+
+_wc:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <wc>:
+
+char buf[512];
+
+void
+wc(int fd, char *name)
+{
+   0:	55                   	push   %ebp
+   1:	89 e5                	mov    %esp,%ebp
+   3:	83 ec 28             	sub    $0x28,%esp
+    int i, n;
+    int l, w, c, inword;
+
+    l = w = c = 0;
+   6:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+   d:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  10:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  13:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  16:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    inword = 0;
+  19:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+    while((n = read(fd, buf, sizeof(buf))) > 0){
+  20:	eb 69                	jmp    8b <wc+0x8b>
+        for(i=0; i<n; i++){
+  22:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  29:	eb 58                	jmp    83 <wc+0x83>
+            c++;
+  2b:	83 45 e8 01          	addl   $0x1,-0x18(%ebp)
+            if(buf[i] == '\n')
+  2f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  32:	05 60 0e 00 00       	add    $0xe60,%eax
+  37:	0f b6 00             	movzbl (%eax),%eax
+  3a:	3c 0a                	cmp    $0xa,%al
+  3c:	75 04                	jne    42 <wc+0x42>
+                l++;
+  3e:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+            if(strchr(" \r\t\n\v", buf[i]))
+  42:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  45:	05 60 0e 00 00       	add    $0xe60,%eax
+  4a:	0f b6 00             	movzbl (%eax),%eax
+  4d:	0f be c0             	movsbl %al,%eax
+  50:	83 ec 08             	sub    $0x8,%esp
+  53:	50                   	push   %eax
+  54:	68 7c 0b 00 00       	push   $0xb7c
+  59:	e8 35 02 00 00       	call   293 <strchr>
+  5e:	83 c4 10             	add    $0x10,%esp
+  61:	85 c0                	test   %eax,%eax
+  63:	74 09                	je     6e <wc+0x6e>
+                inword = 0;
+  65:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  6c:	eb 11                	jmp    7f <wc+0x7f>
+            else if(!inword){
+  6e:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  72:	75 0b                	jne    7f <wc+0x7f>
+                w++;
+  74:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+                inword = 1;
+  78:	c7 45 e4 01 00 00 00 	movl   $0x1,-0x1c(%ebp)
+        for(i=0; i<n; i++){
+  7f:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+  83:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  86:	3b 45 e0             	cmp    -0x20(%ebp),%eax
+  89:	7c a0                	jl     2b <wc+0x2b>
+    while((n = read(fd, buf, sizeof(buf))) > 0){
+  8b:	83 ec 04             	sub    $0x4,%esp
+  8e:	68 00 02 00 00       	push   $0x200
+  93:	68 60 0e 00 00       	push   $0xe60
+  98:	ff 75 08             	push   0x8(%ebp)
+  9b:	e8 3c 04 00 00       	call   4dc <read>
+  a0:	83 c4 10             	add    $0x10,%esp
+  a3:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  a6:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  aa:	0f 8f 72 ff ff ff    	jg     22 <wc+0x22>
+            }
+        }
+    }
+    if(n < 0){
+  b0:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  b4:	79 17                	jns    cd <wc+0xcd>
+        printf(1, "wc: read error\n");
+  b6:	83 ec 08             	sub    $0x8,%esp
+  b9:	68 82 0b 00 00       	push   $0xb82
+  be:	6a 01                	push   $0x1
+  c0:	e8 00 07 00 00       	call   7c5 <printf>
+  c5:	83 c4 10             	add    $0x10,%esp
+        exit();
+  c8:	e8 fa 03 00 00       	call   4c7 <exit>
+    }
+    printf(1, "%d %d %d %s\n", l, w, c, name);
+  cd:	83 ec 08             	sub    $0x8,%esp
+  d0:	ff 75 0c             	push   0xc(%ebp)
+  d3:	ff 75 e8             	push   -0x18(%ebp)
+  d6:	ff 75 ec             	push   -0x14(%ebp)
+  d9:	ff 75 f0             	push   -0x10(%ebp)
+  dc:	68 92 0b 00 00       	push   $0xb92
+  e1:	6a 01                	push   $0x1
+  e3:	e8 dd 06 00 00       	call   7c5 <printf>
+  e8:	83 c4 20             	add    $0x20,%esp
+}
+  eb:	90                   	nop
+  ec:	c9                   	leave
+  ed:	c3                   	ret
+
+000000ee <main>:
+
+int
+main(int argc, char *argv[])
+{
+  ee:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+  f2:	83 e4 f0             	and    $0xfffffff0,%esp
+  f5:	ff 71 fc             	push   -0x4(%ecx)
+  f8:	55                   	push   %ebp
+  f9:	89 e5                	mov    %esp,%ebp
+  fb:	53                   	push   %ebx
+  fc:	51                   	push   %ecx
+  fd:	83 ec 10             	sub    $0x10,%esp
+ 100:	89 cb                	mov    %ecx,%ebx
+    int fd, i;
+
+    if(argc <= 1){
+ 102:	83 3b 01             	cmpl   $0x1,(%ebx)
+ 105:	7f 17                	jg     11e <main+0x30>
+        wc(0, "");
+ 107:	83 ec 08             	sub    $0x8,%esp
+ 10a:	68 9f 0b 00 00       	push   $0xb9f
+ 10f:	6a 00                	push   $0x0
+ 111:	e8 ea fe ff ff       	call   0 <wc>
+ 116:	83 c4 10             	add    $0x10,%esp
+        exit();
+ 119:	e8 a9 03 00 00       	call   4c7 <exit>
+    }
+
+    for(i = 1; i < argc; i++){
+ 11e:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+ 125:	e9 83 00 00 00       	jmp    1ad <main+0xbf>
+        if((fd = open(argv[i], 0)) < 0){
+ 12a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 12d:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+ 134:	8b 43 04             	mov    0x4(%ebx),%eax
+ 137:	01 d0                	add    %edx,%eax
+ 139:	8b 00                	mov    (%eax),%eax
+ 13b:	83 ec 08             	sub    $0x8,%esp
+ 13e:	6a 00                	push   $0x0
+ 140:	50                   	push   %eax
+ 141:	e8 c8 03 00 00       	call   50e <open>
+ 146:	83 c4 10             	add    $0x10,%esp
+ 149:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ 14c:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 150:	79 29                	jns    17b <main+0x8d>
+            printf(1, "wc: cannot open %s\n", argv[i]);
+ 152:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 155:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+ 15c:	8b 43 04             	mov    0x4(%ebx),%eax
+ 15f:	01 d0                	add    %edx,%eax
+ 161:	8b 00                	mov    (%eax),%eax
+ 163:	83 ec 04             	sub    $0x4,%esp
+ 166:	50                   	push   %eax
+ 167:	68 a0 0b 00 00       	push   $0xba0
+ 16c:	6a 01                	push   $0x1
+ 16e:	e8 52 06 00 00       	call   7c5 <printf>
+ 173:	83 c4 10             	add    $0x10,%esp
+            exit();
+ 176:	e8 4c 03 00 00       	call   4c7 <exit>
+        }
+        wc(fd, argv[i]);
+ 17b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 17e:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+ 185:	8b 43 04             	mov    0x4(%ebx),%eax
+ 188:	01 d0                	add    %edx,%eax
+ 18a:	8b 00                	mov    (%eax),%eax
+ 18c:	83 ec 08             	sub    $0x8,%esp
+ 18f:	50                   	push   %eax
+ 190:	ff 75 f0             	push   -0x10(%ebp)
+ 193:	e8 68 fe ff ff       	call   0 <wc>
+ 198:	83 c4 10             	add    $0x10,%esp
+        close(fd);
+ 19b:	83 ec 0c             	sub    $0xc,%esp
+ 19e:	ff 75 f0             	push   -0x10(%ebp)
+ 1a1:	e8 4a 03 00 00       	call   4f0 <close>
+ 1a6:	83 c4 10             	add    $0x10,%esp
+    for(i = 1; i < argc; i++){
+ 1a9:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+ 1ad:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 1b0:	3b 03                	cmp    (%ebx),%eax
+ 1b2:	0f 8c 72 ff ff ff    	jl     12a <main+0x3c>
+    }
+    exit();
+ 1b8:	e8 0a 03 00 00       	call   4c7 <exit>
+
+000001bd <stosb>:
+strchr(const char *s, char c)
+{
+    for(; *s; s++)
+        if(*s == c)
+            return (char*)s;
+    return 0;
+ 1bd:	55                   	push   %ebp
+ 1be:	89 e5                	mov    %esp,%ebp
+ 1c0:	57                   	push   %edi
+ 1c1:	53                   	push   %ebx
+}
+ 1c2:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 1c5:	8b 55 10             	mov    0x10(%ebp),%edx
+ 1c8:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 1cb:	89 cb                	mov    %ecx,%ebx
+ 1cd:	89 df                	mov    %ebx,%edi
+ 1cf:	89 d1                	mov    %edx,%ecx
+ 1d1:	fc                   	cld
+ 1d2:	f3 aa                	rep stos %al,%es:(%edi)
+ 1d4:	89 ca                	mov    %ecx,%edx
+ 1d6:	89 fb                	mov    %edi,%ebx
+ 1d8:	89 5d 08             	mov    %ebx,0x8(%ebp)
+ 1db:	89 55 10             	mov    %edx,0x10(%ebp)
+
+char*
+gets(char *buf, int max)
+{
+ 1de:	90                   	nop
+ 1df:	5b                   	pop    %ebx
+ 1e0:	5f                   	pop    %edi
+ 1e1:	5d                   	pop    %ebp
+ 1e2:	c3                   	ret
+
+000001e3 <strcpy>:
+{
+ 1e3:	55                   	push   %ebp
+ 1e4:	89 e5                	mov    %esp,%ebp
+ 1e6:	83 ec 10             	sub    $0x10,%esp
+    os = s;
+ 1e9:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1ec:	89 45 fc             	mov    %eax,-0x4(%ebp)
+    while((*s++ = *t++) != 0)
+ 1ef:	90                   	nop
+ 1f0:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 1f3:	8d 42 01             	lea    0x1(%edx),%eax
+ 1f6:	89 45 0c             	mov    %eax,0xc(%ebp)
+ 1f9:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1fc:	8d 48 01             	lea    0x1(%eax),%ecx
+ 1ff:	89 4d 08             	mov    %ecx,0x8(%ebp)
+ 202:	0f b6 12             	movzbl (%edx),%edx
+ 205:	88 10                	mov    %dl,(%eax)
+ 207:	0f b6 00             	movzbl (%eax),%eax
+ 20a:	84 c0                	test   %al,%al
+ 20c:	75 e2                	jne    1f0 <strcpy+0xd>
+    return os;
+ 20e:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 211:	c9                   	leave
+ 212:	c3                   	ret
+
+00000213 <strcmp>:
+{
+ 213:	55                   	push   %ebp
+ 214:	89 e5                	mov    %esp,%ebp
+    while(*p && *p == *q)
+ 216:	eb 08                	jmp    220 <strcmp+0xd>
+        p++, q++;
+ 218:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 21c:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+    while(*p && *p == *q)
+ 220:	8b 45 08             	mov    0x8(%ebp),%eax
+ 223:	0f b6 00             	movzbl (%eax),%eax
+ 226:	84 c0                	test   %al,%al
+ 228:	74 10                	je     23a <strcmp+0x27>
+ 22a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 22d:	0f b6 10             	movzbl (%eax),%edx
+ 230:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 233:	0f b6 00             	movzbl (%eax),%eax
+ 236:	38 c2                	cmp    %al,%dl
+ 238:	74 de                	je     218 <strcmp+0x5>
+    return (uchar)*p - (uchar)*q;
+ 23a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 23d:	0f b6 00             	movzbl (%eax),%eax
+ 240:	0f b6 d0             	movzbl %al,%edx
+ 243:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 246:	0f b6 00             	movzbl (%eax),%eax
+ 249:	0f b6 c0             	movzbl %al,%eax
+ 24c:	29 c2                	sub    %eax,%edx
+ 24e:	89 d0                	mov    %edx,%eax
+}
+ 250:	5d                   	pop    %ebp
+ 251:	c3                   	ret
+
+00000252 <strlen>:
+{
+ 252:	55                   	push   %ebp
+ 253:	89 e5                	mov    %esp,%ebp
+ 255:	83 ec 10             	sub    $0x10,%esp
+    for(n = 0; s[n]; n++)
+ 258:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ 25f:	eb 04                	jmp    265 <strlen+0x13>
+ 261:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 265:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 268:	8b 45 08             	mov    0x8(%ebp),%eax
+ 26b:	01 d0                	add    %edx,%eax
+ 26d:	0f b6 00             	movzbl (%eax),%eax
+ 270:	84 c0                	test   %al,%al
+ 272:	75 ed                	jne    261 <strlen+0xf>
+    return n;
+ 274:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 277:	c9                   	leave
+ 278:	c3                   	ret
+
+00000279 <memset>:
+{
+ 279:	55                   	push   %ebp
+ 27a:	89 e5                	mov    %esp,%ebp
+    stosb(dst, c, n);
+ 27c:	8b 45 10             	mov    0x10(%ebp),%eax
+ 27f:	50                   	push   %eax
+ 280:	ff 75 0c             	push   0xc(%ebp)
+ 283:	ff 75 08             	push   0x8(%ebp)
+ 286:	e8 32 ff ff ff       	call   1bd <stosb>
+ 28b:	83 c4 0c             	add    $0xc,%esp
+    return dst;
+ 28e:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 291:	c9                   	leave
+ 292:	c3                   	ret
+
+00000293 <strchr>:
+{
+ 293:	55                   	push   %ebp
+ 294:	89 e5                	mov    %esp,%ebp
+ 296:	83 ec 04             	sub    $0x4,%esp
+ 299:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 29c:	88 45 fc             	mov    %al,-0x4(%ebp)
+    for(; *s; s++)
+ 29f:	eb 14                	jmp    2b5 <strchr+0x22>
+        if(*s == c)
+ 2a1:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2a4:	0f b6 00             	movzbl (%eax),%eax
+ 2a7:	38 45 fc             	cmp    %al,-0x4(%ebp)
+ 2aa:	75 05                	jne    2b1 <strchr+0x1e>
+            return (char*)s;
+ 2ac:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2af:	eb 13                	jmp    2c4 <strchr+0x31>
+    for(; *s; s++)
+ 2b1:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 2b5:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2b8:	0f b6 00             	movzbl (%eax),%eax
+ 2bb:	84 c0                	test   %al,%al
+ 2bd:	75 e2                	jne    2a1 <strchr+0xe>
+    return 0;
+ 2bf:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 2c4:	c9                   	leave
+ 2c5:	c3                   	ret
+
+000002c6 <gets>:
+{
+ 2c6:	55                   	push   %ebp
+ 2c7:	89 e5                	mov    %esp,%ebp
+ 2c9:	83 ec 18             	sub    $0x18,%esp
+    int i, cc;
+    char c;
+
+    for(i=0; i+1 < max; ){
+ 2cc:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 2d3:	eb 42                	jmp    317 <gets+0x51>
+        cc = read(0, &c, 1);
+ 2d5:	83 ec 04             	sub    $0x4,%esp
+ 2d8:	6a 01                	push   $0x1
+ 2da:	8d 45 ef             	lea    -0x11(%ebp),%eax
+ 2dd:	50                   	push   %eax
+ 2de:	6a 00                	push   $0x0
+ 2e0:	e8 f7 01 00 00       	call   4dc <read>
+ 2e5:	83 c4 10             	add    $0x10,%esp
+ 2e8:	89 45 f0             	mov    %eax,-0x10(%ebp)
+        if(cc < 1)
+ 2eb:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 2ef:	7e 33                	jle    324 <gets+0x5e>
+            break;
+        buf[i++] = c;
+ 2f1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 2f4:	8d 50 01             	lea    0x1(%eax),%edx
+ 2f7:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 2fa:	89 c2                	mov    %eax,%edx
+ 2fc:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2ff:	01 c2                	add    %eax,%edx
+ 301:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 305:	88 02                	mov    %al,(%edx)
+        if(c == '\n' || c == '\r')
+ 307:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 30b:	3c 0a                	cmp    $0xa,%al
+ 30d:	74 16                	je     325 <gets+0x5f>
+ 30f:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 313:	3c 0d                	cmp    $0xd,%al
+ 315:	74 0e                	je     325 <gets+0x5f>
+    for(i=0; i+1 < max; ){
+ 317:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 31a:	83 c0 01             	add    $0x1,%eax
+ 31d:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 320:	7f b3                	jg     2d5 <gets+0xf>
+ 322:	eb 01                	jmp    325 <gets+0x5f>
+            break;
+ 324:	90                   	nop
+            break;
+    }
+    buf[i] = '\0';
+ 325:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 328:	8b 45 08             	mov    0x8(%ebp),%eax
+ 32b:	01 d0                	add    %edx,%eax
+ 32d:	c6 00 00             	movb   $0x0,(%eax)
+    return buf;
+ 330:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 333:	c9                   	leave
+ 334:	c3                   	ret
+
+00000335 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 335:	55                   	push   %ebp
+ 336:	89 e5                	mov    %esp,%ebp
+ 338:	83 ec 18             	sub    $0x18,%esp
+    int fd;
+    int r;
+
+    fd = open(n, O_RDONLY);
+ 33b:	83 ec 08             	sub    $0x8,%esp
+ 33e:	6a 00                	push   $0x0
+ 340:	ff 75 08             	push   0x8(%ebp)
+ 343:	e8 c6 01 00 00       	call   50e <open>
+ 348:	83 c4 10             	add    $0x10,%esp
+ 34b:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(fd < 0)
+ 34e:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 352:	79 07                	jns    35b <stat+0x26>
+        return -1;
+ 354:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 359:	eb 25                	jmp    380 <stat+0x4b>
+    r = fstat(fd, st);
+ 35b:	83 ec 08             	sub    $0x8,%esp
+ 35e:	ff 75 0c             	push   0xc(%ebp)
+ 361:	ff 75 f4             	push   -0xc(%ebp)
+ 364:	e8 c3 01 00 00       	call   52c <fstat>
+ 369:	83 c4 10             	add    $0x10,%esp
+ 36c:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    close(fd);
+ 36f:	83 ec 0c             	sub    $0xc,%esp
+ 372:	ff 75 f4             	push   -0xc(%ebp)
+ 375:	e8 76 01 00 00       	call   4f0 <close>
+ 37a:	83 c4 10             	add    $0x10,%esp
+    return r;
+ 37d:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ 380:	c9                   	leave
+ 381:	c3                   	ret
+
+00000382 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 382:	55                   	push   %ebp
+ 383:	89 e5                	mov    %esp,%ebp
+ 385:	83 ec 10             	sub    $0x10,%esp
+    int n;
+
+    n = 0;
+ 388:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+    while('0' <= *s && *s <= '9')
+ 38f:	eb 25                	jmp    3b6 <atoi+0x34>
+        n = n*10 + *s++ - '0';
+ 391:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 394:	89 d0                	mov    %edx,%eax
+ 396:	c1 e0 02             	shl    $0x2,%eax
+ 399:	01 d0                	add    %edx,%eax
+ 39b:	01 c0                	add    %eax,%eax
+ 39d:	89 c1                	mov    %eax,%ecx
+ 39f:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3a2:	8d 50 01             	lea    0x1(%eax),%edx
+ 3a5:	89 55 08             	mov    %edx,0x8(%ebp)
+ 3a8:	0f b6 00             	movzbl (%eax),%eax
+ 3ab:	0f be c0             	movsbl %al,%eax
+ 3ae:	01 c8                	add    %ecx,%eax
+ 3b0:	83 e8 30             	sub    $0x30,%eax
+ 3b3:	89 45 fc             	mov    %eax,-0x4(%ebp)
+    while('0' <= *s && *s <= '9')
+ 3b6:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3b9:	0f b6 00             	movzbl (%eax),%eax
+ 3bc:	3c 2f                	cmp    $0x2f,%al
+ 3be:	7e 0a                	jle    3ca <atoi+0x48>
+ 3c0:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3c3:	0f b6 00             	movzbl (%eax),%eax
+ 3c6:	3c 39                	cmp    $0x39,%al
+ 3c8:	7e c7                	jle    391 <atoi+0xf>
+    return n;
+ 3ca:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 3cd:	c9                   	leave
+ 3ce:	c3                   	ret
+
+000003cf <nice>:
+
+// Add inc to the caller's nice value; return the new value.
+int
+nice(int inc)
+{
+ 3cf:	55                   	push   %ebp
+ 3d0:	89 e5                	mov    %esp,%ebp
+ 3d2:	83 ec 18             	sub    $0x18,%esp
+    int n;
+
+    n = getpriority(0) + inc;
+ 3d5:	83 ec 0c             	sub    $0xc,%esp
+ 3d8:	6a 00                	push   $0x0
+ 3da:	e8 d9 01 00 00       	call   5b8 <getpriority>
+ 3df:	83 c4 10             	add    $0x10,%esp
+ 3e2:	8b 55 08             	mov    0x8(%ebp),%edx
+ 3e5:	01 d0                	add    %edx,%eax
+ 3e7:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(n < 0)
+ 3ea:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 3ee:	79 07                	jns    3f7 <nice+0x28>
+        n = 0;
+ 3f0:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    if(n > NICEMAX)
+ 3f7:	83 7d f4 13          	cmpl   $0x13,-0xc(%ebp)
+ 3fb:	7e 07                	jle    404 <nice+0x35>
+        n = NICEMAX;
+ 3fd:	c7 45 f4 13 00 00 00 	movl   $0x13,-0xc(%ebp)
+    if(setpriority(0, n) < 0)
+ 404:	83 ec 08             	sub    $0x8,%esp
+ 407:	ff 75 f4             	push   -0xc(%ebp)
+ 40a:	6a 00                	push   $0x0
+ 40c:	e8 b1 01 00 00       	call   5c2 <setpriority>
+ 411:	83 c4 10             	add    $0x10,%esp
+ 414:	85 c0                	test   %eax,%eax
+ 416:	79 07                	jns    41f <nice+0x50>
+        return -1;
+ 418:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 41d:	eb 03                	jmp    422 <nice+0x53>
+    return n;
+ 41f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+ 422:	c9                   	leave
+ 423:	c3                   	ret
+
+00000424 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 424:	55                   	push   %ebp
+ 425:	89 e5                	mov    %esp,%ebp
+ 427:	83 ec 10             	sub    $0x10,%esp
+    char *dst;
+    const char *src;
+
+    dst = vdst;
+ 42a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 42d:	89 45 fc             	mov    %eax,-0x4(%ebp)
+    src = vsrc;
+ 430:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 433:	89 45 f8             	mov    %eax,-0x8(%ebp)
+    while(n-- > 0)
+ 436:	eb 17                	jmp    44f <memmove+0x2b>
+        *dst++ = *src++;
+ 438:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 43b:	8d 42 01             	lea    0x1(%edx),%eax
+ 43e:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 441:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 444:	8d 48 01             	lea    0x1(%eax),%ecx
+ 447:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+ 44a:	0f b6 12             	movzbl (%edx),%edx
+ 44d:	88 10                	mov    %dl,(%eax)
+    while(n-- > 0)
+ 44f:	8b 45 10             	mov    0x10(%ebp),%eax
+ 452:	8d 50 ff             	lea    -0x1(%eax),%edx
+ 455:	89 55 10             	mov    %edx,0x10(%ebp)
+ 458:	85 c0                	test   %eax,%eax
+ 45a:	7f dc                	jg     438 <memmove+0x14>
+    return vdst;
+ 45c:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 45f:	c9                   	leave
+ 460:	c3                   	ret
+
+00000461 <dosyscall>:
+sysmode:
+    .long 0
+
+    .text
+dosyscall:
+    cmpl $0, sysmode
+ 461:	83 3d 44 0e 00 00 00 	cmpl   $0x0,0xe44
+    jg 2f
+ 468:	7f 0c                	jg     476 <dosyscall+0x15>
+    jl 1f
+ 46a:	7c 07                	jl     473 <dosyscall+0x12>
+    call sepcheck
+ 46c:	e8 27 00 00 00       	call   498 <sepcheck>
+    jmp dosyscall
+ 471:	eb ee                	jmp    461 <dosyscall>
+1:
+    int $T_SYSCALL
+ 473:	cd 40                	int    $0x40
+    ret
+ 475:	c3                   	ret
+2:
+    pushl %ebx
+ 476:	53                   	push   %ebx
+    pushl %esi
+ 477:	56                   	push   %esi
+    pushl %edi
+ 478:	57                   	push   %edi
+    pushl %ebp
+ 479:	55                   	push   %ebp
+    movl 20(%esp), %ebx
+ 47a:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+    movl 24(%esp), %esi
+ 47e:	8b 74 24 18          	mov    0x18(%esp),%esi
+    movl 28(%esp), %edi
+ 482:	8b 7c 24 1c          	mov    0x1c(%esp),%edi
+    movl 32(%esp), %ebp
+ 486:	8b 6c 24 20          	mov    0x20(%esp),%ebp
+    movl %esp, %ecx
+ 48a:	89 e1                	mov    %esp,%ecx
+    movl $3f, %edx
+ 48c:	ba 93 04 00 00       	mov    $0x493,%edx
+    sysenter
+ 491:	0f 34                	sysenter
+3:
+    popl %ebp
+ 493:	5d                   	pop    %ebp
+    popl %edi
+ 494:	5f                   	pop    %edi
+    popl %esi
+ 495:	5e                   	pop    %esi
+    popl %ebx
+ 496:	5b                   	pop    %ebx
+    ret
+ 497:	c3                   	ret
+
+00000498 <sepcheck>:
+
+# Set sysmode from cpuid's SEP flag.    Preserves %eax.
+sepcheck:
+    pushl %eax
+ 498:	50                   	push   %eax
+    pushl %ebx
+ 499:	53                   	push   %ebx
+    movl $1, %eax
+ 49a:	b8 01 00 00 00       	mov    $0x1,%eax
+    cpuid
+ 49f:	0f a2                	cpuid
+    movl $-1, sysmode
+ 4a1:	c7 05 44 0e 00 00 ff 	movl   $0xffffffff,0xe44
+ 4a8:	ff ff ff 
+    testl $0x800, %edx
+ 4ab:	f7 c2 00 08 00 00    	test   $0x800,%edx
+    jz 1f
+ 4b1:	74 0a                	je     4bd <sepcheck+0x25>
+    movl $1, sysmode
+ 4b3:	c7 05 44 0e 00 00 01 	movl   $0x1,0xe44
+ 4ba:	00 00 00 
+1:
+    popl %ebx
+ 4bd:	5b                   	pop    %ebx
+    popl %eax
+ 4be:	58                   	pop    %eax
+    ret
+ 4bf:	c3                   	ret
+
+000004c0 <fork>:
+
+SYSCALL(fork)
+ 4c0:	b8 01 00 00 00       	mov    $0x1,%eax
+ 4c5:	eb 9a                	jmp    461 <dosyscall>
+
+000004c7 <exit>:
+SYSCALL(exit)
+ 4c7:	b8 02 00 00 00       	mov    $0x2,%eax
+ 4cc:	eb 93                	jmp    461 <dosyscall>
+
+000004ce <wait>:
+SYSCALL(wait)
+ 4ce:	b8 03 00 00 00       	mov    $0x3,%eax
+ 4d3:	eb 8c                	jmp    461 <dosyscall>
+
+000004d5 <pipe>:
+SYSCALL(pipe)
+ 4d5:	b8 04 00 00 00       	mov    $0x4,%eax
+ 4da:	eb 85                	jmp    461 <dosyscall>
+
+000004dc <read>:
+SYSCALL(read)
+ 4dc:	b8 05 00 00 00       	mov    $0x5,%eax
+ 4e1:	e9 7b ff ff ff       	jmp    461 <dosyscall>
+
+000004e6 <write>:
+SYSCALL(write)
+ 4e6:	b8 10 00 00 00       	mov    $0x10,%eax
+ 4eb:	e9 71 ff ff ff       	jmp    461 <dosyscall>
+
+000004f0 <close>:
+SYSCALL(close)
+ 4f0:	b8 15 00 00 00       	mov    $0x15,%eax
+ 4f5:	e9 67 ff ff ff       	jmp    461 <dosyscall>
+
+000004fa <kill>:
+SYSCALL(kill)
+ 4fa:	b8 06 00 00 00       	mov    $0x6,%eax
+ 4ff:	e9 5d ff ff ff       	jmp    461 <dosyscall>
+
+00000504 <exec>:
+SYSCALL(exec)
+ 504:	b8 07 00 00 00       	mov    $0x7,%eax
+ 509:	e9 53 ff ff ff       	jmp    461 <dosyscall>
+
+0000050e <open>:
+SYSCALL(open)
+ 50e:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 513:	e9 49 ff ff ff       	jmp    461 <dosyscall>
+
+00000518 <mknod>:
+SYSCALL(mknod)
+ 518:	b8 11 00 00 00       	mov    $0x11,%eax
+ 51d:	e9 3f ff ff ff       	jmp    461 <dosyscall>
+
+00000522 <unlink>:
+SYSCALL(unlink)
+ 522:	b8 12 00 00 00       	mov    $0x12,%eax
+ 527:	e9 35 ff ff ff       	jmp    461 <dosyscall>
+
+0000052c <fstat>:
+SYSCALL(fstat)
+ 52c:	b8 08 00 00 00       	mov    $0x8,%eax
+ 531:	e9 2b ff ff ff       	jmp    461 <dosyscall>
+
+00000536 <link>:
+SYSCALL(link)
+ 536:	b8 13 00 00 00       	mov    $0x13,%eax
+ 53b:	e9 21 ff ff ff       	jmp    461 <dosyscall>
+
+00000540 <mkdir>:
+SYSCALL(mkdir)
+ 540:	b8 14 00 00 00       	mov    $0x14,%eax
+ 545:	e9 17 ff ff ff       	jmp    461 <dosyscall>
+
+0000054a <chdir>:
+SYSCALL(chdir)
+ 54a:	b8 09 00 00 00       	mov    $0x9,%eax
+ 54f:	e9 0d ff ff ff       	jmp    461 <dosyscall>
+
+00000554 <dup>:
+SYSCALL(dup)
+ 554:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 559:	e9 03 ff ff ff       	jmp    461 <dosyscall>
+
+0000055e <getpid>:
+SYSCALL(getpid)
+ 55e:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 563:	e9 f9 fe ff ff       	jmp    461 <dosyscall>
+
+00000568 <sbrk>:
+SYSCALL(sbrk)
+ 568:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 56d:	e9 ef fe ff ff       	jmp    461 <dosyscall>
+
+00000572 <sleep>:
+SYSCALL(sleep)
+ 572:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 577:	e9 e5 fe ff ff       	jmp    461 <dosyscall>
+
+0000057c <uptime>:
+SYSCALL(uptime)
+ 57c:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 581:	e9 db fe ff ff       	jmp    461 <dosyscall>
+
+00000586 <date>:
+SYSCALL(date)
+ 586:	b8 16 00 00 00       	mov    $0x16,%eax
+ 58b:	e9 d1 fe ff ff       	jmp    461 <dosyscall>
+
+00000590 <dup2>:
+SYSCALL(dup2)
+ 590:	b8 17 00 00 00       	mov    $0x17,%eax
+ 595:	e9 c7 fe ff ff       	jmp    461 <dosyscall>
+
+0000059a <uffd>:
+SYSCALL(uffd)
+ 59a:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 59f:	e9 bd fe ff ff       	jmp    461 <dosyscall>
+
+000005a4 <uffdregister>:
+SYSCALL(uffdregister)
+ 5a4:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 5a9:	e9 b3 fe ff ff       	jmp    461 <dosyscall>
+
+000005ae <uffdcopy>:
+SYSCALL(uffdcopy)
+ 5ae:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 5b3:	e9 a9 fe ff ff       	jmp    461 <dosyscall>
+
+000005b8 <getpriority>:
+SYSCALL(getpriority)
+ 5b8:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 5bd:	e9 9f fe ff ff       	jmp    461 <dosyscall>
+
+000005c2 <setpriority>:
+SYSCALL(setpriority)
+ 5c2:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 5c7:	e9 95 fe ff ff       	jmp    461 <dosyscall>
+
+000005cc <setweight>:
+SYSCALL(setweight)
+ 5cc:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 5d1:	e9 8b fe ff ff       	jmp    461 <dosyscall>
+
+000005d6 <setgroup>:
+SYSCALL(setgroup)
+ 5d6:	b8 20 00 00 00       	mov    $0x20,%eax
+ 5db:	e9 81 fe ff ff       	jmp    461 <dosyscall>
+
+000005e0 <schedinfo>:
+SYSCALL(schedinfo)
+ 5e0:	b8 21 00 00 00       	mov    $0x21,%eax
+ 5e5:	e9 77 fe ff ff       	jmp    461 <dosyscall>
+
+000005ea <nanosleep>:
+SYSCALL(nanosleep)
+ 5ea:	b8 22 00 00 00       	mov    $0x22,%eax
+ 5ef:	e9 6d fe ff ff       	jmp    461 <dosyscall>
+
+000005f4 <clock_nanosleep>:
+SYSCALL(clock_nanosleep)
+ 5f4:	b8 23 00 00 00       	mov    $0x23,%eax
+ 5f9:	e9 63 fe ff ff       	jmp    461 <dosyscall>
+
+000005fe <clock_gettime>:
+SYSCALL(clock_gettime)
+ 5fe:	b8 24 00 00 00       	mov    $0x24,%eax
+ 603:	e9 59 fe ff ff       	jmp    461 <dosyscall>
+
+00000608 <sched_setaffinity>:
+SYSCALL(sched_setaffinity)
+ 608:	b8 25 00 00 00       	mov    $0x25,%eax
+ 60d:	e9 4f fe ff ff       	jmp    461 <dosyscall>
+
+00000612 <sched_getaffinity>:
+SYSCALL(sched_getaffinity)
+ 612:	b8 26 00 00 00       	mov    $0x26,%eax
+ 617:	e9 45 fe ff ff       	jmp    461 <dosyscall>
+
+0000061c <irqaffinity>:
+SYSCALL(irqaffinity)
+ 61c:	b8 27 00 00 00       	mov    $0x27,%eax
+ 621:	e9 3b fe ff ff       	jmp    461 <dosyscall>
+
+00000626 <getrusage>:
+SYSCALL(getrusage)
+ 626:	b8 28 00 00 00       	mov    $0x28,%eax
+ 62b:	e9 31 fe ff ff       	jmp    461 <dosyscall>
+
+00000630 <times>:
+SYSCALL(times)
+ 630:	b8 29 00 00 00       	mov    $0x29,%eax
+ 635:	e9 27 fe ff ff       	jmp    461 <dosyscall>
+
+0000063a <schedlat>:
+SYSCALL(schedlat)
+ 63a:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 63f:	e9 1d fe ff ff       	jmp    461 <dosyscall>
+
+00000644 <sched_setscheduler>:
+SYSCALL(sched_setscheduler)
+ 644:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 649:	e9 13 fe ff ff       	jmp    461 <dosyscall>
+
+0000064e <sched_getscheduler>:
+SYSCALL(sched_getscheduler)
+ 64e:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 653:	e9 09 fe ff ff       	jmp    461 <dosyscall>
+
+00000658 <sched_getparam>:
+SYSCALL(sched_getparam)
+ 658:	b8 2d 00 00 00       	mov    $0x2d,%eax
+ 65d:	e9 ff fd ff ff       	jmp    461 <dosyscall>
+
+00000662 <lockstat>:
+SYSCALL(lockstat)
+ 662:	b8 2e 00 00 00       	mov    $0x2e,%eax
+ 667:	e9 f5 fd ff ff       	jmp    461 <dosyscall>
+
+0000066c <ioring_setup>:
+SYSCALL(ioring_setup)
+ 66c:	b8 2f 00 00 00       	mov    $0x2f,%eax
+ 671:	e9 eb fd ff ff       	jmp    461 <dosyscall>
+
+00000676 <ioring_enter>:
+SYSCALL(ioring_enter)
+ 676:	b8 30 00 00 00       	mov    $0x30,%eax
+ 67b:	e9 e1 fd ff ff       	jmp    461 <dosyscall>
+
+00000680 <readv>:
+SYSCALL(readv)
+ 680:	b8 31 00 00 00       	mov    $0x31,%eax
+ 685:	e9 d7 fd ff ff       	jmp    461 <dosyscall>
+
+0000068a <writev>:
+SYSCALL(writev)
+ 68a:	b8 32 00 00 00       	mov    $0x32,%eax
+ 68f:	e9 cd fd ff ff       	jmp    461 <dosyscall>
+
+00000694 <pread>:
+SYSCALL(pread)
+ 694:	b8 33 00 00 00       	mov    $0x33,%eax
+ 699:	e9 c3 fd ff ff       	jmp    461 <dosyscall>
+
+0000069e <pwrite>:
+SYSCALL(pwrite)
+ 69e:	b8 34 00 00 00       	mov    $0x34,%eax
+ 6a3:	e9 b9 fd ff ff       	jmp    461 <dosyscall>
+
+000006a8 <sendfile>:
+SYSCALL(sendfile)
+ 6a8:	b8 35 00 00 00       	mov    $0x35,%eax
+ 6ad:	e9 af fd ff ff       	jmp    461 <dosyscall>
+
+000006b2 <splice>:
+SYSCALL(splice)
+ 6b2:	b8 36 00 00 00       	mov    $0x36,%eax
+ 6b7:	e9 a5 fd ff ff       	jmp    461 <dosyscall>
+
+000006bc <sysstat>:
+SYSCALL(sysstat)
+ 6bc:	b8 37 00 00 00       	mov    $0x37,%eax
+ 6c1:	e9 9b fd ff ff       	jmp    461 <dosyscall>
+
+000006c6 <strace>:
+SYSCALL(strace)
+ 6c6:	b8 38 00 00 00       	mov    $0x38,%eax
+ 6cb:	e9 91 fd ff ff       	jmp    461 <dosyscall>
+
+000006d0 <straceread>:
+SYSCALL(straceread)
+ 6d0:	b8 39 00 00 00       	mov    $0x39,%eax
+ 6d5:	e9 87 fd ff ff       	jmp    461 <dosyscall>
+
+000006da <alarm>:
+
+# alarm and rstoregs keep to int $T_SYSCALL: rstoregs restores
+# %ecx and %edx, which sysexit would clobber.
+.globl alarm
+    alarm:
+        pushl $rstoregs
+ 6da:	68 ea 06 00 00       	push   $0x6ea
+        movl $SYS_alarm, %eax
+ 6df:	b8 18 00 00 00       	mov    $0x18,%eax
+        int $T_SYSCALL
+ 6e4:	cd 40                	int    $0x40
+        add $0x04, %esp
+ 6e6:	83 c4 04             	add    $0x4,%esp
+        ret
+ 6e9:	c3                   	ret
+
+000006ea <rstoregs>:
+
+.globl rstoregs
+    rstoregs:
+        movl $SYS_rstoregs, %eax
+ 6ea:	b8 19 00 00 00       	mov    $0x19,%eax
+        int $T_SYSCALL
+ 6ef:	cd 40                	int    $0x40
+
+000006f1 <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 6f1:	55                   	push   %ebp
+ 6f2:	89 e5                	mov    %esp,%ebp
+ 6f4:	83 ec 18             	sub    $0x18,%esp
+ 6f7:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 6fa:	88 45 f4             	mov    %al,-0xc(%ebp)
+    write(fd, &c, 1);
+ 6fd:	83 ec 04             	sub    $0x4,%esp
+ 700:	6a 01                	push   $0x1
+ 702:	8d 45 f4             	lea    -0xc(%ebp),%eax
+ 705:	50                   	push   %eax
+ 706:	ff 75 08             	push   0x8(%ebp)
+ 709:	e8 d8 fd ff ff       	call   4e6 <write>
+ 70e:	83 c4 10             	add    $0x10,%esp
+}
+ 711:	90                   	nop
+ 712:	c9                   	leave
+ 713:	c3                   	ret
+
+00000714 <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 714:	55                   	push   %ebp
+ 715:	89 e5                	mov    %esp,%ebp
+ 717:	83 ec 28             	sub    $0x28,%esp
+    static char digits[] = "0123456789ABCDEF";
+    char buf[16];
+    int i, neg;
+    uint x;
+
+    neg = 0;
+ 71a:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+    if(sgn && xx < 0){
+ 721:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+ 725:	74 17                	je     73e <printint+0x2a>
+ 727:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 72b:	79 11                	jns    73e <printint+0x2a>
+        neg = 1;
+ 72d:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+        x = -xx;
+ 734:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 737:	f7 d8                	neg    %eax
+ 739:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 73c:	eb 06                	jmp    744 <printint+0x30>
+    } else {
+        x = xx;
+ 73e:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 741:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    }
+
+    i = 0;
+ 744:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    do{
+        buf[i++] = digits[x % base];
+ 74b:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 74e:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 751:	ba 00 00 00 00       	mov    $0x0,%edx
+ 756:	f7 f1                	div    %ecx
+ 758:	89 d1                	mov    %edx,%ecx
+ 75a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 75d:	8d 50 01             	lea    0x1(%eax),%edx
+ 760:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 763:	0f b6 91 48 0e 00 00 	movzbl 0xe48(%ecx),%edx
+ 76a:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+    }while((x /= base) != 0);
+ 76e:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 771:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 774:	ba 00 00 00 00       	mov    $0x0,%edx
+ 779:	f7 f1                	div    %ecx
+ 77b:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 77e:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 782:	75 c7                	jne    74b <printint+0x37>
+    if(neg)
+ 784:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 788:	74 2d                	je     7b7 <printint+0xa3>
+        buf[i++] = '-';
+ 78a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 78d:	8d 50 01             	lea    0x1(%eax),%edx
+ 790:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 793:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+    while(--i >= 0)
+ 798:	eb 1d                	jmp    7b7 <printint+0xa3>
+        putc(fd, buf[i]);
+ 79a:	8d 55 dc             	lea    -0x24(%ebp),%edx
+ 79d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 7a0:	01 d0                	add    %edx,%eax
+ 7a2:	0f b6 00             	movzbl (%eax),%eax
+ 7a5:	0f be c0             	movsbl %al,%eax
+ 7a8:	83 ec 08             	sub    $0x8,%esp
+ 7ab:	50                   	push   %eax
+ 7ac:	ff 75 08             	push   0x8(%ebp)
+ 7af:	e8 3d ff ff ff       	call   6f1 <putc>
+ 7b4:	83 c4 10             	add    $0x10,%esp
+    while(--i >= 0)
+ 7b7:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+ 7bb:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 7bf:	79 d9                	jns    79a <printint+0x86>
+}
+ 7c1:	90                   	nop
+ 7c2:	90                   	nop
+ 7c3:	c9                   	leave
+ 7c4:	c3                   	ret
+
+000007c5 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 7c5:	55                   	push   %ebp
+ 7c6:	89 e5                	mov    %esp,%ebp
+ 7c8:	83 ec 28             	sub    $0x28,%esp
+    char *s;
+    int c, i, state;
+    uint *ap;
+
+    state = 0;
+ 7cb:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+    ap = (uint*)(void*)&fmt + 1;
+ 7d2:	8d 45 0c             	lea    0xc(%ebp),%eax
+ 7d5:	83 c0 04             	add    $0x4,%eax
+ 7d8:	89 45 e8             	mov    %eax,-0x18(%ebp)
+    for(i = 0; fmt[i]; i++){
+ 7db:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 7e2:	e9 59 01 00 00       	jmp    940 <printf+0x17b>
+        c = fmt[i] & 0xff;
+ 7e7:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 7ea:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 7ed:	01 d0                	add    %edx,%eax
+ 7ef:	0f b6 00             	movzbl (%eax),%eax
+ 7f2:	0f be c0             	movsbl %al,%eax
+ 7f5:	25 ff 00 00 00       	and    $0xff,%eax
+ 7fa:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        if(state == 0){
+ 7fd:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 801:	75 2c                	jne    82f <printf+0x6a>
+            if(c == '%'){
+ 803:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 807:	75 0c                	jne    815 <printf+0x50>
+                state = '%';
+ 809:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+ 810:	e9 27 01 00 00       	jmp    93c <printf+0x177>
+            } else {
+                putc(fd, c);
+ 815:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 818:	0f be c0             	movsbl %al,%eax
+ 81b:	83 ec 08             	sub    $0x8,%esp
+ 81e:	50                   	push   %eax
+ 81f:	ff 75 08             	push   0x8(%ebp)
+ 822:	e8 ca fe ff ff       	call   6f1 <putc>
+ 827:	83 c4 10             	add    $0x10,%esp
+ 82a:	e9 0d 01 00 00       	jmp    93c <printf+0x177>
+            }
+        } else if(state == '%'){
+ 82f:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+ 833:	0f 85 03 01 00 00    	jne    93c <printf+0x177>
+            if(c == 'd'){
+ 839:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+ 83d:	75 1e                	jne    85d <printf+0x98>
+                printint(fd, *ap, 10, 1);
+ 83f:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 842:	8b 00                	mov    (%eax),%eax
+ 844:	6a 01                	push   $0x1
+ 846:	6a 0a                	push   $0xa
+ 848:	50                   	push   %eax
+ 849:	ff 75 08             	push   0x8(%ebp)
+ 84c:	e8 c3 fe ff ff       	call   714 <printint>
+ 851:	83 c4 10             	add    $0x10,%esp
+                ap++;
+ 854:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 858:	e9 d8 00 00 00       	jmp    935 <printf+0x170>
+            } else if(c == 'x' || c == 'p'){
+ 85d:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+ 861:	74 06                	je     869 <printf+0xa4>
+ 863:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+ 867:	75 1e                	jne    887 <printf+0xc2>
+                printint(fd, *ap, 16, 0);
+ 869:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 86c:	8b 00                	mov    (%eax),%eax
+ 86e:	6a 00                	push   $0x0
+ 870:	6a 10                	push   $0x10
+ 872:	50                   	push   %eax
+ 873:	ff 75 08             	push   0x8(%ebp)
+ 876:	e8 99 fe ff ff       	call   714 <printint>
+ 87b:	83 c4 10             	add    $0x10,%esp
+                ap++;
+ 87e:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 882:	e9 ae 00 00 00       	jmp    935 <printf+0x170>
+            } else if(c == 's'){
+ 887:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+ 88b:	75 43                	jne    8d0 <printf+0x10b>
+                s = (char*)*ap;
+ 88d:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 890:	8b 00                	mov    (%eax),%eax
+ 892:	89 45 f4             	mov    %eax,-0xc(%ebp)
+                ap++;
+ 895:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+                if(s == 0)
+ 899:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 89d:	75 25                	jne    8c4 <printf+0xff>
+                    s = "(null)";
+ 89f:	c7 45 f4 b4 0b 00 00 	movl   $0xbb4,-0xc(%ebp)
+                while(*s != 0){
+ 8a6:	eb 1c                	jmp    8c4 <printf+0xff>
+                    putc(fd, *s);
+ 8a8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 8ab:	0f b6 00             	movzbl (%eax),%eax
+ 8ae:	0f be c0             	movsbl %al,%eax
+ 8b1:	83 ec 08             	sub    $0x8,%esp
+ 8b4:	50                   	push   %eax
+ 8b5:	ff 75 08             	push   0x8(%ebp)
+ 8b8:	e8 34 fe ff ff       	call   6f1 <putc>
+ 8bd:	83 c4 10             	add    $0x10,%esp
+                    s++;
+ 8c0:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+                while(*s != 0){
+ 8c4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 8c7:	0f b6 00             	movzbl (%eax),%eax
+ 8ca:	84 c0                	test   %al,%al
+ 8cc:	75 da                	jne    8a8 <printf+0xe3>
+ 8ce:	eb 65                	jmp    935 <printf+0x170>
+                }
+            } else if(c == 'c'){
+ 8d0:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+ 8d4:	75 1d                	jne    8f3 <printf+0x12e>
+                putc(fd, *ap);
+ 8d6:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 8d9:	8b 00                	mov    (%eax),%eax
+ 8db:	0f be c0             	movsbl %al,%eax
+ 8de:	83 ec 08             	sub    $0x8,%esp
+ 8e1:	50                   	push   %eax
+ 8e2:	ff 75 08             	push   0x8(%ebp)
+ 8e5:	e8 07 fe ff ff       	call   6f1 <putc>
+ 8ea:	83 c4 10             	add    $0x10,%esp
+                ap++;
+ 8ed:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 8f1:	eb 42                	jmp    935 <printf+0x170>
+            } else if(c == '%'){
+ 8f3:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 8f7:	75 17                	jne    910 <printf+0x14b>
+                putc(fd, c);
+ 8f9:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 8fc:	0f be c0             	movsbl %al,%eax
+ 8ff:	83 ec 08             	sub    $0x8,%esp
+ 902:	50                   	push   %eax
+ 903:	ff 75 08             	push   0x8(%ebp)
+ 906:	e8 e6 fd ff ff       	call   6f1 <putc>
+ 90b:	83 c4 10             	add    $0x10,%esp
+ 90e:	eb 25                	jmp    935 <printf+0x170>
+            } else {
+                // Unknown % sequence.    Print it to draw attention.
+                putc(fd, '%');
+ 910:	83 ec 08             	sub    $0x8,%esp
+ 913:	6a 25                	push   $0x25
+ 915:	ff 75 08             	push   0x8(%ebp)
+ 918:	e8 d4 fd ff ff       	call   6f1 <putc>
+ 91d:	83 c4 10             	add    $0x10,%esp
+                putc(fd, c);
+ 920:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 923:	0f be c0             	movsbl %al,%eax
+ 926:	83 ec 08             	sub    $0x8,%esp
+ 929:	50                   	push   %eax
+ 92a:	ff 75 08             	push   0x8(%ebp)
+ 92d:	e8 bf fd ff ff       	call   6f1 <putc>
+ 932:	83 c4 10             	add    $0x10,%esp
+            }
+            state = 0;
+ 935:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+    for(i = 0; fmt[i]; i++){
+ 93c:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ 940:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 943:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 946:	01 d0                	add    %edx,%eax
+ 948:	0f b6 00             	movzbl (%eax),%eax
+ 94b:	84 c0                	test   %al,%al
+ 94d:	0f 85 94 fe ff ff    	jne    7e7 <printf+0x22>
+        }
+    }
+}
+ 953:	90                   	nop
+ 954:	90                   	nop
+ 955:	c9                   	leave
+ 956:	c3                   	ret
+
+00000957 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 957:	55                   	push   %ebp
+ 958:	89 e5                	mov    %esp,%ebp
+ 95a:	83 ec 10             	sub    $0x10,%esp
+    Header *bp, *p;
+
+    bp = (Header*)ap - 1;
+ 95d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 960:	83 e8 08             	sub    $0x8,%eax
+ 963:	89 45 f8             	mov    %eax,-0x8(%ebp)
+    for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 966:	a1 68 10 00 00       	mov    0x1068,%eax
+ 96b:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 96e:	eb 24                	jmp    994 <free+0x3d>
+        if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 970:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 973:	8b 00                	mov    (%eax),%eax
+ 975:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 978:	72 12                	jb     98c <free+0x35>
+ 97a:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 97d:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 980:	72 24                	jb     9a6 <free+0x4f>
+ 982:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 985:	8b 00                	mov    (%eax),%eax
+ 987:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 98a:	72 1a                	jb     9a6 <free+0x4f>
+    for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 98c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 98f:	8b 00                	mov    (%eax),%eax
+ 991:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 994:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 997:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 99a:	73 d4                	jae    970 <free+0x19>
+ 99c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 99f:	8b 00                	mov    (%eax),%eax
+ 9a1:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 9a4:	73 ca                	jae    970 <free+0x19>
+            break;
+    if(bp + bp->s.size == p->s.ptr){
+ 9a6:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 9a9:	8b 40 04             	mov    0x4(%eax),%eax
+ 9ac:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 9b3:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 9b6:	01 c2                	add    %eax,%edx
+ 9b8:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 9bb:	8b 00                	mov    (%eax),%eax
+ 9bd:	39 c2                	cmp    %eax,%edx
+ 9bf:	75 24                	jne    9e5 <free+0x8e>
+        bp->s.size += p->s.ptr->s.size;
+ 9c1:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 9c4:	8b 50 04             	mov    0x4(%eax),%edx
+ 9c7:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 9ca:	8b 00                	mov    (%eax),%eax
+ 9cc:	8b 40 04             	mov    0x4(%eax),%eax
+ 9cf:	01 c2                	add    %eax,%edx
+ 9d1:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 9d4:	89 50 04             	mov    %edx,0x4(%eax)
+        bp->s.ptr = p->s.ptr->s.ptr;
+ 9d7:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 9da:	8b 00                	mov    (%eax),%eax
+ 9dc:	8b 10                	mov    (%eax),%edx
+ 9de:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 9e1:	89 10                	mov    %edx,(%eax)
+ 9e3:	eb 0a                	jmp    9ef <free+0x98>
+    } else
+        bp->s.ptr = p->s.ptr;
+ 9e5:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 9e8:	8b 10                	mov    (%eax),%edx
+ 9ea:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 9ed:	89 10                	mov    %edx,(%eax)
+    if(p + p->s.size == bp){
+ 9ef:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 9f2:	8b 40 04             	mov    0x4(%eax),%eax
+ 9f5:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 9fc:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 9ff:	01 d0                	add    %edx,%eax
+ a01:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ a04:	75 20                	jne    a26 <free+0xcf>
+        p->s.size += bp->s.size;
+ a06:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a09:	8b 50 04             	mov    0x4(%eax),%edx
+ a0c:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ a0f:	8b 40 04             	mov    0x4(%eax),%eax
+ a12:	01 c2                	add    %eax,%edx
+ a14:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a17:	89 50 04             	mov    %edx,0x4(%eax)
+        p->s.ptr = bp->s.ptr;
+ a1a:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ a1d:	8b 10                	mov    (%eax),%edx
+ a1f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a22:	89 10                	mov    %edx,(%eax)
+ a24:	eb 08                	jmp    a2e <free+0xd7>
+    } else
+        p->s.ptr = bp;
+ a26:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a29:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ a2c:	89 10                	mov    %edx,(%eax)
+    freep = p;
+ a2e:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a31:	a3 68 10 00 00       	mov    %eax,0x1068
+}
+ a36:	90                   	nop
+ a37:	c9                   	leave
+ a38:	c3                   	ret
+
+00000a39 <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+ a39:	55                   	push   %ebp
+ a3a:	89 e5                	mov    %esp,%ebp
+ a3c:	83 ec 18             	sub    $0x18,%esp
+    char *p;
+    Header *hp;
+
+    if(nu < 4096)
+ a3f:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+ a46:	77 07                	ja     a4f <morecore+0x16>
+        nu = 4096;
+ a48:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+    p = sbrk(nu * sizeof(Header));
+ a4f:	8b 45 08             	mov    0x8(%ebp),%eax
+ a52:	c1 e0 03             	shl    $0x3,%eax
+ a55:	83 ec 0c             	sub    $0xc,%esp
+ a58:	50                   	push   %eax
+ a59:	e8 0a fb ff ff       	call   568 <sbrk>
+ a5e:	83 c4 10             	add    $0x10,%esp
+ a61:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p == (char*)-1)
+ a64:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+ a68:	75 07                	jne    a71 <morecore+0x38>
+        return 0;
+ a6a:	b8 00 00 00 00       	mov    $0x0,%eax
+ a6f:	eb 26                	jmp    a97 <morecore+0x5e>
+    hp = (Header*)p;
+ a71:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a74:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    hp->s.size = nu;
+ a77:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ a7a:	8b 55 08             	mov    0x8(%ebp),%edx
+ a7d:	89 50 04             	mov    %edx,0x4(%eax)
+    free((void*)(hp + 1));
+ a80:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ a83:	83 c0 08             	add    $0x8,%eax
+ a86:	83 ec 0c             	sub    $0xc,%esp
+ a89:	50                   	push   %eax
+ a8a:	e8 c8 fe ff ff       	call   957 <free>
+ a8f:	83 c4 10             	add    $0x10,%esp
+    return freep;
+ a92:	a1 68 10 00 00       	mov    0x1068,%eax
+}
+ a97:	c9                   	leave
+ a98:	c3                   	ret
+
+00000a99 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ a99:	55                   	push   %ebp
+ a9a:	89 e5                	mov    %esp,%ebp
+ a9c:	83 ec 18             	sub    $0x18,%esp
+    Header *p, *prevp;
+    uint nunits;
+
+    nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ a9f:	8b 45 08             	mov    0x8(%ebp),%eax
+ aa2:	83 c0 07             	add    $0x7,%eax
+ aa5:	c1 e8 03             	shr    $0x3,%eax
+ aa8:	83 c0 01             	add    $0x1,%eax
+ aab:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    if((prevp = freep) == 0){
+ aae:	a1 68 10 00 00       	mov    0x1068,%eax
+ ab3:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ ab6:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ aba:	75 23                	jne    adf <malloc+0x46>
+        base.s.ptr = freep = prevp = &base;
+ abc:	c7 45 f0 60 10 00 00 	movl   $0x1060,-0x10(%ebp)
+ ac3:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ ac6:	a3 68 10 00 00       	mov    %eax,0x1068
+ acb:	a1 68 10 00 00       	mov    0x1068,%eax
+ ad0:	a3 60 10 00 00       	mov    %eax,0x1060
+        base.s.size = 0;
+ ad5:	c7 05 64 10 00 00 00 	movl   $0x0,0x1064
+ adc:	00 00 00 
+    }
+    for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ adf:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ ae2:	8b 00                	mov    (%eax),%eax
+ ae4:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        if(p->s.size >= nunits){
+ ae7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ aea:	8b 40 04             	mov    0x4(%eax),%eax
+ aed:	3b 45 ec             	cmp    -0x14(%ebp),%eax
+ af0:	72 4d                	jb     b3f <malloc+0xa6>
+            if(p->s.size == nunits)
+ af2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ af5:	8b 40 04             	mov    0x4(%eax),%eax
+ af8:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+ afb:	75 0c                	jne    b09 <malloc+0x70>
+                prevp->s.ptr = p->s.ptr;
+ afd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b00:	8b 10                	mov    (%eax),%edx
+ b02:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ b05:	89 10                	mov    %edx,(%eax)
+ b07:	eb 26                	jmp    b2f <malloc+0x96>
+            else {
+                p->s.size -= nunits;
+ b09:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b0c:	8b 40 04             	mov    0x4(%eax),%eax
+ b0f:	2b 45 ec             	sub    -0x14(%ebp),%eax
+ b12:	89 c2                	mov    %eax,%edx
+ b14:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b17:	89 50 04             	mov    %edx,0x4(%eax)
+                p += p->s.size;
+ b1a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b1d:	8b 40 04             	mov    0x4(%eax),%eax
+ b20:	c1 e0 03             	shl    $0x3,%eax
+ b23:	01 45 f4             	add    %eax,-0xc(%ebp)
+                p->s.size = nunits;
+ b26:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b29:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ b2c:	89 50 04             	mov    %edx,0x4(%eax)
+            }
+            freep = prevp;
+ b2f:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ b32:	a3 68 10 00 00       	mov    %eax,0x1068
+            return (void*)(p + 1);
+ b37:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b3a:	83 c0 08             	add    $0x8,%eax
+ b3d:	eb 3b                	jmp    b7a <malloc+0xe1>
+        }
+        if(p == freep)
+ b3f:	a1 68 10 00 00       	mov    0x1068,%eax
+ b44:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ b47:	75 1e                	jne    b67 <malloc+0xce>
+            if((p = morecore(nunits)) == 0)
+ b49:	83 ec 0c             	sub    $0xc,%esp
+ b4c:	ff 75 ec             	push   -0x14(%ebp)
+ b4f:	e8 e5 fe ff ff       	call   a39 <morecore>
+ b54:	83 c4 10             	add    $0x10,%esp
+ b57:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ b5a:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ b5e:	75 07                	jne    b67 <malloc+0xce>
+                return 0;
+ b60:	b8 00 00 00 00       	mov    $0x0,%eax
+ b65:	eb 13                	jmp    b7a <malloc+0xe1>
+    for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ b67:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b6a:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ b6d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b70:	8b 00                	mov    (%eax),%eax
+ b72:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        if(p->s.size >= nunits){
+ b75:	e9 6d ff ff ff       	jmp    ae7 <malloc+0x4e>
+    }
+}
+ b7a:	c9                   	leave
+ b7b:	c3                   	ret
@@ -123,6 +123,14 @@ sti(void)
     asm volatile("sti");
 }
 
+// Enable interrupts and halt until one arrives.    sti takes effect
+// after the next instruction, so none can slip in before the hlt.
+static inline void
+stihlt(void)
+{
+    asm volatile("sti; hlt");
+}
+
 static inline uint
 xchg(volatile uint *addr, uint newval)
 {
@@ -136,6 +144,37 @@ xchg(volatile uint *addr, uint newval)
     return result;
 }
 
+// Atomically add v to *addr and return the old value.
+static inline uint
+xadd(volatile uint *addr, uint v)
+{
+    asm volatile("lock; xaddl %0, %1" :
+                             "+r" (v), "+m" (*addr) :
+                             :
+                             "cc");
+    return v;
+}
+
+// If *addr is old, set it to new.    Return what *addr was.
+static inline uint
+cmpxchg(volatile uint *addr, uint old, uint new)
+{
+    uint prev;
+
+    asm volatile("lock; cmpxchgl %2, %1" :
+                             "=a" (prev), "+m" (*addr) :
+                             "r" (new), "0" (old) :
+                             "cc");
+    return prev;
+}
+
+// Tell the cpu this is a spin-wait loop.
+static inline void
+pause(void)
+{
+    asm volatile("pause");
+}
+
 static inline uint
 rcr2(void)
 {
@@ -150,9 +189,62 @@ lcr3(uint val)
     asm volatile("movl %0,%%cr3" : : "r" (val));
 }
 
+static inline uint
+rcr3(void)
+{
+    uint val;
+    asm volatile("movl %%cr3,%0" : "=r" (val));
+    return val;
+}
+
+static inline uint64
+rdtsc(void)
+{
+    uint64 val;
+    asm volatile("rdtsc" : "=A" (val));
+    return val;
+}
+
+// Divide n by d with divl, a 32-bit divide at a time, since
+// there is no libgcc for 64-bit division.
+static inline uint64
+divu64(uint64 n, uint d)
+{
+    uint hi, lo, r;
+
+    hi = (uint)(n >> 32) / d;
+    r = (uint)(n >> 32) % d;
+    asm("divl %4" : "=a" (lo), "=d" (r) : "a" ((uint)n), "d" (r), "rm" (d));
+    return ((uint64)hi << 32) | lo;
+}
+
+// Index of the highest set bit of x, which must be non-zero.
+static inline uint
+bsr(uint x)
+{
+    uint i;
+
+    asm("bsrl %1, %0" : "=r" (i) : "rm" (x));
+    return i;
+}
+
+static inline void
+cpuinfo(uint leaf, uint *a, uint *b, uint *c, uint *d)
+{
+    asm volatile("cpuid" : "=a" (*a), "=b" (*b), "=c" (*c), "=d" (*d)
+                 : "a" (leaf), "c" (0));
+}
+
+static inline void
+wrmsr(uint msr, uint64 val)
+{
+    asm volatile("wrmsr" : : "c" (msr), "a" ((uint)val), "d" ((uint)(val >> 32)));
+}
+
 //PAGEBREAK: 36
 // Layout of the trap frame built on the stack by the
-// hardware and by trapasm.S, and passed to trap().
+// hardware and by trapasm.S, and passed to trap().    sysentry
+// builds the same frame for a sysenter.
 struct trapframe {
     // registers as pushed by pusha
     uint edi;
@@ -0,0 +1,1373 @@
+
+_zombie:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "stat.h"
+#include "user.h"
+
+int
+main(void)
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	51                   	push   %ecx
+   e:	83 ec 04             	sub    $0x4,%esp
+    if(fork() > 0)
+  11:	e8 19 03 00 00       	call   32f <fork>
+  16:	85 c0                	test   %eax,%eax
+  18:	7e 0d                	jle    27 <main+0x27>
+        sleep(5);    // Let child exit before parent.
+  1a:	83 ec 0c             	sub    $0xc,%esp
+  1d:	6a 05                	push   $0x5
+  1f:	e8 bd 03 00 00       	call   3e1 <sleep>
+  24:	83 c4 10             	add    $0x10,%esp
+    exit();
+  27:	e8 0a 03 00 00       	call   336 <exit>
+
+0000002c <stosb>:
+strchr(const char *s, char c)
+{
+    for(; *s; s++)
+        if(*s == c)
+            return (char*)s;
+    return 0;
+  2c:	55                   	push   %ebp
+  2d:	89 e5                	mov    %esp,%ebp
+  2f:	57                   	push   %edi
+  30:	53                   	push   %ebx
+}
+  31:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  34:	8b 55 10             	mov    0x10(%ebp),%edx
+  37:	8b 45 0c             	mov    0xc(%ebp),%eax
+  3a:	89 cb                	mov    %ecx,%ebx
+  3c:	89 df                	mov    %ebx,%edi
+  3e:	89 d1                	mov    %edx,%ecx
+  40:	fc                   	cld
+  41:	f3 aa                	rep stos %al,%es:(%edi)
+  43:	89 ca                	mov    %ecx,%edx
+  45:	89 fb                	mov    %edi,%ebx
+  47:	89 5d 08             	mov    %ebx,0x8(%ebp)
+  4a:	89 55 10             	mov    %edx,0x10(%ebp)
+
+char*
+gets(char *buf, int max)
+{
+  4d:	90                   	nop
+  4e:	5b                   	pop    %ebx
+  4f:	5f                   	pop    %edi
+  50:	5d                   	pop    %ebp
+  51:	c3                   	ret
+
+00000052 <strcpy>:
+{
+  52:	55                   	push   %ebp
+  53:	89 e5                	mov    %esp,%ebp
+  55:	83 ec 10             	sub    $0x10,%esp
+    os = s;
+  58:	8b 45 08             	mov    0x8(%ebp),%eax
+  5b:	89 45 fc             	mov    %eax,-0x4(%ebp)
+    while((*s++ = *t++) != 0)
+  5e:	90                   	nop
+  5f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  62:	8d 42 01             	lea    0x1(%edx),%eax
+  65:	89 45 0c             	mov    %eax,0xc(%ebp)
+  68:	8b 45 08             	mov    0x8(%ebp),%eax
+  6b:	8d 48 01             	lea    0x1(%eax),%ecx
+  6e:	89 4d 08             	mov    %ecx,0x8(%ebp)
+  71:	0f b6 12             	movzbl (%edx),%edx
+  74:	88 10                	mov    %dl,(%eax)
+  76:	0f b6 00             	movzbl (%eax),%eax
+  79:	84 c0                	test   %al,%al
+  7b:	75 e2                	jne    5f <strcpy+0xd>
+    return os;
+  7d:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+  80:	c9                   	leave
+  81:	c3                   	ret
+
+00000082 <strcmp>:
+{
+  82:	55                   	push   %ebp
+  83:	89 e5                	mov    %esp,%ebp
+    while(*p && *p == *q)
+  85:	eb 08                	jmp    8f <strcmp+0xd>
+        p++, q++;
+  87:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+  8b:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+    while(*p && *p == *q)
+  8f:	8b 45 08             	mov    0x8(%ebp),%eax
+  92:	0f b6 00             	movzbl (%eax),%eax
+  95:	84 c0                	test   %al,%al
+  97:	74 10                	je     a9 <strcmp+0x27>
+  99:	8b 45 08             	mov    0x8(%ebp),%eax
+  9c:	0f b6 10             	movzbl (%eax),%edx
+  9f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  a2:	0f b6 00             	movzbl (%eax),%eax
+  a5:	38 c2                	cmp    %al,%dl
+  a7:	74 de                	je     87 <strcmp+0x5>
+    return (uchar)*p - (uchar)*q;
+  a9:	8b 45 08             	mov    0x8(%ebp),%eax
+  ac:	0f b6 00             	movzbl (%eax),%eax
+  af:	0f b6 d0             	movzbl %al,%edx
+  b2:	8b 45 0c             	mov    0xc(%ebp),%eax
+  b5:	0f b6 00             	movzbl (%eax),%eax
+  b8:	0f b6 c0             	movzbl %al,%eax
+  bb:	29 c2                	sub    %eax,%edx
+  bd:	89 d0                	mov    %edx,%eax
+}
+  bf:	5d                   	pop    %ebp
+  c0:	c3                   	ret
+
+000000c1 <strlen>:
+{
+  c1:	55                   	push   %ebp
+  c2:	89 e5                	mov    %esp,%ebp
+  c4:	83 ec 10             	sub    $0x10,%esp
+    for(n = 0; s[n]; n++)
+  c7:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  ce:	eb 04                	jmp    d4 <strlen+0x13>
+  d0:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+  d4:	8b 55 fc             	mov    -0x4(%ebp),%edx
+  d7:	8b 45 08             	mov    0x8(%ebp),%eax
+  da:	01 d0                	add    %edx,%eax
+  dc:	0f b6 00             	movzbl (%eax),%eax
+  df:	84 c0                	test   %al,%al
+  e1:	75 ed                	jne    d0 <strlen+0xf>
+    return n;
+  e3:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+  e6:	c9                   	leave
+  e7:	c3                   	ret
+
+000000e8 <memset>:
+{
+  e8:	55                   	push   %ebp
+  e9:	89 e5                	mov    %esp,%ebp
+    stosb(dst, c, n);
+  eb:	8b 45 10             	mov    0x10(%ebp),%eax
+  ee:	50                   	push   %eax
+  ef:	ff 75 0c             	push   0xc(%ebp)
+  f2:	ff 75 08             	push   0x8(%ebp)
+  f5:	e8 32 ff ff ff       	call   2c <stosb>
+  fa:	83 c4 0c             	add    $0xc,%esp
+    return dst;
+  fd:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 100:	c9                   	leave
+ 101:	c3                   	ret
+
+00000102 <strchr>:
+{
+ 102:	55                   	push   %ebp
+ 103:	89 e5                	mov    %esp,%ebp
+ 105:	83 ec 04             	sub    $0x4,%esp
+ 108:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 10b:	88 45 fc             	mov    %al,-0x4(%ebp)
+    for(; *s; s++)
+ 10e:	eb 14                	jmp    124 <strchr+0x22>
+        if(*s == c)
+ 110:	8b 45 08             	mov    0x8(%ebp),%eax
+ 113:	0f b6 00             	movzbl (%eax),%eax
+ 116:	38 45 fc             	cmp    %al,-0x4(%ebp)
+ 119:	75 05                	jne    120 <strchr+0x1e>
+            return (char*)s;
+ 11b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 11e:	eb 13                	jmp    133 <strchr+0x31>
+    for(; *s; s++)
+ 120:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 124:	8b 45 08             	mov    0x8(%ebp),%eax
+ 127:	0f b6 00             	movzbl (%eax),%eax
+ 12a:	84 c0                	test   %al,%al
+ 12c:	75 e2                	jne    110 <strchr+0xe>
+    return 0;
+ 12e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 133:	c9                   	leave
+ 134:	c3                   	ret
+
+00000135 <gets>:
+{
+ 135:	55                   	push   %ebp
+ 136:	89 e5                	mov    %esp,%ebp
+ 138:	83 ec 18             	sub    $0x18,%esp
+    int i, cc;
+    char c;
+
+    for(i=0; i+1 < max; ){
+ 13b:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 142:	eb 42                	jmp    186 <gets+0x51>
+        cc = read(0, &c, 1);
+ 144:	83 ec 04             	sub    $0x4,%esp
+ 147:	6a 01                	push   $0x1
+ 149:	8d 45 ef             	lea    -0x11(%ebp),%eax
+ 14c:	50                   	push   %eax
+ 14d:	6a 00                	push   $0x0
+ 14f:	e8 f7 01 00 00       	call   34b <read>
+ 154:	83 c4 10             	add    $0x10,%esp
+ 157:	89 45 f0             	mov    %eax,-0x10(%ebp)
+        if(cc < 1)
+ 15a:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 15e:	7e 33                	jle    193 <gets+0x5e>
+            break;
+        buf[i++] = c;
+ 160:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 163:	8d 50 01             	lea    0x1(%eax),%edx
+ 166:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 169:	89 c2                	mov    %eax,%edx
+ 16b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 16e:	01 c2                	add    %eax,%edx
+ 170:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 174:	88 02                	mov    %al,(%edx)
+        if(c == '\n' || c == '\r')
+ 176:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 17a:	3c 0a                	cmp    $0xa,%al
+ 17c:	74 16                	je     194 <gets+0x5f>
+ 17e:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 182:	3c 0d                	cmp    $0xd,%al
+ 184:	74 0e                	je     194 <gets+0x5f>
+    for(i=0; i+1 < max; ){
+ 186:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 189:	83 c0 01             	add    $0x1,%eax
+ 18c:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 18f:	7f b3                	jg     144 <gets+0xf>
+ 191:	eb 01                	jmp    194 <gets+0x5f>
+            break;
+ 193:	90                   	nop
+            break;
+    }
+    buf[i] = '\0';
+ 194:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 197:	8b 45 08             	mov    0x8(%ebp),%eax
+ 19a:	01 d0                	add    %edx,%eax
+ 19c:	c6 00 00             	movb   $0x0,(%eax)
+    return buf;
+ 19f:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 1a2:	c9                   	leave
+ 1a3:	c3                   	ret
+
+000001a4 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 1a4:	55                   	push   %ebp
+ 1a5:	89 e5                	mov    %esp,%ebp
+ 1a7:	83 ec 18             	sub    $0x18,%esp
+    int fd;
+    int r;
+
+    fd = open(n, O_RDONLY);
+ 1aa:	83 ec 08             	sub    $0x8,%esp
+ 1ad:	6a 00                	push   $0x0
+ 1af:	ff 75 08             	push   0x8(%ebp)
+ 1b2:	e8 c6 01 00 00       	call   37d <open>
+ 1b7:	83 c4 10             	add    $0x10,%esp
+ 1ba:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(fd < 0)
+ 1bd:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 1c1:	79 07                	jns    1ca <stat+0x26>
+        return -1;
+ 1c3:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 1c8:	eb 25                	jmp    1ef <stat+0x4b>
+    r = fstat(fd, st);
+ 1ca:	83 ec 08             	sub    $0x8,%esp
+ 1cd:	ff 75 0c             	push   0xc(%ebp)
+ 1d0:	ff 75 f4             	push   -0xc(%ebp)
+ 1d3:	e8 c3 01 00 00       	call   39b <fstat>
+ 1d8:	83 c4 10             	add    $0x10,%esp
+ 1db:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    close(fd);
+ 1de:	83 ec 0c             	sub    $0xc,%esp
+ 1e1:	ff 75 f4             	push   -0xc(%ebp)
+ 1e4:	e8 76 01 00 00       	call   35f <close>
+ 1e9:	83 c4 10             	add    $0x10,%esp
+    return r;
+ 1ec:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ 1ef:	c9                   	leave
+ 1f0:	c3                   	ret
+
+000001f1 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 1f1:	55                   	push   %ebp
+ 1f2:	89 e5                	mov    %esp,%ebp
+ 1f4:	83 ec 10             	sub    $0x10,%esp
+    int n;
+
+    n = 0;
+ 1f7:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+    while('0' <= *s && *s <= '9')
+ 1fe:	eb 25                	jmp    225 <atoi+0x34>
+        n = n*10 + *s++ - '0';
+ 200:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 203:	89 d0                	mov    %edx,%eax
+ 205:	c1 e0 02             	shl    $0x2,%eax
+ 208:	01 d0                	add    %edx,%eax
+ 20a:	01 c0                	add    %eax,%eax
+ 20c:	89 c1                	mov    %eax,%ecx
+ 20e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 211:	8d 50 01             	lea    0x1(%eax),%edx
+ 214:	89 55 08             	mov    %edx,0x8(%ebp)
+ 217:	0f b6 00             	movzbl (%eax),%eax
+ 21a:	0f be c0             	movsbl %al,%eax
+ 21d:	01 c8                	add    %ecx,%eax
+ 21f:	83 e8 30             	sub    $0x30,%eax
+ 222:	89 45 fc             	mov    %eax,-0x4(%ebp)
+    while('0' <= *s && *s <= '9')
+ 225:	8b 45 08             	mov    0x8(%ebp),%eax
+ 228:	0f b6 00             	movzbl (%eax),%eax
+ 22b:	3c 2f                	cmp    $0x2f,%al
+ 22d:	7e 0a                	jle    239 <atoi+0x48>
+ 22f:	8b 45 08             	mov    0x8(%ebp),%eax
+ 232:	0f b6 00             	movzbl (%eax),%eax
+ 235:	3c 39                	cmp    $0x39,%al
+ 237:	7e c7                	jle    200 <atoi+0xf>
+    return n;
+ 239:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 23c:	c9                   	leave
+ 23d:	c3                   	ret
+
+0000023e <nice>:
+
+// Add inc to the caller's nice value; return the new value.
+int
+nice(int inc)
+{
+ 23e:	55                   	push   %ebp
+ 23f:	89 e5                	mov    %esp,%ebp
+ 241:	83 ec 18             	sub    $0x18,%esp
+    int n;
+
+    n = getpriority(0) + inc;
+ 244:	83 ec 0c             	sub    $0xc,%esp
+ 247:	6a 00                	push   $0x0
+ 249:	e8 d9 01 00 00       	call   427 <getpriority>
+ 24e:	83 c4 10             	add    $0x10,%esp
+ 251:	8b 55 08             	mov    0x8(%ebp),%edx
+ 254:	01 d0                	add    %edx,%eax
+ 256:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(n < 0)
+ 259:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 25d:	79 07                	jns    266 <nice+0x28>
+        n = 0;
+ 25f:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    if(n > NICEMAX)
+ 266:	83 7d f4 13          	cmpl   $0x13,-0xc(%ebp)
+ 26a:	7e 07                	jle    273 <nice+0x35>
+        n = NICEMAX;
+ 26c:	c7 45 f4 13 00 00 00 	movl   $0x13,-0xc(%ebp)
+    if(setpriority(0, n) < 0)
+ 273:	83 ec 08             	sub    $0x8,%esp
+ 276:	ff 75 f4             	push   -0xc(%ebp)
+ 279:	6a 00                	push   $0x0
+ 27b:	e8 b1 01 00 00       	call   431 <setpriority>
+ 280:	83 c4 10             	add    $0x10,%esp
+ 283:	85 c0                	test   %eax,%eax
+ 285:	79 07                	jns    28e <nice+0x50>
+        return -1;
+ 287:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 28c:	eb 03                	jmp    291 <nice+0x53>
+    return n;
+ 28e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+ 291:	c9                   	leave
+ 292:	c3                   	ret
+
+00000293 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 293:	55                   	push   %ebp
+ 294:	89 e5                	mov    %esp,%ebp
+ 296:	83 ec 10             	sub    $0x10,%esp
+    char *dst;
+    const char *src;
+
+    dst = vdst;
+ 299:	8b 45 08             	mov    0x8(%ebp),%eax
+ 29c:	89 45 fc             	mov    %eax,-0x4(%ebp)
+    src = vsrc;
+ 29f:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 2a2:	89 45 f8             	mov    %eax,-0x8(%ebp)
+    while(n-- > 0)
+ 2a5:	eb 17                	jmp    2be <memmove+0x2b>
+        *dst++ = *src++;
+ 2a7:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 2aa:	8d 42 01             	lea    0x1(%edx),%eax
+ 2ad:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 2b0:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 2b3:	8d 48 01             	lea    0x1(%eax),%ecx
+ 2b6:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+ 2b9:	0f b6 12             	movzbl (%edx),%edx
+ 2bc:	88 10                	mov    %dl,(%eax)
+    while(n-- > 0)
+ 2be:	8b 45 10             	mov    0x10(%ebp),%eax
+ 2c1:	8d 50 ff             	lea    -0x1(%eax),%edx
+ 2c4:	89 55 10             	mov    %edx,0x10(%ebp)
+ 2c7:	85 c0                	test   %eax,%eax
+ 2c9:	7f dc                	jg     2a7 <memmove+0x14>
+    return vdst;
+ 2cb:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 2ce:	c9                   	leave
+ 2cf:	c3                   	ret
+
+000002d0 <dosyscall>:
+sysmode:
+    .long 0
+
+    .text
+dosyscall:
+    cmpl $0, sysmode
+ 2d0:	83 3d 58 0c 00 00 00 	cmpl   $0x0,0xc58
+    jg 2f
+ 2d7:	7f 0c                	jg     2e5 <dosyscall+0x15>
+    jl 1f
+ 2d9:	7c 07                	jl     2e2 <dosyscall+0x12>
+    call sepcheck
+ 2db:	e8 27 00 00 00       	call   307 <sepcheck>
+    jmp dosyscall
+ 2e0:	eb ee                	jmp    2d0 <dosyscall>
+1:
+    int $T_SYSCALL
+ 2e2:	cd 40                	int    $0x40
+    ret
+ 2e4:	c3                   	ret
+2:
+    pushl %ebx
+ 2e5:	53                   	push   %ebx
+    pushl %esi
+ 2e6:	56                   	push   %esi
+    pushl %edi
+ 2e7:	57                   	push   %edi
+    pushl %ebp
+ 2e8:	55                   	push   %ebp
+    movl 20(%esp), %ebx
+ 2e9:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+    movl 24(%esp), %esi
+ 2ed:	8b 74 24 18          	mov    0x18(%esp),%esi
+    movl 28(%esp), %edi
+ 2f1:	8b 7c 24 1c          	mov    0x1c(%esp),%edi
+    movl 32(%esp), %ebp
+ 2f5:	8b 6c 24 20          	mov    0x20(%esp),%ebp
+    movl %esp, %ecx
+ 2f9:	89 e1                	mov    %esp,%ecx
+    movl $3f, %edx
+ 2fb:	ba 02 03 00 00       	mov    $0x302,%edx
+    sysenter
+ 300:	0f 34                	sysenter
+3:
+    popl %ebp
+ 302:	5d                   	pop    %ebp
+    popl %edi
+ 303:	5f                   	pop    %edi
+    popl %esi
+ 304:	5e                   	pop    %esi
+    popl %ebx
+ 305:	5b                   	pop    %ebx
+    ret
+ 306:	c3                   	ret
+
+00000307 <sepcheck>:
+
+# Set sysmode from cpuid's SEP flag.    Preserves %eax.
+sepcheck:
+    pushl %eax
+ 307:	50                   	push   %eax
+    pushl %ebx
+ 308:	53                   	push   %ebx
+    movl $1, %eax
+ 309:	b8 01 00 00 00       	mov    $0x1,%eax
+    cpuid
+ 30e:	0f a2                	cpuid
+    movl $-1, sysmode
+ 310:	c7 05 58 0c 00 00 ff 	movl   $0xffffffff,0xc58
+ 317:	ff ff ff 
+    testl $0x800, %edx
+ 31a:	f7 c2 00 08 00 00    	test   $0x800,%edx
+    jz 1f
+ 320:	74 0a                	je     32c <sepcheck+0x25>
+    movl $1, sysmode
+ 322:	c7 05 58 0c 00 00 01 	movl   $0x1,0xc58
+ 329:	00 00 00 
+1:
+    popl %ebx
+ 32c:	5b                   	pop    %ebx
+    popl %eax
+ 32d:	58                   	pop    %eax
+    ret
+ 32e:	c3                   	ret
+
+0000032f <fork>:
+
+SYSCALL(fork)
+ 32f:	b8 01 00 00 00       	mov    $0x1,%eax
+ 334:	eb 9a                	jmp    2d0 <dosyscall>
+
+00000336 <exit>:
+SYSCALL(exit)
+ 336:	b8 02 00 00 00       	mov    $0x2,%eax
+ 33b:	eb 93                	jmp    2d0 <dosyscall>
+
+0000033d <wait>:
+SYSCALL(wait)
+ 33d:	b8 03 00 00 00       	mov    $0x3,%eax
+ 342:	eb 8c                	jmp    2d0 <dosyscall>
+
+00000344 <pipe>:
+SYSCALL(pipe)
+ 344:	b8 04 00 00 00       	mov    $0x4,%eax
+ 349:	eb 85                	jmp    2d0 <dosyscall>
+
+0000034b <read>:
+SYSCALL(read)
+ 34b:	b8 05 00 00 00       	mov    $0x5,%eax
+ 350:	e9 7b ff ff ff       	jmp    2d0 <dosyscall>
+
+00000355 <write>:
+SYSCALL(write)
+ 355:	b8 10 00 00 00       	mov    $0x10,%eax
+ 35a:	e9 71 ff ff ff       	jmp    2d0 <dosyscall>
+
+0000035f <close>:
+SYSCALL(close)
+ 35f:	b8 15 00 00 00       	mov    $0x15,%eax
+ 364:	e9 67 ff ff ff       	jmp    2d0 <dosyscall>
+
+00000369 <kill>:
+SYSCALL(kill)
+ 369:	b8 06 00 00 00       	mov    $0x6,%eax
+ 36e:	e9 5d ff ff ff       	jmp    2d0 <dosyscall>
+
+00000373 <exec>:
+SYSCALL(exec)
+ 373:	b8 07 00 00 00       	mov    $0x7,%eax
+ 378:	e9 53 ff ff ff       	jmp    2d0 <dosyscall>
+
+0000037d <open>:
+SYSCALL(open)
+ 37d:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 382:	e9 49 ff ff ff       	jmp    2d0 <dosyscall>
+
+00000387 <mknod>:
+SYSCALL(mknod)
+ 387:	b8 11 00 00 00       	mov    $0x11,%eax
+ 38c:	e9 3f ff ff ff       	jmp    2d0 <dosyscall>
+
+00000391 <unlink>:
+SYSCALL(unlink)
+ 391:	b8 12 00 00 00       	mov    $0x12,%eax
+ 396:	e9 35 ff ff ff       	jmp    2d0 <dosyscall>
+
+0000039b <fstat>:
+SYSCALL(fstat)
+ 39b:	b8 08 00 00 00       	mov    $0x8,%eax
+ 3a0:	e9 2b ff ff ff       	jmp    2d0 <dosyscall>
+
+000003a5 <link>:
+SYSCALL(link)
+ 3a5:	b8 13 00 00 00       	mov    $0x13,%eax
+ 3aa:	e9 21 ff ff ff       	jmp    2d0 <dosyscall>
+
+000003af <mkdir>:
+SYSCALL(mkdir)
+ 3af:	b8 14 00 00 00       	mov    $0x14,%eax
+ 3b4:	e9 17 ff ff ff       	jmp    2d0 <dosyscall>
+
+000003b9 <chdir>:
+SYSCALL(chdir)
+ 3b9:	b8 09 00 00 00       	mov    $0x9,%eax
+ 3be:	e9 0d ff ff ff       	jmp    2d0 <dosyscall>
+
+000003c3 <dup>:
+SYSCALL(dup)
+ 3c3:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 3c8:	e9 03 ff ff ff       	jmp    2d0 <dosyscall>
+
+000003cd <getpid>:
+SYSCALL(getpid)
+ 3cd:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 3d2:	e9 f9 fe ff ff       	jmp    2d0 <dosyscall>
+
+000003d7 <sbrk>:
+SYSCALL(sbrk)
+ 3d7:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 3dc:	e9 ef fe ff ff       	jmp    2d0 <dosyscall>
+
+000003e1 <sleep>:
+SYSCALL(sleep)
+ 3e1:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 3e6:	e9 e5 fe ff ff       	jmp    2d0 <dosyscall>
+
+000003eb <uptime>:
+SYSCALL(uptime)
+ 3eb:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 3f0:	e9 db fe ff ff       	jmp    2d0 <dosyscall>
+
+000003f5 <date>:
+SYSCALL(date)
+ 3f5:	b8 16 00 00 00       	mov    $0x16,%eax
+ 3fa:	e9 d1 fe ff ff       	jmp    2d0 <dosyscall>
+
+000003ff <dup2>:
+SYSCALL(dup2)
+ 3ff:	b8 17 00 00 00       	mov    $0x17,%eax
+ 404:	e9 c7 fe ff ff       	jmp    2d0 <dosyscall>
+
+00000409 <uffd>:
+SYSCALL(uffd)
+ 409:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 40e:	e9 bd fe ff ff       	jmp    2d0 <dosyscall>
+
+00000413 <uffdregister>:
+SYSCALL(uffdregister)
+ 413:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 418:	e9 b3 fe ff ff       	jmp    2d0 <dosyscall>
+
+0000041d <uffdcopy>:
+SYSCALL(uffdcopy)
+ 41d:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 422:	e9 a9 fe ff ff       	jmp    2d0 <dosyscall>
+
+00000427 <getpriority>:
+SYSCALL(getpriority)
+ 427:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 42c:	e9 9f fe ff ff       	jmp    2d0 <dosyscall>
+
+00000431 <setpriority>:
+SYSCALL(setpriority)
+ 431:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 436:	e9 95 fe ff ff       	jmp    2d0 <dosyscall>
+
+0000043b <setweight>:
+SYSCALL(setweight)
+ 43b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 440:	e9 8b fe ff ff       	jmp    2d0 <dosyscall>
+
+00000445 <setgroup>:
+SYSCALL(setgroup)
+ 445:	b8 20 00 00 00       	mov    $0x20,%eax
+ 44a:	e9 81 fe ff ff       	jmp    2d0 <dosyscall>
+
+0000044f <schedinfo>:
+SYSCALL(schedinfo)
+ 44f:	b8 21 00 00 00       	mov    $0x21,%eax
+ 454:	e9 77 fe ff ff       	jmp    2d0 <dosyscall>
+
+00000459 <nanosleep>:
+SYSCALL(nanosleep)
+ 459:	b8 22 00 00 00       	mov    $0x22,%eax
+ 45e:	e9 6d fe ff ff       	jmp    2d0 <dosyscall>
+
+00000463 <clock_nanosleep>:
+SYSCALL(clock_nanosleep)
+ 463:	b8 23 00 00 00       	mov    $0x23,%eax
+ 468:	e9 63 fe ff ff       	jmp    2d0 <dosyscall>
+
+0000046d <clock_gettime>:
+SYSCALL(clock_gettime)
+ 46d:	b8 24 00 00 00       	mov    $0x24,%eax
+ 472:	e9 59 fe ff ff       	jmp    2d0 <dosyscall>
+
+00000477 <sched_setaffinity>:
+SYSCALL(sched_setaffinity)
+ 477:	b8 25 00 00 00       	mov    $0x25,%eax
+ 47c:	e9 4f fe ff ff       	jmp    2d0 <dosyscall>
+
+00000481 <sched_getaffinity>:
+SYSCALL(sched_getaffinity)
+ 481:	b8 26 00 00 00       	mov    $0x26,%eax
+ 486:	e9 45 fe ff ff       	jmp    2d0 <dosyscall>
+
+0000048b <irqaffinity>:
+SYSCALL(irqaffinity)
+ 48b:	b8 27 00 00 00       	mov    $0x27,%eax
+ 490:	e9 3b fe ff ff       	jmp    2d0 <dosyscall>
+
+00000495 <getrusage>:
+SYSCALL(getrusage)
+ 495:	b8 28 00 00 00       	mov    $0x28,%eax
+ 49a:	e9 31 fe ff ff       	jmp    2d0 <dosyscall>
+
+0000049f <times>:
+SYSCALL(times)
+ 49f:	b8 29 00 00 00       	mov    $0x29,%eax
+ 4a4:	e9 27 fe ff ff       	jmp    2d0 <dosyscall>
+
+000004a9 <schedlat>:
+SYSCALL(schedlat)
+ 4a9:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 4ae:	e9 1d fe ff ff       	jmp    2d0 <dosyscall>
+
+000004b3 <sched_setscheduler>:
+SYSCALL(sched_setscheduler)
+ 4b3:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 4b8:	e9 13 fe ff ff       	jmp    2d0 <dosyscall>
+
+000004bd <sched_getscheduler>:
+SYSCALL(sched_getscheduler)
+ 4bd:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 4c2:	e9 09 fe ff ff       	jmp    2d0 <dosyscall>
+
+000004c7 <sched_getparam>:
+SYSCALL(sched_getparam)
+ 4c7:	b8 2d 00 00 00       	mov    $0x2d,%eax
+ 4cc:	e9 ff fd ff ff       	jmp    2d0 <dosyscall>
+
+000004d1 <lockstat>:
+SYSCALL(lockstat)
+ 4d1:	b8 2e 00 00 00       	mov    $0x2e,%eax
+ 4d6:	e9 f5 fd ff ff       	jmp    2d0 <dosyscall>
+
+000004db <ioring_setup>:
+SYSCALL(ioring_setup)
+ 4db:	b8 2f 00 00 00       	mov    $0x2f,%eax
+ 4e0:	e9 eb fd ff ff       	jmp    2d0 <dosyscall>
+
+000004e5 <ioring_enter>:
+SYSCALL(ioring_enter)
+ 4e5:	b8 30 00 00 00       	mov    $0x30,%eax
+ 4ea:	e9 e1 fd ff ff       	jmp    2d0 <dosyscall>
+
+000004ef <readv>:
+SYSCALL(readv)
+ 4ef:	b8 31 00 00 00       	mov    $0x31,%eax
+ 4f4:	e9 d7 fd ff ff       	jmp    2d0 <dosyscall>
+
+000004f9 <writev>:
+SYSCALL(writev)
+ 4f9:	b8 32 00 00 00       	mov    $0x32,%eax
+ 4fe:	e9 cd fd ff ff       	jmp    2d0 <dosyscall>
+
+00000503 <pread>:
+SYSCALL(pread)
+ 503:	b8 33 00 00 00       	mov    $0x33,%eax
+ 508:	e9 c3 fd ff ff       	jmp    2d0 <dosyscall>
+
+0000050d <pwrite>:
+SYSCALL(pwrite)
+ 50d:	b8 34 00 00 00       	mov    $0x34,%eax
+ 512:	e9 b9 fd ff ff       	jmp    2d0 <dosyscall>
+
+00000517 <sendfile>:
+SYSCALL(sendfile)
+ 517:	b8 35 00 00 00       	mov    $0x35,%eax
+ 51c:	e9 af fd ff ff       	jmp    2d0 <dosyscall>
+
+00000521 <splice>:
+SYSCALL(splice)
+ 521:	b8 36 00 00 00       	mov    $0x36,%eax
+ 526:	e9 a5 fd ff ff       	jmp    2d0 <dosyscall>
+
+0000052b <sysstat>:
+SYSCALL(sysstat)
+ 52b:	b8 37 00 00 00       	mov    $0x37,%eax
+ 530:	e9 9b fd ff ff       	jmp    2d0 <dosyscall>
+
+00000535 <strace>:
+SYSCALL(strace)
+ 535:	b8 38 00 00 00       	mov    $0x38,%eax
+ 53a:	e9 91 fd ff ff       	jmp    2d0 <dosyscall>
+
+0000053f <straceread>:
+SYSCALL(straceread)
+ 53f:	b8 39 00 00 00       	mov    $0x39,%eax
+ 544:	e9 87 fd ff ff       	jmp    2d0 <dosyscall>
+
+00000549 <alarm>:
+
+# alarm and rstoregs keep to int $T_SYSCALL: rstoregs restores
+# %ecx and %edx, which sysexit would clobber.
+.globl alarm
+    alarm:
+        pushl $rstoregs
+ 549:	68 59 05 00 00       	push   $0x559
+        movl $SYS_alarm, %eax
+ 54e:	b8 18 00 00 00       	mov    $0x18,%eax
+        int $T_SYSCALL
+ 553:	cd 40                	int    $0x40
+        add $0x04, %esp
+ 555:	83 c4 04             	add    $0x4,%esp
+        ret
+ 558:	c3                   	ret
+
+00000559 <rstoregs>:
+
+.globl rstoregs
+    rstoregs:
+        movl $SYS_rstoregs, %eax
+ 559:	b8 19 00 00 00       	mov    $0x19,%eax
+        int $T_SYSCALL
+ 55e:	cd 40                	int    $0x40
+
+00000560 <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 560:	55                   	push   %ebp
+ 561:	89 e5                	mov    %esp,%ebp
+ 563:	83 ec 18             	sub    $0x18,%esp
+ 566:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 569:	88 45 f4             	mov    %al,-0xc(%ebp)
+    write(fd, &c, 1);
+ 56c:	83 ec 04             	sub    $0x4,%esp
+ 56f:	6a 01                	push   $0x1
+ 571:	8d 45 f4             	lea    -0xc(%ebp),%eax
+ 574:	50                   	push   %eax
+ 575:	ff 75 08             	push   0x8(%ebp)
+ 578:	e8 d8 fd ff ff       	call   355 <write>
+ 57d:	83 c4 10             	add    $0x10,%esp
+}
+ 580:	90                   	nop
+ 581:	c9                   	leave
+ 582:	c3                   	ret
+
+00000583 <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 583:	55                   	push   %ebp
+ 584:	89 e5                	mov    %esp,%ebp
+ 586:	83 ec 28             	sub    $0x28,%esp
+    static char digits[] = "0123456789ABCDEF";
+    char buf[16];
+    int i, neg;
+    uint x;
+
+    neg = 0;
+ 589:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+    if(sgn && xx < 0){
+ 590:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+ 594:	74 17                	je     5ad <printint+0x2a>
+ 596:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 59a:	79 11                	jns    5ad <printint+0x2a>
+        neg = 1;
+ 59c:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+        x = -xx;
+ 5a3:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 5a6:	f7 d8                	neg    %eax
+ 5a8:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 5ab:	eb 06                	jmp    5b3 <printint+0x30>
+    } else {
+        x = xx;
+ 5ad:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 5b0:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    }
+
+    i = 0;
+ 5b3:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    do{
+        buf[i++] = digits[x % base];
+ 5ba:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 5bd:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 5c0:	ba 00 00 00 00       	mov    $0x0,%edx
+ 5c5:	f7 f1                	div    %ecx
+ 5c7:	89 d1                	mov    %edx,%ecx
+ 5c9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 5cc:	8d 50 01             	lea    0x1(%eax),%edx
+ 5cf:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 5d2:	0f b6 91 5c 0c 00 00 	movzbl 0xc5c(%ecx),%edx
+ 5d9:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+    }while((x /= base) != 0);
+ 5dd:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 5e0:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 5e3:	ba 00 00 00 00       	mov    $0x0,%edx
+ 5e8:	f7 f1                	div    %ecx
+ 5ea:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 5ed:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 5f1:	75 c7                	jne    5ba <printint+0x37>
+    if(neg)
+ 5f3:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 5f7:	74 2d                	je     626 <printint+0xa3>
+        buf[i++] = '-';
+ 5f9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 5fc:	8d 50 01             	lea    0x1(%eax),%edx
+ 5ff:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 602:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+    while(--i >= 0)
+ 607:	eb 1d                	jmp    626 <printint+0xa3>
+        putc(fd, buf[i]);
+ 609:	8d 55 dc             	lea    -0x24(%ebp),%edx
+ 60c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 60f:	01 d0                	add    %edx,%eax
+ 611:	0f b6 00             	movzbl (%eax),%eax
+ 614:	0f be c0             	movsbl %al,%eax
+ 617:	83 ec 08             	sub    $0x8,%esp
+ 61a:	50                   	push   %eax
+ 61b:	ff 75 08             	push   0x8(%ebp)
+ 61e:	e8 3d ff ff ff       	call   560 <putc>
+ 623:	83 c4 10             	add    $0x10,%esp
+    while(--i >= 0)
+ 626:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+ 62a:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 62e:	79 d9                	jns    609 <printint+0x86>
+}
+ 630:	90                   	nop
+ 631:	90                   	nop
+ 632:	c9                   	leave
+ 633:	c3                   	ret
+
+00000634 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 634:	55                   	push   %ebp
+ 635:	89 e5                	mov    %esp,%ebp
+ 637:	83 ec 28             	sub    $0x28,%esp
+    char *s;
+    int c, i, state;
+    uint *ap;
+
+    state = 0;
+ 63a:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+    ap = (uint*)(void*)&fmt + 1;
+ 641:	8d 45 0c             	lea    0xc(%ebp),%eax
+ 644:	83 c0 04             	add    $0x4,%eax
+ 647:	89 45 e8             	mov    %eax,-0x18(%ebp)
+    for(i = 0; fmt[i]; i++){
+ 64a:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 651:	e9 59 01 00 00       	jmp    7af <printf+0x17b>
+        c = fmt[i] & 0xff;
+ 656:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 659:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 65c:	01 d0                	add    %edx,%eax
+ 65e:	0f b6 00             	movzbl (%eax),%eax
+ 661:	0f be c0             	movsbl %al,%eax
+ 664:	25 ff 00 00 00       	and    $0xff,%eax
+ 669:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        if(state == 0){
+ 66c:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 670:	75 2c                	jne    69e <printf+0x6a>
+            if(c == '%'){
+ 672:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 676:	75 0c                	jne    684 <printf+0x50>
+                state = '%';
+ 678:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+ 67f:	e9 27 01 00 00       	jmp    7ab <printf+0x177>
+            } else {
+                putc(fd, c);
+ 684:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 687:	0f be c0             	movsbl %al,%eax
+ 68a:	83 ec 08             	sub    $0x8,%esp
+ 68d:	50                   	push   %eax
+ 68e:	ff 75 08             	push   0x8(%ebp)
+ 691:	e8 ca fe ff ff       	call   560 <putc>
+ 696:	83 c4 10             	add    $0x10,%esp
+ 699:	e9 0d 01 00 00       	jmp    7ab <printf+0x177>
+            }
+        } else if(state == '%'){
+ 69e:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+ 6a2:	0f 85 03 01 00 00    	jne    7ab <printf+0x177>
+            if(c == 'd'){
+ 6a8:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+ 6ac:	75 1e                	jne    6cc <printf+0x98>
+                printint(fd, *ap, 10, 1);
+ 6ae:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 6b1:	8b 00                	mov    (%eax),%eax
+ 6b3:	6a 01                	push   $0x1
+ 6b5:	6a 0a                	push   $0xa
+ 6b7:	50                   	push   %eax
+ 6b8:	ff 75 08             	push   0x8(%ebp)
+ 6bb:	e8 c3 fe ff ff       	call   583 <printint>
+ 6c0:	83 c4 10             	add    $0x10,%esp
+                ap++;
+ 6c3:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 6c7:	e9 d8 00 00 00       	jmp    7a4 <printf+0x170>
+            } else if(c == 'x' || c == 'p'){
+ 6cc:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+ 6d0:	74 06                	je     6d8 <printf+0xa4>
+ 6d2:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+ 6d6:	75 1e                	jne    6f6 <printf+0xc2>
+                printint(fd, *ap, 16, 0);
+ 6d8:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 6db:	8b 00                	mov    (%eax),%eax
+ 6dd:	6a 00                	push   $0x0
+ 6df:	6a 10                	push   $0x10
+ 6e1:	50                   	push   %eax
+ 6e2:	ff 75 08             	push   0x8(%ebp)
+ 6e5:	e8 99 fe ff ff       	call   583 <printint>
+ 6ea:	83 c4 10             	add    $0x10,%esp
+                ap++;
+ 6ed:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 6f1:	e9 ae 00 00 00       	jmp    7a4 <printf+0x170>
+            } else if(c == 's'){
+ 6f6:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+ 6fa:	75 43                	jne    73f <printf+0x10b>
+                s = (char*)*ap;
+ 6fc:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 6ff:	8b 00                	mov    (%eax),%eax
+ 701:	89 45 f4             	mov    %eax,-0xc(%ebp)
+                ap++;
+ 704:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+                if(s == 0)
+ 708:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 70c:	75 25                	jne    733 <printf+0xff>
+                    s = "(null)";
+ 70e:	c7 45 f4 eb 09 00 00 	movl   $0x9eb,-0xc(%ebp)
+                while(*s != 0){
+ 715:	eb 1c                	jmp    733 <printf+0xff>
+                    putc(fd, *s);
+ 717:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 71a:	0f b6 00             	movzbl (%eax),%eax
+ 71d:	0f be c0             	movsbl %al,%eax
+ 720:	83 ec 08             	sub    $0x8,%esp
+ 723:	50                   	push   %eax
+ 724:	ff 75 08             	push   0x8(%ebp)
+ 727:	e8 34 fe ff ff       	call   560 <putc>
+ 72c:	83 c4 10             	add    $0x10,%esp
+                    s++;
+ 72f:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+                while(*s != 0){
+ 733:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 736:	0f b6 00             	movzbl (%eax),%eax
+ 739:	84 c0                	test   %al,%al
+ 73b:	75 da                	jne    717 <printf+0xe3>
+ 73d:	eb 65                	jmp    7a4 <printf+0x170>
+                }
+            } else if(c == 'c'){
+ 73f:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+ 743:	75 1d                	jne    762 <printf+0x12e>
+                putc(fd, *ap);
+ 745:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 748:	8b 00                	mov    (%eax),%eax
+ 74a:	0f be c0             	movsbl %al,%eax
+ 74d:	83 ec 08             	sub    $0x8,%esp
+ 750:	50                   	push   %eax
+ 751:	ff 75 08             	push   0x8(%ebp)
+ 754:	e8 07 fe ff ff       	call   560 <putc>
+ 759:	83 c4 10             	add    $0x10,%esp
+                ap++;
+ 75c:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 760:	eb 42                	jmp    7a4 <printf+0x170>
+            } else if(c == '%'){
+ 762:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 766:	75 17                	jne    77f <printf+0x14b>
+                putc(fd, c);
+ 768:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 76b:	0f be c0             	movsbl %al,%eax
+ 76e:	83 ec 08             	sub    $0x8,%esp
+ 771:	50                   	push   %eax
+ 772:	ff 75 08             	push   0x8(%ebp)
+ 775:	e8 e6 fd ff ff       	call   560 <putc>
+ 77a:	83 c4 10             	add    $0x10,%esp
+ 77d:	eb 25                	jmp    7a4 <printf+0x170>
+            } else {
+                // Unknown % sequence.    Print it to draw attention.
+                putc(fd, '%');
+ 77f:	83 ec 08             	sub    $0x8,%esp
+ 782:	6a 25                	push   $0x25
+ 784:	ff 75 08             	push   0x8(%ebp)
+ 787:	e8 d4 fd ff ff       	call   560 <putc>
+ 78c:	83 c4 10             	add    $0x10,%esp
+                putc(fd, c);
+ 78f:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 792:	0f be c0             	movsbl %al,%eax
+ 795:	83 ec 08             	sub    $0x8,%esp
+ 798:	50                   	push   %eax
+ 799:	ff 75 08             	push   0x8(%ebp)
+ 79c:	e8 bf fd ff ff       	call   560 <putc>
+ 7a1:	83 c4 10             	add    $0x10,%esp
+            }
+            state = 0;
+ 7a4:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+    for(i = 0; fmt[i]; i++){
+ 7ab:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ 7af:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 7b2:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 7b5:	01 d0                	add    %edx,%eax
+ 7b7:	0f b6 00             	movzbl (%eax),%eax
+ 7ba:	84 c0                	test   %al,%al
+ 7bc:	0f 85 94 fe ff ff    	jne    656 <printf+0x22>
+        }
+    }
+}
+ 7c2:	90                   	nop
+ 7c3:	90                   	nop
+ 7c4:	c9                   	leave
+ 7c5:	c3                   	ret
+
+000007c6 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 7c6:	55                   	push   %ebp
+ 7c7:	89 e5                	mov    %esp,%ebp
+ 7c9:	83 ec 10             	sub    $0x10,%esp
+    Header *bp, *p;
+
+    bp = (Header*)ap - 1;
+ 7cc:	8b 45 08             	mov    0x8(%ebp),%eax
+ 7cf:	83 e8 08             	sub    $0x8,%eax
+ 7d2:	89 45 f8             	mov    %eax,-0x8(%ebp)
+    for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 7d5:	a1 78 0c 00 00       	mov    0xc78,%eax
+ 7da:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 7dd:	eb 24                	jmp    803 <free+0x3d>
+        if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 7df:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 7e2:	8b 00                	mov    (%eax),%eax
+ 7e4:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 7e7:	72 12                	jb     7fb <free+0x35>
+ 7e9:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 7ec:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 7ef:	72 24                	jb     815 <free+0x4f>
+ 7f1:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 7f4:	8b 00                	mov    (%eax),%eax
+ 7f6:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 7f9:	72 1a                	jb     815 <free+0x4f>
+    for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 7fb:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 7fe:	8b 00                	mov    (%eax),%eax
+ 800:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 803:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 806:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 809:	73 d4                	jae    7df <free+0x19>
+ 80b:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 80e:	8b 00                	mov    (%eax),%eax
+ 810:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 813:	73 ca                	jae    7df <free+0x19>
+            break;
+    if(bp + bp->s.size == p->s.ptr){
+ 815:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 818:	8b 40 04             	mov    0x4(%eax),%eax
+ 81b:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 822:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 825:	01 c2                	add    %eax,%edx
+ 827:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 82a:	8b 00                	mov    (%eax),%eax
+ 82c:	39 c2                	cmp    %eax,%edx
+ 82e:	75 24                	jne    854 <free+0x8e>
+        bp->s.size += p->s.ptr->s.size;
+ 830:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 833:	8b 50 04             	mov    0x4(%eax),%edx
+ 836:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 839:	8b 00                	mov    (%eax),%eax
+ 83b:	8b 40 04             	mov    0x4(%eax),%eax
+ 83e:	01 c2                	add    %eax,%edx
+ 840:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 843:	89 50 04             	mov    %edx,0x4(%eax)
+        bp->s.ptr = p->s.ptr->s.ptr;
+ 846:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 849:	8b 00                	mov    (%eax),%eax
+ 84b:	8b 10                	mov    (%eax),%edx
+ 84d:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 850:	89 10                	mov    %edx,(%eax)
+ 852:	eb 0a                	jmp    85e <free+0x98>
+    } else
+        bp->s.ptr = p->s.ptr;
+ 854:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 857:	8b 10                	mov    (%eax),%edx
+ 859:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 85c:	89 10                	mov    %edx,(%eax)
+    if(p + p->s.size == bp){
+ 85e:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 861:	8b 40 04             	mov    0x4(%eax),%eax
+ 864:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 86b:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 86e:	01 d0                	add    %edx,%eax
+ 870:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 873:	75 20                	jne    895 <free+0xcf>
+        p->s.size += bp->s.size;
+ 875:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 878:	8b 50 04             	mov    0x4(%eax),%edx
+ 87b:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 87e:	8b 40 04             	mov    0x4(%eax),%eax
+ 881:	01 c2                	add    %eax,%edx
+ 883:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 886:	89 50 04             	mov    %edx,0x4(%eax)
+        p->s.ptr = bp->s.ptr;
+ 889:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 88c:	8b 10                	mov    (%eax),%edx
+ 88e:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 891:	89 10                	mov    %edx,(%eax)
+ 893:	eb 08                	jmp    89d <free+0xd7>
+    } else
+        p->s.ptr = bp;
+ 895:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 898:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 89b:	89 10                	mov    %edx,(%eax)
+    freep = p;
+ 89d:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 8a0:	a3 78 0c 00 00       	mov    %eax,0xc78
+}
+ 8a5:	90                   	nop
+ 8a6:	c9                   	leave
+ 8a7:	c3                   	ret
+
+000008a8 <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+ 8a8:	55                   	push   %ebp
+ 8a9:	89 e5                	mov    %esp,%ebp
+ 8ab:	83 ec 18             	sub    $0x18,%esp
+    char *p;
+    Header *hp;
+
+    if(nu < 4096)
+ 8ae:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+ 8b5:	77 07                	ja     8be <morecore+0x16>
+        nu = 4096;
+ 8b7:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+    p = sbrk(nu * sizeof(Header));
+ 8be:	8b 45 08             	mov    0x8(%ebp),%eax
+ 8c1:	c1 e0 03             	shl    $0x3,%eax
+ 8c4:	83 ec 0c             	sub    $0xc,%esp
+ 8c7:	50                   	push   %eax
+ 8c8:	e8 0a fb ff ff       	call   3d7 <sbrk>
+ 8cd:	83 c4 10             	add    $0x10,%esp
+ 8d0:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p == (char*)-1)
+ 8d3:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+ 8d7:	75 07                	jne    8e0 <morecore+0x38>
+        return 0;
+ 8d9:	b8 00 00 00 00       	mov    $0x0,%eax
+ 8de:	eb 26                	jmp    906 <morecore+0x5e>
+    hp = (Header*)p;
+ 8e0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 8e3:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    hp->s.size = nu;
+ 8e6:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 8e9:	8b 55 08             	mov    0x8(%ebp),%edx
+ 8ec:	89 50 04             	mov    %edx,0x4(%eax)
+    free((void*)(hp + 1));
+ 8ef:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 8f2:	83 c0 08             	add    $0x8,%eax
+ 8f5:	83 ec 0c             	sub    $0xc,%esp
+ 8f8:	50                   	push   %eax
+ 8f9:	e8 c8 fe ff ff       	call   7c6 <free>
+ 8fe:	83 c4 10             	add    $0x10,%esp
+    return freep;
+ 901:	a1 78 0c 00 00       	mov    0xc78,%eax
+}
+ 906:	c9                   	leave
+ 907:	c3                   	ret
+
+00000908 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ 908:	55                   	push   %ebp
+ 909:	89 e5                	mov    %esp,%ebp
+ 90b:	83 ec 18             	sub    $0x18,%esp
+    Header *p, *prevp;
+    uint nunits;
+
+    nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 90e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 911:	83 c0 07             	add    $0x7,%eax
+ 914:	c1 e8 03             	shr    $0x3,%eax
+ 917:	83 c0 01             	add    $0x1,%eax
+ 91a:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    if((prevp = freep) == 0){
+ 91d:	a1 78 0c 00 00       	mov    0xc78,%eax
+ 922:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ 925:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 929:	75 23                	jne    94e <malloc+0x46>
+        base.s.ptr = freep = prevp = &base;
+ 92b:	c7 45 f0 70 0c 00 00 	movl   $0xc70,-0x10(%ebp)
+ 932:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 935:	a3 78 0c 00 00       	mov    %eax,0xc78
+ 93a:	a1 78 0c 00 00       	mov    0xc78,%eax
+ 93f:	a3 70 0c 00 00       	mov    %eax,0xc70
+        base.s.size = 0;
+ 944:	c7 05 74 0c 00 00 00 	movl   $0x0,0xc74
+ 94b:	00 00 00 
+    }
+    for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 94e:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 951:	8b 00                	mov    (%eax),%eax
+ 953:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        if(p->s.size >= nunits){
+ 956:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 959:	8b 40 04             	mov    0x4(%eax),%eax
+ 95c:	3b 45 ec             	cmp    -0x14(%ebp),%eax
+ 95f:	72 4d                	jb     9ae <malloc+0xa6>
+            if(p->s.size == nunits)
+ 961:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 964:	8b 40 04             	mov    0x4(%eax),%eax
+ 967:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+ 96a:	75 0c                	jne    978 <malloc+0x70>
+                prevp->s.ptr = p->s.ptr;
+ 96c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 96f:	8b 10                	mov    (%eax),%edx
+ 971:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 974:	89 10                	mov    %edx,(%eax)
+ 976:	eb 26                	jmp    99e <malloc+0x96>
+            else {
+                p->s.size -= nunits;
+ 978:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 97b:	8b 40 04             	mov    0x4(%eax),%eax
+ 97e:	2b 45 ec             	sub    -0x14(%ebp),%eax
+ 981:	89 c2                	mov    %eax,%edx
+ 983:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 986:	89 50 04             	mov    %edx,0x4(%eax)
+                p += p->s.size;
+ 989:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 98c:	8b 40 04             	mov    0x4(%eax),%eax
+ 98f:	c1 e0 03             	shl    $0x3,%eax
+ 992:	01 45 f4             	add    %eax,-0xc(%ebp)
+                p->s.size = nunits;
+ 995:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 998:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 99b:	89 50 04             	mov    %edx,0x4(%eax)
+            }
+            freep = prevp;
+ 99e:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 9a1:	a3 78 0c 00 00       	mov    %eax,0xc78
+            return (void*)(p + 1);
+ 9a6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 9a9:	83 c0 08             	add    $0x8,%eax
+ 9ac:	eb 3b                	jmp    9e9 <malloc+0xe1>
+        }
+        if(p == freep)
+ 9ae:	a1 78 0c 00 00       	mov    0xc78,%eax
+ 9b3:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ 9b6:	75 1e                	jne    9d6 <malloc+0xce>
+            if((p = morecore(nunits)) == 0)
+ 9b8:	83 ec 0c             	sub    $0xc,%esp
+ 9bb:	ff 75 ec             	push   -0x14(%ebp)
+ 9be:	e8 e5 fe ff ff       	call   8a8 <morecore>
+ 9c3:	83 c4 10             	add    $0x10,%esp
+ 9c6:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ 9c9:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 9cd:	75 07                	jne    9d6 <malloc+0xce>
+                return 0;
+ 9cf:	b8 00 00 00 00       	mov    $0x0,%eax
+ 9d4:	eb 13                	jmp    9e9 <malloc+0xe1>
+    for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 9d6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 9d9:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ 9dc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 9df:	8b 00                	mov    (%eax),%eax
+ 9e1:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        if(p->s.size >= nunits){
+ 9e4:	e9 6d ff ff ff       	jmp    956 <malloc+0x4e>
+    }
+}
+ 9e9:	c9                   	leave
+ 9ea:	c3                   	ret